@@ -0,0 +1,2225 @@
+
+_appendbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+         name, n, b.commits - a.commits, b.logged - a.logged, t);
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	53                   	push   %ebx
+       e:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+      13:	51                   	push   %ecx
+  int n;
+
+  n = argc > 1 ? atoi(argv[1]) : 1000;
+      14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+      17:	8b 41 04             	mov    0x4(%ecx),%eax
+  n = argc > 1 ? atoi(argv[1]) : 1000;
+      1a:	7e 10                	jle    2c <main+0x2c>
+      1c:	83 ec 0c             	sub    $0xc,%esp
+      1f:	ff 70 04             	push   0x4(%eax)
+      22:	e8 69 08 00 00       	call   890 <atoi>
+      27:	83 c4 10             	add    $0x10,%esp
+      2a:	89 c3                	mov    %eax,%ebx
+  memset(rec, 'r', sizeof(rec));
+      2c:	83 ec 04             	sub    $0x4,%esp
+      2f:	6a 40                	push   $0x40
+      31:	6a 72                	push   $0x72
+      33:	68 20 17 00 00       	push   $0x1720
+      38:	e8 93 06 00 00       	call   6d0 <memset>
+  rec[RECSIZE-1] = '\n';
+
+  run("write-back", n, 0);
+      3d:	83 c4 0c             	add    $0xc,%esp
+  rec[RECSIZE-1] = '\n';
+      40:	c6 05 5f 17 00 00 0a 	movb   $0xa,0x175f
+  run("write-back", n, 0);
+      47:	6a 00                	push   $0x0
+      49:	53                   	push   %ebx
+      4a:	68 f4 10 00 00       	push   $0x10f4
+      4f:	e8 cc 01 00 00       	call   220 <run>
+  run("fsync each", n, 1);
+      54:	83 c4 0c             	add    $0xc,%esp
+      57:	6a 01                	push   $0x1
+      59:	53                   	push   %ebx
+      5a:	68 ff 10 00 00       	push   $0x10ff
+      5f:	e8 bc 01 00 00       	call   220 <run>
+
+  unlink(FILENAME);
+      64:	c7 04 24 90 10 00 00 	movl   $0x1090,(%esp)
+      6b:	e8 1d 09 00 00       	call   98d <unlink>
+  exit();
+      70:	e8 bb 04 00 00       	call   530 <exit>
+      75:	66 90                	xchg   %ax,%ax
+      77:	66 90                	xchg   %ax,%ax
+      79:	66 90                	xchg   %ax,%ax
+      7b:	66 90                	xchg   %ax,%ax
+      7d:	66 90                	xchg   %ax,%ax
+      7f:	90                   	nop
+
+00000080 <append>:
+{
+      80:	55                   	push   %ebp
+      81:	89 e5                	mov    %esp,%ebp
+      83:	57                   	push   %edi
+      84:	56                   	push   %esi
+      85:	53                   	push   %ebx
+      86:	83 ec 24             	sub    $0x24,%esp
+      89:	8b 45 08             	mov    0x8(%ebp),%eax
+      8c:	8b 75 0c             	mov    0xc(%ebp),%esi
+      8f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if((fd = open(FILENAME, O_CREATE|O_RDWR)) < 0){
+      92:	68 02 02 00 00       	push   $0x202
+      97:	68 90 10 00 00       	push   $0x1090
+      9c:	e8 d8 08 00 00       	call   979 <open>
+      a1:	83 c4 10             	add    $0x10,%esp
+      a4:	85 c0                	test   %eax,%eax
+      a6:	0f 88 88 00 00 00    	js     134 <append+0xb4>
+  for(i = 0; i < n; i++){
+      ac:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+      af:	31 ff                	xor    %edi,%edi
+      b1:	89 c3                	mov    %eax,%ebx
+      b3:	89 f0                	mov    %esi,%eax
+      b5:	89 fe                	mov    %edi,%esi
+      b7:	89 c7                	mov    %eax,%edi
+      b9:	85 d2                	test   %edx,%edx
+      bb:	7f 0b                	jg     c8 <append+0x48>
+      bd:	eb 52                	jmp    111 <append+0x91>
+      bf:	90                   	nop
+      c0:	83 c6 01             	add    $0x1,%esi
+      c3:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+      c6:	74 49                	je     111 <append+0x91>
+    rec[0] = 'a' + i % 26;
+      c8:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+    if(write(fd, rec, sizeof(rec)) != sizeof(rec)){
+      cd:	83 ec 04             	sub    $0x4,%esp
+    rec[0] = 'a' + i % 26;
+      d0:	f7 e6                	mul    %esi
+      d2:	89 f0                	mov    %esi,%eax
+      d4:	c1 ea 03             	shr    $0x3,%edx
+      d7:	6b d2 1a             	imul   $0x1a,%edx,%edx
+      da:	29 d0                	sub    %edx,%eax
+      dc:	83 c0 61             	add    $0x61,%eax
+      df:	a2 20 17 00 00       	mov    %al,0x1720
+    if(write(fd, rec, sizeof(rec)) != sizeof(rec)){
+      e4:	6a 40                	push   $0x40
+      e6:	68 20 17 00 00       	push   $0x1720
+      eb:	53                   	push   %ebx
+      ec:	e8 6c 08 00 00       	call   95d <write>
+      f1:	83 c4 10             	add    $0x10,%esp
+      f4:	83 f8 40             	cmp    $0x40,%eax
+      f7:	75 27                	jne    120 <append+0xa0>
+    if(sync)
+      f9:	85 ff                	test   %edi,%edi
+      fb:	74 c3                	je     c0 <append+0x40>
+      fsync(fd);
+      fd:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < n; i++){
+     100:	83 c6 01             	add    $0x1,%esi
+      fsync(fd);
+     103:	53                   	push   %ebx
+     104:	e8 74 09 00 00       	call   a7d <fsync>
+     109:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++){
+     10c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+     10f:	75 b7                	jne    c8 <append+0x48>
+  close(fd);
+     111:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     114:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     117:	5b                   	pop    %ebx
+     118:	5e                   	pop    %esi
+     119:	5f                   	pop    %edi
+     11a:	5d                   	pop    %ebp
+  close(fd);
+     11b:	e9 80 04 00 00       	jmp    5a0 <close>
+      printf(2, "appendbench: write failed\n");
+     120:	83 ec 08             	sub    $0x8,%esp
+     123:	68 a0 10 00 00       	push   $0x10a0
+     128:	6a 02                	push   $0x2
+     12a:	e8 b1 0a 00 00       	call   be0 <printf>
+      exit();
+     12f:	e8 fc 03 00 00       	call   530 <exit>
+    printf(2, "appendbench: cannot create %s\n", FILENAME);
+     134:	50                   	push   %eax
+     135:	68 90 10 00 00       	push   $0x1090
+     13a:	68 0c 11 00 00       	push   $0x110c
+     13f:	6a 02                	push   $0x2
+     141:	e8 9a 0a 00 00       	call   be0 <printf>
+    exit();
+     146:	e8 e5 03 00 00       	call   530 <exit>
+     14b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     14f:	90                   	nop
+
+00000150 <verify>:
+{
+     150:	55                   	push   %ebp
+     151:	89 e5                	mov    %esp,%ebp
+     153:	57                   	push   %edi
+     154:	56                   	push   %esi
+     155:	53                   	push   %ebx
+     156:	83 ec 54             	sub    $0x54,%esp
+  if((fd = open(FILENAME, O_RDONLY)) < 0){
+     159:	6a 00                	push   $0x0
+     15b:	68 90 10 00 00       	push   $0x1090
+     160:	e8 14 08 00 00       	call   979 <open>
+     165:	83 c4 10             	add    $0x10,%esp
+     168:	85 c0                	test   %eax,%eax
+     16a:	0f 88 84 00 00 00    	js     1f4 <verify+0xa4>
+  for(i = 0; i < n; i++){
+     170:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     173:	89 c7                	mov    %eax,%edi
+     175:	31 db                	xor    %ebx,%ebx
+     177:	8d 75 a8             	lea    -0x58(%ebp),%esi
+     17a:	85 c9                	test   %ecx,%ecx
+     17c:	7e 3a                	jle    1b8 <verify+0x68>
+     17e:	66 90                	xchg   %ax,%ax
+    if(read(fd, r, sizeof(r)) != sizeof(r) || r[0] != 'a' + i % 26){
+     180:	83 ec 04             	sub    $0x4,%esp
+     183:	6a 40                	push   $0x40
+     185:	56                   	push   %esi
+     186:	57                   	push   %edi
+     187:	e8 ca 07 00 00       	call   956 <read>
+     18c:	83 c4 10             	add    $0x10,%esp
+     18f:	83 f8 40             	cmp    $0x40,%eax
+     192:	75 4b                	jne    1df <verify+0x8f>
+     194:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+     199:	0f be 4d a8          	movsbl -0x58(%ebp),%ecx
+     19d:	f7 e3                	mul    %ebx
+     19f:	89 d8                	mov    %ebx,%eax
+     1a1:	c1 ea 03             	shr    $0x3,%edx
+     1a4:	6b d2 1a             	imul   $0x1a,%edx,%edx
+     1a7:	29 d0                	sub    %edx,%eax
+     1a9:	83 c0 61             	add    $0x61,%eax
+     1ac:	39 c1                	cmp    %eax,%ecx
+     1ae:	75 2f                	jne    1df <verify+0x8f>
+  for(i = 0; i < n; i++){
+     1b0:	83 c3 01             	add    $0x1,%ebx
+     1b3:	39 5d 08             	cmp    %ebx,0x8(%ebp)
+     1b6:	75 c8                	jne    180 <verify+0x30>
+  if(read(fd, r, 1) != 0){
+     1b8:	83 ec 04             	sub    $0x4,%esp
+     1bb:	6a 01                	push   $0x1
+     1bd:	56                   	push   %esi
+     1be:	57                   	push   %edi
+     1bf:	e8 92 07 00 00       	call   956 <read>
+     1c4:	83 c4 10             	add    $0x10,%esp
+     1c7:	85 c0                	test   %eax,%eax
+     1c9:	75 40                	jne    20b <verify+0xbb>
+  close(fd);
+     1cb:	83 ec 0c             	sub    $0xc,%esp
+     1ce:	57                   	push   %edi
+     1cf:	e8 cc 03 00 00       	call   5a0 <close>
+}
+     1d4:	83 c4 10             	add    $0x10,%esp
+     1d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     1da:	5b                   	pop    %ebx
+     1db:	5e                   	pop    %esi
+     1dc:	5f                   	pop    %edi
+     1dd:	5d                   	pop    %ebp
+     1de:	c3                   	ret
+      printf(2, "appendbench: record %d is wrong\n", i);
+     1df:	83 ec 04             	sub    $0x4,%esp
+     1e2:	53                   	push   %ebx
+     1e3:	68 2c 11 00 00       	push   $0x112c
+     1e8:	6a 02                	push   $0x2
+     1ea:	e8 f1 09 00 00       	call   be0 <printf>
+      exit();
+     1ef:	e8 3c 03 00 00       	call   530 <exit>
+    printf(2, "appendbench: cannot open %s\n", FILENAME);
+     1f4:	52                   	push   %edx
+     1f5:	68 90 10 00 00       	push   $0x1090
+     1fa:	68 bb 10 00 00       	push   $0x10bb
+     1ff:	6a 02                	push   $0x2
+     201:	e8 da 09 00 00       	call   be0 <printf>
+    exit();
+     206:	e8 25 03 00 00       	call   530 <exit>
+    printf(2, "appendbench: file too long\n");
+     20b:	50                   	push   %eax
+     20c:	50                   	push   %eax
+     20d:	68 d8 10 00 00       	push   $0x10d8
+     212:	6a 02                	push   $0x2
+     214:	e8 c7 09 00 00       	call   be0 <printf>
+    exit();
+     219:	e8 12 03 00 00       	call   530 <exit>
+     21e:	66 90                	xchg   %ax,%ax
+
+00000220 <run>:
+{
+     220:	55                   	push   %ebp
+     221:	89 e5                	mov    %esp,%ebp
+     223:	57                   	push   %edi
+     224:	56                   	push   %esi
+     225:	53                   	push   %ebx
+     226:	83 ec 48             	sub    $0x48,%esp
+     229:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  unlink(FILENAME);
+     22c:	68 90 10 00 00       	push   $0x1090
+     231:	e8 57 07 00 00       	call   98d <unlink>
+  logstat(&a);
+     236:	8d 45 c0             	lea    -0x40(%ebp),%eax
+     239:	89 04 24             	mov    %eax,(%esp)
+     23c:	e8 32 08 00 00       	call   a73 <logstat>
+  t = uptime();
+     241:	e8 a1 07 00 00       	call   9e7 <uptime>
+     246:	89 c7                	mov    %eax,%edi
+  append(n, sync);
+     248:	58                   	pop    %eax
+     249:	5a                   	pop    %edx
+     24a:	ff 75 10             	push   0x10(%ebp)
+     24d:	53                   	push   %ebx
+     24e:	e8 2d fe ff ff       	call   80 <append>
+  t = uptime() - t;
+     253:	e8 8f 07 00 00       	call   9e7 <uptime>
+     258:	29 f8                	sub    %edi,%eax
+     25a:	89 c6                	mov    %eax,%esi
+  logstat(&b);
+     25c:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     25f:	89 04 24             	mov    %eax,(%esp)
+     262:	e8 0c 08 00 00       	call   a73 <logstat>
+  verify(n);
+     267:	89 1c 24             	mov    %ebx,(%esp)
+     26a:	e8 e1 fe ff ff       	call   150 <verify>
+  printf(1, "%s: %d records, %d commits, %d blocks logged in %d ticks\n",
+     26f:	83 c4 0c             	add    $0xc,%esp
+     272:	56                   	push   %esi
+     273:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     276:	2b 45 c4             	sub    -0x3c(%ebp),%eax
+     279:	50                   	push   %eax
+     27a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     27d:	2b 45 c0             	sub    -0x40(%ebp),%eax
+     280:	50                   	push   %eax
+     281:	53                   	push   %ebx
+     282:	ff 75 08             	push   0x8(%ebp)
+     285:	68 50 11 00 00       	push   $0x1150
+     28a:	6a 01                	push   $0x1
+     28c:	e8 4f 09 00 00       	call   be0 <printf>
+}
+     291:	83 c4 20             	add    $0x20,%esp
+     294:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     297:	5b                   	pop    %ebx
+     298:	5e                   	pop    %esi
+     299:	5f                   	pop    %edi
+     29a:	5d                   	pop    %ebp
+     29b:	c3                   	ret
+     29c:	66 90                	xchg   %ax,%ax
+     29e:	66 90                	xchg   %ax,%ax
+
+000002a0 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+     2a0:	55                   	push   %ebp
+     2a1:	89 e5                	mov    %esp,%ebp
+     2a3:	57                   	push   %edi
+     2a4:	56                   	push   %esi
+     2a5:	53                   	push   %ebx
+     2a6:	83 ec 4c             	sub    $0x4c,%esp
+     2a9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2ac:	8b 55 08             	mov    0x8(%ebp),%edx
+     2af:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     2b2:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+     2b5:	83 fa 0f             	cmp    $0xf,%edx
+     2b8:	0f 87 32 01 00 00    	ja     3f0 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+     2be:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     2c4:	8b 80 60 17 00 00    	mov    0x1760(%eax),%eax
+     2ca:	85 c0                	test   %eax,%eax
+     2cc:	0f 84 de 00 00 00    	je     3b0 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+     2d2:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     2d8:	8b b0 64 17 00 00    	mov    0x1764(%eax),%esi
+     2de:	8d 88 60 17 00 00    	lea    0x1760(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+     2e4:	8d b8 68 17 00 00    	lea    0x1768(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+     2ea:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+     2ed:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+     2f0:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+     2f3:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+     2f9:	0f 8f 01 01 00 00    	jg     400 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+     2ff:	8d 78 08             	lea    0x8(%eax),%edi
+     302:	8d bc 3e 60 17 00 00 	lea    0x1760(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     309:	85 db                	test   %ebx,%ebx
+     30b:	7e 3b                	jle    348 <bufwrite+0xa8>
+     30d:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+     310:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+     313:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     317:	90                   	nop
+    *dst++ = *src++;
+     318:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     319:	39 c6                	cmp    %eax,%esi
+     31b:	75 fb                	jne    318 <bufwrite+0x78>
+  ob[fd].n += n;
+     31d:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     323:	8b 88 64 17 00 00    	mov    0x1764(%eax),%ecx
+     329:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     32b:	83 b8 60 17 00 00 01 	cmpl   $0x1,0x1760(%eax)
+  ob[fd].n += n;
+     332:	89 88 64 17 00 00    	mov    %ecx,0x1764(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     338:	74 26                	je     360 <bufwrite+0xc0>
+}
+     33a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     33d:	5b                   	pop    %ebx
+     33e:	5e                   	pop    %esi
+     33f:	5f                   	pop    %edi
+     340:	5d                   	pop    %ebp
+     341:	c3                   	ret
+     342:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+     348:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     34b:	83 b8 60 17 00 00 01 	cmpl   $0x1,0x1760(%eax)
+  ob[fd].n += n;
+     352:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     355:	75 e3                	jne    33a <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+     357:	85 db                	test   %ebx,%ebx
+     359:	74 df                	je     33a <bufwrite+0x9a>
+     35b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     35f:	90                   	nop
+  src = vsrc;
+     360:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     363:	01 c3                	add    %eax,%ebx
+     365:	eb 10                	jmp    377 <bufwrite+0xd7>
+     367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     36e:	66 90                	xchg   %ax,%ax
+     370:	83 c0 01             	add    $0x1,%eax
+     373:	39 d8                	cmp    %ebx,%eax
+     375:	74 c3                	je     33a <bufwrite+0x9a>
+    if(*p == (char)c)
+     377:	80 38 0a             	cmpb   $0xa,(%eax)
+     37a:	75 f4                	jne    370 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     37c:	85 c9                	test   %ecx,%ecx
+     37e:	7e ba                	jle    33a <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+     380:	83 ec 04             	sub    $0x4,%esp
+     383:	51                   	push   %ecx
+     384:	ff 75 ac             	push   -0x54(%ebp)
+     387:	52                   	push   %edx
+     388:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+     38b:	e8 cd 05 00 00       	call   95d <write>
+    ob[fd].n = 0;
+     390:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     393:	83 c4 10             	add    $0x10,%esp
+     396:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+     39c:	c7 82 64 17 00 00 00 	movl   $0x0,0x1764(%edx)
+     3a3:	00 00 00 
+     3a6:	eb 92                	jmp    33a <bufwrite+0x9a>
+     3a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3af:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     3b0:	83 ec 08             	sub    $0x8,%esp
+     3b3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     3b6:	50                   	push   %eax
+     3b7:	52                   	push   %edx
+     3b8:	89 55 b0             	mov    %edx,-0x50(%ebp)
+     3bb:	e8 d7 05 00 00       	call   997 <fstat>
+     3c0:	83 c4 10             	add    $0x10,%esp
+     3c3:	8b 55 b0             	mov    -0x50(%ebp),%edx
+     3c6:	89 c1                	mov    %eax,%ecx
+     3c8:	b8 02 00 00 00       	mov    $0x2,%eax
+     3cd:	85 c9                	test   %ecx,%ecx
+     3cf:	75 0d                	jne    3de <bufwrite+0x13e>
+     3d1:	31 c0                	xor    %eax,%eax
+     3d3:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     3d8:	0f 95 c0             	setne  %al
+     3db:	83 c0 01             	add    $0x1,%eax
+     3de:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+     3e4:	89 81 60 17 00 00    	mov    %eax,0x1760(%ecx)
+     3ea:	e9 e3 fe ff ff       	jmp    2d2 <bufwrite+0x32>
+     3ef:	90                   	nop
+}
+     3f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     3f3:	5b                   	pop    %ebx
+     3f4:	5e                   	pop    %esi
+     3f5:	5f                   	pop    %edi
+     3f6:	5d                   	pop    %ebp
+    write(fd, p, n);
+     3f7:	e9 61 05 00 00       	jmp    95d <write>
+     3fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+     400:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+     403:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+     406:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+     409:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+     40c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+     40f:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+     412:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+     415:	6a 02                	push   $0x2
+     417:	50                   	push   %eax
+     418:	52                   	push   %edx
+     419:	e8 9b 06 00 00       	call   ab9 <writev>
+    ob[fd].n = 0;
+     41e:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+     421:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+     424:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+     42b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     42e:	5b                   	pop    %ebx
+     42f:	5e                   	pop    %esi
+     430:	5f                   	pop    %edi
+     431:	5d                   	pop    %ebp
+     432:	c3                   	ret
+     433:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     43a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000440 <fflush>:
+{
+     440:	55                   	push   %ebp
+     441:	89 e5                	mov    %esp,%ebp
+     443:	53                   	push   %ebx
+     444:	83 ec 04             	sub    $0x4,%esp
+     447:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     44a:	83 f8 0f             	cmp    $0xf,%eax
+     44d:	77 16                	ja     465 <fflush+0x25>
+     44f:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+     455:	8b 8a 64 17 00 00    	mov    0x1764(%edx),%ecx
+     45b:	8d 9a 60 17 00 00    	lea    0x1760(%edx),%ebx
+     461:	85 c9                	test   %ecx,%ecx
+     463:	7f 0b                	jg     470 <fflush+0x30>
+}
+     465:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     468:	c9                   	leave
+     469:	c3                   	ret
+     46a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     470:	83 ec 04             	sub    $0x4,%esp
+     473:	81 c2 68 17 00 00    	add    $0x1768,%edx
+     479:	51                   	push   %ecx
+     47a:	52                   	push   %edx
+     47b:	50                   	push   %eax
+     47c:	e8 dc 04 00 00       	call   95d <write>
+    ob[fd].n = 0;
+     481:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     488:	83 c4 10             	add    $0x10,%esp
+}
+     48b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     48e:	c9                   	leave
+     48f:	c3                   	ret
+
+00000490 <fflushall>:
+{
+     490:	55                   	push   %ebp
+     491:	89 e5                	mov    %esp,%ebp
+     493:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     494:	31 f6                	xor    %esi,%esi
+{
+     496:	53                   	push   %ebx
+     497:	bb 68 17 00 00       	mov    $0x1768,%ebx
+     49c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     4a0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     4a3:	85 c0                	test   %eax,%eax
+     4a5:	7e 15                	jle    4bc <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     4a7:	83 ec 04             	sub    $0x4,%esp
+     4aa:	50                   	push   %eax
+     4ab:	53                   	push   %ebx
+     4ac:	56                   	push   %esi
+     4ad:	e8 ab 04 00 00       	call   95d <write>
+    ob[fd].n = 0;
+     4b2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     4b9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     4bc:	83 c6 01             	add    $0x1,%esi
+     4bf:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     4c5:	83 fe 10             	cmp    $0x10,%esi
+     4c8:	75 d6                	jne    4a0 <fflushall+0x10>
+}
+     4ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4cd:	5b                   	pop    %ebx
+     4ce:	5e                   	pop    %esi
+     4cf:	5d                   	pop    %ebp
+     4d0:	c3                   	ret
+     4d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4df:	90                   	nop
+
+000004e0 <fork>:
+{
+     4e0:	55                   	push   %ebp
+     4e1:	89 e5                	mov    %esp,%ebp
+     4e3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     4e4:	31 f6                	xor    %esi,%esi
+{
+     4e6:	53                   	push   %ebx
+     4e7:	bb 68 17 00 00       	mov    $0x1768,%ebx
+     4ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     4f0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     4f3:	85 c0                	test   %eax,%eax
+     4f5:	7e 15                	jle    50c <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     4f7:	83 ec 04             	sub    $0x4,%esp
+     4fa:	50                   	push   %eax
+     4fb:	53                   	push   %ebx
+     4fc:	56                   	push   %esi
+     4fd:	e8 5b 04 00 00       	call   95d <write>
+    ob[fd].n = 0;
+     502:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     509:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     50c:	83 c6 01             	add    $0x1,%esi
+     50f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     515:	83 fe 10             	cmp    $0x10,%esi
+     518:	75 d6                	jne    4f0 <fork+0x10>
+}
+     51a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     51d:	5b                   	pop    %ebx
+     51e:	5e                   	pop    %esi
+     51f:	5d                   	pop    %ebp
+  return _fork();
+     520:	e9 15 04 00 00       	jmp    93a <_fork>
+     525:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     52c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000530 <exit>:
+{
+     530:	55                   	push   %ebp
+     531:	89 e5                	mov    %esp,%ebp
+     533:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+     536:	e8 55 ff ff ff       	call   490 <fflushall>
+  _exit();
+     53b:	e8 01 04 00 00       	call   941 <_exit>
+
+00000540 <exec>:
+{
+     540:	55                   	push   %ebp
+     541:	89 e5                	mov    %esp,%ebp
+     543:	57                   	push   %edi
+     544:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     545:	31 f6                	xor    %esi,%esi
+{
+     547:	53                   	push   %ebx
+     548:	bb 68 17 00 00       	mov    $0x1768,%ebx
+     54d:	83 ec 1c             	sub    $0x1c,%esp
+     550:	8b 45 08             	mov    0x8(%ebp),%eax
+     553:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     556:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     559:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     560:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     563:	85 c0                	test   %eax,%eax
+     565:	7e 15                	jle    57c <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     567:	83 ec 04             	sub    $0x4,%esp
+     56a:	50                   	push   %eax
+     56b:	53                   	push   %ebx
+     56c:	56                   	push   %esi
+     56d:	e8 eb 03 00 00       	call   95d <write>
+    ob[fd].n = 0;
+     572:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     579:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     57c:	83 c6 01             	add    $0x1,%esi
+     57f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     585:	83 fe 10             	cmp    $0x10,%esi
+     588:	75 d6                	jne    560 <exec+0x20>
+  return _exec(path, argv);
+     58a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     58d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+     590:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     593:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     596:	5b                   	pop    %ebx
+     597:	5e                   	pop    %esi
+     598:	5f                   	pop    %edi
+     599:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     59a:	e9 d3 03 00 00       	jmp    972 <_exec>
+     59f:	90                   	nop
+
+000005a0 <close>:
+{
+     5a0:	55                   	push   %ebp
+     5a1:	89 e5                	mov    %esp,%ebp
+     5a3:	56                   	push   %esi
+     5a4:	53                   	push   %ebx
+     5a5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     5a8:	83 fb 0f             	cmp    $0xf,%ebx
+     5ab:	77 26                	ja     5d3 <close+0x33>
+     5ad:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     5b3:	8b 90 64 17 00 00    	mov    0x1764(%eax),%edx
+     5b9:	8d b0 60 17 00 00    	lea    0x1760(%eax),%esi
+     5bf:	85 d2                	test   %edx,%edx
+     5c1:	7f 25                	jg     5e8 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+     5c3:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     5c9:	c7 80 60 17 00 00 00 	movl   $0x0,0x1760(%eax)
+     5d0:	00 00 00 
+  return _close(fd);
+     5d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     5d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5d9:	5b                   	pop    %ebx
+     5da:	5e                   	pop    %esi
+     5db:	5d                   	pop    %ebp
+  return _close(fd);
+     5dc:	e9 83 03 00 00       	jmp    964 <_close>
+     5e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     5e8:	83 ec 04             	sub    $0x4,%esp
+     5eb:	05 68 17 00 00       	add    $0x1768,%eax
+     5f0:	52                   	push   %edx
+     5f1:	50                   	push   %eax
+     5f2:	53                   	push   %ebx
+     5f3:	e8 65 03 00 00       	call   95d <write>
+    ob[fd].n = 0;
+     5f8:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+     5ff:	83 c4 10             	add    $0x10,%esp
+     602:	eb bf                	jmp    5c3 <close+0x23>
+     604:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     60b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     60f:	90                   	nop
+
+00000610 <strcpy>:
+{
+     610:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+     611:	31 c0                	xor    %eax,%eax
+{
+     613:	89 e5                	mov    %esp,%ebp
+     615:	53                   	push   %ebx
+     616:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     619:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     61c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     620:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     624:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     627:	83 c0 01             	add    $0x1,%eax
+     62a:	84 d2                	test   %dl,%dl
+     62c:	75 f2                	jne    620 <strcpy+0x10>
+}
+     62e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     631:	89 c8                	mov    %ecx,%eax
+     633:	c9                   	leave
+     634:	c3                   	ret
+     635:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     63c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000640 <strcmp>:
+{
+     640:	55                   	push   %ebp
+     641:	89 e5                	mov    %esp,%ebp
+     643:	53                   	push   %ebx
+     644:	8b 55 08             	mov    0x8(%ebp),%edx
+     647:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     64a:	0f b6 02             	movzbl (%edx),%eax
+     64d:	84 c0                	test   %al,%al
+     64f:	75 17                	jne    668 <strcmp+0x28>
+     651:	eb 3a                	jmp    68d <strcmp+0x4d>
+     653:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     657:	90                   	nop
+     658:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     65c:	83 c2 01             	add    $0x1,%edx
+     65f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     662:	84 c0                	test   %al,%al
+     664:	74 1a                	je     680 <strcmp+0x40>
+    p++, q++;
+     666:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     668:	0f b6 19             	movzbl (%ecx),%ebx
+     66b:	38 c3                	cmp    %al,%bl
+     66d:	74 e9                	je     658 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     66f:	29 d8                	sub    %ebx,%eax
+}
+     671:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     674:	c9                   	leave
+     675:	c3                   	ret
+     676:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     67d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     680:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     684:	31 c0                	xor    %eax,%eax
+     686:	29 d8                	sub    %ebx,%eax
+}
+     688:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     68b:	c9                   	leave
+     68c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     68d:	0f b6 19             	movzbl (%ecx),%ebx
+     690:	31 c0                	xor    %eax,%eax
+     692:	eb db                	jmp    66f <strcmp+0x2f>
+     694:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     69b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     69f:	90                   	nop
+
+000006a0 <strlen>:
+{
+     6a0:	55                   	push   %ebp
+     6a1:	89 e5                	mov    %esp,%ebp
+     6a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+     6a6:	80 3a 00             	cmpb   $0x0,(%edx)
+     6a9:	74 15                	je     6c0 <strlen+0x20>
+     6ab:	31 c0                	xor    %eax,%eax
+     6ad:	8d 76 00             	lea    0x0(%esi),%esi
+     6b0:	83 c0 01             	add    $0x1,%eax
+     6b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     6b7:	89 c1                	mov    %eax,%ecx
+     6b9:	75 f5                	jne    6b0 <strlen+0x10>
+}
+     6bb:	89 c8                	mov    %ecx,%eax
+     6bd:	5d                   	pop    %ebp
+     6be:	c3                   	ret
+     6bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+     6c0:	31 c9                	xor    %ecx,%ecx
+}
+     6c2:	5d                   	pop    %ebp
+     6c3:	89 c8                	mov    %ecx,%eax
+     6c5:	c3                   	ret
+     6c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006d0 <memset>:
+{
+     6d0:	55                   	push   %ebp
+     6d1:	89 e5                	mov    %esp,%ebp
+     6d3:	57                   	push   %edi
+     6d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     6d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     6da:	8b 45 0c             	mov    0xc(%ebp),%eax
+     6dd:	89 d7                	mov    %edx,%edi
+     6df:	fc                   	cld
+     6e0:	f3 aa                	rep stos %al,%es:(%edi)
+}
+     6e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     6e5:	89 d0                	mov    %edx,%eax
+     6e7:	c9                   	leave
+     6e8:	c3                   	ret
+     6e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000006f0 <strchr>:
+{
+     6f0:	55                   	push   %ebp
+     6f1:	89 e5                	mov    %esp,%ebp
+     6f3:	8b 45 08             	mov    0x8(%ebp),%eax
+     6f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     6fa:	0f b6 10             	movzbl (%eax),%edx
+     6fd:	84 d2                	test   %dl,%dl
+     6ff:	75 12                	jne    713 <strchr+0x23>
+     701:	eb 1d                	jmp    720 <strchr+0x30>
+     703:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     707:	90                   	nop
+     708:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     70c:	83 c0 01             	add    $0x1,%eax
+     70f:	84 d2                	test   %dl,%dl
+     711:	74 0d                	je     720 <strchr+0x30>
+    if(*s == c)
+     713:	38 d1                	cmp    %dl,%cl
+     715:	75 f1                	jne    708 <strchr+0x18>
+}
+     717:	5d                   	pop    %ebp
+     718:	c3                   	ret
+     719:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     720:	31 c0                	xor    %eax,%eax
+}
+     722:	5d                   	pop    %ebp
+     723:	c3                   	ret
+     724:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     72b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     72f:	90                   	nop
+
+00000730 <memchr>:
+{
+     730:	55                   	push   %ebp
+     731:	89 e5                	mov    %esp,%ebp
+     733:	8b 55 10             	mov    0x10(%ebp),%edx
+     736:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     739:	85 d2                	test   %edx,%edx
+     73b:	74 1b                	je     758 <memchr+0x28>
+    if(*p == (char)c)
+     73d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+     741:	01 c2                	add    %eax,%edx
+     743:	eb 0a                	jmp    74f <memchr+0x1f>
+     745:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+     748:	83 c0 01             	add    $0x1,%eax
+     74b:	39 c2                	cmp    %eax,%edx
+     74d:	74 09                	je     758 <memchr+0x28>
+    if(*p == (char)c)
+     74f:	38 08                	cmp    %cl,(%eax)
+     751:	75 f5                	jne    748 <memchr+0x18>
+}
+     753:	5d                   	pop    %ebp
+     754:	c3                   	ret
+     755:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+     758:	31 c0                	xor    %eax,%eax
+}
+     75a:	5d                   	pop    %ebp
+     75b:	c3                   	ret
+     75c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000760 <gets>:
+{
+     760:	55                   	push   %ebp
+     761:	89 e5                	mov    %esp,%ebp
+     763:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+     764:	31 ff                	xor    %edi,%edi
+{
+     766:	56                   	push   %esi
+     767:	be 68 17 00 00       	mov    $0x1768,%esi
+     76c:	53                   	push   %ebx
+     76d:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     770:	8b 46 fc             	mov    -0x4(%esi),%eax
+     773:	85 c0                	test   %eax,%eax
+     775:	7e 15                	jle    78c <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     777:	83 ec 04             	sub    $0x4,%esp
+     77a:	50                   	push   %eax
+     77b:	56                   	push   %esi
+     77c:	57                   	push   %edi
+     77d:	e8 db 01 00 00       	call   95d <write>
+    ob[fd].n = 0;
+     782:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+     789:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     78c:	83 c7 01             	add    $0x1,%edi
+     78f:	81 c6 08 01 00 00    	add    $0x108,%esi
+     795:	83 ff 10             	cmp    $0x10,%edi
+     798:	75 d6                	jne    770 <gets+0x10>
+  for(i=0; i+1 < max; ){
+     79a:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+     79c:	8d 75 e7             	lea    -0x19(%ebp),%esi
+     79f:	eb 2e                	jmp    7cf <gets+0x6f>
+     7a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7a8:	83 ec 04             	sub    $0x4,%esp
+     7ab:	6a 01                	push   $0x1
+     7ad:	56                   	push   %esi
+     7ae:	6a 00                	push   $0x0
+     7b0:	e8 a1 01 00 00       	call   956 <read>
+    if(cc < 1)
+     7b5:	83 c4 10             	add    $0x10,%esp
+     7b8:	85 c0                	test   %eax,%eax
+     7ba:	7e 1d                	jle    7d9 <gets+0x79>
+    buf[i++] = c;
+     7bc:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     7c0:	8b 55 08             	mov    0x8(%ebp),%edx
+     7c3:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     7c7:	3c 0a                	cmp    $0xa,%al
+     7c9:	74 10                	je     7db <gets+0x7b>
+     7cb:	3c 0d                	cmp    $0xd,%al
+     7cd:	74 0c                	je     7db <gets+0x7b>
+  for(i=0; i+1 < max; ){
+     7cf:	89 df                	mov    %ebx,%edi
+     7d1:	83 c3 01             	add    $0x1,%ebx
+     7d4:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     7d7:	7c cf                	jl     7a8 <gets+0x48>
+     7d9:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     7db:	8b 45 08             	mov    0x8(%ebp),%eax
+     7de:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     7e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     7e5:	5b                   	pop    %ebx
+     7e6:	5e                   	pop    %esi
+     7e7:	5f                   	pop    %edi
+     7e8:	5d                   	pop    %ebp
+     7e9:	c3                   	ret
+     7ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000007f0 <stat>:
+{
+     7f0:	55                   	push   %ebp
+     7f1:	89 e5                	mov    %esp,%ebp
+     7f3:	57                   	push   %edi
+     7f4:	56                   	push   %esi
+     7f5:	53                   	push   %ebx
+     7f6:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+     7f9:	6a 00                	push   $0x0
+     7fb:	ff 75 08             	push   0x8(%ebp)
+     7fe:	e8 76 01 00 00       	call   979 <open>
+  if(fd < 0)
+     803:	83 c4 10             	add    $0x10,%esp
+     806:	85 c0                	test   %eax,%eax
+     808:	78 76                	js     880 <stat+0x90>
+  r = fstat(fd, st);
+     80a:	83 ec 08             	sub    $0x8,%esp
+     80d:	ff 75 0c             	push   0xc(%ebp)
+     810:	89 c3                	mov    %eax,%ebx
+     812:	50                   	push   %eax
+     813:	e8 7f 01 00 00       	call   997 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     818:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     81b:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     81d:	83 fb 0f             	cmp    $0xf,%ebx
+     820:	7f 40                	jg     862 <stat+0x72>
+     822:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     828:	8b 90 64 17 00 00    	mov    0x1764(%eax),%edx
+     82e:	8d b8 60 17 00 00    	lea    0x1760(%eax),%edi
+     834:	85 d2                	test   %edx,%edx
+     836:	7e 1a                	jle    852 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+     838:	83 ec 04             	sub    $0x4,%esp
+     83b:	05 68 17 00 00       	add    $0x1768,%eax
+     840:	52                   	push   %edx
+     841:	50                   	push   %eax
+     842:	53                   	push   %ebx
+     843:	e8 15 01 00 00       	call   95d <write>
+    ob[fd].n = 0;
+     848:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+     84f:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+     852:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     858:	c7 80 60 17 00 00 00 	movl   $0x0,0x1760(%eax)
+     85f:	00 00 00 
+  return _close(fd);
+     862:	83 ec 0c             	sub    $0xc,%esp
+     865:	53                   	push   %ebx
+     866:	e8 f9 00 00 00       	call   964 <_close>
+     86b:	83 c4 10             	add    $0x10,%esp
+}
+     86e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     871:	89 f0                	mov    %esi,%eax
+     873:	5b                   	pop    %ebx
+     874:	5e                   	pop    %esi
+     875:	5f                   	pop    %edi
+     876:	5d                   	pop    %ebp
+     877:	c3                   	ret
+     878:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     87f:	90                   	nop
+    return -1;
+     880:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     885:	eb e7                	jmp    86e <stat+0x7e>
+     887:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     88e:	66 90                	xchg   %ax,%ax
+
+00000890 <atoi>:
+{
+     890:	55                   	push   %ebp
+     891:	89 e5                	mov    %esp,%ebp
+     893:	53                   	push   %ebx
+     894:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     897:	0f be 02             	movsbl (%edx),%eax
+     89a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     89d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     8a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     8a5:	77 1e                	ja     8c5 <atoi+0x35>
+     8a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     8b0:	83 c2 01             	add    $0x1,%edx
+     8b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     8b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     8ba:	0f be 02             	movsbl (%edx),%eax
+     8bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     8c0:	80 fb 09             	cmp    $0x9,%bl
+     8c3:	76 eb                	jbe    8b0 <atoi+0x20>
+}
+     8c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8c8:	89 c8                	mov    %ecx,%eax
+     8ca:	c9                   	leave
+     8cb:	c3                   	ret
+     8cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008d0 <memmove>:
+{
+     8d0:	55                   	push   %ebp
+     8d1:	89 e5                	mov    %esp,%ebp
+     8d3:	57                   	push   %edi
+     8d4:	56                   	push   %esi
+     8d5:	8b 45 10             	mov    0x10(%ebp),%eax
+     8d8:	8b 55 08             	mov    0x8(%ebp),%edx
+     8db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     8de:	85 c0                	test   %eax,%eax
+     8e0:	7e 13                	jle    8f5 <memmove+0x25>
+     8e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     8e4:	89 d7                	mov    %edx,%edi
+     8e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     8f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     8f1:	39 f8                	cmp    %edi,%eax
+     8f3:	75 fb                	jne    8f0 <memmove+0x20>
+  return vdst;
+}
+     8f5:	5e                   	pop    %esi
+     8f6:	89 d0                	mov    %edx,%eax
+     8f8:	5f                   	pop    %edi
+     8f9:	5d                   	pop    %ebp
+     8fa:	c3                   	ret
+
+000008fb <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+     8fb:	83 3d 00 17 00 00 00 	cmpl   $0x0,0x1700
+  jle 1f
+     902:	7e 0a                	jle    90e <syscallentry+0x13>
+  movl %esp, %ecx
+     904:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+     906:	ba 0d 09 00 00       	mov    $0x90d,%edx
+  sysenter
+     90b:	0f 34                	sysenter
+2:
+  ret
+     90d:	c3                   	ret
+1:
+  jl 3f
+     90e:	7c 27                	jl     937 <syscallentry+0x3c>
+  pushal
+     910:	60                   	pusha
+  movl $1, %eax
+     911:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     916:	0f a2                	cpuid
+  movl $-1, sysentermode
+     918:	c7 05 00 17 00 00 ff 	movl   $0xffffffff,0x1700
+     91f:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     922:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+     928:	74 0a                	je     934 <syscallentry+0x39>
+  movl $1, sysentermode
+     92a:	c7 05 00 17 00 00 01 	movl   $0x1,0x1700
+     931:	00 00 00 
+4:
+  popal
+     934:	61                   	popa
+  jmp syscallentry
+     935:	eb c4                	jmp    8fb <syscallentry>
+3:
+  int $T_SYSCALL
+     937:	cd 40                	int    $0x40
+  ret
+     939:	c3                   	ret
+
+0000093a <_fork>:
+
+SYSCALLAS(_fork, fork)
+     93a:	b8 01 00 00 00       	mov    $0x1,%eax
+     93f:	eb ba                	jmp    8fb <syscallentry>
+
+00000941 <_exit>:
+SYSCALLAS(_exit, exit)
+     941:	b8 02 00 00 00       	mov    $0x2,%eax
+     946:	eb b3                	jmp    8fb <syscallentry>
+
+00000948 <wait>:
+SYSCALL(wait)
+     948:	b8 03 00 00 00       	mov    $0x3,%eax
+     94d:	eb ac                	jmp    8fb <syscallentry>
+
+0000094f <pipe>:
+SYSCALL(pipe)
+     94f:	b8 04 00 00 00       	mov    $0x4,%eax
+     954:	eb a5                	jmp    8fb <syscallentry>
+
+00000956 <read>:
+SYSCALL(read)
+     956:	b8 05 00 00 00       	mov    $0x5,%eax
+     95b:	eb 9e                	jmp    8fb <syscallentry>
+
+0000095d <write>:
+SYSCALL(write)
+     95d:	b8 10 00 00 00       	mov    $0x10,%eax
+     962:	eb 97                	jmp    8fb <syscallentry>
+
+00000964 <_close>:
+SYSCALLAS(_close, close)
+     964:	b8 15 00 00 00       	mov    $0x15,%eax
+     969:	eb 90                	jmp    8fb <syscallentry>
+
+0000096b <kill>:
+SYSCALL(kill)
+     96b:	b8 06 00 00 00       	mov    $0x6,%eax
+     970:	eb 89                	jmp    8fb <syscallentry>
+
+00000972 <_exec>:
+SYSCALLAS(_exec, exec)
+     972:	b8 07 00 00 00       	mov    $0x7,%eax
+     977:	eb 82                	jmp    8fb <syscallentry>
+
+00000979 <open>:
+SYSCALL(open)
+     979:	b8 0f 00 00 00       	mov    $0xf,%eax
+     97e:	e9 78 ff ff ff       	jmp    8fb <syscallentry>
+
+00000983 <mknod>:
+SYSCALL(mknod)
+     983:	b8 11 00 00 00       	mov    $0x11,%eax
+     988:	e9 6e ff ff ff       	jmp    8fb <syscallentry>
+
+0000098d <unlink>:
+SYSCALL(unlink)
+     98d:	b8 12 00 00 00       	mov    $0x12,%eax
+     992:	e9 64 ff ff ff       	jmp    8fb <syscallentry>
+
+00000997 <fstat>:
+SYSCALL(fstat)
+     997:	b8 08 00 00 00       	mov    $0x8,%eax
+     99c:	e9 5a ff ff ff       	jmp    8fb <syscallentry>
+
+000009a1 <link>:
+SYSCALL(link)
+     9a1:	b8 13 00 00 00       	mov    $0x13,%eax
+     9a6:	e9 50 ff ff ff       	jmp    8fb <syscallentry>
+
+000009ab <mkdir>:
+SYSCALL(mkdir)
+     9ab:	b8 14 00 00 00       	mov    $0x14,%eax
+     9b0:	e9 46 ff ff ff       	jmp    8fb <syscallentry>
+
+000009b5 <chdir>:
+SYSCALL(chdir)
+     9b5:	b8 09 00 00 00       	mov    $0x9,%eax
+     9ba:	e9 3c ff ff ff       	jmp    8fb <syscallentry>
+
+000009bf <dup>:
+SYSCALL(dup)
+     9bf:	b8 0a 00 00 00       	mov    $0xa,%eax
+     9c4:	e9 32 ff ff ff       	jmp    8fb <syscallentry>
+
+000009c9 <getpid>:
+SYSCALL(getpid)
+     9c9:	b8 0b 00 00 00       	mov    $0xb,%eax
+     9ce:	e9 28 ff ff ff       	jmp    8fb <syscallentry>
+
+000009d3 <sbrk>:
+SYSCALL(sbrk)
+     9d3:	b8 0c 00 00 00       	mov    $0xc,%eax
+     9d8:	e9 1e ff ff ff       	jmp    8fb <syscallentry>
+
+000009dd <sleep>:
+SYSCALL(sleep)
+     9dd:	b8 0d 00 00 00       	mov    $0xd,%eax
+     9e2:	e9 14 ff ff ff       	jmp    8fb <syscallentry>
+
+000009e7 <uptime>:
+SYSCALL(uptime)
+     9e7:	b8 0e 00 00 00       	mov    $0xe,%eax
+     9ec:	e9 0a ff ff ff       	jmp    8fb <syscallentry>
+
+000009f1 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+     9f1:	b8 16 00 00 00       	mov    $0x16,%eax
+     9f6:	e9 00 ff ff ff       	jmp    8fb <syscallentry>
+
+000009fb <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+     9fb:	b8 17 00 00 00       	mov    $0x17,%eax
+     a00:	e9 f6 fe ff ff       	jmp    8fb <syscallentry>
+
+00000a05 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+     a05:	b8 18 00 00 00       	mov    $0x18,%eax
+     a0a:	e9 ec fe ff ff       	jmp    8fb <syscallentry>
+
+00000a0f <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+     a0f:	b8 19 00 00 00       	mov    $0x19,%eax
+     a14:	e9 e2 fe ff ff       	jmp    8fb <syscallentry>
+
+00000a19 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+     a19:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     a1e:	e9 d8 fe ff ff       	jmp    8fb <syscallentry>
+
+00000a23 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+     a23:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     a28:	e9 ce fe ff ff       	jmp    8fb <syscallentry>
+
+00000a2d <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+     a2d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     a32:	e9 c4 fe ff ff       	jmp    8fb <syscallentry>
+
+00000a37 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+     a37:	b8 20 00 00 00       	mov    $0x20,%eax
+     a3c:	e9 ba fe ff ff       	jmp    8fb <syscallentry>
+
+00000a41 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+     a41:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     a46:	e9 b0 fe ff ff       	jmp    8fb <syscallentry>
+
+00000a4b <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+     a4b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     a50:	e9 a6 fe ff ff       	jmp    8fb <syscallentry>
+
+00000a55 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+     a55:	b8 21 00 00 00       	mov    $0x21,%eax
+     a5a:	e9 9c fe ff ff       	jmp    8fb <syscallentry>
+
+00000a5f <yield>:
+SYSCALL(yield) // yield the CPU to another process
+     a5f:	b8 22 00 00 00       	mov    $0x22,%eax
+     a64:	e9 92 fe ff ff       	jmp    8fb <syscallentry>
+
+00000a69 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+     a69:	b8 23 00 00 00       	mov    $0x23,%eax
+     a6e:	e9 88 fe ff ff       	jmp    8fb <syscallentry>
+
+00000a73 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+     a73:	b8 24 00 00 00       	mov    $0x24,%eax
+     a78:	e9 7e fe ff ff       	jmp    8fb <syscallentry>
+
+00000a7d <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+     a7d:	b8 25 00 00 00       	mov    $0x25,%eax
+     a82:	e9 74 fe ff ff       	jmp    8fb <syscallentry>
+
+00000a87 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+     a87:	b8 26 00 00 00       	mov    $0x26,%eax
+     a8c:	e9 6a fe ff ff       	jmp    8fb <syscallentry>
+
+00000a91 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+     a91:	b8 27 00 00 00       	mov    $0x27,%eax
+     a96:	e9 60 fe ff ff       	jmp    8fb <syscallentry>
+
+00000a9b <mmap>:
+SYSCALL(mmap) // map a file into memory
+     a9b:	b8 28 00 00 00       	mov    $0x28,%eax
+     aa0:	e9 56 fe ff ff       	jmp    8fb <syscallentry>
+
+00000aa5 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+     aa5:	b8 29 00 00 00       	mov    $0x29,%eax
+     aaa:	e9 4c fe ff ff       	jmp    8fb <syscallentry>
+
+00000aaf <readv>:
+SYSCALL(readv) // read into several buffers
+     aaf:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     ab4:	e9 42 fe ff ff       	jmp    8fb <syscallentry>
+
+00000ab9 <writev>:
+SYSCALL(writev) // write from several buffers
+     ab9:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     abe:	e9 38 fe ff ff       	jmp    8fb <syscallentry>
+
+00000ac3 <pread>:
+SYSCALL(pread) // read at an offset
+     ac3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     ac8:	e9 2e fe ff ff       	jmp    8fb <syscallentry>
+
+00000acd <pwrite>:
+SYSCALL(pwrite) // write at an offset
+     acd:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     ad2:	e9 24 fe ff ff       	jmp    8fb <syscallentry>
+
+00000ad7 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+     ad7:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     adc:	e9 1a fe ff ff       	jmp    8fb <syscallentry>
+
+00000ae1 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+     ae1:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     ae6:	e9 10 fe ff ff       	jmp    8fb <syscallentry>
+
+00000aeb <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+     aeb:	b8 30 00 00 00       	mov    $0x30,%eax
+     af0:	e9 06 fe ff ff       	jmp    8fb <syscallentry>
+
+00000af5 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+     af5:	b8 31 00 00 00       	mov    $0x31,%eax
+     afa:	e9 fc fd ff ff       	jmp    8fb <syscallentry>
+
+00000aff <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+     aff:	b8 32 00 00 00       	mov    $0x32,%eax
+     b04:	e9 f2 fd ff ff       	jmp    8fb <syscallentry>
+
+00000b09 <profread>:
+SYSCALL(profread) // drain profiler samples
+     b09:	b8 33 00 00 00       	mov    $0x33,%eax
+     b0e:	e9 e8 fd ff ff       	jmp    8fb <syscallentry>
+
+00000b13 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+     b13:	b8 34 00 00 00       	mov    $0x34,%eax
+     b18:	e9 de fd ff ff       	jmp    8fb <syscallentry>
+
+00000b1d <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+     b1d:	b8 35 00 00 00       	mov    $0x35,%eax
+     b22:	e9 d4 fd ff ff       	jmp    8fb <syscallentry>
+
+00000b27 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+     b27:	b8 36 00 00 00       	mov    $0x36,%eax
+     b2c:	e9 ca fd ff ff       	jmp    8fb <syscallentry>
+
+00000b31 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+     b31:	b8 37 00 00 00       	mov    $0x37,%eax
+     b36:	e9 c0 fd ff ff       	jmp    8fb <syscallentry>
+     b3b:	66 90                	xchg   %ax,%ax
+     b3d:	66 90                	xchg   %ax,%ax
+     b3f:	90                   	nop
+
+00000b40 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     b40:	55                   	push   %ebp
+     b41:	89 e5                	mov    %esp,%ebp
+     b43:	57                   	push   %edi
+     b44:	56                   	push   %esi
+     b45:	53                   	push   %ebx
+     b46:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     b48:	89 d1                	mov    %edx,%ecx
+{
+     b4a:	83 ec 3c             	sub    $0x3c,%esp
+     b4d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     b50:	85 d2                	test   %edx,%edx
+     b52:	0f 89 80 00 00 00    	jns    bd8 <printint+0x98>
+     b58:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     b5c:	74 7a                	je     bd8 <printint+0x98>
+    x = -xx;
+     b5e:	f7 d9                	neg    %ecx
+    neg = 1;
+     b60:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     b65:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     b68:	31 f6                	xor    %esi,%esi
+     b6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     b70:	89 c8                	mov    %ecx,%eax
+     b72:	31 d2                	xor    %edx,%edx
+     b74:	89 f7                	mov    %esi,%edi
+     b76:	f7 f3                	div    %ebx
+     b78:	8d 76 01             	lea    0x1(%esi),%esi
+     b7b:	0f b6 92 ec 11 00 00 	movzbl 0x11ec(%edx),%edx
+     b82:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     b86:	89 ca                	mov    %ecx,%edx
+     b88:	89 c1                	mov    %eax,%ecx
+     b8a:	39 da                	cmp    %ebx,%edx
+     b8c:	73 e2                	jae    b70 <printint+0x30>
+  if(neg)
+     b8e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     b91:	85 c0                	test   %eax,%eax
+     b93:	74 07                	je     b9c <printint+0x5c>
+    buf[i++] = '-';
+     b95:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     b9a:	89 f7                	mov    %esi,%edi
+     b9c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     b9f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     ba2:	01 df                	add    %ebx,%edi
+     ba4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     ba8:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+     bab:	83 ec 04             	sub    $0x4,%esp
+     bae:	88 45 d7             	mov    %al,-0x29(%ebp)
+     bb1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     bb4:	6a 01                	push   $0x1
+     bb6:	50                   	push   %eax
+     bb7:	56                   	push   %esi
+     bb8:	e8 e3 f6 ff ff       	call   2a0 <bufwrite>
+  while(--i >= 0)
+     bbd:	89 f8                	mov    %edi,%eax
+     bbf:	83 c4 10             	add    $0x10,%esp
+     bc2:	83 ef 01             	sub    $0x1,%edi
+     bc5:	39 d8                	cmp    %ebx,%eax
+     bc7:	75 df                	jne    ba8 <printint+0x68>
+}
+     bc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bcc:	5b                   	pop    %ebx
+     bcd:	5e                   	pop    %esi
+     bce:	5f                   	pop    %edi
+     bcf:	5d                   	pop    %ebp
+     bd0:	c3                   	ret
+     bd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     bd8:	31 c0                	xor    %eax,%eax
+     bda:	eb 89                	jmp    b65 <printint+0x25>
+     bdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000be0 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     be0:	55                   	push   %ebp
+     be1:	89 e5                	mov    %esp,%ebp
+     be3:	57                   	push   %edi
+     be4:	56                   	push   %esi
+     be5:	53                   	push   %ebx
+     be6:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     be9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     bec:	0f b6 18             	movzbl (%eax),%ebx
+     bef:	84 db                	test   %bl,%bl
+     bf1:	74 6c                	je     c5f <printf+0x7f>
+     bf3:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+     bf6:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+     bf9:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     bfb:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     bfe:	eb 26                	jmp    c26 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     c00:	83 f8 25             	cmp    $0x25,%eax
+     c03:	74 4b                	je     c50 <printf+0x70>
+  bufwrite(fd, &c, 1);
+     c05:	83 ec 04             	sub    $0x4,%esp
+     c08:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     c0b:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     c0e:	6a 01                	push   $0x1
+     c10:	50                   	push   %eax
+     c11:	ff 75 08             	push   0x8(%ebp)
+     c14:	e8 87 f6 ff ff       	call   2a0 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+     c19:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     c1c:	0f b6 1f             	movzbl (%edi),%ebx
+     c1f:	83 c7 01             	add    $0x1,%edi
+     c22:	84 db                	test   %bl,%bl
+     c24:	74 39                	je     c5f <printf+0x7f>
+    c = fmt[i] & 0xff;
+     c26:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     c29:	85 f6                	test   %esi,%esi
+     c2b:	74 d3                	je     c00 <printf+0x20>
+      }
+    } else if(state == '%'){
+     c2d:	83 fe 25             	cmp    $0x25,%esi
+     c30:	75 ea                	jne    c1c <printf+0x3c>
+      if(c == 'd'){
+     c32:	83 f8 25             	cmp    $0x25,%eax
+     c35:	0f 84 d5 01 00 00    	je     e10 <printf+0x230>
+     c3b:	83 e8 63             	sub    $0x63,%eax
+     c3e:	83 f8 15             	cmp    $0x15,%eax
+     c41:	77 45                	ja     c88 <printf+0xa8>
+     c43:	ff 24 85 94 11 00 00 	jmp    *0x1194(,%eax,4)
+     c4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     c50:	0f b6 1f             	movzbl (%edi),%ebx
+     c53:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+     c56:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     c5b:	84 db                	test   %bl,%bl
+     c5d:	75 c7                	jne    c26 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+     c5f:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+     c63:	74 0b                	je     c70 <printf+0x90>
+    fflush(fd);
+}
+     c65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c68:	5b                   	pop    %ebx
+     c69:	5e                   	pop    %esi
+     c6a:	5f                   	pop    %edi
+     c6b:	5d                   	pop    %ebp
+     c6c:	c3                   	ret
+     c6d:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+     c70:	83 ec 0c             	sub    $0xc,%esp
+     c73:	6a 02                	push   $0x2
+     c75:	e8 c6 f7 ff ff       	call   440 <fflush>
+     c7a:	83 c4 10             	add    $0x10,%esp
+}
+     c7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c80:	5b                   	pop    %ebx
+     c81:	5e                   	pop    %esi
+     c82:	5f                   	pop    %edi
+     c83:	5d                   	pop    %ebp
+     c84:	c3                   	ret
+     c85:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+     c88:	83 ec 04             	sub    $0x4,%esp
+     c8b:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     c8e:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+     c92:	6a 01                	push   $0x1
+     c94:	52                   	push   %edx
+     c95:	89 55 c0             	mov    %edx,-0x40(%ebp)
+     c98:	ff 75 08             	push   0x8(%ebp)
+     c9b:	e8 00 f6 ff ff       	call   2a0 <bufwrite>
+     ca0:	83 c4 0c             	add    $0xc,%esp
+     ca3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     ca6:	6a 01                	push   $0x1
+     ca8:	8b 55 c0             	mov    -0x40(%ebp),%edx
+     cab:	52                   	push   %edx
+      state = 0;
+     cac:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+     cae:	ff 75 08             	push   0x8(%ebp)
+     cb1:	e8 ea f5 ff ff       	call   2a0 <bufwrite>
+        putc(fd, c);
+     cb6:	83 c4 10             	add    $0x10,%esp
+     cb9:	e9 5e ff ff ff       	jmp    c1c <printf+0x3c>
+     cbe:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+     cc0:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     cc3:	83 ec 0c             	sub    $0xc,%esp
+     cc6:	b9 10 00 00 00       	mov    $0x10,%ecx
+     ccb:	8b 16                	mov    (%esi),%edx
+     ccd:	6a 00                	push   $0x0
+     ccf:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+     cd2:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+     cd5:	e8 66 fe ff ff       	call   b40 <printint>
+        ap++;
+     cda:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     cdd:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     ce0:	31 f6                	xor    %esi,%esi
+     ce2:	e9 35 ff ff ff       	jmp    c1c <printf+0x3c>
+     ce7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cee:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     cf0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     cf3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     cf5:	83 c0 04             	add    $0x4,%eax
+     cf8:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+     cfb:	b8 8a 11 00 00       	mov    $0x118a,%eax
+     d00:	85 db                	test   %ebx,%ebx
+     d02:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+     d05:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+     d08:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+     d0a:	53                   	push   %ebx
+     d0b:	e8 90 f9 ff ff       	call   6a0 <strlen>
+     d10:	83 c4 0c             	add    $0xc,%esp
+     d13:	50                   	push   %eax
+     d14:	53                   	push   %ebx
+     d15:	ff 75 08             	push   0x8(%ebp)
+     d18:	e8 83 f5 ff ff       	call   2a0 <bufwrite>
+     d1d:	83 c4 10             	add    $0x10,%esp
+     d20:	e9 f7 fe ff ff       	jmp    c1c <printf+0x3c>
+     d25:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+     d28:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+     d2b:	83 ec 04             	sub    $0x4,%esp
+     d2e:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+     d31:	8b 06                	mov    (%esi),%eax
+        ap++;
+     d33:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+     d36:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+     d39:	6a 01                	push   $0x1
+     d3b:	52                   	push   %edx
+     d3c:	ff 75 08             	push   0x8(%ebp)
+     d3f:	e8 5c f5 ff ff       	call   2a0 <bufwrite>
+        ap++;
+     d44:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     d47:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d4a:	31 f6                	xor    %esi,%esi
+     d4c:	e9 cb fe ff ff       	jmp    c1c <printf+0x3c>
+     d51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+     d58:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     d5b:	83 ec 0c             	sub    $0xc,%esp
+     d5e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     d63:	8b 16                	mov    (%esi),%edx
+     d65:	6a 01                	push   $0x1
+     d67:	e9 63 ff ff ff       	jmp    ccf <printf+0xef>
+     d6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+     d70:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     d73:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     d76:	89 7d c0             	mov    %edi,-0x40(%ebp)
+     d79:	89 55 bc             	mov    %edx,-0x44(%ebp)
+     d7c:	8b 18                	mov    (%eax),%ebx
+     d7e:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+     d81:	31 c0                	xor    %eax,%eax
+     d83:	89 c7                	mov    %eax,%edi
+     d85:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+     d88:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+     d8d:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+     d8f:	f7 e1                	mul    %ecx
+     d91:	c1 ea 03             	shr    $0x3,%edx
+     d94:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     d97:	89 d1                	mov    %edx,%ecx
+     d99:	01 c0                	add    %eax,%eax
+     d9b:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     d9d:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+     d9f:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     da1:	be 0a 00 00 00       	mov    $0xa,%esi
+     da6:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+     da8:	89 da                	mov    %ebx,%edx
+     daa:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+     dac:	89 fe                	mov    %edi,%esi
+     dae:	83 c7 01             	add    $0x1,%edi
+     db1:	8d 42 30             	lea    0x30(%edx),%eax
+     db4:	89 da                	mov    %ebx,%edx
+     db6:	8d 14 92             	lea    (%edx,%edx,4),%edx
+     db9:	01 d2                	add    %edx,%edx
+     dbb:	29 d0                	sub    %edx,%eax
+     dbd:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+     dc1:	89 c8                	mov    %ecx,%eax
+     dc3:	09 d8                	or     %ebx,%eax
+     dc5:	75 c1                	jne    d88 <printf+0x1a8>
+     dc7:	8b 55 bc             	mov    -0x44(%ebp),%edx
+     dca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     dcd:	01 d6                	add    %edx,%esi
+     dcf:	89 f7                	mov    %esi,%edi
+     dd1:	89 d6                	mov    %edx,%esi
+     dd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     dd7:	90                   	nop
+    putc(fd, buf[i]);
+     dd8:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+     ddb:	83 ec 04             	sub    $0x4,%esp
+     dde:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+     de1:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+     de4:	6a 01                	push   $0x1
+     de6:	50                   	push   %eax
+     de7:	53                   	push   %ebx
+     de8:	e8 b3 f4 ff ff       	call   2a0 <bufwrite>
+  while(--i >= 0)
+     ded:	89 fa                	mov    %edi,%edx
+     def:	83 c4 10             	add    $0x10,%esp
+     df2:	83 ef 01             	sub    $0x1,%edi
+     df5:	39 d6                	cmp    %edx,%esi
+     df7:	75 df                	jne    dd8 <printf+0x1f8>
+        ap += 2;
+     df9:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+     dfd:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+     e00:	31 f6                	xor    %esi,%esi
+     e02:	e9 15 fe ff ff       	jmp    c1c <printf+0x3c>
+     e07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e0e:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+     e10:	83 ec 04             	sub    $0x4,%esp
+     e13:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     e16:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     e19:	6a 01                	push   $0x1
+     e1b:	e9 8b fe ff ff       	jmp    cab <printf+0xcb>
+
+00000e20 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     e20:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e21:	a1 e0 27 00 00       	mov    0x27e0,%eax
+{
+     e26:	89 e5                	mov    %esp,%ebp
+     e28:	57                   	push   %edi
+     e29:	56                   	push   %esi
+     e2a:	53                   	push   %ebx
+     e2b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     e2e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e38:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e3a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e3c:	39 ca                	cmp    %ecx,%edx
+     e3e:	73 30                	jae    e70 <free+0x50>
+     e40:	39 c1                	cmp    %eax,%ecx
+     e42:	72 04                	jb     e48 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e44:	39 c2                	cmp    %eax,%edx
+     e46:	72 f0                	jb     e38 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     e48:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     e4b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     e4e:	39 f8                	cmp    %edi,%eax
+     e50:	74 2e                	je     e80 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e52:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     e55:	8b 42 04             	mov    0x4(%edx),%eax
+     e58:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     e5b:	39 f1                	cmp    %esi,%ecx
+     e5d:	74 38                	je     e97 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     e5f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     e61:	5b                   	pop    %ebx
+  freep = p;
+     e62:	89 15 e0 27 00 00    	mov    %edx,0x27e0
+}
+     e68:	5e                   	pop    %esi
+     e69:	5f                   	pop    %edi
+     e6a:	5d                   	pop    %ebp
+     e6b:	c3                   	ret
+     e6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e70:	39 c1                	cmp    %eax,%ecx
+     e72:	72 d0                	jb     e44 <free+0x24>
+     e74:	eb c2                	jmp    e38 <free+0x18>
+     e76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e7d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+     e80:	03 70 04             	add    0x4(%eax),%esi
+     e83:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e86:	8b 02                	mov    (%edx),%eax
+     e88:	8b 00                	mov    (%eax),%eax
+     e8a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     e8d:	8b 42 04             	mov    0x4(%edx),%eax
+     e90:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     e93:	39 f1                	cmp    %esi,%ecx
+     e95:	75 c8                	jne    e5f <free+0x3f>
+    p->s.size += bp->s.size;
+     e97:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     e9a:	89 15 e0 27 00 00    	mov    %edx,0x27e0
+    p->s.size += bp->s.size;
+     ea0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     ea3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     ea6:	89 0a                	mov    %ecx,(%edx)
+}
+     ea8:	5b                   	pop    %ebx
+     ea9:	5e                   	pop    %esi
+     eaa:	5f                   	pop    %edi
+     eab:	5d                   	pop    %ebp
+     eac:	c3                   	ret
+     ead:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000eb0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     eb0:	55                   	push   %ebp
+     eb1:	89 e5                	mov    %esp,%ebp
+     eb3:	57                   	push   %edi
+     eb4:	56                   	push   %esi
+     eb5:	53                   	push   %ebx
+     eb6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     eb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+     ebc:	8b 15 e0 27 00 00    	mov    0x27e0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     ec2:	8d 78 07             	lea    0x7(%eax),%edi
+     ec5:	c1 ef 03             	shr    $0x3,%edi
+     ec8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+     ecb:	85 d2                	test   %edx,%edx
+     ecd:	0f 84 8d 00 00 00    	je     f60 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     ed3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     ed5:	8b 48 04             	mov    0x4(%eax),%ecx
+     ed8:	39 f9                	cmp    %edi,%ecx
+     eda:	73 64                	jae    f40 <malloc+0x90>
+  if(nu < 4096)
+     edc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     ee1:	39 df                	cmp    %ebx,%edi
+     ee3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     ee6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     eed:	eb 0a                	jmp    ef9 <malloc+0x49>
+     eef:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     ef0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     ef2:	8b 48 04             	mov    0x4(%eax),%ecx
+     ef5:	39 f9                	cmp    %edi,%ecx
+     ef7:	73 47                	jae    f40 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     ef9:	89 c2                	mov    %eax,%edx
+     efb:	39 05 e0 27 00 00    	cmp    %eax,0x27e0
+     f01:	75 ed                	jne    ef0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+     f03:	83 ec 0c             	sub    $0xc,%esp
+     f06:	56                   	push   %esi
+     f07:	e8 c7 fa ff ff       	call   9d3 <sbrk>
+  if(p == (char*)-1)
+     f0c:	83 c4 10             	add    $0x10,%esp
+     f0f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f12:	74 1c                	je     f30 <malloc+0x80>
+  hp->s.size = nu;
+     f14:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+     f17:	83 ec 0c             	sub    $0xc,%esp
+     f1a:	83 c0 08             	add    $0x8,%eax
+     f1d:	50                   	push   %eax
+     f1e:	e8 fd fe ff ff       	call   e20 <free>
+  return freep;
+     f23:	8b 15 e0 27 00 00    	mov    0x27e0,%edx
+      if((p = morecore(nunits)) == 0)
+     f29:	83 c4 10             	add    $0x10,%esp
+     f2c:	85 d2                	test   %edx,%edx
+     f2e:	75 c0                	jne    ef0 <malloc+0x40>
+        return 0;
+  }
+}
+     f30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     f33:	31 c0                	xor    %eax,%eax
+}
+     f35:	5b                   	pop    %ebx
+     f36:	5e                   	pop    %esi
+     f37:	5f                   	pop    %edi
+     f38:	5d                   	pop    %ebp
+     f39:	c3                   	ret
+     f3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     f40:	39 cf                	cmp    %ecx,%edi
+     f42:	74 4c                	je     f90 <malloc+0xe0>
+        p->s.size -= nunits;
+     f44:	29 f9                	sub    %edi,%ecx
+     f46:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+     f49:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+     f4c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+     f4f:	89 15 e0 27 00 00    	mov    %edx,0x27e0
+}
+     f55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+     f58:	83 c0 08             	add    $0x8,%eax
+}
+     f5b:	5b                   	pop    %ebx
+     f5c:	5e                   	pop    %esi
+     f5d:	5f                   	pop    %edi
+     f5e:	5d                   	pop    %ebp
+     f5f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+     f60:	c7 05 e0 27 00 00 e4 	movl   $0x27e4,0x27e0
+     f67:	27 00 00 
+    base.s.size = 0;
+     f6a:	b8 e4 27 00 00       	mov    $0x27e4,%eax
+    base.s.ptr = freep = prevp = &base;
+     f6f:	c7 05 e4 27 00 00 e4 	movl   $0x27e4,0x27e4
+     f76:	27 00 00 
+    base.s.size = 0;
+     f79:	c7 05 e8 27 00 00 00 	movl   $0x0,0x27e8
+     f80:	00 00 00 
+    if(p->s.size >= nunits){
+     f83:	e9 54 ff ff ff       	jmp    edc <malloc+0x2c>
+     f88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f8f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+     f90:	8b 08                	mov    (%eax),%ecx
+     f92:	89 0a                	mov    %ecx,(%edx)
+     f94:	eb b9                	jmp    f4f <malloc+0x9f>
+     f96:	66 90                	xchg   %ax,%ax
+     f98:	66 90                	xchg   %ax,%ax
+     f9a:	66 90                	xchg   %ax,%ax
+     f9c:	66 90                	xchg   %ax,%ax
+     f9e:	66 90                	xchg   %ax,%ax
+
+00000fa0 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+     fa0:	55                   	push   %ebp
+     fa1:	89 e5                	mov    %esp,%ebp
+     fa3:	57                   	push   %edi
+     fa4:	56                   	push   %esi
+     fa5:	be 01 00 00 00       	mov    $0x1,%esi
+     faa:	53                   	push   %ebx
+     fab:	83 ec 28             	sub    $0x28,%esp
+     fae:	8b 45 0c             	mov    0xc(%ebp),%eax
+     fb1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     fb4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+     fb7:	68 00 98 00 00       	push   $0x9800
+     fbc:	e8 ef fe ff ff       	call   eb0 <malloc>
+     fc1:	83 c4 10             	add    $0x10,%esp
+     fc4:	89 c7                	mov    %eax,%edi
+     fc6:	85 c0                	test   %eax,%eax
+     fc8:	74 62                	je     102c <waitpoll+0x8c>
+     fca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+     fd0:	83 ec 0c             	sub    $0xc,%esp
+     fd3:	6a 01                	push   $0x1
+     fd5:	e8 03 fa ff ff       	call   9dd <sleep>
+    fn();
+     fda:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     fdd:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+     fdf:	58                   	pop    %eax
+     fe0:	5a                   	pop    %edx
+     fe1:	68 00 02 00 00       	push   $0x200
+     fe6:	57                   	push   %edi
+     fe7:	e8 eb fa ff ff       	call   ad7 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+     fec:	83 c4 10             	add    $0x10,%esp
+     fef:	85 c0                	test   %eax,%eax
+     ff1:	7e 2d                	jle    1020 <waitpoll+0x80>
+     ff3:	6b c0 4c             	imul   $0x4c,%eax,%eax
+     ff6:	89 fa                	mov    %edi,%edx
+    alive = 0;
+     ff8:	31 c9                	xor    %ecx,%ecx
+     ffa:	01 f8                	add    %edi,%eax
+     ffc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+    1000:	3b 1a                	cmp    (%edx),%ebx
+    1002:	75 07                	jne    100b <waitpoll+0x6b>
+        alive = 1;
+    1004:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+    1008:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+    100b:	83 c2 4c             	add    $0x4c,%edx
+    100e:	39 d0                	cmp    %edx,%eax
+    1010:	75 ee                	jne    1000 <waitpoll+0x60>
+  } while(alive);
+    1012:	85 c9                	test   %ecx,%ecx
+    1014:	75 ba                	jne    fd0 <waitpoll+0x30>
+    1016:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    101d:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+    1020:	83 ec 0c             	sub    $0xc,%esp
+    1023:	57                   	push   %edi
+    1024:	e8 f7 fd ff ff       	call   e20 <free>
+  wait();
+    1029:	83 c4 10             	add    $0x10,%esp
+}
+    102c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    102f:	5b                   	pop    %ebx
+    1030:	5e                   	pop    %esi
+    1031:	5f                   	pop    %edi
+    1032:	5d                   	pop    %ebp
+  wait();
+    1033:	e9 10 f9 ff ff       	jmp    948 <wait>
+    1038:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    103f:	90                   	nop
+
+00001040 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+    1040:	55                   	push   %ebp
+    1041:	89 e5                	mov    %esp,%ebp
+    1043:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+    1046:	c7 45 f0 fd 11 00 00 	movl   $0x11fd,-0x10(%ebp)
+    104d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+    1054:	e8 87 f4 ff ff       	call   4e0 <fork>
+    1059:	85 c0                	test   %eax,%eax
+    105b:	78 09                	js     1066 <runps+0x26>
+    return -1;
+  if(pid == 0){
+    105d:	74 0e                	je     106d <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+    105f:	e8 e4 f8 ff ff       	call   948 <wait>
+}
+    1064:	c9                   	leave
+    1065:	c3                   	ret
+    1066:	c9                   	leave
+    return -1;
+    1067:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    106c:	c3                   	ret
+    exec("ps", argv);
+    106d:	50                   	push   %eax
+    106e:	50                   	push   %eax
+    106f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    1072:	50                   	push   %eax
+    1073:	68 fd 11 00 00       	push   $0x11fd
+    1078:	e8 c3 f4 ff ff       	call   540 <exec>
+    printf(2, "exec ps failed\n");
+    107d:	5a                   	pop    %edx
+    107e:	59                   	pop    %ecx
+    107f:	68 00 12 00 00       	push   $0x1200
+    1084:	6a 02                	push   $0x2
+    1086:	e8 55 fb ff ff       	call   be0 <printf>
+    exit();
+    108b:	e8 a0 f4 ff ff       	call   530 <exit>
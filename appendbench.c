@@ -0,0 +1,95 @@
+// Append small records to a file, the way a log writer does,
+// and report how many log commits and ticks it takes with the
+// write-back page, and with an fsync() after every record.
+//
+// usage: appendbench [records]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "logstat.h"
+
+#define FILENAME "appendbench.tmp"
+#define RECSIZE 64
+
+char rec[RECSIZE];
+
+// Append n records, calling fsync() after each if sync is set.
+void
+append(int n, int sync)
+{
+  int fd, i;
+
+  if((fd = open(FILENAME, O_CREATE|O_RDWR)) < 0){
+    printf(2, "appendbench: cannot create %s\n", FILENAME);
+    exit();
+  }
+  for(i = 0; i < n; i++){
+    rec[0] = 'a' + i % 26;
+    if(write(fd, rec, sizeof(rec)) != sizeof(rec)){
+      printf(2, "appendbench: write failed\n");
+      exit();
+    }
+    if(sync)
+      fsync(fd);
+  }
+  close(fd);
+}
+
+// Check that the file holds the n records append() wrote.
+void
+verify(int n)
+{
+  int fd, i;
+  char r[RECSIZE];
+
+  if((fd = open(FILENAME, O_RDONLY)) < 0){
+    printf(2, "appendbench: cannot open %s\n", FILENAME);
+    exit();
+  }
+  for(i = 0; i < n; i++){
+    if(read(fd, r, sizeof(r)) != sizeof(r) || r[0] != 'a' + i % 26){
+      printf(2, "appendbench: record %d is wrong\n", i);
+      exit();
+    }
+  }
+  if(read(fd, r, 1) != 0){
+    printf(2, "appendbench: file too long\n");
+    exit();
+  }
+  close(fd);
+}
+
+void
+run(char *name, int n, int sync)
+{
+  struct logstat a, b;
+  int t;
+
+  unlink(FILENAME);
+  logstat(&a);
+  t = uptime();
+  append(n, sync);
+  t = uptime() - t;
+  logstat(&b);
+  verify(n);
+  printf(1, "%s: %d records, %d commits, %d blocks logged in %d ticks\n",
+         name, n, b.commits - a.commits, b.logged - a.logged, t);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int n;
+
+  n = argc > 1 ? atoi(argv[1]) : 1000;
+  memset(rec, 'r', sizeof(rec));
+  rec[RECSIZE-1] = '\n';
+
+  run("write-back", n, 0);
+  run("fsync each", n, 1);
+
+  unlink(FILENAME);
+  exit();
+}
@@ -82,6 +82,7 @@ bget(uint dev, uint blockno)
     if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
       b->dev = dev;
       b->blockno = blockno;
+      b->ioblock = blockno;
       b->flags = 0;
       b->refcnt = 1;
       release(&bcache.lock);
@@ -115,6 +116,42 @@ bwrite(struct buf *b)
   iderw(b);
 }
 
+// Write the contents of n locked bufs to disk together,
+// letting the driver merge adjacent blocks into one transfer.
+void
+bwritev(struct buf **bs, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++){
+    if(!holdingsleep(&bs[i]->lock))
+      panic("bwritev");
+    bs[i]->flags |= B_DIRTY;
+  }
+  iderwv(bs, n);
+}
+
+// Write the contents of n locked bufs to the disk blocks
+// to[0..n-1] instead of their own, as the log does.
+// The bufs stay B_DIRTY, still owing the write home.
+void
+bwritevat(struct buf **bs, uint *to, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++){
+    if(!holdingsleep(&bs[i]->lock))
+      panic("bwritevat");
+    bs[i]->ioblock = to[i];
+    bs[i]->flags |= B_DIRTY;
+  }
+  iderwv(bs, n);
+  for(i = 0; i < n; i++){
+    bs[i]->ioblock = bs[i]->blockno;
+    bs[i]->flags |= B_DIRTY;
+  }
+}
+
 // Release a locked buffer.
 // Move to the head of the MRU list.
 void
@@ -0,0 +1,2168 @@
+
+_bjf_test:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "user.h"
+#include "fcntl.h" // Include for scheduler policy defines
+
+#define LOOP_MEDIUM 2000000 
+
+int main(int argc, char *argv[]) {
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 34             	sub    $0x34,%esp
+  // Set the scheduler policy to BJF for this test
+  if (setschedpolicy(SCHED_BJF) < 0) {
+      14:	6a 02                	push   $0x2
+      16:	e8 9c 09 00 00       	call   9b7 <setschedpolicy>
+      1b:	83 c4 10             	add    $0x10,%esp
+      1e:	85 c0                	test   %eax,%eax
+      20:	0f 88 0d 01 00 00    	js     133 <main+0x133>
+    printf(1, "Error setting scheduler policy to BJF\n");
+    exit();
+  }
+  printf(1, "Set scheduler to BJF (policy %d)\n", SCHED_BJF);
+      26:	56                   	push   %esi
+      27:	6a 02                	push   $0x2
+      29:	68 38 10 00 00       	push   $0x1038
+      2e:	6a 01                	push   $0x1
+      30:	e8 2b 0b 00 00       	call   b60 <printf>
+
+  printf(1, "Best Job First (BJF) Scheduler Test\n");
+      35:	5f                   	pop    %edi
+      36:	58                   	pop    %eax
+      37:	68 5c 10 00 00       	push   $0x105c
+      3c:	6a 01                	push   $0x1
+      3e:	e8 1d 0b 00 00       	call   b60 <printf>
+  printf(1, "------------------------------------\n");
+      43:	58                   	pop    %eax
+      44:	5a                   	pop    %edx
+      45:	68 84 10 00 00       	push   $0x1084
+      4a:	6a 01                	push   $0x1
+      4c:	e8 0f 0b 00 00       	call   b60 <printf>
+  printf(1, "Creating processes with different priorities and computation times:\n");
+      51:	59                   	pop    %ecx
+      52:	5b                   	pop    %ebx
+      53:	68 ac 10 00 00       	push   $0x10ac
+      58:	6a 01                	push   $0x1
+      5a:	e8 01 0b 00 00       	call   b60 <printf>
+  printf(1, "Process 0: High Priority (10), Medium Length\n");
+      5f:	5e                   	pop    %esi
+      60:	5f                   	pop    %edi
+      61:	68 f4 10 00 00       	push   $0x10f4
+      66:	6a 01                	push   $0x1
+      68:	e8 f3 0a 00 00       	call   b60 <printf>
+  printf(1, "Process 1: Low Priority (90), Medium Length\n"); 
+      6d:	58                   	pop    %eax
+      6e:	5a                   	pop    %edx
+      6f:	68 24 11 00 00       	push   $0x1124
+      74:	6a 01                	push   $0x1
+      76:	e8 e5 0a 00 00       	call   b60 <printf>
+  printf(1, "Process 2: Medium Priority (50), Medium Length\n");
+      7b:	59                   	pop    %ecx
+      7c:	5b                   	pop    %ebx
+      7d:	68 54 11 00 00       	push   $0x1154
+      82:	6a 01                	push   $0x1
+  // Priorities: High (10), Low (90), Medium (50)
+  int priorities[] = {10, 90, 50};
+  // Use the same computation length to isolate priority effect
+  int computation_lengths[] = {LOOP_MEDIUM, LOOP_MEDIUM, LOOP_MEDIUM};
+
+  for(i = 0; i < 3; i++) {
+      84:	31 db                	xor    %ebx,%ebx
+  printf(1, "Process 2: Medium Priority (50), Medium Length\n");
+      86:	e8 d5 0a 00 00       	call   b60 <printf>
+  printf(1, "(Lower priority number means higher priority)\n");
+      8b:	5e                   	pop    %esi
+      8c:	5f                   	pop    %edi
+      8d:	68 84 11 00 00       	push   $0x1184
+      92:	6a 01                	push   $0x1
+      94:	e8 c7 0a 00 00       	call   b60 <printf>
+  int priorities[] = {10, 90, 50};
+      99:	c7 45 d0 0a 00 00 00 	movl   $0xa,-0x30(%ebp)
+  int computation_lengths[] = {LOOP_MEDIUM, LOOP_MEDIUM, LOOP_MEDIUM};
+      a0:	83 c4 10             	add    $0x10,%esp
+  int priorities[] = {10, 90, 50};
+      a3:	c7 45 d4 5a 00 00 00 	movl   $0x5a,-0x2c(%ebp)
+      aa:	c7 45 d8 32 00 00 00 	movl   $0x32,-0x28(%ebp)
+  int computation_lengths[] = {LOOP_MEDIUM, LOOP_MEDIUM, LOOP_MEDIUM};
+      b1:	c7 45 dc 80 84 1e 00 	movl   $0x1e8480,-0x24(%ebp)
+      b8:	c7 45 e0 80 84 1e 00 	movl   $0x1e8480,-0x20(%ebp)
+      bf:	c7 45 e4 80 84 1e 00 	movl   $0x1e8480,-0x1c(%ebp)
+    pid = fork();
+      c6:	e8 95 03 00 00       	call   460 <fork>
+    if(pid < 0) {
+      cb:	85 c0                	test   %eax,%eax
+      cd:	78 77                	js     146 <main+0x146>
+      printf(1, "Error: fork failed\n");
+      exit();
+    }
+    if(pid == 0) {
+      cf:	0f 84 84 00 00 00    	je     159 <main+0x159>
+  for(i = 0; i < 3; i++) {
+      d5:	83 c3 01             	add    $0x1,%ebx
+      d8:	83 fb 03             	cmp    $0x3,%ebx
+      db:	75 e9                	jne    c6 <main+0xc6>
+      exit();
+    }
+  }
+
+  // Parent process: Give children time to set up
+  sleep(10); // Sleep to ensure all children run set_priority
+      dd:	83 ec 0c             	sub    $0xc,%esp
+      e0:	6a 0a                	push   $0xa
+      e2:	e8 76 08 00 00       	call   95d <sleep>
+  
+  // Parent waits for all children
+  printf(1, "Parent waiting for children (expect finish order based on priority: 0, 2, 1)...\n");
+      e7:	58                   	pop    %eax
+      e8:	5a                   	pop    %edx
+      e9:	68 70 12 00 00       	push   $0x1270
+      ee:	6a 01                	push   $0x1
+      f0:	e8 6b 0a 00 00       	call   b60 <printf>
+  for(i = 0; i < 3; i++) {
+    wait();
+      f5:	e8 ce 07 00 00       	call   8c8 <wait>
+      fa:	e8 c9 07 00 00       	call   8c8 <wait>
+      ff:	e8 c4 07 00 00       	call   8c8 <wait>
+  }
+
+  printf(1, "All child processes have completed\n");
+     104:	59                   	pop    %ecx
+     105:	5b                   	pop    %ebx
+     106:	68 c4 12 00 00       	push   $0x12c4
+     10b:	6a 01                	push   $0x1
+     10d:	e8 4e 0a 00 00       	call   b60 <printf>
+  printf(1, "Observe the finish order based on BJF criteria (priority, then creation time).\n");
+     112:	5e                   	pop    %esi
+     113:	5f                   	pop    %edi
+     114:	68 e8 12 00 00       	push   $0x12e8
+     119:	6a 01                	push   $0x1
+     11b:	e8 40 0a 00 00       	call   b60 <printf>
+  printf(1, "BJF scheduler test completed\n");
+     120:	58                   	pop    %eax
+     121:	5a                   	pop    %edx
+     122:	68 68 13 00 00       	push   $0x1368
+     127:	6a 01                	push   $0x1
+     129:	e8 32 0a 00 00       	call   b60 <printf>
+
+  exit();
+     12e:	e8 7d 03 00 00       	call   4b0 <exit>
+    printf(1, "Error setting scheduler policy to BJF\n");
+     133:	50                   	push   %eax
+     134:	50                   	push   %eax
+     135:	68 10 10 00 00       	push   $0x1010
+     13a:	6a 01                	push   $0x1
+     13c:	e8 1f 0a 00 00       	call   b60 <printf>
+    exit();
+     141:	e8 6a 03 00 00       	call   4b0 <exit>
+      printf(1, "Error: fork failed\n");
+     146:	53                   	push   %ebx
+     147:	53                   	push   %ebx
+     148:	68 38 13 00 00       	push   $0x1338
+     14d:	6a 01                	push   $0x1
+     14f:	e8 0c 0a 00 00       	call   b60 <printf>
+      exit();
+     154:	e8 57 03 00 00       	call   4b0 <exit>
+      int my_priority = priorities[i];
+     159:	8b 7c 9d d0          	mov    -0x30(%ebp,%ebx,4),%edi
+      if (set_priority(my_priority) < 0) {
+     15d:	83 ec 0c             	sub    $0xc,%esp
+      int len = computation_lengths[i];
+     160:	8b 74 9d dc          	mov    -0x24(%ebp,%ebx,4),%esi
+      if (set_priority(my_priority) < 0) {
+     164:	57                   	push   %edi
+     165:	e8 57 08 00 00       	call   9c1 <set_priority>
+     16a:	83 c4 10             	add    $0x10,%esp
+     16d:	85 c0                	test   %eax,%eax
+     16f:	78 77                	js     1e8 <main+0x1e8>
+         printf(1, "Child %d (PID %d) priority set to %d\n", i, getpid(), my_priority);
+     171:	e8 d3 07 00 00       	call   949 <getpid>
+     176:	83 ec 0c             	sub    $0xc,%esp
+     179:	57                   	push   %edi
+     17a:	50                   	push   %eax
+     17b:	53                   	push   %ebx
+     17c:	68 e8 11 00 00       	push   $0x11e8
+     181:	6a 01                	push   $0x1
+     183:	e8 d8 09 00 00       	call   b60 <printf>
+     188:	83 c4 20             	add    $0x20,%esp
+      printf(1, "Child %d (PID %d) created. Computation length: %d\n", i, getpid(), len);
+     18b:	e8 b9 07 00 00       	call   949 <getpid>
+     190:	83 ec 0c             	sub    $0xc,%esp
+        if(j % 200000 == 0) {
+     193:	bf 40 0d 03 00       	mov    $0x30d40,%edi
+      printf(1, "Child %d (PID %d) created. Computation length: %d\n", i, getpid(), len);
+     198:	56                   	push   %esi
+     199:	50                   	push   %eax
+     19a:	53                   	push   %ebx
+     19b:	68 10 12 00 00       	push   $0x1210
+     1a0:	6a 01                	push   $0x1
+     1a2:	e8 b9 09 00 00       	call   b60 <printf>
+      printf(1, "Child %d (PID %d) starting computation...\n", i, getpid());
+     1a7:	83 c4 20             	add    $0x20,%esp
+     1aa:	e8 9a 07 00 00       	call   949 <getpid>
+     1af:	50                   	push   %eax
+     1b0:	53                   	push   %ebx
+     1b1:	68 44 12 00 00       	push   $0x1244
+     1b6:	6a 01                	push   $0x1
+     1b8:	e8 a3 09 00 00       	call   b60 <printf>
+      for(j = 0; j < len; j++) {
+     1bd:	31 c9                	xor    %ecx,%ecx
+     1bf:	83 c4 10             	add    $0x10,%esp
+     1c2:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+     1c5:	eb 09                	jmp    1d0 <main+0x1d0>
+     1c7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+     1ca:	83 c0 01             	add    $0x1,%eax
+     1cd:	89 45 cc             	mov    %eax,-0x34(%ebp)
+     1d0:	8b 45 cc             	mov    -0x34(%ebp),%eax
+     1d3:	39 f0                	cmp    %esi,%eax
+     1d5:	7d 29                	jge    200 <main+0x200>
+        if(j % 200000 == 0) {
+     1d7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+     1da:	99                   	cltd
+     1db:	f7 ff                	idiv   %edi
+     1dd:	85 d2                	test   %edx,%edx
+     1df:	75 e6                	jne    1c7 <main+0x1c7>
+          yield();
+     1e1:	e8 f9 07 00 00       	call   9df <yield>
+     1e6:	eb df                	jmp    1c7 <main+0x1c7>
+         printf(1, "Child %d (PID %d): Warning - set_priority failed.\n", i, getpid());
+     1e8:	e8 5c 07 00 00       	call   949 <getpid>
+     1ed:	50                   	push   %eax
+     1ee:	53                   	push   %ebx
+     1ef:	68 b4 11 00 00       	push   $0x11b4
+     1f4:	6a 01                	push   $0x1
+     1f6:	e8 65 09 00 00       	call   b60 <printf>
+     1fb:	83 c4 10             	add    $0x10,%esp
+     1fe:	eb 8b                	jmp    18b <main+0x18b>
+      printf(1, "Child %d (PID %d) finished\n", i, getpid());
+     200:	e8 44 07 00 00       	call   949 <getpid>
+     205:	50                   	push   %eax
+     206:	53                   	push   %ebx
+     207:	68 4c 13 00 00       	push   $0x134c
+     20c:	6a 01                	push   $0x1
+     20e:	e8 4d 09 00 00       	call   b60 <printf>
+      exit();
+     213:	e8 98 02 00 00       	call   4b0 <exit>
+     218:	66 90                	xchg   %ax,%ax
+     21a:	66 90                	xchg   %ax,%ax
+     21c:	66 90                	xchg   %ax,%ax
+     21e:	66 90                	xchg   %ax,%ax
+
+00000220 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+     220:	55                   	push   %ebp
+     221:	89 e5                	mov    %esp,%ebp
+     223:	57                   	push   %edi
+     224:	56                   	push   %esi
+     225:	53                   	push   %ebx
+     226:	83 ec 4c             	sub    $0x4c,%esp
+     229:	8b 45 0c             	mov    0xc(%ebp),%eax
+     22c:	8b 55 08             	mov    0x8(%ebp),%edx
+     22f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     232:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+     235:	83 fa 0f             	cmp    $0xf,%edx
+     238:	0f 87 32 01 00 00    	ja     370 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+     23e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     244:	8b 80 80 18 00 00    	mov    0x1880(%eax),%eax
+     24a:	85 c0                	test   %eax,%eax
+     24c:	0f 84 de 00 00 00    	je     330 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+     252:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     258:	8b b0 84 18 00 00    	mov    0x1884(%eax),%esi
+     25e:	8d 88 80 18 00 00    	lea    0x1880(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+     264:	8d b8 88 18 00 00    	lea    0x1888(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+     26a:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+     26d:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+     270:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+     273:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+     279:	0f 8f 01 01 00 00    	jg     380 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+     27f:	8d 78 08             	lea    0x8(%eax),%edi
+     282:	8d bc 3e 80 18 00 00 	lea    0x1880(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     289:	85 db                	test   %ebx,%ebx
+     28b:	7e 3b                	jle    2c8 <bufwrite+0xa8>
+     28d:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+     290:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+     293:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     297:	90                   	nop
+    *dst++ = *src++;
+     298:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     299:	39 c6                	cmp    %eax,%esi
+     29b:	75 fb                	jne    298 <bufwrite+0x78>
+  ob[fd].n += n;
+     29d:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     2a3:	8b 88 84 18 00 00    	mov    0x1884(%eax),%ecx
+     2a9:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     2ab:	83 b8 80 18 00 00 01 	cmpl   $0x1,0x1880(%eax)
+  ob[fd].n += n;
+     2b2:	89 88 84 18 00 00    	mov    %ecx,0x1884(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     2b8:	74 26                	je     2e0 <bufwrite+0xc0>
+}
+     2ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     2bd:	5b                   	pop    %ebx
+     2be:	5e                   	pop    %esi
+     2bf:	5f                   	pop    %edi
+     2c0:	5d                   	pop    %ebp
+     2c1:	c3                   	ret
+     2c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+     2c8:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     2cb:	83 b8 80 18 00 00 01 	cmpl   $0x1,0x1880(%eax)
+  ob[fd].n += n;
+     2d2:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     2d5:	75 e3                	jne    2ba <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+     2d7:	85 db                	test   %ebx,%ebx
+     2d9:	74 df                	je     2ba <bufwrite+0x9a>
+     2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2df:	90                   	nop
+  src = vsrc;
+     2e0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     2e3:	01 c3                	add    %eax,%ebx
+     2e5:	eb 10                	jmp    2f7 <bufwrite+0xd7>
+     2e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2ee:	66 90                	xchg   %ax,%ax
+     2f0:	83 c0 01             	add    $0x1,%eax
+     2f3:	39 d8                	cmp    %ebx,%eax
+     2f5:	74 c3                	je     2ba <bufwrite+0x9a>
+    if(*p == (char)c)
+     2f7:	80 38 0a             	cmpb   $0xa,(%eax)
+     2fa:	75 f4                	jne    2f0 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     2fc:	85 c9                	test   %ecx,%ecx
+     2fe:	7e ba                	jle    2ba <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+     300:	83 ec 04             	sub    $0x4,%esp
+     303:	51                   	push   %ecx
+     304:	ff 75 ac             	push   -0x54(%ebp)
+     307:	52                   	push   %edx
+     308:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+     30b:	e8 cd 05 00 00       	call   8dd <write>
+    ob[fd].n = 0;
+     310:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     313:	83 c4 10             	add    $0x10,%esp
+     316:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+     31c:	c7 82 84 18 00 00 00 	movl   $0x0,0x1884(%edx)
+     323:	00 00 00 
+     326:	eb 92                	jmp    2ba <bufwrite+0x9a>
+     328:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     32f:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     330:	83 ec 08             	sub    $0x8,%esp
+     333:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     336:	50                   	push   %eax
+     337:	52                   	push   %edx
+     338:	89 55 b0             	mov    %edx,-0x50(%ebp)
+     33b:	e8 d7 05 00 00       	call   917 <fstat>
+     340:	83 c4 10             	add    $0x10,%esp
+     343:	8b 55 b0             	mov    -0x50(%ebp),%edx
+     346:	89 c1                	mov    %eax,%ecx
+     348:	b8 02 00 00 00       	mov    $0x2,%eax
+     34d:	85 c9                	test   %ecx,%ecx
+     34f:	75 0d                	jne    35e <bufwrite+0x13e>
+     351:	31 c0                	xor    %eax,%eax
+     353:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     358:	0f 95 c0             	setne  %al
+     35b:	83 c0 01             	add    $0x1,%eax
+     35e:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+     364:	89 81 80 18 00 00    	mov    %eax,0x1880(%ecx)
+     36a:	e9 e3 fe ff ff       	jmp    252 <bufwrite+0x32>
+     36f:	90                   	nop
+}
+     370:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     373:	5b                   	pop    %ebx
+     374:	5e                   	pop    %esi
+     375:	5f                   	pop    %edi
+     376:	5d                   	pop    %ebp
+    write(fd, p, n);
+     377:	e9 61 05 00 00       	jmp    8dd <write>
+     37c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+     380:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+     383:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+     386:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+     389:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+     38c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+     38f:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+     392:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+     395:	6a 02                	push   $0x2
+     397:	50                   	push   %eax
+     398:	52                   	push   %edx
+     399:	e8 9b 06 00 00       	call   a39 <writev>
+    ob[fd].n = 0;
+     39e:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+     3a1:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+     3a4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+     3ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     3ae:	5b                   	pop    %ebx
+     3af:	5e                   	pop    %esi
+     3b0:	5f                   	pop    %edi
+     3b1:	5d                   	pop    %ebp
+     3b2:	c3                   	ret
+     3b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003c0 <fflush>:
+{
+     3c0:	55                   	push   %ebp
+     3c1:	89 e5                	mov    %esp,%ebp
+     3c3:	53                   	push   %ebx
+     3c4:	83 ec 04             	sub    $0x4,%esp
+     3c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     3ca:	83 f8 0f             	cmp    $0xf,%eax
+     3cd:	77 16                	ja     3e5 <fflush+0x25>
+     3cf:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+     3d5:	8b 8a 84 18 00 00    	mov    0x1884(%edx),%ecx
+     3db:	8d 9a 80 18 00 00    	lea    0x1880(%edx),%ebx
+     3e1:	85 c9                	test   %ecx,%ecx
+     3e3:	7f 0b                	jg     3f0 <fflush+0x30>
+}
+     3e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3e8:	c9                   	leave
+     3e9:	c3                   	ret
+     3ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     3f0:	83 ec 04             	sub    $0x4,%esp
+     3f3:	81 c2 88 18 00 00    	add    $0x1888,%edx
+     3f9:	51                   	push   %ecx
+     3fa:	52                   	push   %edx
+     3fb:	50                   	push   %eax
+     3fc:	e8 dc 04 00 00       	call   8dd <write>
+    ob[fd].n = 0;
+     401:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     408:	83 c4 10             	add    $0x10,%esp
+}
+     40b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     40e:	c9                   	leave
+     40f:	c3                   	ret
+
+00000410 <fflushall>:
+{
+     410:	55                   	push   %ebp
+     411:	89 e5                	mov    %esp,%ebp
+     413:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     414:	31 f6                	xor    %esi,%esi
+{
+     416:	53                   	push   %ebx
+     417:	bb 88 18 00 00       	mov    $0x1888,%ebx
+     41c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     420:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     423:	85 c0                	test   %eax,%eax
+     425:	7e 15                	jle    43c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     427:	83 ec 04             	sub    $0x4,%esp
+     42a:	50                   	push   %eax
+     42b:	53                   	push   %ebx
+     42c:	56                   	push   %esi
+     42d:	e8 ab 04 00 00       	call   8dd <write>
+    ob[fd].n = 0;
+     432:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     439:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     43c:	83 c6 01             	add    $0x1,%esi
+     43f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     445:	83 fe 10             	cmp    $0x10,%esi
+     448:	75 d6                	jne    420 <fflushall+0x10>
+}
+     44a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     44d:	5b                   	pop    %ebx
+     44e:	5e                   	pop    %esi
+     44f:	5d                   	pop    %ebp
+     450:	c3                   	ret
+     451:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     458:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     45f:	90                   	nop
+
+00000460 <fork>:
+{
+     460:	55                   	push   %ebp
+     461:	89 e5                	mov    %esp,%ebp
+     463:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     464:	31 f6                	xor    %esi,%esi
+{
+     466:	53                   	push   %ebx
+     467:	bb 88 18 00 00       	mov    $0x1888,%ebx
+     46c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     470:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     473:	85 c0                	test   %eax,%eax
+     475:	7e 15                	jle    48c <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     477:	83 ec 04             	sub    $0x4,%esp
+     47a:	50                   	push   %eax
+     47b:	53                   	push   %ebx
+     47c:	56                   	push   %esi
+     47d:	e8 5b 04 00 00       	call   8dd <write>
+    ob[fd].n = 0;
+     482:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     489:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     48c:	83 c6 01             	add    $0x1,%esi
+     48f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     495:	83 fe 10             	cmp    $0x10,%esi
+     498:	75 d6                	jne    470 <fork+0x10>
+}
+     49a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     49d:	5b                   	pop    %ebx
+     49e:	5e                   	pop    %esi
+     49f:	5d                   	pop    %ebp
+  return _fork();
+     4a0:	e9 15 04 00 00       	jmp    8ba <_fork>
+     4a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004b0 <exit>:
+{
+     4b0:	55                   	push   %ebp
+     4b1:	89 e5                	mov    %esp,%ebp
+     4b3:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+     4b6:	e8 55 ff ff ff       	call   410 <fflushall>
+  _exit();
+     4bb:	e8 01 04 00 00       	call   8c1 <_exit>
+
+000004c0 <exec>:
+{
+     4c0:	55                   	push   %ebp
+     4c1:	89 e5                	mov    %esp,%ebp
+     4c3:	57                   	push   %edi
+     4c4:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     4c5:	31 f6                	xor    %esi,%esi
+{
+     4c7:	53                   	push   %ebx
+     4c8:	bb 88 18 00 00       	mov    $0x1888,%ebx
+     4cd:	83 ec 1c             	sub    $0x1c,%esp
+     4d0:	8b 45 08             	mov    0x8(%ebp),%eax
+     4d3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     4d6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     4d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     4e0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     4e3:	85 c0                	test   %eax,%eax
+     4e5:	7e 15                	jle    4fc <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     4e7:	83 ec 04             	sub    $0x4,%esp
+     4ea:	50                   	push   %eax
+     4eb:	53                   	push   %ebx
+     4ec:	56                   	push   %esi
+     4ed:	e8 eb 03 00 00       	call   8dd <write>
+    ob[fd].n = 0;
+     4f2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     4f9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     4fc:	83 c6 01             	add    $0x1,%esi
+     4ff:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     505:	83 fe 10             	cmp    $0x10,%esi
+     508:	75 d6                	jne    4e0 <exec+0x20>
+  return _exec(path, argv);
+     50a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     50d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+     510:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     513:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     516:	5b                   	pop    %ebx
+     517:	5e                   	pop    %esi
+     518:	5f                   	pop    %edi
+     519:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     51a:	e9 d3 03 00 00       	jmp    8f2 <_exec>
+     51f:	90                   	nop
+
+00000520 <close>:
+{
+     520:	55                   	push   %ebp
+     521:	89 e5                	mov    %esp,%ebp
+     523:	56                   	push   %esi
+     524:	53                   	push   %ebx
+     525:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     528:	83 fb 0f             	cmp    $0xf,%ebx
+     52b:	77 26                	ja     553 <close+0x33>
+     52d:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     533:	8b 90 84 18 00 00    	mov    0x1884(%eax),%edx
+     539:	8d b0 80 18 00 00    	lea    0x1880(%eax),%esi
+     53f:	85 d2                	test   %edx,%edx
+     541:	7f 25                	jg     568 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+     543:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     549:	c7 80 80 18 00 00 00 	movl   $0x0,0x1880(%eax)
+     550:	00 00 00 
+  return _close(fd);
+     553:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     556:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     559:	5b                   	pop    %ebx
+     55a:	5e                   	pop    %esi
+     55b:	5d                   	pop    %ebp
+  return _close(fd);
+     55c:	e9 83 03 00 00       	jmp    8e4 <_close>
+     561:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     568:	83 ec 04             	sub    $0x4,%esp
+     56b:	05 88 18 00 00       	add    $0x1888,%eax
+     570:	52                   	push   %edx
+     571:	50                   	push   %eax
+     572:	53                   	push   %ebx
+     573:	e8 65 03 00 00       	call   8dd <write>
+    ob[fd].n = 0;
+     578:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+     57f:	83 c4 10             	add    $0x10,%esp
+     582:	eb bf                	jmp    543 <close+0x23>
+     584:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     58b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     58f:	90                   	nop
+
+00000590 <strcpy>:
+{
+     590:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+     591:	31 c0                	xor    %eax,%eax
+{
+     593:	89 e5                	mov    %esp,%ebp
+     595:	53                   	push   %ebx
+     596:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     599:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     59c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     5a0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     5a4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     5a7:	83 c0 01             	add    $0x1,%eax
+     5aa:	84 d2                	test   %dl,%dl
+     5ac:	75 f2                	jne    5a0 <strcpy+0x10>
+}
+     5ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5b1:	89 c8                	mov    %ecx,%eax
+     5b3:	c9                   	leave
+     5b4:	c3                   	ret
+     5b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005c0 <strcmp>:
+{
+     5c0:	55                   	push   %ebp
+     5c1:	89 e5                	mov    %esp,%ebp
+     5c3:	53                   	push   %ebx
+     5c4:	8b 55 08             	mov    0x8(%ebp),%edx
+     5c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     5ca:	0f b6 02             	movzbl (%edx),%eax
+     5cd:	84 c0                	test   %al,%al
+     5cf:	75 17                	jne    5e8 <strcmp+0x28>
+     5d1:	eb 3a                	jmp    60d <strcmp+0x4d>
+     5d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5d7:	90                   	nop
+     5d8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     5dc:	83 c2 01             	add    $0x1,%edx
+     5df:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     5e2:	84 c0                	test   %al,%al
+     5e4:	74 1a                	je     600 <strcmp+0x40>
+    p++, q++;
+     5e6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     5e8:	0f b6 19             	movzbl (%ecx),%ebx
+     5eb:	38 c3                	cmp    %al,%bl
+     5ed:	74 e9                	je     5d8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     5ef:	29 d8                	sub    %ebx,%eax
+}
+     5f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5f4:	c9                   	leave
+     5f5:	c3                   	ret
+     5f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5fd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     600:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     604:	31 c0                	xor    %eax,%eax
+     606:	29 d8                	sub    %ebx,%eax
+}
+     608:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     60b:	c9                   	leave
+     60c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     60d:	0f b6 19             	movzbl (%ecx),%ebx
+     610:	31 c0                	xor    %eax,%eax
+     612:	eb db                	jmp    5ef <strcmp+0x2f>
+     614:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     61b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     61f:	90                   	nop
+
+00000620 <strlen>:
+{
+     620:	55                   	push   %ebp
+     621:	89 e5                	mov    %esp,%ebp
+     623:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+     626:	80 3a 00             	cmpb   $0x0,(%edx)
+     629:	74 15                	je     640 <strlen+0x20>
+     62b:	31 c0                	xor    %eax,%eax
+     62d:	8d 76 00             	lea    0x0(%esi),%esi
+     630:	83 c0 01             	add    $0x1,%eax
+     633:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     637:	89 c1                	mov    %eax,%ecx
+     639:	75 f5                	jne    630 <strlen+0x10>
+}
+     63b:	89 c8                	mov    %ecx,%eax
+     63d:	5d                   	pop    %ebp
+     63e:	c3                   	ret
+     63f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     640:	31 c9                	xor    %ecx,%ecx
+}
+     642:	5d                   	pop    %ebp
+     643:	89 c8                	mov    %ecx,%eax
+     645:	c3                   	ret
+     646:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     64d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000650 <memset>:
+{
+     650:	55                   	push   %ebp
+     651:	89 e5                	mov    %esp,%ebp
+     653:	57                   	push   %edi
+     654:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     657:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     65a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     65d:	89 d7                	mov    %edx,%edi
+     65f:	fc                   	cld
+     660:	f3 aa                	rep stos %al,%es:(%edi)
+}
+     662:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     665:	89 d0                	mov    %edx,%eax
+     667:	c9                   	leave
+     668:	c3                   	ret
+     669:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000670 <strchr>:
+{
+     670:	55                   	push   %ebp
+     671:	89 e5                	mov    %esp,%ebp
+     673:	8b 45 08             	mov    0x8(%ebp),%eax
+     676:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     67a:	0f b6 10             	movzbl (%eax),%edx
+     67d:	84 d2                	test   %dl,%dl
+     67f:	75 12                	jne    693 <strchr+0x23>
+     681:	eb 1d                	jmp    6a0 <strchr+0x30>
+     683:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     687:	90                   	nop
+     688:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     68c:	83 c0 01             	add    $0x1,%eax
+     68f:	84 d2                	test   %dl,%dl
+     691:	74 0d                	je     6a0 <strchr+0x30>
+    if(*s == c)
+     693:	38 d1                	cmp    %dl,%cl
+     695:	75 f1                	jne    688 <strchr+0x18>
+}
+     697:	5d                   	pop    %ebp
+     698:	c3                   	ret
+     699:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     6a0:	31 c0                	xor    %eax,%eax
+}
+     6a2:	5d                   	pop    %ebp
+     6a3:	c3                   	ret
+     6a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6af:	90                   	nop
+
+000006b0 <memchr>:
+{
+     6b0:	55                   	push   %ebp
+     6b1:	89 e5                	mov    %esp,%ebp
+     6b3:	8b 55 10             	mov    0x10(%ebp),%edx
+     6b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     6b9:	85 d2                	test   %edx,%edx
+     6bb:	74 1b                	je     6d8 <memchr+0x28>
+    if(*p == (char)c)
+     6bd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+     6c1:	01 c2                	add    %eax,%edx
+     6c3:	eb 0a                	jmp    6cf <memchr+0x1f>
+     6c5:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+     6c8:	83 c0 01             	add    $0x1,%eax
+     6cb:	39 c2                	cmp    %eax,%edx
+     6cd:	74 09                	je     6d8 <memchr+0x28>
+    if(*p == (char)c)
+     6cf:	38 08                	cmp    %cl,(%eax)
+     6d1:	75 f5                	jne    6c8 <memchr+0x18>
+}
+     6d3:	5d                   	pop    %ebp
+     6d4:	c3                   	ret
+     6d5:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+     6d8:	31 c0                	xor    %eax,%eax
+}
+     6da:	5d                   	pop    %ebp
+     6db:	c3                   	ret
+     6dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006e0 <gets>:
+{
+     6e0:	55                   	push   %ebp
+     6e1:	89 e5                	mov    %esp,%ebp
+     6e3:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+     6e4:	31 ff                	xor    %edi,%edi
+{
+     6e6:	56                   	push   %esi
+     6e7:	be 88 18 00 00       	mov    $0x1888,%esi
+     6ec:	53                   	push   %ebx
+     6ed:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     6f0:	8b 46 fc             	mov    -0x4(%esi),%eax
+     6f3:	85 c0                	test   %eax,%eax
+     6f5:	7e 15                	jle    70c <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     6f7:	83 ec 04             	sub    $0x4,%esp
+     6fa:	50                   	push   %eax
+     6fb:	56                   	push   %esi
+     6fc:	57                   	push   %edi
+     6fd:	e8 db 01 00 00       	call   8dd <write>
+    ob[fd].n = 0;
+     702:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+     709:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     70c:	83 c7 01             	add    $0x1,%edi
+     70f:	81 c6 08 01 00 00    	add    $0x108,%esi
+     715:	83 ff 10             	cmp    $0x10,%edi
+     718:	75 d6                	jne    6f0 <gets+0x10>
+  for(i=0; i+1 < max; ){
+     71a:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+     71c:	8d 75 e7             	lea    -0x19(%ebp),%esi
+     71f:	eb 2e                	jmp    74f <gets+0x6f>
+     721:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     728:	83 ec 04             	sub    $0x4,%esp
+     72b:	6a 01                	push   $0x1
+     72d:	56                   	push   %esi
+     72e:	6a 00                	push   $0x0
+     730:	e8 a1 01 00 00       	call   8d6 <read>
+    if(cc < 1)
+     735:	83 c4 10             	add    $0x10,%esp
+     738:	85 c0                	test   %eax,%eax
+     73a:	7e 1d                	jle    759 <gets+0x79>
+    buf[i++] = c;
+     73c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     740:	8b 55 08             	mov    0x8(%ebp),%edx
+     743:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     747:	3c 0a                	cmp    $0xa,%al
+     749:	74 10                	je     75b <gets+0x7b>
+     74b:	3c 0d                	cmp    $0xd,%al
+     74d:	74 0c                	je     75b <gets+0x7b>
+  for(i=0; i+1 < max; ){
+     74f:	89 df                	mov    %ebx,%edi
+     751:	83 c3 01             	add    $0x1,%ebx
+     754:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     757:	7c cf                	jl     728 <gets+0x48>
+     759:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     75b:	8b 45 08             	mov    0x8(%ebp),%eax
+     75e:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     762:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     765:	5b                   	pop    %ebx
+     766:	5e                   	pop    %esi
+     767:	5f                   	pop    %edi
+     768:	5d                   	pop    %ebp
+     769:	c3                   	ret
+     76a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000770 <stat>:
+{
+     770:	55                   	push   %ebp
+     771:	89 e5                	mov    %esp,%ebp
+     773:	57                   	push   %edi
+     774:	56                   	push   %esi
+     775:	53                   	push   %ebx
+     776:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+     779:	6a 00                	push   $0x0
+     77b:	ff 75 08             	push   0x8(%ebp)
+     77e:	e8 76 01 00 00       	call   8f9 <open>
+  if(fd < 0)
+     783:	83 c4 10             	add    $0x10,%esp
+     786:	85 c0                	test   %eax,%eax
+     788:	78 76                	js     800 <stat+0x90>
+  r = fstat(fd, st);
+     78a:	83 ec 08             	sub    $0x8,%esp
+     78d:	ff 75 0c             	push   0xc(%ebp)
+     790:	89 c3                	mov    %eax,%ebx
+     792:	50                   	push   %eax
+     793:	e8 7f 01 00 00       	call   917 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     798:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     79b:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     79d:	83 fb 0f             	cmp    $0xf,%ebx
+     7a0:	7f 40                	jg     7e2 <stat+0x72>
+     7a2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     7a8:	8b 90 84 18 00 00    	mov    0x1884(%eax),%edx
+     7ae:	8d b8 80 18 00 00    	lea    0x1880(%eax),%edi
+     7b4:	85 d2                	test   %edx,%edx
+     7b6:	7e 1a                	jle    7d2 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+     7b8:	83 ec 04             	sub    $0x4,%esp
+     7bb:	05 88 18 00 00       	add    $0x1888,%eax
+     7c0:	52                   	push   %edx
+     7c1:	50                   	push   %eax
+     7c2:	53                   	push   %ebx
+     7c3:	e8 15 01 00 00       	call   8dd <write>
+    ob[fd].n = 0;
+     7c8:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+     7cf:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+     7d2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     7d8:	c7 80 80 18 00 00 00 	movl   $0x0,0x1880(%eax)
+     7df:	00 00 00 
+  return _close(fd);
+     7e2:	83 ec 0c             	sub    $0xc,%esp
+     7e5:	53                   	push   %ebx
+     7e6:	e8 f9 00 00 00       	call   8e4 <_close>
+     7eb:	83 c4 10             	add    $0x10,%esp
+}
+     7ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     7f1:	89 f0                	mov    %esi,%eax
+     7f3:	5b                   	pop    %ebx
+     7f4:	5e                   	pop    %esi
+     7f5:	5f                   	pop    %edi
+     7f6:	5d                   	pop    %ebp
+     7f7:	c3                   	ret
+     7f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ff:	90                   	nop
+    return -1;
+     800:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     805:	eb e7                	jmp    7ee <stat+0x7e>
+     807:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     80e:	66 90                	xchg   %ax,%ax
+
+00000810 <atoi>:
+{
+     810:	55                   	push   %ebp
+     811:	89 e5                	mov    %esp,%ebp
+     813:	53                   	push   %ebx
+     814:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     817:	0f be 02             	movsbl (%edx),%eax
+     81a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     81d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     820:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     825:	77 1e                	ja     845 <atoi+0x35>
+     827:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     82e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     830:	83 c2 01             	add    $0x1,%edx
+     833:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     836:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     83a:	0f be 02             	movsbl (%edx),%eax
+     83d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     840:	80 fb 09             	cmp    $0x9,%bl
+     843:	76 eb                	jbe    830 <atoi+0x20>
+}
+     845:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     848:	89 c8                	mov    %ecx,%eax
+     84a:	c9                   	leave
+     84b:	c3                   	ret
+     84c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000850 <memmove>:
+{
+     850:	55                   	push   %ebp
+     851:	89 e5                	mov    %esp,%ebp
+     853:	57                   	push   %edi
+     854:	56                   	push   %esi
+     855:	8b 45 10             	mov    0x10(%ebp),%eax
+     858:	8b 55 08             	mov    0x8(%ebp),%edx
+     85b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     85e:	85 c0                	test   %eax,%eax
+     860:	7e 13                	jle    875 <memmove+0x25>
+     862:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     864:	89 d7                	mov    %edx,%edi
+     866:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     86d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     870:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     871:	39 f8                	cmp    %edi,%eax
+     873:	75 fb                	jne    870 <memmove+0x20>
+  return vdst;
+}
+     875:	5e                   	pop    %esi
+     876:	89 d0                	mov    %edx,%eax
+     878:	5f                   	pop    %edi
+     879:	5d                   	pop    %ebp
+     87a:	c3                   	ret
+
+0000087b <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+     87b:	83 3d 78 18 00 00 00 	cmpl   $0x0,0x1878
+  jle 1f
+     882:	7e 0a                	jle    88e <syscallentry+0x13>
+  movl %esp, %ecx
+     884:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+     886:	ba 8d 08 00 00       	mov    $0x88d,%edx
+  sysenter
+     88b:	0f 34                	sysenter
+2:
+  ret
+     88d:	c3                   	ret
+1:
+  jl 3f
+     88e:	7c 27                	jl     8b7 <syscallentry+0x3c>
+  pushal
+     890:	60                   	pusha
+  movl $1, %eax
+     891:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     896:	0f a2                	cpuid
+  movl $-1, sysentermode
+     898:	c7 05 78 18 00 00 ff 	movl   $0xffffffff,0x1878
+     89f:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     8a2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+     8a8:	74 0a                	je     8b4 <syscallentry+0x39>
+  movl $1, sysentermode
+     8aa:	c7 05 78 18 00 00 01 	movl   $0x1,0x1878
+     8b1:	00 00 00 
+4:
+  popal
+     8b4:	61                   	popa
+  jmp syscallentry
+     8b5:	eb c4                	jmp    87b <syscallentry>
+3:
+  int $T_SYSCALL
+     8b7:	cd 40                	int    $0x40
+  ret
+     8b9:	c3                   	ret
+
+000008ba <_fork>:
+
+SYSCALLAS(_fork, fork)
+     8ba:	b8 01 00 00 00       	mov    $0x1,%eax
+     8bf:	eb ba                	jmp    87b <syscallentry>
+
+000008c1 <_exit>:
+SYSCALLAS(_exit, exit)
+     8c1:	b8 02 00 00 00       	mov    $0x2,%eax
+     8c6:	eb b3                	jmp    87b <syscallentry>
+
+000008c8 <wait>:
+SYSCALL(wait)
+     8c8:	b8 03 00 00 00       	mov    $0x3,%eax
+     8cd:	eb ac                	jmp    87b <syscallentry>
+
+000008cf <pipe>:
+SYSCALL(pipe)
+     8cf:	b8 04 00 00 00       	mov    $0x4,%eax
+     8d4:	eb a5                	jmp    87b <syscallentry>
+
+000008d6 <read>:
+SYSCALL(read)
+     8d6:	b8 05 00 00 00       	mov    $0x5,%eax
+     8db:	eb 9e                	jmp    87b <syscallentry>
+
+000008dd <write>:
+SYSCALL(write)
+     8dd:	b8 10 00 00 00       	mov    $0x10,%eax
+     8e2:	eb 97                	jmp    87b <syscallentry>
+
+000008e4 <_close>:
+SYSCALLAS(_close, close)
+     8e4:	b8 15 00 00 00       	mov    $0x15,%eax
+     8e9:	eb 90                	jmp    87b <syscallentry>
+
+000008eb <kill>:
+SYSCALL(kill)
+     8eb:	b8 06 00 00 00       	mov    $0x6,%eax
+     8f0:	eb 89                	jmp    87b <syscallentry>
+
+000008f2 <_exec>:
+SYSCALLAS(_exec, exec)
+     8f2:	b8 07 00 00 00       	mov    $0x7,%eax
+     8f7:	eb 82                	jmp    87b <syscallentry>
+
+000008f9 <open>:
+SYSCALL(open)
+     8f9:	b8 0f 00 00 00       	mov    $0xf,%eax
+     8fe:	e9 78 ff ff ff       	jmp    87b <syscallentry>
+
+00000903 <mknod>:
+SYSCALL(mknod)
+     903:	b8 11 00 00 00       	mov    $0x11,%eax
+     908:	e9 6e ff ff ff       	jmp    87b <syscallentry>
+
+0000090d <unlink>:
+SYSCALL(unlink)
+     90d:	b8 12 00 00 00       	mov    $0x12,%eax
+     912:	e9 64 ff ff ff       	jmp    87b <syscallentry>
+
+00000917 <fstat>:
+SYSCALL(fstat)
+     917:	b8 08 00 00 00       	mov    $0x8,%eax
+     91c:	e9 5a ff ff ff       	jmp    87b <syscallentry>
+
+00000921 <link>:
+SYSCALL(link)
+     921:	b8 13 00 00 00       	mov    $0x13,%eax
+     926:	e9 50 ff ff ff       	jmp    87b <syscallentry>
+
+0000092b <mkdir>:
+SYSCALL(mkdir)
+     92b:	b8 14 00 00 00       	mov    $0x14,%eax
+     930:	e9 46 ff ff ff       	jmp    87b <syscallentry>
+
+00000935 <chdir>:
+SYSCALL(chdir)
+     935:	b8 09 00 00 00       	mov    $0x9,%eax
+     93a:	e9 3c ff ff ff       	jmp    87b <syscallentry>
+
+0000093f <dup>:
+SYSCALL(dup)
+     93f:	b8 0a 00 00 00       	mov    $0xa,%eax
+     944:	e9 32 ff ff ff       	jmp    87b <syscallentry>
+
+00000949 <getpid>:
+SYSCALL(getpid)
+     949:	b8 0b 00 00 00       	mov    $0xb,%eax
+     94e:	e9 28 ff ff ff       	jmp    87b <syscallentry>
+
+00000953 <sbrk>:
+SYSCALL(sbrk)
+     953:	b8 0c 00 00 00       	mov    $0xc,%eax
+     958:	e9 1e ff ff ff       	jmp    87b <syscallentry>
+
+0000095d <sleep>:
+SYSCALL(sleep)
+     95d:	b8 0d 00 00 00       	mov    $0xd,%eax
+     962:	e9 14 ff ff ff       	jmp    87b <syscallentry>
+
+00000967 <uptime>:
+SYSCALL(uptime)
+     967:	b8 0e 00 00 00       	mov    $0xe,%eax
+     96c:	e9 0a ff ff ff       	jmp    87b <syscallentry>
+
+00000971 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+     971:	b8 16 00 00 00       	mov    $0x16,%eax
+     976:	e9 00 ff ff ff       	jmp    87b <syscallentry>
+
+0000097b <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+     97b:	b8 17 00 00 00       	mov    $0x17,%eax
+     980:	e9 f6 fe ff ff       	jmp    87b <syscallentry>
+
+00000985 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+     985:	b8 18 00 00 00       	mov    $0x18,%eax
+     98a:	e9 ec fe ff ff       	jmp    87b <syscallentry>
+
+0000098f <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+     98f:	b8 19 00 00 00       	mov    $0x19,%eax
+     994:	e9 e2 fe ff ff       	jmp    87b <syscallentry>
+
+00000999 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+     999:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     99e:	e9 d8 fe ff ff       	jmp    87b <syscallentry>
+
+000009a3 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+     9a3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     9a8:	e9 ce fe ff ff       	jmp    87b <syscallentry>
+
+000009ad <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+     9ad:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     9b2:	e9 c4 fe ff ff       	jmp    87b <syscallentry>
+
+000009b7 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+     9b7:	b8 20 00 00 00       	mov    $0x20,%eax
+     9bc:	e9 ba fe ff ff       	jmp    87b <syscallentry>
+
+000009c1 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+     9c1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     9c6:	e9 b0 fe ff ff       	jmp    87b <syscallentry>
+
+000009cb <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+     9cb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     9d0:	e9 a6 fe ff ff       	jmp    87b <syscallentry>
+
+000009d5 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+     9d5:	b8 21 00 00 00       	mov    $0x21,%eax
+     9da:	e9 9c fe ff ff       	jmp    87b <syscallentry>
+
+000009df <yield>:
+SYSCALL(yield) // yield the CPU to another process
+     9df:	b8 22 00 00 00       	mov    $0x22,%eax
+     9e4:	e9 92 fe ff ff       	jmp    87b <syscallentry>
+
+000009e9 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+     9e9:	b8 23 00 00 00       	mov    $0x23,%eax
+     9ee:	e9 88 fe ff ff       	jmp    87b <syscallentry>
+
+000009f3 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+     9f3:	b8 24 00 00 00       	mov    $0x24,%eax
+     9f8:	e9 7e fe ff ff       	jmp    87b <syscallentry>
+
+000009fd <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+     9fd:	b8 25 00 00 00       	mov    $0x25,%eax
+     a02:	e9 74 fe ff ff       	jmp    87b <syscallentry>
+
+00000a07 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+     a07:	b8 26 00 00 00       	mov    $0x26,%eax
+     a0c:	e9 6a fe ff ff       	jmp    87b <syscallentry>
+
+00000a11 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+     a11:	b8 27 00 00 00       	mov    $0x27,%eax
+     a16:	e9 60 fe ff ff       	jmp    87b <syscallentry>
+
+00000a1b <mmap>:
+SYSCALL(mmap) // map a file into memory
+     a1b:	b8 28 00 00 00       	mov    $0x28,%eax
+     a20:	e9 56 fe ff ff       	jmp    87b <syscallentry>
+
+00000a25 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+     a25:	b8 29 00 00 00       	mov    $0x29,%eax
+     a2a:	e9 4c fe ff ff       	jmp    87b <syscallentry>
+
+00000a2f <readv>:
+SYSCALL(readv) // read into several buffers
+     a2f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     a34:	e9 42 fe ff ff       	jmp    87b <syscallentry>
+
+00000a39 <writev>:
+SYSCALL(writev) // write from several buffers
+     a39:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     a3e:	e9 38 fe ff ff       	jmp    87b <syscallentry>
+
+00000a43 <pread>:
+SYSCALL(pread) // read at an offset
+     a43:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     a48:	e9 2e fe ff ff       	jmp    87b <syscallentry>
+
+00000a4d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+     a4d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     a52:	e9 24 fe ff ff       	jmp    87b <syscallentry>
+
+00000a57 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+     a57:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     a5c:	e9 1a fe ff ff       	jmp    87b <syscallentry>
+
+00000a61 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+     a61:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     a66:	e9 10 fe ff ff       	jmp    87b <syscallentry>
+
+00000a6b <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+     a6b:	b8 30 00 00 00       	mov    $0x30,%eax
+     a70:	e9 06 fe ff ff       	jmp    87b <syscallentry>
+
+00000a75 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+     a75:	b8 31 00 00 00       	mov    $0x31,%eax
+     a7a:	e9 fc fd ff ff       	jmp    87b <syscallentry>
+
+00000a7f <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+     a7f:	b8 32 00 00 00       	mov    $0x32,%eax
+     a84:	e9 f2 fd ff ff       	jmp    87b <syscallentry>
+
+00000a89 <profread>:
+SYSCALL(profread) // drain profiler samples
+     a89:	b8 33 00 00 00       	mov    $0x33,%eax
+     a8e:	e9 e8 fd ff ff       	jmp    87b <syscallentry>
+
+00000a93 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+     a93:	b8 34 00 00 00       	mov    $0x34,%eax
+     a98:	e9 de fd ff ff       	jmp    87b <syscallentry>
+
+00000a9d <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+     a9d:	b8 35 00 00 00       	mov    $0x35,%eax
+     aa2:	e9 d4 fd ff ff       	jmp    87b <syscallentry>
+
+00000aa7 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+     aa7:	b8 36 00 00 00       	mov    $0x36,%eax
+     aac:	e9 ca fd ff ff       	jmp    87b <syscallentry>
+
+00000ab1 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+     ab1:	b8 37 00 00 00       	mov    $0x37,%eax
+     ab6:	e9 c0 fd ff ff       	jmp    87b <syscallentry>
+     abb:	66 90                	xchg   %ax,%ax
+     abd:	66 90                	xchg   %ax,%ax
+     abf:	90                   	nop
+
+00000ac0 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     ac0:	55                   	push   %ebp
+     ac1:	89 e5                	mov    %esp,%ebp
+     ac3:	57                   	push   %edi
+     ac4:	56                   	push   %esi
+     ac5:	53                   	push   %ebx
+     ac6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     ac8:	89 d1                	mov    %edx,%ecx
+{
+     aca:	83 ec 3c             	sub    $0x3c,%esp
+     acd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     ad0:	85 d2                	test   %edx,%edx
+     ad2:	0f 89 80 00 00 00    	jns    b58 <printint+0x98>
+     ad8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     adc:	74 7a                	je     b58 <printint+0x98>
+    x = -xx;
+     ade:	f7 d9                	neg    %ecx
+    neg = 1;
+     ae0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     ae5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     ae8:	31 f6                	xor    %esi,%esi
+     aea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     af0:	89 c8                	mov    %ecx,%eax
+     af2:	31 d2                	xor    %edx,%edx
+     af4:	89 f7                	mov    %esi,%edi
+     af6:	f7 f3                	div    %ebx
+     af8:	8d 76 01             	lea    0x1(%esi),%esi
+     afb:	0f b6 92 e8 13 00 00 	movzbl 0x13e8(%edx),%edx
+     b02:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     b06:	89 ca                	mov    %ecx,%edx
+     b08:	89 c1                	mov    %eax,%ecx
+     b0a:	39 da                	cmp    %ebx,%edx
+     b0c:	73 e2                	jae    af0 <printint+0x30>
+  if(neg)
+     b0e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     b11:	85 c0                	test   %eax,%eax
+     b13:	74 07                	je     b1c <printint+0x5c>
+    buf[i++] = '-';
+     b15:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     b1a:	89 f7                	mov    %esi,%edi
+     b1c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     b1f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     b22:	01 df                	add    %ebx,%edi
+     b24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     b28:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+     b2b:	83 ec 04             	sub    $0x4,%esp
+     b2e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     b31:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     b34:	6a 01                	push   $0x1
+     b36:	50                   	push   %eax
+     b37:	56                   	push   %esi
+     b38:	e8 e3 f6 ff ff       	call   220 <bufwrite>
+  while(--i >= 0)
+     b3d:	89 f8                	mov    %edi,%eax
+     b3f:	83 c4 10             	add    $0x10,%esp
+     b42:	83 ef 01             	sub    $0x1,%edi
+     b45:	39 d8                	cmp    %ebx,%eax
+     b47:	75 df                	jne    b28 <printint+0x68>
+}
+     b49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b4c:	5b                   	pop    %ebx
+     b4d:	5e                   	pop    %esi
+     b4e:	5f                   	pop    %edi
+     b4f:	5d                   	pop    %ebp
+     b50:	c3                   	ret
+     b51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     b58:	31 c0                	xor    %eax,%eax
+     b5a:	eb 89                	jmp    ae5 <printint+0x25>
+     b5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b60 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     b60:	55                   	push   %ebp
+     b61:	89 e5                	mov    %esp,%ebp
+     b63:	57                   	push   %edi
+     b64:	56                   	push   %esi
+     b65:	53                   	push   %ebx
+     b66:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     b69:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b6c:	0f b6 18             	movzbl (%eax),%ebx
+     b6f:	84 db                	test   %bl,%bl
+     b71:	74 6c                	je     bdf <printf+0x7f>
+     b73:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+     b76:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+     b79:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     b7b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     b7e:	eb 26                	jmp    ba6 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     b80:	83 f8 25             	cmp    $0x25,%eax
+     b83:	74 4b                	je     bd0 <printf+0x70>
+  bufwrite(fd, &c, 1);
+     b85:	83 ec 04             	sub    $0x4,%esp
+     b88:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     b8b:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     b8e:	6a 01                	push   $0x1
+     b90:	50                   	push   %eax
+     b91:	ff 75 08             	push   0x8(%ebp)
+     b94:	e8 87 f6 ff ff       	call   220 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+     b99:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     b9c:	0f b6 1f             	movzbl (%edi),%ebx
+     b9f:	83 c7 01             	add    $0x1,%edi
+     ba2:	84 db                	test   %bl,%bl
+     ba4:	74 39                	je     bdf <printf+0x7f>
+    c = fmt[i] & 0xff;
+     ba6:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     ba9:	85 f6                	test   %esi,%esi
+     bab:	74 d3                	je     b80 <printf+0x20>
+      }
+    } else if(state == '%'){
+     bad:	83 fe 25             	cmp    $0x25,%esi
+     bb0:	75 ea                	jne    b9c <printf+0x3c>
+      if(c == 'd'){
+     bb2:	83 f8 25             	cmp    $0x25,%eax
+     bb5:	0f 84 d5 01 00 00    	je     d90 <printf+0x230>
+     bbb:	83 e8 63             	sub    $0x63,%eax
+     bbe:	83 f8 15             	cmp    $0x15,%eax
+     bc1:	77 45                	ja     c08 <printf+0xa8>
+     bc3:	ff 24 85 90 13 00 00 	jmp    *0x1390(,%eax,4)
+     bca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     bd0:	0f b6 1f             	movzbl (%edi),%ebx
+     bd3:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+     bd6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     bdb:	84 db                	test   %bl,%bl
+     bdd:	75 c7                	jne    ba6 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+     bdf:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+     be3:	74 0b                	je     bf0 <printf+0x90>
+    fflush(fd);
+}
+     be5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     be8:	5b                   	pop    %ebx
+     be9:	5e                   	pop    %esi
+     bea:	5f                   	pop    %edi
+     beb:	5d                   	pop    %ebp
+     bec:	c3                   	ret
+     bed:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+     bf0:	83 ec 0c             	sub    $0xc,%esp
+     bf3:	6a 02                	push   $0x2
+     bf5:	e8 c6 f7 ff ff       	call   3c0 <fflush>
+     bfa:	83 c4 10             	add    $0x10,%esp
+}
+     bfd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c00:	5b                   	pop    %ebx
+     c01:	5e                   	pop    %esi
+     c02:	5f                   	pop    %edi
+     c03:	5d                   	pop    %ebp
+     c04:	c3                   	ret
+     c05:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+     c08:	83 ec 04             	sub    $0x4,%esp
+     c0b:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     c0e:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+     c12:	6a 01                	push   $0x1
+     c14:	52                   	push   %edx
+     c15:	89 55 c0             	mov    %edx,-0x40(%ebp)
+     c18:	ff 75 08             	push   0x8(%ebp)
+     c1b:	e8 00 f6 ff ff       	call   220 <bufwrite>
+     c20:	83 c4 0c             	add    $0xc,%esp
+     c23:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     c26:	6a 01                	push   $0x1
+     c28:	8b 55 c0             	mov    -0x40(%ebp),%edx
+     c2b:	52                   	push   %edx
+      state = 0;
+     c2c:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+     c2e:	ff 75 08             	push   0x8(%ebp)
+     c31:	e8 ea f5 ff ff       	call   220 <bufwrite>
+        putc(fd, c);
+     c36:	83 c4 10             	add    $0x10,%esp
+     c39:	e9 5e ff ff ff       	jmp    b9c <printf+0x3c>
+     c3e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+     c40:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     c43:	83 ec 0c             	sub    $0xc,%esp
+     c46:	b9 10 00 00 00       	mov    $0x10,%ecx
+     c4b:	8b 16                	mov    (%esi),%edx
+     c4d:	6a 00                	push   $0x0
+     c4f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+     c52:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+     c55:	e8 66 fe ff ff       	call   ac0 <printint>
+        ap++;
+     c5a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     c5d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     c60:	31 f6                	xor    %esi,%esi
+     c62:	e9 35 ff ff ff       	jmp    b9c <printf+0x3c>
+     c67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c6e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     c70:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     c73:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     c75:	83 c0 04             	add    $0x4,%eax
+     c78:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+     c7b:	b8 86 13 00 00       	mov    $0x1386,%eax
+     c80:	85 db                	test   %ebx,%ebx
+     c82:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+     c85:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+     c88:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+     c8a:	53                   	push   %ebx
+     c8b:	e8 90 f9 ff ff       	call   620 <strlen>
+     c90:	83 c4 0c             	add    $0xc,%esp
+     c93:	50                   	push   %eax
+     c94:	53                   	push   %ebx
+     c95:	ff 75 08             	push   0x8(%ebp)
+     c98:	e8 83 f5 ff ff       	call   220 <bufwrite>
+     c9d:	83 c4 10             	add    $0x10,%esp
+     ca0:	e9 f7 fe ff ff       	jmp    b9c <printf+0x3c>
+     ca5:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+     ca8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+     cab:	83 ec 04             	sub    $0x4,%esp
+     cae:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+     cb1:	8b 06                	mov    (%esi),%eax
+        ap++;
+     cb3:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+     cb6:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+     cb9:	6a 01                	push   $0x1
+     cbb:	52                   	push   %edx
+     cbc:	ff 75 08             	push   0x8(%ebp)
+     cbf:	e8 5c f5 ff ff       	call   220 <bufwrite>
+        ap++;
+     cc4:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     cc7:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     cca:	31 f6                	xor    %esi,%esi
+     ccc:	e9 cb fe ff ff       	jmp    b9c <printf+0x3c>
+     cd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+     cd8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     cdb:	83 ec 0c             	sub    $0xc,%esp
+     cde:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     ce3:	8b 16                	mov    (%esi),%edx
+     ce5:	6a 01                	push   $0x1
+     ce7:	e9 63 ff ff ff       	jmp    c4f <printf+0xef>
+     cec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+     cf0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     cf3:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     cf6:	89 7d c0             	mov    %edi,-0x40(%ebp)
+     cf9:	89 55 bc             	mov    %edx,-0x44(%ebp)
+     cfc:	8b 18                	mov    (%eax),%ebx
+     cfe:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+     d01:	31 c0                	xor    %eax,%eax
+     d03:	89 c7                	mov    %eax,%edi
+     d05:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+     d08:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+     d0d:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+     d0f:	f7 e1                	mul    %ecx
+     d11:	c1 ea 03             	shr    $0x3,%edx
+     d14:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     d17:	89 d1                	mov    %edx,%ecx
+     d19:	01 c0                	add    %eax,%eax
+     d1b:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     d1d:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+     d1f:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     d21:	be 0a 00 00 00       	mov    $0xa,%esi
+     d26:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+     d28:	89 da                	mov    %ebx,%edx
+     d2a:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+     d2c:	89 fe                	mov    %edi,%esi
+     d2e:	83 c7 01             	add    $0x1,%edi
+     d31:	8d 42 30             	lea    0x30(%edx),%eax
+     d34:	89 da                	mov    %ebx,%edx
+     d36:	8d 14 92             	lea    (%edx,%edx,4),%edx
+     d39:	01 d2                	add    %edx,%edx
+     d3b:	29 d0                	sub    %edx,%eax
+     d3d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+     d41:	89 c8                	mov    %ecx,%eax
+     d43:	09 d8                	or     %ebx,%eax
+     d45:	75 c1                	jne    d08 <printf+0x1a8>
+     d47:	8b 55 bc             	mov    -0x44(%ebp),%edx
+     d4a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     d4d:	01 d6                	add    %edx,%esi
+     d4f:	89 f7                	mov    %esi,%edi
+     d51:	89 d6                	mov    %edx,%esi
+     d53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d57:	90                   	nop
+    putc(fd, buf[i]);
+     d58:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+     d5b:	83 ec 04             	sub    $0x4,%esp
+     d5e:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+     d61:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+     d64:	6a 01                	push   $0x1
+     d66:	50                   	push   %eax
+     d67:	53                   	push   %ebx
+     d68:	e8 b3 f4 ff ff       	call   220 <bufwrite>
+  while(--i >= 0)
+     d6d:	89 fa                	mov    %edi,%edx
+     d6f:	83 c4 10             	add    $0x10,%esp
+     d72:	83 ef 01             	sub    $0x1,%edi
+     d75:	39 d6                	cmp    %edx,%esi
+     d77:	75 df                	jne    d58 <printf+0x1f8>
+        ap += 2;
+     d79:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+     d7d:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+     d80:	31 f6                	xor    %esi,%esi
+     d82:	e9 15 fe ff ff       	jmp    b9c <printf+0x3c>
+     d87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d8e:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+     d90:	83 ec 04             	sub    $0x4,%esp
+     d93:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     d96:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     d99:	6a 01                	push   $0x1
+     d9b:	e9 8b fe ff ff       	jmp    c2b <printf+0xcb>
+
+00000da0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     da0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     da1:	a1 00 29 00 00       	mov    0x2900,%eax
+{
+     da6:	89 e5                	mov    %esp,%ebp
+     da8:	57                   	push   %edi
+     da9:	56                   	push   %esi
+     daa:	53                   	push   %ebx
+     dab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     dae:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     db1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     db8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     dba:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     dbc:	39 ca                	cmp    %ecx,%edx
+     dbe:	73 30                	jae    df0 <free+0x50>
+     dc0:	39 c1                	cmp    %eax,%ecx
+     dc2:	72 04                	jb     dc8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     dc4:	39 c2                	cmp    %eax,%edx
+     dc6:	72 f0                	jb     db8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     dc8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     dcb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     dce:	39 f8                	cmp    %edi,%eax
+     dd0:	74 2e                	je     e00 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     dd2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     dd5:	8b 42 04             	mov    0x4(%edx),%eax
+     dd8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     ddb:	39 f1                	cmp    %esi,%ecx
+     ddd:	74 38                	je     e17 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     ddf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     de1:	5b                   	pop    %ebx
+  freep = p;
+     de2:	89 15 00 29 00 00    	mov    %edx,0x2900
+}
+     de8:	5e                   	pop    %esi
+     de9:	5f                   	pop    %edi
+     dea:	5d                   	pop    %ebp
+     deb:	c3                   	ret
+     dec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     df0:	39 c1                	cmp    %eax,%ecx
+     df2:	72 d0                	jb     dc4 <free+0x24>
+     df4:	eb c2                	jmp    db8 <free+0x18>
+     df6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dfd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+     e00:	03 70 04             	add    0x4(%eax),%esi
+     e03:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e06:	8b 02                	mov    (%edx),%eax
+     e08:	8b 00                	mov    (%eax),%eax
+     e0a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     e0d:	8b 42 04             	mov    0x4(%edx),%eax
+     e10:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     e13:	39 f1                	cmp    %esi,%ecx
+     e15:	75 c8                	jne    ddf <free+0x3f>
+    p->s.size += bp->s.size;
+     e17:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     e1a:	89 15 00 29 00 00    	mov    %edx,0x2900
+    p->s.size += bp->s.size;
+     e20:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     e23:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     e26:	89 0a                	mov    %ecx,(%edx)
+}
+     e28:	5b                   	pop    %ebx
+     e29:	5e                   	pop    %esi
+     e2a:	5f                   	pop    %edi
+     e2b:	5d                   	pop    %ebp
+     e2c:	c3                   	ret
+     e2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e30 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     e30:	55                   	push   %ebp
+     e31:	89 e5                	mov    %esp,%ebp
+     e33:	57                   	push   %edi
+     e34:	56                   	push   %esi
+     e35:	53                   	push   %ebx
+     e36:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     e39:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+     e3c:	8b 15 00 29 00 00    	mov    0x2900,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     e42:	8d 78 07             	lea    0x7(%eax),%edi
+     e45:	c1 ef 03             	shr    $0x3,%edi
+     e48:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+     e4b:	85 d2                	test   %edx,%edx
+     e4d:	0f 84 8d 00 00 00    	je     ee0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     e53:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     e55:	8b 48 04             	mov    0x4(%eax),%ecx
+     e58:	39 f9                	cmp    %edi,%ecx
+     e5a:	73 64                	jae    ec0 <malloc+0x90>
+  if(nu < 4096)
+     e5c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     e61:	39 df                	cmp    %ebx,%edi
+     e63:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     e66:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     e6d:	eb 0a                	jmp    e79 <malloc+0x49>
+     e6f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     e70:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     e72:	8b 48 04             	mov    0x4(%eax),%ecx
+     e75:	39 f9                	cmp    %edi,%ecx
+     e77:	73 47                	jae    ec0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     e79:	89 c2                	mov    %eax,%edx
+     e7b:	39 05 00 29 00 00    	cmp    %eax,0x2900
+     e81:	75 ed                	jne    e70 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+     e83:	83 ec 0c             	sub    $0xc,%esp
+     e86:	56                   	push   %esi
+     e87:	e8 c7 fa ff ff       	call   953 <sbrk>
+  if(p == (char*)-1)
+     e8c:	83 c4 10             	add    $0x10,%esp
+     e8f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     e92:	74 1c                	je     eb0 <malloc+0x80>
+  hp->s.size = nu;
+     e94:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+     e97:	83 ec 0c             	sub    $0xc,%esp
+     e9a:	83 c0 08             	add    $0x8,%eax
+     e9d:	50                   	push   %eax
+     e9e:	e8 fd fe ff ff       	call   da0 <free>
+  return freep;
+     ea3:	8b 15 00 29 00 00    	mov    0x2900,%edx
+      if((p = morecore(nunits)) == 0)
+     ea9:	83 c4 10             	add    $0x10,%esp
+     eac:	85 d2                	test   %edx,%edx
+     eae:	75 c0                	jne    e70 <malloc+0x40>
+        return 0;
+  }
+}
+     eb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     eb3:	31 c0                	xor    %eax,%eax
+}
+     eb5:	5b                   	pop    %ebx
+     eb6:	5e                   	pop    %esi
+     eb7:	5f                   	pop    %edi
+     eb8:	5d                   	pop    %ebp
+     eb9:	c3                   	ret
+     eba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     ec0:	39 cf                	cmp    %ecx,%edi
+     ec2:	74 4c                	je     f10 <malloc+0xe0>
+        p->s.size -= nunits;
+     ec4:	29 f9                	sub    %edi,%ecx
+     ec6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+     ec9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+     ecc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+     ecf:	89 15 00 29 00 00    	mov    %edx,0x2900
+}
+     ed5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+     ed8:	83 c0 08             	add    $0x8,%eax
+}
+     edb:	5b                   	pop    %ebx
+     edc:	5e                   	pop    %esi
+     edd:	5f                   	pop    %edi
+     ede:	5d                   	pop    %ebp
+     edf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+     ee0:	c7 05 00 29 00 00 04 	movl   $0x2904,0x2900
+     ee7:	29 00 00 
+    base.s.size = 0;
+     eea:	b8 04 29 00 00       	mov    $0x2904,%eax
+    base.s.ptr = freep = prevp = &base;
+     eef:	c7 05 04 29 00 00 04 	movl   $0x2904,0x2904
+     ef6:	29 00 00 
+    base.s.size = 0;
+     ef9:	c7 05 08 29 00 00 00 	movl   $0x0,0x2908
+     f00:	00 00 00 
+    if(p->s.size >= nunits){
+     f03:	e9 54 ff ff ff       	jmp    e5c <malloc+0x2c>
+     f08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f0f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+     f10:	8b 08                	mov    (%eax),%ecx
+     f12:	89 0a                	mov    %ecx,(%edx)
+     f14:	eb b9                	jmp    ecf <malloc+0x9f>
+     f16:	66 90                	xchg   %ax,%ax
+     f18:	66 90                	xchg   %ax,%ax
+     f1a:	66 90                	xchg   %ax,%ax
+     f1c:	66 90                	xchg   %ax,%ax
+     f1e:	66 90                	xchg   %ax,%ax
+
+00000f20 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+     f20:	55                   	push   %ebp
+     f21:	89 e5                	mov    %esp,%ebp
+     f23:	57                   	push   %edi
+     f24:	56                   	push   %esi
+     f25:	be 01 00 00 00       	mov    $0x1,%esi
+     f2a:	53                   	push   %ebx
+     f2b:	83 ec 28             	sub    $0x28,%esp
+     f2e:	8b 45 0c             	mov    0xc(%ebp),%eax
+     f31:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     f34:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+     f37:	68 00 98 00 00       	push   $0x9800
+     f3c:	e8 ef fe ff ff       	call   e30 <malloc>
+     f41:	83 c4 10             	add    $0x10,%esp
+     f44:	89 c7                	mov    %eax,%edi
+     f46:	85 c0                	test   %eax,%eax
+     f48:	74 62                	je     fac <waitpoll+0x8c>
+     f4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+     f50:	83 ec 0c             	sub    $0xc,%esp
+     f53:	6a 01                	push   $0x1
+     f55:	e8 03 fa ff ff       	call   95d <sleep>
+    fn();
+     f5a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     f5d:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+     f5f:	58                   	pop    %eax
+     f60:	5a                   	pop    %edx
+     f61:	68 00 02 00 00       	push   $0x200
+     f66:	57                   	push   %edi
+     f67:	e8 eb fa ff ff       	call   a57 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+     f6c:	83 c4 10             	add    $0x10,%esp
+     f6f:	85 c0                	test   %eax,%eax
+     f71:	7e 2d                	jle    fa0 <waitpoll+0x80>
+     f73:	6b c0 4c             	imul   $0x4c,%eax,%eax
+     f76:	89 fa                	mov    %edi,%edx
+    alive = 0;
+     f78:	31 c9                	xor    %ecx,%ecx
+     f7a:	01 f8                	add    %edi,%eax
+     f7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+     f80:	3b 1a                	cmp    (%edx),%ebx
+     f82:	75 07                	jne    f8b <waitpoll+0x6b>
+        alive = 1;
+     f84:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+     f88:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+     f8b:	83 c2 4c             	add    $0x4c,%edx
+     f8e:	39 d0                	cmp    %edx,%eax
+     f90:	75 ee                	jne    f80 <waitpoll+0x60>
+  } while(alive);
+     f92:	85 c9                	test   %ecx,%ecx
+     f94:	75 ba                	jne    f50 <waitpoll+0x30>
+     f96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f9d:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+     fa0:	83 ec 0c             	sub    $0xc,%esp
+     fa3:	57                   	push   %edi
+     fa4:	e8 f7 fd ff ff       	call   da0 <free>
+  wait();
+     fa9:	83 c4 10             	add    $0x10,%esp
+}
+     fac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     faf:	5b                   	pop    %ebx
+     fb0:	5e                   	pop    %esi
+     fb1:	5f                   	pop    %edi
+     fb2:	5d                   	pop    %ebp
+  wait();
+     fb3:	e9 10 f9 ff ff       	jmp    8c8 <wait>
+     fb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fbf:	90                   	nop
+
+00000fc0 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+     fc0:	55                   	push   %ebp
+     fc1:	89 e5                	mov    %esp,%ebp
+     fc3:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+     fc6:	c7 45 f0 f9 13 00 00 	movl   $0x13f9,-0x10(%ebp)
+     fcd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+     fd4:	e8 87 f4 ff ff       	call   460 <fork>
+     fd9:	85 c0                	test   %eax,%eax
+     fdb:	78 09                	js     fe6 <runps+0x26>
+    return -1;
+  if(pid == 0){
+     fdd:	74 0e                	je     fed <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+     fdf:	e8 e4 f8 ff ff       	call   8c8 <wait>
+}
+     fe4:	c9                   	leave
+     fe5:	c3                   	ret
+     fe6:	c9                   	leave
+    return -1;
+     fe7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     fec:	c3                   	ret
+    exec("ps", argv);
+     fed:	50                   	push   %eax
+     fee:	50                   	push   %eax
+     fef:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     ff2:	50                   	push   %eax
+     ff3:	68 f9 13 00 00       	push   $0x13f9
+     ff8:	e8 c3 f4 ff ff       	call   4c0 <exec>
+    printf(2, "exec ps failed\n");
+     ffd:	5a                   	pop    %edx
+     ffe:	59                   	pop    %ecx
+     fff:	68 fc 13 00 00       	push   $0x13fc
+    1004:	6a 02                	push   $0x2
+    1006:	e8 55 fb ff ff       	call   b60 <printf>
+    exit();
+    100b:	e8 a0 f4 ff ff       	call   4b0 <exit>
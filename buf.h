@@ -2,6 +2,7 @@ struct buf {
   int flags;
   uint dev;
   uint blockno;
+  uint ioblock;  // disk block to transfer; blockno except in bwritevat()
   struct sleeplock lock;
   uint refcnt;
   struct buf *prev; // LRU cache list
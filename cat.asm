@@ -0,0 +1,2052 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 26                	jg     4f <main+0x4f>
+  29:	eb 52                	jmp    7d <main+0x7d>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+  30:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 1; i < argc; i++){
+  33:	83 c6 01             	add    $0x1,%esi
+  36:	83 c3 04             	add    $0x4,%ebx
+    cat(fd);
+  39:	50                   	push   %eax
+  3a:	e8 51 00 00 00       	call   90 <cat>
+    close(fd);
+  3f:	89 3c 24             	mov    %edi,(%esp)
+  42:	e8 c9 03 00 00       	call   410 <close>
+  for(i = 1; i < argc; i++){
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4d:	74 29                	je     78 <main+0x78>
+    if((fd = open(argv[i], 0)) < 0){
+  4f:	83 ec 08             	sub    $0x8,%esp
+  52:	6a 00                	push   $0x0
+  54:	ff 33                	push   (%ebx)
+  56:	e8 8e 07 00 00       	call   7e9 <open>
+  5b:	83 c4 10             	add    $0x10,%esp
+  5e:	89 c7                	mov    %eax,%edi
+  60:	85 c0                	test   %eax,%eax
+  62:	79 cc                	jns    30 <main+0x30>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  64:	50                   	push   %eax
+  65:	ff 33                	push   (%ebx)
+  67:	68 23 0f 00 00       	push   $0xf23
+  6c:	6a 01                	push   $0x1
+  6e:	e8 dd 09 00 00       	call   a50 <printf>
+      exit();
+  73:	e8 28 03 00 00       	call   3a0 <exit>
+  }
+  exit();
+  78:	e8 23 03 00 00       	call   3a0 <exit>
+    cat(0);
+  7d:	83 ec 0c             	sub    $0xc,%esp
+  80:	6a 00                	push   $0x0
+  82:	e8 09 00 00 00       	call   90 <cat>
+    exit();
+  87:	e8 14 03 00 00       	call   3a0 <exit>
+  8c:	66 90                	xchg   %ax,%ax
+  8e:	66 90                	xchg   %ax,%ax
+
+00000090 <cat>:
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	56                   	push   %esi
+  94:	53                   	push   %ebx
+  95:	8b 75 08             	mov    0x8(%ebp),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  98:	eb 1d                	jmp    b7 <cat+0x27>
+  9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if (write(1, buf, n) != n) {
+  a0:	83 ec 04             	sub    $0x4,%esp
+  a3:	53                   	push   %ebx
+  a4:	68 60 14 00 00       	push   $0x1460
+  a9:	6a 01                	push   $0x1
+  ab:	e8 1d 07 00 00       	call   7cd <write>
+  b0:	83 c4 10             	add    $0x10,%esp
+  b3:	39 d8                	cmp    %ebx,%eax
+  b5:	75 25                	jne    dc <cat+0x4c>
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  b7:	83 ec 04             	sub    $0x4,%esp
+  ba:	68 00 02 00 00       	push   $0x200
+  bf:	68 60 14 00 00       	push   $0x1460
+  c4:	56                   	push   %esi
+  c5:	e8 fc 06 00 00       	call   7c6 <read>
+  ca:	83 c4 10             	add    $0x10,%esp
+  cd:	89 c3                	mov    %eax,%ebx
+  cf:	85 c0                	test   %eax,%eax
+  d1:	7f cd                	jg     a0 <cat+0x10>
+  if(n < 0){
+  d3:	75 1b                	jne    f0 <cat+0x60>
+}
+  d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  d8:	5b                   	pop    %ebx
+  d9:	5e                   	pop    %esi
+  da:	5d                   	pop    %ebp
+  db:	c3                   	ret
+      printf(1, "cat: write error\n");
+  dc:	83 ec 08             	sub    $0x8,%esp
+  df:	68 00 0f 00 00       	push   $0xf00
+  e4:	6a 01                	push   $0x1
+  e6:	e8 65 09 00 00       	call   a50 <printf>
+      exit();
+  eb:	e8 b0 02 00 00       	call   3a0 <exit>
+    printf(1, "cat: read error\n");
+  f0:	50                   	push   %eax
+  f1:	50                   	push   %eax
+  f2:	68 12 0f 00 00       	push   $0xf12
+  f7:	6a 01                	push   $0x1
+  f9:	e8 52 09 00 00       	call   a50 <printf>
+    exit();
+  fe:	e8 9d 02 00 00       	call   3a0 <exit>
+ 103:	66 90                	xchg   %ax,%ax
+ 105:	66 90                	xchg   %ax,%ax
+ 107:	66 90                	xchg   %ax,%ax
+ 109:	66 90                	xchg   %ax,%ax
+ 10b:	66 90                	xchg   %ax,%ax
+ 10d:	66 90                	xchg   %ax,%ax
+ 10f:	90                   	nop
+
+00000110 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	57                   	push   %edi
+ 114:	56                   	push   %esi
+ 115:	53                   	push   %ebx
+ 116:	83 ec 4c             	sub    $0x4c,%esp
+ 119:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 11c:	8b 55 08             	mov    0x8(%ebp),%edx
+ 11f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 122:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+ 125:	83 fa 0f             	cmp    $0xf,%edx
+ 128:	0f 87 32 01 00 00    	ja     260 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+ 12e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 134:	8b 80 60 16 00 00    	mov    0x1660(%eax),%eax
+ 13a:	85 c0                	test   %eax,%eax
+ 13c:	0f 84 de 00 00 00    	je     220 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+ 142:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 148:	8b b0 64 16 00 00    	mov    0x1664(%eax),%esi
+ 14e:	8d 88 60 16 00 00    	lea    0x1660(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+ 154:	8d b8 68 16 00 00    	lea    0x1668(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+ 15a:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+ 15d:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+ 160:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+ 163:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+ 169:	0f 8f 01 01 00 00    	jg     270 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+ 16f:	8d 78 08             	lea    0x8(%eax),%edi
+ 172:	8d bc 3e 60 16 00 00 	lea    0x1660(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 179:	85 db                	test   %ebx,%ebx
+ 17b:	7e 3b                	jle    1b8 <bufwrite+0xa8>
+ 17d:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+ 180:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+ 183:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 187:	90                   	nop
+    *dst++ = *src++;
+ 188:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 189:	39 c6                	cmp    %eax,%esi
+ 18b:	75 fb                	jne    188 <bufwrite+0x78>
+  ob[fd].n += n;
+ 18d:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 193:	8b 88 64 16 00 00    	mov    0x1664(%eax),%ecx
+ 199:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 19b:	83 b8 60 16 00 00 01 	cmpl   $0x1,0x1660(%eax)
+  ob[fd].n += n;
+ 1a2:	89 88 64 16 00 00    	mov    %ecx,0x1664(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 1a8:	74 26                	je     1d0 <bufwrite+0xc0>
+}
+ 1aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1ad:	5b                   	pop    %ebx
+ 1ae:	5e                   	pop    %esi
+ 1af:	5f                   	pop    %edi
+ 1b0:	5d                   	pop    %ebp
+ 1b1:	c3                   	ret
+ 1b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+ 1b8:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 1bb:	83 b8 60 16 00 00 01 	cmpl   $0x1,0x1660(%eax)
+  ob[fd].n += n;
+ 1c2:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 1c5:	75 e3                	jne    1aa <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+ 1c7:	85 db                	test   %ebx,%ebx
+ 1c9:	74 df                	je     1aa <bufwrite+0x9a>
+ 1cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1cf:	90                   	nop
+  src = vsrc;
+ 1d0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 1d3:	01 c3                	add    %eax,%ebx
+ 1d5:	eb 10                	jmp    1e7 <bufwrite+0xd7>
+ 1d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1de:	66 90                	xchg   %ax,%ax
+ 1e0:	83 c0 01             	add    $0x1,%eax
+ 1e3:	39 d8                	cmp    %ebx,%eax
+ 1e5:	74 c3                	je     1aa <bufwrite+0x9a>
+    if(*p == (char)c)
+ 1e7:	80 38 0a             	cmpb   $0xa,(%eax)
+ 1ea:	75 f4                	jne    1e0 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 1ec:	85 c9                	test   %ecx,%ecx
+ 1ee:	7e ba                	jle    1aa <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 1f0:	83 ec 04             	sub    $0x4,%esp
+ 1f3:	51                   	push   %ecx
+ 1f4:	ff 75 ac             	push   -0x54(%ebp)
+ 1f7:	52                   	push   %edx
+ 1f8:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+ 1fb:	e8 cd 05 00 00       	call   7cd <write>
+    ob[fd].n = 0;
+ 200:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+ 203:	83 c4 10             	add    $0x10,%esp
+ 206:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+ 20c:	c7 82 64 16 00 00 00 	movl   $0x0,0x1664(%edx)
+ 213:	00 00 00 
+ 216:	eb 92                	jmp    1aa <bufwrite+0x9a>
+ 218:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21f:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 220:	83 ec 08             	sub    $0x8,%esp
+ 223:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 226:	50                   	push   %eax
+ 227:	52                   	push   %edx
+ 228:	89 55 b0             	mov    %edx,-0x50(%ebp)
+ 22b:	e8 d7 05 00 00       	call   807 <fstat>
+ 230:	83 c4 10             	add    $0x10,%esp
+ 233:	8b 55 b0             	mov    -0x50(%ebp),%edx
+ 236:	89 c1                	mov    %eax,%ecx
+ 238:	b8 02 00 00 00       	mov    $0x2,%eax
+ 23d:	85 c9                	test   %ecx,%ecx
+ 23f:	75 0d                	jne    24e <bufwrite+0x13e>
+ 241:	31 c0                	xor    %eax,%eax
+ 243:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 248:	0f 95 c0             	setne  %al
+ 24b:	83 c0 01             	add    $0x1,%eax
+ 24e:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+ 254:	89 81 60 16 00 00    	mov    %eax,0x1660(%ecx)
+ 25a:	e9 e3 fe ff ff       	jmp    142 <bufwrite+0x32>
+ 25f:	90                   	nop
+}
+ 260:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 263:	5b                   	pop    %ebx
+ 264:	5e                   	pop    %esi
+ 265:	5f                   	pop    %edi
+ 266:	5d                   	pop    %ebp
+    write(fd, p, n);
+ 267:	e9 61 05 00 00       	jmp    7cd <write>
+ 26c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+ 270:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+ 273:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+ 276:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+ 279:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+ 27c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+ 27f:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+ 282:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+ 285:	6a 02                	push   $0x2
+ 287:	50                   	push   %eax
+ 288:	52                   	push   %edx
+ 289:	e8 9b 06 00 00       	call   929 <writev>
+    ob[fd].n = 0;
+ 28e:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+ 291:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+ 294:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ 29b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 29e:	5b                   	pop    %ebx
+ 29f:	5e                   	pop    %esi
+ 2a0:	5f                   	pop    %edi
+ 2a1:	5d                   	pop    %ebp
+ 2a2:	c3                   	ret
+ 2a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000002b0 <fflush>:
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	53                   	push   %ebx
+ 2b4:	83 ec 04             	sub    $0x4,%esp
+ 2b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 2ba:	83 f8 0f             	cmp    $0xf,%eax
+ 2bd:	77 16                	ja     2d5 <fflush+0x25>
+ 2bf:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+ 2c5:	8b 8a 64 16 00 00    	mov    0x1664(%edx),%ecx
+ 2cb:	8d 9a 60 16 00 00    	lea    0x1660(%edx),%ebx
+ 2d1:	85 c9                	test   %ecx,%ecx
+ 2d3:	7f 0b                	jg     2e0 <fflush+0x30>
+}
+ 2d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2d8:	c9                   	leave
+ 2d9:	c3                   	ret
+ 2da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 2e0:	83 ec 04             	sub    $0x4,%esp
+ 2e3:	81 c2 68 16 00 00    	add    $0x1668,%edx
+ 2e9:	51                   	push   %ecx
+ 2ea:	52                   	push   %edx
+ 2eb:	50                   	push   %eax
+ 2ec:	e8 dc 04 00 00       	call   7cd <write>
+    ob[fd].n = 0;
+ 2f1:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+ 2f8:	83 c4 10             	add    $0x10,%esp
+}
+ 2fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2fe:	c9                   	leave
+ 2ff:	c3                   	ret
+
+00000300 <fflushall>:
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 304:	31 f6                	xor    %esi,%esi
+{
+ 306:	53                   	push   %ebx
+ 307:	bb 68 16 00 00       	mov    $0x1668,%ebx
+ 30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 310:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 313:	85 c0                	test   %eax,%eax
+ 315:	7e 15                	jle    32c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 317:	83 ec 04             	sub    $0x4,%esp
+ 31a:	50                   	push   %eax
+ 31b:	53                   	push   %ebx
+ 31c:	56                   	push   %esi
+ 31d:	e8 ab 04 00 00       	call   7cd <write>
+    ob[fd].n = 0;
+ 322:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 329:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 32c:	83 c6 01             	add    $0x1,%esi
+ 32f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 335:	83 fe 10             	cmp    $0x10,%esi
+ 338:	75 d6                	jne    310 <fflushall+0x10>
+}
+ 33a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 33d:	5b                   	pop    %ebx
+ 33e:	5e                   	pop    %esi
+ 33f:	5d                   	pop    %ebp
+ 340:	c3                   	ret
+ 341:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 348:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34f:	90                   	nop
+
+00000350 <fork>:
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 354:	31 f6                	xor    %esi,%esi
+{
+ 356:	53                   	push   %ebx
+ 357:	bb 68 16 00 00       	mov    $0x1668,%ebx
+ 35c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 360:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 363:	85 c0                	test   %eax,%eax
+ 365:	7e 15                	jle    37c <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 367:	83 ec 04             	sub    $0x4,%esp
+ 36a:	50                   	push   %eax
+ 36b:	53                   	push   %ebx
+ 36c:	56                   	push   %esi
+ 36d:	e8 5b 04 00 00       	call   7cd <write>
+    ob[fd].n = 0;
+ 372:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 379:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 37c:	83 c6 01             	add    $0x1,%esi
+ 37f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 385:	83 fe 10             	cmp    $0x10,%esi
+ 388:	75 d6                	jne    360 <fork+0x10>
+}
+ 38a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 38d:	5b                   	pop    %ebx
+ 38e:	5e                   	pop    %esi
+ 38f:	5d                   	pop    %ebp
+  return _fork();
+ 390:	e9 15 04 00 00       	jmp    7aa <_fork>
+ 395:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <exit>:
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+ 3a6:	e8 55 ff ff ff       	call   300 <fflushall>
+  _exit();
+ 3ab:	e8 01 04 00 00       	call   7b1 <_exit>
+
+000003b0 <exec>:
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	57                   	push   %edi
+ 3b4:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 3b5:	31 f6                	xor    %esi,%esi
+{
+ 3b7:	53                   	push   %ebx
+ 3b8:	bb 68 16 00 00       	mov    $0x1668,%ebx
+ 3bd:	83 ec 1c             	sub    $0x1c,%esp
+ 3c0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 3c6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 3c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 3d0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 3d3:	85 c0                	test   %eax,%eax
+ 3d5:	7e 15                	jle    3ec <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 3d7:	83 ec 04             	sub    $0x4,%esp
+ 3da:	50                   	push   %eax
+ 3db:	53                   	push   %ebx
+ 3dc:	56                   	push   %esi
+ 3dd:	e8 eb 03 00 00       	call   7cd <write>
+    ob[fd].n = 0;
+ 3e2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 3e9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 3ec:	83 c6 01             	add    $0x1,%esi
+ 3ef:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 3f5:	83 fe 10             	cmp    $0x10,%esi
+ 3f8:	75 d6                	jne    3d0 <exec+0x20>
+  return _exec(path, argv);
+ 3fa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 3fd:	89 7d 0c             	mov    %edi,0xc(%ebp)
+ 400:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ 403:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 406:	5b                   	pop    %ebx
+ 407:	5e                   	pop    %esi
+ 408:	5f                   	pop    %edi
+ 409:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 40a:	e9 d3 03 00 00       	jmp    7e2 <_exec>
+ 40f:	90                   	nop
+
+00000410 <close>:
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	56                   	push   %esi
+ 414:	53                   	push   %ebx
+ 415:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 418:	83 fb 0f             	cmp    $0xf,%ebx
+ 41b:	77 26                	ja     443 <close+0x33>
+ 41d:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 423:	8b 90 64 16 00 00    	mov    0x1664(%eax),%edx
+ 429:	8d b0 60 16 00 00    	lea    0x1660(%eax),%esi
+ 42f:	85 d2                	test   %edx,%edx
+ 431:	7f 25                	jg     458 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+ 433:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 439:	c7 80 60 16 00 00 00 	movl   $0x0,0x1660(%eax)
+ 440:	00 00 00 
+  return _close(fd);
+ 443:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 446:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 449:	5b                   	pop    %ebx
+ 44a:	5e                   	pop    %esi
+ 44b:	5d                   	pop    %ebp
+  return _close(fd);
+ 44c:	e9 83 03 00 00       	jmp    7d4 <_close>
+ 451:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 458:	83 ec 04             	sub    $0x4,%esp
+ 45b:	05 68 16 00 00       	add    $0x1668,%eax
+ 460:	52                   	push   %edx
+ 461:	50                   	push   %eax
+ 462:	53                   	push   %ebx
+ 463:	e8 65 03 00 00       	call   7cd <write>
+    ob[fd].n = 0;
+ 468:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+ 46f:	83 c4 10             	add    $0x10,%esp
+ 472:	eb bf                	jmp    433 <close+0x23>
+ 474:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 47f:	90                   	nop
+
+00000480 <strcpy>:
+{
+ 480:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+ 481:	31 c0                	xor    %eax,%eax
+{
+ 483:	89 e5                	mov    %esp,%ebp
+ 485:	53                   	push   %ebx
+ 486:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 489:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 48c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 490:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 494:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 497:	83 c0 01             	add    $0x1,%eax
+ 49a:	84 d2                	test   %dl,%dl
+ 49c:	75 f2                	jne    490 <strcpy+0x10>
+}
+ 49e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4a1:	89 c8                	mov    %ecx,%eax
+ 4a3:	c9                   	leave
+ 4a4:	c3                   	ret
+ 4a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004b0 <strcmp>:
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	53                   	push   %ebx
+ 4b4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 4ba:	0f b6 02             	movzbl (%edx),%eax
+ 4bd:	84 c0                	test   %al,%al
+ 4bf:	75 17                	jne    4d8 <strcmp+0x28>
+ 4c1:	eb 3a                	jmp    4fd <strcmp+0x4d>
+ 4c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4c7:	90                   	nop
+ 4c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 4cc:	83 c2 01             	add    $0x1,%edx
+ 4cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 4d2:	84 c0                	test   %al,%al
+ 4d4:	74 1a                	je     4f0 <strcmp+0x40>
+    p++, q++;
+ 4d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 4d8:	0f b6 19             	movzbl (%ecx),%ebx
+ 4db:	38 c3                	cmp    %al,%bl
+ 4dd:	74 e9                	je     4c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 4df:	29 d8                	sub    %ebx,%eax
+}
+ 4e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4e4:	c9                   	leave
+ 4e5:	c3                   	ret
+ 4e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 4f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 4f4:	31 c0                	xor    %eax,%eax
+ 4f6:	29 d8                	sub    %ebx,%eax
+}
+ 4f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4fb:	c9                   	leave
+ 4fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 4fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 500:	31 c0                	xor    %eax,%eax
+ 502:	eb db                	jmp    4df <strcmp+0x2f>
+ 504:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 50f:	90                   	nop
+
+00000510 <strlen>:
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+ 516:	80 3a 00             	cmpb   $0x0,(%edx)
+ 519:	74 15                	je     530 <strlen+0x20>
+ 51b:	31 c0                	xor    %eax,%eax
+ 51d:	8d 76 00             	lea    0x0(%esi),%esi
+ 520:	83 c0 01             	add    $0x1,%eax
+ 523:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 527:	89 c1                	mov    %eax,%ecx
+ 529:	75 f5                	jne    520 <strlen+0x10>
+}
+ 52b:	89 c8                	mov    %ecx,%eax
+ 52d:	5d                   	pop    %ebp
+ 52e:	c3                   	ret
+ 52f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 530:	31 c9                	xor    %ecx,%ecx
+}
+ 532:	5d                   	pop    %ebp
+ 533:	89 c8                	mov    %ecx,%eax
+ 535:	c3                   	ret
+ 536:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000540 <memset>:
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	57                   	push   %edi
+ 544:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 547:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 54a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 54d:	89 d7                	mov    %edx,%edi
+ 54f:	fc                   	cld
+ 550:	f3 aa                	rep stos %al,%es:(%edi)
+}
+ 552:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 555:	89 d0                	mov    %edx,%eax
+ 557:	c9                   	leave
+ 558:	c3                   	ret
+ 559:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000560 <strchr>:
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	8b 45 08             	mov    0x8(%ebp),%eax
+ 566:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 56a:	0f b6 10             	movzbl (%eax),%edx
+ 56d:	84 d2                	test   %dl,%dl
+ 56f:	75 12                	jne    583 <strchr+0x23>
+ 571:	eb 1d                	jmp    590 <strchr+0x30>
+ 573:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 577:	90                   	nop
+ 578:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 57c:	83 c0 01             	add    $0x1,%eax
+ 57f:	84 d2                	test   %dl,%dl
+ 581:	74 0d                	je     590 <strchr+0x30>
+    if(*s == c)
+ 583:	38 d1                	cmp    %dl,%cl
+ 585:	75 f1                	jne    578 <strchr+0x18>
+}
+ 587:	5d                   	pop    %ebp
+ 588:	c3                   	ret
+ 589:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 590:	31 c0                	xor    %eax,%eax
+}
+ 592:	5d                   	pop    %ebp
+ 593:	c3                   	ret
+ 594:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 59f:	90                   	nop
+
+000005a0 <memchr>:
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+ 5a3:	8b 55 10             	mov    0x10(%ebp),%edx
+ 5a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 5a9:	85 d2                	test   %edx,%edx
+ 5ab:	74 1b                	je     5c8 <memchr+0x28>
+    if(*p == (char)c)
+ 5ad:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+ 5b1:	01 c2                	add    %eax,%edx
+ 5b3:	eb 0a                	jmp    5bf <memchr+0x1f>
+ 5b5:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+ 5b8:	83 c0 01             	add    $0x1,%eax
+ 5bb:	39 c2                	cmp    %eax,%edx
+ 5bd:	74 09                	je     5c8 <memchr+0x28>
+    if(*p == (char)c)
+ 5bf:	38 08                	cmp    %cl,(%eax)
+ 5c1:	75 f5                	jne    5b8 <memchr+0x18>
+}
+ 5c3:	5d                   	pop    %ebp
+ 5c4:	c3                   	ret
+ 5c5:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+ 5c8:	31 c0                	xor    %eax,%eax
+}
+ 5ca:	5d                   	pop    %ebp
+ 5cb:	c3                   	ret
+ 5cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005d0 <gets>:
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+ 5d4:	31 ff                	xor    %edi,%edi
+{
+ 5d6:	56                   	push   %esi
+ 5d7:	be 68 16 00 00       	mov    $0x1668,%esi
+ 5dc:	53                   	push   %ebx
+ 5dd:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 5e0:	8b 46 fc             	mov    -0x4(%esi),%eax
+ 5e3:	85 c0                	test   %eax,%eax
+ 5e5:	7e 15                	jle    5fc <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 5e7:	83 ec 04             	sub    $0x4,%esp
+ 5ea:	50                   	push   %eax
+ 5eb:	56                   	push   %esi
+ 5ec:	57                   	push   %edi
+ 5ed:	e8 db 01 00 00       	call   7cd <write>
+    ob[fd].n = 0;
+ 5f2:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+ 5f9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 5fc:	83 c7 01             	add    $0x1,%edi
+ 5ff:	81 c6 08 01 00 00    	add    $0x108,%esi
+ 605:	83 ff 10             	cmp    $0x10,%edi
+ 608:	75 d6                	jne    5e0 <gets+0x10>
+  for(i=0; i+1 < max; ){
+ 60a:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+ 60c:	8d 75 e7             	lea    -0x19(%ebp),%esi
+ 60f:	eb 2e                	jmp    63f <gets+0x6f>
+ 611:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 618:	83 ec 04             	sub    $0x4,%esp
+ 61b:	6a 01                	push   $0x1
+ 61d:	56                   	push   %esi
+ 61e:	6a 00                	push   $0x0
+ 620:	e8 a1 01 00 00       	call   7c6 <read>
+    if(cc < 1)
+ 625:	83 c4 10             	add    $0x10,%esp
+ 628:	85 c0                	test   %eax,%eax
+ 62a:	7e 1d                	jle    649 <gets+0x79>
+    buf[i++] = c;
+ 62c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 630:	8b 55 08             	mov    0x8(%ebp),%edx
+ 633:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 637:	3c 0a                	cmp    $0xa,%al
+ 639:	74 10                	je     64b <gets+0x7b>
+ 63b:	3c 0d                	cmp    $0xd,%al
+ 63d:	74 0c                	je     64b <gets+0x7b>
+  for(i=0; i+1 < max; ){
+ 63f:	89 df                	mov    %ebx,%edi
+ 641:	83 c3 01             	add    $0x1,%ebx
+ 644:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 647:	7c cf                	jl     618 <gets+0x48>
+ 649:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 64b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 64e:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 652:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 655:	5b                   	pop    %ebx
+ 656:	5e                   	pop    %esi
+ 657:	5f                   	pop    %edi
+ 658:	5d                   	pop    %ebp
+ 659:	c3                   	ret
+ 65a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000660 <stat>:
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	57                   	push   %edi
+ 664:	56                   	push   %esi
+ 665:	53                   	push   %ebx
+ 666:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+ 669:	6a 00                	push   $0x0
+ 66b:	ff 75 08             	push   0x8(%ebp)
+ 66e:	e8 76 01 00 00       	call   7e9 <open>
+  if(fd < 0)
+ 673:	83 c4 10             	add    $0x10,%esp
+ 676:	85 c0                	test   %eax,%eax
+ 678:	78 76                	js     6f0 <stat+0x90>
+  r = fstat(fd, st);
+ 67a:	83 ec 08             	sub    $0x8,%esp
+ 67d:	ff 75 0c             	push   0xc(%ebp)
+ 680:	89 c3                	mov    %eax,%ebx
+ 682:	50                   	push   %eax
+ 683:	e8 7f 01 00 00       	call   807 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 688:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 68b:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 68d:	83 fb 0f             	cmp    $0xf,%ebx
+ 690:	7f 40                	jg     6d2 <stat+0x72>
+ 692:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 698:	8b 90 64 16 00 00    	mov    0x1664(%eax),%edx
+ 69e:	8d b8 60 16 00 00    	lea    0x1660(%eax),%edi
+ 6a4:	85 d2                	test   %edx,%edx
+ 6a6:	7e 1a                	jle    6c2 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 6a8:	83 ec 04             	sub    $0x4,%esp
+ 6ab:	05 68 16 00 00       	add    $0x1668,%eax
+ 6b0:	52                   	push   %edx
+ 6b1:	50                   	push   %eax
+ 6b2:	53                   	push   %ebx
+ 6b3:	e8 15 01 00 00       	call   7cd <write>
+    ob[fd].n = 0;
+ 6b8:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+ 6bf:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+ 6c2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 6c8:	c7 80 60 16 00 00 00 	movl   $0x0,0x1660(%eax)
+ 6cf:	00 00 00 
+  return _close(fd);
+ 6d2:	83 ec 0c             	sub    $0xc,%esp
+ 6d5:	53                   	push   %ebx
+ 6d6:	e8 f9 00 00 00       	call   7d4 <_close>
+ 6db:	83 c4 10             	add    $0x10,%esp
+}
+ 6de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6e1:	89 f0                	mov    %esi,%eax
+ 6e3:	5b                   	pop    %ebx
+ 6e4:	5e                   	pop    %esi
+ 6e5:	5f                   	pop    %edi
+ 6e6:	5d                   	pop    %ebp
+ 6e7:	c3                   	ret
+ 6e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ef:	90                   	nop
+    return -1;
+ 6f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 6f5:	eb e7                	jmp    6de <stat+0x7e>
+ 6f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6fe:	66 90                	xchg   %ax,%ax
+
+00000700 <atoi>:
+{
+ 700:	55                   	push   %ebp
+ 701:	89 e5                	mov    %esp,%ebp
+ 703:	53                   	push   %ebx
+ 704:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 707:	0f be 02             	movsbl (%edx),%eax
+ 70a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 70d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 710:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 715:	77 1e                	ja     735 <atoi+0x35>
+ 717:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 71e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 720:	83 c2 01             	add    $0x1,%edx
+ 723:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 726:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 72a:	0f be 02             	movsbl (%edx),%eax
+ 72d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 730:	80 fb 09             	cmp    $0x9,%bl
+ 733:	76 eb                	jbe    720 <atoi+0x20>
+}
+ 735:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 738:	89 c8                	mov    %ecx,%eax
+ 73a:	c9                   	leave
+ 73b:	c3                   	ret
+ 73c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000740 <memmove>:
+{
+ 740:	55                   	push   %ebp
+ 741:	89 e5                	mov    %esp,%ebp
+ 743:	57                   	push   %edi
+ 744:	56                   	push   %esi
+ 745:	8b 45 10             	mov    0x10(%ebp),%eax
+ 748:	8b 55 08             	mov    0x8(%ebp),%edx
+ 74b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 74e:	85 c0                	test   %eax,%eax
+ 750:	7e 13                	jle    765 <memmove+0x25>
+ 752:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 754:	89 d7                	mov    %edx,%edi
+ 756:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 75d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 760:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 761:	39 f8                	cmp    %edi,%eax
+ 763:	75 fb                	jne    760 <memmove+0x20>
+  return vdst;
+}
+ 765:	5e                   	pop    %esi
+ 766:	89 d0                	mov    %edx,%eax
+ 768:	5f                   	pop    %edi
+ 769:	5d                   	pop    %ebp
+ 76a:	c3                   	ret
+
+0000076b <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+ 76b:	83 3d 58 14 00 00 00 	cmpl   $0x0,0x1458
+  jle 1f
+ 772:	7e 0a                	jle    77e <syscallentry+0x13>
+  movl %esp, %ecx
+ 774:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 776:	ba 7d 07 00 00       	mov    $0x77d,%edx
+  sysenter
+ 77b:	0f 34                	sysenter
+2:
+  ret
+ 77d:	c3                   	ret
+1:
+  jl 3f
+ 77e:	7c 27                	jl     7a7 <syscallentry+0x3c>
+  pushal
+ 780:	60                   	pusha
+  movl $1, %eax
+ 781:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 786:	0f a2                	cpuid
+  movl $-1, sysentermode
+ 788:	c7 05 58 14 00 00 ff 	movl   $0xffffffff,0x1458
+ 78f:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 792:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+ 798:	74 0a                	je     7a4 <syscallentry+0x39>
+  movl $1, sysentermode
+ 79a:	c7 05 58 14 00 00 01 	movl   $0x1,0x1458
+ 7a1:	00 00 00 
+4:
+  popal
+ 7a4:	61                   	popa
+  jmp syscallentry
+ 7a5:	eb c4                	jmp    76b <syscallentry>
+3:
+  int $T_SYSCALL
+ 7a7:	cd 40                	int    $0x40
+  ret
+ 7a9:	c3                   	ret
+
+000007aa <_fork>:
+
+SYSCALLAS(_fork, fork)
+ 7aa:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7af:	eb ba                	jmp    76b <syscallentry>
+
+000007b1 <_exit>:
+SYSCALLAS(_exit, exit)
+ 7b1:	b8 02 00 00 00       	mov    $0x2,%eax
+ 7b6:	eb b3                	jmp    76b <syscallentry>
+
+000007b8 <wait>:
+SYSCALL(wait)
+ 7b8:	b8 03 00 00 00       	mov    $0x3,%eax
+ 7bd:	eb ac                	jmp    76b <syscallentry>
+
+000007bf <pipe>:
+SYSCALL(pipe)
+ 7bf:	b8 04 00 00 00       	mov    $0x4,%eax
+ 7c4:	eb a5                	jmp    76b <syscallentry>
+
+000007c6 <read>:
+SYSCALL(read)
+ 7c6:	b8 05 00 00 00       	mov    $0x5,%eax
+ 7cb:	eb 9e                	jmp    76b <syscallentry>
+
+000007cd <write>:
+SYSCALL(write)
+ 7cd:	b8 10 00 00 00       	mov    $0x10,%eax
+ 7d2:	eb 97                	jmp    76b <syscallentry>
+
+000007d4 <_close>:
+SYSCALLAS(_close, close)
+ 7d4:	b8 15 00 00 00       	mov    $0x15,%eax
+ 7d9:	eb 90                	jmp    76b <syscallentry>
+
+000007db <kill>:
+SYSCALL(kill)
+ 7db:	b8 06 00 00 00       	mov    $0x6,%eax
+ 7e0:	eb 89                	jmp    76b <syscallentry>
+
+000007e2 <_exec>:
+SYSCALLAS(_exec, exec)
+ 7e2:	b8 07 00 00 00       	mov    $0x7,%eax
+ 7e7:	eb 82                	jmp    76b <syscallentry>
+
+000007e9 <open>:
+SYSCALL(open)
+ 7e9:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 7ee:	e9 78 ff ff ff       	jmp    76b <syscallentry>
+
+000007f3 <mknod>:
+SYSCALL(mknod)
+ 7f3:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7f8:	e9 6e ff ff ff       	jmp    76b <syscallentry>
+
+000007fd <unlink>:
+SYSCALL(unlink)
+ 7fd:	b8 12 00 00 00       	mov    $0x12,%eax
+ 802:	e9 64 ff ff ff       	jmp    76b <syscallentry>
+
+00000807 <fstat>:
+SYSCALL(fstat)
+ 807:	b8 08 00 00 00       	mov    $0x8,%eax
+ 80c:	e9 5a ff ff ff       	jmp    76b <syscallentry>
+
+00000811 <link>:
+SYSCALL(link)
+ 811:	b8 13 00 00 00       	mov    $0x13,%eax
+ 816:	e9 50 ff ff ff       	jmp    76b <syscallentry>
+
+0000081b <mkdir>:
+SYSCALL(mkdir)
+ 81b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 820:	e9 46 ff ff ff       	jmp    76b <syscallentry>
+
+00000825 <chdir>:
+SYSCALL(chdir)
+ 825:	b8 09 00 00 00       	mov    $0x9,%eax
+ 82a:	e9 3c ff ff ff       	jmp    76b <syscallentry>
+
+0000082f <dup>:
+SYSCALL(dup)
+ 82f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 834:	e9 32 ff ff ff       	jmp    76b <syscallentry>
+
+00000839 <getpid>:
+SYSCALL(getpid)
+ 839:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 83e:	e9 28 ff ff ff       	jmp    76b <syscallentry>
+
+00000843 <sbrk>:
+SYSCALL(sbrk)
+ 843:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 848:	e9 1e ff ff ff       	jmp    76b <syscallentry>
+
+0000084d <sleep>:
+SYSCALL(sleep)
+ 84d:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 852:	e9 14 ff ff ff       	jmp    76b <syscallentry>
+
+00000857 <uptime>:
+SYSCALL(uptime)
+ 857:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 85c:	e9 0a ff ff ff       	jmp    76b <syscallentry>
+
+00000861 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+ 861:	b8 16 00 00 00       	mov    $0x16,%eax
+ 866:	e9 00 ff ff ff       	jmp    76b <syscallentry>
+
+0000086b <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+ 86b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 870:	e9 f6 fe ff ff       	jmp    76b <syscallentry>
+
+00000875 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+ 875:	b8 18 00 00 00       	mov    $0x18,%eax
+ 87a:	e9 ec fe ff ff       	jmp    76b <syscallentry>
+
+0000087f <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+ 87f:	b8 19 00 00 00       	mov    $0x19,%eax
+ 884:	e9 e2 fe ff ff       	jmp    76b <syscallentry>
+
+00000889 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+ 889:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 88e:	e9 d8 fe ff ff       	jmp    76b <syscallentry>
+
+00000893 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+ 893:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 898:	e9 ce fe ff ff       	jmp    76b <syscallentry>
+
+0000089d <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+ 89d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 8a2:	e9 c4 fe ff ff       	jmp    76b <syscallentry>
+
+000008a7 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+ 8a7:	b8 20 00 00 00       	mov    $0x20,%eax
+ 8ac:	e9 ba fe ff ff       	jmp    76b <syscallentry>
+
+000008b1 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+ 8b1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 8b6:	e9 b0 fe ff ff       	jmp    76b <syscallentry>
+
+000008bb <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+ 8bb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 8c0:	e9 a6 fe ff ff       	jmp    76b <syscallentry>
+
+000008c5 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+ 8c5:	b8 21 00 00 00       	mov    $0x21,%eax
+ 8ca:	e9 9c fe ff ff       	jmp    76b <syscallentry>
+
+000008cf <yield>:
+SYSCALL(yield) // yield the CPU to another process
+ 8cf:	b8 22 00 00 00       	mov    $0x22,%eax
+ 8d4:	e9 92 fe ff ff       	jmp    76b <syscallentry>
+
+000008d9 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+ 8d9:	b8 23 00 00 00       	mov    $0x23,%eax
+ 8de:	e9 88 fe ff ff       	jmp    76b <syscallentry>
+
+000008e3 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+ 8e3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 8e8:	e9 7e fe ff ff       	jmp    76b <syscallentry>
+
+000008ed <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+ 8ed:	b8 25 00 00 00       	mov    $0x25,%eax
+ 8f2:	e9 74 fe ff ff       	jmp    76b <syscallentry>
+
+000008f7 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+ 8f7:	b8 26 00 00 00       	mov    $0x26,%eax
+ 8fc:	e9 6a fe ff ff       	jmp    76b <syscallentry>
+
+00000901 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+ 901:	b8 27 00 00 00       	mov    $0x27,%eax
+ 906:	e9 60 fe ff ff       	jmp    76b <syscallentry>
+
+0000090b <mmap>:
+SYSCALL(mmap) // map a file into memory
+ 90b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 910:	e9 56 fe ff ff       	jmp    76b <syscallentry>
+
+00000915 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+ 915:	b8 29 00 00 00       	mov    $0x29,%eax
+ 91a:	e9 4c fe ff ff       	jmp    76b <syscallentry>
+
+0000091f <readv>:
+SYSCALL(readv) // read into several buffers
+ 91f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 924:	e9 42 fe ff ff       	jmp    76b <syscallentry>
+
+00000929 <writev>:
+SYSCALL(writev) // write from several buffers
+ 929:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 92e:	e9 38 fe ff ff       	jmp    76b <syscallentry>
+
+00000933 <pread>:
+SYSCALL(pread) // read at an offset
+ 933:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 938:	e9 2e fe ff ff       	jmp    76b <syscallentry>
+
+0000093d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+ 93d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 942:	e9 24 fe ff ff       	jmp    76b <syscallentry>
+
+00000947 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+ 947:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 94c:	e9 1a fe ff ff       	jmp    76b <syscallentry>
+
+00000951 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+ 951:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 956:	e9 10 fe ff ff       	jmp    76b <syscallentry>
+
+0000095b <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+ 95b:	b8 30 00 00 00       	mov    $0x30,%eax
+ 960:	e9 06 fe ff ff       	jmp    76b <syscallentry>
+
+00000965 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+ 965:	b8 31 00 00 00       	mov    $0x31,%eax
+ 96a:	e9 fc fd ff ff       	jmp    76b <syscallentry>
+
+0000096f <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+ 96f:	b8 32 00 00 00       	mov    $0x32,%eax
+ 974:	e9 f2 fd ff ff       	jmp    76b <syscallentry>
+
+00000979 <profread>:
+SYSCALL(profread) // drain profiler samples
+ 979:	b8 33 00 00 00       	mov    $0x33,%eax
+ 97e:	e9 e8 fd ff ff       	jmp    76b <syscallentry>
+
+00000983 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+ 983:	b8 34 00 00 00       	mov    $0x34,%eax
+ 988:	e9 de fd ff ff       	jmp    76b <syscallentry>
+
+0000098d <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+ 98d:	b8 35 00 00 00       	mov    $0x35,%eax
+ 992:	e9 d4 fd ff ff       	jmp    76b <syscallentry>
+
+00000997 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+ 997:	b8 36 00 00 00       	mov    $0x36,%eax
+ 99c:	e9 ca fd ff ff       	jmp    76b <syscallentry>
+
+000009a1 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+ 9a1:	b8 37 00 00 00       	mov    $0x37,%eax
+ 9a6:	e9 c0 fd ff ff       	jmp    76b <syscallentry>
+ 9ab:	66 90                	xchg   %ax,%ax
+ 9ad:	66 90                	xchg   %ax,%ax
+ 9af:	90                   	nop
+
+000009b0 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 9b0:	55                   	push   %ebp
+ 9b1:	89 e5                	mov    %esp,%ebp
+ 9b3:	57                   	push   %edi
+ 9b4:	56                   	push   %esi
+ 9b5:	53                   	push   %ebx
+ 9b6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 9b8:	89 d1                	mov    %edx,%ecx
+{
+ 9ba:	83 ec 3c             	sub    $0x3c,%esp
+ 9bd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 9c0:	85 d2                	test   %edx,%edx
+ 9c2:	0f 89 80 00 00 00    	jns    a48 <printint+0x98>
+ 9c8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 9cc:	74 7a                	je     a48 <printint+0x98>
+    x = -xx;
+ 9ce:	f7 d9                	neg    %ecx
+    neg = 1;
+ 9d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 9d5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 9d8:	31 f6                	xor    %esi,%esi
+ 9da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 9e0:	89 c8                	mov    %ecx,%eax
+ 9e2:	31 d2                	xor    %edx,%edx
+ 9e4:	89 f7                	mov    %esi,%edi
+ 9e6:	f7 f3                	div    %ebx
+ 9e8:	8d 76 01             	lea    0x1(%esi),%esi
+ 9eb:	0f b6 92 98 0f 00 00 	movzbl 0xf98(%edx),%edx
+ 9f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 9f6:	89 ca                	mov    %ecx,%edx
+ 9f8:	89 c1                	mov    %eax,%ecx
+ 9fa:	39 da                	cmp    %ebx,%edx
+ 9fc:	73 e2                	jae    9e0 <printint+0x30>
+  if(neg)
+ 9fe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ a01:	85 c0                	test   %eax,%eax
+ a03:	74 07                	je     a0c <printint+0x5c>
+    buf[i++] = '-';
+ a05:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ a0a:	89 f7                	mov    %esi,%edi
+ a0c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ a0f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ a12:	01 df                	add    %ebx,%edi
+ a14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ a18:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+ a1b:	83 ec 04             	sub    $0x4,%esp
+ a1e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ a21:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ a24:	6a 01                	push   $0x1
+ a26:	50                   	push   %eax
+ a27:	56                   	push   %esi
+ a28:	e8 e3 f6 ff ff       	call   110 <bufwrite>
+  while(--i >= 0)
+ a2d:	89 f8                	mov    %edi,%eax
+ a2f:	83 c4 10             	add    $0x10,%esp
+ a32:	83 ef 01             	sub    $0x1,%edi
+ a35:	39 d8                	cmp    %ebx,%eax
+ a37:	75 df                	jne    a18 <printint+0x68>
+}
+ a39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a3c:	5b                   	pop    %ebx
+ a3d:	5e                   	pop    %esi
+ a3e:	5f                   	pop    %edi
+ a3f:	5d                   	pop    %ebp
+ a40:	c3                   	ret
+ a41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ a48:	31 c0                	xor    %eax,%eax
+ a4a:	eb 89                	jmp    9d5 <printint+0x25>
+ a4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a50 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ a50:	55                   	push   %ebp
+ a51:	89 e5                	mov    %esp,%ebp
+ a53:	57                   	push   %edi
+ a54:	56                   	push   %esi
+ a55:	53                   	push   %ebx
+ a56:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ a59:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a5c:	0f b6 18             	movzbl (%eax),%ebx
+ a5f:	84 db                	test   %bl,%bl
+ a61:	74 6c                	je     acf <printf+0x7f>
+ a63:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+ a66:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ a69:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ a6b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ a6e:	eb 26                	jmp    a96 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ a70:	83 f8 25             	cmp    $0x25,%eax
+ a73:	74 4b                	je     ac0 <printf+0x70>
+  bufwrite(fd, &c, 1);
+ a75:	83 ec 04             	sub    $0x4,%esp
+ a78:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ a7b:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ a7e:	6a 01                	push   $0x1
+ a80:	50                   	push   %eax
+ a81:	ff 75 08             	push   0x8(%ebp)
+ a84:	e8 87 f6 ff ff       	call   110 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+ a89:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ a8c:	0f b6 1f             	movzbl (%edi),%ebx
+ a8f:	83 c7 01             	add    $0x1,%edi
+ a92:	84 db                	test   %bl,%bl
+ a94:	74 39                	je     acf <printf+0x7f>
+    c = fmt[i] & 0xff;
+ a96:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ a99:	85 f6                	test   %esi,%esi
+ a9b:	74 d3                	je     a70 <printf+0x20>
+      }
+    } else if(state == '%'){
+ a9d:	83 fe 25             	cmp    $0x25,%esi
+ aa0:	75 ea                	jne    a8c <printf+0x3c>
+      if(c == 'd'){
+ aa2:	83 f8 25             	cmp    $0x25,%eax
+ aa5:	0f 84 d5 01 00 00    	je     c80 <printf+0x230>
+ aab:	83 e8 63             	sub    $0x63,%eax
+ aae:	83 f8 15             	cmp    $0x15,%eax
+ ab1:	77 45                	ja     af8 <printf+0xa8>
+ ab3:	ff 24 85 40 0f 00 00 	jmp    *0xf40(,%eax,4)
+ aba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+ ac0:	0f b6 1f             	movzbl (%edi),%ebx
+ ac3:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+ ac6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ acb:	84 db                	test   %bl,%bl
+ acd:	75 c7                	jne    a96 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+ acf:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+ ad3:	74 0b                	je     ae0 <printf+0x90>
+    fflush(fd);
+}
+ ad5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ad8:	5b                   	pop    %ebx
+ ad9:	5e                   	pop    %esi
+ ada:	5f                   	pop    %edi
+ adb:	5d                   	pop    %ebp
+ adc:	c3                   	ret
+ add:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+ ae0:	83 ec 0c             	sub    $0xc,%esp
+ ae3:	6a 02                	push   $0x2
+ ae5:	e8 c6 f7 ff ff       	call   2b0 <fflush>
+ aea:	83 c4 10             	add    $0x10,%esp
+}
+ aed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ af0:	5b                   	pop    %ebx
+ af1:	5e                   	pop    %esi
+ af2:	5f                   	pop    %edi
+ af3:	5d                   	pop    %ebp
+ af4:	c3                   	ret
+ af5:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+ af8:	83 ec 04             	sub    $0x4,%esp
+ afb:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ afe:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+ b02:	6a 01                	push   $0x1
+ b04:	52                   	push   %edx
+ b05:	89 55 c0             	mov    %edx,-0x40(%ebp)
+ b08:	ff 75 08             	push   0x8(%ebp)
+ b0b:	e8 00 f6 ff ff       	call   110 <bufwrite>
+ b10:	83 c4 0c             	add    $0xc,%esp
+ b13:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ b16:	6a 01                	push   $0x1
+ b18:	8b 55 c0             	mov    -0x40(%ebp),%edx
+ b1b:	52                   	push   %edx
+      state = 0;
+ b1c:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+ b1e:	ff 75 08             	push   0x8(%ebp)
+ b21:	e8 ea f5 ff ff       	call   110 <bufwrite>
+        putc(fd, c);
+ b26:	83 c4 10             	add    $0x10,%esp
+ b29:	e9 5e ff ff ff       	jmp    a8c <printf+0x3c>
+ b2e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+ b30:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ b33:	83 ec 0c             	sub    $0xc,%esp
+ b36:	b9 10 00 00 00       	mov    $0x10,%ecx
+ b3b:	8b 16                	mov    (%esi),%edx
+ b3d:	6a 00                	push   $0x0
+ b3f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+ b42:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+ b45:	e8 66 fe ff ff       	call   9b0 <printint>
+        ap++;
+ b4a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ b4d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b50:	31 f6                	xor    %esi,%esi
+ b52:	e9 35 ff ff ff       	jmp    a8c <printf+0x3c>
+ b57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b5e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+ b60:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ b63:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ b65:	83 c0 04             	add    $0x4,%eax
+ b68:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+ b6b:	b8 38 0f 00 00       	mov    $0xf38,%eax
+ b70:	85 db                	test   %ebx,%ebx
+ b72:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+ b75:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+ b78:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+ b7a:	53                   	push   %ebx
+ b7b:	e8 90 f9 ff ff       	call   510 <strlen>
+ b80:	83 c4 0c             	add    $0xc,%esp
+ b83:	50                   	push   %eax
+ b84:	53                   	push   %ebx
+ b85:	ff 75 08             	push   0x8(%ebp)
+ b88:	e8 83 f5 ff ff       	call   110 <bufwrite>
+ b8d:	83 c4 10             	add    $0x10,%esp
+ b90:	e9 f7 fe ff ff       	jmp    a8c <printf+0x3c>
+ b95:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ b98:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+ b9b:	83 ec 04             	sub    $0x4,%esp
+ b9e:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+ ba1:	8b 06                	mov    (%esi),%eax
+        ap++;
+ ba3:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+ ba6:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+ ba9:	6a 01                	push   $0x1
+ bab:	52                   	push   %edx
+ bac:	ff 75 08             	push   0x8(%ebp)
+ baf:	e8 5c f5 ff ff       	call   110 <bufwrite>
+        ap++;
+ bb4:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ bb7:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ bba:	31 f6                	xor    %esi,%esi
+ bbc:	e9 cb fe ff ff       	jmp    a8c <printf+0x3c>
+ bc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+ bc8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ bcb:	83 ec 0c             	sub    $0xc,%esp
+ bce:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ bd3:	8b 16                	mov    (%esi),%edx
+ bd5:	6a 01                	push   $0x1
+ bd7:	e9 63 ff ff ff       	jmp    b3f <printf+0xef>
+ bdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+ be0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ be3:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ be6:	89 7d c0             	mov    %edi,-0x40(%ebp)
+ be9:	89 55 bc             	mov    %edx,-0x44(%ebp)
+ bec:	8b 18                	mov    (%eax),%ebx
+ bee:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+ bf1:	31 c0                	xor    %eax,%eax
+ bf3:	89 c7                	mov    %eax,%edi
+ bf5:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+ bf8:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+ bfd:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+ bff:	f7 e1                	mul    %ecx
+ c01:	c1 ea 03             	shr    $0x3,%edx
+ c04:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ c07:	89 d1                	mov    %edx,%ecx
+ c09:	01 c0                	add    %eax,%eax
+ c0b:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ c0d:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+ c0f:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ c11:	be 0a 00 00 00       	mov    $0xa,%esi
+ c16:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+ c18:	89 da                	mov    %ebx,%edx
+ c1a:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+ c1c:	89 fe                	mov    %edi,%esi
+ c1e:	83 c7 01             	add    $0x1,%edi
+ c21:	8d 42 30             	lea    0x30(%edx),%eax
+ c24:	89 da                	mov    %ebx,%edx
+ c26:	8d 14 92             	lea    (%edx,%edx,4),%edx
+ c29:	01 d2                	add    %edx,%edx
+ c2b:	29 d0                	sub    %edx,%eax
+ c2d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+ c31:	89 c8                	mov    %ecx,%eax
+ c33:	09 d8                	or     %ebx,%eax
+ c35:	75 c1                	jne    bf8 <printf+0x1a8>
+ c37:	8b 55 bc             	mov    -0x44(%ebp),%edx
+ c3a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ c3d:	01 d6                	add    %edx,%esi
+ c3f:	89 f7                	mov    %esi,%edi
+ c41:	89 d6                	mov    %edx,%esi
+ c43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c47:	90                   	nop
+    putc(fd, buf[i]);
+ c48:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+ c4b:	83 ec 04             	sub    $0x4,%esp
+ c4e:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+ c51:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+ c54:	6a 01                	push   $0x1
+ c56:	50                   	push   %eax
+ c57:	53                   	push   %ebx
+ c58:	e8 b3 f4 ff ff       	call   110 <bufwrite>
+  while(--i >= 0)
+ c5d:	89 fa                	mov    %edi,%edx
+ c5f:	83 c4 10             	add    $0x10,%esp
+ c62:	83 ef 01             	sub    $0x1,%edi
+ c65:	39 d6                	cmp    %edx,%esi
+ c67:	75 df                	jne    c48 <printf+0x1f8>
+        ap += 2;
+ c69:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+ c6d:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+ c70:	31 f6                	xor    %esi,%esi
+ c72:	e9 15 fe ff ff       	jmp    a8c <printf+0x3c>
+ c77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c7e:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+ c80:	83 ec 04             	sub    $0x4,%esp
+ c83:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ c86:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ c89:	6a 01                	push   $0x1
+ c8b:	e9 8b fe ff ff       	jmp    b1b <printf+0xcb>
+
+00000c90 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ c90:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c91:	a1 e0 26 00 00       	mov    0x26e0,%eax
+{
+ c96:	89 e5                	mov    %esp,%ebp
+ c98:	57                   	push   %edi
+ c99:	56                   	push   %esi
+ c9a:	53                   	push   %ebx
+ c9b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ c9e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ca1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ca8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ caa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cac:	39 ca                	cmp    %ecx,%edx
+ cae:	73 30                	jae    ce0 <free+0x50>
+ cb0:	39 c1                	cmp    %eax,%ecx
+ cb2:	72 04                	jb     cb8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cb4:	39 c2                	cmp    %eax,%edx
+ cb6:	72 f0                	jb     ca8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ cb8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ cbb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ cbe:	39 f8                	cmp    %edi,%eax
+ cc0:	74 2e                	je     cf0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ cc2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ cc5:	8b 42 04             	mov    0x4(%edx),%eax
+ cc8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ ccb:	39 f1                	cmp    %esi,%ecx
+ ccd:	74 38                	je     d07 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ ccf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ cd1:	5b                   	pop    %ebx
+  freep = p;
+ cd2:	89 15 e0 26 00 00    	mov    %edx,0x26e0
+}
+ cd8:	5e                   	pop    %esi
+ cd9:	5f                   	pop    %edi
+ cda:	5d                   	pop    %ebp
+ cdb:	c3                   	ret
+ cdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ce0:	39 c1                	cmp    %eax,%ecx
+ ce2:	72 d0                	jb     cb4 <free+0x24>
+ ce4:	eb c2                	jmp    ca8 <free+0x18>
+ ce6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ced:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ cf0:	03 70 04             	add    0x4(%eax),%esi
+ cf3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ cf6:	8b 02                	mov    (%edx),%eax
+ cf8:	8b 00                	mov    (%eax),%eax
+ cfa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ cfd:	8b 42 04             	mov    0x4(%edx),%eax
+ d00:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d03:	39 f1                	cmp    %esi,%ecx
+ d05:	75 c8                	jne    ccf <free+0x3f>
+    p->s.size += bp->s.size;
+ d07:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ d0a:	89 15 e0 26 00 00    	mov    %edx,0x26e0
+    p->s.size += bp->s.size;
+ d10:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ d13:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ d16:	89 0a                	mov    %ecx,(%edx)
+}
+ d18:	5b                   	pop    %ebx
+ d19:	5e                   	pop    %esi
+ d1a:	5f                   	pop    %edi
+ d1b:	5d                   	pop    %ebp
+ d1c:	c3                   	ret
+ d1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d20 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ d20:	55                   	push   %ebp
+ d21:	89 e5                	mov    %esp,%ebp
+ d23:	57                   	push   %edi
+ d24:	56                   	push   %esi
+ d25:	53                   	push   %ebx
+ d26:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d29:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ d2c:	8b 15 e0 26 00 00    	mov    0x26e0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d32:	8d 78 07             	lea    0x7(%eax),%edi
+ d35:	c1 ef 03             	shr    $0x3,%edi
+ d38:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ d3b:	85 d2                	test   %edx,%edx
+ d3d:	0f 84 8d 00 00 00    	je     dd0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d43:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d45:	8b 48 04             	mov    0x4(%eax),%ecx
+ d48:	39 f9                	cmp    %edi,%ecx
+ d4a:	73 64                	jae    db0 <malloc+0x90>
+  if(nu < 4096)
+ d4c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ d51:	39 df                	cmp    %ebx,%edi
+ d53:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ d56:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ d5d:	eb 0a                	jmp    d69 <malloc+0x49>
+ d5f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d60:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d62:	8b 48 04             	mov    0x4(%eax),%ecx
+ d65:	39 f9                	cmp    %edi,%ecx
+ d67:	73 47                	jae    db0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ d69:	89 c2                	mov    %eax,%edx
+ d6b:	39 05 e0 26 00 00    	cmp    %eax,0x26e0
+ d71:	75 ed                	jne    d60 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ d73:	83 ec 0c             	sub    $0xc,%esp
+ d76:	56                   	push   %esi
+ d77:	e8 c7 fa ff ff       	call   843 <sbrk>
+  if(p == (char*)-1)
+ d7c:	83 c4 10             	add    $0x10,%esp
+ d7f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ d82:	74 1c                	je     da0 <malloc+0x80>
+  hp->s.size = nu;
+ d84:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ d87:	83 ec 0c             	sub    $0xc,%esp
+ d8a:	83 c0 08             	add    $0x8,%eax
+ d8d:	50                   	push   %eax
+ d8e:	e8 fd fe ff ff       	call   c90 <free>
+  return freep;
+ d93:	8b 15 e0 26 00 00    	mov    0x26e0,%edx
+      if((p = morecore(nunits)) == 0)
+ d99:	83 c4 10             	add    $0x10,%esp
+ d9c:	85 d2                	test   %edx,%edx
+ d9e:	75 c0                	jne    d60 <malloc+0x40>
+        return 0;
+  }
+}
+ da0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ da3:	31 c0                	xor    %eax,%eax
+}
+ da5:	5b                   	pop    %ebx
+ da6:	5e                   	pop    %esi
+ da7:	5f                   	pop    %edi
+ da8:	5d                   	pop    %ebp
+ da9:	c3                   	ret
+ daa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ db0:	39 cf                	cmp    %ecx,%edi
+ db2:	74 4c                	je     e00 <malloc+0xe0>
+        p->s.size -= nunits;
+ db4:	29 f9                	sub    %edi,%ecx
+ db6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ db9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ dbc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ dbf:	89 15 e0 26 00 00    	mov    %edx,0x26e0
+}
+ dc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ dc8:	83 c0 08             	add    $0x8,%eax
+}
+ dcb:	5b                   	pop    %ebx
+ dcc:	5e                   	pop    %esi
+ dcd:	5f                   	pop    %edi
+ dce:	5d                   	pop    %ebp
+ dcf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ dd0:	c7 05 e0 26 00 00 e4 	movl   $0x26e4,0x26e0
+ dd7:	26 00 00 
+    base.s.size = 0;
+ dda:	b8 e4 26 00 00       	mov    $0x26e4,%eax
+    base.s.ptr = freep = prevp = &base;
+ ddf:	c7 05 e4 26 00 00 e4 	movl   $0x26e4,0x26e4
+ de6:	26 00 00 
+    base.s.size = 0;
+ de9:	c7 05 e8 26 00 00 00 	movl   $0x0,0x26e8
+ df0:	00 00 00 
+    if(p->s.size >= nunits){
+ df3:	e9 54 ff ff ff       	jmp    d4c <malloc+0x2c>
+ df8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dff:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ e00:	8b 08                	mov    (%eax),%ecx
+ e02:	89 0a                	mov    %ecx,(%edx)
+ e04:	eb b9                	jmp    dbf <malloc+0x9f>
+ e06:	66 90                	xchg   %ax,%ax
+ e08:	66 90                	xchg   %ax,%ax
+ e0a:	66 90                	xchg   %ax,%ax
+ e0c:	66 90                	xchg   %ax,%ax
+ e0e:	66 90                	xchg   %ax,%ax
+
+00000e10 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+ e10:	55                   	push   %ebp
+ e11:	89 e5                	mov    %esp,%ebp
+ e13:	57                   	push   %edi
+ e14:	56                   	push   %esi
+ e15:	be 01 00 00 00       	mov    $0x1,%esi
+ e1a:	53                   	push   %ebx
+ e1b:	83 ec 28             	sub    $0x28,%esp
+ e1e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ e21:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ e24:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+ e27:	68 00 98 00 00       	push   $0x9800
+ e2c:	e8 ef fe ff ff       	call   d20 <malloc>
+ e31:	83 c4 10             	add    $0x10,%esp
+ e34:	89 c7                	mov    %eax,%edi
+ e36:	85 c0                	test   %eax,%eax
+ e38:	74 62                	je     e9c <waitpoll+0x8c>
+ e3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+ e40:	83 ec 0c             	sub    $0xc,%esp
+ e43:	6a 01                	push   $0x1
+ e45:	e8 03 fa ff ff       	call   84d <sleep>
+    fn();
+ e4a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ e4d:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+ e4f:	58                   	pop    %eax
+ e50:	5a                   	pop    %edx
+ e51:	68 00 02 00 00       	push   $0x200
+ e56:	57                   	push   %edi
+ e57:	e8 eb fa ff ff       	call   947 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+ e5c:	83 c4 10             	add    $0x10,%esp
+ e5f:	85 c0                	test   %eax,%eax
+ e61:	7e 2d                	jle    e90 <waitpoll+0x80>
+ e63:	6b c0 4c             	imul   $0x4c,%eax,%eax
+ e66:	89 fa                	mov    %edi,%edx
+    alive = 0;
+ e68:	31 c9                	xor    %ecx,%ecx
+ e6a:	01 f8                	add    %edi,%eax
+ e6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+ e70:	3b 1a                	cmp    (%edx),%ebx
+ e72:	75 07                	jne    e7b <waitpoll+0x6b>
+        alive = 1;
+ e74:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+ e78:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+ e7b:	83 c2 4c             	add    $0x4c,%edx
+ e7e:	39 d0                	cmp    %edx,%eax
+ e80:	75 ee                	jne    e70 <waitpoll+0x60>
+  } while(alive);
+ e82:	85 c9                	test   %ecx,%ecx
+ e84:	75 ba                	jne    e40 <waitpoll+0x30>
+ e86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e8d:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+ e90:	83 ec 0c             	sub    $0xc,%esp
+ e93:	57                   	push   %edi
+ e94:	e8 f7 fd ff ff       	call   c90 <free>
+  wait();
+ e99:	83 c4 10             	add    $0x10,%esp
+}
+ e9c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e9f:	5b                   	pop    %ebx
+ ea0:	5e                   	pop    %esi
+ ea1:	5f                   	pop    %edi
+ ea2:	5d                   	pop    %ebp
+  wait();
+ ea3:	e9 10 f9 ff ff       	jmp    7b8 <wait>
+ ea8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ eaf:	90                   	nop
+
+00000eb0 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+ eb0:	55                   	push   %ebp
+ eb1:	89 e5                	mov    %esp,%ebp
+ eb3:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+ eb6:	c7 45 f0 a9 0f 00 00 	movl   $0xfa9,-0x10(%ebp)
+ ebd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+ ec4:	e8 87 f4 ff ff       	call   350 <fork>
+ ec9:	85 c0                	test   %eax,%eax
+ ecb:	78 09                	js     ed6 <runps+0x26>
+    return -1;
+  if(pid == 0){
+ ecd:	74 0e                	je     edd <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+ ecf:	e8 e4 f8 ff ff       	call   7b8 <wait>
+}
+ ed4:	c9                   	leave
+ ed5:	c3                   	ret
+ ed6:	c9                   	leave
+    return -1;
+ ed7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ edc:	c3                   	ret
+    exec("ps", argv);
+ edd:	50                   	push   %eax
+ ede:	50                   	push   %eax
+ edf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ ee2:	50                   	push   %eax
+ ee3:	68 a9 0f 00 00       	push   $0xfa9
+ ee8:	e8 c3 f4 ff ff       	call   3b0 <exec>
+    printf(2, "exec ps failed\n");
+ eed:	5a                   	pop    %edx
+ eee:	59                   	pop    %ecx
+ eef:	68 ac 0f 00 00       	push   $0xfac
+ ef4:	6a 02                	push   $0x2
+ ef6:	e8 55 fb ff ff       	call   a50 <printf>
+    exit();
+ efb:	e8 a0 f4 ff ff       	call   3a0 <exit>
@@ -0,0 +1,2049 @@
+
+_copy:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return n < 0 ? -1 : 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(argc != 3){
+  11:	83 39 03             	cmpl   $0x3,(%ecx)
+{
+  14:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc != 3){
+  17:	74 13                	je     2c <main+0x2c>
+    printf(1, "Usage: copy <src> <dest>\n");  // Add file descriptor 1 (stdout)
+  19:	50                   	push   %eax
+  1a:	50                   	push   %eax
+  1b:	68 f0 0e 00 00       	push   $0xef0
+  20:	6a 01                	push   $0x1
+  22:	e8 19 0a 00 00       	call   a40 <printf>
+    exit();  // Remove argument
+  27:	e8 64 03 00 00       	call   390 <exit>
+  }
+
+  if(local_copy_file(argv[1], argv[2]) < 0){
+  2c:	51                   	push   %ecx
+  2d:	51                   	push   %ecx
+  2e:	ff 70 08             	push   0x8(%eax)
+  31:	ff 70 04             	push   0x4(%eax)
+  34:	e8 37 00 00 00       	call   70 <local_copy_file>
+  39:	83 c4 10             	add    $0x10,%esp
+  3c:	85 c0                	test   %eax,%eax
+  3e:	78 16                	js     56 <main+0x56>
+    printf(1, "Copy failed\n");  // Add file descriptor 1
+  } else {
+    printf(1, "Copy succeeded\n");  // Add file descriptor 1
+  40:	50                   	push   %eax
+  41:	50                   	push   %eax
+  42:	68 17 0f 00 00       	push   $0xf17
+  47:	6a 01                	push   $0x1
+  49:	e8 f2 09 00 00       	call   a40 <printf>
+  4e:	83 c4 10             	add    $0x10,%esp
+  }
+
+  exit();  // Remove argument
+  51:	e8 3a 03 00 00       	call   390 <exit>
+    printf(1, "Copy failed\n");  // Add file descriptor 1
+  56:	52                   	push   %edx
+  57:	52                   	push   %edx
+  58:	68 0a 0f 00 00       	push   $0xf0a
+  5d:	6a 01                	push   $0x1
+  5f:	e8 dc 09 00 00       	call   a40 <printf>
+  64:	83 c4 10             	add    $0x10,%esp
+  67:	eb e8                	jmp    51 <main+0x51>
+  69:	66 90                	xchg   %ax,%ax
+  6b:	66 90                	xchg   %ax,%ax
+  6d:	66 90                	xchg   %ax,%ax
+  6f:	90                   	nop
+
+00000070 <local_copy_file>:
+int local_copy_file(char *src, char *dest) {
+  70:	55                   	push   %ebp
+  71:	89 e5                	mov    %esp,%ebp
+  73:	57                   	push   %edi
+  74:	56                   	push   %esi
+  75:	53                   	push   %ebx
+  76:	83 ec 14             	sub    $0x14,%esp
+  if((fd_src = open(src, 0)) < 0)
+  79:	6a 00                	push   $0x0
+  7b:	ff 75 08             	push   0x8(%ebp)
+  7e:	e8 56 07 00 00       	call   7d9 <open>
+  83:	83 c4 10             	add    $0x10,%esp
+  86:	85 c0                	test   %eax,%eax
+  88:	78 62                	js     ec <local_copy_file+0x7c>
+  if((fd_dest = open(dest, 0x200 | 0x002)) < 0) { // O_CREATE | O_RDWR
+  8a:	83 ec 08             	sub    $0x8,%esp
+  8d:	89 c6                	mov    %eax,%esi
+  8f:	68 02 02 00 00       	push   $0x202
+  94:	ff 75 0c             	push   0xc(%ebp)
+  97:	e8 3d 07 00 00       	call   7d9 <open>
+  9c:	83 c4 10             	add    $0x10,%esp
+  9f:	89 c7                	mov    %eax,%edi
+  a1:	85 c0                	test   %eax,%eax
+  a3:	78 3b                	js     e0 <local_copy_file+0x70>
+  a5:	8d 76 00             	lea    0x0(%esi),%esi
+  while((n = copy_file_range(fd_src, fd_dest, 64*1024)) > 0)
+  a8:	83 ec 04             	sub    $0x4,%esp
+  ab:	68 00 00 01 00       	push   $0x10000
+  b0:	57                   	push   %edi
+  b1:	56                   	push   %esi
+  b2:	e8 30 08 00 00       	call   8e7 <copy_file_range>
+  b7:	83 c4 10             	add    $0x10,%esp
+  ba:	89 c3                	mov    %eax,%ebx
+  bc:	85 c0                	test   %eax,%eax
+  be:	7f e8                	jg     a8 <local_copy_file+0x38>
+  close(fd_src);
+  c0:	83 ec 0c             	sub    $0xc,%esp
+  c3:	56                   	push   %esi
+  c4:	e8 37 03 00 00       	call   400 <close>
+  close(fd_dest);
+  c9:	89 3c 24             	mov    %edi,(%esp)
+  cc:	e8 2f 03 00 00       	call   400 <close>
+  return n < 0 ? -1 : 0;
+  d1:	83 c4 10             	add    $0x10,%esp
+  d4:	f7 db                	neg    %ebx
+  d6:	19 c0                	sbb    %eax,%eax
+}
+  d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  db:	5b                   	pop    %ebx
+  dc:	5e                   	pop    %esi
+  dd:	5f                   	pop    %edi
+  de:	5d                   	pop    %ebp
+  df:	c3                   	ret
+    close(fd_src);
+  e0:	83 ec 0c             	sub    $0xc,%esp
+  e3:	56                   	push   %esi
+  e4:	e8 17 03 00 00       	call   400 <close>
+    return -1;
+  e9:	83 c4 10             	add    $0x10,%esp
+    return -1;
+  ec:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  f1:	eb e5                	jmp    d8 <local_copy_file+0x68>
+  f3:	66 90                	xchg   %ax,%ax
+  f5:	66 90                	xchg   %ax,%ax
+  f7:	66 90                	xchg   %ax,%ax
+  f9:	66 90                	xchg   %ax,%ax
+  fb:	66 90                	xchg   %ax,%ax
+  fd:	66 90                	xchg   %ax,%ax
+  ff:	90                   	nop
+
+00000100 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	57                   	push   %edi
+ 104:	56                   	push   %esi
+ 105:	53                   	push   %ebx
+ 106:	83 ec 4c             	sub    $0x4c,%esp
+ 109:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 10c:	8b 55 08             	mov    0x8(%ebp),%edx
+ 10f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 112:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+ 115:	83 fa 0f             	cmp    $0xf,%edx
+ 118:	0f 87 32 01 00 00    	ja     250 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+ 11e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 124:	8b 80 40 14 00 00    	mov    0x1440(%eax),%eax
+ 12a:	85 c0                	test   %eax,%eax
+ 12c:	0f 84 de 00 00 00    	je     210 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+ 132:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 138:	8b b0 44 14 00 00    	mov    0x1444(%eax),%esi
+ 13e:	8d 88 40 14 00 00    	lea    0x1440(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+ 144:	8d b8 48 14 00 00    	lea    0x1448(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+ 14a:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+ 14d:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+ 150:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+ 153:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+ 159:	0f 8f 01 01 00 00    	jg     260 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+ 15f:	8d 78 08             	lea    0x8(%eax),%edi
+ 162:	8d bc 3e 40 14 00 00 	lea    0x1440(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 169:	85 db                	test   %ebx,%ebx
+ 16b:	7e 3b                	jle    1a8 <bufwrite+0xa8>
+ 16d:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+ 170:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+ 173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 177:	90                   	nop
+    *dst++ = *src++;
+ 178:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 179:	39 c6                	cmp    %eax,%esi
+ 17b:	75 fb                	jne    178 <bufwrite+0x78>
+  ob[fd].n += n;
+ 17d:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 183:	8b 88 44 14 00 00    	mov    0x1444(%eax),%ecx
+ 189:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 18b:	83 b8 40 14 00 00 01 	cmpl   $0x1,0x1440(%eax)
+  ob[fd].n += n;
+ 192:	89 88 44 14 00 00    	mov    %ecx,0x1444(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 198:	74 26                	je     1c0 <bufwrite+0xc0>
+}
+ 19a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 19d:	5b                   	pop    %ebx
+ 19e:	5e                   	pop    %esi
+ 19f:	5f                   	pop    %edi
+ 1a0:	5d                   	pop    %ebp
+ 1a1:	c3                   	ret
+ 1a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+ 1a8:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 1ab:	83 b8 40 14 00 00 01 	cmpl   $0x1,0x1440(%eax)
+  ob[fd].n += n;
+ 1b2:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 1b5:	75 e3                	jne    19a <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+ 1b7:	85 db                	test   %ebx,%ebx
+ 1b9:	74 df                	je     19a <bufwrite+0x9a>
+ 1bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1bf:	90                   	nop
+  src = vsrc;
+ 1c0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 1c3:	01 c3                	add    %eax,%ebx
+ 1c5:	eb 10                	jmp    1d7 <bufwrite+0xd7>
+ 1c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ce:	66 90                	xchg   %ax,%ax
+ 1d0:	83 c0 01             	add    $0x1,%eax
+ 1d3:	39 d8                	cmp    %ebx,%eax
+ 1d5:	74 c3                	je     19a <bufwrite+0x9a>
+    if(*p == (char)c)
+ 1d7:	80 38 0a             	cmpb   $0xa,(%eax)
+ 1da:	75 f4                	jne    1d0 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 1dc:	85 c9                	test   %ecx,%ecx
+ 1de:	7e ba                	jle    19a <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 1e0:	83 ec 04             	sub    $0x4,%esp
+ 1e3:	51                   	push   %ecx
+ 1e4:	ff 75 ac             	push   -0x54(%ebp)
+ 1e7:	52                   	push   %edx
+ 1e8:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+ 1eb:	e8 cd 05 00 00       	call   7bd <write>
+    ob[fd].n = 0;
+ 1f0:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+ 1f3:	83 c4 10             	add    $0x10,%esp
+ 1f6:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+ 1fc:	c7 82 44 14 00 00 00 	movl   $0x0,0x1444(%edx)
+ 203:	00 00 00 
+ 206:	eb 92                	jmp    19a <bufwrite+0x9a>
+ 208:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20f:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 210:	83 ec 08             	sub    $0x8,%esp
+ 213:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 216:	50                   	push   %eax
+ 217:	52                   	push   %edx
+ 218:	89 55 b0             	mov    %edx,-0x50(%ebp)
+ 21b:	e8 d7 05 00 00       	call   7f7 <fstat>
+ 220:	83 c4 10             	add    $0x10,%esp
+ 223:	8b 55 b0             	mov    -0x50(%ebp),%edx
+ 226:	89 c1                	mov    %eax,%ecx
+ 228:	b8 02 00 00 00       	mov    $0x2,%eax
+ 22d:	85 c9                	test   %ecx,%ecx
+ 22f:	75 0d                	jne    23e <bufwrite+0x13e>
+ 231:	31 c0                	xor    %eax,%eax
+ 233:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 238:	0f 95 c0             	setne  %al
+ 23b:	83 c0 01             	add    $0x1,%eax
+ 23e:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+ 244:	89 81 40 14 00 00    	mov    %eax,0x1440(%ecx)
+ 24a:	e9 e3 fe ff ff       	jmp    132 <bufwrite+0x32>
+ 24f:	90                   	nop
+}
+ 250:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 253:	5b                   	pop    %ebx
+ 254:	5e                   	pop    %esi
+ 255:	5f                   	pop    %edi
+ 256:	5d                   	pop    %ebp
+    write(fd, p, n);
+ 257:	e9 61 05 00 00       	jmp    7bd <write>
+ 25c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+ 260:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+ 263:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+ 266:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+ 269:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+ 26c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+ 26f:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+ 272:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+ 275:	6a 02                	push   $0x2
+ 277:	50                   	push   %eax
+ 278:	52                   	push   %edx
+ 279:	e8 9b 06 00 00       	call   919 <writev>
+    ob[fd].n = 0;
+ 27e:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+ 281:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+ 284:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ 28b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 28e:	5b                   	pop    %ebx
+ 28f:	5e                   	pop    %esi
+ 290:	5f                   	pop    %edi
+ 291:	5d                   	pop    %ebp
+ 292:	c3                   	ret
+ 293:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000002a0 <fflush>:
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	53                   	push   %ebx
+ 2a4:	83 ec 04             	sub    $0x4,%esp
+ 2a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 2aa:	83 f8 0f             	cmp    $0xf,%eax
+ 2ad:	77 16                	ja     2c5 <fflush+0x25>
+ 2af:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+ 2b5:	8b 8a 44 14 00 00    	mov    0x1444(%edx),%ecx
+ 2bb:	8d 9a 40 14 00 00    	lea    0x1440(%edx),%ebx
+ 2c1:	85 c9                	test   %ecx,%ecx
+ 2c3:	7f 0b                	jg     2d0 <fflush+0x30>
+}
+ 2c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2c8:	c9                   	leave
+ 2c9:	c3                   	ret
+ 2ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 2d0:	83 ec 04             	sub    $0x4,%esp
+ 2d3:	81 c2 48 14 00 00    	add    $0x1448,%edx
+ 2d9:	51                   	push   %ecx
+ 2da:	52                   	push   %edx
+ 2db:	50                   	push   %eax
+ 2dc:	e8 dc 04 00 00       	call   7bd <write>
+    ob[fd].n = 0;
+ 2e1:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+ 2e8:	83 c4 10             	add    $0x10,%esp
+}
+ 2eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2ee:	c9                   	leave
+ 2ef:	c3                   	ret
+
+000002f0 <fflushall>:
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 2f4:	31 f6                	xor    %esi,%esi
+{
+ 2f6:	53                   	push   %ebx
+ 2f7:	bb 48 14 00 00       	mov    $0x1448,%ebx
+ 2fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 300:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 303:	85 c0                	test   %eax,%eax
+ 305:	7e 15                	jle    31c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 307:	83 ec 04             	sub    $0x4,%esp
+ 30a:	50                   	push   %eax
+ 30b:	53                   	push   %ebx
+ 30c:	56                   	push   %esi
+ 30d:	e8 ab 04 00 00       	call   7bd <write>
+    ob[fd].n = 0;
+ 312:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 319:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 31c:	83 c6 01             	add    $0x1,%esi
+ 31f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 325:	83 fe 10             	cmp    $0x10,%esi
+ 328:	75 d6                	jne    300 <fflushall+0x10>
+}
+ 32a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 32d:	5b                   	pop    %ebx
+ 32e:	5e                   	pop    %esi
+ 32f:	5d                   	pop    %ebp
+ 330:	c3                   	ret
+ 331:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 338:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33f:	90                   	nop
+
+00000340 <fork>:
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 344:	31 f6                	xor    %esi,%esi
+{
+ 346:	53                   	push   %ebx
+ 347:	bb 48 14 00 00       	mov    $0x1448,%ebx
+ 34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 350:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 353:	85 c0                	test   %eax,%eax
+ 355:	7e 15                	jle    36c <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 357:	83 ec 04             	sub    $0x4,%esp
+ 35a:	50                   	push   %eax
+ 35b:	53                   	push   %ebx
+ 35c:	56                   	push   %esi
+ 35d:	e8 5b 04 00 00       	call   7bd <write>
+    ob[fd].n = 0;
+ 362:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 369:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 36c:	83 c6 01             	add    $0x1,%esi
+ 36f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 375:	83 fe 10             	cmp    $0x10,%esi
+ 378:	75 d6                	jne    350 <fork+0x10>
+}
+ 37a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 37d:	5b                   	pop    %ebx
+ 37e:	5e                   	pop    %esi
+ 37f:	5d                   	pop    %ebp
+  return _fork();
+ 380:	e9 15 04 00 00       	jmp    79a <_fork>
+ 385:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <exit>:
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+ 396:	e8 55 ff ff ff       	call   2f0 <fflushall>
+  _exit();
+ 39b:	e8 01 04 00 00       	call   7a1 <_exit>
+
+000003a0 <exec>:
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	57                   	push   %edi
+ 3a4:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 3a5:	31 f6                	xor    %esi,%esi
+{
+ 3a7:	53                   	push   %ebx
+ 3a8:	bb 48 14 00 00       	mov    $0x1448,%ebx
+ 3ad:	83 ec 1c             	sub    $0x1c,%esp
+ 3b0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 3b6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 3b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 3c0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 3c3:	85 c0                	test   %eax,%eax
+ 3c5:	7e 15                	jle    3dc <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 3c7:	83 ec 04             	sub    $0x4,%esp
+ 3ca:	50                   	push   %eax
+ 3cb:	53                   	push   %ebx
+ 3cc:	56                   	push   %esi
+ 3cd:	e8 eb 03 00 00       	call   7bd <write>
+    ob[fd].n = 0;
+ 3d2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 3d9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 3dc:	83 c6 01             	add    $0x1,%esi
+ 3df:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 3e5:	83 fe 10             	cmp    $0x10,%esi
+ 3e8:	75 d6                	jne    3c0 <exec+0x20>
+  return _exec(path, argv);
+ 3ea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 3ed:	89 7d 0c             	mov    %edi,0xc(%ebp)
+ 3f0:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ 3f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3f6:	5b                   	pop    %ebx
+ 3f7:	5e                   	pop    %esi
+ 3f8:	5f                   	pop    %edi
+ 3f9:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 3fa:	e9 d3 03 00 00       	jmp    7d2 <_exec>
+ 3ff:	90                   	nop
+
+00000400 <close>:
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	56                   	push   %esi
+ 404:	53                   	push   %ebx
+ 405:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 408:	83 fb 0f             	cmp    $0xf,%ebx
+ 40b:	77 26                	ja     433 <close+0x33>
+ 40d:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 413:	8b 90 44 14 00 00    	mov    0x1444(%eax),%edx
+ 419:	8d b0 40 14 00 00    	lea    0x1440(%eax),%esi
+ 41f:	85 d2                	test   %edx,%edx
+ 421:	7f 25                	jg     448 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+ 423:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 429:	c7 80 40 14 00 00 00 	movl   $0x0,0x1440(%eax)
+ 430:	00 00 00 
+  return _close(fd);
+ 433:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 436:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 439:	5b                   	pop    %ebx
+ 43a:	5e                   	pop    %esi
+ 43b:	5d                   	pop    %ebp
+  return _close(fd);
+ 43c:	e9 83 03 00 00       	jmp    7c4 <_close>
+ 441:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 448:	83 ec 04             	sub    $0x4,%esp
+ 44b:	05 48 14 00 00       	add    $0x1448,%eax
+ 450:	52                   	push   %edx
+ 451:	50                   	push   %eax
+ 452:	53                   	push   %ebx
+ 453:	e8 65 03 00 00       	call   7bd <write>
+    ob[fd].n = 0;
+ 458:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+ 45f:	83 c4 10             	add    $0x10,%esp
+ 462:	eb bf                	jmp    423 <close+0x23>
+ 464:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 46f:	90                   	nop
+
+00000470 <strcpy>:
+{
+ 470:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+ 471:	31 c0                	xor    %eax,%eax
+{
+ 473:	89 e5                	mov    %esp,%ebp
+ 475:	53                   	push   %ebx
+ 476:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 479:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 47c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 480:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 484:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 487:	83 c0 01             	add    $0x1,%eax
+ 48a:	84 d2                	test   %dl,%dl
+ 48c:	75 f2                	jne    480 <strcpy+0x10>
+}
+ 48e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 491:	89 c8                	mov    %ecx,%eax
+ 493:	c9                   	leave
+ 494:	c3                   	ret
+ 495:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004a0 <strcmp>:
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	53                   	push   %ebx
+ 4a4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 4aa:	0f b6 02             	movzbl (%edx),%eax
+ 4ad:	84 c0                	test   %al,%al
+ 4af:	75 17                	jne    4c8 <strcmp+0x28>
+ 4b1:	eb 3a                	jmp    4ed <strcmp+0x4d>
+ 4b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4b7:	90                   	nop
+ 4b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 4bc:	83 c2 01             	add    $0x1,%edx
+ 4bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 4c2:	84 c0                	test   %al,%al
+ 4c4:	74 1a                	je     4e0 <strcmp+0x40>
+    p++, q++;
+ 4c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 4c8:	0f b6 19             	movzbl (%ecx),%ebx
+ 4cb:	38 c3                	cmp    %al,%bl
+ 4cd:	74 e9                	je     4b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 4cf:	29 d8                	sub    %ebx,%eax
+}
+ 4d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4d4:	c9                   	leave
+ 4d5:	c3                   	ret
+ 4d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 4e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 4e4:	31 c0                	xor    %eax,%eax
+ 4e6:	29 d8                	sub    %ebx,%eax
+}
+ 4e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4eb:	c9                   	leave
+ 4ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 4ed:	0f b6 19             	movzbl (%ecx),%ebx
+ 4f0:	31 c0                	xor    %eax,%eax
+ 4f2:	eb db                	jmp    4cf <strcmp+0x2f>
+ 4f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4ff:	90                   	nop
+
+00000500 <strlen>:
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+ 506:	80 3a 00             	cmpb   $0x0,(%edx)
+ 509:	74 15                	je     520 <strlen+0x20>
+ 50b:	31 c0                	xor    %eax,%eax
+ 50d:	8d 76 00             	lea    0x0(%esi),%esi
+ 510:	83 c0 01             	add    $0x1,%eax
+ 513:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 517:	89 c1                	mov    %eax,%ecx
+ 519:	75 f5                	jne    510 <strlen+0x10>
+}
+ 51b:	89 c8                	mov    %ecx,%eax
+ 51d:	5d                   	pop    %ebp
+ 51e:	c3                   	ret
+ 51f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 520:	31 c9                	xor    %ecx,%ecx
+}
+ 522:	5d                   	pop    %ebp
+ 523:	89 c8                	mov    %ecx,%eax
+ 525:	c3                   	ret
+ 526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000530 <memset>:
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	57                   	push   %edi
+ 534:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 537:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 53a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 53d:	89 d7                	mov    %edx,%edi
+ 53f:	fc                   	cld
+ 540:	f3 aa                	rep stos %al,%es:(%edi)
+}
+ 542:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 545:	89 d0                	mov    %edx,%eax
+ 547:	c9                   	leave
+ 548:	c3                   	ret
+ 549:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <strchr>:
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	8b 45 08             	mov    0x8(%ebp),%eax
+ 556:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 55a:	0f b6 10             	movzbl (%eax),%edx
+ 55d:	84 d2                	test   %dl,%dl
+ 55f:	75 12                	jne    573 <strchr+0x23>
+ 561:	eb 1d                	jmp    580 <strchr+0x30>
+ 563:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 567:	90                   	nop
+ 568:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 56c:	83 c0 01             	add    $0x1,%eax
+ 56f:	84 d2                	test   %dl,%dl
+ 571:	74 0d                	je     580 <strchr+0x30>
+    if(*s == c)
+ 573:	38 d1                	cmp    %dl,%cl
+ 575:	75 f1                	jne    568 <strchr+0x18>
+}
+ 577:	5d                   	pop    %ebp
+ 578:	c3                   	ret
+ 579:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 580:	31 c0                	xor    %eax,%eax
+}
+ 582:	5d                   	pop    %ebp
+ 583:	c3                   	ret
+ 584:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 58f:	90                   	nop
+
+00000590 <memchr>:
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	8b 55 10             	mov    0x10(%ebp),%edx
+ 596:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 599:	85 d2                	test   %edx,%edx
+ 59b:	74 1b                	je     5b8 <memchr+0x28>
+    if(*p == (char)c)
+ 59d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+ 5a1:	01 c2                	add    %eax,%edx
+ 5a3:	eb 0a                	jmp    5af <memchr+0x1f>
+ 5a5:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+ 5a8:	83 c0 01             	add    $0x1,%eax
+ 5ab:	39 c2                	cmp    %eax,%edx
+ 5ad:	74 09                	je     5b8 <memchr+0x28>
+    if(*p == (char)c)
+ 5af:	38 08                	cmp    %cl,(%eax)
+ 5b1:	75 f5                	jne    5a8 <memchr+0x18>
+}
+ 5b3:	5d                   	pop    %ebp
+ 5b4:	c3                   	ret
+ 5b5:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+ 5b8:	31 c0                	xor    %eax,%eax
+}
+ 5ba:	5d                   	pop    %ebp
+ 5bb:	c3                   	ret
+ 5bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005c0 <gets>:
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+ 5c4:	31 ff                	xor    %edi,%edi
+{
+ 5c6:	56                   	push   %esi
+ 5c7:	be 48 14 00 00       	mov    $0x1448,%esi
+ 5cc:	53                   	push   %ebx
+ 5cd:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 5d0:	8b 46 fc             	mov    -0x4(%esi),%eax
+ 5d3:	85 c0                	test   %eax,%eax
+ 5d5:	7e 15                	jle    5ec <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 5d7:	83 ec 04             	sub    $0x4,%esp
+ 5da:	50                   	push   %eax
+ 5db:	56                   	push   %esi
+ 5dc:	57                   	push   %edi
+ 5dd:	e8 db 01 00 00       	call   7bd <write>
+    ob[fd].n = 0;
+ 5e2:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+ 5e9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 5ec:	83 c7 01             	add    $0x1,%edi
+ 5ef:	81 c6 08 01 00 00    	add    $0x108,%esi
+ 5f5:	83 ff 10             	cmp    $0x10,%edi
+ 5f8:	75 d6                	jne    5d0 <gets+0x10>
+  for(i=0; i+1 < max; ){
+ 5fa:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+ 5fc:	8d 75 e7             	lea    -0x19(%ebp),%esi
+ 5ff:	eb 2e                	jmp    62f <gets+0x6f>
+ 601:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 608:	83 ec 04             	sub    $0x4,%esp
+ 60b:	6a 01                	push   $0x1
+ 60d:	56                   	push   %esi
+ 60e:	6a 00                	push   $0x0
+ 610:	e8 a1 01 00 00       	call   7b6 <read>
+    if(cc < 1)
+ 615:	83 c4 10             	add    $0x10,%esp
+ 618:	85 c0                	test   %eax,%eax
+ 61a:	7e 1d                	jle    639 <gets+0x79>
+    buf[i++] = c;
+ 61c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 620:	8b 55 08             	mov    0x8(%ebp),%edx
+ 623:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 627:	3c 0a                	cmp    $0xa,%al
+ 629:	74 10                	je     63b <gets+0x7b>
+ 62b:	3c 0d                	cmp    $0xd,%al
+ 62d:	74 0c                	je     63b <gets+0x7b>
+  for(i=0; i+1 < max; ){
+ 62f:	89 df                	mov    %ebx,%edi
+ 631:	83 c3 01             	add    $0x1,%ebx
+ 634:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 637:	7c cf                	jl     608 <gets+0x48>
+ 639:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 63b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 63e:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 642:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 645:	5b                   	pop    %ebx
+ 646:	5e                   	pop    %esi
+ 647:	5f                   	pop    %edi
+ 648:	5d                   	pop    %ebp
+ 649:	c3                   	ret
+ 64a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000650 <stat>:
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	57                   	push   %edi
+ 654:	56                   	push   %esi
+ 655:	53                   	push   %ebx
+ 656:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+ 659:	6a 00                	push   $0x0
+ 65b:	ff 75 08             	push   0x8(%ebp)
+ 65e:	e8 76 01 00 00       	call   7d9 <open>
+  if(fd < 0)
+ 663:	83 c4 10             	add    $0x10,%esp
+ 666:	85 c0                	test   %eax,%eax
+ 668:	78 76                	js     6e0 <stat+0x90>
+  r = fstat(fd, st);
+ 66a:	83 ec 08             	sub    $0x8,%esp
+ 66d:	ff 75 0c             	push   0xc(%ebp)
+ 670:	89 c3                	mov    %eax,%ebx
+ 672:	50                   	push   %eax
+ 673:	e8 7f 01 00 00       	call   7f7 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 678:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 67b:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 67d:	83 fb 0f             	cmp    $0xf,%ebx
+ 680:	7f 40                	jg     6c2 <stat+0x72>
+ 682:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 688:	8b 90 44 14 00 00    	mov    0x1444(%eax),%edx
+ 68e:	8d b8 40 14 00 00    	lea    0x1440(%eax),%edi
+ 694:	85 d2                	test   %edx,%edx
+ 696:	7e 1a                	jle    6b2 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 698:	83 ec 04             	sub    $0x4,%esp
+ 69b:	05 48 14 00 00       	add    $0x1448,%eax
+ 6a0:	52                   	push   %edx
+ 6a1:	50                   	push   %eax
+ 6a2:	53                   	push   %ebx
+ 6a3:	e8 15 01 00 00       	call   7bd <write>
+    ob[fd].n = 0;
+ 6a8:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+ 6af:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+ 6b2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 6b8:	c7 80 40 14 00 00 00 	movl   $0x0,0x1440(%eax)
+ 6bf:	00 00 00 
+  return _close(fd);
+ 6c2:	83 ec 0c             	sub    $0xc,%esp
+ 6c5:	53                   	push   %ebx
+ 6c6:	e8 f9 00 00 00       	call   7c4 <_close>
+ 6cb:	83 c4 10             	add    $0x10,%esp
+}
+ 6ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6d1:	89 f0                	mov    %esi,%eax
+ 6d3:	5b                   	pop    %ebx
+ 6d4:	5e                   	pop    %esi
+ 6d5:	5f                   	pop    %edi
+ 6d6:	5d                   	pop    %ebp
+ 6d7:	c3                   	ret
+ 6d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6df:	90                   	nop
+    return -1;
+ 6e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 6e5:	eb e7                	jmp    6ce <stat+0x7e>
+ 6e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ee:	66 90                	xchg   %ax,%ax
+
+000006f0 <atoi>:
+{
+ 6f0:	55                   	push   %ebp
+ 6f1:	89 e5                	mov    %esp,%ebp
+ 6f3:	53                   	push   %ebx
+ 6f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 6f7:	0f be 02             	movsbl (%edx),%eax
+ 6fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 6fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 700:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 705:	77 1e                	ja     725 <atoi+0x35>
+ 707:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 710:	83 c2 01             	add    $0x1,%edx
+ 713:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 716:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 71a:	0f be 02             	movsbl (%edx),%eax
+ 71d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 720:	80 fb 09             	cmp    $0x9,%bl
+ 723:	76 eb                	jbe    710 <atoi+0x20>
+}
+ 725:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 728:	89 c8                	mov    %ecx,%eax
+ 72a:	c9                   	leave
+ 72b:	c3                   	ret
+ 72c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000730 <memmove>:
+{
+ 730:	55                   	push   %ebp
+ 731:	89 e5                	mov    %esp,%ebp
+ 733:	57                   	push   %edi
+ 734:	56                   	push   %esi
+ 735:	8b 45 10             	mov    0x10(%ebp),%eax
+ 738:	8b 55 08             	mov    0x8(%ebp),%edx
+ 73b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 73e:	85 c0                	test   %eax,%eax
+ 740:	7e 13                	jle    755 <memmove+0x25>
+ 742:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 744:	89 d7                	mov    %edx,%edi
+ 746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 750:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 751:	39 f8                	cmp    %edi,%eax
+ 753:	75 fb                	jne    750 <memmove+0x20>
+  return vdst;
+}
+ 755:	5e                   	pop    %esi
+ 756:	89 d0                	mov    %edx,%eax
+ 758:	5f                   	pop    %edi
+ 759:	5d                   	pop    %ebp
+ 75a:	c3                   	ret
+
+0000075b <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+ 75b:	83 3d 3c 14 00 00 00 	cmpl   $0x0,0x143c
+  jle 1f
+ 762:	7e 0a                	jle    76e <syscallentry+0x13>
+  movl %esp, %ecx
+ 764:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 766:	ba 6d 07 00 00       	mov    $0x76d,%edx
+  sysenter
+ 76b:	0f 34                	sysenter
+2:
+  ret
+ 76d:	c3                   	ret
+1:
+  jl 3f
+ 76e:	7c 27                	jl     797 <syscallentry+0x3c>
+  pushal
+ 770:	60                   	pusha
+  movl $1, %eax
+ 771:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 776:	0f a2                	cpuid
+  movl $-1, sysentermode
+ 778:	c7 05 3c 14 00 00 ff 	movl   $0xffffffff,0x143c
+ 77f:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 782:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+ 788:	74 0a                	je     794 <syscallentry+0x39>
+  movl $1, sysentermode
+ 78a:	c7 05 3c 14 00 00 01 	movl   $0x1,0x143c
+ 791:	00 00 00 
+4:
+  popal
+ 794:	61                   	popa
+  jmp syscallentry
+ 795:	eb c4                	jmp    75b <syscallentry>
+3:
+  int $T_SYSCALL
+ 797:	cd 40                	int    $0x40
+  ret
+ 799:	c3                   	ret
+
+0000079a <_fork>:
+
+SYSCALLAS(_fork, fork)
+ 79a:	b8 01 00 00 00       	mov    $0x1,%eax
+ 79f:	eb ba                	jmp    75b <syscallentry>
+
+000007a1 <_exit>:
+SYSCALLAS(_exit, exit)
+ 7a1:	b8 02 00 00 00       	mov    $0x2,%eax
+ 7a6:	eb b3                	jmp    75b <syscallentry>
+
+000007a8 <wait>:
+SYSCALL(wait)
+ 7a8:	b8 03 00 00 00       	mov    $0x3,%eax
+ 7ad:	eb ac                	jmp    75b <syscallentry>
+
+000007af <pipe>:
+SYSCALL(pipe)
+ 7af:	b8 04 00 00 00       	mov    $0x4,%eax
+ 7b4:	eb a5                	jmp    75b <syscallentry>
+
+000007b6 <read>:
+SYSCALL(read)
+ 7b6:	b8 05 00 00 00       	mov    $0x5,%eax
+ 7bb:	eb 9e                	jmp    75b <syscallentry>
+
+000007bd <write>:
+SYSCALL(write)
+ 7bd:	b8 10 00 00 00       	mov    $0x10,%eax
+ 7c2:	eb 97                	jmp    75b <syscallentry>
+
+000007c4 <_close>:
+SYSCALLAS(_close, close)
+ 7c4:	b8 15 00 00 00       	mov    $0x15,%eax
+ 7c9:	eb 90                	jmp    75b <syscallentry>
+
+000007cb <kill>:
+SYSCALL(kill)
+ 7cb:	b8 06 00 00 00       	mov    $0x6,%eax
+ 7d0:	eb 89                	jmp    75b <syscallentry>
+
+000007d2 <_exec>:
+SYSCALLAS(_exec, exec)
+ 7d2:	b8 07 00 00 00       	mov    $0x7,%eax
+ 7d7:	eb 82                	jmp    75b <syscallentry>
+
+000007d9 <open>:
+SYSCALL(open)
+ 7d9:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 7de:	e9 78 ff ff ff       	jmp    75b <syscallentry>
+
+000007e3 <mknod>:
+SYSCALL(mknod)
+ 7e3:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7e8:	e9 6e ff ff ff       	jmp    75b <syscallentry>
+
+000007ed <unlink>:
+SYSCALL(unlink)
+ 7ed:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7f2:	e9 64 ff ff ff       	jmp    75b <syscallentry>
+
+000007f7 <fstat>:
+SYSCALL(fstat)
+ 7f7:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7fc:	e9 5a ff ff ff       	jmp    75b <syscallentry>
+
+00000801 <link>:
+SYSCALL(link)
+ 801:	b8 13 00 00 00       	mov    $0x13,%eax
+ 806:	e9 50 ff ff ff       	jmp    75b <syscallentry>
+
+0000080b <mkdir>:
+SYSCALL(mkdir)
+ 80b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 810:	e9 46 ff ff ff       	jmp    75b <syscallentry>
+
+00000815 <chdir>:
+SYSCALL(chdir)
+ 815:	b8 09 00 00 00       	mov    $0x9,%eax
+ 81a:	e9 3c ff ff ff       	jmp    75b <syscallentry>
+
+0000081f <dup>:
+SYSCALL(dup)
+ 81f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 824:	e9 32 ff ff ff       	jmp    75b <syscallentry>
+
+00000829 <getpid>:
+SYSCALL(getpid)
+ 829:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 82e:	e9 28 ff ff ff       	jmp    75b <syscallentry>
+
+00000833 <sbrk>:
+SYSCALL(sbrk)
+ 833:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 838:	e9 1e ff ff ff       	jmp    75b <syscallentry>
+
+0000083d <sleep>:
+SYSCALL(sleep)
+ 83d:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 842:	e9 14 ff ff ff       	jmp    75b <syscallentry>
+
+00000847 <uptime>:
+SYSCALL(uptime)
+ 847:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 84c:	e9 0a ff ff ff       	jmp    75b <syscallentry>
+
+00000851 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+ 851:	b8 16 00 00 00       	mov    $0x16,%eax
+ 856:	e9 00 ff ff ff       	jmp    75b <syscallentry>
+
+0000085b <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+ 85b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 860:	e9 f6 fe ff ff       	jmp    75b <syscallentry>
+
+00000865 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+ 865:	b8 18 00 00 00       	mov    $0x18,%eax
+ 86a:	e9 ec fe ff ff       	jmp    75b <syscallentry>
+
+0000086f <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+ 86f:	b8 19 00 00 00       	mov    $0x19,%eax
+ 874:	e9 e2 fe ff ff       	jmp    75b <syscallentry>
+
+00000879 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+ 879:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 87e:	e9 d8 fe ff ff       	jmp    75b <syscallentry>
+
+00000883 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+ 883:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 888:	e9 ce fe ff ff       	jmp    75b <syscallentry>
+
+0000088d <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+ 88d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 892:	e9 c4 fe ff ff       	jmp    75b <syscallentry>
+
+00000897 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+ 897:	b8 20 00 00 00       	mov    $0x20,%eax
+ 89c:	e9 ba fe ff ff       	jmp    75b <syscallentry>
+
+000008a1 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+ 8a1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 8a6:	e9 b0 fe ff ff       	jmp    75b <syscallentry>
+
+000008ab <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+ 8ab:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 8b0:	e9 a6 fe ff ff       	jmp    75b <syscallentry>
+
+000008b5 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+ 8b5:	b8 21 00 00 00       	mov    $0x21,%eax
+ 8ba:	e9 9c fe ff ff       	jmp    75b <syscallentry>
+
+000008bf <yield>:
+SYSCALL(yield) // yield the CPU to another process
+ 8bf:	b8 22 00 00 00       	mov    $0x22,%eax
+ 8c4:	e9 92 fe ff ff       	jmp    75b <syscallentry>
+
+000008c9 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+ 8c9:	b8 23 00 00 00       	mov    $0x23,%eax
+ 8ce:	e9 88 fe ff ff       	jmp    75b <syscallentry>
+
+000008d3 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+ 8d3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 8d8:	e9 7e fe ff ff       	jmp    75b <syscallentry>
+
+000008dd <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+ 8dd:	b8 25 00 00 00       	mov    $0x25,%eax
+ 8e2:	e9 74 fe ff ff       	jmp    75b <syscallentry>
+
+000008e7 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+ 8e7:	b8 26 00 00 00       	mov    $0x26,%eax
+ 8ec:	e9 6a fe ff ff       	jmp    75b <syscallentry>
+
+000008f1 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+ 8f1:	b8 27 00 00 00       	mov    $0x27,%eax
+ 8f6:	e9 60 fe ff ff       	jmp    75b <syscallentry>
+
+000008fb <mmap>:
+SYSCALL(mmap) // map a file into memory
+ 8fb:	b8 28 00 00 00       	mov    $0x28,%eax
+ 900:	e9 56 fe ff ff       	jmp    75b <syscallentry>
+
+00000905 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+ 905:	b8 29 00 00 00       	mov    $0x29,%eax
+ 90a:	e9 4c fe ff ff       	jmp    75b <syscallentry>
+
+0000090f <readv>:
+SYSCALL(readv) // read into several buffers
+ 90f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 914:	e9 42 fe ff ff       	jmp    75b <syscallentry>
+
+00000919 <writev>:
+SYSCALL(writev) // write from several buffers
+ 919:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 91e:	e9 38 fe ff ff       	jmp    75b <syscallentry>
+
+00000923 <pread>:
+SYSCALL(pread) // read at an offset
+ 923:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 928:	e9 2e fe ff ff       	jmp    75b <syscallentry>
+
+0000092d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+ 92d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 932:	e9 24 fe ff ff       	jmp    75b <syscallentry>
+
+00000937 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+ 937:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 93c:	e9 1a fe ff ff       	jmp    75b <syscallentry>
+
+00000941 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+ 941:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 946:	e9 10 fe ff ff       	jmp    75b <syscallentry>
+
+0000094b <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+ 94b:	b8 30 00 00 00       	mov    $0x30,%eax
+ 950:	e9 06 fe ff ff       	jmp    75b <syscallentry>
+
+00000955 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+ 955:	b8 31 00 00 00       	mov    $0x31,%eax
+ 95a:	e9 fc fd ff ff       	jmp    75b <syscallentry>
+
+0000095f <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+ 95f:	b8 32 00 00 00       	mov    $0x32,%eax
+ 964:	e9 f2 fd ff ff       	jmp    75b <syscallentry>
+
+00000969 <profread>:
+SYSCALL(profread) // drain profiler samples
+ 969:	b8 33 00 00 00       	mov    $0x33,%eax
+ 96e:	e9 e8 fd ff ff       	jmp    75b <syscallentry>
+
+00000973 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+ 973:	b8 34 00 00 00       	mov    $0x34,%eax
+ 978:	e9 de fd ff ff       	jmp    75b <syscallentry>
+
+0000097d <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+ 97d:	b8 35 00 00 00       	mov    $0x35,%eax
+ 982:	e9 d4 fd ff ff       	jmp    75b <syscallentry>
+
+00000987 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+ 987:	b8 36 00 00 00       	mov    $0x36,%eax
+ 98c:	e9 ca fd ff ff       	jmp    75b <syscallentry>
+
+00000991 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+ 991:	b8 37 00 00 00       	mov    $0x37,%eax
+ 996:	e9 c0 fd ff ff       	jmp    75b <syscallentry>
+ 99b:	66 90                	xchg   %ax,%ax
+ 99d:	66 90                	xchg   %ax,%ax
+ 99f:	90                   	nop
+
+000009a0 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 9a0:	55                   	push   %ebp
+ 9a1:	89 e5                	mov    %esp,%ebp
+ 9a3:	57                   	push   %edi
+ 9a4:	56                   	push   %esi
+ 9a5:	53                   	push   %ebx
+ 9a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 9a8:	89 d1                	mov    %edx,%ecx
+{
+ 9aa:	83 ec 3c             	sub    $0x3c,%esp
+ 9ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 9b0:	85 d2                	test   %edx,%edx
+ 9b2:	0f 89 80 00 00 00    	jns    a38 <printint+0x98>
+ 9b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 9bc:	74 7a                	je     a38 <printint+0x98>
+    x = -xx;
+ 9be:	f7 d9                	neg    %ecx
+    neg = 1;
+ 9c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 9c5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 9c8:	31 f6                	xor    %esi,%esi
+ 9ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 9d0:	89 c8                	mov    %ecx,%eax
+ 9d2:	31 d2                	xor    %edx,%edx
+ 9d4:	89 f7                	mov    %esi,%edi
+ 9d6:	f7 f3                	div    %ebx
+ 9d8:	8d 76 01             	lea    0x1(%esi),%esi
+ 9db:	0f b6 92 88 0f 00 00 	movzbl 0xf88(%edx),%edx
+ 9e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 9e6:	89 ca                	mov    %ecx,%edx
+ 9e8:	89 c1                	mov    %eax,%ecx
+ 9ea:	39 da                	cmp    %ebx,%edx
+ 9ec:	73 e2                	jae    9d0 <printint+0x30>
+  if(neg)
+ 9ee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 9f1:	85 c0                	test   %eax,%eax
+ 9f3:	74 07                	je     9fc <printint+0x5c>
+    buf[i++] = '-';
+ 9f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 9fa:	89 f7                	mov    %esi,%edi
+ 9fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 9ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ a02:	01 df                	add    %ebx,%edi
+ a04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ a08:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+ a0b:	83 ec 04             	sub    $0x4,%esp
+ a0e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ a11:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ a14:	6a 01                	push   $0x1
+ a16:	50                   	push   %eax
+ a17:	56                   	push   %esi
+ a18:	e8 e3 f6 ff ff       	call   100 <bufwrite>
+  while(--i >= 0)
+ a1d:	89 f8                	mov    %edi,%eax
+ a1f:	83 c4 10             	add    $0x10,%esp
+ a22:	83 ef 01             	sub    $0x1,%edi
+ a25:	39 d8                	cmp    %ebx,%eax
+ a27:	75 df                	jne    a08 <printint+0x68>
+}
+ a29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a2c:	5b                   	pop    %ebx
+ a2d:	5e                   	pop    %esi
+ a2e:	5f                   	pop    %edi
+ a2f:	5d                   	pop    %ebp
+ a30:	c3                   	ret
+ a31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ a38:	31 c0                	xor    %eax,%eax
+ a3a:	eb 89                	jmp    9c5 <printint+0x25>
+ a3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a40 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ a40:	55                   	push   %ebp
+ a41:	89 e5                	mov    %esp,%ebp
+ a43:	57                   	push   %edi
+ a44:	56                   	push   %esi
+ a45:	53                   	push   %ebx
+ a46:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ a49:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a4c:	0f b6 18             	movzbl (%eax),%ebx
+ a4f:	84 db                	test   %bl,%bl
+ a51:	74 6c                	je     abf <printf+0x7f>
+ a53:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+ a56:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ a59:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ a5b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ a5e:	eb 26                	jmp    a86 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ a60:	83 f8 25             	cmp    $0x25,%eax
+ a63:	74 4b                	je     ab0 <printf+0x70>
+  bufwrite(fd, &c, 1);
+ a65:	83 ec 04             	sub    $0x4,%esp
+ a68:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ a6b:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ a6e:	6a 01                	push   $0x1
+ a70:	50                   	push   %eax
+ a71:	ff 75 08             	push   0x8(%ebp)
+ a74:	e8 87 f6 ff ff       	call   100 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+ a79:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ a7c:	0f b6 1f             	movzbl (%edi),%ebx
+ a7f:	83 c7 01             	add    $0x1,%edi
+ a82:	84 db                	test   %bl,%bl
+ a84:	74 39                	je     abf <printf+0x7f>
+    c = fmt[i] & 0xff;
+ a86:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ a89:	85 f6                	test   %esi,%esi
+ a8b:	74 d3                	je     a60 <printf+0x20>
+      }
+    } else if(state == '%'){
+ a8d:	83 fe 25             	cmp    $0x25,%esi
+ a90:	75 ea                	jne    a7c <printf+0x3c>
+      if(c == 'd'){
+ a92:	83 f8 25             	cmp    $0x25,%eax
+ a95:	0f 84 d5 01 00 00    	je     c70 <printf+0x230>
+ a9b:	83 e8 63             	sub    $0x63,%eax
+ a9e:	83 f8 15             	cmp    $0x15,%eax
+ aa1:	77 45                	ja     ae8 <printf+0xa8>
+ aa3:	ff 24 85 30 0f 00 00 	jmp    *0xf30(,%eax,4)
+ aaa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+ ab0:	0f b6 1f             	movzbl (%edi),%ebx
+ ab3:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+ ab6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ abb:	84 db                	test   %bl,%bl
+ abd:	75 c7                	jne    a86 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+ abf:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+ ac3:	74 0b                	je     ad0 <printf+0x90>
+    fflush(fd);
+}
+ ac5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ac8:	5b                   	pop    %ebx
+ ac9:	5e                   	pop    %esi
+ aca:	5f                   	pop    %edi
+ acb:	5d                   	pop    %ebp
+ acc:	c3                   	ret
+ acd:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+ ad0:	83 ec 0c             	sub    $0xc,%esp
+ ad3:	6a 02                	push   $0x2
+ ad5:	e8 c6 f7 ff ff       	call   2a0 <fflush>
+ ada:	83 c4 10             	add    $0x10,%esp
+}
+ add:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ae0:	5b                   	pop    %ebx
+ ae1:	5e                   	pop    %esi
+ ae2:	5f                   	pop    %edi
+ ae3:	5d                   	pop    %ebp
+ ae4:	c3                   	ret
+ ae5:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+ ae8:	83 ec 04             	sub    $0x4,%esp
+ aeb:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ aee:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+ af2:	6a 01                	push   $0x1
+ af4:	52                   	push   %edx
+ af5:	89 55 c0             	mov    %edx,-0x40(%ebp)
+ af8:	ff 75 08             	push   0x8(%ebp)
+ afb:	e8 00 f6 ff ff       	call   100 <bufwrite>
+ b00:	83 c4 0c             	add    $0xc,%esp
+ b03:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ b06:	6a 01                	push   $0x1
+ b08:	8b 55 c0             	mov    -0x40(%ebp),%edx
+ b0b:	52                   	push   %edx
+      state = 0;
+ b0c:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+ b0e:	ff 75 08             	push   0x8(%ebp)
+ b11:	e8 ea f5 ff ff       	call   100 <bufwrite>
+        putc(fd, c);
+ b16:	83 c4 10             	add    $0x10,%esp
+ b19:	e9 5e ff ff ff       	jmp    a7c <printf+0x3c>
+ b1e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+ b20:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ b23:	83 ec 0c             	sub    $0xc,%esp
+ b26:	b9 10 00 00 00       	mov    $0x10,%ecx
+ b2b:	8b 16                	mov    (%esi),%edx
+ b2d:	6a 00                	push   $0x0
+ b2f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+ b32:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+ b35:	e8 66 fe ff ff       	call   9a0 <printint>
+        ap++;
+ b3a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ b3d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b40:	31 f6                	xor    %esi,%esi
+ b42:	e9 35 ff ff ff       	jmp    a7c <printf+0x3c>
+ b47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b4e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+ b50:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ b53:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ b55:	83 c0 04             	add    $0x4,%eax
+ b58:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+ b5b:	b8 27 0f 00 00       	mov    $0xf27,%eax
+ b60:	85 db                	test   %ebx,%ebx
+ b62:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+ b65:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+ b68:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+ b6a:	53                   	push   %ebx
+ b6b:	e8 90 f9 ff ff       	call   500 <strlen>
+ b70:	83 c4 0c             	add    $0xc,%esp
+ b73:	50                   	push   %eax
+ b74:	53                   	push   %ebx
+ b75:	ff 75 08             	push   0x8(%ebp)
+ b78:	e8 83 f5 ff ff       	call   100 <bufwrite>
+ b7d:	83 c4 10             	add    $0x10,%esp
+ b80:	e9 f7 fe ff ff       	jmp    a7c <printf+0x3c>
+ b85:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ b88:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+ b8b:	83 ec 04             	sub    $0x4,%esp
+ b8e:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+ b91:	8b 06                	mov    (%esi),%eax
+        ap++;
+ b93:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+ b96:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+ b99:	6a 01                	push   $0x1
+ b9b:	52                   	push   %edx
+ b9c:	ff 75 08             	push   0x8(%ebp)
+ b9f:	e8 5c f5 ff ff       	call   100 <bufwrite>
+        ap++;
+ ba4:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ ba7:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ baa:	31 f6                	xor    %esi,%esi
+ bac:	e9 cb fe ff ff       	jmp    a7c <printf+0x3c>
+ bb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+ bb8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ bbb:	83 ec 0c             	sub    $0xc,%esp
+ bbe:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ bc3:	8b 16                	mov    (%esi),%edx
+ bc5:	6a 01                	push   $0x1
+ bc7:	e9 63 ff ff ff       	jmp    b2f <printf+0xef>
+ bcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+ bd0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ bd3:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ bd6:	89 7d c0             	mov    %edi,-0x40(%ebp)
+ bd9:	89 55 bc             	mov    %edx,-0x44(%ebp)
+ bdc:	8b 18                	mov    (%eax),%ebx
+ bde:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+ be1:	31 c0                	xor    %eax,%eax
+ be3:	89 c7                	mov    %eax,%edi
+ be5:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+ be8:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+ bed:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+ bef:	f7 e1                	mul    %ecx
+ bf1:	c1 ea 03             	shr    $0x3,%edx
+ bf4:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ bf7:	89 d1                	mov    %edx,%ecx
+ bf9:	01 c0                	add    %eax,%eax
+ bfb:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ bfd:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+ bff:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ c01:	be 0a 00 00 00       	mov    $0xa,%esi
+ c06:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+ c08:	89 da                	mov    %ebx,%edx
+ c0a:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+ c0c:	89 fe                	mov    %edi,%esi
+ c0e:	83 c7 01             	add    $0x1,%edi
+ c11:	8d 42 30             	lea    0x30(%edx),%eax
+ c14:	89 da                	mov    %ebx,%edx
+ c16:	8d 14 92             	lea    (%edx,%edx,4),%edx
+ c19:	01 d2                	add    %edx,%edx
+ c1b:	29 d0                	sub    %edx,%eax
+ c1d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+ c21:	89 c8                	mov    %ecx,%eax
+ c23:	09 d8                	or     %ebx,%eax
+ c25:	75 c1                	jne    be8 <printf+0x1a8>
+ c27:	8b 55 bc             	mov    -0x44(%ebp),%edx
+ c2a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ c2d:	01 d6                	add    %edx,%esi
+ c2f:	89 f7                	mov    %esi,%edi
+ c31:	89 d6                	mov    %edx,%esi
+ c33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c37:	90                   	nop
+    putc(fd, buf[i]);
+ c38:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+ c3b:	83 ec 04             	sub    $0x4,%esp
+ c3e:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+ c41:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+ c44:	6a 01                	push   $0x1
+ c46:	50                   	push   %eax
+ c47:	53                   	push   %ebx
+ c48:	e8 b3 f4 ff ff       	call   100 <bufwrite>
+  while(--i >= 0)
+ c4d:	89 fa                	mov    %edi,%edx
+ c4f:	83 c4 10             	add    $0x10,%esp
+ c52:	83 ef 01             	sub    $0x1,%edi
+ c55:	39 d6                	cmp    %edx,%esi
+ c57:	75 df                	jne    c38 <printf+0x1f8>
+        ap += 2;
+ c59:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+ c5d:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+ c60:	31 f6                	xor    %esi,%esi
+ c62:	e9 15 fe ff ff       	jmp    a7c <printf+0x3c>
+ c67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c6e:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+ c70:	83 ec 04             	sub    $0x4,%esp
+ c73:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ c76:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ c79:	6a 01                	push   $0x1
+ c7b:	e9 8b fe ff ff       	jmp    b0b <printf+0xcb>
+
+00000c80 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ c80:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c81:	a1 c0 24 00 00       	mov    0x24c0,%eax
+{
+ c86:	89 e5                	mov    %esp,%ebp
+ c88:	57                   	push   %edi
+ c89:	56                   	push   %esi
+ c8a:	53                   	push   %ebx
+ c8b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ c8e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c98:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c9a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c9c:	39 ca                	cmp    %ecx,%edx
+ c9e:	73 30                	jae    cd0 <free+0x50>
+ ca0:	39 c1                	cmp    %eax,%ecx
+ ca2:	72 04                	jb     ca8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ca4:	39 c2                	cmp    %eax,%edx
+ ca6:	72 f0                	jb     c98 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ ca8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ cab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ cae:	39 f8                	cmp    %edi,%eax
+ cb0:	74 2e                	je     ce0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ cb2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ cb5:	8b 42 04             	mov    0x4(%edx),%eax
+ cb8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ cbb:	39 f1                	cmp    %esi,%ecx
+ cbd:	74 38                	je     cf7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ cbf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ cc1:	5b                   	pop    %ebx
+  freep = p;
+ cc2:	89 15 c0 24 00 00    	mov    %edx,0x24c0
+}
+ cc8:	5e                   	pop    %esi
+ cc9:	5f                   	pop    %edi
+ cca:	5d                   	pop    %ebp
+ ccb:	c3                   	ret
+ ccc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cd0:	39 c1                	cmp    %eax,%ecx
+ cd2:	72 d0                	jb     ca4 <free+0x24>
+ cd4:	eb c2                	jmp    c98 <free+0x18>
+ cd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cdd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ ce0:	03 70 04             	add    0x4(%eax),%esi
+ ce3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ce6:	8b 02                	mov    (%edx),%eax
+ ce8:	8b 00                	mov    (%eax),%eax
+ cea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ ced:	8b 42 04             	mov    0x4(%edx),%eax
+ cf0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ cf3:	39 f1                	cmp    %esi,%ecx
+ cf5:	75 c8                	jne    cbf <free+0x3f>
+    p->s.size += bp->s.size;
+ cf7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ cfa:	89 15 c0 24 00 00    	mov    %edx,0x24c0
+    p->s.size += bp->s.size;
+ d00:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ d03:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ d06:	89 0a                	mov    %ecx,(%edx)
+}
+ d08:	5b                   	pop    %ebx
+ d09:	5e                   	pop    %esi
+ d0a:	5f                   	pop    %edi
+ d0b:	5d                   	pop    %ebp
+ d0c:	c3                   	ret
+ d0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d10 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ d10:	55                   	push   %ebp
+ d11:	89 e5                	mov    %esp,%ebp
+ d13:	57                   	push   %edi
+ d14:	56                   	push   %esi
+ d15:	53                   	push   %ebx
+ d16:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d19:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ d1c:	8b 15 c0 24 00 00    	mov    0x24c0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d22:	8d 78 07             	lea    0x7(%eax),%edi
+ d25:	c1 ef 03             	shr    $0x3,%edi
+ d28:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ d2b:	85 d2                	test   %edx,%edx
+ d2d:	0f 84 8d 00 00 00    	je     dc0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d33:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d35:	8b 48 04             	mov    0x4(%eax),%ecx
+ d38:	39 f9                	cmp    %edi,%ecx
+ d3a:	73 64                	jae    da0 <malloc+0x90>
+  if(nu < 4096)
+ d3c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ d41:	39 df                	cmp    %ebx,%edi
+ d43:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ d46:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ d4d:	eb 0a                	jmp    d59 <malloc+0x49>
+ d4f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d50:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d52:	8b 48 04             	mov    0x4(%eax),%ecx
+ d55:	39 f9                	cmp    %edi,%ecx
+ d57:	73 47                	jae    da0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ d59:	89 c2                	mov    %eax,%edx
+ d5b:	39 05 c0 24 00 00    	cmp    %eax,0x24c0
+ d61:	75 ed                	jne    d50 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ d63:	83 ec 0c             	sub    $0xc,%esp
+ d66:	56                   	push   %esi
+ d67:	e8 c7 fa ff ff       	call   833 <sbrk>
+  if(p == (char*)-1)
+ d6c:	83 c4 10             	add    $0x10,%esp
+ d6f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ d72:	74 1c                	je     d90 <malloc+0x80>
+  hp->s.size = nu;
+ d74:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ d77:	83 ec 0c             	sub    $0xc,%esp
+ d7a:	83 c0 08             	add    $0x8,%eax
+ d7d:	50                   	push   %eax
+ d7e:	e8 fd fe ff ff       	call   c80 <free>
+  return freep;
+ d83:	8b 15 c0 24 00 00    	mov    0x24c0,%edx
+      if((p = morecore(nunits)) == 0)
+ d89:	83 c4 10             	add    $0x10,%esp
+ d8c:	85 d2                	test   %edx,%edx
+ d8e:	75 c0                	jne    d50 <malloc+0x40>
+        return 0;
+  }
+}
+ d90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ d93:	31 c0                	xor    %eax,%eax
+}
+ d95:	5b                   	pop    %ebx
+ d96:	5e                   	pop    %esi
+ d97:	5f                   	pop    %edi
+ d98:	5d                   	pop    %ebp
+ d99:	c3                   	ret
+ d9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ da0:	39 cf                	cmp    %ecx,%edi
+ da2:	74 4c                	je     df0 <malloc+0xe0>
+        p->s.size -= nunits;
+ da4:	29 f9                	sub    %edi,%ecx
+ da6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ da9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ dac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ daf:	89 15 c0 24 00 00    	mov    %edx,0x24c0
+}
+ db5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ db8:	83 c0 08             	add    $0x8,%eax
+}
+ dbb:	5b                   	pop    %ebx
+ dbc:	5e                   	pop    %esi
+ dbd:	5f                   	pop    %edi
+ dbe:	5d                   	pop    %ebp
+ dbf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ dc0:	c7 05 c0 24 00 00 c4 	movl   $0x24c4,0x24c0
+ dc7:	24 00 00 
+    base.s.size = 0;
+ dca:	b8 c4 24 00 00       	mov    $0x24c4,%eax
+    base.s.ptr = freep = prevp = &base;
+ dcf:	c7 05 c4 24 00 00 c4 	movl   $0x24c4,0x24c4
+ dd6:	24 00 00 
+    base.s.size = 0;
+ dd9:	c7 05 c8 24 00 00 00 	movl   $0x0,0x24c8
+ de0:	00 00 00 
+    if(p->s.size >= nunits){
+ de3:	e9 54 ff ff ff       	jmp    d3c <malloc+0x2c>
+ de8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ def:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ df0:	8b 08                	mov    (%eax),%ecx
+ df2:	89 0a                	mov    %ecx,(%edx)
+ df4:	eb b9                	jmp    daf <malloc+0x9f>
+ df6:	66 90                	xchg   %ax,%ax
+ df8:	66 90                	xchg   %ax,%ax
+ dfa:	66 90                	xchg   %ax,%ax
+ dfc:	66 90                	xchg   %ax,%ax
+ dfe:	66 90                	xchg   %ax,%ax
+
+00000e00 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+ e00:	55                   	push   %ebp
+ e01:	89 e5                	mov    %esp,%ebp
+ e03:	57                   	push   %edi
+ e04:	56                   	push   %esi
+ e05:	be 01 00 00 00       	mov    $0x1,%esi
+ e0a:	53                   	push   %ebx
+ e0b:	83 ec 28             	sub    $0x28,%esp
+ e0e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ e11:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ e14:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+ e17:	68 00 98 00 00       	push   $0x9800
+ e1c:	e8 ef fe ff ff       	call   d10 <malloc>
+ e21:	83 c4 10             	add    $0x10,%esp
+ e24:	89 c7                	mov    %eax,%edi
+ e26:	85 c0                	test   %eax,%eax
+ e28:	74 62                	je     e8c <waitpoll+0x8c>
+ e2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+ e30:	83 ec 0c             	sub    $0xc,%esp
+ e33:	6a 01                	push   $0x1
+ e35:	e8 03 fa ff ff       	call   83d <sleep>
+    fn();
+ e3a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ e3d:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+ e3f:	58                   	pop    %eax
+ e40:	5a                   	pop    %edx
+ e41:	68 00 02 00 00       	push   $0x200
+ e46:	57                   	push   %edi
+ e47:	e8 eb fa ff ff       	call   937 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+ e4c:	83 c4 10             	add    $0x10,%esp
+ e4f:	85 c0                	test   %eax,%eax
+ e51:	7e 2d                	jle    e80 <waitpoll+0x80>
+ e53:	6b c0 4c             	imul   $0x4c,%eax,%eax
+ e56:	89 fa                	mov    %edi,%edx
+    alive = 0;
+ e58:	31 c9                	xor    %ecx,%ecx
+ e5a:	01 f8                	add    %edi,%eax
+ e5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+ e60:	3b 1a                	cmp    (%edx),%ebx
+ e62:	75 07                	jne    e6b <waitpoll+0x6b>
+        alive = 1;
+ e64:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+ e68:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+ e6b:	83 c2 4c             	add    $0x4c,%edx
+ e6e:	39 d0                	cmp    %edx,%eax
+ e70:	75 ee                	jne    e60 <waitpoll+0x60>
+  } while(alive);
+ e72:	85 c9                	test   %ecx,%ecx
+ e74:	75 ba                	jne    e30 <waitpoll+0x30>
+ e76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e7d:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+ e80:	83 ec 0c             	sub    $0xc,%esp
+ e83:	57                   	push   %edi
+ e84:	e8 f7 fd ff ff       	call   c80 <free>
+  wait();
+ e89:	83 c4 10             	add    $0x10,%esp
+}
+ e8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e8f:	5b                   	pop    %ebx
+ e90:	5e                   	pop    %esi
+ e91:	5f                   	pop    %edi
+ e92:	5d                   	pop    %ebp
+  wait();
+ e93:	e9 10 f9 ff ff       	jmp    7a8 <wait>
+ e98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e9f:	90                   	nop
+
+00000ea0 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+ ea0:	55                   	push   %ebp
+ ea1:	89 e5                	mov    %esp,%ebp
+ ea3:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+ ea6:	c7 45 f0 99 0f 00 00 	movl   $0xf99,-0x10(%ebp)
+ ead:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+ eb4:	e8 87 f4 ff ff       	call   340 <fork>
+ eb9:	85 c0                	test   %eax,%eax
+ ebb:	78 09                	js     ec6 <runps+0x26>
+    return -1;
+  if(pid == 0){
+ ebd:	74 0e                	je     ecd <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+ ebf:	e8 e4 f8 ff ff       	call   7a8 <wait>
+}
+ ec4:	c9                   	leave
+ ec5:	c3                   	ret
+ ec6:	c9                   	leave
+    return -1;
+ ec7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ ecc:	c3                   	ret
+    exec("ps", argv);
+ ecd:	50                   	push   %eax
+ ece:	50                   	push   %eax
+ ecf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ ed2:	50                   	push   %eax
+ ed3:	68 99 0f 00 00       	push   $0xf99
+ ed8:	e8 c3 f4 ff ff       	call   3a0 <exec>
+    printf(2, "exec ps failed\n");
+ edd:	5a                   	pop    %edx
+ ede:	59                   	pop    %ecx
+ edf:	68 9c 0f 00 00       	push   $0xf9c
+ ee4:	6a 02                	push   $0x2
+ ee6:	e8 55 fb ff ff       	call   a40 <printf>
+    exit();
+ eeb:	e8 a0 f4 ff ff       	call   390 <exit>
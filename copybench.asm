@@ -0,0 +1,2312 @@
+
+_copybench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+         name, kb, b.commits - a.commits, t);
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	53                   	push   %ebx
+       e:	bb 00 01 00 00       	mov    $0x100,%ebx
+      13:	51                   	push   %ecx
+  int kb;
+
+  kb = argc > 1 ? atoi(argv[1]) : 256;
+      14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+      17:	8b 41 04             	mov    0x4(%ecx),%eax
+  kb = argc > 1 ? atoi(argv[1]) : 256;
+      1a:	7e 10                	jle    2c <main+0x2c>
+      1c:	83 ec 0c             	sub    $0xc,%esp
+      1f:	ff 70 04             	push   0x4(%eax)
+      22:	e8 59 09 00 00       	call   980 <atoi>
+      27:	83 c4 10             	add    $0x10,%esp
+      2a:	89 c3                	mov    %eax,%ebx
+  makesrc(kb);
+      2c:	83 ec 0c             	sub    $0xc,%esp
+      2f:	53                   	push   %ebx
+      30:	e8 6b 01 00 00       	call   1a0 <makesrc>
+
+  run("read/write", readwrite, kb);
+      35:	83 c4 0c             	add    $0xc,%esp
+      38:	53                   	push   %ebx
+      39:	68 90 00 00 00       	push   $0x90
+      3e:	68 f2 11 00 00       	push   $0x11f2
+      43:	e8 d8 02 00 00       	call   320 <run>
+  run("copy_file_range", copyrange, kb);
+      48:	83 c4 0c             	add    $0xc,%esp
+      4b:	53                   	push   %ebx
+      4c:	68 10 01 00 00       	push   $0x110
+      51:	68 fd 11 00 00       	push   $0x11fd
+      56:	e8 c5 02 00 00       	call   320 <run>
+  run("copy_file", copypath, kb);
+      5b:	83 c4 0c             	add    $0xc,%esp
+      5e:	53                   	push   %ebx
+      5f:	68 80 01 00 00       	push   $0x180
+      64:	68 0d 12 00 00       	push   $0x120d
+      69:	e8 b2 02 00 00       	call   320 <run>
+
+  unlink(SRC);
+      6e:	c7 04 24 80 11 00 00 	movl   $0x1180,(%esp)
+      75:	e8 03 0a 00 00       	call   a7d <unlink>
+  unlink(DST);
+      7a:	c7 04 24 8e 11 00 00 	movl   $0x118e,(%esp)
+      81:	e8 f7 09 00 00       	call   a7d <unlink>
+  exit();
+      86:	e8 95 05 00 00       	call   620 <exit>
+      8b:	66 90                	xchg   %ax,%ax
+      8d:	66 90                	xchg   %ax,%ax
+      8f:	90                   	nop
+
+00000090 <readwrite>:
+{
+      90:	55                   	push   %ebp
+      91:	89 e5                	mov    %esp,%ebp
+      93:	56                   	push   %esi
+      94:	53                   	push   %ebx
+  in = open(SRC, O_RDONLY);
+      95:	83 ec 08             	sub    $0x8,%esp
+      98:	6a 00                	push   $0x0
+      9a:	68 80 11 00 00       	push   $0x1180
+      9f:	e8 c5 09 00 00       	call   a69 <open>
+      a4:	89 c3                	mov    %eax,%ebx
+  out = open(DST, O_CREATE|O_RDWR);
+      a6:	58                   	pop    %eax
+      a7:	5a                   	pop    %edx
+      a8:	68 02 02 00 00       	push   $0x202
+      ad:	68 8e 11 00 00       	push   $0x118e
+      b2:	e8 b2 09 00 00       	call   a69 <open>
+  while((n = read(in, buf, sizeof(buf))) > 0)
+      b7:	83 c4 10             	add    $0x10,%esp
+  out = open(DST, O_CREATE|O_RDWR);
+      ba:	89 c6                	mov    %eax,%esi
+  while((n = read(in, buf, sizeof(buf))) > 0)
+      bc:	eb 14                	jmp    d2 <readwrite+0x42>
+      be:	66 90                	xchg   %ax,%ax
+    write(out, buf, n);
+      c0:	83 ec 04             	sub    $0x4,%esp
+      c3:	50                   	push   %eax
+      c4:	68 40 18 00 00       	push   $0x1840
+      c9:	56                   	push   %esi
+      ca:	e8 7e 09 00 00       	call   a4d <write>
+      cf:	83 c4 10             	add    $0x10,%esp
+  while((n = read(in, buf, sizeof(buf))) > 0)
+      d2:	83 ec 04             	sub    $0x4,%esp
+      d5:	68 00 02 00 00       	push   $0x200
+      da:	68 40 18 00 00       	push   $0x1840
+      df:	53                   	push   %ebx
+      e0:	e8 61 09 00 00       	call   a46 <read>
+      e5:	83 c4 10             	add    $0x10,%esp
+      e8:	85 c0                	test   %eax,%eax
+      ea:	7f d4                	jg     c0 <readwrite+0x30>
+  close(in);
+      ec:	83 ec 0c             	sub    $0xc,%esp
+      ef:	53                   	push   %ebx
+      f0:	e8 9b 05 00 00       	call   690 <close>
+  close(out);
+      f5:	89 34 24             	mov    %esi,(%esp)
+      f8:	e8 93 05 00 00       	call   690 <close>
+}
+      fd:	83 c4 10             	add    $0x10,%esp
+     100:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     103:	5b                   	pop    %ebx
+     104:	5e                   	pop    %esi
+     105:	5d                   	pop    %ebp
+     106:	c3                   	ret
+     107:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     10e:	66 90                	xchg   %ax,%ax
+
+00000110 <copyrange>:
+{
+     110:	55                   	push   %ebp
+     111:	89 e5                	mov    %esp,%ebp
+     113:	56                   	push   %esi
+     114:	53                   	push   %ebx
+  in = open(SRC, O_RDONLY);
+     115:	83 ec 08             	sub    $0x8,%esp
+     118:	6a 00                	push   $0x0
+     11a:	68 80 11 00 00       	push   $0x1180
+     11f:	e8 45 09 00 00       	call   a69 <open>
+     124:	89 c6                	mov    %eax,%esi
+  out = open(DST, O_CREATE|O_RDWR);
+     126:	58                   	pop    %eax
+     127:	5a                   	pop    %edx
+     128:	68 02 02 00 00       	push   $0x202
+     12d:	68 8e 11 00 00       	push   $0x118e
+     132:	e8 32 09 00 00       	call   a69 <open>
+  while(copy_file_range(in, out, 64*1024) > 0)
+     137:	83 c4 10             	add    $0x10,%esp
+  out = open(DST, O_CREATE|O_RDWR);
+     13a:	89 c3                	mov    %eax,%ebx
+  while(copy_file_range(in, out, 64*1024) > 0)
+     13c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     140:	83 ec 04             	sub    $0x4,%esp
+     143:	68 00 00 01 00       	push   $0x10000
+     148:	53                   	push   %ebx
+     149:	56                   	push   %esi
+     14a:	e8 28 0a 00 00       	call   b77 <copy_file_range>
+     14f:	83 c4 10             	add    $0x10,%esp
+     152:	85 c0                	test   %eax,%eax
+     154:	7f ea                	jg     140 <copyrange+0x30>
+  close(in);
+     156:	83 ec 0c             	sub    $0xc,%esp
+     159:	56                   	push   %esi
+     15a:	e8 31 05 00 00       	call   690 <close>
+  close(out);
+     15f:	89 1c 24             	mov    %ebx,(%esp)
+     162:	e8 29 05 00 00       	call   690 <close>
+}
+     167:	83 c4 10             	add    $0x10,%esp
+     16a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     16d:	5b                   	pop    %ebx
+     16e:	5e                   	pop    %esi
+     16f:	5d                   	pop    %ebp
+     170:	c3                   	ret
+     171:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     178:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     17f:	90                   	nop
+
+00000180 <copypath>:
+{
+     180:	55                   	push   %ebp
+     181:	89 e5                	mov    %esp,%ebp
+     183:	83 ec 10             	sub    $0x10,%esp
+  copy_file(SRC, DST);
+     186:	68 8e 11 00 00       	push   $0x118e
+     18b:	68 80 11 00 00       	push   $0x1180
+     190:	e8 56 09 00 00       	call   aeb <copy_file>
+}
+     195:	83 c4 10             	add    $0x10,%esp
+     198:	c9                   	leave
+     199:	c3                   	ret
+     19a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000001a0 <makesrc>:
+{
+     1a0:	55                   	push   %ebp
+     1a1:	89 e5                	mov    %esp,%ebp
+     1a3:	57                   	push   %edi
+     1a4:	56                   	push   %esi
+     1a5:	53                   	push   %ebx
+     1a6:	83 ec 24             	sub    $0x24,%esp
+     1a9:	8b 55 08             	mov    0x8(%ebp),%edx
+     1ac:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  if((fd = open(SRC, O_CREATE|O_RDWR)) < 0){
+     1af:	68 02 02 00 00       	push   $0x202
+     1b4:	68 80 11 00 00       	push   $0x1180
+     1b9:	e8 ab 08 00 00       	call   a69 <open>
+     1be:	83 c4 10             	add    $0x10,%esp
+     1c1:	85 c0                	test   %eax,%eax
+     1c3:	78 66                	js     22b <makesrc+0x8b>
+  for(i = 0; i < 2*kb; i++){
+     1c5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     1c8:	89 c3                	mov    %eax,%ebx
+     1ca:	31 f6                	xor    %esi,%esi
+     1cc:	8d 3c 12             	lea    (%edx,%edx,1),%edi
+     1cf:	85 d2                	test   %edx,%edx
+     1d1:	7e 49                	jle    21c <makesrc+0x7c>
+     1d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1d7:	90                   	nop
+    memset(buf, 'a' + i % 26, sizeof(buf));
+     1d8:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+     1dd:	83 ec 04             	sub    $0x4,%esp
+     1e0:	f7 e6                	mul    %esi
+     1e2:	89 f0                	mov    %esi,%eax
+     1e4:	68 00 02 00 00       	push   $0x200
+  for(i = 0; i < 2*kb; i++){
+     1e9:	83 c6 01             	add    $0x1,%esi
+    memset(buf, 'a' + i % 26, sizeof(buf));
+     1ec:	c1 ea 03             	shr    $0x3,%edx
+     1ef:	6b d2 1a             	imul   $0x1a,%edx,%edx
+     1f2:	29 d0                	sub    %edx,%eax
+     1f4:	83 c0 61             	add    $0x61,%eax
+     1f7:	50                   	push   %eax
+     1f8:	68 40 18 00 00       	push   $0x1840
+     1fd:	e8 be 05 00 00       	call   7c0 <memset>
+    write(fd, buf, sizeof(buf));
+     202:	83 c4 0c             	add    $0xc,%esp
+     205:	68 00 02 00 00       	push   $0x200
+     20a:	68 40 18 00 00       	push   $0x1840
+     20f:	53                   	push   %ebx
+     210:	e8 38 08 00 00       	call   a4d <write>
+  for(i = 0; i < 2*kb; i++){
+     215:	83 c4 10             	add    $0x10,%esp
+     218:	39 fe                	cmp    %edi,%esi
+     21a:	7c bc                	jl     1d8 <makesrc+0x38>
+  close(fd);
+     21c:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     21f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     222:	5b                   	pop    %ebx
+     223:	5e                   	pop    %esi
+     224:	5f                   	pop    %edi
+     225:	5d                   	pop    %ebp
+  close(fd);
+     226:	e9 65 04 00 00       	jmp    690 <close>
+    printf(2, "copybench: cannot create %s\n", SRC);
+     22b:	50                   	push   %eax
+     22c:	68 80 11 00 00       	push   $0x1180
+     231:	68 9c 11 00 00       	push   $0x119c
+     236:	6a 02                	push   $0x2
+     238:	e8 93 0a 00 00       	call   cd0 <printf>
+    exit();
+     23d:	e8 de 03 00 00       	call   620 <exit>
+     242:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     249:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000250 <verify>:
+{
+     250:	55                   	push   %ebp
+     251:	89 e5                	mov    %esp,%ebp
+     253:	57                   	push   %edi
+     254:	56                   	push   %esi
+     255:	53                   	push   %ebx
+     256:	83 ec 24             	sub    $0x24,%esp
+     259:	8b 55 08             	mov    0x8(%ebp),%edx
+     25c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  if((fd = open(DST, O_RDONLY)) < 0){
+     25f:	6a 00                	push   $0x0
+     261:	68 8e 11 00 00       	push   $0x118e
+     266:	e8 fe 07 00 00       	call   a69 <open>
+     26b:	83 c4 10             	add    $0x10,%esp
+     26e:	85 c0                	test   %eax,%eax
+     270:	0f 88 84 00 00 00    	js     2fa <verify+0xaa>
+  for(i = 0; i < 2*kb; i++){
+     276:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     279:	89 c3                	mov    %eax,%ebx
+     27b:	31 f6                	xor    %esi,%esi
+     27d:	8d 3c 12             	lea    (%edx,%edx,1),%edi
+     280:	85 d2                	test   %edx,%edx
+     282:	7e 52                	jle    2d6 <verify+0x86>
+     284:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(read(fd, buf, sizeof(buf)) != sizeof(buf) ||
+     288:	83 ec 04             	sub    $0x4,%esp
+     28b:	68 00 02 00 00       	push   $0x200
+     290:	68 40 18 00 00       	push   $0x1840
+     295:	53                   	push   %ebx
+     296:	e8 ab 07 00 00       	call   a46 <read>
+     29b:	83 c4 10             	add    $0x10,%esp
+     29e:	3d 00 02 00 00       	cmp    $0x200,%eax
+     2a3:	75 40                	jne    2e5 <verify+0x95>
+       buf[0] != 'a' + i % 26 || buf[511] != 'a' + i % 26){
+     2a5:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+     2aa:	f7 e6                	mul    %esi
+     2ac:	89 f0                	mov    %esi,%eax
+     2ae:	c1 ea 03             	shr    $0x3,%edx
+     2b1:	6b d2 1a             	imul   $0x1a,%edx,%edx
+     2b4:	29 d0                	sub    %edx,%eax
+     2b6:	0f be 15 40 18 00 00 	movsbl 0x1840,%edx
+     2bd:	83 c0 61             	add    $0x61,%eax
+    if(read(fd, buf, sizeof(buf)) != sizeof(buf) ||
+     2c0:	39 c2                	cmp    %eax,%edx
+     2c2:	75 21                	jne    2e5 <verify+0x95>
+       buf[0] != 'a' + i % 26 || buf[511] != 'a' + i % 26){
+     2c4:	0f be 05 3f 1a 00 00 	movsbl 0x1a3f,%eax
+     2cb:	39 c2                	cmp    %eax,%edx
+     2cd:	75 16                	jne    2e5 <verify+0x95>
+  for(i = 0; i < 2*kb; i++){
+     2cf:	83 c6 01             	add    $0x1,%esi
+     2d2:	39 fe                	cmp    %edi,%esi
+     2d4:	7c b2                	jl     288 <verify+0x38>
+  close(fd);
+     2d6:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     2d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     2dc:	5b                   	pop    %ebx
+     2dd:	5e                   	pop    %esi
+     2de:	5f                   	pop    %edi
+     2df:	5d                   	pop    %ebp
+  close(fd);
+     2e0:	e9 ab 03 00 00       	jmp    690 <close>
+      printf(2, "copybench: block %d is wrong\n", i);
+     2e5:	83 ec 04             	sub    $0x4,%esp
+     2e8:	56                   	push   %esi
+     2e9:	68 d4 11 00 00       	push   $0x11d4
+     2ee:	6a 02                	push   $0x2
+     2f0:	e8 db 09 00 00       	call   cd0 <printf>
+      exit();
+     2f5:	e8 26 03 00 00       	call   620 <exit>
+    printf(2, "copybench: cannot open %s\n", DST);
+     2fa:	50                   	push   %eax
+     2fb:	68 8e 11 00 00       	push   $0x118e
+     300:	68 b9 11 00 00       	push   $0x11b9
+     305:	6a 02                	push   $0x2
+     307:	e8 c4 09 00 00       	call   cd0 <printf>
+    exit();
+     30c:	e8 0f 03 00 00       	call   620 <exit>
+     311:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     318:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     31f:	90                   	nop
+
+00000320 <run>:
+{
+     320:	55                   	push   %ebp
+     321:	89 e5                	mov    %esp,%ebp
+     323:	57                   	push   %edi
+     324:	56                   	push   %esi
+     325:	53                   	push   %ebx
+     326:	83 ec 48             	sub    $0x48,%esp
+     329:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  unlink(DST);
+     32c:	68 8e 11 00 00       	push   $0x118e
+     331:	e8 47 07 00 00       	call   a7d <unlink>
+  logstat(&a);
+     336:	8d 45 c0             	lea    -0x40(%ebp),%eax
+     339:	89 04 24             	mov    %eax,(%esp)
+     33c:	e8 22 08 00 00       	call   b63 <logstat>
+  t = uptime();
+     341:	e8 91 07 00 00       	call   ad7 <uptime>
+     346:	89 c7                	mov    %eax,%edi
+  copy();
+     348:	ff 55 0c             	call   *0xc(%ebp)
+  t = uptime() - t;
+     34b:	e8 87 07 00 00       	call   ad7 <uptime>
+     350:	29 f8                	sub    %edi,%eax
+     352:	89 c6                	mov    %eax,%esi
+  logstat(&b);
+     354:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     357:	89 04 24             	mov    %eax,(%esp)
+     35a:	e8 04 08 00 00       	call   b63 <logstat>
+  verify(kb);
+     35f:	89 1c 24             	mov    %ebx,(%esp)
+     362:	e8 e9 fe ff ff       	call   250 <verify>
+  printf(1, "%s: %d KB, %d commits in %d ticks\n",
+     367:	58                   	pop    %eax
+     368:	5a                   	pop    %edx
+     369:	56                   	push   %esi
+     36a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     36d:	2b 45 c0             	sub    -0x40(%ebp),%eax
+     370:	50                   	push   %eax
+     371:	53                   	push   %ebx
+     372:	ff 75 08             	push   0x8(%ebp)
+     375:	68 18 12 00 00       	push   $0x1218
+     37a:	6a 01                	push   $0x1
+     37c:	e8 4f 09 00 00       	call   cd0 <printf>
+}
+     381:	83 c4 20             	add    $0x20,%esp
+     384:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     387:	5b                   	pop    %ebx
+     388:	5e                   	pop    %esi
+     389:	5f                   	pop    %edi
+     38a:	5d                   	pop    %ebp
+     38b:	c3                   	ret
+     38c:	66 90                	xchg   %ax,%ax
+     38e:	66 90                	xchg   %ax,%ax
+
+00000390 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+     390:	55                   	push   %ebp
+     391:	89 e5                	mov    %esp,%ebp
+     393:	57                   	push   %edi
+     394:	56                   	push   %esi
+     395:	53                   	push   %ebx
+     396:	83 ec 4c             	sub    $0x4c,%esp
+     399:	8b 45 0c             	mov    0xc(%ebp),%eax
+     39c:	8b 55 08             	mov    0x8(%ebp),%edx
+     39f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     3a2:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+     3a5:	83 fa 0f             	cmp    $0xf,%edx
+     3a8:	0f 87 32 01 00 00    	ja     4e0 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+     3ae:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     3b4:	8b 80 40 1a 00 00    	mov    0x1a40(%eax),%eax
+     3ba:	85 c0                	test   %eax,%eax
+     3bc:	0f 84 de 00 00 00    	je     4a0 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+     3c2:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     3c8:	8b b0 44 1a 00 00    	mov    0x1a44(%eax),%esi
+     3ce:	8d 88 40 1a 00 00    	lea    0x1a40(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+     3d4:	8d b8 48 1a 00 00    	lea    0x1a48(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+     3da:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+     3dd:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+     3e0:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+     3e3:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+     3e9:	0f 8f 01 01 00 00    	jg     4f0 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+     3ef:	8d 78 08             	lea    0x8(%eax),%edi
+     3f2:	8d bc 3e 40 1a 00 00 	lea    0x1a40(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     3f9:	85 db                	test   %ebx,%ebx
+     3fb:	7e 3b                	jle    438 <bufwrite+0xa8>
+     3fd:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+     400:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+     403:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     407:	90                   	nop
+    *dst++ = *src++;
+     408:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     409:	39 c6                	cmp    %eax,%esi
+     40b:	75 fb                	jne    408 <bufwrite+0x78>
+  ob[fd].n += n;
+     40d:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     413:	8b 88 44 1a 00 00    	mov    0x1a44(%eax),%ecx
+     419:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     41b:	83 b8 40 1a 00 00 01 	cmpl   $0x1,0x1a40(%eax)
+  ob[fd].n += n;
+     422:	89 88 44 1a 00 00    	mov    %ecx,0x1a44(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     428:	74 26                	je     450 <bufwrite+0xc0>
+}
+     42a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     42d:	5b                   	pop    %ebx
+     42e:	5e                   	pop    %esi
+     42f:	5f                   	pop    %edi
+     430:	5d                   	pop    %ebp
+     431:	c3                   	ret
+     432:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+     438:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     43b:	83 b8 40 1a 00 00 01 	cmpl   $0x1,0x1a40(%eax)
+  ob[fd].n += n;
+     442:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     445:	75 e3                	jne    42a <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+     447:	85 db                	test   %ebx,%ebx
+     449:	74 df                	je     42a <bufwrite+0x9a>
+     44b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     44f:	90                   	nop
+  src = vsrc;
+     450:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     453:	01 c3                	add    %eax,%ebx
+     455:	eb 10                	jmp    467 <bufwrite+0xd7>
+     457:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     45e:	66 90                	xchg   %ax,%ax
+     460:	83 c0 01             	add    $0x1,%eax
+     463:	39 d8                	cmp    %ebx,%eax
+     465:	74 c3                	je     42a <bufwrite+0x9a>
+    if(*p == (char)c)
+     467:	80 38 0a             	cmpb   $0xa,(%eax)
+     46a:	75 f4                	jne    460 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     46c:	85 c9                	test   %ecx,%ecx
+     46e:	7e ba                	jle    42a <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+     470:	83 ec 04             	sub    $0x4,%esp
+     473:	51                   	push   %ecx
+     474:	ff 75 ac             	push   -0x54(%ebp)
+     477:	52                   	push   %edx
+     478:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+     47b:	e8 cd 05 00 00       	call   a4d <write>
+    ob[fd].n = 0;
+     480:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     483:	83 c4 10             	add    $0x10,%esp
+     486:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+     48c:	c7 82 44 1a 00 00 00 	movl   $0x0,0x1a44(%edx)
+     493:	00 00 00 
+     496:	eb 92                	jmp    42a <bufwrite+0x9a>
+     498:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     49f:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     4a0:	83 ec 08             	sub    $0x8,%esp
+     4a3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     4a6:	50                   	push   %eax
+     4a7:	52                   	push   %edx
+     4a8:	89 55 b0             	mov    %edx,-0x50(%ebp)
+     4ab:	e8 d7 05 00 00       	call   a87 <fstat>
+     4b0:	83 c4 10             	add    $0x10,%esp
+     4b3:	8b 55 b0             	mov    -0x50(%ebp),%edx
+     4b6:	89 c1                	mov    %eax,%ecx
+     4b8:	b8 02 00 00 00       	mov    $0x2,%eax
+     4bd:	85 c9                	test   %ecx,%ecx
+     4bf:	75 0d                	jne    4ce <bufwrite+0x13e>
+     4c1:	31 c0                	xor    %eax,%eax
+     4c3:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     4c8:	0f 95 c0             	setne  %al
+     4cb:	83 c0 01             	add    $0x1,%eax
+     4ce:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+     4d4:	89 81 40 1a 00 00    	mov    %eax,0x1a40(%ecx)
+     4da:	e9 e3 fe ff ff       	jmp    3c2 <bufwrite+0x32>
+     4df:	90                   	nop
+}
+     4e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4e3:	5b                   	pop    %ebx
+     4e4:	5e                   	pop    %esi
+     4e5:	5f                   	pop    %edi
+     4e6:	5d                   	pop    %ebp
+    write(fd, p, n);
+     4e7:	e9 61 05 00 00       	jmp    a4d <write>
+     4ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+     4f0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+     4f3:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+     4f6:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+     4f9:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+     4fc:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+     4ff:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+     502:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+     505:	6a 02                	push   $0x2
+     507:	50                   	push   %eax
+     508:	52                   	push   %edx
+     509:	e8 9b 06 00 00       	call   ba9 <writev>
+    ob[fd].n = 0;
+     50e:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+     511:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+     514:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+     51b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     51e:	5b                   	pop    %ebx
+     51f:	5e                   	pop    %esi
+     520:	5f                   	pop    %edi
+     521:	5d                   	pop    %ebp
+     522:	c3                   	ret
+     523:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     52a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000530 <fflush>:
+{
+     530:	55                   	push   %ebp
+     531:	89 e5                	mov    %esp,%ebp
+     533:	53                   	push   %ebx
+     534:	83 ec 04             	sub    $0x4,%esp
+     537:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     53a:	83 f8 0f             	cmp    $0xf,%eax
+     53d:	77 16                	ja     555 <fflush+0x25>
+     53f:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+     545:	8b 8a 44 1a 00 00    	mov    0x1a44(%edx),%ecx
+     54b:	8d 9a 40 1a 00 00    	lea    0x1a40(%edx),%ebx
+     551:	85 c9                	test   %ecx,%ecx
+     553:	7f 0b                	jg     560 <fflush+0x30>
+}
+     555:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     558:	c9                   	leave
+     559:	c3                   	ret
+     55a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     560:	83 ec 04             	sub    $0x4,%esp
+     563:	81 c2 48 1a 00 00    	add    $0x1a48,%edx
+     569:	51                   	push   %ecx
+     56a:	52                   	push   %edx
+     56b:	50                   	push   %eax
+     56c:	e8 dc 04 00 00       	call   a4d <write>
+    ob[fd].n = 0;
+     571:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     578:	83 c4 10             	add    $0x10,%esp
+}
+     57b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     57e:	c9                   	leave
+     57f:	c3                   	ret
+
+00000580 <fflushall>:
+{
+     580:	55                   	push   %ebp
+     581:	89 e5                	mov    %esp,%ebp
+     583:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     584:	31 f6                	xor    %esi,%esi
+{
+     586:	53                   	push   %ebx
+     587:	bb 48 1a 00 00       	mov    $0x1a48,%ebx
+     58c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     590:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     593:	85 c0                	test   %eax,%eax
+     595:	7e 15                	jle    5ac <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     597:	83 ec 04             	sub    $0x4,%esp
+     59a:	50                   	push   %eax
+     59b:	53                   	push   %ebx
+     59c:	56                   	push   %esi
+     59d:	e8 ab 04 00 00       	call   a4d <write>
+    ob[fd].n = 0;
+     5a2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     5a9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     5ac:	83 c6 01             	add    $0x1,%esi
+     5af:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     5b5:	83 fe 10             	cmp    $0x10,%esi
+     5b8:	75 d6                	jne    590 <fflushall+0x10>
+}
+     5ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5bd:	5b                   	pop    %ebx
+     5be:	5e                   	pop    %esi
+     5bf:	5d                   	pop    %ebp
+     5c0:	c3                   	ret
+     5c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5cf:	90                   	nop
+
+000005d0 <fork>:
+{
+     5d0:	55                   	push   %ebp
+     5d1:	89 e5                	mov    %esp,%ebp
+     5d3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     5d4:	31 f6                	xor    %esi,%esi
+{
+     5d6:	53                   	push   %ebx
+     5d7:	bb 48 1a 00 00       	mov    $0x1a48,%ebx
+     5dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     5e0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     5e3:	85 c0                	test   %eax,%eax
+     5e5:	7e 15                	jle    5fc <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     5e7:	83 ec 04             	sub    $0x4,%esp
+     5ea:	50                   	push   %eax
+     5eb:	53                   	push   %ebx
+     5ec:	56                   	push   %esi
+     5ed:	e8 5b 04 00 00       	call   a4d <write>
+    ob[fd].n = 0;
+     5f2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     5f9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     5fc:	83 c6 01             	add    $0x1,%esi
+     5ff:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     605:	83 fe 10             	cmp    $0x10,%esi
+     608:	75 d6                	jne    5e0 <fork+0x10>
+}
+     60a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     60d:	5b                   	pop    %ebx
+     60e:	5e                   	pop    %esi
+     60f:	5d                   	pop    %ebp
+  return _fork();
+     610:	e9 15 04 00 00       	jmp    a2a <_fork>
+     615:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     61c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000620 <exit>:
+{
+     620:	55                   	push   %ebp
+     621:	89 e5                	mov    %esp,%ebp
+     623:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+     626:	e8 55 ff ff ff       	call   580 <fflushall>
+  _exit();
+     62b:	e8 01 04 00 00       	call   a31 <_exit>
+
+00000630 <exec>:
+{
+     630:	55                   	push   %ebp
+     631:	89 e5                	mov    %esp,%ebp
+     633:	57                   	push   %edi
+     634:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     635:	31 f6                	xor    %esi,%esi
+{
+     637:	53                   	push   %ebx
+     638:	bb 48 1a 00 00       	mov    $0x1a48,%ebx
+     63d:	83 ec 1c             	sub    $0x1c,%esp
+     640:	8b 45 08             	mov    0x8(%ebp),%eax
+     643:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     646:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     649:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     650:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     653:	85 c0                	test   %eax,%eax
+     655:	7e 15                	jle    66c <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     657:	83 ec 04             	sub    $0x4,%esp
+     65a:	50                   	push   %eax
+     65b:	53                   	push   %ebx
+     65c:	56                   	push   %esi
+     65d:	e8 eb 03 00 00       	call   a4d <write>
+    ob[fd].n = 0;
+     662:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     669:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     66c:	83 c6 01             	add    $0x1,%esi
+     66f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     675:	83 fe 10             	cmp    $0x10,%esi
+     678:	75 d6                	jne    650 <exec+0x20>
+  return _exec(path, argv);
+     67a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     67d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+     680:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     683:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     686:	5b                   	pop    %ebx
+     687:	5e                   	pop    %esi
+     688:	5f                   	pop    %edi
+     689:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     68a:	e9 d3 03 00 00       	jmp    a62 <_exec>
+     68f:	90                   	nop
+
+00000690 <close>:
+{
+     690:	55                   	push   %ebp
+     691:	89 e5                	mov    %esp,%ebp
+     693:	56                   	push   %esi
+     694:	53                   	push   %ebx
+     695:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     698:	83 fb 0f             	cmp    $0xf,%ebx
+     69b:	77 26                	ja     6c3 <close+0x33>
+     69d:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     6a3:	8b 90 44 1a 00 00    	mov    0x1a44(%eax),%edx
+     6a9:	8d b0 40 1a 00 00    	lea    0x1a40(%eax),%esi
+     6af:	85 d2                	test   %edx,%edx
+     6b1:	7f 25                	jg     6d8 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+     6b3:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     6b9:	c7 80 40 1a 00 00 00 	movl   $0x0,0x1a40(%eax)
+     6c0:	00 00 00 
+  return _close(fd);
+     6c3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     6c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     6c9:	5b                   	pop    %ebx
+     6ca:	5e                   	pop    %esi
+     6cb:	5d                   	pop    %ebp
+  return _close(fd);
+     6cc:	e9 83 03 00 00       	jmp    a54 <_close>
+     6d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     6d8:	83 ec 04             	sub    $0x4,%esp
+     6db:	05 48 1a 00 00       	add    $0x1a48,%eax
+     6e0:	52                   	push   %edx
+     6e1:	50                   	push   %eax
+     6e2:	53                   	push   %ebx
+     6e3:	e8 65 03 00 00       	call   a4d <write>
+    ob[fd].n = 0;
+     6e8:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+     6ef:	83 c4 10             	add    $0x10,%esp
+     6f2:	eb bf                	jmp    6b3 <close+0x23>
+     6f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6ff:	90                   	nop
+
+00000700 <strcpy>:
+{
+     700:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+     701:	31 c0                	xor    %eax,%eax
+{
+     703:	89 e5                	mov    %esp,%ebp
+     705:	53                   	push   %ebx
+     706:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     709:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     70c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     710:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     714:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     717:	83 c0 01             	add    $0x1,%eax
+     71a:	84 d2                	test   %dl,%dl
+     71c:	75 f2                	jne    710 <strcpy+0x10>
+}
+     71e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     721:	89 c8                	mov    %ecx,%eax
+     723:	c9                   	leave
+     724:	c3                   	ret
+     725:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     72c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000730 <strcmp>:
+{
+     730:	55                   	push   %ebp
+     731:	89 e5                	mov    %esp,%ebp
+     733:	53                   	push   %ebx
+     734:	8b 55 08             	mov    0x8(%ebp),%edx
+     737:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     73a:	0f b6 02             	movzbl (%edx),%eax
+     73d:	84 c0                	test   %al,%al
+     73f:	75 17                	jne    758 <strcmp+0x28>
+     741:	eb 3a                	jmp    77d <strcmp+0x4d>
+     743:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     747:	90                   	nop
+     748:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     74c:	83 c2 01             	add    $0x1,%edx
+     74f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     752:	84 c0                	test   %al,%al
+     754:	74 1a                	je     770 <strcmp+0x40>
+    p++, q++;
+     756:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     758:	0f b6 19             	movzbl (%ecx),%ebx
+     75b:	38 c3                	cmp    %al,%bl
+     75d:	74 e9                	je     748 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     75f:	29 d8                	sub    %ebx,%eax
+}
+     761:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     764:	c9                   	leave
+     765:	c3                   	ret
+     766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     76d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     770:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     774:	31 c0                	xor    %eax,%eax
+     776:	29 d8                	sub    %ebx,%eax
+}
+     778:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     77b:	c9                   	leave
+     77c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     77d:	0f b6 19             	movzbl (%ecx),%ebx
+     780:	31 c0                	xor    %eax,%eax
+     782:	eb db                	jmp    75f <strcmp+0x2f>
+     784:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     78b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     78f:	90                   	nop
+
+00000790 <strlen>:
+{
+     790:	55                   	push   %ebp
+     791:	89 e5                	mov    %esp,%ebp
+     793:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+     796:	80 3a 00             	cmpb   $0x0,(%edx)
+     799:	74 15                	je     7b0 <strlen+0x20>
+     79b:	31 c0                	xor    %eax,%eax
+     79d:	8d 76 00             	lea    0x0(%esi),%esi
+     7a0:	83 c0 01             	add    $0x1,%eax
+     7a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     7a7:	89 c1                	mov    %eax,%ecx
+     7a9:	75 f5                	jne    7a0 <strlen+0x10>
+}
+     7ab:	89 c8                	mov    %ecx,%eax
+     7ad:	5d                   	pop    %ebp
+     7ae:	c3                   	ret
+     7af:	90                   	nop
+  for(n = 0; s[n]; n++)
+     7b0:	31 c9                	xor    %ecx,%ecx
+}
+     7b2:	5d                   	pop    %ebp
+     7b3:	89 c8                	mov    %ecx,%eax
+     7b5:	c3                   	ret
+     7b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007c0 <memset>:
+{
+     7c0:	55                   	push   %ebp
+     7c1:	89 e5                	mov    %esp,%ebp
+     7c3:	57                   	push   %edi
+     7c4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     7c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     7ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+     7cd:	89 d7                	mov    %edx,%edi
+     7cf:	fc                   	cld
+     7d0:	f3 aa                	rep stos %al,%es:(%edi)
+}
+     7d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     7d5:	89 d0                	mov    %edx,%eax
+     7d7:	c9                   	leave
+     7d8:	c3                   	ret
+     7d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000007e0 <strchr>:
+{
+     7e0:	55                   	push   %ebp
+     7e1:	89 e5                	mov    %esp,%ebp
+     7e3:	8b 45 08             	mov    0x8(%ebp),%eax
+     7e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     7ea:	0f b6 10             	movzbl (%eax),%edx
+     7ed:	84 d2                	test   %dl,%dl
+     7ef:	75 12                	jne    803 <strchr+0x23>
+     7f1:	eb 1d                	jmp    810 <strchr+0x30>
+     7f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7f7:	90                   	nop
+     7f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     7fc:	83 c0 01             	add    $0x1,%eax
+     7ff:	84 d2                	test   %dl,%dl
+     801:	74 0d                	je     810 <strchr+0x30>
+    if(*s == c)
+     803:	38 d1                	cmp    %dl,%cl
+     805:	75 f1                	jne    7f8 <strchr+0x18>
+}
+     807:	5d                   	pop    %ebp
+     808:	c3                   	ret
+     809:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     810:	31 c0                	xor    %eax,%eax
+}
+     812:	5d                   	pop    %ebp
+     813:	c3                   	ret
+     814:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     81b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     81f:	90                   	nop
+
+00000820 <memchr>:
+{
+     820:	55                   	push   %ebp
+     821:	89 e5                	mov    %esp,%ebp
+     823:	8b 55 10             	mov    0x10(%ebp),%edx
+     826:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     829:	85 d2                	test   %edx,%edx
+     82b:	74 1b                	je     848 <memchr+0x28>
+    if(*p == (char)c)
+     82d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+     831:	01 c2                	add    %eax,%edx
+     833:	eb 0a                	jmp    83f <memchr+0x1f>
+     835:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+     838:	83 c0 01             	add    $0x1,%eax
+     83b:	39 c2                	cmp    %eax,%edx
+     83d:	74 09                	je     848 <memchr+0x28>
+    if(*p == (char)c)
+     83f:	38 08                	cmp    %cl,(%eax)
+     841:	75 f5                	jne    838 <memchr+0x18>
+}
+     843:	5d                   	pop    %ebp
+     844:	c3                   	ret
+     845:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+     848:	31 c0                	xor    %eax,%eax
+}
+     84a:	5d                   	pop    %ebp
+     84b:	c3                   	ret
+     84c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000850 <gets>:
+{
+     850:	55                   	push   %ebp
+     851:	89 e5                	mov    %esp,%ebp
+     853:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+     854:	31 ff                	xor    %edi,%edi
+{
+     856:	56                   	push   %esi
+     857:	be 48 1a 00 00       	mov    $0x1a48,%esi
+     85c:	53                   	push   %ebx
+     85d:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     860:	8b 46 fc             	mov    -0x4(%esi),%eax
+     863:	85 c0                	test   %eax,%eax
+     865:	7e 15                	jle    87c <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     867:	83 ec 04             	sub    $0x4,%esp
+     86a:	50                   	push   %eax
+     86b:	56                   	push   %esi
+     86c:	57                   	push   %edi
+     86d:	e8 db 01 00 00       	call   a4d <write>
+    ob[fd].n = 0;
+     872:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+     879:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     87c:	83 c7 01             	add    $0x1,%edi
+     87f:	81 c6 08 01 00 00    	add    $0x108,%esi
+     885:	83 ff 10             	cmp    $0x10,%edi
+     888:	75 d6                	jne    860 <gets+0x10>
+  for(i=0; i+1 < max; ){
+     88a:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+     88c:	8d 75 e7             	lea    -0x19(%ebp),%esi
+     88f:	eb 2e                	jmp    8bf <gets+0x6f>
+     891:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     898:	83 ec 04             	sub    $0x4,%esp
+     89b:	6a 01                	push   $0x1
+     89d:	56                   	push   %esi
+     89e:	6a 00                	push   $0x0
+     8a0:	e8 a1 01 00 00       	call   a46 <read>
+    if(cc < 1)
+     8a5:	83 c4 10             	add    $0x10,%esp
+     8a8:	85 c0                	test   %eax,%eax
+     8aa:	7e 1d                	jle    8c9 <gets+0x79>
+    buf[i++] = c;
+     8ac:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     8b0:	8b 55 08             	mov    0x8(%ebp),%edx
+     8b3:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     8b7:	3c 0a                	cmp    $0xa,%al
+     8b9:	74 10                	je     8cb <gets+0x7b>
+     8bb:	3c 0d                	cmp    $0xd,%al
+     8bd:	74 0c                	je     8cb <gets+0x7b>
+  for(i=0; i+1 < max; ){
+     8bf:	89 df                	mov    %ebx,%edi
+     8c1:	83 c3 01             	add    $0x1,%ebx
+     8c4:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     8c7:	7c cf                	jl     898 <gets+0x48>
+     8c9:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     8cb:	8b 45 08             	mov    0x8(%ebp),%eax
+     8ce:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     8d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8d5:	5b                   	pop    %ebx
+     8d6:	5e                   	pop    %esi
+     8d7:	5f                   	pop    %edi
+     8d8:	5d                   	pop    %ebp
+     8d9:	c3                   	ret
+     8da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008e0 <stat>:
+{
+     8e0:	55                   	push   %ebp
+     8e1:	89 e5                	mov    %esp,%ebp
+     8e3:	57                   	push   %edi
+     8e4:	56                   	push   %esi
+     8e5:	53                   	push   %ebx
+     8e6:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+     8e9:	6a 00                	push   $0x0
+     8eb:	ff 75 08             	push   0x8(%ebp)
+     8ee:	e8 76 01 00 00       	call   a69 <open>
+  if(fd < 0)
+     8f3:	83 c4 10             	add    $0x10,%esp
+     8f6:	85 c0                	test   %eax,%eax
+     8f8:	78 76                	js     970 <stat+0x90>
+  r = fstat(fd, st);
+     8fa:	83 ec 08             	sub    $0x8,%esp
+     8fd:	ff 75 0c             	push   0xc(%ebp)
+     900:	89 c3                	mov    %eax,%ebx
+     902:	50                   	push   %eax
+     903:	e8 7f 01 00 00       	call   a87 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     908:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     90b:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     90d:	83 fb 0f             	cmp    $0xf,%ebx
+     910:	7f 40                	jg     952 <stat+0x72>
+     912:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     918:	8b 90 44 1a 00 00    	mov    0x1a44(%eax),%edx
+     91e:	8d b8 40 1a 00 00    	lea    0x1a40(%eax),%edi
+     924:	85 d2                	test   %edx,%edx
+     926:	7e 1a                	jle    942 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+     928:	83 ec 04             	sub    $0x4,%esp
+     92b:	05 48 1a 00 00       	add    $0x1a48,%eax
+     930:	52                   	push   %edx
+     931:	50                   	push   %eax
+     932:	53                   	push   %ebx
+     933:	e8 15 01 00 00       	call   a4d <write>
+    ob[fd].n = 0;
+     938:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+     93f:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+     942:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     948:	c7 80 40 1a 00 00 00 	movl   $0x0,0x1a40(%eax)
+     94f:	00 00 00 
+  return _close(fd);
+     952:	83 ec 0c             	sub    $0xc,%esp
+     955:	53                   	push   %ebx
+     956:	e8 f9 00 00 00       	call   a54 <_close>
+     95b:	83 c4 10             	add    $0x10,%esp
+}
+     95e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     961:	89 f0                	mov    %esi,%eax
+     963:	5b                   	pop    %ebx
+     964:	5e                   	pop    %esi
+     965:	5f                   	pop    %edi
+     966:	5d                   	pop    %ebp
+     967:	c3                   	ret
+     968:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     96f:	90                   	nop
+    return -1;
+     970:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     975:	eb e7                	jmp    95e <stat+0x7e>
+     977:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     97e:	66 90                	xchg   %ax,%ax
+
+00000980 <atoi>:
+{
+     980:	55                   	push   %ebp
+     981:	89 e5                	mov    %esp,%ebp
+     983:	53                   	push   %ebx
+     984:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     987:	0f be 02             	movsbl (%edx),%eax
+     98a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     98d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     990:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     995:	77 1e                	ja     9b5 <atoi+0x35>
+     997:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     99e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     9a0:	83 c2 01             	add    $0x1,%edx
+     9a3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     9a6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     9aa:	0f be 02             	movsbl (%edx),%eax
+     9ad:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     9b0:	80 fb 09             	cmp    $0x9,%bl
+     9b3:	76 eb                	jbe    9a0 <atoi+0x20>
+}
+     9b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9b8:	89 c8                	mov    %ecx,%eax
+     9ba:	c9                   	leave
+     9bb:	c3                   	ret
+     9bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000009c0 <memmove>:
+{
+     9c0:	55                   	push   %ebp
+     9c1:	89 e5                	mov    %esp,%ebp
+     9c3:	57                   	push   %edi
+     9c4:	56                   	push   %esi
+     9c5:	8b 45 10             	mov    0x10(%ebp),%eax
+     9c8:	8b 55 08             	mov    0x8(%ebp),%edx
+     9cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     9ce:	85 c0                	test   %eax,%eax
+     9d0:	7e 13                	jle    9e5 <memmove+0x25>
+     9d2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     9d4:	89 d7                	mov    %edx,%edi
+     9d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9dd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     9e0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     9e1:	39 f8                	cmp    %edi,%eax
+     9e3:	75 fb                	jne    9e0 <memmove+0x20>
+  return vdst;
+}
+     9e5:	5e                   	pop    %esi
+     9e6:	89 d0                	mov    %edx,%eax
+     9e8:	5f                   	pop    %edi
+     9e9:	5d                   	pop    %ebp
+     9ea:	c3                   	ret
+
+000009eb <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+     9eb:	83 3d 20 18 00 00 00 	cmpl   $0x0,0x1820
+  jle 1f
+     9f2:	7e 0a                	jle    9fe <syscallentry+0x13>
+  movl %esp, %ecx
+     9f4:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+     9f6:	ba fd 09 00 00       	mov    $0x9fd,%edx
+  sysenter
+     9fb:	0f 34                	sysenter
+2:
+  ret
+     9fd:	c3                   	ret
+1:
+  jl 3f
+     9fe:	7c 27                	jl     a27 <syscallentry+0x3c>
+  pushal
+     a00:	60                   	pusha
+  movl $1, %eax
+     a01:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     a06:	0f a2                	cpuid
+  movl $-1, sysentermode
+     a08:	c7 05 20 18 00 00 ff 	movl   $0xffffffff,0x1820
+     a0f:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     a12:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+     a18:	74 0a                	je     a24 <syscallentry+0x39>
+  movl $1, sysentermode
+     a1a:	c7 05 20 18 00 00 01 	movl   $0x1,0x1820
+     a21:	00 00 00 
+4:
+  popal
+     a24:	61                   	popa
+  jmp syscallentry
+     a25:	eb c4                	jmp    9eb <syscallentry>
+3:
+  int $T_SYSCALL
+     a27:	cd 40                	int    $0x40
+  ret
+     a29:	c3                   	ret
+
+00000a2a <_fork>:
+
+SYSCALLAS(_fork, fork)
+     a2a:	b8 01 00 00 00       	mov    $0x1,%eax
+     a2f:	eb ba                	jmp    9eb <syscallentry>
+
+00000a31 <_exit>:
+SYSCALLAS(_exit, exit)
+     a31:	b8 02 00 00 00       	mov    $0x2,%eax
+     a36:	eb b3                	jmp    9eb <syscallentry>
+
+00000a38 <wait>:
+SYSCALL(wait)
+     a38:	b8 03 00 00 00       	mov    $0x3,%eax
+     a3d:	eb ac                	jmp    9eb <syscallentry>
+
+00000a3f <pipe>:
+SYSCALL(pipe)
+     a3f:	b8 04 00 00 00       	mov    $0x4,%eax
+     a44:	eb a5                	jmp    9eb <syscallentry>
+
+00000a46 <read>:
+SYSCALL(read)
+     a46:	b8 05 00 00 00       	mov    $0x5,%eax
+     a4b:	eb 9e                	jmp    9eb <syscallentry>
+
+00000a4d <write>:
+SYSCALL(write)
+     a4d:	b8 10 00 00 00       	mov    $0x10,%eax
+     a52:	eb 97                	jmp    9eb <syscallentry>
+
+00000a54 <_close>:
+SYSCALLAS(_close, close)
+     a54:	b8 15 00 00 00       	mov    $0x15,%eax
+     a59:	eb 90                	jmp    9eb <syscallentry>
+
+00000a5b <kill>:
+SYSCALL(kill)
+     a5b:	b8 06 00 00 00       	mov    $0x6,%eax
+     a60:	eb 89                	jmp    9eb <syscallentry>
+
+00000a62 <_exec>:
+SYSCALLAS(_exec, exec)
+     a62:	b8 07 00 00 00       	mov    $0x7,%eax
+     a67:	eb 82                	jmp    9eb <syscallentry>
+
+00000a69 <open>:
+SYSCALL(open)
+     a69:	b8 0f 00 00 00       	mov    $0xf,%eax
+     a6e:	e9 78 ff ff ff       	jmp    9eb <syscallentry>
+
+00000a73 <mknod>:
+SYSCALL(mknod)
+     a73:	b8 11 00 00 00       	mov    $0x11,%eax
+     a78:	e9 6e ff ff ff       	jmp    9eb <syscallentry>
+
+00000a7d <unlink>:
+SYSCALL(unlink)
+     a7d:	b8 12 00 00 00       	mov    $0x12,%eax
+     a82:	e9 64 ff ff ff       	jmp    9eb <syscallentry>
+
+00000a87 <fstat>:
+SYSCALL(fstat)
+     a87:	b8 08 00 00 00       	mov    $0x8,%eax
+     a8c:	e9 5a ff ff ff       	jmp    9eb <syscallentry>
+
+00000a91 <link>:
+SYSCALL(link)
+     a91:	b8 13 00 00 00       	mov    $0x13,%eax
+     a96:	e9 50 ff ff ff       	jmp    9eb <syscallentry>
+
+00000a9b <mkdir>:
+SYSCALL(mkdir)
+     a9b:	b8 14 00 00 00       	mov    $0x14,%eax
+     aa0:	e9 46 ff ff ff       	jmp    9eb <syscallentry>
+
+00000aa5 <chdir>:
+SYSCALL(chdir)
+     aa5:	b8 09 00 00 00       	mov    $0x9,%eax
+     aaa:	e9 3c ff ff ff       	jmp    9eb <syscallentry>
+
+00000aaf <dup>:
+SYSCALL(dup)
+     aaf:	b8 0a 00 00 00       	mov    $0xa,%eax
+     ab4:	e9 32 ff ff ff       	jmp    9eb <syscallentry>
+
+00000ab9 <getpid>:
+SYSCALL(getpid)
+     ab9:	b8 0b 00 00 00       	mov    $0xb,%eax
+     abe:	e9 28 ff ff ff       	jmp    9eb <syscallentry>
+
+00000ac3 <sbrk>:
+SYSCALL(sbrk)
+     ac3:	b8 0c 00 00 00       	mov    $0xc,%eax
+     ac8:	e9 1e ff ff ff       	jmp    9eb <syscallentry>
+
+00000acd <sleep>:
+SYSCALL(sleep)
+     acd:	b8 0d 00 00 00       	mov    $0xd,%eax
+     ad2:	e9 14 ff ff ff       	jmp    9eb <syscallentry>
+
+00000ad7 <uptime>:
+SYSCALL(uptime)
+     ad7:	b8 0e 00 00 00       	mov    $0xe,%eax
+     adc:	e9 0a ff ff ff       	jmp    9eb <syscallentry>
+
+00000ae1 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+     ae1:	b8 16 00 00 00       	mov    $0x16,%eax
+     ae6:	e9 00 ff ff ff       	jmp    9eb <syscallentry>
+
+00000aeb <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+     aeb:	b8 17 00 00 00       	mov    $0x17,%eax
+     af0:	e9 f6 fe ff ff       	jmp    9eb <syscallentry>
+
+00000af5 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+     af5:	b8 18 00 00 00       	mov    $0x18,%eax
+     afa:	e9 ec fe ff ff       	jmp    9eb <syscallentry>
+
+00000aff <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+     aff:	b8 19 00 00 00       	mov    $0x19,%eax
+     b04:	e9 e2 fe ff ff       	jmp    9eb <syscallentry>
+
+00000b09 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+     b09:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     b0e:	e9 d8 fe ff ff       	jmp    9eb <syscallentry>
+
+00000b13 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+     b13:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     b18:	e9 ce fe ff ff       	jmp    9eb <syscallentry>
+
+00000b1d <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+     b1d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     b22:	e9 c4 fe ff ff       	jmp    9eb <syscallentry>
+
+00000b27 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+     b27:	b8 20 00 00 00       	mov    $0x20,%eax
+     b2c:	e9 ba fe ff ff       	jmp    9eb <syscallentry>
+
+00000b31 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+     b31:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     b36:	e9 b0 fe ff ff       	jmp    9eb <syscallentry>
+
+00000b3b <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+     b3b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     b40:	e9 a6 fe ff ff       	jmp    9eb <syscallentry>
+
+00000b45 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+     b45:	b8 21 00 00 00       	mov    $0x21,%eax
+     b4a:	e9 9c fe ff ff       	jmp    9eb <syscallentry>
+
+00000b4f <yield>:
+SYSCALL(yield) // yield the CPU to another process
+     b4f:	b8 22 00 00 00       	mov    $0x22,%eax
+     b54:	e9 92 fe ff ff       	jmp    9eb <syscallentry>
+
+00000b59 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+     b59:	b8 23 00 00 00       	mov    $0x23,%eax
+     b5e:	e9 88 fe ff ff       	jmp    9eb <syscallentry>
+
+00000b63 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+     b63:	b8 24 00 00 00       	mov    $0x24,%eax
+     b68:	e9 7e fe ff ff       	jmp    9eb <syscallentry>
+
+00000b6d <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+     b6d:	b8 25 00 00 00       	mov    $0x25,%eax
+     b72:	e9 74 fe ff ff       	jmp    9eb <syscallentry>
+
+00000b77 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+     b77:	b8 26 00 00 00       	mov    $0x26,%eax
+     b7c:	e9 6a fe ff ff       	jmp    9eb <syscallentry>
+
+00000b81 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+     b81:	b8 27 00 00 00       	mov    $0x27,%eax
+     b86:	e9 60 fe ff ff       	jmp    9eb <syscallentry>
+
+00000b8b <mmap>:
+SYSCALL(mmap) // map a file into memory
+     b8b:	b8 28 00 00 00       	mov    $0x28,%eax
+     b90:	e9 56 fe ff ff       	jmp    9eb <syscallentry>
+
+00000b95 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+     b95:	b8 29 00 00 00       	mov    $0x29,%eax
+     b9a:	e9 4c fe ff ff       	jmp    9eb <syscallentry>
+
+00000b9f <readv>:
+SYSCALL(readv) // read into several buffers
+     b9f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     ba4:	e9 42 fe ff ff       	jmp    9eb <syscallentry>
+
+00000ba9 <writev>:
+SYSCALL(writev) // write from several buffers
+     ba9:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     bae:	e9 38 fe ff ff       	jmp    9eb <syscallentry>
+
+00000bb3 <pread>:
+SYSCALL(pread) // read at an offset
+     bb3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     bb8:	e9 2e fe ff ff       	jmp    9eb <syscallentry>
+
+00000bbd <pwrite>:
+SYSCALL(pwrite) // write at an offset
+     bbd:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     bc2:	e9 24 fe ff ff       	jmp    9eb <syscallentry>
+
+00000bc7 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+     bc7:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     bcc:	e9 1a fe ff ff       	jmp    9eb <syscallentry>
+
+00000bd1 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+     bd1:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     bd6:	e9 10 fe ff ff       	jmp    9eb <syscallentry>
+
+00000bdb <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+     bdb:	b8 30 00 00 00       	mov    $0x30,%eax
+     be0:	e9 06 fe ff ff       	jmp    9eb <syscallentry>
+
+00000be5 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+     be5:	b8 31 00 00 00       	mov    $0x31,%eax
+     bea:	e9 fc fd ff ff       	jmp    9eb <syscallentry>
+
+00000bef <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+     bef:	b8 32 00 00 00       	mov    $0x32,%eax
+     bf4:	e9 f2 fd ff ff       	jmp    9eb <syscallentry>
+
+00000bf9 <profread>:
+SYSCALL(profread) // drain profiler samples
+     bf9:	b8 33 00 00 00       	mov    $0x33,%eax
+     bfe:	e9 e8 fd ff ff       	jmp    9eb <syscallentry>
+
+00000c03 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+     c03:	b8 34 00 00 00       	mov    $0x34,%eax
+     c08:	e9 de fd ff ff       	jmp    9eb <syscallentry>
+
+00000c0d <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+     c0d:	b8 35 00 00 00       	mov    $0x35,%eax
+     c12:	e9 d4 fd ff ff       	jmp    9eb <syscallentry>
+
+00000c17 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+     c17:	b8 36 00 00 00       	mov    $0x36,%eax
+     c1c:	e9 ca fd ff ff       	jmp    9eb <syscallentry>
+
+00000c21 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+     c21:	b8 37 00 00 00       	mov    $0x37,%eax
+     c26:	e9 c0 fd ff ff       	jmp    9eb <syscallentry>
+     c2b:	66 90                	xchg   %ax,%ax
+     c2d:	66 90                	xchg   %ax,%ax
+     c2f:	90                   	nop
+
+00000c30 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     c30:	55                   	push   %ebp
+     c31:	89 e5                	mov    %esp,%ebp
+     c33:	57                   	push   %edi
+     c34:	56                   	push   %esi
+     c35:	53                   	push   %ebx
+     c36:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     c38:	89 d1                	mov    %edx,%ecx
+{
+     c3a:	83 ec 3c             	sub    $0x3c,%esp
+     c3d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     c40:	85 d2                	test   %edx,%edx
+     c42:	0f 89 80 00 00 00    	jns    cc8 <printint+0x98>
+     c48:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     c4c:	74 7a                	je     cc8 <printint+0x98>
+    x = -xx;
+     c4e:	f7 d9                	neg    %ecx
+    neg = 1;
+     c50:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     c55:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     c58:	31 f6                	xor    %esi,%esi
+     c5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     c60:	89 c8                	mov    %ecx,%eax
+     c62:	31 d2                	xor    %edx,%edx
+     c64:	89 f7                	mov    %esi,%edi
+     c66:	f7 f3                	div    %ebx
+     c68:	8d 76 01             	lea    0x1(%esi),%esi
+     c6b:	0f b6 92 9c 12 00 00 	movzbl 0x129c(%edx),%edx
+     c72:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     c76:	89 ca                	mov    %ecx,%edx
+     c78:	89 c1                	mov    %eax,%ecx
+     c7a:	39 da                	cmp    %ebx,%edx
+     c7c:	73 e2                	jae    c60 <printint+0x30>
+  if(neg)
+     c7e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     c81:	85 c0                	test   %eax,%eax
+     c83:	74 07                	je     c8c <printint+0x5c>
+    buf[i++] = '-';
+     c85:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     c8a:	89 f7                	mov    %esi,%edi
+     c8c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     c8f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     c92:	01 df                	add    %ebx,%edi
+     c94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     c98:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+     c9b:	83 ec 04             	sub    $0x4,%esp
+     c9e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     ca1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     ca4:	6a 01                	push   $0x1
+     ca6:	50                   	push   %eax
+     ca7:	56                   	push   %esi
+     ca8:	e8 e3 f6 ff ff       	call   390 <bufwrite>
+  while(--i >= 0)
+     cad:	89 f8                	mov    %edi,%eax
+     caf:	83 c4 10             	add    $0x10,%esp
+     cb2:	83 ef 01             	sub    $0x1,%edi
+     cb5:	39 d8                	cmp    %ebx,%eax
+     cb7:	75 df                	jne    c98 <printint+0x68>
+}
+     cb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cbc:	5b                   	pop    %ebx
+     cbd:	5e                   	pop    %esi
+     cbe:	5f                   	pop    %edi
+     cbf:	5d                   	pop    %ebp
+     cc0:	c3                   	ret
+     cc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     cc8:	31 c0                	xor    %eax,%eax
+     cca:	eb 89                	jmp    c55 <printint+0x25>
+     ccc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000cd0 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     cd0:	55                   	push   %ebp
+     cd1:	89 e5                	mov    %esp,%ebp
+     cd3:	57                   	push   %edi
+     cd4:	56                   	push   %esi
+     cd5:	53                   	push   %ebx
+     cd6:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     cd9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     cdc:	0f b6 18             	movzbl (%eax),%ebx
+     cdf:	84 db                	test   %bl,%bl
+     ce1:	74 6c                	je     d4f <printf+0x7f>
+     ce3:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+     ce6:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+     ce9:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     ceb:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     cee:	eb 26                	jmp    d16 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     cf0:	83 f8 25             	cmp    $0x25,%eax
+     cf3:	74 4b                	je     d40 <printf+0x70>
+  bufwrite(fd, &c, 1);
+     cf5:	83 ec 04             	sub    $0x4,%esp
+     cf8:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     cfb:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     cfe:	6a 01                	push   $0x1
+     d00:	50                   	push   %eax
+     d01:	ff 75 08             	push   0x8(%ebp)
+     d04:	e8 87 f6 ff ff       	call   390 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+     d09:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     d0c:	0f b6 1f             	movzbl (%edi),%ebx
+     d0f:	83 c7 01             	add    $0x1,%edi
+     d12:	84 db                	test   %bl,%bl
+     d14:	74 39                	je     d4f <printf+0x7f>
+    c = fmt[i] & 0xff;
+     d16:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     d19:	85 f6                	test   %esi,%esi
+     d1b:	74 d3                	je     cf0 <printf+0x20>
+      }
+    } else if(state == '%'){
+     d1d:	83 fe 25             	cmp    $0x25,%esi
+     d20:	75 ea                	jne    d0c <printf+0x3c>
+      if(c == 'd'){
+     d22:	83 f8 25             	cmp    $0x25,%eax
+     d25:	0f 84 d5 01 00 00    	je     f00 <printf+0x230>
+     d2b:	83 e8 63             	sub    $0x63,%eax
+     d2e:	83 f8 15             	cmp    $0x15,%eax
+     d31:	77 45                	ja     d78 <printf+0xa8>
+     d33:	ff 24 85 44 12 00 00 	jmp    *0x1244(,%eax,4)
+     d3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     d40:	0f b6 1f             	movzbl (%edi),%ebx
+     d43:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+     d46:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     d4b:	84 db                	test   %bl,%bl
+     d4d:	75 c7                	jne    d16 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+     d4f:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+     d53:	74 0b                	je     d60 <printf+0x90>
+    fflush(fd);
+}
+     d55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d58:	5b                   	pop    %ebx
+     d59:	5e                   	pop    %esi
+     d5a:	5f                   	pop    %edi
+     d5b:	5d                   	pop    %ebp
+     d5c:	c3                   	ret
+     d5d:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+     d60:	83 ec 0c             	sub    $0xc,%esp
+     d63:	6a 02                	push   $0x2
+     d65:	e8 c6 f7 ff ff       	call   530 <fflush>
+     d6a:	83 c4 10             	add    $0x10,%esp
+}
+     d6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d70:	5b                   	pop    %ebx
+     d71:	5e                   	pop    %esi
+     d72:	5f                   	pop    %edi
+     d73:	5d                   	pop    %ebp
+     d74:	c3                   	ret
+     d75:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+     d78:	83 ec 04             	sub    $0x4,%esp
+     d7b:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     d7e:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+     d82:	6a 01                	push   $0x1
+     d84:	52                   	push   %edx
+     d85:	89 55 c0             	mov    %edx,-0x40(%ebp)
+     d88:	ff 75 08             	push   0x8(%ebp)
+     d8b:	e8 00 f6 ff ff       	call   390 <bufwrite>
+     d90:	83 c4 0c             	add    $0xc,%esp
+     d93:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     d96:	6a 01                	push   $0x1
+     d98:	8b 55 c0             	mov    -0x40(%ebp),%edx
+     d9b:	52                   	push   %edx
+      state = 0;
+     d9c:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+     d9e:	ff 75 08             	push   0x8(%ebp)
+     da1:	e8 ea f5 ff ff       	call   390 <bufwrite>
+        putc(fd, c);
+     da6:	83 c4 10             	add    $0x10,%esp
+     da9:	e9 5e ff ff ff       	jmp    d0c <printf+0x3c>
+     dae:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+     db0:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     db3:	83 ec 0c             	sub    $0xc,%esp
+     db6:	b9 10 00 00 00       	mov    $0x10,%ecx
+     dbb:	8b 16                	mov    (%esi),%edx
+     dbd:	6a 00                	push   $0x0
+     dbf:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+     dc2:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+     dc5:	e8 66 fe ff ff       	call   c30 <printint>
+        ap++;
+     dca:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     dcd:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     dd0:	31 f6                	xor    %esi,%esi
+     dd2:	e9 35 ff ff ff       	jmp    d0c <printf+0x3c>
+     dd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dde:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     de0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     de3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     de5:	83 c0 04             	add    $0x4,%eax
+     de8:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+     deb:	b8 3b 12 00 00       	mov    $0x123b,%eax
+     df0:	85 db                	test   %ebx,%ebx
+     df2:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+     df5:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+     df8:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+     dfa:	53                   	push   %ebx
+     dfb:	e8 90 f9 ff ff       	call   790 <strlen>
+     e00:	83 c4 0c             	add    $0xc,%esp
+     e03:	50                   	push   %eax
+     e04:	53                   	push   %ebx
+     e05:	ff 75 08             	push   0x8(%ebp)
+     e08:	e8 83 f5 ff ff       	call   390 <bufwrite>
+     e0d:	83 c4 10             	add    $0x10,%esp
+     e10:	e9 f7 fe ff ff       	jmp    d0c <printf+0x3c>
+     e15:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+     e18:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+     e1b:	83 ec 04             	sub    $0x4,%esp
+     e1e:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+     e21:	8b 06                	mov    (%esi),%eax
+        ap++;
+     e23:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+     e26:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+     e29:	6a 01                	push   $0x1
+     e2b:	52                   	push   %edx
+     e2c:	ff 75 08             	push   0x8(%ebp)
+     e2f:	e8 5c f5 ff ff       	call   390 <bufwrite>
+        ap++;
+     e34:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     e37:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     e3a:	31 f6                	xor    %esi,%esi
+     e3c:	e9 cb fe ff ff       	jmp    d0c <printf+0x3c>
+     e41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+     e48:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     e4b:	83 ec 0c             	sub    $0xc,%esp
+     e4e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     e53:	8b 16                	mov    (%esi),%edx
+     e55:	6a 01                	push   $0x1
+     e57:	e9 63 ff ff ff       	jmp    dbf <printf+0xef>
+     e5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+     e60:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     e63:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     e66:	89 7d c0             	mov    %edi,-0x40(%ebp)
+     e69:	89 55 bc             	mov    %edx,-0x44(%ebp)
+     e6c:	8b 18                	mov    (%eax),%ebx
+     e6e:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+     e71:	31 c0                	xor    %eax,%eax
+     e73:	89 c7                	mov    %eax,%edi
+     e75:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+     e78:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+     e7d:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+     e7f:	f7 e1                	mul    %ecx
+     e81:	c1 ea 03             	shr    $0x3,%edx
+     e84:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     e87:	89 d1                	mov    %edx,%ecx
+     e89:	01 c0                	add    %eax,%eax
+     e8b:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     e8d:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+     e8f:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     e91:	be 0a 00 00 00       	mov    $0xa,%esi
+     e96:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+     e98:	89 da                	mov    %ebx,%edx
+     e9a:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+     e9c:	89 fe                	mov    %edi,%esi
+     e9e:	83 c7 01             	add    $0x1,%edi
+     ea1:	8d 42 30             	lea    0x30(%edx),%eax
+     ea4:	89 da                	mov    %ebx,%edx
+     ea6:	8d 14 92             	lea    (%edx,%edx,4),%edx
+     ea9:	01 d2                	add    %edx,%edx
+     eab:	29 d0                	sub    %edx,%eax
+     ead:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+     eb1:	89 c8                	mov    %ecx,%eax
+     eb3:	09 d8                	or     %ebx,%eax
+     eb5:	75 c1                	jne    e78 <printf+0x1a8>
+     eb7:	8b 55 bc             	mov    -0x44(%ebp),%edx
+     eba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     ebd:	01 d6                	add    %edx,%esi
+     ebf:	89 f7                	mov    %esi,%edi
+     ec1:	89 d6                	mov    %edx,%esi
+     ec3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ec7:	90                   	nop
+    putc(fd, buf[i]);
+     ec8:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+     ecb:	83 ec 04             	sub    $0x4,%esp
+     ece:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+     ed1:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+     ed4:	6a 01                	push   $0x1
+     ed6:	50                   	push   %eax
+     ed7:	53                   	push   %ebx
+     ed8:	e8 b3 f4 ff ff       	call   390 <bufwrite>
+  while(--i >= 0)
+     edd:	89 fa                	mov    %edi,%edx
+     edf:	83 c4 10             	add    $0x10,%esp
+     ee2:	83 ef 01             	sub    $0x1,%edi
+     ee5:	39 d6                	cmp    %edx,%esi
+     ee7:	75 df                	jne    ec8 <printf+0x1f8>
+        ap += 2;
+     ee9:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+     eed:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+     ef0:	31 f6                	xor    %esi,%esi
+     ef2:	e9 15 fe ff ff       	jmp    d0c <printf+0x3c>
+     ef7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     efe:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+     f00:	83 ec 04             	sub    $0x4,%esp
+     f03:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     f06:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     f09:	6a 01                	push   $0x1
+     f0b:	e9 8b fe ff ff       	jmp    d9b <printf+0xcb>
+
+00000f10 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     f10:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f11:	a1 c0 2a 00 00       	mov    0x2ac0,%eax
+{
+     f16:	89 e5                	mov    %esp,%ebp
+     f18:	57                   	push   %edi
+     f19:	56                   	push   %esi
+     f1a:	53                   	push   %ebx
+     f1b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     f1e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f28:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f2a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f2c:	39 ca                	cmp    %ecx,%edx
+     f2e:	73 30                	jae    f60 <free+0x50>
+     f30:	39 c1                	cmp    %eax,%ecx
+     f32:	72 04                	jb     f38 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f34:	39 c2                	cmp    %eax,%edx
+     f36:	72 f0                	jb     f28 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     f38:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     f3b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     f3e:	39 f8                	cmp    %edi,%eax
+     f40:	74 2e                	je     f70 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f42:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     f45:	8b 42 04             	mov    0x4(%edx),%eax
+     f48:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     f4b:	39 f1                	cmp    %esi,%ecx
+     f4d:	74 38                	je     f87 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     f4f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     f51:	5b                   	pop    %ebx
+  freep = p;
+     f52:	89 15 c0 2a 00 00    	mov    %edx,0x2ac0
+}
+     f58:	5e                   	pop    %esi
+     f59:	5f                   	pop    %edi
+     f5a:	5d                   	pop    %ebp
+     f5b:	c3                   	ret
+     f5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f60:	39 c1                	cmp    %eax,%ecx
+     f62:	72 d0                	jb     f34 <free+0x24>
+     f64:	eb c2                	jmp    f28 <free+0x18>
+     f66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f6d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+     f70:	03 70 04             	add    0x4(%eax),%esi
+     f73:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f76:	8b 02                	mov    (%edx),%eax
+     f78:	8b 00                	mov    (%eax),%eax
+     f7a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     f7d:	8b 42 04             	mov    0x4(%edx),%eax
+     f80:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     f83:	39 f1                	cmp    %esi,%ecx
+     f85:	75 c8                	jne    f4f <free+0x3f>
+    p->s.size += bp->s.size;
+     f87:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     f8a:	89 15 c0 2a 00 00    	mov    %edx,0x2ac0
+    p->s.size += bp->s.size;
+     f90:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     f93:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     f96:	89 0a                	mov    %ecx,(%edx)
+}
+     f98:	5b                   	pop    %ebx
+     f99:	5e                   	pop    %esi
+     f9a:	5f                   	pop    %edi
+     f9b:	5d                   	pop    %ebp
+     f9c:	c3                   	ret
+     f9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000fa0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     fa0:	55                   	push   %ebp
+     fa1:	89 e5                	mov    %esp,%ebp
+     fa3:	57                   	push   %edi
+     fa4:	56                   	push   %esi
+     fa5:	53                   	push   %ebx
+     fa6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     fa9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+     fac:	8b 15 c0 2a 00 00    	mov    0x2ac0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     fb2:	8d 78 07             	lea    0x7(%eax),%edi
+     fb5:	c1 ef 03             	shr    $0x3,%edi
+     fb8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+     fbb:	85 d2                	test   %edx,%edx
+     fbd:	0f 84 8d 00 00 00    	je     1050 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     fc3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     fc5:	8b 48 04             	mov    0x4(%eax),%ecx
+     fc8:	39 f9                	cmp    %edi,%ecx
+     fca:	73 64                	jae    1030 <malloc+0x90>
+  if(nu < 4096)
+     fcc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     fd1:	39 df                	cmp    %ebx,%edi
+     fd3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     fd6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     fdd:	eb 0a                	jmp    fe9 <malloc+0x49>
+     fdf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     fe0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     fe2:	8b 48 04             	mov    0x4(%eax),%ecx
+     fe5:	39 f9                	cmp    %edi,%ecx
+     fe7:	73 47                	jae    1030 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     fe9:	89 c2                	mov    %eax,%edx
+     feb:	39 05 c0 2a 00 00    	cmp    %eax,0x2ac0
+     ff1:	75 ed                	jne    fe0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+     ff3:	83 ec 0c             	sub    $0xc,%esp
+     ff6:	56                   	push   %esi
+     ff7:	e8 c7 fa ff ff       	call   ac3 <sbrk>
+  if(p == (char*)-1)
+     ffc:	83 c4 10             	add    $0x10,%esp
+     fff:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1002:	74 1c                	je     1020 <malloc+0x80>
+  hp->s.size = nu;
+    1004:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1007:	83 ec 0c             	sub    $0xc,%esp
+    100a:	83 c0 08             	add    $0x8,%eax
+    100d:	50                   	push   %eax
+    100e:	e8 fd fe ff ff       	call   f10 <free>
+  return freep;
+    1013:	8b 15 c0 2a 00 00    	mov    0x2ac0,%edx
+      if((p = morecore(nunits)) == 0)
+    1019:	83 c4 10             	add    $0x10,%esp
+    101c:	85 d2                	test   %edx,%edx
+    101e:	75 c0                	jne    fe0 <malloc+0x40>
+        return 0;
+  }
+}
+    1020:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1023:	31 c0                	xor    %eax,%eax
+}
+    1025:	5b                   	pop    %ebx
+    1026:	5e                   	pop    %esi
+    1027:	5f                   	pop    %edi
+    1028:	5d                   	pop    %ebp
+    1029:	c3                   	ret
+    102a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1030:	39 cf                	cmp    %ecx,%edi
+    1032:	74 4c                	je     1080 <malloc+0xe0>
+        p->s.size -= nunits;
+    1034:	29 f9                	sub    %edi,%ecx
+    1036:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1039:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    103c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    103f:	89 15 c0 2a 00 00    	mov    %edx,0x2ac0
+}
+    1045:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1048:	83 c0 08             	add    $0x8,%eax
+}
+    104b:	5b                   	pop    %ebx
+    104c:	5e                   	pop    %esi
+    104d:	5f                   	pop    %edi
+    104e:	5d                   	pop    %ebp
+    104f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1050:	c7 05 c0 2a 00 00 c4 	movl   $0x2ac4,0x2ac0
+    1057:	2a 00 00 
+    base.s.size = 0;
+    105a:	b8 c4 2a 00 00       	mov    $0x2ac4,%eax
+    base.s.ptr = freep = prevp = &base;
+    105f:	c7 05 c4 2a 00 00 c4 	movl   $0x2ac4,0x2ac4
+    1066:	2a 00 00 
+    base.s.size = 0;
+    1069:	c7 05 c8 2a 00 00 00 	movl   $0x0,0x2ac8
+    1070:	00 00 00 
+    if(p->s.size >= nunits){
+    1073:	e9 54 ff ff ff       	jmp    fcc <malloc+0x2c>
+    1078:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    107f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1080:	8b 08                	mov    (%eax),%ecx
+    1082:	89 0a                	mov    %ecx,(%edx)
+    1084:	eb b9                	jmp    103f <malloc+0x9f>
+    1086:	66 90                	xchg   %ax,%ax
+    1088:	66 90                	xchg   %ax,%ax
+    108a:	66 90                	xchg   %ax,%ax
+    108c:	66 90                	xchg   %ax,%ax
+    108e:	66 90                	xchg   %ax,%ax
+
+00001090 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+    1090:	55                   	push   %ebp
+    1091:	89 e5                	mov    %esp,%ebp
+    1093:	57                   	push   %edi
+    1094:	56                   	push   %esi
+    1095:	be 01 00 00 00       	mov    $0x1,%esi
+    109a:	53                   	push   %ebx
+    109b:	83 ec 28             	sub    $0x28,%esp
+    109e:	8b 45 0c             	mov    0xc(%ebp),%eax
+    10a1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    10a4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+    10a7:	68 00 98 00 00       	push   $0x9800
+    10ac:	e8 ef fe ff ff       	call   fa0 <malloc>
+    10b1:	83 c4 10             	add    $0x10,%esp
+    10b4:	89 c7                	mov    %eax,%edi
+    10b6:	85 c0                	test   %eax,%eax
+    10b8:	74 62                	je     111c <waitpoll+0x8c>
+    10ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+    10c0:	83 ec 0c             	sub    $0xc,%esp
+    10c3:	6a 01                	push   $0x1
+    10c5:	e8 03 fa ff ff       	call   acd <sleep>
+    fn();
+    10ca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    10cd:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+    10cf:	58                   	pop    %eax
+    10d0:	5a                   	pop    %edx
+    10d1:	68 00 02 00 00       	push   $0x200
+    10d6:	57                   	push   %edi
+    10d7:	e8 eb fa ff ff       	call   bc7 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+    10dc:	83 c4 10             	add    $0x10,%esp
+    10df:	85 c0                	test   %eax,%eax
+    10e1:	7e 2d                	jle    1110 <waitpoll+0x80>
+    10e3:	6b c0 4c             	imul   $0x4c,%eax,%eax
+    10e6:	89 fa                	mov    %edi,%edx
+    alive = 0;
+    10e8:	31 c9                	xor    %ecx,%ecx
+    10ea:	01 f8                	add    %edi,%eax
+    10ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+    10f0:	3b 1a                	cmp    (%edx),%ebx
+    10f2:	75 07                	jne    10fb <waitpoll+0x6b>
+        alive = 1;
+    10f4:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+    10f8:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+    10fb:	83 c2 4c             	add    $0x4c,%edx
+    10fe:	39 d0                	cmp    %edx,%eax
+    1100:	75 ee                	jne    10f0 <waitpoll+0x60>
+  } while(alive);
+    1102:	85 c9                	test   %ecx,%ecx
+    1104:	75 ba                	jne    10c0 <waitpoll+0x30>
+    1106:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    110d:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+    1110:	83 ec 0c             	sub    $0xc,%esp
+    1113:	57                   	push   %edi
+    1114:	e8 f7 fd ff ff       	call   f10 <free>
+  wait();
+    1119:	83 c4 10             	add    $0x10,%esp
+}
+    111c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    111f:	5b                   	pop    %ebx
+    1120:	5e                   	pop    %esi
+    1121:	5f                   	pop    %edi
+    1122:	5d                   	pop    %ebp
+  wait();
+    1123:	e9 10 f9 ff ff       	jmp    a38 <wait>
+    1128:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    112f:	90                   	nop
+
+00001130 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+    1130:	55                   	push   %ebp
+    1131:	89 e5                	mov    %esp,%ebp
+    1133:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+    1136:	c7 45 f0 ad 12 00 00 	movl   $0x12ad,-0x10(%ebp)
+    113d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+    1144:	e8 87 f4 ff ff       	call   5d0 <fork>
+    1149:	85 c0                	test   %eax,%eax
+    114b:	78 09                	js     1156 <runps+0x26>
+    return -1;
+  if(pid == 0){
+    114d:	74 0e                	je     115d <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+    114f:	e8 e4 f8 ff ff       	call   a38 <wait>
+}
+    1154:	c9                   	leave
+    1155:	c3                   	ret
+    1156:	c9                   	leave
+    return -1;
+    1157:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    115c:	c3                   	ret
+    exec("ps", argv);
+    115d:	50                   	push   %eax
+    115e:	50                   	push   %eax
+    115f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    1162:	50                   	push   %eax
+    1163:	68 ad 12 00 00       	push   $0x12ad
+    1168:	e8 c3 f4 ff ff       	call   630 <exec>
+    printf(2, "exec ps failed\n");
+    116d:	5a                   	pop    %edx
+    116e:	59                   	pop    %ecx
+    116f:	68 b0 12 00 00       	push   $0x12b0
+    1174:	6a 02                	push   $0x2
+    1176:	e8 55 fb ff ff       	call   cd0 <printf>
+    exit();
+    117b:	e8 a0 f4 ff ff       	call   620 <exit>
@@ -0,0 +1,117 @@
+// Time copying a file with read()/write(), with
+// copy_file_range(), and with copy_file().
+//
+// usage: copybench [kb]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "logstat.h"
+
+#define SRC "copybench.src"
+#define DST "copybench.dst"
+
+char buf[512];
+
+void
+makesrc(int kb)
+{
+  int fd, i;
+
+  if((fd = open(SRC, O_CREATE|O_RDWR)) < 0){
+    printf(2, "copybench: cannot create %s\n", SRC);
+    exit();
+  }
+  for(i = 0; i < 2*kb; i++){
+    memset(buf, 'a' + i % 26, sizeof(buf));
+    write(fd, buf, sizeof(buf));
+  }
+  close(fd);
+}
+
+void
+readwrite(void)
+{
+  int in, out, n;
+
+  in = open(SRC, O_RDONLY);
+  out = open(DST, O_CREATE|O_RDWR);
+  while((n = read(in, buf, sizeof(buf))) > 0)
+    write(out, buf, n);
+  close(in);
+  close(out);
+}
+
+void
+copyrange(void)
+{
+  int in, out;
+
+  in = open(SRC, O_RDONLY);
+  out = open(DST, O_CREATE|O_RDWR);
+  while(copy_file_range(in, out, 64*1024) > 0)
+    ;
+  close(in);
+  close(out);
+}
+
+void
+copypath(void)
+{
+  copy_file(SRC, DST);
+}
+
+// Check that DST matches what makesrc() wrote.
+void
+verify(int kb)
+{
+  int fd, i;
+
+  if((fd = open(DST, O_RDONLY)) < 0){
+    printf(2, "copybench: cannot open %s\n", DST);
+    exit();
+  }
+  for(i = 0; i < 2*kb; i++){
+    if(read(fd, buf, sizeof(buf)) != sizeof(buf) ||
+       buf[0] != 'a' + i % 26 || buf[511] != 'a' + i % 26){
+      printf(2, "copybench: block %d is wrong\n", i);
+      exit();
+    }
+  }
+  close(fd);
+}
+
+void
+run(char *name, void (*copy)(void), int kb)
+{
+  struct logstat a, b;
+  int t;
+
+  unlink(DST);
+  logstat(&a);
+  t = uptime();
+  copy();
+  t = uptime() - t;
+  logstat(&b);
+  verify(kb);
+  printf(1, "%s: %d KB, %d commits in %d ticks\n",
+         name, kb, b.commits - a.commits, t);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int kb;
+
+  kb = argc > 1 ? atoi(argv[1]) : 256;
+  makesrc(kb);
+
+  run("read/write", readwrite, kb);
+  run("copy_file_range", copyrange, kb);
+  run("copy_file", copypath, kb);
+
+  unlink(SRC);
+  unlink(DST);
+  exit();
+}
@@ -1,20 +1,31 @@
 struct buf;
 struct context;
 struct file;
+struct icachestat;
 struct inode;
+struct lockstat;
+struct iovec;
+struct logstat;
 struct pipe;
 struct proc;
+struct procinfo;
+struct profsample;
 struct rtcdate;
+struct schedlat;
 struct spinlock;
+struct trapframe;
 struct sleeplock;
 struct stat;
 struct superblock;
+struct traceev;
 
 // bio.c
 void            binit(void);
 struct buf*     bread(uint, uint);
 void            brelse(struct buf*);
 void            bwrite(struct buf*);
+void            bwritev(struct buf**, int);
+void            bwritevat(struct buf**, uint*, int);
 
 // console.c
 void            consoleinit(void);
@@ -27,16 +38,26 @@ int             exec(char*, char**);
 
 // file.c
 struct file*    filealloc(void);
+int             filecopy(struct file*, struct file*, int);
 void            fileclose(struct file*);
 struct file*    filedup(struct file*);
 void            fileinit(void);
 int             fileread(struct file*, char*, int n);
+int             filereadv(struct file*, struct iovec*, int, uint*);
 int             filestat(struct file*, struct stat*);
 int             filewrite(struct file*, char*, int n);
+int             filewritev(struct file*, struct iovec*, int, uint*);
+int             copyrange(struct inode*, uint*, struct inode*, uint*, int);
 
 // fs.c
+void            ballocinit(int);
+uint            bfreecount(void);
 void            readsb(int dev, struct superblock *sb);
 int             dirlink(struct inode*, char*, uint);
+void            iflush(struct inode*);
+void            icache_stat(struct icachestat*);
+int             icopy(struct inode*, uint, struct inode*, uint, uint);
+void            dirunlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
 struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
@@ -51,12 +72,17 @@ struct inode*   namei(char*);
 struct inode*   nameiparent(char*, char*);
 int             readi(struct inode*, char*, uint, uint);
 void            stati(struct inode*, struct stat*);
+int             wbappend(struct inode*, char*, uint, uint);
+int             wbbusy(struct inode*, uint, uint);
+void            wbflusher(void);
 int             writei(struct inode*, char*, uint, uint);
 
 // ide.c
 void            ideinit(void);
 void            ideintr(void);
 void            iderw(struct buf*);
+void            iderwv(struct buf**, int);
+int             idesetmode(int);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
@@ -78,15 +104,34 @@ int             lapicid(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
 void            lapicinit(void);
+void            lapicrate(int);
 void            lapicstartap(uchar, uint);
 void            microdelay(int);
+void            tscinit(void);
+uint64          tsc2us(uint64);
+extern uint     tsckhz;
 
 // log.c
 void            initlog(int dev);
 void            log_write(struct buf*);
+void            log_writedata(struct buf*);
+void            log_freed(uint);
+int             log_isfreed(uint);
+void            log_stat(struct logstat*);
+void            log_sync(void);
 void            begin_op();
 void            end_op();
 
+// mmap.c
+uint            mmap(struct file*, uint, uint, int, int);
+int             munmap(struct proc*, uint, uint);
+void            munmapall(struct proc*);
+int             mmapdup(struct proc*, struct proc*);
+int             mmapfault(struct proc*, uint, int);
+int             mmapcheck(struct proc*, uint, uint, int);
+void            mmapinit(void);
+void            mmapsync(struct inode*, uint, char*, uint);
+
 // mp.c
 extern int      ismp;
 void            mpinit(void);
@@ -99,6 +144,7 @@ void            picinit(void);
 int             pipealloc(struct file**, struct file**);
 void            pipeclose(struct pipe*, int);
 int             piperead(struct pipe*, char*, int);
+int             pipereadv(struct pipe*, struct iovec*, int);
 int             pipewrite(struct pipe*, char*, int);
 
 //PAGEBREAK: 16
@@ -108,29 +154,45 @@ void            exit(void);
 int             fork(void);
 int             growproc(int);
 int             kill(int);
+int             getprocinfo(struct procinfo*, int);
+void            kthread(void (*)(void), char*);
 struct cpu*     mycpu(void);
 struct proc*    myproc();
 void            pinit(void);
 void            procdump(void);
 void            scheduler(void) __attribute__((noreturn));
+int             schedlat(struct schedlat*, int);
 void            sched(void);
 void            setproc(struct proc*);
 void            sleep(void*, struct spinlock*);
 void            userinit(void);
 int             wait(void);
-int             waitx(int*, int*);  // Add declaration for waitx
+int             waitx(uint64*, uint64*);
 void            wakeup(void*);
+int             wakeup_one(void*);
 void            yield(void);
 int             get_uncle_count(int);
+int             proclifetime(int);
+void            setscheduler(int);
 
 // swtch.S
 void            swtch(struct context**, struct context*);
 
+// prof.c
+void            profinit(void);
+int             proftick(struct trapframe*);
+int             profctl(int);
+int             profread(struct profsample*, int);
+
 // spinlock.c
 void            acquire(struct spinlock*);
+void            droplock(struct spinlock*);
 void            getcallerpcs(void*, uint*);
 int             holding(struct spinlock*);
 void            initlock(struct spinlock*, char*);
+int             lockstat(struct lockstat*, int, int);
+int             lockbench(int);
+void            lockbenchinit(void);
 void            release(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
@@ -153,7 +215,9 @@ char*           strncpy(char*, const char*, int);
 // syscall.c
 int             argint(int, int*);
 int             argptr(int, char**, int);
+int             argptr_ro(int, char**, int);
 int             argstr(int, char**);
+int             fetchbuf(uint, int, int);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
 void            syscall(void);
@@ -161,8 +225,15 @@ void            syscall(void);
 // timer.c
 void            timerinit(void);
 
+// trace.c
+void            traceinit(void);
+void            trace(int, int, int);
+int             tracectl(int);
+int             traceread(struct traceev*, int);
+
 // trap.c
 void            idtinit(void);
+void            sysenterinit(void);
 extern uint     ticks;
 void            tvinit(void);
 extern struct spinlock tickslock;
@@ -187,6 +258,8 @@ void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
+pte_t*          walkpgdir(pde_t*, const void*, int);
+int             mappages(pde_t*, void*, uint, uint, int);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
@@ -0,0 +1,2288 @@
+
+_dirbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  *p = 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 38             	sub    $0x38,%esp
+      14:	8b 19                	mov    (%ecx),%ebx
+      16:	8b 71 04             	mov    0x4(%ecx),%esi
+  struct stat st;
+  int n, i, fd, t, linear;
+
+  linear = argc > 1 && strcmp(argv[1], "-l") == 0;
+  n = argc > 1 + linear ? atoi(argv[1 + linear]) : 4000;
+      19:	c7 45 c0 a0 0f 00 00 	movl   $0xfa0,-0x40(%ebp)
+  linear = argc > 1 && strcmp(argv[1], "-l") == 0;
+      20:	83 fb 01             	cmp    $0x1,%ebx
+      23:	0f 8f 2c 01 00 00    	jg     155 <main+0x155>
+  if((linear ? mkdir(DIR) : mkhdir(DIR)) < 0){
+      29:	83 ec 0c             	sub    $0xc,%esp
+      2c:	68 70 11 00 00       	push   $0x1170
+      31:	e8 cb 0b 00 00       	call   c01 <mkhdir>
+      36:	83 c4 10             	add    $0x10,%esp
+      39:	85 c0                	test   %eax,%eax
+      3b:	0f 88 fd 00 00 00    	js     13e <main+0x13e>
+    printf(2, "dirbench: cannot create %s\n", DIR);
+    exit();
+  }
+  if((fd = open(DIR "/file", O_CREATE|O_RDWR)) < 0){
+      41:	50                   	push   %eax
+      42:	50                   	push   %eax
+      43:	68 02 02 00 00       	push   $0x202
+      48:	68 97 11 00 00       	push   $0x1197
+      4d:	e8 f7 09 00 00       	call   a49 <open>
+      52:	83 c4 10             	add    $0x10,%esp
+      55:	85 c0                	test   %eax,%eax
+      57:	0f 88 24 01 00 00    	js     181 <main+0x181>
+    printf(2, "dirbench: cannot create %s/file\n", DIR);
+    exit();
+  }
+  close(fd);
+      5d:	83 ec 0c             	sub    $0xc,%esp
+      60:	50                   	push   %eax
+      61:	e8 0a 06 00 00       	call   670 <close>
+
+  t = uptime();
+      66:	e8 4c 0a 00 00       	call   ab7 <uptime>
+  for(i = 0; i < n; i++){
+      6b:	83 c4 10             	add    $0x10,%esp
+      6e:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+  t = uptime();
+      72:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < n; i++){
+      74:	0f 8e 0f 02 00 00    	jle    289 <main+0x289>
+      7a:	89 45 bc             	mov    %eax,-0x44(%ebp)
+      7d:	31 ff                	xor    %edi,%edi
+    *p++ = '0' + n % 10;
+      7f:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+      84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  strcpy(name, DIR "/x");
+      88:	83 ec 08             	sub    $0x8,%esp
+      8b:	68 60 11 00 00       	push   $0x1160
+      90:	68 a0 17 00 00       	push   $0x17a0
+      95:	e8 46 06 00 00       	call   6e0 <strcpy>
+  p = name + strlen(name);
+      9a:	c7 04 24 a0 17 00 00 	movl   $0x17a0,(%esp)
+      a1:	e8 ca 06 00 00       	call   770 <strlen>
+      a6:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+      a9:	83 c4 10             	add    $0x10,%esp
+      ac:	89 f9                	mov    %edi,%ecx
+      ae:	8d 98 a0 17 00 00    	lea    0x17a0(%eax),%ebx
+  n = i;
+      b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    *p++ = '0' + n % 10;
+      b8:	89 c8                	mov    %ecx,%eax
+      ba:	83 c3 01             	add    $0x1,%ebx
+      bd:	f7 e6                	mul    %esi
+      bf:	89 c8                	mov    %ecx,%eax
+      c1:	c1 ea 03             	shr    $0x3,%edx
+      c4:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+      c7:	01 ff                	add    %edi,%edi
+      c9:	29 f8                	sub    %edi,%eax
+      cb:	83 c0 30             	add    $0x30,%eax
+      ce:	88 43 ff             	mov    %al,-0x1(%ebx)
+    n /= 10;
+      d1:	89 c8                	mov    %ecx,%eax
+      d3:	89 d1                	mov    %edx,%ecx
+  } while(n > 0);
+      d5:	83 f8 09             	cmp    $0x9,%eax
+      d8:	7f de                	jg     b8 <main+0xb8>
+    mkname(i);
+    if(link(DIR "/file", name) < 0){
+      da:	83 ec 08             	sub    $0x8,%esp
+  *p = 0;
+      dd:	c6 03 00             	movb   $0x0,(%ebx)
+      e0:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+    if(link(DIR "/file", name) < 0){
+      e3:	68 a0 17 00 00       	push   $0x17a0
+      e8:	68 97 11 00 00       	push   $0x1197
+      ed:	e8 7f 09 00 00       	call   a71 <link>
+      f2:	83 c4 10             	add    $0x10,%esp
+      f5:	85 c0                	test   %eax,%eax
+      f7:	0f 88 10 01 00 00    	js     20d <main+0x20d>
+  for(i = 0; i < n; i++){
+      fd:	8d 57 01             	lea    0x1(%edi),%edx
+     100:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+     103:	0f 84 8f 00 00 00    	je     198 <main+0x198>
+     109:	89 d7                	mov    %edx,%edi
+     10b:	e9 78 ff ff ff       	jmp    88 <main+0x88>
+  n = argc > 1 + linear ? atoi(argv[1 + linear]) : 4000;
+     110:	83 fb 02             	cmp    $0x2,%ebx
+     113:	74 11                	je     126 <main+0x126>
+     115:	83 ec 0c             	sub    $0xc,%esp
+     118:	ff 76 08             	push   0x8(%esi)
+     11b:	e8 40 08 00 00       	call   960 <atoi>
+     120:	83 c4 10             	add    $0x10,%esp
+     123:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if((linear ? mkdir(DIR) : mkhdir(DIR)) < 0){
+     126:	83 ec 0c             	sub    $0xc,%esp
+     129:	68 70 11 00 00       	push   $0x1170
+     12e:	e8 48 09 00 00       	call   a7b <mkdir>
+     133:	83 c4 10             	add    $0x10,%esp
+     136:	85 c0                	test   %eax,%eax
+     138:	0f 89 03 ff ff ff    	jns    41 <main+0x41>
+    printf(2, "dirbench: cannot create %s\n", DIR);
+     13e:	50                   	push   %eax
+     13f:	68 70 11 00 00       	push   $0x1170
+     144:	68 7b 11 00 00       	push   $0x117b
+     149:	6a 02                	push   $0x2
+     14b:	e8 60 0b 00 00       	call   cb0 <printf>
+    exit();
+     150:	e8 ab 04 00 00       	call   600 <exit>
+  linear = argc > 1 && strcmp(argv[1], "-l") == 0;
+     155:	52                   	push   %edx
+     156:	52                   	push   %edx
+     157:	68 6d 11 00 00       	push   $0x116d
+     15c:	ff 76 04             	push   0x4(%esi)
+     15f:	e8 ac 05 00 00       	call   710 <strcmp>
+     164:	83 c4 10             	add    $0x10,%esp
+     167:	85 c0                	test   %eax,%eax
+     169:	74 a5                	je     110 <main+0x110>
+  n = argc > 1 + linear ? atoi(argv[1 + linear]) : 4000;
+     16b:	83 ec 0c             	sub    $0xc,%esp
+     16e:	ff 76 04             	push   0x4(%esi)
+     171:	e8 ea 07 00 00       	call   960 <atoi>
+     176:	83 c4 10             	add    $0x10,%esp
+     179:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if((linear ? mkdir(DIR) : mkhdir(DIR)) < 0){
+     17c:	e9 a8 fe ff ff       	jmp    29 <main+0x29>
+    printf(2, "dirbench: cannot create %s/file\n", DIR);
+     181:	50                   	push   %eax
+     182:	68 70 11 00 00       	push   $0x1170
+     187:	68 54 12 00 00       	push   $0x1254
+     18c:	6a 02                	push   $0x2
+     18e:	e8 1d 0b 00 00       	call   cb0 <printf>
+    exit();
+     193:	e8 68 04 00 00       	call   600 <exit>
+      printf(2, "dirbench: link %s failed\n", name);
+      exit();
+    }
+  }
+  printf(1, "create: %d names in %d ticks\n", n, uptime() - t);
+     198:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+     19b:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+
+  t = uptime();
+  for(i = 0; i < n; i++){
+     19e:	31 f6                	xor    %esi,%esi
+  printf(1, "create: %d names in %d ticks\n", n, uptime() - t);
+     1a0:	e8 12 09 00 00       	call   ab7 <uptime>
+     1a5:	29 d8                	sub    %ebx,%eax
+     1a7:	8d 5d d4             	lea    -0x2c(%ebp),%ebx
+     1aa:	50                   	push   %eax
+     1ab:	ff 75 c0             	push   -0x40(%ebp)
+     1ae:	68 c1 11 00 00       	push   $0x11c1
+     1b3:	6a 01                	push   $0x1
+     1b5:	e8 f6 0a 00 00       	call   cb0 <printf>
+  t = uptime();
+     1ba:	e8 f8 08 00 00       	call   ab7 <uptime>
+     1bf:	83 c4 10             	add    $0x10,%esp
+     1c2:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  for(i = 0; i < n; i++){
+     1c5:	eb 12                	jmp    1d9 <main+0x1d9>
+     1c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ce:	66 90                	xchg   %ax,%ax
+     1d0:	8d 46 01             	lea    0x1(%esi),%eax
+     1d3:	39 f7                	cmp    %esi,%edi
+     1d5:	74 4d                	je     224 <main+0x224>
+     1d7:	89 c6                	mov    %eax,%esi
+    mkname(i);
+     1d9:	83 ec 0c             	sub    $0xc,%esp
+     1dc:	56                   	push   %esi
+     1dd:	e8 1e 01 00 00       	call   300 <mkname>
+    if(stat(name, &st) < 0){
+     1e2:	59                   	pop    %ecx
+     1e3:	58                   	pop    %eax
+     1e4:	53                   	push   %ebx
+     1e5:	68 a0 17 00 00       	push   $0x17a0
+     1ea:	e8 d1 06 00 00       	call   8c0 <stat>
+     1ef:	83 c4 10             	add    $0x10,%esp
+     1f2:	85 c0                	test   %eax,%eax
+     1f4:	79 da                	jns    1d0 <main+0x1d0>
+      printf(2, "dirbench: stat %s failed\n", name);
+     1f6:	52                   	push   %edx
+     1f7:	68 a0 17 00 00       	push   $0x17a0
+     1fc:	68 df 11 00 00       	push   $0x11df
+     201:	6a 02                	push   $0x2
+     203:	e8 a8 0a 00 00       	call   cb0 <printf>
+      exit();
+     208:	e8 f3 03 00 00       	call   600 <exit>
+      printf(2, "dirbench: link %s failed\n", name);
+     20d:	50                   	push   %eax
+     20e:	68 a0 17 00 00       	push   $0x17a0
+     213:	68 a7 11 00 00       	push   $0x11a7
+     218:	6a 02                	push   $0x2
+     21a:	e8 91 0a 00 00       	call   cb0 <printf>
+      exit();
+     21f:	e8 dc 03 00 00       	call   600 <exit>
+    }
+  }
+  printf(1, "lookup: %d names in %d ticks\n", n, uptime() - t);
+     224:	e8 8e 08 00 00       	call   ab7 <uptime>
+     229:	8b 75 bc             	mov    -0x44(%ebp),%esi
+     22c:	29 f0                	sub    %esi,%eax
+
+  t = uptime();
+  for(i = 0; i < n; i++){
+     22e:	31 f6                	xor    %esi,%esi
+  printf(1, "lookup: %d names in %d ticks\n", n, uptime() - t);
+     230:	50                   	push   %eax
+     231:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     234:	52                   	push   %edx
+     235:	68 f9 11 00 00       	push   $0x11f9
+     23a:	6a 01                	push   $0x1
+     23c:	e8 6f 0a 00 00       	call   cb0 <printf>
+  t = uptime();
+     241:	e8 71 08 00 00       	call   ab7 <uptime>
+     246:	83 c4 10             	add    $0x10,%esp
+     249:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < n; i++){
+     24b:	eb 09                	jmp    256 <main+0x256>
+     24d:	8d 46 01             	lea    0x1(%esi),%eax
+     250:	39 fe                	cmp    %edi,%esi
+     252:	74 73                	je     2c7 <main+0x2c7>
+     254:	89 c6                	mov    %eax,%esi
+    mkname(i);
+     256:	83 ec 0c             	sub    $0xc,%esp
+     259:	56                   	push   %esi
+     25a:	e8 a1 00 00 00       	call   300 <mkname>
+    if(unlink(name) < 0){
+     25f:	c7 04 24 a0 17 00 00 	movl   $0x17a0,(%esp)
+     266:	e8 f2 07 00 00       	call   a5d <unlink>
+     26b:	83 c4 10             	add    $0x10,%esp
+     26e:	85 c0                	test   %eax,%eax
+     270:	79 db                	jns    24d <main+0x24d>
+      printf(2, "dirbench: unlink %s failed\n", name);
+     272:	50                   	push   %eax
+     273:	68 a0 17 00 00       	push   $0x17a0
+     278:	68 17 12 00 00       	push   $0x1217
+     27d:	6a 02                	push   $0x2
+     27f:	e8 2c 0a 00 00       	call   cb0 <printf>
+      exit();
+     284:	e8 77 03 00 00       	call   600 <exit>
+  printf(1, "create: %d names in %d ticks\n", n, uptime() - t);
+     289:	e8 29 08 00 00       	call   ab7 <uptime>
+     28e:	29 d8                	sub    %ebx,%eax
+     290:	50                   	push   %eax
+     291:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     294:	56                   	push   %esi
+     295:	68 c1 11 00 00       	push   $0x11c1
+     29a:	6a 01                	push   $0x1
+     29c:	e8 0f 0a 00 00       	call   cb0 <printf>
+  t = uptime();
+     2a1:	e8 11 08 00 00       	call   ab7 <uptime>
+     2a6:	89 c3                	mov    %eax,%ebx
+  printf(1, "lookup: %d names in %d ticks\n", n, uptime() - t);
+     2a8:	e8 0a 08 00 00       	call   ab7 <uptime>
+     2ad:	29 d8                	sub    %ebx,%eax
+     2af:	50                   	push   %eax
+     2b0:	56                   	push   %esi
+     2b1:	68 f9 11 00 00       	push   $0x11f9
+     2b6:	6a 01                	push   $0x1
+     2b8:	e8 f3 09 00 00       	call   cb0 <printf>
+  t = uptime();
+     2bd:	83 c4 20             	add    $0x20,%esp
+     2c0:	e8 f2 07 00 00       	call   ab7 <uptime>
+     2c5:	89 c3                	mov    %eax,%ebx
+    }
+  }
+  printf(1, "unlink: %d names in %d ticks\n", n, uptime() - t);
+     2c7:	e8 eb 07 00 00       	call   ab7 <uptime>
+     2cc:	29 d8                	sub    %ebx,%eax
+     2ce:	50                   	push   %eax
+     2cf:	ff 75 c0             	push   -0x40(%ebp)
+     2d2:	68 33 12 00 00       	push   $0x1233
+     2d7:	6a 01                	push   $0x1
+     2d9:	e8 d2 09 00 00       	call   cb0 <printf>
+
+  unlink(DIR "/file");
+     2de:	c7 04 24 97 11 00 00 	movl   $0x1197,(%esp)
+     2e5:	e8 73 07 00 00       	call   a5d <unlink>
+  unlink(DIR);
+     2ea:	c7 04 24 70 11 00 00 	movl   $0x1170,(%esp)
+     2f1:	e8 67 07 00 00       	call   a5d <unlink>
+  exit();
+     2f6:	e8 05 03 00 00       	call   600 <exit>
+     2fb:	66 90                	xchg   %ax,%ax
+     2fd:	66 90                	xchg   %ax,%ax
+     2ff:	90                   	nop
+
+00000300 <mkname>:
+{
+     300:	55                   	push   %ebp
+     301:	89 e5                	mov    %esp,%ebp
+     303:	57                   	push   %edi
+     304:	56                   	push   %esi
+    *p++ = '0' + n % 10;
+     305:	be 67 66 66 66       	mov    $0x66666667,%esi
+{
+     30a:	53                   	push   %ebx
+     30b:	83 ec 14             	sub    $0x14,%esp
+     30e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  strcpy(name, DIR "/x");
+     311:	68 60 11 00 00       	push   $0x1160
+     316:	68 a0 17 00 00       	push   $0x17a0
+     31b:	e8 c0 03 00 00       	call   6e0 <strcpy>
+  p = name + strlen(name);
+     320:	c7 04 24 a0 17 00 00 	movl   $0x17a0,(%esp)
+     327:	e8 44 04 00 00       	call   770 <strlen>
+     32c:	83 c4 10             	add    $0x10,%esp
+     32f:	8d 88 a0 17 00 00    	lea    0x17a0(%eax),%ecx
+  n = i;
+     335:	8d 76 00             	lea    0x0(%esi),%esi
+    *p++ = '0' + n % 10;
+     338:	89 d8                	mov    %ebx,%eax
+     33a:	83 c1 01             	add    $0x1,%ecx
+     33d:	f7 ee                	imul   %esi
+     33f:	89 d8                	mov    %ebx,%eax
+     341:	c1 f8 1f             	sar    $0x1f,%eax
+     344:	c1 fa 02             	sar    $0x2,%edx
+     347:	29 c2                	sub    %eax,%edx
+     349:	89 d8                	mov    %ebx,%eax
+     34b:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+     34e:	01 ff                	add    %edi,%edi
+     350:	29 f8                	sub    %edi,%eax
+     352:	83 c0 30             	add    $0x30,%eax
+     355:	88 41 ff             	mov    %al,-0x1(%ecx)
+    n /= 10;
+     358:	89 d8                	mov    %ebx,%eax
+     35a:	89 d3                	mov    %edx,%ebx
+  } while(n > 0);
+     35c:	83 f8 09             	cmp    $0x9,%eax
+     35f:	7f d7                	jg     338 <mkname+0x38>
+  *p = 0;
+     361:	c6 01 00             	movb   $0x0,(%ecx)
+}
+     364:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     367:	5b                   	pop    %ebx
+     368:	5e                   	pop    %esi
+     369:	5f                   	pop    %edi
+     36a:	5d                   	pop    %ebp
+     36b:	c3                   	ret
+     36c:	66 90                	xchg   %ax,%ax
+     36e:	66 90                	xchg   %ax,%ax
+
+00000370 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+     373:	57                   	push   %edi
+     374:	56                   	push   %esi
+     375:	53                   	push   %ebx
+     376:	83 ec 4c             	sub    $0x4c,%esp
+     379:	8b 45 0c             	mov    0xc(%ebp),%eax
+     37c:	8b 55 08             	mov    0x8(%ebp),%edx
+     37f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     382:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+     385:	83 fa 0f             	cmp    $0xf,%edx
+     388:	0f 87 32 01 00 00    	ja     4c0 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+     38e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     394:	8b 80 c0 17 00 00    	mov    0x17c0(%eax),%eax
+     39a:	85 c0                	test   %eax,%eax
+     39c:	0f 84 de 00 00 00    	je     480 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+     3a2:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     3a8:	8b b0 c4 17 00 00    	mov    0x17c4(%eax),%esi
+     3ae:	8d 88 c0 17 00 00    	lea    0x17c0(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+     3b4:	8d b8 c8 17 00 00    	lea    0x17c8(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+     3ba:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+     3bd:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+     3c0:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+     3c3:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+     3c9:	0f 8f 01 01 00 00    	jg     4d0 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+     3cf:	8d 78 08             	lea    0x8(%eax),%edi
+     3d2:	8d bc 3e c0 17 00 00 	lea    0x17c0(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     3d9:	85 db                	test   %ebx,%ebx
+     3db:	7e 3b                	jle    418 <bufwrite+0xa8>
+     3dd:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+     3e0:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+     3e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3e7:	90                   	nop
+    *dst++ = *src++;
+     3e8:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     3e9:	39 c6                	cmp    %eax,%esi
+     3eb:	75 fb                	jne    3e8 <bufwrite+0x78>
+  ob[fd].n += n;
+     3ed:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     3f3:	8b 88 c4 17 00 00    	mov    0x17c4(%eax),%ecx
+     3f9:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     3fb:	83 b8 c0 17 00 00 01 	cmpl   $0x1,0x17c0(%eax)
+  ob[fd].n += n;
+     402:	89 88 c4 17 00 00    	mov    %ecx,0x17c4(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     408:	74 26                	je     430 <bufwrite+0xc0>
+}
+     40a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     40d:	5b                   	pop    %ebx
+     40e:	5e                   	pop    %esi
+     40f:	5f                   	pop    %edi
+     410:	5d                   	pop    %ebp
+     411:	c3                   	ret
+     412:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+     418:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     41b:	83 b8 c0 17 00 00 01 	cmpl   $0x1,0x17c0(%eax)
+  ob[fd].n += n;
+     422:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     425:	75 e3                	jne    40a <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+     427:	85 db                	test   %ebx,%ebx
+     429:	74 df                	je     40a <bufwrite+0x9a>
+     42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     42f:	90                   	nop
+  src = vsrc;
+     430:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     433:	01 c3                	add    %eax,%ebx
+     435:	eb 10                	jmp    447 <bufwrite+0xd7>
+     437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     43e:	66 90                	xchg   %ax,%ax
+     440:	83 c0 01             	add    $0x1,%eax
+     443:	39 d8                	cmp    %ebx,%eax
+     445:	74 c3                	je     40a <bufwrite+0x9a>
+    if(*p == (char)c)
+     447:	80 38 0a             	cmpb   $0xa,(%eax)
+     44a:	75 f4                	jne    440 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     44c:	85 c9                	test   %ecx,%ecx
+     44e:	7e ba                	jle    40a <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+     450:	83 ec 04             	sub    $0x4,%esp
+     453:	51                   	push   %ecx
+     454:	ff 75 ac             	push   -0x54(%ebp)
+     457:	52                   	push   %edx
+     458:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+     45b:	e8 cd 05 00 00       	call   a2d <write>
+    ob[fd].n = 0;
+     460:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     463:	83 c4 10             	add    $0x10,%esp
+     466:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+     46c:	c7 82 c4 17 00 00 00 	movl   $0x0,0x17c4(%edx)
+     473:	00 00 00 
+     476:	eb 92                	jmp    40a <bufwrite+0x9a>
+     478:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     47f:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     480:	83 ec 08             	sub    $0x8,%esp
+     483:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     486:	50                   	push   %eax
+     487:	52                   	push   %edx
+     488:	89 55 b0             	mov    %edx,-0x50(%ebp)
+     48b:	e8 d7 05 00 00       	call   a67 <fstat>
+     490:	83 c4 10             	add    $0x10,%esp
+     493:	8b 55 b0             	mov    -0x50(%ebp),%edx
+     496:	89 c1                	mov    %eax,%ecx
+     498:	b8 02 00 00 00       	mov    $0x2,%eax
+     49d:	85 c9                	test   %ecx,%ecx
+     49f:	75 0d                	jne    4ae <bufwrite+0x13e>
+     4a1:	31 c0                	xor    %eax,%eax
+     4a3:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     4a8:	0f 95 c0             	setne  %al
+     4ab:	83 c0 01             	add    $0x1,%eax
+     4ae:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+     4b4:	89 81 c0 17 00 00    	mov    %eax,0x17c0(%ecx)
+     4ba:	e9 e3 fe ff ff       	jmp    3a2 <bufwrite+0x32>
+     4bf:	90                   	nop
+}
+     4c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4c3:	5b                   	pop    %ebx
+     4c4:	5e                   	pop    %esi
+     4c5:	5f                   	pop    %edi
+     4c6:	5d                   	pop    %ebp
+    write(fd, p, n);
+     4c7:	e9 61 05 00 00       	jmp    a2d <write>
+     4cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+     4d0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+     4d3:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+     4d6:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+     4d9:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+     4dc:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+     4df:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+     4e2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+     4e5:	6a 02                	push   $0x2
+     4e7:	50                   	push   %eax
+     4e8:	52                   	push   %edx
+     4e9:	e8 9b 06 00 00       	call   b89 <writev>
+    ob[fd].n = 0;
+     4ee:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+     4f1:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+     4f4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+     4fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4fe:	5b                   	pop    %ebx
+     4ff:	5e                   	pop    %esi
+     500:	5f                   	pop    %edi
+     501:	5d                   	pop    %ebp
+     502:	c3                   	ret
+     503:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     50a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000510 <fflush>:
+{
+     510:	55                   	push   %ebp
+     511:	89 e5                	mov    %esp,%ebp
+     513:	53                   	push   %ebx
+     514:	83 ec 04             	sub    $0x4,%esp
+     517:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     51a:	83 f8 0f             	cmp    $0xf,%eax
+     51d:	77 16                	ja     535 <fflush+0x25>
+     51f:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+     525:	8b 8a c4 17 00 00    	mov    0x17c4(%edx),%ecx
+     52b:	8d 9a c0 17 00 00    	lea    0x17c0(%edx),%ebx
+     531:	85 c9                	test   %ecx,%ecx
+     533:	7f 0b                	jg     540 <fflush+0x30>
+}
+     535:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     538:	c9                   	leave
+     539:	c3                   	ret
+     53a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     540:	83 ec 04             	sub    $0x4,%esp
+     543:	81 c2 c8 17 00 00    	add    $0x17c8,%edx
+     549:	51                   	push   %ecx
+     54a:	52                   	push   %edx
+     54b:	50                   	push   %eax
+     54c:	e8 dc 04 00 00       	call   a2d <write>
+    ob[fd].n = 0;
+     551:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     558:	83 c4 10             	add    $0x10,%esp
+}
+     55b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     55e:	c9                   	leave
+     55f:	c3                   	ret
+
+00000560 <fflushall>:
+{
+     560:	55                   	push   %ebp
+     561:	89 e5                	mov    %esp,%ebp
+     563:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     564:	31 f6                	xor    %esi,%esi
+{
+     566:	53                   	push   %ebx
+     567:	bb c8 17 00 00       	mov    $0x17c8,%ebx
+     56c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     570:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     573:	85 c0                	test   %eax,%eax
+     575:	7e 15                	jle    58c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     577:	83 ec 04             	sub    $0x4,%esp
+     57a:	50                   	push   %eax
+     57b:	53                   	push   %ebx
+     57c:	56                   	push   %esi
+     57d:	e8 ab 04 00 00       	call   a2d <write>
+    ob[fd].n = 0;
+     582:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     589:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     58c:	83 c6 01             	add    $0x1,%esi
+     58f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     595:	83 fe 10             	cmp    $0x10,%esi
+     598:	75 d6                	jne    570 <fflushall+0x10>
+}
+     59a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     59d:	5b                   	pop    %ebx
+     59e:	5e                   	pop    %esi
+     59f:	5d                   	pop    %ebp
+     5a0:	c3                   	ret
+     5a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5af:	90                   	nop
+
+000005b0 <fork>:
+{
+     5b0:	55                   	push   %ebp
+     5b1:	89 e5                	mov    %esp,%ebp
+     5b3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     5b4:	31 f6                	xor    %esi,%esi
+{
+     5b6:	53                   	push   %ebx
+     5b7:	bb c8 17 00 00       	mov    $0x17c8,%ebx
+     5bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     5c0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     5c3:	85 c0                	test   %eax,%eax
+     5c5:	7e 15                	jle    5dc <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     5c7:	83 ec 04             	sub    $0x4,%esp
+     5ca:	50                   	push   %eax
+     5cb:	53                   	push   %ebx
+     5cc:	56                   	push   %esi
+     5cd:	e8 5b 04 00 00       	call   a2d <write>
+    ob[fd].n = 0;
+     5d2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     5d9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     5dc:	83 c6 01             	add    $0x1,%esi
+     5df:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     5e5:	83 fe 10             	cmp    $0x10,%esi
+     5e8:	75 d6                	jne    5c0 <fork+0x10>
+}
+     5ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5ed:	5b                   	pop    %ebx
+     5ee:	5e                   	pop    %esi
+     5ef:	5d                   	pop    %ebp
+  return _fork();
+     5f0:	e9 15 04 00 00       	jmp    a0a <_fork>
+     5f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000600 <exit>:
+{
+     600:	55                   	push   %ebp
+     601:	89 e5                	mov    %esp,%ebp
+     603:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+     606:	e8 55 ff ff ff       	call   560 <fflushall>
+  _exit();
+     60b:	e8 01 04 00 00       	call   a11 <_exit>
+
+00000610 <exec>:
+{
+     610:	55                   	push   %ebp
+     611:	89 e5                	mov    %esp,%ebp
+     613:	57                   	push   %edi
+     614:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     615:	31 f6                	xor    %esi,%esi
+{
+     617:	53                   	push   %ebx
+     618:	bb c8 17 00 00       	mov    $0x17c8,%ebx
+     61d:	83 ec 1c             	sub    $0x1c,%esp
+     620:	8b 45 08             	mov    0x8(%ebp),%eax
+     623:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     626:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     629:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     630:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     633:	85 c0                	test   %eax,%eax
+     635:	7e 15                	jle    64c <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     637:	83 ec 04             	sub    $0x4,%esp
+     63a:	50                   	push   %eax
+     63b:	53                   	push   %ebx
+     63c:	56                   	push   %esi
+     63d:	e8 eb 03 00 00       	call   a2d <write>
+    ob[fd].n = 0;
+     642:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     649:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     64c:	83 c6 01             	add    $0x1,%esi
+     64f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     655:	83 fe 10             	cmp    $0x10,%esi
+     658:	75 d6                	jne    630 <exec+0x20>
+  return _exec(path, argv);
+     65a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     65d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+     660:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     663:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     666:	5b                   	pop    %ebx
+     667:	5e                   	pop    %esi
+     668:	5f                   	pop    %edi
+     669:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     66a:	e9 d3 03 00 00       	jmp    a42 <_exec>
+     66f:	90                   	nop
+
+00000670 <close>:
+{
+     670:	55                   	push   %ebp
+     671:	89 e5                	mov    %esp,%ebp
+     673:	56                   	push   %esi
+     674:	53                   	push   %ebx
+     675:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     678:	83 fb 0f             	cmp    $0xf,%ebx
+     67b:	77 26                	ja     6a3 <close+0x33>
+     67d:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     683:	8b 90 c4 17 00 00    	mov    0x17c4(%eax),%edx
+     689:	8d b0 c0 17 00 00    	lea    0x17c0(%eax),%esi
+     68f:	85 d2                	test   %edx,%edx
+     691:	7f 25                	jg     6b8 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+     693:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     699:	c7 80 c0 17 00 00 00 	movl   $0x0,0x17c0(%eax)
+     6a0:	00 00 00 
+  return _close(fd);
+     6a3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     6a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     6a9:	5b                   	pop    %ebx
+     6aa:	5e                   	pop    %esi
+     6ab:	5d                   	pop    %ebp
+  return _close(fd);
+     6ac:	e9 83 03 00 00       	jmp    a34 <_close>
+     6b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     6b8:	83 ec 04             	sub    $0x4,%esp
+     6bb:	05 c8 17 00 00       	add    $0x17c8,%eax
+     6c0:	52                   	push   %edx
+     6c1:	50                   	push   %eax
+     6c2:	53                   	push   %ebx
+     6c3:	e8 65 03 00 00       	call   a2d <write>
+    ob[fd].n = 0;
+     6c8:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+     6cf:	83 c4 10             	add    $0x10,%esp
+     6d2:	eb bf                	jmp    693 <close+0x23>
+     6d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6df:	90                   	nop
+
+000006e0 <strcpy>:
+{
+     6e0:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+     6e1:	31 c0                	xor    %eax,%eax
+{
+     6e3:	89 e5                	mov    %esp,%ebp
+     6e5:	53                   	push   %ebx
+     6e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     6e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     6ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     6f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     6f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     6f7:	83 c0 01             	add    $0x1,%eax
+     6fa:	84 d2                	test   %dl,%dl
+     6fc:	75 f2                	jne    6f0 <strcpy+0x10>
+}
+     6fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     701:	89 c8                	mov    %ecx,%eax
+     703:	c9                   	leave
+     704:	c3                   	ret
+     705:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     70c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000710 <strcmp>:
+{
+     710:	55                   	push   %ebp
+     711:	89 e5                	mov    %esp,%ebp
+     713:	53                   	push   %ebx
+     714:	8b 55 08             	mov    0x8(%ebp),%edx
+     717:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     71a:	0f b6 02             	movzbl (%edx),%eax
+     71d:	84 c0                	test   %al,%al
+     71f:	75 17                	jne    738 <strcmp+0x28>
+     721:	eb 3a                	jmp    75d <strcmp+0x4d>
+     723:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     727:	90                   	nop
+     728:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     72c:	83 c2 01             	add    $0x1,%edx
+     72f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     732:	84 c0                	test   %al,%al
+     734:	74 1a                	je     750 <strcmp+0x40>
+    p++, q++;
+     736:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     738:	0f b6 19             	movzbl (%ecx),%ebx
+     73b:	38 c3                	cmp    %al,%bl
+     73d:	74 e9                	je     728 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     73f:	29 d8                	sub    %ebx,%eax
+}
+     741:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     744:	c9                   	leave
+     745:	c3                   	ret
+     746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     74d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     750:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     754:	31 c0                	xor    %eax,%eax
+     756:	29 d8                	sub    %ebx,%eax
+}
+     758:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     75b:	c9                   	leave
+     75c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     75d:	0f b6 19             	movzbl (%ecx),%ebx
+     760:	31 c0                	xor    %eax,%eax
+     762:	eb db                	jmp    73f <strcmp+0x2f>
+     764:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     76b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     76f:	90                   	nop
+
+00000770 <strlen>:
+{
+     770:	55                   	push   %ebp
+     771:	89 e5                	mov    %esp,%ebp
+     773:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+     776:	80 3a 00             	cmpb   $0x0,(%edx)
+     779:	74 15                	je     790 <strlen+0x20>
+     77b:	31 c0                	xor    %eax,%eax
+     77d:	8d 76 00             	lea    0x0(%esi),%esi
+     780:	83 c0 01             	add    $0x1,%eax
+     783:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     787:	89 c1                	mov    %eax,%ecx
+     789:	75 f5                	jne    780 <strlen+0x10>
+}
+     78b:	89 c8                	mov    %ecx,%eax
+     78d:	5d                   	pop    %ebp
+     78e:	c3                   	ret
+     78f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     790:	31 c9                	xor    %ecx,%ecx
+}
+     792:	5d                   	pop    %ebp
+     793:	89 c8                	mov    %ecx,%eax
+     795:	c3                   	ret
+     796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     79d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007a0 <memset>:
+{
+     7a0:	55                   	push   %ebp
+     7a1:	89 e5                	mov    %esp,%ebp
+     7a3:	57                   	push   %edi
+     7a4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     7a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     7aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+     7ad:	89 d7                	mov    %edx,%edi
+     7af:	fc                   	cld
+     7b0:	f3 aa                	rep stos %al,%es:(%edi)
+}
+     7b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     7b5:	89 d0                	mov    %edx,%eax
+     7b7:	c9                   	leave
+     7b8:	c3                   	ret
+     7b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000007c0 <strchr>:
+{
+     7c0:	55                   	push   %ebp
+     7c1:	89 e5                	mov    %esp,%ebp
+     7c3:	8b 45 08             	mov    0x8(%ebp),%eax
+     7c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     7ca:	0f b6 10             	movzbl (%eax),%edx
+     7cd:	84 d2                	test   %dl,%dl
+     7cf:	75 12                	jne    7e3 <strchr+0x23>
+     7d1:	eb 1d                	jmp    7f0 <strchr+0x30>
+     7d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7d7:	90                   	nop
+     7d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     7dc:	83 c0 01             	add    $0x1,%eax
+     7df:	84 d2                	test   %dl,%dl
+     7e1:	74 0d                	je     7f0 <strchr+0x30>
+    if(*s == c)
+     7e3:	38 d1                	cmp    %dl,%cl
+     7e5:	75 f1                	jne    7d8 <strchr+0x18>
+}
+     7e7:	5d                   	pop    %ebp
+     7e8:	c3                   	ret
+     7e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     7f0:	31 c0                	xor    %eax,%eax
+}
+     7f2:	5d                   	pop    %ebp
+     7f3:	c3                   	ret
+     7f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7ff:	90                   	nop
+
+00000800 <memchr>:
+{
+     800:	55                   	push   %ebp
+     801:	89 e5                	mov    %esp,%ebp
+     803:	8b 55 10             	mov    0x10(%ebp),%edx
+     806:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     809:	85 d2                	test   %edx,%edx
+     80b:	74 1b                	je     828 <memchr+0x28>
+    if(*p == (char)c)
+     80d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+     811:	01 c2                	add    %eax,%edx
+     813:	eb 0a                	jmp    81f <memchr+0x1f>
+     815:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+     818:	83 c0 01             	add    $0x1,%eax
+     81b:	39 c2                	cmp    %eax,%edx
+     81d:	74 09                	je     828 <memchr+0x28>
+    if(*p == (char)c)
+     81f:	38 08                	cmp    %cl,(%eax)
+     821:	75 f5                	jne    818 <memchr+0x18>
+}
+     823:	5d                   	pop    %ebp
+     824:	c3                   	ret
+     825:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+     828:	31 c0                	xor    %eax,%eax
+}
+     82a:	5d                   	pop    %ebp
+     82b:	c3                   	ret
+     82c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000830 <gets>:
+{
+     830:	55                   	push   %ebp
+     831:	89 e5                	mov    %esp,%ebp
+     833:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+     834:	31 ff                	xor    %edi,%edi
+{
+     836:	56                   	push   %esi
+     837:	be c8 17 00 00       	mov    $0x17c8,%esi
+     83c:	53                   	push   %ebx
+     83d:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     840:	8b 46 fc             	mov    -0x4(%esi),%eax
+     843:	85 c0                	test   %eax,%eax
+     845:	7e 15                	jle    85c <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     847:	83 ec 04             	sub    $0x4,%esp
+     84a:	50                   	push   %eax
+     84b:	56                   	push   %esi
+     84c:	57                   	push   %edi
+     84d:	e8 db 01 00 00       	call   a2d <write>
+    ob[fd].n = 0;
+     852:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+     859:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     85c:	83 c7 01             	add    $0x1,%edi
+     85f:	81 c6 08 01 00 00    	add    $0x108,%esi
+     865:	83 ff 10             	cmp    $0x10,%edi
+     868:	75 d6                	jne    840 <gets+0x10>
+  for(i=0; i+1 < max; ){
+     86a:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+     86c:	8d 75 e7             	lea    -0x19(%ebp),%esi
+     86f:	eb 2e                	jmp    89f <gets+0x6f>
+     871:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     878:	83 ec 04             	sub    $0x4,%esp
+     87b:	6a 01                	push   $0x1
+     87d:	56                   	push   %esi
+     87e:	6a 00                	push   $0x0
+     880:	e8 a1 01 00 00       	call   a26 <read>
+    if(cc < 1)
+     885:	83 c4 10             	add    $0x10,%esp
+     888:	85 c0                	test   %eax,%eax
+     88a:	7e 1d                	jle    8a9 <gets+0x79>
+    buf[i++] = c;
+     88c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     890:	8b 55 08             	mov    0x8(%ebp),%edx
+     893:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     897:	3c 0a                	cmp    $0xa,%al
+     899:	74 10                	je     8ab <gets+0x7b>
+     89b:	3c 0d                	cmp    $0xd,%al
+     89d:	74 0c                	je     8ab <gets+0x7b>
+  for(i=0; i+1 < max; ){
+     89f:	89 df                	mov    %ebx,%edi
+     8a1:	83 c3 01             	add    $0x1,%ebx
+     8a4:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     8a7:	7c cf                	jl     878 <gets+0x48>
+     8a9:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     8ab:	8b 45 08             	mov    0x8(%ebp),%eax
+     8ae:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     8b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8b5:	5b                   	pop    %ebx
+     8b6:	5e                   	pop    %esi
+     8b7:	5f                   	pop    %edi
+     8b8:	5d                   	pop    %ebp
+     8b9:	c3                   	ret
+     8ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008c0 <stat>:
+{
+     8c0:	55                   	push   %ebp
+     8c1:	89 e5                	mov    %esp,%ebp
+     8c3:	57                   	push   %edi
+     8c4:	56                   	push   %esi
+     8c5:	53                   	push   %ebx
+     8c6:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+     8c9:	6a 00                	push   $0x0
+     8cb:	ff 75 08             	push   0x8(%ebp)
+     8ce:	e8 76 01 00 00       	call   a49 <open>
+  if(fd < 0)
+     8d3:	83 c4 10             	add    $0x10,%esp
+     8d6:	85 c0                	test   %eax,%eax
+     8d8:	78 76                	js     950 <stat+0x90>
+  r = fstat(fd, st);
+     8da:	83 ec 08             	sub    $0x8,%esp
+     8dd:	ff 75 0c             	push   0xc(%ebp)
+     8e0:	89 c3                	mov    %eax,%ebx
+     8e2:	50                   	push   %eax
+     8e3:	e8 7f 01 00 00       	call   a67 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     8e8:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     8eb:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     8ed:	83 fb 0f             	cmp    $0xf,%ebx
+     8f0:	7f 40                	jg     932 <stat+0x72>
+     8f2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     8f8:	8b 90 c4 17 00 00    	mov    0x17c4(%eax),%edx
+     8fe:	8d b8 c0 17 00 00    	lea    0x17c0(%eax),%edi
+     904:	85 d2                	test   %edx,%edx
+     906:	7e 1a                	jle    922 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+     908:	83 ec 04             	sub    $0x4,%esp
+     90b:	05 c8 17 00 00       	add    $0x17c8,%eax
+     910:	52                   	push   %edx
+     911:	50                   	push   %eax
+     912:	53                   	push   %ebx
+     913:	e8 15 01 00 00       	call   a2d <write>
+    ob[fd].n = 0;
+     918:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+     91f:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+     922:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     928:	c7 80 c0 17 00 00 00 	movl   $0x0,0x17c0(%eax)
+     92f:	00 00 00 
+  return _close(fd);
+     932:	83 ec 0c             	sub    $0xc,%esp
+     935:	53                   	push   %ebx
+     936:	e8 f9 00 00 00       	call   a34 <_close>
+     93b:	83 c4 10             	add    $0x10,%esp
+}
+     93e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     941:	89 f0                	mov    %esi,%eax
+     943:	5b                   	pop    %ebx
+     944:	5e                   	pop    %esi
+     945:	5f                   	pop    %edi
+     946:	5d                   	pop    %ebp
+     947:	c3                   	ret
+     948:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     94f:	90                   	nop
+    return -1;
+     950:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     955:	eb e7                	jmp    93e <stat+0x7e>
+     957:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     95e:	66 90                	xchg   %ax,%ax
+
+00000960 <atoi>:
+{
+     960:	55                   	push   %ebp
+     961:	89 e5                	mov    %esp,%ebp
+     963:	53                   	push   %ebx
+     964:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     967:	0f be 02             	movsbl (%edx),%eax
+     96a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     96d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     970:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     975:	77 1e                	ja     995 <atoi+0x35>
+     977:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     97e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     980:	83 c2 01             	add    $0x1,%edx
+     983:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     986:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     98a:	0f be 02             	movsbl (%edx),%eax
+     98d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     990:	80 fb 09             	cmp    $0x9,%bl
+     993:	76 eb                	jbe    980 <atoi+0x20>
+}
+     995:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     998:	89 c8                	mov    %ecx,%eax
+     99a:	c9                   	leave
+     99b:	c3                   	ret
+     99c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000009a0 <memmove>:
+{
+     9a0:	55                   	push   %ebp
+     9a1:	89 e5                	mov    %esp,%ebp
+     9a3:	57                   	push   %edi
+     9a4:	56                   	push   %esi
+     9a5:	8b 45 10             	mov    0x10(%ebp),%eax
+     9a8:	8b 55 08             	mov    0x8(%ebp),%edx
+     9ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     9ae:	85 c0                	test   %eax,%eax
+     9b0:	7e 13                	jle    9c5 <memmove+0x25>
+     9b2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     9b4:	89 d7                	mov    %edx,%edi
+     9b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9bd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     9c0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     9c1:	39 f8                	cmp    %edi,%eax
+     9c3:	75 fb                	jne    9c0 <memmove+0x20>
+  return vdst;
+}
+     9c5:	5e                   	pop    %esi
+     9c6:	89 d0                	mov    %edx,%eax
+     9c8:	5f                   	pop    %edi
+     9c9:	5d                   	pop    %ebp
+     9ca:	c3                   	ret
+
+000009cb <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+     9cb:	83 3d 94 17 00 00 00 	cmpl   $0x0,0x1794
+  jle 1f
+     9d2:	7e 0a                	jle    9de <syscallentry+0x13>
+  movl %esp, %ecx
+     9d4:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+     9d6:	ba dd 09 00 00       	mov    $0x9dd,%edx
+  sysenter
+     9db:	0f 34                	sysenter
+2:
+  ret
+     9dd:	c3                   	ret
+1:
+  jl 3f
+     9de:	7c 27                	jl     a07 <syscallentry+0x3c>
+  pushal
+     9e0:	60                   	pusha
+  movl $1, %eax
+     9e1:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     9e6:	0f a2                	cpuid
+  movl $-1, sysentermode
+     9e8:	c7 05 94 17 00 00 ff 	movl   $0xffffffff,0x1794
+     9ef:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     9f2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+     9f8:	74 0a                	je     a04 <syscallentry+0x39>
+  movl $1, sysentermode
+     9fa:	c7 05 94 17 00 00 01 	movl   $0x1,0x1794
+     a01:	00 00 00 
+4:
+  popal
+     a04:	61                   	popa
+  jmp syscallentry
+     a05:	eb c4                	jmp    9cb <syscallentry>
+3:
+  int $T_SYSCALL
+     a07:	cd 40                	int    $0x40
+  ret
+     a09:	c3                   	ret
+
+00000a0a <_fork>:
+
+SYSCALLAS(_fork, fork)
+     a0a:	b8 01 00 00 00       	mov    $0x1,%eax
+     a0f:	eb ba                	jmp    9cb <syscallentry>
+
+00000a11 <_exit>:
+SYSCALLAS(_exit, exit)
+     a11:	b8 02 00 00 00       	mov    $0x2,%eax
+     a16:	eb b3                	jmp    9cb <syscallentry>
+
+00000a18 <wait>:
+SYSCALL(wait)
+     a18:	b8 03 00 00 00       	mov    $0x3,%eax
+     a1d:	eb ac                	jmp    9cb <syscallentry>
+
+00000a1f <pipe>:
+SYSCALL(pipe)
+     a1f:	b8 04 00 00 00       	mov    $0x4,%eax
+     a24:	eb a5                	jmp    9cb <syscallentry>
+
+00000a26 <read>:
+SYSCALL(read)
+     a26:	b8 05 00 00 00       	mov    $0x5,%eax
+     a2b:	eb 9e                	jmp    9cb <syscallentry>
+
+00000a2d <write>:
+SYSCALL(write)
+     a2d:	b8 10 00 00 00       	mov    $0x10,%eax
+     a32:	eb 97                	jmp    9cb <syscallentry>
+
+00000a34 <_close>:
+SYSCALLAS(_close, close)
+     a34:	b8 15 00 00 00       	mov    $0x15,%eax
+     a39:	eb 90                	jmp    9cb <syscallentry>
+
+00000a3b <kill>:
+SYSCALL(kill)
+     a3b:	b8 06 00 00 00       	mov    $0x6,%eax
+     a40:	eb 89                	jmp    9cb <syscallentry>
+
+00000a42 <_exec>:
+SYSCALLAS(_exec, exec)
+     a42:	b8 07 00 00 00       	mov    $0x7,%eax
+     a47:	eb 82                	jmp    9cb <syscallentry>
+
+00000a49 <open>:
+SYSCALL(open)
+     a49:	b8 0f 00 00 00       	mov    $0xf,%eax
+     a4e:	e9 78 ff ff ff       	jmp    9cb <syscallentry>
+
+00000a53 <mknod>:
+SYSCALL(mknod)
+     a53:	b8 11 00 00 00       	mov    $0x11,%eax
+     a58:	e9 6e ff ff ff       	jmp    9cb <syscallentry>
+
+00000a5d <unlink>:
+SYSCALL(unlink)
+     a5d:	b8 12 00 00 00       	mov    $0x12,%eax
+     a62:	e9 64 ff ff ff       	jmp    9cb <syscallentry>
+
+00000a67 <fstat>:
+SYSCALL(fstat)
+     a67:	b8 08 00 00 00       	mov    $0x8,%eax
+     a6c:	e9 5a ff ff ff       	jmp    9cb <syscallentry>
+
+00000a71 <link>:
+SYSCALL(link)
+     a71:	b8 13 00 00 00       	mov    $0x13,%eax
+     a76:	e9 50 ff ff ff       	jmp    9cb <syscallentry>
+
+00000a7b <mkdir>:
+SYSCALL(mkdir)
+     a7b:	b8 14 00 00 00       	mov    $0x14,%eax
+     a80:	e9 46 ff ff ff       	jmp    9cb <syscallentry>
+
+00000a85 <chdir>:
+SYSCALL(chdir)
+     a85:	b8 09 00 00 00       	mov    $0x9,%eax
+     a8a:	e9 3c ff ff ff       	jmp    9cb <syscallentry>
+
+00000a8f <dup>:
+SYSCALL(dup)
+     a8f:	b8 0a 00 00 00       	mov    $0xa,%eax
+     a94:	e9 32 ff ff ff       	jmp    9cb <syscallentry>
+
+00000a99 <getpid>:
+SYSCALL(getpid)
+     a99:	b8 0b 00 00 00       	mov    $0xb,%eax
+     a9e:	e9 28 ff ff ff       	jmp    9cb <syscallentry>
+
+00000aa3 <sbrk>:
+SYSCALL(sbrk)
+     aa3:	b8 0c 00 00 00       	mov    $0xc,%eax
+     aa8:	e9 1e ff ff ff       	jmp    9cb <syscallentry>
+
+00000aad <sleep>:
+SYSCALL(sleep)
+     aad:	b8 0d 00 00 00       	mov    $0xd,%eax
+     ab2:	e9 14 ff ff ff       	jmp    9cb <syscallentry>
+
+00000ab7 <uptime>:
+SYSCALL(uptime)
+     ab7:	b8 0e 00 00 00       	mov    $0xe,%eax
+     abc:	e9 0a ff ff ff       	jmp    9cb <syscallentry>
+
+00000ac1 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+     ac1:	b8 16 00 00 00       	mov    $0x16,%eax
+     ac6:	e9 00 ff ff ff       	jmp    9cb <syscallentry>
+
+00000acb <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+     acb:	b8 17 00 00 00       	mov    $0x17,%eax
+     ad0:	e9 f6 fe ff ff       	jmp    9cb <syscallentry>
+
+00000ad5 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+     ad5:	b8 18 00 00 00       	mov    $0x18,%eax
+     ada:	e9 ec fe ff ff       	jmp    9cb <syscallentry>
+
+00000adf <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+     adf:	b8 19 00 00 00       	mov    $0x19,%eax
+     ae4:	e9 e2 fe ff ff       	jmp    9cb <syscallentry>
+
+00000ae9 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+     ae9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     aee:	e9 d8 fe ff ff       	jmp    9cb <syscallentry>
+
+00000af3 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+     af3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     af8:	e9 ce fe ff ff       	jmp    9cb <syscallentry>
+
+00000afd <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+     afd:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     b02:	e9 c4 fe ff ff       	jmp    9cb <syscallentry>
+
+00000b07 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+     b07:	b8 20 00 00 00       	mov    $0x20,%eax
+     b0c:	e9 ba fe ff ff       	jmp    9cb <syscallentry>
+
+00000b11 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+     b11:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     b16:	e9 b0 fe ff ff       	jmp    9cb <syscallentry>
+
+00000b1b <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+     b1b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     b20:	e9 a6 fe ff ff       	jmp    9cb <syscallentry>
+
+00000b25 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+     b25:	b8 21 00 00 00       	mov    $0x21,%eax
+     b2a:	e9 9c fe ff ff       	jmp    9cb <syscallentry>
+
+00000b2f <yield>:
+SYSCALL(yield) // yield the CPU to another process
+     b2f:	b8 22 00 00 00       	mov    $0x22,%eax
+     b34:	e9 92 fe ff ff       	jmp    9cb <syscallentry>
+
+00000b39 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+     b39:	b8 23 00 00 00       	mov    $0x23,%eax
+     b3e:	e9 88 fe ff ff       	jmp    9cb <syscallentry>
+
+00000b43 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+     b43:	b8 24 00 00 00       	mov    $0x24,%eax
+     b48:	e9 7e fe ff ff       	jmp    9cb <syscallentry>
+
+00000b4d <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+     b4d:	b8 25 00 00 00       	mov    $0x25,%eax
+     b52:	e9 74 fe ff ff       	jmp    9cb <syscallentry>
+
+00000b57 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+     b57:	b8 26 00 00 00       	mov    $0x26,%eax
+     b5c:	e9 6a fe ff ff       	jmp    9cb <syscallentry>
+
+00000b61 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+     b61:	b8 27 00 00 00       	mov    $0x27,%eax
+     b66:	e9 60 fe ff ff       	jmp    9cb <syscallentry>
+
+00000b6b <mmap>:
+SYSCALL(mmap) // map a file into memory
+     b6b:	b8 28 00 00 00       	mov    $0x28,%eax
+     b70:	e9 56 fe ff ff       	jmp    9cb <syscallentry>
+
+00000b75 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+     b75:	b8 29 00 00 00       	mov    $0x29,%eax
+     b7a:	e9 4c fe ff ff       	jmp    9cb <syscallentry>
+
+00000b7f <readv>:
+SYSCALL(readv) // read into several buffers
+     b7f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     b84:	e9 42 fe ff ff       	jmp    9cb <syscallentry>
+
+00000b89 <writev>:
+SYSCALL(writev) // write from several buffers
+     b89:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     b8e:	e9 38 fe ff ff       	jmp    9cb <syscallentry>
+
+00000b93 <pread>:
+SYSCALL(pread) // read at an offset
+     b93:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     b98:	e9 2e fe ff ff       	jmp    9cb <syscallentry>
+
+00000b9d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+     b9d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     ba2:	e9 24 fe ff ff       	jmp    9cb <syscallentry>
+
+00000ba7 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+     ba7:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     bac:	e9 1a fe ff ff       	jmp    9cb <syscallentry>
+
+00000bb1 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+     bb1:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     bb6:	e9 10 fe ff ff       	jmp    9cb <syscallentry>
+
+00000bbb <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+     bbb:	b8 30 00 00 00       	mov    $0x30,%eax
+     bc0:	e9 06 fe ff ff       	jmp    9cb <syscallentry>
+
+00000bc5 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+     bc5:	b8 31 00 00 00       	mov    $0x31,%eax
+     bca:	e9 fc fd ff ff       	jmp    9cb <syscallentry>
+
+00000bcf <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+     bcf:	b8 32 00 00 00       	mov    $0x32,%eax
+     bd4:	e9 f2 fd ff ff       	jmp    9cb <syscallentry>
+
+00000bd9 <profread>:
+SYSCALL(profread) // drain profiler samples
+     bd9:	b8 33 00 00 00       	mov    $0x33,%eax
+     bde:	e9 e8 fd ff ff       	jmp    9cb <syscallentry>
+
+00000be3 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+     be3:	b8 34 00 00 00       	mov    $0x34,%eax
+     be8:	e9 de fd ff ff       	jmp    9cb <syscallentry>
+
+00000bed <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+     bed:	b8 35 00 00 00       	mov    $0x35,%eax
+     bf2:	e9 d4 fd ff ff       	jmp    9cb <syscallentry>
+
+00000bf7 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+     bf7:	b8 36 00 00 00       	mov    $0x36,%eax
+     bfc:	e9 ca fd ff ff       	jmp    9cb <syscallentry>
+
+00000c01 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+     c01:	b8 37 00 00 00       	mov    $0x37,%eax
+     c06:	e9 c0 fd ff ff       	jmp    9cb <syscallentry>
+     c0b:	66 90                	xchg   %ax,%ax
+     c0d:	66 90                	xchg   %ax,%ax
+     c0f:	90                   	nop
+
+00000c10 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     c10:	55                   	push   %ebp
+     c11:	89 e5                	mov    %esp,%ebp
+     c13:	57                   	push   %edi
+     c14:	56                   	push   %esi
+     c15:	53                   	push   %ebx
+     c16:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     c18:	89 d1                	mov    %edx,%ecx
+{
+     c1a:	83 ec 3c             	sub    $0x3c,%esp
+     c1d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     c20:	85 d2                	test   %edx,%edx
+     c22:	0f 89 80 00 00 00    	jns    ca8 <printint+0x98>
+     c28:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     c2c:	74 7a                	je     ca8 <printint+0x98>
+    x = -xx;
+     c2e:	f7 d9                	neg    %ecx
+    neg = 1;
+     c30:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     c35:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     c38:	31 f6                	xor    %esi,%esi
+     c3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     c40:	89 c8                	mov    %ecx,%eax
+     c42:	31 d2                	xor    %edx,%edx
+     c44:	89 f7                	mov    %esi,%edi
+     c46:	f7 f3                	div    %ebx
+     c48:	8d 76 01             	lea    0x1(%esi),%esi
+     c4b:	0f b6 92 d4 12 00 00 	movzbl 0x12d4(%edx),%edx
+     c52:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     c56:	89 ca                	mov    %ecx,%edx
+     c58:	89 c1                	mov    %eax,%ecx
+     c5a:	39 da                	cmp    %ebx,%edx
+     c5c:	73 e2                	jae    c40 <printint+0x30>
+  if(neg)
+     c5e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     c61:	85 c0                	test   %eax,%eax
+     c63:	74 07                	je     c6c <printint+0x5c>
+    buf[i++] = '-';
+     c65:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     c6a:	89 f7                	mov    %esi,%edi
+     c6c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     c6f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     c72:	01 df                	add    %ebx,%edi
+     c74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     c78:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+     c7b:	83 ec 04             	sub    $0x4,%esp
+     c7e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     c81:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     c84:	6a 01                	push   $0x1
+     c86:	50                   	push   %eax
+     c87:	56                   	push   %esi
+     c88:	e8 e3 f6 ff ff       	call   370 <bufwrite>
+  while(--i >= 0)
+     c8d:	89 f8                	mov    %edi,%eax
+     c8f:	83 c4 10             	add    $0x10,%esp
+     c92:	83 ef 01             	sub    $0x1,%edi
+     c95:	39 d8                	cmp    %ebx,%eax
+     c97:	75 df                	jne    c78 <printint+0x68>
+}
+     c99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c9c:	5b                   	pop    %ebx
+     c9d:	5e                   	pop    %esi
+     c9e:	5f                   	pop    %edi
+     c9f:	5d                   	pop    %ebp
+     ca0:	c3                   	ret
+     ca1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     ca8:	31 c0                	xor    %eax,%eax
+     caa:	eb 89                	jmp    c35 <printint+0x25>
+     cac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000cb0 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     cb0:	55                   	push   %ebp
+     cb1:	89 e5                	mov    %esp,%ebp
+     cb3:	57                   	push   %edi
+     cb4:	56                   	push   %esi
+     cb5:	53                   	push   %ebx
+     cb6:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     cb9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     cbc:	0f b6 18             	movzbl (%eax),%ebx
+     cbf:	84 db                	test   %bl,%bl
+     cc1:	74 6c                	je     d2f <printf+0x7f>
+     cc3:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+     cc6:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+     cc9:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     ccb:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     cce:	eb 26                	jmp    cf6 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     cd0:	83 f8 25             	cmp    $0x25,%eax
+     cd3:	74 4b                	je     d20 <printf+0x70>
+  bufwrite(fd, &c, 1);
+     cd5:	83 ec 04             	sub    $0x4,%esp
+     cd8:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     cdb:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     cde:	6a 01                	push   $0x1
+     ce0:	50                   	push   %eax
+     ce1:	ff 75 08             	push   0x8(%ebp)
+     ce4:	e8 87 f6 ff ff       	call   370 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+     ce9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     cec:	0f b6 1f             	movzbl (%edi),%ebx
+     cef:	83 c7 01             	add    $0x1,%edi
+     cf2:	84 db                	test   %bl,%bl
+     cf4:	74 39                	je     d2f <printf+0x7f>
+    c = fmt[i] & 0xff;
+     cf6:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     cf9:	85 f6                	test   %esi,%esi
+     cfb:	74 d3                	je     cd0 <printf+0x20>
+      }
+    } else if(state == '%'){
+     cfd:	83 fe 25             	cmp    $0x25,%esi
+     d00:	75 ea                	jne    cec <printf+0x3c>
+      if(c == 'd'){
+     d02:	83 f8 25             	cmp    $0x25,%eax
+     d05:	0f 84 d5 01 00 00    	je     ee0 <printf+0x230>
+     d0b:	83 e8 63             	sub    $0x63,%eax
+     d0e:	83 f8 15             	cmp    $0x15,%eax
+     d11:	77 45                	ja     d58 <printf+0xa8>
+     d13:	ff 24 85 7c 12 00 00 	jmp    *0x127c(,%eax,4)
+     d1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     d20:	0f b6 1f             	movzbl (%edi),%ebx
+     d23:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+     d26:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     d2b:	84 db                	test   %bl,%bl
+     d2d:	75 c7                	jne    cf6 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+     d2f:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+     d33:	74 0b                	je     d40 <printf+0x90>
+    fflush(fd);
+}
+     d35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d38:	5b                   	pop    %ebx
+     d39:	5e                   	pop    %esi
+     d3a:	5f                   	pop    %edi
+     d3b:	5d                   	pop    %ebp
+     d3c:	c3                   	ret
+     d3d:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+     d40:	83 ec 0c             	sub    $0xc,%esp
+     d43:	6a 02                	push   $0x2
+     d45:	e8 c6 f7 ff ff       	call   510 <fflush>
+     d4a:	83 c4 10             	add    $0x10,%esp
+}
+     d4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d50:	5b                   	pop    %ebx
+     d51:	5e                   	pop    %esi
+     d52:	5f                   	pop    %edi
+     d53:	5d                   	pop    %ebp
+     d54:	c3                   	ret
+     d55:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+     d58:	83 ec 04             	sub    $0x4,%esp
+     d5b:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     d5e:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+     d62:	6a 01                	push   $0x1
+     d64:	52                   	push   %edx
+     d65:	89 55 c0             	mov    %edx,-0x40(%ebp)
+     d68:	ff 75 08             	push   0x8(%ebp)
+     d6b:	e8 00 f6 ff ff       	call   370 <bufwrite>
+     d70:	83 c4 0c             	add    $0xc,%esp
+     d73:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     d76:	6a 01                	push   $0x1
+     d78:	8b 55 c0             	mov    -0x40(%ebp),%edx
+     d7b:	52                   	push   %edx
+      state = 0;
+     d7c:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+     d7e:	ff 75 08             	push   0x8(%ebp)
+     d81:	e8 ea f5 ff ff       	call   370 <bufwrite>
+        putc(fd, c);
+     d86:	83 c4 10             	add    $0x10,%esp
+     d89:	e9 5e ff ff ff       	jmp    cec <printf+0x3c>
+     d8e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+     d90:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     d93:	83 ec 0c             	sub    $0xc,%esp
+     d96:	b9 10 00 00 00       	mov    $0x10,%ecx
+     d9b:	8b 16                	mov    (%esi),%edx
+     d9d:	6a 00                	push   $0x0
+     d9f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+     da2:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+     da5:	e8 66 fe ff ff       	call   c10 <printint>
+        ap++;
+     daa:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     dad:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     db0:	31 f6                	xor    %esi,%esi
+     db2:	e9 35 ff ff ff       	jmp    cec <printf+0x3c>
+     db7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dbe:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     dc0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     dc3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     dc5:	83 c0 04             	add    $0x4,%eax
+     dc8:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+     dcb:	b8 75 12 00 00       	mov    $0x1275,%eax
+     dd0:	85 db                	test   %ebx,%ebx
+     dd2:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+     dd5:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+     dd8:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+     dda:	53                   	push   %ebx
+     ddb:	e8 90 f9 ff ff       	call   770 <strlen>
+     de0:	83 c4 0c             	add    $0xc,%esp
+     de3:	50                   	push   %eax
+     de4:	53                   	push   %ebx
+     de5:	ff 75 08             	push   0x8(%ebp)
+     de8:	e8 83 f5 ff ff       	call   370 <bufwrite>
+     ded:	83 c4 10             	add    $0x10,%esp
+     df0:	e9 f7 fe ff ff       	jmp    cec <printf+0x3c>
+     df5:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+     df8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+     dfb:	83 ec 04             	sub    $0x4,%esp
+     dfe:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+     e01:	8b 06                	mov    (%esi),%eax
+        ap++;
+     e03:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+     e06:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+     e09:	6a 01                	push   $0x1
+     e0b:	52                   	push   %edx
+     e0c:	ff 75 08             	push   0x8(%ebp)
+     e0f:	e8 5c f5 ff ff       	call   370 <bufwrite>
+        ap++;
+     e14:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     e17:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     e1a:	31 f6                	xor    %esi,%esi
+     e1c:	e9 cb fe ff ff       	jmp    cec <printf+0x3c>
+     e21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+     e28:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     e2b:	83 ec 0c             	sub    $0xc,%esp
+     e2e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     e33:	8b 16                	mov    (%esi),%edx
+     e35:	6a 01                	push   $0x1
+     e37:	e9 63 ff ff ff       	jmp    d9f <printf+0xef>
+     e3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+     e40:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     e43:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     e46:	89 7d c0             	mov    %edi,-0x40(%ebp)
+     e49:	89 55 bc             	mov    %edx,-0x44(%ebp)
+     e4c:	8b 18                	mov    (%eax),%ebx
+     e4e:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+     e51:	31 c0                	xor    %eax,%eax
+     e53:	89 c7                	mov    %eax,%edi
+     e55:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+     e58:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+     e5d:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+     e5f:	f7 e1                	mul    %ecx
+     e61:	c1 ea 03             	shr    $0x3,%edx
+     e64:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     e67:	89 d1                	mov    %edx,%ecx
+     e69:	01 c0                	add    %eax,%eax
+     e6b:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     e6d:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+     e6f:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     e71:	be 0a 00 00 00       	mov    $0xa,%esi
+     e76:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+     e78:	89 da                	mov    %ebx,%edx
+     e7a:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+     e7c:	89 fe                	mov    %edi,%esi
+     e7e:	83 c7 01             	add    $0x1,%edi
+     e81:	8d 42 30             	lea    0x30(%edx),%eax
+     e84:	89 da                	mov    %ebx,%edx
+     e86:	8d 14 92             	lea    (%edx,%edx,4),%edx
+     e89:	01 d2                	add    %edx,%edx
+     e8b:	29 d0                	sub    %edx,%eax
+     e8d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+     e91:	89 c8                	mov    %ecx,%eax
+     e93:	09 d8                	or     %ebx,%eax
+     e95:	75 c1                	jne    e58 <printf+0x1a8>
+     e97:	8b 55 bc             	mov    -0x44(%ebp),%edx
+     e9a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     e9d:	01 d6                	add    %edx,%esi
+     e9f:	89 f7                	mov    %esi,%edi
+     ea1:	89 d6                	mov    %edx,%esi
+     ea3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ea7:	90                   	nop
+    putc(fd, buf[i]);
+     ea8:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+     eab:	83 ec 04             	sub    $0x4,%esp
+     eae:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+     eb1:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+     eb4:	6a 01                	push   $0x1
+     eb6:	50                   	push   %eax
+     eb7:	53                   	push   %ebx
+     eb8:	e8 b3 f4 ff ff       	call   370 <bufwrite>
+  while(--i >= 0)
+     ebd:	89 fa                	mov    %edi,%edx
+     ebf:	83 c4 10             	add    $0x10,%esp
+     ec2:	83 ef 01             	sub    $0x1,%edi
+     ec5:	39 d6                	cmp    %edx,%esi
+     ec7:	75 df                	jne    ea8 <printf+0x1f8>
+        ap += 2;
+     ec9:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+     ecd:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+     ed0:	31 f6                	xor    %esi,%esi
+     ed2:	e9 15 fe ff ff       	jmp    cec <printf+0x3c>
+     ed7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ede:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+     ee0:	83 ec 04             	sub    $0x4,%esp
+     ee3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     ee6:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     ee9:	6a 01                	push   $0x1
+     eeb:	e9 8b fe ff ff       	jmp    d7b <printf+0xcb>
+
+00000ef0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     ef0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     ef1:	a1 40 28 00 00       	mov    0x2840,%eax
+{
+     ef6:	89 e5                	mov    %esp,%ebp
+     ef8:	57                   	push   %edi
+     ef9:	56                   	push   %esi
+     efa:	53                   	push   %ebx
+     efb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     efe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f08:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f0a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f0c:	39 ca                	cmp    %ecx,%edx
+     f0e:	73 30                	jae    f40 <free+0x50>
+     f10:	39 c1                	cmp    %eax,%ecx
+     f12:	72 04                	jb     f18 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f14:	39 c2                	cmp    %eax,%edx
+     f16:	72 f0                	jb     f08 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     f18:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     f1b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     f1e:	39 f8                	cmp    %edi,%eax
+     f20:	74 2e                	je     f50 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f22:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     f25:	8b 42 04             	mov    0x4(%edx),%eax
+     f28:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     f2b:	39 f1                	cmp    %esi,%ecx
+     f2d:	74 38                	je     f67 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     f2f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     f31:	5b                   	pop    %ebx
+  freep = p;
+     f32:	89 15 40 28 00 00    	mov    %edx,0x2840
+}
+     f38:	5e                   	pop    %esi
+     f39:	5f                   	pop    %edi
+     f3a:	5d                   	pop    %ebp
+     f3b:	c3                   	ret
+     f3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f40:	39 c1                	cmp    %eax,%ecx
+     f42:	72 d0                	jb     f14 <free+0x24>
+     f44:	eb c2                	jmp    f08 <free+0x18>
+     f46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f4d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+     f50:	03 70 04             	add    0x4(%eax),%esi
+     f53:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f56:	8b 02                	mov    (%edx),%eax
+     f58:	8b 00                	mov    (%eax),%eax
+     f5a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     f5d:	8b 42 04             	mov    0x4(%edx),%eax
+     f60:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     f63:	39 f1                	cmp    %esi,%ecx
+     f65:	75 c8                	jne    f2f <free+0x3f>
+    p->s.size += bp->s.size;
+     f67:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     f6a:	89 15 40 28 00 00    	mov    %edx,0x2840
+    p->s.size += bp->s.size;
+     f70:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     f73:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     f76:	89 0a                	mov    %ecx,(%edx)
+}
+     f78:	5b                   	pop    %ebx
+     f79:	5e                   	pop    %esi
+     f7a:	5f                   	pop    %edi
+     f7b:	5d                   	pop    %ebp
+     f7c:	c3                   	ret
+     f7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f80 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     f80:	55                   	push   %ebp
+     f81:	89 e5                	mov    %esp,%ebp
+     f83:	57                   	push   %edi
+     f84:	56                   	push   %esi
+     f85:	53                   	push   %ebx
+     f86:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f89:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+     f8c:	8b 15 40 28 00 00    	mov    0x2840,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f92:	8d 78 07             	lea    0x7(%eax),%edi
+     f95:	c1 ef 03             	shr    $0x3,%edi
+     f98:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+     f9b:	85 d2                	test   %edx,%edx
+     f9d:	0f 84 8d 00 00 00    	je     1030 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     fa3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     fa5:	8b 48 04             	mov    0x4(%eax),%ecx
+     fa8:	39 f9                	cmp    %edi,%ecx
+     faa:	73 64                	jae    1010 <malloc+0x90>
+  if(nu < 4096)
+     fac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     fb1:	39 df                	cmp    %ebx,%edi
+     fb3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     fb6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     fbd:	eb 0a                	jmp    fc9 <malloc+0x49>
+     fbf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     fc0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     fc2:	8b 48 04             	mov    0x4(%eax),%ecx
+     fc5:	39 f9                	cmp    %edi,%ecx
+     fc7:	73 47                	jae    1010 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     fc9:	89 c2                	mov    %eax,%edx
+     fcb:	39 05 40 28 00 00    	cmp    %eax,0x2840
+     fd1:	75 ed                	jne    fc0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+     fd3:	83 ec 0c             	sub    $0xc,%esp
+     fd6:	56                   	push   %esi
+     fd7:	e8 c7 fa ff ff       	call   aa3 <sbrk>
+  if(p == (char*)-1)
+     fdc:	83 c4 10             	add    $0x10,%esp
+     fdf:	83 f8 ff             	cmp    $0xffffffff,%eax
+     fe2:	74 1c                	je     1000 <malloc+0x80>
+  hp->s.size = nu;
+     fe4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+     fe7:	83 ec 0c             	sub    $0xc,%esp
+     fea:	83 c0 08             	add    $0x8,%eax
+     fed:	50                   	push   %eax
+     fee:	e8 fd fe ff ff       	call   ef0 <free>
+  return freep;
+     ff3:	8b 15 40 28 00 00    	mov    0x2840,%edx
+      if((p = morecore(nunits)) == 0)
+     ff9:	83 c4 10             	add    $0x10,%esp
+     ffc:	85 d2                	test   %edx,%edx
+     ffe:	75 c0                	jne    fc0 <malloc+0x40>
+        return 0;
+  }
+}
+    1000:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1003:	31 c0                	xor    %eax,%eax
+}
+    1005:	5b                   	pop    %ebx
+    1006:	5e                   	pop    %esi
+    1007:	5f                   	pop    %edi
+    1008:	5d                   	pop    %ebp
+    1009:	c3                   	ret
+    100a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1010:	39 cf                	cmp    %ecx,%edi
+    1012:	74 4c                	je     1060 <malloc+0xe0>
+        p->s.size -= nunits;
+    1014:	29 f9                	sub    %edi,%ecx
+    1016:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1019:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    101c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    101f:	89 15 40 28 00 00    	mov    %edx,0x2840
+}
+    1025:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1028:	83 c0 08             	add    $0x8,%eax
+}
+    102b:	5b                   	pop    %ebx
+    102c:	5e                   	pop    %esi
+    102d:	5f                   	pop    %edi
+    102e:	5d                   	pop    %ebp
+    102f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1030:	c7 05 40 28 00 00 44 	movl   $0x2844,0x2840
+    1037:	28 00 00 
+    base.s.size = 0;
+    103a:	b8 44 28 00 00       	mov    $0x2844,%eax
+    base.s.ptr = freep = prevp = &base;
+    103f:	c7 05 44 28 00 00 44 	movl   $0x2844,0x2844
+    1046:	28 00 00 
+    base.s.size = 0;
+    1049:	c7 05 48 28 00 00 00 	movl   $0x0,0x2848
+    1050:	00 00 00 
+    if(p->s.size >= nunits){
+    1053:	e9 54 ff ff ff       	jmp    fac <malloc+0x2c>
+    1058:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    105f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1060:	8b 08                	mov    (%eax),%ecx
+    1062:	89 0a                	mov    %ecx,(%edx)
+    1064:	eb b9                	jmp    101f <malloc+0x9f>
+    1066:	66 90                	xchg   %ax,%ax
+    1068:	66 90                	xchg   %ax,%ax
+    106a:	66 90                	xchg   %ax,%ax
+    106c:	66 90                	xchg   %ax,%ax
+    106e:	66 90                	xchg   %ax,%ax
+
+00001070 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+    1070:	55                   	push   %ebp
+    1071:	89 e5                	mov    %esp,%ebp
+    1073:	57                   	push   %edi
+    1074:	56                   	push   %esi
+    1075:	be 01 00 00 00       	mov    $0x1,%esi
+    107a:	53                   	push   %ebx
+    107b:	83 ec 28             	sub    $0x28,%esp
+    107e:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1081:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1084:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+    1087:	68 00 98 00 00       	push   $0x9800
+    108c:	e8 ef fe ff ff       	call   f80 <malloc>
+    1091:	83 c4 10             	add    $0x10,%esp
+    1094:	89 c7                	mov    %eax,%edi
+    1096:	85 c0                	test   %eax,%eax
+    1098:	74 62                	je     10fc <waitpoll+0x8c>
+    109a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+    10a0:	83 ec 0c             	sub    $0xc,%esp
+    10a3:	6a 01                	push   $0x1
+    10a5:	e8 03 fa ff ff       	call   aad <sleep>
+    fn();
+    10aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    10ad:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+    10af:	58                   	pop    %eax
+    10b0:	5a                   	pop    %edx
+    10b1:	68 00 02 00 00       	push   $0x200
+    10b6:	57                   	push   %edi
+    10b7:	e8 eb fa ff ff       	call   ba7 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+    10bc:	83 c4 10             	add    $0x10,%esp
+    10bf:	85 c0                	test   %eax,%eax
+    10c1:	7e 2d                	jle    10f0 <waitpoll+0x80>
+    10c3:	6b c0 4c             	imul   $0x4c,%eax,%eax
+    10c6:	89 fa                	mov    %edi,%edx
+    alive = 0;
+    10c8:	31 c9                	xor    %ecx,%ecx
+    10ca:	01 f8                	add    %edi,%eax
+    10cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+    10d0:	3b 1a                	cmp    (%edx),%ebx
+    10d2:	75 07                	jne    10db <waitpoll+0x6b>
+        alive = 1;
+    10d4:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+    10d8:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+    10db:	83 c2 4c             	add    $0x4c,%edx
+    10de:	39 d0                	cmp    %edx,%eax
+    10e0:	75 ee                	jne    10d0 <waitpoll+0x60>
+  } while(alive);
+    10e2:	85 c9                	test   %ecx,%ecx
+    10e4:	75 ba                	jne    10a0 <waitpoll+0x30>
+    10e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ed:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+    10f0:	83 ec 0c             	sub    $0xc,%esp
+    10f3:	57                   	push   %edi
+    10f4:	e8 f7 fd ff ff       	call   ef0 <free>
+  wait();
+    10f9:	83 c4 10             	add    $0x10,%esp
+}
+    10fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10ff:	5b                   	pop    %ebx
+    1100:	5e                   	pop    %esi
+    1101:	5f                   	pop    %edi
+    1102:	5d                   	pop    %ebp
+  wait();
+    1103:	e9 10 f9 ff ff       	jmp    a18 <wait>
+    1108:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    110f:	90                   	nop
+
+00001110 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+    1110:	55                   	push   %ebp
+    1111:	89 e5                	mov    %esp,%ebp
+    1113:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+    1116:	c7 45 f0 e5 12 00 00 	movl   $0x12e5,-0x10(%ebp)
+    111d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+    1124:	e8 87 f4 ff ff       	call   5b0 <fork>
+    1129:	85 c0                	test   %eax,%eax
+    112b:	78 09                	js     1136 <runps+0x26>
+    return -1;
+  if(pid == 0){
+    112d:	74 0e                	je     113d <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+    112f:	e8 e4 f8 ff ff       	call   a18 <wait>
+}
+    1134:	c9                   	leave
+    1135:	c3                   	ret
+    1136:	c9                   	leave
+    return -1;
+    1137:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    113c:	c3                   	ret
+    exec("ps", argv);
+    113d:	50                   	push   %eax
+    113e:	50                   	push   %eax
+    113f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    1142:	50                   	push   %eax
+    1143:	68 e5 12 00 00       	push   $0x12e5
+    1148:	e8 c3 f4 ff ff       	call   610 <exec>
+    printf(2, "exec ps failed\n");
+    114d:	5a                   	pop    %edx
+    114e:	59                   	pop    %ecx
+    114f:	68 e8 12 00 00       	push   $0x12e8
+    1154:	6a 02                	push   $0x2
+    1156:	e8 55 fb ff ff       	call   cb0 <printf>
+    exit();
+    115b:	e8 a0 f4 ff ff       	call   600 <exit>
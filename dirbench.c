@@ -0,0 +1,87 @@
+// Populate a directory with n names, then look each one up
+// and remove it, timing each phase.  The names are links to
+// a single file, so n is not limited by the number of inodes.
+// The directory is hashed, or linear with -l.  The default n
+// is about twice what the hash buckets of a directory hold, so
+// that most chains get overflow blocks.
+//
+// usage: dirbench [-l] [n]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define DIR "dirbench.d"
+
+char name[32];
+
+// Set name to DIR/x<i>.
+void
+mkname(int i)
+{
+  char *p;
+  int n;
+
+  strcpy(name, DIR "/x");
+  p = name + strlen(name);
+  n = i;
+  do {
+    *p++ = '0' + n % 10;
+    n /= 10;
+  } while(n > 0);
+  *p = 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct stat st;
+  int n, i, fd, t, linear;
+
+  linear = argc > 1 && strcmp(argv[1], "-l") == 0;
+  n = argc > 1 + linear ? atoi(argv[1 + linear]) : 4000;
+  if((linear ? mkdir(DIR) : mkhdir(DIR)) < 0){
+    printf(2, "dirbench: cannot create %s\n", DIR);
+    exit();
+  }
+  if((fd = open(DIR "/file", O_CREATE|O_RDWR)) < 0){
+    printf(2, "dirbench: cannot create %s/file\n", DIR);
+    exit();
+  }
+  close(fd);
+
+  t = uptime();
+  for(i = 0; i < n; i++){
+    mkname(i);
+    if(link(DIR "/file", name) < 0){
+      printf(2, "dirbench: link %s failed\n", name);
+      exit();
+    }
+  }
+  printf(1, "create: %d names in %d ticks\n", n, uptime() - t);
+
+  t = uptime();
+  for(i = 0; i < n; i++){
+    mkname(i);
+    if(stat(name, &st) < 0){
+      printf(2, "dirbench: stat %s failed\n", name);
+      exit();
+    }
+  }
+  printf(1, "lookup: %d names in %d ticks\n", n, uptime() - t);
+
+  t = uptime();
+  for(i = 0; i < n; i++){
+    mkname(i);
+    if(unlink(name) < 0){
+      printf(2, "dirbench: unlink %s failed\n", name);
+      exit();
+    }
+  }
+  printf(1, "unlink: %d names in %d ticks\n", n, uptime() - t);
+
+  unlink(DIR "/file");
+  unlink(DIR);
+  exit();
+}
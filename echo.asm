@@ -0,0 +1,1966 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  for(i = 1; i < argc; i++)
+  19:	83 fe 01             	cmp    $0x1,%esi
+  1c:	7e 47                	jle    65 <main+0x65>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  1e:	8b 47 04             	mov    0x4(%edi),%eax
+  21:	83 fe 02             	cmp    $0x2,%esi
+  24:	74 2a                	je     50 <main+0x50>
+  26:	bb 02 00 00 00       	mov    $0x2,%ebx
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  30:	68 60 0e 00 00       	push   $0xe60
+  35:	83 c3 01             	add    $0x1,%ebx
+  38:	50                   	push   %eax
+  39:	68 62 0e 00 00       	push   $0xe62
+  3e:	6a 01                	push   $0x1
+  40:	e8 6b 09 00 00       	call   9b0 <printf>
+  45:	8b 44 9f fc          	mov    -0x4(%edi,%ebx,4),%eax
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 f3                	cmp    %esi,%ebx
+  4e:	75 e0                	jne    30 <main+0x30>
+  50:	68 ea 0e 00 00       	push   $0xeea
+  55:	50                   	push   %eax
+  56:	68 62 0e 00 00       	push   $0xe62
+  5b:	6a 01                	push   $0x1
+  5d:	e8 4e 09 00 00       	call   9b0 <printf>
+  62:	83 c4 10             	add    $0x10,%esp
+  exit();
+  65:	e8 96 02 00 00       	call   300 <exit>
+  6a:	66 90                	xchg   %ax,%ax
+  6c:	66 90                	xchg   %ax,%ax
+  6e:	66 90                	xchg   %ax,%ax
+
+00000070 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+  70:	55                   	push   %ebp
+  71:	89 e5                	mov    %esp,%ebp
+  73:	57                   	push   %edi
+  74:	56                   	push   %esi
+  75:	53                   	push   %ebx
+  76:	83 ec 4c             	sub    $0x4c,%esp
+  79:	8b 45 0c             	mov    0xc(%ebp),%eax
+  7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  7f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  82:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+  85:	83 fa 0f             	cmp    $0xf,%edx
+  88:	0f 87 32 01 00 00    	ja     1c0 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+  8e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+  94:	8b 80 60 13 00 00    	mov    0x1360(%eax),%eax
+  9a:	85 c0                	test   %eax,%eax
+  9c:	0f 84 de 00 00 00    	je     180 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+  a2:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+  a8:	8b b0 64 13 00 00    	mov    0x1364(%eax),%esi
+  ae:	8d 88 60 13 00 00    	lea    0x1360(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+  b4:	8d b8 68 13 00 00    	lea    0x1368(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+  ba:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+  bd:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+  c0:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+  c3:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+  c9:	0f 8f 01 01 00 00    	jg     1d0 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+  cf:	8d 78 08             	lea    0x8(%eax),%edi
+  d2:	8d bc 3e 60 13 00 00 	lea    0x1360(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+  d9:	85 db                	test   %ebx,%ebx
+  db:	7e 3b                	jle    118 <bufwrite+0xa8>
+  dd:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+  e0:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  e7:	90                   	nop
+    *dst++ = *src++;
+  e8:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+  e9:	39 c6                	cmp    %eax,%esi
+  eb:	75 fb                	jne    e8 <bufwrite+0x78>
+  ob[fd].n += n;
+  ed:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+  f3:	8b 88 64 13 00 00    	mov    0x1364(%eax),%ecx
+  f9:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+  fb:	83 b8 60 13 00 00 01 	cmpl   $0x1,0x1360(%eax)
+  ob[fd].n += n;
+ 102:	89 88 64 13 00 00    	mov    %ecx,0x1364(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 108:	74 26                	je     130 <bufwrite+0xc0>
+}
+ 10a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 10d:	5b                   	pop    %ebx
+ 10e:	5e                   	pop    %esi
+ 10f:	5f                   	pop    %edi
+ 110:	5d                   	pop    %ebp
+ 111:	c3                   	ret
+ 112:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+ 118:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 11b:	83 b8 60 13 00 00 01 	cmpl   $0x1,0x1360(%eax)
+  ob[fd].n += n;
+ 122:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 125:	75 e3                	jne    10a <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+ 127:	85 db                	test   %ebx,%ebx
+ 129:	74 df                	je     10a <bufwrite+0x9a>
+ 12b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 12f:	90                   	nop
+  src = vsrc;
+ 130:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 133:	01 c3                	add    %eax,%ebx
+ 135:	eb 10                	jmp    147 <bufwrite+0xd7>
+ 137:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13e:	66 90                	xchg   %ax,%ax
+ 140:	83 c0 01             	add    $0x1,%eax
+ 143:	39 d8                	cmp    %ebx,%eax
+ 145:	74 c3                	je     10a <bufwrite+0x9a>
+    if(*p == (char)c)
+ 147:	80 38 0a             	cmpb   $0xa,(%eax)
+ 14a:	75 f4                	jne    140 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 14c:	85 c9                	test   %ecx,%ecx
+ 14e:	7e ba                	jle    10a <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 150:	83 ec 04             	sub    $0x4,%esp
+ 153:	51                   	push   %ecx
+ 154:	ff 75 ac             	push   -0x54(%ebp)
+ 157:	52                   	push   %edx
+ 158:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+ 15b:	e8 cd 05 00 00       	call   72d <write>
+    ob[fd].n = 0;
+ 160:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+ 163:	83 c4 10             	add    $0x10,%esp
+ 166:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+ 16c:	c7 82 64 13 00 00 00 	movl   $0x0,0x1364(%edx)
+ 173:	00 00 00 
+ 176:	eb 92                	jmp    10a <bufwrite+0x9a>
+ 178:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17f:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 180:	83 ec 08             	sub    $0x8,%esp
+ 183:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 186:	50                   	push   %eax
+ 187:	52                   	push   %edx
+ 188:	89 55 b0             	mov    %edx,-0x50(%ebp)
+ 18b:	e8 d7 05 00 00       	call   767 <fstat>
+ 190:	83 c4 10             	add    $0x10,%esp
+ 193:	8b 55 b0             	mov    -0x50(%ebp),%edx
+ 196:	89 c1                	mov    %eax,%ecx
+ 198:	b8 02 00 00 00       	mov    $0x2,%eax
+ 19d:	85 c9                	test   %ecx,%ecx
+ 19f:	75 0d                	jne    1ae <bufwrite+0x13e>
+ 1a1:	31 c0                	xor    %eax,%eax
+ 1a3:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 1a8:	0f 95 c0             	setne  %al
+ 1ab:	83 c0 01             	add    $0x1,%eax
+ 1ae:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+ 1b4:	89 81 60 13 00 00    	mov    %eax,0x1360(%ecx)
+ 1ba:	e9 e3 fe ff ff       	jmp    a2 <bufwrite+0x32>
+ 1bf:	90                   	nop
+}
+ 1c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1c3:	5b                   	pop    %ebx
+ 1c4:	5e                   	pop    %esi
+ 1c5:	5f                   	pop    %edi
+ 1c6:	5d                   	pop    %ebp
+    write(fd, p, n);
+ 1c7:	e9 61 05 00 00       	jmp    72d <write>
+ 1cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+ 1d0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+ 1d3:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+ 1d6:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+ 1d9:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+ 1dc:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+ 1df:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+ 1e2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+ 1e5:	6a 02                	push   $0x2
+ 1e7:	50                   	push   %eax
+ 1e8:	52                   	push   %edx
+ 1e9:	e8 9b 06 00 00       	call   889 <writev>
+    ob[fd].n = 0;
+ 1ee:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+ 1f1:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+ 1f4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ 1fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1fe:	5b                   	pop    %ebx
+ 1ff:	5e                   	pop    %esi
+ 200:	5f                   	pop    %edi
+ 201:	5d                   	pop    %ebp
+ 202:	c3                   	ret
+ 203:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000210 <fflush>:
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	53                   	push   %ebx
+ 214:	83 ec 04             	sub    $0x4,%esp
+ 217:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 21a:	83 f8 0f             	cmp    $0xf,%eax
+ 21d:	77 16                	ja     235 <fflush+0x25>
+ 21f:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+ 225:	8b 8a 64 13 00 00    	mov    0x1364(%edx),%ecx
+ 22b:	8d 9a 60 13 00 00    	lea    0x1360(%edx),%ebx
+ 231:	85 c9                	test   %ecx,%ecx
+ 233:	7f 0b                	jg     240 <fflush+0x30>
+}
+ 235:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 238:	c9                   	leave
+ 239:	c3                   	ret
+ 23a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 240:	83 ec 04             	sub    $0x4,%esp
+ 243:	81 c2 68 13 00 00    	add    $0x1368,%edx
+ 249:	51                   	push   %ecx
+ 24a:	52                   	push   %edx
+ 24b:	50                   	push   %eax
+ 24c:	e8 dc 04 00 00       	call   72d <write>
+    ob[fd].n = 0;
+ 251:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+ 258:	83 c4 10             	add    $0x10,%esp
+}
+ 25b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 25e:	c9                   	leave
+ 25f:	c3                   	ret
+
+00000260 <fflushall>:
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 264:	31 f6                	xor    %esi,%esi
+{
+ 266:	53                   	push   %ebx
+ 267:	bb 68 13 00 00       	mov    $0x1368,%ebx
+ 26c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 270:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 273:	85 c0                	test   %eax,%eax
+ 275:	7e 15                	jle    28c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 277:	83 ec 04             	sub    $0x4,%esp
+ 27a:	50                   	push   %eax
+ 27b:	53                   	push   %ebx
+ 27c:	56                   	push   %esi
+ 27d:	e8 ab 04 00 00       	call   72d <write>
+    ob[fd].n = 0;
+ 282:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 289:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 28c:	83 c6 01             	add    $0x1,%esi
+ 28f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 295:	83 fe 10             	cmp    $0x10,%esi
+ 298:	75 d6                	jne    270 <fflushall+0x10>
+}
+ 29a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 29d:	5b                   	pop    %ebx
+ 29e:	5e                   	pop    %esi
+ 29f:	5d                   	pop    %ebp
+ 2a0:	c3                   	ret
+ 2a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2af:	90                   	nop
+
+000002b0 <fork>:
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 2b4:	31 f6                	xor    %esi,%esi
+{
+ 2b6:	53                   	push   %ebx
+ 2b7:	bb 68 13 00 00       	mov    $0x1368,%ebx
+ 2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 2c0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 2c3:	85 c0                	test   %eax,%eax
+ 2c5:	7e 15                	jle    2dc <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 2c7:	83 ec 04             	sub    $0x4,%esp
+ 2ca:	50                   	push   %eax
+ 2cb:	53                   	push   %ebx
+ 2cc:	56                   	push   %esi
+ 2cd:	e8 5b 04 00 00       	call   72d <write>
+    ob[fd].n = 0;
+ 2d2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 2d9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 2dc:	83 c6 01             	add    $0x1,%esi
+ 2df:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 2e5:	83 fe 10             	cmp    $0x10,%esi
+ 2e8:	75 d6                	jne    2c0 <fork+0x10>
+}
+ 2ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2ed:	5b                   	pop    %ebx
+ 2ee:	5e                   	pop    %esi
+ 2ef:	5d                   	pop    %ebp
+  return _fork();
+ 2f0:	e9 15 04 00 00       	jmp    70a <_fork>
+ 2f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <exit>:
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+ 306:	e8 55 ff ff ff       	call   260 <fflushall>
+  _exit();
+ 30b:	e8 01 04 00 00       	call   711 <_exit>
+
+00000310 <exec>:
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	57                   	push   %edi
+ 314:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 315:	31 f6                	xor    %esi,%esi
+{
+ 317:	53                   	push   %ebx
+ 318:	bb 68 13 00 00       	mov    $0x1368,%ebx
+ 31d:	83 ec 1c             	sub    $0x1c,%esp
+ 320:	8b 45 08             	mov    0x8(%ebp),%eax
+ 323:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 326:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 329:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 330:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 333:	85 c0                	test   %eax,%eax
+ 335:	7e 15                	jle    34c <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 337:	83 ec 04             	sub    $0x4,%esp
+ 33a:	50                   	push   %eax
+ 33b:	53                   	push   %ebx
+ 33c:	56                   	push   %esi
+ 33d:	e8 eb 03 00 00       	call   72d <write>
+    ob[fd].n = 0;
+ 342:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 349:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 34c:	83 c6 01             	add    $0x1,%esi
+ 34f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 355:	83 fe 10             	cmp    $0x10,%esi
+ 358:	75 d6                	jne    330 <exec+0x20>
+  return _exec(path, argv);
+ 35a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 35d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+ 360:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ 363:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 366:	5b                   	pop    %ebx
+ 367:	5e                   	pop    %esi
+ 368:	5f                   	pop    %edi
+ 369:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 36a:	e9 d3 03 00 00       	jmp    742 <_exec>
+ 36f:	90                   	nop
+
+00000370 <close>:
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	56                   	push   %esi
+ 374:	53                   	push   %ebx
+ 375:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 378:	83 fb 0f             	cmp    $0xf,%ebx
+ 37b:	77 26                	ja     3a3 <close+0x33>
+ 37d:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 383:	8b 90 64 13 00 00    	mov    0x1364(%eax),%edx
+ 389:	8d b0 60 13 00 00    	lea    0x1360(%eax),%esi
+ 38f:	85 d2                	test   %edx,%edx
+ 391:	7f 25                	jg     3b8 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+ 393:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 399:	c7 80 60 13 00 00 00 	movl   $0x0,0x1360(%eax)
+ 3a0:	00 00 00 
+  return _close(fd);
+ 3a3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 3a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3a9:	5b                   	pop    %ebx
+ 3aa:	5e                   	pop    %esi
+ 3ab:	5d                   	pop    %ebp
+  return _close(fd);
+ 3ac:	e9 83 03 00 00       	jmp    734 <_close>
+ 3b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 3b8:	83 ec 04             	sub    $0x4,%esp
+ 3bb:	05 68 13 00 00       	add    $0x1368,%eax
+ 3c0:	52                   	push   %edx
+ 3c1:	50                   	push   %eax
+ 3c2:	53                   	push   %ebx
+ 3c3:	e8 65 03 00 00       	call   72d <write>
+    ob[fd].n = 0;
+ 3c8:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+ 3cf:	83 c4 10             	add    $0x10,%esp
+ 3d2:	eb bf                	jmp    393 <close+0x23>
+ 3d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3df:	90                   	nop
+
+000003e0 <strcpy>:
+{
+ 3e0:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+ 3e1:	31 c0                	xor    %eax,%eax
+{
+ 3e3:	89 e5                	mov    %esp,%ebp
+ 3e5:	53                   	push   %ebx
+ 3e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 3f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 3f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 3f7:	83 c0 01             	add    $0x1,%eax
+ 3fa:	84 d2                	test   %dl,%dl
+ 3fc:	75 f2                	jne    3f0 <strcpy+0x10>
+}
+ 3fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 401:	89 c8                	mov    %ecx,%eax
+ 403:	c9                   	leave
+ 404:	c3                   	ret
+ 405:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000410 <strcmp>:
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	53                   	push   %ebx
+ 414:	8b 55 08             	mov    0x8(%ebp),%edx
+ 417:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 41a:	0f b6 02             	movzbl (%edx),%eax
+ 41d:	84 c0                	test   %al,%al
+ 41f:	75 17                	jne    438 <strcmp+0x28>
+ 421:	eb 3a                	jmp    45d <strcmp+0x4d>
+ 423:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 427:	90                   	nop
+ 428:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 42c:	83 c2 01             	add    $0x1,%edx
+ 42f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 432:	84 c0                	test   %al,%al
+ 434:	74 1a                	je     450 <strcmp+0x40>
+    p++, q++;
+ 436:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 438:	0f b6 19             	movzbl (%ecx),%ebx
+ 43b:	38 c3                	cmp    %al,%bl
+ 43d:	74 e9                	je     428 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 43f:	29 d8                	sub    %ebx,%eax
+}
+ 441:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 444:	c9                   	leave
+ 445:	c3                   	ret
+ 446:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 450:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 454:	31 c0                	xor    %eax,%eax
+ 456:	29 d8                	sub    %ebx,%eax
+}
+ 458:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 45b:	c9                   	leave
+ 45c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 45d:	0f b6 19             	movzbl (%ecx),%ebx
+ 460:	31 c0                	xor    %eax,%eax
+ 462:	eb db                	jmp    43f <strcmp+0x2f>
+ 464:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 46f:	90                   	nop
+
+00000470 <strlen>:
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+ 476:	80 3a 00             	cmpb   $0x0,(%edx)
+ 479:	74 15                	je     490 <strlen+0x20>
+ 47b:	31 c0                	xor    %eax,%eax
+ 47d:	8d 76 00             	lea    0x0(%esi),%esi
+ 480:	83 c0 01             	add    $0x1,%eax
+ 483:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 487:	89 c1                	mov    %eax,%ecx
+ 489:	75 f5                	jne    480 <strlen+0x10>
+}
+ 48b:	89 c8                	mov    %ecx,%eax
+ 48d:	5d                   	pop    %ebp
+ 48e:	c3                   	ret
+ 48f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 490:	31 c9                	xor    %ecx,%ecx
+}
+ 492:	5d                   	pop    %ebp
+ 493:	89 c8                	mov    %ecx,%eax
+ 495:	c3                   	ret
+ 496:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004a0 <memset>:
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	57                   	push   %edi
+ 4a4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 4a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4ad:	89 d7                	mov    %edx,%edi
+ 4af:	fc                   	cld
+ 4b0:	f3 aa                	rep stos %al,%es:(%edi)
+}
+ 4b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 4b5:	89 d0                	mov    %edx,%eax
+ 4b7:	c9                   	leave
+ 4b8:	c3                   	ret
+ 4b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <strchr>:
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 4ca:	0f b6 10             	movzbl (%eax),%edx
+ 4cd:	84 d2                	test   %dl,%dl
+ 4cf:	75 12                	jne    4e3 <strchr+0x23>
+ 4d1:	eb 1d                	jmp    4f0 <strchr+0x30>
+ 4d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4d7:	90                   	nop
+ 4d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 4dc:	83 c0 01             	add    $0x1,%eax
+ 4df:	84 d2                	test   %dl,%dl
+ 4e1:	74 0d                	je     4f0 <strchr+0x30>
+    if(*s == c)
+ 4e3:	38 d1                	cmp    %dl,%cl
+ 4e5:	75 f1                	jne    4d8 <strchr+0x18>
+}
+ 4e7:	5d                   	pop    %ebp
+ 4e8:	c3                   	ret
+ 4e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 4f0:	31 c0                	xor    %eax,%eax
+}
+ 4f2:	5d                   	pop    %ebp
+ 4f3:	c3                   	ret
+ 4f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4ff:	90                   	nop
+
+00000500 <memchr>:
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	8b 55 10             	mov    0x10(%ebp),%edx
+ 506:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 509:	85 d2                	test   %edx,%edx
+ 50b:	74 1b                	je     528 <memchr+0x28>
+    if(*p == (char)c)
+ 50d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+ 511:	01 c2                	add    %eax,%edx
+ 513:	eb 0a                	jmp    51f <memchr+0x1f>
+ 515:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+ 518:	83 c0 01             	add    $0x1,%eax
+ 51b:	39 c2                	cmp    %eax,%edx
+ 51d:	74 09                	je     528 <memchr+0x28>
+    if(*p == (char)c)
+ 51f:	38 08                	cmp    %cl,(%eax)
+ 521:	75 f5                	jne    518 <memchr+0x18>
+}
+ 523:	5d                   	pop    %ebp
+ 524:	c3                   	ret
+ 525:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+ 528:	31 c0                	xor    %eax,%eax
+}
+ 52a:	5d                   	pop    %ebp
+ 52b:	c3                   	ret
+ 52c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000530 <gets>:
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+ 534:	31 ff                	xor    %edi,%edi
+{
+ 536:	56                   	push   %esi
+ 537:	be 68 13 00 00       	mov    $0x1368,%esi
+ 53c:	53                   	push   %ebx
+ 53d:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 540:	8b 46 fc             	mov    -0x4(%esi),%eax
+ 543:	85 c0                	test   %eax,%eax
+ 545:	7e 15                	jle    55c <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 547:	83 ec 04             	sub    $0x4,%esp
+ 54a:	50                   	push   %eax
+ 54b:	56                   	push   %esi
+ 54c:	57                   	push   %edi
+ 54d:	e8 db 01 00 00       	call   72d <write>
+    ob[fd].n = 0;
+ 552:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+ 559:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 55c:	83 c7 01             	add    $0x1,%edi
+ 55f:	81 c6 08 01 00 00    	add    $0x108,%esi
+ 565:	83 ff 10             	cmp    $0x10,%edi
+ 568:	75 d6                	jne    540 <gets+0x10>
+  for(i=0; i+1 < max; ){
+ 56a:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+ 56c:	8d 75 e7             	lea    -0x19(%ebp),%esi
+ 56f:	eb 2e                	jmp    59f <gets+0x6f>
+ 571:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 578:	83 ec 04             	sub    $0x4,%esp
+ 57b:	6a 01                	push   $0x1
+ 57d:	56                   	push   %esi
+ 57e:	6a 00                	push   $0x0
+ 580:	e8 a1 01 00 00       	call   726 <read>
+    if(cc < 1)
+ 585:	83 c4 10             	add    $0x10,%esp
+ 588:	85 c0                	test   %eax,%eax
+ 58a:	7e 1d                	jle    5a9 <gets+0x79>
+    buf[i++] = c;
+ 58c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 590:	8b 55 08             	mov    0x8(%ebp),%edx
+ 593:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 597:	3c 0a                	cmp    $0xa,%al
+ 599:	74 10                	je     5ab <gets+0x7b>
+ 59b:	3c 0d                	cmp    $0xd,%al
+ 59d:	74 0c                	je     5ab <gets+0x7b>
+  for(i=0; i+1 < max; ){
+ 59f:	89 df                	mov    %ebx,%edi
+ 5a1:	83 c3 01             	add    $0x1,%ebx
+ 5a4:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 5a7:	7c cf                	jl     578 <gets+0x48>
+ 5a9:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 5ab:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5ae:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 5b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5b5:	5b                   	pop    %ebx
+ 5b6:	5e                   	pop    %esi
+ 5b7:	5f                   	pop    %edi
+ 5b8:	5d                   	pop    %ebp
+ 5b9:	c3                   	ret
+ 5ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000005c0 <stat>:
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	57                   	push   %edi
+ 5c4:	56                   	push   %esi
+ 5c5:	53                   	push   %ebx
+ 5c6:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+ 5c9:	6a 00                	push   $0x0
+ 5cb:	ff 75 08             	push   0x8(%ebp)
+ 5ce:	e8 76 01 00 00       	call   749 <open>
+  if(fd < 0)
+ 5d3:	83 c4 10             	add    $0x10,%esp
+ 5d6:	85 c0                	test   %eax,%eax
+ 5d8:	78 76                	js     650 <stat+0x90>
+  r = fstat(fd, st);
+ 5da:	83 ec 08             	sub    $0x8,%esp
+ 5dd:	ff 75 0c             	push   0xc(%ebp)
+ 5e0:	89 c3                	mov    %eax,%ebx
+ 5e2:	50                   	push   %eax
+ 5e3:	e8 7f 01 00 00       	call   767 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 5e8:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 5eb:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 5ed:	83 fb 0f             	cmp    $0xf,%ebx
+ 5f0:	7f 40                	jg     632 <stat+0x72>
+ 5f2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 5f8:	8b 90 64 13 00 00    	mov    0x1364(%eax),%edx
+ 5fe:	8d b8 60 13 00 00    	lea    0x1360(%eax),%edi
+ 604:	85 d2                	test   %edx,%edx
+ 606:	7e 1a                	jle    622 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 608:	83 ec 04             	sub    $0x4,%esp
+ 60b:	05 68 13 00 00       	add    $0x1368,%eax
+ 610:	52                   	push   %edx
+ 611:	50                   	push   %eax
+ 612:	53                   	push   %ebx
+ 613:	e8 15 01 00 00       	call   72d <write>
+    ob[fd].n = 0;
+ 618:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+ 61f:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+ 622:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 628:	c7 80 60 13 00 00 00 	movl   $0x0,0x1360(%eax)
+ 62f:	00 00 00 
+  return _close(fd);
+ 632:	83 ec 0c             	sub    $0xc,%esp
+ 635:	53                   	push   %ebx
+ 636:	e8 f9 00 00 00       	call   734 <_close>
+ 63b:	83 c4 10             	add    $0x10,%esp
+}
+ 63e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 641:	89 f0                	mov    %esi,%eax
+ 643:	5b                   	pop    %ebx
+ 644:	5e                   	pop    %esi
+ 645:	5f                   	pop    %edi
+ 646:	5d                   	pop    %ebp
+ 647:	c3                   	ret
+ 648:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 64f:	90                   	nop
+    return -1;
+ 650:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 655:	eb e7                	jmp    63e <stat+0x7e>
+ 657:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 65e:	66 90                	xchg   %ax,%ax
+
+00000660 <atoi>:
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	53                   	push   %ebx
+ 664:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 667:	0f be 02             	movsbl (%edx),%eax
+ 66a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 66d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 670:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 675:	77 1e                	ja     695 <atoi+0x35>
+ 677:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 680:	83 c2 01             	add    $0x1,%edx
+ 683:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 686:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 68a:	0f be 02             	movsbl (%edx),%eax
+ 68d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 690:	80 fb 09             	cmp    $0x9,%bl
+ 693:	76 eb                	jbe    680 <atoi+0x20>
+}
+ 695:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 698:	89 c8                	mov    %ecx,%eax
+ 69a:	c9                   	leave
+ 69b:	c3                   	ret
+ 69c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006a0 <memmove>:
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	57                   	push   %edi
+ 6a4:	56                   	push   %esi
+ 6a5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 6a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 6ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 6ae:	85 c0                	test   %eax,%eax
+ 6b0:	7e 13                	jle    6c5 <memmove+0x25>
+ 6b2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 6b4:	89 d7                	mov    %edx,%edi
+ 6b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6bd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 6c0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 6c1:	39 f8                	cmp    %edi,%eax
+ 6c3:	75 fb                	jne    6c0 <memmove+0x20>
+  return vdst;
+}
+ 6c5:	5e                   	pop    %esi
+ 6c6:	89 d0                	mov    %edx,%eax
+ 6c8:	5f                   	pop    %edi
+ 6c9:	5d                   	pop    %ebp
+ 6ca:	c3                   	ret
+
+000006cb <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+ 6cb:	83 3d 58 13 00 00 00 	cmpl   $0x0,0x1358
+  jle 1f
+ 6d2:	7e 0a                	jle    6de <syscallentry+0x13>
+  movl %esp, %ecx
+ 6d4:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 6d6:	ba dd 06 00 00       	mov    $0x6dd,%edx
+  sysenter
+ 6db:	0f 34                	sysenter
+2:
+  ret
+ 6dd:	c3                   	ret
+1:
+  jl 3f
+ 6de:	7c 27                	jl     707 <syscallentry+0x3c>
+  pushal
+ 6e0:	60                   	pusha
+  movl $1, %eax
+ 6e1:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 6e6:	0f a2                	cpuid
+  movl $-1, sysentermode
+ 6e8:	c7 05 58 13 00 00 ff 	movl   $0xffffffff,0x1358
+ 6ef:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 6f2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+ 6f8:	74 0a                	je     704 <syscallentry+0x39>
+  movl $1, sysentermode
+ 6fa:	c7 05 58 13 00 00 01 	movl   $0x1,0x1358
+ 701:	00 00 00 
+4:
+  popal
+ 704:	61                   	popa
+  jmp syscallentry
+ 705:	eb c4                	jmp    6cb <syscallentry>
+3:
+  int $T_SYSCALL
+ 707:	cd 40                	int    $0x40
+  ret
+ 709:	c3                   	ret
+
+0000070a <_fork>:
+
+SYSCALLAS(_fork, fork)
+ 70a:	b8 01 00 00 00       	mov    $0x1,%eax
+ 70f:	eb ba                	jmp    6cb <syscallentry>
+
+00000711 <_exit>:
+SYSCALLAS(_exit, exit)
+ 711:	b8 02 00 00 00       	mov    $0x2,%eax
+ 716:	eb b3                	jmp    6cb <syscallentry>
+
+00000718 <wait>:
+SYSCALL(wait)
+ 718:	b8 03 00 00 00       	mov    $0x3,%eax
+ 71d:	eb ac                	jmp    6cb <syscallentry>
+
+0000071f <pipe>:
+SYSCALL(pipe)
+ 71f:	b8 04 00 00 00       	mov    $0x4,%eax
+ 724:	eb a5                	jmp    6cb <syscallentry>
+
+00000726 <read>:
+SYSCALL(read)
+ 726:	b8 05 00 00 00       	mov    $0x5,%eax
+ 72b:	eb 9e                	jmp    6cb <syscallentry>
+
+0000072d <write>:
+SYSCALL(write)
+ 72d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 732:	eb 97                	jmp    6cb <syscallentry>
+
+00000734 <_close>:
+SYSCALLAS(_close, close)
+ 734:	b8 15 00 00 00       	mov    $0x15,%eax
+ 739:	eb 90                	jmp    6cb <syscallentry>
+
+0000073b <kill>:
+SYSCALL(kill)
+ 73b:	b8 06 00 00 00       	mov    $0x6,%eax
+ 740:	eb 89                	jmp    6cb <syscallentry>
+
+00000742 <_exec>:
+SYSCALLAS(_exec, exec)
+ 742:	b8 07 00 00 00       	mov    $0x7,%eax
+ 747:	eb 82                	jmp    6cb <syscallentry>
+
+00000749 <open>:
+SYSCALL(open)
+ 749:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 74e:	e9 78 ff ff ff       	jmp    6cb <syscallentry>
+
+00000753 <mknod>:
+SYSCALL(mknod)
+ 753:	b8 11 00 00 00       	mov    $0x11,%eax
+ 758:	e9 6e ff ff ff       	jmp    6cb <syscallentry>
+
+0000075d <unlink>:
+SYSCALL(unlink)
+ 75d:	b8 12 00 00 00       	mov    $0x12,%eax
+ 762:	e9 64 ff ff ff       	jmp    6cb <syscallentry>
+
+00000767 <fstat>:
+SYSCALL(fstat)
+ 767:	b8 08 00 00 00       	mov    $0x8,%eax
+ 76c:	e9 5a ff ff ff       	jmp    6cb <syscallentry>
+
+00000771 <link>:
+SYSCALL(link)
+ 771:	b8 13 00 00 00       	mov    $0x13,%eax
+ 776:	e9 50 ff ff ff       	jmp    6cb <syscallentry>
+
+0000077b <mkdir>:
+SYSCALL(mkdir)
+ 77b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 780:	e9 46 ff ff ff       	jmp    6cb <syscallentry>
+
+00000785 <chdir>:
+SYSCALL(chdir)
+ 785:	b8 09 00 00 00       	mov    $0x9,%eax
+ 78a:	e9 3c ff ff ff       	jmp    6cb <syscallentry>
+
+0000078f <dup>:
+SYSCALL(dup)
+ 78f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 794:	e9 32 ff ff ff       	jmp    6cb <syscallentry>
+
+00000799 <getpid>:
+SYSCALL(getpid)
+ 799:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 79e:	e9 28 ff ff ff       	jmp    6cb <syscallentry>
+
+000007a3 <sbrk>:
+SYSCALL(sbrk)
+ 7a3:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 7a8:	e9 1e ff ff ff       	jmp    6cb <syscallentry>
+
+000007ad <sleep>:
+SYSCALL(sleep)
+ 7ad:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 7b2:	e9 14 ff ff ff       	jmp    6cb <syscallentry>
+
+000007b7 <uptime>:
+SYSCALL(uptime)
+ 7b7:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 7bc:	e9 0a ff ff ff       	jmp    6cb <syscallentry>
+
+000007c1 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+ 7c1:	b8 16 00 00 00       	mov    $0x16,%eax
+ 7c6:	e9 00 ff ff ff       	jmp    6cb <syscallentry>
+
+000007cb <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+ 7cb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 7d0:	e9 f6 fe ff ff       	jmp    6cb <syscallentry>
+
+000007d5 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+ 7d5:	b8 18 00 00 00       	mov    $0x18,%eax
+ 7da:	e9 ec fe ff ff       	jmp    6cb <syscallentry>
+
+000007df <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+ 7df:	b8 19 00 00 00       	mov    $0x19,%eax
+ 7e4:	e9 e2 fe ff ff       	jmp    6cb <syscallentry>
+
+000007e9 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+ 7e9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 7ee:	e9 d8 fe ff ff       	jmp    6cb <syscallentry>
+
+000007f3 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+ 7f3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 7f8:	e9 ce fe ff ff       	jmp    6cb <syscallentry>
+
+000007fd <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+ 7fd:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 802:	e9 c4 fe ff ff       	jmp    6cb <syscallentry>
+
+00000807 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+ 807:	b8 20 00 00 00       	mov    $0x20,%eax
+ 80c:	e9 ba fe ff ff       	jmp    6cb <syscallentry>
+
+00000811 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+ 811:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 816:	e9 b0 fe ff ff       	jmp    6cb <syscallentry>
+
+0000081b <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+ 81b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 820:	e9 a6 fe ff ff       	jmp    6cb <syscallentry>
+
+00000825 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+ 825:	b8 21 00 00 00       	mov    $0x21,%eax
+ 82a:	e9 9c fe ff ff       	jmp    6cb <syscallentry>
+
+0000082f <yield>:
+SYSCALL(yield) // yield the CPU to another process
+ 82f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 834:	e9 92 fe ff ff       	jmp    6cb <syscallentry>
+
+00000839 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+ 839:	b8 23 00 00 00       	mov    $0x23,%eax
+ 83e:	e9 88 fe ff ff       	jmp    6cb <syscallentry>
+
+00000843 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+ 843:	b8 24 00 00 00       	mov    $0x24,%eax
+ 848:	e9 7e fe ff ff       	jmp    6cb <syscallentry>
+
+0000084d <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+ 84d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 852:	e9 74 fe ff ff       	jmp    6cb <syscallentry>
+
+00000857 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+ 857:	b8 26 00 00 00       	mov    $0x26,%eax
+ 85c:	e9 6a fe ff ff       	jmp    6cb <syscallentry>
+
+00000861 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+ 861:	b8 27 00 00 00       	mov    $0x27,%eax
+ 866:	e9 60 fe ff ff       	jmp    6cb <syscallentry>
+
+0000086b <mmap>:
+SYSCALL(mmap) // map a file into memory
+ 86b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 870:	e9 56 fe ff ff       	jmp    6cb <syscallentry>
+
+00000875 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+ 875:	b8 29 00 00 00       	mov    $0x29,%eax
+ 87a:	e9 4c fe ff ff       	jmp    6cb <syscallentry>
+
+0000087f <readv>:
+SYSCALL(readv) // read into several buffers
+ 87f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 884:	e9 42 fe ff ff       	jmp    6cb <syscallentry>
+
+00000889 <writev>:
+SYSCALL(writev) // write from several buffers
+ 889:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 88e:	e9 38 fe ff ff       	jmp    6cb <syscallentry>
+
+00000893 <pread>:
+SYSCALL(pread) // read at an offset
+ 893:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 898:	e9 2e fe ff ff       	jmp    6cb <syscallentry>
+
+0000089d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+ 89d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 8a2:	e9 24 fe ff ff       	jmp    6cb <syscallentry>
+
+000008a7 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+ 8a7:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 8ac:	e9 1a fe ff ff       	jmp    6cb <syscallentry>
+
+000008b1 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+ 8b1:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 8b6:	e9 10 fe ff ff       	jmp    6cb <syscallentry>
+
+000008bb <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+ 8bb:	b8 30 00 00 00       	mov    $0x30,%eax
+ 8c0:	e9 06 fe ff ff       	jmp    6cb <syscallentry>
+
+000008c5 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+ 8c5:	b8 31 00 00 00       	mov    $0x31,%eax
+ 8ca:	e9 fc fd ff ff       	jmp    6cb <syscallentry>
+
+000008cf <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+ 8cf:	b8 32 00 00 00       	mov    $0x32,%eax
+ 8d4:	e9 f2 fd ff ff       	jmp    6cb <syscallentry>
+
+000008d9 <profread>:
+SYSCALL(profread) // drain profiler samples
+ 8d9:	b8 33 00 00 00       	mov    $0x33,%eax
+ 8de:	e9 e8 fd ff ff       	jmp    6cb <syscallentry>
+
+000008e3 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+ 8e3:	b8 34 00 00 00       	mov    $0x34,%eax
+ 8e8:	e9 de fd ff ff       	jmp    6cb <syscallentry>
+
+000008ed <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+ 8ed:	b8 35 00 00 00       	mov    $0x35,%eax
+ 8f2:	e9 d4 fd ff ff       	jmp    6cb <syscallentry>
+
+000008f7 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+ 8f7:	b8 36 00 00 00       	mov    $0x36,%eax
+ 8fc:	e9 ca fd ff ff       	jmp    6cb <syscallentry>
+
+00000901 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+ 901:	b8 37 00 00 00       	mov    $0x37,%eax
+ 906:	e9 c0 fd ff ff       	jmp    6cb <syscallentry>
+ 90b:	66 90                	xchg   %ax,%ax
+ 90d:	66 90                	xchg   %ax,%ax
+ 90f:	90                   	nop
+
+00000910 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 910:	55                   	push   %ebp
+ 911:	89 e5                	mov    %esp,%ebp
+ 913:	57                   	push   %edi
+ 914:	56                   	push   %esi
+ 915:	53                   	push   %ebx
+ 916:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 918:	89 d1                	mov    %edx,%ecx
+{
+ 91a:	83 ec 3c             	sub    $0x3c,%esp
+ 91d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 920:	85 d2                	test   %edx,%edx
+ 922:	0f 89 80 00 00 00    	jns    9a8 <printint+0x98>
+ 928:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 92c:	74 7a                	je     9a8 <printint+0x98>
+    x = -xx;
+ 92e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 930:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 935:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 938:	31 f6                	xor    %esi,%esi
+ 93a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 940:	89 c8                	mov    %ecx,%eax
+ 942:	31 d2                	xor    %edx,%edx
+ 944:	89 f7                	mov    %esi,%edi
+ 946:	f7 f3                	div    %ebx
+ 948:	8d 76 01             	lea    0x1(%esi),%esi
+ 94b:	0f b6 92 c8 0e 00 00 	movzbl 0xec8(%edx),%edx
+ 952:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 956:	89 ca                	mov    %ecx,%edx
+ 958:	89 c1                	mov    %eax,%ecx
+ 95a:	39 da                	cmp    %ebx,%edx
+ 95c:	73 e2                	jae    940 <printint+0x30>
+  if(neg)
+ 95e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 961:	85 c0                	test   %eax,%eax
+ 963:	74 07                	je     96c <printint+0x5c>
+    buf[i++] = '-';
+ 965:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 96a:	89 f7                	mov    %esi,%edi
+ 96c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 96f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 972:	01 df                	add    %ebx,%edi
+ 974:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 978:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+ 97b:	83 ec 04             	sub    $0x4,%esp
+ 97e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 981:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 984:	6a 01                	push   $0x1
+ 986:	50                   	push   %eax
+ 987:	56                   	push   %esi
+ 988:	e8 e3 f6 ff ff       	call   70 <bufwrite>
+  while(--i >= 0)
+ 98d:	89 f8                	mov    %edi,%eax
+ 98f:	83 c4 10             	add    $0x10,%esp
+ 992:	83 ef 01             	sub    $0x1,%edi
+ 995:	39 d8                	cmp    %ebx,%eax
+ 997:	75 df                	jne    978 <printint+0x68>
+}
+ 999:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 99c:	5b                   	pop    %ebx
+ 99d:	5e                   	pop    %esi
+ 99e:	5f                   	pop    %edi
+ 99f:	5d                   	pop    %ebp
+ 9a0:	c3                   	ret
+ 9a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 9a8:	31 c0                	xor    %eax,%eax
+ 9aa:	eb 89                	jmp    935 <printint+0x25>
+ 9ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000009b0 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 9b0:	55                   	push   %ebp
+ 9b1:	89 e5                	mov    %esp,%ebp
+ 9b3:	57                   	push   %edi
+ 9b4:	56                   	push   %esi
+ 9b5:	53                   	push   %ebx
+ 9b6:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 9b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 9bc:	0f b6 18             	movzbl (%eax),%ebx
+ 9bf:	84 db                	test   %bl,%bl
+ 9c1:	74 6c                	je     a2f <printf+0x7f>
+ 9c3:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+ 9c6:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ 9c9:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 9cb:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 9ce:	eb 26                	jmp    9f6 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 9d0:	83 f8 25             	cmp    $0x25,%eax
+ 9d3:	74 4b                	je     a20 <printf+0x70>
+  bufwrite(fd, &c, 1);
+ 9d5:	83 ec 04             	sub    $0x4,%esp
+ 9d8:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 9db:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ 9de:	6a 01                	push   $0x1
+ 9e0:	50                   	push   %eax
+ 9e1:	ff 75 08             	push   0x8(%ebp)
+ 9e4:	e8 87 f6 ff ff       	call   70 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+ 9e9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 9ec:	0f b6 1f             	movzbl (%edi),%ebx
+ 9ef:	83 c7 01             	add    $0x1,%edi
+ 9f2:	84 db                	test   %bl,%bl
+ 9f4:	74 39                	je     a2f <printf+0x7f>
+    c = fmt[i] & 0xff;
+ 9f6:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 9f9:	85 f6                	test   %esi,%esi
+ 9fb:	74 d3                	je     9d0 <printf+0x20>
+      }
+    } else if(state == '%'){
+ 9fd:	83 fe 25             	cmp    $0x25,%esi
+ a00:	75 ea                	jne    9ec <printf+0x3c>
+      if(c == 'd'){
+ a02:	83 f8 25             	cmp    $0x25,%eax
+ a05:	0f 84 d5 01 00 00    	je     be0 <printf+0x230>
+ a0b:	83 e8 63             	sub    $0x63,%eax
+ a0e:	83 f8 15             	cmp    $0x15,%eax
+ a11:	77 45                	ja     a58 <printf+0xa8>
+ a13:	ff 24 85 70 0e 00 00 	jmp    *0xe70(,%eax,4)
+ a1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+ a20:	0f b6 1f             	movzbl (%edi),%ebx
+ a23:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+ a26:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ a2b:	84 db                	test   %bl,%bl
+ a2d:	75 c7                	jne    9f6 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+ a2f:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+ a33:	74 0b                	je     a40 <printf+0x90>
+    fflush(fd);
+}
+ a35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a38:	5b                   	pop    %ebx
+ a39:	5e                   	pop    %esi
+ a3a:	5f                   	pop    %edi
+ a3b:	5d                   	pop    %ebp
+ a3c:	c3                   	ret
+ a3d:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+ a40:	83 ec 0c             	sub    $0xc,%esp
+ a43:	6a 02                	push   $0x2
+ a45:	e8 c6 f7 ff ff       	call   210 <fflush>
+ a4a:	83 c4 10             	add    $0x10,%esp
+}
+ a4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a50:	5b                   	pop    %ebx
+ a51:	5e                   	pop    %esi
+ a52:	5f                   	pop    %edi
+ a53:	5d                   	pop    %ebp
+ a54:	c3                   	ret
+ a55:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+ a58:	83 ec 04             	sub    $0x4,%esp
+ a5b:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ a5e:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+ a62:	6a 01                	push   $0x1
+ a64:	52                   	push   %edx
+ a65:	89 55 c0             	mov    %edx,-0x40(%ebp)
+ a68:	ff 75 08             	push   0x8(%ebp)
+ a6b:	e8 00 f6 ff ff       	call   70 <bufwrite>
+ a70:	83 c4 0c             	add    $0xc,%esp
+ a73:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ a76:	6a 01                	push   $0x1
+ a78:	8b 55 c0             	mov    -0x40(%ebp),%edx
+ a7b:	52                   	push   %edx
+      state = 0;
+ a7c:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+ a7e:	ff 75 08             	push   0x8(%ebp)
+ a81:	e8 ea f5 ff ff       	call   70 <bufwrite>
+        putc(fd, c);
+ a86:	83 c4 10             	add    $0x10,%esp
+ a89:	e9 5e ff ff ff       	jmp    9ec <printf+0x3c>
+ a8e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+ a90:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ a93:	83 ec 0c             	sub    $0xc,%esp
+ a96:	b9 10 00 00 00       	mov    $0x10,%ecx
+ a9b:	8b 16                	mov    (%esi),%edx
+ a9d:	6a 00                	push   $0x0
+ a9f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+ aa2:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+ aa5:	e8 66 fe ff ff       	call   910 <printint>
+        ap++;
+ aaa:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ aad:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ ab0:	31 f6                	xor    %esi,%esi
+ ab2:	e9 35 ff ff ff       	jmp    9ec <printf+0x3c>
+ ab7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abe:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+ ac0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ ac3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ ac5:	83 c0 04             	add    $0x4,%eax
+ ac8:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+ acb:	b8 67 0e 00 00       	mov    $0xe67,%eax
+ ad0:	85 db                	test   %ebx,%ebx
+ ad2:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+ ad5:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+ ad8:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+ ada:	53                   	push   %ebx
+ adb:	e8 90 f9 ff ff       	call   470 <strlen>
+ ae0:	83 c4 0c             	add    $0xc,%esp
+ ae3:	50                   	push   %eax
+ ae4:	53                   	push   %ebx
+ ae5:	ff 75 08             	push   0x8(%ebp)
+ ae8:	e8 83 f5 ff ff       	call   70 <bufwrite>
+ aed:	83 c4 10             	add    $0x10,%esp
+ af0:	e9 f7 fe ff ff       	jmp    9ec <printf+0x3c>
+ af5:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ af8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+ afb:	83 ec 04             	sub    $0x4,%esp
+ afe:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+ b01:	8b 06                	mov    (%esi),%eax
+        ap++;
+ b03:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+ b06:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+ b09:	6a 01                	push   $0x1
+ b0b:	52                   	push   %edx
+ b0c:	ff 75 08             	push   0x8(%ebp)
+ b0f:	e8 5c f5 ff ff       	call   70 <bufwrite>
+        ap++;
+ b14:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ b17:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b1a:	31 f6                	xor    %esi,%esi
+ b1c:	e9 cb fe ff ff       	jmp    9ec <printf+0x3c>
+ b21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+ b28:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ b2b:	83 ec 0c             	sub    $0xc,%esp
+ b2e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ b33:	8b 16                	mov    (%esi),%edx
+ b35:	6a 01                	push   $0x1
+ b37:	e9 63 ff ff ff       	jmp    a9f <printf+0xef>
+ b3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+ b40:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ b43:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ b46:	89 7d c0             	mov    %edi,-0x40(%ebp)
+ b49:	89 55 bc             	mov    %edx,-0x44(%ebp)
+ b4c:	8b 18                	mov    (%eax),%ebx
+ b4e:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+ b51:	31 c0                	xor    %eax,%eax
+ b53:	89 c7                	mov    %eax,%edi
+ b55:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+ b58:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+ b5d:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+ b5f:	f7 e1                	mul    %ecx
+ b61:	c1 ea 03             	shr    $0x3,%edx
+ b64:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ b67:	89 d1                	mov    %edx,%ecx
+ b69:	01 c0                	add    %eax,%eax
+ b6b:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ b6d:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+ b6f:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ b71:	be 0a 00 00 00       	mov    $0xa,%esi
+ b76:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+ b78:	89 da                	mov    %ebx,%edx
+ b7a:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+ b7c:	89 fe                	mov    %edi,%esi
+ b7e:	83 c7 01             	add    $0x1,%edi
+ b81:	8d 42 30             	lea    0x30(%edx),%eax
+ b84:	89 da                	mov    %ebx,%edx
+ b86:	8d 14 92             	lea    (%edx,%edx,4),%edx
+ b89:	01 d2                	add    %edx,%edx
+ b8b:	29 d0                	sub    %edx,%eax
+ b8d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+ b91:	89 c8                	mov    %ecx,%eax
+ b93:	09 d8                	or     %ebx,%eax
+ b95:	75 c1                	jne    b58 <printf+0x1a8>
+ b97:	8b 55 bc             	mov    -0x44(%ebp),%edx
+ b9a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ b9d:	01 d6                	add    %edx,%esi
+ b9f:	89 f7                	mov    %esi,%edi
+ ba1:	89 d6                	mov    %edx,%esi
+ ba3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ ba7:	90                   	nop
+    putc(fd, buf[i]);
+ ba8:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+ bab:	83 ec 04             	sub    $0x4,%esp
+ bae:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+ bb1:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+ bb4:	6a 01                	push   $0x1
+ bb6:	50                   	push   %eax
+ bb7:	53                   	push   %ebx
+ bb8:	e8 b3 f4 ff ff       	call   70 <bufwrite>
+  while(--i >= 0)
+ bbd:	89 fa                	mov    %edi,%edx
+ bbf:	83 c4 10             	add    $0x10,%esp
+ bc2:	83 ef 01             	sub    $0x1,%edi
+ bc5:	39 d6                	cmp    %edx,%esi
+ bc7:	75 df                	jne    ba8 <printf+0x1f8>
+        ap += 2;
+ bc9:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+ bcd:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+ bd0:	31 f6                	xor    %esi,%esi
+ bd2:	e9 15 fe ff ff       	jmp    9ec <printf+0x3c>
+ bd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bde:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+ be0:	83 ec 04             	sub    $0x4,%esp
+ be3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ be6:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ be9:	6a 01                	push   $0x1
+ beb:	e9 8b fe ff ff       	jmp    a7b <printf+0xcb>
+
+00000bf0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ bf0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bf1:	a1 e0 23 00 00       	mov    0x23e0,%eax
+{
+ bf6:	89 e5                	mov    %esp,%ebp
+ bf8:	57                   	push   %edi
+ bf9:	56                   	push   %esi
+ bfa:	53                   	push   %ebx
+ bfb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ bfe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c08:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c0a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c0c:	39 ca                	cmp    %ecx,%edx
+ c0e:	73 30                	jae    c40 <free+0x50>
+ c10:	39 c1                	cmp    %eax,%ecx
+ c12:	72 04                	jb     c18 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c14:	39 c2                	cmp    %eax,%edx
+ c16:	72 f0                	jb     c08 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ c18:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ c1b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ c1e:	39 f8                	cmp    %edi,%eax
+ c20:	74 2e                	je     c50 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c22:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ c25:	8b 42 04             	mov    0x4(%edx),%eax
+ c28:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c2b:	39 f1                	cmp    %esi,%ecx
+ c2d:	74 38                	je     c67 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ c2f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ c31:	5b                   	pop    %ebx
+  freep = p;
+ c32:	89 15 e0 23 00 00    	mov    %edx,0x23e0
+}
+ c38:	5e                   	pop    %esi
+ c39:	5f                   	pop    %edi
+ c3a:	5d                   	pop    %ebp
+ c3b:	c3                   	ret
+ c3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c40:	39 c1                	cmp    %eax,%ecx
+ c42:	72 d0                	jb     c14 <free+0x24>
+ c44:	eb c2                	jmp    c08 <free+0x18>
+ c46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c4d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ c50:	03 70 04             	add    0x4(%eax),%esi
+ c53:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c56:	8b 02                	mov    (%edx),%eax
+ c58:	8b 00                	mov    (%eax),%eax
+ c5a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ c5d:	8b 42 04             	mov    0x4(%edx),%eax
+ c60:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c63:	39 f1                	cmp    %esi,%ecx
+ c65:	75 c8                	jne    c2f <free+0x3f>
+    p->s.size += bp->s.size;
+ c67:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ c6a:	89 15 e0 23 00 00    	mov    %edx,0x23e0
+    p->s.size += bp->s.size;
+ c70:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ c73:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ c76:	89 0a                	mov    %ecx,(%edx)
+}
+ c78:	5b                   	pop    %ebx
+ c79:	5e                   	pop    %esi
+ c7a:	5f                   	pop    %edi
+ c7b:	5d                   	pop    %ebp
+ c7c:	c3                   	ret
+ c7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c80 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ c80:	55                   	push   %ebp
+ c81:	89 e5                	mov    %esp,%ebp
+ c83:	57                   	push   %edi
+ c84:	56                   	push   %esi
+ c85:	53                   	push   %ebx
+ c86:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c89:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ c8c:	8b 15 e0 23 00 00    	mov    0x23e0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c92:	8d 78 07             	lea    0x7(%eax),%edi
+ c95:	c1 ef 03             	shr    $0x3,%edi
+ c98:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ c9b:	85 d2                	test   %edx,%edx
+ c9d:	0f 84 8d 00 00 00    	je     d30 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ca3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ca5:	8b 48 04             	mov    0x4(%eax),%ecx
+ ca8:	39 f9                	cmp    %edi,%ecx
+ caa:	73 64                	jae    d10 <malloc+0x90>
+  if(nu < 4096)
+ cac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ cb1:	39 df                	cmp    %ebx,%edi
+ cb3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ cb6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ cbd:	eb 0a                	jmp    cc9 <malloc+0x49>
+ cbf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cc0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ cc2:	8b 48 04             	mov    0x4(%eax),%ecx
+ cc5:	39 f9                	cmp    %edi,%ecx
+ cc7:	73 47                	jae    d10 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ cc9:	89 c2                	mov    %eax,%edx
+ ccb:	39 05 e0 23 00 00    	cmp    %eax,0x23e0
+ cd1:	75 ed                	jne    cc0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ cd3:	83 ec 0c             	sub    $0xc,%esp
+ cd6:	56                   	push   %esi
+ cd7:	e8 c7 fa ff ff       	call   7a3 <sbrk>
+  if(p == (char*)-1)
+ cdc:	83 c4 10             	add    $0x10,%esp
+ cdf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ce2:	74 1c                	je     d00 <malloc+0x80>
+  hp->s.size = nu;
+ ce4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ ce7:	83 ec 0c             	sub    $0xc,%esp
+ cea:	83 c0 08             	add    $0x8,%eax
+ ced:	50                   	push   %eax
+ cee:	e8 fd fe ff ff       	call   bf0 <free>
+  return freep;
+ cf3:	8b 15 e0 23 00 00    	mov    0x23e0,%edx
+      if((p = morecore(nunits)) == 0)
+ cf9:	83 c4 10             	add    $0x10,%esp
+ cfc:	85 d2                	test   %edx,%edx
+ cfe:	75 c0                	jne    cc0 <malloc+0x40>
+        return 0;
+  }
+}
+ d00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ d03:	31 c0                	xor    %eax,%eax
+}
+ d05:	5b                   	pop    %ebx
+ d06:	5e                   	pop    %esi
+ d07:	5f                   	pop    %edi
+ d08:	5d                   	pop    %ebp
+ d09:	c3                   	ret
+ d0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ d10:	39 cf                	cmp    %ecx,%edi
+ d12:	74 4c                	je     d60 <malloc+0xe0>
+        p->s.size -= nunits;
+ d14:	29 f9                	sub    %edi,%ecx
+ d16:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ d19:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ d1c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ d1f:	89 15 e0 23 00 00    	mov    %edx,0x23e0
+}
+ d25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ d28:	83 c0 08             	add    $0x8,%eax
+}
+ d2b:	5b                   	pop    %ebx
+ d2c:	5e                   	pop    %esi
+ d2d:	5f                   	pop    %edi
+ d2e:	5d                   	pop    %ebp
+ d2f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ d30:	c7 05 e0 23 00 00 e4 	movl   $0x23e4,0x23e0
+ d37:	23 00 00 
+    base.s.size = 0;
+ d3a:	b8 e4 23 00 00       	mov    $0x23e4,%eax
+    base.s.ptr = freep = prevp = &base;
+ d3f:	c7 05 e4 23 00 00 e4 	movl   $0x23e4,0x23e4
+ d46:	23 00 00 
+    base.s.size = 0;
+ d49:	c7 05 e8 23 00 00 00 	movl   $0x0,0x23e8
+ d50:	00 00 00 
+    if(p->s.size >= nunits){
+ d53:	e9 54 ff ff ff       	jmp    cac <malloc+0x2c>
+ d58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d5f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ d60:	8b 08                	mov    (%eax),%ecx
+ d62:	89 0a                	mov    %ecx,(%edx)
+ d64:	eb b9                	jmp    d1f <malloc+0x9f>
+ d66:	66 90                	xchg   %ax,%ax
+ d68:	66 90                	xchg   %ax,%ax
+ d6a:	66 90                	xchg   %ax,%ax
+ d6c:	66 90                	xchg   %ax,%ax
+ d6e:	66 90                	xchg   %ax,%ax
+
+00000d70 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+ d70:	55                   	push   %ebp
+ d71:	89 e5                	mov    %esp,%ebp
+ d73:	57                   	push   %edi
+ d74:	56                   	push   %esi
+ d75:	be 01 00 00 00       	mov    $0x1,%esi
+ d7a:	53                   	push   %ebx
+ d7b:	83 ec 28             	sub    $0x28,%esp
+ d7e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ d81:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ d84:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+ d87:	68 00 98 00 00       	push   $0x9800
+ d8c:	e8 ef fe ff ff       	call   c80 <malloc>
+ d91:	83 c4 10             	add    $0x10,%esp
+ d94:	89 c7                	mov    %eax,%edi
+ d96:	85 c0                	test   %eax,%eax
+ d98:	74 62                	je     dfc <waitpoll+0x8c>
+ d9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+ da0:	83 ec 0c             	sub    $0xc,%esp
+ da3:	6a 01                	push   $0x1
+ da5:	e8 03 fa ff ff       	call   7ad <sleep>
+    fn();
+ daa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ dad:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+ daf:	58                   	pop    %eax
+ db0:	5a                   	pop    %edx
+ db1:	68 00 02 00 00       	push   $0x200
+ db6:	57                   	push   %edi
+ db7:	e8 eb fa ff ff       	call   8a7 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+ dbc:	83 c4 10             	add    $0x10,%esp
+ dbf:	85 c0                	test   %eax,%eax
+ dc1:	7e 2d                	jle    df0 <waitpoll+0x80>
+ dc3:	6b c0 4c             	imul   $0x4c,%eax,%eax
+ dc6:	89 fa                	mov    %edi,%edx
+    alive = 0;
+ dc8:	31 c9                	xor    %ecx,%ecx
+ dca:	01 f8                	add    %edi,%eax
+ dcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+ dd0:	3b 1a                	cmp    (%edx),%ebx
+ dd2:	75 07                	jne    ddb <waitpoll+0x6b>
+        alive = 1;
+ dd4:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+ dd8:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+ ddb:	83 c2 4c             	add    $0x4c,%edx
+ dde:	39 d0                	cmp    %edx,%eax
+ de0:	75 ee                	jne    dd0 <waitpoll+0x60>
+  } while(alive);
+ de2:	85 c9                	test   %ecx,%ecx
+ de4:	75 ba                	jne    da0 <waitpoll+0x30>
+ de6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ded:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+ df0:	83 ec 0c             	sub    $0xc,%esp
+ df3:	57                   	push   %edi
+ df4:	e8 f7 fd ff ff       	call   bf0 <free>
+  wait();
+ df9:	83 c4 10             	add    $0x10,%esp
+}
+ dfc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ dff:	5b                   	pop    %ebx
+ e00:	5e                   	pop    %esi
+ e01:	5f                   	pop    %edi
+ e02:	5d                   	pop    %ebp
+  wait();
+ e03:	e9 10 f9 ff ff       	jmp    718 <wait>
+ e08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e0f:	90                   	nop
+
+00000e10 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+ e10:	55                   	push   %ebp
+ e11:	89 e5                	mov    %esp,%ebp
+ e13:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+ e16:	c7 45 f0 d9 0e 00 00 	movl   $0xed9,-0x10(%ebp)
+ e1d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+ e24:	e8 87 f4 ff ff       	call   2b0 <fork>
+ e29:	85 c0                	test   %eax,%eax
+ e2b:	78 09                	js     e36 <runps+0x26>
+    return -1;
+  if(pid == 0){
+ e2d:	74 0e                	je     e3d <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+ e2f:	e8 e4 f8 ff ff       	call   718 <wait>
+}
+ e34:	c9                   	leave
+ e35:	c3                   	ret
+ e36:	c9                   	leave
+    return -1;
+ e37:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ e3c:	c3                   	ret
+    exec("ps", argv);
+ e3d:	50                   	push   %eax
+ e3e:	50                   	push   %eax
+ e3f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ e42:	50                   	push   %eax
+ e43:	68 d9 0e 00 00       	push   $0xed9
+ e48:	e8 c3 f4 ff ff       	call   310 <exec>
+    printf(2, "exec ps failed\n");
+ e4d:	5a                   	pop    %edx
+ e4e:	59                   	pop    %ecx
+ e4f:	68 dc 0e 00 00       	push   $0xedc
+ e54:	6a 02                	push   $0x2
+ e56:	e8 55 fb ff ff       	call   9b0 <printf>
+    exit();
+ e5b:	e8 a0 f4 ff ff       	call   300 <exit>
@@ -10,3 +10,13 @@
 #define SCHED_BJF    2
 #define SCHED_RANDOM 3
 #define SCHED_RR     4 // Default Round Robin
+
+// Disk transfer modes for setidemode()
+#define IDE_PIO      0
+#define IDE_DMA      1
+
+// mmap() protections and flags
+#define PROT_READ    0x1
+#define PROT_WRITE   0x2
+#define MAP_SHARED   0x1  // write changes back to the file
+#define MAP_PRIVATE  0x2  // keep changes to this process
@@ -5,10 +5,12 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "stat.h"
 #include "fs.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
+#include "uio.h"
 
 struct devsw devsw[NDEV];
 struct {
@@ -73,6 +75,8 @@ fileclose(struct file *f)
   if(ff.type == FD_PIPE)
     pipeclose(ff.pipe, ff.writable);
   else if(ff.type == FD_INODE){
+    if(ff.writable)
+      iflush(ff.ip);
     begin_op();
     iput(ff.ip);
     end_op();
@@ -96,18 +100,40 @@ filestat(struct file *f, struct stat *st)
 int
 fileread(struct file *f, char *addr, int n)
 {
-  int r;
+  struct iovec v;
+
+  v.base = addr;
+  v.len = n;
+  return filereadv(f, &v, 1, &f->off);
+}
+
+// Read from file f into the iovcnt buffers of iov, taking
+// the inode lock once, at and advancing *off.
+int
+filereadv(struct file *f, struct iovec *iov, int iovcnt, uint *off)
+{
+  int i, r, tot;
 
   if(f->readable == 0)
     return -1;
   if(f->type == FD_PIPE)
-    return piperead(f->pipe, addr, n);
+    return pipereadv(f->pipe, iov, iovcnt);
   if(f->type == FD_INODE){
+    tot = 0;
     ilock(f->ip);
-    if((r = readi(f->ip, addr, f->off, n)) > 0)
-      f->off += r;
+    for(i = 0; i < iovcnt; i++){
+      if((r = readi(f->ip, iov[i].base, *off, iov[i].len)) < 0){
+        if(tot == 0)
+          tot = -1;
+        break;
+      }
+      *off += r;
+      tot += r;
+      if(r < iov[i].len)
+        break;
+    }
     iunlock(f->ip);
-    return r;
+    return tot;
   }
   panic("fileread");
 }
@@ -117,41 +143,167 @@ fileread(struct file *f, char *addr, int n)
 int
 filewrite(struct file *f, char *addr, int n)
 {
-  int r;
+  struct iovec v;
+
+  v.base = addr;
+  v.len = n;
+  return filewritev(f, &v, 1, &f->off);
+}
+
+// Write the iovcnt buffers of iov to file f, at and
+// advancing *off. Returns the bytes written, or -1.
+int
+filewritev(struct file *f, struct iovec *iov, int iovcnt, uint *off)
+{
+  struct inode *ip = f->ip;
+  int i, o, r, tot, busy, n1, room;
 
   if(f->writable == 0)
     return -1;
-  if(f->type == FD_PIPE)
-    return pipewrite(f->pipe, addr, n);
+  if(f->type == FD_PIPE){
+    for(tot = i = 0; i < iovcnt; i++){
+      if((r = pipewrite(f->pipe, iov[i].base, iov[i].len)) < 0)
+        return -1;
+      tot += r;
+    }
+    return tot;
+  }
   if(f->type == FD_INODE){
     // write a few blocks at a time to avoid exceeding
     // the maximum log transaction size, including
-    // i-node, indirect block, allocation blocks,
-    // and 2 blocks of slop for non-aligned writes.
+    // i-node, 2 allocation blocks, up to 5 indirect
+    // blocks (two leaves and the blocks above them),
+    // and 1 block of slop for non-aligned writes.
     // this really belongs lower down, since writei()
     // might be writing a device like the console.
-    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
-    int i = 0;
-    while(i < n){
-      int n1 = n - i;
-      if(n1 > max)
-        n1 = max;
+    // appends small enough to fit in the inode's write-back
+    // page go there instead, outside any transaction.
+    // as many buffers as fit share each transaction.
+    int max = (MAXOPBLOCKS-1-2-5-1) * 512;
+    i = o = tot = r = 0;
+    while(i < iovcnt){
+      ilock(ip);
+      while(i < iovcnt){
+        if(o == iov[i].len){
+          i++;
+          o = 0;
+        } else if((r = wbappend(ip, iov[i].base + o, *off, iov[i].len - o)) > 0){
+          *off += r;
+          o += r;
+          tot += r;
+        } else
+          break;
+      }
+      iunlock(ip);
+      if(i == iovcnt)
+        break;
 
       begin_op();
-      ilock(f->ip);
-      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
-        f->off += r;
-      iunlock(f->ip);
+      ilock(ip);
+      busy = 0;
+      for(room = max; room > 0 && i < iovcnt; ){
+        if(o == iov[i].len){
+          i++;
+          o = 0;
+          continue;
+        }
+        n1 = iov[i].len - o;
+        if(n1 > room)
+          n1 = room;
+        if((busy = wbbusy(ip, *off, n1)) != 0)
+          break;
+        if((r = writei(ip, iov[i].base + o, *off, n1)) < 0)
+          break;
+        *off += r;
+        o += r;
+        tot += r;
+        room -= r;
+        if(r != n1){
+          r = -1;  // disk full
+          break;
+        }
+      }
+      iunlock(ip);
       end_op();
 
+      if(busy){
+        // the write reaches data still in the page.
+        iflush(ip);
+        continue;
+      }
       if(r < 0)
-        break;
-      if(r != n1)
-        panic("short filewrite");
-      i += r;
+        return -1;
     }
-    return i == n ? n : -1;
+    return tot;
   }
   panic("filewrite");
 }
 
+// Type of ip, which does not change while it is referenced.
+static int
+itype(struct inode *ip)
+{
+  int type;
+
+  ilock(ip);
+  type = ip->type;
+  iunlock(ip);
+  return type;
+}
+
+// Copy up to n bytes from regular file src at *soff to regular
+// file dst at *doff, a filewrite()-sized transaction at a time,
+// advancing both offsets. Locks the inodes in inum order, so
+// two copies between the same files can not deadlock; both must
+// be regular files, so no directory is locked out of order.
+// Returns the number of bytes copied, or -1.
+int
+copyrange(struct inode *src, uint *soff, struct inode *dst, uint *doff, int n)
+{
+  int max = (MAXOPBLOCKS-1-2-5-1) * 512;
+  int r = 0, tot = 0, busy;
+  struct inode *first, *second;
+
+  if(src == dst || itype(src) != T_FILE || itype(dst) != T_FILE)
+    return -1;
+  first = src->inum < dst->inum ? src : dst;
+  second = first == src ? dst : src;
+  while(tot < n){
+    int n1 = n - tot;
+    if(n1 > max)
+      n1 = max;
+
+    begin_op();
+    ilock(first);
+    ilock(second);
+    if((busy = wbbusy(dst, *doff, n1)) == 0 &&
+       (r = icopy(src, *soff, dst, *doff, n1)) > 0){
+      *soff += r;
+      *doff += r;
+    }
+    iunlock(second);
+    iunlock(first);
+    end_op();
+
+    if(busy){
+      iflush(dst);
+      continue;
+    }
+    if(r <= 0)
+      break;
+    tot += r;
+  }
+  return r < 0 && tot == 0 ? -1 : tot;
+}
+
+// Copy up to n bytes from file in to file out,
+// starting at and advancing their offsets.
+int
+filecopy(struct file *in, struct file *out, int n)
+{
+  if(in->readable == 0 || out->writable == 0)
+    return -1;
+  if(in->type != FD_INODE || out->type != FD_INODE)
+    return -1;
+  return copyrange(in->ip, &in->off, out->ip, &out->off, n);
+}
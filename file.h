@@ -14,6 +14,10 @@ struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
+  struct inode *hnext; // icache hash chain
+  struct inode *lprev; // icache LRU list, while ref is 0
+  struct inode *lnext;
+  struct inode *anext; // every icache entry
   struct sleeplock lock; // protects everything below here
   int valid;          // inode has been read from disk?
 
@@ -22,7 +26,12 @@ struct inode {
   short minor;
   short nlink;
   uint size;
-  uint addrs[NDIRECT+1];
+  uint addrs[NDIRECT+3];
+  uint leaf;          // 1 + number of the leaf indirect block cached
+  uint leafaddr;      // in leafaddr, or 0 if none
+  uint near;          // where to allocate the next block
+  char *wbuf;         // write-back page holding the last
+  uint wblen;         // wblen bytes of the file, not on disk yet
 };
 
 // table mapping major device number to
@@ -0,0 +1,2194 @@
+
+_fillbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+char buf[4096];
+char name[] = "fill00";
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 18             	sub    $0x18,%esp
+      14:	8b 19                	mov    (%ecx),%ebx
+      16:	8b 71 04             	mov    0x4(%ecx),%esi
+  int kb, steps, i, j, fd, t;
+
+  kb = argc > 1 ? atoi(argv[1]) : fsfree() * BSIZE / 1024;
+      19:	83 fb 01             	cmp    $0x1,%ebx
+      1c:	7e 45                	jle    63 <main+0x63>
+      1e:	83 ec 0c             	sub    $0xc,%esp
+      21:	ff 76 04             	push   0x4(%esi)
+      24:	e8 27 08 00 00       	call   850 <atoi>
+  steps = argc > 2 ? atoi(argv[2]) : 16;
+      29:	83 c4 10             	add    $0x10,%esp
+  kb = argc > 1 ? atoi(argv[1]) : fsfree() * BSIZE / 1024;
+      2c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  steps = argc > 2 ? atoi(argv[2]) : 16;
+      2f:	83 fb 02             	cmp    $0x2,%ebx
+      32:	74 3f                	je     73 <main+0x73>
+      34:	83 ec 0c             	sub    $0xc,%esp
+      37:	ff 76 08             	push   0x8(%esi)
+      3a:	e8 11 08 00 00       	call   850 <atoi>
+  if(steps < 1 || steps > 100){
+      3f:	83 c4 10             	add    $0x10,%esp
+  steps = argc > 2 ? atoi(argv[2]) : 16;
+      42:	89 c1                	mov    %eax,%ecx
+  if(steps < 1 || steps > 100){
+      44:	8d 40 ff             	lea    -0x1(%eax),%eax
+      47:	83 f8 63             	cmp    $0x63,%eax
+      4a:	0f 86 ef 01 00 00    	jbe    23f <main+0x23f>
+    printf(2, "usage: fillbench [kb [steps(1-100)]]\n");
+      50:	50                   	push   %eax
+      51:	50                   	push   %eax
+      52:	68 50 10 00 00       	push   $0x1050
+      57:	6a 02                	push   $0x2
+      59:	e8 42 0b 00 00       	call   ba0 <printf>
+    exit();
+      5e:	e8 8d 04 00 00       	call   4f0 <exit>
+  kb = argc > 1 ? atoi(argv[1]) : fsfree() * BSIZE / 1024;
+      63:	e8 7f 0a 00 00       	call   ae7 <fsfree>
+      68:	b9 02 00 00 00       	mov    $0x2,%ecx
+      6d:	99                   	cltd
+      6e:	f7 f9                	idiv   %ecx
+      70:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  }
+  memset(buf, 'f', sizeof(buf));
+      73:	57                   	push   %edi
+      74:	68 00 10 00 00       	push   $0x1000
+      79:	6a 66                	push   $0x66
+      7b:	68 c0 15 00 00       	push   $0x15c0
+      80:	e8 0b 06 00 00       	call   690 <memset>
+      85:	83 c4 10             	add    $0x10,%esp
+  steps = argc > 2 ? atoi(argv[2]) : 16;
+      88:	b9 10 00 00 00       	mov    $0x10,%ecx
+
+  for(i = 0; i < steps; i++){
+      8d:	31 db                	xor    %ebx,%ebx
+    name[4] = '0' + i / 10;
+      8f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  for(i = 0; i < steps; i++){
+      92:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+      95:	8d 76 00             	lea    0x0(%esi),%esi
+    name[4] = '0' + i / 10;
+      98:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+      9b:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+    name[5] = '0' + i % 10;
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+      a0:	83 ec 08             	sub    $0x8,%esp
+      a3:	68 02 02 00 00       	push   $0x202
+    name[4] = '0' + i / 10;
+      a8:	f7 e1                	mul    %ecx
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+      aa:	68 ac 15 00 00       	push   $0x15ac
+    name[4] = '0' + i / 10;
+      af:	c1 ea 03             	shr    $0x3,%edx
+      b2:	8d 42 30             	lea    0x30(%edx),%eax
+    name[5] = '0' + i % 10;
+      b5:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    name[4] = '0' + i / 10;
+      b8:	a2 b0 15 00 00       	mov    %al,0x15b0
+    name[5] = '0' + i % 10;
+      bd:	01 d2                	add    %edx,%edx
+      bf:	89 c8                	mov    %ecx,%eax
+      c1:	29 d0                	sub    %edx,%eax
+      c3:	83 c0 30             	add    $0x30,%eax
+      c6:	a2 b1 15 00 00       	mov    %al,0x15b1
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+      cb:	e8 69 08 00 00       	call   939 <open>
+      d0:	83 c4 10             	add    $0x10,%esp
+      d3:	89 c3                	mov    %eax,%ebx
+      d5:	85 c0                	test   %eax,%eax
+      d7:	0f 88 2b 01 00 00    	js     208 <main+0x208>
+      printf(2, "fillbench: cannot create %s\n", name);
+      break;
+    }
+    t = uptime();
+      dd:	e8 c5 08 00 00       	call   9a7 <uptime>
+      e2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    for(j = 0; j < kb / steps / 4; j++)
+      e5:	8b 45 d8             	mov    -0x28(%ebp),%eax
+      e8:	99                   	cltd
+      e9:	f7 7d e0             	idivl  -0x20(%ebp)
+      ec:	85 c0                	test   %eax,%eax
+      ee:	8d 70 03             	lea    0x3(%eax),%esi
+      f1:	0f 49 f0             	cmovns %eax,%esi
+      f4:	31 ff                	xor    %edi,%edi
+      f6:	c1 fe 02             	sar    $0x2,%esi
+      f9:	83 f8 03             	cmp    $0x3,%eax
+      fc:	7f 0d                	jg     10b <main+0x10b>
+      fe:	eb 28                	jmp    128 <main+0x128>
+     100:	83 c7 01             	add    $0x1,%edi
+     103:	39 f7                	cmp    %esi,%edi
+     105:	0f 8d bd 00 00 00    	jge    1c8 <main+0x1c8>
+      if(write(fd, buf, sizeof(buf)) != sizeof(buf))
+     10b:	83 ec 04             	sub    $0x4,%esp
+     10e:	68 00 10 00 00       	push   $0x1000
+     113:	68 c0 15 00 00       	push   $0x15c0
+     118:	53                   	push   %ebx
+     119:	e8 ff 07 00 00       	call   91d <write>
+     11e:	83 c4 10             	add    $0x10,%esp
+     121:	3d 00 10 00 00       	cmp    $0x1000,%eax
+     126:	74 d8                	je     100 <main+0x100>
+        break;
+    t = uptime() - t;
+     128:	e8 7a 08 00 00       	call   9a7 <uptime>
+     12d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+    close(fd);
+     130:	83 ec 0c             	sub    $0xc,%esp
+    t = uptime() - t;
+     133:	29 c8                	sub    %ecx,%eax
+     135:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    close(fd);
+     138:	53                   	push   %ebx
+     139:	e8 22 04 00 00       	call   560 <close>
+    printf(1, "step %d: %d KB in %d ticks\n", i, 4*j, t);
+     13e:	8d 04 bd 00 00 00 00 	lea    0x0(,%edi,4),%eax
+     145:	5a                   	pop    %edx
+     146:	ff 75 dc             	push   -0x24(%ebp)
+     149:	50                   	push   %eax
+     14a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+     14d:	53                   	push   %ebx
+     14e:	68 93 10 00 00       	push   $0x1093
+     153:	6a 01                	push   $0x1
+     155:	e8 46 0a 00 00       	call   ba0 <printf>
+    if(j < kb / steps / 4){
+      printf(1, "disk full\n");
+      i++;
+     15a:	89 d8                	mov    %ebx,%eax
+    if(j < kb / steps / 4){
+     15c:	83 c4 20             	add    $0x20,%esp
+      i++;
+     15f:	83 c0 01             	add    $0x1,%eax
+     162:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(j < kb / steps / 4){
+     165:	39 f7                	cmp    %esi,%edi
+     167:	0f 8c bc 00 00 00    	jl     229 <main+0x229>
+  for(i = 0; i < steps; i++){
+     16d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     170:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+     173:	0f 85 1f ff ff ff    	jne    98 <main+0x98>
+    }
+  }
+  steps = i;
+
+  for(i = 0; i < steps; i++){
+    name[4] = '0' + i / 10;
+     179:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  for(i = 0; i < steps; i++){
+     17c:	31 f6                	xor    %esi,%esi
+    name[4] = '0' + i / 10;
+     17e:	bb cd cc cc cc       	mov    $0xcccccccd,%ebx
+     183:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     187:	90                   	nop
+     188:	89 f0                	mov    %esi,%eax
+    name[5] = '0' + i % 10;
+    unlink(name);
+     18a:	83 ec 0c             	sub    $0xc,%esp
+    name[4] = '0' + i / 10;
+     18d:	f7 e3                	mul    %ebx
+    unlink(name);
+     18f:	68 ac 15 00 00       	push   $0x15ac
+    name[4] = '0' + i / 10;
+     194:	c1 ea 03             	shr    $0x3,%edx
+     197:	8d 42 30             	lea    0x30(%edx),%eax
+    name[5] = '0' + i % 10;
+     19a:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    name[4] = '0' + i / 10;
+     19d:	a2 b0 15 00 00       	mov    %al,0x15b0
+    name[5] = '0' + i % 10;
+     1a2:	01 d2                	add    %edx,%edx
+     1a4:	89 f0                	mov    %esi,%eax
+  for(i = 0; i < steps; i++){
+     1a6:	83 c6 01             	add    $0x1,%esi
+    name[5] = '0' + i % 10;
+     1a9:	29 d0                	sub    %edx,%eax
+     1ab:	83 c0 30             	add    $0x30,%eax
+     1ae:	a2 b1 15 00 00       	mov    %al,0x15b1
+    unlink(name);
+     1b3:	e8 95 07 00 00       	call   94d <unlink>
+  for(i = 0; i < steps; i++){
+     1b8:	83 c4 10             	add    $0x10,%esp
+     1bb:	39 fe                	cmp    %edi,%esi
+     1bd:	7c c9                	jl     188 <main+0x188>
+  }
+  exit();
+     1bf:	e8 2c 03 00 00       	call   4f0 <exit>
+     1c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    t = uptime() - t;
+     1c8:	e8 da 07 00 00       	call   9a7 <uptime>
+    close(fd);
+     1cd:	83 ec 0c             	sub    $0xc,%esp
+    t = uptime() - t;
+     1d0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+    close(fd);
+     1d3:	53                   	push   %ebx
+    t = uptime() - t;
+     1d4:	29 c8                	sub    %ecx,%eax
+     1d6:	89 c6                	mov    %eax,%esi
+    close(fd);
+     1d8:	e8 83 03 00 00       	call   560 <close>
+    printf(1, "step %d: %d KB in %d ticks\n", i, 4*j, t);
+     1dd:	8d 14 bd 00 00 00 00 	lea    0x0(,%edi,4),%edx
+     1e4:	89 34 24             	mov    %esi,(%esp)
+     1e7:	52                   	push   %edx
+     1e8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+     1eb:	53                   	push   %ebx
+     1ec:	68 93 10 00 00       	push   $0x1093
+     1f1:	6a 01                	push   $0x1
+     1f3:	e8 a8 09 00 00       	call   ba0 <printf>
+      i++;
+     1f8:	89 d8                	mov    %ebx,%eax
+     1fa:	83 c4 20             	add    $0x20,%esp
+     1fd:	83 c0 01             	add    $0x1,%eax
+     200:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     203:	e9 65 ff ff ff       	jmp    16d <main+0x16d>
+      printf(2, "fillbench: cannot create %s\n", name);
+     208:	51                   	push   %ecx
+     209:	68 ac 15 00 00       	push   $0x15ac
+     20e:	68 76 10 00 00       	push   $0x1076
+     213:	6a 02                	push   $0x2
+     215:	e8 86 09 00 00       	call   ba0 <printf>
+  for(i = 0; i < steps; i++){
+     21a:	83 c4 10             	add    $0x10,%esp
+     21d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     221:	0f 85 52 ff ff ff    	jne    179 <main+0x179>
+     227:	eb 96                	jmp    1bf <main+0x1bf>
+      printf(1, "disk full\n");
+     229:	50                   	push   %eax
+     22a:	50                   	push   %eax
+     22b:	68 af 10 00 00       	push   $0x10af
+     230:	6a 01                	push   $0x1
+     232:	e8 69 09 00 00       	call   ba0 <printf>
+     237:	83 c4 10             	add    $0x10,%esp
+     23a:	e9 3a ff ff ff       	jmp    179 <main+0x179>
+     23f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  memset(buf, 'f', sizeof(buf));
+     242:	56                   	push   %esi
+     243:	68 00 10 00 00       	push   $0x1000
+     248:	6a 66                	push   $0x66
+     24a:	68 c0 15 00 00       	push   $0x15c0
+     24f:	e8 3c 04 00 00       	call   690 <memset>
+     254:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     257:	83 c4 10             	add    $0x10,%esp
+     25a:	e9 2e fe ff ff       	jmp    8d <main+0x8d>
+     25f:	90                   	nop
+
+00000260 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+     260:	55                   	push   %ebp
+     261:	89 e5                	mov    %esp,%ebp
+     263:	57                   	push   %edi
+     264:	56                   	push   %esi
+     265:	53                   	push   %ebx
+     266:	83 ec 4c             	sub    $0x4c,%esp
+     269:	8b 45 0c             	mov    0xc(%ebp),%eax
+     26c:	8b 55 08             	mov    0x8(%ebp),%edx
+     26f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     272:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+     275:	83 fa 0f             	cmp    $0xf,%edx
+     278:	0f 87 32 01 00 00    	ja     3b0 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+     27e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     284:	8b 80 c0 25 00 00    	mov    0x25c0(%eax),%eax
+     28a:	85 c0                	test   %eax,%eax
+     28c:	0f 84 de 00 00 00    	je     370 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+     292:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     298:	8b b0 c4 25 00 00    	mov    0x25c4(%eax),%esi
+     29e:	8d 88 c0 25 00 00    	lea    0x25c0(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+     2a4:	8d b8 c8 25 00 00    	lea    0x25c8(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+     2aa:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+     2ad:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+     2b0:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+     2b3:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+     2b9:	0f 8f 01 01 00 00    	jg     3c0 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+     2bf:	8d 78 08             	lea    0x8(%eax),%edi
+     2c2:	8d bc 3e c0 25 00 00 	lea    0x25c0(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     2c9:	85 db                	test   %ebx,%ebx
+     2cb:	7e 3b                	jle    308 <bufwrite+0xa8>
+     2cd:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+     2d0:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+     2d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2d7:	90                   	nop
+    *dst++ = *src++;
+     2d8:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     2d9:	39 c6                	cmp    %eax,%esi
+     2db:	75 fb                	jne    2d8 <bufwrite+0x78>
+  ob[fd].n += n;
+     2dd:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     2e3:	8b 88 c4 25 00 00    	mov    0x25c4(%eax),%ecx
+     2e9:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     2eb:	83 b8 c0 25 00 00 01 	cmpl   $0x1,0x25c0(%eax)
+  ob[fd].n += n;
+     2f2:	89 88 c4 25 00 00    	mov    %ecx,0x25c4(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     2f8:	74 26                	je     320 <bufwrite+0xc0>
+}
+     2fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     2fd:	5b                   	pop    %ebx
+     2fe:	5e                   	pop    %esi
+     2ff:	5f                   	pop    %edi
+     300:	5d                   	pop    %ebp
+     301:	c3                   	ret
+     302:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+     308:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     30b:	83 b8 c0 25 00 00 01 	cmpl   $0x1,0x25c0(%eax)
+  ob[fd].n += n;
+     312:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     315:	75 e3                	jne    2fa <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+     317:	85 db                	test   %ebx,%ebx
+     319:	74 df                	je     2fa <bufwrite+0x9a>
+     31b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     31f:	90                   	nop
+  src = vsrc;
+     320:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     323:	01 c3                	add    %eax,%ebx
+     325:	eb 10                	jmp    337 <bufwrite+0xd7>
+     327:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     32e:	66 90                	xchg   %ax,%ax
+     330:	83 c0 01             	add    $0x1,%eax
+     333:	39 d8                	cmp    %ebx,%eax
+     335:	74 c3                	je     2fa <bufwrite+0x9a>
+    if(*p == (char)c)
+     337:	80 38 0a             	cmpb   $0xa,(%eax)
+     33a:	75 f4                	jne    330 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     33c:	85 c9                	test   %ecx,%ecx
+     33e:	7e ba                	jle    2fa <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+     340:	83 ec 04             	sub    $0x4,%esp
+     343:	51                   	push   %ecx
+     344:	ff 75 ac             	push   -0x54(%ebp)
+     347:	52                   	push   %edx
+     348:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+     34b:	e8 cd 05 00 00       	call   91d <write>
+    ob[fd].n = 0;
+     350:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     353:	83 c4 10             	add    $0x10,%esp
+     356:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+     35c:	c7 82 c4 25 00 00 00 	movl   $0x0,0x25c4(%edx)
+     363:	00 00 00 
+     366:	eb 92                	jmp    2fa <bufwrite+0x9a>
+     368:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     36f:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     370:	83 ec 08             	sub    $0x8,%esp
+     373:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     376:	50                   	push   %eax
+     377:	52                   	push   %edx
+     378:	89 55 b0             	mov    %edx,-0x50(%ebp)
+     37b:	e8 d7 05 00 00       	call   957 <fstat>
+     380:	83 c4 10             	add    $0x10,%esp
+     383:	8b 55 b0             	mov    -0x50(%ebp),%edx
+     386:	89 c1                	mov    %eax,%ecx
+     388:	b8 02 00 00 00       	mov    $0x2,%eax
+     38d:	85 c9                	test   %ecx,%ecx
+     38f:	75 0d                	jne    39e <bufwrite+0x13e>
+     391:	31 c0                	xor    %eax,%eax
+     393:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     398:	0f 95 c0             	setne  %al
+     39b:	83 c0 01             	add    $0x1,%eax
+     39e:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+     3a4:	89 81 c0 25 00 00    	mov    %eax,0x25c0(%ecx)
+     3aa:	e9 e3 fe ff ff       	jmp    292 <bufwrite+0x32>
+     3af:	90                   	nop
+}
+     3b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     3b3:	5b                   	pop    %ebx
+     3b4:	5e                   	pop    %esi
+     3b5:	5f                   	pop    %edi
+     3b6:	5d                   	pop    %ebp
+    write(fd, p, n);
+     3b7:	e9 61 05 00 00       	jmp    91d <write>
+     3bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+     3c0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+     3c3:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+     3c6:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+     3c9:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+     3cc:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+     3cf:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+     3d2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+     3d5:	6a 02                	push   $0x2
+     3d7:	50                   	push   %eax
+     3d8:	52                   	push   %edx
+     3d9:	e8 9b 06 00 00       	call   a79 <writev>
+    ob[fd].n = 0;
+     3de:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+     3e1:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+     3e4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+     3eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     3ee:	5b                   	pop    %ebx
+     3ef:	5e                   	pop    %esi
+     3f0:	5f                   	pop    %edi
+     3f1:	5d                   	pop    %ebp
+     3f2:	c3                   	ret
+     3f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000400 <fflush>:
+{
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+     403:	53                   	push   %ebx
+     404:	83 ec 04             	sub    $0x4,%esp
+     407:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     40a:	83 f8 0f             	cmp    $0xf,%eax
+     40d:	77 16                	ja     425 <fflush+0x25>
+     40f:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+     415:	8b 8a c4 25 00 00    	mov    0x25c4(%edx),%ecx
+     41b:	8d 9a c0 25 00 00    	lea    0x25c0(%edx),%ebx
+     421:	85 c9                	test   %ecx,%ecx
+     423:	7f 0b                	jg     430 <fflush+0x30>
+}
+     425:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     428:	c9                   	leave
+     429:	c3                   	ret
+     42a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     430:	83 ec 04             	sub    $0x4,%esp
+     433:	81 c2 c8 25 00 00    	add    $0x25c8,%edx
+     439:	51                   	push   %ecx
+     43a:	52                   	push   %edx
+     43b:	50                   	push   %eax
+     43c:	e8 dc 04 00 00       	call   91d <write>
+    ob[fd].n = 0;
+     441:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     448:	83 c4 10             	add    $0x10,%esp
+}
+     44b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     44e:	c9                   	leave
+     44f:	c3                   	ret
+
+00000450 <fflushall>:
+{
+     450:	55                   	push   %ebp
+     451:	89 e5                	mov    %esp,%ebp
+     453:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     454:	31 f6                	xor    %esi,%esi
+{
+     456:	53                   	push   %ebx
+     457:	bb c8 25 00 00       	mov    $0x25c8,%ebx
+     45c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     460:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     463:	85 c0                	test   %eax,%eax
+     465:	7e 15                	jle    47c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     467:	83 ec 04             	sub    $0x4,%esp
+     46a:	50                   	push   %eax
+     46b:	53                   	push   %ebx
+     46c:	56                   	push   %esi
+     46d:	e8 ab 04 00 00       	call   91d <write>
+    ob[fd].n = 0;
+     472:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     479:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     47c:	83 c6 01             	add    $0x1,%esi
+     47f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     485:	83 fe 10             	cmp    $0x10,%esi
+     488:	75 d6                	jne    460 <fflushall+0x10>
+}
+     48a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     48d:	5b                   	pop    %ebx
+     48e:	5e                   	pop    %esi
+     48f:	5d                   	pop    %ebp
+     490:	c3                   	ret
+     491:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     498:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     49f:	90                   	nop
+
+000004a0 <fork>:
+{
+     4a0:	55                   	push   %ebp
+     4a1:	89 e5                	mov    %esp,%ebp
+     4a3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     4a4:	31 f6                	xor    %esi,%esi
+{
+     4a6:	53                   	push   %ebx
+     4a7:	bb c8 25 00 00       	mov    $0x25c8,%ebx
+     4ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     4b0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     4b3:	85 c0                	test   %eax,%eax
+     4b5:	7e 15                	jle    4cc <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     4b7:	83 ec 04             	sub    $0x4,%esp
+     4ba:	50                   	push   %eax
+     4bb:	53                   	push   %ebx
+     4bc:	56                   	push   %esi
+     4bd:	e8 5b 04 00 00       	call   91d <write>
+    ob[fd].n = 0;
+     4c2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     4c9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     4cc:	83 c6 01             	add    $0x1,%esi
+     4cf:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     4d5:	83 fe 10             	cmp    $0x10,%esi
+     4d8:	75 d6                	jne    4b0 <fork+0x10>
+}
+     4da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4dd:	5b                   	pop    %ebx
+     4de:	5e                   	pop    %esi
+     4df:	5d                   	pop    %ebp
+  return _fork();
+     4e0:	e9 15 04 00 00       	jmp    8fa <_fork>
+     4e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004f0 <exit>:
+{
+     4f0:	55                   	push   %ebp
+     4f1:	89 e5                	mov    %esp,%ebp
+     4f3:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+     4f6:	e8 55 ff ff ff       	call   450 <fflushall>
+  _exit();
+     4fb:	e8 01 04 00 00       	call   901 <_exit>
+
+00000500 <exec>:
+{
+     500:	55                   	push   %ebp
+     501:	89 e5                	mov    %esp,%ebp
+     503:	57                   	push   %edi
+     504:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     505:	31 f6                	xor    %esi,%esi
+{
+     507:	53                   	push   %ebx
+     508:	bb c8 25 00 00       	mov    $0x25c8,%ebx
+     50d:	83 ec 1c             	sub    $0x1c,%esp
+     510:	8b 45 08             	mov    0x8(%ebp),%eax
+     513:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     516:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     519:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     520:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     523:	85 c0                	test   %eax,%eax
+     525:	7e 15                	jle    53c <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     527:	83 ec 04             	sub    $0x4,%esp
+     52a:	50                   	push   %eax
+     52b:	53                   	push   %ebx
+     52c:	56                   	push   %esi
+     52d:	e8 eb 03 00 00       	call   91d <write>
+    ob[fd].n = 0;
+     532:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     539:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     53c:	83 c6 01             	add    $0x1,%esi
+     53f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     545:	83 fe 10             	cmp    $0x10,%esi
+     548:	75 d6                	jne    520 <exec+0x20>
+  return _exec(path, argv);
+     54a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     54d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+     550:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     553:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     556:	5b                   	pop    %ebx
+     557:	5e                   	pop    %esi
+     558:	5f                   	pop    %edi
+     559:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     55a:	e9 d3 03 00 00       	jmp    932 <_exec>
+     55f:	90                   	nop
+
+00000560 <close>:
+{
+     560:	55                   	push   %ebp
+     561:	89 e5                	mov    %esp,%ebp
+     563:	56                   	push   %esi
+     564:	53                   	push   %ebx
+     565:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     568:	83 fb 0f             	cmp    $0xf,%ebx
+     56b:	77 26                	ja     593 <close+0x33>
+     56d:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     573:	8b 90 c4 25 00 00    	mov    0x25c4(%eax),%edx
+     579:	8d b0 c0 25 00 00    	lea    0x25c0(%eax),%esi
+     57f:	85 d2                	test   %edx,%edx
+     581:	7f 25                	jg     5a8 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+     583:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     589:	c7 80 c0 25 00 00 00 	movl   $0x0,0x25c0(%eax)
+     590:	00 00 00 
+  return _close(fd);
+     593:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     596:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     599:	5b                   	pop    %ebx
+     59a:	5e                   	pop    %esi
+     59b:	5d                   	pop    %ebp
+  return _close(fd);
+     59c:	e9 83 03 00 00       	jmp    924 <_close>
+     5a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     5a8:	83 ec 04             	sub    $0x4,%esp
+     5ab:	05 c8 25 00 00       	add    $0x25c8,%eax
+     5b0:	52                   	push   %edx
+     5b1:	50                   	push   %eax
+     5b2:	53                   	push   %ebx
+     5b3:	e8 65 03 00 00       	call   91d <write>
+    ob[fd].n = 0;
+     5b8:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+     5bf:	83 c4 10             	add    $0x10,%esp
+     5c2:	eb bf                	jmp    583 <close+0x23>
+     5c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5cf:	90                   	nop
+
+000005d0 <strcpy>:
+{
+     5d0:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+     5d1:	31 c0                	xor    %eax,%eax
+{
+     5d3:	89 e5                	mov    %esp,%ebp
+     5d5:	53                   	push   %ebx
+     5d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     5d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     5dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     5e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     5e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     5e7:	83 c0 01             	add    $0x1,%eax
+     5ea:	84 d2                	test   %dl,%dl
+     5ec:	75 f2                	jne    5e0 <strcpy+0x10>
+}
+     5ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5f1:	89 c8                	mov    %ecx,%eax
+     5f3:	c9                   	leave
+     5f4:	c3                   	ret
+     5f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000600 <strcmp>:
+{
+     600:	55                   	push   %ebp
+     601:	89 e5                	mov    %esp,%ebp
+     603:	53                   	push   %ebx
+     604:	8b 55 08             	mov    0x8(%ebp),%edx
+     607:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     60a:	0f b6 02             	movzbl (%edx),%eax
+     60d:	84 c0                	test   %al,%al
+     60f:	75 17                	jne    628 <strcmp+0x28>
+     611:	eb 3a                	jmp    64d <strcmp+0x4d>
+     613:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     617:	90                   	nop
+     618:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     61c:	83 c2 01             	add    $0x1,%edx
+     61f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     622:	84 c0                	test   %al,%al
+     624:	74 1a                	je     640 <strcmp+0x40>
+    p++, q++;
+     626:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     628:	0f b6 19             	movzbl (%ecx),%ebx
+     62b:	38 c3                	cmp    %al,%bl
+     62d:	74 e9                	je     618 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     62f:	29 d8                	sub    %ebx,%eax
+}
+     631:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     634:	c9                   	leave
+     635:	c3                   	ret
+     636:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     63d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     640:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     644:	31 c0                	xor    %eax,%eax
+     646:	29 d8                	sub    %ebx,%eax
+}
+     648:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     64b:	c9                   	leave
+     64c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     64d:	0f b6 19             	movzbl (%ecx),%ebx
+     650:	31 c0                	xor    %eax,%eax
+     652:	eb db                	jmp    62f <strcmp+0x2f>
+     654:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     65b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     65f:	90                   	nop
+
+00000660 <strlen>:
+{
+     660:	55                   	push   %ebp
+     661:	89 e5                	mov    %esp,%ebp
+     663:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+     666:	80 3a 00             	cmpb   $0x0,(%edx)
+     669:	74 15                	je     680 <strlen+0x20>
+     66b:	31 c0                	xor    %eax,%eax
+     66d:	8d 76 00             	lea    0x0(%esi),%esi
+     670:	83 c0 01             	add    $0x1,%eax
+     673:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     677:	89 c1                	mov    %eax,%ecx
+     679:	75 f5                	jne    670 <strlen+0x10>
+}
+     67b:	89 c8                	mov    %ecx,%eax
+     67d:	5d                   	pop    %ebp
+     67e:	c3                   	ret
+     67f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     680:	31 c9                	xor    %ecx,%ecx
+}
+     682:	5d                   	pop    %ebp
+     683:	89 c8                	mov    %ecx,%eax
+     685:	c3                   	ret
+     686:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     68d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000690 <memset>:
+{
+     690:	55                   	push   %ebp
+     691:	89 e5                	mov    %esp,%ebp
+     693:	57                   	push   %edi
+     694:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     697:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     69a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     69d:	89 d7                	mov    %edx,%edi
+     69f:	fc                   	cld
+     6a0:	f3 aa                	rep stos %al,%es:(%edi)
+}
+     6a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     6a5:	89 d0                	mov    %edx,%eax
+     6a7:	c9                   	leave
+     6a8:	c3                   	ret
+     6a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000006b0 <strchr>:
+{
+     6b0:	55                   	push   %ebp
+     6b1:	89 e5                	mov    %esp,%ebp
+     6b3:	8b 45 08             	mov    0x8(%ebp),%eax
+     6b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     6ba:	0f b6 10             	movzbl (%eax),%edx
+     6bd:	84 d2                	test   %dl,%dl
+     6bf:	75 12                	jne    6d3 <strchr+0x23>
+     6c1:	eb 1d                	jmp    6e0 <strchr+0x30>
+     6c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6c7:	90                   	nop
+     6c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     6cc:	83 c0 01             	add    $0x1,%eax
+     6cf:	84 d2                	test   %dl,%dl
+     6d1:	74 0d                	je     6e0 <strchr+0x30>
+    if(*s == c)
+     6d3:	38 d1                	cmp    %dl,%cl
+     6d5:	75 f1                	jne    6c8 <strchr+0x18>
+}
+     6d7:	5d                   	pop    %ebp
+     6d8:	c3                   	ret
+     6d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     6e0:	31 c0                	xor    %eax,%eax
+}
+     6e2:	5d                   	pop    %ebp
+     6e3:	c3                   	ret
+     6e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6ef:	90                   	nop
+
+000006f0 <memchr>:
+{
+     6f0:	55                   	push   %ebp
+     6f1:	89 e5                	mov    %esp,%ebp
+     6f3:	8b 55 10             	mov    0x10(%ebp),%edx
+     6f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     6f9:	85 d2                	test   %edx,%edx
+     6fb:	74 1b                	je     718 <memchr+0x28>
+    if(*p == (char)c)
+     6fd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+     701:	01 c2                	add    %eax,%edx
+     703:	eb 0a                	jmp    70f <memchr+0x1f>
+     705:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+     708:	83 c0 01             	add    $0x1,%eax
+     70b:	39 c2                	cmp    %eax,%edx
+     70d:	74 09                	je     718 <memchr+0x28>
+    if(*p == (char)c)
+     70f:	38 08                	cmp    %cl,(%eax)
+     711:	75 f5                	jne    708 <memchr+0x18>
+}
+     713:	5d                   	pop    %ebp
+     714:	c3                   	ret
+     715:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+     718:	31 c0                	xor    %eax,%eax
+}
+     71a:	5d                   	pop    %ebp
+     71b:	c3                   	ret
+     71c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000720 <gets>:
+{
+     720:	55                   	push   %ebp
+     721:	89 e5                	mov    %esp,%ebp
+     723:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+     724:	31 ff                	xor    %edi,%edi
+{
+     726:	56                   	push   %esi
+     727:	be c8 25 00 00       	mov    $0x25c8,%esi
+     72c:	53                   	push   %ebx
+     72d:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     730:	8b 46 fc             	mov    -0x4(%esi),%eax
+     733:	85 c0                	test   %eax,%eax
+     735:	7e 15                	jle    74c <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     737:	83 ec 04             	sub    $0x4,%esp
+     73a:	50                   	push   %eax
+     73b:	56                   	push   %esi
+     73c:	57                   	push   %edi
+     73d:	e8 db 01 00 00       	call   91d <write>
+    ob[fd].n = 0;
+     742:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+     749:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     74c:	83 c7 01             	add    $0x1,%edi
+     74f:	81 c6 08 01 00 00    	add    $0x108,%esi
+     755:	83 ff 10             	cmp    $0x10,%edi
+     758:	75 d6                	jne    730 <gets+0x10>
+  for(i=0; i+1 < max; ){
+     75a:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+     75c:	8d 75 e7             	lea    -0x19(%ebp),%esi
+     75f:	eb 2e                	jmp    78f <gets+0x6f>
+     761:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     768:	83 ec 04             	sub    $0x4,%esp
+     76b:	6a 01                	push   $0x1
+     76d:	56                   	push   %esi
+     76e:	6a 00                	push   $0x0
+     770:	e8 a1 01 00 00       	call   916 <read>
+    if(cc < 1)
+     775:	83 c4 10             	add    $0x10,%esp
+     778:	85 c0                	test   %eax,%eax
+     77a:	7e 1d                	jle    799 <gets+0x79>
+    buf[i++] = c;
+     77c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     780:	8b 55 08             	mov    0x8(%ebp),%edx
+     783:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     787:	3c 0a                	cmp    $0xa,%al
+     789:	74 10                	je     79b <gets+0x7b>
+     78b:	3c 0d                	cmp    $0xd,%al
+     78d:	74 0c                	je     79b <gets+0x7b>
+  for(i=0; i+1 < max; ){
+     78f:	89 df                	mov    %ebx,%edi
+     791:	83 c3 01             	add    $0x1,%ebx
+     794:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     797:	7c cf                	jl     768 <gets+0x48>
+     799:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     79b:	8b 45 08             	mov    0x8(%ebp),%eax
+     79e:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     7a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     7a5:	5b                   	pop    %ebx
+     7a6:	5e                   	pop    %esi
+     7a7:	5f                   	pop    %edi
+     7a8:	5d                   	pop    %ebp
+     7a9:	c3                   	ret
+     7aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000007b0 <stat>:
+{
+     7b0:	55                   	push   %ebp
+     7b1:	89 e5                	mov    %esp,%ebp
+     7b3:	57                   	push   %edi
+     7b4:	56                   	push   %esi
+     7b5:	53                   	push   %ebx
+     7b6:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+     7b9:	6a 00                	push   $0x0
+     7bb:	ff 75 08             	push   0x8(%ebp)
+     7be:	e8 76 01 00 00       	call   939 <open>
+  if(fd < 0)
+     7c3:	83 c4 10             	add    $0x10,%esp
+     7c6:	85 c0                	test   %eax,%eax
+     7c8:	78 76                	js     840 <stat+0x90>
+  r = fstat(fd, st);
+     7ca:	83 ec 08             	sub    $0x8,%esp
+     7cd:	ff 75 0c             	push   0xc(%ebp)
+     7d0:	89 c3                	mov    %eax,%ebx
+     7d2:	50                   	push   %eax
+     7d3:	e8 7f 01 00 00       	call   957 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     7d8:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     7db:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     7dd:	83 fb 0f             	cmp    $0xf,%ebx
+     7e0:	7f 40                	jg     822 <stat+0x72>
+     7e2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     7e8:	8b 90 c4 25 00 00    	mov    0x25c4(%eax),%edx
+     7ee:	8d b8 c0 25 00 00    	lea    0x25c0(%eax),%edi
+     7f4:	85 d2                	test   %edx,%edx
+     7f6:	7e 1a                	jle    812 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+     7f8:	83 ec 04             	sub    $0x4,%esp
+     7fb:	05 c8 25 00 00       	add    $0x25c8,%eax
+     800:	52                   	push   %edx
+     801:	50                   	push   %eax
+     802:	53                   	push   %ebx
+     803:	e8 15 01 00 00       	call   91d <write>
+    ob[fd].n = 0;
+     808:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+     80f:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+     812:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     818:	c7 80 c0 25 00 00 00 	movl   $0x0,0x25c0(%eax)
+     81f:	00 00 00 
+  return _close(fd);
+     822:	83 ec 0c             	sub    $0xc,%esp
+     825:	53                   	push   %ebx
+     826:	e8 f9 00 00 00       	call   924 <_close>
+     82b:	83 c4 10             	add    $0x10,%esp
+}
+     82e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     831:	89 f0                	mov    %esi,%eax
+     833:	5b                   	pop    %ebx
+     834:	5e                   	pop    %esi
+     835:	5f                   	pop    %edi
+     836:	5d                   	pop    %ebp
+     837:	c3                   	ret
+     838:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     83f:	90                   	nop
+    return -1;
+     840:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     845:	eb e7                	jmp    82e <stat+0x7e>
+     847:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     84e:	66 90                	xchg   %ax,%ax
+
+00000850 <atoi>:
+{
+     850:	55                   	push   %ebp
+     851:	89 e5                	mov    %esp,%ebp
+     853:	53                   	push   %ebx
+     854:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     857:	0f be 02             	movsbl (%edx),%eax
+     85a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     85d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     860:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     865:	77 1e                	ja     885 <atoi+0x35>
+     867:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     86e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     870:	83 c2 01             	add    $0x1,%edx
+     873:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     876:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     87a:	0f be 02             	movsbl (%edx),%eax
+     87d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     880:	80 fb 09             	cmp    $0x9,%bl
+     883:	76 eb                	jbe    870 <atoi+0x20>
+}
+     885:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     888:	89 c8                	mov    %ecx,%eax
+     88a:	c9                   	leave
+     88b:	c3                   	ret
+     88c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000890 <memmove>:
+{
+     890:	55                   	push   %ebp
+     891:	89 e5                	mov    %esp,%ebp
+     893:	57                   	push   %edi
+     894:	56                   	push   %esi
+     895:	8b 45 10             	mov    0x10(%ebp),%eax
+     898:	8b 55 08             	mov    0x8(%ebp),%edx
+     89b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     89e:	85 c0                	test   %eax,%eax
+     8a0:	7e 13                	jle    8b5 <memmove+0x25>
+     8a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     8a4:	89 d7                	mov    %edx,%edi
+     8a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     8b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     8b1:	39 f8                	cmp    %edi,%eax
+     8b3:	75 fb                	jne    8b0 <memmove+0x20>
+  return vdst;
+}
+     8b5:	5e                   	pop    %esi
+     8b6:	89 d0                	mov    %edx,%eax
+     8b8:	5f                   	pop    %edi
+     8b9:	5d                   	pop    %ebp
+     8ba:	c3                   	ret
+
+000008bb <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+     8bb:	83 3d b3 15 00 00 00 	cmpl   $0x0,0x15b3
+  jle 1f
+     8c2:	7e 0a                	jle    8ce <syscallentry+0x13>
+  movl %esp, %ecx
+     8c4:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+     8c6:	ba cd 08 00 00       	mov    $0x8cd,%edx
+  sysenter
+     8cb:	0f 34                	sysenter
+2:
+  ret
+     8cd:	c3                   	ret
+1:
+  jl 3f
+     8ce:	7c 27                	jl     8f7 <syscallentry+0x3c>
+  pushal
+     8d0:	60                   	pusha
+  movl $1, %eax
+     8d1:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     8d6:	0f a2                	cpuid
+  movl $-1, sysentermode
+     8d8:	c7 05 b3 15 00 00 ff 	movl   $0xffffffff,0x15b3
+     8df:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     8e2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+     8e8:	74 0a                	je     8f4 <syscallentry+0x39>
+  movl $1, sysentermode
+     8ea:	c7 05 b3 15 00 00 01 	movl   $0x1,0x15b3
+     8f1:	00 00 00 
+4:
+  popal
+     8f4:	61                   	popa
+  jmp syscallentry
+     8f5:	eb c4                	jmp    8bb <syscallentry>
+3:
+  int $T_SYSCALL
+     8f7:	cd 40                	int    $0x40
+  ret
+     8f9:	c3                   	ret
+
+000008fa <_fork>:
+
+SYSCALLAS(_fork, fork)
+     8fa:	b8 01 00 00 00       	mov    $0x1,%eax
+     8ff:	eb ba                	jmp    8bb <syscallentry>
+
+00000901 <_exit>:
+SYSCALLAS(_exit, exit)
+     901:	b8 02 00 00 00       	mov    $0x2,%eax
+     906:	eb b3                	jmp    8bb <syscallentry>
+
+00000908 <wait>:
+SYSCALL(wait)
+     908:	b8 03 00 00 00       	mov    $0x3,%eax
+     90d:	eb ac                	jmp    8bb <syscallentry>
+
+0000090f <pipe>:
+SYSCALL(pipe)
+     90f:	b8 04 00 00 00       	mov    $0x4,%eax
+     914:	eb a5                	jmp    8bb <syscallentry>
+
+00000916 <read>:
+SYSCALL(read)
+     916:	b8 05 00 00 00       	mov    $0x5,%eax
+     91b:	eb 9e                	jmp    8bb <syscallentry>
+
+0000091d <write>:
+SYSCALL(write)
+     91d:	b8 10 00 00 00       	mov    $0x10,%eax
+     922:	eb 97                	jmp    8bb <syscallentry>
+
+00000924 <_close>:
+SYSCALLAS(_close, close)
+     924:	b8 15 00 00 00       	mov    $0x15,%eax
+     929:	eb 90                	jmp    8bb <syscallentry>
+
+0000092b <kill>:
+SYSCALL(kill)
+     92b:	b8 06 00 00 00       	mov    $0x6,%eax
+     930:	eb 89                	jmp    8bb <syscallentry>
+
+00000932 <_exec>:
+SYSCALLAS(_exec, exec)
+     932:	b8 07 00 00 00       	mov    $0x7,%eax
+     937:	eb 82                	jmp    8bb <syscallentry>
+
+00000939 <open>:
+SYSCALL(open)
+     939:	b8 0f 00 00 00       	mov    $0xf,%eax
+     93e:	e9 78 ff ff ff       	jmp    8bb <syscallentry>
+
+00000943 <mknod>:
+SYSCALL(mknod)
+     943:	b8 11 00 00 00       	mov    $0x11,%eax
+     948:	e9 6e ff ff ff       	jmp    8bb <syscallentry>
+
+0000094d <unlink>:
+SYSCALL(unlink)
+     94d:	b8 12 00 00 00       	mov    $0x12,%eax
+     952:	e9 64 ff ff ff       	jmp    8bb <syscallentry>
+
+00000957 <fstat>:
+SYSCALL(fstat)
+     957:	b8 08 00 00 00       	mov    $0x8,%eax
+     95c:	e9 5a ff ff ff       	jmp    8bb <syscallentry>
+
+00000961 <link>:
+SYSCALL(link)
+     961:	b8 13 00 00 00       	mov    $0x13,%eax
+     966:	e9 50 ff ff ff       	jmp    8bb <syscallentry>
+
+0000096b <mkdir>:
+SYSCALL(mkdir)
+     96b:	b8 14 00 00 00       	mov    $0x14,%eax
+     970:	e9 46 ff ff ff       	jmp    8bb <syscallentry>
+
+00000975 <chdir>:
+SYSCALL(chdir)
+     975:	b8 09 00 00 00       	mov    $0x9,%eax
+     97a:	e9 3c ff ff ff       	jmp    8bb <syscallentry>
+
+0000097f <dup>:
+SYSCALL(dup)
+     97f:	b8 0a 00 00 00       	mov    $0xa,%eax
+     984:	e9 32 ff ff ff       	jmp    8bb <syscallentry>
+
+00000989 <getpid>:
+SYSCALL(getpid)
+     989:	b8 0b 00 00 00       	mov    $0xb,%eax
+     98e:	e9 28 ff ff ff       	jmp    8bb <syscallentry>
+
+00000993 <sbrk>:
+SYSCALL(sbrk)
+     993:	b8 0c 00 00 00       	mov    $0xc,%eax
+     998:	e9 1e ff ff ff       	jmp    8bb <syscallentry>
+
+0000099d <sleep>:
+SYSCALL(sleep)
+     99d:	b8 0d 00 00 00       	mov    $0xd,%eax
+     9a2:	e9 14 ff ff ff       	jmp    8bb <syscallentry>
+
+000009a7 <uptime>:
+SYSCALL(uptime)
+     9a7:	b8 0e 00 00 00       	mov    $0xe,%eax
+     9ac:	e9 0a ff ff ff       	jmp    8bb <syscallentry>
+
+000009b1 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+     9b1:	b8 16 00 00 00       	mov    $0x16,%eax
+     9b6:	e9 00 ff ff ff       	jmp    8bb <syscallentry>
+
+000009bb <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+     9bb:	b8 17 00 00 00       	mov    $0x17,%eax
+     9c0:	e9 f6 fe ff ff       	jmp    8bb <syscallentry>
+
+000009c5 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+     9c5:	b8 18 00 00 00       	mov    $0x18,%eax
+     9ca:	e9 ec fe ff ff       	jmp    8bb <syscallentry>
+
+000009cf <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+     9cf:	b8 19 00 00 00       	mov    $0x19,%eax
+     9d4:	e9 e2 fe ff ff       	jmp    8bb <syscallentry>
+
+000009d9 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+     9d9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     9de:	e9 d8 fe ff ff       	jmp    8bb <syscallentry>
+
+000009e3 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+     9e3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     9e8:	e9 ce fe ff ff       	jmp    8bb <syscallentry>
+
+000009ed <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+     9ed:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     9f2:	e9 c4 fe ff ff       	jmp    8bb <syscallentry>
+
+000009f7 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+     9f7:	b8 20 00 00 00       	mov    $0x20,%eax
+     9fc:	e9 ba fe ff ff       	jmp    8bb <syscallentry>
+
+00000a01 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+     a01:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     a06:	e9 b0 fe ff ff       	jmp    8bb <syscallentry>
+
+00000a0b <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+     a0b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     a10:	e9 a6 fe ff ff       	jmp    8bb <syscallentry>
+
+00000a15 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+     a15:	b8 21 00 00 00       	mov    $0x21,%eax
+     a1a:	e9 9c fe ff ff       	jmp    8bb <syscallentry>
+
+00000a1f <yield>:
+SYSCALL(yield) // yield the CPU to another process
+     a1f:	b8 22 00 00 00       	mov    $0x22,%eax
+     a24:	e9 92 fe ff ff       	jmp    8bb <syscallentry>
+
+00000a29 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+     a29:	b8 23 00 00 00       	mov    $0x23,%eax
+     a2e:	e9 88 fe ff ff       	jmp    8bb <syscallentry>
+
+00000a33 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+     a33:	b8 24 00 00 00       	mov    $0x24,%eax
+     a38:	e9 7e fe ff ff       	jmp    8bb <syscallentry>
+
+00000a3d <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+     a3d:	b8 25 00 00 00       	mov    $0x25,%eax
+     a42:	e9 74 fe ff ff       	jmp    8bb <syscallentry>
+
+00000a47 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+     a47:	b8 26 00 00 00       	mov    $0x26,%eax
+     a4c:	e9 6a fe ff ff       	jmp    8bb <syscallentry>
+
+00000a51 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+     a51:	b8 27 00 00 00       	mov    $0x27,%eax
+     a56:	e9 60 fe ff ff       	jmp    8bb <syscallentry>
+
+00000a5b <mmap>:
+SYSCALL(mmap) // map a file into memory
+     a5b:	b8 28 00 00 00       	mov    $0x28,%eax
+     a60:	e9 56 fe ff ff       	jmp    8bb <syscallentry>
+
+00000a65 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+     a65:	b8 29 00 00 00       	mov    $0x29,%eax
+     a6a:	e9 4c fe ff ff       	jmp    8bb <syscallentry>
+
+00000a6f <readv>:
+SYSCALL(readv) // read into several buffers
+     a6f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     a74:	e9 42 fe ff ff       	jmp    8bb <syscallentry>
+
+00000a79 <writev>:
+SYSCALL(writev) // write from several buffers
+     a79:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     a7e:	e9 38 fe ff ff       	jmp    8bb <syscallentry>
+
+00000a83 <pread>:
+SYSCALL(pread) // read at an offset
+     a83:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     a88:	e9 2e fe ff ff       	jmp    8bb <syscallentry>
+
+00000a8d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+     a8d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     a92:	e9 24 fe ff ff       	jmp    8bb <syscallentry>
+
+00000a97 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+     a97:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     a9c:	e9 1a fe ff ff       	jmp    8bb <syscallentry>
+
+00000aa1 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+     aa1:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     aa6:	e9 10 fe ff ff       	jmp    8bb <syscallentry>
+
+00000aab <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+     aab:	b8 30 00 00 00       	mov    $0x30,%eax
+     ab0:	e9 06 fe ff ff       	jmp    8bb <syscallentry>
+
+00000ab5 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+     ab5:	b8 31 00 00 00       	mov    $0x31,%eax
+     aba:	e9 fc fd ff ff       	jmp    8bb <syscallentry>
+
+00000abf <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+     abf:	b8 32 00 00 00       	mov    $0x32,%eax
+     ac4:	e9 f2 fd ff ff       	jmp    8bb <syscallentry>
+
+00000ac9 <profread>:
+SYSCALL(profread) // drain profiler samples
+     ac9:	b8 33 00 00 00       	mov    $0x33,%eax
+     ace:	e9 e8 fd ff ff       	jmp    8bb <syscallentry>
+
+00000ad3 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+     ad3:	b8 34 00 00 00       	mov    $0x34,%eax
+     ad8:	e9 de fd ff ff       	jmp    8bb <syscallentry>
+
+00000add <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+     add:	b8 35 00 00 00       	mov    $0x35,%eax
+     ae2:	e9 d4 fd ff ff       	jmp    8bb <syscallentry>
+
+00000ae7 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+     ae7:	b8 36 00 00 00       	mov    $0x36,%eax
+     aec:	e9 ca fd ff ff       	jmp    8bb <syscallentry>
+
+00000af1 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+     af1:	b8 37 00 00 00       	mov    $0x37,%eax
+     af6:	e9 c0 fd ff ff       	jmp    8bb <syscallentry>
+     afb:	66 90                	xchg   %ax,%ax
+     afd:	66 90                	xchg   %ax,%ax
+     aff:	90                   	nop
+
+00000b00 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     b00:	55                   	push   %ebp
+     b01:	89 e5                	mov    %esp,%ebp
+     b03:	57                   	push   %edi
+     b04:	56                   	push   %esi
+     b05:	53                   	push   %ebx
+     b06:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     b08:	89 d1                	mov    %edx,%ecx
+{
+     b0a:	83 ec 3c             	sub    $0x3c,%esp
+     b0d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     b10:	85 d2                	test   %edx,%edx
+     b12:	0f 89 80 00 00 00    	jns    b98 <printint+0x98>
+     b18:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     b1c:	74 7a                	je     b98 <printint+0x98>
+    x = -xx;
+     b1e:	f7 d9                	neg    %ecx
+    neg = 1;
+     b20:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     b25:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     b28:	31 f6                	xor    %esi,%esi
+     b2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     b30:	89 c8                	mov    %ecx,%eax
+     b32:	31 d2                	xor    %edx,%edx
+     b34:	89 f7                	mov    %esi,%edi
+     b36:	f7 f3                	div    %ebx
+     b38:	8d 76 01             	lea    0x1(%esi),%esi
+     b3b:	0f b6 92 1c 11 00 00 	movzbl 0x111c(%edx),%edx
+     b42:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     b46:	89 ca                	mov    %ecx,%edx
+     b48:	89 c1                	mov    %eax,%ecx
+     b4a:	39 da                	cmp    %ebx,%edx
+     b4c:	73 e2                	jae    b30 <printint+0x30>
+  if(neg)
+     b4e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     b51:	85 c0                	test   %eax,%eax
+     b53:	74 07                	je     b5c <printint+0x5c>
+    buf[i++] = '-';
+     b55:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     b5a:	89 f7                	mov    %esi,%edi
+     b5c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     b5f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     b62:	01 df                	add    %ebx,%edi
+     b64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     b68:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+     b6b:	83 ec 04             	sub    $0x4,%esp
+     b6e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     b71:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     b74:	6a 01                	push   $0x1
+     b76:	50                   	push   %eax
+     b77:	56                   	push   %esi
+     b78:	e8 e3 f6 ff ff       	call   260 <bufwrite>
+  while(--i >= 0)
+     b7d:	89 f8                	mov    %edi,%eax
+     b7f:	83 c4 10             	add    $0x10,%esp
+     b82:	83 ef 01             	sub    $0x1,%edi
+     b85:	39 d8                	cmp    %ebx,%eax
+     b87:	75 df                	jne    b68 <printint+0x68>
+}
+     b89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b8c:	5b                   	pop    %ebx
+     b8d:	5e                   	pop    %esi
+     b8e:	5f                   	pop    %edi
+     b8f:	5d                   	pop    %ebp
+     b90:	c3                   	ret
+     b91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     b98:	31 c0                	xor    %eax,%eax
+     b9a:	eb 89                	jmp    b25 <printint+0x25>
+     b9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ba0 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     ba0:	55                   	push   %ebp
+     ba1:	89 e5                	mov    %esp,%ebp
+     ba3:	57                   	push   %edi
+     ba4:	56                   	push   %esi
+     ba5:	53                   	push   %ebx
+     ba6:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     ba9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     bac:	0f b6 18             	movzbl (%eax),%ebx
+     baf:	84 db                	test   %bl,%bl
+     bb1:	74 6c                	je     c1f <printf+0x7f>
+     bb3:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+     bb6:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+     bb9:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     bbb:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     bbe:	eb 26                	jmp    be6 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     bc0:	83 f8 25             	cmp    $0x25,%eax
+     bc3:	74 4b                	je     c10 <printf+0x70>
+  bufwrite(fd, &c, 1);
+     bc5:	83 ec 04             	sub    $0x4,%esp
+     bc8:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     bcb:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     bce:	6a 01                	push   $0x1
+     bd0:	50                   	push   %eax
+     bd1:	ff 75 08             	push   0x8(%ebp)
+     bd4:	e8 87 f6 ff ff       	call   260 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+     bd9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     bdc:	0f b6 1f             	movzbl (%edi),%ebx
+     bdf:	83 c7 01             	add    $0x1,%edi
+     be2:	84 db                	test   %bl,%bl
+     be4:	74 39                	je     c1f <printf+0x7f>
+    c = fmt[i] & 0xff;
+     be6:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     be9:	85 f6                	test   %esi,%esi
+     beb:	74 d3                	je     bc0 <printf+0x20>
+      }
+    } else if(state == '%'){
+     bed:	83 fe 25             	cmp    $0x25,%esi
+     bf0:	75 ea                	jne    bdc <printf+0x3c>
+      if(c == 'd'){
+     bf2:	83 f8 25             	cmp    $0x25,%eax
+     bf5:	0f 84 d5 01 00 00    	je     dd0 <printf+0x230>
+     bfb:	83 e8 63             	sub    $0x63,%eax
+     bfe:	83 f8 15             	cmp    $0x15,%eax
+     c01:	77 45                	ja     c48 <printf+0xa8>
+     c03:	ff 24 85 c4 10 00 00 	jmp    *0x10c4(,%eax,4)
+     c0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     c10:	0f b6 1f             	movzbl (%edi),%ebx
+     c13:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+     c16:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     c1b:	84 db                	test   %bl,%bl
+     c1d:	75 c7                	jne    be6 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+     c1f:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+     c23:	74 0b                	je     c30 <printf+0x90>
+    fflush(fd);
+}
+     c25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c28:	5b                   	pop    %ebx
+     c29:	5e                   	pop    %esi
+     c2a:	5f                   	pop    %edi
+     c2b:	5d                   	pop    %ebp
+     c2c:	c3                   	ret
+     c2d:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+     c30:	83 ec 0c             	sub    $0xc,%esp
+     c33:	6a 02                	push   $0x2
+     c35:	e8 c6 f7 ff ff       	call   400 <fflush>
+     c3a:	83 c4 10             	add    $0x10,%esp
+}
+     c3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c40:	5b                   	pop    %ebx
+     c41:	5e                   	pop    %esi
+     c42:	5f                   	pop    %edi
+     c43:	5d                   	pop    %ebp
+     c44:	c3                   	ret
+     c45:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+     c48:	83 ec 04             	sub    $0x4,%esp
+     c4b:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     c4e:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+     c52:	6a 01                	push   $0x1
+     c54:	52                   	push   %edx
+     c55:	89 55 c0             	mov    %edx,-0x40(%ebp)
+     c58:	ff 75 08             	push   0x8(%ebp)
+     c5b:	e8 00 f6 ff ff       	call   260 <bufwrite>
+     c60:	83 c4 0c             	add    $0xc,%esp
+     c63:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     c66:	6a 01                	push   $0x1
+     c68:	8b 55 c0             	mov    -0x40(%ebp),%edx
+     c6b:	52                   	push   %edx
+      state = 0;
+     c6c:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+     c6e:	ff 75 08             	push   0x8(%ebp)
+     c71:	e8 ea f5 ff ff       	call   260 <bufwrite>
+        putc(fd, c);
+     c76:	83 c4 10             	add    $0x10,%esp
+     c79:	e9 5e ff ff ff       	jmp    bdc <printf+0x3c>
+     c7e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+     c80:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     c83:	83 ec 0c             	sub    $0xc,%esp
+     c86:	b9 10 00 00 00       	mov    $0x10,%ecx
+     c8b:	8b 16                	mov    (%esi),%edx
+     c8d:	6a 00                	push   $0x0
+     c8f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+     c92:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+     c95:	e8 66 fe ff ff       	call   b00 <printint>
+        ap++;
+     c9a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     c9d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     ca0:	31 f6                	xor    %esi,%esi
+     ca2:	e9 35 ff ff ff       	jmp    bdc <printf+0x3c>
+     ca7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cae:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     cb0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     cb3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     cb5:	83 c0 04             	add    $0x4,%eax
+     cb8:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+     cbb:	b8 ba 10 00 00       	mov    $0x10ba,%eax
+     cc0:	85 db                	test   %ebx,%ebx
+     cc2:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+     cc5:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+     cc8:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+     cca:	53                   	push   %ebx
+     ccb:	e8 90 f9 ff ff       	call   660 <strlen>
+     cd0:	83 c4 0c             	add    $0xc,%esp
+     cd3:	50                   	push   %eax
+     cd4:	53                   	push   %ebx
+     cd5:	ff 75 08             	push   0x8(%ebp)
+     cd8:	e8 83 f5 ff ff       	call   260 <bufwrite>
+     cdd:	83 c4 10             	add    $0x10,%esp
+     ce0:	e9 f7 fe ff ff       	jmp    bdc <printf+0x3c>
+     ce5:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+     ce8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+     ceb:	83 ec 04             	sub    $0x4,%esp
+     cee:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+     cf1:	8b 06                	mov    (%esi),%eax
+        ap++;
+     cf3:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+     cf6:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+     cf9:	6a 01                	push   $0x1
+     cfb:	52                   	push   %edx
+     cfc:	ff 75 08             	push   0x8(%ebp)
+     cff:	e8 5c f5 ff ff       	call   260 <bufwrite>
+        ap++;
+     d04:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     d07:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d0a:	31 f6                	xor    %esi,%esi
+     d0c:	e9 cb fe ff ff       	jmp    bdc <printf+0x3c>
+     d11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+     d18:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     d1b:	83 ec 0c             	sub    $0xc,%esp
+     d1e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     d23:	8b 16                	mov    (%esi),%edx
+     d25:	6a 01                	push   $0x1
+     d27:	e9 63 ff ff ff       	jmp    c8f <printf+0xef>
+     d2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+     d30:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     d33:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     d36:	89 7d c0             	mov    %edi,-0x40(%ebp)
+     d39:	89 55 bc             	mov    %edx,-0x44(%ebp)
+     d3c:	8b 18                	mov    (%eax),%ebx
+     d3e:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+     d41:	31 c0                	xor    %eax,%eax
+     d43:	89 c7                	mov    %eax,%edi
+     d45:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+     d48:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+     d4d:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+     d4f:	f7 e1                	mul    %ecx
+     d51:	c1 ea 03             	shr    $0x3,%edx
+     d54:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     d57:	89 d1                	mov    %edx,%ecx
+     d59:	01 c0                	add    %eax,%eax
+     d5b:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     d5d:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+     d5f:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     d61:	be 0a 00 00 00       	mov    $0xa,%esi
+     d66:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+     d68:	89 da                	mov    %ebx,%edx
+     d6a:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+     d6c:	89 fe                	mov    %edi,%esi
+     d6e:	83 c7 01             	add    $0x1,%edi
+     d71:	8d 42 30             	lea    0x30(%edx),%eax
+     d74:	89 da                	mov    %ebx,%edx
+     d76:	8d 14 92             	lea    (%edx,%edx,4),%edx
+     d79:	01 d2                	add    %edx,%edx
+     d7b:	29 d0                	sub    %edx,%eax
+     d7d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+     d81:	89 c8                	mov    %ecx,%eax
+     d83:	09 d8                	or     %ebx,%eax
+     d85:	75 c1                	jne    d48 <printf+0x1a8>
+     d87:	8b 55 bc             	mov    -0x44(%ebp),%edx
+     d8a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     d8d:	01 d6                	add    %edx,%esi
+     d8f:	89 f7                	mov    %esi,%edi
+     d91:	89 d6                	mov    %edx,%esi
+     d93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d97:	90                   	nop
+    putc(fd, buf[i]);
+     d98:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+     d9b:	83 ec 04             	sub    $0x4,%esp
+     d9e:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+     da1:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+     da4:	6a 01                	push   $0x1
+     da6:	50                   	push   %eax
+     da7:	53                   	push   %ebx
+     da8:	e8 b3 f4 ff ff       	call   260 <bufwrite>
+  while(--i >= 0)
+     dad:	89 fa                	mov    %edi,%edx
+     daf:	83 c4 10             	add    $0x10,%esp
+     db2:	83 ef 01             	sub    $0x1,%edi
+     db5:	39 d6                	cmp    %edx,%esi
+     db7:	75 df                	jne    d98 <printf+0x1f8>
+        ap += 2;
+     db9:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+     dbd:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+     dc0:	31 f6                	xor    %esi,%esi
+     dc2:	e9 15 fe ff ff       	jmp    bdc <printf+0x3c>
+     dc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dce:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+     dd0:	83 ec 04             	sub    $0x4,%esp
+     dd3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     dd6:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     dd9:	6a 01                	push   $0x1
+     ddb:	e9 8b fe ff ff       	jmp    c6b <printf+0xcb>
+
+00000de0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     de0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     de1:	a1 40 36 00 00       	mov    0x3640,%eax
+{
+     de6:	89 e5                	mov    %esp,%ebp
+     de8:	57                   	push   %edi
+     de9:	56                   	push   %esi
+     dea:	53                   	push   %ebx
+     deb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     dee:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     df1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     df8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     dfa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     dfc:	39 ca                	cmp    %ecx,%edx
+     dfe:	73 30                	jae    e30 <free+0x50>
+     e00:	39 c1                	cmp    %eax,%ecx
+     e02:	72 04                	jb     e08 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e04:	39 c2                	cmp    %eax,%edx
+     e06:	72 f0                	jb     df8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     e08:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     e0b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     e0e:	39 f8                	cmp    %edi,%eax
+     e10:	74 2e                	je     e40 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e12:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     e15:	8b 42 04             	mov    0x4(%edx),%eax
+     e18:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     e1b:	39 f1                	cmp    %esi,%ecx
+     e1d:	74 38                	je     e57 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     e1f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     e21:	5b                   	pop    %ebx
+  freep = p;
+     e22:	89 15 40 36 00 00    	mov    %edx,0x3640
+}
+     e28:	5e                   	pop    %esi
+     e29:	5f                   	pop    %edi
+     e2a:	5d                   	pop    %ebp
+     e2b:	c3                   	ret
+     e2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e30:	39 c1                	cmp    %eax,%ecx
+     e32:	72 d0                	jb     e04 <free+0x24>
+     e34:	eb c2                	jmp    df8 <free+0x18>
+     e36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e3d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+     e40:	03 70 04             	add    0x4(%eax),%esi
+     e43:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e46:	8b 02                	mov    (%edx),%eax
+     e48:	8b 00                	mov    (%eax),%eax
+     e4a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     e4d:	8b 42 04             	mov    0x4(%edx),%eax
+     e50:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     e53:	39 f1                	cmp    %esi,%ecx
+     e55:	75 c8                	jne    e1f <free+0x3f>
+    p->s.size += bp->s.size;
+     e57:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     e5a:	89 15 40 36 00 00    	mov    %edx,0x3640
+    p->s.size += bp->s.size;
+     e60:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     e63:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     e66:	89 0a                	mov    %ecx,(%edx)
+}
+     e68:	5b                   	pop    %ebx
+     e69:	5e                   	pop    %esi
+     e6a:	5f                   	pop    %edi
+     e6b:	5d                   	pop    %ebp
+     e6c:	c3                   	ret
+     e6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e70 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     e70:	55                   	push   %ebp
+     e71:	89 e5                	mov    %esp,%ebp
+     e73:	57                   	push   %edi
+     e74:	56                   	push   %esi
+     e75:	53                   	push   %ebx
+     e76:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     e79:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+     e7c:	8b 15 40 36 00 00    	mov    0x3640,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     e82:	8d 78 07             	lea    0x7(%eax),%edi
+     e85:	c1 ef 03             	shr    $0x3,%edi
+     e88:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+     e8b:	85 d2                	test   %edx,%edx
+     e8d:	0f 84 8d 00 00 00    	je     f20 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     e93:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     e95:	8b 48 04             	mov    0x4(%eax),%ecx
+     e98:	39 f9                	cmp    %edi,%ecx
+     e9a:	73 64                	jae    f00 <malloc+0x90>
+  if(nu < 4096)
+     e9c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     ea1:	39 df                	cmp    %ebx,%edi
+     ea3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     ea6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     ead:	eb 0a                	jmp    eb9 <malloc+0x49>
+     eaf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     eb0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     eb2:	8b 48 04             	mov    0x4(%eax),%ecx
+     eb5:	39 f9                	cmp    %edi,%ecx
+     eb7:	73 47                	jae    f00 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     eb9:	89 c2                	mov    %eax,%edx
+     ebb:	39 05 40 36 00 00    	cmp    %eax,0x3640
+     ec1:	75 ed                	jne    eb0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+     ec3:	83 ec 0c             	sub    $0xc,%esp
+     ec6:	56                   	push   %esi
+     ec7:	e8 c7 fa ff ff       	call   993 <sbrk>
+  if(p == (char*)-1)
+     ecc:	83 c4 10             	add    $0x10,%esp
+     ecf:	83 f8 ff             	cmp    $0xffffffff,%eax
+     ed2:	74 1c                	je     ef0 <malloc+0x80>
+  hp->s.size = nu;
+     ed4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+     ed7:	83 ec 0c             	sub    $0xc,%esp
+     eda:	83 c0 08             	add    $0x8,%eax
+     edd:	50                   	push   %eax
+     ede:	e8 fd fe ff ff       	call   de0 <free>
+  return freep;
+     ee3:	8b 15 40 36 00 00    	mov    0x3640,%edx
+      if((p = morecore(nunits)) == 0)
+     ee9:	83 c4 10             	add    $0x10,%esp
+     eec:	85 d2                	test   %edx,%edx
+     eee:	75 c0                	jne    eb0 <malloc+0x40>
+        return 0;
+  }
+}
+     ef0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     ef3:	31 c0                	xor    %eax,%eax
+}
+     ef5:	5b                   	pop    %ebx
+     ef6:	5e                   	pop    %esi
+     ef7:	5f                   	pop    %edi
+     ef8:	5d                   	pop    %ebp
+     ef9:	c3                   	ret
+     efa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     f00:	39 cf                	cmp    %ecx,%edi
+     f02:	74 4c                	je     f50 <malloc+0xe0>
+        p->s.size -= nunits;
+     f04:	29 f9                	sub    %edi,%ecx
+     f06:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+     f09:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+     f0c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+     f0f:	89 15 40 36 00 00    	mov    %edx,0x3640
+}
+     f15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+     f18:	83 c0 08             	add    $0x8,%eax
+}
+     f1b:	5b                   	pop    %ebx
+     f1c:	5e                   	pop    %esi
+     f1d:	5f                   	pop    %edi
+     f1e:	5d                   	pop    %ebp
+     f1f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+     f20:	c7 05 40 36 00 00 44 	movl   $0x3644,0x3640
+     f27:	36 00 00 
+    base.s.size = 0;
+     f2a:	b8 44 36 00 00       	mov    $0x3644,%eax
+    base.s.ptr = freep = prevp = &base;
+     f2f:	c7 05 44 36 00 00 44 	movl   $0x3644,0x3644
+     f36:	36 00 00 
+    base.s.size = 0;
+     f39:	c7 05 48 36 00 00 00 	movl   $0x0,0x3648
+     f40:	00 00 00 
+    if(p->s.size >= nunits){
+     f43:	e9 54 ff ff ff       	jmp    e9c <malloc+0x2c>
+     f48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f4f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+     f50:	8b 08                	mov    (%eax),%ecx
+     f52:	89 0a                	mov    %ecx,(%edx)
+     f54:	eb b9                	jmp    f0f <malloc+0x9f>
+     f56:	66 90                	xchg   %ax,%ax
+     f58:	66 90                	xchg   %ax,%ax
+     f5a:	66 90                	xchg   %ax,%ax
+     f5c:	66 90                	xchg   %ax,%ax
+     f5e:	66 90                	xchg   %ax,%ax
+
+00000f60 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+     f60:	55                   	push   %ebp
+     f61:	89 e5                	mov    %esp,%ebp
+     f63:	57                   	push   %edi
+     f64:	56                   	push   %esi
+     f65:	be 01 00 00 00       	mov    $0x1,%esi
+     f6a:	53                   	push   %ebx
+     f6b:	83 ec 28             	sub    $0x28,%esp
+     f6e:	8b 45 0c             	mov    0xc(%ebp),%eax
+     f71:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     f74:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+     f77:	68 00 98 00 00       	push   $0x9800
+     f7c:	e8 ef fe ff ff       	call   e70 <malloc>
+     f81:	83 c4 10             	add    $0x10,%esp
+     f84:	89 c7                	mov    %eax,%edi
+     f86:	85 c0                	test   %eax,%eax
+     f88:	74 62                	je     fec <waitpoll+0x8c>
+     f8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+     f90:	83 ec 0c             	sub    $0xc,%esp
+     f93:	6a 01                	push   $0x1
+     f95:	e8 03 fa ff ff       	call   99d <sleep>
+    fn();
+     f9a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     f9d:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+     f9f:	58                   	pop    %eax
+     fa0:	5a                   	pop    %edx
+     fa1:	68 00 02 00 00       	push   $0x200
+     fa6:	57                   	push   %edi
+     fa7:	e8 eb fa ff ff       	call   a97 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+     fac:	83 c4 10             	add    $0x10,%esp
+     faf:	85 c0                	test   %eax,%eax
+     fb1:	7e 2d                	jle    fe0 <waitpoll+0x80>
+     fb3:	6b c0 4c             	imul   $0x4c,%eax,%eax
+     fb6:	89 fa                	mov    %edi,%edx
+    alive = 0;
+     fb8:	31 c9                	xor    %ecx,%ecx
+     fba:	01 f8                	add    %edi,%eax
+     fbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+     fc0:	3b 1a                	cmp    (%edx),%ebx
+     fc2:	75 07                	jne    fcb <waitpoll+0x6b>
+        alive = 1;
+     fc4:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+     fc8:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+     fcb:	83 c2 4c             	add    $0x4c,%edx
+     fce:	39 d0                	cmp    %edx,%eax
+     fd0:	75 ee                	jne    fc0 <waitpoll+0x60>
+  } while(alive);
+     fd2:	85 c9                	test   %ecx,%ecx
+     fd4:	75 ba                	jne    f90 <waitpoll+0x30>
+     fd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fdd:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+     fe0:	83 ec 0c             	sub    $0xc,%esp
+     fe3:	57                   	push   %edi
+     fe4:	e8 f7 fd ff ff       	call   de0 <free>
+  wait();
+     fe9:	83 c4 10             	add    $0x10,%esp
+}
+     fec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     fef:	5b                   	pop    %ebx
+     ff0:	5e                   	pop    %esi
+     ff1:	5f                   	pop    %edi
+     ff2:	5d                   	pop    %ebp
+  wait();
+     ff3:	e9 10 f9 ff ff       	jmp    908 <wait>
+     ff8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fff:	90                   	nop
+
+00001000 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+    1000:	55                   	push   %ebp
+    1001:	89 e5                	mov    %esp,%ebp
+    1003:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+    1006:	c7 45 f0 2d 11 00 00 	movl   $0x112d,-0x10(%ebp)
+    100d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+    1014:	e8 87 f4 ff ff       	call   4a0 <fork>
+    1019:	85 c0                	test   %eax,%eax
+    101b:	78 09                	js     1026 <runps+0x26>
+    return -1;
+  if(pid == 0){
+    101d:	74 0e                	je     102d <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+    101f:	e8 e4 f8 ff ff       	call   908 <wait>
+}
+    1024:	c9                   	leave
+    1025:	c3                   	ret
+    1026:	c9                   	leave
+    return -1;
+    1027:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    102c:	c3                   	ret
+    exec("ps", argv);
+    102d:	50                   	push   %eax
+    102e:	50                   	push   %eax
+    102f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    1032:	50                   	push   %eax
+    1033:	68 2d 11 00 00       	push   $0x112d
+    1038:	e8 c3 f4 ff ff       	call   500 <exec>
+    printf(2, "exec ps failed\n");
+    103d:	5a                   	pop    %edx
+    103e:	59                   	pop    %ecx
+    103f:	68 30 11 00 00       	push   $0x1130
+    1044:	6a 02                	push   $0x2
+    1046:	e8 55 fb ff ff       	call   ba0 <printf>
+    exit();
+    104b:	e8 a0 f4 ff ff       	call   4f0 <exit>
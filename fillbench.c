@@ -0,0 +1,58 @@
+// Fill the disk in steps, timing each step, to show whether
+// block allocation slows down as the disk fills.  By default
+// it writes as much as fsfree() says is free; a step stops
+// early if a write comes up short because the disk is full.
+//
+// usage: fillbench [kb [steps]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "fs.h"
+
+char buf[4096];
+char name[] = "fill00";
+
+int
+main(int argc, char *argv[])
+{
+  int kb, steps, i, j, fd, t;
+
+  kb = argc > 1 ? atoi(argv[1]) : fsfree() * BSIZE / 1024;
+  steps = argc > 2 ? atoi(argv[2]) : 16;
+  if(steps < 1 || steps > 100){
+    printf(2, "usage: fillbench [kb [steps(1-100)]]\n");
+    exit();
+  }
+  memset(buf, 'f', sizeof(buf));
+
+  for(i = 0; i < steps; i++){
+    name[4] = '0' + i / 10;
+    name[5] = '0' + i % 10;
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+      printf(2, "fillbench: cannot create %s\n", name);
+      break;
+    }
+    t = uptime();
+    for(j = 0; j < kb / steps / 4; j++)
+      if(write(fd, buf, sizeof(buf)) != sizeof(buf))
+        break;
+    t = uptime() - t;
+    close(fd);
+    printf(1, "step %d: %d KB in %d ticks\n", i, 4*j, t);
+    if(j < kb / steps / 4){
+      printf(1, "disk full\n");
+      i++;
+      break;
+    }
+  }
+  steps = i;
+
+  for(i = 0; i < steps; i++){
+    name[4] = '0' + i / 10;
+    name[5] = '0' + i % 10;
+    unlink(name);
+  }
+  exit();
+}
@@ -0,0 +1,2175 @@
+
+_forkbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return n;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	bf e8 03 00 00       	mov    $0x3e8,%edi
+      13:	56                   	push   %esi
+      14:	53                   	push   %ebx
+      15:	51                   	push   %ecx
+      16:	83 ec 28             	sub    $0x28,%esp
+  int rounds, i, j, n, pid, fd[2];
+  uint64 t;
+
+  rounds = argc > 1 ? atoi(argv[1]) : 1000;
+      19:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+      1c:	8b 41 04             	mov    0x4(%ecx),%eax
+  rounds = argc > 1 ? atoi(argv[1]) : 1000;
+      1f:	0f 8f b6 00 00 00    	jg     db <main+0xdb>
+  if(rounds <= 0)
+    rounds = 1;
+
+  for(i = 0; i < sizeof(levels)/sizeof(levels[0]); i++){
+      25:	31 f6                	xor    %esi,%esi
+    n = spawnidle(levels[i], fd);
+      27:	83 ec 08             	sub    $0x8,%esp
+      2a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+      2d:	50                   	push   %eax
+      2e:	ff 34 b5 9c 15 00 00 	push   0x159c(,%esi,4)
+      35:	e8 c6 00 00 00       	call   100 <spawnidle>
+      3a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+  asm volatile("rdtsc" : "=A" (t));
+      3d:	0f 31                	rdtsc
+    t = rdtsc();
+    for(j = 0; j < rounds; j++){
+      3f:	31 db                	xor    %ebx,%ebx
+      41:	89 45 c8             	mov    %eax,-0x38(%ebp)
+      44:	83 c4 10             	add    $0x10,%esp
+      47:	89 55 cc             	mov    %edx,-0x34(%ebp)
+      4a:	eb 16                	jmp    62 <main+0x62>
+      4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((pid = fork()) < 0){
+        printf(2, "forkbench: fork failed\n");
+        break;
+      }
+      if(pid == 0)
+      50:	0f 84 80 00 00 00    	je     d6 <main+0xd6>
+        exit();
+      wait();
+      56:	e8 7d 08 00 00       	call   8d8 <wait>
+    for(j = 0; j < rounds; j++){
+      5b:	83 c3 01             	add    $0x1,%ebx
+      5e:	39 df                	cmp    %ebx,%edi
+      60:	74 1a                	je     7c <main+0x7c>
+      if((pid = fork()) < 0){
+      62:	e8 09 04 00 00       	call   470 <fork>
+      67:	85 c0                	test   %eax,%eax
+      69:	79 e5                	jns    50 <main+0x50>
+        printf(2, "forkbench: fork failed\n");
+      6b:	52                   	push   %edx
+      6c:	52                   	push   %edx
+      6d:	68 38 10 00 00       	push   $0x1038
+      72:	6a 02                	push   $0x2
+      74:	e8 f7 0a 00 00       	call   b70 <printf>
+        break;
+      79:	83 c4 10             	add    $0x10,%esp
+      7c:	0f 31                	rdtsc
+    }
+    t = rdtsc() - t;
+    printf(1, "%d idle processes: %d cycles per fork/exit/wait\n",
+           n, (uint)div64(t, j > 0 ? j : 1));
+      7e:	b9 01 00 00 00       	mov    $0x1,%ecx
+    t = rdtsc() - t;
+      83:	2b 45 c8             	sub    -0x38(%ebp),%eax
+      86:	1b 55 cc             	sbb    -0x34(%ebp),%edx
+           n, (uint)div64(t, j > 0 ? j : 1));
+      89:	85 db                	test   %ebx,%ebx
+      8b:	0f 4f cb             	cmovg  %ebx,%ecx
+static inline uint64
+div64(uint64 n, uint d)
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+      8e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+      91:	89 d0                	mov    %edx,%eax
+      93:	89 55 cc             	mov    %edx,-0x34(%ebp)
+      96:	31 d2                	xor    %edx,%edx
+      98:	f7 f1                	div    %ecx
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+      9a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+      9d:	f7 f1                	div    %ecx
+    printf(1, "%d idle processes: %d cycles per fork/exit/wait\n",
+      9f:	50                   	push   %eax
+      a0:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+      a3:	53                   	push   %ebx
+      a4:	68 50 10 00 00       	push   $0x1050
+      a9:	6a 01                	push   $0x1
+      ab:	e8 c0 0a 00 00       	call   b70 <printf>
+    close(fd[1]);
+      b0:	58                   	pop    %eax
+      b1:	ff 75 e4             	push   -0x1c(%ebp)
+      b4:	e8 77 04 00 00       	call   530 <close>
+    wait();
+      b9:	e8 1a 08 00 00       	call   8d8 <wait>
+    if(n < levels[i])
+      be:	83 c4 10             	add    $0x10,%esp
+      c1:	39 1c b5 9c 15 00 00 	cmp    %ebx,0x159c(,%esi,4)
+      c8:	7f 0c                	jg     d6 <main+0xd6>
+  for(i = 0; i < sizeof(levels)/sizeof(levels[0]); i++){
+      ca:	83 c6 01             	add    $0x1,%esi
+      cd:	83 fe 06             	cmp    $0x6,%esi
+      d0:	0f 85 51 ff ff ff    	jne    27 <main+0x27>
+        exit();
+      d6:	e8 e5 03 00 00       	call   4c0 <exit>
+  rounds = argc > 1 ? atoi(argv[1]) : 1000;
+      db:	83 ec 0c             	sub    $0xc,%esp
+      de:	ff 70 04             	push   0x4(%eax)
+      e1:	e8 3a 07 00 00       	call   820 <atoi>
+  if(rounds <= 0)
+      e6:	ba 01 00 00 00       	mov    $0x1,%edx
+      eb:	85 c0                	test   %eax,%eax
+      ed:	0f 4f d0             	cmovg  %eax,%edx
+      f0:	83 c4 10             	add    $0x10,%esp
+      f3:	89 d7                	mov    %edx,%edi
+      f5:	e9 2b ff ff ff       	jmp    25 <main+0x25>
+      fa:	66 90                	xchg   %ax,%ax
+      fc:	66 90                	xchg   %ax,%ax
+      fe:	66 90                	xchg   %ax,%ax
+
+00000100 <spawnidle>:
+{
+     100:	55                   	push   %ebp
+     101:	89 e5                	mov    %esp,%ebp
+     103:	53                   	push   %ebx
+     104:	83 ec 20             	sub    $0x20,%esp
+     107:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(pipe(fd) < 0 || pipe(ready) < 0){
+     10a:	53                   	push   %ebx
+     10b:	e8 cf 07 00 00       	call   8df <pipe>
+     110:	83 c4 10             	add    $0x10,%esp
+     113:	85 c0                	test   %eax,%eax
+     115:	0f 88 f3 00 00 00    	js     20e <spawnidle+0x10e>
+     11b:	83 ec 0c             	sub    $0xc,%esp
+     11e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     121:	50                   	push   %eax
+     122:	e8 b8 07 00 00       	call   8df <pipe>
+     127:	83 c4 10             	add    $0x10,%esp
+     12a:	85 c0                	test   %eax,%eax
+     12c:	0f 88 dc 00 00 00    	js     20e <spawnidle+0x10e>
+  if((pid = fork()) < 0){
+     132:	e8 39 03 00 00       	call   470 <fork>
+     137:	85 c0                	test   %eax,%eax
+     139:	0f 88 bc 00 00 00    	js     1fb <spawnidle+0xfb>
+  if(pid == 0){
+     13f:	75 5f                	jne    1a0 <spawnidle+0xa0>
+    close(fd[1]);
+     141:	83 ec 0c             	sub    $0xc,%esp
+     144:	ff 73 04             	push   0x4(%ebx)
+     147:	e8 e4 03 00 00       	call   530 <close>
+    for(i = 0; i < n; i++){
+     14c:	8b 55 08             	mov    0x8(%ebp),%edx
+     14f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+     156:	83 c4 10             	add    $0x10,%esp
+     159:	85 d2                	test   %edx,%edx
+     15b:	7f 17                	jg     174 <spawnidle+0x74>
+     15d:	eb 1e                	jmp    17d <spawnidle+0x7d>
+     15f:	90                   	nop
+      if(pid == 0){
+     160:	0f 84 80 00 00 00    	je     1e6 <spawnidle+0xe6>
+    for(i = 0; i < n; i++){
+     166:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     169:	83 c0 01             	add    $0x1,%eax
+     16c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     16f:	3b 45 08             	cmp    0x8(%ebp),%eax
+     172:	7d 09                	jge    17d <spawnidle+0x7d>
+      if((pid = fork()) < 0)
+     174:	e8 f7 02 00 00       	call   470 <fork>
+     179:	85 c0                	test   %eax,%eax
+     17b:	79 e3                	jns    160 <spawnidle+0x60>
+    write(ready[1], &i, sizeof(i));
+     17d:	83 ec 04             	sub    $0x4,%esp
+     180:	8d 45 ec             	lea    -0x14(%ebp),%eax
+     183:	6a 04                	push   $0x4
+     185:	50                   	push   %eax
+     186:	ff 75 f4             	push   -0xc(%ebp)
+     189:	e8 5f 07 00 00       	call   8ed <write>
+    while(wait() >= 0)
+     18e:	83 c4 10             	add    $0x10,%esp
+     191:	e8 42 07 00 00       	call   8d8 <wait>
+     196:	85 c0                	test   %eax,%eax
+     198:	79 f7                	jns    191 <spawnidle+0x91>
+    exit();
+     19a:	e8 21 03 00 00       	call   4c0 <exit>
+     19f:	90                   	nop
+  close(fd[0]);
+     1a0:	83 ec 0c             	sub    $0xc,%esp
+     1a3:	ff 33                	push   (%ebx)
+     1a5:	e8 86 03 00 00       	call   530 <close>
+  close(ready[1]);
+     1aa:	58                   	pop    %eax
+     1ab:	ff 75 f4             	push   -0xc(%ebp)
+     1ae:	e8 7d 03 00 00       	call   530 <close>
+  if(read(ready[0], &n, sizeof(n)) != sizeof(n))
+     1b3:	83 c4 0c             	add    $0xc,%esp
+     1b6:	8d 45 08             	lea    0x8(%ebp),%eax
+     1b9:	6a 04                	push   $0x4
+     1bb:	50                   	push   %eax
+     1bc:	ff 75 f0             	push   -0x10(%ebp)
+     1bf:	e8 22 07 00 00       	call   8e6 <read>
+     1c4:	83 c4 10             	add    $0x10,%esp
+     1c7:	83 f8 04             	cmp    $0x4,%eax
+     1ca:	74 07                	je     1d3 <spawnidle+0xd3>
+    n = 0;
+     1cc:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+  close(ready[0]);
+     1d3:	83 ec 0c             	sub    $0xc,%esp
+     1d6:	ff 75 f0             	push   -0x10(%ebp)
+     1d9:	e8 52 03 00 00       	call   530 <close>
+}
+     1de:	8b 45 08             	mov    0x8(%ebp),%eax
+     1e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1e4:	c9                   	leave
+     1e5:	c3                   	ret
+        read(fd[0], &c, 1);
+     1e6:	83 ec 04             	sub    $0x4,%esp
+     1e9:	8d 45 eb             	lea    -0x15(%ebp),%eax
+     1ec:	6a 01                	push   $0x1
+     1ee:	50                   	push   %eax
+     1ef:	ff 33                	push   (%ebx)
+     1f1:	e8 f0 06 00 00       	call   8e6 <read>
+        exit();
+     1f6:	e8 c5 02 00 00       	call   4c0 <exit>
+    printf(2, "forkbench: fork failed\n");
+     1fb:	51                   	push   %ecx
+     1fc:	51                   	push   %ecx
+     1fd:	68 38 10 00 00       	push   $0x1038
+     202:	6a 02                	push   $0x2
+     204:	e8 67 09 00 00       	call   b70 <printf>
+    exit();
+     209:	e8 b2 02 00 00       	call   4c0 <exit>
+    printf(2, "forkbench: pipe failed\n");
+     20e:	53                   	push   %ebx
+     20f:	53                   	push   %ebx
+     210:	68 20 10 00 00       	push   $0x1020
+     215:	6a 02                	push   $0x2
+     217:	e8 54 09 00 00       	call   b70 <printf>
+    exit();
+     21c:	e8 9f 02 00 00       	call   4c0 <exit>
+     221:	66 90                	xchg   %ax,%ax
+     223:	66 90                	xchg   %ax,%ax
+     225:	66 90                	xchg   %ax,%ax
+     227:	66 90                	xchg   %ax,%ax
+     229:	66 90                	xchg   %ax,%ax
+     22b:	66 90                	xchg   %ax,%ax
+     22d:	66 90                	xchg   %ax,%ax
+     22f:	90                   	nop
+
+00000230 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+     230:	55                   	push   %ebp
+     231:	89 e5                	mov    %esp,%ebp
+     233:	57                   	push   %edi
+     234:	56                   	push   %esi
+     235:	53                   	push   %ebx
+     236:	83 ec 4c             	sub    $0x4c,%esp
+     239:	8b 45 0c             	mov    0xc(%ebp),%eax
+     23c:	8b 55 08             	mov    0x8(%ebp),%edx
+     23f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     242:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+     245:	83 fa 0f             	cmp    $0xf,%edx
+     248:	0f 87 32 01 00 00    	ja     380 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+     24e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     254:	8b 80 c0 15 00 00    	mov    0x15c0(%eax),%eax
+     25a:	85 c0                	test   %eax,%eax
+     25c:	0f 84 de 00 00 00    	je     340 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+     262:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     268:	8b b0 c4 15 00 00    	mov    0x15c4(%eax),%esi
+     26e:	8d 88 c0 15 00 00    	lea    0x15c0(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+     274:	8d b8 c8 15 00 00    	lea    0x15c8(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+     27a:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+     27d:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+     280:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+     283:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+     289:	0f 8f 01 01 00 00    	jg     390 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+     28f:	8d 78 08             	lea    0x8(%eax),%edi
+     292:	8d bc 3e c0 15 00 00 	lea    0x15c0(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     299:	85 db                	test   %ebx,%ebx
+     29b:	7e 3b                	jle    2d8 <bufwrite+0xa8>
+     29d:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+     2a0:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+     2a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2a7:	90                   	nop
+    *dst++ = *src++;
+     2a8:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     2a9:	39 c6                	cmp    %eax,%esi
+     2ab:	75 fb                	jne    2a8 <bufwrite+0x78>
+  ob[fd].n += n;
+     2ad:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     2b3:	8b 88 c4 15 00 00    	mov    0x15c4(%eax),%ecx
+     2b9:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     2bb:	83 b8 c0 15 00 00 01 	cmpl   $0x1,0x15c0(%eax)
+  ob[fd].n += n;
+     2c2:	89 88 c4 15 00 00    	mov    %ecx,0x15c4(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     2c8:	74 26                	je     2f0 <bufwrite+0xc0>
+}
+     2ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     2cd:	5b                   	pop    %ebx
+     2ce:	5e                   	pop    %esi
+     2cf:	5f                   	pop    %edi
+     2d0:	5d                   	pop    %ebp
+     2d1:	c3                   	ret
+     2d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+     2d8:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     2db:	83 b8 c0 15 00 00 01 	cmpl   $0x1,0x15c0(%eax)
+  ob[fd].n += n;
+     2e2:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     2e5:	75 e3                	jne    2ca <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+     2e7:	85 db                	test   %ebx,%ebx
+     2e9:	74 df                	je     2ca <bufwrite+0x9a>
+     2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2ef:	90                   	nop
+  src = vsrc;
+     2f0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     2f3:	01 c3                	add    %eax,%ebx
+     2f5:	eb 10                	jmp    307 <bufwrite+0xd7>
+     2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2fe:	66 90                	xchg   %ax,%ax
+     300:	83 c0 01             	add    $0x1,%eax
+     303:	39 d8                	cmp    %ebx,%eax
+     305:	74 c3                	je     2ca <bufwrite+0x9a>
+    if(*p == (char)c)
+     307:	80 38 0a             	cmpb   $0xa,(%eax)
+     30a:	75 f4                	jne    300 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     30c:	85 c9                	test   %ecx,%ecx
+     30e:	7e ba                	jle    2ca <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+     310:	83 ec 04             	sub    $0x4,%esp
+     313:	51                   	push   %ecx
+     314:	ff 75 ac             	push   -0x54(%ebp)
+     317:	52                   	push   %edx
+     318:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+     31b:	e8 cd 05 00 00       	call   8ed <write>
+    ob[fd].n = 0;
+     320:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     323:	83 c4 10             	add    $0x10,%esp
+     326:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+     32c:	c7 82 c4 15 00 00 00 	movl   $0x0,0x15c4(%edx)
+     333:	00 00 00 
+     336:	eb 92                	jmp    2ca <bufwrite+0x9a>
+     338:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     33f:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     340:	83 ec 08             	sub    $0x8,%esp
+     343:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     346:	50                   	push   %eax
+     347:	52                   	push   %edx
+     348:	89 55 b0             	mov    %edx,-0x50(%ebp)
+     34b:	e8 d7 05 00 00       	call   927 <fstat>
+     350:	83 c4 10             	add    $0x10,%esp
+     353:	8b 55 b0             	mov    -0x50(%ebp),%edx
+     356:	89 c1                	mov    %eax,%ecx
+     358:	b8 02 00 00 00       	mov    $0x2,%eax
+     35d:	85 c9                	test   %ecx,%ecx
+     35f:	75 0d                	jne    36e <bufwrite+0x13e>
+     361:	31 c0                	xor    %eax,%eax
+     363:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     368:	0f 95 c0             	setne  %al
+     36b:	83 c0 01             	add    $0x1,%eax
+     36e:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+     374:	89 81 c0 15 00 00    	mov    %eax,0x15c0(%ecx)
+     37a:	e9 e3 fe ff ff       	jmp    262 <bufwrite+0x32>
+     37f:	90                   	nop
+}
+     380:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     383:	5b                   	pop    %ebx
+     384:	5e                   	pop    %esi
+     385:	5f                   	pop    %edi
+     386:	5d                   	pop    %ebp
+    write(fd, p, n);
+     387:	e9 61 05 00 00       	jmp    8ed <write>
+     38c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+     390:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+     393:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+     396:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+     399:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+     39c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+     39f:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+     3a2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+     3a5:	6a 02                	push   $0x2
+     3a7:	50                   	push   %eax
+     3a8:	52                   	push   %edx
+     3a9:	e8 9b 06 00 00       	call   a49 <writev>
+    ob[fd].n = 0;
+     3ae:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+     3b1:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+     3b4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+     3bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     3be:	5b                   	pop    %ebx
+     3bf:	5e                   	pop    %esi
+     3c0:	5f                   	pop    %edi
+     3c1:	5d                   	pop    %ebp
+     3c2:	c3                   	ret
+     3c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003d0 <fflush>:
+{
+     3d0:	55                   	push   %ebp
+     3d1:	89 e5                	mov    %esp,%ebp
+     3d3:	53                   	push   %ebx
+     3d4:	83 ec 04             	sub    $0x4,%esp
+     3d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     3da:	83 f8 0f             	cmp    $0xf,%eax
+     3dd:	77 16                	ja     3f5 <fflush+0x25>
+     3df:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+     3e5:	8b 8a c4 15 00 00    	mov    0x15c4(%edx),%ecx
+     3eb:	8d 9a c0 15 00 00    	lea    0x15c0(%edx),%ebx
+     3f1:	85 c9                	test   %ecx,%ecx
+     3f3:	7f 0b                	jg     400 <fflush+0x30>
+}
+     3f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3f8:	c9                   	leave
+     3f9:	c3                   	ret
+     3fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     400:	83 ec 04             	sub    $0x4,%esp
+     403:	81 c2 c8 15 00 00    	add    $0x15c8,%edx
+     409:	51                   	push   %ecx
+     40a:	52                   	push   %edx
+     40b:	50                   	push   %eax
+     40c:	e8 dc 04 00 00       	call   8ed <write>
+    ob[fd].n = 0;
+     411:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     418:	83 c4 10             	add    $0x10,%esp
+}
+     41b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     41e:	c9                   	leave
+     41f:	c3                   	ret
+
+00000420 <fflushall>:
+{
+     420:	55                   	push   %ebp
+     421:	89 e5                	mov    %esp,%ebp
+     423:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     424:	31 f6                	xor    %esi,%esi
+{
+     426:	53                   	push   %ebx
+     427:	bb c8 15 00 00       	mov    $0x15c8,%ebx
+     42c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     430:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     433:	85 c0                	test   %eax,%eax
+     435:	7e 15                	jle    44c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     437:	83 ec 04             	sub    $0x4,%esp
+     43a:	50                   	push   %eax
+     43b:	53                   	push   %ebx
+     43c:	56                   	push   %esi
+     43d:	e8 ab 04 00 00       	call   8ed <write>
+    ob[fd].n = 0;
+     442:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     449:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     44c:	83 c6 01             	add    $0x1,%esi
+     44f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     455:	83 fe 10             	cmp    $0x10,%esi
+     458:	75 d6                	jne    430 <fflushall+0x10>
+}
+     45a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     45d:	5b                   	pop    %ebx
+     45e:	5e                   	pop    %esi
+     45f:	5d                   	pop    %ebp
+     460:	c3                   	ret
+     461:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     468:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     46f:	90                   	nop
+
+00000470 <fork>:
+{
+     470:	55                   	push   %ebp
+     471:	89 e5                	mov    %esp,%ebp
+     473:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     474:	31 f6                	xor    %esi,%esi
+{
+     476:	53                   	push   %ebx
+     477:	bb c8 15 00 00       	mov    $0x15c8,%ebx
+     47c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     480:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     483:	85 c0                	test   %eax,%eax
+     485:	7e 15                	jle    49c <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     487:	83 ec 04             	sub    $0x4,%esp
+     48a:	50                   	push   %eax
+     48b:	53                   	push   %ebx
+     48c:	56                   	push   %esi
+     48d:	e8 5b 04 00 00       	call   8ed <write>
+    ob[fd].n = 0;
+     492:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     499:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     49c:	83 c6 01             	add    $0x1,%esi
+     49f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     4a5:	83 fe 10             	cmp    $0x10,%esi
+     4a8:	75 d6                	jne    480 <fork+0x10>
+}
+     4aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4ad:	5b                   	pop    %ebx
+     4ae:	5e                   	pop    %esi
+     4af:	5d                   	pop    %ebp
+  return _fork();
+     4b0:	e9 15 04 00 00       	jmp    8ca <_fork>
+     4b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <exit>:
+{
+     4c0:	55                   	push   %ebp
+     4c1:	89 e5                	mov    %esp,%ebp
+     4c3:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+     4c6:	e8 55 ff ff ff       	call   420 <fflushall>
+  _exit();
+     4cb:	e8 01 04 00 00       	call   8d1 <_exit>
+
+000004d0 <exec>:
+{
+     4d0:	55                   	push   %ebp
+     4d1:	89 e5                	mov    %esp,%ebp
+     4d3:	57                   	push   %edi
+     4d4:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     4d5:	31 f6                	xor    %esi,%esi
+{
+     4d7:	53                   	push   %ebx
+     4d8:	bb c8 15 00 00       	mov    $0x15c8,%ebx
+     4dd:	83 ec 1c             	sub    $0x1c,%esp
+     4e0:	8b 45 08             	mov    0x8(%ebp),%eax
+     4e3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     4e6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     4e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     4f0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     4f3:	85 c0                	test   %eax,%eax
+     4f5:	7e 15                	jle    50c <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     4f7:	83 ec 04             	sub    $0x4,%esp
+     4fa:	50                   	push   %eax
+     4fb:	53                   	push   %ebx
+     4fc:	56                   	push   %esi
+     4fd:	e8 eb 03 00 00       	call   8ed <write>
+    ob[fd].n = 0;
+     502:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     509:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     50c:	83 c6 01             	add    $0x1,%esi
+     50f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     515:	83 fe 10             	cmp    $0x10,%esi
+     518:	75 d6                	jne    4f0 <exec+0x20>
+  return _exec(path, argv);
+     51a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     51d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+     520:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     523:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     526:	5b                   	pop    %ebx
+     527:	5e                   	pop    %esi
+     528:	5f                   	pop    %edi
+     529:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     52a:	e9 d3 03 00 00       	jmp    902 <_exec>
+     52f:	90                   	nop
+
+00000530 <close>:
+{
+     530:	55                   	push   %ebp
+     531:	89 e5                	mov    %esp,%ebp
+     533:	56                   	push   %esi
+     534:	53                   	push   %ebx
+     535:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     538:	83 fb 0f             	cmp    $0xf,%ebx
+     53b:	77 26                	ja     563 <close+0x33>
+     53d:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     543:	8b 90 c4 15 00 00    	mov    0x15c4(%eax),%edx
+     549:	8d b0 c0 15 00 00    	lea    0x15c0(%eax),%esi
+     54f:	85 d2                	test   %edx,%edx
+     551:	7f 25                	jg     578 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+     553:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     559:	c7 80 c0 15 00 00 00 	movl   $0x0,0x15c0(%eax)
+     560:	00 00 00 
+  return _close(fd);
+     563:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     566:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     569:	5b                   	pop    %ebx
+     56a:	5e                   	pop    %esi
+     56b:	5d                   	pop    %ebp
+  return _close(fd);
+     56c:	e9 83 03 00 00       	jmp    8f4 <_close>
+     571:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     578:	83 ec 04             	sub    $0x4,%esp
+     57b:	05 c8 15 00 00       	add    $0x15c8,%eax
+     580:	52                   	push   %edx
+     581:	50                   	push   %eax
+     582:	53                   	push   %ebx
+     583:	e8 65 03 00 00       	call   8ed <write>
+    ob[fd].n = 0;
+     588:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+     58f:	83 c4 10             	add    $0x10,%esp
+     592:	eb bf                	jmp    553 <close+0x23>
+     594:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     59b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     59f:	90                   	nop
+
+000005a0 <strcpy>:
+{
+     5a0:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+     5a1:	31 c0                	xor    %eax,%eax
+{
+     5a3:	89 e5                	mov    %esp,%ebp
+     5a5:	53                   	push   %ebx
+     5a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     5a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     5ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     5b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     5b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     5b7:	83 c0 01             	add    $0x1,%eax
+     5ba:	84 d2                	test   %dl,%dl
+     5bc:	75 f2                	jne    5b0 <strcpy+0x10>
+}
+     5be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5c1:	89 c8                	mov    %ecx,%eax
+     5c3:	c9                   	leave
+     5c4:	c3                   	ret
+     5c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005d0 <strcmp>:
+{
+     5d0:	55                   	push   %ebp
+     5d1:	89 e5                	mov    %esp,%ebp
+     5d3:	53                   	push   %ebx
+     5d4:	8b 55 08             	mov    0x8(%ebp),%edx
+     5d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     5da:	0f b6 02             	movzbl (%edx),%eax
+     5dd:	84 c0                	test   %al,%al
+     5df:	75 17                	jne    5f8 <strcmp+0x28>
+     5e1:	eb 3a                	jmp    61d <strcmp+0x4d>
+     5e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5e7:	90                   	nop
+     5e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     5ec:	83 c2 01             	add    $0x1,%edx
+     5ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     5f2:	84 c0                	test   %al,%al
+     5f4:	74 1a                	je     610 <strcmp+0x40>
+    p++, q++;
+     5f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     5f8:	0f b6 19             	movzbl (%ecx),%ebx
+     5fb:	38 c3                	cmp    %al,%bl
+     5fd:	74 e9                	je     5e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     5ff:	29 d8                	sub    %ebx,%eax
+}
+     601:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     604:	c9                   	leave
+     605:	c3                   	ret
+     606:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     60d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     610:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     614:	31 c0                	xor    %eax,%eax
+     616:	29 d8                	sub    %ebx,%eax
+}
+     618:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     61b:	c9                   	leave
+     61c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     61d:	0f b6 19             	movzbl (%ecx),%ebx
+     620:	31 c0                	xor    %eax,%eax
+     622:	eb db                	jmp    5ff <strcmp+0x2f>
+     624:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     62b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     62f:	90                   	nop
+
+00000630 <strlen>:
+{
+     630:	55                   	push   %ebp
+     631:	89 e5                	mov    %esp,%ebp
+     633:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+     636:	80 3a 00             	cmpb   $0x0,(%edx)
+     639:	74 15                	je     650 <strlen+0x20>
+     63b:	31 c0                	xor    %eax,%eax
+     63d:	8d 76 00             	lea    0x0(%esi),%esi
+     640:	83 c0 01             	add    $0x1,%eax
+     643:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     647:	89 c1                	mov    %eax,%ecx
+     649:	75 f5                	jne    640 <strlen+0x10>
+}
+     64b:	89 c8                	mov    %ecx,%eax
+     64d:	5d                   	pop    %ebp
+     64e:	c3                   	ret
+     64f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     650:	31 c9                	xor    %ecx,%ecx
+}
+     652:	5d                   	pop    %ebp
+     653:	89 c8                	mov    %ecx,%eax
+     655:	c3                   	ret
+     656:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     65d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000660 <memset>:
+{
+     660:	55                   	push   %ebp
+     661:	89 e5                	mov    %esp,%ebp
+     663:	57                   	push   %edi
+     664:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("cld; rep stosb" :
+     667:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     66a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     66d:	89 d7                	mov    %edx,%edi
+     66f:	fc                   	cld
+     670:	f3 aa                	rep stos %al,%es:(%edi)
+}
+     672:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     675:	89 d0                	mov    %edx,%eax
+     677:	c9                   	leave
+     678:	c3                   	ret
+     679:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000680 <strchr>:
+{
+     680:	55                   	push   %ebp
+     681:	89 e5                	mov    %esp,%ebp
+     683:	8b 45 08             	mov    0x8(%ebp),%eax
+     686:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     68a:	0f b6 10             	movzbl (%eax),%edx
+     68d:	84 d2                	test   %dl,%dl
+     68f:	75 12                	jne    6a3 <strchr+0x23>
+     691:	eb 1d                	jmp    6b0 <strchr+0x30>
+     693:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     697:	90                   	nop
+     698:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     69c:	83 c0 01             	add    $0x1,%eax
+     69f:	84 d2                	test   %dl,%dl
+     6a1:	74 0d                	je     6b0 <strchr+0x30>
+    if(*s == c)
+     6a3:	38 d1                	cmp    %dl,%cl
+     6a5:	75 f1                	jne    698 <strchr+0x18>
+}
+     6a7:	5d                   	pop    %ebp
+     6a8:	c3                   	ret
+     6a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     6b0:	31 c0                	xor    %eax,%eax
+}
+     6b2:	5d                   	pop    %ebp
+     6b3:	c3                   	ret
+     6b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6bf:	90                   	nop
+
+000006c0 <memchr>:
+{
+     6c0:	55                   	push   %ebp
+     6c1:	89 e5                	mov    %esp,%ebp
+     6c3:	8b 55 10             	mov    0x10(%ebp),%edx
+     6c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     6c9:	85 d2                	test   %edx,%edx
+     6cb:	74 1b                	je     6e8 <memchr+0x28>
+    if(*p == (char)c)
+     6cd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+     6d1:	01 c2                	add    %eax,%edx
+     6d3:	eb 0a                	jmp    6df <memchr+0x1f>
+     6d5:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+     6d8:	83 c0 01             	add    $0x1,%eax
+     6db:	39 c2                	cmp    %eax,%edx
+     6dd:	74 09                	je     6e8 <memchr+0x28>
+    if(*p == (char)c)
+     6df:	38 08                	cmp    %cl,(%eax)
+     6e1:	75 f5                	jne    6d8 <memchr+0x18>
+}
+     6e3:	5d                   	pop    %ebp
+     6e4:	c3                   	ret
+     6e5:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+     6e8:	31 c0                	xor    %eax,%eax
+}
+     6ea:	5d                   	pop    %ebp
+     6eb:	c3                   	ret
+     6ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006f0 <gets>:
+{
+     6f0:	55                   	push   %ebp
+     6f1:	89 e5                	mov    %esp,%ebp
+     6f3:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+     6f4:	31 ff                	xor    %edi,%edi
+{
+     6f6:	56                   	push   %esi
+     6f7:	be c8 15 00 00       	mov    $0x15c8,%esi
+     6fc:	53                   	push   %ebx
+     6fd:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     700:	8b 46 fc             	mov    -0x4(%esi),%eax
+     703:	85 c0                	test   %eax,%eax
+     705:	7e 15                	jle    71c <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     707:	83 ec 04             	sub    $0x4,%esp
+     70a:	50                   	push   %eax
+     70b:	56                   	push   %esi
+     70c:	57                   	push   %edi
+     70d:	e8 db 01 00 00       	call   8ed <write>
+    ob[fd].n = 0;
+     712:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+     719:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     71c:	83 c7 01             	add    $0x1,%edi
+     71f:	81 c6 08 01 00 00    	add    $0x108,%esi
+     725:	83 ff 10             	cmp    $0x10,%edi
+     728:	75 d6                	jne    700 <gets+0x10>
+  for(i=0; i+1 < max; ){
+     72a:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+     72c:	8d 75 e7             	lea    -0x19(%ebp),%esi
+     72f:	eb 2e                	jmp    75f <gets+0x6f>
+     731:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     738:	83 ec 04             	sub    $0x4,%esp
+     73b:	6a 01                	push   $0x1
+     73d:	56                   	push   %esi
+     73e:	6a 00                	push   $0x0
+     740:	e8 a1 01 00 00       	call   8e6 <read>
+    if(cc < 1)
+     745:	83 c4 10             	add    $0x10,%esp
+     748:	85 c0                	test   %eax,%eax
+     74a:	7e 1d                	jle    769 <gets+0x79>
+    buf[i++] = c;
+     74c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     750:	8b 55 08             	mov    0x8(%ebp),%edx
+     753:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     757:	3c 0a                	cmp    $0xa,%al
+     759:	74 10                	je     76b <gets+0x7b>
+     75b:	3c 0d                	cmp    $0xd,%al
+     75d:	74 0c                	je     76b <gets+0x7b>
+  for(i=0; i+1 < max; ){
+     75f:	89 df                	mov    %ebx,%edi
+     761:	83 c3 01             	add    $0x1,%ebx
+     764:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     767:	7c cf                	jl     738 <gets+0x48>
+     769:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     76b:	8b 45 08             	mov    0x8(%ebp),%eax
+     76e:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     772:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     775:	5b                   	pop    %ebx
+     776:	5e                   	pop    %esi
+     777:	5f                   	pop    %edi
+     778:	5d                   	pop    %ebp
+     779:	c3                   	ret
+     77a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000780 <stat>:
+{
+     780:	55                   	push   %ebp
+     781:	89 e5                	mov    %esp,%ebp
+     783:	57                   	push   %edi
+     784:	56                   	push   %esi
+     785:	53                   	push   %ebx
+     786:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+     789:	6a 00                	push   $0x0
+     78b:	ff 75 08             	push   0x8(%ebp)
+     78e:	e8 76 01 00 00       	call   909 <open>
+  if(fd < 0)
+     793:	83 c4 10             	add    $0x10,%esp
+     796:	85 c0                	test   %eax,%eax
+     798:	78 76                	js     810 <stat+0x90>
+  r = fstat(fd, st);
+     79a:	83 ec 08             	sub    $0x8,%esp
+     79d:	ff 75 0c             	push   0xc(%ebp)
+     7a0:	89 c3                	mov    %eax,%ebx
+     7a2:	50                   	push   %eax
+     7a3:	e8 7f 01 00 00       	call   927 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     7a8:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     7ab:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     7ad:	83 fb 0f             	cmp    $0xf,%ebx
+     7b0:	7f 40                	jg     7f2 <stat+0x72>
+     7b2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     7b8:	8b 90 c4 15 00 00    	mov    0x15c4(%eax),%edx
+     7be:	8d b8 c0 15 00 00    	lea    0x15c0(%eax),%edi
+     7c4:	85 d2                	test   %edx,%edx
+     7c6:	7e 1a                	jle    7e2 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+     7c8:	83 ec 04             	sub    $0x4,%esp
+     7cb:	05 c8 15 00 00       	add    $0x15c8,%eax
+     7d0:	52                   	push   %edx
+     7d1:	50                   	push   %eax
+     7d2:	53                   	push   %ebx
+     7d3:	e8 15 01 00 00       	call   8ed <write>
+    ob[fd].n = 0;
+     7d8:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+     7df:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+     7e2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     7e8:	c7 80 c0 15 00 00 00 	movl   $0x0,0x15c0(%eax)
+     7ef:	00 00 00 
+  return _close(fd);
+     7f2:	83 ec 0c             	sub    $0xc,%esp
+     7f5:	53                   	push   %ebx
+     7f6:	e8 f9 00 00 00       	call   8f4 <_close>
+     7fb:	83 c4 10             	add    $0x10,%esp
+}
+     7fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     801:	89 f0                	mov    %esi,%eax
+     803:	5b                   	pop    %ebx
+     804:	5e                   	pop    %esi
+     805:	5f                   	pop    %edi
+     806:	5d                   	pop    %ebp
+     807:	c3                   	ret
+     808:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     80f:	90                   	nop
+    return -1;
+     810:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     815:	eb e7                	jmp    7fe <stat+0x7e>
+     817:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     81e:	66 90                	xchg   %ax,%ax
+
+00000820 <atoi>:
+{
+     820:	55                   	push   %ebp
+     821:	89 e5                	mov    %esp,%ebp
+     823:	53                   	push   %ebx
+     824:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     827:	0f be 02             	movsbl (%edx),%eax
+     82a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     82d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     830:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     835:	77 1e                	ja     855 <atoi+0x35>
+     837:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     83e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     840:	83 c2 01             	add    $0x1,%edx
+     843:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     846:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     84a:	0f be 02             	movsbl (%edx),%eax
+     84d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     850:	80 fb 09             	cmp    $0x9,%bl
+     853:	76 eb                	jbe    840 <atoi+0x20>
+}
+     855:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     858:	89 c8                	mov    %ecx,%eax
+     85a:	c9                   	leave
+     85b:	c3                   	ret
+     85c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000860 <memmove>:
+{
+     860:	55                   	push   %ebp
+     861:	89 e5                	mov    %esp,%ebp
+     863:	57                   	push   %edi
+     864:	56                   	push   %esi
+     865:	8b 45 10             	mov    0x10(%ebp),%eax
+     868:	8b 55 08             	mov    0x8(%ebp),%edx
+     86b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     86e:	85 c0                	test   %eax,%eax
+     870:	7e 13                	jle    885 <memmove+0x25>
+     872:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     874:	89 d7                	mov    %edx,%edi
+     876:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     87d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     880:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     881:	39 f8                	cmp    %edi,%eax
+     883:	75 fb                	jne    880 <memmove+0x20>
+  return vdst;
+}
+     885:	5e                   	pop    %esi
+     886:	89 d0                	mov    %edx,%eax
+     888:	5f                   	pop    %edi
+     889:	5d                   	pop    %ebp
+     88a:	c3                   	ret
+
+0000088b <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+     88b:	83 3d b4 15 00 00 00 	cmpl   $0x0,0x15b4
+  jle 1f
+     892:	7e 0a                	jle    89e <syscallentry+0x13>
+  movl %esp, %ecx
+     894:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+     896:	ba 9d 08 00 00       	mov    $0x89d,%edx
+  sysenter
+     89b:	0f 34                	sysenter
+2:
+  ret
+     89d:	c3                   	ret
+1:
+  jl 3f
+     89e:	7c 27                	jl     8c7 <syscallentry+0x3c>
+  pushal
+     8a0:	60                   	pusha
+  movl $1, %eax
+     8a1:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     8a6:	0f a2                	cpuid
+  movl $-1, sysentermode
+     8a8:	c7 05 b4 15 00 00 ff 	movl   $0xffffffff,0x15b4
+     8af:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     8b2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+     8b8:	74 0a                	je     8c4 <syscallentry+0x39>
+  movl $1, sysentermode
+     8ba:	c7 05 b4 15 00 00 01 	movl   $0x1,0x15b4
+     8c1:	00 00 00 
+4:
+  popal
+     8c4:	61                   	popa
+  jmp syscallentry
+     8c5:	eb c4                	jmp    88b <syscallentry>
+3:
+  int $T_SYSCALL
+     8c7:	cd 40                	int    $0x40
+  ret
+     8c9:	c3                   	ret
+
+000008ca <_fork>:
+
+SYSCALLAS(_fork, fork)
+     8ca:	b8 01 00 00 00       	mov    $0x1,%eax
+     8cf:	eb ba                	jmp    88b <syscallentry>
+
+000008d1 <_exit>:
+SYSCALLAS(_exit, exit)
+     8d1:	b8 02 00 00 00       	mov    $0x2,%eax
+     8d6:	eb b3                	jmp    88b <syscallentry>
+
+000008d8 <wait>:
+SYSCALL(wait)
+     8d8:	b8 03 00 00 00       	mov    $0x3,%eax
+     8dd:	eb ac                	jmp    88b <syscallentry>
+
+000008df <pipe>:
+SYSCALL(pipe)
+     8df:	b8 04 00 00 00       	mov    $0x4,%eax
+     8e4:	eb a5                	jmp    88b <syscallentry>
+
+000008e6 <read>:
+SYSCALL(read)
+     8e6:	b8 05 00 00 00       	mov    $0x5,%eax
+     8eb:	eb 9e                	jmp    88b <syscallentry>
+
+000008ed <write>:
+SYSCALL(write)
+     8ed:	b8 10 00 00 00       	mov    $0x10,%eax
+     8f2:	eb 97                	jmp    88b <syscallentry>
+
+000008f4 <_close>:
+SYSCALLAS(_close, close)
+     8f4:	b8 15 00 00 00       	mov    $0x15,%eax
+     8f9:	eb 90                	jmp    88b <syscallentry>
+
+000008fb <kill>:
+SYSCALL(kill)
+     8fb:	b8 06 00 00 00       	mov    $0x6,%eax
+     900:	eb 89                	jmp    88b <syscallentry>
+
+00000902 <_exec>:
+SYSCALLAS(_exec, exec)
+     902:	b8 07 00 00 00       	mov    $0x7,%eax
+     907:	eb 82                	jmp    88b <syscallentry>
+
+00000909 <open>:
+SYSCALL(open)
+     909:	b8 0f 00 00 00       	mov    $0xf,%eax
+     90e:	e9 78 ff ff ff       	jmp    88b <syscallentry>
+
+00000913 <mknod>:
+SYSCALL(mknod)
+     913:	b8 11 00 00 00       	mov    $0x11,%eax
+     918:	e9 6e ff ff ff       	jmp    88b <syscallentry>
+
+0000091d <unlink>:
+SYSCALL(unlink)
+     91d:	b8 12 00 00 00       	mov    $0x12,%eax
+     922:	e9 64 ff ff ff       	jmp    88b <syscallentry>
+
+00000927 <fstat>:
+SYSCALL(fstat)
+     927:	b8 08 00 00 00       	mov    $0x8,%eax
+     92c:	e9 5a ff ff ff       	jmp    88b <syscallentry>
+
+00000931 <link>:
+SYSCALL(link)
+     931:	b8 13 00 00 00       	mov    $0x13,%eax
+     936:	e9 50 ff ff ff       	jmp    88b <syscallentry>
+
+0000093b <mkdir>:
+SYSCALL(mkdir)
+     93b:	b8 14 00 00 00       	mov    $0x14,%eax
+     940:	e9 46 ff ff ff       	jmp    88b <syscallentry>
+
+00000945 <chdir>:
+SYSCALL(chdir)
+     945:	b8 09 00 00 00       	mov    $0x9,%eax
+     94a:	e9 3c ff ff ff       	jmp    88b <syscallentry>
+
+0000094f <dup>:
+SYSCALL(dup)
+     94f:	b8 0a 00 00 00       	mov    $0xa,%eax
+     954:	e9 32 ff ff ff       	jmp    88b <syscallentry>
+
+00000959 <getpid>:
+SYSCALL(getpid)
+     959:	b8 0b 00 00 00       	mov    $0xb,%eax
+     95e:	e9 28 ff ff ff       	jmp    88b <syscallentry>
+
+00000963 <sbrk>:
+SYSCALL(sbrk)
+     963:	b8 0c 00 00 00       	mov    $0xc,%eax
+     968:	e9 1e ff ff ff       	jmp    88b <syscallentry>
+
+0000096d <sleep>:
+SYSCALL(sleep)
+     96d:	b8 0d 00 00 00       	mov    $0xd,%eax
+     972:	e9 14 ff ff ff       	jmp    88b <syscallentry>
+
+00000977 <uptime>:
+SYSCALL(uptime)
+     977:	b8 0e 00 00 00       	mov    $0xe,%eax
+     97c:	e9 0a ff ff ff       	jmp    88b <syscallentry>
+
+00000981 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+     981:	b8 16 00 00 00       	mov    $0x16,%eax
+     986:	e9 00 ff ff ff       	jmp    88b <syscallentry>
+
+0000098b <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+     98b:	b8 17 00 00 00       	mov    $0x17,%eax
+     990:	e9 f6 fe ff ff       	jmp    88b <syscallentry>
+
+00000995 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+     995:	b8 18 00 00 00       	mov    $0x18,%eax
+     99a:	e9 ec fe ff ff       	jmp    88b <syscallentry>
+
+0000099f <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+     99f:	b8 19 00 00 00       	mov    $0x19,%eax
+     9a4:	e9 e2 fe ff ff       	jmp    88b <syscallentry>
+
+000009a9 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+     9a9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     9ae:	e9 d8 fe ff ff       	jmp    88b <syscallentry>
+
+000009b3 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+     9b3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     9b8:	e9 ce fe ff ff       	jmp    88b <syscallentry>
+
+000009bd <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+     9bd:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     9c2:	e9 c4 fe ff ff       	jmp    88b <syscallentry>
+
+000009c7 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+     9c7:	b8 20 00 00 00       	mov    $0x20,%eax
+     9cc:	e9 ba fe ff ff       	jmp    88b <syscallentry>
+
+000009d1 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+     9d1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     9d6:	e9 b0 fe ff ff       	jmp    88b <syscallentry>
+
+000009db <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+     9db:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     9e0:	e9 a6 fe ff ff       	jmp    88b <syscallentry>
+
+000009e5 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+     9e5:	b8 21 00 00 00       	mov    $0x21,%eax
+     9ea:	e9 9c fe ff ff       	jmp    88b <syscallentry>
+
+000009ef <yield>:
+SYSCALL(yield) // yield the CPU to another process
+     9ef:	b8 22 00 00 00       	mov    $0x22,%eax
+     9f4:	e9 92 fe ff ff       	jmp    88b <syscallentry>
+
+000009f9 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+     9f9:	b8 23 00 00 00       	mov    $0x23,%eax
+     9fe:	e9 88 fe ff ff       	jmp    88b <syscallentry>
+
+00000a03 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+     a03:	b8 24 00 00 00       	mov    $0x24,%eax
+     a08:	e9 7e fe ff ff       	jmp    88b <syscallentry>
+
+00000a0d <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+     a0d:	b8 25 00 00 00       	mov    $0x25,%eax
+     a12:	e9 74 fe ff ff       	jmp    88b <syscallentry>
+
+00000a17 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+     a17:	b8 26 00 00 00       	mov    $0x26,%eax
+     a1c:	e9 6a fe ff ff       	jmp    88b <syscallentry>
+
+00000a21 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+     a21:	b8 27 00 00 00       	mov    $0x27,%eax
+     a26:	e9 60 fe ff ff       	jmp    88b <syscallentry>
+
+00000a2b <mmap>:
+SYSCALL(mmap) // map a file into memory
+     a2b:	b8 28 00 00 00       	mov    $0x28,%eax
+     a30:	e9 56 fe ff ff       	jmp    88b <syscallentry>
+
+00000a35 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+     a35:	b8 29 00 00 00       	mov    $0x29,%eax
+     a3a:	e9 4c fe ff ff       	jmp    88b <syscallentry>
+
+00000a3f <readv>:
+SYSCALL(readv) // read into several buffers
+     a3f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     a44:	e9 42 fe ff ff       	jmp    88b <syscallentry>
+
+00000a49 <writev>:
+SYSCALL(writev) // write from several buffers
+     a49:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     a4e:	e9 38 fe ff ff       	jmp    88b <syscallentry>
+
+00000a53 <pread>:
+SYSCALL(pread) // read at an offset
+     a53:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     a58:	e9 2e fe ff ff       	jmp    88b <syscallentry>
+
+00000a5d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+     a5d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     a62:	e9 24 fe ff ff       	jmp    88b <syscallentry>
+
+00000a67 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+     a67:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     a6c:	e9 1a fe ff ff       	jmp    88b <syscallentry>
+
+00000a71 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+     a71:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     a76:	e9 10 fe ff ff       	jmp    88b <syscallentry>
+
+00000a7b <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+     a7b:	b8 30 00 00 00       	mov    $0x30,%eax
+     a80:	e9 06 fe ff ff       	jmp    88b <syscallentry>
+
+00000a85 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+     a85:	b8 31 00 00 00       	mov    $0x31,%eax
+     a8a:	e9 fc fd ff ff       	jmp    88b <syscallentry>
+
+00000a8f <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+     a8f:	b8 32 00 00 00       	mov    $0x32,%eax
+     a94:	e9 f2 fd ff ff       	jmp    88b <syscallentry>
+
+00000a99 <profread>:
+SYSCALL(profread) // drain profiler samples
+     a99:	b8 33 00 00 00       	mov    $0x33,%eax
+     a9e:	e9 e8 fd ff ff       	jmp    88b <syscallentry>
+
+00000aa3 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+     aa3:	b8 34 00 00 00       	mov    $0x34,%eax
+     aa8:	e9 de fd ff ff       	jmp    88b <syscallentry>
+
+00000aad <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+     aad:	b8 35 00 00 00       	mov    $0x35,%eax
+     ab2:	e9 d4 fd ff ff       	jmp    88b <syscallentry>
+
+00000ab7 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+     ab7:	b8 36 00 00 00       	mov    $0x36,%eax
+     abc:	e9 ca fd ff ff       	jmp    88b <syscallentry>
+
+00000ac1 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+     ac1:	b8 37 00 00 00       	mov    $0x37,%eax
+     ac6:	e9 c0 fd ff ff       	jmp    88b <syscallentry>
+     acb:	66 90                	xchg   %ax,%ax
+     acd:	66 90                	xchg   %ax,%ax
+     acf:	90                   	nop
+
+00000ad0 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     ad0:	55                   	push   %ebp
+     ad1:	89 e5                	mov    %esp,%ebp
+     ad3:	57                   	push   %edi
+     ad4:	56                   	push   %esi
+     ad5:	53                   	push   %ebx
+     ad6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     ad8:	89 d1                	mov    %edx,%ecx
+{
+     ada:	83 ec 3c             	sub    $0x3c,%esp
+     add:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     ae0:	85 d2                	test   %edx,%edx
+     ae2:	0f 89 80 00 00 00    	jns    b68 <printint+0x98>
+     ae8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     aec:	74 7a                	je     b68 <printint+0x98>
+    x = -xx;
+     aee:	f7 d9                	neg    %ecx
+    neg = 1;
+     af0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     af5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     af8:	31 f6                	xor    %esi,%esi
+     afa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     b00:	89 c8                	mov    %ecx,%eax
+     b02:	31 d2                	xor    %edx,%edx
+     b04:	89 f7                	mov    %esi,%edi
+     b06:	f7 f3                	div    %ebx
+     b08:	8d 76 01             	lea    0x1(%esi),%esi
+     b0b:	0f b6 92 e0 10 00 00 	movzbl 0x10e0(%edx),%edx
+     b12:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     b16:	89 ca                	mov    %ecx,%edx
+     b18:	89 c1                	mov    %eax,%ecx
+     b1a:	39 da                	cmp    %ebx,%edx
+     b1c:	73 e2                	jae    b00 <printint+0x30>
+  if(neg)
+     b1e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     b21:	85 c0                	test   %eax,%eax
+     b23:	74 07                	je     b2c <printint+0x5c>
+    buf[i++] = '-';
+     b25:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     b2a:	89 f7                	mov    %esi,%edi
+     b2c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     b2f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     b32:	01 df                	add    %ebx,%edi
+     b34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     b38:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+     b3b:	83 ec 04             	sub    $0x4,%esp
+     b3e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     b41:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     b44:	6a 01                	push   $0x1
+     b46:	50                   	push   %eax
+     b47:	56                   	push   %esi
+     b48:	e8 e3 f6 ff ff       	call   230 <bufwrite>
+  while(--i >= 0)
+     b4d:	89 f8                	mov    %edi,%eax
+     b4f:	83 c4 10             	add    $0x10,%esp
+     b52:	83 ef 01             	sub    $0x1,%edi
+     b55:	39 d8                	cmp    %ebx,%eax
+     b57:	75 df                	jne    b38 <printint+0x68>
+}
+     b59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b5c:	5b                   	pop    %ebx
+     b5d:	5e                   	pop    %esi
+     b5e:	5f                   	pop    %edi
+     b5f:	5d                   	pop    %ebp
+     b60:	c3                   	ret
+     b61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     b68:	31 c0                	xor    %eax,%eax
+     b6a:	eb 89                	jmp    af5 <printint+0x25>
+     b6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b70 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     b70:	55                   	push   %ebp
+     b71:	89 e5                	mov    %esp,%ebp
+     b73:	57                   	push   %edi
+     b74:	56                   	push   %esi
+     b75:	53                   	push   %ebx
+     b76:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     b79:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b7c:	0f b6 18             	movzbl (%eax),%ebx
+     b7f:	84 db                	test   %bl,%bl
+     b81:	74 6c                	je     bef <printf+0x7f>
+     b83:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+     b86:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+     b89:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     b8b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     b8e:	eb 26                	jmp    bb6 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     b90:	83 f8 25             	cmp    $0x25,%eax
+     b93:	74 4b                	je     be0 <printf+0x70>
+  bufwrite(fd, &c, 1);
+     b95:	83 ec 04             	sub    $0x4,%esp
+     b98:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     b9b:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     b9e:	6a 01                	push   $0x1
+     ba0:	50                   	push   %eax
+     ba1:	ff 75 08             	push   0x8(%ebp)
+     ba4:	e8 87 f6 ff ff       	call   230 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+     ba9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     bac:	0f b6 1f             	movzbl (%edi),%ebx
+     baf:	83 c7 01             	add    $0x1,%edi
+     bb2:	84 db                	test   %bl,%bl
+     bb4:	74 39                	je     bef <printf+0x7f>
+    c = fmt[i] & 0xff;
+     bb6:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     bb9:	85 f6                	test   %esi,%esi
+     bbb:	74 d3                	je     b90 <printf+0x20>
+      }
+    } else if(state == '%'){
+     bbd:	83 fe 25             	cmp    $0x25,%esi
+     bc0:	75 ea                	jne    bac <printf+0x3c>
+      if(c == 'd'){
+     bc2:	83 f8 25             	cmp    $0x25,%eax
+     bc5:	0f 84 d5 01 00 00    	je     da0 <printf+0x230>
+     bcb:	83 e8 63             	sub    $0x63,%eax
+     bce:	83 f8 15             	cmp    $0x15,%eax
+     bd1:	77 45                	ja     c18 <printf+0xa8>
+     bd3:	ff 24 85 88 10 00 00 	jmp    *0x1088(,%eax,4)
+     bda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     be0:	0f b6 1f             	movzbl (%edi),%ebx
+     be3:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+     be6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     beb:	84 db                	test   %bl,%bl
+     bed:	75 c7                	jne    bb6 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+     bef:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+     bf3:	74 0b                	je     c00 <printf+0x90>
+    fflush(fd);
+}
+     bf5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bf8:	5b                   	pop    %ebx
+     bf9:	5e                   	pop    %esi
+     bfa:	5f                   	pop    %edi
+     bfb:	5d                   	pop    %ebp
+     bfc:	c3                   	ret
+     bfd:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+     c00:	83 ec 0c             	sub    $0xc,%esp
+     c03:	6a 02                	push   $0x2
+     c05:	e8 c6 f7 ff ff       	call   3d0 <fflush>
+     c0a:	83 c4 10             	add    $0x10,%esp
+}
+     c0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c10:	5b                   	pop    %ebx
+     c11:	5e                   	pop    %esi
+     c12:	5f                   	pop    %edi
+     c13:	5d                   	pop    %ebp
+     c14:	c3                   	ret
+     c15:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+     c18:	83 ec 04             	sub    $0x4,%esp
+     c1b:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     c1e:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+     c22:	6a 01                	push   $0x1
+     c24:	52                   	push   %edx
+     c25:	89 55 c0             	mov    %edx,-0x40(%ebp)
+     c28:	ff 75 08             	push   0x8(%ebp)
+     c2b:	e8 00 f6 ff ff       	call   230 <bufwrite>
+     c30:	83 c4 0c             	add    $0xc,%esp
+     c33:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     c36:	6a 01                	push   $0x1
+     c38:	8b 55 c0             	mov    -0x40(%ebp),%edx
+     c3b:	52                   	push   %edx
+      state = 0;
+     c3c:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+     c3e:	ff 75 08             	push   0x8(%ebp)
+     c41:	e8 ea f5 ff ff       	call   230 <bufwrite>
+        putc(fd, c);
+     c46:	83 c4 10             	add    $0x10,%esp
+     c49:	e9 5e ff ff ff       	jmp    bac <printf+0x3c>
+     c4e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+     c50:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     c53:	83 ec 0c             	sub    $0xc,%esp
+     c56:	b9 10 00 00 00       	mov    $0x10,%ecx
+     c5b:	8b 16                	mov    (%esi),%edx
+     c5d:	6a 00                	push   $0x0
+     c5f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+     c62:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+     c65:	e8 66 fe ff ff       	call   ad0 <printint>
+        ap++;
+     c6a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     c6d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     c70:	31 f6                	xor    %esi,%esi
+     c72:	e9 35 ff ff ff       	jmp    bac <printf+0x3c>
+     c77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c7e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     c80:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     c83:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     c85:	83 c0 04             	add    $0x4,%eax
+     c88:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+     c8b:	b8 81 10 00 00       	mov    $0x1081,%eax
+     c90:	85 db                	test   %ebx,%ebx
+     c92:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+     c95:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+     c98:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+     c9a:	53                   	push   %ebx
+     c9b:	e8 90 f9 ff ff       	call   630 <strlen>
+     ca0:	83 c4 0c             	add    $0xc,%esp
+     ca3:	50                   	push   %eax
+     ca4:	53                   	push   %ebx
+     ca5:	ff 75 08             	push   0x8(%ebp)
+     ca8:	e8 83 f5 ff ff       	call   230 <bufwrite>
+     cad:	83 c4 10             	add    $0x10,%esp
+     cb0:	e9 f7 fe ff ff       	jmp    bac <printf+0x3c>
+     cb5:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+     cb8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+     cbb:	83 ec 04             	sub    $0x4,%esp
+     cbe:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+     cc1:	8b 06                	mov    (%esi),%eax
+        ap++;
+     cc3:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+     cc6:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+     cc9:	6a 01                	push   $0x1
+     ccb:	52                   	push   %edx
+     ccc:	ff 75 08             	push   0x8(%ebp)
+     ccf:	e8 5c f5 ff ff       	call   230 <bufwrite>
+        ap++;
+     cd4:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     cd7:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     cda:	31 f6                	xor    %esi,%esi
+     cdc:	e9 cb fe ff ff       	jmp    bac <printf+0x3c>
+     ce1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+     ce8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     ceb:	83 ec 0c             	sub    $0xc,%esp
+     cee:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     cf3:	8b 16                	mov    (%esi),%edx
+     cf5:	6a 01                	push   $0x1
+     cf7:	e9 63 ff ff ff       	jmp    c5f <printf+0xef>
+     cfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+     d00:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     d03:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     d06:	89 7d c0             	mov    %edi,-0x40(%ebp)
+     d09:	89 55 bc             	mov    %edx,-0x44(%ebp)
+     d0c:	8b 18                	mov    (%eax),%ebx
+     d0e:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+     d11:	31 c0                	xor    %eax,%eax
+     d13:	89 c7                	mov    %eax,%edi
+     d15:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+     d18:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+     d1d:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+     d1f:	f7 e1                	mul    %ecx
+     d21:	c1 ea 03             	shr    $0x3,%edx
+     d24:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     d27:	89 d1                	mov    %edx,%ecx
+     d29:	01 c0                	add    %eax,%eax
+     d2b:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     d2d:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+     d2f:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     d31:	be 0a 00 00 00       	mov    $0xa,%esi
+     d36:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+     d38:	89 da                	mov    %ebx,%edx
+     d3a:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+     d3c:	89 fe                	mov    %edi,%esi
+     d3e:	83 c7 01             	add    $0x1,%edi
+     d41:	8d 42 30             	lea    0x30(%edx),%eax
+     d44:	89 da                	mov    %ebx,%edx
+     d46:	8d 14 92             	lea    (%edx,%edx,4),%edx
+     d49:	01 d2                	add    %edx,%edx
+     d4b:	29 d0                	sub    %edx,%eax
+     d4d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+     d51:	89 c8                	mov    %ecx,%eax
+     d53:	09 d8                	or     %ebx,%eax
+     d55:	75 c1                	jne    d18 <printf+0x1a8>
+     d57:	8b 55 bc             	mov    -0x44(%ebp),%edx
+     d5a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     d5d:	01 d6                	add    %edx,%esi
+     d5f:	89 f7                	mov    %esi,%edi
+     d61:	89 d6                	mov    %edx,%esi
+     d63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d67:	90                   	nop
+    putc(fd, buf[i]);
+     d68:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+     d6b:	83 ec 04             	sub    $0x4,%esp
+     d6e:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+     d71:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+     d74:	6a 01                	push   $0x1
+     d76:	50                   	push   %eax
+     d77:	53                   	push   %ebx
+     d78:	e8 b3 f4 ff ff       	call   230 <bufwrite>
+  while(--i >= 0)
+     d7d:	89 fa                	mov    %edi,%edx
+     d7f:	83 c4 10             	add    $0x10,%esp
+     d82:	83 ef 01             	sub    $0x1,%edi
+     d85:	39 d6                	cmp    %edx,%esi
+     d87:	75 df                	jne    d68 <printf+0x1f8>
+        ap += 2;
+     d89:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+     d8d:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+     d90:	31 f6                	xor    %esi,%esi
+     d92:	e9 15 fe ff ff       	jmp    bac <printf+0x3c>
+     d97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d9e:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+     da0:	83 ec 04             	sub    $0x4,%esp
+     da3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     da6:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     da9:	6a 01                	push   $0x1
+     dab:	e9 8b fe ff ff       	jmp    c3b <printf+0xcb>
+
+00000db0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     db0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     db1:	a1 40 26 00 00       	mov    0x2640,%eax
+{
+     db6:	89 e5                	mov    %esp,%ebp
+     db8:	57                   	push   %edi
+     db9:	56                   	push   %esi
+     dba:	53                   	push   %ebx
+     dbb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     dbe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     dc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dc8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     dca:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     dcc:	39 ca                	cmp    %ecx,%edx
+     dce:	73 30                	jae    e00 <free+0x50>
+     dd0:	39 c1                	cmp    %eax,%ecx
+     dd2:	72 04                	jb     dd8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     dd4:	39 c2                	cmp    %eax,%edx
+     dd6:	72 f0                	jb     dc8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     dd8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     ddb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     dde:	39 f8                	cmp    %edi,%eax
+     de0:	74 2e                	je     e10 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     de2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     de5:	8b 42 04             	mov    0x4(%edx),%eax
+     de8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     deb:	39 f1                	cmp    %esi,%ecx
+     ded:	74 38                	je     e27 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     def:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     df1:	5b                   	pop    %ebx
+  freep = p;
+     df2:	89 15 40 26 00 00    	mov    %edx,0x2640
+}
+     df8:	5e                   	pop    %esi
+     df9:	5f                   	pop    %edi
+     dfa:	5d                   	pop    %ebp
+     dfb:	c3                   	ret
+     dfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e00:	39 c1                	cmp    %eax,%ecx
+     e02:	72 d0                	jb     dd4 <free+0x24>
+     e04:	eb c2                	jmp    dc8 <free+0x18>
+     e06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e0d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+     e10:	03 70 04             	add    0x4(%eax),%esi
+     e13:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e16:	8b 02                	mov    (%edx),%eax
+     e18:	8b 00                	mov    (%eax),%eax
+     e1a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     e1d:	8b 42 04             	mov    0x4(%edx),%eax
+     e20:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     e23:	39 f1                	cmp    %esi,%ecx
+     e25:	75 c8                	jne    def <free+0x3f>
+    p->s.size += bp->s.size;
+     e27:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     e2a:	89 15 40 26 00 00    	mov    %edx,0x2640
+    p->s.size += bp->s.size;
+     e30:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     e33:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     e36:	89 0a                	mov    %ecx,(%edx)
+}
+     e38:	5b                   	pop    %ebx
+     e39:	5e                   	pop    %esi
+     e3a:	5f                   	pop    %edi
+     e3b:	5d                   	pop    %ebp
+     e3c:	c3                   	ret
+     e3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e40 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     e40:	55                   	push   %ebp
+     e41:	89 e5                	mov    %esp,%ebp
+     e43:	57                   	push   %edi
+     e44:	56                   	push   %esi
+     e45:	53                   	push   %ebx
+     e46:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     e49:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+     e4c:	8b 15 40 26 00 00    	mov    0x2640,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     e52:	8d 78 07             	lea    0x7(%eax),%edi
+     e55:	c1 ef 03             	shr    $0x3,%edi
+     e58:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+     e5b:	85 d2                	test   %edx,%edx
+     e5d:	0f 84 8d 00 00 00    	je     ef0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     e63:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     e65:	8b 48 04             	mov    0x4(%eax),%ecx
+     e68:	39 f9                	cmp    %edi,%ecx
+     e6a:	73 64                	jae    ed0 <malloc+0x90>
+  if(nu < 4096)
+     e6c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     e71:	39 df                	cmp    %ebx,%edi
+     e73:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     e76:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     e7d:	eb 0a                	jmp    e89 <malloc+0x49>
+     e7f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     e80:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     e82:	8b 48 04             	mov    0x4(%eax),%ecx
+     e85:	39 f9                	cmp    %edi,%ecx
+     e87:	73 47                	jae    ed0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     e89:	89 c2                	mov    %eax,%edx
+     e8b:	39 05 40 26 00 00    	cmp    %eax,0x2640
+     e91:	75 ed                	jne    e80 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+     e93:	83 ec 0c             	sub    $0xc,%esp
+     e96:	56                   	push   %esi
+     e97:	e8 c7 fa ff ff       	call   963 <sbrk>
+  if(p == (char*)-1)
+     e9c:	83 c4 10             	add    $0x10,%esp
+     e9f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     ea2:	74 1c                	je     ec0 <malloc+0x80>
+  hp->s.size = nu;
+     ea4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+     ea7:	83 ec 0c             	sub    $0xc,%esp
+     eaa:	83 c0 08             	add    $0x8,%eax
+     ead:	50                   	push   %eax
+     eae:	e8 fd fe ff ff       	call   db0 <free>
+  return freep;
+     eb3:	8b 15 40 26 00 00    	mov    0x2640,%edx
+      if((p = morecore(nunits)) == 0)
+     eb9:	83 c4 10             	add    $0x10,%esp
+     ebc:	85 d2                	test   %edx,%edx
+     ebe:	75 c0                	jne    e80 <malloc+0x40>
+        return 0;
+  }
+}
+     ec0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     ec3:	31 c0                	xor    %eax,%eax
+}
+     ec5:	5b                   	pop    %ebx
+     ec6:	5e                   	pop    %esi
+     ec7:	5f                   	pop    %edi
+     ec8:	5d                   	pop    %ebp
+     ec9:	c3                   	ret
+     eca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     ed0:	39 cf                	cmp    %ecx,%edi
+     ed2:	74 4c                	je     f20 <malloc+0xe0>
+        p->s.size -= nunits;
+     ed4:	29 f9                	sub    %edi,%ecx
+     ed6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+     ed9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+     edc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+     edf:	89 15 40 26 00 00    	mov    %edx,0x2640
+}
+     ee5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+     ee8:	83 c0 08             	add    $0x8,%eax
+}
+     eeb:	5b                   	pop    %ebx
+     eec:	5e                   	pop    %esi
+     eed:	5f                   	pop    %edi
+     eee:	5d                   	pop    %ebp
+     eef:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+     ef0:	c7 05 40 26 00 00 44 	movl   $0x2644,0x2640
+     ef7:	26 00 00 
+    base.s.size = 0;
+     efa:	b8 44 26 00 00       	mov    $0x2644,%eax
+    base.s.ptr = freep = prevp = &base;
+     eff:	c7 05 44 26 00 00 44 	movl   $0x2644,0x2644
+     f06:	26 00 00 
+    base.s.size = 0;
+     f09:	c7 05 48 26 00 00 00 	movl   $0x0,0x2648
+     f10:	00 00 00 
+    if(p->s.size >= nunits){
+     f13:	e9 54 ff ff ff       	jmp    e6c <malloc+0x2c>
+     f18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f1f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+     f20:	8b 08                	mov    (%eax),%ecx
+     f22:	89 0a                	mov    %ecx,(%edx)
+     f24:	eb b9                	jmp    edf <malloc+0x9f>
+     f26:	66 90                	xchg   %ax,%ax
+     f28:	66 90                	xchg   %ax,%ax
+     f2a:	66 90                	xchg   %ax,%ax
+     f2c:	66 90                	xchg   %ax,%ax
+     f2e:	66 90                	xchg   %ax,%ax
+
+00000f30 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+     f30:	55                   	push   %ebp
+     f31:	89 e5                	mov    %esp,%ebp
+     f33:	57                   	push   %edi
+     f34:	56                   	push   %esi
+     f35:	be 01 00 00 00       	mov    $0x1,%esi
+     f3a:	53                   	push   %ebx
+     f3b:	83 ec 28             	sub    $0x28,%esp
+     f3e:	8b 45 0c             	mov    0xc(%ebp),%eax
+     f41:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     f44:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+     f47:	68 00 98 00 00       	push   $0x9800
+     f4c:	e8 ef fe ff ff       	call   e40 <malloc>
+     f51:	83 c4 10             	add    $0x10,%esp
+     f54:	89 c7                	mov    %eax,%edi
+     f56:	85 c0                	test   %eax,%eax
+     f58:	74 62                	je     fbc <waitpoll+0x8c>
+     f5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+     f60:	83 ec 0c             	sub    $0xc,%esp
+     f63:	6a 01                	push   $0x1
+     f65:	e8 03 fa ff ff       	call   96d <sleep>
+    fn();
+     f6a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     f6d:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+     f6f:	58                   	pop    %eax
+     f70:	5a                   	pop    %edx
+     f71:	68 00 02 00 00       	push   $0x200
+     f76:	57                   	push   %edi
+     f77:	e8 eb fa ff ff       	call   a67 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+     f7c:	83 c4 10             	add    $0x10,%esp
+     f7f:	85 c0                	test   %eax,%eax
+     f81:	7e 2d                	jle    fb0 <waitpoll+0x80>
+     f83:	6b c0 4c             	imul   $0x4c,%eax,%eax
+     f86:	89 fa                	mov    %edi,%edx
+    alive = 0;
+     f88:	31 c9                	xor    %ecx,%ecx
+     f8a:	01 f8                	add    %edi,%eax
+     f8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+     f90:	3b 1a                	cmp    (%edx),%ebx
+     f92:	75 07                	jne    f9b <waitpoll+0x6b>
+        alive = 1;
+     f94:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+     f98:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+     f9b:	83 c2 4c             	add    $0x4c,%edx
+     f9e:	39 d0                	cmp    %edx,%eax
+     fa0:	75 ee                	jne    f90 <waitpoll+0x60>
+  } while(alive);
+     fa2:	85 c9                	test   %ecx,%ecx
+     fa4:	75 ba                	jne    f60 <waitpoll+0x30>
+     fa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fad:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+     fb0:	83 ec 0c             	sub    $0xc,%esp
+     fb3:	57                   	push   %edi
+     fb4:	e8 f7 fd ff ff       	call   db0 <free>
+  wait();
+     fb9:	83 c4 10             	add    $0x10,%esp
+}
+     fbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     fbf:	5b                   	pop    %ebx
+     fc0:	5e                   	pop    %esi
+     fc1:	5f                   	pop    %edi
+     fc2:	5d                   	pop    %ebp
+  wait();
+     fc3:	e9 10 f9 ff ff       	jmp    8d8 <wait>
+     fc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fcf:	90                   	nop
+
+00000fd0 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+     fd0:	55                   	push   %ebp
+     fd1:	89 e5                	mov    %esp,%ebp
+     fd3:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+     fd6:	c7 45 f0 f1 10 00 00 	movl   $0x10f1,-0x10(%ebp)
+     fdd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+     fe4:	e8 87 f4 ff ff       	call   470 <fork>
+     fe9:	85 c0                	test   %eax,%eax
+     feb:	78 09                	js     ff6 <runps+0x26>
+    return -1;
+  if(pid == 0){
+     fed:	74 0e                	je     ffd <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+     fef:	e8 e4 f8 ff ff       	call   8d8 <wait>
+}
+     ff4:	c9                   	leave
+     ff5:	c3                   	ret
+     ff6:	c9                   	leave
+    return -1;
+     ff7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     ffc:	c3                   	ret
+    exec("ps", argv);
+     ffd:	50                   	push   %eax
+     ffe:	50                   	push   %eax
+     fff:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    1002:	50                   	push   %eax
+    1003:	68 f1 10 00 00       	push   $0x10f1
+    1008:	e8 c3 f4 ff ff       	call   4d0 <exec>
+    printf(2, "exec ps failed\n");
+    100d:	5a                   	pop    %edx
+    100e:	59                   	pop    %ecx
+    100f:	68 f4 10 00 00       	push   $0x10f4
+    1014:	6a 02                	push   $0x2
+    1016:	e8 55 fb ff ff       	call   b70 <printf>
+    exit();
+    101b:	e8 a0 f4 ff ff       	call   4c0 <exit>
@@ -0,0 +1,86 @@
+// Time fork(), exit() and wait() with more and more idle
+// processes alive, in TSC cycles per round trip. The idle
+// ones belong to another process, so that only the size of
+// the process table changes, not the number of our children.
+//
+// usage: forkbench [rounds]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "x86.h"
+
+int levels[] = { 0, 16, 64, 128, 256, 400 };
+
+// Fork a process that forks n idle children, and wait until
+// they all exist. They exit when fd[1] is closed.
+int
+spawnidle(int n, int fd[2])
+{
+  int ready[2], pid, i;
+  char c;
+
+  if(pipe(fd) < 0 || pipe(ready) < 0){
+    printf(2, "forkbench: pipe failed\n");
+    exit();
+  }
+  if((pid = fork()) < 0){
+    printf(2, "forkbench: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    close(fd[1]);
+    for(i = 0; i < n; i++){
+      if((pid = fork()) < 0)
+        break;
+      if(pid == 0){
+        read(fd[0], &c, 1);
+        exit();
+      }
+    }
+    write(ready[1], &i, sizeof(i));
+    while(wait() >= 0)
+      ;
+    exit();
+  }
+  close(fd[0]);
+  close(ready[1]);
+  if(read(ready[0], &n, sizeof(n)) != sizeof(n))
+    n = 0;
+  close(ready[0]);
+  return n;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int rounds, i, j, n, pid, fd[2];
+  uint64 t;
+
+  rounds = argc > 1 ? atoi(argv[1]) : 1000;
+  if(rounds <= 0)
+    rounds = 1;
+
+  for(i = 0; i < sizeof(levels)/sizeof(levels[0]); i++){
+    n = spawnidle(levels[i], fd);
+    t = rdtsc();
+    for(j = 0; j < rounds; j++){
+      if((pid = fork()) < 0){
+        printf(2, "forkbench: fork failed\n");
+        break;
+      }
+      if(pid == 0)
+        exit();
+      wait();
+    }
+    t = rdtsc() - t;
+    printf(1, "%d idle processes: %d cycles per fork/exit/wait\n",
+           n, (uint)div64(t, j > 0 ? j : 1));
+    close(fd[1]);
+    wait();
+    if(n < levels[i])
+      break;
+  }
+  exit();
+}
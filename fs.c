@@ -20,9 +20,26 @@
 #include "fs.h"
 #include "buf.h"
 #include "file.h"
+#include "icachestat.h"
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 static void itrunc(struct inode*);
+static void dcacheinit(void);
+static void dcache_purge(uint, uint);
+
+// Write-back file data. An append at the end of a regular file
+// that fits in a page is copied into ip->wbuf instead of being
+// written through the log; ip->size counts it, but the on-disk
+// size and block map do not until iflush() writes the page out
+// in a few transactions, allocating its blocks then, together.
+// iflush() runs from fsync() and close(), and from the wbflusher
+// kernel thread every WBTICKS ticks, or as soon as a writer finds
+// all NWBUF pages in use.
+struct {
+  struct spinlock lock;
+  int n;          // pages in use
+  int pressure;   // a writer found none free
+} wb;
 // there should be one superblock per disk device, but we run with
 // only one device
 struct superblock sb; 
@@ -52,29 +69,120 @@ bzero(int dev, int bno)
 
 // Blocks.
 
-// Allocate a zeroed disk block.
-static uint
-balloc(uint dev)
+// Does the block hold file data that is written around the log?
+#ifdef LOG_METADATA_ONLY
+#define DATABLOCK(ip) ((ip)->type == T_FILE)
+#else
+#define DATABLOCK(ip) 0
+#endif
+
+// Free-space summary, kept in memory so that allocation does
+// not rescan the bitmap from block 0: a count of free blocks per
+// bitmap block, and cursors where the last searches ended.
+struct {
+  struct spinlock lock;
+  uint nbmap;                  // bitmap blocks in use
+  uint nfree[FSSIZE/BPB + 1];  // free blocks per bitmap block
+  uint bcursor;                // block to search from
+  uint icursor;                // inode to search from
+} fsalloc;
+
+// Count the free blocks in each bitmap block.
+// Called once log recovery has brought the bitmap up to date.
+void
+ballocinit(int dev)
 {
-  int b, bi, m;
   struct buf *bp;
+  uint b, bi, n;
 
-  bp = 0;
+  initlock(&fsalloc.lock, "fsalloc");
+  fsalloc.nbmap = (sb.size + BPB - 1) / BPB;
+  if(fsalloc.nbmap > NELEM(fsalloc.nfree))
+    panic("ballocinit: file system too big");
   for(b = 0; b < sb.size; b += BPB){
     bp = bread(dev, BBLOCK(b, sb));
-    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
-      m = 1 << (bi % 8);
-      if((bp->data[bi/8] & m) == 0){  // Is block free?
-        bp->data[bi/8] |= m;  // Mark block in use.
-        log_write(bp);
-        brelse(bp);
+    n = 0;
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++)
+      if((bp->data[bi/8] & (1 << (bi % 8))) == 0)
+        n++;
+    fsalloc.nfree[b/BPB] = n;
+    brelse(bp);
+  }
+  fsalloc.bcursor = 0;
+  fsalloc.icursor = 1;
+}
+
+// Find a free block in the bitmap block bp, at or after bit
+// from and below bit n, skipping fully used words at a time.
+// base is the block number of bit 0.  Returns -1 if none.
+static int
+bscan(struct buf *bp, uint from, uint n, uint base, int data)
+{
+  uint *w, bi;
+
+  w = (uint*)bp->data;
+  for(bi = from; bi < n; bi++){
+    if(bi % 32 == 0 && w[bi/32] == ~0U){
+      bi += 31;  // whole word in use
+      continue;
+    }
+    if((w[bi/32] & (1U << (bi % 32))) == 0){
+#ifdef LOG_METADATA_ONLY
+      if(data && log_isfreed(base + bi))
+        continue;
+#endif
+      return bi;
+    }
+  }
+  return -1;
+}
+
+// Allocate a zeroed disk block, preferably at or soon after
+// goal (if not 0), else where the last search ended.
+// A block for data written around the log is not zeroed:
+// writei() fills it before the file's size covers it.
+// Returns 0 if the disk is full.
+static uint
+balloc(uint dev, int data, uint goal)
+{
+  uint i, k, b, start, n;
+  int bi, atcursor;
+  struct buf *bp;
+
+  acquire(&fsalloc.lock);
+  atcursor = (goal == 0 || goal >= sb.size);
+  start = atcursor ? fsalloc.bcursor : goal;
+  release(&fsalloc.lock);
+
+  // Search from start to the end of its bitmap block, then the
+  // other bitmap blocks that have free blocks, then the rest
+  // of start's bitmap block.
+  for(i = 0; i <= fsalloc.nbmap; i++){
+    k = (start/BPB + i) % fsalloc.nbmap;
+    acquire(&fsalloc.lock);
+    n = fsalloc.nfree[k];
+    release(&fsalloc.lock);
+    if(n == 0)
+      continue;
+    b = k * BPB;
+    bp = bread(dev, BBLOCK(b, sb));
+    bi = bscan(bp, i == 0 ? start % BPB : 0, min(BPB, sb.size - b), b, data);
+    if(bi >= 0){
+      bp->data[bi/8] |= 1 << (bi % 8);  // Mark block in use.
+      log_write(bp);
+      brelse(bp);
+      acquire(&fsalloc.lock);
+      fsalloc.nfree[k]--;
+      if(atcursor)
+        fsalloc.bcursor = b + bi + 1;
+      release(&fsalloc.lock);
+      if(!data)
         bzero(dev, b + bi);
-        return b + bi;
-      }
+      return b + bi;
     }
     brelse(bp);
   }
-  panic("balloc: out of blocks");
+  return 0;
 }
 
 // Free a disk block.
@@ -92,6 +200,26 @@ bfree(int dev, uint b)
   bp->data[bi/8] &= ~m;
   log_write(bp);
   brelse(bp);
+  acquire(&fsalloc.lock);
+  fsalloc.nfree[b/BPB]++;
+  release(&fsalloc.lock);
+#ifdef LOG_METADATA_ONLY
+  log_freed(b);
+#endif
+}
+
+// Number of free blocks, from the in-memory summary.
+uint
+bfreecount(void)
+{
+  uint k, n;
+
+  n = 0;
+  acquire(&fsalloc.lock);
+  for(k = 0; k < fsalloc.nbmap; k++)
+    n += fsalloc.nfree[k];
+  release(&fsalloc.lock);
+  return n;
 }
 
 // Inodes.
@@ -154,29 +282,85 @@ bfree(int dev, uint b)
 // have locked the inodes involved; this lets callers create
 // multi-step atomic operations.
 //
-// The icache.lock spin-lock protects the allocation of icache
-// entries. Since ip->ref indicates whether an entry is free,
-// and ip->dev and ip->inum indicate which i-node an entry
-// holds, one must hold icache.lock while using any of those fields.
+// The icache is a hash table of inodes, grown a page of entries
+// at a time up to NINODE. An entry whose ref drops to 0 stays
+// hashed and valid on an LRU list, so a later iget() of the same
+// inode needs no disk read; iget() takes the least recently used
+// one when it needs an entry and the cache is full.
+//
+// Each hash bucket's spin-lock protects its chain, and the ref,
+// dev, and inum fields of the inodes on it, so lookups of
+// different inodes do not contend. icache.lock protects the
+// free and LRU lists, and is taken after a bucket lock, never
+// before. An entry with ref 0 that is not on the LRU list is
+// being moved to another bucket; lookups pass over it.
 //
 // An ip->lock sleep-lock protects all ip-> fields other than ref,
 // dev, and inum.  One must hold ip->lock in order to
 // read or write that inode's ip->valid, ip->size, ip->type, &c.
 
+#define NIHASH 31
+
+struct ibucket {
+  struct spinlock lock;
+  struct inode *head;    // chain through hnext
+  uint hits;
+  uint misses;
+};
+
 struct {
   struct spinlock lock;
-  struct inode inode[NINODE];
+  struct ibucket bucket[NIHASH];
+  struct inode lru;      // lru.lnext is the most recently used
+  struct inode *free;    // never used entries, through hnext
+  struct inode *all;     // every entry, through anext
+  int n;                 // entries allocated
+  int idle;              // entries on the LRU list
+  uint evicted;
 } icache;
 
+static struct ibucket*
+ibucket(uint dev, uint inum)
+{
+  return &icache.bucket[(dev*31 + inum) % NIHASH];
+}
+
+// Put ip on the LRU list, at the front unless it
+// holds no inode worth keeping. Caller holds icache.lock.
+static void
+lru_push(struct inode *ip)
+{
+  struct inode *at;
+
+  at = ip->valid ? &icache.lru : icache.lru.lprev;
+  ip->lnext = at->lnext;
+  ip->lprev = at;
+  at->lnext->lprev = ip;
+  at->lnext = ip;
+  icache.idle++;
+}
+
+// Caller holds icache.lock.
+static void
+lru_remove(struct inode *ip)
+{
+  ip->lnext->lprev = ip->lprev;
+  ip->lprev->lnext = ip->lnext;
+  ip->lnext = ip->lprev = 0;
+  icache.idle--;
+}
+
 void
 iinit(int dev)
 {
   int i = 0;
   
   initlock(&icache.lock, "icache");
-  for(i = 0; i < NINODE; i++) {
-    initsleeplock(&icache.inode[i].lock, "inode");
-  }
+  for(i = 0; i < NIHASH; i++)
+    initlock(&icache.bucket[i].lock, "ibucket");
+  icache.lru.lnext = icache.lru.lprev = &icache.lru;
+  initlock(&wb.lock, "wb");
+  dcacheinit();
 
   readsb(dev, &sb);
   cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
@@ -194,11 +378,17 @@ static struct inode* iget(uint dev, uint inum);
 struct inode*
 ialloc(uint dev, short type)
 {
-  int inum;
+  int i, inum, start;
   struct buf *bp;
   struct dinode *dip;
 
-  for(inum = 1; inum < sb.ninodes; inum++){
+  // Start where the last search ended; inodes below
+  // the cursor are in use unless iput() moved it back.
+  acquire(&fsalloc.lock);
+  start = fsalloc.icursor;
+  release(&fsalloc.lock);
+  for(i = 0; i < sb.ninodes - 1; i++){
+    inum = 1 + (start - 1 + i) % (sb.ninodes - 1);
     bp = bread(dev, IBLOCK(inum, sb));
     dip = (struct dinode*)bp->data + inum%IPB;
     if(dip->type == 0){  // a free inode
@@ -206,6 +396,9 @@ ialloc(uint dev, short type)
       dip->type = type;
       log_write(bp);   // mark it allocated on the disk
       brelse(bp);
+      acquire(&fsalloc.lock);
+      fsalloc.icursor = inum + 1 < sb.ninodes ? inum + 1 : 1;
+      release(&fsalloc.lock);
       return iget(dev, inum);
     }
     brelse(bp);
@@ -229,46 +422,126 @@ iupdate(struct inode *ip)
   dip->major = ip->major;
   dip->minor = ip->minor;
   dip->nlink = ip->nlink;
-  dip->size = ip->size;
+  dip->size = ip->size - ip->wblen;
   memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
   log_write(bp);
   brelse(bp);
 }
 
+// Take a reference to inode inum on device dev if
+// bucket b, whose lock the caller holds, has it.
+static struct inode*
+ifind(struct ibucket *b, uint dev, uint inum)
+{
+  struct inode *ip;
+
+  for(ip = b->head; ip; ip = ip->hnext){
+    if(ip->dev != dev || ip->inum != inum)
+      continue;
+    if(ip->ref == 0){
+      acquire(&icache.lock);
+      if(ip->lnext == 0){
+        // iget() is moving it to another bucket.
+        release(&icache.lock);
+        continue;
+      }
+      lru_remove(ip);
+      release(&icache.lock);
+    }
+    ip->ref++;
+    return ip;
+  }
+  return 0;
+}
+
+// Return an entry for iget() to fill: a free one, a new one,
+// or the least recently used unreferenced one, which is still
+// on its hash chain. Caller holds icache.lock.
+static struct inode*
+inew(void)
+{
+  struct inode *ip;
+  char *p;
+  int i;
+
+  if(icache.free == 0 && icache.n < NINODE && (p = kalloc()) != 0){
+    memset(p, 0, PGSIZE);
+    for(i = 0; i < PGSIZE/sizeof(*ip) && icache.n < NINODE; i++){
+      ip = (struct inode*)p + i;
+      initsleeplock(&ip->lock, "inode");
+      ip->hnext = icache.free;
+      icache.free = ip;
+      ip->anext = icache.all;
+      icache.all = ip;
+      icache.n++;
+    }
+  }
+  if((ip = icache.free) != 0){
+    icache.free = ip->hnext;
+    return ip;
+  }
+  if((ip = icache.lru.lprev) == &icache.lru)
+    return 0;
+  lru_remove(ip);
+  icache.evicted++;
+  return ip;
+}
+
 // Find the inode with number inum on device dev
 // and return the in-memory copy. Does not lock
 // the inode and does not read it from disk.
 static struct inode*
 iget(uint dev, uint inum)
 {
-  struct inode *ip, *empty;
-
-  acquire(&icache.lock);
-
-  // Is the inode already cached?
-  empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
-      ip->ref++;
-      release(&icache.lock);
-      return ip;
-    }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
+  struct ibucket *b, *ob;
+  struct inode *ip, *nip, **pp;
+
+  b = ibucket(dev, inum);
+  acquire(&b->lock);
+  if((ip = ifind(b, dev, inum)) != 0){
+    b->hits++;
+    release(&b->lock);
+    return ip;
   }
+  b->misses++;
+  release(&b->lock);
 
-  // Recycle an inode cache entry.
-  if(empty == 0)
+  acquire(&icache.lock);
+  nip = inew();
+  release(&icache.lock);
+  if(nip == 0)
     panic("iget: no inodes");
 
-  ip = empty;
-  ip->dev = dev;
-  ip->inum = inum;
-  ip->ref = 1;
-  ip->valid = 0;
-  release(&icache.lock);
+  // Take a recycled entry off its old chain.
+  if(nip->inum){
+    ob = ibucket(nip->dev, nip->inum);
+    acquire(&ob->lock);
+    for(pp = &ob->head; *pp != nip; pp = &(*pp)->hnext)
+      ;
+    *pp = nip->hnext;
+    release(&ob->lock);
+  }
 
-  return ip;
+  acquire(&b->lock);
+  if((ip = ifind(b, dev, inum)) != 0){
+    // Another process brought it in meanwhile.
+    release(&b->lock);
+    acquire(&icache.lock);
+    nip->inum = 0;
+    nip->hnext = icache.free;
+    icache.free = nip;
+    release(&icache.lock);
+    return ip;
+  }
+  nip->dev = dev;
+  nip->inum = inum;
+  nip->ref = 1;
+  nip->valid = 0;
+  nip->hnext = b->head;
+  b->head = nip;
+  release(&b->lock);
+
+  return nip;
 }
 
 // Increment reference count for ip.
@@ -276,9 +549,11 @@ iget(uint dev, uint inum)
 struct inode*
 idup(struct inode *ip)
 {
-  acquire(&icache.lock);
+  struct ibucket *b = ibucket(ip->dev, ip->inum);
+
+  acquire(&b->lock);
   ip->ref++;
-  release(&icache.lock);
+  release(&b->lock);
   return ip;
 }
 
@@ -305,6 +580,8 @@ ilock(struct inode *ip)
     ip->size = dip->size;
     memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
     brelse(bp);
+    ip->leaf = 0;
+    ip->near = 0;
     ip->valid = 1;
     if(ip->type == 0)
       panic("ilock: no type");
@@ -331,23 +608,57 @@ iunlock(struct inode *ip)
 void
 iput(struct inode *ip)
 {
+  struct ibucket *b = ibucket(ip->dev, ip->inum);
+
   acquiresleep(&ip->lock);
   if(ip->valid && ip->nlink == 0){
-    acquire(&icache.lock);
+    acquire(&b->lock);
     int r = ip->ref;
-    release(&icache.lock);
+    release(&b->lock);
     if(r == 1){
       // inode has no links and no other references: truncate and free.
+      if(ip->type == T_DIR)
+        dcache_purge(ip->dev, ip->inum);
       itrunc(ip);
       ip->type = 0;
       iupdate(ip);
       ip->valid = 0;
+      acquire(&fsalloc.lock);
+      if(ip->inum < fsalloc.icursor)
+        fsalloc.icursor = ip->inum;
+      release(&fsalloc.lock);
     }
   }
   releasesleep(&ip->lock);
 
+  acquire(&b->lock);
+  if(ip->ref == 1 && ip->wbuf)
+    panic("iput: unflushed");
+  if(--ip->ref == 0){
+    acquire(&icache.lock);
+    lru_push(ip);
+    release(&icache.lock);
+  }
+  release(&b->lock);
+}
+
+// Copy out the inode cache counters.
+void
+icache_stat(struct icachestat *st)
+{
+  struct ibucket *b;
+
+  memset(st, 0, sizeof(*st));
+  for(b = icache.bucket; b < &icache.bucket[NIHASH]; b++){
+    acquire(&b->lock);
+    st->hits += b->hits;
+    st->misses += b->misses;
+    release(&b->lock);
+  }
   acquire(&icache.lock);
-  ip->ref--;
+  st->evicted = icache.evicted;
+  st->entries = icache.n;
+  st->idle = icache.idle;
   release(&icache.lock);
 }
 
@@ -365,38 +676,113 @@ iunlockput(struct inode *ip)
 // The content (data) associated with each inode is stored
 // in blocks on the disk. The first NDIRECT block numbers
 // are listed in ip->addrs[].  The next NINDIRECT blocks are
-// listed in block ip->addrs[NDIRECT].
+// listed in block ip->addrs[NDIRECT].  The next NDINDIRECT
+// and NTINDIRECT blocks hang off trees of indirect blocks
+// two and three levels deep, rooted at ip->addrs[NDIRECT+1]
+// and ip->addrs[NDIRECT+2].  The indirect blocks that hold
+// data block numbers are the leaves; bmap() remembers where
+// the last leaf it used is, so sequential access does not
+// walk the tree for every block.  New blocks are allocated
+// just after the last block bmap() returned, when free, so
+// that a file's blocks tend to be contiguous.  A file may
+// have holes (hashed directories do), which read as zeros.
 
 // Return the disk block address of the nth block in inode ip.
-// If there is no such block, bmap allocates one.
+// If there is no such block, bmap allocates one if alloc
+// is set, and otherwise returns 0.  It also returns 0 if
+// the disk is full.
 static uint
-bmap(struct inode *ip, uint bn)
+bmap(struct inode *ip, uint bn, int alloc)
 {
-  uint addr, *a;
+  uint addr, *a, leaf, div;
+  int root, depth;
   struct buf *bp;
 
   if(bn < NDIRECT){
-    if((addr = ip->addrs[bn]) == 0)
-      ip->addrs[bn] = addr = balloc(ip->dev);
+    if((addr = ip->addrs[bn]) == 0 && alloc)
+      ip->addrs[bn] = addr = balloc(ip->dev, DATABLOCK(ip), ip->near);
+    if(addr)
+      ip->near = addr + 1;
     return addr;
   }
   bn -= NDIRECT;
 
-  if(bn < NINDIRECT){
-    // Load indirect block, allocating if necessary.
-    if((addr = ip->addrs[NDIRECT]) == 0)
-      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
-    bp = bread(ip->dev, addr);
-    a = (uint*)bp->data;
-    if((addr = a[bn]) == 0){
-      a[bn] = addr = balloc(ip->dev);
+  // Find the leaf for bn, walking down from the
+  // root of its tree unless it is the cached one.
+  leaf = bn / NINDIRECT;
+  if(ip->leaf != leaf + 1){
+    if(bn < NINDIRECT){
+      root = NDIRECT;
+      depth = 0;
+      div = 1;
+    } else if(bn - NINDIRECT < NDINDIRECT){
+      bn -= NINDIRECT;
+      root = NDIRECT+1;
+      depth = 1;
+      div = NINDIRECT;
+    } else if(bn - NINDIRECT - NDINDIRECT < NTINDIRECT){
+      bn -= NINDIRECT + NDINDIRECT;
+      root = NDIRECT+2;
+      depth = 2;
+      div = NDINDIRECT;
+    } else
+      panic("bmap: out of range");
+
+    // Load indirect blocks, allocating if necessary.
+    if((addr = ip->addrs[root]) == 0){
+      if(!alloc)
+        return 0;
+      if((ip->addrs[root] = addr = balloc(ip->dev, 0, ip->near)) == 0)
+        return 0;
+    }
+    for(; depth > 0; depth--, div /= NINDIRECT){
+      bp = bread(ip->dev, addr);
+      a = (uint*)bp->data;
+      if((addr = a[bn/div % NINDIRECT]) == 0 && alloc){
+        if((a[bn/div % NINDIRECT] = addr = balloc(ip->dev, 0, ip->near)) != 0)
+          log_write(bp);
+      }
+      brelse(bp);
+      if(addr == 0)
+        return 0;
+    }
+    ip->leaf = leaf + 1;
+    ip->leafaddr = addr;
+  }
+
+  // Every tree holds a whole number of leaves,
+  // so bn's slot in its leaf does not depend on the tree.
+  bp = bread(ip->dev, ip->leafaddr);
+  a = (uint*)bp->data;
+  if((addr = a[bn % NINDIRECT]) == 0 && alloc){
+    if((a[bn % NINDIRECT] = addr = balloc(ip->dev, DATABLOCK(ip), ip->near)) != 0)
       log_write(bp);
+  }
+  brelse(bp);
+  if(addr)
+    ip->near = addr + 1;
+  return addr;
+}
+
+// Free block addr and, if it is an indirect block
+// depth levels above the data, every block below it.
+static void
+bfreetree(uint dev, uint addr, int depth)
+{
+  struct buf *bp;
+  uint *a;
+  int j;
+
+  if(depth > 0){
+    bp = bread(dev, addr);
+    a = (uint*)bp->data;
+    for(j = 0; j < NINDIRECT; j++){
+      if(a[j])
+        bfreetree(dev, a[j], depth-1);
     }
     brelse(bp);
-    return addr;
   }
-
-  panic("bmap: out of range");
+  bfree(dev, addr);
 }
 
 // Truncate inode (discard contents).
@@ -407,28 +793,16 @@ bmap(struct inode *ip, uint bn)
 static void
 itrunc(struct inode *ip)
 {
-  int i, j;
-  struct buf *bp;
-  uint *a;
+  int i;
 
-  for(i = 0; i < NDIRECT; i++){
+  for(i = 0; i < NDIRECT+3; i++){
     if(ip->addrs[i]){
-      bfree(ip->dev, ip->addrs[i]);
+      bfreetree(ip->dev, ip->addrs[i], i < NDIRECT ? 0 : i-NDIRECT+1);
       ip->addrs[i] = 0;
     }
   }
-
-  if(ip->addrs[NDIRECT]){
-    bp = bread(ip->dev, ip->addrs[NDIRECT]);
-    a = (uint*)bp->data;
-    for(j = 0; j < NINDIRECT; j++){
-      if(a[j])
-        bfree(ip->dev, a[j]);
-    }
-    brelse(bp);
-    bfree(ip->dev, ip->addrs[NDIRECT]);
-    ip->addrs[NDIRECT] = 0;
-  }
+  ip->leaf = 0;
+  ip->near = 0;
 
   ip->size = 0;
   iupdate(ip);
@@ -452,7 +826,7 @@ stati(struct inode *ip, struct stat *st)
 int
 readi(struct inode *ip, char *dst, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, addr;
   struct buf *bp;
 
   if(ip->type == T_DEV){
@@ -467,8 +841,17 @@ readi(struct inode *ip, char *dst, uint off, uint n)
     n = ip->size - off;
 
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
     m = min(n - tot, BSIZE - off%BSIZE);
+    if(off >= ip->size - ip->wblen){
+      memmove(dst, ip->wbuf + off - (ip->size - ip->wblen), m);
+      continue;
+    }
+    m = min(m, ip->size - ip->wblen - off);
+    if((addr = bmap(ip, off/BSIZE, 0)) == 0){
+      memset(dst, 0, m);  // hole
+      continue;
+    }
+    bp = bread(ip->dev, addr);
     memmove(dst, bp->data + off%BSIZE, m);
     brelse(bp);
   }
@@ -478,10 +861,12 @@ readi(struct inode *ip, char *dst, uint off, uint n)
 // PAGEBREAK!
 // Write data to inode.
 // Caller must hold ip->lock.
+// Returns the number of bytes written, which is less
+// than n if the disk fills up.
 int
 writei(struct inode *ip, char *src, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, addr;
   struct buf *bp;
 
   if(ip->type == T_DEV){
@@ -494,22 +879,206 @@ writei(struct inode *ip, char *src, uint off, uint n)
     return -1;
   if(off + n > MAXFILE*BSIZE)
     return -1;
+  if(wbbusy(ip, off, n))
+    return -1;
 
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    if((addr = bmap(ip, off/BSIZE, 1)) == 0)
+      break;
+    bp = bread(ip->dev, addr);
     m = min(n - tot, BSIZE - off%BSIZE);
     memmove(bp->data + off%BSIZE, src, m);
-    log_write(bp);
+    if(ip->type == T_FILE){
+      mmapsync(ip, off, src, m);
+      log_writedata(bp);
+    } else
+      log_write(bp);
     brelse(bp);
   }
 
-  if(n > 0 && off > ip->size){
+  if(tot > 0 && off > ip->size){
     ip->size = off;
     iupdate(ip);
   }
+  return tot;
+}
+
+// Copy n bytes of regular file src at soff to regular file
+// dst at doff, block by block in the buffer cache.
+// Caller must hold both locks and be in a transaction that can
+// take as many blocks as a writei() of n bytes.  Returns the
+// number of bytes copied, fewer than n if the disk fills up.
+int
+icopy(struct inode *src, uint soff, struct inode *dst, uint doff, uint n)
+{
+  uint tot, m, addr, wbstart;
+  struct buf *bp, *sbp;
+
+  if(soff > src->size || soff + n < soff || doff > dst->size || doff + n < doff)
+    return -1;
+  if(soff + n > src->size)
+    n = src->size - soff;
+  if(doff + n > MAXFILE*BSIZE || wbbusy(dst, doff, n))
+    return -1;
+
+  wbstart = src->size - src->wblen;
+  for(tot=0; tot<n; tot+=m, soff+=m, doff+=m){
+    m = min(n - tot, BSIZE - doff%BSIZE);
+    if((addr = bmap(dst, doff/BSIZE, 1)) == 0)
+      break;
+    bp = bread(dst->dev, addr);
+    if(soff >= wbstart){
+      memmove(bp->data + doff%BSIZE, src->wbuf + soff - wbstart, m);
+    } else {
+      m = min(m, min(BSIZE - soff%BSIZE, wbstart - soff));
+      if((addr = bmap(src, soff/BSIZE, 0)) == 0){
+        memset(bp->data + doff%BSIZE, 0, m);  // hole
+      } else {
+        sbp = bread(src->dev, addr);
+        memmove(bp->data + doff%BSIZE, sbp->data + soff%BSIZE, m);
+        brelse(sbp);
+      }
+    }
+    mmapsync(dst, doff, (char*)bp->data + doff%BSIZE, m);
+    log_writedata(bp);
+    brelse(bp);
+  }
+
+  if(tot > 0 && doff > dst->size){
+    dst->size = doff;
+    iupdate(dst);
+  }
+  return tot;
+}
+
+// Copy n bytes at the end of regular file ip into its
+// write-back page, if they fit. Returns n, or 0 if the
+// caller must write them with writei() instead.
+// Caller must hold ip->lock.
+int
+wbappend(struct inode *ip, char *src, uint off, uint n)
+{
+  if(ip->type != T_FILE || off != ip->size || n == 0)
+    return 0;
+  if(ip->wblen + n > PGSIZE || off + n > MAXFILE*BSIZE)
+    return 0;
+
+  if(ip->wbuf == 0){
+    acquire(&wb.lock);
+    if(wb.n == NWBUF){
+      wb.pressure = 1;
+      release(&wb.lock);
+      return 0;
+    }
+    wb.n++;
+    release(&wb.lock);
+    if((ip->wbuf = kalloc()) == 0){
+      acquire(&wb.lock);
+      wb.n--;
+      release(&wb.lock);
+      return 0;
+    }
+  }
+  memmove(ip->wbuf + ip->wblen, src, n);
+  mmapsync(ip, off, src, n);
+  ip->wblen += n;
+  ip->size += n;
   return n;
 }
 
+// Would writing n bytes at off reach ip's write-back page?
+// Caller must hold ip->lock.
+int
+wbbusy(struct inode *ip, uint off, uint n)
+{
+  return ip->wblen > 0 && off + n > ip->size - ip->wblen;
+}
+
+// Write ip's write-back page to disk and free it.
+// Caller must not hold ip->lock or be in a transaction.
+void
+iflush(struct inode *ip)
+{
+  uint max = (MAXOPBLOCKS-1-2-5-1) * BSIZE;
+  uint off, len, n;
+  int r;
+
+  for(;;){
+    begin_op();
+    ilock(ip);
+    if((len = ip->wblen) == 0){
+      iunlock(ip);
+      end_op();
+      break;
+    }
+    n = min(len, max);
+
+    // Hand the front of the page to writei(), which
+    // allocates its blocks and moves the on-disk size up.
+    off = ip->size - len;
+    ip->size = off;
+    ip->wblen = 0;
+    if((r = writei(ip, ip->wbuf, off, n)) != n)
+      n = len = r;  // the disk is full: drop the rest
+    ip->size = off + len;
+    ip->wblen = len - n;
+    memmove(ip->wbuf, ip->wbuf + n, ip->wblen);
+
+    if(ip->wblen == 0){
+      kfree(ip->wbuf);
+      ip->wbuf = 0;
+      acquire(&wb.lock);
+      wb.n--;
+      release(&wb.lock);
+    }
+    iunlock(ip);
+    end_op();
+  }
+}
+
+// Kernel thread that flushes every write-back page
+// each WBTICKS ticks, or sooner when they run out.
+void
+wbflusher(void)
+{
+  struct ibucket *b;
+  struct inode *ip;
+  uint t0;
+
+  for(;;){
+    acquire(&tickslock);
+    t0 = ticks;
+    while(ticks - t0 < WBTICKS && !wb.pressure)
+      sleep(&ticks, &tickslock);
+    release(&tickslock);
+
+    acquire(&wb.lock);
+    wb.pressure = 0;
+    release(&wb.lock);
+
+    acquire(&icache.lock);
+    ip = icache.all;
+    release(&icache.lock);
+    for(; ip; ip = ip->anext){
+      // An entry with a reference can not change identity,
+      // so b is its bucket if the check passes.
+      b = ibucket(ip->dev, ip->inum);
+      acquire(&b->lock);
+      if(ip->ref == 0 || ip->wbuf == 0 || b != ibucket(ip->dev, ip->inum)){
+        release(&b->lock);
+        continue;
+      }
+      ip->ref++;
+      release(&b->lock);
+
+      iflush(ip);
+      begin_op();
+      iput(ip);
+      end_op();
+    }
+  }
+}
+
 //PAGEBREAK!
 // Directories
 
@@ -519,16 +1088,126 @@ namecmp(const char *s, const char *t)
   return strncmp(s, t, DIRSIZ);
 }
 
-// Look for a directory entry in a directory.
-// If found, set *poff to byte offset of entry.
-struct inode*
-dirlookup(struct inode *dp, char *name, uint *poff)
+// Directory entry cache.
+//
+// Remembers the results of dirlookup() by (dev, directory inum,
+// name): the inum and offset of the entry, or that the name is
+// absent (inum 0). Entries for a directory change only while
+// the directory is locked, which dirlookup()'s callers hold, so
+// the cache and the directory's contents change together:
+// dirlink() and dirunlink() update it, and iput() drops all of
+// a directory's entries when the directory itself is freed.
+// Old entries are recycled round-robin.
+
+#define NDHASH 61
+
+struct dentry {
+  uint dev;
+  uint dir;           // inum of the directory
+  char name[DIRSIZ];
+  uint inum;          // 0 if name is not in the directory
+  uint off;           // byte offset of the entry, if inum != 0
+  struct dentry *next; // hash chain
+};
+
+struct {
+  struct spinlock lock;
+  struct dentry dentry[NDCACHE];
+  struct dentry *hash[NDHASH];
+  int hand;           // next entry to recycle
+} dcache;
+
+static void
+dcacheinit(void)
 {
-  uint off, inum;
-  struct dirent de;
+  initlock(&dcache.lock, "dcache");
+}
 
-  if(dp->type != T_DIR)
-    panic("dirlookup not DIR");
+static struct dentry**
+dhash(uint dev, uint dir, char *name)
+{
+  uint h;
+  int i;
+
+  h = dev*31 + dir;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = h*31 + name[i];
+  return &dcache.hash[h % NDHASH];
+}
+
+// Find the cached entry for name in directory dir.
+// Caller must hold dcache.lock.
+static struct dentry*
+dfind(uint dev, uint dir, char *name)
+{
+  struct dentry *d;
+
+  for(d = *dhash(dev, dir, name); d; d = d->next)
+    if(d->dev == dev && d->dir == dir && namecmp(d->name, name) == 0)
+      return d;
+  return 0;
+}
+
+// Remove d from its hash chain.
+// Caller must hold dcache.lock.
+static void
+dunhash(struct dentry *d)
+{
+  struct dentry **pp;
+
+  for(pp = dhash(d->dev, d->dir, d->name); *pp; pp = &(*pp)->next){
+    if(*pp == d){
+      *pp = d->next;
+      break;
+    }
+  }
+  d->dev = 0;
+}
+
+// Record that name in directory dp maps to inum at off,
+// or is absent if inum is 0.  Caller must hold dp->lock.
+static void
+dcache_set(struct inode *dp, char *name, uint inum, uint off)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  if((d = dfind(dp->dev, dp->inum, name)) == 0){
+    d = &dcache.dentry[dcache.hand];
+    dcache.hand = (dcache.hand + 1) % NDCACHE;
+    if(d->dev)
+      dunhash(d);
+    d->dev = dp->dev;
+    d->dir = dp->inum;
+    strncpy(d->name, name, DIRSIZ);
+    d->next = *dhash(d->dev, d->dir, d->name);
+    *dhash(d->dev, d->dir, d->name) = d;
+  }
+  d->inum = inum;
+  d->off = off;
+  release(&dcache.lock);
+}
+
+// Forget every entry of directory inum, which is being freed.
+static void
+dcache_purge(uint dev, uint inum)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  for(d = dcache.dentry; d < &dcache.dentry[NDCACHE]; d++)
+    if(d->dev == dev && d->dir == inum)
+      dunhash(d);
+  release(&dcache.lock);
+}
+
+// Look for name in the linear directory dp.
+// If found, return its inum and set *poff to its byte offset.
+static uint
+dirscan(struct inode *dp, char *name, uint *poff)
+{
+  uint off;
+  struct dirent de;
 
   for(off = 0; off < dp->size; off += sizeof(de)){
     if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
@@ -537,21 +1216,100 @@ dirlookup(struct inode *dp, char *name, uint *poff)
       continue;
     if(namecmp(name, de.name) == 0){
       // entry matches path element
-      if(poff)
-        *poff = off;
-      inum = de.inum;
-      return iget(dp->dev, inum);
+      *poff = off;
+      return de.inum;
     }
   }
+  return 0;
+}
 
+// Look for name along its bucket chain in the hashed directory dp.
+// If found, return its inum and set *poff to its byte offset.
+// Otherwise return 0, and set *poff to the first free slot in
+// the chain, or to -1 and *plast to the chain's last block if
+// the chain is full.
+static uint
+dirhscan(struct inode *dp, char *name, uint *poff, uint *plast)
+{
+  uint bn, addr, i, inum, next, free;
+  struct buf *bp;
+  struct dirent *de;
+
+  free = -1;
+  for(bn = dirbucket(name); ; bn = next){
+    if((addr = bmap(dp, bn, 0)) == 0){
+      // bucket never used: all free
+      if(free == -1)
+        free = bn*BSIZE;
+      break;
+    }
+    bp = bread(dp->dev, addr);
+    de = (struct dirent*)bp->data;
+    for(i = 0; i < DIRLINK; i++){
+      if(de[i].inum == 0){
+        if(free == -1)
+          free = bn*BSIZE + i*sizeof(*de);
+      } else if(namecmp(name, de[i].name) == 0){
+        inum = de[i].inum;
+        brelse(bp);
+        *poff = bn*BSIZE + i*sizeof(*de);
+        return inum;
+      }
+    }
+    memmove(&next, de[DIRLINK].name, sizeof(next));
+    brelse(bp);
+    if(next == 0)
+      break;
+  }
+  *poff = free;
+  *plast = bn;
   return 0;
 }
 
+// Look for a directory entry in a directory.
+// If found, set *poff to byte offset of entry.
+struct inode*
+dirlookup(struct inode *dp, char *name, uint *poff)
+{
+  uint off, inum, last;
+  struct dentry *d;
+
+  if(dp->type != T_DIR)
+    panic("dirlookup not DIR");
+
+  acquire(&dcache.lock);
+  if((d = dfind(dp->dev, dp->inum, name)) != 0){
+    inum = d->inum;
+    off = d->off;
+    release(&dcache.lock);
+    if(inum == 0)
+      return 0;
+    if(poff)
+      *poff = off;
+    return iget(dp->dev, inum);
+  }
+  release(&dcache.lock);
+
+  if(dp->major == DIRHASHED)
+    inum = dirhscan(dp, name, &off, &last);
+  else
+    inum = dirscan(dp, name, &off);
+  if(inum == 0){
+    dcache_set(dp, name, 0, 0);
+    return 0;
+  }
+  if(poff)
+    *poff = off;
+  dcache_set(dp, name, inum, off);
+  return iget(dp->dev, inum);
+}
+
 // Write a new directory entry (name, inum) into the directory dp.
+// Returns -1 if name is present or the disk is full.
 int
 dirlink(struct inode *dp, char *name, uint inum)
 {
-  int off;
+  uint off, last, next;
   struct dirent de;
   struct inode *ip;
 
@@ -561,22 +1319,59 @@ dirlink(struct inode *dp, char *name, uint inum)
     return -1;
   }
 
-  // Look for an empty dirent.
-  for(off = 0; off < dp->size; off += sizeof(de)){
-    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-      panic("dirlink read");
-    if(de.inum == 0)
-      break;
+  if(dp->major == DIRHASHED){
+    if(dp->size < DIRHSIZE)
+      dp->size = DIRHSIZE;  // buckets start out as holes
+    dirhscan(dp, name, &off, &last);
+    if(off == -1){
+      // Chain is full: link a new block onto its end.
+      // The whole block is the chain's, so the directory
+      // grows by a block even though one slot is written.
+      next = (dp->size + BSIZE - 1) / BSIZE;
+      off = next * BSIZE;
+      dp->size = off + BSIZE;
+      memset(&de, 0, sizeof(de));
+      memmove(de.name, &next, sizeof(next));
+      if(writei(dp, (char*)&de, last*BSIZE + DIRLINK*sizeof(de), sizeof(de)) != sizeof(de))
+        panic("dirlink link");
+    }
+  } else {
+    // Look for an empty dirent.
+    for(off = 0; off < dp->size; off += sizeof(de)){
+      if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+        panic("dirlink read");
+      if(de.inum == 0)
+        break;
+    }
   }
 
   strncpy(de.name, name, DIRSIZ);
   de.inum = inum;
-  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-    panic("dirlink");
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de)){
+    if(dp->major == DIRHASHED)
+      iupdate(dp);  // keep the size that covers a new link
+    return -1;
+  }
+  if(dp->major == DIRHASHED)
+    iupdate(dp);  // writei() may have filled a hole
+  dcache_set(dp, name, inum, off);
 
   return 0;
 }
 
+// Remove the entry for name, found by dirlookup() at off,
+// from the directory dp.
+void
+dirunlink(struct inode *dp, char *name, uint off)
+{
+  struct dirent de;
+
+  memset(&de, 0, sizeof(de));
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+    panic("dirunlink");
+  dcache_set(dp, name, 0, 0);
+}
+
 //PAGEBREAK!
 // Paths
 
@@ -21,9 +21,11 @@ struct superblock {
   uint bmapstart;    // Block number of first free map block
 };
 
-#define NDIRECT 12
+#define NDIRECT 10
 #define NINDIRECT (BSIZE / sizeof(uint))
-#define MAXFILE (NDIRECT + NINDIRECT)
+#define NDINDIRECT (NINDIRECT * NINDIRECT)
+#define NTINDIRECT (NDINDIRECT * NINDIRECT)
+#define MAXFILE (NDIRECT + NINDIRECT + NDINDIRECT + NTINDIRECT)
 
 // On-disk inode structure
 struct dinode {
@@ -32,7 +34,8 @@ struct dinode {
   short minor;          // Minor device number (T_DEV only)
   short nlink;          // Number of links to inode in file system
   uint size;            // Size of file (bytes)
-  uint addrs[NDIRECT+1];   // Data block addresses
+  uint addrs[NDIRECT+3];   // Data block addresses: direct, then
+                           // single, double, triple indirect
 };
 
 // Inodes per block.
@@ -55,3 +58,33 @@ struct dirent {
   char name[DIRSIZ];
 };
 
+// A hashed directory (major DIRHASHED, made by mkhdir()) keeps
+// its entries in NDIRBUCKET bucket blocks after block 0, which
+// are allocated when first used.  The last dirent slot of a
+// bucket block has inum 0 and, in its name, the block number of
+// the bucket's next overflow block (0 if none).  Overflow blocks
+// are appended to the directory.  A lookup walks one chain, so
+// it reads about n/NDIRBUCKET entries instead of n, but a nearly
+// empty hashed directory is already DIRHSIZE long (mostly holes),
+// so ordinary directories stay linear.
+#define DIRHASHED 1
+#define NDIRBUCKET 64
+#define DPB (BSIZE / sizeof(struct dirent))  // dirents per block
+#define DIRLINK (DPB - 1)  // slot holding the overflow link
+#define DIRHSIZE ((1 + NDIRBUCKET) * BSIZE)  // initial size
+
+// Block of a hashed directory where the chain for name starts.
+static inline uint
+dirbucket(const char *name)
+{
+  uint h;
+  int i;
+
+  if(name[0] == '.' && (name[1] == 0 || (name[1] == '.' && name[2] == 0)))
+    return 0;
+  h = 2166136261U;  // FNV-1a
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = (h ^ (uchar)name[i]) * 16777619U;
+  return 1 + h % NDIRBUCKET;
+}
+
@@ -0,0 +1,2154 @@
+
+_fsstorm:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 39                	mov    (%ecx),%edi
+  16:	8b 51 04             	mov    0x4(%ecx),%edx
+  int nproc, nops, i, start;
+
+  nproc = argc > 1 ? atoi(argv[1]) : 4;
+  19:	83 ff 01             	cmp    $0x1,%edi
+  1c:	7f 33                	jg     51 <main+0x51>
+  if(nproc < 1 || nproc > 26){
+    printf(2, "usage: fsstorm [nproc(1-26) [nops]]\n");
+    exit();
+  }
+
+  start = uptime();
+  1e:	e8 14 09 00 00       	call   937 <uptime>
+  nproc = argc > 1 ? atoi(argv[1]) : 4;
+  23:	bb 04 00 00 00       	mov    $0x4,%ebx
+  nops = argc > 2 ? atoi(argv[2]) : 50;
+  28:	be 32 00 00 00       	mov    $0x32,%esi
+  start = uptime();
+  2d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < nproc; i++){
+  30:	31 ff                	xor    %edi,%edi
+  32:	eb 0b                	jmp    3f <main+0x3f>
+  34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  38:	83 c7 01             	add    $0x1,%edi
+  3b:	39 df                	cmp    %ebx,%edi
+  3d:	74 5d                	je     9c <main+0x9c>
+    if(fork() == 0)
+  3f:	e8 ec 03 00 00       	call   430 <fork>
+  44:	85 c0                	test   %eax,%eax
+  46:	75 f0                	jne    38 <main+0x38>
+      storm(i, nops);
+  48:	50                   	push   %eax
+  49:	50                   	push   %eax
+  4a:	56                   	push   %esi
+  4b:	57                   	push   %edi
+  4c:	e8 8f 00 00 00       	call   e0 <storm>
+  nproc = argc > 1 ? atoi(argv[1]) : 4;
+  51:	83 ec 0c             	sub    $0xc,%esp
+  54:	ff 72 04             	push   0x4(%edx)
+  nops = argc > 2 ? atoi(argv[2]) : 50;
+  57:	be 32 00 00 00       	mov    $0x32,%esi
+  nproc = argc > 1 ? atoi(argv[1]) : 4;
+  5c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  5f:	e8 7c 07 00 00       	call   7e0 <atoi>
+  nops = argc > 2 ? atoi(argv[2]) : 50;
+  64:	83 c4 10             	add    $0x10,%esp
+  nproc = argc > 1 ? atoi(argv[1]) : 4;
+  67:	89 c3                	mov    %eax,%ebx
+  nops = argc > 2 ? atoi(argv[2]) : 50;
+  69:	83 ff 02             	cmp    $0x2,%edi
+  6c:	74 13                	je     81 <main+0x81>
+  6e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  71:	83 ec 0c             	sub    $0xc,%esp
+  74:	ff 72 08             	push   0x8(%edx)
+  77:	e8 64 07 00 00       	call   7e0 <atoi>
+  7c:	83 c4 10             	add    $0x10,%esp
+  7f:	89 c6                	mov    %eax,%esi
+  if(nproc < 1 || nproc > 26){
+  81:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  84:	83 f8 19             	cmp    $0x19,%eax
+  87:	76 47                	jbe    d0 <main+0xd0>
+    printf(2, "usage: fsstorm [nproc(1-26) [nops]]\n");
+  89:	52                   	push   %edx
+  8a:	52                   	push   %edx
+  8b:	68 30 10 00 00       	push   $0x1030
+  90:	6a 02                	push   $0x2
+  92:	e8 99 0a 00 00       	call   b30 <printf>
+    exit();
+  97:	e8 e4 03 00 00       	call   480 <exit>
+  }
+  for(i = 0; i < nproc; i++)
+  9c:	31 ff                	xor    %edi,%edi
+  9e:	66 90                	xchg   %ax,%ax
+    wait();
+  a0:	e8 f3 07 00 00       	call   898 <wait>
+  for(i = 0; i < nproc; i++)
+  a5:	83 c7 01             	add    $0x1,%edi
+  a8:	39 df                	cmp    %ebx,%edi
+  aa:	75 f4                	jne    a0 <main+0xa0>
+  printf(1, "fsstorm: %d procs x %d ops in %d ticks\n",
+         nproc, nops, uptime() - start);
+  ac:	e8 86 08 00 00       	call   937 <uptime>
+  printf(1, "fsstorm: %d procs x %d ops in %d ticks\n",
+  b1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  b4:	83 ec 0c             	sub    $0xc,%esp
+  b7:	29 d0                	sub    %edx,%eax
+  b9:	50                   	push   %eax
+  ba:	56                   	push   %esi
+  bb:	57                   	push   %edi
+  bc:	68 58 10 00 00       	push   $0x1058
+  c1:	6a 01                	push   $0x1
+  c3:	e8 68 0a 00 00       	call   b30 <printf>
+  exit();
+  c8:	83 c4 20             	add    $0x20,%esp
+  cb:	e8 b0 03 00 00       	call   480 <exit>
+  start = uptime();
+  d0:	e8 62 08 00 00       	call   937 <uptime>
+  d5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < nproc; i++){
+  d8:	e9 53 ff ff ff       	jmp    30 <main+0x30>
+  dd:	66 90                	xchg   %ax,%ax
+  df:	90                   	nop
+
+000000e0 <storm>:
+{
+  e0:	55                   	push   %ebp
+  e1:	89 e5                	mov    %esp,%ebp
+  e3:	57                   	push   %edi
+  e4:	56                   	push   %esi
+  e5:	53                   	push   %ebx
+  e6:	83 ec 2c             	sub    $0x2c,%esp
+  dir[1] = file[1] = 'a' + id;
+  e9:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  for(i = 0; i < nops; i++){
+  ed:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  dir[0] = 'd';
+  f0:	c6 45 d8 64          	movb   $0x64,-0x28(%ebp)
+  file[0] = 'f';
+  f4:	c6 45 e0 66          	movb   $0x66,-0x20(%ebp)
+  dir[1] = file[1] = 'a' + id;
+  f8:	83 c0 61             	add    $0x61,%eax
+  dir[3] = file[3] = 0;
+  fb:	c6 45 e3 00          	movb   $0x0,-0x1d(%ebp)
+  dir[1] = file[1] = 'a' + id;
+  ff:	88 45 e1             	mov    %al,-0x1f(%ebp)
+ 102:	88 45 d9             	mov    %al,-0x27(%ebp)
+  dir[3] = file[3] = 0;
+ 105:	c6 45 db 00          	movb   $0x0,-0x25(%ebp)
+  for(i = 0; i < nops; i++){
+ 109:	85 db                	test   %ebx,%ebx
+ 10b:	0f 8e bd 00 00 00    	jle    1ce <storm+0xee>
+ 111:	31 db                	xor    %ebx,%ebx
+ 113:	8d 75 d8             	lea    -0x28(%ebp),%esi
+    if((fd = open(file, O_CREATE|O_RDWR)) < 0){
+ 116:	8d 7d e0             	lea    -0x20(%ebp),%edi
+ 119:	eb 5f                	jmp    17a <storm+0x9a>
+ 11b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 11f:	90                   	nop
+ 120:	83 ec 08             	sub    $0x8,%esp
+ 123:	68 02 02 00 00       	push   $0x202
+ 128:	57                   	push   %edi
+ 129:	e8 9b 07 00 00       	call   8c9 <open>
+ 12e:	83 c4 10             	add    $0x10,%esp
+ 131:	85 c0                	test   %eax,%eax
+ 133:	0f 88 9a 00 00 00    	js     1d3 <storm+0xf3>
+    write(fd, dir, sizeof(dir));
+ 139:	83 ec 04             	sub    $0x4,%esp
+ 13c:	6a 08                	push   $0x8
+ 13e:	56                   	push   %esi
+ 13f:	50                   	push   %eax
+ 140:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 143:	e8 65 07 00 00       	call   8ad <write>
+    close(fd);
+ 148:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 14b:	89 14 24             	mov    %edx,(%esp)
+ 14e:	e8 9d 03 00 00       	call   4f0 <close>
+    if(unlink(dir) < 0 || unlink(file) < 0){
+ 153:	89 34 24             	mov    %esi,(%esp)
+ 156:	e8 82 07 00 00       	call   8dd <unlink>
+ 15b:	83 c4 10             	add    $0x10,%esp
+ 15e:	85 c0                	test   %eax,%eax
+ 160:	78 59                	js     1bb <storm+0xdb>
+ 162:	83 ec 0c             	sub    $0xc,%esp
+ 165:	57                   	push   %edi
+ 166:	e8 72 07 00 00       	call   8dd <unlink>
+ 16b:	83 c4 10             	add    $0x10,%esp
+ 16e:	85 c0                	test   %eax,%eax
+ 170:	78 49                	js     1bb <storm+0xdb>
+  for(i = 0; i < nops; i++){
+ 172:	83 c3 01             	add    $0x1,%ebx
+ 175:	39 5d 0c             	cmp    %ebx,0xc(%ebp)
+ 178:	74 54                	je     1ce <storm+0xee>
+    dir[2] = file[2] = 'a' + i % 26;
+ 17a:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+    if(mkdir(dir) < 0){
+ 17f:	83 ec 0c             	sub    $0xc,%esp
+    dir[2] = file[2] = 'a' + i % 26;
+ 182:	f7 e3                	mul    %ebx
+ 184:	89 d8                	mov    %ebx,%eax
+ 186:	c1 ea 03             	shr    $0x3,%edx
+ 189:	6b d2 1a             	imul   $0x1a,%edx,%edx
+ 18c:	29 d0                	sub    %edx,%eax
+ 18e:	83 c0 61             	add    $0x61,%eax
+ 191:	88 45 e2             	mov    %al,-0x1e(%ebp)
+ 194:	88 45 da             	mov    %al,-0x26(%ebp)
+    if(mkdir(dir) < 0){
+ 197:	56                   	push   %esi
+ 198:	e8 5e 07 00 00       	call   8fb <mkdir>
+ 19d:	83 c4 10             	add    $0x10,%esp
+ 1a0:	85 c0                	test   %eax,%eax
+ 1a2:	0f 89 78 ff ff ff    	jns    120 <storm+0x40>
+      printf(2, "fsstorm: mkdir %s failed\n", dir);
+ 1a8:	51                   	push   %ecx
+ 1a9:	56                   	push   %esi
+ 1aa:	68 e0 0f 00 00       	push   $0xfe0
+ 1af:	6a 02                	push   $0x2
+ 1b1:	e8 7a 09 00 00       	call   b30 <printf>
+      exit();
+ 1b6:	e8 c5 02 00 00       	call   480 <exit>
+      printf(2, "fsstorm: unlink failed\n");
+ 1bb:	50                   	push   %eax
+ 1bc:	50                   	push   %eax
+ 1bd:	68 15 10 00 00       	push   $0x1015
+ 1c2:	6a 02                	push   $0x2
+ 1c4:	e8 67 09 00 00       	call   b30 <printf>
+      exit();
+ 1c9:	e8 b2 02 00 00       	call   480 <exit>
+  exit();
+ 1ce:	e8 ad 02 00 00       	call   480 <exit>
+      printf(2, "fsstorm: create %s failed\n", file);
+ 1d3:	52                   	push   %edx
+ 1d4:	57                   	push   %edi
+ 1d5:	68 fa 0f 00 00       	push   $0xffa
+ 1da:	6a 02                	push   $0x2
+ 1dc:	e8 4f 09 00 00       	call   b30 <printf>
+      exit();
+ 1e1:	e8 9a 02 00 00       	call   480 <exit>
+ 1e6:	66 90                	xchg   %ax,%ax
+ 1e8:	66 90                	xchg   %ax,%ax
+ 1ea:	66 90                	xchg   %ax,%ax
+ 1ec:	66 90                	xchg   %ax,%ax
+ 1ee:	66 90                	xchg   %ax,%ax
+
+000001f0 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+ 1f4:	56                   	push   %esi
+ 1f5:	53                   	push   %ebx
+ 1f6:	83 ec 4c             	sub    $0x4c,%esp
+ 1f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1fc:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 202:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+ 205:	83 fa 0f             	cmp    $0xf,%edx
+ 208:	0f 87 32 01 00 00    	ja     340 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+ 20e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 214:	8b 80 a0 15 00 00    	mov    0x15a0(%eax),%eax
+ 21a:	85 c0                	test   %eax,%eax
+ 21c:	0f 84 de 00 00 00    	je     300 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+ 222:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 228:	8b b0 a4 15 00 00    	mov    0x15a4(%eax),%esi
+ 22e:	8d 88 a0 15 00 00    	lea    0x15a0(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+ 234:	8d b8 a8 15 00 00    	lea    0x15a8(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+ 23a:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+ 23d:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+ 240:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+ 243:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+ 249:	0f 8f 01 01 00 00    	jg     350 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+ 24f:	8d 78 08             	lea    0x8(%eax),%edi
+ 252:	8d bc 3e a0 15 00 00 	lea    0x15a0(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 259:	85 db                	test   %ebx,%ebx
+ 25b:	7e 3b                	jle    298 <bufwrite+0xa8>
+ 25d:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+ 260:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+ 263:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 267:	90                   	nop
+    *dst++ = *src++;
+ 268:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 269:	39 c6                	cmp    %eax,%esi
+ 26b:	75 fb                	jne    268 <bufwrite+0x78>
+  ob[fd].n += n;
+ 26d:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 273:	8b 88 a4 15 00 00    	mov    0x15a4(%eax),%ecx
+ 279:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 27b:	83 b8 a0 15 00 00 01 	cmpl   $0x1,0x15a0(%eax)
+  ob[fd].n += n;
+ 282:	89 88 a4 15 00 00    	mov    %ecx,0x15a4(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 288:	74 26                	je     2b0 <bufwrite+0xc0>
+}
+ 28a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 28d:	5b                   	pop    %ebx
+ 28e:	5e                   	pop    %esi
+ 28f:	5f                   	pop    %edi
+ 290:	5d                   	pop    %ebp
+ 291:	c3                   	ret
+ 292:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+ 298:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 29b:	83 b8 a0 15 00 00 01 	cmpl   $0x1,0x15a0(%eax)
+  ob[fd].n += n;
+ 2a2:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 2a5:	75 e3                	jne    28a <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+ 2a7:	85 db                	test   %ebx,%ebx
+ 2a9:	74 df                	je     28a <bufwrite+0x9a>
+ 2ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2af:	90                   	nop
+  src = vsrc;
+ 2b0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 2b3:	01 c3                	add    %eax,%ebx
+ 2b5:	eb 10                	jmp    2c7 <bufwrite+0xd7>
+ 2b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2be:	66 90                	xchg   %ax,%ax
+ 2c0:	83 c0 01             	add    $0x1,%eax
+ 2c3:	39 d8                	cmp    %ebx,%eax
+ 2c5:	74 c3                	je     28a <bufwrite+0x9a>
+    if(*p == (char)c)
+ 2c7:	80 38 0a             	cmpb   $0xa,(%eax)
+ 2ca:	75 f4                	jne    2c0 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 2cc:	85 c9                	test   %ecx,%ecx
+ 2ce:	7e ba                	jle    28a <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 2d0:	83 ec 04             	sub    $0x4,%esp
+ 2d3:	51                   	push   %ecx
+ 2d4:	ff 75 ac             	push   -0x54(%ebp)
+ 2d7:	52                   	push   %edx
+ 2d8:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+ 2db:	e8 cd 05 00 00       	call   8ad <write>
+    ob[fd].n = 0;
+ 2e0:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+ 2e3:	83 c4 10             	add    $0x10,%esp
+ 2e6:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+ 2ec:	c7 82 a4 15 00 00 00 	movl   $0x0,0x15a4(%edx)
+ 2f3:	00 00 00 
+ 2f6:	eb 92                	jmp    28a <bufwrite+0x9a>
+ 2f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ff:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 300:	83 ec 08             	sub    $0x8,%esp
+ 303:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 306:	50                   	push   %eax
+ 307:	52                   	push   %edx
+ 308:	89 55 b0             	mov    %edx,-0x50(%ebp)
+ 30b:	e8 d7 05 00 00       	call   8e7 <fstat>
+ 310:	83 c4 10             	add    $0x10,%esp
+ 313:	8b 55 b0             	mov    -0x50(%ebp),%edx
+ 316:	89 c1                	mov    %eax,%ecx
+ 318:	b8 02 00 00 00       	mov    $0x2,%eax
+ 31d:	85 c9                	test   %ecx,%ecx
+ 31f:	75 0d                	jne    32e <bufwrite+0x13e>
+ 321:	31 c0                	xor    %eax,%eax
+ 323:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 328:	0f 95 c0             	setne  %al
+ 32b:	83 c0 01             	add    $0x1,%eax
+ 32e:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+ 334:	89 81 a0 15 00 00    	mov    %eax,0x15a0(%ecx)
+ 33a:	e9 e3 fe ff ff       	jmp    222 <bufwrite+0x32>
+ 33f:	90                   	nop
+}
+ 340:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 343:	5b                   	pop    %ebx
+ 344:	5e                   	pop    %esi
+ 345:	5f                   	pop    %edi
+ 346:	5d                   	pop    %ebp
+    write(fd, p, n);
+ 347:	e9 61 05 00 00       	jmp    8ad <write>
+ 34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+ 350:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+ 353:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+ 356:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+ 359:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+ 35c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+ 35f:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+ 362:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+ 365:	6a 02                	push   $0x2
+ 367:	50                   	push   %eax
+ 368:	52                   	push   %edx
+ 369:	e8 9b 06 00 00       	call   a09 <writev>
+    ob[fd].n = 0;
+ 36e:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+ 371:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+ 374:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ 37b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 37e:	5b                   	pop    %ebx
+ 37f:	5e                   	pop    %esi
+ 380:	5f                   	pop    %edi
+ 381:	5d                   	pop    %ebp
+ 382:	c3                   	ret
+ 383:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000390 <fflush>:
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	53                   	push   %ebx
+ 394:	83 ec 04             	sub    $0x4,%esp
+ 397:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 39a:	83 f8 0f             	cmp    $0xf,%eax
+ 39d:	77 16                	ja     3b5 <fflush+0x25>
+ 39f:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+ 3a5:	8b 8a a4 15 00 00    	mov    0x15a4(%edx),%ecx
+ 3ab:	8d 9a a0 15 00 00    	lea    0x15a0(%edx),%ebx
+ 3b1:	85 c9                	test   %ecx,%ecx
+ 3b3:	7f 0b                	jg     3c0 <fflush+0x30>
+}
+ 3b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3b8:	c9                   	leave
+ 3b9:	c3                   	ret
+ 3ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 3c0:	83 ec 04             	sub    $0x4,%esp
+ 3c3:	81 c2 a8 15 00 00    	add    $0x15a8,%edx
+ 3c9:	51                   	push   %ecx
+ 3ca:	52                   	push   %edx
+ 3cb:	50                   	push   %eax
+ 3cc:	e8 dc 04 00 00       	call   8ad <write>
+    ob[fd].n = 0;
+ 3d1:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+ 3d8:	83 c4 10             	add    $0x10,%esp
+}
+ 3db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3de:	c9                   	leave
+ 3df:	c3                   	ret
+
+000003e0 <fflushall>:
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 3e4:	31 f6                	xor    %esi,%esi
+{
+ 3e6:	53                   	push   %ebx
+ 3e7:	bb a8 15 00 00       	mov    $0x15a8,%ebx
+ 3ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 3f0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 3f3:	85 c0                	test   %eax,%eax
+ 3f5:	7e 15                	jle    40c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 3f7:	83 ec 04             	sub    $0x4,%esp
+ 3fa:	50                   	push   %eax
+ 3fb:	53                   	push   %ebx
+ 3fc:	56                   	push   %esi
+ 3fd:	e8 ab 04 00 00       	call   8ad <write>
+    ob[fd].n = 0;
+ 402:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 409:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 40c:	83 c6 01             	add    $0x1,%esi
+ 40f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 415:	83 fe 10             	cmp    $0x10,%esi
+ 418:	75 d6                	jne    3f0 <fflushall+0x10>
+}
+ 41a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 41d:	5b                   	pop    %ebx
+ 41e:	5e                   	pop    %esi
+ 41f:	5d                   	pop    %ebp
+ 420:	c3                   	ret
+ 421:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 428:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42f:	90                   	nop
+
+00000430 <fork>:
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 434:	31 f6                	xor    %esi,%esi
+{
+ 436:	53                   	push   %ebx
+ 437:	bb a8 15 00 00       	mov    $0x15a8,%ebx
+ 43c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 440:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 443:	85 c0                	test   %eax,%eax
+ 445:	7e 15                	jle    45c <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 447:	83 ec 04             	sub    $0x4,%esp
+ 44a:	50                   	push   %eax
+ 44b:	53                   	push   %ebx
+ 44c:	56                   	push   %esi
+ 44d:	e8 5b 04 00 00       	call   8ad <write>
+    ob[fd].n = 0;
+ 452:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 459:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 45c:	83 c6 01             	add    $0x1,%esi
+ 45f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 465:	83 fe 10             	cmp    $0x10,%esi
+ 468:	75 d6                	jne    440 <fork+0x10>
+}
+ 46a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 46d:	5b                   	pop    %ebx
+ 46e:	5e                   	pop    %esi
+ 46f:	5d                   	pop    %ebp
+  return _fork();
+ 470:	e9 15 04 00 00       	jmp    88a <_fork>
+ 475:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <exit>:
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+ 486:	e8 55 ff ff ff       	call   3e0 <fflushall>
+  _exit();
+ 48b:	e8 01 04 00 00       	call   891 <_exit>
+
+00000490 <exec>:
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 495:	31 f6                	xor    %esi,%esi
+{
+ 497:	53                   	push   %ebx
+ 498:	bb a8 15 00 00       	mov    $0x15a8,%ebx
+ 49d:	83 ec 1c             	sub    $0x1c,%esp
+ 4a0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 4a6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 4a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 4b0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 4b3:	85 c0                	test   %eax,%eax
+ 4b5:	7e 15                	jle    4cc <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 4b7:	83 ec 04             	sub    $0x4,%esp
+ 4ba:	50                   	push   %eax
+ 4bb:	53                   	push   %ebx
+ 4bc:	56                   	push   %esi
+ 4bd:	e8 eb 03 00 00       	call   8ad <write>
+    ob[fd].n = 0;
+ 4c2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 4c9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 4cc:	83 c6 01             	add    $0x1,%esi
+ 4cf:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 4d5:	83 fe 10             	cmp    $0x10,%esi
+ 4d8:	75 d6                	jne    4b0 <exec+0x20>
+  return _exec(path, argv);
+ 4da:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 4dd:	89 7d 0c             	mov    %edi,0xc(%ebp)
+ 4e0:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ 4e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4e6:	5b                   	pop    %ebx
+ 4e7:	5e                   	pop    %esi
+ 4e8:	5f                   	pop    %edi
+ 4e9:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 4ea:	e9 d3 03 00 00       	jmp    8c2 <_exec>
+ 4ef:	90                   	nop
+
+000004f0 <close>:
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	56                   	push   %esi
+ 4f4:	53                   	push   %ebx
+ 4f5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 4f8:	83 fb 0f             	cmp    $0xf,%ebx
+ 4fb:	77 26                	ja     523 <close+0x33>
+ 4fd:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 503:	8b 90 a4 15 00 00    	mov    0x15a4(%eax),%edx
+ 509:	8d b0 a0 15 00 00    	lea    0x15a0(%eax),%esi
+ 50f:	85 d2                	test   %edx,%edx
+ 511:	7f 25                	jg     538 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+ 513:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 519:	c7 80 a0 15 00 00 00 	movl   $0x0,0x15a0(%eax)
+ 520:	00 00 00 
+  return _close(fd);
+ 523:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 526:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 529:	5b                   	pop    %ebx
+ 52a:	5e                   	pop    %esi
+ 52b:	5d                   	pop    %ebp
+  return _close(fd);
+ 52c:	e9 83 03 00 00       	jmp    8b4 <_close>
+ 531:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 538:	83 ec 04             	sub    $0x4,%esp
+ 53b:	05 a8 15 00 00       	add    $0x15a8,%eax
+ 540:	52                   	push   %edx
+ 541:	50                   	push   %eax
+ 542:	53                   	push   %ebx
+ 543:	e8 65 03 00 00       	call   8ad <write>
+    ob[fd].n = 0;
+ 548:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+ 54f:	83 c4 10             	add    $0x10,%esp
+ 552:	eb bf                	jmp    513 <close+0x23>
+ 554:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 55f:	90                   	nop
+
+00000560 <strcpy>:
+{
+ 560:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+ 561:	31 c0                	xor    %eax,%eax
+{
+ 563:	89 e5                	mov    %esp,%ebp
+ 565:	53                   	push   %ebx
+ 566:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 569:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 56c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 570:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 574:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 577:	83 c0 01             	add    $0x1,%eax
+ 57a:	84 d2                	test   %dl,%dl
+ 57c:	75 f2                	jne    570 <strcpy+0x10>
+}
+ 57e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 581:	89 c8                	mov    %ecx,%eax
+ 583:	c9                   	leave
+ 584:	c3                   	ret
+ 585:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000590 <strcmp>:
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	53                   	push   %ebx
+ 594:	8b 55 08             	mov    0x8(%ebp),%edx
+ 597:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 59a:	0f b6 02             	movzbl (%edx),%eax
+ 59d:	84 c0                	test   %al,%al
+ 59f:	75 17                	jne    5b8 <strcmp+0x28>
+ 5a1:	eb 3a                	jmp    5dd <strcmp+0x4d>
+ 5a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5a7:	90                   	nop
+ 5a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 5ac:	83 c2 01             	add    $0x1,%edx
+ 5af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 5b2:	84 c0                	test   %al,%al
+ 5b4:	74 1a                	je     5d0 <strcmp+0x40>
+    p++, q++;
+ 5b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 5b8:	0f b6 19             	movzbl (%ecx),%ebx
+ 5bb:	38 c3                	cmp    %al,%bl
+ 5bd:	74 e9                	je     5a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 5bf:	29 d8                	sub    %ebx,%eax
+}
+ 5c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5c4:	c9                   	leave
+ 5c5:	c3                   	ret
+ 5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 5d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 5d4:	31 c0                	xor    %eax,%eax
+ 5d6:	29 d8                	sub    %ebx,%eax
+}
+ 5d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5db:	c9                   	leave
+ 5dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 5dd:	0f b6 19             	movzbl (%ecx),%ebx
+ 5e0:	31 c0                	xor    %eax,%eax
+ 5e2:	eb db                	jmp    5bf <strcmp+0x2f>
+ 5e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5ef:	90                   	nop
+
+000005f0 <strlen>:
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+ 5f6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 5f9:	74 15                	je     610 <strlen+0x20>
+ 5fb:	31 c0                	xor    %eax,%eax
+ 5fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 600:	83 c0 01             	add    $0x1,%eax
+ 603:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 607:	89 c1                	mov    %eax,%ecx
+ 609:	75 f5                	jne    600 <strlen+0x10>
+}
+ 60b:	89 c8                	mov    %ecx,%eax
+ 60d:	5d                   	pop    %ebp
+ 60e:	c3                   	ret
+ 60f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 610:	31 c9                	xor    %ecx,%ecx
+}
+ 612:	5d                   	pop    %ebp
+ 613:	89 c8                	mov    %ecx,%eax
+ 615:	c3                   	ret
+ 616:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000620 <memset>:
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	57                   	push   %edi
+ 624:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 627:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 62a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 62d:	89 d7                	mov    %edx,%edi
+ 62f:	fc                   	cld
+ 630:	f3 aa                	rep stos %al,%es:(%edi)
+}
+ 632:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 635:	89 d0                	mov    %edx,%eax
+ 637:	c9                   	leave
+ 638:	c3                   	ret
+ 639:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000640 <strchr>:
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	8b 45 08             	mov    0x8(%ebp),%eax
+ 646:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 64a:	0f b6 10             	movzbl (%eax),%edx
+ 64d:	84 d2                	test   %dl,%dl
+ 64f:	75 12                	jne    663 <strchr+0x23>
+ 651:	eb 1d                	jmp    670 <strchr+0x30>
+ 653:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 657:	90                   	nop
+ 658:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 65c:	83 c0 01             	add    $0x1,%eax
+ 65f:	84 d2                	test   %dl,%dl
+ 661:	74 0d                	je     670 <strchr+0x30>
+    if(*s == c)
+ 663:	38 d1                	cmp    %dl,%cl
+ 665:	75 f1                	jne    658 <strchr+0x18>
+}
+ 667:	5d                   	pop    %ebp
+ 668:	c3                   	ret
+ 669:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 670:	31 c0                	xor    %eax,%eax
+}
+ 672:	5d                   	pop    %ebp
+ 673:	c3                   	ret
+ 674:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 67f:	90                   	nop
+
+00000680 <memchr>:
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+ 683:	8b 55 10             	mov    0x10(%ebp),%edx
+ 686:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 689:	85 d2                	test   %edx,%edx
+ 68b:	74 1b                	je     6a8 <memchr+0x28>
+    if(*p == (char)c)
+ 68d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+ 691:	01 c2                	add    %eax,%edx
+ 693:	eb 0a                	jmp    69f <memchr+0x1f>
+ 695:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+ 698:	83 c0 01             	add    $0x1,%eax
+ 69b:	39 c2                	cmp    %eax,%edx
+ 69d:	74 09                	je     6a8 <memchr+0x28>
+    if(*p == (char)c)
+ 69f:	38 08                	cmp    %cl,(%eax)
+ 6a1:	75 f5                	jne    698 <memchr+0x18>
+}
+ 6a3:	5d                   	pop    %ebp
+ 6a4:	c3                   	ret
+ 6a5:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+ 6a8:	31 c0                	xor    %eax,%eax
+}
+ 6aa:	5d                   	pop    %ebp
+ 6ab:	c3                   	ret
+ 6ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006b0 <gets>:
+{
+ 6b0:	55                   	push   %ebp
+ 6b1:	89 e5                	mov    %esp,%ebp
+ 6b3:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+ 6b4:	31 ff                	xor    %edi,%edi
+{
+ 6b6:	56                   	push   %esi
+ 6b7:	be a8 15 00 00       	mov    $0x15a8,%esi
+ 6bc:	53                   	push   %ebx
+ 6bd:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 6c0:	8b 46 fc             	mov    -0x4(%esi),%eax
+ 6c3:	85 c0                	test   %eax,%eax
+ 6c5:	7e 15                	jle    6dc <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 6c7:	83 ec 04             	sub    $0x4,%esp
+ 6ca:	50                   	push   %eax
+ 6cb:	56                   	push   %esi
+ 6cc:	57                   	push   %edi
+ 6cd:	e8 db 01 00 00       	call   8ad <write>
+    ob[fd].n = 0;
+ 6d2:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+ 6d9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 6dc:	83 c7 01             	add    $0x1,%edi
+ 6df:	81 c6 08 01 00 00    	add    $0x108,%esi
+ 6e5:	83 ff 10             	cmp    $0x10,%edi
+ 6e8:	75 d6                	jne    6c0 <gets+0x10>
+  for(i=0; i+1 < max; ){
+ 6ea:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+ 6ec:	8d 75 e7             	lea    -0x19(%ebp),%esi
+ 6ef:	eb 2e                	jmp    71f <gets+0x6f>
+ 6f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6f8:	83 ec 04             	sub    $0x4,%esp
+ 6fb:	6a 01                	push   $0x1
+ 6fd:	56                   	push   %esi
+ 6fe:	6a 00                	push   $0x0
+ 700:	e8 a1 01 00 00       	call   8a6 <read>
+    if(cc < 1)
+ 705:	83 c4 10             	add    $0x10,%esp
+ 708:	85 c0                	test   %eax,%eax
+ 70a:	7e 1d                	jle    729 <gets+0x79>
+    buf[i++] = c;
+ 70c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 710:	8b 55 08             	mov    0x8(%ebp),%edx
+ 713:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 717:	3c 0a                	cmp    $0xa,%al
+ 719:	74 10                	je     72b <gets+0x7b>
+ 71b:	3c 0d                	cmp    $0xd,%al
+ 71d:	74 0c                	je     72b <gets+0x7b>
+  for(i=0; i+1 < max; ){
+ 71f:	89 df                	mov    %ebx,%edi
+ 721:	83 c3 01             	add    $0x1,%ebx
+ 724:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 727:	7c cf                	jl     6f8 <gets+0x48>
+ 729:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 72b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 72e:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 732:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 735:	5b                   	pop    %ebx
+ 736:	5e                   	pop    %esi
+ 737:	5f                   	pop    %edi
+ 738:	5d                   	pop    %ebp
+ 739:	c3                   	ret
+ 73a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000740 <stat>:
+{
+ 740:	55                   	push   %ebp
+ 741:	89 e5                	mov    %esp,%ebp
+ 743:	57                   	push   %edi
+ 744:	56                   	push   %esi
+ 745:	53                   	push   %ebx
+ 746:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+ 749:	6a 00                	push   $0x0
+ 74b:	ff 75 08             	push   0x8(%ebp)
+ 74e:	e8 76 01 00 00       	call   8c9 <open>
+  if(fd < 0)
+ 753:	83 c4 10             	add    $0x10,%esp
+ 756:	85 c0                	test   %eax,%eax
+ 758:	78 76                	js     7d0 <stat+0x90>
+  r = fstat(fd, st);
+ 75a:	83 ec 08             	sub    $0x8,%esp
+ 75d:	ff 75 0c             	push   0xc(%ebp)
+ 760:	89 c3                	mov    %eax,%ebx
+ 762:	50                   	push   %eax
+ 763:	e8 7f 01 00 00       	call   8e7 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 768:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 76b:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 76d:	83 fb 0f             	cmp    $0xf,%ebx
+ 770:	7f 40                	jg     7b2 <stat+0x72>
+ 772:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 778:	8b 90 a4 15 00 00    	mov    0x15a4(%eax),%edx
+ 77e:	8d b8 a0 15 00 00    	lea    0x15a0(%eax),%edi
+ 784:	85 d2                	test   %edx,%edx
+ 786:	7e 1a                	jle    7a2 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 788:	83 ec 04             	sub    $0x4,%esp
+ 78b:	05 a8 15 00 00       	add    $0x15a8,%eax
+ 790:	52                   	push   %edx
+ 791:	50                   	push   %eax
+ 792:	53                   	push   %ebx
+ 793:	e8 15 01 00 00       	call   8ad <write>
+    ob[fd].n = 0;
+ 798:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+ 79f:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+ 7a2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 7a8:	c7 80 a0 15 00 00 00 	movl   $0x0,0x15a0(%eax)
+ 7af:	00 00 00 
+  return _close(fd);
+ 7b2:	83 ec 0c             	sub    $0xc,%esp
+ 7b5:	53                   	push   %ebx
+ 7b6:	e8 f9 00 00 00       	call   8b4 <_close>
+ 7bb:	83 c4 10             	add    $0x10,%esp
+}
+ 7be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7c1:	89 f0                	mov    %esi,%eax
+ 7c3:	5b                   	pop    %ebx
+ 7c4:	5e                   	pop    %esi
+ 7c5:	5f                   	pop    %edi
+ 7c6:	5d                   	pop    %ebp
+ 7c7:	c3                   	ret
+ 7c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7cf:	90                   	nop
+    return -1;
+ 7d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 7d5:	eb e7                	jmp    7be <stat+0x7e>
+ 7d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7de:	66 90                	xchg   %ax,%ax
+
+000007e0 <atoi>:
+{
+ 7e0:	55                   	push   %ebp
+ 7e1:	89 e5                	mov    %esp,%ebp
+ 7e3:	53                   	push   %ebx
+ 7e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 7e7:	0f be 02             	movsbl (%edx),%eax
+ 7ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 7ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 7f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 7f5:	77 1e                	ja     815 <atoi+0x35>
+ 7f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 800:	83 c2 01             	add    $0x1,%edx
+ 803:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 806:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 80a:	0f be 02             	movsbl (%edx),%eax
+ 80d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 810:	80 fb 09             	cmp    $0x9,%bl
+ 813:	76 eb                	jbe    800 <atoi+0x20>
+}
+ 815:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 818:	89 c8                	mov    %ecx,%eax
+ 81a:	c9                   	leave
+ 81b:	c3                   	ret
+ 81c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000820 <memmove>:
+{
+ 820:	55                   	push   %ebp
+ 821:	89 e5                	mov    %esp,%ebp
+ 823:	57                   	push   %edi
+ 824:	56                   	push   %esi
+ 825:	8b 45 10             	mov    0x10(%ebp),%eax
+ 828:	8b 55 08             	mov    0x8(%ebp),%edx
+ 82b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 82e:	85 c0                	test   %eax,%eax
+ 830:	7e 13                	jle    845 <memmove+0x25>
+ 832:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 834:	89 d7                	mov    %edx,%edi
+ 836:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 83d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 840:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 841:	39 f8                	cmp    %edi,%eax
+ 843:	75 fb                	jne    840 <memmove+0x20>
+  return vdst;
+}
+ 845:	5e                   	pop    %esi
+ 846:	89 d0                	mov    %edx,%eax
+ 848:	5f                   	pop    %edi
+ 849:	5d                   	pop    %ebp
+ 84a:	c3                   	ret
+
+0000084b <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+ 84b:	83 3d 90 15 00 00 00 	cmpl   $0x0,0x1590
+  jle 1f
+ 852:	7e 0a                	jle    85e <syscallentry+0x13>
+  movl %esp, %ecx
+ 854:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 856:	ba 5d 08 00 00       	mov    $0x85d,%edx
+  sysenter
+ 85b:	0f 34                	sysenter
+2:
+  ret
+ 85d:	c3                   	ret
+1:
+  jl 3f
+ 85e:	7c 27                	jl     887 <syscallentry+0x3c>
+  pushal
+ 860:	60                   	pusha
+  movl $1, %eax
+ 861:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 866:	0f a2                	cpuid
+  movl $-1, sysentermode
+ 868:	c7 05 90 15 00 00 ff 	movl   $0xffffffff,0x1590
+ 86f:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 872:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+ 878:	74 0a                	je     884 <syscallentry+0x39>
+  movl $1, sysentermode
+ 87a:	c7 05 90 15 00 00 01 	movl   $0x1,0x1590
+ 881:	00 00 00 
+4:
+  popal
+ 884:	61                   	popa
+  jmp syscallentry
+ 885:	eb c4                	jmp    84b <syscallentry>
+3:
+  int $T_SYSCALL
+ 887:	cd 40                	int    $0x40
+  ret
+ 889:	c3                   	ret
+
+0000088a <_fork>:
+
+SYSCALLAS(_fork, fork)
+ 88a:	b8 01 00 00 00       	mov    $0x1,%eax
+ 88f:	eb ba                	jmp    84b <syscallentry>
+
+00000891 <_exit>:
+SYSCALLAS(_exit, exit)
+ 891:	b8 02 00 00 00       	mov    $0x2,%eax
+ 896:	eb b3                	jmp    84b <syscallentry>
+
+00000898 <wait>:
+SYSCALL(wait)
+ 898:	b8 03 00 00 00       	mov    $0x3,%eax
+ 89d:	eb ac                	jmp    84b <syscallentry>
+
+0000089f <pipe>:
+SYSCALL(pipe)
+ 89f:	b8 04 00 00 00       	mov    $0x4,%eax
+ 8a4:	eb a5                	jmp    84b <syscallentry>
+
+000008a6 <read>:
+SYSCALL(read)
+ 8a6:	b8 05 00 00 00       	mov    $0x5,%eax
+ 8ab:	eb 9e                	jmp    84b <syscallentry>
+
+000008ad <write>:
+SYSCALL(write)
+ 8ad:	b8 10 00 00 00       	mov    $0x10,%eax
+ 8b2:	eb 97                	jmp    84b <syscallentry>
+
+000008b4 <_close>:
+SYSCALLAS(_close, close)
+ 8b4:	b8 15 00 00 00       	mov    $0x15,%eax
+ 8b9:	eb 90                	jmp    84b <syscallentry>
+
+000008bb <kill>:
+SYSCALL(kill)
+ 8bb:	b8 06 00 00 00       	mov    $0x6,%eax
+ 8c0:	eb 89                	jmp    84b <syscallentry>
+
+000008c2 <_exec>:
+SYSCALLAS(_exec, exec)
+ 8c2:	b8 07 00 00 00       	mov    $0x7,%eax
+ 8c7:	eb 82                	jmp    84b <syscallentry>
+
+000008c9 <open>:
+SYSCALL(open)
+ 8c9:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 8ce:	e9 78 ff ff ff       	jmp    84b <syscallentry>
+
+000008d3 <mknod>:
+SYSCALL(mknod)
+ 8d3:	b8 11 00 00 00       	mov    $0x11,%eax
+ 8d8:	e9 6e ff ff ff       	jmp    84b <syscallentry>
+
+000008dd <unlink>:
+SYSCALL(unlink)
+ 8dd:	b8 12 00 00 00       	mov    $0x12,%eax
+ 8e2:	e9 64 ff ff ff       	jmp    84b <syscallentry>
+
+000008e7 <fstat>:
+SYSCALL(fstat)
+ 8e7:	b8 08 00 00 00       	mov    $0x8,%eax
+ 8ec:	e9 5a ff ff ff       	jmp    84b <syscallentry>
+
+000008f1 <link>:
+SYSCALL(link)
+ 8f1:	b8 13 00 00 00       	mov    $0x13,%eax
+ 8f6:	e9 50 ff ff ff       	jmp    84b <syscallentry>
+
+000008fb <mkdir>:
+SYSCALL(mkdir)
+ 8fb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 900:	e9 46 ff ff ff       	jmp    84b <syscallentry>
+
+00000905 <chdir>:
+SYSCALL(chdir)
+ 905:	b8 09 00 00 00       	mov    $0x9,%eax
+ 90a:	e9 3c ff ff ff       	jmp    84b <syscallentry>
+
+0000090f <dup>:
+SYSCALL(dup)
+ 90f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 914:	e9 32 ff ff ff       	jmp    84b <syscallentry>
+
+00000919 <getpid>:
+SYSCALL(getpid)
+ 919:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 91e:	e9 28 ff ff ff       	jmp    84b <syscallentry>
+
+00000923 <sbrk>:
+SYSCALL(sbrk)
+ 923:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 928:	e9 1e ff ff ff       	jmp    84b <syscallentry>
+
+0000092d <sleep>:
+SYSCALL(sleep)
+ 92d:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 932:	e9 14 ff ff ff       	jmp    84b <syscallentry>
+
+00000937 <uptime>:
+SYSCALL(uptime)
+ 937:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 93c:	e9 0a ff ff ff       	jmp    84b <syscallentry>
+
+00000941 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+ 941:	b8 16 00 00 00       	mov    $0x16,%eax
+ 946:	e9 00 ff ff ff       	jmp    84b <syscallentry>
+
+0000094b <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+ 94b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 950:	e9 f6 fe ff ff       	jmp    84b <syscallentry>
+
+00000955 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+ 955:	b8 18 00 00 00       	mov    $0x18,%eax
+ 95a:	e9 ec fe ff ff       	jmp    84b <syscallentry>
+
+0000095f <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+ 95f:	b8 19 00 00 00       	mov    $0x19,%eax
+ 964:	e9 e2 fe ff ff       	jmp    84b <syscallentry>
+
+00000969 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+ 969:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 96e:	e9 d8 fe ff ff       	jmp    84b <syscallentry>
+
+00000973 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+ 973:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 978:	e9 ce fe ff ff       	jmp    84b <syscallentry>
+
+0000097d <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+ 97d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 982:	e9 c4 fe ff ff       	jmp    84b <syscallentry>
+
+00000987 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+ 987:	b8 20 00 00 00       	mov    $0x20,%eax
+ 98c:	e9 ba fe ff ff       	jmp    84b <syscallentry>
+
+00000991 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+ 991:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 996:	e9 b0 fe ff ff       	jmp    84b <syscallentry>
+
+0000099b <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+ 99b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 9a0:	e9 a6 fe ff ff       	jmp    84b <syscallentry>
+
+000009a5 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+ 9a5:	b8 21 00 00 00       	mov    $0x21,%eax
+ 9aa:	e9 9c fe ff ff       	jmp    84b <syscallentry>
+
+000009af <yield>:
+SYSCALL(yield) // yield the CPU to another process
+ 9af:	b8 22 00 00 00       	mov    $0x22,%eax
+ 9b4:	e9 92 fe ff ff       	jmp    84b <syscallentry>
+
+000009b9 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+ 9b9:	b8 23 00 00 00       	mov    $0x23,%eax
+ 9be:	e9 88 fe ff ff       	jmp    84b <syscallentry>
+
+000009c3 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+ 9c3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 9c8:	e9 7e fe ff ff       	jmp    84b <syscallentry>
+
+000009cd <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+ 9cd:	b8 25 00 00 00       	mov    $0x25,%eax
+ 9d2:	e9 74 fe ff ff       	jmp    84b <syscallentry>
+
+000009d7 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+ 9d7:	b8 26 00 00 00       	mov    $0x26,%eax
+ 9dc:	e9 6a fe ff ff       	jmp    84b <syscallentry>
+
+000009e1 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+ 9e1:	b8 27 00 00 00       	mov    $0x27,%eax
+ 9e6:	e9 60 fe ff ff       	jmp    84b <syscallentry>
+
+000009eb <mmap>:
+SYSCALL(mmap) // map a file into memory
+ 9eb:	b8 28 00 00 00       	mov    $0x28,%eax
+ 9f0:	e9 56 fe ff ff       	jmp    84b <syscallentry>
+
+000009f5 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+ 9f5:	b8 29 00 00 00       	mov    $0x29,%eax
+ 9fa:	e9 4c fe ff ff       	jmp    84b <syscallentry>
+
+000009ff <readv>:
+SYSCALL(readv) // read into several buffers
+ 9ff:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ a04:	e9 42 fe ff ff       	jmp    84b <syscallentry>
+
+00000a09 <writev>:
+SYSCALL(writev) // write from several buffers
+ a09:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ a0e:	e9 38 fe ff ff       	jmp    84b <syscallentry>
+
+00000a13 <pread>:
+SYSCALL(pread) // read at an offset
+ a13:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ a18:	e9 2e fe ff ff       	jmp    84b <syscallentry>
+
+00000a1d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+ a1d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ a22:	e9 24 fe ff ff       	jmp    84b <syscallentry>
+
+00000a27 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+ a27:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ a2c:	e9 1a fe ff ff       	jmp    84b <syscallentry>
+
+00000a31 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+ a31:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ a36:	e9 10 fe ff ff       	jmp    84b <syscallentry>
+
+00000a3b <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+ a3b:	b8 30 00 00 00       	mov    $0x30,%eax
+ a40:	e9 06 fe ff ff       	jmp    84b <syscallentry>
+
+00000a45 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+ a45:	b8 31 00 00 00       	mov    $0x31,%eax
+ a4a:	e9 fc fd ff ff       	jmp    84b <syscallentry>
+
+00000a4f <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+ a4f:	b8 32 00 00 00       	mov    $0x32,%eax
+ a54:	e9 f2 fd ff ff       	jmp    84b <syscallentry>
+
+00000a59 <profread>:
+SYSCALL(profread) // drain profiler samples
+ a59:	b8 33 00 00 00       	mov    $0x33,%eax
+ a5e:	e9 e8 fd ff ff       	jmp    84b <syscallentry>
+
+00000a63 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+ a63:	b8 34 00 00 00       	mov    $0x34,%eax
+ a68:	e9 de fd ff ff       	jmp    84b <syscallentry>
+
+00000a6d <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+ a6d:	b8 35 00 00 00       	mov    $0x35,%eax
+ a72:	e9 d4 fd ff ff       	jmp    84b <syscallentry>
+
+00000a77 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+ a77:	b8 36 00 00 00       	mov    $0x36,%eax
+ a7c:	e9 ca fd ff ff       	jmp    84b <syscallentry>
+
+00000a81 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+ a81:	b8 37 00 00 00       	mov    $0x37,%eax
+ a86:	e9 c0 fd ff ff       	jmp    84b <syscallentry>
+ a8b:	66 90                	xchg   %ax,%ax
+ a8d:	66 90                	xchg   %ax,%ax
+ a8f:	90                   	nop
+
+00000a90 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a90:	55                   	push   %ebp
+ a91:	89 e5                	mov    %esp,%ebp
+ a93:	57                   	push   %edi
+ a94:	56                   	push   %esi
+ a95:	53                   	push   %ebx
+ a96:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ a98:	89 d1                	mov    %edx,%ecx
+{
+ a9a:	83 ec 3c             	sub    $0x3c,%esp
+ a9d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ aa0:	85 d2                	test   %edx,%edx
+ aa2:	0f 89 80 00 00 00    	jns    b28 <printint+0x98>
+ aa8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ aac:	74 7a                	je     b28 <printint+0x98>
+    x = -xx;
+ aae:	f7 d9                	neg    %ecx
+    neg = 1;
+ ab0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ ab5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ ab8:	31 f6                	xor    %esi,%esi
+ aba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ ac0:	89 c8                	mov    %ecx,%eax
+ ac2:	31 d2                	xor    %edx,%edx
+ ac4:	89 f7                	mov    %esi,%edi
+ ac6:	f7 f3                	div    %ebx
+ ac8:	8d 76 01             	lea    0x1(%esi),%esi
+ acb:	0f b6 92 e0 10 00 00 	movzbl 0x10e0(%edx),%edx
+ ad2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ ad6:	89 ca                	mov    %ecx,%edx
+ ad8:	89 c1                	mov    %eax,%ecx
+ ada:	39 da                	cmp    %ebx,%edx
+ adc:	73 e2                	jae    ac0 <printint+0x30>
+  if(neg)
+ ade:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ ae1:	85 c0                	test   %eax,%eax
+ ae3:	74 07                	je     aec <printint+0x5c>
+    buf[i++] = '-';
+ ae5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ aea:	89 f7                	mov    %esi,%edi
+ aec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ aef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ af2:	01 df                	add    %ebx,%edi
+ af4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ af8:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+ afb:	83 ec 04             	sub    $0x4,%esp
+ afe:	88 45 d7             	mov    %al,-0x29(%ebp)
+ b01:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ b04:	6a 01                	push   $0x1
+ b06:	50                   	push   %eax
+ b07:	56                   	push   %esi
+ b08:	e8 e3 f6 ff ff       	call   1f0 <bufwrite>
+  while(--i >= 0)
+ b0d:	89 f8                	mov    %edi,%eax
+ b0f:	83 c4 10             	add    $0x10,%esp
+ b12:	83 ef 01             	sub    $0x1,%edi
+ b15:	39 d8                	cmp    %ebx,%eax
+ b17:	75 df                	jne    af8 <printint+0x68>
+}
+ b19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b1c:	5b                   	pop    %ebx
+ b1d:	5e                   	pop    %esi
+ b1e:	5f                   	pop    %edi
+ b1f:	5d                   	pop    %ebp
+ b20:	c3                   	ret
+ b21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ b28:	31 c0                	xor    %eax,%eax
+ b2a:	eb 89                	jmp    ab5 <printint+0x25>
+ b2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b30 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ b30:	55                   	push   %ebp
+ b31:	89 e5                	mov    %esp,%ebp
+ b33:	57                   	push   %edi
+ b34:	56                   	push   %esi
+ b35:	53                   	push   %ebx
+ b36:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ b39:	8b 45 0c             	mov    0xc(%ebp),%eax
+ b3c:	0f b6 18             	movzbl (%eax),%ebx
+ b3f:	84 db                	test   %bl,%bl
+ b41:	74 6c                	je     baf <printf+0x7f>
+ b43:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+ b46:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ b49:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ b4b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ b4e:	eb 26                	jmp    b76 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ b50:	83 f8 25             	cmp    $0x25,%eax
+ b53:	74 4b                	je     ba0 <printf+0x70>
+  bufwrite(fd, &c, 1);
+ b55:	83 ec 04             	sub    $0x4,%esp
+ b58:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ b5b:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ b5e:	6a 01                	push   $0x1
+ b60:	50                   	push   %eax
+ b61:	ff 75 08             	push   0x8(%ebp)
+ b64:	e8 87 f6 ff ff       	call   1f0 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+ b69:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ b6c:	0f b6 1f             	movzbl (%edi),%ebx
+ b6f:	83 c7 01             	add    $0x1,%edi
+ b72:	84 db                	test   %bl,%bl
+ b74:	74 39                	je     baf <printf+0x7f>
+    c = fmt[i] & 0xff;
+ b76:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ b79:	85 f6                	test   %esi,%esi
+ b7b:	74 d3                	je     b50 <printf+0x20>
+      }
+    } else if(state == '%'){
+ b7d:	83 fe 25             	cmp    $0x25,%esi
+ b80:	75 ea                	jne    b6c <printf+0x3c>
+      if(c == 'd'){
+ b82:	83 f8 25             	cmp    $0x25,%eax
+ b85:	0f 84 d5 01 00 00    	je     d60 <printf+0x230>
+ b8b:	83 e8 63             	sub    $0x63,%eax
+ b8e:	83 f8 15             	cmp    $0x15,%eax
+ b91:	77 45                	ja     bd8 <printf+0xa8>
+ b93:	ff 24 85 88 10 00 00 	jmp    *0x1088(,%eax,4)
+ b9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+ ba0:	0f b6 1f             	movzbl (%edi),%ebx
+ ba3:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+ ba6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ bab:	84 db                	test   %bl,%bl
+ bad:	75 c7                	jne    b76 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+ baf:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+ bb3:	74 0b                	je     bc0 <printf+0x90>
+    fflush(fd);
+}
+ bb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ bb8:	5b                   	pop    %ebx
+ bb9:	5e                   	pop    %esi
+ bba:	5f                   	pop    %edi
+ bbb:	5d                   	pop    %ebp
+ bbc:	c3                   	ret
+ bbd:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+ bc0:	83 ec 0c             	sub    $0xc,%esp
+ bc3:	6a 02                	push   $0x2
+ bc5:	e8 c6 f7 ff ff       	call   390 <fflush>
+ bca:	83 c4 10             	add    $0x10,%esp
+}
+ bcd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ bd0:	5b                   	pop    %ebx
+ bd1:	5e                   	pop    %esi
+ bd2:	5f                   	pop    %edi
+ bd3:	5d                   	pop    %ebp
+ bd4:	c3                   	ret
+ bd5:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+ bd8:	83 ec 04             	sub    $0x4,%esp
+ bdb:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ bde:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+ be2:	6a 01                	push   $0x1
+ be4:	52                   	push   %edx
+ be5:	89 55 c0             	mov    %edx,-0x40(%ebp)
+ be8:	ff 75 08             	push   0x8(%ebp)
+ beb:	e8 00 f6 ff ff       	call   1f0 <bufwrite>
+ bf0:	83 c4 0c             	add    $0xc,%esp
+ bf3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ bf6:	6a 01                	push   $0x1
+ bf8:	8b 55 c0             	mov    -0x40(%ebp),%edx
+ bfb:	52                   	push   %edx
+      state = 0;
+ bfc:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+ bfe:	ff 75 08             	push   0x8(%ebp)
+ c01:	e8 ea f5 ff ff       	call   1f0 <bufwrite>
+        putc(fd, c);
+ c06:	83 c4 10             	add    $0x10,%esp
+ c09:	e9 5e ff ff ff       	jmp    b6c <printf+0x3c>
+ c0e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+ c10:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ c13:	83 ec 0c             	sub    $0xc,%esp
+ c16:	b9 10 00 00 00       	mov    $0x10,%ecx
+ c1b:	8b 16                	mov    (%esi),%edx
+ c1d:	6a 00                	push   $0x0
+ c1f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+ c22:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+ c25:	e8 66 fe ff ff       	call   a90 <printint>
+        ap++;
+ c2a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ c2d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c30:	31 f6                	xor    %esi,%esi
+ c32:	e9 35 ff ff ff       	jmp    b6c <printf+0x3c>
+ c37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c3e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+ c40:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ c43:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ c45:	83 c0 04             	add    $0x4,%eax
+ c48:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+ c4b:	b8 80 10 00 00       	mov    $0x1080,%eax
+ c50:	85 db                	test   %ebx,%ebx
+ c52:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+ c55:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+ c58:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+ c5a:	53                   	push   %ebx
+ c5b:	e8 90 f9 ff ff       	call   5f0 <strlen>
+ c60:	83 c4 0c             	add    $0xc,%esp
+ c63:	50                   	push   %eax
+ c64:	53                   	push   %ebx
+ c65:	ff 75 08             	push   0x8(%ebp)
+ c68:	e8 83 f5 ff ff       	call   1f0 <bufwrite>
+ c6d:	83 c4 10             	add    $0x10,%esp
+ c70:	e9 f7 fe ff ff       	jmp    b6c <printf+0x3c>
+ c75:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ c78:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+ c7b:	83 ec 04             	sub    $0x4,%esp
+ c7e:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+ c81:	8b 06                	mov    (%esi),%eax
+        ap++;
+ c83:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+ c86:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+ c89:	6a 01                	push   $0x1
+ c8b:	52                   	push   %edx
+ c8c:	ff 75 08             	push   0x8(%ebp)
+ c8f:	e8 5c f5 ff ff       	call   1f0 <bufwrite>
+        ap++;
+ c94:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ c97:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c9a:	31 f6                	xor    %esi,%esi
+ c9c:	e9 cb fe ff ff       	jmp    b6c <printf+0x3c>
+ ca1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+ ca8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ cab:	83 ec 0c             	sub    $0xc,%esp
+ cae:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ cb3:	8b 16                	mov    (%esi),%edx
+ cb5:	6a 01                	push   $0x1
+ cb7:	e9 63 ff ff ff       	jmp    c1f <printf+0xef>
+ cbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+ cc0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ cc3:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ cc6:	89 7d c0             	mov    %edi,-0x40(%ebp)
+ cc9:	89 55 bc             	mov    %edx,-0x44(%ebp)
+ ccc:	8b 18                	mov    (%eax),%ebx
+ cce:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+ cd1:	31 c0                	xor    %eax,%eax
+ cd3:	89 c7                	mov    %eax,%edi
+ cd5:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+ cd8:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+ cdd:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+ cdf:	f7 e1                	mul    %ecx
+ ce1:	c1 ea 03             	shr    $0x3,%edx
+ ce4:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ ce7:	89 d1                	mov    %edx,%ecx
+ ce9:	01 c0                	add    %eax,%eax
+ ceb:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ ced:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+ cef:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ cf1:	be 0a 00 00 00       	mov    $0xa,%esi
+ cf6:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+ cf8:	89 da                	mov    %ebx,%edx
+ cfa:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+ cfc:	89 fe                	mov    %edi,%esi
+ cfe:	83 c7 01             	add    $0x1,%edi
+ d01:	8d 42 30             	lea    0x30(%edx),%eax
+ d04:	89 da                	mov    %ebx,%edx
+ d06:	8d 14 92             	lea    (%edx,%edx,4),%edx
+ d09:	01 d2                	add    %edx,%edx
+ d0b:	29 d0                	sub    %edx,%eax
+ d0d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+ d11:	89 c8                	mov    %ecx,%eax
+ d13:	09 d8                	or     %ebx,%eax
+ d15:	75 c1                	jne    cd8 <printf+0x1a8>
+ d17:	8b 55 bc             	mov    -0x44(%ebp),%edx
+ d1a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ d1d:	01 d6                	add    %edx,%esi
+ d1f:	89 f7                	mov    %esi,%edi
+ d21:	89 d6                	mov    %edx,%esi
+ d23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d27:	90                   	nop
+    putc(fd, buf[i]);
+ d28:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+ d2b:	83 ec 04             	sub    $0x4,%esp
+ d2e:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+ d31:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+ d34:	6a 01                	push   $0x1
+ d36:	50                   	push   %eax
+ d37:	53                   	push   %ebx
+ d38:	e8 b3 f4 ff ff       	call   1f0 <bufwrite>
+  while(--i >= 0)
+ d3d:	89 fa                	mov    %edi,%edx
+ d3f:	83 c4 10             	add    $0x10,%esp
+ d42:	83 ef 01             	sub    $0x1,%edi
+ d45:	39 d6                	cmp    %edx,%esi
+ d47:	75 df                	jne    d28 <printf+0x1f8>
+        ap += 2;
+ d49:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+ d4d:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+ d50:	31 f6                	xor    %esi,%esi
+ d52:	e9 15 fe ff ff       	jmp    b6c <printf+0x3c>
+ d57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d5e:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+ d60:	83 ec 04             	sub    $0x4,%esp
+ d63:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ d66:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ d69:	6a 01                	push   $0x1
+ d6b:	e9 8b fe ff ff       	jmp    bfb <printf+0xcb>
+
+00000d70 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ d70:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d71:	a1 20 26 00 00       	mov    0x2620,%eax
+{
+ d76:	89 e5                	mov    %esp,%ebp
+ d78:	57                   	push   %edi
+ d79:	56                   	push   %esi
+ d7a:	53                   	push   %ebx
+ d7b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ d7e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d88:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d8a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d8c:	39 ca                	cmp    %ecx,%edx
+ d8e:	73 30                	jae    dc0 <free+0x50>
+ d90:	39 c1                	cmp    %eax,%ecx
+ d92:	72 04                	jb     d98 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d94:	39 c2                	cmp    %eax,%edx
+ d96:	72 f0                	jb     d88 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ d98:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ d9b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ d9e:	39 f8                	cmp    %edi,%eax
+ da0:	74 2e                	je     dd0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ da2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ da5:	8b 42 04             	mov    0x4(%edx),%eax
+ da8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ dab:	39 f1                	cmp    %esi,%ecx
+ dad:	74 38                	je     de7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ daf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ db1:	5b                   	pop    %ebx
+  freep = p;
+ db2:	89 15 20 26 00 00    	mov    %edx,0x2620
+}
+ db8:	5e                   	pop    %esi
+ db9:	5f                   	pop    %edi
+ dba:	5d                   	pop    %ebp
+ dbb:	c3                   	ret
+ dbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ dc0:	39 c1                	cmp    %eax,%ecx
+ dc2:	72 d0                	jb     d94 <free+0x24>
+ dc4:	eb c2                	jmp    d88 <free+0x18>
+ dc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dcd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ dd0:	03 70 04             	add    0x4(%eax),%esi
+ dd3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ dd6:	8b 02                	mov    (%edx),%eax
+ dd8:	8b 00                	mov    (%eax),%eax
+ dda:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ ddd:	8b 42 04             	mov    0x4(%edx),%eax
+ de0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ de3:	39 f1                	cmp    %esi,%ecx
+ de5:	75 c8                	jne    daf <free+0x3f>
+    p->s.size += bp->s.size;
+ de7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ dea:	89 15 20 26 00 00    	mov    %edx,0x2620
+    p->s.size += bp->s.size;
+ df0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ df3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ df6:	89 0a                	mov    %ecx,(%edx)
+}
+ df8:	5b                   	pop    %ebx
+ df9:	5e                   	pop    %esi
+ dfa:	5f                   	pop    %edi
+ dfb:	5d                   	pop    %ebp
+ dfc:	c3                   	ret
+ dfd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e00 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ e00:	55                   	push   %ebp
+ e01:	89 e5                	mov    %esp,%ebp
+ e03:	57                   	push   %edi
+ e04:	56                   	push   %esi
+ e05:	53                   	push   %ebx
+ e06:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e09:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ e0c:	8b 15 20 26 00 00    	mov    0x2620,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e12:	8d 78 07             	lea    0x7(%eax),%edi
+ e15:	c1 ef 03             	shr    $0x3,%edi
+ e18:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ e1b:	85 d2                	test   %edx,%edx
+ e1d:	0f 84 8d 00 00 00    	je     eb0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e23:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ e25:	8b 48 04             	mov    0x4(%eax),%ecx
+ e28:	39 f9                	cmp    %edi,%ecx
+ e2a:	73 64                	jae    e90 <malloc+0x90>
+  if(nu < 4096)
+ e2c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ e31:	39 df                	cmp    %ebx,%edi
+ e33:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ e36:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ e3d:	eb 0a                	jmp    e49 <malloc+0x49>
+ e3f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e40:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ e42:	8b 48 04             	mov    0x4(%eax),%ecx
+ e45:	39 f9                	cmp    %edi,%ecx
+ e47:	73 47                	jae    e90 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ e49:	89 c2                	mov    %eax,%edx
+ e4b:	39 05 20 26 00 00    	cmp    %eax,0x2620
+ e51:	75 ed                	jne    e40 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ e53:	83 ec 0c             	sub    $0xc,%esp
+ e56:	56                   	push   %esi
+ e57:	e8 c7 fa ff ff       	call   923 <sbrk>
+  if(p == (char*)-1)
+ e5c:	83 c4 10             	add    $0x10,%esp
+ e5f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ e62:	74 1c                	je     e80 <malloc+0x80>
+  hp->s.size = nu;
+ e64:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ e67:	83 ec 0c             	sub    $0xc,%esp
+ e6a:	83 c0 08             	add    $0x8,%eax
+ e6d:	50                   	push   %eax
+ e6e:	e8 fd fe ff ff       	call   d70 <free>
+  return freep;
+ e73:	8b 15 20 26 00 00    	mov    0x2620,%edx
+      if((p = morecore(nunits)) == 0)
+ e79:	83 c4 10             	add    $0x10,%esp
+ e7c:	85 d2                	test   %edx,%edx
+ e7e:	75 c0                	jne    e40 <malloc+0x40>
+        return 0;
+  }
+}
+ e80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ e83:	31 c0                	xor    %eax,%eax
+}
+ e85:	5b                   	pop    %ebx
+ e86:	5e                   	pop    %esi
+ e87:	5f                   	pop    %edi
+ e88:	5d                   	pop    %ebp
+ e89:	c3                   	ret
+ e8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ e90:	39 cf                	cmp    %ecx,%edi
+ e92:	74 4c                	je     ee0 <malloc+0xe0>
+        p->s.size -= nunits;
+ e94:	29 f9                	sub    %edi,%ecx
+ e96:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ e99:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ e9c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ e9f:	89 15 20 26 00 00    	mov    %edx,0x2620
+}
+ ea5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ ea8:	83 c0 08             	add    $0x8,%eax
+}
+ eab:	5b                   	pop    %ebx
+ eac:	5e                   	pop    %esi
+ ead:	5f                   	pop    %edi
+ eae:	5d                   	pop    %ebp
+ eaf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ eb0:	c7 05 20 26 00 00 24 	movl   $0x2624,0x2620
+ eb7:	26 00 00 
+    base.s.size = 0;
+ eba:	b8 24 26 00 00       	mov    $0x2624,%eax
+    base.s.ptr = freep = prevp = &base;
+ ebf:	c7 05 24 26 00 00 24 	movl   $0x2624,0x2624
+ ec6:	26 00 00 
+    base.s.size = 0;
+ ec9:	c7 05 28 26 00 00 00 	movl   $0x0,0x2628
+ ed0:	00 00 00 
+    if(p->s.size >= nunits){
+ ed3:	e9 54 ff ff ff       	jmp    e2c <malloc+0x2c>
+ ed8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ edf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ee0:	8b 08                	mov    (%eax),%ecx
+ ee2:	89 0a                	mov    %ecx,(%edx)
+ ee4:	eb b9                	jmp    e9f <malloc+0x9f>
+ ee6:	66 90                	xchg   %ax,%ax
+ ee8:	66 90                	xchg   %ax,%ax
+ eea:	66 90                	xchg   %ax,%ax
+ eec:	66 90                	xchg   %ax,%ax
+ eee:	66 90                	xchg   %ax,%ax
+
+00000ef0 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+ ef0:	55                   	push   %ebp
+ ef1:	89 e5                	mov    %esp,%ebp
+ ef3:	57                   	push   %edi
+ ef4:	56                   	push   %esi
+ ef5:	be 01 00 00 00       	mov    $0x1,%esi
+ efa:	53                   	push   %ebx
+ efb:	83 ec 28             	sub    $0x28,%esp
+ efe:	8b 45 0c             	mov    0xc(%ebp),%eax
+ f01:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ f04:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+ f07:	68 00 98 00 00       	push   $0x9800
+ f0c:	e8 ef fe ff ff       	call   e00 <malloc>
+ f11:	83 c4 10             	add    $0x10,%esp
+ f14:	89 c7                	mov    %eax,%edi
+ f16:	85 c0                	test   %eax,%eax
+ f18:	74 62                	je     f7c <waitpoll+0x8c>
+ f1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+ f20:	83 ec 0c             	sub    $0xc,%esp
+ f23:	6a 01                	push   $0x1
+ f25:	e8 03 fa ff ff       	call   92d <sleep>
+    fn();
+ f2a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ f2d:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+ f2f:	58                   	pop    %eax
+ f30:	5a                   	pop    %edx
+ f31:	68 00 02 00 00       	push   $0x200
+ f36:	57                   	push   %edi
+ f37:	e8 eb fa ff ff       	call   a27 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+ f3c:	83 c4 10             	add    $0x10,%esp
+ f3f:	85 c0                	test   %eax,%eax
+ f41:	7e 2d                	jle    f70 <waitpoll+0x80>
+ f43:	6b c0 4c             	imul   $0x4c,%eax,%eax
+ f46:	89 fa                	mov    %edi,%edx
+    alive = 0;
+ f48:	31 c9                	xor    %ecx,%ecx
+ f4a:	01 f8                	add    %edi,%eax
+ f4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+ f50:	3b 1a                	cmp    (%edx),%ebx
+ f52:	75 07                	jne    f5b <waitpoll+0x6b>
+        alive = 1;
+ f54:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+ f58:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+ f5b:	83 c2 4c             	add    $0x4c,%edx
+ f5e:	39 d0                	cmp    %edx,%eax
+ f60:	75 ee                	jne    f50 <waitpoll+0x60>
+  } while(alive);
+ f62:	85 c9                	test   %ecx,%ecx
+ f64:	75 ba                	jne    f20 <waitpoll+0x30>
+ f66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f6d:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+ f70:	83 ec 0c             	sub    $0xc,%esp
+ f73:	57                   	push   %edi
+ f74:	e8 f7 fd ff ff       	call   d70 <free>
+  wait();
+ f79:	83 c4 10             	add    $0x10,%esp
+}
+ f7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ f7f:	5b                   	pop    %ebx
+ f80:	5e                   	pop    %esi
+ f81:	5f                   	pop    %edi
+ f82:	5d                   	pop    %ebp
+  wait();
+ f83:	e9 10 f9 ff ff       	jmp    898 <wait>
+ f88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f8f:	90                   	nop
+
+00000f90 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+ f90:	55                   	push   %ebp
+ f91:	89 e5                	mov    %esp,%ebp
+ f93:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+ f96:	c7 45 f0 f1 10 00 00 	movl   $0x10f1,-0x10(%ebp)
+ f9d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+ fa4:	e8 87 f4 ff ff       	call   430 <fork>
+ fa9:	85 c0                	test   %eax,%eax
+ fab:	78 09                	js     fb6 <runps+0x26>
+    return -1;
+  if(pid == 0){
+ fad:	74 0e                	je     fbd <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+ faf:	e8 e4 f8 ff ff       	call   898 <wait>
+}
+ fb4:	c9                   	leave
+ fb5:	c3                   	ret
+ fb6:	c9                   	leave
+    return -1;
+ fb7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ fbc:	c3                   	ret
+    exec("ps", argv);
+ fbd:	50                   	push   %eax
+ fbe:	50                   	push   %eax
+ fbf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ fc2:	50                   	push   %eax
+ fc3:	68 f1 10 00 00       	push   $0x10f1
+ fc8:	e8 c3 f4 ff ff       	call   490 <exec>
+    printf(2, "exec ps failed\n");
+ fcd:	5a                   	pop    %edx
+ fce:	59                   	pop    %ecx
+ fcf:	68 f4 10 00 00       	push   $0x10f4
+ fd4:	6a 02                	push   $0x2
+ fd6:	e8 55 fb ff ff       	call   b30 <printf>
+    exit();
+ fdb:	e8 a0 f4 ff ff       	call   480 <exit>
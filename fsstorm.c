@@ -0,0 +1,64 @@
+// Metadata storm: several processes create and remove
+// directories and small files at once, so that their
+// transactions have to share log commits.
+//
+// usage: fsstorm [nproc [nops]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+void
+storm(int id, int nops)
+{
+  char dir[8], file[8];
+  int fd, i;
+
+  dir[0] = 'd';
+  file[0] = 'f';
+  dir[1] = file[1] = 'a' + id;
+  dir[3] = file[3] = 0;
+  for(i = 0; i < nops; i++){
+    dir[2] = file[2] = 'a' + i % 26;
+    if(mkdir(dir) < 0){
+      printf(2, "fsstorm: mkdir %s failed\n", dir);
+      exit();
+    }
+    if((fd = open(file, O_CREATE|O_RDWR)) < 0){
+      printf(2, "fsstorm: create %s failed\n", file);
+      exit();
+    }
+    write(fd, dir, sizeof(dir));
+    close(fd);
+    if(unlink(dir) < 0 || unlink(file) < 0){
+      printf(2, "fsstorm: unlink failed\n");
+      exit();
+    }
+  }
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  int nproc, nops, i, start;
+
+  nproc = argc > 1 ? atoi(argv[1]) : 4;
+  nops = argc > 2 ? atoi(argv[2]) : 50;
+  if(nproc < 1 || nproc > 26){
+    printf(2, "usage: fsstorm [nproc(1-26) [nops]]\n");
+    exit();
+  }
+
+  start = uptime();
+  for(i = 0; i < nproc; i++){
+    if(fork() == 0)
+      storm(i, nops);
+  }
+  for(i = 0; i < nproc; i++)
+    wait();
+  printf(1, "fsstorm: %d procs x %d ops in %d ticks\n",
+         nproc, nops, uptime() - start);
+  exit();
+}
@@ -0,0 +1,2596 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 18             	sub    $0x18,%esp
+      14:	8b 11                	mov    (%ecx),%edx
+      16:	8b 71 04             	mov    0x4(%ecx),%esi
+  int fd, i, usemmap;
+  char *pattern;
+
+  usemmap = argc > 1 && strcmp(argv[1], "-m") == 0;
+      19:	83 fa 01             	cmp    $0x1,%edx
+      1c:	7f 13                	jg     31 <main+0x31>
+  if(usemmap){
+    argc--;
+    argv++;
+  }
+  if(argc <= 1){
+    printf(2, "usage: grep [-m] pattern [file ...]\n");
+      1e:	50                   	push   %eax
+      1f:	50                   	push   %eax
+      20:	68 30 13 00 00       	push   $0x1330
+      25:	6a 02                	push   $0x2
+      27:	e8 54 0e 00 00       	call   e80 <printf>
+    exit();
+      2c:	e8 9f 07 00 00       	call   7d0 <exit>
+      31:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  usemmap = argc > 1 && strcmp(argv[1], "-m") == 0;
+      34:	50                   	push   %eax
+      35:	50                   	push   %eax
+      36:	68 55 13 00 00       	push   $0x1355
+      3b:	ff 76 04             	push   0x4(%esi)
+      3e:	e8 9d 08 00 00       	call   8e0 <strcmp>
+      43:	83 c4 10             	add    $0x10,%esp
+      46:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+      49:	85 c0                	test   %eax,%eax
+      4b:	75 14                	jne    61 <main+0x61>
+    argc--;
+      4d:	83 ea 01             	sub    $0x1,%edx
+  if(argc <= 1){
+      50:	83 fa 01             	cmp    $0x1,%edx
+      53:	74 c9                	je     1e <main+0x1e>
+  usemmap = argc > 1 && strcmp(argv[1], "-m") == 0;
+      55:	c7 45 dc 01 00 00 00 	movl   $0x1,-0x24(%ebp)
+    argv++;
+      5c:	83 c6 04             	add    $0x4,%esi
+      5f:	eb 05                	jmp    66 <main+0x66>
+  usemmap = argc > 1 && strcmp(argv[1], "-m") == 0;
+      61:	31 ff                	xor    %edi,%edi
+      63:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  }
+  pattern = argv[1];
+      66:	8b 4e 04             	mov    0x4(%esi),%ecx
+  if(argc <= 2){
+    grep(pattern, 0);
+    exit();
+  }
+
+  for(i = 2; i < argc; i++){
+      69:	bf 02 00 00 00       	mov    $0x2,%edi
+      6e:	83 c6 08             	add    $0x8,%esi
+  if(argc <= 2){
+      71:	83 fa 02             	cmp    $0x2,%edx
+      74:	74 7c                	je     f2 <main+0xf2>
+      76:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+      79:	89 55 e0             	mov    %edx,-0x20(%ebp)
+      7c:	eb 2e                	jmp    ac <main+0xac>
+      7e:	66 90                	xchg   %ax,%ax
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      exit();
+    }
+    if(!usemmap || mgrep(pattern, fd) < 0)
+      80:	83 ec 08             	sub    $0x8,%esp
+      83:	53                   	push   %ebx
+      84:	ff 75 e4             	push   -0x1c(%ebp)
+      87:	e8 04 03 00 00       	call   390 <mgrep>
+      8c:	83 c4 10             	add    $0x10,%esp
+      8f:	85 c0                	test   %eax,%eax
+      91:	78 35                	js     c8 <main+0xc8>
+      grep(pattern, fd);
+    close(fd);
+      93:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 2; i < argc; i++){
+      96:	83 c7 01             	add    $0x1,%edi
+      99:	83 c6 04             	add    $0x4,%esi
+    close(fd);
+      9c:	53                   	push   %ebx
+      9d:	e8 9e 07 00 00       	call   840 <close>
+  for(i = 2; i < argc; i++){
+      a2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+      a5:	83 c4 10             	add    $0x10,%esp
+      a8:	39 c7                	cmp    %eax,%edi
+      aa:	74 2d                	je     d9 <main+0xd9>
+    if((fd = open(argv[i], 0)) < 0){
+      ac:	83 ec 08             	sub    $0x8,%esp
+      af:	6a 00                	push   $0x0
+      b1:	ff 36                	push   (%esi)
+      b3:	e8 61 0b 00 00       	call   c19 <open>
+      b8:	83 c4 10             	add    $0x10,%esp
+      bb:	89 c3                	mov    %eax,%ebx
+      bd:	85 c0                	test   %eax,%eax
+      bf:	78 1d                	js     de <main+0xde>
+    if(!usemmap || mgrep(pattern, fd) < 0)
+      c1:	8b 45 dc             	mov    -0x24(%ebp),%eax
+      c4:	85 c0                	test   %eax,%eax
+      c6:	75 b8                	jne    80 <main+0x80>
+      grep(pattern, fd);
+      c8:	83 ec 08             	sub    $0x8,%esp
+      cb:	53                   	push   %ebx
+      cc:	ff 75 e4             	push   -0x1c(%ebp)
+      cf:	e8 6c 01 00 00       	call   240 <grep>
+      d4:	83 c4 10             	add    $0x10,%esp
+      d7:	eb ba                	jmp    93 <main+0x93>
+  }
+  exit();
+      d9:	e8 f2 06 00 00       	call   7d0 <exit>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      de:	52                   	push   %edx
+      df:	ff 36                	push   (%esi)
+      e1:	68 58 13 00 00       	push   $0x1358
+      e6:	6a 01                	push   $0x1
+      e8:	e8 93 0d 00 00       	call   e80 <printf>
+      exit();
+      ed:	e8 de 06 00 00       	call   7d0 <exit>
+    grep(pattern, 0);
+      f2:	53                   	push   %ebx
+      f3:	53                   	push   %ebx
+      f4:	6a 00                	push   $0x0
+      f6:	51                   	push   %ecx
+      f7:	e8 44 01 00 00       	call   240 <grep>
+    exit();
+      fc:	e8 cf 06 00 00       	call   7d0 <exit>
+     101:	66 90                	xchg   %ax,%ax
+     103:	66 90                	xchg   %ax,%ax
+     105:	66 90                	xchg   %ax,%ax
+     107:	66 90                	xchg   %ax,%ax
+     109:	66 90                	xchg   %ax,%ax
+     10b:	66 90                	xchg   %ax,%ax
+     10d:	66 90                	xchg   %ax,%ax
+     10f:	90                   	nop
+
+00000110 <matchhere>:
+  return 0;
+}
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+     110:	55                   	push   %ebp
+     111:	89 e5                	mov    %esp,%ebp
+     113:	57                   	push   %edi
+     114:	56                   	push   %esi
+     115:	53                   	push   %ebx
+     116:	83 ec 0c             	sub    $0xc,%esp
+     119:	8b 7d 08             	mov    0x8(%ebp),%edi
+     11c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '\0')
+     11f:	0f b6 0f             	movzbl (%edi),%ecx
+     122:	84 c9                	test   %cl,%cl
+     124:	0f 84 96 00 00 00    	je     1c0 <matchhere+0xb0>
+    return 1;
+  if(re[1] == '*')
+     12a:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+     12e:	3c 2a                	cmp    $0x2a,%al
+     130:	74 2d                	je     15f <matchhere+0x4f>
+     132:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return matchstar(re[0], re+2, text);
+  if(re[0] == '$' && re[1] == '\0')
+    return *text == '\0';
+     138:	0f b6 33             	movzbl (%ebx),%esi
+  if(re[0] == '$' && re[1] == '\0')
+     13b:	80 f9 24             	cmp    $0x24,%cl
+     13e:	74 50                	je     190 <matchhere+0x80>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+     140:	89 f2                	mov    %esi,%edx
+     142:	84 d2                	test   %dl,%dl
+     144:	74 6e                	je     1b4 <matchhere+0xa4>
+     146:	80 f9 2e             	cmp    $0x2e,%cl
+     149:	75 65                	jne    1b0 <matchhere+0xa0>
+    return matchhere(re+1, text+1);
+     14b:	83 c3 01             	add    $0x1,%ebx
+     14e:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+     151:	84 c0                	test   %al,%al
+     153:	74 6b                	je     1c0 <matchhere+0xb0>
+     155:	89 c1                	mov    %eax,%ecx
+  if(re[1] == '*')
+     157:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+     15b:	3c 2a                	cmp    $0x2a,%al
+     15d:	75 d9                	jne    138 <matchhere+0x28>
+    return matchstar(re[0], re+2, text);
+     15f:	8d 77 02             	lea    0x2(%edi),%esi
+     162:	0f be f9             	movsbl %cl,%edi
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+     165:	8d 76 00             	lea    0x0(%esi),%esi
+{
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+     168:	83 ec 08             	sub    $0x8,%esp
+     16b:	53                   	push   %ebx
+     16c:	56                   	push   %esi
+     16d:	e8 9e ff ff ff       	call   110 <matchhere>
+     172:	83 c4 10             	add    $0x10,%esp
+     175:	85 c0                	test   %eax,%eax
+     177:	75 47                	jne    1c0 <matchhere+0xb0>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+     179:	0f be 13             	movsbl (%ebx),%edx
+     17c:	84 d2                	test   %dl,%dl
+     17e:	74 45                	je     1c5 <matchhere+0xb5>
+     180:	83 c3 01             	add    $0x1,%ebx
+     183:	39 fa                	cmp    %edi,%edx
+     185:	74 e1                	je     168 <matchhere+0x58>
+     187:	83 ff 2e             	cmp    $0x2e,%edi
+     18a:	74 dc                	je     168 <matchhere+0x58>
+     18c:	eb 37                	jmp    1c5 <matchhere+0xb5>
+     18e:	66 90                	xchg   %ax,%ax
+  if(re[0] == '$' && re[1] == '\0')
+     190:	84 c0                	test   %al,%al
+     192:	74 39                	je     1cd <matchhere+0xbd>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+     194:	89 f2                	mov    %esi,%edx
+     196:	84 d2                	test   %dl,%dl
+     198:	74 1a                	je     1b4 <matchhere+0xa4>
+     19a:	80 fa 24             	cmp    $0x24,%dl
+     19d:	75 15                	jne    1b4 <matchhere+0xa4>
+    return matchhere(re+1, text+1);
+     19f:	83 c3 01             	add    $0x1,%ebx
+     1a2:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+     1a5:	89 c1                	mov    %eax,%ecx
+     1a7:	eb ae                	jmp    157 <matchhere+0x47>
+     1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+     1b0:	38 ca                	cmp    %cl,%dl
+     1b2:	74 97                	je     14b <matchhere+0x3b>
+}
+     1b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+     1b7:	31 c0                	xor    %eax,%eax
+}
+     1b9:	5b                   	pop    %ebx
+     1ba:	5e                   	pop    %esi
+     1bb:	5f                   	pop    %edi
+     1bc:	5d                   	pop    %ebp
+     1bd:	c3                   	ret
+     1be:	66 90                	xchg   %ax,%ax
+    return 1;
+     1c0:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+     1c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     1c8:	5b                   	pop    %ebx
+     1c9:	5e                   	pop    %esi
+     1ca:	5f                   	pop    %edi
+     1cb:	5d                   	pop    %ebp
+     1cc:	c3                   	ret
+    return *text == '\0';
+     1cd:	89 f0                	mov    %esi,%eax
+     1cf:	84 c0                	test   %al,%al
+     1d1:	0f 94 c0             	sete   %al
+     1d4:	0f b6 c0             	movzbl %al,%eax
+     1d7:	eb ec                	jmp    1c5 <matchhere+0xb5>
+     1d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001e0 <match>:
+{
+     1e0:	55                   	push   %ebp
+     1e1:	89 e5                	mov    %esp,%ebp
+     1e3:	56                   	push   %esi
+     1e4:	53                   	push   %ebx
+     1e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     1e8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(re[0] == '^')
+     1eb:	80 3b 5e             	cmpb   $0x5e,(%ebx)
+     1ee:	75 11                	jne    201 <match+0x21>
+     1f0:	eb 2e                	jmp    220 <match+0x40>
+     1f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }while(*text++ != '\0');
+     1f8:	83 c6 01             	add    $0x1,%esi
+     1fb:	80 7e ff 00          	cmpb   $0x0,-0x1(%esi)
+     1ff:	74 16                	je     217 <match+0x37>
+    if(matchhere(re, text))
+     201:	83 ec 08             	sub    $0x8,%esp
+     204:	56                   	push   %esi
+     205:	53                   	push   %ebx
+     206:	e8 05 ff ff ff       	call   110 <matchhere>
+     20b:	83 c4 10             	add    $0x10,%esp
+     20e:	85 c0                	test   %eax,%eax
+     210:	74 e6                	je     1f8 <match+0x18>
+      return 1;
+     212:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+     217:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     21a:	5b                   	pop    %ebx
+     21b:	5e                   	pop    %esi
+     21c:	5d                   	pop    %ebp
+     21d:	c3                   	ret
+     21e:	66 90                	xchg   %ax,%ax
+    return matchhere(re+1, text);
+     220:	83 c3 01             	add    $0x1,%ebx
+     223:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     226:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     229:	5b                   	pop    %ebx
+     22a:	5e                   	pop    %esi
+     22b:	5d                   	pop    %ebp
+    return matchhere(re+1, text);
+     22c:	e9 df fe ff ff       	jmp    110 <matchhere>
+     231:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     238:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     23f:	90                   	nop
+
+00000240 <grep>:
+{
+     240:	55                   	push   %ebp
+     241:	89 e5                	mov    %esp,%ebp
+     243:	57                   	push   %edi
+  m = 0;
+     244:	31 ff                	xor    %edi,%edi
+{
+     246:	56                   	push   %esi
+     247:	53                   	push   %ebx
+     248:	83 ec 1c             	sub    $0x1c,%esp
+     24b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     24e:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    return matchhere(re+1, text);
+     251:	8d 43 01             	lea    0x1(%ebx),%eax
+     254:	89 45 dc             	mov    %eax,-0x24(%ebp)
+     257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     25e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+     260:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     263:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+     268:	83 ec 04             	sub    $0x4,%esp
+     26b:	29 c8                	sub    %ecx,%eax
+     26d:	50                   	push   %eax
+     26e:	8d 81 80 19 00 00    	lea    0x1980(%ecx),%eax
+     274:	50                   	push   %eax
+     275:	ff 75 0c             	push   0xc(%ebp)
+     278:	e8 79 09 00 00       	call   bf6 <read>
+     27d:	83 c4 10             	add    $0x10,%esp
+     280:	85 c0                	test   %eax,%eax
+     282:	0f 8e fd 00 00 00    	jle    385 <grep+0x145>
+    m += n;
+     288:	01 45 e0             	add    %eax,-0x20(%ebp)
+     28b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    buf[m] = '\0';
+     28e:	bf 80 19 00 00       	mov    $0x1980,%edi
+     293:	89 de                	mov    %ebx,%esi
+     295:	c6 81 80 19 00 00 00 	movb   $0x0,0x1980(%ecx)
+    while((q = strchr(p, '\n')) != 0){
+     29c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2a0:	83 ec 08             	sub    $0x8,%esp
+     2a3:	6a 0a                	push   $0xa
+     2a5:	57                   	push   %edi
+     2a6:	e8 e5 06 00 00       	call   990 <strchr>
+     2ab:	83 c4 10             	add    $0x10,%esp
+     2ae:	89 c2                	mov    %eax,%edx
+     2b0:	85 c0                	test   %eax,%eax
+     2b2:	0f 84 88 00 00 00    	je     340 <grep+0x100>
+      *q = 0;
+     2b8:	c6 02 00             	movb   $0x0,(%edx)
+  if(re[0] == '^')
+     2bb:	80 3e 5e             	cmpb   $0x5e,(%esi)
+     2be:	74 58                	je     318 <grep+0xd8>
+     2c0:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     2c3:	89 d3                	mov    %edx,%ebx
+     2c5:	eb 12                	jmp    2d9 <grep+0x99>
+     2c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2ce:	66 90                	xchg   %ax,%ax
+  }while(*text++ != '\0');
+     2d0:	83 c7 01             	add    $0x1,%edi
+     2d3:	80 7f ff 00          	cmpb   $0x0,-0x1(%edi)
+     2d7:	74 37                	je     310 <grep+0xd0>
+    if(matchhere(re, text))
+     2d9:	83 ec 08             	sub    $0x8,%esp
+     2dc:	57                   	push   %edi
+     2dd:	56                   	push   %esi
+     2de:	e8 2d fe ff ff       	call   110 <matchhere>
+     2e3:	83 c4 10             	add    $0x10,%esp
+     2e6:	85 c0                	test   %eax,%eax
+     2e8:	74 e6                	je     2d0 <grep+0x90>
+        write(1, p, q+1 - p);
+     2ea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     2ed:	89 da                	mov    %ebx,%edx
+     2ef:	8d 5b 01             	lea    0x1(%ebx),%ebx
+     2f2:	89 d8                	mov    %ebx,%eax
+     2f4:	83 ec 04             	sub    $0x4,%esp
+        *q = '\n';
+     2f7:	c6 02 0a             	movb   $0xa,(%edx)
+        write(1, p, q+1 - p);
+     2fa:	29 f8                	sub    %edi,%eax
+     2fc:	50                   	push   %eax
+     2fd:	57                   	push   %edi
+     2fe:	89 df                	mov    %ebx,%edi
+     300:	6a 01                	push   $0x1
+     302:	e8 f6 08 00 00       	call   bfd <write>
+     307:	83 c4 10             	add    $0x10,%esp
+     30a:	eb 94                	jmp    2a0 <grep+0x60>
+     30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     310:	8d 7b 01             	lea    0x1(%ebx),%edi
+      p = q+1;
+     313:	eb 8b                	jmp    2a0 <grep+0x60>
+     315:	8d 76 00             	lea    0x0(%esi),%esi
+    return matchhere(re+1, text);
+     318:	83 ec 08             	sub    $0x8,%esp
+     31b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     31e:	57                   	push   %edi
+     31f:	ff 75 dc             	push   -0x24(%ebp)
+     322:	e8 e9 fd ff ff       	call   110 <matchhere>
+        write(1, p, q+1 - p);
+     327:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    return matchhere(re+1, text);
+     32a:	83 c4 10             	add    $0x10,%esp
+        write(1, p, q+1 - p);
+     32d:	8d 5a 01             	lea    0x1(%edx),%ebx
+      if(match(pattern, p)){
+     330:	85 c0                	test   %eax,%eax
+     332:	75 be                	jne    2f2 <grep+0xb2>
+        write(1, p, q+1 - p);
+     334:	89 df                	mov    %ebx,%edi
+     336:	e9 65 ff ff ff       	jmp    2a0 <grep+0x60>
+     33b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     33f:	90                   	nop
+    if(p == buf)
+     340:	89 f3                	mov    %esi,%ebx
+     342:	81 ff 80 19 00 00    	cmp    $0x1980,%edi
+     348:	74 2f                	je     379 <grep+0x139>
+    if(m > 0){
+     34a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     34d:	85 c0                	test   %eax,%eax
+     34f:	0f 8e 0b ff ff ff    	jle    260 <grep+0x20>
+      m -= p - buf;
+     355:	89 f8                	mov    %edi,%eax
+      memmove(buf, p, m);
+     357:	83 ec 04             	sub    $0x4,%esp
+      m -= p - buf;
+     35a:	2d 80 19 00 00       	sub    $0x1980,%eax
+     35f:	29 45 e0             	sub    %eax,-0x20(%ebp)
+     362:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      memmove(buf, p, m);
+     365:	51                   	push   %ecx
+     366:	57                   	push   %edi
+     367:	68 80 19 00 00       	push   $0x1980
+     36c:	e8 ff 07 00 00       	call   b70 <memmove>
+     371:	83 c4 10             	add    $0x10,%esp
+     374:	e9 e7 fe ff ff       	jmp    260 <grep+0x20>
+      m = 0;
+     379:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+     380:	e9 db fe ff ff       	jmp    260 <grep+0x20>
+}
+     385:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     388:	5b                   	pop    %ebx
+     389:	5e                   	pop    %esi
+     38a:	5f                   	pop    %edi
+     38b:	5d                   	pop    %ebp
+     38c:	c3                   	ret
+     38d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000390 <mgrep>:
+{
+     390:	55                   	push   %ebp
+     391:	89 e5                	mov    %esp,%ebp
+     393:	57                   	push   %edi
+     394:	56                   	push   %esi
+  if(fstat(fd, &st) < 0)
+     395:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+{
+     398:	53                   	push   %ebx
+     399:	83 ec 44             	sub    $0x44,%esp
+     39c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     39f:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(fstat(fd, &st) < 0)
+     3a2:	50                   	push   %eax
+     3a3:	53                   	push   %ebx
+     3a4:	e8 8e 08 00 00       	call   c37 <fstat>
+     3a9:	83 c4 10             	add    $0x10,%esp
+     3ac:	85 c0                	test   %eax,%eax
+     3ae:	0f 88 14 01 00 00    	js     4c8 <mgrep+0x138>
+  if(st.size == 0)
+     3b4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     3b7:	85 c0                	test   %eax,%eax
+     3b9:	75 0d                	jne    3c8 <mgrep+0x38>
+    return 0;
+     3bb:	31 c0                	xor    %eax,%eax
+}
+     3bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     3c0:	5b                   	pop    %ebx
+     3c1:	5e                   	pop    %esi
+     3c2:	5f                   	pop    %edi
+     3c3:	5d                   	pop    %ebp
+     3c4:	c3                   	ret
+     3c5:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = mmap(fd, 0, st.size, PROT_READ|PROT_WRITE, MAP_PRIVATE)) == (char*)-1)
+     3c8:	83 ec 0c             	sub    $0xc,%esp
+     3cb:	6a 02                	push   $0x2
+     3cd:	6a 03                	push   $0x3
+     3cf:	50                   	push   %eax
+     3d0:	6a 00                	push   $0x0
+     3d2:	53                   	push   %ebx
+     3d3:	e8 63 09 00 00       	call   d3b <mmap>
+     3d8:	83 c4 20             	add    $0x20,%esp
+     3db:	89 c7                	mov    %eax,%edi
+     3dd:	83 f8 ff             	cmp    $0xffffffff,%eax
+     3e0:	0f 84 e2 00 00 00    	je     4c8 <mgrep+0x138>
+  end = p + st.size;
+     3e6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    return matchhere(re+1, text);
+     3e9:	8d 5e 01             	lea    0x1(%esi),%ebx
+     3ec:	89 5d bc             	mov    %ebx,-0x44(%ebp)
+  end = p + st.size;
+     3ef:	8d 0c 07             	lea    (%edi,%eax,1),%ecx
+  while(p < end && (q = memchr(p, '\n', end - p)) != 0){
+     3f2:	39 cf                	cmp    %ecx,%edi
+     3f4:	0f 83 7c 00 00 00    	jae    476 <mgrep+0xe6>
+     3fa:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+     3fd:	8d 76 00             	lea    0x0(%esi),%esi
+     400:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     403:	83 ec 04             	sub    $0x4,%esp
+     406:	29 f8                	sub    %edi,%eax
+     408:	50                   	push   %eax
+     409:	6a 0a                	push   $0xa
+     40b:	57                   	push   %edi
+     40c:	e8 bf 05 00 00       	call   9d0 <memchr>
+     411:	83 c4 10             	add    $0x10,%esp
+     414:	89 c2                	mov    %eax,%edx
+     416:	85 c0                	test   %eax,%eax
+     418:	0f 84 a2 00 00 00    	je     4c0 <mgrep+0x130>
+    *q = 0;
+     41e:	c6 02 00             	movb   $0x0,(%edx)
+  if(re[0] == '^')
+     421:	80 3e 5e             	cmpb   $0x5e,(%esi)
+     424:	74 72                	je     498 <mgrep+0x108>
+     426:	89 7d c0             	mov    %edi,-0x40(%ebp)
+     429:	89 d3                	mov    %edx,%ebx
+     42b:	eb 0c                	jmp    439 <mgrep+0xa9>
+     42d:	8d 76 00             	lea    0x0(%esi),%esi
+  }while(*text++ != '\0');
+     430:	83 c7 01             	add    $0x1,%edi
+     433:	80 7f ff 00          	cmpb   $0x0,-0x1(%edi)
+     437:	74 57                	je     490 <mgrep+0x100>
+    if(matchhere(re, text))
+     439:	83 ec 08             	sub    $0x8,%esp
+     43c:	57                   	push   %edi
+     43d:	56                   	push   %esi
+     43e:	e8 cd fc ff ff       	call   110 <matchhere>
+     443:	83 c4 10             	add    $0x10,%esp
+     446:	85 c0                	test   %eax,%eax
+     448:	74 e6                	je     430 <mgrep+0xa0>
+      write(1, p, q+1 - p);
+     44a:	8b 7d c0             	mov    -0x40(%ebp),%edi
+     44d:	89 da                	mov    %ebx,%edx
+     44f:	8d 5b 01             	lea    0x1(%ebx),%ebx
+     452:	89 d8                	mov    %ebx,%eax
+     454:	83 ec 04             	sub    $0x4,%esp
+      *q = '\n';
+     457:	c6 02 0a             	movb   $0xa,(%edx)
+      write(1, p, q+1 - p);
+     45a:	29 f8                	sub    %edi,%eax
+     45c:	50                   	push   %eax
+     45d:	57                   	push   %edi
+     45e:	6a 01                	push   $0x1
+     460:	e8 98 07 00 00       	call   bfd <write>
+     465:	83 c4 10             	add    $0x10,%esp
+     468:	89 df                	mov    %ebx,%edi
+  while(p < end && (q = memchr(p, '\n', end - p)) != 0){
+     46a:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     46d:	39 c7                	cmp    %eax,%edi
+     46f:	72 8f                	jb     400 <mgrep+0x70>
+  munmap(end - st.size, st.size);
+     471:	89 c1                	mov    %eax,%ecx
+     473:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     476:	83 ec 08             	sub    $0x8,%esp
+     479:	29 c1                	sub    %eax,%ecx
+     47b:	50                   	push   %eax
+     47c:	51                   	push   %ecx
+     47d:	e8 c3 08 00 00       	call   d45 <munmap>
+  return 0;
+     482:	83 c4 10             	add    $0x10,%esp
+     485:	e9 31 ff ff ff       	jmp    3bb <mgrep+0x2b>
+     48a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      write(1, p, q+1 - p);
+     490:	8d 7b 01             	lea    0x1(%ebx),%edi
+     493:	eb d5                	jmp    46a <mgrep+0xda>
+     495:	8d 76 00             	lea    0x0(%esi),%esi
+    return matchhere(re+1, text);
+     498:	83 ec 08             	sub    $0x8,%esp
+     49b:	89 55 c0             	mov    %edx,-0x40(%ebp)
+     49e:	57                   	push   %edi
+     49f:	ff 75 bc             	push   -0x44(%ebp)
+     4a2:	e8 69 fc ff ff       	call   110 <matchhere>
+      write(1, p, q+1 - p);
+     4a7:	8b 55 c0             	mov    -0x40(%ebp),%edx
+    return matchhere(re+1, text);
+     4aa:	83 c4 10             	add    $0x10,%esp
+      write(1, p, q+1 - p);
+     4ad:	8d 5a 01             	lea    0x1(%edx),%ebx
+    if(match(pattern, p)){
+     4b0:	85 c0                	test   %eax,%eax
+     4b2:	74 b4                	je     468 <mgrep+0xd8>
+     4b4:	eb 9c                	jmp    452 <mgrep+0xc2>
+     4b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4bd:	8d 76 00             	lea    0x0(%esi),%esi
+  munmap(end - st.size, st.size);
+     4c0:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+     4c3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     4c6:	eb ae                	jmp    476 <mgrep+0xe6>
+    return -1;
+     4c8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     4cd:	e9 eb fe ff ff       	jmp    3bd <mgrep+0x2d>
+     4d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004e0 <matchstar>:
+{
+     4e0:	55                   	push   %ebp
+     4e1:	89 e5                	mov    %esp,%ebp
+     4e3:	57                   	push   %edi
+     4e4:	56                   	push   %esi
+     4e5:	53                   	push   %ebx
+     4e6:	83 ec 0c             	sub    $0xc,%esp
+     4e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     4ec:	8b 75 0c             	mov    0xc(%ebp),%esi
+     4ef:	8b 7d 10             	mov    0x10(%ebp),%edi
+     4f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(matchhere(re, text))
+     4f8:	83 ec 08             	sub    $0x8,%esp
+     4fb:	57                   	push   %edi
+     4fc:	56                   	push   %esi
+     4fd:	e8 0e fc ff ff       	call   110 <matchhere>
+     502:	83 c4 10             	add    $0x10,%esp
+     505:	85 c0                	test   %eax,%eax
+     507:	75 1f                	jne    528 <matchstar+0x48>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+     509:	0f be 17             	movsbl (%edi),%edx
+     50c:	84 d2                	test   %dl,%dl
+     50e:	74 0c                	je     51c <matchstar+0x3c>
+     510:	83 c7 01             	add    $0x1,%edi
+     513:	39 da                	cmp    %ebx,%edx
+     515:	74 e1                	je     4f8 <matchstar+0x18>
+     517:	83 fb 2e             	cmp    $0x2e,%ebx
+     51a:	74 dc                	je     4f8 <matchstar+0x18>
+}
+     51c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     51f:	5b                   	pop    %ebx
+     520:	5e                   	pop    %esi
+     521:	5f                   	pop    %edi
+     522:	5d                   	pop    %ebp
+     523:	c3                   	ret
+     524:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     528:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 1;
+     52b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+     530:	5b                   	pop    %ebx
+     531:	5e                   	pop    %esi
+     532:	5f                   	pop    %edi
+     533:	5d                   	pop    %ebp
+     534:	c3                   	ret
+     535:	66 90                	xchg   %ax,%ax
+     537:	66 90                	xchg   %ax,%ax
+     539:	66 90                	xchg   %ax,%ax
+     53b:	66 90                	xchg   %ax,%ax
+     53d:	66 90                	xchg   %ax,%ax
+     53f:	90                   	nop
+
+00000540 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+     540:	55                   	push   %ebp
+     541:	89 e5                	mov    %esp,%ebp
+     543:	57                   	push   %edi
+     544:	56                   	push   %esi
+     545:	53                   	push   %ebx
+     546:	83 ec 4c             	sub    $0x4c,%esp
+     549:	8b 45 0c             	mov    0xc(%ebp),%eax
+     54c:	8b 55 08             	mov    0x8(%ebp),%edx
+     54f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     552:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+     555:	83 fa 0f             	cmp    $0xf,%edx
+     558:	0f 87 32 01 00 00    	ja     690 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+     55e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     564:	8b 80 80 1d 00 00    	mov    0x1d80(%eax),%eax
+     56a:	85 c0                	test   %eax,%eax
+     56c:	0f 84 de 00 00 00    	je     650 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+     572:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     578:	8b b0 84 1d 00 00    	mov    0x1d84(%eax),%esi
+     57e:	8d 88 80 1d 00 00    	lea    0x1d80(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+     584:	8d b8 88 1d 00 00    	lea    0x1d88(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+     58a:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+     58d:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+     590:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+     593:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+     599:	0f 8f 01 01 00 00    	jg     6a0 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+     59f:	8d 78 08             	lea    0x8(%eax),%edi
+     5a2:	8d bc 3e 80 1d 00 00 	lea    0x1d80(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     5a9:	85 db                	test   %ebx,%ebx
+     5ab:	7e 3b                	jle    5e8 <bufwrite+0xa8>
+     5ad:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+     5b0:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+     5b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5b7:	90                   	nop
+    *dst++ = *src++;
+     5b8:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     5b9:	39 c6                	cmp    %eax,%esi
+     5bb:	75 fb                	jne    5b8 <bufwrite+0x78>
+  ob[fd].n += n;
+     5bd:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     5c3:	8b 88 84 1d 00 00    	mov    0x1d84(%eax),%ecx
+     5c9:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     5cb:	83 b8 80 1d 00 00 01 	cmpl   $0x1,0x1d80(%eax)
+  ob[fd].n += n;
+     5d2:	89 88 84 1d 00 00    	mov    %ecx,0x1d84(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     5d8:	74 26                	je     600 <bufwrite+0xc0>
+}
+     5da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     5dd:	5b                   	pop    %ebx
+     5de:	5e                   	pop    %esi
+     5df:	5f                   	pop    %edi
+     5e0:	5d                   	pop    %ebp
+     5e1:	c3                   	ret
+     5e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+     5e8:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     5eb:	83 b8 80 1d 00 00 01 	cmpl   $0x1,0x1d80(%eax)
+  ob[fd].n += n;
+     5f2:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     5f5:	75 e3                	jne    5da <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+     5f7:	85 db                	test   %ebx,%ebx
+     5f9:	74 df                	je     5da <bufwrite+0x9a>
+     5fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5ff:	90                   	nop
+  src = vsrc;
+     600:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     603:	01 c3                	add    %eax,%ebx
+     605:	eb 10                	jmp    617 <bufwrite+0xd7>
+     607:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     60e:	66 90                	xchg   %ax,%ax
+     610:	83 c0 01             	add    $0x1,%eax
+     613:	39 d8                	cmp    %ebx,%eax
+     615:	74 c3                	je     5da <bufwrite+0x9a>
+    if(*p == (char)c)
+     617:	80 38 0a             	cmpb   $0xa,(%eax)
+     61a:	75 f4                	jne    610 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     61c:	85 c9                	test   %ecx,%ecx
+     61e:	7e ba                	jle    5da <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+     620:	83 ec 04             	sub    $0x4,%esp
+     623:	51                   	push   %ecx
+     624:	ff 75 ac             	push   -0x54(%ebp)
+     627:	52                   	push   %edx
+     628:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+     62b:	e8 cd 05 00 00       	call   bfd <write>
+    ob[fd].n = 0;
+     630:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     633:	83 c4 10             	add    $0x10,%esp
+     636:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+     63c:	c7 82 84 1d 00 00 00 	movl   $0x0,0x1d84(%edx)
+     643:	00 00 00 
+     646:	eb 92                	jmp    5da <bufwrite+0x9a>
+     648:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     64f:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     650:	83 ec 08             	sub    $0x8,%esp
+     653:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     656:	50                   	push   %eax
+     657:	52                   	push   %edx
+     658:	89 55 b0             	mov    %edx,-0x50(%ebp)
+     65b:	e8 d7 05 00 00       	call   c37 <fstat>
+     660:	83 c4 10             	add    $0x10,%esp
+     663:	8b 55 b0             	mov    -0x50(%ebp),%edx
+     666:	89 c1                	mov    %eax,%ecx
+     668:	b8 02 00 00 00       	mov    $0x2,%eax
+     66d:	85 c9                	test   %ecx,%ecx
+     66f:	75 0d                	jne    67e <bufwrite+0x13e>
+     671:	31 c0                	xor    %eax,%eax
+     673:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     678:	0f 95 c0             	setne  %al
+     67b:	83 c0 01             	add    $0x1,%eax
+     67e:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+     684:	89 81 80 1d 00 00    	mov    %eax,0x1d80(%ecx)
+     68a:	e9 e3 fe ff ff       	jmp    572 <bufwrite+0x32>
+     68f:	90                   	nop
+}
+     690:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     693:	5b                   	pop    %ebx
+     694:	5e                   	pop    %esi
+     695:	5f                   	pop    %edi
+     696:	5d                   	pop    %ebp
+    write(fd, p, n);
+     697:	e9 61 05 00 00       	jmp    bfd <write>
+     69c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+     6a0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+     6a3:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+     6a6:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+     6a9:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+     6ac:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+     6af:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+     6b2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+     6b5:	6a 02                	push   $0x2
+     6b7:	50                   	push   %eax
+     6b8:	52                   	push   %edx
+     6b9:	e8 9b 06 00 00       	call   d59 <writev>
+    ob[fd].n = 0;
+     6be:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+     6c1:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+     6c4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+     6cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6ce:	5b                   	pop    %ebx
+     6cf:	5e                   	pop    %esi
+     6d0:	5f                   	pop    %edi
+     6d1:	5d                   	pop    %ebp
+     6d2:	c3                   	ret
+     6d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000006e0 <fflush>:
+{
+     6e0:	55                   	push   %ebp
+     6e1:	89 e5                	mov    %esp,%ebp
+     6e3:	53                   	push   %ebx
+     6e4:	83 ec 04             	sub    $0x4,%esp
+     6e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     6ea:	83 f8 0f             	cmp    $0xf,%eax
+     6ed:	77 16                	ja     705 <fflush+0x25>
+     6ef:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+     6f5:	8b 8a 84 1d 00 00    	mov    0x1d84(%edx),%ecx
+     6fb:	8d 9a 80 1d 00 00    	lea    0x1d80(%edx),%ebx
+     701:	85 c9                	test   %ecx,%ecx
+     703:	7f 0b                	jg     710 <fflush+0x30>
+}
+     705:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     708:	c9                   	leave
+     709:	c3                   	ret
+     70a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     710:	83 ec 04             	sub    $0x4,%esp
+     713:	81 c2 88 1d 00 00    	add    $0x1d88,%edx
+     719:	51                   	push   %ecx
+     71a:	52                   	push   %edx
+     71b:	50                   	push   %eax
+     71c:	e8 dc 04 00 00       	call   bfd <write>
+    ob[fd].n = 0;
+     721:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     728:	83 c4 10             	add    $0x10,%esp
+}
+     72b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     72e:	c9                   	leave
+     72f:	c3                   	ret
+
+00000730 <fflushall>:
+{
+     730:	55                   	push   %ebp
+     731:	89 e5                	mov    %esp,%ebp
+     733:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     734:	31 f6                	xor    %esi,%esi
+{
+     736:	53                   	push   %ebx
+     737:	bb 88 1d 00 00       	mov    $0x1d88,%ebx
+     73c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     740:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     743:	85 c0                	test   %eax,%eax
+     745:	7e 15                	jle    75c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     747:	83 ec 04             	sub    $0x4,%esp
+     74a:	50                   	push   %eax
+     74b:	53                   	push   %ebx
+     74c:	56                   	push   %esi
+     74d:	e8 ab 04 00 00       	call   bfd <write>
+    ob[fd].n = 0;
+     752:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     759:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     75c:	83 c6 01             	add    $0x1,%esi
+     75f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     765:	83 fe 10             	cmp    $0x10,%esi
+     768:	75 d6                	jne    740 <fflushall+0x10>
+}
+     76a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     76d:	5b                   	pop    %ebx
+     76e:	5e                   	pop    %esi
+     76f:	5d                   	pop    %ebp
+     770:	c3                   	ret
+     771:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     778:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     77f:	90                   	nop
+
+00000780 <fork>:
+{
+     780:	55                   	push   %ebp
+     781:	89 e5                	mov    %esp,%ebp
+     783:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     784:	31 f6                	xor    %esi,%esi
+{
+     786:	53                   	push   %ebx
+     787:	bb 88 1d 00 00       	mov    $0x1d88,%ebx
+     78c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     790:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     793:	85 c0                	test   %eax,%eax
+     795:	7e 15                	jle    7ac <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     797:	83 ec 04             	sub    $0x4,%esp
+     79a:	50                   	push   %eax
+     79b:	53                   	push   %ebx
+     79c:	56                   	push   %esi
+     79d:	e8 5b 04 00 00       	call   bfd <write>
+    ob[fd].n = 0;
+     7a2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     7a9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     7ac:	83 c6 01             	add    $0x1,%esi
+     7af:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     7b5:	83 fe 10             	cmp    $0x10,%esi
+     7b8:	75 d6                	jne    790 <fork+0x10>
+}
+     7ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     7bd:	5b                   	pop    %ebx
+     7be:	5e                   	pop    %esi
+     7bf:	5d                   	pop    %ebp
+  return _fork();
+     7c0:	e9 15 04 00 00       	jmp    bda <_fork>
+     7c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007d0 <exit>:
+{
+     7d0:	55                   	push   %ebp
+     7d1:	89 e5                	mov    %esp,%ebp
+     7d3:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+     7d6:	e8 55 ff ff ff       	call   730 <fflushall>
+  _exit();
+     7db:	e8 01 04 00 00       	call   be1 <_exit>
+
+000007e0 <exec>:
+{
+     7e0:	55                   	push   %ebp
+     7e1:	89 e5                	mov    %esp,%ebp
+     7e3:	57                   	push   %edi
+     7e4:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     7e5:	31 f6                	xor    %esi,%esi
+{
+     7e7:	53                   	push   %ebx
+     7e8:	bb 88 1d 00 00       	mov    $0x1d88,%ebx
+     7ed:	83 ec 1c             	sub    $0x1c,%esp
+     7f0:	8b 45 08             	mov    0x8(%ebp),%eax
+     7f3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     7f6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     7f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     800:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     803:	85 c0                	test   %eax,%eax
+     805:	7e 15                	jle    81c <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     807:	83 ec 04             	sub    $0x4,%esp
+     80a:	50                   	push   %eax
+     80b:	53                   	push   %ebx
+     80c:	56                   	push   %esi
+     80d:	e8 eb 03 00 00       	call   bfd <write>
+    ob[fd].n = 0;
+     812:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     819:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     81c:	83 c6 01             	add    $0x1,%esi
+     81f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     825:	83 fe 10             	cmp    $0x10,%esi
+     828:	75 d6                	jne    800 <exec+0x20>
+  return _exec(path, argv);
+     82a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     82d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+     830:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     833:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     836:	5b                   	pop    %ebx
+     837:	5e                   	pop    %esi
+     838:	5f                   	pop    %edi
+     839:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     83a:	e9 d3 03 00 00       	jmp    c12 <_exec>
+     83f:	90                   	nop
+
+00000840 <close>:
+{
+     840:	55                   	push   %ebp
+     841:	89 e5                	mov    %esp,%ebp
+     843:	56                   	push   %esi
+     844:	53                   	push   %ebx
+     845:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     848:	83 fb 0f             	cmp    $0xf,%ebx
+     84b:	77 26                	ja     873 <close+0x33>
+     84d:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     853:	8b 90 84 1d 00 00    	mov    0x1d84(%eax),%edx
+     859:	8d b0 80 1d 00 00    	lea    0x1d80(%eax),%esi
+     85f:	85 d2                	test   %edx,%edx
+     861:	7f 25                	jg     888 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+     863:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     869:	c7 80 80 1d 00 00 00 	movl   $0x0,0x1d80(%eax)
+     870:	00 00 00 
+  return _close(fd);
+     873:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     876:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     879:	5b                   	pop    %ebx
+     87a:	5e                   	pop    %esi
+     87b:	5d                   	pop    %ebp
+  return _close(fd);
+     87c:	e9 83 03 00 00       	jmp    c04 <_close>
+     881:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     888:	83 ec 04             	sub    $0x4,%esp
+     88b:	05 88 1d 00 00       	add    $0x1d88,%eax
+     890:	52                   	push   %edx
+     891:	50                   	push   %eax
+     892:	53                   	push   %ebx
+     893:	e8 65 03 00 00       	call   bfd <write>
+    ob[fd].n = 0;
+     898:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+     89f:	83 c4 10             	add    $0x10,%esp
+     8a2:	eb bf                	jmp    863 <close+0x23>
+     8a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     8af:	90                   	nop
+
+000008b0 <strcpy>:
+{
+     8b0:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+     8b1:	31 c0                	xor    %eax,%eax
+{
+     8b3:	89 e5                	mov    %esp,%ebp
+     8b5:	53                   	push   %ebx
+     8b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     8b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     8bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     8c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     8c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     8c7:	83 c0 01             	add    $0x1,%eax
+     8ca:	84 d2                	test   %dl,%dl
+     8cc:	75 f2                	jne    8c0 <strcpy+0x10>
+}
+     8ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8d1:	89 c8                	mov    %ecx,%eax
+     8d3:	c9                   	leave
+     8d4:	c3                   	ret
+     8d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008e0 <strcmp>:
+{
+     8e0:	55                   	push   %ebp
+     8e1:	89 e5                	mov    %esp,%ebp
+     8e3:	53                   	push   %ebx
+     8e4:	8b 55 08             	mov    0x8(%ebp),%edx
+     8e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     8ea:	0f b6 02             	movzbl (%edx),%eax
+     8ed:	84 c0                	test   %al,%al
+     8ef:	75 17                	jne    908 <strcmp+0x28>
+     8f1:	eb 3a                	jmp    92d <strcmp+0x4d>
+     8f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     8f7:	90                   	nop
+     8f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     8fc:	83 c2 01             	add    $0x1,%edx
+     8ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     902:	84 c0                	test   %al,%al
+     904:	74 1a                	je     920 <strcmp+0x40>
+    p++, q++;
+     906:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     908:	0f b6 19             	movzbl (%ecx),%ebx
+     90b:	38 c3                	cmp    %al,%bl
+     90d:	74 e9                	je     8f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     90f:	29 d8                	sub    %ebx,%eax
+}
+     911:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     914:	c9                   	leave
+     915:	c3                   	ret
+     916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     91d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     920:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     924:	31 c0                	xor    %eax,%eax
+     926:	29 d8                	sub    %ebx,%eax
+}
+     928:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     92b:	c9                   	leave
+     92c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     92d:	0f b6 19             	movzbl (%ecx),%ebx
+     930:	31 c0                	xor    %eax,%eax
+     932:	eb db                	jmp    90f <strcmp+0x2f>
+     934:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     93b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     93f:	90                   	nop
+
+00000940 <strlen>:
+{
+     940:	55                   	push   %ebp
+     941:	89 e5                	mov    %esp,%ebp
+     943:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+     946:	80 3a 00             	cmpb   $0x0,(%edx)
+     949:	74 15                	je     960 <strlen+0x20>
+     94b:	31 c0                	xor    %eax,%eax
+     94d:	8d 76 00             	lea    0x0(%esi),%esi
+     950:	83 c0 01             	add    $0x1,%eax
+     953:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     957:	89 c1                	mov    %eax,%ecx
+     959:	75 f5                	jne    950 <strlen+0x10>
+}
+     95b:	89 c8                	mov    %ecx,%eax
+     95d:	5d                   	pop    %ebp
+     95e:	c3                   	ret
+     95f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     960:	31 c9                	xor    %ecx,%ecx
+}
+     962:	5d                   	pop    %ebp
+     963:	89 c8                	mov    %ecx,%eax
+     965:	c3                   	ret
+     966:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     96d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000970 <memset>:
+{
+     970:	55                   	push   %ebp
+     971:	89 e5                	mov    %esp,%ebp
+     973:	57                   	push   %edi
+     974:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     977:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     97a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     97d:	89 d7                	mov    %edx,%edi
+     97f:	fc                   	cld
+     980:	f3 aa                	rep stos %al,%es:(%edi)
+}
+     982:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     985:	89 d0                	mov    %edx,%eax
+     987:	c9                   	leave
+     988:	c3                   	ret
+     989:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000990 <strchr>:
+{
+     990:	55                   	push   %ebp
+     991:	89 e5                	mov    %esp,%ebp
+     993:	8b 45 08             	mov    0x8(%ebp),%eax
+     996:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     99a:	0f b6 10             	movzbl (%eax),%edx
+     99d:	84 d2                	test   %dl,%dl
+     99f:	75 12                	jne    9b3 <strchr+0x23>
+     9a1:	eb 1d                	jmp    9c0 <strchr+0x30>
+     9a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     9a7:	90                   	nop
+     9a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     9ac:	83 c0 01             	add    $0x1,%eax
+     9af:	84 d2                	test   %dl,%dl
+     9b1:	74 0d                	je     9c0 <strchr+0x30>
+    if(*s == c)
+     9b3:	38 d1                	cmp    %dl,%cl
+     9b5:	75 f1                	jne    9a8 <strchr+0x18>
+}
+     9b7:	5d                   	pop    %ebp
+     9b8:	c3                   	ret
+     9b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     9c0:	31 c0                	xor    %eax,%eax
+}
+     9c2:	5d                   	pop    %ebp
+     9c3:	c3                   	ret
+     9c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     9cf:	90                   	nop
+
+000009d0 <memchr>:
+{
+     9d0:	55                   	push   %ebp
+     9d1:	89 e5                	mov    %esp,%ebp
+     9d3:	8b 55 10             	mov    0x10(%ebp),%edx
+     9d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     9d9:	85 d2                	test   %edx,%edx
+     9db:	74 1b                	je     9f8 <memchr+0x28>
+    if(*p == (char)c)
+     9dd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+     9e1:	01 c2                	add    %eax,%edx
+     9e3:	eb 0a                	jmp    9ef <memchr+0x1f>
+     9e5:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+     9e8:	83 c0 01             	add    $0x1,%eax
+     9eb:	39 c2                	cmp    %eax,%edx
+     9ed:	74 09                	je     9f8 <memchr+0x28>
+    if(*p == (char)c)
+     9ef:	38 08                	cmp    %cl,(%eax)
+     9f1:	75 f5                	jne    9e8 <memchr+0x18>
+}
+     9f3:	5d                   	pop    %ebp
+     9f4:	c3                   	ret
+     9f5:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+     9f8:	31 c0                	xor    %eax,%eax
+}
+     9fa:	5d                   	pop    %ebp
+     9fb:	c3                   	ret
+     9fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a00 <gets>:
+{
+     a00:	55                   	push   %ebp
+     a01:	89 e5                	mov    %esp,%ebp
+     a03:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+     a04:	31 ff                	xor    %edi,%edi
+{
+     a06:	56                   	push   %esi
+     a07:	be 88 1d 00 00       	mov    $0x1d88,%esi
+     a0c:	53                   	push   %ebx
+     a0d:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     a10:	8b 46 fc             	mov    -0x4(%esi),%eax
+     a13:	85 c0                	test   %eax,%eax
+     a15:	7e 15                	jle    a2c <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     a17:	83 ec 04             	sub    $0x4,%esp
+     a1a:	50                   	push   %eax
+     a1b:	56                   	push   %esi
+     a1c:	57                   	push   %edi
+     a1d:	e8 db 01 00 00       	call   bfd <write>
+    ob[fd].n = 0;
+     a22:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+     a29:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     a2c:	83 c7 01             	add    $0x1,%edi
+     a2f:	81 c6 08 01 00 00    	add    $0x108,%esi
+     a35:	83 ff 10             	cmp    $0x10,%edi
+     a38:	75 d6                	jne    a10 <gets+0x10>
+  for(i=0; i+1 < max; ){
+     a3a:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+     a3c:	8d 75 e7             	lea    -0x19(%ebp),%esi
+     a3f:	eb 2e                	jmp    a6f <gets+0x6f>
+     a41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a48:	83 ec 04             	sub    $0x4,%esp
+     a4b:	6a 01                	push   $0x1
+     a4d:	56                   	push   %esi
+     a4e:	6a 00                	push   $0x0
+     a50:	e8 a1 01 00 00       	call   bf6 <read>
+    if(cc < 1)
+     a55:	83 c4 10             	add    $0x10,%esp
+     a58:	85 c0                	test   %eax,%eax
+     a5a:	7e 1d                	jle    a79 <gets+0x79>
+    buf[i++] = c;
+     a5c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     a60:	8b 55 08             	mov    0x8(%ebp),%edx
+     a63:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     a67:	3c 0a                	cmp    $0xa,%al
+     a69:	74 10                	je     a7b <gets+0x7b>
+     a6b:	3c 0d                	cmp    $0xd,%al
+     a6d:	74 0c                	je     a7b <gets+0x7b>
+  for(i=0; i+1 < max; ){
+     a6f:	89 df                	mov    %ebx,%edi
+     a71:	83 c3 01             	add    $0x1,%ebx
+     a74:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     a77:	7c cf                	jl     a48 <gets+0x48>
+     a79:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     a7b:	8b 45 08             	mov    0x8(%ebp),%eax
+     a7e:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     a82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a85:	5b                   	pop    %ebx
+     a86:	5e                   	pop    %esi
+     a87:	5f                   	pop    %edi
+     a88:	5d                   	pop    %ebp
+     a89:	c3                   	ret
+     a8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a90 <stat>:
+{
+     a90:	55                   	push   %ebp
+     a91:	89 e5                	mov    %esp,%ebp
+     a93:	57                   	push   %edi
+     a94:	56                   	push   %esi
+     a95:	53                   	push   %ebx
+     a96:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+     a99:	6a 00                	push   $0x0
+     a9b:	ff 75 08             	push   0x8(%ebp)
+     a9e:	e8 76 01 00 00       	call   c19 <open>
+  if(fd < 0)
+     aa3:	83 c4 10             	add    $0x10,%esp
+     aa6:	85 c0                	test   %eax,%eax
+     aa8:	78 76                	js     b20 <stat+0x90>
+  r = fstat(fd, st);
+     aaa:	83 ec 08             	sub    $0x8,%esp
+     aad:	ff 75 0c             	push   0xc(%ebp)
+     ab0:	89 c3                	mov    %eax,%ebx
+     ab2:	50                   	push   %eax
+     ab3:	e8 7f 01 00 00       	call   c37 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     ab8:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     abb:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     abd:	83 fb 0f             	cmp    $0xf,%ebx
+     ac0:	7f 40                	jg     b02 <stat+0x72>
+     ac2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     ac8:	8b 90 84 1d 00 00    	mov    0x1d84(%eax),%edx
+     ace:	8d b8 80 1d 00 00    	lea    0x1d80(%eax),%edi
+     ad4:	85 d2                	test   %edx,%edx
+     ad6:	7e 1a                	jle    af2 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+     ad8:	83 ec 04             	sub    $0x4,%esp
+     adb:	05 88 1d 00 00       	add    $0x1d88,%eax
+     ae0:	52                   	push   %edx
+     ae1:	50                   	push   %eax
+     ae2:	53                   	push   %ebx
+     ae3:	e8 15 01 00 00       	call   bfd <write>
+    ob[fd].n = 0;
+     ae8:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+     aef:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+     af2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     af8:	c7 80 80 1d 00 00 00 	movl   $0x0,0x1d80(%eax)
+     aff:	00 00 00 
+  return _close(fd);
+     b02:	83 ec 0c             	sub    $0xc,%esp
+     b05:	53                   	push   %ebx
+     b06:	e8 f9 00 00 00       	call   c04 <_close>
+     b0b:	83 c4 10             	add    $0x10,%esp
+}
+     b0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b11:	89 f0                	mov    %esi,%eax
+     b13:	5b                   	pop    %ebx
+     b14:	5e                   	pop    %esi
+     b15:	5f                   	pop    %edi
+     b16:	5d                   	pop    %ebp
+     b17:	c3                   	ret
+     b18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b1f:	90                   	nop
+    return -1;
+     b20:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     b25:	eb e7                	jmp    b0e <stat+0x7e>
+     b27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b2e:	66 90                	xchg   %ax,%ax
+
+00000b30 <atoi>:
+{
+     b30:	55                   	push   %ebp
+     b31:	89 e5                	mov    %esp,%ebp
+     b33:	53                   	push   %ebx
+     b34:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     b37:	0f be 02             	movsbl (%edx),%eax
+     b3a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     b3d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     b40:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     b45:	77 1e                	ja     b65 <atoi+0x35>
+     b47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b4e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     b50:	83 c2 01             	add    $0x1,%edx
+     b53:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     b56:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     b5a:	0f be 02             	movsbl (%edx),%eax
+     b5d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     b60:	80 fb 09             	cmp    $0x9,%bl
+     b63:	76 eb                	jbe    b50 <atoi+0x20>
+}
+     b65:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b68:	89 c8                	mov    %ecx,%eax
+     b6a:	c9                   	leave
+     b6b:	c3                   	ret
+     b6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b70 <memmove>:
+{
+     b70:	55                   	push   %ebp
+     b71:	89 e5                	mov    %esp,%ebp
+     b73:	57                   	push   %edi
+     b74:	56                   	push   %esi
+     b75:	8b 45 10             	mov    0x10(%ebp),%eax
+     b78:	8b 55 08             	mov    0x8(%ebp),%edx
+     b7b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     b7e:	85 c0                	test   %eax,%eax
+     b80:	7e 13                	jle    b95 <memmove+0x25>
+     b82:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     b84:	89 d7                	mov    %edx,%edi
+     b86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b8d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     b90:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     b91:	39 f8                	cmp    %edi,%eax
+     b93:	75 fb                	jne    b90 <memmove+0x20>
+  return vdst;
+}
+     b95:	5e                   	pop    %esi
+     b96:	89 d0                	mov    %edx,%eax
+     b98:	5f                   	pop    %edi
+     b99:	5d                   	pop    %ebp
+     b9a:	c3                   	ret
+
+00000b9b <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+     b9b:	83 3d 70 19 00 00 00 	cmpl   $0x0,0x1970
+  jle 1f
+     ba2:	7e 0a                	jle    bae <syscallentry+0x13>
+  movl %esp, %ecx
+     ba4:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+     ba6:	ba ad 0b 00 00       	mov    $0xbad,%edx
+  sysenter
+     bab:	0f 34                	sysenter
+2:
+  ret
+     bad:	c3                   	ret
+1:
+  jl 3f
+     bae:	7c 27                	jl     bd7 <syscallentry+0x3c>
+  pushal
+     bb0:	60                   	pusha
+  movl $1, %eax
+     bb1:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     bb6:	0f a2                	cpuid
+  movl $-1, sysentermode
+     bb8:	c7 05 70 19 00 00 ff 	movl   $0xffffffff,0x1970
+     bbf:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     bc2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+     bc8:	74 0a                	je     bd4 <syscallentry+0x39>
+  movl $1, sysentermode
+     bca:	c7 05 70 19 00 00 01 	movl   $0x1,0x1970
+     bd1:	00 00 00 
+4:
+  popal
+     bd4:	61                   	popa
+  jmp syscallentry
+     bd5:	eb c4                	jmp    b9b <syscallentry>
+3:
+  int $T_SYSCALL
+     bd7:	cd 40                	int    $0x40
+  ret
+     bd9:	c3                   	ret
+
+00000bda <_fork>:
+
+SYSCALLAS(_fork, fork)
+     bda:	b8 01 00 00 00       	mov    $0x1,%eax
+     bdf:	eb ba                	jmp    b9b <syscallentry>
+
+00000be1 <_exit>:
+SYSCALLAS(_exit, exit)
+     be1:	b8 02 00 00 00       	mov    $0x2,%eax
+     be6:	eb b3                	jmp    b9b <syscallentry>
+
+00000be8 <wait>:
+SYSCALL(wait)
+     be8:	b8 03 00 00 00       	mov    $0x3,%eax
+     bed:	eb ac                	jmp    b9b <syscallentry>
+
+00000bef <pipe>:
+SYSCALL(pipe)
+     bef:	b8 04 00 00 00       	mov    $0x4,%eax
+     bf4:	eb a5                	jmp    b9b <syscallentry>
+
+00000bf6 <read>:
+SYSCALL(read)
+     bf6:	b8 05 00 00 00       	mov    $0x5,%eax
+     bfb:	eb 9e                	jmp    b9b <syscallentry>
+
+00000bfd <write>:
+SYSCALL(write)
+     bfd:	b8 10 00 00 00       	mov    $0x10,%eax
+     c02:	eb 97                	jmp    b9b <syscallentry>
+
+00000c04 <_close>:
+SYSCALLAS(_close, close)
+     c04:	b8 15 00 00 00       	mov    $0x15,%eax
+     c09:	eb 90                	jmp    b9b <syscallentry>
+
+00000c0b <kill>:
+SYSCALL(kill)
+     c0b:	b8 06 00 00 00       	mov    $0x6,%eax
+     c10:	eb 89                	jmp    b9b <syscallentry>
+
+00000c12 <_exec>:
+SYSCALLAS(_exec, exec)
+     c12:	b8 07 00 00 00       	mov    $0x7,%eax
+     c17:	eb 82                	jmp    b9b <syscallentry>
+
+00000c19 <open>:
+SYSCALL(open)
+     c19:	b8 0f 00 00 00       	mov    $0xf,%eax
+     c1e:	e9 78 ff ff ff       	jmp    b9b <syscallentry>
+
+00000c23 <mknod>:
+SYSCALL(mknod)
+     c23:	b8 11 00 00 00       	mov    $0x11,%eax
+     c28:	e9 6e ff ff ff       	jmp    b9b <syscallentry>
+
+00000c2d <unlink>:
+SYSCALL(unlink)
+     c2d:	b8 12 00 00 00       	mov    $0x12,%eax
+     c32:	e9 64 ff ff ff       	jmp    b9b <syscallentry>
+
+00000c37 <fstat>:
+SYSCALL(fstat)
+     c37:	b8 08 00 00 00       	mov    $0x8,%eax
+     c3c:	e9 5a ff ff ff       	jmp    b9b <syscallentry>
+
+00000c41 <link>:
+SYSCALL(link)
+     c41:	b8 13 00 00 00       	mov    $0x13,%eax
+     c46:	e9 50 ff ff ff       	jmp    b9b <syscallentry>
+
+00000c4b <mkdir>:
+SYSCALL(mkdir)
+     c4b:	b8 14 00 00 00       	mov    $0x14,%eax
+     c50:	e9 46 ff ff ff       	jmp    b9b <syscallentry>
+
+00000c55 <chdir>:
+SYSCALL(chdir)
+     c55:	b8 09 00 00 00       	mov    $0x9,%eax
+     c5a:	e9 3c ff ff ff       	jmp    b9b <syscallentry>
+
+00000c5f <dup>:
+SYSCALL(dup)
+     c5f:	b8 0a 00 00 00       	mov    $0xa,%eax
+     c64:	e9 32 ff ff ff       	jmp    b9b <syscallentry>
+
+00000c69 <getpid>:
+SYSCALL(getpid)
+     c69:	b8 0b 00 00 00       	mov    $0xb,%eax
+     c6e:	e9 28 ff ff ff       	jmp    b9b <syscallentry>
+
+00000c73 <sbrk>:
+SYSCALL(sbrk)
+     c73:	b8 0c 00 00 00       	mov    $0xc,%eax
+     c78:	e9 1e ff ff ff       	jmp    b9b <syscallentry>
+
+00000c7d <sleep>:
+SYSCALL(sleep)
+     c7d:	b8 0d 00 00 00       	mov    $0xd,%eax
+     c82:	e9 14 ff ff ff       	jmp    b9b <syscallentry>
+
+00000c87 <uptime>:
+SYSCALL(uptime)
+     c87:	b8 0e 00 00 00       	mov    $0xe,%eax
+     c8c:	e9 0a ff ff ff       	jmp    b9b <syscallentry>
+
+00000c91 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+     c91:	b8 16 00 00 00       	mov    $0x16,%eax
+     c96:	e9 00 ff ff ff       	jmp    b9b <syscallentry>
+
+00000c9b <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+     c9b:	b8 17 00 00 00       	mov    $0x17,%eax
+     ca0:	e9 f6 fe ff ff       	jmp    b9b <syscallentry>
+
+00000ca5 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+     ca5:	b8 18 00 00 00       	mov    $0x18,%eax
+     caa:	e9 ec fe ff ff       	jmp    b9b <syscallentry>
+
+00000caf <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+     caf:	b8 19 00 00 00       	mov    $0x19,%eax
+     cb4:	e9 e2 fe ff ff       	jmp    b9b <syscallentry>
+
+00000cb9 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+     cb9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     cbe:	e9 d8 fe ff ff       	jmp    b9b <syscallentry>
+
+00000cc3 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+     cc3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     cc8:	e9 ce fe ff ff       	jmp    b9b <syscallentry>
+
+00000ccd <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+     ccd:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     cd2:	e9 c4 fe ff ff       	jmp    b9b <syscallentry>
+
+00000cd7 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+     cd7:	b8 20 00 00 00       	mov    $0x20,%eax
+     cdc:	e9 ba fe ff ff       	jmp    b9b <syscallentry>
+
+00000ce1 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+     ce1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     ce6:	e9 b0 fe ff ff       	jmp    b9b <syscallentry>
+
+00000ceb <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+     ceb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     cf0:	e9 a6 fe ff ff       	jmp    b9b <syscallentry>
+
+00000cf5 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+     cf5:	b8 21 00 00 00       	mov    $0x21,%eax
+     cfa:	e9 9c fe ff ff       	jmp    b9b <syscallentry>
+
+00000cff <yield>:
+SYSCALL(yield) // yield the CPU to another process
+     cff:	b8 22 00 00 00       	mov    $0x22,%eax
+     d04:	e9 92 fe ff ff       	jmp    b9b <syscallentry>
+
+00000d09 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+     d09:	b8 23 00 00 00       	mov    $0x23,%eax
+     d0e:	e9 88 fe ff ff       	jmp    b9b <syscallentry>
+
+00000d13 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+     d13:	b8 24 00 00 00       	mov    $0x24,%eax
+     d18:	e9 7e fe ff ff       	jmp    b9b <syscallentry>
+
+00000d1d <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+     d1d:	b8 25 00 00 00       	mov    $0x25,%eax
+     d22:	e9 74 fe ff ff       	jmp    b9b <syscallentry>
+
+00000d27 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+     d27:	b8 26 00 00 00       	mov    $0x26,%eax
+     d2c:	e9 6a fe ff ff       	jmp    b9b <syscallentry>
+
+00000d31 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+     d31:	b8 27 00 00 00       	mov    $0x27,%eax
+     d36:	e9 60 fe ff ff       	jmp    b9b <syscallentry>
+
+00000d3b <mmap>:
+SYSCALL(mmap) // map a file into memory
+     d3b:	b8 28 00 00 00       	mov    $0x28,%eax
+     d40:	e9 56 fe ff ff       	jmp    b9b <syscallentry>
+
+00000d45 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+     d45:	b8 29 00 00 00       	mov    $0x29,%eax
+     d4a:	e9 4c fe ff ff       	jmp    b9b <syscallentry>
+
+00000d4f <readv>:
+SYSCALL(readv) // read into several buffers
+     d4f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     d54:	e9 42 fe ff ff       	jmp    b9b <syscallentry>
+
+00000d59 <writev>:
+SYSCALL(writev) // write from several buffers
+     d59:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     d5e:	e9 38 fe ff ff       	jmp    b9b <syscallentry>
+
+00000d63 <pread>:
+SYSCALL(pread) // read at an offset
+     d63:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     d68:	e9 2e fe ff ff       	jmp    b9b <syscallentry>
+
+00000d6d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+     d6d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     d72:	e9 24 fe ff ff       	jmp    b9b <syscallentry>
+
+00000d77 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+     d77:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     d7c:	e9 1a fe ff ff       	jmp    b9b <syscallentry>
+
+00000d81 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+     d81:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     d86:	e9 10 fe ff ff       	jmp    b9b <syscallentry>
+
+00000d8b <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+     d8b:	b8 30 00 00 00       	mov    $0x30,%eax
+     d90:	e9 06 fe ff ff       	jmp    b9b <syscallentry>
+
+00000d95 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+     d95:	b8 31 00 00 00       	mov    $0x31,%eax
+     d9a:	e9 fc fd ff ff       	jmp    b9b <syscallentry>
+
+00000d9f <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+     d9f:	b8 32 00 00 00       	mov    $0x32,%eax
+     da4:	e9 f2 fd ff ff       	jmp    b9b <syscallentry>
+
+00000da9 <profread>:
+SYSCALL(profread) // drain profiler samples
+     da9:	b8 33 00 00 00       	mov    $0x33,%eax
+     dae:	e9 e8 fd ff ff       	jmp    b9b <syscallentry>
+
+00000db3 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+     db3:	b8 34 00 00 00       	mov    $0x34,%eax
+     db8:	e9 de fd ff ff       	jmp    b9b <syscallentry>
+
+00000dbd <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+     dbd:	b8 35 00 00 00       	mov    $0x35,%eax
+     dc2:	e9 d4 fd ff ff       	jmp    b9b <syscallentry>
+
+00000dc7 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+     dc7:	b8 36 00 00 00       	mov    $0x36,%eax
+     dcc:	e9 ca fd ff ff       	jmp    b9b <syscallentry>
+
+00000dd1 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+     dd1:	b8 37 00 00 00       	mov    $0x37,%eax
+     dd6:	e9 c0 fd ff ff       	jmp    b9b <syscallentry>
+     ddb:	66 90                	xchg   %ax,%ax
+     ddd:	66 90                	xchg   %ax,%ax
+     ddf:	90                   	nop
+
+00000de0 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     de0:	55                   	push   %ebp
+     de1:	89 e5                	mov    %esp,%ebp
+     de3:	57                   	push   %edi
+     de4:	56                   	push   %esi
+     de5:	53                   	push   %ebx
+     de6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     de8:	89 d1                	mov    %edx,%ecx
+{
+     dea:	83 ec 3c             	sub    $0x3c,%esp
+     ded:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     df0:	85 d2                	test   %edx,%edx
+     df2:	0f 89 80 00 00 00    	jns    e78 <printint+0x98>
+     df8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     dfc:	74 7a                	je     e78 <printint+0x98>
+    x = -xx;
+     dfe:	f7 d9                	neg    %ecx
+    neg = 1;
+     e00:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     e05:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     e08:	31 f6                	xor    %esi,%esi
+     e0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     e10:	89 c8                	mov    %ecx,%eax
+     e12:	31 d2                	xor    %edx,%edx
+     e14:	89 f7                	mov    %esi,%edi
+     e16:	f7 f3                	div    %ebx
+     e18:	8d 76 01             	lea    0x1(%esi),%esi
+     e1b:	0f b6 92 d0 13 00 00 	movzbl 0x13d0(%edx),%edx
+     e22:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     e26:	89 ca                	mov    %ecx,%edx
+     e28:	89 c1                	mov    %eax,%ecx
+     e2a:	39 da                	cmp    %ebx,%edx
+     e2c:	73 e2                	jae    e10 <printint+0x30>
+  if(neg)
+     e2e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     e31:	85 c0                	test   %eax,%eax
+     e33:	74 07                	je     e3c <printint+0x5c>
+    buf[i++] = '-';
+     e35:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     e3a:	89 f7                	mov    %esi,%edi
+     e3c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     e3f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     e42:	01 df                	add    %ebx,%edi
+     e44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     e48:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+     e4b:	83 ec 04             	sub    $0x4,%esp
+     e4e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     e51:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     e54:	6a 01                	push   $0x1
+     e56:	50                   	push   %eax
+     e57:	56                   	push   %esi
+     e58:	e8 e3 f6 ff ff       	call   540 <bufwrite>
+  while(--i >= 0)
+     e5d:	89 f8                	mov    %edi,%eax
+     e5f:	83 c4 10             	add    $0x10,%esp
+     e62:	83 ef 01             	sub    $0x1,%edi
+     e65:	39 d8                	cmp    %ebx,%eax
+     e67:	75 df                	jne    e48 <printint+0x68>
+}
+     e69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e6c:	5b                   	pop    %ebx
+     e6d:	5e                   	pop    %esi
+     e6e:	5f                   	pop    %edi
+     e6f:	5d                   	pop    %ebp
+     e70:	c3                   	ret
+     e71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     e78:	31 c0                	xor    %eax,%eax
+     e7a:	eb 89                	jmp    e05 <printint+0x25>
+     e7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000e80 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     e80:	55                   	push   %ebp
+     e81:	89 e5                	mov    %esp,%ebp
+     e83:	57                   	push   %edi
+     e84:	56                   	push   %esi
+     e85:	53                   	push   %ebx
+     e86:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     e89:	8b 45 0c             	mov    0xc(%ebp),%eax
+     e8c:	0f b6 18             	movzbl (%eax),%ebx
+     e8f:	84 db                	test   %bl,%bl
+     e91:	74 6c                	je     eff <printf+0x7f>
+     e93:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+     e96:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+     e99:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     e9b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     e9e:	eb 26                	jmp    ec6 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     ea0:	83 f8 25             	cmp    $0x25,%eax
+     ea3:	74 4b                	je     ef0 <printf+0x70>
+  bufwrite(fd, &c, 1);
+     ea5:	83 ec 04             	sub    $0x4,%esp
+     ea8:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     eab:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     eae:	6a 01                	push   $0x1
+     eb0:	50                   	push   %eax
+     eb1:	ff 75 08             	push   0x8(%ebp)
+     eb4:	e8 87 f6 ff ff       	call   540 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+     eb9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     ebc:	0f b6 1f             	movzbl (%edi),%ebx
+     ebf:	83 c7 01             	add    $0x1,%edi
+     ec2:	84 db                	test   %bl,%bl
+     ec4:	74 39                	je     eff <printf+0x7f>
+    c = fmt[i] & 0xff;
+     ec6:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     ec9:	85 f6                	test   %esi,%esi
+     ecb:	74 d3                	je     ea0 <printf+0x20>
+      }
+    } else if(state == '%'){
+     ecd:	83 fe 25             	cmp    $0x25,%esi
+     ed0:	75 ea                	jne    ebc <printf+0x3c>
+      if(c == 'd'){
+     ed2:	83 f8 25             	cmp    $0x25,%eax
+     ed5:	0f 84 d5 01 00 00    	je     10b0 <printf+0x230>
+     edb:	83 e8 63             	sub    $0x63,%eax
+     ede:	83 f8 15             	cmp    $0x15,%eax
+     ee1:	77 45                	ja     f28 <printf+0xa8>
+     ee3:	ff 24 85 78 13 00 00 	jmp    *0x1378(,%eax,4)
+     eea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     ef0:	0f b6 1f             	movzbl (%edi),%ebx
+     ef3:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+     ef6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     efb:	84 db                	test   %bl,%bl
+     efd:	75 c7                	jne    ec6 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+     eff:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+     f03:	74 0b                	je     f10 <printf+0x90>
+    fflush(fd);
+}
+     f05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f08:	5b                   	pop    %ebx
+     f09:	5e                   	pop    %esi
+     f0a:	5f                   	pop    %edi
+     f0b:	5d                   	pop    %ebp
+     f0c:	c3                   	ret
+     f0d:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+     f10:	83 ec 0c             	sub    $0xc,%esp
+     f13:	6a 02                	push   $0x2
+     f15:	e8 c6 f7 ff ff       	call   6e0 <fflush>
+     f1a:	83 c4 10             	add    $0x10,%esp
+}
+     f1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f20:	5b                   	pop    %ebx
+     f21:	5e                   	pop    %esi
+     f22:	5f                   	pop    %edi
+     f23:	5d                   	pop    %ebp
+     f24:	c3                   	ret
+     f25:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+     f28:	83 ec 04             	sub    $0x4,%esp
+     f2b:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     f2e:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+     f32:	6a 01                	push   $0x1
+     f34:	52                   	push   %edx
+     f35:	89 55 c0             	mov    %edx,-0x40(%ebp)
+     f38:	ff 75 08             	push   0x8(%ebp)
+     f3b:	e8 00 f6 ff ff       	call   540 <bufwrite>
+     f40:	83 c4 0c             	add    $0xc,%esp
+     f43:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     f46:	6a 01                	push   $0x1
+     f48:	8b 55 c0             	mov    -0x40(%ebp),%edx
+     f4b:	52                   	push   %edx
+      state = 0;
+     f4c:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+     f4e:	ff 75 08             	push   0x8(%ebp)
+     f51:	e8 ea f5 ff ff       	call   540 <bufwrite>
+        putc(fd, c);
+     f56:	83 c4 10             	add    $0x10,%esp
+     f59:	e9 5e ff ff ff       	jmp    ebc <printf+0x3c>
+     f5e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+     f60:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     f63:	83 ec 0c             	sub    $0xc,%esp
+     f66:	b9 10 00 00 00       	mov    $0x10,%ecx
+     f6b:	8b 16                	mov    (%esi),%edx
+     f6d:	6a 00                	push   $0x0
+     f6f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+     f72:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+     f75:	e8 66 fe ff ff       	call   de0 <printint>
+        ap++;
+     f7a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     f7d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     f80:	31 f6                	xor    %esi,%esi
+     f82:	e9 35 ff ff ff       	jmp    ebc <printf+0x3c>
+     f87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f8e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     f90:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     f93:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     f95:	83 c0 04             	add    $0x4,%eax
+     f98:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+     f9b:	b8 6e 13 00 00       	mov    $0x136e,%eax
+     fa0:	85 db                	test   %ebx,%ebx
+     fa2:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+     fa5:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+     fa8:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+     faa:	53                   	push   %ebx
+     fab:	e8 90 f9 ff ff       	call   940 <strlen>
+     fb0:	83 c4 0c             	add    $0xc,%esp
+     fb3:	50                   	push   %eax
+     fb4:	53                   	push   %ebx
+     fb5:	ff 75 08             	push   0x8(%ebp)
+     fb8:	e8 83 f5 ff ff       	call   540 <bufwrite>
+     fbd:	83 c4 10             	add    $0x10,%esp
+     fc0:	e9 f7 fe ff ff       	jmp    ebc <printf+0x3c>
+     fc5:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+     fc8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+     fcb:	83 ec 04             	sub    $0x4,%esp
+     fce:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+     fd1:	8b 06                	mov    (%esi),%eax
+        ap++;
+     fd3:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+     fd6:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+     fd9:	6a 01                	push   $0x1
+     fdb:	52                   	push   %edx
+     fdc:	ff 75 08             	push   0x8(%ebp)
+     fdf:	e8 5c f5 ff ff       	call   540 <bufwrite>
+        ap++;
+     fe4:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     fe7:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     fea:	31 f6                	xor    %esi,%esi
+     fec:	e9 cb fe ff ff       	jmp    ebc <printf+0x3c>
+     ff1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+     ff8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     ffb:	83 ec 0c             	sub    $0xc,%esp
+     ffe:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    1003:	8b 16                	mov    (%esi),%edx
+    1005:	6a 01                	push   $0x1
+    1007:	e9 63 ff ff ff       	jmp    f6f <printf+0xef>
+    100c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+    1010:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1013:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+    1016:	89 7d c0             	mov    %edi,-0x40(%ebp)
+    1019:	89 55 bc             	mov    %edx,-0x44(%ebp)
+    101c:	8b 18                	mov    (%eax),%ebx
+    101e:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+    1021:	31 c0                	xor    %eax,%eax
+    1023:	89 c7                	mov    %eax,%edi
+    1025:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+    1028:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+    102d:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+    102f:	f7 e1                	mul    %ecx
+    1031:	c1 ea 03             	shr    $0x3,%edx
+    1034:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    1037:	89 d1                	mov    %edx,%ecx
+    1039:	01 c0                	add    %eax,%eax
+    103b:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+    103d:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+    103f:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+    1041:	be 0a 00 00 00       	mov    $0xa,%esi
+    1046:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+    1048:	89 da                	mov    %ebx,%edx
+    104a:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+    104c:	89 fe                	mov    %edi,%esi
+    104e:	83 c7 01             	add    $0x1,%edi
+    1051:	8d 42 30             	lea    0x30(%edx),%eax
+    1054:	89 da                	mov    %ebx,%edx
+    1056:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    1059:	01 d2                	add    %edx,%edx
+    105b:	29 d0                	sub    %edx,%eax
+    105d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+    1061:	89 c8                	mov    %ecx,%eax
+    1063:	09 d8                	or     %ebx,%eax
+    1065:	75 c1                	jne    1028 <printf+0x1a8>
+    1067:	8b 55 bc             	mov    -0x44(%ebp),%edx
+    106a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    106d:	01 d6                	add    %edx,%esi
+    106f:	89 f7                	mov    %esi,%edi
+    1071:	89 d6                	mov    %edx,%esi
+    1073:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1077:	90                   	nop
+    putc(fd, buf[i]);
+    1078:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+    107b:	83 ec 04             	sub    $0x4,%esp
+    107e:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+    1081:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+    1084:	6a 01                	push   $0x1
+    1086:	50                   	push   %eax
+    1087:	53                   	push   %ebx
+    1088:	e8 b3 f4 ff ff       	call   540 <bufwrite>
+  while(--i >= 0)
+    108d:	89 fa                	mov    %edi,%edx
+    108f:	83 c4 10             	add    $0x10,%esp
+    1092:	83 ef 01             	sub    $0x1,%edi
+    1095:	39 d6                	cmp    %edx,%esi
+    1097:	75 df                	jne    1078 <printf+0x1f8>
+        ap += 2;
+    1099:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+    109d:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+    10a0:	31 f6                	xor    %esi,%esi
+    10a2:	e9 15 fe ff ff       	jmp    ebc <printf+0x3c>
+    10a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ae:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+    10b0:	83 ec 04             	sub    $0x4,%esp
+    10b3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+    10b6:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+    10b9:	6a 01                	push   $0x1
+    10bb:	e9 8b fe ff ff       	jmp    f4b <printf+0xcb>
+
+000010c0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    10c0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    10c1:	a1 00 2e 00 00       	mov    0x2e00,%eax
+{
+    10c6:	89 e5                	mov    %esp,%ebp
+    10c8:	57                   	push   %edi
+    10c9:	56                   	push   %esi
+    10ca:	53                   	push   %ebx
+    10cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    10ce:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    10d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10d8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    10da:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    10dc:	39 ca                	cmp    %ecx,%edx
+    10de:	73 30                	jae    1110 <free+0x50>
+    10e0:	39 c1                	cmp    %eax,%ecx
+    10e2:	72 04                	jb     10e8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    10e4:	39 c2                	cmp    %eax,%edx
+    10e6:	72 f0                	jb     10d8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    10e8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    10eb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    10ee:	39 f8                	cmp    %edi,%eax
+    10f0:	74 2e                	je     1120 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    10f2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    10f5:	8b 42 04             	mov    0x4(%edx),%eax
+    10f8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    10fb:	39 f1                	cmp    %esi,%ecx
+    10fd:	74 38                	je     1137 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    10ff:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1101:	5b                   	pop    %ebx
+  freep = p;
+    1102:	89 15 00 2e 00 00    	mov    %edx,0x2e00
+}
+    1108:	5e                   	pop    %esi
+    1109:	5f                   	pop    %edi
+    110a:	5d                   	pop    %ebp
+    110b:	c3                   	ret
+    110c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1110:	39 c1                	cmp    %eax,%ecx
+    1112:	72 d0                	jb     10e4 <free+0x24>
+    1114:	eb c2                	jmp    10d8 <free+0x18>
+    1116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    111d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1120:	03 70 04             	add    0x4(%eax),%esi
+    1123:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1126:	8b 02                	mov    (%edx),%eax
+    1128:	8b 00                	mov    (%eax),%eax
+    112a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    112d:	8b 42 04             	mov    0x4(%edx),%eax
+    1130:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1133:	39 f1                	cmp    %esi,%ecx
+    1135:	75 c8                	jne    10ff <free+0x3f>
+    p->s.size += bp->s.size;
+    1137:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    113a:	89 15 00 2e 00 00    	mov    %edx,0x2e00
+    p->s.size += bp->s.size;
+    1140:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1143:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1146:	89 0a                	mov    %ecx,(%edx)
+}
+    1148:	5b                   	pop    %ebx
+    1149:	5e                   	pop    %esi
+    114a:	5f                   	pop    %edi
+    114b:	5d                   	pop    %ebp
+    114c:	c3                   	ret
+    114d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001150 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1150:	55                   	push   %ebp
+    1151:	89 e5                	mov    %esp,%ebp
+    1153:	57                   	push   %edi
+    1154:	56                   	push   %esi
+    1155:	53                   	push   %ebx
+    1156:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1159:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    115c:	8b 15 00 2e 00 00    	mov    0x2e00,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1162:	8d 78 07             	lea    0x7(%eax),%edi
+    1165:	c1 ef 03             	shr    $0x3,%edi
+    1168:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    116b:	85 d2                	test   %edx,%edx
+    116d:	0f 84 8d 00 00 00    	je     1200 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1173:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1175:	8b 48 04             	mov    0x4(%eax),%ecx
+    1178:	39 f9                	cmp    %edi,%ecx
+    117a:	73 64                	jae    11e0 <malloc+0x90>
+  if(nu < 4096)
+    117c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1181:	39 df                	cmp    %ebx,%edi
+    1183:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1186:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    118d:	eb 0a                	jmp    1199 <malloc+0x49>
+    118f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1190:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1192:	8b 48 04             	mov    0x4(%eax),%ecx
+    1195:	39 f9                	cmp    %edi,%ecx
+    1197:	73 47                	jae    11e0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1199:	89 c2                	mov    %eax,%edx
+    119b:	39 05 00 2e 00 00    	cmp    %eax,0x2e00
+    11a1:	75 ed                	jne    1190 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    11a3:	83 ec 0c             	sub    $0xc,%esp
+    11a6:	56                   	push   %esi
+    11a7:	e8 c7 fa ff ff       	call   c73 <sbrk>
+  if(p == (char*)-1)
+    11ac:	83 c4 10             	add    $0x10,%esp
+    11af:	83 f8 ff             	cmp    $0xffffffff,%eax
+    11b2:	74 1c                	je     11d0 <malloc+0x80>
+  hp->s.size = nu;
+    11b4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    11b7:	83 ec 0c             	sub    $0xc,%esp
+    11ba:	83 c0 08             	add    $0x8,%eax
+    11bd:	50                   	push   %eax
+    11be:	e8 fd fe ff ff       	call   10c0 <free>
+  return freep;
+    11c3:	8b 15 00 2e 00 00    	mov    0x2e00,%edx
+      if((p = morecore(nunits)) == 0)
+    11c9:	83 c4 10             	add    $0x10,%esp
+    11cc:	85 d2                	test   %edx,%edx
+    11ce:	75 c0                	jne    1190 <malloc+0x40>
+        return 0;
+  }
+}
+    11d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    11d3:	31 c0                	xor    %eax,%eax
+}
+    11d5:	5b                   	pop    %ebx
+    11d6:	5e                   	pop    %esi
+    11d7:	5f                   	pop    %edi
+    11d8:	5d                   	pop    %ebp
+    11d9:	c3                   	ret
+    11da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    11e0:	39 cf                	cmp    %ecx,%edi
+    11e2:	74 4c                	je     1230 <malloc+0xe0>
+        p->s.size -= nunits;
+    11e4:	29 f9                	sub    %edi,%ecx
+    11e6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    11e9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    11ec:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    11ef:	89 15 00 2e 00 00    	mov    %edx,0x2e00
+}
+    11f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    11f8:	83 c0 08             	add    $0x8,%eax
+}
+    11fb:	5b                   	pop    %ebx
+    11fc:	5e                   	pop    %esi
+    11fd:	5f                   	pop    %edi
+    11fe:	5d                   	pop    %ebp
+    11ff:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1200:	c7 05 00 2e 00 00 04 	movl   $0x2e04,0x2e00
+    1207:	2e 00 00 
+    base.s.size = 0;
+    120a:	b8 04 2e 00 00       	mov    $0x2e04,%eax
+    base.s.ptr = freep = prevp = &base;
+    120f:	c7 05 04 2e 00 00 04 	movl   $0x2e04,0x2e04
+    1216:	2e 00 00 
+    base.s.size = 0;
+    1219:	c7 05 08 2e 00 00 00 	movl   $0x0,0x2e08
+    1220:	00 00 00 
+    if(p->s.size >= nunits){
+    1223:	e9 54 ff ff ff       	jmp    117c <malloc+0x2c>
+    1228:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    122f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1230:	8b 08                	mov    (%eax),%ecx
+    1232:	89 0a                	mov    %ecx,(%edx)
+    1234:	eb b9                	jmp    11ef <malloc+0x9f>
+    1236:	66 90                	xchg   %ax,%ax
+    1238:	66 90                	xchg   %ax,%ax
+    123a:	66 90                	xchg   %ax,%ax
+    123c:	66 90                	xchg   %ax,%ax
+    123e:	66 90                	xchg   %ax,%ax
+
+00001240 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+    1240:	55                   	push   %ebp
+    1241:	89 e5                	mov    %esp,%ebp
+    1243:	57                   	push   %edi
+    1244:	56                   	push   %esi
+    1245:	be 01 00 00 00       	mov    $0x1,%esi
+    124a:	53                   	push   %ebx
+    124b:	83 ec 28             	sub    $0x28,%esp
+    124e:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1251:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1254:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+    1257:	68 00 98 00 00       	push   $0x9800
+    125c:	e8 ef fe ff ff       	call   1150 <malloc>
+    1261:	83 c4 10             	add    $0x10,%esp
+    1264:	89 c7                	mov    %eax,%edi
+    1266:	85 c0                	test   %eax,%eax
+    1268:	74 62                	je     12cc <waitpoll+0x8c>
+    126a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+    1270:	83 ec 0c             	sub    $0xc,%esp
+    1273:	6a 01                	push   $0x1
+    1275:	e8 03 fa ff ff       	call   c7d <sleep>
+    fn();
+    127a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    127d:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+    127f:	58                   	pop    %eax
+    1280:	5a                   	pop    %edx
+    1281:	68 00 02 00 00       	push   $0x200
+    1286:	57                   	push   %edi
+    1287:	e8 eb fa ff ff       	call   d77 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+    128c:	83 c4 10             	add    $0x10,%esp
+    128f:	85 c0                	test   %eax,%eax
+    1291:	7e 2d                	jle    12c0 <waitpoll+0x80>
+    1293:	6b c0 4c             	imul   $0x4c,%eax,%eax
+    1296:	89 fa                	mov    %edi,%edx
+    alive = 0;
+    1298:	31 c9                	xor    %ecx,%ecx
+    129a:	01 f8                	add    %edi,%eax
+    129c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+    12a0:	3b 1a                	cmp    (%edx),%ebx
+    12a2:	75 07                	jne    12ab <waitpoll+0x6b>
+        alive = 1;
+    12a4:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+    12a8:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+    12ab:	83 c2 4c             	add    $0x4c,%edx
+    12ae:	39 d0                	cmp    %edx,%eax
+    12b0:	75 ee                	jne    12a0 <waitpoll+0x60>
+  } while(alive);
+    12b2:	85 c9                	test   %ecx,%ecx
+    12b4:	75 ba                	jne    1270 <waitpoll+0x30>
+    12b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12bd:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+    12c0:	83 ec 0c             	sub    $0xc,%esp
+    12c3:	57                   	push   %edi
+    12c4:	e8 f7 fd ff ff       	call   10c0 <free>
+  wait();
+    12c9:	83 c4 10             	add    $0x10,%esp
+}
+    12cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12cf:	5b                   	pop    %ebx
+    12d0:	5e                   	pop    %esi
+    12d1:	5f                   	pop    %edi
+    12d2:	5d                   	pop    %ebp
+  wait();
+    12d3:	e9 10 f9 ff ff       	jmp    be8 <wait>
+    12d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12df:	90                   	nop
+
+000012e0 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+    12e0:	55                   	push   %ebp
+    12e1:	89 e5                	mov    %esp,%ebp
+    12e3:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+    12e6:	c7 45 f0 e1 13 00 00 	movl   $0x13e1,-0x10(%ebp)
+    12ed:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+    12f4:	e8 87 f4 ff ff       	call   780 <fork>
+    12f9:	85 c0                	test   %eax,%eax
+    12fb:	78 09                	js     1306 <runps+0x26>
+    return -1;
+  if(pid == 0){
+    12fd:	74 0e                	je     130d <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+    12ff:	e8 e4 f8 ff ff       	call   be8 <wait>
+}
+    1304:	c9                   	leave
+    1305:	c3                   	ret
+    1306:	c9                   	leave
+    return -1;
+    1307:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    130c:	c3                   	ret
+    exec("ps", argv);
+    130d:	50                   	push   %eax
+    130e:	50                   	push   %eax
+    130f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    1312:	50                   	push   %eax
+    1313:	68 e1 13 00 00       	push   $0x13e1
+    1318:	e8 c3 f4 ff ff       	call   7e0 <exec>
+    printf(2, "exec ps failed\n");
+    131d:	5a                   	pop    %edx
+    131e:	59                   	pop    %ecx
+    131f:	68 e4 13 00 00       	push   $0x13e4
+    1324:	6a 02                	push   $0x2
+    1326:	e8 55 fb ff ff       	call   e80 <printf>
+    exit();
+    132b:	e8 a0 f4 ff ff       	call   7d0 <exit>
@@ -3,6 +3,7 @@
 #include "types.h"
 #include "stat.h"
 #include "user.h"
+#include "fcntl.h"
 
 char buf[1024];
 int match(char*, char*);
@@ -35,14 +36,47 @@ grep(char *pattern, int fd)
   }
 }
 
+// Like grep(), but scan the file in place through a private
+// mapping, which lets the lines be terminated where they lie.
+// Returns -1 if fd can not be mapped.
+int
+mgrep(char *pattern, int fd)
+{
+  struct stat st;
+  char *p, *q, *end;
+
+  if(fstat(fd, &st) < 0)
+    return -1;
+  if(st.size == 0)
+    return 0;
+  if((p = mmap(fd, 0, st.size, PROT_READ|PROT_WRITE, MAP_PRIVATE)) == (char*)-1)
+    return -1;
+  end = p + st.size;
+  while(p < end && (q = memchr(p, '\n', end - p)) != 0){
+    *q = 0;
+    if(match(pattern, p)){
+      *q = '\n';
+      write(1, p, q+1 - p);
+    }
+    p = q+1;
+  }
+  munmap(end - st.size, st.size);
+  return 0;
+}
+
 int
 main(int argc, char *argv[])
 {
-  int fd, i;
+  int fd, i, usemmap;
   char *pattern;
 
+  usemmap = argc > 1 && strcmp(argv[1], "-m") == 0;
+  if(usemmap){
+    argc--;
+    argv++;
+  }
   if(argc <= 1){
-    printf(2, "usage: grep pattern [file ...]\n");
+    printf(2, "usage: grep [-m] pattern [file ...]\n");
     exit();
   }
   pattern = argv[1];
@@ -57,7 +91,8 @@ main(int argc, char *argv[])
       printf(1, "grep: cannot open %s\n", argv[i]);
       exit();
     }
-    grep(pattern, fd);
+    if(!usemmap || mgrep(pattern, fd) < 0)
+      grep(pattern, fd);
     close(fd);
   }
   exit();
@@ -0,0 +1,8 @@
+// Inode cache counters, returned by the icachestat system call.
+struct icachestat {
+  uint hits;       // iget()s that found the inode cached
+  uint misses;     // iget()s that did not
+  uint evicted;    // unreferenced inodes dropped for others
+  uint entries;    // entries allocated, at most NINODE
+  uint idle;       // cached inodes with no references
+};
@@ -1,4 +1,5 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// Simple IDE driver code.  Moves data with PIIX busmaster DMA
+// when the controller supports it, and programmed I/O otherwise.
 
 #include "types.h"
 #include "defs.h"
@@ -12,6 +13,7 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "fcntl.h"
 
 #define SECTOR_SIZE   512
 #define IDE_BSY       0x80
@@ -23,16 +25,51 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_SETMUL 0xc6
+
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
+
+#define IDE_MAXSECT   8   // most sectors moved by one merged PIO command
+#define IDE_MAXDMA    32  // most sectors moved by one merged DMA command
+
+// Busmaster registers, at offsets from idebm (PCI BAR4).
+#define BM_CMD        0
+#define BM_STATUS     2
+#define BM_PRDT       4
+#define BM_START      0x01  // command: start transfer
+#define BM_READ       0x08  // command: device to memory
+#define BM_ERR        0x02  // status
+#define BM_INTR       0x04  // status
+
+// Physical region descriptor: one contiguous piece of a DMA
+// transfer.  A region may not cross a 64KB boundary.
+struct prd {
+  uint addr;
+  ushort len;
+  ushort flags;
+};
+#define PRD_EOT       0x8000  // last region of the transfer
+#define NPRD          (2*IDE_MAXDMA)
+
+static struct prd prdt[NPRD] __attribute__((aligned(sizeof(struct prd)*NPRD)));
 
 // idequeue points to the buf now being read/written to the disk.
 // idequeue->qnext points to the next buf to be processed.
+// The first idenbuf bufs of the queue cover consecutive blocks
+// and are all transferred by the one command in flight.
 // You must hold idelock while manipulating queue.
 
 static struct spinlock idelock;
 static struct buf *idequeue;
+static int idenbuf;
 
 static int havedisk1;
-static void idestart(struct buf*);
+static int idemult[2];  // sectors per READ/WRITE MULTIPLE, per drive
+static ushort idebm;    // busmaster I/O base, 0 if none
+static int idedma;      // start new requests with DMA?
+static int idedmabusy;  // request in flight uses DMA
+static void idestart(struct buf*, int);
 
 // Wait for IDE disk to become ready.
 static int
@@ -47,6 +84,49 @@ idewait(int checkerr)
   return 0;
 }
 
+// Read a 32-bit PCI configuration register.
+static uint
+pciread(int bus, int dev, int func, int reg)
+{
+  outl(0xcf8, 0x80000000 | (bus<<16) | (dev<<11) | (func<<8) | (reg&0xfc));
+  return inl(0xcfc);
+}
+
+static void
+pciwrite(int bus, int dev, int func, int reg, uint v)
+{
+  outl(0xcf8, 0x80000000 | (bus<<16) | (dev<<11) | (func<<8) | (reg&0xfc));
+  outl(0xcfc, v);
+}
+
+// Look on PCI bus 0 for a busmaster IDE controller (such as
+// the PIIX in QEMU) and enable it.  Returns its busmaster
+// I/O base, or 0 if there is none.
+static ushort
+idedmaprobe(void)
+{
+  int dev, func;
+  uint class, bar;
+
+  for(dev = 0; dev < 32; dev++){
+    for(func = 0; func < 8; func++){
+      if((pciread(0, dev, func, 0x00) & 0xffff) == 0xffff)
+        continue;
+      class = pciread(0, dev, func, 0x08);
+      // class 1 (storage), subclass 1 (IDE), prog-if bit 7 (busmaster)
+      if((class >> 16) != 0x0101 || (class & 0x8000) == 0)
+        continue;
+      bar = pciread(0, dev, func, 0x20);
+      if((bar & 1) == 0 || (bar & 0xfffc) == 0)
+        continue;
+      // Enable I/O space and bus mastering.
+      pciwrite(0, dev, func, 0x04, pciread(0, dev, func, 0x04) | 0x5);
+      return bar & 0xfffc;
+    }
+  }
+  return 0;
+}
+
 void
 ideinit(void)
 {
@@ -65,35 +145,134 @@ ideinit(void)
     }
   }
 
+  // Let each drive move up to IDE_MAXSECT sectors per interrupt,
+  // so that idestart() can merge requests for adjacent blocks.
+  // nIEN is set so SET MULTIPLE doesn't raise an interrupt;
+  // idestart() clears it again.
+  outb(0x3f6, 2);
+  for(i=0; i<2; i++){
+    if(i == 1 && !havedisk1)
+      break;
+    outb(0x1f6, 0xe0 | (i<<4));
+    idewait(0);
+    outb(0x1f2, IDE_MAXSECT);
+    outb(0x1f7, IDE_CMD_SETMUL);
+    if(idewait(1) >= 0)
+      idemult[i] = IDE_MAXSECT;
+  }
+
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
+
+  if((idebm = idedmaprobe()) != 0)
+    idedma = 1;
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Choose between DMA and PIO for future requests.
+// Returns the previous mode, or -1 if DMA is not available.
+int
+idesetmode(int mode)
+{
+  int old;
+
+  if(mode != IDE_PIO && mode != IDE_DMA)
+    return -1;
+  if(mode == IDE_DMA && idebm == 0)
+    return -1;
+  acquire(&idelock);
+  old = idedma ? IDE_DMA : IDE_PIO;
+  idedma = (mode == IDE_DMA);
+  release(&idelock);
+  return old;
+}
+
+// Fill prdt with the data of the n queued bufs starting at b.
+static void
+idedmaprd(struct buf *b, int n)
+{
+  struct prd *p;
+  uint a, len, m;
+
+  p = prdt;
+  for(; n > 0; b = b->qnext, n--){
+    a = V2P(b->data);
+    for(len = BSIZE; len > 0; len -= m, a += m){
+      m = 0x10000 - (a & 0xffff);  // stop at the 64KB boundary
+      if(m > len)
+        m = len;
+      p->addr = a;
+      p->len = m;
+      p->flags = 0;
+      p++;
+    }
+  }
+  p[-1].flags = PRD_EOT;
+}
+
+// Start the request for b, the head of idequeue, with DMA
+// if dma is set and with PIO otherwise.
+// Bufs further down the queue that continue b's run of blocks
+// (same disk, same direction) are moved up behind b and go out
+// in the same command.  Caller must hold idelock.
 static void
-idestart(struct buf *b)
+idestart(struct buf *b, int dma)
 {
+  struct buf **pp, *q, *tail;
+  int n, maxn, write;
+
   if(b == 0)
     panic("idestart");
-  if(b->blockno >= FSSIZE)
+  if(b->ioblock >= FSSIZE)
     panic("incorrect blockno");
   int sector_per_block =  BSIZE/SECTOR_SIZE;
-  int sector = b->blockno * sector_per_block;
-  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
-  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+  int sector = b->ioblock * sector_per_block;
 
   if (sector_per_block > 7) panic("idestart");
 
+  write = b->flags & B_DIRTY;
+  if(dma)
+    maxn = IDE_MAXDMA / sector_per_block;
+  else
+    maxn = idemult[b->dev&1] / sector_per_block;
+  tail = b;
+  for(n = 1; n < maxn; n++){
+    for(pp=&tail->qnext; (q = *pp) != 0; pp=&q->qnext)
+      if(q->dev == b->dev && q->ioblock == tail->ioblock+1 &&
+         (q->flags & B_DIRTY) == write)
+        break;
+    if(q == 0)
+      break;
+    *pp = q->qnext;
+    q->qnext = tail->qnext;
+    tail->qnext = q;
+    tail = q;
+  }
+  idenbuf = n;
+
+  int nsect = n * sector_per_block;
+  int read_cmd = (nsect == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
+  int write_cmd = (nsect == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, nsect);  // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
-  if(b->flags & B_DIRTY){
+  idedmabusy = dma;
+  if(dma){
+    idedmaprd(b, n);
+    __sync_synchronize();  // prdt must be in memory before the start
+    outl(idebm+BM_PRDT, V2P(prdt));
+    outb(idebm+BM_CMD, write ? 0 : BM_READ);
+    outb(idebm+BM_STATUS, BM_INTR|BM_ERR);  // write 1s to clear
+    outb(0x1f7, write ? IDE_CMD_WRDMA : IDE_CMD_RDDMA);
+    outb(idebm+BM_CMD, (write ? 0 : BM_READ) | BM_START);
+  } else if(write){
     outb(0x1f7, write_cmd);
-    outsl(0x1f0, b->data, BSIZE/4);
+    for(q = b; n > 0; q = q->qnext, n--)
+      outsl(0x1f0, q->data, BSIZE/4);
   } else {
     outb(0x1f7, read_cmd);
   }
@@ -104,28 +283,51 @@ void
 ideintr(void)
 {
   struct buf *b;
+  int i, read, st;
 
-  // First queued buffer is the active request.
+  // First queued buffers are the active request.
   acquire(&idelock);
 
   if((b = idequeue) == 0){
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
+  if(idedmabusy){
+    // The controller has already moved the data;
+    // stop it and acknowledge its interrupt.
+    st = inb(idebm+BM_STATUS);
+    outb(idebm+BM_CMD, 0);
+    outb(idebm+BM_STATUS, BM_INTR|BM_ERR);
+    if((st & BM_ERR) || idewait(1) < 0){
+      // The transfer failed; the bufs are neither read
+      // nor written.  Do the run again with PIO.
+      cprintf("ide: dma error on block %d, retrying with pio\n", b->ioblock);
+      idestart(b, 0);
+      release(&idelock);
+      return;
+    }
+    read = 0;
+  } else {
+    // Read data if needed.
+    read = !(b->flags & B_DIRTY) && idewait(1) >= 0;
+  }
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+  for(i = 0; i < idenbuf; i++){
+    b = idequeue;
+    idequeue = b->qnext;
+    if(read)
+      insl(0x1f0, b->data, BSIZE/4);
+
+    // Wake process waiting for this buf.
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    wakeup(b);
+  }
 
   // Start disk on next buf in queue.
   if(idequeue != 0)
-    idestart(idequeue);
+    idestart(idequeue, idedma);
 
   release(&idelock);
 }
@@ -137,30 +339,54 @@ ideintr(void)
 void
 iderw(struct buf *b)
 {
-  struct buf **pp;
+  iderwv(&b, 1);
+}
 
-  if(!holdingsleep(&b->lock))
-    panic("iderw: buf not locked");
-  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
-    panic("iderw: nothing to do");
-  if(b->dev != 0 && !havedisk1)
-    panic("iderw: ide disk 1 not present");
+// Sync n bufs with disk, as iderw() does for one.
+// All of them are queued before waiting, so that
+// idestart() can merge runs of adjacent blocks.
+// Sorts bs[] by block number.
+void
+iderwv(struct buf **bs, int n)
+{
+  struct buf **pp, *b;
+  int i, j, idle;
+
+  for(i = 0; i < n; i++){
+    b = bs[i];
+    if(!holdingsleep(&b->lock))
+      panic("iderw: buf not locked");
+    if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+      panic("iderw: nothing to do");
+    if(b->dev != 0 && !havedisk1)
+      panic("iderw: ide disk 1 not present");
+    // Keep bs[0..i] in block order, so runs start at their first block.
+    for(j = i; j > 0 && bs[j-1]->ioblock > b->ioblock; j--)
+      bs[j] = bs[j-1];
+    bs[j] = b;
+  }
 
   acquire(&idelock);  //DOC:acquire-lock
 
-  // Append b to idequeue.
-  b->qnext = 0;
+  // Append bs to idequeue.
+  idle = (idequeue == 0);
   for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
     ;
-  *pp = b;
+  for(i = 0; i < n; i++){
+    bs[i]->qnext = 0;
+    *pp = bs[i];
+    pp = &bs[i]->qnext;
+  }
 
   // Start disk if necessary.
-  if(idequeue == b)
-    idestart(b);
+  if(idle)
+    idestart(idequeue, idedma);
 
-  // Wait for request to finish.
-  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
-    sleep(b, &idelock);
+  // Wait for requests to finish.
+  for(i = 0; i < n; i++){
+    while((bs[i]->flags & (B_VALID|B_DIRTY)) != B_VALID){
+      sleep(bs[i], &idelock);
+    }
   }
 
 
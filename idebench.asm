@@ -0,0 +1,2361 @@
+
+_idebench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return total;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 28             	sub    $0x28,%esp
+      14:	8b 31                	mov    (%ecx),%esi
+      16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  static char *names[] = { [IDE_PIO] "PIO", [IDE_DMA] "DMA" };
+  int kb, nspin, mode, old, orig;
+  uint idle, busy, moved;
+
+  kb = argc > 1 ? atoi(argv[1]) : 64;
+      19:	83 fe 01             	cmp    $0x1,%esi
+      1c:	0f 8f 24 01 00 00    	jg     146 <main+0x146>
+      22:	c7 45 d4 40 00 00 00 	movl   $0x40,-0x2c(%ebp)
+  nspin = argc > 2 ? atoi(argv[2]) : 2;
+      29:	be 02 00 00 00       	mov    $0x2,%esi
+  memset(buf, 'x', sizeof(buf));
+      2e:	83 ec 04             	sub    $0x4,%esp
+         kb, nspin, TICKS);
+  idle = run(nspin, 0, &moved);
+  printf(1, "idle: %d spins\n", idle);
+
+  orig = -1;
+  for(mode = IDE_PIO; mode <= IDE_DMA; mode++){
+      31:	31 db                	xor    %ebx,%ebx
+  orig = -1;
+      33:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+  memset(buf, 'x', sizeof(buf));
+      38:	68 00 10 00 00       	push   $0x1000
+      3d:	6a 78                	push   $0x78
+      3f:	68 40 18 00 00       	push   $0x1840
+      44:	e8 e7 07 00 00       	call   830 <memset>
+  printf(1, "idebench: %d KB file, %d spinners, %d ticks per run\n",
+      49:	c7 04 24 2c 01 00 00 	movl   $0x12c,(%esp)
+      50:	56                   	push   %esi
+      51:	ff 75 d4             	push   -0x2c(%ebp)
+      54:	68 5c 12 00 00       	push   $0x125c
+      59:	6a 01                	push   $0x1
+      5b:	e8 e0 0c 00 00       	call   d40 <printf>
+  idle = run(nspin, 0, &moved);
+      60:	83 c4 1c             	add    $0x1c,%esp
+      63:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+      66:	50                   	push   %eax
+      67:	6a 00                	push   $0x0
+      69:	56                   	push   %esi
+      6a:	e8 81 02 00 00       	call   2f0 <run>
+  printf(1, "idle: %d spins\n", idle);
+      6f:	83 c4 0c             	add    $0xc,%esp
+  idle = run(nspin, 0, &moved);
+      72:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  printf(1, "idle: %d spins\n", idle);
+      75:	50                   	push   %eax
+      76:	68 30 12 00 00       	push   $0x1230
+      7b:	6a 01                	push   $0x1
+      7d:	e8 be 0c 00 00       	call   d40 <printf>
+      82:	83 c4 10             	add    $0x10,%esp
+    if((old = setidemode(mode)) < 0){
+      85:	83 ec 0c             	sub    $0xc,%esp
+      88:	53                   	push   %ebx
+      89:	e8 3b 0b 00 00       	call   bc9 <setidemode>
+      8e:	83 c4 10             	add    $0x10,%esp
+      91:	85 c0                	test   %eax,%eax
+      93:	78 7c                	js     111 <main+0x111>
+      printf(1, "%s: not available\n", names[mode]);
+      continue;
+    }
+    if(orig < 0)
+      95:	83 ff ff             	cmp    $0xffffffff,%edi
+      98:	0f 44 f8             	cmove  %eax,%edi
+      orig = old;
+    busy = run(nspin, kb, &moved);
+      9b:	83 ec 04             	sub    $0x4,%esp
+      9e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+      a1:	50                   	push   %eax
+      a2:	ff 75 d4             	push   -0x2c(%ebp)
+      a5:	56                   	push   %esi
+      a6:	e8 45 02 00 00       	call   2f0 <run>
+    printf(1, "%s: %d KB in %d ticks, %d spins (%d%% of idle)\n",
+      ab:	8b 55 d0             	mov    -0x30(%ebp),%edx
+      ae:	83 c4 10             	add    $0x10,%esp
+    busy = run(nspin, kb, &moved);
+      b1:	89 c1                	mov    %eax,%ecx
+    printf(1, "%s: %d KB in %d ticks, %d spins (%d%% of idle)\n",
+      b3:	31 c0                	xor    %eax,%eax
+      b5:	85 d2                	test   %edx,%edx
+      b7:	74 1c                	je     d5 <main+0xd5>
+           names[mode], moved, TICKS, busy,
+           idle ? busy / (idle / 100 + 1) : 0);
+      b9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+      bc:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+      c1:	f7 e2                	mul    %edx
+      c3:	c1 ea 05             	shr    $0x5,%edx
+      c6:	8d 42 01             	lea    0x1(%edx),%eax
+      c9:	89 c2                	mov    %eax,%edx
+    printf(1, "%s: %d KB in %d ticks, %d spins (%d%% of idle)\n",
+      cb:	89 c8                	mov    %ecx,%eax
+      cd:	89 55 cc             	mov    %edx,-0x34(%ebp)
+      d0:	31 d2                	xor    %edx,%edx
+      d2:	f7 75 cc             	divl   -0x34(%ebp)
+      d5:	83 ec 04             	sub    $0x4,%esp
+      d8:	50                   	push   %eax
+      d9:	51                   	push   %ecx
+      da:	68 2c 01 00 00       	push   $0x12c
+      df:	ff 75 e4             	push   -0x1c(%ebp)
+      e2:	ff 34 9d c4 12 00 00 	push   0x12c4(,%ebx,4)
+      e9:	68 94 12 00 00       	push   $0x1294
+      ee:	6a 01                	push   $0x1
+      f0:	e8 4b 0c 00 00       	call   d40 <printf>
+      f5:	83 c4 20             	add    $0x20,%esp
+  for(mode = IDE_PIO; mode <= IDE_DMA; mode++){
+      f8:	85 db                	test   %ebx,%ebx
+      fa:	75 34                	jne    130 <main+0x130>
+    if((old = setidemode(mode)) < 0){
+      fc:	83 ec 0c             	sub    $0xc,%esp
+  for(mode = IDE_PIO; mode <= IDE_DMA; mode++){
+      ff:	bb 01 00 00 00       	mov    $0x1,%ebx
+    if((old = setidemode(mode)) < 0){
+     104:	53                   	push   %ebx
+     105:	e8 bf 0a 00 00       	call   bc9 <setidemode>
+     10a:	83 c4 10             	add    $0x10,%esp
+     10d:	85 c0                	test   %eax,%eax
+     10f:	79 84                	jns    95 <main+0x95>
+      printf(1, "%s: not available\n", names[mode]);
+     111:	51                   	push   %ecx
+     112:	ff 34 9d c4 12 00 00 	push   0x12c4(,%ebx,4)
+     119:	68 40 12 00 00       	push   $0x1240
+     11e:	6a 01                	push   $0x1
+     120:	e8 1b 0c 00 00       	call   d40 <printf>
+      continue;
+     125:	83 c4 10             	add    $0x10,%esp
+     128:	eb ce                	jmp    f8 <main+0xf8>
+     12a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }
+  if(orig >= 0)
+     130:	83 ff ff             	cmp    $0xffffffff,%edi
+     133:	74 0c                	je     141 <main+0x141>
+    setidemode(orig);
+     135:	83 ec 0c             	sub    $0xc,%esp
+     138:	57                   	push   %edi
+     139:	e8 8b 0a 00 00       	call   bc9 <setidemode>
+     13e:	83 c4 10             	add    $0x10,%esp
+  exit();
+     141:	e8 4a 05 00 00       	call   690 <exit>
+  kb = argc > 1 ? atoi(argv[1]) : 64;
+     146:	83 ec 0c             	sub    $0xc,%esp
+     149:	ff 73 04             	push   0x4(%ebx)
+     14c:	e8 9f 08 00 00       	call   9f0 <atoi>
+  nspin = argc > 2 ? atoi(argv[2]) : 2;
+     151:	83 c4 10             	add    $0x10,%esp
+  kb = argc > 1 ? atoi(argv[1]) : 64;
+     154:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  nspin = argc > 2 ? atoi(argv[2]) : 2;
+     157:	83 fe 02             	cmp    $0x2,%esi
+     15a:	0f 84 ce fe ff ff    	je     2e <main+0x2e>
+     160:	83 ec 0c             	sub    $0xc,%esp
+     163:	ff 73 08             	push   0x8(%ebx)
+     166:	e8 85 08 00 00       	call   9f0 <atoi>
+     16b:	83 c4 10             	add    $0x10,%esp
+     16e:	89 c6                	mov    %eax,%esi
+     170:	e9 b9 fe ff ff       	jmp    2e <main+0x2e>
+     175:	66 90                	xchg   %ax,%ax
+     177:	66 90                	xchg   %ax,%ax
+     179:	66 90                	xchg   %ax,%ax
+     17b:	66 90                	xchg   %ax,%ax
+     17d:	66 90                	xchg   %ax,%ax
+     17f:	90                   	nop
+
+00000180 <spinner>:
+{
+     180:	55                   	push   %ebp
+     181:	89 e5                	mov    %esp,%ebp
+     183:	53                   	push   %ebx
+     184:	83 ec 14             	sub    $0x14,%esp
+  n = 0;
+     187:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  end = uptime() + TICKS;
+     18e:	e8 b4 09 00 00       	call   b47 <uptime>
+     193:	8d 98 2c 01 00 00    	lea    0x12c(%eax),%ebx
+  while(uptime() < end){
+     199:	eb 07                	jmp    1a2 <spinner+0x22>
+      n++;
+     19b:	81 45 f4 a0 86 01 00 	addl   $0x186a0,-0xc(%ebp)
+  while(uptime() < end){
+     1a2:	e8 a0 09 00 00       	call   b47 <uptime>
+     1a7:	39 d8                	cmp    %ebx,%eax
+     1a9:	7c f0                	jl     19b <spinner+0x1b>
+  write(fd, &n, sizeof(n));
+     1ab:	83 ec 04             	sub    $0x4,%esp
+     1ae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+     1b1:	6a 04                	push   $0x4
+     1b3:	50                   	push   %eax
+     1b4:	ff 75 08             	push   0x8(%ebp)
+     1b7:	e8 01 09 00 00       	call   abd <write>
+  exit();
+     1bc:	e8 cf 04 00 00       	call   690 <exit>
+     1c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1cf:	90                   	nop
+
+000001d0 <diskload>:
+{
+     1d0:	55                   	push   %ebp
+     1d1:	89 e5                	mov    %esp,%ebp
+     1d3:	57                   	push   %edi
+     1d4:	56                   	push   %esi
+     1d5:	53                   	push   %ebx
+     1d6:	83 ec 1c             	sub    $0x1c,%esp
+     1d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  end = uptime() + TICKS;
+     1dc:	e8 66 09 00 00       	call   b47 <uptime>
+  moved = 0;
+     1e1:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  end = uptime() + TICKS;
+     1e8:	05 2c 01 00 00       	add    $0x12c,%eax
+     1ed:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    moved += 2*kb;
+     1f0:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+     1f3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  while(uptime() < end){
+     1f6:	e8 4c 09 00 00       	call   b47 <uptime>
+     1fb:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     1fe:	39 d0                	cmp    %edx,%eax
+     200:	0f 8d ba 00 00 00    	jge    2c0 <diskload+0xf0>
+     206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     20d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((fd = open(FILENAME, O_CREATE|O_RDWR)) < 0){
+     210:	83 ec 08             	sub    $0x8,%esp
+     213:	68 02 02 00 00       	push   $0x202
+     218:	68 f0 11 00 00       	push   $0x11f0
+     21d:	e8 b7 08 00 00       	call   ad9 <open>
+     222:	83 c4 10             	add    $0x10,%esp
+     225:	89 c7                	mov    %eax,%edi
+     227:	85 c0                	test   %eax,%eax
+     229:	0f 88 9c 00 00 00    	js     2cb <diskload+0xfb>
+    for(i = 0; i < kb; i += sizeof(buf)/1024)
+     22f:	31 f6                	xor    %esi,%esi
+     231:	85 db                	test   %ebx,%ebx
+     233:	7e 20                	jle    255 <diskload+0x85>
+     235:	8d 76 00             	lea    0x0(%esi),%esi
+      write(fd, buf, sizeof(buf));
+     238:	83 ec 04             	sub    $0x4,%esp
+    for(i = 0; i < kb; i += sizeof(buf)/1024)
+     23b:	83 c6 04             	add    $0x4,%esi
+      write(fd, buf, sizeof(buf));
+     23e:	68 00 10 00 00       	push   $0x1000
+     243:	68 40 18 00 00       	push   $0x1840
+     248:	57                   	push   %edi
+     249:	e8 6f 08 00 00       	call   abd <write>
+    for(i = 0; i < kb; i += sizeof(buf)/1024)
+     24e:	83 c4 10             	add    $0x10,%esp
+     251:	39 f3                	cmp    %esi,%ebx
+     253:	7f e3                	jg     238 <diskload+0x68>
+    close(fd);
+     255:	83 ec 0c             	sub    $0xc,%esp
+     258:	57                   	push   %edi
+     259:	e8 a2 04 00 00       	call   700 <close>
+    fd = open(FILENAME, O_RDONLY);
+     25e:	58                   	pop    %eax
+     25f:	5a                   	pop    %edx
+     260:	6a 00                	push   $0x0
+     262:	68 f0 11 00 00       	push   $0x11f0
+     267:	e8 6d 08 00 00       	call   ad9 <open>
+    while(read(fd, buf, sizeof(buf)) > 0)
+     26c:	83 c4 10             	add    $0x10,%esp
+    fd = open(FILENAME, O_RDONLY);
+     26f:	89 c7                	mov    %eax,%edi
+    while(read(fd, buf, sizeof(buf)) > 0)
+     271:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     278:	83 ec 04             	sub    $0x4,%esp
+     27b:	68 00 10 00 00       	push   $0x1000
+     280:	68 40 18 00 00       	push   $0x1840
+     285:	57                   	push   %edi
+     286:	e8 2b 08 00 00       	call   ab6 <read>
+     28b:	83 c4 10             	add    $0x10,%esp
+     28e:	85 c0                	test   %eax,%eax
+     290:	7f e6                	jg     278 <diskload+0xa8>
+    close(fd);
+     292:	83 ec 0c             	sub    $0xc,%esp
+     295:	57                   	push   %edi
+     296:	e8 65 04 00 00       	call   700 <close>
+    unlink(FILENAME);
+     29b:	c7 04 24 f0 11 00 00 	movl   $0x11f0,(%esp)
+     2a2:	e8 46 08 00 00       	call   aed <unlink>
+    moved += 2*kb;
+     2a7:	83 c4 10             	add    $0x10,%esp
+     2aa:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+     2ad:	01 4d e0             	add    %ecx,-0x20(%ebp)
+  while(uptime() < end){
+     2b0:	e8 92 08 00 00       	call   b47 <uptime>
+     2b5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     2b8:	39 d0                	cmp    %edx,%eax
+     2ba:	0f 8c 50 ff ff ff    	jl     210 <diskload+0x40>
+}
+     2c0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     2c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     2c6:	5b                   	pop    %ebx
+     2c7:	5e                   	pop    %esi
+     2c8:	5f                   	pop    %edi
+     2c9:	5d                   	pop    %ebp
+     2ca:	c3                   	ret
+      printf(2, "idebench: cannot create %s\n", FILENAME);
+     2cb:	83 ec 04             	sub    $0x4,%esp
+     2ce:	68 f0 11 00 00       	push   $0x11f0
+     2d3:	68 fd 11 00 00       	push   $0x11fd
+     2d8:	6a 02                	push   $0x2
+     2da:	e8 61 0a 00 00       	call   d40 <printf>
+      exit();
+     2df:	e8 ac 03 00 00       	call   690 <exit>
+     2e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2ef:	90                   	nop
+
+000002f0 <run>:
+{
+     2f0:	55                   	push   %ebp
+     2f1:	89 e5                	mov    %esp,%ebp
+     2f3:	57                   	push   %edi
+     2f4:	56                   	push   %esi
+  if(pipe(p) < 0){
+     2f5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     2f8:	53                   	push   %ebx
+     2f9:	83 ec 38             	sub    $0x38,%esp
+     2fc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     2ff:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(pipe(p) < 0){
+     302:	50                   	push   %eax
+     303:	e8 a7 07 00 00       	call   aaf <pipe>
+     308:	83 c4 10             	add    $0x10,%esp
+     30b:	85 c0                	test   %eax,%eax
+     30d:	0f 88 d7 00 00 00    	js     3ea <run+0xfa>
+  for(i = 0; i < nspin; i++){
+     313:	31 f6                	xor    %esi,%esi
+     315:	85 db                	test   %ebx,%ebx
+     317:	0f 8e 89 00 00 00    	jle    3a6 <run+0xb6>
+     31d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(fork() == 0){
+     320:	e8 1b 03 00 00       	call   640 <fork>
+     325:	85 c0                	test   %eax,%eax
+     327:	0f 84 a9 00 00 00    	je     3d6 <run+0xe6>
+  for(i = 0; i < nspin; i++){
+     32d:	83 c6 01             	add    $0x1,%esi
+     330:	39 f3                	cmp    %esi,%ebx
+     332:	75 ec                	jne    320 <run+0x30>
+  close(p[1]);
+     334:	83 ec 0c             	sub    $0xc,%esp
+     337:	ff 75 e4             	push   -0x1c(%ebp)
+     33a:	e8 c1 03 00 00       	call   700 <close>
+  *moved = kb > 0 ? diskload(kb) : 0;
+     33f:	83 c4 10             	add    $0x10,%esp
+     342:	31 c0                	xor    %eax,%eax
+     344:	85 ff                	test   %edi,%edi
+     346:	7e 0c                	jle    354 <run+0x64>
+     348:	83 ec 0c             	sub    $0xc,%esp
+     34b:	57                   	push   %edi
+     34c:	e8 7f fe ff ff       	call   1d0 <diskload>
+     351:	83 c4 10             	add    $0x10,%esp
+     354:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  total = 0;
+     357:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  for(i = 0; i < nspin; i++){
+     35e:	31 f6                	xor    %esi,%esi
+     360:	8d 7d dc             	lea    -0x24(%ebp),%edi
+  *moved = kb > 0 ? diskload(kb) : 0;
+     363:	89 01                	mov    %eax,(%ecx)
+     365:	8d 76 00             	lea    0x0(%esi),%esi
+    if(read(p[0], &n, sizeof(n)) == sizeof(n))
+     368:	83 ec 04             	sub    $0x4,%esp
+     36b:	6a 04                	push   $0x4
+     36d:	57                   	push   %edi
+     36e:	ff 75 e0             	push   -0x20(%ebp)
+     371:	e8 40 07 00 00       	call   ab6 <read>
+     376:	83 c4 10             	add    $0x10,%esp
+     379:	83 f8 04             	cmp    $0x4,%eax
+     37c:	75 06                	jne    384 <run+0x94>
+      total += n;
+     37e:	8b 55 dc             	mov    -0x24(%ebp),%edx
+     381:	01 55 d4             	add    %edx,-0x2c(%ebp)
+    wait();
+     384:	e8 1f 07 00 00       	call   aa8 <wait>
+  for(i = 0; i < nspin; i++){
+     389:	83 c6 01             	add    $0x1,%esi
+     38c:	39 f3                	cmp    %esi,%ebx
+     38e:	75 d8                	jne    368 <run+0x78>
+  close(p[0]);
+     390:	83 ec 0c             	sub    $0xc,%esp
+     393:	ff 75 e0             	push   -0x20(%ebp)
+     396:	e8 65 03 00 00       	call   700 <close>
+}
+     39b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     39e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     3a1:	5b                   	pop    %ebx
+     3a2:	5e                   	pop    %esi
+     3a3:	5f                   	pop    %edi
+     3a4:	5d                   	pop    %ebp
+     3a5:	c3                   	ret
+  close(p[1]);
+     3a6:	83 ec 0c             	sub    $0xc,%esp
+     3a9:	ff 75 e4             	push   -0x1c(%ebp)
+     3ac:	e8 4f 03 00 00       	call   700 <close>
+  *moved = kb > 0 ? diskload(kb) : 0;
+     3b1:	83 c4 10             	add    $0x10,%esp
+     3b4:	31 c0                	xor    %eax,%eax
+     3b6:	85 ff                	test   %edi,%edi
+     3b8:	7f 0e                	jg     3c8 <run+0xd8>
+     3ba:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  total = 0;
+     3bd:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  *moved = kb > 0 ? diskload(kb) : 0;
+     3c4:	89 01                	mov    %eax,(%ecx)
+     3c6:	eb c8                	jmp    390 <run+0xa0>
+     3c8:	83 ec 0c             	sub    $0xc,%esp
+     3cb:	57                   	push   %edi
+     3cc:	e8 ff fd ff ff       	call   1d0 <diskload>
+     3d1:	83 c4 10             	add    $0x10,%esp
+     3d4:	eb e4                	jmp    3ba <run+0xca>
+      close(p[0]);
+     3d6:	83 ec 0c             	sub    $0xc,%esp
+     3d9:	ff 75 e0             	push   -0x20(%ebp)
+     3dc:	e8 1f 03 00 00       	call   700 <close>
+      spinner(p[1]);
+     3e1:	58                   	pop    %eax
+     3e2:	ff 75 e4             	push   -0x1c(%ebp)
+     3e5:	e8 96 fd ff ff       	call   180 <spinner>
+    printf(2, "idebench: pipe failed\n");
+     3ea:	52                   	push   %edx
+     3eb:	52                   	push   %edx
+     3ec:	68 19 12 00 00       	push   $0x1219
+     3f1:	6a 02                	push   $0x2
+     3f3:	e8 48 09 00 00       	call   d40 <printf>
+    exit();
+     3f8:	e8 93 02 00 00       	call   690 <exit>
+     3fd:	66 90                	xchg   %ax,%ax
+     3ff:	90                   	nop
+
+00000400 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+     403:	57                   	push   %edi
+     404:	56                   	push   %esi
+     405:	53                   	push   %ebx
+     406:	83 ec 4c             	sub    $0x4c,%esp
+     409:	8b 45 0c             	mov    0xc(%ebp),%eax
+     40c:	8b 55 08             	mov    0x8(%ebp),%edx
+     40f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     412:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+     415:	83 fa 0f             	cmp    $0xf,%edx
+     418:	0f 87 32 01 00 00    	ja     550 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+     41e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     424:	8b 80 40 28 00 00    	mov    0x2840(%eax),%eax
+     42a:	85 c0                	test   %eax,%eax
+     42c:	0f 84 de 00 00 00    	je     510 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+     432:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     438:	8b b0 44 28 00 00    	mov    0x2844(%eax),%esi
+     43e:	8d 88 40 28 00 00    	lea    0x2840(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+     444:	8d b8 48 28 00 00    	lea    0x2848(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+     44a:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+     44d:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+     450:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+     453:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+     459:	0f 8f 01 01 00 00    	jg     560 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+     45f:	8d 78 08             	lea    0x8(%eax),%edi
+     462:	8d bc 3e 40 28 00 00 	lea    0x2840(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     469:	85 db                	test   %ebx,%ebx
+     46b:	7e 3b                	jle    4a8 <bufwrite+0xa8>
+     46d:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+     470:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+     473:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     477:	90                   	nop
+    *dst++ = *src++;
+     478:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     479:	39 c6                	cmp    %eax,%esi
+     47b:	75 fb                	jne    478 <bufwrite+0x78>
+  ob[fd].n += n;
+     47d:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     483:	8b 88 44 28 00 00    	mov    0x2844(%eax),%ecx
+     489:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     48b:	83 b8 40 28 00 00 01 	cmpl   $0x1,0x2840(%eax)
+  ob[fd].n += n;
+     492:	89 88 44 28 00 00    	mov    %ecx,0x2844(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     498:	74 26                	je     4c0 <bufwrite+0xc0>
+}
+     49a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     49d:	5b                   	pop    %ebx
+     49e:	5e                   	pop    %esi
+     49f:	5f                   	pop    %edi
+     4a0:	5d                   	pop    %ebp
+     4a1:	c3                   	ret
+     4a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+     4a8:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     4ab:	83 b8 40 28 00 00 01 	cmpl   $0x1,0x2840(%eax)
+  ob[fd].n += n;
+     4b2:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     4b5:	75 e3                	jne    49a <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+     4b7:	85 db                	test   %ebx,%ebx
+     4b9:	74 df                	je     49a <bufwrite+0x9a>
+     4bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4bf:	90                   	nop
+  src = vsrc;
+     4c0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     4c3:	01 c3                	add    %eax,%ebx
+     4c5:	eb 10                	jmp    4d7 <bufwrite+0xd7>
+     4c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ce:	66 90                	xchg   %ax,%ax
+     4d0:	83 c0 01             	add    $0x1,%eax
+     4d3:	39 d8                	cmp    %ebx,%eax
+     4d5:	74 c3                	je     49a <bufwrite+0x9a>
+    if(*p == (char)c)
+     4d7:	80 38 0a             	cmpb   $0xa,(%eax)
+     4da:	75 f4                	jne    4d0 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     4dc:	85 c9                	test   %ecx,%ecx
+     4de:	7e ba                	jle    49a <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+     4e0:	83 ec 04             	sub    $0x4,%esp
+     4e3:	51                   	push   %ecx
+     4e4:	ff 75 ac             	push   -0x54(%ebp)
+     4e7:	52                   	push   %edx
+     4e8:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+     4eb:	e8 cd 05 00 00       	call   abd <write>
+    ob[fd].n = 0;
+     4f0:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     4f3:	83 c4 10             	add    $0x10,%esp
+     4f6:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+     4fc:	c7 82 44 28 00 00 00 	movl   $0x0,0x2844(%edx)
+     503:	00 00 00 
+     506:	eb 92                	jmp    49a <bufwrite+0x9a>
+     508:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     50f:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     510:	83 ec 08             	sub    $0x8,%esp
+     513:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     516:	50                   	push   %eax
+     517:	52                   	push   %edx
+     518:	89 55 b0             	mov    %edx,-0x50(%ebp)
+     51b:	e8 d7 05 00 00       	call   af7 <fstat>
+     520:	83 c4 10             	add    $0x10,%esp
+     523:	8b 55 b0             	mov    -0x50(%ebp),%edx
+     526:	89 c1                	mov    %eax,%ecx
+     528:	b8 02 00 00 00       	mov    $0x2,%eax
+     52d:	85 c9                	test   %ecx,%ecx
+     52f:	75 0d                	jne    53e <bufwrite+0x13e>
+     531:	31 c0                	xor    %eax,%eax
+     533:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     538:	0f 95 c0             	setne  %al
+     53b:	83 c0 01             	add    $0x1,%eax
+     53e:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+     544:	89 81 40 28 00 00    	mov    %eax,0x2840(%ecx)
+     54a:	e9 e3 fe ff ff       	jmp    432 <bufwrite+0x32>
+     54f:	90                   	nop
+}
+     550:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     553:	5b                   	pop    %ebx
+     554:	5e                   	pop    %esi
+     555:	5f                   	pop    %edi
+     556:	5d                   	pop    %ebp
+    write(fd, p, n);
+     557:	e9 61 05 00 00       	jmp    abd <write>
+     55c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+     560:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+     563:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+     566:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+     569:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+     56c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+     56f:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+     572:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+     575:	6a 02                	push   $0x2
+     577:	50                   	push   %eax
+     578:	52                   	push   %edx
+     579:	e8 9b 06 00 00       	call   c19 <writev>
+    ob[fd].n = 0;
+     57e:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+     581:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+     584:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+     58b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     58e:	5b                   	pop    %ebx
+     58f:	5e                   	pop    %esi
+     590:	5f                   	pop    %edi
+     591:	5d                   	pop    %ebp
+     592:	c3                   	ret
+     593:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     59a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000005a0 <fflush>:
+{
+     5a0:	55                   	push   %ebp
+     5a1:	89 e5                	mov    %esp,%ebp
+     5a3:	53                   	push   %ebx
+     5a4:	83 ec 04             	sub    $0x4,%esp
+     5a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     5aa:	83 f8 0f             	cmp    $0xf,%eax
+     5ad:	77 16                	ja     5c5 <fflush+0x25>
+     5af:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+     5b5:	8b 8a 44 28 00 00    	mov    0x2844(%edx),%ecx
+     5bb:	8d 9a 40 28 00 00    	lea    0x2840(%edx),%ebx
+     5c1:	85 c9                	test   %ecx,%ecx
+     5c3:	7f 0b                	jg     5d0 <fflush+0x30>
+}
+     5c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5c8:	c9                   	leave
+     5c9:	c3                   	ret
+     5ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     5d0:	83 ec 04             	sub    $0x4,%esp
+     5d3:	81 c2 48 28 00 00    	add    $0x2848,%edx
+     5d9:	51                   	push   %ecx
+     5da:	52                   	push   %edx
+     5db:	50                   	push   %eax
+     5dc:	e8 dc 04 00 00       	call   abd <write>
+    ob[fd].n = 0;
+     5e1:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     5e8:	83 c4 10             	add    $0x10,%esp
+}
+     5eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5ee:	c9                   	leave
+     5ef:	c3                   	ret
+
+000005f0 <fflushall>:
+{
+     5f0:	55                   	push   %ebp
+     5f1:	89 e5                	mov    %esp,%ebp
+     5f3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     5f4:	31 f6                	xor    %esi,%esi
+{
+     5f6:	53                   	push   %ebx
+     5f7:	bb 48 28 00 00       	mov    $0x2848,%ebx
+     5fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     600:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     603:	85 c0                	test   %eax,%eax
+     605:	7e 15                	jle    61c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     607:	83 ec 04             	sub    $0x4,%esp
+     60a:	50                   	push   %eax
+     60b:	53                   	push   %ebx
+     60c:	56                   	push   %esi
+     60d:	e8 ab 04 00 00       	call   abd <write>
+    ob[fd].n = 0;
+     612:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     619:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     61c:	83 c6 01             	add    $0x1,%esi
+     61f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     625:	83 fe 10             	cmp    $0x10,%esi
+     628:	75 d6                	jne    600 <fflushall+0x10>
+}
+     62a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     62d:	5b                   	pop    %ebx
+     62e:	5e                   	pop    %esi
+     62f:	5d                   	pop    %ebp
+     630:	c3                   	ret
+     631:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     638:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     63f:	90                   	nop
+
+00000640 <fork>:
+{
+     640:	55                   	push   %ebp
+     641:	89 e5                	mov    %esp,%ebp
+     643:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     644:	31 f6                	xor    %esi,%esi
+{
+     646:	53                   	push   %ebx
+     647:	bb 48 28 00 00       	mov    $0x2848,%ebx
+     64c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     650:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     653:	85 c0                	test   %eax,%eax
+     655:	7e 15                	jle    66c <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     657:	83 ec 04             	sub    $0x4,%esp
+     65a:	50                   	push   %eax
+     65b:	53                   	push   %ebx
+     65c:	56                   	push   %esi
+     65d:	e8 5b 04 00 00       	call   abd <write>
+    ob[fd].n = 0;
+     662:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     669:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     66c:	83 c6 01             	add    $0x1,%esi
+     66f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     675:	83 fe 10             	cmp    $0x10,%esi
+     678:	75 d6                	jne    650 <fork+0x10>
+}
+     67a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     67d:	5b                   	pop    %ebx
+     67e:	5e                   	pop    %esi
+     67f:	5d                   	pop    %ebp
+  return _fork();
+     680:	e9 15 04 00 00       	jmp    a9a <_fork>
+     685:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     68c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000690 <exit>:
+{
+     690:	55                   	push   %ebp
+     691:	89 e5                	mov    %esp,%ebp
+     693:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+     696:	e8 55 ff ff ff       	call   5f0 <fflushall>
+  _exit();
+     69b:	e8 01 04 00 00       	call   aa1 <_exit>
+
+000006a0 <exec>:
+{
+     6a0:	55                   	push   %ebp
+     6a1:	89 e5                	mov    %esp,%ebp
+     6a3:	57                   	push   %edi
+     6a4:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     6a5:	31 f6                	xor    %esi,%esi
+{
+     6a7:	53                   	push   %ebx
+     6a8:	bb 48 28 00 00       	mov    $0x2848,%ebx
+     6ad:	83 ec 1c             	sub    $0x1c,%esp
+     6b0:	8b 45 08             	mov    0x8(%ebp),%eax
+     6b3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     6b6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     6b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     6c0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     6c3:	85 c0                	test   %eax,%eax
+     6c5:	7e 15                	jle    6dc <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     6c7:	83 ec 04             	sub    $0x4,%esp
+     6ca:	50                   	push   %eax
+     6cb:	53                   	push   %ebx
+     6cc:	56                   	push   %esi
+     6cd:	e8 eb 03 00 00       	call   abd <write>
+    ob[fd].n = 0;
+     6d2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     6d9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     6dc:	83 c6 01             	add    $0x1,%esi
+     6df:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     6e5:	83 fe 10             	cmp    $0x10,%esi
+     6e8:	75 d6                	jne    6c0 <exec+0x20>
+  return _exec(path, argv);
+     6ea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     6ed:	89 7d 0c             	mov    %edi,0xc(%ebp)
+     6f0:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     6f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6f6:	5b                   	pop    %ebx
+     6f7:	5e                   	pop    %esi
+     6f8:	5f                   	pop    %edi
+     6f9:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     6fa:	e9 d3 03 00 00       	jmp    ad2 <_exec>
+     6ff:	90                   	nop
+
+00000700 <close>:
+{
+     700:	55                   	push   %ebp
+     701:	89 e5                	mov    %esp,%ebp
+     703:	56                   	push   %esi
+     704:	53                   	push   %ebx
+     705:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     708:	83 fb 0f             	cmp    $0xf,%ebx
+     70b:	77 26                	ja     733 <close+0x33>
+     70d:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     713:	8b 90 44 28 00 00    	mov    0x2844(%eax),%edx
+     719:	8d b0 40 28 00 00    	lea    0x2840(%eax),%esi
+     71f:	85 d2                	test   %edx,%edx
+     721:	7f 25                	jg     748 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+     723:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     729:	c7 80 40 28 00 00 00 	movl   $0x0,0x2840(%eax)
+     730:	00 00 00 
+  return _close(fd);
+     733:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     736:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     739:	5b                   	pop    %ebx
+     73a:	5e                   	pop    %esi
+     73b:	5d                   	pop    %ebp
+  return _close(fd);
+     73c:	e9 83 03 00 00       	jmp    ac4 <_close>
+     741:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     748:	83 ec 04             	sub    $0x4,%esp
+     74b:	05 48 28 00 00       	add    $0x2848,%eax
+     750:	52                   	push   %edx
+     751:	50                   	push   %eax
+     752:	53                   	push   %ebx
+     753:	e8 65 03 00 00       	call   abd <write>
+    ob[fd].n = 0;
+     758:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+     75f:	83 c4 10             	add    $0x10,%esp
+     762:	eb bf                	jmp    723 <close+0x23>
+     764:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     76b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     76f:	90                   	nop
+
+00000770 <strcpy>:
+{
+     770:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+     771:	31 c0                	xor    %eax,%eax
+{
+     773:	89 e5                	mov    %esp,%ebp
+     775:	53                   	push   %ebx
+     776:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     779:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     77c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     780:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     784:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     787:	83 c0 01             	add    $0x1,%eax
+     78a:	84 d2                	test   %dl,%dl
+     78c:	75 f2                	jne    780 <strcpy+0x10>
+}
+     78e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     791:	89 c8                	mov    %ecx,%eax
+     793:	c9                   	leave
+     794:	c3                   	ret
+     795:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     79c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007a0 <strcmp>:
+{
+     7a0:	55                   	push   %ebp
+     7a1:	89 e5                	mov    %esp,%ebp
+     7a3:	53                   	push   %ebx
+     7a4:	8b 55 08             	mov    0x8(%ebp),%edx
+     7a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     7aa:	0f b6 02             	movzbl (%edx),%eax
+     7ad:	84 c0                	test   %al,%al
+     7af:	75 17                	jne    7c8 <strcmp+0x28>
+     7b1:	eb 3a                	jmp    7ed <strcmp+0x4d>
+     7b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7b7:	90                   	nop
+     7b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     7bc:	83 c2 01             	add    $0x1,%edx
+     7bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     7c2:	84 c0                	test   %al,%al
+     7c4:	74 1a                	je     7e0 <strcmp+0x40>
+    p++, q++;
+     7c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     7c8:	0f b6 19             	movzbl (%ecx),%ebx
+     7cb:	38 c3                	cmp    %al,%bl
+     7cd:	74 e9                	je     7b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     7cf:	29 d8                	sub    %ebx,%eax
+}
+     7d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7d4:	c9                   	leave
+     7d5:	c3                   	ret
+     7d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     7e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     7e4:	31 c0                	xor    %eax,%eax
+     7e6:	29 d8                	sub    %ebx,%eax
+}
+     7e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7eb:	c9                   	leave
+     7ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     7ed:	0f b6 19             	movzbl (%ecx),%ebx
+     7f0:	31 c0                	xor    %eax,%eax
+     7f2:	eb db                	jmp    7cf <strcmp+0x2f>
+     7f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7ff:	90                   	nop
+
+00000800 <strlen>:
+{
+     800:	55                   	push   %ebp
+     801:	89 e5                	mov    %esp,%ebp
+     803:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+     806:	80 3a 00             	cmpb   $0x0,(%edx)
+     809:	74 15                	je     820 <strlen+0x20>
+     80b:	31 c0                	xor    %eax,%eax
+     80d:	8d 76 00             	lea    0x0(%esi),%esi
+     810:	83 c0 01             	add    $0x1,%eax
+     813:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     817:	89 c1                	mov    %eax,%ecx
+     819:	75 f5                	jne    810 <strlen+0x10>
+}
+     81b:	89 c8                	mov    %ecx,%eax
+     81d:	5d                   	pop    %ebp
+     81e:	c3                   	ret
+     81f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     820:	31 c9                	xor    %ecx,%ecx
+}
+     822:	5d                   	pop    %ebp
+     823:	89 c8                	mov    %ecx,%eax
+     825:	c3                   	ret
+     826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     82d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000830 <memset>:
+{
+     830:	55                   	push   %ebp
+     831:	89 e5                	mov    %esp,%ebp
+     833:	57                   	push   %edi
+     834:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     837:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     83a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     83d:	89 d7                	mov    %edx,%edi
+     83f:	fc                   	cld
+     840:	f3 aa                	rep stos %al,%es:(%edi)
+}
+     842:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     845:	89 d0                	mov    %edx,%eax
+     847:	c9                   	leave
+     848:	c3                   	ret
+     849:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000850 <strchr>:
+{
+     850:	55                   	push   %ebp
+     851:	89 e5                	mov    %esp,%ebp
+     853:	8b 45 08             	mov    0x8(%ebp),%eax
+     856:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     85a:	0f b6 10             	movzbl (%eax),%edx
+     85d:	84 d2                	test   %dl,%dl
+     85f:	75 12                	jne    873 <strchr+0x23>
+     861:	eb 1d                	jmp    880 <strchr+0x30>
+     863:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     867:	90                   	nop
+     868:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     86c:	83 c0 01             	add    $0x1,%eax
+     86f:	84 d2                	test   %dl,%dl
+     871:	74 0d                	je     880 <strchr+0x30>
+    if(*s == c)
+     873:	38 d1                	cmp    %dl,%cl
+     875:	75 f1                	jne    868 <strchr+0x18>
+}
+     877:	5d                   	pop    %ebp
+     878:	c3                   	ret
+     879:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     880:	31 c0                	xor    %eax,%eax
+}
+     882:	5d                   	pop    %ebp
+     883:	c3                   	ret
+     884:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     88b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     88f:	90                   	nop
+
+00000890 <memchr>:
+{
+     890:	55                   	push   %ebp
+     891:	89 e5                	mov    %esp,%ebp
+     893:	8b 55 10             	mov    0x10(%ebp),%edx
+     896:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     899:	85 d2                	test   %edx,%edx
+     89b:	74 1b                	je     8b8 <memchr+0x28>
+    if(*p == (char)c)
+     89d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+     8a1:	01 c2                	add    %eax,%edx
+     8a3:	eb 0a                	jmp    8af <memchr+0x1f>
+     8a5:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+     8a8:	83 c0 01             	add    $0x1,%eax
+     8ab:	39 c2                	cmp    %eax,%edx
+     8ad:	74 09                	je     8b8 <memchr+0x28>
+    if(*p == (char)c)
+     8af:	38 08                	cmp    %cl,(%eax)
+     8b1:	75 f5                	jne    8a8 <memchr+0x18>
+}
+     8b3:	5d                   	pop    %ebp
+     8b4:	c3                   	ret
+     8b5:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+     8b8:	31 c0                	xor    %eax,%eax
+}
+     8ba:	5d                   	pop    %ebp
+     8bb:	c3                   	ret
+     8bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008c0 <gets>:
+{
+     8c0:	55                   	push   %ebp
+     8c1:	89 e5                	mov    %esp,%ebp
+     8c3:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+     8c4:	31 ff                	xor    %edi,%edi
+{
+     8c6:	56                   	push   %esi
+     8c7:	be 48 28 00 00       	mov    $0x2848,%esi
+     8cc:	53                   	push   %ebx
+     8cd:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     8d0:	8b 46 fc             	mov    -0x4(%esi),%eax
+     8d3:	85 c0                	test   %eax,%eax
+     8d5:	7e 15                	jle    8ec <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     8d7:	83 ec 04             	sub    $0x4,%esp
+     8da:	50                   	push   %eax
+     8db:	56                   	push   %esi
+     8dc:	57                   	push   %edi
+     8dd:	e8 db 01 00 00       	call   abd <write>
+    ob[fd].n = 0;
+     8e2:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+     8e9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     8ec:	83 c7 01             	add    $0x1,%edi
+     8ef:	81 c6 08 01 00 00    	add    $0x108,%esi
+     8f5:	83 ff 10             	cmp    $0x10,%edi
+     8f8:	75 d6                	jne    8d0 <gets+0x10>
+  for(i=0; i+1 < max; ){
+     8fa:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+     8fc:	8d 75 e7             	lea    -0x19(%ebp),%esi
+     8ff:	eb 2e                	jmp    92f <gets+0x6f>
+     901:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     908:	83 ec 04             	sub    $0x4,%esp
+     90b:	6a 01                	push   $0x1
+     90d:	56                   	push   %esi
+     90e:	6a 00                	push   $0x0
+     910:	e8 a1 01 00 00       	call   ab6 <read>
+    if(cc < 1)
+     915:	83 c4 10             	add    $0x10,%esp
+     918:	85 c0                	test   %eax,%eax
+     91a:	7e 1d                	jle    939 <gets+0x79>
+    buf[i++] = c;
+     91c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     920:	8b 55 08             	mov    0x8(%ebp),%edx
+     923:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     927:	3c 0a                	cmp    $0xa,%al
+     929:	74 10                	je     93b <gets+0x7b>
+     92b:	3c 0d                	cmp    $0xd,%al
+     92d:	74 0c                	je     93b <gets+0x7b>
+  for(i=0; i+1 < max; ){
+     92f:	89 df                	mov    %ebx,%edi
+     931:	83 c3 01             	add    $0x1,%ebx
+     934:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     937:	7c cf                	jl     908 <gets+0x48>
+     939:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     93b:	8b 45 08             	mov    0x8(%ebp),%eax
+     93e:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     942:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     945:	5b                   	pop    %ebx
+     946:	5e                   	pop    %esi
+     947:	5f                   	pop    %edi
+     948:	5d                   	pop    %ebp
+     949:	c3                   	ret
+     94a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000950 <stat>:
+{
+     950:	55                   	push   %ebp
+     951:	89 e5                	mov    %esp,%ebp
+     953:	57                   	push   %edi
+     954:	56                   	push   %esi
+     955:	53                   	push   %ebx
+     956:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+     959:	6a 00                	push   $0x0
+     95b:	ff 75 08             	push   0x8(%ebp)
+     95e:	e8 76 01 00 00       	call   ad9 <open>
+  if(fd < 0)
+     963:	83 c4 10             	add    $0x10,%esp
+     966:	85 c0                	test   %eax,%eax
+     968:	78 76                	js     9e0 <stat+0x90>
+  r = fstat(fd, st);
+     96a:	83 ec 08             	sub    $0x8,%esp
+     96d:	ff 75 0c             	push   0xc(%ebp)
+     970:	89 c3                	mov    %eax,%ebx
+     972:	50                   	push   %eax
+     973:	e8 7f 01 00 00       	call   af7 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     978:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     97b:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     97d:	83 fb 0f             	cmp    $0xf,%ebx
+     980:	7f 40                	jg     9c2 <stat+0x72>
+     982:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     988:	8b 90 44 28 00 00    	mov    0x2844(%eax),%edx
+     98e:	8d b8 40 28 00 00    	lea    0x2840(%eax),%edi
+     994:	85 d2                	test   %edx,%edx
+     996:	7e 1a                	jle    9b2 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+     998:	83 ec 04             	sub    $0x4,%esp
+     99b:	05 48 28 00 00       	add    $0x2848,%eax
+     9a0:	52                   	push   %edx
+     9a1:	50                   	push   %eax
+     9a2:	53                   	push   %ebx
+     9a3:	e8 15 01 00 00       	call   abd <write>
+    ob[fd].n = 0;
+     9a8:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+     9af:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+     9b2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     9b8:	c7 80 40 28 00 00 00 	movl   $0x0,0x2840(%eax)
+     9bf:	00 00 00 
+  return _close(fd);
+     9c2:	83 ec 0c             	sub    $0xc,%esp
+     9c5:	53                   	push   %ebx
+     9c6:	e8 f9 00 00 00       	call   ac4 <_close>
+     9cb:	83 c4 10             	add    $0x10,%esp
+}
+     9ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9d1:	89 f0                	mov    %esi,%eax
+     9d3:	5b                   	pop    %ebx
+     9d4:	5e                   	pop    %esi
+     9d5:	5f                   	pop    %edi
+     9d6:	5d                   	pop    %ebp
+     9d7:	c3                   	ret
+     9d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9df:	90                   	nop
+    return -1;
+     9e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     9e5:	eb e7                	jmp    9ce <stat+0x7e>
+     9e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9ee:	66 90                	xchg   %ax,%ax
+
+000009f0 <atoi>:
+{
+     9f0:	55                   	push   %ebp
+     9f1:	89 e5                	mov    %esp,%ebp
+     9f3:	53                   	push   %ebx
+     9f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     9f7:	0f be 02             	movsbl (%edx),%eax
+     9fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     9fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     a00:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     a05:	77 1e                	ja     a25 <atoi+0x35>
+     a07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a0e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     a10:	83 c2 01             	add    $0x1,%edx
+     a13:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     a16:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     a1a:	0f be 02             	movsbl (%edx),%eax
+     a1d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     a20:	80 fb 09             	cmp    $0x9,%bl
+     a23:	76 eb                	jbe    a10 <atoi+0x20>
+}
+     a25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a28:	89 c8                	mov    %ecx,%eax
+     a2a:	c9                   	leave
+     a2b:	c3                   	ret
+     a2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a30 <memmove>:
+{
+     a30:	55                   	push   %ebp
+     a31:	89 e5                	mov    %esp,%ebp
+     a33:	57                   	push   %edi
+     a34:	56                   	push   %esi
+     a35:	8b 45 10             	mov    0x10(%ebp),%eax
+     a38:	8b 55 08             	mov    0x8(%ebp),%edx
+     a3b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     a3e:	85 c0                	test   %eax,%eax
+     a40:	7e 13                	jle    a55 <memmove+0x25>
+     a42:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     a44:	89 d7                	mov    %edx,%edi
+     a46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a4d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     a50:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     a51:	39 f8                	cmp    %edi,%eax
+     a53:	75 fb                	jne    a50 <memmove+0x20>
+  return vdst;
+}
+     a55:	5e                   	pop    %esi
+     a56:	89 d0                	mov    %edx,%eax
+     a58:	5f                   	pop    %edi
+     a59:	5d                   	pop    %ebp
+     a5a:	c3                   	ret
+
+00000a5b <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+     a5b:	83 3d 38 18 00 00 00 	cmpl   $0x0,0x1838
+  jle 1f
+     a62:	7e 0a                	jle    a6e <syscallentry+0x13>
+  movl %esp, %ecx
+     a64:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+     a66:	ba 6d 0a 00 00       	mov    $0xa6d,%edx
+  sysenter
+     a6b:	0f 34                	sysenter
+2:
+  ret
+     a6d:	c3                   	ret
+1:
+  jl 3f
+     a6e:	7c 27                	jl     a97 <syscallentry+0x3c>
+  pushal
+     a70:	60                   	pusha
+  movl $1, %eax
+     a71:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     a76:	0f a2                	cpuid
+  movl $-1, sysentermode
+     a78:	c7 05 38 18 00 00 ff 	movl   $0xffffffff,0x1838
+     a7f:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     a82:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+     a88:	74 0a                	je     a94 <syscallentry+0x39>
+  movl $1, sysentermode
+     a8a:	c7 05 38 18 00 00 01 	movl   $0x1,0x1838
+     a91:	00 00 00 
+4:
+  popal
+     a94:	61                   	popa
+  jmp syscallentry
+     a95:	eb c4                	jmp    a5b <syscallentry>
+3:
+  int $T_SYSCALL
+     a97:	cd 40                	int    $0x40
+  ret
+     a99:	c3                   	ret
+
+00000a9a <_fork>:
+
+SYSCALLAS(_fork, fork)
+     a9a:	b8 01 00 00 00       	mov    $0x1,%eax
+     a9f:	eb ba                	jmp    a5b <syscallentry>
+
+00000aa1 <_exit>:
+SYSCALLAS(_exit, exit)
+     aa1:	b8 02 00 00 00       	mov    $0x2,%eax
+     aa6:	eb b3                	jmp    a5b <syscallentry>
+
+00000aa8 <wait>:
+SYSCALL(wait)
+     aa8:	b8 03 00 00 00       	mov    $0x3,%eax
+     aad:	eb ac                	jmp    a5b <syscallentry>
+
+00000aaf <pipe>:
+SYSCALL(pipe)
+     aaf:	b8 04 00 00 00       	mov    $0x4,%eax
+     ab4:	eb a5                	jmp    a5b <syscallentry>
+
+00000ab6 <read>:
+SYSCALL(read)
+     ab6:	b8 05 00 00 00       	mov    $0x5,%eax
+     abb:	eb 9e                	jmp    a5b <syscallentry>
+
+00000abd <write>:
+SYSCALL(write)
+     abd:	b8 10 00 00 00       	mov    $0x10,%eax
+     ac2:	eb 97                	jmp    a5b <syscallentry>
+
+00000ac4 <_close>:
+SYSCALLAS(_close, close)
+     ac4:	b8 15 00 00 00       	mov    $0x15,%eax
+     ac9:	eb 90                	jmp    a5b <syscallentry>
+
+00000acb <kill>:
+SYSCALL(kill)
+     acb:	b8 06 00 00 00       	mov    $0x6,%eax
+     ad0:	eb 89                	jmp    a5b <syscallentry>
+
+00000ad2 <_exec>:
+SYSCALLAS(_exec, exec)
+     ad2:	b8 07 00 00 00       	mov    $0x7,%eax
+     ad7:	eb 82                	jmp    a5b <syscallentry>
+
+00000ad9 <open>:
+SYSCALL(open)
+     ad9:	b8 0f 00 00 00       	mov    $0xf,%eax
+     ade:	e9 78 ff ff ff       	jmp    a5b <syscallentry>
+
+00000ae3 <mknod>:
+SYSCALL(mknod)
+     ae3:	b8 11 00 00 00       	mov    $0x11,%eax
+     ae8:	e9 6e ff ff ff       	jmp    a5b <syscallentry>
+
+00000aed <unlink>:
+SYSCALL(unlink)
+     aed:	b8 12 00 00 00       	mov    $0x12,%eax
+     af2:	e9 64 ff ff ff       	jmp    a5b <syscallentry>
+
+00000af7 <fstat>:
+SYSCALL(fstat)
+     af7:	b8 08 00 00 00       	mov    $0x8,%eax
+     afc:	e9 5a ff ff ff       	jmp    a5b <syscallentry>
+
+00000b01 <link>:
+SYSCALL(link)
+     b01:	b8 13 00 00 00       	mov    $0x13,%eax
+     b06:	e9 50 ff ff ff       	jmp    a5b <syscallentry>
+
+00000b0b <mkdir>:
+SYSCALL(mkdir)
+     b0b:	b8 14 00 00 00       	mov    $0x14,%eax
+     b10:	e9 46 ff ff ff       	jmp    a5b <syscallentry>
+
+00000b15 <chdir>:
+SYSCALL(chdir)
+     b15:	b8 09 00 00 00       	mov    $0x9,%eax
+     b1a:	e9 3c ff ff ff       	jmp    a5b <syscallentry>
+
+00000b1f <dup>:
+SYSCALL(dup)
+     b1f:	b8 0a 00 00 00       	mov    $0xa,%eax
+     b24:	e9 32 ff ff ff       	jmp    a5b <syscallentry>
+
+00000b29 <getpid>:
+SYSCALL(getpid)
+     b29:	b8 0b 00 00 00       	mov    $0xb,%eax
+     b2e:	e9 28 ff ff ff       	jmp    a5b <syscallentry>
+
+00000b33 <sbrk>:
+SYSCALL(sbrk)
+     b33:	b8 0c 00 00 00       	mov    $0xc,%eax
+     b38:	e9 1e ff ff ff       	jmp    a5b <syscallentry>
+
+00000b3d <sleep>:
+SYSCALL(sleep)
+     b3d:	b8 0d 00 00 00       	mov    $0xd,%eax
+     b42:	e9 14 ff ff ff       	jmp    a5b <syscallentry>
+
+00000b47 <uptime>:
+SYSCALL(uptime)
+     b47:	b8 0e 00 00 00       	mov    $0xe,%eax
+     b4c:	e9 0a ff ff ff       	jmp    a5b <syscallentry>
+
+00000b51 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+     b51:	b8 16 00 00 00       	mov    $0x16,%eax
+     b56:	e9 00 ff ff ff       	jmp    a5b <syscallentry>
+
+00000b5b <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+     b5b:	b8 17 00 00 00       	mov    $0x17,%eax
+     b60:	e9 f6 fe ff ff       	jmp    a5b <syscallentry>
+
+00000b65 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+     b65:	b8 18 00 00 00       	mov    $0x18,%eax
+     b6a:	e9 ec fe ff ff       	jmp    a5b <syscallentry>
+
+00000b6f <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+     b6f:	b8 19 00 00 00       	mov    $0x19,%eax
+     b74:	e9 e2 fe ff ff       	jmp    a5b <syscallentry>
+
+00000b79 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+     b79:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     b7e:	e9 d8 fe ff ff       	jmp    a5b <syscallentry>
+
+00000b83 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+     b83:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     b88:	e9 ce fe ff ff       	jmp    a5b <syscallentry>
+
+00000b8d <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+     b8d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     b92:	e9 c4 fe ff ff       	jmp    a5b <syscallentry>
+
+00000b97 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+     b97:	b8 20 00 00 00       	mov    $0x20,%eax
+     b9c:	e9 ba fe ff ff       	jmp    a5b <syscallentry>
+
+00000ba1 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+     ba1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     ba6:	e9 b0 fe ff ff       	jmp    a5b <syscallentry>
+
+00000bab <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+     bab:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     bb0:	e9 a6 fe ff ff       	jmp    a5b <syscallentry>
+
+00000bb5 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+     bb5:	b8 21 00 00 00       	mov    $0x21,%eax
+     bba:	e9 9c fe ff ff       	jmp    a5b <syscallentry>
+
+00000bbf <yield>:
+SYSCALL(yield) // yield the CPU to another process
+     bbf:	b8 22 00 00 00       	mov    $0x22,%eax
+     bc4:	e9 92 fe ff ff       	jmp    a5b <syscallentry>
+
+00000bc9 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+     bc9:	b8 23 00 00 00       	mov    $0x23,%eax
+     bce:	e9 88 fe ff ff       	jmp    a5b <syscallentry>
+
+00000bd3 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+     bd3:	b8 24 00 00 00       	mov    $0x24,%eax
+     bd8:	e9 7e fe ff ff       	jmp    a5b <syscallentry>
+
+00000bdd <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+     bdd:	b8 25 00 00 00       	mov    $0x25,%eax
+     be2:	e9 74 fe ff ff       	jmp    a5b <syscallentry>
+
+00000be7 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+     be7:	b8 26 00 00 00       	mov    $0x26,%eax
+     bec:	e9 6a fe ff ff       	jmp    a5b <syscallentry>
+
+00000bf1 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+     bf1:	b8 27 00 00 00       	mov    $0x27,%eax
+     bf6:	e9 60 fe ff ff       	jmp    a5b <syscallentry>
+
+00000bfb <mmap>:
+SYSCALL(mmap) // map a file into memory
+     bfb:	b8 28 00 00 00       	mov    $0x28,%eax
+     c00:	e9 56 fe ff ff       	jmp    a5b <syscallentry>
+
+00000c05 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+     c05:	b8 29 00 00 00       	mov    $0x29,%eax
+     c0a:	e9 4c fe ff ff       	jmp    a5b <syscallentry>
+
+00000c0f <readv>:
+SYSCALL(readv) // read into several buffers
+     c0f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     c14:	e9 42 fe ff ff       	jmp    a5b <syscallentry>
+
+00000c19 <writev>:
+SYSCALL(writev) // write from several buffers
+     c19:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     c1e:	e9 38 fe ff ff       	jmp    a5b <syscallentry>
+
+00000c23 <pread>:
+SYSCALL(pread) // read at an offset
+     c23:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     c28:	e9 2e fe ff ff       	jmp    a5b <syscallentry>
+
+00000c2d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+     c2d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     c32:	e9 24 fe ff ff       	jmp    a5b <syscallentry>
+
+00000c37 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+     c37:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     c3c:	e9 1a fe ff ff       	jmp    a5b <syscallentry>
+
+00000c41 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+     c41:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     c46:	e9 10 fe ff ff       	jmp    a5b <syscallentry>
+
+00000c4b <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+     c4b:	b8 30 00 00 00       	mov    $0x30,%eax
+     c50:	e9 06 fe ff ff       	jmp    a5b <syscallentry>
+
+00000c55 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+     c55:	b8 31 00 00 00       	mov    $0x31,%eax
+     c5a:	e9 fc fd ff ff       	jmp    a5b <syscallentry>
+
+00000c5f <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+     c5f:	b8 32 00 00 00       	mov    $0x32,%eax
+     c64:	e9 f2 fd ff ff       	jmp    a5b <syscallentry>
+
+00000c69 <profread>:
+SYSCALL(profread) // drain profiler samples
+     c69:	b8 33 00 00 00       	mov    $0x33,%eax
+     c6e:	e9 e8 fd ff ff       	jmp    a5b <syscallentry>
+
+00000c73 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+     c73:	b8 34 00 00 00       	mov    $0x34,%eax
+     c78:	e9 de fd ff ff       	jmp    a5b <syscallentry>
+
+00000c7d <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+     c7d:	b8 35 00 00 00       	mov    $0x35,%eax
+     c82:	e9 d4 fd ff ff       	jmp    a5b <syscallentry>
+
+00000c87 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+     c87:	b8 36 00 00 00       	mov    $0x36,%eax
+     c8c:	e9 ca fd ff ff       	jmp    a5b <syscallentry>
+
+00000c91 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+     c91:	b8 37 00 00 00       	mov    $0x37,%eax
+     c96:	e9 c0 fd ff ff       	jmp    a5b <syscallentry>
+     c9b:	66 90                	xchg   %ax,%ax
+     c9d:	66 90                	xchg   %ax,%ax
+     c9f:	90                   	nop
+
+00000ca0 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     ca0:	55                   	push   %ebp
+     ca1:	89 e5                	mov    %esp,%ebp
+     ca3:	57                   	push   %edi
+     ca4:	56                   	push   %esi
+     ca5:	53                   	push   %ebx
+     ca6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     ca8:	89 d1                	mov    %edx,%ecx
+{
+     caa:	83 ec 3c             	sub    $0x3c,%esp
+     cad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     cb0:	85 d2                	test   %edx,%edx
+     cb2:	0f 89 80 00 00 00    	jns    d38 <printint+0x98>
+     cb8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     cbc:	74 7a                	je     d38 <printint+0x98>
+    x = -xx;
+     cbe:	f7 d9                	neg    %ecx
+    neg = 1;
+     cc0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     cc5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     cc8:	31 f6                	xor    %esi,%esi
+     cca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     cd0:	89 c8                	mov    %ecx,%eax
+     cd2:	31 d2                	xor    %edx,%edx
+     cd4:	89 f7                	mov    %esi,%edi
+     cd6:	f7 f3                	div    %ebx
+     cd8:	8d 76 01             	lea    0x1(%esi),%esi
+     cdb:	0f b6 92 2c 13 00 00 	movzbl 0x132c(%edx),%edx
+     ce2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     ce6:	89 ca                	mov    %ecx,%edx
+     ce8:	89 c1                	mov    %eax,%ecx
+     cea:	39 da                	cmp    %ebx,%edx
+     cec:	73 e2                	jae    cd0 <printint+0x30>
+  if(neg)
+     cee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     cf1:	85 c0                	test   %eax,%eax
+     cf3:	74 07                	je     cfc <printint+0x5c>
+    buf[i++] = '-';
+     cf5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     cfa:	89 f7                	mov    %esi,%edi
+     cfc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     cff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     d02:	01 df                	add    %ebx,%edi
+     d04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     d08:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+     d0b:	83 ec 04             	sub    $0x4,%esp
+     d0e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     d11:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     d14:	6a 01                	push   $0x1
+     d16:	50                   	push   %eax
+     d17:	56                   	push   %esi
+     d18:	e8 e3 f6 ff ff       	call   400 <bufwrite>
+  while(--i >= 0)
+     d1d:	89 f8                	mov    %edi,%eax
+     d1f:	83 c4 10             	add    $0x10,%esp
+     d22:	83 ef 01             	sub    $0x1,%edi
+     d25:	39 d8                	cmp    %ebx,%eax
+     d27:	75 df                	jne    d08 <printint+0x68>
+}
+     d29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d2c:	5b                   	pop    %ebx
+     d2d:	5e                   	pop    %esi
+     d2e:	5f                   	pop    %edi
+     d2f:	5d                   	pop    %ebp
+     d30:	c3                   	ret
+     d31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     d38:	31 c0                	xor    %eax,%eax
+     d3a:	eb 89                	jmp    cc5 <printint+0x25>
+     d3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000d40 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     d40:	55                   	push   %ebp
+     d41:	89 e5                	mov    %esp,%ebp
+     d43:	57                   	push   %edi
+     d44:	56                   	push   %esi
+     d45:	53                   	push   %ebx
+     d46:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     d49:	8b 45 0c             	mov    0xc(%ebp),%eax
+     d4c:	0f b6 18             	movzbl (%eax),%ebx
+     d4f:	84 db                	test   %bl,%bl
+     d51:	74 6c                	je     dbf <printf+0x7f>
+     d53:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+     d56:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+     d59:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     d5b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     d5e:	eb 26                	jmp    d86 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     d60:	83 f8 25             	cmp    $0x25,%eax
+     d63:	74 4b                	je     db0 <printf+0x70>
+  bufwrite(fd, &c, 1);
+     d65:	83 ec 04             	sub    $0x4,%esp
+     d68:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     d6b:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     d6e:	6a 01                	push   $0x1
+     d70:	50                   	push   %eax
+     d71:	ff 75 08             	push   0x8(%ebp)
+     d74:	e8 87 f6 ff ff       	call   400 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+     d79:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     d7c:	0f b6 1f             	movzbl (%edi),%ebx
+     d7f:	83 c7 01             	add    $0x1,%edi
+     d82:	84 db                	test   %bl,%bl
+     d84:	74 39                	je     dbf <printf+0x7f>
+    c = fmt[i] & 0xff;
+     d86:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     d89:	85 f6                	test   %esi,%esi
+     d8b:	74 d3                	je     d60 <printf+0x20>
+      }
+    } else if(state == '%'){
+     d8d:	83 fe 25             	cmp    $0x25,%esi
+     d90:	75 ea                	jne    d7c <printf+0x3c>
+      if(c == 'd'){
+     d92:	83 f8 25             	cmp    $0x25,%eax
+     d95:	0f 84 d5 01 00 00    	je     f70 <printf+0x230>
+     d9b:	83 e8 63             	sub    $0x63,%eax
+     d9e:	83 f8 15             	cmp    $0x15,%eax
+     da1:	77 45                	ja     de8 <printf+0xa8>
+     da3:	ff 24 85 d4 12 00 00 	jmp    *0x12d4(,%eax,4)
+     daa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     db0:	0f b6 1f             	movzbl (%edi),%ebx
+     db3:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+     db6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     dbb:	84 db                	test   %bl,%bl
+     dbd:	75 c7                	jne    d86 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+     dbf:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+     dc3:	74 0b                	je     dd0 <printf+0x90>
+    fflush(fd);
+}
+     dc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     dc8:	5b                   	pop    %ebx
+     dc9:	5e                   	pop    %esi
+     dca:	5f                   	pop    %edi
+     dcb:	5d                   	pop    %ebp
+     dcc:	c3                   	ret
+     dcd:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+     dd0:	83 ec 0c             	sub    $0xc,%esp
+     dd3:	6a 02                	push   $0x2
+     dd5:	e8 c6 f7 ff ff       	call   5a0 <fflush>
+     dda:	83 c4 10             	add    $0x10,%esp
+}
+     ddd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     de0:	5b                   	pop    %ebx
+     de1:	5e                   	pop    %esi
+     de2:	5f                   	pop    %edi
+     de3:	5d                   	pop    %ebp
+     de4:	c3                   	ret
+     de5:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+     de8:	83 ec 04             	sub    $0x4,%esp
+     deb:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     dee:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+     df2:	6a 01                	push   $0x1
+     df4:	52                   	push   %edx
+     df5:	89 55 c0             	mov    %edx,-0x40(%ebp)
+     df8:	ff 75 08             	push   0x8(%ebp)
+     dfb:	e8 00 f6 ff ff       	call   400 <bufwrite>
+     e00:	83 c4 0c             	add    $0xc,%esp
+     e03:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     e06:	6a 01                	push   $0x1
+     e08:	8b 55 c0             	mov    -0x40(%ebp),%edx
+     e0b:	52                   	push   %edx
+      state = 0;
+     e0c:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+     e0e:	ff 75 08             	push   0x8(%ebp)
+     e11:	e8 ea f5 ff ff       	call   400 <bufwrite>
+        putc(fd, c);
+     e16:	83 c4 10             	add    $0x10,%esp
+     e19:	e9 5e ff ff ff       	jmp    d7c <printf+0x3c>
+     e1e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+     e20:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     e23:	83 ec 0c             	sub    $0xc,%esp
+     e26:	b9 10 00 00 00       	mov    $0x10,%ecx
+     e2b:	8b 16                	mov    (%esi),%edx
+     e2d:	6a 00                	push   $0x0
+     e2f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+     e32:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+     e35:	e8 66 fe ff ff       	call   ca0 <printint>
+        ap++;
+     e3a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     e3d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     e40:	31 f6                	xor    %esi,%esi
+     e42:	e9 35 ff ff ff       	jmp    d7c <printf+0x3c>
+     e47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e4e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     e50:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     e53:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     e55:	83 c0 04             	add    $0x4,%eax
+     e58:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+     e5b:	b8 cc 12 00 00       	mov    $0x12cc,%eax
+     e60:	85 db                	test   %ebx,%ebx
+     e62:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+     e65:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+     e68:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+     e6a:	53                   	push   %ebx
+     e6b:	e8 90 f9 ff ff       	call   800 <strlen>
+     e70:	83 c4 0c             	add    $0xc,%esp
+     e73:	50                   	push   %eax
+     e74:	53                   	push   %ebx
+     e75:	ff 75 08             	push   0x8(%ebp)
+     e78:	e8 83 f5 ff ff       	call   400 <bufwrite>
+     e7d:	83 c4 10             	add    $0x10,%esp
+     e80:	e9 f7 fe ff ff       	jmp    d7c <printf+0x3c>
+     e85:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+     e88:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+     e8b:	83 ec 04             	sub    $0x4,%esp
+     e8e:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+     e91:	8b 06                	mov    (%esi),%eax
+        ap++;
+     e93:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+     e96:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+     e99:	6a 01                	push   $0x1
+     e9b:	52                   	push   %edx
+     e9c:	ff 75 08             	push   0x8(%ebp)
+     e9f:	e8 5c f5 ff ff       	call   400 <bufwrite>
+        ap++;
+     ea4:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     ea7:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     eaa:	31 f6                	xor    %esi,%esi
+     eac:	e9 cb fe ff ff       	jmp    d7c <printf+0x3c>
+     eb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+     eb8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     ebb:	83 ec 0c             	sub    $0xc,%esp
+     ebe:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     ec3:	8b 16                	mov    (%esi),%edx
+     ec5:	6a 01                	push   $0x1
+     ec7:	e9 63 ff ff ff       	jmp    e2f <printf+0xef>
+     ecc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+     ed0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     ed3:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     ed6:	89 7d c0             	mov    %edi,-0x40(%ebp)
+     ed9:	89 55 bc             	mov    %edx,-0x44(%ebp)
+     edc:	8b 18                	mov    (%eax),%ebx
+     ede:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+     ee1:	31 c0                	xor    %eax,%eax
+     ee3:	89 c7                	mov    %eax,%edi
+     ee5:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+     ee8:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+     eed:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+     eef:	f7 e1                	mul    %ecx
+     ef1:	c1 ea 03             	shr    $0x3,%edx
+     ef4:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     ef7:	89 d1                	mov    %edx,%ecx
+     ef9:	01 c0                	add    %eax,%eax
+     efb:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     efd:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+     eff:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     f01:	be 0a 00 00 00       	mov    $0xa,%esi
+     f06:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+     f08:	89 da                	mov    %ebx,%edx
+     f0a:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+     f0c:	89 fe                	mov    %edi,%esi
+     f0e:	83 c7 01             	add    $0x1,%edi
+     f11:	8d 42 30             	lea    0x30(%edx),%eax
+     f14:	89 da                	mov    %ebx,%edx
+     f16:	8d 14 92             	lea    (%edx,%edx,4),%edx
+     f19:	01 d2                	add    %edx,%edx
+     f1b:	29 d0                	sub    %edx,%eax
+     f1d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+     f21:	89 c8                	mov    %ecx,%eax
+     f23:	09 d8                	or     %ebx,%eax
+     f25:	75 c1                	jne    ee8 <printf+0x1a8>
+     f27:	8b 55 bc             	mov    -0x44(%ebp),%edx
+     f2a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     f2d:	01 d6                	add    %edx,%esi
+     f2f:	89 f7                	mov    %esi,%edi
+     f31:	89 d6                	mov    %edx,%esi
+     f33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f37:	90                   	nop
+    putc(fd, buf[i]);
+     f38:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+     f3b:	83 ec 04             	sub    $0x4,%esp
+     f3e:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+     f41:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+     f44:	6a 01                	push   $0x1
+     f46:	50                   	push   %eax
+     f47:	53                   	push   %ebx
+     f48:	e8 b3 f4 ff ff       	call   400 <bufwrite>
+  while(--i >= 0)
+     f4d:	89 fa                	mov    %edi,%edx
+     f4f:	83 c4 10             	add    $0x10,%esp
+     f52:	83 ef 01             	sub    $0x1,%edi
+     f55:	39 d6                	cmp    %edx,%esi
+     f57:	75 df                	jne    f38 <printf+0x1f8>
+        ap += 2;
+     f59:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+     f5d:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+     f60:	31 f6                	xor    %esi,%esi
+     f62:	e9 15 fe ff ff       	jmp    d7c <printf+0x3c>
+     f67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f6e:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+     f70:	83 ec 04             	sub    $0x4,%esp
+     f73:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     f76:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     f79:	6a 01                	push   $0x1
+     f7b:	e9 8b fe ff ff       	jmp    e0b <printf+0xcb>
+
+00000f80 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     f80:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f81:	a1 c0 38 00 00       	mov    0x38c0,%eax
+{
+     f86:	89 e5                	mov    %esp,%ebp
+     f88:	57                   	push   %edi
+     f89:	56                   	push   %esi
+     f8a:	53                   	push   %ebx
+     f8b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     f8e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f98:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f9a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f9c:	39 ca                	cmp    %ecx,%edx
+     f9e:	73 30                	jae    fd0 <free+0x50>
+     fa0:	39 c1                	cmp    %eax,%ecx
+     fa2:	72 04                	jb     fa8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     fa4:	39 c2                	cmp    %eax,%edx
+     fa6:	72 f0                	jb     f98 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     fa8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     fab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     fae:	39 f8                	cmp    %edi,%eax
+     fb0:	74 2e                	je     fe0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     fb2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     fb5:	8b 42 04             	mov    0x4(%edx),%eax
+     fb8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     fbb:	39 f1                	cmp    %esi,%ecx
+     fbd:	74 38                	je     ff7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     fbf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     fc1:	5b                   	pop    %ebx
+  freep = p;
+     fc2:	89 15 c0 38 00 00    	mov    %edx,0x38c0
+}
+     fc8:	5e                   	pop    %esi
+     fc9:	5f                   	pop    %edi
+     fca:	5d                   	pop    %ebp
+     fcb:	c3                   	ret
+     fcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     fd0:	39 c1                	cmp    %eax,%ecx
+     fd2:	72 d0                	jb     fa4 <free+0x24>
+     fd4:	eb c2                	jmp    f98 <free+0x18>
+     fd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fdd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+     fe0:	03 70 04             	add    0x4(%eax),%esi
+     fe3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     fe6:	8b 02                	mov    (%edx),%eax
+     fe8:	8b 00                	mov    (%eax),%eax
+     fea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     fed:	8b 42 04             	mov    0x4(%edx),%eax
+     ff0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     ff3:	39 f1                	cmp    %esi,%ecx
+     ff5:	75 c8                	jne    fbf <free+0x3f>
+    p->s.size += bp->s.size;
+     ff7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     ffa:	89 15 c0 38 00 00    	mov    %edx,0x38c0
+    p->s.size += bp->s.size;
+    1000:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1003:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1006:	89 0a                	mov    %ecx,(%edx)
+}
+    1008:	5b                   	pop    %ebx
+    1009:	5e                   	pop    %esi
+    100a:	5f                   	pop    %edi
+    100b:	5d                   	pop    %ebp
+    100c:	c3                   	ret
+    100d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001010 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1010:	55                   	push   %ebp
+    1011:	89 e5                	mov    %esp,%ebp
+    1013:	57                   	push   %edi
+    1014:	56                   	push   %esi
+    1015:	53                   	push   %ebx
+    1016:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1019:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    101c:	8b 15 c0 38 00 00    	mov    0x38c0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1022:	8d 78 07             	lea    0x7(%eax),%edi
+    1025:	c1 ef 03             	shr    $0x3,%edi
+    1028:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    102b:	85 d2                	test   %edx,%edx
+    102d:	0f 84 8d 00 00 00    	je     10c0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1033:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1035:	8b 48 04             	mov    0x4(%eax),%ecx
+    1038:	39 f9                	cmp    %edi,%ecx
+    103a:	73 64                	jae    10a0 <malloc+0x90>
+  if(nu < 4096)
+    103c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1041:	39 df                	cmp    %ebx,%edi
+    1043:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1046:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    104d:	eb 0a                	jmp    1059 <malloc+0x49>
+    104f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1050:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1052:	8b 48 04             	mov    0x4(%eax),%ecx
+    1055:	39 f9                	cmp    %edi,%ecx
+    1057:	73 47                	jae    10a0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1059:	89 c2                	mov    %eax,%edx
+    105b:	39 05 c0 38 00 00    	cmp    %eax,0x38c0
+    1061:	75 ed                	jne    1050 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1063:	83 ec 0c             	sub    $0xc,%esp
+    1066:	56                   	push   %esi
+    1067:	e8 c7 fa ff ff       	call   b33 <sbrk>
+  if(p == (char*)-1)
+    106c:	83 c4 10             	add    $0x10,%esp
+    106f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1072:	74 1c                	je     1090 <malloc+0x80>
+  hp->s.size = nu;
+    1074:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1077:	83 ec 0c             	sub    $0xc,%esp
+    107a:	83 c0 08             	add    $0x8,%eax
+    107d:	50                   	push   %eax
+    107e:	e8 fd fe ff ff       	call   f80 <free>
+  return freep;
+    1083:	8b 15 c0 38 00 00    	mov    0x38c0,%edx
+      if((p = morecore(nunits)) == 0)
+    1089:	83 c4 10             	add    $0x10,%esp
+    108c:	85 d2                	test   %edx,%edx
+    108e:	75 c0                	jne    1050 <malloc+0x40>
+        return 0;
+  }
+}
+    1090:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1093:	31 c0                	xor    %eax,%eax
+}
+    1095:	5b                   	pop    %ebx
+    1096:	5e                   	pop    %esi
+    1097:	5f                   	pop    %edi
+    1098:	5d                   	pop    %ebp
+    1099:	c3                   	ret
+    109a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    10a0:	39 cf                	cmp    %ecx,%edi
+    10a2:	74 4c                	je     10f0 <malloc+0xe0>
+        p->s.size -= nunits;
+    10a4:	29 f9                	sub    %edi,%ecx
+    10a6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    10a9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    10ac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    10af:	89 15 c0 38 00 00    	mov    %edx,0x38c0
+}
+    10b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    10b8:	83 c0 08             	add    $0x8,%eax
+}
+    10bb:	5b                   	pop    %ebx
+    10bc:	5e                   	pop    %esi
+    10bd:	5f                   	pop    %edi
+    10be:	5d                   	pop    %ebp
+    10bf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    10c0:	c7 05 c0 38 00 00 c4 	movl   $0x38c4,0x38c0
+    10c7:	38 00 00 
+    base.s.size = 0;
+    10ca:	b8 c4 38 00 00       	mov    $0x38c4,%eax
+    base.s.ptr = freep = prevp = &base;
+    10cf:	c7 05 c4 38 00 00 c4 	movl   $0x38c4,0x38c4
+    10d6:	38 00 00 
+    base.s.size = 0;
+    10d9:	c7 05 c8 38 00 00 00 	movl   $0x0,0x38c8
+    10e0:	00 00 00 
+    if(p->s.size >= nunits){
+    10e3:	e9 54 ff ff ff       	jmp    103c <malloc+0x2c>
+    10e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    10f0:	8b 08                	mov    (%eax),%ecx
+    10f2:	89 0a                	mov    %ecx,(%edx)
+    10f4:	eb b9                	jmp    10af <malloc+0x9f>
+    10f6:	66 90                	xchg   %ax,%ax
+    10f8:	66 90                	xchg   %ax,%ax
+    10fa:	66 90                	xchg   %ax,%ax
+    10fc:	66 90                	xchg   %ax,%ax
+    10fe:	66 90                	xchg   %ax,%ax
+
+00001100 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+    1100:	55                   	push   %ebp
+    1101:	89 e5                	mov    %esp,%ebp
+    1103:	57                   	push   %edi
+    1104:	56                   	push   %esi
+    1105:	be 01 00 00 00       	mov    $0x1,%esi
+    110a:	53                   	push   %ebx
+    110b:	83 ec 28             	sub    $0x28,%esp
+    110e:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1111:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1114:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+    1117:	68 00 98 00 00       	push   $0x9800
+    111c:	e8 ef fe ff ff       	call   1010 <malloc>
+    1121:	83 c4 10             	add    $0x10,%esp
+    1124:	89 c7                	mov    %eax,%edi
+    1126:	85 c0                	test   %eax,%eax
+    1128:	74 62                	je     118c <waitpoll+0x8c>
+    112a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+    1130:	83 ec 0c             	sub    $0xc,%esp
+    1133:	6a 01                	push   $0x1
+    1135:	e8 03 fa ff ff       	call   b3d <sleep>
+    fn();
+    113a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    113d:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+    113f:	58                   	pop    %eax
+    1140:	5a                   	pop    %edx
+    1141:	68 00 02 00 00       	push   $0x200
+    1146:	57                   	push   %edi
+    1147:	e8 eb fa ff ff       	call   c37 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+    114c:	83 c4 10             	add    $0x10,%esp
+    114f:	85 c0                	test   %eax,%eax
+    1151:	7e 2d                	jle    1180 <waitpoll+0x80>
+    1153:	6b c0 4c             	imul   $0x4c,%eax,%eax
+    1156:	89 fa                	mov    %edi,%edx
+    alive = 0;
+    1158:	31 c9                	xor    %ecx,%ecx
+    115a:	01 f8                	add    %edi,%eax
+    115c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+    1160:	3b 1a                	cmp    (%edx),%ebx
+    1162:	75 07                	jne    116b <waitpoll+0x6b>
+        alive = 1;
+    1164:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+    1168:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+    116b:	83 c2 4c             	add    $0x4c,%edx
+    116e:	39 d0                	cmp    %edx,%eax
+    1170:	75 ee                	jne    1160 <waitpoll+0x60>
+  } while(alive);
+    1172:	85 c9                	test   %ecx,%ecx
+    1174:	75 ba                	jne    1130 <waitpoll+0x30>
+    1176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    117d:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+    1180:	83 ec 0c             	sub    $0xc,%esp
+    1183:	57                   	push   %edi
+    1184:	e8 f7 fd ff ff       	call   f80 <free>
+  wait();
+    1189:	83 c4 10             	add    $0x10,%esp
+}
+    118c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    118f:	5b                   	pop    %ebx
+    1190:	5e                   	pop    %esi
+    1191:	5f                   	pop    %edi
+    1192:	5d                   	pop    %ebp
+  wait();
+    1193:	e9 10 f9 ff ff       	jmp    aa8 <wait>
+    1198:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    119f:	90                   	nop
+
+000011a0 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+    11a0:	55                   	push   %ebp
+    11a1:	89 e5                	mov    %esp,%ebp
+    11a3:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+    11a6:	c7 45 f0 3d 13 00 00 	movl   $0x133d,-0x10(%ebp)
+    11ad:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+    11b4:	e8 87 f4 ff ff       	call   640 <fork>
+    11b9:	85 c0                	test   %eax,%eax
+    11bb:	78 09                	js     11c6 <runps+0x26>
+    return -1;
+  if(pid == 0){
+    11bd:	74 0e                	je     11cd <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+    11bf:	e8 e4 f8 ff ff       	call   aa8 <wait>
+}
+    11c4:	c9                   	leave
+    11c5:	c3                   	ret
+    11c6:	c9                   	leave
+    return -1;
+    11c7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11cc:	c3                   	ret
+    exec("ps", argv);
+    11cd:	50                   	push   %eax
+    11ce:	50                   	push   %eax
+    11cf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    11d2:	50                   	push   %eax
+    11d3:	68 3d 13 00 00       	push   $0x133d
+    11d8:	e8 c3 f4 ff ff       	call   6a0 <exec>
+    printf(2, "exec ps failed\n");
+    11dd:	5a                   	pop    %edx
+    11de:	59                   	pop    %ecx
+    11df:	68 40 13 00 00       	push   $0x1340
+    11e4:	6a 02                	push   $0x2
+    11e6:	e8 55 fb ff ff       	call   d40 <printf>
+    exit();
+    11eb:	e8 a0 f4 ff ff       	call   690 <exit>
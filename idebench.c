@@ -0,0 +1,125 @@
+// Compare disk throughput and leftover CPU between PIO and DMA.
+//
+// For each mode, spinner children count loop iterations for a
+// fixed number of ticks while the parent repeatedly writes and
+// reads back a file.  The spinners' count, relative to an idle
+// run, shows how much CPU the disk transfers left over.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define TICKS 300
+#define FILENAME "idebench.tmp"
+
+char buf[8*512];
+
+// Spin for TICKS ticks and report the iteration count on fd.
+void
+spinner(int fd)
+{
+  int end, i;
+  uint n;
+
+  n = 0;
+  end = uptime() + TICKS;
+  while(uptime() < end){
+    for(i = 0; i < 100000; i++)
+      n++;
+  }
+  write(fd, &n, sizeof(n));
+  exit();
+}
+
+// Write and read back a kb-KB file until TICKS ticks pass.
+// Returns the number of KB moved.
+uint
+diskload(int kb)
+{
+  int end, fd, i;
+  uint moved;
+
+  moved = 0;
+  end = uptime() + TICKS;
+  while(uptime() < end){
+    if((fd = open(FILENAME, O_CREATE|O_RDWR)) < 0){
+      printf(2, "idebench: cannot create %s\n", FILENAME);
+      exit();
+    }
+    for(i = 0; i < kb; i += sizeof(buf)/1024)
+      write(fd, buf, sizeof(buf));
+    close(fd);
+    fd = open(FILENAME, O_RDONLY);
+    while(read(fd, buf, sizeof(buf)) > 0)
+      ;
+    close(fd);
+    unlink(FILENAME);
+    moved += 2*kb;
+  }
+  return moved;
+}
+
+// Run nspin spinners, with the disk load if kb > 0.
+// Returns the spinners' total iteration count.
+uint
+run(int nspin, int kb, uint *moved)
+{
+  int i, p[2];
+  uint n, total;
+
+  if(pipe(p) < 0){
+    printf(2, "idebench: pipe failed\n");
+    exit();
+  }
+  for(i = 0; i < nspin; i++){
+    if(fork() == 0){
+      close(p[0]);
+      spinner(p[1]);
+    }
+  }
+  close(p[1]);
+  *moved = kb > 0 ? diskload(kb) : 0;
+  total = 0;
+  for(i = 0; i < nspin; i++){
+    if(read(p[0], &n, sizeof(n)) == sizeof(n))
+      total += n;
+    wait();
+  }
+  close(p[0]);
+  return total;
+}
+
+int
+main(int argc, char *argv[])
+{
+  static char *names[] = { [IDE_PIO] "PIO", [IDE_DMA] "DMA" };
+  int kb, nspin, mode, old, orig;
+  uint idle, busy, moved;
+
+  kb = argc > 1 ? atoi(argv[1]) : 64;
+  nspin = argc > 2 ? atoi(argv[2]) : 2;
+  memset(buf, 'x', sizeof(buf));
+
+  printf(1, "idebench: %d KB file, %d spinners, %d ticks per run\n",
+         kb, nspin, TICKS);
+  idle = run(nspin, 0, &moved);
+  printf(1, "idle: %d spins\n", idle);
+
+  orig = -1;
+  for(mode = IDE_PIO; mode <= IDE_DMA; mode++){
+    if((old = setidemode(mode)) < 0){
+      printf(1, "%s: not available\n", names[mode]);
+      continue;
+    }
+    if(orig < 0)
+      orig = old;
+    busy = run(nspin, kb, &moved);
+    printf(1, "%s: %d KB in %d ticks, %d spins (%d%% of idle)\n",
+           names[mode], moved, TICKS, busy,
+           idle ? busy / (idle / 100 + 1) : 0);
+  }
+  if(orig >= 0)
+    setidemode(orig);
+  exit();
+}
@@ -0,0 +1,2028 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+   f:	83 ec 08             	sub    $0x8,%esp
+  12:	6a 02                	push   $0x2
+  14:	68 e0 0e 00 00       	push   $0xee0
+  19:	e8 ab 07 00 00       	call   7c9 <open>
+  1e:	83 c4 10             	add    $0x10,%esp
+  21:	85 c0                	test   %eax,%eax
+  23:	0f 88 9f 00 00 00    	js     c8 <main+0xc8>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+  29:	83 ec 0c             	sub    $0xc,%esp
+  2c:	6a 00                	push   $0x0
+  2e:	e8 dc 07 00 00       	call   80f <dup>
+  dup(0);  // stderr
+  33:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  3a:	e8 d0 07 00 00       	call   80f <dup>
+  3f:	83 c4 10             	add    $0x10,%esp
+  42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  48:	83 ec 08             	sub    $0x8,%esp
+  4b:	68 e8 0e 00 00       	push   $0xee8
+  50:	6a 01                	push   $0x1
+  52:	e8 d9 09 00 00       	call   a30 <printf>
+    pid = fork();
+  57:	e8 d4 02 00 00       	call   330 <fork>
+    if(pid < 0){
+  5c:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+  5f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+  61:	85 c0                	test   %eax,%eax
+  63:	78 2c                	js     91 <main+0x91>
+      printf(1, "init: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+  65:	74 3d                	je     a4 <main+0xa4>
+  67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6e:	66 90                	xchg   %ax,%ax
+      exec("sh", argv);
+      printf(1, "init: exec sh failed\n");
+      exit();
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+  70:	e8 23 07 00 00       	call   798 <wait>
+  75:	85 c0                	test   %eax,%eax
+  77:	78 cf                	js     48 <main+0x48>
+  79:	39 c3                	cmp    %eax,%ebx
+  7b:	74 cb                	je     48 <main+0x48>
+      printf(1, "zombie!\n");
+  7d:	83 ec 08             	sub    $0x8,%esp
+  80:	68 27 0f 00 00       	push   $0xf27
+  85:	6a 01                	push   $0x1
+  87:	e8 a4 09 00 00       	call   a30 <printf>
+  8c:	83 c4 10             	add    $0x10,%esp
+  8f:	eb df                	jmp    70 <main+0x70>
+      printf(1, "init: fork failed\n");
+  91:	53                   	push   %ebx
+  92:	53                   	push   %ebx
+  93:	68 fb 0e 00 00       	push   $0xefb
+  98:	6a 01                	push   $0x1
+  9a:	e8 91 09 00 00       	call   a30 <printf>
+      exit();
+  9f:	e8 dc 02 00 00       	call   380 <exit>
+      exec("sh", argv);
+  a4:	50                   	push   %eax
+  a5:	50                   	push   %eax
+  a6:	68 18 14 00 00       	push   $0x1418
+  ab:	68 0e 0f 00 00       	push   $0xf0e
+  b0:	e8 db 02 00 00       	call   390 <exec>
+      printf(1, "init: exec sh failed\n");
+  b5:	5a                   	pop    %edx
+  b6:	59                   	pop    %ecx
+  b7:	68 11 0f 00 00       	push   $0xf11
+  bc:	6a 01                	push   $0x1
+  be:	e8 6d 09 00 00       	call   a30 <printf>
+      exit();
+  c3:	e8 b8 02 00 00       	call   380 <exit>
+    mknod("console", 1, 1);
+  c8:	50                   	push   %eax
+  c9:	6a 01                	push   $0x1
+  cb:	6a 01                	push   $0x1
+  cd:	68 e0 0e 00 00       	push   $0xee0
+  d2:	e8 fc 06 00 00       	call   7d3 <mknod>
+    open("console", O_RDWR);
+  d7:	58                   	pop    %eax
+  d8:	5a                   	pop    %edx
+  d9:	6a 02                	push   $0x2
+  db:	68 e0 0e 00 00       	push   $0xee0
+  e0:	e8 e4 06 00 00       	call   7c9 <open>
+  e5:	83 c4 10             	add    $0x10,%esp
+  e8:	e9 3c ff ff ff       	jmp    29 <main+0x29>
+  ed:	66 90                	xchg   %ax,%ax
+  ef:	90                   	nop
+
+000000f0 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	57                   	push   %edi
+  f4:	56                   	push   %esi
+  f5:	53                   	push   %ebx
+  f6:	83 ec 4c             	sub    $0x4c,%esp
+  f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 102:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+ 105:	83 fa 0f             	cmp    $0xf,%edx
+ 108:	0f 87 32 01 00 00    	ja     240 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+ 10e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 114:	8b 80 40 14 00 00    	mov    0x1440(%eax),%eax
+ 11a:	85 c0                	test   %eax,%eax
+ 11c:	0f 84 de 00 00 00    	je     200 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+ 122:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 128:	8b b0 44 14 00 00    	mov    0x1444(%eax),%esi
+ 12e:	8d 88 40 14 00 00    	lea    0x1440(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+ 134:	8d b8 48 14 00 00    	lea    0x1448(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+ 13a:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+ 13d:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+ 140:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+ 143:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+ 149:	0f 8f 01 01 00 00    	jg     250 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+ 14f:	8d 78 08             	lea    0x8(%eax),%edi
+ 152:	8d bc 3e 40 14 00 00 	lea    0x1440(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 159:	85 db                	test   %ebx,%ebx
+ 15b:	7e 3b                	jle    198 <bufwrite+0xa8>
+ 15d:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+ 160:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+    *dst++ = *src++;
+ 168:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 169:	39 c6                	cmp    %eax,%esi
+ 16b:	75 fb                	jne    168 <bufwrite+0x78>
+  ob[fd].n += n;
+ 16d:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 173:	8b 88 44 14 00 00    	mov    0x1444(%eax),%ecx
+ 179:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 17b:	83 b8 40 14 00 00 01 	cmpl   $0x1,0x1440(%eax)
+  ob[fd].n += n;
+ 182:	89 88 44 14 00 00    	mov    %ecx,0x1444(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 188:	74 26                	je     1b0 <bufwrite+0xc0>
+}
+ 18a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 18d:	5b                   	pop    %ebx
+ 18e:	5e                   	pop    %esi
+ 18f:	5f                   	pop    %edi
+ 190:	5d                   	pop    %ebp
+ 191:	c3                   	ret
+ 192:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+ 198:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 19b:	83 b8 40 14 00 00 01 	cmpl   $0x1,0x1440(%eax)
+  ob[fd].n += n;
+ 1a2:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 1a5:	75 e3                	jne    18a <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+ 1a7:	85 db                	test   %ebx,%ebx
+ 1a9:	74 df                	je     18a <bufwrite+0x9a>
+ 1ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1af:	90                   	nop
+  src = vsrc;
+ 1b0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 1b3:	01 c3                	add    %eax,%ebx
+ 1b5:	eb 10                	jmp    1c7 <bufwrite+0xd7>
+ 1b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1be:	66 90                	xchg   %ax,%ax
+ 1c0:	83 c0 01             	add    $0x1,%eax
+ 1c3:	39 d8                	cmp    %ebx,%eax
+ 1c5:	74 c3                	je     18a <bufwrite+0x9a>
+    if(*p == (char)c)
+ 1c7:	80 38 0a             	cmpb   $0xa,(%eax)
+ 1ca:	75 f4                	jne    1c0 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 1cc:	85 c9                	test   %ecx,%ecx
+ 1ce:	7e ba                	jle    18a <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 1d0:	83 ec 04             	sub    $0x4,%esp
+ 1d3:	51                   	push   %ecx
+ 1d4:	ff 75 ac             	push   -0x54(%ebp)
+ 1d7:	52                   	push   %edx
+ 1d8:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+ 1db:	e8 cd 05 00 00       	call   7ad <write>
+    ob[fd].n = 0;
+ 1e0:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+ 1e3:	83 c4 10             	add    $0x10,%esp
+ 1e6:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+ 1ec:	c7 82 44 14 00 00 00 	movl   $0x0,0x1444(%edx)
+ 1f3:	00 00 00 
+ 1f6:	eb 92                	jmp    18a <bufwrite+0x9a>
+ 1f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ff:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 200:	83 ec 08             	sub    $0x8,%esp
+ 203:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 206:	50                   	push   %eax
+ 207:	52                   	push   %edx
+ 208:	89 55 b0             	mov    %edx,-0x50(%ebp)
+ 20b:	e8 d7 05 00 00       	call   7e7 <fstat>
+ 210:	83 c4 10             	add    $0x10,%esp
+ 213:	8b 55 b0             	mov    -0x50(%ebp),%edx
+ 216:	89 c1                	mov    %eax,%ecx
+ 218:	b8 02 00 00 00       	mov    $0x2,%eax
+ 21d:	85 c9                	test   %ecx,%ecx
+ 21f:	75 0d                	jne    22e <bufwrite+0x13e>
+ 221:	31 c0                	xor    %eax,%eax
+ 223:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 228:	0f 95 c0             	setne  %al
+ 22b:	83 c0 01             	add    $0x1,%eax
+ 22e:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+ 234:	89 81 40 14 00 00    	mov    %eax,0x1440(%ecx)
+ 23a:	e9 e3 fe ff ff       	jmp    122 <bufwrite+0x32>
+ 23f:	90                   	nop
+}
+ 240:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 243:	5b                   	pop    %ebx
+ 244:	5e                   	pop    %esi
+ 245:	5f                   	pop    %edi
+ 246:	5d                   	pop    %ebp
+    write(fd, p, n);
+ 247:	e9 61 05 00 00       	jmp    7ad <write>
+ 24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+ 250:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+ 253:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+ 256:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+ 259:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+ 25c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+ 25f:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+ 262:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+ 265:	6a 02                	push   $0x2
+ 267:	50                   	push   %eax
+ 268:	52                   	push   %edx
+ 269:	e8 9b 06 00 00       	call   909 <writev>
+    ob[fd].n = 0;
+ 26e:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+ 271:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+ 274:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ 27b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 27e:	5b                   	pop    %ebx
+ 27f:	5e                   	pop    %esi
+ 280:	5f                   	pop    %edi
+ 281:	5d                   	pop    %ebp
+ 282:	c3                   	ret
+ 283:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000290 <fflush>:
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	53                   	push   %ebx
+ 294:	83 ec 04             	sub    $0x4,%esp
+ 297:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 29a:	83 f8 0f             	cmp    $0xf,%eax
+ 29d:	77 16                	ja     2b5 <fflush+0x25>
+ 29f:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+ 2a5:	8b 8a 44 14 00 00    	mov    0x1444(%edx),%ecx
+ 2ab:	8d 9a 40 14 00 00    	lea    0x1440(%edx),%ebx
+ 2b1:	85 c9                	test   %ecx,%ecx
+ 2b3:	7f 0b                	jg     2c0 <fflush+0x30>
+}
+ 2b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2b8:	c9                   	leave
+ 2b9:	c3                   	ret
+ 2ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 2c0:	83 ec 04             	sub    $0x4,%esp
+ 2c3:	81 c2 48 14 00 00    	add    $0x1448,%edx
+ 2c9:	51                   	push   %ecx
+ 2ca:	52                   	push   %edx
+ 2cb:	50                   	push   %eax
+ 2cc:	e8 dc 04 00 00       	call   7ad <write>
+    ob[fd].n = 0;
+ 2d1:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+ 2d8:	83 c4 10             	add    $0x10,%esp
+}
+ 2db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2de:	c9                   	leave
+ 2df:	c3                   	ret
+
+000002e0 <fflushall>:
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 2e4:	31 f6                	xor    %esi,%esi
+{
+ 2e6:	53                   	push   %ebx
+ 2e7:	bb 48 14 00 00       	mov    $0x1448,%ebx
+ 2ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 2f0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 2f3:	85 c0                	test   %eax,%eax
+ 2f5:	7e 15                	jle    30c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 2f7:	83 ec 04             	sub    $0x4,%esp
+ 2fa:	50                   	push   %eax
+ 2fb:	53                   	push   %ebx
+ 2fc:	56                   	push   %esi
+ 2fd:	e8 ab 04 00 00       	call   7ad <write>
+    ob[fd].n = 0;
+ 302:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 309:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 30c:	83 c6 01             	add    $0x1,%esi
+ 30f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 315:	83 fe 10             	cmp    $0x10,%esi
+ 318:	75 d6                	jne    2f0 <fflushall+0x10>
+}
+ 31a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 31d:	5b                   	pop    %ebx
+ 31e:	5e                   	pop    %esi
+ 31f:	5d                   	pop    %ebp
+ 320:	c3                   	ret
+ 321:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 328:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32f:	90                   	nop
+
+00000330 <fork>:
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 334:	31 f6                	xor    %esi,%esi
+{
+ 336:	53                   	push   %ebx
+ 337:	bb 48 14 00 00       	mov    $0x1448,%ebx
+ 33c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 340:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 343:	85 c0                	test   %eax,%eax
+ 345:	7e 15                	jle    35c <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 347:	83 ec 04             	sub    $0x4,%esp
+ 34a:	50                   	push   %eax
+ 34b:	53                   	push   %ebx
+ 34c:	56                   	push   %esi
+ 34d:	e8 5b 04 00 00       	call   7ad <write>
+    ob[fd].n = 0;
+ 352:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 359:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 35c:	83 c6 01             	add    $0x1,%esi
+ 35f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 365:	83 fe 10             	cmp    $0x10,%esi
+ 368:	75 d6                	jne    340 <fork+0x10>
+}
+ 36a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 36d:	5b                   	pop    %ebx
+ 36e:	5e                   	pop    %esi
+ 36f:	5d                   	pop    %ebp
+  return _fork();
+ 370:	e9 15 04 00 00       	jmp    78a <_fork>
+ 375:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000380 <exit>:
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+ 386:	e8 55 ff ff ff       	call   2e0 <fflushall>
+  _exit();
+ 38b:	e8 01 04 00 00       	call   791 <_exit>
+
+00000390 <exec>:
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	57                   	push   %edi
+ 394:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 395:	31 f6                	xor    %esi,%esi
+{
+ 397:	53                   	push   %ebx
+ 398:	bb 48 14 00 00       	mov    $0x1448,%ebx
+ 39d:	83 ec 1c             	sub    $0x1c,%esp
+ 3a0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 3a6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 3a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 3b0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 3b3:	85 c0                	test   %eax,%eax
+ 3b5:	7e 15                	jle    3cc <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 3b7:	83 ec 04             	sub    $0x4,%esp
+ 3ba:	50                   	push   %eax
+ 3bb:	53                   	push   %ebx
+ 3bc:	56                   	push   %esi
+ 3bd:	e8 eb 03 00 00       	call   7ad <write>
+    ob[fd].n = 0;
+ 3c2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 3c9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 3cc:	83 c6 01             	add    $0x1,%esi
+ 3cf:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 3d5:	83 fe 10             	cmp    $0x10,%esi
+ 3d8:	75 d6                	jne    3b0 <exec+0x20>
+  return _exec(path, argv);
+ 3da:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 3dd:	89 7d 0c             	mov    %edi,0xc(%ebp)
+ 3e0:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ 3e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3e6:	5b                   	pop    %ebx
+ 3e7:	5e                   	pop    %esi
+ 3e8:	5f                   	pop    %edi
+ 3e9:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 3ea:	e9 d3 03 00 00       	jmp    7c2 <_exec>
+ 3ef:	90                   	nop
+
+000003f0 <close>:
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	56                   	push   %esi
+ 3f4:	53                   	push   %ebx
+ 3f5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 3f8:	83 fb 0f             	cmp    $0xf,%ebx
+ 3fb:	77 26                	ja     423 <close+0x33>
+ 3fd:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 403:	8b 90 44 14 00 00    	mov    0x1444(%eax),%edx
+ 409:	8d b0 40 14 00 00    	lea    0x1440(%eax),%esi
+ 40f:	85 d2                	test   %edx,%edx
+ 411:	7f 25                	jg     438 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+ 413:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 419:	c7 80 40 14 00 00 00 	movl   $0x0,0x1440(%eax)
+ 420:	00 00 00 
+  return _close(fd);
+ 423:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 426:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 429:	5b                   	pop    %ebx
+ 42a:	5e                   	pop    %esi
+ 42b:	5d                   	pop    %ebp
+  return _close(fd);
+ 42c:	e9 83 03 00 00       	jmp    7b4 <_close>
+ 431:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 438:	83 ec 04             	sub    $0x4,%esp
+ 43b:	05 48 14 00 00       	add    $0x1448,%eax
+ 440:	52                   	push   %edx
+ 441:	50                   	push   %eax
+ 442:	53                   	push   %ebx
+ 443:	e8 65 03 00 00       	call   7ad <write>
+    ob[fd].n = 0;
+ 448:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+ 44f:	83 c4 10             	add    $0x10,%esp
+ 452:	eb bf                	jmp    413 <close+0x23>
+ 454:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 45f:	90                   	nop
+
+00000460 <strcpy>:
+{
+ 460:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+ 461:	31 c0                	xor    %eax,%eax
+{
+ 463:	89 e5                	mov    %esp,%ebp
+ 465:	53                   	push   %ebx
+ 466:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 469:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 46c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 470:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 474:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 477:	83 c0 01             	add    $0x1,%eax
+ 47a:	84 d2                	test   %dl,%dl
+ 47c:	75 f2                	jne    470 <strcpy+0x10>
+}
+ 47e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 481:	89 c8                	mov    %ecx,%eax
+ 483:	c9                   	leave
+ 484:	c3                   	ret
+ 485:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <strcmp>:
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	53                   	push   %ebx
+ 494:	8b 55 08             	mov    0x8(%ebp),%edx
+ 497:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 49a:	0f b6 02             	movzbl (%edx),%eax
+ 49d:	84 c0                	test   %al,%al
+ 49f:	75 17                	jne    4b8 <strcmp+0x28>
+ 4a1:	eb 3a                	jmp    4dd <strcmp+0x4d>
+ 4a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4a7:	90                   	nop
+ 4a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 4ac:	83 c2 01             	add    $0x1,%edx
+ 4af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 4b2:	84 c0                	test   %al,%al
+ 4b4:	74 1a                	je     4d0 <strcmp+0x40>
+    p++, q++;
+ 4b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 4b8:	0f b6 19             	movzbl (%ecx),%ebx
+ 4bb:	38 c3                	cmp    %al,%bl
+ 4bd:	74 e9                	je     4a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 4bf:	29 d8                	sub    %ebx,%eax
+}
+ 4c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4c4:	c9                   	leave
+ 4c5:	c3                   	ret
+ 4c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 4d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 4d4:	31 c0                	xor    %eax,%eax
+ 4d6:	29 d8                	sub    %ebx,%eax
+}
+ 4d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4db:	c9                   	leave
+ 4dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 4dd:	0f b6 19             	movzbl (%ecx),%ebx
+ 4e0:	31 c0                	xor    %eax,%eax
+ 4e2:	eb db                	jmp    4bf <strcmp+0x2f>
+ 4e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4ef:	90                   	nop
+
+000004f0 <strlen>:
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+ 4f6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 4f9:	74 15                	je     510 <strlen+0x20>
+ 4fb:	31 c0                	xor    %eax,%eax
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 500:	83 c0 01             	add    $0x1,%eax
+ 503:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 507:	89 c1                	mov    %eax,%ecx
+ 509:	75 f5                	jne    500 <strlen+0x10>
+}
+ 50b:	89 c8                	mov    %ecx,%eax
+ 50d:	5d                   	pop    %ebp
+ 50e:	c3                   	ret
+ 50f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 510:	31 c9                	xor    %ecx,%ecx
+}
+ 512:	5d                   	pop    %ebp
+ 513:	89 c8                	mov    %ecx,%eax
+ 515:	c3                   	ret
+ 516:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000520 <memset>:
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	57                   	push   %edi
+ 524:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 527:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 52a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 52d:	89 d7                	mov    %edx,%edi
+ 52f:	fc                   	cld
+ 530:	f3 aa                	rep stos %al,%es:(%edi)
+}
+ 532:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 535:	89 d0                	mov    %edx,%eax
+ 537:	c9                   	leave
+ 538:	c3                   	ret
+ 539:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000540 <strchr>:
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	8b 45 08             	mov    0x8(%ebp),%eax
+ 546:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 54a:	0f b6 10             	movzbl (%eax),%edx
+ 54d:	84 d2                	test   %dl,%dl
+ 54f:	75 12                	jne    563 <strchr+0x23>
+ 551:	eb 1d                	jmp    570 <strchr+0x30>
+ 553:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 557:	90                   	nop
+ 558:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 55c:	83 c0 01             	add    $0x1,%eax
+ 55f:	84 d2                	test   %dl,%dl
+ 561:	74 0d                	je     570 <strchr+0x30>
+    if(*s == c)
+ 563:	38 d1                	cmp    %dl,%cl
+ 565:	75 f1                	jne    558 <strchr+0x18>
+}
+ 567:	5d                   	pop    %ebp
+ 568:	c3                   	ret
+ 569:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 570:	31 c0                	xor    %eax,%eax
+}
+ 572:	5d                   	pop    %ebp
+ 573:	c3                   	ret
+ 574:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 57f:	90                   	nop
+
+00000580 <memchr>:
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	8b 55 10             	mov    0x10(%ebp),%edx
+ 586:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 589:	85 d2                	test   %edx,%edx
+ 58b:	74 1b                	je     5a8 <memchr+0x28>
+    if(*p == (char)c)
+ 58d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+ 591:	01 c2                	add    %eax,%edx
+ 593:	eb 0a                	jmp    59f <memchr+0x1f>
+ 595:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+ 598:	83 c0 01             	add    $0x1,%eax
+ 59b:	39 c2                	cmp    %eax,%edx
+ 59d:	74 09                	je     5a8 <memchr+0x28>
+    if(*p == (char)c)
+ 59f:	38 08                	cmp    %cl,(%eax)
+ 5a1:	75 f5                	jne    598 <memchr+0x18>
+}
+ 5a3:	5d                   	pop    %ebp
+ 5a4:	c3                   	ret
+ 5a5:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+ 5a8:	31 c0                	xor    %eax,%eax
+}
+ 5aa:	5d                   	pop    %ebp
+ 5ab:	c3                   	ret
+ 5ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005b0 <gets>:
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+ 5b4:	31 ff                	xor    %edi,%edi
+{
+ 5b6:	56                   	push   %esi
+ 5b7:	be 48 14 00 00       	mov    $0x1448,%esi
+ 5bc:	53                   	push   %ebx
+ 5bd:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 5c0:	8b 46 fc             	mov    -0x4(%esi),%eax
+ 5c3:	85 c0                	test   %eax,%eax
+ 5c5:	7e 15                	jle    5dc <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 5c7:	83 ec 04             	sub    $0x4,%esp
+ 5ca:	50                   	push   %eax
+ 5cb:	56                   	push   %esi
+ 5cc:	57                   	push   %edi
+ 5cd:	e8 db 01 00 00       	call   7ad <write>
+    ob[fd].n = 0;
+ 5d2:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+ 5d9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 5dc:	83 c7 01             	add    $0x1,%edi
+ 5df:	81 c6 08 01 00 00    	add    $0x108,%esi
+ 5e5:	83 ff 10             	cmp    $0x10,%edi
+ 5e8:	75 d6                	jne    5c0 <gets+0x10>
+  for(i=0; i+1 < max; ){
+ 5ea:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+ 5ec:	8d 75 e7             	lea    -0x19(%ebp),%esi
+ 5ef:	eb 2e                	jmp    61f <gets+0x6f>
+ 5f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5f8:	83 ec 04             	sub    $0x4,%esp
+ 5fb:	6a 01                	push   $0x1
+ 5fd:	56                   	push   %esi
+ 5fe:	6a 00                	push   $0x0
+ 600:	e8 a1 01 00 00       	call   7a6 <read>
+    if(cc < 1)
+ 605:	83 c4 10             	add    $0x10,%esp
+ 608:	85 c0                	test   %eax,%eax
+ 60a:	7e 1d                	jle    629 <gets+0x79>
+    buf[i++] = c;
+ 60c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 610:	8b 55 08             	mov    0x8(%ebp),%edx
+ 613:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 617:	3c 0a                	cmp    $0xa,%al
+ 619:	74 10                	je     62b <gets+0x7b>
+ 61b:	3c 0d                	cmp    $0xd,%al
+ 61d:	74 0c                	je     62b <gets+0x7b>
+  for(i=0; i+1 < max; ){
+ 61f:	89 df                	mov    %ebx,%edi
+ 621:	83 c3 01             	add    $0x1,%ebx
+ 624:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 627:	7c cf                	jl     5f8 <gets+0x48>
+ 629:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 62b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 62e:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 632:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 635:	5b                   	pop    %ebx
+ 636:	5e                   	pop    %esi
+ 637:	5f                   	pop    %edi
+ 638:	5d                   	pop    %ebp
+ 639:	c3                   	ret
+ 63a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000640 <stat>:
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	57                   	push   %edi
+ 644:	56                   	push   %esi
+ 645:	53                   	push   %ebx
+ 646:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+ 649:	6a 00                	push   $0x0
+ 64b:	ff 75 08             	push   0x8(%ebp)
+ 64e:	e8 76 01 00 00       	call   7c9 <open>
+  if(fd < 0)
+ 653:	83 c4 10             	add    $0x10,%esp
+ 656:	85 c0                	test   %eax,%eax
+ 658:	78 76                	js     6d0 <stat+0x90>
+  r = fstat(fd, st);
+ 65a:	83 ec 08             	sub    $0x8,%esp
+ 65d:	ff 75 0c             	push   0xc(%ebp)
+ 660:	89 c3                	mov    %eax,%ebx
+ 662:	50                   	push   %eax
+ 663:	e8 7f 01 00 00       	call   7e7 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 668:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 66b:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 66d:	83 fb 0f             	cmp    $0xf,%ebx
+ 670:	7f 40                	jg     6b2 <stat+0x72>
+ 672:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 678:	8b 90 44 14 00 00    	mov    0x1444(%eax),%edx
+ 67e:	8d b8 40 14 00 00    	lea    0x1440(%eax),%edi
+ 684:	85 d2                	test   %edx,%edx
+ 686:	7e 1a                	jle    6a2 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 688:	83 ec 04             	sub    $0x4,%esp
+ 68b:	05 48 14 00 00       	add    $0x1448,%eax
+ 690:	52                   	push   %edx
+ 691:	50                   	push   %eax
+ 692:	53                   	push   %ebx
+ 693:	e8 15 01 00 00       	call   7ad <write>
+    ob[fd].n = 0;
+ 698:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+ 69f:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+ 6a2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 6a8:	c7 80 40 14 00 00 00 	movl   $0x0,0x1440(%eax)
+ 6af:	00 00 00 
+  return _close(fd);
+ 6b2:	83 ec 0c             	sub    $0xc,%esp
+ 6b5:	53                   	push   %ebx
+ 6b6:	e8 f9 00 00 00       	call   7b4 <_close>
+ 6bb:	83 c4 10             	add    $0x10,%esp
+}
+ 6be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6c1:	89 f0                	mov    %esi,%eax
+ 6c3:	5b                   	pop    %ebx
+ 6c4:	5e                   	pop    %esi
+ 6c5:	5f                   	pop    %edi
+ 6c6:	5d                   	pop    %ebp
+ 6c7:	c3                   	ret
+ 6c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6cf:	90                   	nop
+    return -1;
+ 6d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 6d5:	eb e7                	jmp    6be <stat+0x7e>
+ 6d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6de:	66 90                	xchg   %ax,%ax
+
+000006e0 <atoi>:
+{
+ 6e0:	55                   	push   %ebp
+ 6e1:	89 e5                	mov    %esp,%ebp
+ 6e3:	53                   	push   %ebx
+ 6e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 6e7:	0f be 02             	movsbl (%edx),%eax
+ 6ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 6ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 6f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 6f5:	77 1e                	ja     715 <atoi+0x35>
+ 6f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 700:	83 c2 01             	add    $0x1,%edx
+ 703:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 706:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 70a:	0f be 02             	movsbl (%edx),%eax
+ 70d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 710:	80 fb 09             	cmp    $0x9,%bl
+ 713:	76 eb                	jbe    700 <atoi+0x20>
+}
+ 715:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 718:	89 c8                	mov    %ecx,%eax
+ 71a:	c9                   	leave
+ 71b:	c3                   	ret
+ 71c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000720 <memmove>:
+{
+ 720:	55                   	push   %ebp
+ 721:	89 e5                	mov    %esp,%ebp
+ 723:	57                   	push   %edi
+ 724:	56                   	push   %esi
+ 725:	8b 45 10             	mov    0x10(%ebp),%eax
+ 728:	8b 55 08             	mov    0x8(%ebp),%edx
+ 72b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 72e:	85 c0                	test   %eax,%eax
+ 730:	7e 13                	jle    745 <memmove+0x25>
+ 732:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 734:	89 d7                	mov    %edx,%edi
+ 736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 740:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 741:	39 f8                	cmp    %edi,%eax
+ 743:	75 fb                	jne    740 <memmove+0x20>
+  return vdst;
+}
+ 745:	5e                   	pop    %esi
+ 746:	89 d0                	mov    %edx,%eax
+ 748:	5f                   	pop    %edi
+ 749:	5d                   	pop    %ebp
+ 74a:	c3                   	ret
+
+0000074b <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+ 74b:	83 3d 20 14 00 00 00 	cmpl   $0x0,0x1420
+  jle 1f
+ 752:	7e 0a                	jle    75e <syscallentry+0x13>
+  movl %esp, %ecx
+ 754:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 756:	ba 5d 07 00 00       	mov    $0x75d,%edx
+  sysenter
+ 75b:	0f 34                	sysenter
+2:
+  ret
+ 75d:	c3                   	ret
+1:
+  jl 3f
+ 75e:	7c 27                	jl     787 <syscallentry+0x3c>
+  pushal
+ 760:	60                   	pusha
+  movl $1, %eax
+ 761:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 766:	0f a2                	cpuid
+  movl $-1, sysentermode
+ 768:	c7 05 20 14 00 00 ff 	movl   $0xffffffff,0x1420
+ 76f:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 772:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+ 778:	74 0a                	je     784 <syscallentry+0x39>
+  movl $1, sysentermode
+ 77a:	c7 05 20 14 00 00 01 	movl   $0x1,0x1420
+ 781:	00 00 00 
+4:
+  popal
+ 784:	61                   	popa
+  jmp syscallentry
+ 785:	eb c4                	jmp    74b <syscallentry>
+3:
+  int $T_SYSCALL
+ 787:	cd 40                	int    $0x40
+  ret
+ 789:	c3                   	ret
+
+0000078a <_fork>:
+
+SYSCALLAS(_fork, fork)
+ 78a:	b8 01 00 00 00       	mov    $0x1,%eax
+ 78f:	eb ba                	jmp    74b <syscallentry>
+
+00000791 <_exit>:
+SYSCALLAS(_exit, exit)
+ 791:	b8 02 00 00 00       	mov    $0x2,%eax
+ 796:	eb b3                	jmp    74b <syscallentry>
+
+00000798 <wait>:
+SYSCALL(wait)
+ 798:	b8 03 00 00 00       	mov    $0x3,%eax
+ 79d:	eb ac                	jmp    74b <syscallentry>
+
+0000079f <pipe>:
+SYSCALL(pipe)
+ 79f:	b8 04 00 00 00       	mov    $0x4,%eax
+ 7a4:	eb a5                	jmp    74b <syscallentry>
+
+000007a6 <read>:
+SYSCALL(read)
+ 7a6:	b8 05 00 00 00       	mov    $0x5,%eax
+ 7ab:	eb 9e                	jmp    74b <syscallentry>
+
+000007ad <write>:
+SYSCALL(write)
+ 7ad:	b8 10 00 00 00       	mov    $0x10,%eax
+ 7b2:	eb 97                	jmp    74b <syscallentry>
+
+000007b4 <_close>:
+SYSCALLAS(_close, close)
+ 7b4:	b8 15 00 00 00       	mov    $0x15,%eax
+ 7b9:	eb 90                	jmp    74b <syscallentry>
+
+000007bb <kill>:
+SYSCALL(kill)
+ 7bb:	b8 06 00 00 00       	mov    $0x6,%eax
+ 7c0:	eb 89                	jmp    74b <syscallentry>
+
+000007c2 <_exec>:
+SYSCALLAS(_exec, exec)
+ 7c2:	b8 07 00 00 00       	mov    $0x7,%eax
+ 7c7:	eb 82                	jmp    74b <syscallentry>
+
+000007c9 <open>:
+SYSCALL(open)
+ 7c9:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 7ce:	e9 78 ff ff ff       	jmp    74b <syscallentry>
+
+000007d3 <mknod>:
+SYSCALL(mknod)
+ 7d3:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7d8:	e9 6e ff ff ff       	jmp    74b <syscallentry>
+
+000007dd <unlink>:
+SYSCALL(unlink)
+ 7dd:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7e2:	e9 64 ff ff ff       	jmp    74b <syscallentry>
+
+000007e7 <fstat>:
+SYSCALL(fstat)
+ 7e7:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7ec:	e9 5a ff ff ff       	jmp    74b <syscallentry>
+
+000007f1 <link>:
+SYSCALL(link)
+ 7f1:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7f6:	e9 50 ff ff ff       	jmp    74b <syscallentry>
+
+000007fb <mkdir>:
+SYSCALL(mkdir)
+ 7fb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 800:	e9 46 ff ff ff       	jmp    74b <syscallentry>
+
+00000805 <chdir>:
+SYSCALL(chdir)
+ 805:	b8 09 00 00 00       	mov    $0x9,%eax
+ 80a:	e9 3c ff ff ff       	jmp    74b <syscallentry>
+
+0000080f <dup>:
+SYSCALL(dup)
+ 80f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 814:	e9 32 ff ff ff       	jmp    74b <syscallentry>
+
+00000819 <getpid>:
+SYSCALL(getpid)
+ 819:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 81e:	e9 28 ff ff ff       	jmp    74b <syscallentry>
+
+00000823 <sbrk>:
+SYSCALL(sbrk)
+ 823:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 828:	e9 1e ff ff ff       	jmp    74b <syscallentry>
+
+0000082d <sleep>:
+SYSCALL(sleep)
+ 82d:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 832:	e9 14 ff ff ff       	jmp    74b <syscallentry>
+
+00000837 <uptime>:
+SYSCALL(uptime)
+ 837:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 83c:	e9 0a ff ff ff       	jmp    74b <syscallentry>
+
+00000841 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+ 841:	b8 16 00 00 00       	mov    $0x16,%eax
+ 846:	e9 00 ff ff ff       	jmp    74b <syscallentry>
+
+0000084b <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+ 84b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 850:	e9 f6 fe ff ff       	jmp    74b <syscallentry>
+
+00000855 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+ 855:	b8 18 00 00 00       	mov    $0x18,%eax
+ 85a:	e9 ec fe ff ff       	jmp    74b <syscallentry>
+
+0000085f <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+ 85f:	b8 19 00 00 00       	mov    $0x19,%eax
+ 864:	e9 e2 fe ff ff       	jmp    74b <syscallentry>
+
+00000869 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+ 869:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 86e:	e9 d8 fe ff ff       	jmp    74b <syscallentry>
+
+00000873 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+ 873:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 878:	e9 ce fe ff ff       	jmp    74b <syscallentry>
+
+0000087d <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+ 87d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 882:	e9 c4 fe ff ff       	jmp    74b <syscallentry>
+
+00000887 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+ 887:	b8 20 00 00 00       	mov    $0x20,%eax
+ 88c:	e9 ba fe ff ff       	jmp    74b <syscallentry>
+
+00000891 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+ 891:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 896:	e9 b0 fe ff ff       	jmp    74b <syscallentry>
+
+0000089b <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+ 89b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 8a0:	e9 a6 fe ff ff       	jmp    74b <syscallentry>
+
+000008a5 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+ 8a5:	b8 21 00 00 00       	mov    $0x21,%eax
+ 8aa:	e9 9c fe ff ff       	jmp    74b <syscallentry>
+
+000008af <yield>:
+SYSCALL(yield) // yield the CPU to another process
+ 8af:	b8 22 00 00 00       	mov    $0x22,%eax
+ 8b4:	e9 92 fe ff ff       	jmp    74b <syscallentry>
+
+000008b9 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+ 8b9:	b8 23 00 00 00       	mov    $0x23,%eax
+ 8be:	e9 88 fe ff ff       	jmp    74b <syscallentry>
+
+000008c3 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+ 8c3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 8c8:	e9 7e fe ff ff       	jmp    74b <syscallentry>
+
+000008cd <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+ 8cd:	b8 25 00 00 00       	mov    $0x25,%eax
+ 8d2:	e9 74 fe ff ff       	jmp    74b <syscallentry>
+
+000008d7 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+ 8d7:	b8 26 00 00 00       	mov    $0x26,%eax
+ 8dc:	e9 6a fe ff ff       	jmp    74b <syscallentry>
+
+000008e1 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+ 8e1:	b8 27 00 00 00       	mov    $0x27,%eax
+ 8e6:	e9 60 fe ff ff       	jmp    74b <syscallentry>
+
+000008eb <mmap>:
+SYSCALL(mmap) // map a file into memory
+ 8eb:	b8 28 00 00 00       	mov    $0x28,%eax
+ 8f0:	e9 56 fe ff ff       	jmp    74b <syscallentry>
+
+000008f5 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+ 8f5:	b8 29 00 00 00       	mov    $0x29,%eax
+ 8fa:	e9 4c fe ff ff       	jmp    74b <syscallentry>
+
+000008ff <readv>:
+SYSCALL(readv) // read into several buffers
+ 8ff:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 904:	e9 42 fe ff ff       	jmp    74b <syscallentry>
+
+00000909 <writev>:
+SYSCALL(writev) // write from several buffers
+ 909:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 90e:	e9 38 fe ff ff       	jmp    74b <syscallentry>
+
+00000913 <pread>:
+SYSCALL(pread) // read at an offset
+ 913:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 918:	e9 2e fe ff ff       	jmp    74b <syscallentry>
+
+0000091d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+ 91d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 922:	e9 24 fe ff ff       	jmp    74b <syscallentry>
+
+00000927 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+ 927:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 92c:	e9 1a fe ff ff       	jmp    74b <syscallentry>
+
+00000931 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+ 931:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 936:	e9 10 fe ff ff       	jmp    74b <syscallentry>
+
+0000093b <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+ 93b:	b8 30 00 00 00       	mov    $0x30,%eax
+ 940:	e9 06 fe ff ff       	jmp    74b <syscallentry>
+
+00000945 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+ 945:	b8 31 00 00 00       	mov    $0x31,%eax
+ 94a:	e9 fc fd ff ff       	jmp    74b <syscallentry>
+
+0000094f <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+ 94f:	b8 32 00 00 00       	mov    $0x32,%eax
+ 954:	e9 f2 fd ff ff       	jmp    74b <syscallentry>
+
+00000959 <profread>:
+SYSCALL(profread) // drain profiler samples
+ 959:	b8 33 00 00 00       	mov    $0x33,%eax
+ 95e:	e9 e8 fd ff ff       	jmp    74b <syscallentry>
+
+00000963 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+ 963:	b8 34 00 00 00       	mov    $0x34,%eax
+ 968:	e9 de fd ff ff       	jmp    74b <syscallentry>
+
+0000096d <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+ 96d:	b8 35 00 00 00       	mov    $0x35,%eax
+ 972:	e9 d4 fd ff ff       	jmp    74b <syscallentry>
+
+00000977 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+ 977:	b8 36 00 00 00       	mov    $0x36,%eax
+ 97c:	e9 ca fd ff ff       	jmp    74b <syscallentry>
+
+00000981 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+ 981:	b8 37 00 00 00       	mov    $0x37,%eax
+ 986:	e9 c0 fd ff ff       	jmp    74b <syscallentry>
+ 98b:	66 90                	xchg   %ax,%ax
+ 98d:	66 90                	xchg   %ax,%ax
+ 98f:	90                   	nop
+
+00000990 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 990:	55                   	push   %ebp
+ 991:	89 e5                	mov    %esp,%ebp
+ 993:	57                   	push   %edi
+ 994:	56                   	push   %esi
+ 995:	53                   	push   %ebx
+ 996:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 998:	89 d1                	mov    %edx,%ecx
+{
+ 99a:	83 ec 3c             	sub    $0x3c,%esp
+ 99d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 9a0:	85 d2                	test   %edx,%edx
+ 9a2:	0f 89 80 00 00 00    	jns    a28 <printint+0x98>
+ 9a8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 9ac:	74 7a                	je     a28 <printint+0x98>
+    x = -xx;
+ 9ae:	f7 d9                	neg    %ecx
+    neg = 1;
+ 9b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 9b5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 9b8:	31 f6                	xor    %esi,%esi
+ 9ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 9c0:	89 c8                	mov    %ecx,%eax
+ 9c2:	31 d2                	xor    %edx,%edx
+ 9c4:	89 f7                	mov    %esi,%edi
+ 9c6:	f7 f3                	div    %ebx
+ 9c8:	8d 76 01             	lea    0x1(%esi),%esi
+ 9cb:	0f b6 92 90 0f 00 00 	movzbl 0xf90(%edx),%edx
+ 9d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 9d6:	89 ca                	mov    %ecx,%edx
+ 9d8:	89 c1                	mov    %eax,%ecx
+ 9da:	39 da                	cmp    %ebx,%edx
+ 9dc:	73 e2                	jae    9c0 <printint+0x30>
+  if(neg)
+ 9de:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 9e1:	85 c0                	test   %eax,%eax
+ 9e3:	74 07                	je     9ec <printint+0x5c>
+    buf[i++] = '-';
+ 9e5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 9ea:	89 f7                	mov    %esi,%edi
+ 9ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 9ef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 9f2:	01 df                	add    %ebx,%edi
+ 9f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 9f8:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+ 9fb:	83 ec 04             	sub    $0x4,%esp
+ 9fe:	88 45 d7             	mov    %al,-0x29(%ebp)
+ a01:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ a04:	6a 01                	push   $0x1
+ a06:	50                   	push   %eax
+ a07:	56                   	push   %esi
+ a08:	e8 e3 f6 ff ff       	call   f0 <bufwrite>
+  while(--i >= 0)
+ a0d:	89 f8                	mov    %edi,%eax
+ a0f:	83 c4 10             	add    $0x10,%esp
+ a12:	83 ef 01             	sub    $0x1,%edi
+ a15:	39 d8                	cmp    %ebx,%eax
+ a17:	75 df                	jne    9f8 <printint+0x68>
+}
+ a19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a1c:	5b                   	pop    %ebx
+ a1d:	5e                   	pop    %esi
+ a1e:	5f                   	pop    %edi
+ a1f:	5d                   	pop    %ebp
+ a20:	c3                   	ret
+ a21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ a28:	31 c0                	xor    %eax,%eax
+ a2a:	eb 89                	jmp    9b5 <printint+0x25>
+ a2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a30 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ a30:	55                   	push   %ebp
+ a31:	89 e5                	mov    %esp,%ebp
+ a33:	57                   	push   %edi
+ a34:	56                   	push   %esi
+ a35:	53                   	push   %ebx
+ a36:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ a39:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a3c:	0f b6 18             	movzbl (%eax),%ebx
+ a3f:	84 db                	test   %bl,%bl
+ a41:	74 6c                	je     aaf <printf+0x7f>
+ a43:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+ a46:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ a49:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ a4b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ a4e:	eb 26                	jmp    a76 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ a50:	83 f8 25             	cmp    $0x25,%eax
+ a53:	74 4b                	je     aa0 <printf+0x70>
+  bufwrite(fd, &c, 1);
+ a55:	83 ec 04             	sub    $0x4,%esp
+ a58:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ a5b:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ a5e:	6a 01                	push   $0x1
+ a60:	50                   	push   %eax
+ a61:	ff 75 08             	push   0x8(%ebp)
+ a64:	e8 87 f6 ff ff       	call   f0 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+ a69:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ a6c:	0f b6 1f             	movzbl (%edi),%ebx
+ a6f:	83 c7 01             	add    $0x1,%edi
+ a72:	84 db                	test   %bl,%bl
+ a74:	74 39                	je     aaf <printf+0x7f>
+    c = fmt[i] & 0xff;
+ a76:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ a79:	85 f6                	test   %esi,%esi
+ a7b:	74 d3                	je     a50 <printf+0x20>
+      }
+    } else if(state == '%'){
+ a7d:	83 fe 25             	cmp    $0x25,%esi
+ a80:	75 ea                	jne    a6c <printf+0x3c>
+      if(c == 'd'){
+ a82:	83 f8 25             	cmp    $0x25,%eax
+ a85:	0f 84 d5 01 00 00    	je     c60 <printf+0x230>
+ a8b:	83 e8 63             	sub    $0x63,%eax
+ a8e:	83 f8 15             	cmp    $0x15,%eax
+ a91:	77 45                	ja     ad8 <printf+0xa8>
+ a93:	ff 24 85 38 0f 00 00 	jmp    *0xf38(,%eax,4)
+ a9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+ aa0:	0f b6 1f             	movzbl (%edi),%ebx
+ aa3:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+ aa6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ aab:	84 db                	test   %bl,%bl
+ aad:	75 c7                	jne    a76 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+ aaf:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+ ab3:	74 0b                	je     ac0 <printf+0x90>
+    fflush(fd);
+}
+ ab5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ab8:	5b                   	pop    %ebx
+ ab9:	5e                   	pop    %esi
+ aba:	5f                   	pop    %edi
+ abb:	5d                   	pop    %ebp
+ abc:	c3                   	ret
+ abd:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+ ac0:	83 ec 0c             	sub    $0xc,%esp
+ ac3:	6a 02                	push   $0x2
+ ac5:	e8 c6 f7 ff ff       	call   290 <fflush>
+ aca:	83 c4 10             	add    $0x10,%esp
+}
+ acd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ad0:	5b                   	pop    %ebx
+ ad1:	5e                   	pop    %esi
+ ad2:	5f                   	pop    %edi
+ ad3:	5d                   	pop    %ebp
+ ad4:	c3                   	ret
+ ad5:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+ ad8:	83 ec 04             	sub    $0x4,%esp
+ adb:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ ade:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+ ae2:	6a 01                	push   $0x1
+ ae4:	52                   	push   %edx
+ ae5:	89 55 c0             	mov    %edx,-0x40(%ebp)
+ ae8:	ff 75 08             	push   0x8(%ebp)
+ aeb:	e8 00 f6 ff ff       	call   f0 <bufwrite>
+ af0:	83 c4 0c             	add    $0xc,%esp
+ af3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ af6:	6a 01                	push   $0x1
+ af8:	8b 55 c0             	mov    -0x40(%ebp),%edx
+ afb:	52                   	push   %edx
+      state = 0;
+ afc:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+ afe:	ff 75 08             	push   0x8(%ebp)
+ b01:	e8 ea f5 ff ff       	call   f0 <bufwrite>
+        putc(fd, c);
+ b06:	83 c4 10             	add    $0x10,%esp
+ b09:	e9 5e ff ff ff       	jmp    a6c <printf+0x3c>
+ b0e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+ b10:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ b13:	83 ec 0c             	sub    $0xc,%esp
+ b16:	b9 10 00 00 00       	mov    $0x10,%ecx
+ b1b:	8b 16                	mov    (%esi),%edx
+ b1d:	6a 00                	push   $0x0
+ b1f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+ b22:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+ b25:	e8 66 fe ff ff       	call   990 <printint>
+        ap++;
+ b2a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ b2d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b30:	31 f6                	xor    %esi,%esi
+ b32:	e9 35 ff ff ff       	jmp    a6c <printf+0x3c>
+ b37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b3e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+ b40:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ b43:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ b45:	83 c0 04             	add    $0x4,%eax
+ b48:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+ b4b:	b8 30 0f 00 00       	mov    $0xf30,%eax
+ b50:	85 db                	test   %ebx,%ebx
+ b52:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+ b55:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+ b58:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+ b5a:	53                   	push   %ebx
+ b5b:	e8 90 f9 ff ff       	call   4f0 <strlen>
+ b60:	83 c4 0c             	add    $0xc,%esp
+ b63:	50                   	push   %eax
+ b64:	53                   	push   %ebx
+ b65:	ff 75 08             	push   0x8(%ebp)
+ b68:	e8 83 f5 ff ff       	call   f0 <bufwrite>
+ b6d:	83 c4 10             	add    $0x10,%esp
+ b70:	e9 f7 fe ff ff       	jmp    a6c <printf+0x3c>
+ b75:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ b78:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+ b7b:	83 ec 04             	sub    $0x4,%esp
+ b7e:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+ b81:	8b 06                	mov    (%esi),%eax
+        ap++;
+ b83:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+ b86:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+ b89:	6a 01                	push   $0x1
+ b8b:	52                   	push   %edx
+ b8c:	ff 75 08             	push   0x8(%ebp)
+ b8f:	e8 5c f5 ff ff       	call   f0 <bufwrite>
+        ap++;
+ b94:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ b97:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b9a:	31 f6                	xor    %esi,%esi
+ b9c:	e9 cb fe ff ff       	jmp    a6c <printf+0x3c>
+ ba1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+ ba8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ bab:	83 ec 0c             	sub    $0xc,%esp
+ bae:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ bb3:	8b 16                	mov    (%esi),%edx
+ bb5:	6a 01                	push   $0x1
+ bb7:	e9 63 ff ff ff       	jmp    b1f <printf+0xef>
+ bbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+ bc0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ bc3:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ bc6:	89 7d c0             	mov    %edi,-0x40(%ebp)
+ bc9:	89 55 bc             	mov    %edx,-0x44(%ebp)
+ bcc:	8b 18                	mov    (%eax),%ebx
+ bce:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+ bd1:	31 c0                	xor    %eax,%eax
+ bd3:	89 c7                	mov    %eax,%edi
+ bd5:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+ bd8:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+ bdd:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+ bdf:	f7 e1                	mul    %ecx
+ be1:	c1 ea 03             	shr    $0x3,%edx
+ be4:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ be7:	89 d1                	mov    %edx,%ecx
+ be9:	01 c0                	add    %eax,%eax
+ beb:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ bed:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+ bef:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ bf1:	be 0a 00 00 00       	mov    $0xa,%esi
+ bf6:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+ bf8:	89 da                	mov    %ebx,%edx
+ bfa:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+ bfc:	89 fe                	mov    %edi,%esi
+ bfe:	83 c7 01             	add    $0x1,%edi
+ c01:	8d 42 30             	lea    0x30(%edx),%eax
+ c04:	89 da                	mov    %ebx,%edx
+ c06:	8d 14 92             	lea    (%edx,%edx,4),%edx
+ c09:	01 d2                	add    %edx,%edx
+ c0b:	29 d0                	sub    %edx,%eax
+ c0d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+ c11:	89 c8                	mov    %ecx,%eax
+ c13:	09 d8                	or     %ebx,%eax
+ c15:	75 c1                	jne    bd8 <printf+0x1a8>
+ c17:	8b 55 bc             	mov    -0x44(%ebp),%edx
+ c1a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ c1d:	01 d6                	add    %edx,%esi
+ c1f:	89 f7                	mov    %esi,%edi
+ c21:	89 d6                	mov    %edx,%esi
+ c23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c27:	90                   	nop
+    putc(fd, buf[i]);
+ c28:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+ c2b:	83 ec 04             	sub    $0x4,%esp
+ c2e:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+ c31:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+ c34:	6a 01                	push   $0x1
+ c36:	50                   	push   %eax
+ c37:	53                   	push   %ebx
+ c38:	e8 b3 f4 ff ff       	call   f0 <bufwrite>
+  while(--i >= 0)
+ c3d:	89 fa                	mov    %edi,%edx
+ c3f:	83 c4 10             	add    $0x10,%esp
+ c42:	83 ef 01             	sub    $0x1,%edi
+ c45:	39 d6                	cmp    %edx,%esi
+ c47:	75 df                	jne    c28 <printf+0x1f8>
+        ap += 2;
+ c49:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+ c4d:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+ c50:	31 f6                	xor    %esi,%esi
+ c52:	e9 15 fe ff ff       	jmp    a6c <printf+0x3c>
+ c57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c5e:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+ c60:	83 ec 04             	sub    $0x4,%esp
+ c63:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ c66:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ c69:	6a 01                	push   $0x1
+ c6b:	e9 8b fe ff ff       	jmp    afb <printf+0xcb>
+
+00000c70 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ c70:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c71:	a1 c0 24 00 00       	mov    0x24c0,%eax
+{
+ c76:	89 e5                	mov    %esp,%ebp
+ c78:	57                   	push   %edi
+ c79:	56                   	push   %esi
+ c7a:	53                   	push   %ebx
+ c7b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ c7e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c88:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c8a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c8c:	39 ca                	cmp    %ecx,%edx
+ c8e:	73 30                	jae    cc0 <free+0x50>
+ c90:	39 c1                	cmp    %eax,%ecx
+ c92:	72 04                	jb     c98 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c94:	39 c2                	cmp    %eax,%edx
+ c96:	72 f0                	jb     c88 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ c98:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ c9b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ c9e:	39 f8                	cmp    %edi,%eax
+ ca0:	74 2e                	je     cd0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ca2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ ca5:	8b 42 04             	mov    0x4(%edx),%eax
+ ca8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ cab:	39 f1                	cmp    %esi,%ecx
+ cad:	74 38                	je     ce7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ caf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ cb1:	5b                   	pop    %ebx
+  freep = p;
+ cb2:	89 15 c0 24 00 00    	mov    %edx,0x24c0
+}
+ cb8:	5e                   	pop    %esi
+ cb9:	5f                   	pop    %edi
+ cba:	5d                   	pop    %ebp
+ cbb:	c3                   	ret
+ cbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cc0:	39 c1                	cmp    %eax,%ecx
+ cc2:	72 d0                	jb     c94 <free+0x24>
+ cc4:	eb c2                	jmp    c88 <free+0x18>
+ cc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ccd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ cd0:	03 70 04             	add    0x4(%eax),%esi
+ cd3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ cd6:	8b 02                	mov    (%edx),%eax
+ cd8:	8b 00                	mov    (%eax),%eax
+ cda:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ cdd:	8b 42 04             	mov    0x4(%edx),%eax
+ ce0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ ce3:	39 f1                	cmp    %esi,%ecx
+ ce5:	75 c8                	jne    caf <free+0x3f>
+    p->s.size += bp->s.size;
+ ce7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ cea:	89 15 c0 24 00 00    	mov    %edx,0x24c0
+    p->s.size += bp->s.size;
+ cf0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ cf3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ cf6:	89 0a                	mov    %ecx,(%edx)
+}
+ cf8:	5b                   	pop    %ebx
+ cf9:	5e                   	pop    %esi
+ cfa:	5f                   	pop    %edi
+ cfb:	5d                   	pop    %ebp
+ cfc:	c3                   	ret
+ cfd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d00 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ d00:	55                   	push   %ebp
+ d01:	89 e5                	mov    %esp,%ebp
+ d03:	57                   	push   %edi
+ d04:	56                   	push   %esi
+ d05:	53                   	push   %ebx
+ d06:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d09:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ d0c:	8b 15 c0 24 00 00    	mov    0x24c0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d12:	8d 78 07             	lea    0x7(%eax),%edi
+ d15:	c1 ef 03             	shr    $0x3,%edi
+ d18:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ d1b:	85 d2                	test   %edx,%edx
+ d1d:	0f 84 8d 00 00 00    	je     db0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d23:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d25:	8b 48 04             	mov    0x4(%eax),%ecx
+ d28:	39 f9                	cmp    %edi,%ecx
+ d2a:	73 64                	jae    d90 <malloc+0x90>
+  if(nu < 4096)
+ d2c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ d31:	39 df                	cmp    %ebx,%edi
+ d33:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ d36:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ d3d:	eb 0a                	jmp    d49 <malloc+0x49>
+ d3f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d40:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d42:	8b 48 04             	mov    0x4(%eax),%ecx
+ d45:	39 f9                	cmp    %edi,%ecx
+ d47:	73 47                	jae    d90 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ d49:	89 c2                	mov    %eax,%edx
+ d4b:	39 05 c0 24 00 00    	cmp    %eax,0x24c0
+ d51:	75 ed                	jne    d40 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ d53:	83 ec 0c             	sub    $0xc,%esp
+ d56:	56                   	push   %esi
+ d57:	e8 c7 fa ff ff       	call   823 <sbrk>
+  if(p == (char*)-1)
+ d5c:	83 c4 10             	add    $0x10,%esp
+ d5f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ d62:	74 1c                	je     d80 <malloc+0x80>
+  hp->s.size = nu;
+ d64:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ d67:	83 ec 0c             	sub    $0xc,%esp
+ d6a:	83 c0 08             	add    $0x8,%eax
+ d6d:	50                   	push   %eax
+ d6e:	e8 fd fe ff ff       	call   c70 <free>
+  return freep;
+ d73:	8b 15 c0 24 00 00    	mov    0x24c0,%edx
+      if((p = morecore(nunits)) == 0)
+ d79:	83 c4 10             	add    $0x10,%esp
+ d7c:	85 d2                	test   %edx,%edx
+ d7e:	75 c0                	jne    d40 <malloc+0x40>
+        return 0;
+  }
+}
+ d80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ d83:	31 c0                	xor    %eax,%eax
+}
+ d85:	5b                   	pop    %ebx
+ d86:	5e                   	pop    %esi
+ d87:	5f                   	pop    %edi
+ d88:	5d                   	pop    %ebp
+ d89:	c3                   	ret
+ d8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ d90:	39 cf                	cmp    %ecx,%edi
+ d92:	74 4c                	je     de0 <malloc+0xe0>
+        p->s.size -= nunits;
+ d94:	29 f9                	sub    %edi,%ecx
+ d96:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ d99:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ d9c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ d9f:	89 15 c0 24 00 00    	mov    %edx,0x24c0
+}
+ da5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ da8:	83 c0 08             	add    $0x8,%eax
+}
+ dab:	5b                   	pop    %ebx
+ dac:	5e                   	pop    %esi
+ dad:	5f                   	pop    %edi
+ dae:	5d                   	pop    %ebp
+ daf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ db0:	c7 05 c0 24 00 00 c4 	movl   $0x24c4,0x24c0
+ db7:	24 00 00 
+    base.s.size = 0;
+ dba:	b8 c4 24 00 00       	mov    $0x24c4,%eax
+    base.s.ptr = freep = prevp = &base;
+ dbf:	c7 05 c4 24 00 00 c4 	movl   $0x24c4,0x24c4
+ dc6:	24 00 00 
+    base.s.size = 0;
+ dc9:	c7 05 c8 24 00 00 00 	movl   $0x0,0x24c8
+ dd0:	00 00 00 
+    if(p->s.size >= nunits){
+ dd3:	e9 54 ff ff ff       	jmp    d2c <malloc+0x2c>
+ dd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ddf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ de0:	8b 08                	mov    (%eax),%ecx
+ de2:	89 0a                	mov    %ecx,(%edx)
+ de4:	eb b9                	jmp    d9f <malloc+0x9f>
+ de6:	66 90                	xchg   %ax,%ax
+ de8:	66 90                	xchg   %ax,%ax
+ dea:	66 90                	xchg   %ax,%ax
+ dec:	66 90                	xchg   %ax,%ax
+ dee:	66 90                	xchg   %ax,%ax
+
+00000df0 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+ df0:	55                   	push   %ebp
+ df1:	89 e5                	mov    %esp,%ebp
+ df3:	57                   	push   %edi
+ df4:	56                   	push   %esi
+ df5:	be 01 00 00 00       	mov    $0x1,%esi
+ dfa:	53                   	push   %ebx
+ dfb:	83 ec 28             	sub    $0x28,%esp
+ dfe:	8b 45 0c             	mov    0xc(%ebp),%eax
+ e01:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ e04:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+ e07:	68 00 98 00 00       	push   $0x9800
+ e0c:	e8 ef fe ff ff       	call   d00 <malloc>
+ e11:	83 c4 10             	add    $0x10,%esp
+ e14:	89 c7                	mov    %eax,%edi
+ e16:	85 c0                	test   %eax,%eax
+ e18:	74 62                	je     e7c <waitpoll+0x8c>
+ e1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+ e20:	83 ec 0c             	sub    $0xc,%esp
+ e23:	6a 01                	push   $0x1
+ e25:	e8 03 fa ff ff       	call   82d <sleep>
+    fn();
+ e2a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ e2d:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+ e2f:	58                   	pop    %eax
+ e30:	5a                   	pop    %edx
+ e31:	68 00 02 00 00       	push   $0x200
+ e36:	57                   	push   %edi
+ e37:	e8 eb fa ff ff       	call   927 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+ e3c:	83 c4 10             	add    $0x10,%esp
+ e3f:	85 c0                	test   %eax,%eax
+ e41:	7e 2d                	jle    e70 <waitpoll+0x80>
+ e43:	6b c0 4c             	imul   $0x4c,%eax,%eax
+ e46:	89 fa                	mov    %edi,%edx
+    alive = 0;
+ e48:	31 c9                	xor    %ecx,%ecx
+ e4a:	01 f8                	add    %edi,%eax
+ e4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+ e50:	3b 1a                	cmp    (%edx),%ebx
+ e52:	75 07                	jne    e5b <waitpoll+0x6b>
+        alive = 1;
+ e54:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+ e58:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+ e5b:	83 c2 4c             	add    $0x4c,%edx
+ e5e:	39 d0                	cmp    %edx,%eax
+ e60:	75 ee                	jne    e50 <waitpoll+0x60>
+  } while(alive);
+ e62:	85 c9                	test   %ecx,%ecx
+ e64:	75 ba                	jne    e20 <waitpoll+0x30>
+ e66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e6d:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+ e70:	83 ec 0c             	sub    $0xc,%esp
+ e73:	57                   	push   %edi
+ e74:	e8 f7 fd ff ff       	call   c70 <free>
+  wait();
+ e79:	83 c4 10             	add    $0x10,%esp
+}
+ e7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e7f:	5b                   	pop    %ebx
+ e80:	5e                   	pop    %esi
+ e81:	5f                   	pop    %edi
+ e82:	5d                   	pop    %ebp
+  wait();
+ e83:	e9 10 f9 ff ff       	jmp    798 <wait>
+ e88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e8f:	90                   	nop
+
+00000e90 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+ e90:	55                   	push   %ebp
+ e91:	89 e5                	mov    %esp,%ebp
+ e93:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+ e96:	c7 45 f0 a1 0f 00 00 	movl   $0xfa1,-0x10(%ebp)
+ e9d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+ ea4:	e8 87 f4 ff ff       	call   330 <fork>
+ ea9:	85 c0                	test   %eax,%eax
+ eab:	78 09                	js     eb6 <runps+0x26>
+    return -1;
+  if(pid == 0){
+ ead:	74 0e                	je     ebd <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+ eaf:	e8 e4 f8 ff ff       	call   798 <wait>
+}
+ eb4:	c9                   	leave
+ eb5:	c3                   	ret
+ eb6:	c9                   	leave
+    return -1;
+ eb7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ ebc:	c3                   	ret
+    exec("ps", argv);
+ ebd:	50                   	push   %eax
+ ebe:	50                   	push   %eax
+ ebf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ ec2:	50                   	push   %eax
+ ec3:	68 a1 0f 00 00       	push   $0xfa1
+ ec8:	e8 c3 f4 ff ff       	call   390 <exec>
+    printf(2, "exec ps failed\n");
+ ecd:	5a                   	pop    %edx
+ ece:	59                   	pop    %ecx
+ ecf:	68 a4 0f 00 00       	push   $0xfa4
+ ed4:	6a 02                	push   $0x2
+ ed6:	e8 55 fb ff ff       	call   a30 <printf>
+    exit();
+ edb:	e8 a0 f4 ff ff       	call   380 <exit>
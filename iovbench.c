@@ -0,0 +1,114 @@
+// Compare writing records made of several fragments with one
+// write() per fragment against one writev() per record, and
+// reading records back with pread() at scattered offsets.
+//
+// usage: iovbench [records]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "uio.h"
+
+#define FILENAME "iovbench.tmp"
+#define NFRAG 8
+#define FRAGSIZE 16
+#define RECSIZE (NFRAG*FRAGSIZE)
+
+char frag[NFRAG][FRAGSIZE];
+
+int
+create(void)
+{
+  int fd;
+
+  unlink(FILENAME);
+  if((fd = open(FILENAME, O_CREATE|O_RDWR)) < 0){
+    printf(2, "iovbench: cannot create %s\n", FILENAME);
+    exit();
+  }
+  return fd;
+}
+
+void
+writes(int n)
+{
+  int fd, i, j;
+
+  fd = create();
+  for(i = 0; i < n; i++)
+    for(j = 0; j < NFRAG; j++)
+      write(fd, frag[j], FRAGSIZE);
+  close(fd);
+}
+
+void
+writevs(int n)
+{
+  struct iovec iov[NFRAG];
+  int fd, i, j;
+
+  for(j = 0; j < NFRAG; j++){
+    iov[j].base = frag[j];
+    iov[j].len = FRAGSIZE;
+  }
+  fd = create();
+  for(i = 0; i < n; i++)
+    if(writev(fd, iov, NFRAG) != RECSIZE){
+      printf(2, "iovbench: writev failed\n");
+      exit();
+    }
+  close(fd);
+}
+
+// pread() every record, in a scattered order, and check it.
+void
+preads(int n)
+{
+  char rec[RECSIZE];
+  int fd, i, r, j;
+
+  fd = open(FILENAME, O_RDONLY);
+  for(i = 0; i < n; i++){
+    r = (i * 7919) % n;
+    if(pread(fd, rec, RECSIZE, r * RECSIZE) != RECSIZE){
+      printf(2, "iovbench: pread of record %d failed\n", r);
+      exit();
+    }
+    for(j = 0; j < NFRAG; j++){
+      if(rec[j*FRAGSIZE] != 'a' + j){
+        printf(2, "iovbench: record %d is wrong\n", r);
+        exit();
+      }
+    }
+  }
+  close(fd);
+}
+
+void
+run(char *name, void (*f)(int), int n)
+{
+  int t;
+
+  t = uptime();
+  f(n);
+  t = uptime() - t;
+  printf(1, "%s: %d records in %d ticks\n", name, n, t);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int n, j;
+
+  n = argc > 1 ? atoi(argv[1]) : 1000;
+  for(j = 0; j < NFRAG; j++)
+    memset(frag[j], 'a' + j, FRAGSIZE);
+
+  run("write", writes, n);
+  run("writev", writevs, n);
+  run("pread", preads, n);
+
+  unlink(FILENAME);
+  exit();
+}
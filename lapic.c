@@ -41,8 +41,12 @@
 #define TCCR    (0x0390/4)   // Timer Current Count
 #define TDCR    (0x03E0/4)   // Timer Divide Configuration
 
+#define TICKCOUNT 10000000   // Timer counts per clock tick
+
 volatile uint *lapic;  // Initialized in mp.c
 
+uint tsckhz;  // TSC cycles per millisecond, from tscinit()
+
 //PAGEBREAK!
 static void
 lapicw(int index, int value)
@@ -66,7 +70,7 @@ lapicinit(void)
   // TICR would be calibrated using an external time source.
   lapicw(TDCR, X1);
   lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
-  lapicw(TICR, 10000000);
+  lapicw(TICR, TICKCOUNT);
 
   // Disable logical interrupt lines.
   lapicw(LINT0, MASKED);
@@ -97,6 +101,14 @@ lapicinit(void)
   lapicw(TPR, 0);
 }
 
+// Make this CPU's timer interrupt mul times per clock tick.
+void
+lapicrate(int mul)
+{
+  if(lapic)
+    lapicw(TICR, TICKCOUNT / mul);
+}
+
 int
 lapicid(void)
 {
@@ -113,6 +125,48 @@ lapiceoi(void)
     lapicw(EOI, 0);
 }
 
+// The PIT's channel 2 counts down at a fixed PIT_HZ, with its
+// gate and output in the keyboard controller's port B, so it
+// can time an interval without interrupts. The lapic timer
+// runs at the bus frequency, which is not known.
+#define PIT_CH2   0x42
+#define PIT_MODE  0x43
+#define PIT_PORTB 0x61
+  #define GATE2      0x01   // channel 2 counts
+  #define SPEAKER    0x02   // channel 2 drives the speaker
+  #define OUT2       0x20   // channel 2 has reached 0
+#define PIT_HZ    1193182
+#define CALMS     10        // calibration interval, ms
+
+// Measure the TSC rate against the PIT, for tsc2us().
+void
+tscinit(void)
+{
+  uint64 t0, t1;
+  uint latch;
+
+  latch = PIT_HZ / (1000 / CALMS);
+  outb(PIT_PORTB, (inb(PIT_PORTB) & ~SPEAKER) | GATE2);
+  outb(PIT_MODE, 0xB0);  // channel 2, lo then hi byte, count down once
+  outb(PIT_CH2, latch & 0xFF);
+  outb(PIT_CH2, latch >> 8);
+  t0 = rdtsc();
+  while((inb(PIT_PORTB) & OUT2) == 0)
+    ;
+  t1 = rdtsc();
+  tsckhz = (uint)(t1 - t0) / CALMS;
+  if(tsckhz == 0)
+    tsckhz = 1;
+  cprintf("tsc: %d kHz\n", tsckhz);
+}
+
+// Convert TSC cycles to microseconds.
+uint64
+tsc2us(uint64 cycles)
+{
+  return div64(cycles * 1000, tsckhz);
+}
+
 // Spin for a given number of microseconds.
 // On real hardware would want to tune this dynamically.
 void
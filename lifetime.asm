@@ -0,0 +1,1954 @@
+
+_lifetime:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+void printf(int fd, const char* format, ...);
+
+int main() {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  printf(1, "Starting lifetime program...\n");
+   f:	83 ec 08             	sub    $0x8,%esp
+  12:	68 40 0e 00 00       	push   $0xe40
+  17:	6a 01                	push   $0x1
+  19:	e8 72 09 00 00       	call   990 <printf>
+  int pid = getpid();
+  1e:	e8 56 07 00 00       	call   779 <getpid>
+  sleep(69);
+  23:	c7 04 24 45 00 00 00 	movl   $0x45,(%esp)
+  int pid = getpid();
+  2a:	89 c3                	mov    %eax,%ebx
+  sleep(69);
+  2c:	e8 5c 07 00 00       	call   78d <sleep>
+  int lifetime = get_process_lifetime(pid);
+  31:	89 1c 24             	mov    %ebx,(%esp)
+  34:	e8 86 07 00 00       	call   7bf <get_process_lifetime>
+  printf(1, "Lifetime of process %d: %d ms\n", pid, lifetime);
+  39:	50                   	push   %eax
+  3a:	53                   	push   %ebx
+  3b:	68 60 0e 00 00       	push   $0xe60
+  40:	6a 01                	push   $0x1
+  42:	e8 49 09 00 00       	call   990 <printf>
+  exit();
+  47:	83 c4 20             	add    $0x20,%esp
+  4a:	e8 91 02 00 00       	call   2e0 <exit>
+  4f:	90                   	nop
+
+00000050 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+  50:	55                   	push   %ebp
+  51:	89 e5                	mov    %esp,%ebp
+  53:	57                   	push   %edi
+  54:	56                   	push   %esi
+  55:	53                   	push   %ebx
+  56:	83 ec 4c             	sub    $0x4c,%esp
+  59:	8b 45 0c             	mov    0xc(%ebp),%eax
+  5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  5f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  62:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+  65:	83 fa 0f             	cmp    $0xf,%edx
+  68:	0f 87 32 01 00 00    	ja     1a0 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+  6e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+  74:	8b 80 80 13 00 00    	mov    0x1380(%eax),%eax
+  7a:	85 c0                	test   %eax,%eax
+  7c:	0f 84 de 00 00 00    	je     160 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+  82:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+  88:	8b b0 84 13 00 00    	mov    0x1384(%eax),%esi
+  8e:	8d 88 80 13 00 00    	lea    0x1380(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+  94:	8d b8 88 13 00 00    	lea    0x1388(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+  9a:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+  9d:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+  a0:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+  a3:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+  a9:	0f 8f 01 01 00 00    	jg     1b0 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+  af:	8d 78 08             	lea    0x8(%eax),%edi
+  b2:	8d bc 3e 80 13 00 00 	lea    0x1380(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+  b9:	85 db                	test   %ebx,%ebx
+  bb:	7e 3b                	jle    f8 <bufwrite+0xa8>
+  bd:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+  c0:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  c7:	90                   	nop
+    *dst++ = *src++;
+  c8:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+  c9:	39 c6                	cmp    %eax,%esi
+  cb:	75 fb                	jne    c8 <bufwrite+0x78>
+  ob[fd].n += n;
+  cd:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+  d3:	8b 88 84 13 00 00    	mov    0x1384(%eax),%ecx
+  d9:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+  db:	83 b8 80 13 00 00 01 	cmpl   $0x1,0x1380(%eax)
+  ob[fd].n += n;
+  e2:	89 88 84 13 00 00    	mov    %ecx,0x1384(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+  e8:	74 26                	je     110 <bufwrite+0xc0>
+}
+  ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  ed:	5b                   	pop    %ebx
+  ee:	5e                   	pop    %esi
+  ef:	5f                   	pop    %edi
+  f0:	5d                   	pop    %ebp
+  f1:	c3                   	ret
+  f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+  f8:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+  fb:	83 b8 80 13 00 00 01 	cmpl   $0x1,0x1380(%eax)
+  ob[fd].n += n;
+ 102:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 105:	75 e3                	jne    ea <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+ 107:	85 db                	test   %ebx,%ebx
+ 109:	74 df                	je     ea <bufwrite+0x9a>
+ 10b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 10f:	90                   	nop
+  src = vsrc;
+ 110:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 113:	01 c3                	add    %eax,%ebx
+ 115:	eb 10                	jmp    127 <bufwrite+0xd7>
+ 117:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11e:	66 90                	xchg   %ax,%ax
+ 120:	83 c0 01             	add    $0x1,%eax
+ 123:	39 d8                	cmp    %ebx,%eax
+ 125:	74 c3                	je     ea <bufwrite+0x9a>
+    if(*p == (char)c)
+ 127:	80 38 0a             	cmpb   $0xa,(%eax)
+ 12a:	75 f4                	jne    120 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 12c:	85 c9                	test   %ecx,%ecx
+ 12e:	7e ba                	jle    ea <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 130:	83 ec 04             	sub    $0x4,%esp
+ 133:	51                   	push   %ecx
+ 134:	ff 75 ac             	push   -0x54(%ebp)
+ 137:	52                   	push   %edx
+ 138:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+ 13b:	e8 cd 05 00 00       	call   70d <write>
+    ob[fd].n = 0;
+ 140:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+ 143:	83 c4 10             	add    $0x10,%esp
+ 146:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+ 14c:	c7 82 84 13 00 00 00 	movl   $0x0,0x1384(%edx)
+ 153:	00 00 00 
+ 156:	eb 92                	jmp    ea <bufwrite+0x9a>
+ 158:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15f:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 160:	83 ec 08             	sub    $0x8,%esp
+ 163:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 166:	50                   	push   %eax
+ 167:	52                   	push   %edx
+ 168:	89 55 b0             	mov    %edx,-0x50(%ebp)
+ 16b:	e8 d7 05 00 00       	call   747 <fstat>
+ 170:	83 c4 10             	add    $0x10,%esp
+ 173:	8b 55 b0             	mov    -0x50(%ebp),%edx
+ 176:	89 c1                	mov    %eax,%ecx
+ 178:	b8 02 00 00 00       	mov    $0x2,%eax
+ 17d:	85 c9                	test   %ecx,%ecx
+ 17f:	75 0d                	jne    18e <bufwrite+0x13e>
+ 181:	31 c0                	xor    %eax,%eax
+ 183:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 188:	0f 95 c0             	setne  %al
+ 18b:	83 c0 01             	add    $0x1,%eax
+ 18e:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+ 194:	89 81 80 13 00 00    	mov    %eax,0x1380(%ecx)
+ 19a:	e9 e3 fe ff ff       	jmp    82 <bufwrite+0x32>
+ 19f:	90                   	nop
+}
+ 1a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1a3:	5b                   	pop    %ebx
+ 1a4:	5e                   	pop    %esi
+ 1a5:	5f                   	pop    %edi
+ 1a6:	5d                   	pop    %ebp
+    write(fd, p, n);
+ 1a7:	e9 61 05 00 00       	jmp    70d <write>
+ 1ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+ 1b0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+ 1b3:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+ 1b6:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+ 1b9:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+ 1bc:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+ 1bf:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+ 1c2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+ 1c5:	6a 02                	push   $0x2
+ 1c7:	50                   	push   %eax
+ 1c8:	52                   	push   %edx
+ 1c9:	e8 9b 06 00 00       	call   869 <writev>
+    ob[fd].n = 0;
+ 1ce:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+ 1d1:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+ 1d4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ 1db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1de:	5b                   	pop    %ebx
+ 1df:	5e                   	pop    %esi
+ 1e0:	5f                   	pop    %edi
+ 1e1:	5d                   	pop    %ebp
+ 1e2:	c3                   	ret
+ 1e3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000001f0 <fflush>:
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	53                   	push   %ebx
+ 1f4:	83 ec 04             	sub    $0x4,%esp
+ 1f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 1fa:	83 f8 0f             	cmp    $0xf,%eax
+ 1fd:	77 16                	ja     215 <fflush+0x25>
+ 1ff:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+ 205:	8b 8a 84 13 00 00    	mov    0x1384(%edx),%ecx
+ 20b:	8d 9a 80 13 00 00    	lea    0x1380(%edx),%ebx
+ 211:	85 c9                	test   %ecx,%ecx
+ 213:	7f 0b                	jg     220 <fflush+0x30>
+}
+ 215:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 218:	c9                   	leave
+ 219:	c3                   	ret
+ 21a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 220:	83 ec 04             	sub    $0x4,%esp
+ 223:	81 c2 88 13 00 00    	add    $0x1388,%edx
+ 229:	51                   	push   %ecx
+ 22a:	52                   	push   %edx
+ 22b:	50                   	push   %eax
+ 22c:	e8 dc 04 00 00       	call   70d <write>
+    ob[fd].n = 0;
+ 231:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+ 238:	83 c4 10             	add    $0x10,%esp
+}
+ 23b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 23e:	c9                   	leave
+ 23f:	c3                   	ret
+
+00000240 <fflushall>:
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 244:	31 f6                	xor    %esi,%esi
+{
+ 246:	53                   	push   %ebx
+ 247:	bb 88 13 00 00       	mov    $0x1388,%ebx
+ 24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 250:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 253:	85 c0                	test   %eax,%eax
+ 255:	7e 15                	jle    26c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 257:	83 ec 04             	sub    $0x4,%esp
+ 25a:	50                   	push   %eax
+ 25b:	53                   	push   %ebx
+ 25c:	56                   	push   %esi
+ 25d:	e8 ab 04 00 00       	call   70d <write>
+    ob[fd].n = 0;
+ 262:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 269:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 26c:	83 c6 01             	add    $0x1,%esi
+ 26f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 275:	83 fe 10             	cmp    $0x10,%esi
+ 278:	75 d6                	jne    250 <fflushall+0x10>
+}
+ 27a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 27d:	5b                   	pop    %ebx
+ 27e:	5e                   	pop    %esi
+ 27f:	5d                   	pop    %ebp
+ 280:	c3                   	ret
+ 281:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 288:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28f:	90                   	nop
+
+00000290 <fork>:
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 294:	31 f6                	xor    %esi,%esi
+{
+ 296:	53                   	push   %ebx
+ 297:	bb 88 13 00 00       	mov    $0x1388,%ebx
+ 29c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 2a0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 2a3:	85 c0                	test   %eax,%eax
+ 2a5:	7e 15                	jle    2bc <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 2a7:	83 ec 04             	sub    $0x4,%esp
+ 2aa:	50                   	push   %eax
+ 2ab:	53                   	push   %ebx
+ 2ac:	56                   	push   %esi
+ 2ad:	e8 5b 04 00 00       	call   70d <write>
+    ob[fd].n = 0;
+ 2b2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 2b9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 2bc:	83 c6 01             	add    $0x1,%esi
+ 2bf:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 2c5:	83 fe 10             	cmp    $0x10,%esi
+ 2c8:	75 d6                	jne    2a0 <fork+0x10>
+}
+ 2ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2cd:	5b                   	pop    %ebx
+ 2ce:	5e                   	pop    %esi
+ 2cf:	5d                   	pop    %ebp
+  return _fork();
+ 2d0:	e9 15 04 00 00       	jmp    6ea <_fork>
+ 2d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002e0 <exit>:
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+ 2e6:	e8 55 ff ff ff       	call   240 <fflushall>
+  _exit();
+ 2eb:	e8 01 04 00 00       	call   6f1 <_exit>
+
+000002f0 <exec>:
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	57                   	push   %edi
+ 2f4:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 2f5:	31 f6                	xor    %esi,%esi
+{
+ 2f7:	53                   	push   %ebx
+ 2f8:	bb 88 13 00 00       	mov    $0x1388,%ebx
+ 2fd:	83 ec 1c             	sub    $0x1c,%esp
+ 300:	8b 45 08             	mov    0x8(%ebp),%eax
+ 303:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 306:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 310:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 313:	85 c0                	test   %eax,%eax
+ 315:	7e 15                	jle    32c <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 317:	83 ec 04             	sub    $0x4,%esp
+ 31a:	50                   	push   %eax
+ 31b:	53                   	push   %ebx
+ 31c:	56                   	push   %esi
+ 31d:	e8 eb 03 00 00       	call   70d <write>
+    ob[fd].n = 0;
+ 322:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 329:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 32c:	83 c6 01             	add    $0x1,%esi
+ 32f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 335:	83 fe 10             	cmp    $0x10,%esi
+ 338:	75 d6                	jne    310 <exec+0x20>
+  return _exec(path, argv);
+ 33a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 33d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+ 340:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ 343:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 346:	5b                   	pop    %ebx
+ 347:	5e                   	pop    %esi
+ 348:	5f                   	pop    %edi
+ 349:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 34a:	e9 d3 03 00 00       	jmp    722 <_exec>
+ 34f:	90                   	nop
+
+00000350 <close>:
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	56                   	push   %esi
+ 354:	53                   	push   %ebx
+ 355:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 358:	83 fb 0f             	cmp    $0xf,%ebx
+ 35b:	77 26                	ja     383 <close+0x33>
+ 35d:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 363:	8b 90 84 13 00 00    	mov    0x1384(%eax),%edx
+ 369:	8d b0 80 13 00 00    	lea    0x1380(%eax),%esi
+ 36f:	85 d2                	test   %edx,%edx
+ 371:	7f 25                	jg     398 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+ 373:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 379:	c7 80 80 13 00 00 00 	movl   $0x0,0x1380(%eax)
+ 380:	00 00 00 
+  return _close(fd);
+ 383:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 386:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 389:	5b                   	pop    %ebx
+ 38a:	5e                   	pop    %esi
+ 38b:	5d                   	pop    %ebp
+  return _close(fd);
+ 38c:	e9 83 03 00 00       	jmp    714 <_close>
+ 391:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 398:	83 ec 04             	sub    $0x4,%esp
+ 39b:	05 88 13 00 00       	add    $0x1388,%eax
+ 3a0:	52                   	push   %edx
+ 3a1:	50                   	push   %eax
+ 3a2:	53                   	push   %ebx
+ 3a3:	e8 65 03 00 00       	call   70d <write>
+    ob[fd].n = 0;
+ 3a8:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+ 3af:	83 c4 10             	add    $0x10,%esp
+ 3b2:	eb bf                	jmp    373 <close+0x23>
+ 3b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3bf:	90                   	nop
+
+000003c0 <strcpy>:
+{
+ 3c0:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+ 3c1:	31 c0                	xor    %eax,%eax
+{
+ 3c3:	89 e5                	mov    %esp,%ebp
+ 3c5:	53                   	push   %ebx
+ 3c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 3d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 3d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 3d7:	83 c0 01             	add    $0x1,%eax
+ 3da:	84 d2                	test   %dl,%dl
+ 3dc:	75 f2                	jne    3d0 <strcpy+0x10>
+}
+ 3de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3e1:	89 c8                	mov    %ecx,%eax
+ 3e3:	c9                   	leave
+ 3e4:	c3                   	ret
+ 3e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003f0 <strcmp>:
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	53                   	push   %ebx
+ 3f4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 3fa:	0f b6 02             	movzbl (%edx),%eax
+ 3fd:	84 c0                	test   %al,%al
+ 3ff:	75 17                	jne    418 <strcmp+0x28>
+ 401:	eb 3a                	jmp    43d <strcmp+0x4d>
+ 403:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 407:	90                   	nop
+ 408:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 40c:	83 c2 01             	add    $0x1,%edx
+ 40f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 412:	84 c0                	test   %al,%al
+ 414:	74 1a                	je     430 <strcmp+0x40>
+    p++, q++;
+ 416:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 418:	0f b6 19             	movzbl (%ecx),%ebx
+ 41b:	38 c3                	cmp    %al,%bl
+ 41d:	74 e9                	je     408 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 41f:	29 d8                	sub    %ebx,%eax
+}
+ 421:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 424:	c9                   	leave
+ 425:	c3                   	ret
+ 426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 430:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 434:	31 c0                	xor    %eax,%eax
+ 436:	29 d8                	sub    %ebx,%eax
+}
+ 438:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 43b:	c9                   	leave
+ 43c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 43d:	0f b6 19             	movzbl (%ecx),%ebx
+ 440:	31 c0                	xor    %eax,%eax
+ 442:	eb db                	jmp    41f <strcmp+0x2f>
+ 444:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 44f:	90                   	nop
+
+00000450 <strlen>:
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+ 456:	80 3a 00             	cmpb   $0x0,(%edx)
+ 459:	74 15                	je     470 <strlen+0x20>
+ 45b:	31 c0                	xor    %eax,%eax
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+ 460:	83 c0 01             	add    $0x1,%eax
+ 463:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 467:	89 c1                	mov    %eax,%ecx
+ 469:	75 f5                	jne    460 <strlen+0x10>
+}
+ 46b:	89 c8                	mov    %ecx,%eax
+ 46d:	5d                   	pop    %ebp
+ 46e:	c3                   	ret
+ 46f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 470:	31 c9                	xor    %ecx,%ecx
+}
+ 472:	5d                   	pop    %ebp
+ 473:	89 c8                	mov    %ecx,%eax
+ 475:	c3                   	ret
+ 476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000480 <memset>:
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	57                   	push   %edi
+ 484:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 487:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 48a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 48d:	89 d7                	mov    %edx,%edi
+ 48f:	fc                   	cld
+ 490:	f3 aa                	rep stos %al,%es:(%edi)
+}
+ 492:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 495:	89 d0                	mov    %edx,%eax
+ 497:	c9                   	leave
+ 498:	c3                   	ret
+ 499:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004a0 <strchr>:
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 4aa:	0f b6 10             	movzbl (%eax),%edx
+ 4ad:	84 d2                	test   %dl,%dl
+ 4af:	75 12                	jne    4c3 <strchr+0x23>
+ 4b1:	eb 1d                	jmp    4d0 <strchr+0x30>
+ 4b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4b7:	90                   	nop
+ 4b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 4bc:	83 c0 01             	add    $0x1,%eax
+ 4bf:	84 d2                	test   %dl,%dl
+ 4c1:	74 0d                	je     4d0 <strchr+0x30>
+    if(*s == c)
+ 4c3:	38 d1                	cmp    %dl,%cl
+ 4c5:	75 f1                	jne    4b8 <strchr+0x18>
+}
+ 4c7:	5d                   	pop    %ebp
+ 4c8:	c3                   	ret
+ 4c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 4d0:	31 c0                	xor    %eax,%eax
+}
+ 4d2:	5d                   	pop    %ebp
+ 4d3:	c3                   	ret
+ 4d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4df:	90                   	nop
+
+000004e0 <memchr>:
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	8b 55 10             	mov    0x10(%ebp),%edx
+ 4e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 4e9:	85 d2                	test   %edx,%edx
+ 4eb:	74 1b                	je     508 <memchr+0x28>
+    if(*p == (char)c)
+ 4ed:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+ 4f1:	01 c2                	add    %eax,%edx
+ 4f3:	eb 0a                	jmp    4ff <memchr+0x1f>
+ 4f5:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+ 4f8:	83 c0 01             	add    $0x1,%eax
+ 4fb:	39 c2                	cmp    %eax,%edx
+ 4fd:	74 09                	je     508 <memchr+0x28>
+    if(*p == (char)c)
+ 4ff:	38 08                	cmp    %cl,(%eax)
+ 501:	75 f5                	jne    4f8 <memchr+0x18>
+}
+ 503:	5d                   	pop    %ebp
+ 504:	c3                   	ret
+ 505:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+ 508:	31 c0                	xor    %eax,%eax
+}
+ 50a:	5d                   	pop    %ebp
+ 50b:	c3                   	ret
+ 50c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000510 <gets>:
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+ 514:	31 ff                	xor    %edi,%edi
+{
+ 516:	56                   	push   %esi
+ 517:	be 88 13 00 00       	mov    $0x1388,%esi
+ 51c:	53                   	push   %ebx
+ 51d:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 520:	8b 46 fc             	mov    -0x4(%esi),%eax
+ 523:	85 c0                	test   %eax,%eax
+ 525:	7e 15                	jle    53c <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 527:	83 ec 04             	sub    $0x4,%esp
+ 52a:	50                   	push   %eax
+ 52b:	56                   	push   %esi
+ 52c:	57                   	push   %edi
+ 52d:	e8 db 01 00 00       	call   70d <write>
+    ob[fd].n = 0;
+ 532:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+ 539:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 53c:	83 c7 01             	add    $0x1,%edi
+ 53f:	81 c6 08 01 00 00    	add    $0x108,%esi
+ 545:	83 ff 10             	cmp    $0x10,%edi
+ 548:	75 d6                	jne    520 <gets+0x10>
+  for(i=0; i+1 < max; ){
+ 54a:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+ 54c:	8d 75 e7             	lea    -0x19(%ebp),%esi
+ 54f:	eb 2e                	jmp    57f <gets+0x6f>
+ 551:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 558:	83 ec 04             	sub    $0x4,%esp
+ 55b:	6a 01                	push   $0x1
+ 55d:	56                   	push   %esi
+ 55e:	6a 00                	push   $0x0
+ 560:	e8 a1 01 00 00       	call   706 <read>
+    if(cc < 1)
+ 565:	83 c4 10             	add    $0x10,%esp
+ 568:	85 c0                	test   %eax,%eax
+ 56a:	7e 1d                	jle    589 <gets+0x79>
+    buf[i++] = c;
+ 56c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 570:	8b 55 08             	mov    0x8(%ebp),%edx
+ 573:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 577:	3c 0a                	cmp    $0xa,%al
+ 579:	74 10                	je     58b <gets+0x7b>
+ 57b:	3c 0d                	cmp    $0xd,%al
+ 57d:	74 0c                	je     58b <gets+0x7b>
+  for(i=0; i+1 < max; ){
+ 57f:	89 df                	mov    %ebx,%edi
+ 581:	83 c3 01             	add    $0x1,%ebx
+ 584:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 587:	7c cf                	jl     558 <gets+0x48>
+ 589:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 58b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 58e:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 592:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 595:	5b                   	pop    %ebx
+ 596:	5e                   	pop    %esi
+ 597:	5f                   	pop    %edi
+ 598:	5d                   	pop    %ebp
+ 599:	c3                   	ret
+ 59a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000005a0 <stat>:
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+ 5a3:	57                   	push   %edi
+ 5a4:	56                   	push   %esi
+ 5a5:	53                   	push   %ebx
+ 5a6:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+ 5a9:	6a 00                	push   $0x0
+ 5ab:	ff 75 08             	push   0x8(%ebp)
+ 5ae:	e8 76 01 00 00       	call   729 <open>
+  if(fd < 0)
+ 5b3:	83 c4 10             	add    $0x10,%esp
+ 5b6:	85 c0                	test   %eax,%eax
+ 5b8:	78 76                	js     630 <stat+0x90>
+  r = fstat(fd, st);
+ 5ba:	83 ec 08             	sub    $0x8,%esp
+ 5bd:	ff 75 0c             	push   0xc(%ebp)
+ 5c0:	89 c3                	mov    %eax,%ebx
+ 5c2:	50                   	push   %eax
+ 5c3:	e8 7f 01 00 00       	call   747 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 5c8:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 5cb:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 5cd:	83 fb 0f             	cmp    $0xf,%ebx
+ 5d0:	7f 40                	jg     612 <stat+0x72>
+ 5d2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 5d8:	8b 90 84 13 00 00    	mov    0x1384(%eax),%edx
+ 5de:	8d b8 80 13 00 00    	lea    0x1380(%eax),%edi
+ 5e4:	85 d2                	test   %edx,%edx
+ 5e6:	7e 1a                	jle    602 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 5e8:	83 ec 04             	sub    $0x4,%esp
+ 5eb:	05 88 13 00 00       	add    $0x1388,%eax
+ 5f0:	52                   	push   %edx
+ 5f1:	50                   	push   %eax
+ 5f2:	53                   	push   %ebx
+ 5f3:	e8 15 01 00 00       	call   70d <write>
+    ob[fd].n = 0;
+ 5f8:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+ 5ff:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+ 602:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 608:	c7 80 80 13 00 00 00 	movl   $0x0,0x1380(%eax)
+ 60f:	00 00 00 
+  return _close(fd);
+ 612:	83 ec 0c             	sub    $0xc,%esp
+ 615:	53                   	push   %ebx
+ 616:	e8 f9 00 00 00       	call   714 <_close>
+ 61b:	83 c4 10             	add    $0x10,%esp
+}
+ 61e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 621:	89 f0                	mov    %esi,%eax
+ 623:	5b                   	pop    %ebx
+ 624:	5e                   	pop    %esi
+ 625:	5f                   	pop    %edi
+ 626:	5d                   	pop    %ebp
+ 627:	c3                   	ret
+ 628:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 62f:	90                   	nop
+    return -1;
+ 630:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 635:	eb e7                	jmp    61e <stat+0x7e>
+ 637:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 63e:	66 90                	xchg   %ax,%ax
+
+00000640 <atoi>:
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	53                   	push   %ebx
+ 644:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 647:	0f be 02             	movsbl (%edx),%eax
+ 64a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 64d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 650:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 655:	77 1e                	ja     675 <atoi+0x35>
+ 657:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 65e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 660:	83 c2 01             	add    $0x1,%edx
+ 663:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 666:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 66a:	0f be 02             	movsbl (%edx),%eax
+ 66d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 670:	80 fb 09             	cmp    $0x9,%bl
+ 673:	76 eb                	jbe    660 <atoi+0x20>
+}
+ 675:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 678:	89 c8                	mov    %ecx,%eax
+ 67a:	c9                   	leave
+ 67b:	c3                   	ret
+ 67c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000680 <memmove>:
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+ 683:	57                   	push   %edi
+ 684:	56                   	push   %esi
+ 685:	8b 45 10             	mov    0x10(%ebp),%eax
+ 688:	8b 55 08             	mov    0x8(%ebp),%edx
+ 68b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 68e:	85 c0                	test   %eax,%eax
+ 690:	7e 13                	jle    6a5 <memmove+0x25>
+ 692:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 694:	89 d7                	mov    %edx,%edi
+ 696:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 69d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 6a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 6a1:	39 f8                	cmp    %edi,%eax
+ 6a3:	75 fb                	jne    6a0 <memmove+0x20>
+  return vdst;
+}
+ 6a5:	5e                   	pop    %esi
+ 6a6:	89 d0                	mov    %edx,%eax
+ 6a8:	5f                   	pop    %edi
+ 6a9:	5d                   	pop    %ebp
+ 6aa:	c3                   	ret
+
+000006ab <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+ 6ab:	83 3d 68 13 00 00 00 	cmpl   $0x0,0x1368
+  jle 1f
+ 6b2:	7e 0a                	jle    6be <syscallentry+0x13>
+  movl %esp, %ecx
+ 6b4:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 6b6:	ba bd 06 00 00       	mov    $0x6bd,%edx
+  sysenter
+ 6bb:	0f 34                	sysenter
+2:
+  ret
+ 6bd:	c3                   	ret
+1:
+  jl 3f
+ 6be:	7c 27                	jl     6e7 <syscallentry+0x3c>
+  pushal
+ 6c0:	60                   	pusha
+  movl $1, %eax
+ 6c1:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 6c6:	0f a2                	cpuid
+  movl $-1, sysentermode
+ 6c8:	c7 05 68 13 00 00 ff 	movl   $0xffffffff,0x1368
+ 6cf:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 6d2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+ 6d8:	74 0a                	je     6e4 <syscallentry+0x39>
+  movl $1, sysentermode
+ 6da:	c7 05 68 13 00 00 01 	movl   $0x1,0x1368
+ 6e1:	00 00 00 
+4:
+  popal
+ 6e4:	61                   	popa
+  jmp syscallentry
+ 6e5:	eb c4                	jmp    6ab <syscallentry>
+3:
+  int $T_SYSCALL
+ 6e7:	cd 40                	int    $0x40
+  ret
+ 6e9:	c3                   	ret
+
+000006ea <_fork>:
+
+SYSCALLAS(_fork, fork)
+ 6ea:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6ef:	eb ba                	jmp    6ab <syscallentry>
+
+000006f1 <_exit>:
+SYSCALLAS(_exit, exit)
+ 6f1:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6f6:	eb b3                	jmp    6ab <syscallentry>
+
+000006f8 <wait>:
+SYSCALL(wait)
+ 6f8:	b8 03 00 00 00       	mov    $0x3,%eax
+ 6fd:	eb ac                	jmp    6ab <syscallentry>
+
+000006ff <pipe>:
+SYSCALL(pipe)
+ 6ff:	b8 04 00 00 00       	mov    $0x4,%eax
+ 704:	eb a5                	jmp    6ab <syscallentry>
+
+00000706 <read>:
+SYSCALL(read)
+ 706:	b8 05 00 00 00       	mov    $0x5,%eax
+ 70b:	eb 9e                	jmp    6ab <syscallentry>
+
+0000070d <write>:
+SYSCALL(write)
+ 70d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 712:	eb 97                	jmp    6ab <syscallentry>
+
+00000714 <_close>:
+SYSCALLAS(_close, close)
+ 714:	b8 15 00 00 00       	mov    $0x15,%eax
+ 719:	eb 90                	jmp    6ab <syscallentry>
+
+0000071b <kill>:
+SYSCALL(kill)
+ 71b:	b8 06 00 00 00       	mov    $0x6,%eax
+ 720:	eb 89                	jmp    6ab <syscallentry>
+
+00000722 <_exec>:
+SYSCALLAS(_exec, exec)
+ 722:	b8 07 00 00 00       	mov    $0x7,%eax
+ 727:	eb 82                	jmp    6ab <syscallentry>
+
+00000729 <open>:
+SYSCALL(open)
+ 729:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 72e:	e9 78 ff ff ff       	jmp    6ab <syscallentry>
+
+00000733 <mknod>:
+SYSCALL(mknod)
+ 733:	b8 11 00 00 00       	mov    $0x11,%eax
+ 738:	e9 6e ff ff ff       	jmp    6ab <syscallentry>
+
+0000073d <unlink>:
+SYSCALL(unlink)
+ 73d:	b8 12 00 00 00       	mov    $0x12,%eax
+ 742:	e9 64 ff ff ff       	jmp    6ab <syscallentry>
+
+00000747 <fstat>:
+SYSCALL(fstat)
+ 747:	b8 08 00 00 00       	mov    $0x8,%eax
+ 74c:	e9 5a ff ff ff       	jmp    6ab <syscallentry>
+
+00000751 <link>:
+SYSCALL(link)
+ 751:	b8 13 00 00 00       	mov    $0x13,%eax
+ 756:	e9 50 ff ff ff       	jmp    6ab <syscallentry>
+
+0000075b <mkdir>:
+SYSCALL(mkdir)
+ 75b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 760:	e9 46 ff ff ff       	jmp    6ab <syscallentry>
+
+00000765 <chdir>:
+SYSCALL(chdir)
+ 765:	b8 09 00 00 00       	mov    $0x9,%eax
+ 76a:	e9 3c ff ff ff       	jmp    6ab <syscallentry>
+
+0000076f <dup>:
+SYSCALL(dup)
+ 76f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 774:	e9 32 ff ff ff       	jmp    6ab <syscallentry>
+
+00000779 <getpid>:
+SYSCALL(getpid)
+ 779:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 77e:	e9 28 ff ff ff       	jmp    6ab <syscallentry>
+
+00000783 <sbrk>:
+SYSCALL(sbrk)
+ 783:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 788:	e9 1e ff ff ff       	jmp    6ab <syscallentry>
+
+0000078d <sleep>:
+SYSCALL(sleep)
+ 78d:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 792:	e9 14 ff ff ff       	jmp    6ab <syscallentry>
+
+00000797 <uptime>:
+SYSCALL(uptime)
+ 797:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 79c:	e9 0a ff ff ff       	jmp    6ab <syscallentry>
+
+000007a1 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+ 7a1:	b8 16 00 00 00       	mov    $0x16,%eax
+ 7a6:	e9 00 ff ff ff       	jmp    6ab <syscallentry>
+
+000007ab <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+ 7ab:	b8 17 00 00 00       	mov    $0x17,%eax
+ 7b0:	e9 f6 fe ff ff       	jmp    6ab <syscallentry>
+
+000007b5 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+ 7b5:	b8 18 00 00 00       	mov    $0x18,%eax
+ 7ba:	e9 ec fe ff ff       	jmp    6ab <syscallentry>
+
+000007bf <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+ 7bf:	b8 19 00 00 00       	mov    $0x19,%eax
+ 7c4:	e9 e2 fe ff ff       	jmp    6ab <syscallentry>
+
+000007c9 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+ 7c9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 7ce:	e9 d8 fe ff ff       	jmp    6ab <syscallentry>
+
+000007d3 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+ 7d3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 7d8:	e9 ce fe ff ff       	jmp    6ab <syscallentry>
+
+000007dd <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+ 7dd:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 7e2:	e9 c4 fe ff ff       	jmp    6ab <syscallentry>
+
+000007e7 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+ 7e7:	b8 20 00 00 00       	mov    $0x20,%eax
+ 7ec:	e9 ba fe ff ff       	jmp    6ab <syscallentry>
+
+000007f1 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+ 7f1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 7f6:	e9 b0 fe ff ff       	jmp    6ab <syscallentry>
+
+000007fb <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+ 7fb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 800:	e9 a6 fe ff ff       	jmp    6ab <syscallentry>
+
+00000805 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+ 805:	b8 21 00 00 00       	mov    $0x21,%eax
+ 80a:	e9 9c fe ff ff       	jmp    6ab <syscallentry>
+
+0000080f <yield>:
+SYSCALL(yield) // yield the CPU to another process
+ 80f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 814:	e9 92 fe ff ff       	jmp    6ab <syscallentry>
+
+00000819 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+ 819:	b8 23 00 00 00       	mov    $0x23,%eax
+ 81e:	e9 88 fe ff ff       	jmp    6ab <syscallentry>
+
+00000823 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+ 823:	b8 24 00 00 00       	mov    $0x24,%eax
+ 828:	e9 7e fe ff ff       	jmp    6ab <syscallentry>
+
+0000082d <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+ 82d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 832:	e9 74 fe ff ff       	jmp    6ab <syscallentry>
+
+00000837 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+ 837:	b8 26 00 00 00       	mov    $0x26,%eax
+ 83c:	e9 6a fe ff ff       	jmp    6ab <syscallentry>
+
+00000841 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+ 841:	b8 27 00 00 00       	mov    $0x27,%eax
+ 846:	e9 60 fe ff ff       	jmp    6ab <syscallentry>
+
+0000084b <mmap>:
+SYSCALL(mmap) // map a file into memory
+ 84b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 850:	e9 56 fe ff ff       	jmp    6ab <syscallentry>
+
+00000855 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+ 855:	b8 29 00 00 00       	mov    $0x29,%eax
+ 85a:	e9 4c fe ff ff       	jmp    6ab <syscallentry>
+
+0000085f <readv>:
+SYSCALL(readv) // read into several buffers
+ 85f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 864:	e9 42 fe ff ff       	jmp    6ab <syscallentry>
+
+00000869 <writev>:
+SYSCALL(writev) // write from several buffers
+ 869:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 86e:	e9 38 fe ff ff       	jmp    6ab <syscallentry>
+
+00000873 <pread>:
+SYSCALL(pread) // read at an offset
+ 873:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 878:	e9 2e fe ff ff       	jmp    6ab <syscallentry>
+
+0000087d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+ 87d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 882:	e9 24 fe ff ff       	jmp    6ab <syscallentry>
+
+00000887 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+ 887:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 88c:	e9 1a fe ff ff       	jmp    6ab <syscallentry>
+
+00000891 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+ 891:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 896:	e9 10 fe ff ff       	jmp    6ab <syscallentry>
+
+0000089b <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+ 89b:	b8 30 00 00 00       	mov    $0x30,%eax
+ 8a0:	e9 06 fe ff ff       	jmp    6ab <syscallentry>
+
+000008a5 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+ 8a5:	b8 31 00 00 00       	mov    $0x31,%eax
+ 8aa:	e9 fc fd ff ff       	jmp    6ab <syscallentry>
+
+000008af <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+ 8af:	b8 32 00 00 00       	mov    $0x32,%eax
+ 8b4:	e9 f2 fd ff ff       	jmp    6ab <syscallentry>
+
+000008b9 <profread>:
+SYSCALL(profread) // drain profiler samples
+ 8b9:	b8 33 00 00 00       	mov    $0x33,%eax
+ 8be:	e9 e8 fd ff ff       	jmp    6ab <syscallentry>
+
+000008c3 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+ 8c3:	b8 34 00 00 00       	mov    $0x34,%eax
+ 8c8:	e9 de fd ff ff       	jmp    6ab <syscallentry>
+
+000008cd <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+ 8cd:	b8 35 00 00 00       	mov    $0x35,%eax
+ 8d2:	e9 d4 fd ff ff       	jmp    6ab <syscallentry>
+
+000008d7 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+ 8d7:	b8 36 00 00 00       	mov    $0x36,%eax
+ 8dc:	e9 ca fd ff ff       	jmp    6ab <syscallentry>
+
+000008e1 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+ 8e1:	b8 37 00 00 00       	mov    $0x37,%eax
+ 8e6:	e9 c0 fd ff ff       	jmp    6ab <syscallentry>
+ 8eb:	66 90                	xchg   %ax,%ax
+ 8ed:	66 90                	xchg   %ax,%ax
+ 8ef:	90                   	nop
+
+000008f0 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 8f0:	55                   	push   %ebp
+ 8f1:	89 e5                	mov    %esp,%ebp
+ 8f3:	57                   	push   %edi
+ 8f4:	56                   	push   %esi
+ 8f5:	53                   	push   %ebx
+ 8f6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 8f8:	89 d1                	mov    %edx,%ecx
+{
+ 8fa:	83 ec 3c             	sub    $0x3c,%esp
+ 8fd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 900:	85 d2                	test   %edx,%edx
+ 902:	0f 89 80 00 00 00    	jns    988 <printint+0x98>
+ 908:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 90c:	74 7a                	je     988 <printint+0x98>
+    x = -xx;
+ 90e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 910:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 915:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 918:	31 f6                	xor    %esi,%esi
+ 91a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 920:	89 c8                	mov    %ecx,%eax
+ 922:	31 d2                	xor    %edx,%edx
+ 924:	89 f7                	mov    %esi,%edi
+ 926:	f7 f3                	div    %ebx
+ 928:	8d 76 01             	lea    0x1(%esi),%esi
+ 92b:	0f b6 92 e0 0e 00 00 	movzbl 0xee0(%edx),%edx
+ 932:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 936:	89 ca                	mov    %ecx,%edx
+ 938:	89 c1                	mov    %eax,%ecx
+ 93a:	39 da                	cmp    %ebx,%edx
+ 93c:	73 e2                	jae    920 <printint+0x30>
+  if(neg)
+ 93e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 941:	85 c0                	test   %eax,%eax
+ 943:	74 07                	je     94c <printint+0x5c>
+    buf[i++] = '-';
+ 945:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 94a:	89 f7                	mov    %esi,%edi
+ 94c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 94f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 952:	01 df                	add    %ebx,%edi
+ 954:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 958:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+ 95b:	83 ec 04             	sub    $0x4,%esp
+ 95e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 961:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 964:	6a 01                	push   $0x1
+ 966:	50                   	push   %eax
+ 967:	56                   	push   %esi
+ 968:	e8 e3 f6 ff ff       	call   50 <bufwrite>
+  while(--i >= 0)
+ 96d:	89 f8                	mov    %edi,%eax
+ 96f:	83 c4 10             	add    $0x10,%esp
+ 972:	83 ef 01             	sub    $0x1,%edi
+ 975:	39 d8                	cmp    %ebx,%eax
+ 977:	75 df                	jne    958 <printint+0x68>
+}
+ 979:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 97c:	5b                   	pop    %ebx
+ 97d:	5e                   	pop    %esi
+ 97e:	5f                   	pop    %edi
+ 97f:	5d                   	pop    %ebp
+ 980:	c3                   	ret
+ 981:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 988:	31 c0                	xor    %eax,%eax
+ 98a:	eb 89                	jmp    915 <printint+0x25>
+ 98c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000990 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 990:	55                   	push   %ebp
+ 991:	89 e5                	mov    %esp,%ebp
+ 993:	57                   	push   %edi
+ 994:	56                   	push   %esi
+ 995:	53                   	push   %ebx
+ 996:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 999:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 99c:	0f b6 18             	movzbl (%eax),%ebx
+ 99f:	84 db                	test   %bl,%bl
+ 9a1:	74 6c                	je     a0f <printf+0x7f>
+ 9a3:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+ 9a6:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ 9a9:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 9ab:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 9ae:	eb 26                	jmp    9d6 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 9b0:	83 f8 25             	cmp    $0x25,%eax
+ 9b3:	74 4b                	je     a00 <printf+0x70>
+  bufwrite(fd, &c, 1);
+ 9b5:	83 ec 04             	sub    $0x4,%esp
+ 9b8:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 9bb:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ 9be:	6a 01                	push   $0x1
+ 9c0:	50                   	push   %eax
+ 9c1:	ff 75 08             	push   0x8(%ebp)
+ 9c4:	e8 87 f6 ff ff       	call   50 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+ 9c9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 9cc:	0f b6 1f             	movzbl (%edi),%ebx
+ 9cf:	83 c7 01             	add    $0x1,%edi
+ 9d2:	84 db                	test   %bl,%bl
+ 9d4:	74 39                	je     a0f <printf+0x7f>
+    c = fmt[i] & 0xff;
+ 9d6:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 9d9:	85 f6                	test   %esi,%esi
+ 9db:	74 d3                	je     9b0 <printf+0x20>
+      }
+    } else if(state == '%'){
+ 9dd:	83 fe 25             	cmp    $0x25,%esi
+ 9e0:	75 ea                	jne    9cc <printf+0x3c>
+      if(c == 'd'){
+ 9e2:	83 f8 25             	cmp    $0x25,%eax
+ 9e5:	0f 84 d5 01 00 00    	je     bc0 <printf+0x230>
+ 9eb:	83 e8 63             	sub    $0x63,%eax
+ 9ee:	83 f8 15             	cmp    $0x15,%eax
+ 9f1:	77 45                	ja     a38 <printf+0xa8>
+ 9f3:	ff 24 85 88 0e 00 00 	jmp    *0xe88(,%eax,4)
+ 9fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+ a00:	0f b6 1f             	movzbl (%edi),%ebx
+ a03:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+ a06:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ a0b:	84 db                	test   %bl,%bl
+ a0d:	75 c7                	jne    9d6 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+ a0f:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+ a13:	74 0b                	je     a20 <printf+0x90>
+    fflush(fd);
+}
+ a15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a18:	5b                   	pop    %ebx
+ a19:	5e                   	pop    %esi
+ a1a:	5f                   	pop    %edi
+ a1b:	5d                   	pop    %ebp
+ a1c:	c3                   	ret
+ a1d:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+ a20:	83 ec 0c             	sub    $0xc,%esp
+ a23:	6a 02                	push   $0x2
+ a25:	e8 c6 f7 ff ff       	call   1f0 <fflush>
+ a2a:	83 c4 10             	add    $0x10,%esp
+}
+ a2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a30:	5b                   	pop    %ebx
+ a31:	5e                   	pop    %esi
+ a32:	5f                   	pop    %edi
+ a33:	5d                   	pop    %ebp
+ a34:	c3                   	ret
+ a35:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+ a38:	83 ec 04             	sub    $0x4,%esp
+ a3b:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ a3e:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+ a42:	6a 01                	push   $0x1
+ a44:	52                   	push   %edx
+ a45:	89 55 c0             	mov    %edx,-0x40(%ebp)
+ a48:	ff 75 08             	push   0x8(%ebp)
+ a4b:	e8 00 f6 ff ff       	call   50 <bufwrite>
+ a50:	83 c4 0c             	add    $0xc,%esp
+ a53:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ a56:	6a 01                	push   $0x1
+ a58:	8b 55 c0             	mov    -0x40(%ebp),%edx
+ a5b:	52                   	push   %edx
+      state = 0;
+ a5c:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+ a5e:	ff 75 08             	push   0x8(%ebp)
+ a61:	e8 ea f5 ff ff       	call   50 <bufwrite>
+        putc(fd, c);
+ a66:	83 c4 10             	add    $0x10,%esp
+ a69:	e9 5e ff ff ff       	jmp    9cc <printf+0x3c>
+ a6e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+ a70:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ a73:	83 ec 0c             	sub    $0xc,%esp
+ a76:	b9 10 00 00 00       	mov    $0x10,%ecx
+ a7b:	8b 16                	mov    (%esi),%edx
+ a7d:	6a 00                	push   $0x0
+ a7f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+ a82:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+ a85:	e8 66 fe ff ff       	call   8f0 <printint>
+        ap++;
+ a8a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ a8d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a90:	31 f6                	xor    %esi,%esi
+ a92:	e9 35 ff ff ff       	jmp    9cc <printf+0x3c>
+ a97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a9e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+ aa0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ aa3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ aa5:	83 c0 04             	add    $0x4,%eax
+ aa8:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+ aab:	b8 7f 0e 00 00       	mov    $0xe7f,%eax
+ ab0:	85 db                	test   %ebx,%ebx
+ ab2:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+ ab5:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+ ab8:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+ aba:	53                   	push   %ebx
+ abb:	e8 90 f9 ff ff       	call   450 <strlen>
+ ac0:	83 c4 0c             	add    $0xc,%esp
+ ac3:	50                   	push   %eax
+ ac4:	53                   	push   %ebx
+ ac5:	ff 75 08             	push   0x8(%ebp)
+ ac8:	e8 83 f5 ff ff       	call   50 <bufwrite>
+ acd:	83 c4 10             	add    $0x10,%esp
+ ad0:	e9 f7 fe ff ff       	jmp    9cc <printf+0x3c>
+ ad5:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ ad8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+ adb:	83 ec 04             	sub    $0x4,%esp
+ ade:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+ ae1:	8b 06                	mov    (%esi),%eax
+        ap++;
+ ae3:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+ ae6:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+ ae9:	6a 01                	push   $0x1
+ aeb:	52                   	push   %edx
+ aec:	ff 75 08             	push   0x8(%ebp)
+ aef:	e8 5c f5 ff ff       	call   50 <bufwrite>
+        ap++;
+ af4:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ af7:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ afa:	31 f6                	xor    %esi,%esi
+ afc:	e9 cb fe ff ff       	jmp    9cc <printf+0x3c>
+ b01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+ b08:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ b0b:	83 ec 0c             	sub    $0xc,%esp
+ b0e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ b13:	8b 16                	mov    (%esi),%edx
+ b15:	6a 01                	push   $0x1
+ b17:	e9 63 ff ff ff       	jmp    a7f <printf+0xef>
+ b1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+ b20:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ b23:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ b26:	89 7d c0             	mov    %edi,-0x40(%ebp)
+ b29:	89 55 bc             	mov    %edx,-0x44(%ebp)
+ b2c:	8b 18                	mov    (%eax),%ebx
+ b2e:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+ b31:	31 c0                	xor    %eax,%eax
+ b33:	89 c7                	mov    %eax,%edi
+ b35:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+ b38:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+ b3d:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+ b3f:	f7 e1                	mul    %ecx
+ b41:	c1 ea 03             	shr    $0x3,%edx
+ b44:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ b47:	89 d1                	mov    %edx,%ecx
+ b49:	01 c0                	add    %eax,%eax
+ b4b:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ b4d:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+ b4f:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ b51:	be 0a 00 00 00       	mov    $0xa,%esi
+ b56:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+ b58:	89 da                	mov    %ebx,%edx
+ b5a:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+ b5c:	89 fe                	mov    %edi,%esi
+ b5e:	83 c7 01             	add    $0x1,%edi
+ b61:	8d 42 30             	lea    0x30(%edx),%eax
+ b64:	89 da                	mov    %ebx,%edx
+ b66:	8d 14 92             	lea    (%edx,%edx,4),%edx
+ b69:	01 d2                	add    %edx,%edx
+ b6b:	29 d0                	sub    %edx,%eax
+ b6d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+ b71:	89 c8                	mov    %ecx,%eax
+ b73:	09 d8                	or     %ebx,%eax
+ b75:	75 c1                	jne    b38 <printf+0x1a8>
+ b77:	8b 55 bc             	mov    -0x44(%ebp),%edx
+ b7a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ b7d:	01 d6                	add    %edx,%esi
+ b7f:	89 f7                	mov    %esi,%edi
+ b81:	89 d6                	mov    %edx,%esi
+ b83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b87:	90                   	nop
+    putc(fd, buf[i]);
+ b88:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+ b8b:	83 ec 04             	sub    $0x4,%esp
+ b8e:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+ b91:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+ b94:	6a 01                	push   $0x1
+ b96:	50                   	push   %eax
+ b97:	53                   	push   %ebx
+ b98:	e8 b3 f4 ff ff       	call   50 <bufwrite>
+  while(--i >= 0)
+ b9d:	89 fa                	mov    %edi,%edx
+ b9f:	83 c4 10             	add    $0x10,%esp
+ ba2:	83 ef 01             	sub    $0x1,%edi
+ ba5:	39 d6                	cmp    %edx,%esi
+ ba7:	75 df                	jne    b88 <printf+0x1f8>
+        ap += 2;
+ ba9:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+ bad:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+ bb0:	31 f6                	xor    %esi,%esi
+ bb2:	e9 15 fe ff ff       	jmp    9cc <printf+0x3c>
+ bb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bbe:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+ bc0:	83 ec 04             	sub    $0x4,%esp
+ bc3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ bc6:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ bc9:	6a 01                	push   $0x1
+ bcb:	e9 8b fe ff ff       	jmp    a5b <printf+0xcb>
+
+00000bd0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ bd0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bd1:	a1 00 24 00 00       	mov    0x2400,%eax
+{
+ bd6:	89 e5                	mov    %esp,%ebp
+ bd8:	57                   	push   %edi
+ bd9:	56                   	push   %esi
+ bda:	53                   	push   %ebx
+ bdb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ bde:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ be1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ be8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ bea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bec:	39 ca                	cmp    %ecx,%edx
+ bee:	73 30                	jae    c20 <free+0x50>
+ bf0:	39 c1                	cmp    %eax,%ecx
+ bf2:	72 04                	jb     bf8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ bf4:	39 c2                	cmp    %eax,%edx
+ bf6:	72 f0                	jb     be8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ bf8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ bfb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ bfe:	39 f8                	cmp    %edi,%eax
+ c00:	74 2e                	je     c30 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c02:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ c05:	8b 42 04             	mov    0x4(%edx),%eax
+ c08:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c0b:	39 f1                	cmp    %esi,%ecx
+ c0d:	74 38                	je     c47 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ c0f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ c11:	5b                   	pop    %ebx
+  freep = p;
+ c12:	89 15 00 24 00 00    	mov    %edx,0x2400
+}
+ c18:	5e                   	pop    %esi
+ c19:	5f                   	pop    %edi
+ c1a:	5d                   	pop    %ebp
+ c1b:	c3                   	ret
+ c1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c20:	39 c1                	cmp    %eax,%ecx
+ c22:	72 d0                	jb     bf4 <free+0x24>
+ c24:	eb c2                	jmp    be8 <free+0x18>
+ c26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c2d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ c30:	03 70 04             	add    0x4(%eax),%esi
+ c33:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c36:	8b 02                	mov    (%edx),%eax
+ c38:	8b 00                	mov    (%eax),%eax
+ c3a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ c3d:	8b 42 04             	mov    0x4(%edx),%eax
+ c40:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c43:	39 f1                	cmp    %esi,%ecx
+ c45:	75 c8                	jne    c0f <free+0x3f>
+    p->s.size += bp->s.size;
+ c47:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ c4a:	89 15 00 24 00 00    	mov    %edx,0x2400
+    p->s.size += bp->s.size;
+ c50:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ c53:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ c56:	89 0a                	mov    %ecx,(%edx)
+}
+ c58:	5b                   	pop    %ebx
+ c59:	5e                   	pop    %esi
+ c5a:	5f                   	pop    %edi
+ c5b:	5d                   	pop    %ebp
+ c5c:	c3                   	ret
+ c5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c60 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ c60:	55                   	push   %ebp
+ c61:	89 e5                	mov    %esp,%ebp
+ c63:	57                   	push   %edi
+ c64:	56                   	push   %esi
+ c65:	53                   	push   %ebx
+ c66:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c69:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ c6c:	8b 15 00 24 00 00    	mov    0x2400,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c72:	8d 78 07             	lea    0x7(%eax),%edi
+ c75:	c1 ef 03             	shr    $0x3,%edi
+ c78:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ c7b:	85 d2                	test   %edx,%edx
+ c7d:	0f 84 8d 00 00 00    	je     d10 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c83:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c85:	8b 48 04             	mov    0x4(%eax),%ecx
+ c88:	39 f9                	cmp    %edi,%ecx
+ c8a:	73 64                	jae    cf0 <malloc+0x90>
+  if(nu < 4096)
+ c8c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ c91:	39 df                	cmp    %ebx,%edi
+ c93:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ c96:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ c9d:	eb 0a                	jmp    ca9 <malloc+0x49>
+ c9f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ca0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ca2:	8b 48 04             	mov    0x4(%eax),%ecx
+ ca5:	39 f9                	cmp    %edi,%ecx
+ ca7:	73 47                	jae    cf0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ ca9:	89 c2                	mov    %eax,%edx
+ cab:	39 05 00 24 00 00    	cmp    %eax,0x2400
+ cb1:	75 ed                	jne    ca0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ cb3:	83 ec 0c             	sub    $0xc,%esp
+ cb6:	56                   	push   %esi
+ cb7:	e8 c7 fa ff ff       	call   783 <sbrk>
+  if(p == (char*)-1)
+ cbc:	83 c4 10             	add    $0x10,%esp
+ cbf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ cc2:	74 1c                	je     ce0 <malloc+0x80>
+  hp->s.size = nu;
+ cc4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ cc7:	83 ec 0c             	sub    $0xc,%esp
+ cca:	83 c0 08             	add    $0x8,%eax
+ ccd:	50                   	push   %eax
+ cce:	e8 fd fe ff ff       	call   bd0 <free>
+  return freep;
+ cd3:	8b 15 00 24 00 00    	mov    0x2400,%edx
+      if((p = morecore(nunits)) == 0)
+ cd9:	83 c4 10             	add    $0x10,%esp
+ cdc:	85 d2                	test   %edx,%edx
+ cde:	75 c0                	jne    ca0 <malloc+0x40>
+        return 0;
+  }
+}
+ ce0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ ce3:	31 c0                	xor    %eax,%eax
+}
+ ce5:	5b                   	pop    %ebx
+ ce6:	5e                   	pop    %esi
+ ce7:	5f                   	pop    %edi
+ ce8:	5d                   	pop    %ebp
+ ce9:	c3                   	ret
+ cea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ cf0:	39 cf                	cmp    %ecx,%edi
+ cf2:	74 4c                	je     d40 <malloc+0xe0>
+        p->s.size -= nunits;
+ cf4:	29 f9                	sub    %edi,%ecx
+ cf6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ cf9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ cfc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ cff:	89 15 00 24 00 00    	mov    %edx,0x2400
+}
+ d05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ d08:	83 c0 08             	add    $0x8,%eax
+}
+ d0b:	5b                   	pop    %ebx
+ d0c:	5e                   	pop    %esi
+ d0d:	5f                   	pop    %edi
+ d0e:	5d                   	pop    %ebp
+ d0f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ d10:	c7 05 00 24 00 00 04 	movl   $0x2404,0x2400
+ d17:	24 00 00 
+    base.s.size = 0;
+ d1a:	b8 04 24 00 00       	mov    $0x2404,%eax
+    base.s.ptr = freep = prevp = &base;
+ d1f:	c7 05 04 24 00 00 04 	movl   $0x2404,0x2404
+ d26:	24 00 00 
+    base.s.size = 0;
+ d29:	c7 05 08 24 00 00 00 	movl   $0x0,0x2408
+ d30:	00 00 00 
+    if(p->s.size >= nunits){
+ d33:	e9 54 ff ff ff       	jmp    c8c <malloc+0x2c>
+ d38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d3f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ d40:	8b 08                	mov    (%eax),%ecx
+ d42:	89 0a                	mov    %ecx,(%edx)
+ d44:	eb b9                	jmp    cff <malloc+0x9f>
+ d46:	66 90                	xchg   %ax,%ax
+ d48:	66 90                	xchg   %ax,%ax
+ d4a:	66 90                	xchg   %ax,%ax
+ d4c:	66 90                	xchg   %ax,%ax
+ d4e:	66 90                	xchg   %ax,%ax
+
+00000d50 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+ d50:	55                   	push   %ebp
+ d51:	89 e5                	mov    %esp,%ebp
+ d53:	57                   	push   %edi
+ d54:	56                   	push   %esi
+ d55:	be 01 00 00 00       	mov    $0x1,%esi
+ d5a:	53                   	push   %ebx
+ d5b:	83 ec 28             	sub    $0x28,%esp
+ d5e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ d61:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ d64:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+ d67:	68 00 98 00 00       	push   $0x9800
+ d6c:	e8 ef fe ff ff       	call   c60 <malloc>
+ d71:	83 c4 10             	add    $0x10,%esp
+ d74:	89 c7                	mov    %eax,%edi
+ d76:	85 c0                	test   %eax,%eax
+ d78:	74 62                	je     ddc <waitpoll+0x8c>
+ d7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+ d80:	83 ec 0c             	sub    $0xc,%esp
+ d83:	6a 01                	push   $0x1
+ d85:	e8 03 fa ff ff       	call   78d <sleep>
+    fn();
+ d8a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ d8d:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+ d8f:	58                   	pop    %eax
+ d90:	5a                   	pop    %edx
+ d91:	68 00 02 00 00       	push   $0x200
+ d96:	57                   	push   %edi
+ d97:	e8 eb fa ff ff       	call   887 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+ d9c:	83 c4 10             	add    $0x10,%esp
+ d9f:	85 c0                	test   %eax,%eax
+ da1:	7e 2d                	jle    dd0 <waitpoll+0x80>
+ da3:	6b c0 4c             	imul   $0x4c,%eax,%eax
+ da6:	89 fa                	mov    %edi,%edx
+    alive = 0;
+ da8:	31 c9                	xor    %ecx,%ecx
+ daa:	01 f8                	add    %edi,%eax
+ dac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+ db0:	3b 1a                	cmp    (%edx),%ebx
+ db2:	75 07                	jne    dbb <waitpoll+0x6b>
+        alive = 1;
+ db4:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+ db8:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+ dbb:	83 c2 4c             	add    $0x4c,%edx
+ dbe:	39 d0                	cmp    %edx,%eax
+ dc0:	75 ee                	jne    db0 <waitpoll+0x60>
+  } while(alive);
+ dc2:	85 c9                	test   %ecx,%ecx
+ dc4:	75 ba                	jne    d80 <waitpoll+0x30>
+ dc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dcd:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+ dd0:	83 ec 0c             	sub    $0xc,%esp
+ dd3:	57                   	push   %edi
+ dd4:	e8 f7 fd ff ff       	call   bd0 <free>
+  wait();
+ dd9:	83 c4 10             	add    $0x10,%esp
+}
+ ddc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ddf:	5b                   	pop    %ebx
+ de0:	5e                   	pop    %esi
+ de1:	5f                   	pop    %edi
+ de2:	5d                   	pop    %ebp
+  wait();
+ de3:	e9 10 f9 ff ff       	jmp    6f8 <wait>
+ de8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ def:	90                   	nop
+
+00000df0 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+ df0:	55                   	push   %ebp
+ df1:	89 e5                	mov    %esp,%ebp
+ df3:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+ df6:	c7 45 f0 f1 0e 00 00 	movl   $0xef1,-0x10(%ebp)
+ dfd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+ e04:	e8 87 f4 ff ff       	call   290 <fork>
+ e09:	85 c0                	test   %eax,%eax
+ e0b:	78 09                	js     e16 <runps+0x26>
+    return -1;
+  if(pid == 0){
+ e0d:	74 0e                	je     e1d <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+ e0f:	e8 e4 f8 ff ff       	call   6f8 <wait>
+}
+ e14:	c9                   	leave
+ e15:	c3                   	ret
+ e16:	c9                   	leave
+    return -1;
+ e17:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ e1c:	c3                   	ret
+    exec("ps", argv);
+ e1d:	50                   	push   %eax
+ e1e:	50                   	push   %eax
+ e1f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ e22:	50                   	push   %eax
+ e23:	68 f1 0e 00 00       	push   $0xef1
+ e28:	e8 c3 f4 ff ff       	call   2f0 <exec>
+    printf(2, "exec ps failed\n");
+ e2d:	5a                   	pop    %edx
+ e2e:	59                   	pop    %ecx
+ e2f:	68 f4 0e 00 00       	push   $0xef4
+ e34:	6a 02                	push   $0x2
+ e36:	e8 55 fb ff ff       	call   990 <printf>
+    exit();
+ e3b:	e8 a0 f4 ff ff       	call   2e0 <exit>
@@ -9,6 +9,6 @@ int main() {
   int pid = getpid();
   sleep(69);
   int lifetime = get_process_lifetime(pid);
-  printf(1, "Lifetime of process %d: %d ticks\n", pid, lifetime);
+  printf(1, "Lifetime of process %d: %d ms\n", pid, lifetime);
   exit();
 }
@@ -0,0 +1,2234 @@
+
+_lockbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+         total / ticks, ratio / 100, ratio / 10 % 10, ratio % 10);
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	be 64 00 00 00       	mov    $0x64,%esi
+      14:	53                   	push   %ebx
+      15:	51                   	push   %ecx
+      16:	83 ec 08             	sub    $0x8,%esp
+  int ticks, ncpu, n;
+
+  ticks = argc > 1 ? atoi(argv[1]) : 100;
+      19:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+      1c:	8b 41 04             	mov    0x4(%ecx),%eax
+  ticks = argc > 1 ? atoi(argv[1]) : 100;
+      1f:	7f 38                	jg     59 <main+0x59>
+  if(ticks <= 0 || ticks > 1000){
+    printf(2, "usage: lockbench [ticks (1-1000)]\n");
+    exit();
+  }
+  ncpu = schedlat(sl, NCPU);
+      21:	50                   	push   %eax
+      22:	50                   	push   %eax
+      23:	6a 08                	push   $0x8
+      25:	68 80 16 00 00       	push   $0x1680
+      2a:	e8 d2 0a 00 00       	call   b01 <schedlat>
+  for(n = 1; n <= ncpu; n++)
+      2f:	83 c4 10             	add    $0x10,%esp
+  ncpu = schedlat(sl, NCPU);
+      32:	89 c7                	mov    %eax,%edi
+  for(n = 1; n <= ncpu; n++)
+      34:	85 c0                	test   %eax,%eax
+      36:	7e 1c                	jle    54 <main+0x54>
+      38:	bb 01 00 00 00       	mov    $0x1,%ebx
+      3d:	8d 76 00             	lea    0x0(%esi),%esi
+    run(n, ticks);
+      40:	83 ec 08             	sub    $0x8,%esp
+      43:	56                   	push   %esi
+      44:	53                   	push   %ebx
+  for(n = 1; n <= ncpu; n++)
+      45:	83 c3 01             	add    $0x1,%ebx
+    run(n, ticks);
+      48:	e8 43 00 00 00       	call   90 <run>
+  for(n = 1; n <= ncpu; n++)
+      4d:	83 c4 10             	add    $0x10,%esp
+      50:	39 df                	cmp    %ebx,%edi
+      52:	7d ec                	jge    40 <main+0x40>
+  exit();
+      54:	e8 f7 04 00 00       	call   550 <exit>
+  ticks = argc > 1 ? atoi(argv[1]) : 100;
+      59:	83 ec 0c             	sub    $0xc,%esp
+      5c:	ff 70 04             	push   0x4(%eax)
+      5f:	e8 4c 08 00 00       	call   8b0 <atoi>
+  if(ticks <= 0 || ticks > 1000){
+      64:	83 c4 10             	add    $0x10,%esp
+  ticks = argc > 1 ? atoi(argv[1]) : 100;
+      67:	89 c6                	mov    %eax,%esi
+  if(ticks <= 0 || ticks > 1000){
+      69:	8d 40 ff             	lea    -0x1(%eax),%eax
+      6c:	3d e7 03 00 00       	cmp    $0x3e7,%eax
+      71:	76 ae                	jbe    21 <main+0x21>
+    printf(2, "usage: lockbench [ticks (1-1000)]\n");
+      73:	52                   	push   %edx
+      74:	52                   	push   %edx
+      75:	68 28 11 00 00       	push   $0x1128
+      7a:	6a 02                	push   $0x2
+      7c:	e8 7f 0b 00 00       	call   c00 <printf>
+    exit();
+      81:	e8 ca 04 00 00       	call   550 <exit>
+      86:	66 90                	xchg   %ax,%ax
+      88:	66 90                	xchg   %ax,%ax
+      8a:	66 90                	xchg   %ax,%ax
+      8c:	66 90                	xchg   %ax,%ax
+      8e:	66 90                	xchg   %ax,%ax
+
+00000090 <run>:
+{
+      90:	55                   	push   %ebp
+      91:	89 e5                	mov    %esp,%ebp
+      93:	57                   	push   %edi
+      94:	56                   	push   %esi
+  if(pipe(start) < 0 || pipe(done) < 0){
+      95:	8d 45 d8             	lea    -0x28(%ebp),%eax
+{
+      98:	53                   	push   %ebx
+      99:	83 ec 48             	sub    $0x48,%esp
+  if(pipe(start) < 0 || pipe(done) < 0){
+      9c:	50                   	push   %eax
+      9d:	e8 cd 08 00 00       	call   96f <pipe>
+      a2:	83 c4 10             	add    $0x10,%esp
+      a5:	85 c0                	test   %eax,%eax
+      a7:	0f 88 fb 01 00 00    	js     2a8 <run+0x218>
+      ad:	83 ec 0c             	sub    $0xc,%esp
+      b0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+      b3:	50                   	push   %eax
+      b4:	e8 b6 08 00 00       	call   96f <pipe>
+      b9:	83 c4 10             	add    $0x10,%esp
+      bc:	85 c0                	test   %eax,%eax
+      be:	0f 88 e4 01 00 00    	js     2a8 <run+0x218>
+  for(i = 0; i < nproc; i++){
+      c4:	8b 7d 08             	mov    0x8(%ebp),%edi
+      c7:	8b 75 08             	mov    0x8(%ebp),%esi
+      ca:	31 db                	xor    %ebx,%ebx
+      cc:	85 ff                	test   %edi,%edi
+      ce:	7f 0a                	jg     da <run+0x4a>
+      d0:	e9 63 01 00 00       	jmp    238 <run+0x1a8>
+      d5:	8d 76 00             	lea    0x0(%esi),%esi
+      d8:	89 c3                	mov    %eax,%ebx
+    if((n = fork()) < 0){
+      da:	e8 21 04 00 00       	call   500 <fork>
+      df:	85 c0                	test   %eax,%eax
+      e1:	0f 88 99 01 00 00    	js     280 <run+0x1f0>
+    if(n == 0){
+      e7:	0f 84 60 01 00 00    	je     24d <run+0x1bd>
+  for(i = 0; i < nproc; i++){
+      ed:	8d 43 01             	lea    0x1(%ebx),%eax
+      f0:	39 c6                	cmp    %eax,%esi
+      f2:	75 e4                	jne    d8 <run+0x48>
+  for(i = 0; i < nproc; i++)
+      f4:	31 f6                	xor    %esi,%esi
+      f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      fd:	8d 76 00             	lea    0x0(%esi),%esi
+    write(start[1], "x", 1);
+     100:	83 ec 04             	sub    $0x4,%esp
+     103:	6a 01                	push   $0x1
+     105:	68 e0 10 00 00       	push   $0x10e0
+     10a:	ff 75 dc             	push   -0x24(%ebp)
+     10d:	e8 6b 08 00 00       	call   97d <write>
+  for(i = 0; i < nproc; i++)
+     112:	89 f0                	mov    %esi,%eax
+     114:	83 c4 10             	add    $0x10,%esp
+     117:	83 c6 01             	add    $0x1,%esi
+     11a:	39 d8                	cmp    %ebx,%eax
+     11c:	75 e2                	jne    100 <run+0x70>
+  for(i = 0; i < nproc; i++){
+     11e:	31 d2                	xor    %edx,%edx
+     120:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+  min = -1;
+     123:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  total = max = 0;
+     128:	31 ff                	xor    %edi,%edi
+     12a:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+     131:	89 d3                	mov    %edx,%ebx
+     133:	eb 05                	jmp    13a <run+0xaa>
+     135:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; i < nproc; i++){
+     138:	89 c3                	mov    %eax,%ebx
+    if(read(done[0], &got, sizeof(got)) != sizeof(got)){
+     13a:	83 ec 04             	sub    $0x4,%esp
+     13d:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     140:	6a 04                	push   $0x4
+     142:	50                   	push   %eax
+     143:	ff 75 e0             	push   -0x20(%ebp)
+     146:	e8 2b 08 00 00       	call   976 <read>
+     14b:	83 c4 10             	add    $0x10,%esp
+     14e:	83 f8 04             	cmp    $0x4,%eax
+     151:	0f 85 3d 01 00 00    	jne    294 <run+0x204>
+    total += got;
+     157:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     15a:	01 45 c4             	add    %eax,-0x3c(%ebp)
+     15d:	39 c7                	cmp    %eax,%edi
+     15f:	89 c1                	mov    %eax,%ecx
+     161:	0f 4c f8             	cmovl  %eax,%edi
+    if(min < 0 || got < min)
+     164:	39 c6                	cmp    %eax,%esi
+     166:	0f 4e ce             	cmovle %esi,%ecx
+     169:	85 f6                	test   %esi,%esi
+     16b:	0f 49 c1             	cmovns %ecx,%eax
+     16e:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < nproc; i++){
+     170:	8d 43 01             	lea    0x1(%ebx),%eax
+     173:	39 5d c0             	cmp    %ebx,-0x40(%ebp)
+     176:	75 c0                	jne    138 <run+0xa8>
+  for(i = 0; i < nproc; i++)
+     178:	31 d2                	xor    %edx,%edx
+     17a:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+     17d:	89 75 c0             	mov    %esi,-0x40(%ebp)
+     180:	89 d6                	mov    %edx,%esi
+     182:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+     188:	e8 db 07 00 00       	call   968 <wait>
+  for(i = 0; i < nproc; i++)
+     18d:	89 f0                	mov    %esi,%eax
+     18f:	83 c6 01             	add    $0x1,%esi
+     192:	39 c3                	cmp    %eax,%ebx
+     194:	75 f2                	jne    188 <run+0xf8>
+  ratio = div64((uint64)max * 100, min > 0 ? min : 1);
+     196:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     199:	bb 01 00 00 00       	mov    $0x1,%ebx
+     19e:	b8 64 00 00 00       	mov    $0x64,%eax
+     1a3:	85 f6                	test   %esi,%esi
+     1a5:	0f 4f de             	cmovg  %esi,%ebx
+     1a8:	f7 ef                	imul   %edi
+static inline uint64
+div64(uint64 n, uint d)
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+     1aa:	89 d6                	mov    %edx,%esi
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     1ac:	89 c7                	mov    %eax,%edi
+  close(start[0]);
+     1ae:	83 ec 0c             	sub    $0xc,%esp
+     1b1:	ff 75 d8             	push   -0x28(%ebp)
+     1b4:	e8 07 04 00 00       	call   5c0 <close>
+  close(start[1]);
+     1b9:	58                   	pop    %eax
+     1ba:	ff 75 dc             	push   -0x24(%ebp)
+     1bd:	e8 fe 03 00 00       	call   5c0 <close>
+  close(done[0]);
+     1c2:	5a                   	pop    %edx
+     1c3:	ff 75 e0             	push   -0x20(%ebp)
+     1c6:	e8 f5 03 00 00       	call   5c0 <close>
+  close(done[1]);
+     1cb:	59                   	pop    %ecx
+     1cc:	ff 75 e4             	push   -0x1c(%ebp)
+     1cf:	e8 ec 03 00 00       	call   5c0 <close>
+  hi = (uint)(n >> 32) / d;
+     1d4:	89 f0                	mov    %esi,%eax
+     1d6:	31 d2                	xor    %edx,%edx
+  printf(1, "%d cpus: %d acquires/tick, max/min %d.%d%d\n", nproc,
+     1d8:	83 c4 0c             	add    $0xc,%esp
+     1db:	f7 f3                	div    %ebx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     1dd:	89 f8                	mov    %edi,%eax
+     1df:	f7 f3                	div    %ebx
+     1e1:	bb cd cc cc cc       	mov    $0xcccccccd,%ebx
+     1e6:	89 c7                	mov    %eax,%edi
+     1e8:	f7 e3                	mul    %ebx
+     1ea:	89 d1                	mov    %edx,%ecx
+     1ec:	89 fa                	mov    %edi,%edx
+     1ee:	c1 e9 03             	shr    $0x3,%ecx
+     1f1:	8d 04 89             	lea    (%ecx,%ecx,4),%eax
+     1f4:	01 c0                	add    %eax,%eax
+     1f6:	29 c2                	sub    %eax,%edx
+     1f8:	89 c8                	mov    %ecx,%eax
+     1fa:	52                   	push   %edx
+     1fb:	f7 e3                	mul    %ebx
+     1fd:	89 d3                	mov    %edx,%ebx
+     1ff:	c1 eb 03             	shr    $0x3,%ebx
+     202:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+     205:	01 c0                	add    %eax,%eax
+     207:	29 c1                	sub    %eax,%ecx
+     209:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+     20e:	f7 e7                	mul    %edi
+     210:	51                   	push   %ecx
+     211:	c1 ea 05             	shr    $0x5,%edx
+     214:	52                   	push   %edx
+     215:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     218:	31 d2                	xor    %edx,%edx
+     21a:	f7 75 0c             	divl   0xc(%ebp)
+     21d:	50                   	push   %eax
+     21e:	ff 75 08             	push   0x8(%ebp)
+     221:	68 fc 10 00 00       	push   $0x10fc
+     226:	6a 01                	push   $0x1
+     228:	e8 d3 09 00 00       	call   c00 <printf>
+}
+     22d:	83 c4 20             	add    $0x20,%esp
+     230:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     233:	5b                   	pop    %ebx
+     234:	5e                   	pop    %esi
+     235:	5f                   	pop    %edi
+     236:	5d                   	pop    %ebp
+     237:	c3                   	ret
+  for(i = 0; i < nproc; i++){
+     238:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+     23f:	31 ff                	xor    %edi,%edi
+     241:	31 f6                	xor    %esi,%esi
+     243:	bb 01 00 00 00       	mov    $0x1,%ebx
+     248:	e9 61 ff ff ff       	jmp    1ae <run+0x11e>
+      read(start[0], &c, 1);
+     24d:	83 ec 04             	sub    $0x4,%esp
+     250:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+     253:	6a 01                	push   $0x1
+     255:	50                   	push   %eax
+     256:	ff 75 d8             	push   -0x28(%ebp)
+     259:	e8 18 07 00 00       	call   976 <read>
+      got = lockbench(ticks);
+     25e:	5b                   	pop    %ebx
+     25f:	ff 75 0c             	push   0xc(%ebp)
+     262:	e8 d6 08 00 00       	call   b3d <lockbench>
+      write(done[1], &got, sizeof(got));
+     267:	83 c4 0c             	add    $0xc,%esp
+      got = lockbench(ticks);
+     26a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+      write(done[1], &got, sizeof(got));
+     26d:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     270:	6a 04                	push   $0x4
+     272:	50                   	push   %eax
+     273:	ff 75 e4             	push   -0x1c(%ebp)
+     276:	e8 02 07 00 00       	call   97d <write>
+      exit();
+     27b:	e8 d0 02 00 00       	call   550 <exit>
+      printf(2, "lockbench: fork failed\n");
+     280:	83 ec 08             	sub    $0x8,%esp
+     283:	68 c8 10 00 00       	push   $0x10c8
+     288:	6a 02                	push   $0x2
+     28a:	e8 71 09 00 00       	call   c00 <printf>
+      exit();
+     28f:	e8 bc 02 00 00       	call   550 <exit>
+      printf(2, "lockbench: lost a result\n");
+     294:	83 ec 08             	sub    $0x8,%esp
+     297:	68 e2 10 00 00       	push   $0x10e2
+     29c:	6a 02                	push   $0x2
+     29e:	e8 5d 09 00 00       	call   c00 <printf>
+      exit();
+     2a3:	e8 a8 02 00 00       	call   550 <exit>
+    printf(2, "lockbench: pipe failed\n");
+     2a8:	56                   	push   %esi
+     2a9:	56                   	push   %esi
+     2aa:	68 b0 10 00 00       	push   $0x10b0
+     2af:	6a 02                	push   $0x2
+     2b1:	e8 4a 09 00 00       	call   c00 <printf>
+    exit();
+     2b6:	e8 95 02 00 00       	call   550 <exit>
+     2bb:	66 90                	xchg   %ax,%ax
+     2bd:	66 90                	xchg   %ax,%ax
+     2bf:	90                   	nop
+
+000002c0 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+     2c0:	55                   	push   %ebp
+     2c1:	89 e5                	mov    %esp,%ebp
+     2c3:	57                   	push   %edi
+     2c4:	56                   	push   %esi
+     2c5:	53                   	push   %ebx
+     2c6:	83 ec 4c             	sub    $0x4c,%esp
+     2c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2cc:	8b 55 08             	mov    0x8(%ebp),%edx
+     2cf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     2d2:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+     2d5:	83 fa 0f             	cmp    $0xf,%edx
+     2d8:	0f 87 32 01 00 00    	ja     410 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+     2de:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     2e4:	8b 80 a0 1a 00 00    	mov    0x1aa0(%eax),%eax
+     2ea:	85 c0                	test   %eax,%eax
+     2ec:	0f 84 de 00 00 00    	je     3d0 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+     2f2:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     2f8:	8b b0 a4 1a 00 00    	mov    0x1aa4(%eax),%esi
+     2fe:	8d 88 a0 1a 00 00    	lea    0x1aa0(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+     304:	8d b8 a8 1a 00 00    	lea    0x1aa8(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+     30a:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+     30d:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+     310:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+     313:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+     319:	0f 8f 01 01 00 00    	jg     420 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+     31f:	8d 78 08             	lea    0x8(%eax),%edi
+     322:	8d bc 3e a0 1a 00 00 	lea    0x1aa0(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     329:	85 db                	test   %ebx,%ebx
+     32b:	7e 3b                	jle    368 <bufwrite+0xa8>
+     32d:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+     330:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+     333:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     337:	90                   	nop
+    *dst++ = *src++;
+     338:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     339:	39 c6                	cmp    %eax,%esi
+     33b:	75 fb                	jne    338 <bufwrite+0x78>
+  ob[fd].n += n;
+     33d:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     343:	8b 88 a4 1a 00 00    	mov    0x1aa4(%eax),%ecx
+     349:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     34b:	83 b8 a0 1a 00 00 01 	cmpl   $0x1,0x1aa0(%eax)
+  ob[fd].n += n;
+     352:	89 88 a4 1a 00 00    	mov    %ecx,0x1aa4(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     358:	74 26                	je     380 <bufwrite+0xc0>
+}
+     35a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     35d:	5b                   	pop    %ebx
+     35e:	5e                   	pop    %esi
+     35f:	5f                   	pop    %edi
+     360:	5d                   	pop    %ebp
+     361:	c3                   	ret
+     362:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+     368:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     36b:	83 b8 a0 1a 00 00 01 	cmpl   $0x1,0x1aa0(%eax)
+  ob[fd].n += n;
+     372:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     375:	75 e3                	jne    35a <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+     377:	85 db                	test   %ebx,%ebx
+     379:	74 df                	je     35a <bufwrite+0x9a>
+     37b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     37f:	90                   	nop
+  src = vsrc;
+     380:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     383:	01 c3                	add    %eax,%ebx
+     385:	eb 10                	jmp    397 <bufwrite+0xd7>
+     387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     38e:	66 90                	xchg   %ax,%ax
+     390:	83 c0 01             	add    $0x1,%eax
+     393:	39 d8                	cmp    %ebx,%eax
+     395:	74 c3                	je     35a <bufwrite+0x9a>
+    if(*p == (char)c)
+     397:	80 38 0a             	cmpb   $0xa,(%eax)
+     39a:	75 f4                	jne    390 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     39c:	85 c9                	test   %ecx,%ecx
+     39e:	7e ba                	jle    35a <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+     3a0:	83 ec 04             	sub    $0x4,%esp
+     3a3:	51                   	push   %ecx
+     3a4:	ff 75 ac             	push   -0x54(%ebp)
+     3a7:	52                   	push   %edx
+     3a8:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+     3ab:	e8 cd 05 00 00       	call   97d <write>
+    ob[fd].n = 0;
+     3b0:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     3b3:	83 c4 10             	add    $0x10,%esp
+     3b6:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+     3bc:	c7 82 a4 1a 00 00 00 	movl   $0x0,0x1aa4(%edx)
+     3c3:	00 00 00 
+     3c6:	eb 92                	jmp    35a <bufwrite+0x9a>
+     3c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3cf:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     3d0:	83 ec 08             	sub    $0x8,%esp
+     3d3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     3d6:	50                   	push   %eax
+     3d7:	52                   	push   %edx
+     3d8:	89 55 b0             	mov    %edx,-0x50(%ebp)
+     3db:	e8 d7 05 00 00       	call   9b7 <fstat>
+     3e0:	83 c4 10             	add    $0x10,%esp
+     3e3:	8b 55 b0             	mov    -0x50(%ebp),%edx
+     3e6:	89 c1                	mov    %eax,%ecx
+     3e8:	b8 02 00 00 00       	mov    $0x2,%eax
+     3ed:	85 c9                	test   %ecx,%ecx
+     3ef:	75 0d                	jne    3fe <bufwrite+0x13e>
+     3f1:	31 c0                	xor    %eax,%eax
+     3f3:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     3f8:	0f 95 c0             	setne  %al
+     3fb:	83 c0 01             	add    $0x1,%eax
+     3fe:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+     404:	89 81 a0 1a 00 00    	mov    %eax,0x1aa0(%ecx)
+     40a:	e9 e3 fe ff ff       	jmp    2f2 <bufwrite+0x32>
+     40f:	90                   	nop
+}
+     410:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     413:	5b                   	pop    %ebx
+     414:	5e                   	pop    %esi
+     415:	5f                   	pop    %edi
+     416:	5d                   	pop    %ebp
+    write(fd, p, n);
+     417:	e9 61 05 00 00       	jmp    97d <write>
+     41c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+     420:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+     423:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+     426:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+     429:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+     42c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+     42f:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+     432:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+     435:	6a 02                	push   $0x2
+     437:	50                   	push   %eax
+     438:	52                   	push   %edx
+     439:	e8 9b 06 00 00       	call   ad9 <writev>
+    ob[fd].n = 0;
+     43e:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+     441:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+     444:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+     44b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     44e:	5b                   	pop    %ebx
+     44f:	5e                   	pop    %esi
+     450:	5f                   	pop    %edi
+     451:	5d                   	pop    %ebp
+     452:	c3                   	ret
+     453:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     45a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000460 <fflush>:
+{
+     460:	55                   	push   %ebp
+     461:	89 e5                	mov    %esp,%ebp
+     463:	53                   	push   %ebx
+     464:	83 ec 04             	sub    $0x4,%esp
+     467:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     46a:	83 f8 0f             	cmp    $0xf,%eax
+     46d:	77 16                	ja     485 <fflush+0x25>
+     46f:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+     475:	8b 8a a4 1a 00 00    	mov    0x1aa4(%edx),%ecx
+     47b:	8d 9a a0 1a 00 00    	lea    0x1aa0(%edx),%ebx
+     481:	85 c9                	test   %ecx,%ecx
+     483:	7f 0b                	jg     490 <fflush+0x30>
+}
+     485:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     488:	c9                   	leave
+     489:	c3                   	ret
+     48a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     490:	83 ec 04             	sub    $0x4,%esp
+     493:	81 c2 a8 1a 00 00    	add    $0x1aa8,%edx
+     499:	51                   	push   %ecx
+     49a:	52                   	push   %edx
+     49b:	50                   	push   %eax
+     49c:	e8 dc 04 00 00       	call   97d <write>
+    ob[fd].n = 0;
+     4a1:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     4a8:	83 c4 10             	add    $0x10,%esp
+}
+     4ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4ae:	c9                   	leave
+     4af:	c3                   	ret
+
+000004b0 <fflushall>:
+{
+     4b0:	55                   	push   %ebp
+     4b1:	89 e5                	mov    %esp,%ebp
+     4b3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     4b4:	31 f6                	xor    %esi,%esi
+{
+     4b6:	53                   	push   %ebx
+     4b7:	bb a8 1a 00 00       	mov    $0x1aa8,%ebx
+     4bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     4c0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     4c3:	85 c0                	test   %eax,%eax
+     4c5:	7e 15                	jle    4dc <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     4c7:	83 ec 04             	sub    $0x4,%esp
+     4ca:	50                   	push   %eax
+     4cb:	53                   	push   %ebx
+     4cc:	56                   	push   %esi
+     4cd:	e8 ab 04 00 00       	call   97d <write>
+    ob[fd].n = 0;
+     4d2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     4d9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     4dc:	83 c6 01             	add    $0x1,%esi
+     4df:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     4e5:	83 fe 10             	cmp    $0x10,%esi
+     4e8:	75 d6                	jne    4c0 <fflushall+0x10>
+}
+     4ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4ed:	5b                   	pop    %ebx
+     4ee:	5e                   	pop    %esi
+     4ef:	5d                   	pop    %ebp
+     4f0:	c3                   	ret
+     4f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ff:	90                   	nop
+
+00000500 <fork>:
+{
+     500:	55                   	push   %ebp
+     501:	89 e5                	mov    %esp,%ebp
+     503:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     504:	31 f6                	xor    %esi,%esi
+{
+     506:	53                   	push   %ebx
+     507:	bb a8 1a 00 00       	mov    $0x1aa8,%ebx
+     50c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     510:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     513:	85 c0                	test   %eax,%eax
+     515:	7e 15                	jle    52c <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     517:	83 ec 04             	sub    $0x4,%esp
+     51a:	50                   	push   %eax
+     51b:	53                   	push   %ebx
+     51c:	56                   	push   %esi
+     51d:	e8 5b 04 00 00       	call   97d <write>
+    ob[fd].n = 0;
+     522:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     529:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     52c:	83 c6 01             	add    $0x1,%esi
+     52f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     535:	83 fe 10             	cmp    $0x10,%esi
+     538:	75 d6                	jne    510 <fork+0x10>
+}
+     53a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     53d:	5b                   	pop    %ebx
+     53e:	5e                   	pop    %esi
+     53f:	5d                   	pop    %ebp
+  return _fork();
+     540:	e9 15 04 00 00       	jmp    95a <_fork>
+     545:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <exit>:
+{
+     550:	55                   	push   %ebp
+     551:	89 e5                	mov    %esp,%ebp
+     553:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+     556:	e8 55 ff ff ff       	call   4b0 <fflushall>
+  _exit();
+     55b:	e8 01 04 00 00       	call   961 <_exit>
+
+00000560 <exec>:
+{
+     560:	55                   	push   %ebp
+     561:	89 e5                	mov    %esp,%ebp
+     563:	57                   	push   %edi
+     564:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     565:	31 f6                	xor    %esi,%esi
+{
+     567:	53                   	push   %ebx
+     568:	bb a8 1a 00 00       	mov    $0x1aa8,%ebx
+     56d:	83 ec 1c             	sub    $0x1c,%esp
+     570:	8b 45 08             	mov    0x8(%ebp),%eax
+     573:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     576:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     579:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     580:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     583:	85 c0                	test   %eax,%eax
+     585:	7e 15                	jle    59c <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     587:	83 ec 04             	sub    $0x4,%esp
+     58a:	50                   	push   %eax
+     58b:	53                   	push   %ebx
+     58c:	56                   	push   %esi
+     58d:	e8 eb 03 00 00       	call   97d <write>
+    ob[fd].n = 0;
+     592:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     599:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     59c:	83 c6 01             	add    $0x1,%esi
+     59f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     5a5:	83 fe 10             	cmp    $0x10,%esi
+     5a8:	75 d6                	jne    580 <exec+0x20>
+  return _exec(path, argv);
+     5aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     5ad:	89 7d 0c             	mov    %edi,0xc(%ebp)
+     5b0:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     5b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     5b6:	5b                   	pop    %ebx
+     5b7:	5e                   	pop    %esi
+     5b8:	5f                   	pop    %edi
+     5b9:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     5ba:	e9 d3 03 00 00       	jmp    992 <_exec>
+     5bf:	90                   	nop
+
+000005c0 <close>:
+{
+     5c0:	55                   	push   %ebp
+     5c1:	89 e5                	mov    %esp,%ebp
+     5c3:	56                   	push   %esi
+     5c4:	53                   	push   %ebx
+     5c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     5c8:	83 fb 0f             	cmp    $0xf,%ebx
+     5cb:	77 26                	ja     5f3 <close+0x33>
+     5cd:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     5d3:	8b 90 a4 1a 00 00    	mov    0x1aa4(%eax),%edx
+     5d9:	8d b0 a0 1a 00 00    	lea    0x1aa0(%eax),%esi
+     5df:	85 d2                	test   %edx,%edx
+     5e1:	7f 25                	jg     608 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+     5e3:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     5e9:	c7 80 a0 1a 00 00 00 	movl   $0x0,0x1aa0(%eax)
+     5f0:	00 00 00 
+  return _close(fd);
+     5f3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     5f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5f9:	5b                   	pop    %ebx
+     5fa:	5e                   	pop    %esi
+     5fb:	5d                   	pop    %ebp
+  return _close(fd);
+     5fc:	e9 83 03 00 00       	jmp    984 <_close>
+     601:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     608:	83 ec 04             	sub    $0x4,%esp
+     60b:	05 a8 1a 00 00       	add    $0x1aa8,%eax
+     610:	52                   	push   %edx
+     611:	50                   	push   %eax
+     612:	53                   	push   %ebx
+     613:	e8 65 03 00 00       	call   97d <write>
+    ob[fd].n = 0;
+     618:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+     61f:	83 c4 10             	add    $0x10,%esp
+     622:	eb bf                	jmp    5e3 <close+0x23>
+     624:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     62b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     62f:	90                   	nop
+
+00000630 <strcpy>:
+{
+     630:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+     631:	31 c0                	xor    %eax,%eax
+{
+     633:	89 e5                	mov    %esp,%ebp
+     635:	53                   	push   %ebx
+     636:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     639:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     63c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     640:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     644:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     647:	83 c0 01             	add    $0x1,%eax
+     64a:	84 d2                	test   %dl,%dl
+     64c:	75 f2                	jne    640 <strcpy+0x10>
+}
+     64e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     651:	89 c8                	mov    %ecx,%eax
+     653:	c9                   	leave
+     654:	c3                   	ret
+     655:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     65c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000660 <strcmp>:
+{
+     660:	55                   	push   %ebp
+     661:	89 e5                	mov    %esp,%ebp
+     663:	53                   	push   %ebx
+     664:	8b 55 08             	mov    0x8(%ebp),%edx
+     667:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     66a:	0f b6 02             	movzbl (%edx),%eax
+     66d:	84 c0                	test   %al,%al
+     66f:	75 17                	jne    688 <strcmp+0x28>
+     671:	eb 3a                	jmp    6ad <strcmp+0x4d>
+     673:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     677:	90                   	nop
+     678:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     67c:	83 c2 01             	add    $0x1,%edx
+     67f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     682:	84 c0                	test   %al,%al
+     684:	74 1a                	je     6a0 <strcmp+0x40>
+    p++, q++;
+     686:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     688:	0f b6 19             	movzbl (%ecx),%ebx
+     68b:	38 c3                	cmp    %al,%bl
+     68d:	74 e9                	je     678 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     68f:	29 d8                	sub    %ebx,%eax
+}
+     691:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     694:	c9                   	leave
+     695:	c3                   	ret
+     696:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     69d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     6a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     6a4:	31 c0                	xor    %eax,%eax
+     6a6:	29 d8                	sub    %ebx,%eax
+}
+     6a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6ab:	c9                   	leave
+     6ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     6ad:	0f b6 19             	movzbl (%ecx),%ebx
+     6b0:	31 c0                	xor    %eax,%eax
+     6b2:	eb db                	jmp    68f <strcmp+0x2f>
+     6b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6bf:	90                   	nop
+
+000006c0 <strlen>:
+{
+     6c0:	55                   	push   %ebp
+     6c1:	89 e5                	mov    %esp,%ebp
+     6c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+     6c6:	80 3a 00             	cmpb   $0x0,(%edx)
+     6c9:	74 15                	je     6e0 <strlen+0x20>
+     6cb:	31 c0                	xor    %eax,%eax
+     6cd:	8d 76 00             	lea    0x0(%esi),%esi
+     6d0:	83 c0 01             	add    $0x1,%eax
+     6d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     6d7:	89 c1                	mov    %eax,%ecx
+     6d9:	75 f5                	jne    6d0 <strlen+0x10>
+}
+     6db:	89 c8                	mov    %ecx,%eax
+     6dd:	5d                   	pop    %ebp
+     6de:	c3                   	ret
+     6df:	90                   	nop
+  for(n = 0; s[n]; n++)
+     6e0:	31 c9                	xor    %ecx,%ecx
+}
+     6e2:	5d                   	pop    %ebp
+     6e3:	89 c8                	mov    %ecx,%eax
+     6e5:	c3                   	ret
+     6e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006f0 <memset>:
+{
+     6f0:	55                   	push   %ebp
+     6f1:	89 e5                	mov    %esp,%ebp
+     6f3:	57                   	push   %edi
+     6f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("cld; rep stosb" :
+     6f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     6fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+     6fd:	89 d7                	mov    %edx,%edi
+     6ff:	fc                   	cld
+     700:	f3 aa                	rep stos %al,%es:(%edi)
+}
+     702:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     705:	89 d0                	mov    %edx,%eax
+     707:	c9                   	leave
+     708:	c3                   	ret
+     709:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000710 <strchr>:
+{
+     710:	55                   	push   %ebp
+     711:	89 e5                	mov    %esp,%ebp
+     713:	8b 45 08             	mov    0x8(%ebp),%eax
+     716:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     71a:	0f b6 10             	movzbl (%eax),%edx
+     71d:	84 d2                	test   %dl,%dl
+     71f:	75 12                	jne    733 <strchr+0x23>
+     721:	eb 1d                	jmp    740 <strchr+0x30>
+     723:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     727:	90                   	nop
+     728:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     72c:	83 c0 01             	add    $0x1,%eax
+     72f:	84 d2                	test   %dl,%dl
+     731:	74 0d                	je     740 <strchr+0x30>
+    if(*s == c)
+     733:	38 d1                	cmp    %dl,%cl
+     735:	75 f1                	jne    728 <strchr+0x18>
+}
+     737:	5d                   	pop    %ebp
+     738:	c3                   	ret
+     739:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     740:	31 c0                	xor    %eax,%eax
+}
+     742:	5d                   	pop    %ebp
+     743:	c3                   	ret
+     744:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     74b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     74f:	90                   	nop
+
+00000750 <memchr>:
+{
+     750:	55                   	push   %ebp
+     751:	89 e5                	mov    %esp,%ebp
+     753:	8b 55 10             	mov    0x10(%ebp),%edx
+     756:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     759:	85 d2                	test   %edx,%edx
+     75b:	74 1b                	je     778 <memchr+0x28>
+    if(*p == (char)c)
+     75d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+     761:	01 c2                	add    %eax,%edx
+     763:	eb 0a                	jmp    76f <memchr+0x1f>
+     765:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+     768:	83 c0 01             	add    $0x1,%eax
+     76b:	39 c2                	cmp    %eax,%edx
+     76d:	74 09                	je     778 <memchr+0x28>
+    if(*p == (char)c)
+     76f:	38 08                	cmp    %cl,(%eax)
+     771:	75 f5                	jne    768 <memchr+0x18>
+}
+     773:	5d                   	pop    %ebp
+     774:	c3                   	ret
+     775:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+     778:	31 c0                	xor    %eax,%eax
+}
+     77a:	5d                   	pop    %ebp
+     77b:	c3                   	ret
+     77c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000780 <gets>:
+{
+     780:	55                   	push   %ebp
+     781:	89 e5                	mov    %esp,%ebp
+     783:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+     784:	31 ff                	xor    %edi,%edi
+{
+     786:	56                   	push   %esi
+     787:	be a8 1a 00 00       	mov    $0x1aa8,%esi
+     78c:	53                   	push   %ebx
+     78d:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     790:	8b 46 fc             	mov    -0x4(%esi),%eax
+     793:	85 c0                	test   %eax,%eax
+     795:	7e 15                	jle    7ac <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     797:	83 ec 04             	sub    $0x4,%esp
+     79a:	50                   	push   %eax
+     79b:	56                   	push   %esi
+     79c:	57                   	push   %edi
+     79d:	e8 db 01 00 00       	call   97d <write>
+    ob[fd].n = 0;
+     7a2:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+     7a9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     7ac:	83 c7 01             	add    $0x1,%edi
+     7af:	81 c6 08 01 00 00    	add    $0x108,%esi
+     7b5:	83 ff 10             	cmp    $0x10,%edi
+     7b8:	75 d6                	jne    790 <gets+0x10>
+  for(i=0; i+1 < max; ){
+     7ba:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+     7bc:	8d 75 e7             	lea    -0x19(%ebp),%esi
+     7bf:	eb 2e                	jmp    7ef <gets+0x6f>
+     7c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7c8:	83 ec 04             	sub    $0x4,%esp
+     7cb:	6a 01                	push   $0x1
+     7cd:	56                   	push   %esi
+     7ce:	6a 00                	push   $0x0
+     7d0:	e8 a1 01 00 00       	call   976 <read>
+    if(cc < 1)
+     7d5:	83 c4 10             	add    $0x10,%esp
+     7d8:	85 c0                	test   %eax,%eax
+     7da:	7e 1d                	jle    7f9 <gets+0x79>
+    buf[i++] = c;
+     7dc:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     7e0:	8b 55 08             	mov    0x8(%ebp),%edx
+     7e3:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     7e7:	3c 0a                	cmp    $0xa,%al
+     7e9:	74 10                	je     7fb <gets+0x7b>
+     7eb:	3c 0d                	cmp    $0xd,%al
+     7ed:	74 0c                	je     7fb <gets+0x7b>
+  for(i=0; i+1 < max; ){
+     7ef:	89 df                	mov    %ebx,%edi
+     7f1:	83 c3 01             	add    $0x1,%ebx
+     7f4:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     7f7:	7c cf                	jl     7c8 <gets+0x48>
+     7f9:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     7fb:	8b 45 08             	mov    0x8(%ebp),%eax
+     7fe:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     802:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     805:	5b                   	pop    %ebx
+     806:	5e                   	pop    %esi
+     807:	5f                   	pop    %edi
+     808:	5d                   	pop    %ebp
+     809:	c3                   	ret
+     80a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000810 <stat>:
+{
+     810:	55                   	push   %ebp
+     811:	89 e5                	mov    %esp,%ebp
+     813:	57                   	push   %edi
+     814:	56                   	push   %esi
+     815:	53                   	push   %ebx
+     816:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+     819:	6a 00                	push   $0x0
+     81b:	ff 75 08             	push   0x8(%ebp)
+     81e:	e8 76 01 00 00       	call   999 <open>
+  if(fd < 0)
+     823:	83 c4 10             	add    $0x10,%esp
+     826:	85 c0                	test   %eax,%eax
+     828:	78 76                	js     8a0 <stat+0x90>
+  r = fstat(fd, st);
+     82a:	83 ec 08             	sub    $0x8,%esp
+     82d:	ff 75 0c             	push   0xc(%ebp)
+     830:	89 c3                	mov    %eax,%ebx
+     832:	50                   	push   %eax
+     833:	e8 7f 01 00 00       	call   9b7 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     838:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     83b:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     83d:	83 fb 0f             	cmp    $0xf,%ebx
+     840:	7f 40                	jg     882 <stat+0x72>
+     842:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     848:	8b 90 a4 1a 00 00    	mov    0x1aa4(%eax),%edx
+     84e:	8d b8 a0 1a 00 00    	lea    0x1aa0(%eax),%edi
+     854:	85 d2                	test   %edx,%edx
+     856:	7e 1a                	jle    872 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+     858:	83 ec 04             	sub    $0x4,%esp
+     85b:	05 a8 1a 00 00       	add    $0x1aa8,%eax
+     860:	52                   	push   %edx
+     861:	50                   	push   %eax
+     862:	53                   	push   %ebx
+     863:	e8 15 01 00 00       	call   97d <write>
+    ob[fd].n = 0;
+     868:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+     86f:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+     872:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     878:	c7 80 a0 1a 00 00 00 	movl   $0x0,0x1aa0(%eax)
+     87f:	00 00 00 
+  return _close(fd);
+     882:	83 ec 0c             	sub    $0xc,%esp
+     885:	53                   	push   %ebx
+     886:	e8 f9 00 00 00       	call   984 <_close>
+     88b:	83 c4 10             	add    $0x10,%esp
+}
+     88e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     891:	89 f0                	mov    %esi,%eax
+     893:	5b                   	pop    %ebx
+     894:	5e                   	pop    %esi
+     895:	5f                   	pop    %edi
+     896:	5d                   	pop    %ebp
+     897:	c3                   	ret
+     898:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     89f:	90                   	nop
+    return -1;
+     8a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     8a5:	eb e7                	jmp    88e <stat+0x7e>
+     8a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ae:	66 90                	xchg   %ax,%ax
+
+000008b0 <atoi>:
+{
+     8b0:	55                   	push   %ebp
+     8b1:	89 e5                	mov    %esp,%ebp
+     8b3:	53                   	push   %ebx
+     8b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     8b7:	0f be 02             	movsbl (%edx),%eax
+     8ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     8bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     8c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     8c5:	77 1e                	ja     8e5 <atoi+0x35>
+     8c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     8d0:	83 c2 01             	add    $0x1,%edx
+     8d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     8d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     8da:	0f be 02             	movsbl (%edx),%eax
+     8dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     8e0:	80 fb 09             	cmp    $0x9,%bl
+     8e3:	76 eb                	jbe    8d0 <atoi+0x20>
+}
+     8e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8e8:	89 c8                	mov    %ecx,%eax
+     8ea:	c9                   	leave
+     8eb:	c3                   	ret
+     8ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008f0 <memmove>:
+{
+     8f0:	55                   	push   %ebp
+     8f1:	89 e5                	mov    %esp,%ebp
+     8f3:	57                   	push   %edi
+     8f4:	56                   	push   %esi
+     8f5:	8b 45 10             	mov    0x10(%ebp),%eax
+     8f8:	8b 55 08             	mov    0x8(%ebp),%edx
+     8fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     8fe:	85 c0                	test   %eax,%eax
+     900:	7e 13                	jle    915 <memmove+0x25>
+     902:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     904:	89 d7                	mov    %edx,%edi
+     906:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     90d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     910:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     911:	39 f8                	cmp    %edi,%eax
+     913:	75 fb                	jne    910 <memmove+0x20>
+  return vdst;
+}
+     915:	5e                   	pop    %esi
+     916:	89 d0                	mov    %edx,%eax
+     918:	5f                   	pop    %edi
+     919:	5d                   	pop    %ebp
+     91a:	c3                   	ret
+
+0000091b <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+     91b:	83 3d 70 16 00 00 00 	cmpl   $0x0,0x1670
+  jle 1f
+     922:	7e 0a                	jle    92e <syscallentry+0x13>
+  movl %esp, %ecx
+     924:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+     926:	ba 2d 09 00 00       	mov    $0x92d,%edx
+  sysenter
+     92b:	0f 34                	sysenter
+2:
+  ret
+     92d:	c3                   	ret
+1:
+  jl 3f
+     92e:	7c 27                	jl     957 <syscallentry+0x3c>
+  pushal
+     930:	60                   	pusha
+  movl $1, %eax
+     931:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     936:	0f a2                	cpuid
+  movl $-1, sysentermode
+     938:	c7 05 70 16 00 00 ff 	movl   $0xffffffff,0x1670
+     93f:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     942:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+     948:	74 0a                	je     954 <syscallentry+0x39>
+  movl $1, sysentermode
+     94a:	c7 05 70 16 00 00 01 	movl   $0x1,0x1670
+     951:	00 00 00 
+4:
+  popal
+     954:	61                   	popa
+  jmp syscallentry
+     955:	eb c4                	jmp    91b <syscallentry>
+3:
+  int $T_SYSCALL
+     957:	cd 40                	int    $0x40
+  ret
+     959:	c3                   	ret
+
+0000095a <_fork>:
+
+SYSCALLAS(_fork, fork)
+     95a:	b8 01 00 00 00       	mov    $0x1,%eax
+     95f:	eb ba                	jmp    91b <syscallentry>
+
+00000961 <_exit>:
+SYSCALLAS(_exit, exit)
+     961:	b8 02 00 00 00       	mov    $0x2,%eax
+     966:	eb b3                	jmp    91b <syscallentry>
+
+00000968 <wait>:
+SYSCALL(wait)
+     968:	b8 03 00 00 00       	mov    $0x3,%eax
+     96d:	eb ac                	jmp    91b <syscallentry>
+
+0000096f <pipe>:
+SYSCALL(pipe)
+     96f:	b8 04 00 00 00       	mov    $0x4,%eax
+     974:	eb a5                	jmp    91b <syscallentry>
+
+00000976 <read>:
+SYSCALL(read)
+     976:	b8 05 00 00 00       	mov    $0x5,%eax
+     97b:	eb 9e                	jmp    91b <syscallentry>
+
+0000097d <write>:
+SYSCALL(write)
+     97d:	b8 10 00 00 00       	mov    $0x10,%eax
+     982:	eb 97                	jmp    91b <syscallentry>
+
+00000984 <_close>:
+SYSCALLAS(_close, close)
+     984:	b8 15 00 00 00       	mov    $0x15,%eax
+     989:	eb 90                	jmp    91b <syscallentry>
+
+0000098b <kill>:
+SYSCALL(kill)
+     98b:	b8 06 00 00 00       	mov    $0x6,%eax
+     990:	eb 89                	jmp    91b <syscallentry>
+
+00000992 <_exec>:
+SYSCALLAS(_exec, exec)
+     992:	b8 07 00 00 00       	mov    $0x7,%eax
+     997:	eb 82                	jmp    91b <syscallentry>
+
+00000999 <open>:
+SYSCALL(open)
+     999:	b8 0f 00 00 00       	mov    $0xf,%eax
+     99e:	e9 78 ff ff ff       	jmp    91b <syscallentry>
+
+000009a3 <mknod>:
+SYSCALL(mknod)
+     9a3:	b8 11 00 00 00       	mov    $0x11,%eax
+     9a8:	e9 6e ff ff ff       	jmp    91b <syscallentry>
+
+000009ad <unlink>:
+SYSCALL(unlink)
+     9ad:	b8 12 00 00 00       	mov    $0x12,%eax
+     9b2:	e9 64 ff ff ff       	jmp    91b <syscallentry>
+
+000009b7 <fstat>:
+SYSCALL(fstat)
+     9b7:	b8 08 00 00 00       	mov    $0x8,%eax
+     9bc:	e9 5a ff ff ff       	jmp    91b <syscallentry>
+
+000009c1 <link>:
+SYSCALL(link)
+     9c1:	b8 13 00 00 00       	mov    $0x13,%eax
+     9c6:	e9 50 ff ff ff       	jmp    91b <syscallentry>
+
+000009cb <mkdir>:
+SYSCALL(mkdir)
+     9cb:	b8 14 00 00 00       	mov    $0x14,%eax
+     9d0:	e9 46 ff ff ff       	jmp    91b <syscallentry>
+
+000009d5 <chdir>:
+SYSCALL(chdir)
+     9d5:	b8 09 00 00 00       	mov    $0x9,%eax
+     9da:	e9 3c ff ff ff       	jmp    91b <syscallentry>
+
+000009df <dup>:
+SYSCALL(dup)
+     9df:	b8 0a 00 00 00       	mov    $0xa,%eax
+     9e4:	e9 32 ff ff ff       	jmp    91b <syscallentry>
+
+000009e9 <getpid>:
+SYSCALL(getpid)
+     9e9:	b8 0b 00 00 00       	mov    $0xb,%eax
+     9ee:	e9 28 ff ff ff       	jmp    91b <syscallentry>
+
+000009f3 <sbrk>:
+SYSCALL(sbrk)
+     9f3:	b8 0c 00 00 00       	mov    $0xc,%eax
+     9f8:	e9 1e ff ff ff       	jmp    91b <syscallentry>
+
+000009fd <sleep>:
+SYSCALL(sleep)
+     9fd:	b8 0d 00 00 00       	mov    $0xd,%eax
+     a02:	e9 14 ff ff ff       	jmp    91b <syscallentry>
+
+00000a07 <uptime>:
+SYSCALL(uptime)
+     a07:	b8 0e 00 00 00       	mov    $0xe,%eax
+     a0c:	e9 0a ff ff ff       	jmp    91b <syscallentry>
+
+00000a11 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+     a11:	b8 16 00 00 00       	mov    $0x16,%eax
+     a16:	e9 00 ff ff ff       	jmp    91b <syscallentry>
+
+00000a1b <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+     a1b:	b8 17 00 00 00       	mov    $0x17,%eax
+     a20:	e9 f6 fe ff ff       	jmp    91b <syscallentry>
+
+00000a25 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+     a25:	b8 18 00 00 00       	mov    $0x18,%eax
+     a2a:	e9 ec fe ff ff       	jmp    91b <syscallentry>
+
+00000a2f <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+     a2f:	b8 19 00 00 00       	mov    $0x19,%eax
+     a34:	e9 e2 fe ff ff       	jmp    91b <syscallentry>
+
+00000a39 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+     a39:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     a3e:	e9 d8 fe ff ff       	jmp    91b <syscallentry>
+
+00000a43 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+     a43:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     a48:	e9 ce fe ff ff       	jmp    91b <syscallentry>
+
+00000a4d <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+     a4d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     a52:	e9 c4 fe ff ff       	jmp    91b <syscallentry>
+
+00000a57 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+     a57:	b8 20 00 00 00       	mov    $0x20,%eax
+     a5c:	e9 ba fe ff ff       	jmp    91b <syscallentry>
+
+00000a61 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+     a61:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     a66:	e9 b0 fe ff ff       	jmp    91b <syscallentry>
+
+00000a6b <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+     a6b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     a70:	e9 a6 fe ff ff       	jmp    91b <syscallentry>
+
+00000a75 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+     a75:	b8 21 00 00 00       	mov    $0x21,%eax
+     a7a:	e9 9c fe ff ff       	jmp    91b <syscallentry>
+
+00000a7f <yield>:
+SYSCALL(yield) // yield the CPU to another process
+     a7f:	b8 22 00 00 00       	mov    $0x22,%eax
+     a84:	e9 92 fe ff ff       	jmp    91b <syscallentry>
+
+00000a89 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+     a89:	b8 23 00 00 00       	mov    $0x23,%eax
+     a8e:	e9 88 fe ff ff       	jmp    91b <syscallentry>
+
+00000a93 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+     a93:	b8 24 00 00 00       	mov    $0x24,%eax
+     a98:	e9 7e fe ff ff       	jmp    91b <syscallentry>
+
+00000a9d <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+     a9d:	b8 25 00 00 00       	mov    $0x25,%eax
+     aa2:	e9 74 fe ff ff       	jmp    91b <syscallentry>
+
+00000aa7 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+     aa7:	b8 26 00 00 00       	mov    $0x26,%eax
+     aac:	e9 6a fe ff ff       	jmp    91b <syscallentry>
+
+00000ab1 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+     ab1:	b8 27 00 00 00       	mov    $0x27,%eax
+     ab6:	e9 60 fe ff ff       	jmp    91b <syscallentry>
+
+00000abb <mmap>:
+SYSCALL(mmap) // map a file into memory
+     abb:	b8 28 00 00 00       	mov    $0x28,%eax
+     ac0:	e9 56 fe ff ff       	jmp    91b <syscallentry>
+
+00000ac5 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+     ac5:	b8 29 00 00 00       	mov    $0x29,%eax
+     aca:	e9 4c fe ff ff       	jmp    91b <syscallentry>
+
+00000acf <readv>:
+SYSCALL(readv) // read into several buffers
+     acf:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     ad4:	e9 42 fe ff ff       	jmp    91b <syscallentry>
+
+00000ad9 <writev>:
+SYSCALL(writev) // write from several buffers
+     ad9:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     ade:	e9 38 fe ff ff       	jmp    91b <syscallentry>
+
+00000ae3 <pread>:
+SYSCALL(pread) // read at an offset
+     ae3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     ae8:	e9 2e fe ff ff       	jmp    91b <syscallentry>
+
+00000aed <pwrite>:
+SYSCALL(pwrite) // write at an offset
+     aed:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     af2:	e9 24 fe ff ff       	jmp    91b <syscallentry>
+
+00000af7 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+     af7:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     afc:	e9 1a fe ff ff       	jmp    91b <syscallentry>
+
+00000b01 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+     b01:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     b06:	e9 10 fe ff ff       	jmp    91b <syscallentry>
+
+00000b0b <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+     b0b:	b8 30 00 00 00       	mov    $0x30,%eax
+     b10:	e9 06 fe ff ff       	jmp    91b <syscallentry>
+
+00000b15 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+     b15:	b8 31 00 00 00       	mov    $0x31,%eax
+     b1a:	e9 fc fd ff ff       	jmp    91b <syscallentry>
+
+00000b1f <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+     b1f:	b8 32 00 00 00       	mov    $0x32,%eax
+     b24:	e9 f2 fd ff ff       	jmp    91b <syscallentry>
+
+00000b29 <profread>:
+SYSCALL(profread) // drain profiler samples
+     b29:	b8 33 00 00 00       	mov    $0x33,%eax
+     b2e:	e9 e8 fd ff ff       	jmp    91b <syscallentry>
+
+00000b33 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+     b33:	b8 34 00 00 00       	mov    $0x34,%eax
+     b38:	e9 de fd ff ff       	jmp    91b <syscallentry>
+
+00000b3d <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+     b3d:	b8 35 00 00 00       	mov    $0x35,%eax
+     b42:	e9 d4 fd ff ff       	jmp    91b <syscallentry>
+
+00000b47 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+     b47:	b8 36 00 00 00       	mov    $0x36,%eax
+     b4c:	e9 ca fd ff ff       	jmp    91b <syscallentry>
+
+00000b51 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+     b51:	b8 37 00 00 00       	mov    $0x37,%eax
+     b56:	e9 c0 fd ff ff       	jmp    91b <syscallentry>
+     b5b:	66 90                	xchg   %ax,%ax
+     b5d:	66 90                	xchg   %ax,%ax
+     b5f:	90                   	nop
+
+00000b60 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     b60:	55                   	push   %ebp
+     b61:	89 e5                	mov    %esp,%ebp
+     b63:	57                   	push   %edi
+     b64:	56                   	push   %esi
+     b65:	53                   	push   %ebx
+     b66:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     b68:	89 d1                	mov    %edx,%ecx
+{
+     b6a:	83 ec 3c             	sub    $0x3c,%esp
+     b6d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     b70:	85 d2                	test   %edx,%edx
+     b72:	0f 89 80 00 00 00    	jns    bf8 <printint+0x98>
+     b78:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     b7c:	74 7a                	je     bf8 <printint+0x98>
+    x = -xx;
+     b7e:	f7 d9                	neg    %ecx
+    neg = 1;
+     b80:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     b85:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     b88:	31 f6                	xor    %esi,%esi
+     b8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     b90:	89 c8                	mov    %ecx,%eax
+     b92:	31 d2                	xor    %edx,%edx
+     b94:	89 f7                	mov    %esi,%edi
+     b96:	f7 f3                	div    %ebx
+     b98:	8d 76 01             	lea    0x1(%esi),%esi
+     b9b:	0f b6 92 ac 11 00 00 	movzbl 0x11ac(%edx),%edx
+     ba2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     ba6:	89 ca                	mov    %ecx,%edx
+     ba8:	89 c1                	mov    %eax,%ecx
+     baa:	39 da                	cmp    %ebx,%edx
+     bac:	73 e2                	jae    b90 <printint+0x30>
+  if(neg)
+     bae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     bb1:	85 c0                	test   %eax,%eax
+     bb3:	74 07                	je     bbc <printint+0x5c>
+    buf[i++] = '-';
+     bb5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     bba:	89 f7                	mov    %esi,%edi
+     bbc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     bbf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     bc2:	01 df                	add    %ebx,%edi
+     bc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     bc8:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+     bcb:	83 ec 04             	sub    $0x4,%esp
+     bce:	88 45 d7             	mov    %al,-0x29(%ebp)
+     bd1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     bd4:	6a 01                	push   $0x1
+     bd6:	50                   	push   %eax
+     bd7:	56                   	push   %esi
+     bd8:	e8 e3 f6 ff ff       	call   2c0 <bufwrite>
+  while(--i >= 0)
+     bdd:	89 f8                	mov    %edi,%eax
+     bdf:	83 c4 10             	add    $0x10,%esp
+     be2:	83 ef 01             	sub    $0x1,%edi
+     be5:	39 d8                	cmp    %ebx,%eax
+     be7:	75 df                	jne    bc8 <printint+0x68>
+}
+     be9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bec:	5b                   	pop    %ebx
+     bed:	5e                   	pop    %esi
+     bee:	5f                   	pop    %edi
+     bef:	5d                   	pop    %ebp
+     bf0:	c3                   	ret
+     bf1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     bf8:	31 c0                	xor    %eax,%eax
+     bfa:	eb 89                	jmp    b85 <printint+0x25>
+     bfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c00 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     c00:	55                   	push   %ebp
+     c01:	89 e5                	mov    %esp,%ebp
+     c03:	57                   	push   %edi
+     c04:	56                   	push   %esi
+     c05:	53                   	push   %ebx
+     c06:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     c09:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c0c:	0f b6 18             	movzbl (%eax),%ebx
+     c0f:	84 db                	test   %bl,%bl
+     c11:	74 6c                	je     c7f <printf+0x7f>
+     c13:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+     c16:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+     c19:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     c1b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     c1e:	eb 26                	jmp    c46 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     c20:	83 f8 25             	cmp    $0x25,%eax
+     c23:	74 4b                	je     c70 <printf+0x70>
+  bufwrite(fd, &c, 1);
+     c25:	83 ec 04             	sub    $0x4,%esp
+     c28:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     c2b:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     c2e:	6a 01                	push   $0x1
+     c30:	50                   	push   %eax
+     c31:	ff 75 08             	push   0x8(%ebp)
+     c34:	e8 87 f6 ff ff       	call   2c0 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+     c39:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     c3c:	0f b6 1f             	movzbl (%edi),%ebx
+     c3f:	83 c7 01             	add    $0x1,%edi
+     c42:	84 db                	test   %bl,%bl
+     c44:	74 39                	je     c7f <printf+0x7f>
+    c = fmt[i] & 0xff;
+     c46:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     c49:	85 f6                	test   %esi,%esi
+     c4b:	74 d3                	je     c20 <printf+0x20>
+      }
+    } else if(state == '%'){
+     c4d:	83 fe 25             	cmp    $0x25,%esi
+     c50:	75 ea                	jne    c3c <printf+0x3c>
+      if(c == 'd'){
+     c52:	83 f8 25             	cmp    $0x25,%eax
+     c55:	0f 84 d5 01 00 00    	je     e30 <printf+0x230>
+     c5b:	83 e8 63             	sub    $0x63,%eax
+     c5e:	83 f8 15             	cmp    $0x15,%eax
+     c61:	77 45                	ja     ca8 <printf+0xa8>
+     c63:	ff 24 85 54 11 00 00 	jmp    *0x1154(,%eax,4)
+     c6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     c70:	0f b6 1f             	movzbl (%edi),%ebx
+     c73:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+     c76:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     c7b:	84 db                	test   %bl,%bl
+     c7d:	75 c7                	jne    c46 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+     c7f:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+     c83:	74 0b                	je     c90 <printf+0x90>
+    fflush(fd);
+}
+     c85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c88:	5b                   	pop    %ebx
+     c89:	5e                   	pop    %esi
+     c8a:	5f                   	pop    %edi
+     c8b:	5d                   	pop    %ebp
+     c8c:	c3                   	ret
+     c8d:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+     c90:	83 ec 0c             	sub    $0xc,%esp
+     c93:	6a 02                	push   $0x2
+     c95:	e8 c6 f7 ff ff       	call   460 <fflush>
+     c9a:	83 c4 10             	add    $0x10,%esp
+}
+     c9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ca0:	5b                   	pop    %ebx
+     ca1:	5e                   	pop    %esi
+     ca2:	5f                   	pop    %edi
+     ca3:	5d                   	pop    %ebp
+     ca4:	c3                   	ret
+     ca5:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+     ca8:	83 ec 04             	sub    $0x4,%esp
+     cab:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     cae:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+     cb2:	6a 01                	push   $0x1
+     cb4:	52                   	push   %edx
+     cb5:	89 55 c0             	mov    %edx,-0x40(%ebp)
+     cb8:	ff 75 08             	push   0x8(%ebp)
+     cbb:	e8 00 f6 ff ff       	call   2c0 <bufwrite>
+     cc0:	83 c4 0c             	add    $0xc,%esp
+     cc3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     cc6:	6a 01                	push   $0x1
+     cc8:	8b 55 c0             	mov    -0x40(%ebp),%edx
+     ccb:	52                   	push   %edx
+      state = 0;
+     ccc:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+     cce:	ff 75 08             	push   0x8(%ebp)
+     cd1:	e8 ea f5 ff ff       	call   2c0 <bufwrite>
+        putc(fd, c);
+     cd6:	83 c4 10             	add    $0x10,%esp
+     cd9:	e9 5e ff ff ff       	jmp    c3c <printf+0x3c>
+     cde:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+     ce0:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     ce3:	83 ec 0c             	sub    $0xc,%esp
+     ce6:	b9 10 00 00 00       	mov    $0x10,%ecx
+     ceb:	8b 16                	mov    (%esi),%edx
+     ced:	6a 00                	push   $0x0
+     cef:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+     cf2:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+     cf5:	e8 66 fe ff ff       	call   b60 <printint>
+        ap++;
+     cfa:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     cfd:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d00:	31 f6                	xor    %esi,%esi
+     d02:	e9 35 ff ff ff       	jmp    c3c <printf+0x3c>
+     d07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d0e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     d10:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     d13:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     d15:	83 c0 04             	add    $0x4,%eax
+     d18:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+     d1b:	b8 4b 11 00 00       	mov    $0x114b,%eax
+     d20:	85 db                	test   %ebx,%ebx
+     d22:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+     d25:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+     d28:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+     d2a:	53                   	push   %ebx
+     d2b:	e8 90 f9 ff ff       	call   6c0 <strlen>
+     d30:	83 c4 0c             	add    $0xc,%esp
+     d33:	50                   	push   %eax
+     d34:	53                   	push   %ebx
+     d35:	ff 75 08             	push   0x8(%ebp)
+     d38:	e8 83 f5 ff ff       	call   2c0 <bufwrite>
+     d3d:	83 c4 10             	add    $0x10,%esp
+     d40:	e9 f7 fe ff ff       	jmp    c3c <printf+0x3c>
+     d45:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+     d48:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+     d4b:	83 ec 04             	sub    $0x4,%esp
+     d4e:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+     d51:	8b 06                	mov    (%esi),%eax
+        ap++;
+     d53:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+     d56:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+     d59:	6a 01                	push   $0x1
+     d5b:	52                   	push   %edx
+     d5c:	ff 75 08             	push   0x8(%ebp)
+     d5f:	e8 5c f5 ff ff       	call   2c0 <bufwrite>
+        ap++;
+     d64:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     d67:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d6a:	31 f6                	xor    %esi,%esi
+     d6c:	e9 cb fe ff ff       	jmp    c3c <printf+0x3c>
+     d71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+     d78:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     d7b:	83 ec 0c             	sub    $0xc,%esp
+     d7e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     d83:	8b 16                	mov    (%esi),%edx
+     d85:	6a 01                	push   $0x1
+     d87:	e9 63 ff ff ff       	jmp    cef <printf+0xef>
+     d8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+     d90:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     d93:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     d96:	89 7d c0             	mov    %edi,-0x40(%ebp)
+     d99:	89 55 bc             	mov    %edx,-0x44(%ebp)
+     d9c:	8b 18                	mov    (%eax),%ebx
+     d9e:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+     da1:	31 c0                	xor    %eax,%eax
+     da3:	89 c7                	mov    %eax,%edi
+     da5:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+     da8:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+     dad:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+     daf:	f7 e1                	mul    %ecx
+     db1:	c1 ea 03             	shr    $0x3,%edx
+     db4:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     db7:	89 d1                	mov    %edx,%ecx
+     db9:	01 c0                	add    %eax,%eax
+     dbb:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     dbd:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+     dbf:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     dc1:	be 0a 00 00 00       	mov    $0xa,%esi
+     dc6:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+     dc8:	89 da                	mov    %ebx,%edx
+     dca:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+     dcc:	89 fe                	mov    %edi,%esi
+     dce:	83 c7 01             	add    $0x1,%edi
+     dd1:	8d 42 30             	lea    0x30(%edx),%eax
+     dd4:	89 da                	mov    %ebx,%edx
+     dd6:	8d 14 92             	lea    (%edx,%edx,4),%edx
+     dd9:	01 d2                	add    %edx,%edx
+     ddb:	29 d0                	sub    %edx,%eax
+     ddd:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+     de1:	89 c8                	mov    %ecx,%eax
+     de3:	09 d8                	or     %ebx,%eax
+     de5:	75 c1                	jne    da8 <printf+0x1a8>
+     de7:	8b 55 bc             	mov    -0x44(%ebp),%edx
+     dea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     ded:	01 d6                	add    %edx,%esi
+     def:	89 f7                	mov    %esi,%edi
+     df1:	89 d6                	mov    %edx,%esi
+     df3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     df7:	90                   	nop
+    putc(fd, buf[i]);
+     df8:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+     dfb:	83 ec 04             	sub    $0x4,%esp
+     dfe:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+     e01:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+     e04:	6a 01                	push   $0x1
+     e06:	50                   	push   %eax
+     e07:	53                   	push   %ebx
+     e08:	e8 b3 f4 ff ff       	call   2c0 <bufwrite>
+  while(--i >= 0)
+     e0d:	89 fa                	mov    %edi,%edx
+     e0f:	83 c4 10             	add    $0x10,%esp
+     e12:	83 ef 01             	sub    $0x1,%edi
+     e15:	39 d6                	cmp    %edx,%esi
+     e17:	75 df                	jne    df8 <printf+0x1f8>
+        ap += 2;
+     e19:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+     e1d:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+     e20:	31 f6                	xor    %esi,%esi
+     e22:	e9 15 fe ff ff       	jmp    c3c <printf+0x3c>
+     e27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e2e:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+     e30:	83 ec 04             	sub    $0x4,%esp
+     e33:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     e36:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     e39:	6a 01                	push   $0x1
+     e3b:	e9 8b fe ff ff       	jmp    ccb <printf+0xcb>
+
+00000e40 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     e40:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e41:	a1 20 2b 00 00       	mov    0x2b20,%eax
+{
+     e46:	89 e5                	mov    %esp,%ebp
+     e48:	57                   	push   %edi
+     e49:	56                   	push   %esi
+     e4a:	53                   	push   %ebx
+     e4b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     e4e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e58:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e5a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e5c:	39 ca                	cmp    %ecx,%edx
+     e5e:	73 30                	jae    e90 <free+0x50>
+     e60:	39 c1                	cmp    %eax,%ecx
+     e62:	72 04                	jb     e68 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e64:	39 c2                	cmp    %eax,%edx
+     e66:	72 f0                	jb     e58 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     e68:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     e6b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     e6e:	39 f8                	cmp    %edi,%eax
+     e70:	74 2e                	je     ea0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e72:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     e75:	8b 42 04             	mov    0x4(%edx),%eax
+     e78:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     e7b:	39 f1                	cmp    %esi,%ecx
+     e7d:	74 38                	je     eb7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     e7f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     e81:	5b                   	pop    %ebx
+  freep = p;
+     e82:	89 15 20 2b 00 00    	mov    %edx,0x2b20
+}
+     e88:	5e                   	pop    %esi
+     e89:	5f                   	pop    %edi
+     e8a:	5d                   	pop    %ebp
+     e8b:	c3                   	ret
+     e8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e90:	39 c1                	cmp    %eax,%ecx
+     e92:	72 d0                	jb     e64 <free+0x24>
+     e94:	eb c2                	jmp    e58 <free+0x18>
+     e96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e9d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+     ea0:	03 70 04             	add    0x4(%eax),%esi
+     ea3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     ea6:	8b 02                	mov    (%edx),%eax
+     ea8:	8b 00                	mov    (%eax),%eax
+     eaa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     ead:	8b 42 04             	mov    0x4(%edx),%eax
+     eb0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     eb3:	39 f1                	cmp    %esi,%ecx
+     eb5:	75 c8                	jne    e7f <free+0x3f>
+    p->s.size += bp->s.size;
+     eb7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     eba:	89 15 20 2b 00 00    	mov    %edx,0x2b20
+    p->s.size += bp->s.size;
+     ec0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     ec3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     ec6:	89 0a                	mov    %ecx,(%edx)
+}
+     ec8:	5b                   	pop    %ebx
+     ec9:	5e                   	pop    %esi
+     eca:	5f                   	pop    %edi
+     ecb:	5d                   	pop    %ebp
+     ecc:	c3                   	ret
+     ecd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ed0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     ed0:	55                   	push   %ebp
+     ed1:	89 e5                	mov    %esp,%ebp
+     ed3:	57                   	push   %edi
+     ed4:	56                   	push   %esi
+     ed5:	53                   	push   %ebx
+     ed6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     ed9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+     edc:	8b 15 20 2b 00 00    	mov    0x2b20,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     ee2:	8d 78 07             	lea    0x7(%eax),%edi
+     ee5:	c1 ef 03             	shr    $0x3,%edi
+     ee8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+     eeb:	85 d2                	test   %edx,%edx
+     eed:	0f 84 8d 00 00 00    	je     f80 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     ef3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     ef5:	8b 48 04             	mov    0x4(%eax),%ecx
+     ef8:	39 f9                	cmp    %edi,%ecx
+     efa:	73 64                	jae    f60 <malloc+0x90>
+  if(nu < 4096)
+     efc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     f01:	39 df                	cmp    %ebx,%edi
+     f03:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     f06:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     f0d:	eb 0a                	jmp    f19 <malloc+0x49>
+     f0f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f10:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     f12:	8b 48 04             	mov    0x4(%eax),%ecx
+     f15:	39 f9                	cmp    %edi,%ecx
+     f17:	73 47                	jae    f60 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     f19:	89 c2                	mov    %eax,%edx
+     f1b:	39 05 20 2b 00 00    	cmp    %eax,0x2b20
+     f21:	75 ed                	jne    f10 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+     f23:	83 ec 0c             	sub    $0xc,%esp
+     f26:	56                   	push   %esi
+     f27:	e8 c7 fa ff ff       	call   9f3 <sbrk>
+  if(p == (char*)-1)
+     f2c:	83 c4 10             	add    $0x10,%esp
+     f2f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f32:	74 1c                	je     f50 <malloc+0x80>
+  hp->s.size = nu;
+     f34:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+     f37:	83 ec 0c             	sub    $0xc,%esp
+     f3a:	83 c0 08             	add    $0x8,%eax
+     f3d:	50                   	push   %eax
+     f3e:	e8 fd fe ff ff       	call   e40 <free>
+  return freep;
+     f43:	8b 15 20 2b 00 00    	mov    0x2b20,%edx
+      if((p = morecore(nunits)) == 0)
+     f49:	83 c4 10             	add    $0x10,%esp
+     f4c:	85 d2                	test   %edx,%edx
+     f4e:	75 c0                	jne    f10 <malloc+0x40>
+        return 0;
+  }
+}
+     f50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     f53:	31 c0                	xor    %eax,%eax
+}
+     f55:	5b                   	pop    %ebx
+     f56:	5e                   	pop    %esi
+     f57:	5f                   	pop    %edi
+     f58:	5d                   	pop    %ebp
+     f59:	c3                   	ret
+     f5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     f60:	39 cf                	cmp    %ecx,%edi
+     f62:	74 4c                	je     fb0 <malloc+0xe0>
+        p->s.size -= nunits;
+     f64:	29 f9                	sub    %edi,%ecx
+     f66:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+     f69:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+     f6c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+     f6f:	89 15 20 2b 00 00    	mov    %edx,0x2b20
+}
+     f75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+     f78:	83 c0 08             	add    $0x8,%eax
+}
+     f7b:	5b                   	pop    %ebx
+     f7c:	5e                   	pop    %esi
+     f7d:	5f                   	pop    %edi
+     f7e:	5d                   	pop    %ebp
+     f7f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+     f80:	c7 05 20 2b 00 00 24 	movl   $0x2b24,0x2b20
+     f87:	2b 00 00 
+    base.s.size = 0;
+     f8a:	b8 24 2b 00 00       	mov    $0x2b24,%eax
+    base.s.ptr = freep = prevp = &base;
+     f8f:	c7 05 24 2b 00 00 24 	movl   $0x2b24,0x2b24
+     f96:	2b 00 00 
+    base.s.size = 0;
+     f99:	c7 05 28 2b 00 00 00 	movl   $0x0,0x2b28
+     fa0:	00 00 00 
+    if(p->s.size >= nunits){
+     fa3:	e9 54 ff ff ff       	jmp    efc <malloc+0x2c>
+     fa8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     faf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+     fb0:	8b 08                	mov    (%eax),%ecx
+     fb2:	89 0a                	mov    %ecx,(%edx)
+     fb4:	eb b9                	jmp    f6f <malloc+0x9f>
+     fb6:	66 90                	xchg   %ax,%ax
+     fb8:	66 90                	xchg   %ax,%ax
+     fba:	66 90                	xchg   %ax,%ax
+     fbc:	66 90                	xchg   %ax,%ax
+     fbe:	66 90                	xchg   %ax,%ax
+
+00000fc0 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+     fc0:	55                   	push   %ebp
+     fc1:	89 e5                	mov    %esp,%ebp
+     fc3:	57                   	push   %edi
+     fc4:	56                   	push   %esi
+     fc5:	be 01 00 00 00       	mov    $0x1,%esi
+     fca:	53                   	push   %ebx
+     fcb:	83 ec 28             	sub    $0x28,%esp
+     fce:	8b 45 0c             	mov    0xc(%ebp),%eax
+     fd1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     fd4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+     fd7:	68 00 98 00 00       	push   $0x9800
+     fdc:	e8 ef fe ff ff       	call   ed0 <malloc>
+     fe1:	83 c4 10             	add    $0x10,%esp
+     fe4:	89 c7                	mov    %eax,%edi
+     fe6:	85 c0                	test   %eax,%eax
+     fe8:	74 62                	je     104c <waitpoll+0x8c>
+     fea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+     ff0:	83 ec 0c             	sub    $0xc,%esp
+     ff3:	6a 01                	push   $0x1
+     ff5:	e8 03 fa ff ff       	call   9fd <sleep>
+    fn();
+     ffa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     ffd:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+     fff:	58                   	pop    %eax
+    1000:	5a                   	pop    %edx
+    1001:	68 00 02 00 00       	push   $0x200
+    1006:	57                   	push   %edi
+    1007:	e8 eb fa ff ff       	call   af7 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+    100c:	83 c4 10             	add    $0x10,%esp
+    100f:	85 c0                	test   %eax,%eax
+    1011:	7e 2d                	jle    1040 <waitpoll+0x80>
+    1013:	6b c0 4c             	imul   $0x4c,%eax,%eax
+    1016:	89 fa                	mov    %edi,%edx
+    alive = 0;
+    1018:	31 c9                	xor    %ecx,%ecx
+    101a:	01 f8                	add    %edi,%eax
+    101c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+    1020:	3b 1a                	cmp    (%edx),%ebx
+    1022:	75 07                	jne    102b <waitpoll+0x6b>
+        alive = 1;
+    1024:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+    1028:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+    102b:	83 c2 4c             	add    $0x4c,%edx
+    102e:	39 d0                	cmp    %edx,%eax
+    1030:	75 ee                	jne    1020 <waitpoll+0x60>
+  } while(alive);
+    1032:	85 c9                	test   %ecx,%ecx
+    1034:	75 ba                	jne    ff0 <waitpoll+0x30>
+    1036:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    103d:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+    1040:	83 ec 0c             	sub    $0xc,%esp
+    1043:	57                   	push   %edi
+    1044:	e8 f7 fd ff ff       	call   e40 <free>
+  wait();
+    1049:	83 c4 10             	add    $0x10,%esp
+}
+    104c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    104f:	5b                   	pop    %ebx
+    1050:	5e                   	pop    %esi
+    1051:	5f                   	pop    %edi
+    1052:	5d                   	pop    %ebp
+  wait();
+    1053:	e9 10 f9 ff ff       	jmp    968 <wait>
+    1058:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    105f:	90                   	nop
+
+00001060 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+    1060:	55                   	push   %ebp
+    1061:	89 e5                	mov    %esp,%ebp
+    1063:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+    1066:	c7 45 f0 bd 11 00 00 	movl   $0x11bd,-0x10(%ebp)
+    106d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+    1074:	e8 87 f4 ff ff       	call   500 <fork>
+    1079:	85 c0                	test   %eax,%eax
+    107b:	78 09                	js     1086 <runps+0x26>
+    return -1;
+  if(pid == 0){
+    107d:	74 0e                	je     108d <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+    107f:	e8 e4 f8 ff ff       	call   968 <wait>
+}
+    1084:	c9                   	leave
+    1085:	c3                   	ret
+    1086:	c9                   	leave
+    return -1;
+    1087:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    108c:	c3                   	ret
+    exec("ps", argv);
+    108d:	50                   	push   %eax
+    108e:	50                   	push   %eax
+    108f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    1092:	50                   	push   %eax
+    1093:	68 bd 11 00 00       	push   $0x11bd
+    1098:	e8 c3 f4 ff ff       	call   560 <exec>
+    printf(2, "exec ps failed\n");
+    109d:	5a                   	pop    %edx
+    109e:	59                   	pop    %ecx
+    109f:	68 c0 11 00 00       	push   $0x11c0
+    10a4:	6a 02                	push   $0x2
+    10a6:	e8 55 fb ff ff       	call   c00 <printf>
+    exit();
+    10ab:	e8 a0 f4 ff ff       	call   550 <exit>
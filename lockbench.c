@@ -0,0 +1,82 @@
+// Contend for one kernel spinlock from 1, 2, ... processes at
+// once, one per CPU, and report acquisitions per tick and how
+// evenly they were shared (max/min per process).
+//
+// usage: lockbench [ticks (1-1000)]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "x86.h"
+#include "schedlat.h"
+
+struct schedlat sl[NCPU];
+
+void
+run(int nproc, int ticks)
+{
+  int start[2], done[2], i, n, got, max, min;
+  uint total, ratio;
+  char c;
+
+  if(pipe(start) < 0 || pipe(done) < 0){
+    printf(2, "lockbench: pipe failed\n");
+    exit();
+  }
+  for(i = 0; i < nproc; i++){
+    if((n = fork()) < 0){
+      printf(2, "lockbench: fork failed\n");
+      exit();
+    }
+    if(n == 0){
+      // Wait until all are forked, so that they start together.
+      read(start[0], &c, 1);
+      got = lockbench(ticks);
+      write(done[1], &got, sizeof(got));
+      exit();
+    }
+  }
+  for(i = 0; i < nproc; i++)
+    write(start[1], "x", 1);
+
+  total = max = 0;
+  min = -1;
+  for(i = 0; i < nproc; i++){
+    if(read(done[0], &got, sizeof(got)) != sizeof(got)){
+      printf(2, "lockbench: lost a result\n");
+      exit();
+    }
+    total += got;
+    if(got > max)
+      max = got;
+    if(min < 0 || got < min)
+      min = got;
+  }
+  for(i = 0; i < nproc; i++)
+    wait();
+  close(start[0]);
+  close(start[1]);
+  close(done[0]);
+  close(done[1]);
+
+  ratio = div64((uint64)max * 100, min > 0 ? min : 1);
+  printf(1, "%d cpus: %d acquires/tick, max/min %d.%d%d\n", nproc,
+         total / ticks, ratio / 100, ratio / 10 % 10, ratio % 10);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int ticks, ncpu, n;
+
+  ticks = argc > 1 ? atoi(argv[1]) : 100;
+  if(ticks <= 0 || ticks > 1000){
+    printf(2, "usage: lockbench [ticks (1-1000)]\n");
+    exit();
+  }
+  ncpu = schedlat(sl, NCPU);
+  for(n = 1; n <= ncpu; n++)
+    run(n, ticks);
+  exit();
+}
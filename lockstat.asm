@@ -0,0 +1,2274 @@
+
+_lockstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	53                   	push   %ebx
+       e:	51                   	push   %ecx
+  int pid;
+
+  if(argc > 1 && strcmp(argv[1], "-r") == 0){
+       f:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+      12:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc > 1 && strcmp(argv[1], "-r") == 0){
+      15:	7e 5d                	jle    74 <main+0x74>
+      17:	50                   	push   %eax
+      18:	50                   	push   %eax
+      19:	68 42 11 00 00       	push   $0x1142
+      1e:	ff 73 04             	push   0x4(%ebx)
+      21:	e8 ca 06 00 00       	call   6f0 <strcmp>
+      26:	83 c4 10             	add    $0x10,%esp
+      29:	85 c0                	test   %eax,%eax
+      2b:	74 51                	je     7e <main+0x7e>
+    lockstat(ls, 0, 1);
+    exit();
+  }
+  if(argc > 1){
+    lockstat(ls, 0, 1);
+      2d:	51                   	push   %ecx
+      2e:	6a 01                	push   $0x1
+      30:	6a 00                	push   $0x0
+      32:	68 20 57 01 00       	push   $0x15720
+      37:	e8 87 0b 00 00       	call   bc3 <lockstat>
+    if((pid = fork()) < 0){
+      3c:	e8 4f 05 00 00       	call   590 <fork>
+      41:	83 c4 10             	add    $0x10,%esp
+      44:	85 c0                	test   %eax,%eax
+      46:	78 4a                	js     92 <main+0x92>
+      printf(2, "lockstat: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      48:	75 25                	jne    6f <main+0x6f>
+      exec(argv[1], argv + 1);
+      4a:	50                   	push   %eax
+      4b:	50                   	push   %eax
+      4c:	8d 43 04             	lea    0x4(%ebx),%eax
+      4f:	50                   	push   %eax
+      50:	ff 73 04             	push   0x4(%ebx)
+      53:	e8 98 05 00 00       	call   5f0 <exec>
+      printf(2, "lockstat: exec %s failed\n", argv[1]);
+      58:	83 c4 0c             	add    $0xc,%esp
+      5b:	ff 73 04             	push   0x4(%ebx)
+      5e:	68 5c 11 00 00       	push   $0x115c
+      63:	6a 02                	push   $0x2
+      65:	e8 26 0c 00 00       	call   c90 <printf>
+      exit();
+      6a:	e8 71 05 00 00       	call   5e0 <exit>
+    }
+    wait();
+      6f:	e8 84 09 00 00       	call   9f8 <wait>
+  }
+  report();
+      74:	e8 37 00 00 00       	call   b0 <report>
+  exit();
+      79:	e8 62 05 00 00       	call   5e0 <exit>
+    lockstat(ls, 0, 1);
+      7e:	53                   	push   %ebx
+      7f:	6a 01                	push   $0x1
+      81:	6a 00                	push   $0x0
+      83:	68 20 57 01 00       	push   $0x15720
+      88:	e8 36 0b 00 00       	call   bc3 <lockstat>
+    exit();
+      8d:	e8 4e 05 00 00       	call   5e0 <exit>
+      printf(2, "lockstat: fork failed\n");
+      92:	52                   	push   %edx
+      93:	52                   	push   %edx
+      94:	68 45 11 00 00       	push   $0x1145
+      99:	6a 02                	push   $0x2
+      9b:	e8 f0 0b 00 00       	call   c90 <printf>
+      exit();
+      a0:	e8 3b 05 00 00       	call   5e0 <exit>
+      a5:	66 90                	xchg   %ax,%ax
+      a7:	66 90                	xchg   %ax,%ax
+      a9:	66 90                	xchg   %ax,%ax
+      ab:	66 90                	xchg   %ax,%ax
+      ad:	66 90                	xchg   %ax,%ax
+      af:	90                   	nop
+
+000000b0 <report>:
+{
+      b0:	55                   	push   %ebp
+      b1:	89 e5                	mov    %esp,%ebp
+      b3:	57                   	push   %edi
+      b4:	56                   	push   %esi
+      b5:	53                   	push   %ebx
+      b6:	83 ec 30             	sub    $0x30,%esp
+  n = lockstat(ls, MAXLOCKSTAT, 0);
+      b9:	6a 00                	push   $0x0
+      bb:	68 00 08 00 00       	push   $0x800
+      c0:	68 20 57 01 00       	push   $0x15720
+      c5:	e8 f9 0a 00 00       	call   bc3 <lockstat>
+  for(i = 0; i < n; i++){
+      ca:	83 c4 10             	add    $0x10,%esp
+  n = lockstat(ls, MAXLOCKSTAT, 0);
+      cd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for(i = 0; i < n; i++){
+      d0:	85 c0                	test   %eax,%eax
+      d2:	0f 8e cf 00 00 00    	jle    1a7 <report+0xf7>
+      d8:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+      df:	bb 20 57 01 00       	mov    $0x15720,%ebx
+      e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    for(j = 0; j < nagg; j++)
+      e8:	a1 00 17 00 00       	mov    0x1700,%eax
+      ed:	31 ff                	xor    %edi,%edi
+      ef:	31 f6                	xor    %esi,%esi
+      f1:	85 c0                	test   %eax,%eax
+      f3:	7f 1b                	jg     110 <report+0x60>
+      f5:	eb 3f                	jmp    136 <report+0x86>
+      f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      fe:	66 90                	xchg   %ax,%ax
+     100:	a1 00 17 00 00       	mov    0x1700,%eax
+     105:	83 c7 01             	add    $0x1,%edi
+     108:	39 f8                	cmp    %edi,%eax
+     10a:	0f 8e 30 02 00 00    	jle    340 <report+0x290>
+      if(strcmp(agg[j].name, ls[i].name) == 0)
+     110:	8d 34 bd 00 00 00 00 	lea    0x0(,%edi,4),%esi
+     117:	83 ec 08             	sub    $0x8,%esp
+     11a:	8d 04 3e             	lea    (%esi,%edi,1),%eax
+     11d:	53                   	push   %ebx
+     11e:	ff 34 c5 20 17 00 00 	push   0x1720(,%eax,8)
+     125:	e8 c6 05 00 00       	call   6f0 <strcmp>
+     12a:	83 c4 10             	add    $0x10,%esp
+     12d:	85 c0                	test   %eax,%eax
+     12f:	75 cf                	jne    100 <report+0x50>
+    for(j = 0; j < nagg; j++)
+     131:	a1 00 17 00 00       	mov    0x1700,%eax
+    if(j == nagg){
+     136:	39 c7                	cmp    %eax,%edi
+     138:	75 12                	jne    14c <report+0x9c>
+      agg[nagg].name = ls[i].name;
+     13a:	8d 04 3e             	lea    (%esi,%edi,1),%eax
+     13d:	89 1c c5 20 17 00 00 	mov    %ebx,0x1720(,%eax,8)
+      nagg++;
+     144:	8d 47 01             	lea    0x1(%edi),%eax
+     147:	a3 00 17 00 00       	mov    %eax,0x1700
+    agg[j].nlocks++;
+     14c:	8d 14 3e             	lea    (%esi,%edi,1),%edx
+    agg[j].spin += ls[i].spin;
+     14f:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+    if(ls[i].maxhold > agg[j].maxhold)
+     152:	8b 73 24             	mov    0x24(%ebx),%esi
+    agg[j].nlocks++;
+     155:	8d 04 d5 20 17 00 00 	lea    0x1720(,%edx,8),%eax
+    agg[j].nacquire += ls[i].nacquire;
+     15c:	8b 53 10             	mov    0x10(%ebx),%edx
+    if(ls[i].maxhold > agg[j].maxhold)
+     15f:	8b 7b 20             	mov    0x20(%ebx),%edi
+    agg[j].nacquire += ls[i].nacquire;
+     162:	01 50 08             	add    %edx,0x8(%eax)
+    agg[j].ncontend += ls[i].ncontend;
+     165:	8b 53 14             	mov    0x14(%ebx),%edx
+    agg[j].nlocks++;
+     168:	83 40 04 01          	addl   $0x1,0x4(%eax)
+    agg[j].ncontend += ls[i].ncontend;
+     16c:	01 50 0c             	add    %edx,0xc(%eax)
+    agg[j].spin += ls[i].spin;
+     16f:	8b 53 18             	mov    0x18(%ebx),%edx
+     172:	01 50 10             	add    %edx,0x10(%eax)
+    agg[j].nspinwait += ls[i].nspinwait;
+     175:	8b 53 28             	mov    0x28(%ebx),%edx
+    agg[j].spin += ls[i].spin;
+     178:	11 48 14             	adc    %ecx,0x14(%eax)
+    agg[j].nspinwait += ls[i].nspinwait;
+     17b:	01 50 20             	add    %edx,0x20(%eax)
+    agg[j].nsleep += ls[i].nsleep;
+     17e:	8b 53 2c             	mov    0x2c(%ebx),%edx
+     181:	01 50 24             	add    %edx,0x24(%eax)
+    if(ls[i].maxhold > agg[j].maxhold)
+     184:	8b 50 1c             	mov    0x1c(%eax),%edx
+     187:	39 78 18             	cmp    %edi,0x18(%eax)
+     18a:	19 f2                	sbb    %esi,%edx
+     18c:	73 06                	jae    194 <report+0xe4>
+      agg[j].maxhold = ls[i].maxhold;
+     18e:	89 78 18             	mov    %edi,0x18(%eax)
+     191:	89 70 1c             	mov    %esi,0x1c(%eax)
+  for(i = 0; i < n; i++){
+     194:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+     198:	83 c3 30             	add    $0x30,%ebx
+     19b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     19e:	39 45 e0             	cmp    %eax,-0x20(%ebp)
+     1a1:	0f 85 41 ff ff ff    	jne    e8 <report+0x38>
+  printf(1, "name\t\tlocks\tacquires\tcontended\tspin kcycles\tmax hold kcycles\tspun\tslept\n");
+     1a7:	83 ec 08             	sub    $0x8,%esp
+     1aa:	68 78 11 00 00       	push   $0x1178
+     1af:	6a 01                	push   $0x1
+     1b1:	e8 da 0a 00 00       	call   c90 <printf>
+     1b6:	c7 45 c8 0f 00 00 00 	movl   $0xf,-0x38(%ebp)
+     1bd:	83 c4 10             	add    $0x10,%esp
+    for(j = 0; j < nagg; j++)
+     1c0:	a1 00 17 00 00       	mov    0x1700,%eax
+     1c5:	85 c0                	test   %eax,%eax
+     1c7:	0f 8e 6b 01 00 00    	jle    338 <report+0x288>
+    best = -1;
+     1cd:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+    for(j = 0; j < nagg; j++)
+     1d2:	31 d2                	xor    %edx,%edx
+     1d4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     1d7:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     1da:	89 d6                	mov    %edx,%esi
+     1dc:	eb 64                	jmp    242 <report+0x192>
+     1de:	66 90                	xchg   %ax,%ax
+      if(agg[j].nacquire && (best < 0 || agg[j].spin > agg[best].spin ||
+     1e0:	8b 14 c5 34 17 00 00 	mov    0x1734(,%eax,8),%edx
+     1e7:	8b 0c c5 30 17 00 00 	mov    0x1730(,%eax,8),%ecx
+     1ee:	8d 04 bf             	lea    (%edi,%edi,4),%eax
+     1f1:	89 d3                	mov    %edx,%ebx
+     1f3:	8d 14 c5 20 17 00 00 	lea    0x1720(,%eax,8),%edx
+     1fa:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     1fd:	8b 42 10             	mov    0x10(%edx),%eax
+     200:	89 55 d8             	mov    %edx,-0x28(%ebp)
+     203:	8b 52 14             	mov    0x14(%edx),%edx
+     206:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+     209:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+     20c:	39 c8                	cmp    %ecx,%eax
+     20e:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+     211:	89 d7                	mov    %edx,%edi
+     213:	19 df                	sbb    %ebx,%edi
+     215:	72 43                	jb     25a <report+0x1aa>
+     217:	31 d3                	xor    %edx,%ebx
+     219:	31 c1                	xor    %eax,%ecx
+     21b:	89 d8                	mov    %ebx,%eax
+     21d:	09 c8                	or     %ecx,%eax
+     21f:	75 17                	jne    238 <report+0x188>
+         (agg[j].spin == agg[best].spin && agg[j].nacquire > agg[best].nacquire)))
+     221:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     224:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+     227:	39 48 08             	cmp    %ecx,0x8(%eax)
+     22a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     22d:	0f 42 c6             	cmovb  %esi,%eax
+     230:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     233:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     237:	90                   	nop
+    for(j = 0; j < nagg; j++)
+     238:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     23b:	83 c6 01             	add    $0x1,%esi
+     23e:	39 c6                	cmp    %eax,%esi
+     240:	74 25                	je     267 <report+0x1b7>
+      if(agg[j].nacquire && (best < 0 || agg[j].spin > agg[best].spin ||
+     242:	8d 04 b6             	lea    (%esi,%esi,4),%eax
+     245:	8b 1c c5 28 17 00 00 	mov    0x1728(,%eax,8),%ebx
+     24c:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+     24f:	85 db                	test   %ebx,%ebx
+     251:	74 e5                	je     238 <report+0x188>
+     253:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     256:	85 ff                	test   %edi,%edi
+     258:	79 86                	jns    1e0 <report+0x130>
+    for(j = 0; j < nagg; j++)
+     25a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     25d:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+     260:	83 c6 01             	add    $0x1,%esi
+     263:	39 c6                	cmp    %eax,%esi
+     265:	75 db                	jne    242 <report+0x192>
+    if(best < 0)
+     267:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     26a:	85 ff                	test   %edi,%edi
+     26c:	0f 88 c6 00 00 00    	js     338 <report+0x288>
+    printf(1, "%s\t%s%d\t%d\t\t%d\t\t%d\t\t%d\t\t%d\t%d\n", agg[best].name,
+     272:	8d 34 bf             	lea    (%edi,%edi,4),%esi
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     275:	bf e8 03 00 00       	mov    $0x3e8,%edi
+           strlen(agg[best].name) < 8 ? "\t" : "", agg[best].nlocks,
+     27a:	83 ec 0c             	sub    $0xc,%esp
+    printf(1, "%s\t%s%d\t%d\t\t%d\t\t%d\t\t%d\t\t%d\t%d\n", agg[best].name,
+     27d:	8d 1c f5 20 17 00 00 	lea    0x1720(,%esi,8),%ebx
+     284:	8b 4b 20             	mov    0x20(%ebx),%ecx
+     287:	8b 43 24             	mov    0x24(%ebx),%eax
+     28a:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+           (uint)div64(agg[best].maxhold, 1000),
+     28d:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+    printf(1, "%s\t%s%d\t%d\t\t%d\t\t%d\t\t%d\t\t%d\t%d\n", agg[best].name,
+     290:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  r = (uint)(n >> 32) % d;
+     293:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+     298:	f7 e1                	mul    %ecx
+     29a:	c1 ea 06             	shr    $0x6,%edx
+     29d:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+     2a3:	29 c1                	sub    %eax,%ecx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     2a5:	8b 43 18             	mov    0x18(%ebx),%eax
+  r = (uint)(n >> 32) % d;
+     2a8:	89 ca                	mov    %ecx,%edx
+           (uint)div64(agg[best].spin, 1000),
+     2aa:	8b 4b 14             	mov    0x14(%ebx),%ecx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     2ad:	f7 f7                	div    %edi
+  return ((uint64)hi << 32) | lo;
+     2af:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  r = (uint)(n >> 32) % d;
+     2b2:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+     2b7:	f7 e1                	mul    %ecx
+     2b9:	c1 ea 06             	shr    $0x6,%edx
+     2bc:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+     2c2:	29 c1                	sub    %eax,%ecx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     2c4:	8b 43 10             	mov    0x10(%ebx),%eax
+  r = (uint)(n >> 32) % d;
+     2c7:	89 ca                	mov    %ecx,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     2c9:	f7 f7                	div    %edi
+    printf(1, "%s\t%s%d\t%d\t\t%d\t\t%d\t\t%d\t\t%d\t%d\n", agg[best].name,
+     2cb:	8b 53 0c             	mov    0xc(%ebx),%edx
+     2ce:	8b 7b 08             	mov    0x8(%ebx),%edi
+  return ((uint64)hi << 32) | lo;
+     2d1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+     2d4:	89 55 cc             	mov    %edx,-0x34(%ebp)
+     2d7:	8b 53 04             	mov    0x4(%ebx),%edx
+     2da:	89 55 dc             	mov    %edx,-0x24(%ebp)
+           strlen(agg[best].name) < 8 ? "\t" : "", agg[best].nlocks,
+     2dd:	ff 34 f5 20 17 00 00 	push   0x1720(,%esi,8)
+     2e4:	e8 67 04 00 00       	call   750 <strlen>
+    printf(1, "%s\t%s%d\t%d\t\t%d\t\t%d\t\t%d\t\t%d\t%d\n", agg[best].name,
+     2e9:	83 c4 0c             	add    $0xc,%esp
+     2ec:	b9 40 11 00 00       	mov    $0x1140,%ecx
+     2f1:	ff 75 e4             	push   -0x1c(%ebp)
+     2f4:	83 f8 07             	cmp    $0x7,%eax
+     2f7:	b8 41 11 00 00       	mov    $0x1141,%eax
+     2fc:	ff 75 e0             	push   -0x20(%ebp)
+     2ff:	0f 46 c1             	cmovbe %ecx,%eax
+     302:	ff 75 d0             	push   -0x30(%ebp)
+     305:	ff 75 d8             	push   -0x28(%ebp)
+     308:	8b 55 cc             	mov    -0x34(%ebp),%edx
+     30b:	52                   	push   %edx
+     30c:	57                   	push   %edi
+     30d:	ff 75 dc             	push   -0x24(%ebp)
+     310:	50                   	push   %eax
+     311:	ff 34 f5 20 17 00 00 	push   0x1720(,%esi,8)
+     318:	68 c4 11 00 00       	push   $0x11c4
+     31d:	6a 01                	push   $0x1
+     31f:	e8 6c 09 00 00       	call   c90 <printf>
+  for(i = 0; i < NSHOW; i++){
+     324:	83 c4 30             	add    $0x30,%esp
+     327:	83 6d c8 01          	subl   $0x1,-0x38(%ebp)
+    agg[best].nacquire = 0;
+     32b:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  for(i = 0; i < NSHOW; i++){
+     332:	0f 85 88 fe ff ff    	jne    1c0 <report+0x110>
+}
+     338:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     33b:	5b                   	pop    %ebx
+     33c:	5e                   	pop    %esi
+     33d:	5f                   	pop    %edi
+     33e:	5d                   	pop    %ebp
+     33f:	c3                   	ret
+     340:	8d 34 bd 00 00 00 00 	lea    0x0(,%edi,4),%esi
+     347:	e9 ea fd ff ff       	jmp    136 <report+0x86>
+     34c:	66 90                	xchg   %ax,%ax
+     34e:	66 90                	xchg   %ax,%ax
+
+00000350 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+     350:	55                   	push   %ebp
+     351:	89 e5                	mov    %esp,%ebp
+     353:	57                   	push   %edi
+     354:	56                   	push   %esi
+     355:	53                   	push   %ebx
+     356:	83 ec 4c             	sub    $0x4c,%esp
+     359:	8b 45 0c             	mov    0xc(%ebp),%eax
+     35c:	8b 55 08             	mov    0x8(%ebp),%edx
+     35f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     362:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+     365:	83 fa 0f             	cmp    $0xf,%edx
+     368:	0f 87 32 01 00 00    	ja     4a0 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+     36e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     374:	8b 80 20 d7 02 00    	mov    0x2d720(%eax),%eax
+     37a:	85 c0                	test   %eax,%eax
+     37c:	0f 84 de 00 00 00    	je     460 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+     382:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     388:	8b b0 24 d7 02 00    	mov    0x2d724(%eax),%esi
+     38e:	8d 88 20 d7 02 00    	lea    0x2d720(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+     394:	8d b8 28 d7 02 00    	lea    0x2d728(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+     39a:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+     39d:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+     3a0:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+     3a3:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+     3a9:	0f 8f 01 01 00 00    	jg     4b0 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+     3af:	8d 78 08             	lea    0x8(%eax),%edi
+     3b2:	8d bc 3e 20 d7 02 00 	lea    0x2d720(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     3b9:	85 db                	test   %ebx,%ebx
+     3bb:	7e 3b                	jle    3f8 <bufwrite+0xa8>
+     3bd:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+     3c0:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+     3c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3c7:	90                   	nop
+    *dst++ = *src++;
+     3c8:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     3c9:	39 c6                	cmp    %eax,%esi
+     3cb:	75 fb                	jne    3c8 <bufwrite+0x78>
+  ob[fd].n += n;
+     3cd:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     3d3:	8b 88 24 d7 02 00    	mov    0x2d724(%eax),%ecx
+     3d9:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     3db:	83 b8 20 d7 02 00 01 	cmpl   $0x1,0x2d720(%eax)
+  ob[fd].n += n;
+     3e2:	89 88 24 d7 02 00    	mov    %ecx,0x2d724(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     3e8:	74 26                	je     410 <bufwrite+0xc0>
+}
+     3ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     3ed:	5b                   	pop    %ebx
+     3ee:	5e                   	pop    %esi
+     3ef:	5f                   	pop    %edi
+     3f0:	5d                   	pop    %ebp
+     3f1:	c3                   	ret
+     3f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+     3f8:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     3fb:	83 b8 20 d7 02 00 01 	cmpl   $0x1,0x2d720(%eax)
+  ob[fd].n += n;
+     402:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     405:	75 e3                	jne    3ea <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+     407:	85 db                	test   %ebx,%ebx
+     409:	74 df                	je     3ea <bufwrite+0x9a>
+     40b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     40f:	90                   	nop
+  src = vsrc;
+     410:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     413:	01 c3                	add    %eax,%ebx
+     415:	eb 10                	jmp    427 <bufwrite+0xd7>
+     417:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     41e:	66 90                	xchg   %ax,%ax
+     420:	83 c0 01             	add    $0x1,%eax
+     423:	39 d8                	cmp    %ebx,%eax
+     425:	74 c3                	je     3ea <bufwrite+0x9a>
+    if(*p == (char)c)
+     427:	80 38 0a             	cmpb   $0xa,(%eax)
+     42a:	75 f4                	jne    420 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     42c:	85 c9                	test   %ecx,%ecx
+     42e:	7e ba                	jle    3ea <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+     430:	83 ec 04             	sub    $0x4,%esp
+     433:	51                   	push   %ecx
+     434:	ff 75 ac             	push   -0x54(%ebp)
+     437:	52                   	push   %edx
+     438:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+     43b:	e8 cd 05 00 00       	call   a0d <write>
+    ob[fd].n = 0;
+     440:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     443:	83 c4 10             	add    $0x10,%esp
+     446:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+     44c:	c7 82 24 d7 02 00 00 	movl   $0x0,0x2d724(%edx)
+     453:	00 00 00 
+     456:	eb 92                	jmp    3ea <bufwrite+0x9a>
+     458:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     45f:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     460:	83 ec 08             	sub    $0x8,%esp
+     463:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     466:	50                   	push   %eax
+     467:	52                   	push   %edx
+     468:	89 55 b0             	mov    %edx,-0x50(%ebp)
+     46b:	e8 d7 05 00 00       	call   a47 <fstat>
+     470:	83 c4 10             	add    $0x10,%esp
+     473:	8b 55 b0             	mov    -0x50(%ebp),%edx
+     476:	89 c1                	mov    %eax,%ecx
+     478:	b8 02 00 00 00       	mov    $0x2,%eax
+     47d:	85 c9                	test   %ecx,%ecx
+     47f:	75 0d                	jne    48e <bufwrite+0x13e>
+     481:	31 c0                	xor    %eax,%eax
+     483:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     488:	0f 95 c0             	setne  %al
+     48b:	83 c0 01             	add    $0x1,%eax
+     48e:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+     494:	89 81 20 d7 02 00    	mov    %eax,0x2d720(%ecx)
+     49a:	e9 e3 fe ff ff       	jmp    382 <bufwrite+0x32>
+     49f:	90                   	nop
+}
+     4a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4a3:	5b                   	pop    %ebx
+     4a4:	5e                   	pop    %esi
+     4a5:	5f                   	pop    %edi
+     4a6:	5d                   	pop    %ebp
+    write(fd, p, n);
+     4a7:	e9 61 05 00 00       	jmp    a0d <write>
+     4ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+     4b0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+     4b3:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+     4b6:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+     4b9:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+     4bc:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+     4bf:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+     4c2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+     4c5:	6a 02                	push   $0x2
+     4c7:	50                   	push   %eax
+     4c8:	52                   	push   %edx
+     4c9:	e8 9b 06 00 00       	call   b69 <writev>
+    ob[fd].n = 0;
+     4ce:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+     4d1:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+     4d4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+     4db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4de:	5b                   	pop    %ebx
+     4df:	5e                   	pop    %esi
+     4e0:	5f                   	pop    %edi
+     4e1:	5d                   	pop    %ebp
+     4e2:	c3                   	ret
+     4e3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000004f0 <fflush>:
+{
+     4f0:	55                   	push   %ebp
+     4f1:	89 e5                	mov    %esp,%ebp
+     4f3:	53                   	push   %ebx
+     4f4:	83 ec 04             	sub    $0x4,%esp
+     4f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     4fa:	83 f8 0f             	cmp    $0xf,%eax
+     4fd:	77 16                	ja     515 <fflush+0x25>
+     4ff:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+     505:	8b 8a 24 d7 02 00    	mov    0x2d724(%edx),%ecx
+     50b:	8d 9a 20 d7 02 00    	lea    0x2d720(%edx),%ebx
+     511:	85 c9                	test   %ecx,%ecx
+     513:	7f 0b                	jg     520 <fflush+0x30>
+}
+     515:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     518:	c9                   	leave
+     519:	c3                   	ret
+     51a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     520:	83 ec 04             	sub    $0x4,%esp
+     523:	81 c2 28 d7 02 00    	add    $0x2d728,%edx
+     529:	51                   	push   %ecx
+     52a:	52                   	push   %edx
+     52b:	50                   	push   %eax
+     52c:	e8 dc 04 00 00       	call   a0d <write>
+    ob[fd].n = 0;
+     531:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     538:	83 c4 10             	add    $0x10,%esp
+}
+     53b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     53e:	c9                   	leave
+     53f:	c3                   	ret
+
+00000540 <fflushall>:
+{
+     540:	55                   	push   %ebp
+     541:	89 e5                	mov    %esp,%ebp
+     543:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     544:	31 f6                	xor    %esi,%esi
+{
+     546:	53                   	push   %ebx
+     547:	bb 28 d7 02 00       	mov    $0x2d728,%ebx
+     54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     550:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     553:	85 c0                	test   %eax,%eax
+     555:	7e 15                	jle    56c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     557:	83 ec 04             	sub    $0x4,%esp
+     55a:	50                   	push   %eax
+     55b:	53                   	push   %ebx
+     55c:	56                   	push   %esi
+     55d:	e8 ab 04 00 00       	call   a0d <write>
+    ob[fd].n = 0;
+     562:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     569:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     56c:	83 c6 01             	add    $0x1,%esi
+     56f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     575:	83 fe 10             	cmp    $0x10,%esi
+     578:	75 d6                	jne    550 <fflushall+0x10>
+}
+     57a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     57d:	5b                   	pop    %ebx
+     57e:	5e                   	pop    %esi
+     57f:	5d                   	pop    %ebp
+     580:	c3                   	ret
+     581:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     588:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     58f:	90                   	nop
+
+00000590 <fork>:
+{
+     590:	55                   	push   %ebp
+     591:	89 e5                	mov    %esp,%ebp
+     593:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     594:	31 f6                	xor    %esi,%esi
+{
+     596:	53                   	push   %ebx
+     597:	bb 28 d7 02 00       	mov    $0x2d728,%ebx
+     59c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     5a0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     5a3:	85 c0                	test   %eax,%eax
+     5a5:	7e 15                	jle    5bc <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     5a7:	83 ec 04             	sub    $0x4,%esp
+     5aa:	50                   	push   %eax
+     5ab:	53                   	push   %ebx
+     5ac:	56                   	push   %esi
+     5ad:	e8 5b 04 00 00       	call   a0d <write>
+    ob[fd].n = 0;
+     5b2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     5b9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     5bc:	83 c6 01             	add    $0x1,%esi
+     5bf:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     5c5:	83 fe 10             	cmp    $0x10,%esi
+     5c8:	75 d6                	jne    5a0 <fork+0x10>
+}
+     5ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5cd:	5b                   	pop    %ebx
+     5ce:	5e                   	pop    %esi
+     5cf:	5d                   	pop    %ebp
+  return _fork();
+     5d0:	e9 15 04 00 00       	jmp    9ea <_fork>
+     5d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005e0 <exit>:
+{
+     5e0:	55                   	push   %ebp
+     5e1:	89 e5                	mov    %esp,%ebp
+     5e3:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+     5e6:	e8 55 ff ff ff       	call   540 <fflushall>
+  _exit();
+     5eb:	e8 01 04 00 00       	call   9f1 <_exit>
+
+000005f0 <exec>:
+{
+     5f0:	55                   	push   %ebp
+     5f1:	89 e5                	mov    %esp,%ebp
+     5f3:	57                   	push   %edi
+     5f4:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     5f5:	31 f6                	xor    %esi,%esi
+{
+     5f7:	53                   	push   %ebx
+     5f8:	bb 28 d7 02 00       	mov    $0x2d728,%ebx
+     5fd:	83 ec 1c             	sub    $0x1c,%esp
+     600:	8b 45 08             	mov    0x8(%ebp),%eax
+     603:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     606:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     609:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     610:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     613:	85 c0                	test   %eax,%eax
+     615:	7e 15                	jle    62c <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     617:	83 ec 04             	sub    $0x4,%esp
+     61a:	50                   	push   %eax
+     61b:	53                   	push   %ebx
+     61c:	56                   	push   %esi
+     61d:	e8 eb 03 00 00       	call   a0d <write>
+    ob[fd].n = 0;
+     622:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     629:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     62c:	83 c6 01             	add    $0x1,%esi
+     62f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     635:	83 fe 10             	cmp    $0x10,%esi
+     638:	75 d6                	jne    610 <exec+0x20>
+  return _exec(path, argv);
+     63a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     63d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+     640:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     643:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     646:	5b                   	pop    %ebx
+     647:	5e                   	pop    %esi
+     648:	5f                   	pop    %edi
+     649:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     64a:	e9 d3 03 00 00       	jmp    a22 <_exec>
+     64f:	90                   	nop
+
+00000650 <close>:
+{
+     650:	55                   	push   %ebp
+     651:	89 e5                	mov    %esp,%ebp
+     653:	56                   	push   %esi
+     654:	53                   	push   %ebx
+     655:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     658:	83 fb 0f             	cmp    $0xf,%ebx
+     65b:	77 26                	ja     683 <close+0x33>
+     65d:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     663:	8b 90 24 d7 02 00    	mov    0x2d724(%eax),%edx
+     669:	8d b0 20 d7 02 00    	lea    0x2d720(%eax),%esi
+     66f:	85 d2                	test   %edx,%edx
+     671:	7f 25                	jg     698 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+     673:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     679:	c7 80 20 d7 02 00 00 	movl   $0x0,0x2d720(%eax)
+     680:	00 00 00 
+  return _close(fd);
+     683:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     686:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     689:	5b                   	pop    %ebx
+     68a:	5e                   	pop    %esi
+     68b:	5d                   	pop    %ebp
+  return _close(fd);
+     68c:	e9 83 03 00 00       	jmp    a14 <_close>
+     691:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     698:	83 ec 04             	sub    $0x4,%esp
+     69b:	05 28 d7 02 00       	add    $0x2d728,%eax
+     6a0:	52                   	push   %edx
+     6a1:	50                   	push   %eax
+     6a2:	53                   	push   %ebx
+     6a3:	e8 65 03 00 00       	call   a0d <write>
+    ob[fd].n = 0;
+     6a8:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+     6af:	83 c4 10             	add    $0x10,%esp
+     6b2:	eb bf                	jmp    673 <close+0x23>
+     6b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6bf:	90                   	nop
+
+000006c0 <strcpy>:
+{
+     6c0:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+     6c1:	31 c0                	xor    %eax,%eax
+{
+     6c3:	89 e5                	mov    %esp,%ebp
+     6c5:	53                   	push   %ebx
+     6c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     6c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     6cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     6d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     6d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     6d7:	83 c0 01             	add    $0x1,%eax
+     6da:	84 d2                	test   %dl,%dl
+     6dc:	75 f2                	jne    6d0 <strcpy+0x10>
+}
+     6de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6e1:	89 c8                	mov    %ecx,%eax
+     6e3:	c9                   	leave
+     6e4:	c3                   	ret
+     6e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006f0 <strcmp>:
+{
+     6f0:	55                   	push   %ebp
+     6f1:	89 e5                	mov    %esp,%ebp
+     6f3:	53                   	push   %ebx
+     6f4:	8b 55 08             	mov    0x8(%ebp),%edx
+     6f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     6fa:	0f b6 02             	movzbl (%edx),%eax
+     6fd:	84 c0                	test   %al,%al
+     6ff:	75 17                	jne    718 <strcmp+0x28>
+     701:	eb 3a                	jmp    73d <strcmp+0x4d>
+     703:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     707:	90                   	nop
+     708:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     70c:	83 c2 01             	add    $0x1,%edx
+     70f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     712:	84 c0                	test   %al,%al
+     714:	74 1a                	je     730 <strcmp+0x40>
+    p++, q++;
+     716:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     718:	0f b6 19             	movzbl (%ecx),%ebx
+     71b:	38 c3                	cmp    %al,%bl
+     71d:	74 e9                	je     708 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     71f:	29 d8                	sub    %ebx,%eax
+}
+     721:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     724:	c9                   	leave
+     725:	c3                   	ret
+     726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     72d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     730:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     734:	31 c0                	xor    %eax,%eax
+     736:	29 d8                	sub    %ebx,%eax
+}
+     738:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     73b:	c9                   	leave
+     73c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     73d:	0f b6 19             	movzbl (%ecx),%ebx
+     740:	31 c0                	xor    %eax,%eax
+     742:	eb db                	jmp    71f <strcmp+0x2f>
+     744:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     74b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     74f:	90                   	nop
+
+00000750 <strlen>:
+{
+     750:	55                   	push   %ebp
+     751:	89 e5                	mov    %esp,%ebp
+     753:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+     756:	80 3a 00             	cmpb   $0x0,(%edx)
+     759:	74 15                	je     770 <strlen+0x20>
+     75b:	31 c0                	xor    %eax,%eax
+     75d:	8d 76 00             	lea    0x0(%esi),%esi
+     760:	83 c0 01             	add    $0x1,%eax
+     763:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     767:	89 c1                	mov    %eax,%ecx
+     769:	75 f5                	jne    760 <strlen+0x10>
+}
+     76b:	89 c8                	mov    %ecx,%eax
+     76d:	5d                   	pop    %ebp
+     76e:	c3                   	ret
+     76f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     770:	31 c9                	xor    %ecx,%ecx
+}
+     772:	5d                   	pop    %ebp
+     773:	89 c8                	mov    %ecx,%eax
+     775:	c3                   	ret
+     776:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     77d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000780 <memset>:
+{
+     780:	55                   	push   %ebp
+     781:	89 e5                	mov    %esp,%ebp
+     783:	57                   	push   %edi
+     784:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("cld; rep stosb" :
+     787:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     78a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     78d:	89 d7                	mov    %edx,%edi
+     78f:	fc                   	cld
+     790:	f3 aa                	rep stos %al,%es:(%edi)
+}
+     792:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     795:	89 d0                	mov    %edx,%eax
+     797:	c9                   	leave
+     798:	c3                   	ret
+     799:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000007a0 <strchr>:
+{
+     7a0:	55                   	push   %ebp
+     7a1:	89 e5                	mov    %esp,%ebp
+     7a3:	8b 45 08             	mov    0x8(%ebp),%eax
+     7a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     7aa:	0f b6 10             	movzbl (%eax),%edx
+     7ad:	84 d2                	test   %dl,%dl
+     7af:	75 12                	jne    7c3 <strchr+0x23>
+     7b1:	eb 1d                	jmp    7d0 <strchr+0x30>
+     7b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7b7:	90                   	nop
+     7b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     7bc:	83 c0 01             	add    $0x1,%eax
+     7bf:	84 d2                	test   %dl,%dl
+     7c1:	74 0d                	je     7d0 <strchr+0x30>
+    if(*s == c)
+     7c3:	38 d1                	cmp    %dl,%cl
+     7c5:	75 f1                	jne    7b8 <strchr+0x18>
+}
+     7c7:	5d                   	pop    %ebp
+     7c8:	c3                   	ret
+     7c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     7d0:	31 c0                	xor    %eax,%eax
+}
+     7d2:	5d                   	pop    %ebp
+     7d3:	c3                   	ret
+     7d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7df:	90                   	nop
+
+000007e0 <memchr>:
+{
+     7e0:	55                   	push   %ebp
+     7e1:	89 e5                	mov    %esp,%ebp
+     7e3:	8b 55 10             	mov    0x10(%ebp),%edx
+     7e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     7e9:	85 d2                	test   %edx,%edx
+     7eb:	74 1b                	je     808 <memchr+0x28>
+    if(*p == (char)c)
+     7ed:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+     7f1:	01 c2                	add    %eax,%edx
+     7f3:	eb 0a                	jmp    7ff <memchr+0x1f>
+     7f5:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+     7f8:	83 c0 01             	add    $0x1,%eax
+     7fb:	39 c2                	cmp    %eax,%edx
+     7fd:	74 09                	je     808 <memchr+0x28>
+    if(*p == (char)c)
+     7ff:	38 08                	cmp    %cl,(%eax)
+     801:	75 f5                	jne    7f8 <memchr+0x18>
+}
+     803:	5d                   	pop    %ebp
+     804:	c3                   	ret
+     805:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+     808:	31 c0                	xor    %eax,%eax
+}
+     80a:	5d                   	pop    %ebp
+     80b:	c3                   	ret
+     80c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000810 <gets>:
+{
+     810:	55                   	push   %ebp
+     811:	89 e5                	mov    %esp,%ebp
+     813:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+     814:	31 ff                	xor    %edi,%edi
+{
+     816:	56                   	push   %esi
+     817:	be 28 d7 02 00       	mov    $0x2d728,%esi
+     81c:	53                   	push   %ebx
+     81d:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     820:	8b 46 fc             	mov    -0x4(%esi),%eax
+     823:	85 c0                	test   %eax,%eax
+     825:	7e 15                	jle    83c <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     827:	83 ec 04             	sub    $0x4,%esp
+     82a:	50                   	push   %eax
+     82b:	56                   	push   %esi
+     82c:	57                   	push   %edi
+     82d:	e8 db 01 00 00       	call   a0d <write>
+    ob[fd].n = 0;
+     832:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+     839:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     83c:	83 c7 01             	add    $0x1,%edi
+     83f:	81 c6 08 01 00 00    	add    $0x108,%esi
+     845:	83 ff 10             	cmp    $0x10,%edi
+     848:	75 d6                	jne    820 <gets+0x10>
+  for(i=0; i+1 < max; ){
+     84a:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+     84c:	8d 75 e7             	lea    -0x19(%ebp),%esi
+     84f:	eb 2e                	jmp    87f <gets+0x6f>
+     851:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     858:	83 ec 04             	sub    $0x4,%esp
+     85b:	6a 01                	push   $0x1
+     85d:	56                   	push   %esi
+     85e:	6a 00                	push   $0x0
+     860:	e8 a1 01 00 00       	call   a06 <read>
+    if(cc < 1)
+     865:	83 c4 10             	add    $0x10,%esp
+     868:	85 c0                	test   %eax,%eax
+     86a:	7e 1d                	jle    889 <gets+0x79>
+    buf[i++] = c;
+     86c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     870:	8b 55 08             	mov    0x8(%ebp),%edx
+     873:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     877:	3c 0a                	cmp    $0xa,%al
+     879:	74 10                	je     88b <gets+0x7b>
+     87b:	3c 0d                	cmp    $0xd,%al
+     87d:	74 0c                	je     88b <gets+0x7b>
+  for(i=0; i+1 < max; ){
+     87f:	89 df                	mov    %ebx,%edi
+     881:	83 c3 01             	add    $0x1,%ebx
+     884:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     887:	7c cf                	jl     858 <gets+0x48>
+     889:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     88b:	8b 45 08             	mov    0x8(%ebp),%eax
+     88e:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     892:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     895:	5b                   	pop    %ebx
+     896:	5e                   	pop    %esi
+     897:	5f                   	pop    %edi
+     898:	5d                   	pop    %ebp
+     899:	c3                   	ret
+     89a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008a0 <stat>:
+{
+     8a0:	55                   	push   %ebp
+     8a1:	89 e5                	mov    %esp,%ebp
+     8a3:	57                   	push   %edi
+     8a4:	56                   	push   %esi
+     8a5:	53                   	push   %ebx
+     8a6:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+     8a9:	6a 00                	push   $0x0
+     8ab:	ff 75 08             	push   0x8(%ebp)
+     8ae:	e8 76 01 00 00       	call   a29 <open>
+  if(fd < 0)
+     8b3:	83 c4 10             	add    $0x10,%esp
+     8b6:	85 c0                	test   %eax,%eax
+     8b8:	78 76                	js     930 <stat+0x90>
+  r = fstat(fd, st);
+     8ba:	83 ec 08             	sub    $0x8,%esp
+     8bd:	ff 75 0c             	push   0xc(%ebp)
+     8c0:	89 c3                	mov    %eax,%ebx
+     8c2:	50                   	push   %eax
+     8c3:	e8 7f 01 00 00       	call   a47 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     8c8:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     8cb:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     8cd:	83 fb 0f             	cmp    $0xf,%ebx
+     8d0:	7f 40                	jg     912 <stat+0x72>
+     8d2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     8d8:	8b 90 24 d7 02 00    	mov    0x2d724(%eax),%edx
+     8de:	8d b8 20 d7 02 00    	lea    0x2d720(%eax),%edi
+     8e4:	85 d2                	test   %edx,%edx
+     8e6:	7e 1a                	jle    902 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+     8e8:	83 ec 04             	sub    $0x4,%esp
+     8eb:	05 28 d7 02 00       	add    $0x2d728,%eax
+     8f0:	52                   	push   %edx
+     8f1:	50                   	push   %eax
+     8f2:	53                   	push   %ebx
+     8f3:	e8 15 01 00 00       	call   a0d <write>
+    ob[fd].n = 0;
+     8f8:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+     8ff:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+     902:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     908:	c7 80 20 d7 02 00 00 	movl   $0x0,0x2d720(%eax)
+     90f:	00 00 00 
+  return _close(fd);
+     912:	83 ec 0c             	sub    $0xc,%esp
+     915:	53                   	push   %ebx
+     916:	e8 f9 00 00 00       	call   a14 <_close>
+     91b:	83 c4 10             	add    $0x10,%esp
+}
+     91e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     921:	89 f0                	mov    %esi,%eax
+     923:	5b                   	pop    %ebx
+     924:	5e                   	pop    %esi
+     925:	5f                   	pop    %edi
+     926:	5d                   	pop    %ebp
+     927:	c3                   	ret
+     928:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     92f:	90                   	nop
+    return -1;
+     930:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     935:	eb e7                	jmp    91e <stat+0x7e>
+     937:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     93e:	66 90                	xchg   %ax,%ax
+
+00000940 <atoi>:
+{
+     940:	55                   	push   %ebp
+     941:	89 e5                	mov    %esp,%ebp
+     943:	53                   	push   %ebx
+     944:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     947:	0f be 02             	movsbl (%edx),%eax
+     94a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     94d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     950:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     955:	77 1e                	ja     975 <atoi+0x35>
+     957:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     95e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     960:	83 c2 01             	add    $0x1,%edx
+     963:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     966:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     96a:	0f be 02             	movsbl (%edx),%eax
+     96d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     970:	80 fb 09             	cmp    $0x9,%bl
+     973:	76 eb                	jbe    960 <atoi+0x20>
+}
+     975:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     978:	89 c8                	mov    %ecx,%eax
+     97a:	c9                   	leave
+     97b:	c3                   	ret
+     97c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000980 <memmove>:
+{
+     980:	55                   	push   %ebp
+     981:	89 e5                	mov    %esp,%ebp
+     983:	57                   	push   %edi
+     984:	56                   	push   %esi
+     985:	8b 45 10             	mov    0x10(%ebp),%eax
+     988:	8b 55 08             	mov    0x8(%ebp),%edx
+     98b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     98e:	85 c0                	test   %eax,%eax
+     990:	7e 13                	jle    9a5 <memmove+0x25>
+     992:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     994:	89 d7                	mov    %edx,%edi
+     996:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     99d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     9a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     9a1:	39 f8                	cmp    %edi,%eax
+     9a3:	75 fb                	jne    9a0 <memmove+0x20>
+  return vdst;
+}
+     9a5:	5e                   	pop    %esi
+     9a6:	89 d0                	mov    %edx,%eax
+     9a8:	5f                   	pop    %edi
+     9a9:	5d                   	pop    %ebp
+     9aa:	c3                   	ret
+
+000009ab <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+     9ab:	83 3d fc 16 00 00 00 	cmpl   $0x0,0x16fc
+  jle 1f
+     9b2:	7e 0a                	jle    9be <syscallentry+0x13>
+  movl %esp, %ecx
+     9b4:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+     9b6:	ba bd 09 00 00       	mov    $0x9bd,%edx
+  sysenter
+     9bb:	0f 34                	sysenter
+2:
+  ret
+     9bd:	c3                   	ret
+1:
+  jl 3f
+     9be:	7c 27                	jl     9e7 <syscallentry+0x3c>
+  pushal
+     9c0:	60                   	pusha
+  movl $1, %eax
+     9c1:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     9c6:	0f a2                	cpuid
+  movl $-1, sysentermode
+     9c8:	c7 05 fc 16 00 00 ff 	movl   $0xffffffff,0x16fc
+     9cf:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     9d2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+     9d8:	74 0a                	je     9e4 <syscallentry+0x39>
+  movl $1, sysentermode
+     9da:	c7 05 fc 16 00 00 01 	movl   $0x1,0x16fc
+     9e1:	00 00 00 
+4:
+  popal
+     9e4:	61                   	popa
+  jmp syscallentry
+     9e5:	eb c4                	jmp    9ab <syscallentry>
+3:
+  int $T_SYSCALL
+     9e7:	cd 40                	int    $0x40
+  ret
+     9e9:	c3                   	ret
+
+000009ea <_fork>:
+
+SYSCALLAS(_fork, fork)
+     9ea:	b8 01 00 00 00       	mov    $0x1,%eax
+     9ef:	eb ba                	jmp    9ab <syscallentry>
+
+000009f1 <_exit>:
+SYSCALLAS(_exit, exit)
+     9f1:	b8 02 00 00 00       	mov    $0x2,%eax
+     9f6:	eb b3                	jmp    9ab <syscallentry>
+
+000009f8 <wait>:
+SYSCALL(wait)
+     9f8:	b8 03 00 00 00       	mov    $0x3,%eax
+     9fd:	eb ac                	jmp    9ab <syscallentry>
+
+000009ff <pipe>:
+SYSCALL(pipe)
+     9ff:	b8 04 00 00 00       	mov    $0x4,%eax
+     a04:	eb a5                	jmp    9ab <syscallentry>
+
+00000a06 <read>:
+SYSCALL(read)
+     a06:	b8 05 00 00 00       	mov    $0x5,%eax
+     a0b:	eb 9e                	jmp    9ab <syscallentry>
+
+00000a0d <write>:
+SYSCALL(write)
+     a0d:	b8 10 00 00 00       	mov    $0x10,%eax
+     a12:	eb 97                	jmp    9ab <syscallentry>
+
+00000a14 <_close>:
+SYSCALLAS(_close, close)
+     a14:	b8 15 00 00 00       	mov    $0x15,%eax
+     a19:	eb 90                	jmp    9ab <syscallentry>
+
+00000a1b <kill>:
+SYSCALL(kill)
+     a1b:	b8 06 00 00 00       	mov    $0x6,%eax
+     a20:	eb 89                	jmp    9ab <syscallentry>
+
+00000a22 <_exec>:
+SYSCALLAS(_exec, exec)
+     a22:	b8 07 00 00 00       	mov    $0x7,%eax
+     a27:	eb 82                	jmp    9ab <syscallentry>
+
+00000a29 <open>:
+SYSCALL(open)
+     a29:	b8 0f 00 00 00       	mov    $0xf,%eax
+     a2e:	e9 78 ff ff ff       	jmp    9ab <syscallentry>
+
+00000a33 <mknod>:
+SYSCALL(mknod)
+     a33:	b8 11 00 00 00       	mov    $0x11,%eax
+     a38:	e9 6e ff ff ff       	jmp    9ab <syscallentry>
+
+00000a3d <unlink>:
+SYSCALL(unlink)
+     a3d:	b8 12 00 00 00       	mov    $0x12,%eax
+     a42:	e9 64 ff ff ff       	jmp    9ab <syscallentry>
+
+00000a47 <fstat>:
+SYSCALL(fstat)
+     a47:	b8 08 00 00 00       	mov    $0x8,%eax
+     a4c:	e9 5a ff ff ff       	jmp    9ab <syscallentry>
+
+00000a51 <link>:
+SYSCALL(link)
+     a51:	b8 13 00 00 00       	mov    $0x13,%eax
+     a56:	e9 50 ff ff ff       	jmp    9ab <syscallentry>
+
+00000a5b <mkdir>:
+SYSCALL(mkdir)
+     a5b:	b8 14 00 00 00       	mov    $0x14,%eax
+     a60:	e9 46 ff ff ff       	jmp    9ab <syscallentry>
+
+00000a65 <chdir>:
+SYSCALL(chdir)
+     a65:	b8 09 00 00 00       	mov    $0x9,%eax
+     a6a:	e9 3c ff ff ff       	jmp    9ab <syscallentry>
+
+00000a6f <dup>:
+SYSCALL(dup)
+     a6f:	b8 0a 00 00 00       	mov    $0xa,%eax
+     a74:	e9 32 ff ff ff       	jmp    9ab <syscallentry>
+
+00000a79 <getpid>:
+SYSCALL(getpid)
+     a79:	b8 0b 00 00 00       	mov    $0xb,%eax
+     a7e:	e9 28 ff ff ff       	jmp    9ab <syscallentry>
+
+00000a83 <sbrk>:
+SYSCALL(sbrk)
+     a83:	b8 0c 00 00 00       	mov    $0xc,%eax
+     a88:	e9 1e ff ff ff       	jmp    9ab <syscallentry>
+
+00000a8d <sleep>:
+SYSCALL(sleep)
+     a8d:	b8 0d 00 00 00       	mov    $0xd,%eax
+     a92:	e9 14 ff ff ff       	jmp    9ab <syscallentry>
+
+00000a97 <uptime>:
+SYSCALL(uptime)
+     a97:	b8 0e 00 00 00       	mov    $0xe,%eax
+     a9c:	e9 0a ff ff ff       	jmp    9ab <syscallentry>
+
+00000aa1 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+     aa1:	b8 16 00 00 00       	mov    $0x16,%eax
+     aa6:	e9 00 ff ff ff       	jmp    9ab <syscallentry>
+
+00000aab <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+     aab:	b8 17 00 00 00       	mov    $0x17,%eax
+     ab0:	e9 f6 fe ff ff       	jmp    9ab <syscallentry>
+
+00000ab5 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+     ab5:	b8 18 00 00 00       	mov    $0x18,%eax
+     aba:	e9 ec fe ff ff       	jmp    9ab <syscallentry>
+
+00000abf <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+     abf:	b8 19 00 00 00       	mov    $0x19,%eax
+     ac4:	e9 e2 fe ff ff       	jmp    9ab <syscallentry>
+
+00000ac9 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+     ac9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     ace:	e9 d8 fe ff ff       	jmp    9ab <syscallentry>
+
+00000ad3 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+     ad3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     ad8:	e9 ce fe ff ff       	jmp    9ab <syscallentry>
+
+00000add <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+     add:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     ae2:	e9 c4 fe ff ff       	jmp    9ab <syscallentry>
+
+00000ae7 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+     ae7:	b8 20 00 00 00       	mov    $0x20,%eax
+     aec:	e9 ba fe ff ff       	jmp    9ab <syscallentry>
+
+00000af1 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+     af1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     af6:	e9 b0 fe ff ff       	jmp    9ab <syscallentry>
+
+00000afb <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+     afb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     b00:	e9 a6 fe ff ff       	jmp    9ab <syscallentry>
+
+00000b05 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+     b05:	b8 21 00 00 00       	mov    $0x21,%eax
+     b0a:	e9 9c fe ff ff       	jmp    9ab <syscallentry>
+
+00000b0f <yield>:
+SYSCALL(yield) // yield the CPU to another process
+     b0f:	b8 22 00 00 00       	mov    $0x22,%eax
+     b14:	e9 92 fe ff ff       	jmp    9ab <syscallentry>
+
+00000b19 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+     b19:	b8 23 00 00 00       	mov    $0x23,%eax
+     b1e:	e9 88 fe ff ff       	jmp    9ab <syscallentry>
+
+00000b23 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+     b23:	b8 24 00 00 00       	mov    $0x24,%eax
+     b28:	e9 7e fe ff ff       	jmp    9ab <syscallentry>
+
+00000b2d <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+     b2d:	b8 25 00 00 00       	mov    $0x25,%eax
+     b32:	e9 74 fe ff ff       	jmp    9ab <syscallentry>
+
+00000b37 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+     b37:	b8 26 00 00 00       	mov    $0x26,%eax
+     b3c:	e9 6a fe ff ff       	jmp    9ab <syscallentry>
+
+00000b41 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+     b41:	b8 27 00 00 00       	mov    $0x27,%eax
+     b46:	e9 60 fe ff ff       	jmp    9ab <syscallentry>
+
+00000b4b <mmap>:
+SYSCALL(mmap) // map a file into memory
+     b4b:	b8 28 00 00 00       	mov    $0x28,%eax
+     b50:	e9 56 fe ff ff       	jmp    9ab <syscallentry>
+
+00000b55 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+     b55:	b8 29 00 00 00       	mov    $0x29,%eax
+     b5a:	e9 4c fe ff ff       	jmp    9ab <syscallentry>
+
+00000b5f <readv>:
+SYSCALL(readv) // read into several buffers
+     b5f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     b64:	e9 42 fe ff ff       	jmp    9ab <syscallentry>
+
+00000b69 <writev>:
+SYSCALL(writev) // write from several buffers
+     b69:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     b6e:	e9 38 fe ff ff       	jmp    9ab <syscallentry>
+
+00000b73 <pread>:
+SYSCALL(pread) // read at an offset
+     b73:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     b78:	e9 2e fe ff ff       	jmp    9ab <syscallentry>
+
+00000b7d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+     b7d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     b82:	e9 24 fe ff ff       	jmp    9ab <syscallentry>
+
+00000b87 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+     b87:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     b8c:	e9 1a fe ff ff       	jmp    9ab <syscallentry>
+
+00000b91 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+     b91:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     b96:	e9 10 fe ff ff       	jmp    9ab <syscallentry>
+
+00000b9b <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+     b9b:	b8 30 00 00 00       	mov    $0x30,%eax
+     ba0:	e9 06 fe ff ff       	jmp    9ab <syscallentry>
+
+00000ba5 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+     ba5:	b8 31 00 00 00       	mov    $0x31,%eax
+     baa:	e9 fc fd ff ff       	jmp    9ab <syscallentry>
+
+00000baf <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+     baf:	b8 32 00 00 00       	mov    $0x32,%eax
+     bb4:	e9 f2 fd ff ff       	jmp    9ab <syscallentry>
+
+00000bb9 <profread>:
+SYSCALL(profread) // drain profiler samples
+     bb9:	b8 33 00 00 00       	mov    $0x33,%eax
+     bbe:	e9 e8 fd ff ff       	jmp    9ab <syscallentry>
+
+00000bc3 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+     bc3:	b8 34 00 00 00       	mov    $0x34,%eax
+     bc8:	e9 de fd ff ff       	jmp    9ab <syscallentry>
+
+00000bcd <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+     bcd:	b8 35 00 00 00       	mov    $0x35,%eax
+     bd2:	e9 d4 fd ff ff       	jmp    9ab <syscallentry>
+
+00000bd7 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+     bd7:	b8 36 00 00 00       	mov    $0x36,%eax
+     bdc:	e9 ca fd ff ff       	jmp    9ab <syscallentry>
+
+00000be1 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+     be1:	b8 37 00 00 00       	mov    $0x37,%eax
+     be6:	e9 c0 fd ff ff       	jmp    9ab <syscallentry>
+     beb:	66 90                	xchg   %ax,%ax
+     bed:	66 90                	xchg   %ax,%ax
+     bef:	90                   	nop
+
+00000bf0 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     bf0:	55                   	push   %ebp
+     bf1:	89 e5                	mov    %esp,%ebp
+     bf3:	57                   	push   %edi
+     bf4:	56                   	push   %esi
+     bf5:	53                   	push   %ebx
+     bf6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     bf8:	89 d1                	mov    %edx,%ecx
+{
+     bfa:	83 ec 3c             	sub    $0x3c,%esp
+     bfd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     c00:	85 d2                	test   %edx,%edx
+     c02:	0f 89 80 00 00 00    	jns    c88 <printint+0x98>
+     c08:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     c0c:	74 7a                	je     c88 <printint+0x98>
+    x = -xx;
+     c0e:	f7 d9                	neg    %ecx
+    neg = 1;
+     c10:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     c15:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     c18:	31 f6                	xor    %esi,%esi
+     c1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     c20:	89 c8                	mov    %ecx,%eax
+     c22:	31 d2                	xor    %edx,%edx
+     c24:	89 f7                	mov    %esi,%edi
+     c26:	f7 f3                	div    %ebx
+     c28:	8d 76 01             	lea    0x1(%esi),%esi
+     c2b:	0f b6 92 44 12 00 00 	movzbl 0x1244(%edx),%edx
+     c32:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     c36:	89 ca                	mov    %ecx,%edx
+     c38:	89 c1                	mov    %eax,%ecx
+     c3a:	39 da                	cmp    %ebx,%edx
+     c3c:	73 e2                	jae    c20 <printint+0x30>
+  if(neg)
+     c3e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     c41:	85 c0                	test   %eax,%eax
+     c43:	74 07                	je     c4c <printint+0x5c>
+    buf[i++] = '-';
+     c45:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     c4a:	89 f7                	mov    %esi,%edi
+     c4c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     c4f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     c52:	01 df                	add    %ebx,%edi
+     c54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     c58:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+     c5b:	83 ec 04             	sub    $0x4,%esp
+     c5e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     c61:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     c64:	6a 01                	push   $0x1
+     c66:	50                   	push   %eax
+     c67:	56                   	push   %esi
+     c68:	e8 e3 f6 ff ff       	call   350 <bufwrite>
+  while(--i >= 0)
+     c6d:	89 f8                	mov    %edi,%eax
+     c6f:	83 c4 10             	add    $0x10,%esp
+     c72:	83 ef 01             	sub    $0x1,%edi
+     c75:	39 d8                	cmp    %ebx,%eax
+     c77:	75 df                	jne    c58 <printint+0x68>
+}
+     c79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c7c:	5b                   	pop    %ebx
+     c7d:	5e                   	pop    %esi
+     c7e:	5f                   	pop    %edi
+     c7f:	5d                   	pop    %ebp
+     c80:	c3                   	ret
+     c81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     c88:	31 c0                	xor    %eax,%eax
+     c8a:	eb 89                	jmp    c15 <printint+0x25>
+     c8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c90 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     c90:	55                   	push   %ebp
+     c91:	89 e5                	mov    %esp,%ebp
+     c93:	57                   	push   %edi
+     c94:	56                   	push   %esi
+     c95:	53                   	push   %ebx
+     c96:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     c99:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c9c:	0f b6 18             	movzbl (%eax),%ebx
+     c9f:	84 db                	test   %bl,%bl
+     ca1:	74 6c                	je     d0f <printf+0x7f>
+     ca3:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+     ca6:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+     ca9:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     cab:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     cae:	eb 26                	jmp    cd6 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     cb0:	83 f8 25             	cmp    $0x25,%eax
+     cb3:	74 4b                	je     d00 <printf+0x70>
+  bufwrite(fd, &c, 1);
+     cb5:	83 ec 04             	sub    $0x4,%esp
+     cb8:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     cbb:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     cbe:	6a 01                	push   $0x1
+     cc0:	50                   	push   %eax
+     cc1:	ff 75 08             	push   0x8(%ebp)
+     cc4:	e8 87 f6 ff ff       	call   350 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+     cc9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     ccc:	0f b6 1f             	movzbl (%edi),%ebx
+     ccf:	83 c7 01             	add    $0x1,%edi
+     cd2:	84 db                	test   %bl,%bl
+     cd4:	74 39                	je     d0f <printf+0x7f>
+    c = fmt[i] & 0xff;
+     cd6:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     cd9:	85 f6                	test   %esi,%esi
+     cdb:	74 d3                	je     cb0 <printf+0x20>
+      }
+    } else if(state == '%'){
+     cdd:	83 fe 25             	cmp    $0x25,%esi
+     ce0:	75 ea                	jne    ccc <printf+0x3c>
+      if(c == 'd'){
+     ce2:	83 f8 25             	cmp    $0x25,%eax
+     ce5:	0f 84 d5 01 00 00    	je     ec0 <printf+0x230>
+     ceb:	83 e8 63             	sub    $0x63,%eax
+     cee:	83 f8 15             	cmp    $0x15,%eax
+     cf1:	77 45                	ja     d38 <printf+0xa8>
+     cf3:	ff 24 85 ec 11 00 00 	jmp    *0x11ec(,%eax,4)
+     cfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     d00:	0f b6 1f             	movzbl (%edi),%ebx
+     d03:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+     d06:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     d0b:	84 db                	test   %bl,%bl
+     d0d:	75 c7                	jne    cd6 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+     d0f:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+     d13:	74 0b                	je     d20 <printf+0x90>
+    fflush(fd);
+}
+     d15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d18:	5b                   	pop    %ebx
+     d19:	5e                   	pop    %esi
+     d1a:	5f                   	pop    %edi
+     d1b:	5d                   	pop    %ebp
+     d1c:	c3                   	ret
+     d1d:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+     d20:	83 ec 0c             	sub    $0xc,%esp
+     d23:	6a 02                	push   $0x2
+     d25:	e8 c6 f7 ff ff       	call   4f0 <fflush>
+     d2a:	83 c4 10             	add    $0x10,%esp
+}
+     d2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d30:	5b                   	pop    %ebx
+     d31:	5e                   	pop    %esi
+     d32:	5f                   	pop    %edi
+     d33:	5d                   	pop    %ebp
+     d34:	c3                   	ret
+     d35:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+     d38:	83 ec 04             	sub    $0x4,%esp
+     d3b:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     d3e:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+     d42:	6a 01                	push   $0x1
+     d44:	52                   	push   %edx
+     d45:	89 55 c0             	mov    %edx,-0x40(%ebp)
+     d48:	ff 75 08             	push   0x8(%ebp)
+     d4b:	e8 00 f6 ff ff       	call   350 <bufwrite>
+     d50:	83 c4 0c             	add    $0xc,%esp
+     d53:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     d56:	6a 01                	push   $0x1
+     d58:	8b 55 c0             	mov    -0x40(%ebp),%edx
+     d5b:	52                   	push   %edx
+      state = 0;
+     d5c:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+     d5e:	ff 75 08             	push   0x8(%ebp)
+     d61:	e8 ea f5 ff ff       	call   350 <bufwrite>
+        putc(fd, c);
+     d66:	83 c4 10             	add    $0x10,%esp
+     d69:	e9 5e ff ff ff       	jmp    ccc <printf+0x3c>
+     d6e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+     d70:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     d73:	83 ec 0c             	sub    $0xc,%esp
+     d76:	b9 10 00 00 00       	mov    $0x10,%ecx
+     d7b:	8b 16                	mov    (%esi),%edx
+     d7d:	6a 00                	push   $0x0
+     d7f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+     d82:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+     d85:	e8 66 fe ff ff       	call   bf0 <printint>
+        ap++;
+     d8a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     d8d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d90:	31 f6                	xor    %esi,%esi
+     d92:	e9 35 ff ff ff       	jmp    ccc <printf+0x3c>
+     d97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d9e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     da0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     da3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     da5:	83 c0 04             	add    $0x4,%eax
+     da8:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+     dab:	b8 e3 11 00 00       	mov    $0x11e3,%eax
+     db0:	85 db                	test   %ebx,%ebx
+     db2:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+     db5:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+     db8:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+     dba:	53                   	push   %ebx
+     dbb:	e8 90 f9 ff ff       	call   750 <strlen>
+     dc0:	83 c4 0c             	add    $0xc,%esp
+     dc3:	50                   	push   %eax
+     dc4:	53                   	push   %ebx
+     dc5:	ff 75 08             	push   0x8(%ebp)
+     dc8:	e8 83 f5 ff ff       	call   350 <bufwrite>
+     dcd:	83 c4 10             	add    $0x10,%esp
+     dd0:	e9 f7 fe ff ff       	jmp    ccc <printf+0x3c>
+     dd5:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+     dd8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+     ddb:	83 ec 04             	sub    $0x4,%esp
+     dde:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+     de1:	8b 06                	mov    (%esi),%eax
+        ap++;
+     de3:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+     de6:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+     de9:	6a 01                	push   $0x1
+     deb:	52                   	push   %edx
+     dec:	ff 75 08             	push   0x8(%ebp)
+     def:	e8 5c f5 ff ff       	call   350 <bufwrite>
+        ap++;
+     df4:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     df7:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     dfa:	31 f6                	xor    %esi,%esi
+     dfc:	e9 cb fe ff ff       	jmp    ccc <printf+0x3c>
+     e01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+     e08:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     e0b:	83 ec 0c             	sub    $0xc,%esp
+     e0e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     e13:	8b 16                	mov    (%esi),%edx
+     e15:	6a 01                	push   $0x1
+     e17:	e9 63 ff ff ff       	jmp    d7f <printf+0xef>
+     e1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+     e20:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     e23:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     e26:	89 7d c0             	mov    %edi,-0x40(%ebp)
+     e29:	89 55 bc             	mov    %edx,-0x44(%ebp)
+     e2c:	8b 18                	mov    (%eax),%ebx
+     e2e:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+     e31:	31 c0                	xor    %eax,%eax
+     e33:	89 c7                	mov    %eax,%edi
+     e35:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+     e38:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+     e3d:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+     e3f:	f7 e1                	mul    %ecx
+     e41:	c1 ea 03             	shr    $0x3,%edx
+     e44:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     e47:	89 d1                	mov    %edx,%ecx
+     e49:	01 c0                	add    %eax,%eax
+     e4b:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     e4d:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+     e4f:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     e51:	be 0a 00 00 00       	mov    $0xa,%esi
+     e56:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+     e58:	89 da                	mov    %ebx,%edx
+     e5a:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+     e5c:	89 fe                	mov    %edi,%esi
+     e5e:	83 c7 01             	add    $0x1,%edi
+     e61:	8d 42 30             	lea    0x30(%edx),%eax
+     e64:	89 da                	mov    %ebx,%edx
+     e66:	8d 14 92             	lea    (%edx,%edx,4),%edx
+     e69:	01 d2                	add    %edx,%edx
+     e6b:	29 d0                	sub    %edx,%eax
+     e6d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+     e71:	89 c8                	mov    %ecx,%eax
+     e73:	09 d8                	or     %ebx,%eax
+     e75:	75 c1                	jne    e38 <printf+0x1a8>
+     e77:	8b 55 bc             	mov    -0x44(%ebp),%edx
+     e7a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     e7d:	01 d6                	add    %edx,%esi
+     e7f:	89 f7                	mov    %esi,%edi
+     e81:	89 d6                	mov    %edx,%esi
+     e83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e87:	90                   	nop
+    putc(fd, buf[i]);
+     e88:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+     e8b:	83 ec 04             	sub    $0x4,%esp
+     e8e:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+     e91:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+     e94:	6a 01                	push   $0x1
+     e96:	50                   	push   %eax
+     e97:	53                   	push   %ebx
+     e98:	e8 b3 f4 ff ff       	call   350 <bufwrite>
+  while(--i >= 0)
+     e9d:	89 fa                	mov    %edi,%edx
+     e9f:	83 c4 10             	add    $0x10,%esp
+     ea2:	83 ef 01             	sub    $0x1,%edi
+     ea5:	39 d6                	cmp    %edx,%esi
+     ea7:	75 df                	jne    e88 <printf+0x1f8>
+        ap += 2;
+     ea9:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+     ead:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+     eb0:	31 f6                	xor    %esi,%esi
+     eb2:	e9 15 fe ff ff       	jmp    ccc <printf+0x3c>
+     eb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ebe:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+     ec0:	83 ec 04             	sub    $0x4,%esp
+     ec3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     ec6:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     ec9:	6a 01                	push   $0x1
+     ecb:	e9 8b fe ff ff       	jmp    d5b <printf+0xcb>
+
+00000ed0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     ed0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     ed1:	a1 a0 e7 02 00       	mov    0x2e7a0,%eax
+{
+     ed6:	89 e5                	mov    %esp,%ebp
+     ed8:	57                   	push   %edi
+     ed9:	56                   	push   %esi
+     eda:	53                   	push   %ebx
+     edb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     ede:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     ee1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ee8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     eea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     eec:	39 ca                	cmp    %ecx,%edx
+     eee:	73 30                	jae    f20 <free+0x50>
+     ef0:	39 c1                	cmp    %eax,%ecx
+     ef2:	72 04                	jb     ef8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     ef4:	39 c2                	cmp    %eax,%edx
+     ef6:	72 f0                	jb     ee8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     ef8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     efb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     efe:	39 f8                	cmp    %edi,%eax
+     f00:	74 2e                	je     f30 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f02:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     f05:	8b 42 04             	mov    0x4(%edx),%eax
+     f08:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     f0b:	39 f1                	cmp    %esi,%ecx
+     f0d:	74 38                	je     f47 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     f0f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     f11:	5b                   	pop    %ebx
+  freep = p;
+     f12:	89 15 a0 e7 02 00    	mov    %edx,0x2e7a0
+}
+     f18:	5e                   	pop    %esi
+     f19:	5f                   	pop    %edi
+     f1a:	5d                   	pop    %ebp
+     f1b:	c3                   	ret
+     f1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f20:	39 c1                	cmp    %eax,%ecx
+     f22:	72 d0                	jb     ef4 <free+0x24>
+     f24:	eb c2                	jmp    ee8 <free+0x18>
+     f26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f2d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+     f30:	03 70 04             	add    0x4(%eax),%esi
+     f33:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f36:	8b 02                	mov    (%edx),%eax
+     f38:	8b 00                	mov    (%eax),%eax
+     f3a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     f3d:	8b 42 04             	mov    0x4(%edx),%eax
+     f40:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     f43:	39 f1                	cmp    %esi,%ecx
+     f45:	75 c8                	jne    f0f <free+0x3f>
+    p->s.size += bp->s.size;
+     f47:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     f4a:	89 15 a0 e7 02 00    	mov    %edx,0x2e7a0
+    p->s.size += bp->s.size;
+     f50:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     f53:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     f56:	89 0a                	mov    %ecx,(%edx)
+}
+     f58:	5b                   	pop    %ebx
+     f59:	5e                   	pop    %esi
+     f5a:	5f                   	pop    %edi
+     f5b:	5d                   	pop    %ebp
+     f5c:	c3                   	ret
+     f5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f60 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     f60:	55                   	push   %ebp
+     f61:	89 e5                	mov    %esp,%ebp
+     f63:	57                   	push   %edi
+     f64:	56                   	push   %esi
+     f65:	53                   	push   %ebx
+     f66:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f69:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+     f6c:	8b 15 a0 e7 02 00    	mov    0x2e7a0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f72:	8d 78 07             	lea    0x7(%eax),%edi
+     f75:	c1 ef 03             	shr    $0x3,%edi
+     f78:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+     f7b:	85 d2                	test   %edx,%edx
+     f7d:	0f 84 8d 00 00 00    	je     1010 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f83:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     f85:	8b 48 04             	mov    0x4(%eax),%ecx
+     f88:	39 f9                	cmp    %edi,%ecx
+     f8a:	73 64                	jae    ff0 <malloc+0x90>
+  if(nu < 4096)
+     f8c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     f91:	39 df                	cmp    %ebx,%edi
+     f93:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     f96:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     f9d:	eb 0a                	jmp    fa9 <malloc+0x49>
+     f9f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     fa0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     fa2:	8b 48 04             	mov    0x4(%eax),%ecx
+     fa5:	39 f9                	cmp    %edi,%ecx
+     fa7:	73 47                	jae    ff0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     fa9:	89 c2                	mov    %eax,%edx
+     fab:	39 05 a0 e7 02 00    	cmp    %eax,0x2e7a0
+     fb1:	75 ed                	jne    fa0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+     fb3:	83 ec 0c             	sub    $0xc,%esp
+     fb6:	56                   	push   %esi
+     fb7:	e8 c7 fa ff ff       	call   a83 <sbrk>
+  if(p == (char*)-1)
+     fbc:	83 c4 10             	add    $0x10,%esp
+     fbf:	83 f8 ff             	cmp    $0xffffffff,%eax
+     fc2:	74 1c                	je     fe0 <malloc+0x80>
+  hp->s.size = nu;
+     fc4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+     fc7:	83 ec 0c             	sub    $0xc,%esp
+     fca:	83 c0 08             	add    $0x8,%eax
+     fcd:	50                   	push   %eax
+     fce:	e8 fd fe ff ff       	call   ed0 <free>
+  return freep;
+     fd3:	8b 15 a0 e7 02 00    	mov    0x2e7a0,%edx
+      if((p = morecore(nunits)) == 0)
+     fd9:	83 c4 10             	add    $0x10,%esp
+     fdc:	85 d2                	test   %edx,%edx
+     fde:	75 c0                	jne    fa0 <malloc+0x40>
+        return 0;
+  }
+}
+     fe0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     fe3:	31 c0                	xor    %eax,%eax
+}
+     fe5:	5b                   	pop    %ebx
+     fe6:	5e                   	pop    %esi
+     fe7:	5f                   	pop    %edi
+     fe8:	5d                   	pop    %ebp
+     fe9:	c3                   	ret
+     fea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     ff0:	39 cf                	cmp    %ecx,%edi
+     ff2:	74 4c                	je     1040 <malloc+0xe0>
+        p->s.size -= nunits;
+     ff4:	29 f9                	sub    %edi,%ecx
+     ff6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+     ff9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+     ffc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+     fff:	89 15 a0 e7 02 00    	mov    %edx,0x2e7a0
+}
+    1005:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1008:	83 c0 08             	add    $0x8,%eax
+}
+    100b:	5b                   	pop    %ebx
+    100c:	5e                   	pop    %esi
+    100d:	5f                   	pop    %edi
+    100e:	5d                   	pop    %ebp
+    100f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1010:	c7 05 a0 e7 02 00 a4 	movl   $0x2e7a4,0x2e7a0
+    1017:	e7 02 00 
+    base.s.size = 0;
+    101a:	b8 a4 e7 02 00       	mov    $0x2e7a4,%eax
+    base.s.ptr = freep = prevp = &base;
+    101f:	c7 05 a4 e7 02 00 a4 	movl   $0x2e7a4,0x2e7a4
+    1026:	e7 02 00 
+    base.s.size = 0;
+    1029:	c7 05 a8 e7 02 00 00 	movl   $0x0,0x2e7a8
+    1030:	00 00 00 
+    if(p->s.size >= nunits){
+    1033:	e9 54 ff ff ff       	jmp    f8c <malloc+0x2c>
+    1038:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    103f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1040:	8b 08                	mov    (%eax),%ecx
+    1042:	89 0a                	mov    %ecx,(%edx)
+    1044:	eb b9                	jmp    fff <malloc+0x9f>
+    1046:	66 90                	xchg   %ax,%ax
+    1048:	66 90                	xchg   %ax,%ax
+    104a:	66 90                	xchg   %ax,%ax
+    104c:	66 90                	xchg   %ax,%ax
+    104e:	66 90                	xchg   %ax,%ax
+
+00001050 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+    1050:	55                   	push   %ebp
+    1051:	89 e5                	mov    %esp,%ebp
+    1053:	57                   	push   %edi
+    1054:	56                   	push   %esi
+    1055:	be 01 00 00 00       	mov    $0x1,%esi
+    105a:	53                   	push   %ebx
+    105b:	83 ec 28             	sub    $0x28,%esp
+    105e:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1061:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1064:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+    1067:	68 00 98 00 00       	push   $0x9800
+    106c:	e8 ef fe ff ff       	call   f60 <malloc>
+    1071:	83 c4 10             	add    $0x10,%esp
+    1074:	89 c7                	mov    %eax,%edi
+    1076:	85 c0                	test   %eax,%eax
+    1078:	74 62                	je     10dc <waitpoll+0x8c>
+    107a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+    1080:	83 ec 0c             	sub    $0xc,%esp
+    1083:	6a 01                	push   $0x1
+    1085:	e8 03 fa ff ff       	call   a8d <sleep>
+    fn();
+    108a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    108d:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+    108f:	58                   	pop    %eax
+    1090:	5a                   	pop    %edx
+    1091:	68 00 02 00 00       	push   $0x200
+    1096:	57                   	push   %edi
+    1097:	e8 eb fa ff ff       	call   b87 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+    109c:	83 c4 10             	add    $0x10,%esp
+    109f:	85 c0                	test   %eax,%eax
+    10a1:	7e 2d                	jle    10d0 <waitpoll+0x80>
+    10a3:	6b c0 4c             	imul   $0x4c,%eax,%eax
+    10a6:	89 fa                	mov    %edi,%edx
+    alive = 0;
+    10a8:	31 c9                	xor    %ecx,%ecx
+    10aa:	01 f8                	add    %edi,%eax
+    10ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+    10b0:	3b 1a                	cmp    (%edx),%ebx
+    10b2:	75 07                	jne    10bb <waitpoll+0x6b>
+        alive = 1;
+    10b4:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+    10b8:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+    10bb:	83 c2 4c             	add    $0x4c,%edx
+    10be:	39 d0                	cmp    %edx,%eax
+    10c0:	75 ee                	jne    10b0 <waitpoll+0x60>
+  } while(alive);
+    10c2:	85 c9                	test   %ecx,%ecx
+    10c4:	75 ba                	jne    1080 <waitpoll+0x30>
+    10c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10cd:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+    10d0:	83 ec 0c             	sub    $0xc,%esp
+    10d3:	57                   	push   %edi
+    10d4:	e8 f7 fd ff ff       	call   ed0 <free>
+  wait();
+    10d9:	83 c4 10             	add    $0x10,%esp
+}
+    10dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10df:	5b                   	pop    %ebx
+    10e0:	5e                   	pop    %esi
+    10e1:	5f                   	pop    %edi
+    10e2:	5d                   	pop    %ebp
+  wait();
+    10e3:	e9 10 f9 ff ff       	jmp    9f8 <wait>
+    10e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ef:	90                   	nop
+
+000010f0 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+    10f0:	55                   	push   %ebp
+    10f1:	89 e5                	mov    %esp,%ebp
+    10f3:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+    10f6:	c7 45 f0 55 12 00 00 	movl   $0x1255,-0x10(%ebp)
+    10fd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+    1104:	e8 87 f4 ff ff       	call   590 <fork>
+    1109:	85 c0                	test   %eax,%eax
+    110b:	78 09                	js     1116 <runps+0x26>
+    return -1;
+  if(pid == 0){
+    110d:	74 0e                	je     111d <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+    110f:	e8 e4 f8 ff ff       	call   9f8 <wait>
+}
+    1114:	c9                   	leave
+    1115:	c3                   	ret
+    1116:	c9                   	leave
+    return -1;
+    1117:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    111c:	c3                   	ret
+    exec("ps", argv);
+    111d:	50                   	push   %eax
+    111e:	50                   	push   %eax
+    111f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    1122:	50                   	push   %eax
+    1123:	68 55 12 00 00       	push   $0x1255
+    1128:	e8 c3 f4 ff ff       	call   5f0 <exec>
+    printf(2, "exec ps failed\n");
+    112d:	5a                   	pop    %edx
+    112e:	59                   	pop    %ecx
+    112f:	68 58 12 00 00       	push   $0x1258
+    1134:	6a 02                	push   $0x2
+    1136:	e8 55 fb ff ff       	call   c90 <printf>
+    exit();
+    113b:	e8 a0 f4 ff ff       	call   5e0 <exit>
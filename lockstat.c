@@ -0,0 +1,99 @@
+// Print the most contended spinlocks, adding together locks
+// of the same name (every buffer, every inode, ...). For the
+// spinlock inside a sleeplock, also show how many waits for the
+// sleeplock spun until it was free and how many slept.
+//
+// usage: lockstat           print counters since the last reset
+//        lockstat -r        reset the counters
+//        lockstat cmd ...   reset, run cmd, then print
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "x86.h"
+#include "lockstat.h"
+
+#define NSHOW 15
+
+struct lockstat ls[MAXLOCKSTAT];
+
+struct {
+  char *name;
+  int nlocks;
+  uint nacquire;
+  uint ncontend;
+  uint64 spin;
+  uint64 maxhold;
+  uint nspinwait;
+  uint nsleep;
+} agg[MAXLOCKSTAT];
+int nagg;
+
+void
+report(void)
+{
+  int n, i, j, best;
+
+  n = lockstat(ls, MAXLOCKSTAT, 0);
+  for(i = 0; i < n; i++){
+    for(j = 0; j < nagg; j++)
+      if(strcmp(agg[j].name, ls[i].name) == 0)
+        break;
+    if(j == nagg){
+      agg[nagg].name = ls[i].name;
+      nagg++;
+    }
+    agg[j].nlocks++;
+    agg[j].nacquire += ls[i].nacquire;
+    agg[j].ncontend += ls[i].ncontend;
+    agg[j].spin += ls[i].spin;
+    agg[j].nspinwait += ls[i].nspinwait;
+    agg[j].nsleep += ls[i].nsleep;
+    if(ls[i].maxhold > agg[j].maxhold)
+      agg[j].maxhold = ls[i].maxhold;
+  }
+
+  printf(1, "name\t\tlocks\tacquires\tcontended\tspin kcycles\tmax hold kcycles\tspun\tslept\n");
+  for(i = 0; i < NSHOW; i++){
+    best = -1;
+    for(j = 0; j < nagg; j++)
+      if(agg[j].nacquire && (best < 0 || agg[j].spin > agg[best].spin ||
+         (agg[j].spin == agg[best].spin && agg[j].nacquire > agg[best].nacquire)))
+        best = j;
+    if(best < 0)
+      break;
+    printf(1, "%s\t%s%d\t%d\t\t%d\t\t%d\t\t%d\t\t%d\t%d\n", agg[best].name,
+           strlen(agg[best].name) < 8 ? "\t" : "", agg[best].nlocks,
+           agg[best].nacquire, agg[best].ncontend,
+           (uint)div64(agg[best].spin, 1000),
+           (uint)div64(agg[best].maxhold, 1000),
+           agg[best].nspinwait, agg[best].nsleep);
+    agg[best].nacquire = 0;
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  int pid;
+
+  if(argc > 1 && strcmp(argv[1], "-r") == 0){
+    lockstat(ls, 0, 1);
+    exit();
+  }
+  if(argc > 1){
+    lockstat(ls, 0, 1);
+    if((pid = fork()) < 0){
+      printf(2, "lockstat: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      exec(argv[1], argv + 1);
+      printf(2, "lockstat: exec %s failed\n", argv[1]);
+      exit();
+    }
+    wait();
+  }
+  report();
+  exit();
+}
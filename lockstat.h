@@ -0,0 +1,13 @@
+// Counters of one spinlock, returned by the lockstat system call.
+
+#define MAXLOCKSTAT 2048  // most locks one call reports
+
+struct lockstat {
+  char name[16];
+  uint nacquire;     // times acquired
+  uint ncontend;     // times acquire() had to spin
+  uint64 spin;       // TSC cycles spent spinning
+  uint64 maxhold;    // longest hold, in TSC cycles
+  uint nspinwait;    // for a sleeplock: waits that spun
+  uint nsleep;       // and that slept
+};
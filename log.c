@@ -5,12 +5,13 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "logstat.h"
 
 // Simple logging that allows concurrent FS system calls.
 //
 // A log transaction contains the updates of multiple FS system
-// calls. The logging system only commits when there are
-// no FS system calls active. Thus there is never
+// calls. A transaction is sealed for commit only when no FS
+// system calls in it are active. Thus there is never
 // any reasoning required about whether a commit might
 // write an uncommitted system call's updates to disk.
 //
@@ -18,7 +19,26 @@
 // its start and end. Usually begin_op() just increments
 // the count of in-progress FS system calls and returns.
 // But if it thinks the log is close to running out, it
-// sleeps until the last outstanding end_op() commits.
+// sleeps until the current transaction is sealed.
+//
+// Group commit: there are two in-memory headers. New system
+// calls join the open one, lh[cur]. When the last of them ends,
+// end_op() seals it by flipping cur, so later system calls
+// accumulate in the other header while the sealed one is
+// written out. The committing process copies the sealed blocks
+// into log-private bufs and unlocks the cached ones at once, so a
+// newer transaction may modify them while the copies are logged
+// and installed; the cached bufs stay B_DIRTY until then, so they
+// are neither evicted nor written in place. It then commits the
+// next transaction too if that has closed in the meantime.
+//
+// Built with LOG_METADATA_ONLY, file data blocks are written
+// in place by log_writedata() instead of going through the log,
+// unless they are already part of the open transaction. A crash
+// may then leave stale data in a file, but the file system
+// structure is still recovered intact: a block freed by a
+// transaction that has not committed yet is not reused for file
+// data, since the crash could bring its old owner back.
 //
 // The log is a physical re-do log containing disk blocks.
 // The on-disk log format:
@@ -29,6 +49,10 @@
 //   ...
 // Log appends are synchronous.
 
+// Blocks handed to the disk driver at once by write_log() and
+// install_trans(), so that adjacent ones share one disk command.
+#define LOGBATCH 8
+
 // Contents of the header block, used for both the on-disk header block
 // and to keep track in memory of logged block# before commit.
 struct logheader {
@@ -40,10 +64,21 @@ struct log {
   struct spinlock lock;
   int start;
   int size;
+  int cap;         // max blocks per transaction
   int outstanding; // how many FS sys calls are executing.
-  int committing;  // in commit(), please wait.
+  int committing;  // a process is in commit().
+  int sealing;     // commit() is copying the sealed bufs, please wait.
   int dev;
-  struct logheader lh;
+  int cur;         // header that new FS sys calls join
+  int seq;         // serial number of the open transaction
+  int done;        // serial number of the last one committed
+  struct logheader lh[2];
+  struct buf snap[LOGSIZE];  // copies of the sealed blocks
+  struct buf *snapp[LOGSIZE];
+  struct logstat stat;
+#ifdef LOG_METADATA_ONLY
+  uchar freed[2][FSSIZE/8+1]; // blocks freed by lh[0], lh[1]
+#endif
 };
 struct log log;
 
@@ -53,6 +88,8 @@ static void commit();
 void
 initlog(int dev)
 {
+  int i;
+
   if (sizeof(struct logheader) >= BSIZE)
     panic("initlog: too big logheader");
 
@@ -61,64 +98,80 @@ initlog(int dev)
   readsb(dev, &sb);
   log.start = sb.logstart;
   log.size = sb.nlog;
+  log.cap = log.size - 1 < LOGSIZE ? log.size - 1 : LOGSIZE;
+  if (log.cap < MAXOPBLOCKS)
+    panic("initlog: log too small");
   log.dev = dev;
+  log.seq = 1;
+  for (i = 0; i < LOGSIZE; i++)
+    initsleeplock(&log.snap[i].lock, "logsnap");
   recover_from_log();
 }
 
 // Copy committed blocks from log to their home location
 static void
-install_trans(void)
+install_trans(struct logheader *lh)
 {
-  int tail;
+  struct buf *dbuf[LOGBATCH];
+  int tail, i, n;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
-    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
-    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
-    bwrite(dbuf);  // write dst to disk
-    brelse(lbuf);
-    brelse(dbuf);
+  for (tail = 0; tail < lh->n; tail += n) {
+    n = lh->n - tail;
+    if (n > LOGBATCH)
+      n = LOGBATCH;
+    for (i = 0; i < n; i++) {
+      struct buf *lbuf = bread(log.dev, log.start+tail+i+1); // read log block
+      dbuf[i] = bread(log.dev, lh->block[tail+i]); // read dst
+      memmove(dbuf[i]->data, lbuf->data, BSIZE);  // copy block to dst
+      brelse(lbuf);
+    }
+    bwritev(dbuf, n);  // write dsts to disk
+    for (i = 0; i < n; i++)
+      brelse(dbuf[i]);
   }
 }
 
-// Read the log header from disk into the in-memory log header
+// Read the log header from disk into an in-memory log header
 static void
-read_head(void)
+read_head(struct logheader *lh)
 {
   struct buf *buf = bread(log.dev, log.start);
-  struct logheader *lh = (struct logheader *) (buf->data);
+  struct logheader *hb = (struct logheader *) (buf->data);
   int i;
-  log.lh.n = lh->n;
-  for (i = 0; i < log.lh.n; i++) {
-    log.lh.block[i] = lh->block[i];
+  lh->n = hb->n;
+  for (i = 0; i < lh->n; i++) {
+    lh->block[i] = hb->block[i];
   }
   brelse(buf);
 }
 
-// Write in-memory log header to disk.
+// Write an in-memory log header to disk.
 // This is the true point at which the
-// current transaction commits.
+// transaction commits.
 static void
-write_head(void)
+write_head(struct logheader *lh)
 {
   struct buf *buf = bread(log.dev, log.start);
   struct logheader *hb = (struct logheader *) (buf->data);
   int i;
-  hb->n = log.lh.n;
-  for (i = 0; i < log.lh.n; i++) {
-    hb->block[i] = log.lh.block[i];
+  hb->n = lh->n;
+  for (i = 0; i < lh->n; i++) {
+    hb->block[i] = lh->block[i];
   }
   bwrite(buf);
   brelse(buf);
+  log.stat.heads++;
 }
 
 static void
 recover_from_log(void)
 {
-  read_head();
-  install_trans(); // if committed, copy from log to disk
-  log.lh.n = 0;
-  write_head(); // clear the log
+  struct logheader *lh = &log.lh[0];
+
+  read_head(lh);
+  install_trans(lh); // if committed, copy from log to disk
+  lh->n = 0;
+  write_head(lh); // clear the log
 }
 
 // called at the start of each FS system call.
@@ -127,9 +180,9 @@ begin_op(void)
 {
   acquire(&log.lock);
   while(1){
-    if(log.committing){
+    if(log.sealing){
       sleep(&log, &log.lock);
-    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+    } else if(log.lh[log.cur].n + (log.outstanding+1)*MAXOPBLOCKS > log.cap){
       // this op might exhaust log space; wait for commit.
       sleep(&log, &log.lock);
     } else {
@@ -141,7 +194,8 @@ begin_op(void)
 }
 
 // called at the end of each FS system call.
-// commits if this was the last outstanding operation.
+// commits if this was the last outstanding operation
+// and no other process is already committing.
 void
 end_op(void)
 {
@@ -149,9 +203,7 @@ end_op(void)
 
   acquire(&log.lock);
   log.outstanding -= 1;
-  if(log.committing)
-    panic("log.committing");
-  if(log.outstanding == 0){
+  if(log.outstanding == 0 && !log.committing){
     do_commit = 1;
     log.committing = 1;
   } else {
@@ -166,39 +218,126 @@ end_op(void)
     // call commit w/o holding locks, since not allowed
     // to sleep with locks.
     commit();
-    acquire(&log.lock);
-    log.committing = 0;
-    wakeup(&log);
-    release(&log.lock);
   }
 }
 
-// Copy modified blocks from cache to log.
+// Wait until the FS system calls that have ended so far
+// are committed, for fsync().
+void
+log_sync(void)
+{
+  int seq;
+
+  acquire(&log.lock);
+  seq = log.lh[log.cur].n > 0 ? log.seq : log.seq - 1;
+  while(log.done < seq)
+    sleep(&log, &log.lock);
+  release(&log.lock);
+}
+
+// Copy the sealed blocks into log.snap[] and let go of the
+// cached bufs, which keep B_DIRTY until install_snap().
+static void
+snapshot(struct logheader *lh)
+{
+  struct buf *b, *s;
+  int i;
+
+  for (i = 0; i < lh->n; i++) {
+    b = bread(log.dev, lh->block[i]);
+    s = &log.snap[i];
+    acquiresleep(&s->lock);
+    s->dev = log.dev;
+    s->blockno = s->ioblock = lh->block[i];
+    memmove(s->data, b->data, BSIZE);
+    log.snapp[i] = s;
+    brelse(b);
+  }
+}
+
+// Write the snapshots to the log,
+// all in one batch of adjacent blocks.
+static void
+write_log(struct logheader *lh)
+{
+  uint to[LOGSIZE];
+  int i;
+
+  for (i = 0; i < lh->n; i++)
+    to[i] = log.start+i+1;
+  bwritevat(log.snapp, to, lh->n);
+  log.stat.logged += lh->n;
+}
+
+// Write the snapshots to their home locations, then unpin
+// the cached bufs that no newer transaction has modified.
 static void
-write_log(void)
+install_snap(struct logheader *lh)
 {
-  int tail;
+  struct buf *b;
+  int i, j;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
-    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
-    memmove(to->data, from->data, BSIZE);
-    bwrite(to);  // write the log
-    brelse(from);
-    brelse(to);
+  bwritev(log.snapp, lh->n);
+  log.stat.installed += lh->n;
+  for (i = 0; i < lh->n; i++) {
+    releasesleep(&log.snap[i].lock);
+    b = bread(log.dev, lh->block[i]);
+    acquire(&log.lock);
+    for (j = 0; j < log.lh[log.cur].n; j++)
+      if (log.lh[log.cur].block[j] == b->blockno)
+        break;
+    if (j == log.lh[log.cur].n)
+      b->flags &= ~B_DIRTY;
+    release(&log.lock);
+    brelse(b);
   }
 }
 
+// Commit sealed transactions until the open one is empty
+// or still has FS system calls in progress. Clears
+// log.committing under the same hold of log.lock that saw
+// that, so an end_op() in between can not leave the open
+// transaction with nobody to commit it.
 static void
 commit()
 {
-  if (log.lh.n > 0) {
-    write_log();     // Write modified blocks from cache to log
-    write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
-    log.lh.n = 0;
-    write_head();    // Erase the transaction from the log
+  struct logheader *lh;
+  int seq;
+
+  acquire(&log.lock);
+  while (log.outstanding == 0 && log.lh[log.cur].n > 0) {
+    // Seal: later FS sys calls join the other header, but not
+    // before the sealed blocks are copied.
+    lh = &log.lh[log.cur];
+    log.cur ^= 1;
+    seq = log.seq++;
+    log.sealing = 1;
+    release(&log.lock);
+
+    snapshot(lh);
+
+    acquire(&log.lock);
+    log.sealing = 0;
+    wakeup(&log);
+    release(&log.lock);
+
+    write_log(lh);   // Write the copies to the log
+    write_head(lh);  // Write header to disk -- the real commit
+    install_snap(lh); // Now install writes to home locations
+    lh->n = 0;
+    write_head(lh);  // Erase the transaction from the log
+
+    acquire(&log.lock);
+    log.stat.commits++;
+    log.done = seq;
+#ifdef LOG_METADATA_ONLY
+    memset(log.freed[lh - log.lh], 0, sizeof(log.freed[0]));
+#endif
+    wakeup(&log);
   }
+  log.committing = 0;
+  wakeup(&log);
+  release(&log.lock);
 }
 
 // Caller has modified b->data and is done with the buffer.
@@ -213,22 +352,74 @@ commit()
 void
 log_write(struct buf *b)
 {
+  struct logheader *lh;
   int i;
 
-  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
-    panic("too big a transaction");
   if (log.outstanding < 1)
     panic("log_write outside of trans");
 
   acquire(&log.lock);
-  for (i = 0; i < log.lh.n; i++) {
-    if (log.lh.block[i] == b->blockno)   // log absorbtion
+  lh = &log.lh[log.cur];
+  if (lh->n >= log.cap)
+    panic("too big a transaction");
+  for (i = 0; i < lh->n; i++) {
+    if (lh->block[i] == b->blockno)   // log absorbtion
       break;
   }
-  log.lh.block[i] = b->blockno;
-  if (i == log.lh.n)
-    log.lh.n++;
+  lh->block[i] = b->blockno;
+  if (i == lh->n)
+    lh->n++;
   b->flags |= B_DIRTY; // prevent eviction
   release(&log.lock);
 }
 
+// Like log_write(), for a block of file data.
+// In metadata-only mode the block goes straight to disk,
+// unless the open transaction already holds it.
+void
+log_writedata(struct buf *b)
+{
+#ifdef LOG_METADATA_ONLY
+  if ((b->flags & B_DIRTY) == 0) {
+    bwrite(b);
+    acquire(&log.lock);
+    log.stat.direct++;
+    release(&log.lock);
+    return;
+  }
+#endif
+  log_write(b);
+}
+
+#ifdef LOG_METADATA_ONLY
+// Record that the current transaction frees block b.
+void
+log_freed(uint b)
+{
+  acquire(&log.lock);
+  log.freed[log.cur][b/8] |= 1 << (b%8);
+  release(&log.lock);
+}
+
+// Was block b freed by a transaction that has not committed?
+// Such a block must not be written outside the log yet.
+int
+log_isfreed(uint b)
+{
+  int r;
+
+  acquire(&log.lock);
+  r = ((log.freed[0][b/8] | log.freed[1][b/8]) >> (b%8)) & 1;
+  release(&log.lock);
+  return r;
+}
+#endif
+
+// Copy the log traffic counters to *st.
+void
+log_stat(struct logstat *st)
+{
+  acquire(&log.lock);
+  *st = log.stat;
+  release(&log.lock);
+}
@@ -0,0 +1,2284 @@
+
+_logbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+         direct, logged + installed + heads + direct, t);
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	bf 20 00 00 00       	mov    $0x20,%edi
+      13:	56                   	push   %esi
+      14:	53                   	push   %ebx
+      15:	51                   	push   %ecx
+      16:	83 ec 48             	sub    $0x48,%esp
+  struct logstat a, b;
+  int kb, t;
+
+  kb = argc > 1 ? atoi(argv[1]) : 32;
+      19:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+      1c:	8b 41 04             	mov    0x4(%ecx),%eax
+  kb = argc > 1 ? atoi(argv[1]) : 32;
+      1f:	7e 10                	jle    31 <main+0x31>
+      21:	83 ec 0c             	sub    $0xc,%esp
+      24:	ff 70 04             	push   0x4(%eax)
+      27:	e8 a4 08 00 00       	call   8d0 <atoi>
+      2c:	83 c4 10             	add    $0x10,%esp
+      2f:	89 c7                	mov    %eax,%edi
+  memset(buf, 'l', sizeof(buf));
+      31:	83 ec 04             	sub    $0x4,%esp
+
+  logstat(&a);
+      34:	8d 75 c0             	lea    -0x40(%ebp),%esi
+  memset(buf, 'l', sizeof(buf));
+      37:	68 00 02 00 00       	push   $0x200
+      3c:	6a 6c                	push   $0x6c
+      3e:	68 60 17 00 00       	push   $0x1760
+      43:	e8 c8 06 00 00       	call   710 <memset>
+  logstat(&a);
+      48:	89 34 24             	mov    %esi,(%esp)
+      4b:	e8 63 0a 00 00       	call   ab3 <logstat>
+  t = uptime();
+      50:	e8 d2 09 00 00       	call   a27 <uptime>
+  append(kb);
+      55:	89 3c 24             	mov    %edi,(%esp)
+  t = uptime();
+      58:	89 c3                	mov    %eax,%ebx
+  append(kb);
+      5a:	e8 e1 00 00 00       	call   140 <append>
+  t = uptime() - t;
+      5f:	e8 c3 09 00 00       	call   a27 <uptime>
+      64:	29 d8                	sub    %ebx,%eax
+  logstat(&b);
+      66:	8d 5d d4             	lea    -0x2c(%ebp),%ebx
+  t = uptime() - t;
+      69:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  logstat(&b);
+      6c:	89 1c 24             	mov    %ebx,(%esp)
+      6f:	e8 3f 0a 00 00       	call   ab3 <logstat>
+  report("append", &a, &b, t);
+      74:	ff 75 b4             	push   -0x4c(%ebp)
+      77:	53                   	push   %ebx
+      78:	56                   	push   %esi
+      79:	68 1e 11 00 00       	push   $0x111e
+      7e:	e8 fd 01 00 00       	call   280 <report>
+
+  a = b;
+      83:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  t = uptime();
+      86:	83 c4 20             	add    $0x20,%esp
+  a = b;
+      89:	89 45 c0             	mov    %eax,-0x40(%ebp)
+      8c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+      8f:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+      92:	8b 45 dc             	mov    -0x24(%ebp),%eax
+      95:	89 45 c8             	mov    %eax,-0x38(%ebp)
+      98:	8b 45 e0             	mov    -0x20(%ebp),%eax
+      9b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      9e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      a1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  t = uptime();
+      a4:	e8 7e 09 00 00       	call   a27 <uptime>
+  overwrite(kb);
+      a9:	83 ec 0c             	sub    $0xc,%esp
+  t = uptime();
+      ac:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  overwrite(kb);
+      af:	57                   	push   %edi
+      b0:	e8 0b 01 00 00       	call   1c0 <overwrite>
+  t = uptime() - t;
+      b5:	e8 6d 09 00 00       	call   a27 <uptime>
+      ba:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+  logstat(&b);
+      bd:	89 1c 24             	mov    %ebx,(%esp)
+  t = uptime() - t;
+      c0:	29 d0                	sub    %edx,%eax
+      c2:	89 c7                	mov    %eax,%edi
+  logstat(&b);
+      c4:	e8 ea 09 00 00       	call   ab3 <logstat>
+  report("overwrite", &a, &b, t);
+      c9:	57                   	push   %edi
+      ca:	53                   	push   %ebx
+      cb:	56                   	push   %esi
+      cc:	68 25 11 00 00       	push   $0x1125
+      d1:	e8 aa 01 00 00       	call   280 <report>
+
+  a = b;
+      d6:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  t = uptime();
+      d9:	83 c4 20             	add    $0x20,%esp
+  a = b;
+      dc:	89 45 c0             	mov    %eax,-0x40(%ebp)
+      df:	8b 45 d8             	mov    -0x28(%ebp),%eax
+      e2:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+      e5:	8b 45 dc             	mov    -0x24(%ebp),%eax
+      e8:	89 45 c8             	mov    %eax,-0x38(%ebp)
+      eb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+      ee:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      f1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      f4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  t = uptime();
+      f7:	e8 2b 09 00 00       	call   a27 <uptime>
+  mkdirs(20);
+      fc:	83 ec 0c             	sub    $0xc,%esp
+      ff:	6a 14                	push   $0x14
+  t = uptime();
+     101:	89 c7                	mov    %eax,%edi
+  mkdirs(20);
+     103:	e8 38 01 00 00       	call   240 <mkdirs>
+  t = uptime() - t;
+     108:	e8 1a 09 00 00       	call   a27 <uptime>
+  logstat(&b);
+     10d:	89 1c 24             	mov    %ebx,(%esp)
+  t = uptime() - t;
+     110:	29 f8                	sub    %edi,%eax
+     112:	89 c7                	mov    %eax,%edi
+  logstat(&b);
+     114:	e8 9a 09 00 00       	call   ab3 <logstat>
+  report("mkdir/unlink", &a, &b, t);
+     119:	57                   	push   %edi
+     11a:	53                   	push   %ebx
+     11b:	56                   	push   %esi
+     11c:	68 2f 11 00 00       	push   $0x112f
+     121:	e8 5a 01 00 00       	call   280 <report>
+
+  unlink(FILENAME);
+     126:	83 c4 14             	add    $0x14,%esp
+     129:	68 d0 10 00 00       	push   $0x10d0
+     12e:	e8 9a 08 00 00       	call   9cd <unlink>
+  exit();
+     133:	e8 38 04 00 00       	call   570 <exit>
+     138:	66 90                	xchg   %ax,%ax
+     13a:	66 90                	xchg   %ax,%ax
+     13c:	66 90                	xchg   %ax,%ax
+     13e:	66 90                	xchg   %ax,%ax
+
+00000140 <append>:
+{
+     140:	55                   	push   %ebp
+     141:	89 e5                	mov    %esp,%ebp
+     143:	57                   	push   %edi
+     144:	56                   	push   %esi
+     145:	53                   	push   %ebx
+     146:	83 ec 24             	sub    $0x24,%esp
+     149:	8b 55 08             	mov    0x8(%ebp),%edx
+     14c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  if((fd = open(FILENAME, O_CREATE|O_RDWR)) < 0){
+     14f:	68 02 02 00 00       	push   $0x202
+     154:	68 d0 10 00 00       	push   $0x10d0
+     159:	e8 5b 08 00 00       	call   9b9 <open>
+     15e:	83 c4 10             	add    $0x10,%esp
+     161:	85 c0                	test   %eax,%eax
+     163:	78 3f                	js     1a4 <append+0x64>
+  for(i = 0; i < 2*kb; i++)
+     165:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     168:	89 c6                	mov    %eax,%esi
+     16a:	31 db                	xor    %ebx,%ebx
+     16c:	8d 3c 12             	lea    (%edx,%edx,1),%edi
+     16f:	85 d2                	test   %edx,%edx
+     171:	7e 22                	jle    195 <append+0x55>
+     173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     177:	90                   	nop
+    write(fd, buf, sizeof(buf));
+     178:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < 2*kb; i++)
+     17b:	83 c3 01             	add    $0x1,%ebx
+    write(fd, buf, sizeof(buf));
+     17e:	68 00 02 00 00       	push   $0x200
+     183:	68 60 17 00 00       	push   $0x1760
+     188:	56                   	push   %esi
+     189:	e8 0f 08 00 00       	call   99d <write>
+  for(i = 0; i < 2*kb; i++)
+     18e:	83 c4 10             	add    $0x10,%esp
+     191:	39 fb                	cmp    %edi,%ebx
+     193:	7c e3                	jl     178 <append+0x38>
+  close(fd);
+     195:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+     198:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     19b:	5b                   	pop    %ebx
+     19c:	5e                   	pop    %esi
+     19d:	5f                   	pop    %edi
+     19e:	5d                   	pop    %ebp
+  close(fd);
+     19f:	e9 3c 04 00 00       	jmp    5e0 <close>
+    printf(2, "logbench: cannot create %s\n", FILENAME);
+     1a4:	50                   	push   %eax
+     1a5:	68 d0 10 00 00       	push   $0x10d0
+     1aa:	68 dd 10 00 00       	push   $0x10dd
+     1af:	6a 02                	push   $0x2
+     1b1:	e8 6a 0a 00 00       	call   c20 <printf>
+    exit();
+     1b6:	e8 b5 03 00 00       	call   570 <exit>
+     1bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1bf:	90                   	nop
+
+000001c0 <overwrite>:
+{
+     1c0:	55                   	push   %ebp
+     1c1:	89 e5                	mov    %esp,%ebp
+     1c3:	57                   	push   %edi
+     1c4:	56                   	push   %esi
+     1c5:	53                   	push   %ebx
+     1c6:	83 ec 24             	sub    $0x24,%esp
+     1c9:	8b 55 08             	mov    0x8(%ebp),%edx
+     1cc:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  if((fd = open(FILENAME, O_RDWR)) < 0){
+     1cf:	6a 02                	push   $0x2
+     1d1:	68 d0 10 00 00       	push   $0x10d0
+     1d6:	e8 de 07 00 00       	call   9b9 <open>
+     1db:	83 c4 10             	add    $0x10,%esp
+     1de:	85 c0                	test   %eax,%eax
+     1e0:	78 3a                	js     21c <overwrite+0x5c>
+  for(i = 0; i < 2*kb; i++)
+     1e2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     1e5:	89 c6                	mov    %eax,%esi
+     1e7:	31 db                	xor    %ebx,%ebx
+     1e9:	8d 3c 12             	lea    (%edx,%edx,1),%edi
+     1ec:	85 d2                	test   %edx,%edx
+     1ee:	7e 1d                	jle    20d <overwrite+0x4d>
+    write(fd, buf, sizeof(buf));
+     1f0:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < 2*kb; i++)
+     1f3:	83 c3 01             	add    $0x1,%ebx
+    write(fd, buf, sizeof(buf));
+     1f6:	68 00 02 00 00       	push   $0x200
+     1fb:	68 60 17 00 00       	push   $0x1760
+     200:	56                   	push   %esi
+     201:	e8 97 07 00 00       	call   99d <write>
+  for(i = 0; i < 2*kb; i++)
+     206:	83 c4 10             	add    $0x10,%esp
+     209:	39 fb                	cmp    %edi,%ebx
+     20b:	7c e3                	jl     1f0 <overwrite+0x30>
+  close(fd);
+     20d:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+     210:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     213:	5b                   	pop    %ebx
+     214:	5e                   	pop    %esi
+     215:	5f                   	pop    %edi
+     216:	5d                   	pop    %ebp
+  close(fd);
+     217:	e9 c4 03 00 00       	jmp    5e0 <close>
+    printf(2, "logbench: cannot open %s\n", FILENAME);
+     21c:	50                   	push   %eax
+     21d:	68 d0 10 00 00       	push   $0x10d0
+     222:	68 f9 10 00 00       	push   $0x10f9
+     227:	6a 02                	push   $0x2
+     229:	e8 f2 09 00 00       	call   c20 <printf>
+    exit();
+     22e:	e8 3d 03 00 00       	call   570 <exit>
+     233:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     23a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000240 <mkdirs>:
+{
+     240:	55                   	push   %ebp
+     241:	89 e5                	mov    %esp,%ebp
+     243:	56                   	push   %esi
+     244:	53                   	push   %ebx
+     245:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(i = 0; i < n; i++){
+     248:	85 f6                	test   %esi,%esi
+     24a:	7e 27                	jle    273 <mkdirs+0x33>
+     24c:	31 db                	xor    %ebx,%ebx
+     24e:	66 90                	xchg   %ax,%ax
+    mkdir("logbench.d");
+     250:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < n; i++){
+     253:	83 c3 01             	add    $0x1,%ebx
+    mkdir("logbench.d");
+     256:	68 13 11 00 00       	push   $0x1113
+     25b:	e8 8b 07 00 00       	call   9eb <mkdir>
+    unlink("logbench.d");
+     260:	c7 04 24 13 11 00 00 	movl   $0x1113,(%esp)
+     267:	e8 61 07 00 00       	call   9cd <unlink>
+  for(i = 0; i < n; i++){
+     26c:	83 c4 10             	add    $0x10,%esp
+     26f:	39 de                	cmp    %ebx,%esi
+     271:	75 dd                	jne    250 <mkdirs+0x10>
+}
+     273:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     276:	5b                   	pop    %ebx
+     277:	5e                   	pop    %esi
+     278:	5d                   	pop    %ebp
+     279:	c3                   	ret
+     27a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000280 <report>:
+{
+     280:	55                   	push   %ebp
+     281:	89 e5                	mov    %esp,%ebp
+     283:	57                   	push   %edi
+     284:	56                   	push   %esi
+     285:	53                   	push   %ebx
+     286:	83 ec 24             	sub    $0x24,%esp
+     289:	8b 45 0c             	mov    0xc(%ebp),%eax
+     28c:	8b 55 10             	mov    0x10(%ebp),%edx
+  logged = b->logged - a->logged;
+     28f:	8b 4a 04             	mov    0x4(%edx),%ecx
+  installed = b->installed - a->installed;
+     292:	8b 5a 08             	mov    0x8(%edx),%ebx
+  logged = b->logged - a->logged;
+     295:	2b 48 04             	sub    0x4(%eax),%ecx
+  installed = b->installed - a->installed;
+     298:	2b 58 08             	sub    0x8(%eax),%ebx
+  heads = b->heads - a->heads;
+     29b:	8b 72 0c             	mov    0xc(%edx),%esi
+  direct = b->direct - a->direct;
+     29e:	8b 7a 10             	mov    0x10(%edx),%edi
+  heads = b->heads - a->heads;
+     2a1:	2b 70 0c             	sub    0xc(%eax),%esi
+  direct = b->direct - a->direct;
+     2a4:	2b 78 10             	sub    0x10(%eax),%edi
+  printf(1, "%s: %d commits, %d logged, %d installed, %d headers, "
+     2a7:	ff 75 14             	push   0x14(%ebp)
+         direct, logged + installed + heads + direct, t);
+     2aa:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+     2ad:	01 d9                	add    %ebx,%ecx
+     2af:	01 f1                	add    %esi,%ecx
+  printf(1, "%s: %d commits, %d logged, %d installed, %d headers, "
+     2b1:	01 f9                	add    %edi,%ecx
+     2b3:	51                   	push   %ecx
+     2b4:	57                   	push   %edi
+     2b5:	56                   	push   %esi
+     2b6:	53                   	push   %ebx
+     2b7:	ff 75 e4             	push   -0x1c(%ebp)
+     2ba:	8b 12                	mov    (%edx),%edx
+     2bc:	2b 10                	sub    (%eax),%edx
+     2be:	52                   	push   %edx
+     2bf:	ff 75 08             	push   0x8(%ebp)
+     2c2:	68 3c 11 00 00       	push   $0x113c
+     2c7:	6a 01                	push   $0x1
+     2c9:	e8 52 09 00 00       	call   c20 <printf>
+}
+     2ce:	83 c4 30             	add    $0x30,%esp
+     2d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     2d4:	5b                   	pop    %ebx
+     2d5:	5e                   	pop    %esi
+     2d6:	5f                   	pop    %edi
+     2d7:	5d                   	pop    %ebp
+     2d8:	c3                   	ret
+     2d9:	66 90                	xchg   %ax,%ax
+     2db:	66 90                	xchg   %ax,%ax
+     2dd:	66 90                	xchg   %ax,%ax
+     2df:	90                   	nop
+
+000002e0 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+     2e0:	55                   	push   %ebp
+     2e1:	89 e5                	mov    %esp,%ebp
+     2e3:	57                   	push   %edi
+     2e4:	56                   	push   %esi
+     2e5:	53                   	push   %ebx
+     2e6:	83 ec 4c             	sub    $0x4c,%esp
+     2e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2ec:	8b 55 08             	mov    0x8(%ebp),%edx
+     2ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     2f2:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+     2f5:	83 fa 0f             	cmp    $0xf,%edx
+     2f8:	0f 87 32 01 00 00    	ja     430 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+     2fe:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     304:	8b 80 60 19 00 00    	mov    0x1960(%eax),%eax
+     30a:	85 c0                	test   %eax,%eax
+     30c:	0f 84 de 00 00 00    	je     3f0 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+     312:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     318:	8b b0 64 19 00 00    	mov    0x1964(%eax),%esi
+     31e:	8d 88 60 19 00 00    	lea    0x1960(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+     324:	8d b8 68 19 00 00    	lea    0x1968(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+     32a:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+     32d:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+     330:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+     333:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+     339:	0f 8f 01 01 00 00    	jg     440 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+     33f:	8d 78 08             	lea    0x8(%eax),%edi
+     342:	8d bc 3e 60 19 00 00 	lea    0x1960(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     349:	85 db                	test   %ebx,%ebx
+     34b:	7e 3b                	jle    388 <bufwrite+0xa8>
+     34d:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+     350:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+     353:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     357:	90                   	nop
+    *dst++ = *src++;
+     358:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     359:	39 c6                	cmp    %eax,%esi
+     35b:	75 fb                	jne    358 <bufwrite+0x78>
+  ob[fd].n += n;
+     35d:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     363:	8b 88 64 19 00 00    	mov    0x1964(%eax),%ecx
+     369:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     36b:	83 b8 60 19 00 00 01 	cmpl   $0x1,0x1960(%eax)
+  ob[fd].n += n;
+     372:	89 88 64 19 00 00    	mov    %ecx,0x1964(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     378:	74 26                	je     3a0 <bufwrite+0xc0>
+}
+     37a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     37d:	5b                   	pop    %ebx
+     37e:	5e                   	pop    %esi
+     37f:	5f                   	pop    %edi
+     380:	5d                   	pop    %ebp
+     381:	c3                   	ret
+     382:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+     388:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     38b:	83 b8 60 19 00 00 01 	cmpl   $0x1,0x1960(%eax)
+  ob[fd].n += n;
+     392:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     395:	75 e3                	jne    37a <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+     397:	85 db                	test   %ebx,%ebx
+     399:	74 df                	je     37a <bufwrite+0x9a>
+     39b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     39f:	90                   	nop
+  src = vsrc;
+     3a0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     3a3:	01 c3                	add    %eax,%ebx
+     3a5:	eb 10                	jmp    3b7 <bufwrite+0xd7>
+     3a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ae:	66 90                	xchg   %ax,%ax
+     3b0:	83 c0 01             	add    $0x1,%eax
+     3b3:	39 d8                	cmp    %ebx,%eax
+     3b5:	74 c3                	je     37a <bufwrite+0x9a>
+    if(*p == (char)c)
+     3b7:	80 38 0a             	cmpb   $0xa,(%eax)
+     3ba:	75 f4                	jne    3b0 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     3bc:	85 c9                	test   %ecx,%ecx
+     3be:	7e ba                	jle    37a <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+     3c0:	83 ec 04             	sub    $0x4,%esp
+     3c3:	51                   	push   %ecx
+     3c4:	ff 75 ac             	push   -0x54(%ebp)
+     3c7:	52                   	push   %edx
+     3c8:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+     3cb:	e8 cd 05 00 00       	call   99d <write>
+    ob[fd].n = 0;
+     3d0:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     3d3:	83 c4 10             	add    $0x10,%esp
+     3d6:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+     3dc:	c7 82 64 19 00 00 00 	movl   $0x0,0x1964(%edx)
+     3e3:	00 00 00 
+     3e6:	eb 92                	jmp    37a <bufwrite+0x9a>
+     3e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ef:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     3f0:	83 ec 08             	sub    $0x8,%esp
+     3f3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     3f6:	50                   	push   %eax
+     3f7:	52                   	push   %edx
+     3f8:	89 55 b0             	mov    %edx,-0x50(%ebp)
+     3fb:	e8 d7 05 00 00       	call   9d7 <fstat>
+     400:	83 c4 10             	add    $0x10,%esp
+     403:	8b 55 b0             	mov    -0x50(%ebp),%edx
+     406:	89 c1                	mov    %eax,%ecx
+     408:	b8 02 00 00 00       	mov    $0x2,%eax
+     40d:	85 c9                	test   %ecx,%ecx
+     40f:	75 0d                	jne    41e <bufwrite+0x13e>
+     411:	31 c0                	xor    %eax,%eax
+     413:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     418:	0f 95 c0             	setne  %al
+     41b:	83 c0 01             	add    $0x1,%eax
+     41e:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+     424:	89 81 60 19 00 00    	mov    %eax,0x1960(%ecx)
+     42a:	e9 e3 fe ff ff       	jmp    312 <bufwrite+0x32>
+     42f:	90                   	nop
+}
+     430:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     433:	5b                   	pop    %ebx
+     434:	5e                   	pop    %esi
+     435:	5f                   	pop    %edi
+     436:	5d                   	pop    %ebp
+    write(fd, p, n);
+     437:	e9 61 05 00 00       	jmp    99d <write>
+     43c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+     440:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+     443:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+     446:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+     449:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+     44c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+     44f:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+     452:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+     455:	6a 02                	push   $0x2
+     457:	50                   	push   %eax
+     458:	52                   	push   %edx
+     459:	e8 9b 06 00 00       	call   af9 <writev>
+    ob[fd].n = 0;
+     45e:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+     461:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+     464:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+     46b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     46e:	5b                   	pop    %ebx
+     46f:	5e                   	pop    %esi
+     470:	5f                   	pop    %edi
+     471:	5d                   	pop    %ebp
+     472:	c3                   	ret
+     473:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     47a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000480 <fflush>:
+{
+     480:	55                   	push   %ebp
+     481:	89 e5                	mov    %esp,%ebp
+     483:	53                   	push   %ebx
+     484:	83 ec 04             	sub    $0x4,%esp
+     487:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     48a:	83 f8 0f             	cmp    $0xf,%eax
+     48d:	77 16                	ja     4a5 <fflush+0x25>
+     48f:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+     495:	8b 8a 64 19 00 00    	mov    0x1964(%edx),%ecx
+     49b:	8d 9a 60 19 00 00    	lea    0x1960(%edx),%ebx
+     4a1:	85 c9                	test   %ecx,%ecx
+     4a3:	7f 0b                	jg     4b0 <fflush+0x30>
+}
+     4a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4a8:	c9                   	leave
+     4a9:	c3                   	ret
+     4aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     4b0:	83 ec 04             	sub    $0x4,%esp
+     4b3:	81 c2 68 19 00 00    	add    $0x1968,%edx
+     4b9:	51                   	push   %ecx
+     4ba:	52                   	push   %edx
+     4bb:	50                   	push   %eax
+     4bc:	e8 dc 04 00 00       	call   99d <write>
+    ob[fd].n = 0;
+     4c1:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     4c8:	83 c4 10             	add    $0x10,%esp
+}
+     4cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4ce:	c9                   	leave
+     4cf:	c3                   	ret
+
+000004d0 <fflushall>:
+{
+     4d0:	55                   	push   %ebp
+     4d1:	89 e5                	mov    %esp,%ebp
+     4d3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     4d4:	31 f6                	xor    %esi,%esi
+{
+     4d6:	53                   	push   %ebx
+     4d7:	bb 68 19 00 00       	mov    $0x1968,%ebx
+     4dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     4e0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     4e3:	85 c0                	test   %eax,%eax
+     4e5:	7e 15                	jle    4fc <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     4e7:	83 ec 04             	sub    $0x4,%esp
+     4ea:	50                   	push   %eax
+     4eb:	53                   	push   %ebx
+     4ec:	56                   	push   %esi
+     4ed:	e8 ab 04 00 00       	call   99d <write>
+    ob[fd].n = 0;
+     4f2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     4f9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     4fc:	83 c6 01             	add    $0x1,%esi
+     4ff:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     505:	83 fe 10             	cmp    $0x10,%esi
+     508:	75 d6                	jne    4e0 <fflushall+0x10>
+}
+     50a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     50d:	5b                   	pop    %ebx
+     50e:	5e                   	pop    %esi
+     50f:	5d                   	pop    %ebp
+     510:	c3                   	ret
+     511:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     518:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     51f:	90                   	nop
+
+00000520 <fork>:
+{
+     520:	55                   	push   %ebp
+     521:	89 e5                	mov    %esp,%ebp
+     523:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     524:	31 f6                	xor    %esi,%esi
+{
+     526:	53                   	push   %ebx
+     527:	bb 68 19 00 00       	mov    $0x1968,%ebx
+     52c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     530:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     533:	85 c0                	test   %eax,%eax
+     535:	7e 15                	jle    54c <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     537:	83 ec 04             	sub    $0x4,%esp
+     53a:	50                   	push   %eax
+     53b:	53                   	push   %ebx
+     53c:	56                   	push   %esi
+     53d:	e8 5b 04 00 00       	call   99d <write>
+    ob[fd].n = 0;
+     542:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     549:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     54c:	83 c6 01             	add    $0x1,%esi
+     54f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     555:	83 fe 10             	cmp    $0x10,%esi
+     558:	75 d6                	jne    530 <fork+0x10>
+}
+     55a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     55d:	5b                   	pop    %ebx
+     55e:	5e                   	pop    %esi
+     55f:	5d                   	pop    %ebp
+  return _fork();
+     560:	e9 15 04 00 00       	jmp    97a <_fork>
+     565:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     56c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000570 <exit>:
+{
+     570:	55                   	push   %ebp
+     571:	89 e5                	mov    %esp,%ebp
+     573:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+     576:	e8 55 ff ff ff       	call   4d0 <fflushall>
+  _exit();
+     57b:	e8 01 04 00 00       	call   981 <_exit>
+
+00000580 <exec>:
+{
+     580:	55                   	push   %ebp
+     581:	89 e5                	mov    %esp,%ebp
+     583:	57                   	push   %edi
+     584:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     585:	31 f6                	xor    %esi,%esi
+{
+     587:	53                   	push   %ebx
+     588:	bb 68 19 00 00       	mov    $0x1968,%ebx
+     58d:	83 ec 1c             	sub    $0x1c,%esp
+     590:	8b 45 08             	mov    0x8(%ebp),%eax
+     593:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     596:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     599:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     5a0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     5a3:	85 c0                	test   %eax,%eax
+     5a5:	7e 15                	jle    5bc <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     5a7:	83 ec 04             	sub    $0x4,%esp
+     5aa:	50                   	push   %eax
+     5ab:	53                   	push   %ebx
+     5ac:	56                   	push   %esi
+     5ad:	e8 eb 03 00 00       	call   99d <write>
+    ob[fd].n = 0;
+     5b2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     5b9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     5bc:	83 c6 01             	add    $0x1,%esi
+     5bf:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     5c5:	83 fe 10             	cmp    $0x10,%esi
+     5c8:	75 d6                	jne    5a0 <exec+0x20>
+  return _exec(path, argv);
+     5ca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     5cd:	89 7d 0c             	mov    %edi,0xc(%ebp)
+     5d0:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     5d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     5d6:	5b                   	pop    %ebx
+     5d7:	5e                   	pop    %esi
+     5d8:	5f                   	pop    %edi
+     5d9:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     5da:	e9 d3 03 00 00       	jmp    9b2 <_exec>
+     5df:	90                   	nop
+
+000005e0 <close>:
+{
+     5e0:	55                   	push   %ebp
+     5e1:	89 e5                	mov    %esp,%ebp
+     5e3:	56                   	push   %esi
+     5e4:	53                   	push   %ebx
+     5e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     5e8:	83 fb 0f             	cmp    $0xf,%ebx
+     5eb:	77 26                	ja     613 <close+0x33>
+     5ed:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     5f3:	8b 90 64 19 00 00    	mov    0x1964(%eax),%edx
+     5f9:	8d b0 60 19 00 00    	lea    0x1960(%eax),%esi
+     5ff:	85 d2                	test   %edx,%edx
+     601:	7f 25                	jg     628 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+     603:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     609:	c7 80 60 19 00 00 00 	movl   $0x0,0x1960(%eax)
+     610:	00 00 00 
+  return _close(fd);
+     613:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     616:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     619:	5b                   	pop    %ebx
+     61a:	5e                   	pop    %esi
+     61b:	5d                   	pop    %ebp
+  return _close(fd);
+     61c:	e9 83 03 00 00       	jmp    9a4 <_close>
+     621:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     628:	83 ec 04             	sub    $0x4,%esp
+     62b:	05 68 19 00 00       	add    $0x1968,%eax
+     630:	52                   	push   %edx
+     631:	50                   	push   %eax
+     632:	53                   	push   %ebx
+     633:	e8 65 03 00 00       	call   99d <write>
+    ob[fd].n = 0;
+     638:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+     63f:	83 c4 10             	add    $0x10,%esp
+     642:	eb bf                	jmp    603 <close+0x23>
+     644:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     64b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     64f:	90                   	nop
+
+00000650 <strcpy>:
+{
+     650:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+     651:	31 c0                	xor    %eax,%eax
+{
+     653:	89 e5                	mov    %esp,%ebp
+     655:	53                   	push   %ebx
+     656:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     659:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     65c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     660:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     664:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     667:	83 c0 01             	add    $0x1,%eax
+     66a:	84 d2                	test   %dl,%dl
+     66c:	75 f2                	jne    660 <strcpy+0x10>
+}
+     66e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     671:	89 c8                	mov    %ecx,%eax
+     673:	c9                   	leave
+     674:	c3                   	ret
+     675:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     67c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000680 <strcmp>:
+{
+     680:	55                   	push   %ebp
+     681:	89 e5                	mov    %esp,%ebp
+     683:	53                   	push   %ebx
+     684:	8b 55 08             	mov    0x8(%ebp),%edx
+     687:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     68a:	0f b6 02             	movzbl (%edx),%eax
+     68d:	84 c0                	test   %al,%al
+     68f:	75 17                	jne    6a8 <strcmp+0x28>
+     691:	eb 3a                	jmp    6cd <strcmp+0x4d>
+     693:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     697:	90                   	nop
+     698:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     69c:	83 c2 01             	add    $0x1,%edx
+     69f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     6a2:	84 c0                	test   %al,%al
+     6a4:	74 1a                	je     6c0 <strcmp+0x40>
+    p++, q++;
+     6a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     6a8:	0f b6 19             	movzbl (%ecx),%ebx
+     6ab:	38 c3                	cmp    %al,%bl
+     6ad:	74 e9                	je     698 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     6af:	29 d8                	sub    %ebx,%eax
+}
+     6b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6b4:	c9                   	leave
+     6b5:	c3                   	ret
+     6b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     6c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     6c4:	31 c0                	xor    %eax,%eax
+     6c6:	29 d8                	sub    %ebx,%eax
+}
+     6c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6cb:	c9                   	leave
+     6cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     6cd:	0f b6 19             	movzbl (%ecx),%ebx
+     6d0:	31 c0                	xor    %eax,%eax
+     6d2:	eb db                	jmp    6af <strcmp+0x2f>
+     6d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6df:	90                   	nop
+
+000006e0 <strlen>:
+{
+     6e0:	55                   	push   %ebp
+     6e1:	89 e5                	mov    %esp,%ebp
+     6e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+     6e6:	80 3a 00             	cmpb   $0x0,(%edx)
+     6e9:	74 15                	je     700 <strlen+0x20>
+     6eb:	31 c0                	xor    %eax,%eax
+     6ed:	8d 76 00             	lea    0x0(%esi),%esi
+     6f0:	83 c0 01             	add    $0x1,%eax
+     6f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     6f7:	89 c1                	mov    %eax,%ecx
+     6f9:	75 f5                	jne    6f0 <strlen+0x10>
+}
+     6fb:	89 c8                	mov    %ecx,%eax
+     6fd:	5d                   	pop    %ebp
+     6fe:	c3                   	ret
+     6ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+     700:	31 c9                	xor    %ecx,%ecx
+}
+     702:	5d                   	pop    %ebp
+     703:	89 c8                	mov    %ecx,%eax
+     705:	c3                   	ret
+     706:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     70d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000710 <memset>:
+{
+     710:	55                   	push   %ebp
+     711:	89 e5                	mov    %esp,%ebp
+     713:	57                   	push   %edi
+     714:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     717:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     71a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     71d:	89 d7                	mov    %edx,%edi
+     71f:	fc                   	cld
+     720:	f3 aa                	rep stos %al,%es:(%edi)
+}
+     722:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     725:	89 d0                	mov    %edx,%eax
+     727:	c9                   	leave
+     728:	c3                   	ret
+     729:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000730 <strchr>:
+{
+     730:	55                   	push   %ebp
+     731:	89 e5                	mov    %esp,%ebp
+     733:	8b 45 08             	mov    0x8(%ebp),%eax
+     736:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     73a:	0f b6 10             	movzbl (%eax),%edx
+     73d:	84 d2                	test   %dl,%dl
+     73f:	75 12                	jne    753 <strchr+0x23>
+     741:	eb 1d                	jmp    760 <strchr+0x30>
+     743:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     747:	90                   	nop
+     748:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     74c:	83 c0 01             	add    $0x1,%eax
+     74f:	84 d2                	test   %dl,%dl
+     751:	74 0d                	je     760 <strchr+0x30>
+    if(*s == c)
+     753:	38 d1                	cmp    %dl,%cl
+     755:	75 f1                	jne    748 <strchr+0x18>
+}
+     757:	5d                   	pop    %ebp
+     758:	c3                   	ret
+     759:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     760:	31 c0                	xor    %eax,%eax
+}
+     762:	5d                   	pop    %ebp
+     763:	c3                   	ret
+     764:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     76b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     76f:	90                   	nop
+
+00000770 <memchr>:
+{
+     770:	55                   	push   %ebp
+     771:	89 e5                	mov    %esp,%ebp
+     773:	8b 55 10             	mov    0x10(%ebp),%edx
+     776:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     779:	85 d2                	test   %edx,%edx
+     77b:	74 1b                	je     798 <memchr+0x28>
+    if(*p == (char)c)
+     77d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+     781:	01 c2                	add    %eax,%edx
+     783:	eb 0a                	jmp    78f <memchr+0x1f>
+     785:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+     788:	83 c0 01             	add    $0x1,%eax
+     78b:	39 c2                	cmp    %eax,%edx
+     78d:	74 09                	je     798 <memchr+0x28>
+    if(*p == (char)c)
+     78f:	38 08                	cmp    %cl,(%eax)
+     791:	75 f5                	jne    788 <memchr+0x18>
+}
+     793:	5d                   	pop    %ebp
+     794:	c3                   	ret
+     795:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+     798:	31 c0                	xor    %eax,%eax
+}
+     79a:	5d                   	pop    %ebp
+     79b:	c3                   	ret
+     79c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007a0 <gets>:
+{
+     7a0:	55                   	push   %ebp
+     7a1:	89 e5                	mov    %esp,%ebp
+     7a3:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+     7a4:	31 ff                	xor    %edi,%edi
+{
+     7a6:	56                   	push   %esi
+     7a7:	be 68 19 00 00       	mov    $0x1968,%esi
+     7ac:	53                   	push   %ebx
+     7ad:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     7b0:	8b 46 fc             	mov    -0x4(%esi),%eax
+     7b3:	85 c0                	test   %eax,%eax
+     7b5:	7e 15                	jle    7cc <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     7b7:	83 ec 04             	sub    $0x4,%esp
+     7ba:	50                   	push   %eax
+     7bb:	56                   	push   %esi
+     7bc:	57                   	push   %edi
+     7bd:	e8 db 01 00 00       	call   99d <write>
+    ob[fd].n = 0;
+     7c2:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+     7c9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     7cc:	83 c7 01             	add    $0x1,%edi
+     7cf:	81 c6 08 01 00 00    	add    $0x108,%esi
+     7d5:	83 ff 10             	cmp    $0x10,%edi
+     7d8:	75 d6                	jne    7b0 <gets+0x10>
+  for(i=0; i+1 < max; ){
+     7da:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+     7dc:	8d 75 e7             	lea    -0x19(%ebp),%esi
+     7df:	eb 2e                	jmp    80f <gets+0x6f>
+     7e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7e8:	83 ec 04             	sub    $0x4,%esp
+     7eb:	6a 01                	push   $0x1
+     7ed:	56                   	push   %esi
+     7ee:	6a 00                	push   $0x0
+     7f0:	e8 a1 01 00 00       	call   996 <read>
+    if(cc < 1)
+     7f5:	83 c4 10             	add    $0x10,%esp
+     7f8:	85 c0                	test   %eax,%eax
+     7fa:	7e 1d                	jle    819 <gets+0x79>
+    buf[i++] = c;
+     7fc:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     800:	8b 55 08             	mov    0x8(%ebp),%edx
+     803:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     807:	3c 0a                	cmp    $0xa,%al
+     809:	74 10                	je     81b <gets+0x7b>
+     80b:	3c 0d                	cmp    $0xd,%al
+     80d:	74 0c                	je     81b <gets+0x7b>
+  for(i=0; i+1 < max; ){
+     80f:	89 df                	mov    %ebx,%edi
+     811:	83 c3 01             	add    $0x1,%ebx
+     814:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     817:	7c cf                	jl     7e8 <gets+0x48>
+     819:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     81b:	8b 45 08             	mov    0x8(%ebp),%eax
+     81e:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     822:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     825:	5b                   	pop    %ebx
+     826:	5e                   	pop    %esi
+     827:	5f                   	pop    %edi
+     828:	5d                   	pop    %ebp
+     829:	c3                   	ret
+     82a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000830 <stat>:
+{
+     830:	55                   	push   %ebp
+     831:	89 e5                	mov    %esp,%ebp
+     833:	57                   	push   %edi
+     834:	56                   	push   %esi
+     835:	53                   	push   %ebx
+     836:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+     839:	6a 00                	push   $0x0
+     83b:	ff 75 08             	push   0x8(%ebp)
+     83e:	e8 76 01 00 00       	call   9b9 <open>
+  if(fd < 0)
+     843:	83 c4 10             	add    $0x10,%esp
+     846:	85 c0                	test   %eax,%eax
+     848:	78 76                	js     8c0 <stat+0x90>
+  r = fstat(fd, st);
+     84a:	83 ec 08             	sub    $0x8,%esp
+     84d:	ff 75 0c             	push   0xc(%ebp)
+     850:	89 c3                	mov    %eax,%ebx
+     852:	50                   	push   %eax
+     853:	e8 7f 01 00 00       	call   9d7 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     858:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     85b:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     85d:	83 fb 0f             	cmp    $0xf,%ebx
+     860:	7f 40                	jg     8a2 <stat+0x72>
+     862:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     868:	8b 90 64 19 00 00    	mov    0x1964(%eax),%edx
+     86e:	8d b8 60 19 00 00    	lea    0x1960(%eax),%edi
+     874:	85 d2                	test   %edx,%edx
+     876:	7e 1a                	jle    892 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+     878:	83 ec 04             	sub    $0x4,%esp
+     87b:	05 68 19 00 00       	add    $0x1968,%eax
+     880:	52                   	push   %edx
+     881:	50                   	push   %eax
+     882:	53                   	push   %ebx
+     883:	e8 15 01 00 00       	call   99d <write>
+    ob[fd].n = 0;
+     888:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+     88f:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+     892:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     898:	c7 80 60 19 00 00 00 	movl   $0x0,0x1960(%eax)
+     89f:	00 00 00 
+  return _close(fd);
+     8a2:	83 ec 0c             	sub    $0xc,%esp
+     8a5:	53                   	push   %ebx
+     8a6:	e8 f9 00 00 00       	call   9a4 <_close>
+     8ab:	83 c4 10             	add    $0x10,%esp
+}
+     8ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8b1:	89 f0                	mov    %esi,%eax
+     8b3:	5b                   	pop    %ebx
+     8b4:	5e                   	pop    %esi
+     8b5:	5f                   	pop    %edi
+     8b6:	5d                   	pop    %ebp
+     8b7:	c3                   	ret
+     8b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8bf:	90                   	nop
+    return -1;
+     8c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     8c5:	eb e7                	jmp    8ae <stat+0x7e>
+     8c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ce:	66 90                	xchg   %ax,%ax
+
+000008d0 <atoi>:
+{
+     8d0:	55                   	push   %ebp
+     8d1:	89 e5                	mov    %esp,%ebp
+     8d3:	53                   	push   %ebx
+     8d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     8d7:	0f be 02             	movsbl (%edx),%eax
+     8da:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     8dd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     8e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     8e5:	77 1e                	ja     905 <atoi+0x35>
+     8e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     8f0:	83 c2 01             	add    $0x1,%edx
+     8f3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     8f6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     8fa:	0f be 02             	movsbl (%edx),%eax
+     8fd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     900:	80 fb 09             	cmp    $0x9,%bl
+     903:	76 eb                	jbe    8f0 <atoi+0x20>
+}
+     905:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     908:	89 c8                	mov    %ecx,%eax
+     90a:	c9                   	leave
+     90b:	c3                   	ret
+     90c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000910 <memmove>:
+{
+     910:	55                   	push   %ebp
+     911:	89 e5                	mov    %esp,%ebp
+     913:	57                   	push   %edi
+     914:	56                   	push   %esi
+     915:	8b 45 10             	mov    0x10(%ebp),%eax
+     918:	8b 55 08             	mov    0x8(%ebp),%edx
+     91b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     91e:	85 c0                	test   %eax,%eax
+     920:	7e 13                	jle    935 <memmove+0x25>
+     922:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     924:	89 d7                	mov    %edx,%edi
+     926:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     92d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     930:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     931:	39 f8                	cmp    %edi,%eax
+     933:	75 fb                	jne    930 <memmove+0x20>
+  return vdst;
+}
+     935:	5e                   	pop    %esi
+     936:	89 d0                	mov    %edx,%eax
+     938:	5f                   	pop    %edi
+     939:	5d                   	pop    %ebp
+     93a:	c3                   	ret
+
+0000093b <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+     93b:	83 3d 40 17 00 00 00 	cmpl   $0x0,0x1740
+  jle 1f
+     942:	7e 0a                	jle    94e <syscallentry+0x13>
+  movl %esp, %ecx
+     944:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+     946:	ba 4d 09 00 00       	mov    $0x94d,%edx
+  sysenter
+     94b:	0f 34                	sysenter
+2:
+  ret
+     94d:	c3                   	ret
+1:
+  jl 3f
+     94e:	7c 27                	jl     977 <syscallentry+0x3c>
+  pushal
+     950:	60                   	pusha
+  movl $1, %eax
+     951:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     956:	0f a2                	cpuid
+  movl $-1, sysentermode
+     958:	c7 05 40 17 00 00 ff 	movl   $0xffffffff,0x1740
+     95f:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     962:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+     968:	74 0a                	je     974 <syscallentry+0x39>
+  movl $1, sysentermode
+     96a:	c7 05 40 17 00 00 01 	movl   $0x1,0x1740
+     971:	00 00 00 
+4:
+  popal
+     974:	61                   	popa
+  jmp syscallentry
+     975:	eb c4                	jmp    93b <syscallentry>
+3:
+  int $T_SYSCALL
+     977:	cd 40                	int    $0x40
+  ret
+     979:	c3                   	ret
+
+0000097a <_fork>:
+
+SYSCALLAS(_fork, fork)
+     97a:	b8 01 00 00 00       	mov    $0x1,%eax
+     97f:	eb ba                	jmp    93b <syscallentry>
+
+00000981 <_exit>:
+SYSCALLAS(_exit, exit)
+     981:	b8 02 00 00 00       	mov    $0x2,%eax
+     986:	eb b3                	jmp    93b <syscallentry>
+
+00000988 <wait>:
+SYSCALL(wait)
+     988:	b8 03 00 00 00       	mov    $0x3,%eax
+     98d:	eb ac                	jmp    93b <syscallentry>
+
+0000098f <pipe>:
+SYSCALL(pipe)
+     98f:	b8 04 00 00 00       	mov    $0x4,%eax
+     994:	eb a5                	jmp    93b <syscallentry>
+
+00000996 <read>:
+SYSCALL(read)
+     996:	b8 05 00 00 00       	mov    $0x5,%eax
+     99b:	eb 9e                	jmp    93b <syscallentry>
+
+0000099d <write>:
+SYSCALL(write)
+     99d:	b8 10 00 00 00       	mov    $0x10,%eax
+     9a2:	eb 97                	jmp    93b <syscallentry>
+
+000009a4 <_close>:
+SYSCALLAS(_close, close)
+     9a4:	b8 15 00 00 00       	mov    $0x15,%eax
+     9a9:	eb 90                	jmp    93b <syscallentry>
+
+000009ab <kill>:
+SYSCALL(kill)
+     9ab:	b8 06 00 00 00       	mov    $0x6,%eax
+     9b0:	eb 89                	jmp    93b <syscallentry>
+
+000009b2 <_exec>:
+SYSCALLAS(_exec, exec)
+     9b2:	b8 07 00 00 00       	mov    $0x7,%eax
+     9b7:	eb 82                	jmp    93b <syscallentry>
+
+000009b9 <open>:
+SYSCALL(open)
+     9b9:	b8 0f 00 00 00       	mov    $0xf,%eax
+     9be:	e9 78 ff ff ff       	jmp    93b <syscallentry>
+
+000009c3 <mknod>:
+SYSCALL(mknod)
+     9c3:	b8 11 00 00 00       	mov    $0x11,%eax
+     9c8:	e9 6e ff ff ff       	jmp    93b <syscallentry>
+
+000009cd <unlink>:
+SYSCALL(unlink)
+     9cd:	b8 12 00 00 00       	mov    $0x12,%eax
+     9d2:	e9 64 ff ff ff       	jmp    93b <syscallentry>
+
+000009d7 <fstat>:
+SYSCALL(fstat)
+     9d7:	b8 08 00 00 00       	mov    $0x8,%eax
+     9dc:	e9 5a ff ff ff       	jmp    93b <syscallentry>
+
+000009e1 <link>:
+SYSCALL(link)
+     9e1:	b8 13 00 00 00       	mov    $0x13,%eax
+     9e6:	e9 50 ff ff ff       	jmp    93b <syscallentry>
+
+000009eb <mkdir>:
+SYSCALL(mkdir)
+     9eb:	b8 14 00 00 00       	mov    $0x14,%eax
+     9f0:	e9 46 ff ff ff       	jmp    93b <syscallentry>
+
+000009f5 <chdir>:
+SYSCALL(chdir)
+     9f5:	b8 09 00 00 00       	mov    $0x9,%eax
+     9fa:	e9 3c ff ff ff       	jmp    93b <syscallentry>
+
+000009ff <dup>:
+SYSCALL(dup)
+     9ff:	b8 0a 00 00 00       	mov    $0xa,%eax
+     a04:	e9 32 ff ff ff       	jmp    93b <syscallentry>
+
+00000a09 <getpid>:
+SYSCALL(getpid)
+     a09:	b8 0b 00 00 00       	mov    $0xb,%eax
+     a0e:	e9 28 ff ff ff       	jmp    93b <syscallentry>
+
+00000a13 <sbrk>:
+SYSCALL(sbrk)
+     a13:	b8 0c 00 00 00       	mov    $0xc,%eax
+     a18:	e9 1e ff ff ff       	jmp    93b <syscallentry>
+
+00000a1d <sleep>:
+SYSCALL(sleep)
+     a1d:	b8 0d 00 00 00       	mov    $0xd,%eax
+     a22:	e9 14 ff ff ff       	jmp    93b <syscallentry>
+
+00000a27 <uptime>:
+SYSCALL(uptime)
+     a27:	b8 0e 00 00 00       	mov    $0xe,%eax
+     a2c:	e9 0a ff ff ff       	jmp    93b <syscallentry>
+
+00000a31 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+     a31:	b8 16 00 00 00       	mov    $0x16,%eax
+     a36:	e9 00 ff ff ff       	jmp    93b <syscallentry>
+
+00000a3b <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+     a3b:	b8 17 00 00 00       	mov    $0x17,%eax
+     a40:	e9 f6 fe ff ff       	jmp    93b <syscallentry>
+
+00000a45 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+     a45:	b8 18 00 00 00       	mov    $0x18,%eax
+     a4a:	e9 ec fe ff ff       	jmp    93b <syscallentry>
+
+00000a4f <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+     a4f:	b8 19 00 00 00       	mov    $0x19,%eax
+     a54:	e9 e2 fe ff ff       	jmp    93b <syscallentry>
+
+00000a59 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+     a59:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     a5e:	e9 d8 fe ff ff       	jmp    93b <syscallentry>
+
+00000a63 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+     a63:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     a68:	e9 ce fe ff ff       	jmp    93b <syscallentry>
+
+00000a6d <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+     a6d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     a72:	e9 c4 fe ff ff       	jmp    93b <syscallentry>
+
+00000a77 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+     a77:	b8 20 00 00 00       	mov    $0x20,%eax
+     a7c:	e9 ba fe ff ff       	jmp    93b <syscallentry>
+
+00000a81 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+     a81:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     a86:	e9 b0 fe ff ff       	jmp    93b <syscallentry>
+
+00000a8b <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+     a8b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     a90:	e9 a6 fe ff ff       	jmp    93b <syscallentry>
+
+00000a95 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+     a95:	b8 21 00 00 00       	mov    $0x21,%eax
+     a9a:	e9 9c fe ff ff       	jmp    93b <syscallentry>
+
+00000a9f <yield>:
+SYSCALL(yield) // yield the CPU to another process
+     a9f:	b8 22 00 00 00       	mov    $0x22,%eax
+     aa4:	e9 92 fe ff ff       	jmp    93b <syscallentry>
+
+00000aa9 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+     aa9:	b8 23 00 00 00       	mov    $0x23,%eax
+     aae:	e9 88 fe ff ff       	jmp    93b <syscallentry>
+
+00000ab3 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+     ab3:	b8 24 00 00 00       	mov    $0x24,%eax
+     ab8:	e9 7e fe ff ff       	jmp    93b <syscallentry>
+
+00000abd <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+     abd:	b8 25 00 00 00       	mov    $0x25,%eax
+     ac2:	e9 74 fe ff ff       	jmp    93b <syscallentry>
+
+00000ac7 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+     ac7:	b8 26 00 00 00       	mov    $0x26,%eax
+     acc:	e9 6a fe ff ff       	jmp    93b <syscallentry>
+
+00000ad1 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+     ad1:	b8 27 00 00 00       	mov    $0x27,%eax
+     ad6:	e9 60 fe ff ff       	jmp    93b <syscallentry>
+
+00000adb <mmap>:
+SYSCALL(mmap) // map a file into memory
+     adb:	b8 28 00 00 00       	mov    $0x28,%eax
+     ae0:	e9 56 fe ff ff       	jmp    93b <syscallentry>
+
+00000ae5 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+     ae5:	b8 29 00 00 00       	mov    $0x29,%eax
+     aea:	e9 4c fe ff ff       	jmp    93b <syscallentry>
+
+00000aef <readv>:
+SYSCALL(readv) // read into several buffers
+     aef:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     af4:	e9 42 fe ff ff       	jmp    93b <syscallentry>
+
+00000af9 <writev>:
+SYSCALL(writev) // write from several buffers
+     af9:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     afe:	e9 38 fe ff ff       	jmp    93b <syscallentry>
+
+00000b03 <pread>:
+SYSCALL(pread) // read at an offset
+     b03:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     b08:	e9 2e fe ff ff       	jmp    93b <syscallentry>
+
+00000b0d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+     b0d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     b12:	e9 24 fe ff ff       	jmp    93b <syscallentry>
+
+00000b17 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+     b17:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     b1c:	e9 1a fe ff ff       	jmp    93b <syscallentry>
+
+00000b21 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+     b21:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     b26:	e9 10 fe ff ff       	jmp    93b <syscallentry>
+
+00000b2b <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+     b2b:	b8 30 00 00 00       	mov    $0x30,%eax
+     b30:	e9 06 fe ff ff       	jmp    93b <syscallentry>
+
+00000b35 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+     b35:	b8 31 00 00 00       	mov    $0x31,%eax
+     b3a:	e9 fc fd ff ff       	jmp    93b <syscallentry>
+
+00000b3f <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+     b3f:	b8 32 00 00 00       	mov    $0x32,%eax
+     b44:	e9 f2 fd ff ff       	jmp    93b <syscallentry>
+
+00000b49 <profread>:
+SYSCALL(profread) // drain profiler samples
+     b49:	b8 33 00 00 00       	mov    $0x33,%eax
+     b4e:	e9 e8 fd ff ff       	jmp    93b <syscallentry>
+
+00000b53 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+     b53:	b8 34 00 00 00       	mov    $0x34,%eax
+     b58:	e9 de fd ff ff       	jmp    93b <syscallentry>
+
+00000b5d <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+     b5d:	b8 35 00 00 00       	mov    $0x35,%eax
+     b62:	e9 d4 fd ff ff       	jmp    93b <syscallentry>
+
+00000b67 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+     b67:	b8 36 00 00 00       	mov    $0x36,%eax
+     b6c:	e9 ca fd ff ff       	jmp    93b <syscallentry>
+
+00000b71 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+     b71:	b8 37 00 00 00       	mov    $0x37,%eax
+     b76:	e9 c0 fd ff ff       	jmp    93b <syscallentry>
+     b7b:	66 90                	xchg   %ax,%ax
+     b7d:	66 90                	xchg   %ax,%ax
+     b7f:	90                   	nop
+
+00000b80 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     b80:	55                   	push   %ebp
+     b81:	89 e5                	mov    %esp,%ebp
+     b83:	57                   	push   %edi
+     b84:	56                   	push   %esi
+     b85:	53                   	push   %ebx
+     b86:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     b88:	89 d1                	mov    %edx,%ecx
+{
+     b8a:	83 ec 3c             	sub    $0x3c,%esp
+     b8d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     b90:	85 d2                	test   %edx,%edx
+     b92:	0f 89 80 00 00 00    	jns    c18 <printint+0x98>
+     b98:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     b9c:	74 7a                	je     c18 <printint+0x98>
+    x = -xx;
+     b9e:	f7 d9                	neg    %ecx
+    neg = 1;
+     ba0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     ba5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     ba8:	31 f6                	xor    %esi,%esi
+     baa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     bb0:	89 c8                	mov    %ecx,%eax
+     bb2:	31 d2                	xor    %edx,%edx
+     bb4:	89 f7                	mov    %esi,%edi
+     bb6:	f7 f3                	div    %ebx
+     bb8:	8d 76 01             	lea    0x1(%esi),%esi
+     bbb:	0f b6 92 f8 11 00 00 	movzbl 0x11f8(%edx),%edx
+     bc2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     bc6:	89 ca                	mov    %ecx,%edx
+     bc8:	89 c1                	mov    %eax,%ecx
+     bca:	39 da                	cmp    %ebx,%edx
+     bcc:	73 e2                	jae    bb0 <printint+0x30>
+  if(neg)
+     bce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     bd1:	85 c0                	test   %eax,%eax
+     bd3:	74 07                	je     bdc <printint+0x5c>
+    buf[i++] = '-';
+     bd5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     bda:	89 f7                	mov    %esi,%edi
+     bdc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     bdf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     be2:	01 df                	add    %ebx,%edi
+     be4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     be8:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+     beb:	83 ec 04             	sub    $0x4,%esp
+     bee:	88 45 d7             	mov    %al,-0x29(%ebp)
+     bf1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     bf4:	6a 01                	push   $0x1
+     bf6:	50                   	push   %eax
+     bf7:	56                   	push   %esi
+     bf8:	e8 e3 f6 ff ff       	call   2e0 <bufwrite>
+  while(--i >= 0)
+     bfd:	89 f8                	mov    %edi,%eax
+     bff:	83 c4 10             	add    $0x10,%esp
+     c02:	83 ef 01             	sub    $0x1,%edi
+     c05:	39 d8                	cmp    %ebx,%eax
+     c07:	75 df                	jne    be8 <printint+0x68>
+}
+     c09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c0c:	5b                   	pop    %ebx
+     c0d:	5e                   	pop    %esi
+     c0e:	5f                   	pop    %edi
+     c0f:	5d                   	pop    %ebp
+     c10:	c3                   	ret
+     c11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     c18:	31 c0                	xor    %eax,%eax
+     c1a:	eb 89                	jmp    ba5 <printint+0x25>
+     c1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c20 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     c20:	55                   	push   %ebp
+     c21:	89 e5                	mov    %esp,%ebp
+     c23:	57                   	push   %edi
+     c24:	56                   	push   %esi
+     c25:	53                   	push   %ebx
+     c26:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     c29:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c2c:	0f b6 18             	movzbl (%eax),%ebx
+     c2f:	84 db                	test   %bl,%bl
+     c31:	74 6c                	je     c9f <printf+0x7f>
+     c33:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+     c36:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+     c39:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     c3b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     c3e:	eb 26                	jmp    c66 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     c40:	83 f8 25             	cmp    $0x25,%eax
+     c43:	74 4b                	je     c90 <printf+0x70>
+  bufwrite(fd, &c, 1);
+     c45:	83 ec 04             	sub    $0x4,%esp
+     c48:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     c4b:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     c4e:	6a 01                	push   $0x1
+     c50:	50                   	push   %eax
+     c51:	ff 75 08             	push   0x8(%ebp)
+     c54:	e8 87 f6 ff ff       	call   2e0 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+     c59:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     c5c:	0f b6 1f             	movzbl (%edi),%ebx
+     c5f:	83 c7 01             	add    $0x1,%edi
+     c62:	84 db                	test   %bl,%bl
+     c64:	74 39                	je     c9f <printf+0x7f>
+    c = fmt[i] & 0xff;
+     c66:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     c69:	85 f6                	test   %esi,%esi
+     c6b:	74 d3                	je     c40 <printf+0x20>
+      }
+    } else if(state == '%'){
+     c6d:	83 fe 25             	cmp    $0x25,%esi
+     c70:	75 ea                	jne    c5c <printf+0x3c>
+      if(c == 'd'){
+     c72:	83 f8 25             	cmp    $0x25,%eax
+     c75:	0f 84 d5 01 00 00    	je     e50 <printf+0x230>
+     c7b:	83 e8 63             	sub    $0x63,%eax
+     c7e:	83 f8 15             	cmp    $0x15,%eax
+     c81:	77 45                	ja     cc8 <printf+0xa8>
+     c83:	ff 24 85 a0 11 00 00 	jmp    *0x11a0(,%eax,4)
+     c8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     c90:	0f b6 1f             	movzbl (%edi),%ebx
+     c93:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+     c96:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     c9b:	84 db                	test   %bl,%bl
+     c9d:	75 c7                	jne    c66 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+     c9f:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+     ca3:	74 0b                	je     cb0 <printf+0x90>
+    fflush(fd);
+}
+     ca5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ca8:	5b                   	pop    %ebx
+     ca9:	5e                   	pop    %esi
+     caa:	5f                   	pop    %edi
+     cab:	5d                   	pop    %ebp
+     cac:	c3                   	ret
+     cad:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+     cb0:	83 ec 0c             	sub    $0xc,%esp
+     cb3:	6a 02                	push   $0x2
+     cb5:	e8 c6 f7 ff ff       	call   480 <fflush>
+     cba:	83 c4 10             	add    $0x10,%esp
+}
+     cbd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cc0:	5b                   	pop    %ebx
+     cc1:	5e                   	pop    %esi
+     cc2:	5f                   	pop    %edi
+     cc3:	5d                   	pop    %ebp
+     cc4:	c3                   	ret
+     cc5:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+     cc8:	83 ec 04             	sub    $0x4,%esp
+     ccb:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     cce:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+     cd2:	6a 01                	push   $0x1
+     cd4:	52                   	push   %edx
+     cd5:	89 55 c0             	mov    %edx,-0x40(%ebp)
+     cd8:	ff 75 08             	push   0x8(%ebp)
+     cdb:	e8 00 f6 ff ff       	call   2e0 <bufwrite>
+     ce0:	83 c4 0c             	add    $0xc,%esp
+     ce3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     ce6:	6a 01                	push   $0x1
+     ce8:	8b 55 c0             	mov    -0x40(%ebp),%edx
+     ceb:	52                   	push   %edx
+      state = 0;
+     cec:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+     cee:	ff 75 08             	push   0x8(%ebp)
+     cf1:	e8 ea f5 ff ff       	call   2e0 <bufwrite>
+        putc(fd, c);
+     cf6:	83 c4 10             	add    $0x10,%esp
+     cf9:	e9 5e ff ff ff       	jmp    c5c <printf+0x3c>
+     cfe:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+     d00:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     d03:	83 ec 0c             	sub    $0xc,%esp
+     d06:	b9 10 00 00 00       	mov    $0x10,%ecx
+     d0b:	8b 16                	mov    (%esi),%edx
+     d0d:	6a 00                	push   $0x0
+     d0f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+     d12:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+     d15:	e8 66 fe ff ff       	call   b80 <printint>
+        ap++;
+     d1a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     d1d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d20:	31 f6                	xor    %esi,%esi
+     d22:	e9 35 ff ff ff       	jmp    c5c <printf+0x3c>
+     d27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d2e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     d30:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     d33:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     d35:	83 c0 04             	add    $0x4,%eax
+     d38:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+     d3b:	b8 99 11 00 00       	mov    $0x1199,%eax
+     d40:	85 db                	test   %ebx,%ebx
+     d42:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+     d45:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+     d48:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+     d4a:	53                   	push   %ebx
+     d4b:	e8 90 f9 ff ff       	call   6e0 <strlen>
+     d50:	83 c4 0c             	add    $0xc,%esp
+     d53:	50                   	push   %eax
+     d54:	53                   	push   %ebx
+     d55:	ff 75 08             	push   0x8(%ebp)
+     d58:	e8 83 f5 ff ff       	call   2e0 <bufwrite>
+     d5d:	83 c4 10             	add    $0x10,%esp
+     d60:	e9 f7 fe ff ff       	jmp    c5c <printf+0x3c>
+     d65:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+     d68:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+     d6b:	83 ec 04             	sub    $0x4,%esp
+     d6e:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+     d71:	8b 06                	mov    (%esi),%eax
+        ap++;
+     d73:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+     d76:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+     d79:	6a 01                	push   $0x1
+     d7b:	52                   	push   %edx
+     d7c:	ff 75 08             	push   0x8(%ebp)
+     d7f:	e8 5c f5 ff ff       	call   2e0 <bufwrite>
+        ap++;
+     d84:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     d87:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d8a:	31 f6                	xor    %esi,%esi
+     d8c:	e9 cb fe ff ff       	jmp    c5c <printf+0x3c>
+     d91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+     d98:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     d9b:	83 ec 0c             	sub    $0xc,%esp
+     d9e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     da3:	8b 16                	mov    (%esi),%edx
+     da5:	6a 01                	push   $0x1
+     da7:	e9 63 ff ff ff       	jmp    d0f <printf+0xef>
+     dac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+     db0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     db3:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     db6:	89 7d c0             	mov    %edi,-0x40(%ebp)
+     db9:	89 55 bc             	mov    %edx,-0x44(%ebp)
+     dbc:	8b 18                	mov    (%eax),%ebx
+     dbe:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+     dc1:	31 c0                	xor    %eax,%eax
+     dc3:	89 c7                	mov    %eax,%edi
+     dc5:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+     dc8:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+     dcd:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+     dcf:	f7 e1                	mul    %ecx
+     dd1:	c1 ea 03             	shr    $0x3,%edx
+     dd4:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     dd7:	89 d1                	mov    %edx,%ecx
+     dd9:	01 c0                	add    %eax,%eax
+     ddb:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     ddd:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+     ddf:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     de1:	be 0a 00 00 00       	mov    $0xa,%esi
+     de6:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+     de8:	89 da                	mov    %ebx,%edx
+     dea:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+     dec:	89 fe                	mov    %edi,%esi
+     dee:	83 c7 01             	add    $0x1,%edi
+     df1:	8d 42 30             	lea    0x30(%edx),%eax
+     df4:	89 da                	mov    %ebx,%edx
+     df6:	8d 14 92             	lea    (%edx,%edx,4),%edx
+     df9:	01 d2                	add    %edx,%edx
+     dfb:	29 d0                	sub    %edx,%eax
+     dfd:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+     e01:	89 c8                	mov    %ecx,%eax
+     e03:	09 d8                	or     %ebx,%eax
+     e05:	75 c1                	jne    dc8 <printf+0x1a8>
+     e07:	8b 55 bc             	mov    -0x44(%ebp),%edx
+     e0a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     e0d:	01 d6                	add    %edx,%esi
+     e0f:	89 f7                	mov    %esi,%edi
+     e11:	89 d6                	mov    %edx,%esi
+     e13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e17:	90                   	nop
+    putc(fd, buf[i]);
+     e18:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+     e1b:	83 ec 04             	sub    $0x4,%esp
+     e1e:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+     e21:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+     e24:	6a 01                	push   $0x1
+     e26:	50                   	push   %eax
+     e27:	53                   	push   %ebx
+     e28:	e8 b3 f4 ff ff       	call   2e0 <bufwrite>
+  while(--i >= 0)
+     e2d:	89 fa                	mov    %edi,%edx
+     e2f:	83 c4 10             	add    $0x10,%esp
+     e32:	83 ef 01             	sub    $0x1,%edi
+     e35:	39 d6                	cmp    %edx,%esi
+     e37:	75 df                	jne    e18 <printf+0x1f8>
+        ap += 2;
+     e39:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+     e3d:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+     e40:	31 f6                	xor    %esi,%esi
+     e42:	e9 15 fe ff ff       	jmp    c5c <printf+0x3c>
+     e47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e4e:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+     e50:	83 ec 04             	sub    $0x4,%esp
+     e53:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     e56:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     e59:	6a 01                	push   $0x1
+     e5b:	e9 8b fe ff ff       	jmp    ceb <printf+0xcb>
+
+00000e60 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     e60:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e61:	a1 e0 29 00 00       	mov    0x29e0,%eax
+{
+     e66:	89 e5                	mov    %esp,%ebp
+     e68:	57                   	push   %edi
+     e69:	56                   	push   %esi
+     e6a:	53                   	push   %ebx
+     e6b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     e6e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e78:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e7a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e7c:	39 ca                	cmp    %ecx,%edx
+     e7e:	73 30                	jae    eb0 <free+0x50>
+     e80:	39 c1                	cmp    %eax,%ecx
+     e82:	72 04                	jb     e88 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e84:	39 c2                	cmp    %eax,%edx
+     e86:	72 f0                	jb     e78 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     e88:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     e8b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     e8e:	39 f8                	cmp    %edi,%eax
+     e90:	74 2e                	je     ec0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e92:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     e95:	8b 42 04             	mov    0x4(%edx),%eax
+     e98:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     e9b:	39 f1                	cmp    %esi,%ecx
+     e9d:	74 38                	je     ed7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     e9f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     ea1:	5b                   	pop    %ebx
+  freep = p;
+     ea2:	89 15 e0 29 00 00    	mov    %edx,0x29e0
+}
+     ea8:	5e                   	pop    %esi
+     ea9:	5f                   	pop    %edi
+     eaa:	5d                   	pop    %ebp
+     eab:	c3                   	ret
+     eac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     eb0:	39 c1                	cmp    %eax,%ecx
+     eb2:	72 d0                	jb     e84 <free+0x24>
+     eb4:	eb c2                	jmp    e78 <free+0x18>
+     eb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ebd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+     ec0:	03 70 04             	add    0x4(%eax),%esi
+     ec3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     ec6:	8b 02                	mov    (%edx),%eax
+     ec8:	8b 00                	mov    (%eax),%eax
+     eca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     ecd:	8b 42 04             	mov    0x4(%edx),%eax
+     ed0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     ed3:	39 f1                	cmp    %esi,%ecx
+     ed5:	75 c8                	jne    e9f <free+0x3f>
+    p->s.size += bp->s.size;
+     ed7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     eda:	89 15 e0 29 00 00    	mov    %edx,0x29e0
+    p->s.size += bp->s.size;
+     ee0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     ee3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     ee6:	89 0a                	mov    %ecx,(%edx)
+}
+     ee8:	5b                   	pop    %ebx
+     ee9:	5e                   	pop    %esi
+     eea:	5f                   	pop    %edi
+     eeb:	5d                   	pop    %ebp
+     eec:	c3                   	ret
+     eed:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ef0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     ef0:	55                   	push   %ebp
+     ef1:	89 e5                	mov    %esp,%ebp
+     ef3:	57                   	push   %edi
+     ef4:	56                   	push   %esi
+     ef5:	53                   	push   %ebx
+     ef6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     ef9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+     efc:	8b 15 e0 29 00 00    	mov    0x29e0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f02:	8d 78 07             	lea    0x7(%eax),%edi
+     f05:	c1 ef 03             	shr    $0x3,%edi
+     f08:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+     f0b:	85 d2                	test   %edx,%edx
+     f0d:	0f 84 8d 00 00 00    	je     fa0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f13:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     f15:	8b 48 04             	mov    0x4(%eax),%ecx
+     f18:	39 f9                	cmp    %edi,%ecx
+     f1a:	73 64                	jae    f80 <malloc+0x90>
+  if(nu < 4096)
+     f1c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     f21:	39 df                	cmp    %ebx,%edi
+     f23:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     f26:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     f2d:	eb 0a                	jmp    f39 <malloc+0x49>
+     f2f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f30:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     f32:	8b 48 04             	mov    0x4(%eax),%ecx
+     f35:	39 f9                	cmp    %edi,%ecx
+     f37:	73 47                	jae    f80 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     f39:	89 c2                	mov    %eax,%edx
+     f3b:	39 05 e0 29 00 00    	cmp    %eax,0x29e0
+     f41:	75 ed                	jne    f30 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+     f43:	83 ec 0c             	sub    $0xc,%esp
+     f46:	56                   	push   %esi
+     f47:	e8 c7 fa ff ff       	call   a13 <sbrk>
+  if(p == (char*)-1)
+     f4c:	83 c4 10             	add    $0x10,%esp
+     f4f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f52:	74 1c                	je     f70 <malloc+0x80>
+  hp->s.size = nu;
+     f54:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+     f57:	83 ec 0c             	sub    $0xc,%esp
+     f5a:	83 c0 08             	add    $0x8,%eax
+     f5d:	50                   	push   %eax
+     f5e:	e8 fd fe ff ff       	call   e60 <free>
+  return freep;
+     f63:	8b 15 e0 29 00 00    	mov    0x29e0,%edx
+      if((p = morecore(nunits)) == 0)
+     f69:	83 c4 10             	add    $0x10,%esp
+     f6c:	85 d2                	test   %edx,%edx
+     f6e:	75 c0                	jne    f30 <malloc+0x40>
+        return 0;
+  }
+}
+     f70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     f73:	31 c0                	xor    %eax,%eax
+}
+     f75:	5b                   	pop    %ebx
+     f76:	5e                   	pop    %esi
+     f77:	5f                   	pop    %edi
+     f78:	5d                   	pop    %ebp
+     f79:	c3                   	ret
+     f7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     f80:	39 cf                	cmp    %ecx,%edi
+     f82:	74 4c                	je     fd0 <malloc+0xe0>
+        p->s.size -= nunits;
+     f84:	29 f9                	sub    %edi,%ecx
+     f86:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+     f89:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+     f8c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+     f8f:	89 15 e0 29 00 00    	mov    %edx,0x29e0
+}
+     f95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+     f98:	83 c0 08             	add    $0x8,%eax
+}
+     f9b:	5b                   	pop    %ebx
+     f9c:	5e                   	pop    %esi
+     f9d:	5f                   	pop    %edi
+     f9e:	5d                   	pop    %ebp
+     f9f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+     fa0:	c7 05 e0 29 00 00 e4 	movl   $0x29e4,0x29e0
+     fa7:	29 00 00 
+    base.s.size = 0;
+     faa:	b8 e4 29 00 00       	mov    $0x29e4,%eax
+    base.s.ptr = freep = prevp = &base;
+     faf:	c7 05 e4 29 00 00 e4 	movl   $0x29e4,0x29e4
+     fb6:	29 00 00 
+    base.s.size = 0;
+     fb9:	c7 05 e8 29 00 00 00 	movl   $0x0,0x29e8
+     fc0:	00 00 00 
+    if(p->s.size >= nunits){
+     fc3:	e9 54 ff ff ff       	jmp    f1c <malloc+0x2c>
+     fc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fcf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+     fd0:	8b 08                	mov    (%eax),%ecx
+     fd2:	89 0a                	mov    %ecx,(%edx)
+     fd4:	eb b9                	jmp    f8f <malloc+0x9f>
+     fd6:	66 90                	xchg   %ax,%ax
+     fd8:	66 90                	xchg   %ax,%ax
+     fda:	66 90                	xchg   %ax,%ax
+     fdc:	66 90                	xchg   %ax,%ax
+     fde:	66 90                	xchg   %ax,%ax
+
+00000fe0 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+     fe0:	55                   	push   %ebp
+     fe1:	89 e5                	mov    %esp,%ebp
+     fe3:	57                   	push   %edi
+     fe4:	56                   	push   %esi
+     fe5:	be 01 00 00 00       	mov    $0x1,%esi
+     fea:	53                   	push   %ebx
+     feb:	83 ec 28             	sub    $0x28,%esp
+     fee:	8b 45 0c             	mov    0xc(%ebp),%eax
+     ff1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     ff4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+     ff7:	68 00 98 00 00       	push   $0x9800
+     ffc:	e8 ef fe ff ff       	call   ef0 <malloc>
+    1001:	83 c4 10             	add    $0x10,%esp
+    1004:	89 c7                	mov    %eax,%edi
+    1006:	85 c0                	test   %eax,%eax
+    1008:	74 62                	je     106c <waitpoll+0x8c>
+    100a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+    1010:	83 ec 0c             	sub    $0xc,%esp
+    1013:	6a 01                	push   $0x1
+    1015:	e8 03 fa ff ff       	call   a1d <sleep>
+    fn();
+    101a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    101d:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+    101f:	58                   	pop    %eax
+    1020:	5a                   	pop    %edx
+    1021:	68 00 02 00 00       	push   $0x200
+    1026:	57                   	push   %edi
+    1027:	e8 eb fa ff ff       	call   b17 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+    102c:	83 c4 10             	add    $0x10,%esp
+    102f:	85 c0                	test   %eax,%eax
+    1031:	7e 2d                	jle    1060 <waitpoll+0x80>
+    1033:	6b c0 4c             	imul   $0x4c,%eax,%eax
+    1036:	89 fa                	mov    %edi,%edx
+    alive = 0;
+    1038:	31 c9                	xor    %ecx,%ecx
+    103a:	01 f8                	add    %edi,%eax
+    103c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+    1040:	3b 1a                	cmp    (%edx),%ebx
+    1042:	75 07                	jne    104b <waitpoll+0x6b>
+        alive = 1;
+    1044:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+    1048:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+    104b:	83 c2 4c             	add    $0x4c,%edx
+    104e:	39 d0                	cmp    %edx,%eax
+    1050:	75 ee                	jne    1040 <waitpoll+0x60>
+  } while(alive);
+    1052:	85 c9                	test   %ecx,%ecx
+    1054:	75 ba                	jne    1010 <waitpoll+0x30>
+    1056:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    105d:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+    1060:	83 ec 0c             	sub    $0xc,%esp
+    1063:	57                   	push   %edi
+    1064:	e8 f7 fd ff ff       	call   e60 <free>
+  wait();
+    1069:	83 c4 10             	add    $0x10,%esp
+}
+    106c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    106f:	5b                   	pop    %ebx
+    1070:	5e                   	pop    %esi
+    1071:	5f                   	pop    %edi
+    1072:	5d                   	pop    %ebp
+  wait();
+    1073:	e9 10 f9 ff ff       	jmp    988 <wait>
+    1078:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    107f:	90                   	nop
+
+00001080 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+    1080:	55                   	push   %ebp
+    1081:	89 e5                	mov    %esp,%ebp
+    1083:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+    1086:	c7 45 f0 09 12 00 00 	movl   $0x1209,-0x10(%ebp)
+    108d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+    1094:	e8 87 f4 ff ff       	call   520 <fork>
+    1099:	85 c0                	test   %eax,%eax
+    109b:	78 09                	js     10a6 <runps+0x26>
+    return -1;
+  if(pid == 0){
+    109d:	74 0e                	je     10ad <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+    109f:	e8 e4 f8 ff ff       	call   988 <wait>
+}
+    10a4:	c9                   	leave
+    10a5:	c3                   	ret
+    10a6:	c9                   	leave
+    return -1;
+    10a7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    10ac:	c3                   	ret
+    exec("ps", argv);
+    10ad:	50                   	push   %eax
+    10ae:	50                   	push   %eax
+    10af:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    10b2:	50                   	push   %eax
+    10b3:	68 09 12 00 00       	push   $0x1209
+    10b8:	e8 c3 f4 ff ff       	call   580 <exec>
+    printf(2, "exec ps failed\n");
+    10bd:	5a                   	pop    %edx
+    10be:	59                   	pop    %ecx
+    10bf:	68 0c 12 00 00       	push   $0x120c
+    10c4:	6a 02                	push   $0x2
+    10c6:	e8 55 fb ff ff       	call   c20 <printf>
+    exit();
+    10cb:	e8 a0 f4 ff ff       	call   570 <exit>
@@ -0,0 +1,105 @@
+// Report the disk traffic the log generates for a few workloads,
+// using the counters from logstat().
+//
+// usage: logbench [kb]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "logstat.h"
+
+#define FILENAME "logbench.tmp"
+
+char buf[512];
+
+// Append kb KB to a new file in 512-byte writes.
+void
+append(int kb)
+{
+  int fd, i;
+
+  if((fd = open(FILENAME, O_CREATE|O_RDWR)) < 0){
+    printf(2, "logbench: cannot create %s\n", FILENAME);
+    exit();
+  }
+  for(i = 0; i < 2*kb; i++)
+    write(fd, buf, sizeof(buf));
+  close(fd);
+}
+
+// Overwrite the file made by append() in place.
+void
+overwrite(int kb)
+{
+  int fd, i;
+
+  if((fd = open(FILENAME, O_RDWR)) < 0){
+    printf(2, "logbench: cannot open %s\n", FILENAME);
+    exit();
+  }
+  for(i = 0; i < 2*kb; i++)
+    write(fd, buf, sizeof(buf));
+  close(fd);
+}
+
+// Create and remove a directory n times.
+void
+mkdirs(int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++){
+    mkdir("logbench.d");
+    unlink("logbench.d");
+  }
+}
+
+void
+report(char *name, struct logstat *a, struct logstat *b, int t)
+{
+  uint logged, installed, heads, direct;
+
+  logged = b->logged - a->logged;
+  installed = b->installed - a->installed;
+  heads = b->heads - a->heads;
+  direct = b->direct - a->direct;
+  printf(1, "%s: %d commits, %d logged, %d installed, %d headers, "
+         "%d direct: %d block writes in %d ticks\n",
+         name, b->commits - a->commits, logged, installed, heads,
+         direct, logged + installed + heads + direct, t);
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct logstat a, b;
+  int kb, t;
+
+  kb = argc > 1 ? atoi(argv[1]) : 32;
+  memset(buf, 'l', sizeof(buf));
+
+  logstat(&a);
+  t = uptime();
+  append(kb);
+  t = uptime() - t;
+  logstat(&b);
+  report("append", &a, &b, t);
+
+  a = b;
+  t = uptime();
+  overwrite(kb);
+  t = uptime() - t;
+  logstat(&b);
+  report("overwrite", &a, &b, t);
+
+  a = b;
+  t = uptime();
+  mkdirs(20);
+  t = uptime() - t;
+  logstat(&b);
+  report("mkdir/unlink", &a, &b, t);
+
+  unlink(FILENAME);
+  exit();
+}
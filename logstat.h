@@ -0,0 +1,8 @@
+// Log traffic counters, returned by the logstat system call.
+struct logstat {
+  uint commits;    // transactions committed
+  uint logged;     // blocks written to the log
+  uint installed;  // blocks written home from the log
+  uint heads;      // log header writes
+  uint direct;     // file data blocks written around the log
+};
@@ -0,0 +1,2251 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	bb 01 00 00 00       	mov    $0x1,%ebx
+      15:	51                   	push   %ecx
+      16:	83 ec 08             	sub    $0x8,%esp
+      19:	8b 31                	mov    (%ecx),%esi
+      1b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+      1e:	83 fe 01             	cmp    $0x1,%esi
+      21:	7e 1f                	jle    42 <main+0x42>
+      23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      27:	90                   	nop
+    ls(".");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+    ls(argv[i]);
+      28:	83 ec 0c             	sub    $0xc,%esp
+      2b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i=1; i<argc; i++)
+      2e:	83 c3 01             	add    $0x1,%ebx
+    ls(argv[i]);
+      31:	e8 ca 00 00 00       	call   100 <ls>
+  for(i=1; i<argc; i++)
+      36:	83 c4 10             	add    $0x10,%esp
+      39:	39 de                	cmp    %ebx,%esi
+      3b:	75 eb                	jne    28 <main+0x28>
+  exit();
+      3d:	e8 8e 05 00 00       	call   5d0 <exit>
+    ls(".");
+      42:	83 ec 0c             	sub    $0xc,%esp
+      45:	68 78 11 00 00       	push   $0x1178
+      4a:	e8 b1 00 00 00       	call   100 <ls>
+    exit();
+      4f:	e8 7c 05 00 00       	call   5d0 <exit>
+      54:	66 90                	xchg   %ax,%ax
+      56:	66 90                	xchg   %ax,%ax
+      58:	66 90                	xchg   %ax,%ax
+      5a:	66 90                	xchg   %ax,%ax
+      5c:	66 90                	xchg   %ax,%ax
+      5e:	66 90                	xchg   %ax,%ax
+
+00000060 <fmtname>:
+{
+      60:	55                   	push   %ebp
+      61:	89 e5                	mov    %esp,%ebp
+      63:	56                   	push   %esi
+      64:	53                   	push   %ebx
+      65:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+      68:	83 ec 0c             	sub    $0xc,%esp
+      6b:	56                   	push   %esi
+      6c:	e8 cf 06 00 00       	call   740 <strlen>
+      71:	83 c4 10             	add    $0x10,%esp
+      74:	01 f0                	add    %esi,%eax
+      76:	89 c3                	mov    %eax,%ebx
+      78:	73 0f                	jae    89 <fmtname+0x29>
+      7a:	eb 12                	jmp    8e <fmtname+0x2e>
+      7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      80:	8d 43 ff             	lea    -0x1(%ebx),%eax
+      83:	39 f0                	cmp    %esi,%eax
+      85:	72 0a                	jb     91 <fmtname+0x31>
+      87:	89 c3                	mov    %eax,%ebx
+      89:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+      8c:	75 f2                	jne    80 <fmtname+0x20>
+  p++;
+      8e:	83 c3 01             	add    $0x1,%ebx
+  if(strlen(p) >= DIRSIZ)
+      91:	83 ec 0c             	sub    $0xc,%esp
+      94:	53                   	push   %ebx
+      95:	e8 a6 06 00 00       	call   740 <strlen>
+      9a:	83 c4 10             	add    $0x10,%esp
+      9d:	83 f8 0d             	cmp    $0xd,%eax
+      a0:	77 4a                	ja     ec <fmtname+0x8c>
+  memmove(buf, p, strlen(p));
+      a2:	83 ec 0c             	sub    $0xc,%esp
+      a5:	53                   	push   %ebx
+      a6:	e8 95 06 00 00       	call   740 <strlen>
+      ab:	83 c4 0c             	add    $0xc,%esp
+      ae:	50                   	push   %eax
+      af:	53                   	push   %ebx
+      b0:	68 00 17 00 00       	push   $0x1700
+      b5:	e8 b6 08 00 00       	call   970 <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+      ba:	89 1c 24             	mov    %ebx,(%esp)
+      bd:	e8 7e 06 00 00       	call   740 <strlen>
+      c2:	89 1c 24             	mov    %ebx,(%esp)
+  return buf;
+      c5:	bb 00 17 00 00       	mov    $0x1700,%ebx
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+      ca:	89 c6                	mov    %eax,%esi
+      cc:	e8 6f 06 00 00       	call   740 <strlen>
+      d1:	ba 0e 00 00 00       	mov    $0xe,%edx
+      d6:	83 c4 0c             	add    $0xc,%esp
+      d9:	29 f2                	sub    %esi,%edx
+      db:	05 00 17 00 00       	add    $0x1700,%eax
+      e0:	52                   	push   %edx
+      e1:	6a 20                	push   $0x20
+      e3:	50                   	push   %eax
+      e4:	e8 87 06 00 00       	call   770 <memset>
+  return buf;
+      e9:	83 c4 10             	add    $0x10,%esp
+}
+      ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      ef:	89 d8                	mov    %ebx,%eax
+      f1:	5b                   	pop    %ebx
+      f2:	5e                   	pop    %esi
+      f3:	5d                   	pop    %ebp
+      f4:	c3                   	ret
+      f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000100 <ls>:
+{
+     100:	55                   	push   %ebp
+     101:	89 e5                	mov    %esp,%ebp
+     103:	57                   	push   %edi
+     104:	56                   	push   %esi
+     105:	53                   	push   %ebx
+     106:	81 ec 64 02 00 00    	sub    $0x264,%esp
+     10c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if((fd = open(path, 0)) < 0){
+     10f:	6a 00                	push   $0x0
+     111:	57                   	push   %edi
+     112:	e8 02 09 00 00       	call   a19 <open>
+     117:	83 c4 10             	add    $0x10,%esp
+     11a:	85 c0                	test   %eax,%eax
+     11c:	0f 88 9e 01 00 00    	js     2c0 <ls+0x1c0>
+  if(fstat(fd, &st) < 0){
+     122:	83 ec 08             	sub    $0x8,%esp
+     125:	8d b5 d4 fd ff ff    	lea    -0x22c(%ebp),%esi
+     12b:	89 c3                	mov    %eax,%ebx
+     12d:	56                   	push   %esi
+     12e:	50                   	push   %eax
+     12f:	e8 03 09 00 00       	call   a37 <fstat>
+     134:	83 c4 10             	add    $0x10,%esp
+     137:	85 c0                	test   %eax,%eax
+     139:	0f 88 c1 01 00 00    	js     300 <ls+0x200>
+  switch(st.type){
+     13f:	0f b7 85 d4 fd ff ff 	movzwl -0x22c(%ebp),%eax
+     146:	66 83 f8 01          	cmp    $0x1,%ax
+     14a:	74 64                	je     1b0 <ls+0xb0>
+     14c:	66 83 f8 02          	cmp    $0x2,%ax
+     150:	74 1e                	je     170 <ls+0x70>
+  close(fd);
+     152:	83 ec 0c             	sub    $0xc,%esp
+     155:	53                   	push   %ebx
+     156:	e8 e5 04 00 00       	call   640 <close>
+     15b:	83 c4 10             	add    $0x10,%esp
+}
+     15e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     161:	5b                   	pop    %ebx
+     162:	5e                   	pop    %esi
+     163:	5f                   	pop    %edi
+     164:	5d                   	pop    %ebp
+     165:	c3                   	ret
+     166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     16d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+     170:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+     176:	83 ec 0c             	sub    $0xc,%esp
+     179:	8b b5 dc fd ff ff    	mov    -0x224(%ebp),%esi
+     17f:	89 95 b4 fd ff ff    	mov    %edx,-0x24c(%ebp)
+     185:	57                   	push   %edi
+     186:	e8 d5 fe ff ff       	call   60 <fmtname>
+     18b:	8b 95 b4 fd ff ff    	mov    -0x24c(%ebp),%edx
+     191:	59                   	pop    %ecx
+     192:	5f                   	pop    %edi
+     193:	52                   	push   %edx
+     194:	56                   	push   %esi
+     195:	6a 02                	push   $0x2
+     197:	50                   	push   %eax
+     198:	68 58 11 00 00       	push   $0x1158
+     19d:	6a 01                	push   $0x1
+     19f:	e8 dc 0a 00 00       	call   c80 <printf>
+    break;
+     1a4:	83 c4 20             	add    $0x20,%esp
+     1a7:	eb a9                	jmp    152 <ls+0x52>
+     1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+     1b0:	83 ec 0c             	sub    $0xc,%esp
+     1b3:	57                   	push   %edi
+     1b4:	e8 87 05 00 00       	call   740 <strlen>
+     1b9:	83 c4 10             	add    $0x10,%esp
+     1bc:	83 c0 10             	add    $0x10,%eax
+     1bf:	3d 00 02 00 00       	cmp    $0x200,%eax
+     1c4:	0f 87 16 01 00 00    	ja     2e0 <ls+0x1e0>
+    strcpy(buf, path);
+     1ca:	83 ec 08             	sub    $0x8,%esp
+     1cd:	57                   	push   %edi
+     1ce:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+     1d4:	57                   	push   %edi
+     1d5:	e8 d6 04 00 00       	call   6b0 <strcpy>
+    p = buf+strlen(buf);
+     1da:	89 3c 24             	mov    %edi,(%esp)
+     1dd:	e8 5e 05 00 00       	call   740 <strlen>
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+     1e2:	83 c4 10             	add    $0x10,%esp
+    p = buf+strlen(buf);
+     1e5:	01 f8                	add    %edi,%eax
+    *p++ = '/';
+     1e7:	8d 48 01             	lea    0x1(%eax),%ecx
+    p = buf+strlen(buf);
+     1ea:	89 85 a8 fd ff ff    	mov    %eax,-0x258(%ebp)
+    *p++ = '/';
+     1f0:	89 8d a4 fd ff ff    	mov    %ecx,-0x25c(%ebp)
+     1f6:	c6 00 2f             	movb   $0x2f,(%eax)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+     1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     200:	83 ec 04             	sub    $0x4,%esp
+     203:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+     209:	6a 10                	push   $0x10
+     20b:	50                   	push   %eax
+     20c:	53                   	push   %ebx
+     20d:	e8 e4 07 00 00       	call   9f6 <read>
+     212:	83 c4 10             	add    $0x10,%esp
+     215:	83 f8 10             	cmp    $0x10,%eax
+     218:	0f 85 34 ff ff ff    	jne    152 <ls+0x52>
+      if(de.inum == 0)
+     21e:	66 83 bd c4 fd ff ff 	cmpw   $0x0,-0x23c(%ebp)
+     225:	00 
+     226:	74 d8                	je     200 <ls+0x100>
+      memmove(p, de.name, DIRSIZ);
+     228:	83 ec 04             	sub    $0x4,%esp
+     22b:	8d 85 c6 fd ff ff    	lea    -0x23a(%ebp),%eax
+     231:	6a 0e                	push   $0xe
+     233:	50                   	push   %eax
+     234:	ff b5 a4 fd ff ff    	push   -0x25c(%ebp)
+     23a:	e8 31 07 00 00       	call   970 <memmove>
+      p[DIRSIZ] = 0;
+     23f:	8b 85 a8 fd ff ff    	mov    -0x258(%ebp),%eax
+     245:	c6 40 0f 00          	movb   $0x0,0xf(%eax)
+      if(stat(buf, &st) < 0){
+     249:	58                   	pop    %eax
+     24a:	5a                   	pop    %edx
+     24b:	56                   	push   %esi
+     24c:	57                   	push   %edi
+     24d:	e8 3e 06 00 00       	call   890 <stat>
+     252:	83 c4 10             	add    $0x10,%esp
+     255:	85 c0                	test   %eax,%eax
+     257:	0f 88 cb 00 00 00    	js     328 <ls+0x228>
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+     25d:	8b 8d e4 fd ff ff    	mov    -0x21c(%ebp),%ecx
+     263:	8b 95 dc fd ff ff    	mov    -0x224(%ebp),%edx
+     269:	83 ec 0c             	sub    $0xc,%esp
+     26c:	0f bf 85 d4 fd ff ff 	movswl -0x22c(%ebp),%eax
+     273:	89 8d ac fd ff ff    	mov    %ecx,-0x254(%ebp)
+     279:	89 95 b0 fd ff ff    	mov    %edx,-0x250(%ebp)
+     27f:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+     285:	57                   	push   %edi
+     286:	e8 d5 fd ff ff       	call   60 <fmtname>
+     28b:	5a                   	pop    %edx
+     28c:	59                   	pop    %ecx
+     28d:	8b 8d ac fd ff ff    	mov    -0x254(%ebp),%ecx
+     293:	51                   	push   %ecx
+     294:	8b 95 b0 fd ff ff    	mov    -0x250(%ebp),%edx
+     29a:	52                   	push   %edx
+     29b:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+     2a1:	50                   	push   %eax
+     2a2:	68 58 11 00 00       	push   $0x1158
+     2a7:	6a 01                	push   $0x1
+     2a9:	e8 d2 09 00 00       	call   c80 <printf>
+     2ae:	83 c4 20             	add    $0x20,%esp
+     2b1:	e9 4a ff ff ff       	jmp    200 <ls+0x100>
+     2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2bd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(2, "ls: cannot open %s\n", path);
+     2c0:	83 ec 04             	sub    $0x4,%esp
+     2c3:	57                   	push   %edi
+     2c4:	68 30 11 00 00       	push   $0x1130
+     2c9:	6a 02                	push   $0x2
+     2cb:	e8 b0 09 00 00       	call   c80 <printf>
+    return;
+     2d0:	83 c4 10             	add    $0x10,%esp
+}
+     2d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     2d6:	5b                   	pop    %ebx
+     2d7:	5e                   	pop    %esi
+     2d8:	5f                   	pop    %edi
+     2d9:	5d                   	pop    %ebp
+     2da:	c3                   	ret
+     2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2df:	90                   	nop
+      printf(1, "ls: path too long\n");
+     2e0:	83 ec 08             	sub    $0x8,%esp
+     2e3:	68 65 11 00 00       	push   $0x1165
+     2e8:	6a 01                	push   $0x1
+     2ea:	e8 91 09 00 00       	call   c80 <printf>
+      break;
+     2ef:	83 c4 10             	add    $0x10,%esp
+     2f2:	e9 5b fe ff ff       	jmp    152 <ls+0x52>
+     2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2fe:	66 90                	xchg   %ax,%ax
+    printf(2, "ls: cannot stat %s\n", path);
+     300:	83 ec 04             	sub    $0x4,%esp
+     303:	57                   	push   %edi
+     304:	68 44 11 00 00       	push   $0x1144
+     309:	6a 02                	push   $0x2
+     30b:	e8 70 09 00 00       	call   c80 <printf>
+    close(fd);
+     310:	89 1c 24             	mov    %ebx,(%esp)
+     313:	e8 28 03 00 00       	call   640 <close>
+    return;
+     318:	83 c4 10             	add    $0x10,%esp
+}
+     31b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     31e:	5b                   	pop    %ebx
+     31f:	5e                   	pop    %esi
+     320:	5f                   	pop    %edi
+     321:	5d                   	pop    %ebp
+     322:	c3                   	ret
+     323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     327:	90                   	nop
+        printf(1, "ls: cannot stat %s\n", buf);
+     328:	83 ec 04             	sub    $0x4,%esp
+     32b:	57                   	push   %edi
+     32c:	68 44 11 00 00       	push   $0x1144
+     331:	6a 01                	push   $0x1
+     333:	e8 48 09 00 00       	call   c80 <printf>
+        continue;
+     338:	83 c4 10             	add    $0x10,%esp
+     33b:	e9 c0 fe ff ff       	jmp    200 <ls+0x100>
+
+00000340 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+     340:	55                   	push   %ebp
+     341:	89 e5                	mov    %esp,%ebp
+     343:	57                   	push   %edi
+     344:	56                   	push   %esi
+     345:	53                   	push   %ebx
+     346:	83 ec 4c             	sub    $0x4c,%esp
+     349:	8b 45 0c             	mov    0xc(%ebp),%eax
+     34c:	8b 55 08             	mov    0x8(%ebp),%edx
+     34f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     352:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+     355:	83 fa 0f             	cmp    $0xf,%edx
+     358:	0f 87 32 01 00 00    	ja     490 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+     35e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     364:	8b 80 20 17 00 00    	mov    0x1720(%eax),%eax
+     36a:	85 c0                	test   %eax,%eax
+     36c:	0f 84 de 00 00 00    	je     450 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+     372:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     378:	8b b0 24 17 00 00    	mov    0x1724(%eax),%esi
+     37e:	8d 88 20 17 00 00    	lea    0x1720(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+     384:	8d b8 28 17 00 00    	lea    0x1728(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+     38a:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+     38d:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+     390:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+     393:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+     399:	0f 8f 01 01 00 00    	jg     4a0 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+     39f:	8d 78 08             	lea    0x8(%eax),%edi
+     3a2:	8d bc 3e 20 17 00 00 	lea    0x1720(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     3a9:	85 db                	test   %ebx,%ebx
+     3ab:	7e 3b                	jle    3e8 <bufwrite+0xa8>
+     3ad:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+     3b0:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+     3b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3b7:	90                   	nop
+    *dst++ = *src++;
+     3b8:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     3b9:	39 c6                	cmp    %eax,%esi
+     3bb:	75 fb                	jne    3b8 <bufwrite+0x78>
+  ob[fd].n += n;
+     3bd:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     3c3:	8b 88 24 17 00 00    	mov    0x1724(%eax),%ecx
+     3c9:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     3cb:	83 b8 20 17 00 00 01 	cmpl   $0x1,0x1720(%eax)
+  ob[fd].n += n;
+     3d2:	89 88 24 17 00 00    	mov    %ecx,0x1724(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     3d8:	74 26                	je     400 <bufwrite+0xc0>
+}
+     3da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     3dd:	5b                   	pop    %ebx
+     3de:	5e                   	pop    %esi
+     3df:	5f                   	pop    %edi
+     3e0:	5d                   	pop    %ebp
+     3e1:	c3                   	ret
+     3e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+     3e8:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     3eb:	83 b8 20 17 00 00 01 	cmpl   $0x1,0x1720(%eax)
+  ob[fd].n += n;
+     3f2:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     3f5:	75 e3                	jne    3da <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+     3f7:	85 db                	test   %ebx,%ebx
+     3f9:	74 df                	je     3da <bufwrite+0x9a>
+     3fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3ff:	90                   	nop
+  src = vsrc;
+     400:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     403:	01 c3                	add    %eax,%ebx
+     405:	eb 10                	jmp    417 <bufwrite+0xd7>
+     407:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     40e:	66 90                	xchg   %ax,%ax
+     410:	83 c0 01             	add    $0x1,%eax
+     413:	39 d8                	cmp    %ebx,%eax
+     415:	74 c3                	je     3da <bufwrite+0x9a>
+    if(*p == (char)c)
+     417:	80 38 0a             	cmpb   $0xa,(%eax)
+     41a:	75 f4                	jne    410 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     41c:	85 c9                	test   %ecx,%ecx
+     41e:	7e ba                	jle    3da <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+     420:	83 ec 04             	sub    $0x4,%esp
+     423:	51                   	push   %ecx
+     424:	ff 75 ac             	push   -0x54(%ebp)
+     427:	52                   	push   %edx
+     428:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+     42b:	e8 cd 05 00 00       	call   9fd <write>
+    ob[fd].n = 0;
+     430:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     433:	83 c4 10             	add    $0x10,%esp
+     436:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+     43c:	c7 82 24 17 00 00 00 	movl   $0x0,0x1724(%edx)
+     443:	00 00 00 
+     446:	eb 92                	jmp    3da <bufwrite+0x9a>
+     448:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     44f:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     450:	83 ec 08             	sub    $0x8,%esp
+     453:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     456:	50                   	push   %eax
+     457:	52                   	push   %edx
+     458:	89 55 b0             	mov    %edx,-0x50(%ebp)
+     45b:	e8 d7 05 00 00       	call   a37 <fstat>
+     460:	83 c4 10             	add    $0x10,%esp
+     463:	8b 55 b0             	mov    -0x50(%ebp),%edx
+     466:	89 c1                	mov    %eax,%ecx
+     468:	b8 02 00 00 00       	mov    $0x2,%eax
+     46d:	85 c9                	test   %ecx,%ecx
+     46f:	75 0d                	jne    47e <bufwrite+0x13e>
+     471:	31 c0                	xor    %eax,%eax
+     473:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     478:	0f 95 c0             	setne  %al
+     47b:	83 c0 01             	add    $0x1,%eax
+     47e:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+     484:	89 81 20 17 00 00    	mov    %eax,0x1720(%ecx)
+     48a:	e9 e3 fe ff ff       	jmp    372 <bufwrite+0x32>
+     48f:	90                   	nop
+}
+     490:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     493:	5b                   	pop    %ebx
+     494:	5e                   	pop    %esi
+     495:	5f                   	pop    %edi
+     496:	5d                   	pop    %ebp
+    write(fd, p, n);
+     497:	e9 61 05 00 00       	jmp    9fd <write>
+     49c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+     4a0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+     4a3:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+     4a6:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+     4a9:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+     4ac:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+     4af:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+     4b2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+     4b5:	6a 02                	push   $0x2
+     4b7:	50                   	push   %eax
+     4b8:	52                   	push   %edx
+     4b9:	e8 9b 06 00 00       	call   b59 <writev>
+    ob[fd].n = 0;
+     4be:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+     4c1:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+     4c4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+     4cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4ce:	5b                   	pop    %ebx
+     4cf:	5e                   	pop    %esi
+     4d0:	5f                   	pop    %edi
+     4d1:	5d                   	pop    %ebp
+     4d2:	c3                   	ret
+     4d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000004e0 <fflush>:
+{
+     4e0:	55                   	push   %ebp
+     4e1:	89 e5                	mov    %esp,%ebp
+     4e3:	53                   	push   %ebx
+     4e4:	83 ec 04             	sub    $0x4,%esp
+     4e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     4ea:	83 f8 0f             	cmp    $0xf,%eax
+     4ed:	77 16                	ja     505 <fflush+0x25>
+     4ef:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+     4f5:	8b 8a 24 17 00 00    	mov    0x1724(%edx),%ecx
+     4fb:	8d 9a 20 17 00 00    	lea    0x1720(%edx),%ebx
+     501:	85 c9                	test   %ecx,%ecx
+     503:	7f 0b                	jg     510 <fflush+0x30>
+}
+     505:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     508:	c9                   	leave
+     509:	c3                   	ret
+     50a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     510:	83 ec 04             	sub    $0x4,%esp
+     513:	81 c2 28 17 00 00    	add    $0x1728,%edx
+     519:	51                   	push   %ecx
+     51a:	52                   	push   %edx
+     51b:	50                   	push   %eax
+     51c:	e8 dc 04 00 00       	call   9fd <write>
+    ob[fd].n = 0;
+     521:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     528:	83 c4 10             	add    $0x10,%esp
+}
+     52b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     52e:	c9                   	leave
+     52f:	c3                   	ret
+
+00000530 <fflushall>:
+{
+     530:	55                   	push   %ebp
+     531:	89 e5                	mov    %esp,%ebp
+     533:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     534:	31 f6                	xor    %esi,%esi
+{
+     536:	53                   	push   %ebx
+     537:	bb 28 17 00 00       	mov    $0x1728,%ebx
+     53c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     540:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     543:	85 c0                	test   %eax,%eax
+     545:	7e 15                	jle    55c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     547:	83 ec 04             	sub    $0x4,%esp
+     54a:	50                   	push   %eax
+     54b:	53                   	push   %ebx
+     54c:	56                   	push   %esi
+     54d:	e8 ab 04 00 00       	call   9fd <write>
+    ob[fd].n = 0;
+     552:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     559:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     55c:	83 c6 01             	add    $0x1,%esi
+     55f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     565:	83 fe 10             	cmp    $0x10,%esi
+     568:	75 d6                	jne    540 <fflushall+0x10>
+}
+     56a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     56d:	5b                   	pop    %ebx
+     56e:	5e                   	pop    %esi
+     56f:	5d                   	pop    %ebp
+     570:	c3                   	ret
+     571:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     578:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     57f:	90                   	nop
+
+00000580 <fork>:
+{
+     580:	55                   	push   %ebp
+     581:	89 e5                	mov    %esp,%ebp
+     583:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     584:	31 f6                	xor    %esi,%esi
+{
+     586:	53                   	push   %ebx
+     587:	bb 28 17 00 00       	mov    $0x1728,%ebx
+     58c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     590:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     593:	85 c0                	test   %eax,%eax
+     595:	7e 15                	jle    5ac <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     597:	83 ec 04             	sub    $0x4,%esp
+     59a:	50                   	push   %eax
+     59b:	53                   	push   %ebx
+     59c:	56                   	push   %esi
+     59d:	e8 5b 04 00 00       	call   9fd <write>
+    ob[fd].n = 0;
+     5a2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     5a9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     5ac:	83 c6 01             	add    $0x1,%esi
+     5af:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     5b5:	83 fe 10             	cmp    $0x10,%esi
+     5b8:	75 d6                	jne    590 <fork+0x10>
+}
+     5ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5bd:	5b                   	pop    %ebx
+     5be:	5e                   	pop    %esi
+     5bf:	5d                   	pop    %ebp
+  return _fork();
+     5c0:	e9 15 04 00 00       	jmp    9da <_fork>
+     5c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005d0 <exit>:
+{
+     5d0:	55                   	push   %ebp
+     5d1:	89 e5                	mov    %esp,%ebp
+     5d3:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+     5d6:	e8 55 ff ff ff       	call   530 <fflushall>
+  _exit();
+     5db:	e8 01 04 00 00       	call   9e1 <_exit>
+
+000005e0 <exec>:
+{
+     5e0:	55                   	push   %ebp
+     5e1:	89 e5                	mov    %esp,%ebp
+     5e3:	57                   	push   %edi
+     5e4:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     5e5:	31 f6                	xor    %esi,%esi
+{
+     5e7:	53                   	push   %ebx
+     5e8:	bb 28 17 00 00       	mov    $0x1728,%ebx
+     5ed:	83 ec 1c             	sub    $0x1c,%esp
+     5f0:	8b 45 08             	mov    0x8(%ebp),%eax
+     5f3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     5f6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     5f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     600:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     603:	85 c0                	test   %eax,%eax
+     605:	7e 15                	jle    61c <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     607:	83 ec 04             	sub    $0x4,%esp
+     60a:	50                   	push   %eax
+     60b:	53                   	push   %ebx
+     60c:	56                   	push   %esi
+     60d:	e8 eb 03 00 00       	call   9fd <write>
+    ob[fd].n = 0;
+     612:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     619:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     61c:	83 c6 01             	add    $0x1,%esi
+     61f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     625:	83 fe 10             	cmp    $0x10,%esi
+     628:	75 d6                	jne    600 <exec+0x20>
+  return _exec(path, argv);
+     62a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     62d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+     630:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     633:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     636:	5b                   	pop    %ebx
+     637:	5e                   	pop    %esi
+     638:	5f                   	pop    %edi
+     639:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     63a:	e9 d3 03 00 00       	jmp    a12 <_exec>
+     63f:	90                   	nop
+
+00000640 <close>:
+{
+     640:	55                   	push   %ebp
+     641:	89 e5                	mov    %esp,%ebp
+     643:	56                   	push   %esi
+     644:	53                   	push   %ebx
+     645:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     648:	83 fb 0f             	cmp    $0xf,%ebx
+     64b:	77 26                	ja     673 <close+0x33>
+     64d:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     653:	8b 90 24 17 00 00    	mov    0x1724(%eax),%edx
+     659:	8d b0 20 17 00 00    	lea    0x1720(%eax),%esi
+     65f:	85 d2                	test   %edx,%edx
+     661:	7f 25                	jg     688 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+     663:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     669:	c7 80 20 17 00 00 00 	movl   $0x0,0x1720(%eax)
+     670:	00 00 00 
+  return _close(fd);
+     673:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     676:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     679:	5b                   	pop    %ebx
+     67a:	5e                   	pop    %esi
+     67b:	5d                   	pop    %ebp
+  return _close(fd);
+     67c:	e9 83 03 00 00       	jmp    a04 <_close>
+     681:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     688:	83 ec 04             	sub    $0x4,%esp
+     68b:	05 28 17 00 00       	add    $0x1728,%eax
+     690:	52                   	push   %edx
+     691:	50                   	push   %eax
+     692:	53                   	push   %ebx
+     693:	e8 65 03 00 00       	call   9fd <write>
+    ob[fd].n = 0;
+     698:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+     69f:	83 c4 10             	add    $0x10,%esp
+     6a2:	eb bf                	jmp    663 <close+0x23>
+     6a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6af:	90                   	nop
+
+000006b0 <strcpy>:
+{
+     6b0:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+     6b1:	31 c0                	xor    %eax,%eax
+{
+     6b3:	89 e5                	mov    %esp,%ebp
+     6b5:	53                   	push   %ebx
+     6b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     6b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     6bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     6c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     6c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     6c7:	83 c0 01             	add    $0x1,%eax
+     6ca:	84 d2                	test   %dl,%dl
+     6cc:	75 f2                	jne    6c0 <strcpy+0x10>
+}
+     6ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6d1:	89 c8                	mov    %ecx,%eax
+     6d3:	c9                   	leave
+     6d4:	c3                   	ret
+     6d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006e0 <strcmp>:
+{
+     6e0:	55                   	push   %ebp
+     6e1:	89 e5                	mov    %esp,%ebp
+     6e3:	53                   	push   %ebx
+     6e4:	8b 55 08             	mov    0x8(%ebp),%edx
+     6e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     6ea:	0f b6 02             	movzbl (%edx),%eax
+     6ed:	84 c0                	test   %al,%al
+     6ef:	75 17                	jne    708 <strcmp+0x28>
+     6f1:	eb 3a                	jmp    72d <strcmp+0x4d>
+     6f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6f7:	90                   	nop
+     6f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     6fc:	83 c2 01             	add    $0x1,%edx
+     6ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     702:	84 c0                	test   %al,%al
+     704:	74 1a                	je     720 <strcmp+0x40>
+    p++, q++;
+     706:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     708:	0f b6 19             	movzbl (%ecx),%ebx
+     70b:	38 c3                	cmp    %al,%bl
+     70d:	74 e9                	je     6f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     70f:	29 d8                	sub    %ebx,%eax
+}
+     711:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     714:	c9                   	leave
+     715:	c3                   	ret
+     716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     71d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     720:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     724:	31 c0                	xor    %eax,%eax
+     726:	29 d8                	sub    %ebx,%eax
+}
+     728:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     72b:	c9                   	leave
+     72c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     72d:	0f b6 19             	movzbl (%ecx),%ebx
+     730:	31 c0                	xor    %eax,%eax
+     732:	eb db                	jmp    70f <strcmp+0x2f>
+     734:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     73b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     73f:	90                   	nop
+
+00000740 <strlen>:
+{
+     740:	55                   	push   %ebp
+     741:	89 e5                	mov    %esp,%ebp
+     743:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+     746:	80 3a 00             	cmpb   $0x0,(%edx)
+     749:	74 15                	je     760 <strlen+0x20>
+     74b:	31 c0                	xor    %eax,%eax
+     74d:	8d 76 00             	lea    0x0(%esi),%esi
+     750:	83 c0 01             	add    $0x1,%eax
+     753:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     757:	89 c1                	mov    %eax,%ecx
+     759:	75 f5                	jne    750 <strlen+0x10>
+}
+     75b:	89 c8                	mov    %ecx,%eax
+     75d:	5d                   	pop    %ebp
+     75e:	c3                   	ret
+     75f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     760:	31 c9                	xor    %ecx,%ecx
+}
+     762:	5d                   	pop    %ebp
+     763:	89 c8                	mov    %ecx,%eax
+     765:	c3                   	ret
+     766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     76d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000770 <memset>:
+{
+     770:	55                   	push   %ebp
+     771:	89 e5                	mov    %esp,%ebp
+     773:	57                   	push   %edi
+     774:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     777:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     77a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     77d:	89 d7                	mov    %edx,%edi
+     77f:	fc                   	cld
+     780:	f3 aa                	rep stos %al,%es:(%edi)
+}
+     782:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     785:	89 d0                	mov    %edx,%eax
+     787:	c9                   	leave
+     788:	c3                   	ret
+     789:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000790 <strchr>:
+{
+     790:	55                   	push   %ebp
+     791:	89 e5                	mov    %esp,%ebp
+     793:	8b 45 08             	mov    0x8(%ebp),%eax
+     796:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     79a:	0f b6 10             	movzbl (%eax),%edx
+     79d:	84 d2                	test   %dl,%dl
+     79f:	75 12                	jne    7b3 <strchr+0x23>
+     7a1:	eb 1d                	jmp    7c0 <strchr+0x30>
+     7a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7a7:	90                   	nop
+     7a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     7ac:	83 c0 01             	add    $0x1,%eax
+     7af:	84 d2                	test   %dl,%dl
+     7b1:	74 0d                	je     7c0 <strchr+0x30>
+    if(*s == c)
+     7b3:	38 d1                	cmp    %dl,%cl
+     7b5:	75 f1                	jne    7a8 <strchr+0x18>
+}
+     7b7:	5d                   	pop    %ebp
+     7b8:	c3                   	ret
+     7b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     7c0:	31 c0                	xor    %eax,%eax
+}
+     7c2:	5d                   	pop    %ebp
+     7c3:	c3                   	ret
+     7c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7cf:	90                   	nop
+
+000007d0 <memchr>:
+{
+     7d0:	55                   	push   %ebp
+     7d1:	89 e5                	mov    %esp,%ebp
+     7d3:	8b 55 10             	mov    0x10(%ebp),%edx
+     7d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     7d9:	85 d2                	test   %edx,%edx
+     7db:	74 1b                	je     7f8 <memchr+0x28>
+    if(*p == (char)c)
+     7dd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+     7e1:	01 c2                	add    %eax,%edx
+     7e3:	eb 0a                	jmp    7ef <memchr+0x1f>
+     7e5:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+     7e8:	83 c0 01             	add    $0x1,%eax
+     7eb:	39 c2                	cmp    %eax,%edx
+     7ed:	74 09                	je     7f8 <memchr+0x28>
+    if(*p == (char)c)
+     7ef:	38 08                	cmp    %cl,(%eax)
+     7f1:	75 f5                	jne    7e8 <memchr+0x18>
+}
+     7f3:	5d                   	pop    %ebp
+     7f4:	c3                   	ret
+     7f5:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+     7f8:	31 c0                	xor    %eax,%eax
+}
+     7fa:	5d                   	pop    %ebp
+     7fb:	c3                   	ret
+     7fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000800 <gets>:
+{
+     800:	55                   	push   %ebp
+     801:	89 e5                	mov    %esp,%ebp
+     803:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+     804:	31 ff                	xor    %edi,%edi
+{
+     806:	56                   	push   %esi
+     807:	be 28 17 00 00       	mov    $0x1728,%esi
+     80c:	53                   	push   %ebx
+     80d:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     810:	8b 46 fc             	mov    -0x4(%esi),%eax
+     813:	85 c0                	test   %eax,%eax
+     815:	7e 15                	jle    82c <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     817:	83 ec 04             	sub    $0x4,%esp
+     81a:	50                   	push   %eax
+     81b:	56                   	push   %esi
+     81c:	57                   	push   %edi
+     81d:	e8 db 01 00 00       	call   9fd <write>
+    ob[fd].n = 0;
+     822:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+     829:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     82c:	83 c7 01             	add    $0x1,%edi
+     82f:	81 c6 08 01 00 00    	add    $0x108,%esi
+     835:	83 ff 10             	cmp    $0x10,%edi
+     838:	75 d6                	jne    810 <gets+0x10>
+  for(i=0; i+1 < max; ){
+     83a:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+     83c:	8d 75 e7             	lea    -0x19(%ebp),%esi
+     83f:	eb 2e                	jmp    86f <gets+0x6f>
+     841:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     848:	83 ec 04             	sub    $0x4,%esp
+     84b:	6a 01                	push   $0x1
+     84d:	56                   	push   %esi
+     84e:	6a 00                	push   $0x0
+     850:	e8 a1 01 00 00       	call   9f6 <read>
+    if(cc < 1)
+     855:	83 c4 10             	add    $0x10,%esp
+     858:	85 c0                	test   %eax,%eax
+     85a:	7e 1d                	jle    879 <gets+0x79>
+    buf[i++] = c;
+     85c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     860:	8b 55 08             	mov    0x8(%ebp),%edx
+     863:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     867:	3c 0a                	cmp    $0xa,%al
+     869:	74 10                	je     87b <gets+0x7b>
+     86b:	3c 0d                	cmp    $0xd,%al
+     86d:	74 0c                	je     87b <gets+0x7b>
+  for(i=0; i+1 < max; ){
+     86f:	89 df                	mov    %ebx,%edi
+     871:	83 c3 01             	add    $0x1,%ebx
+     874:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     877:	7c cf                	jl     848 <gets+0x48>
+     879:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     87b:	8b 45 08             	mov    0x8(%ebp),%eax
+     87e:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     882:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     885:	5b                   	pop    %ebx
+     886:	5e                   	pop    %esi
+     887:	5f                   	pop    %edi
+     888:	5d                   	pop    %ebp
+     889:	c3                   	ret
+     88a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000890 <stat>:
+{
+     890:	55                   	push   %ebp
+     891:	89 e5                	mov    %esp,%ebp
+     893:	57                   	push   %edi
+     894:	56                   	push   %esi
+     895:	53                   	push   %ebx
+     896:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+     899:	6a 00                	push   $0x0
+     89b:	ff 75 08             	push   0x8(%ebp)
+     89e:	e8 76 01 00 00       	call   a19 <open>
+  if(fd < 0)
+     8a3:	83 c4 10             	add    $0x10,%esp
+     8a6:	85 c0                	test   %eax,%eax
+     8a8:	78 76                	js     920 <stat+0x90>
+  r = fstat(fd, st);
+     8aa:	83 ec 08             	sub    $0x8,%esp
+     8ad:	ff 75 0c             	push   0xc(%ebp)
+     8b0:	89 c3                	mov    %eax,%ebx
+     8b2:	50                   	push   %eax
+     8b3:	e8 7f 01 00 00       	call   a37 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     8b8:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     8bb:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     8bd:	83 fb 0f             	cmp    $0xf,%ebx
+     8c0:	7f 40                	jg     902 <stat+0x72>
+     8c2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     8c8:	8b 90 24 17 00 00    	mov    0x1724(%eax),%edx
+     8ce:	8d b8 20 17 00 00    	lea    0x1720(%eax),%edi
+     8d4:	85 d2                	test   %edx,%edx
+     8d6:	7e 1a                	jle    8f2 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+     8d8:	83 ec 04             	sub    $0x4,%esp
+     8db:	05 28 17 00 00       	add    $0x1728,%eax
+     8e0:	52                   	push   %edx
+     8e1:	50                   	push   %eax
+     8e2:	53                   	push   %ebx
+     8e3:	e8 15 01 00 00       	call   9fd <write>
+    ob[fd].n = 0;
+     8e8:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+     8ef:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+     8f2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     8f8:	c7 80 20 17 00 00 00 	movl   $0x0,0x1720(%eax)
+     8ff:	00 00 00 
+  return _close(fd);
+     902:	83 ec 0c             	sub    $0xc,%esp
+     905:	53                   	push   %ebx
+     906:	e8 f9 00 00 00       	call   a04 <_close>
+     90b:	83 c4 10             	add    $0x10,%esp
+}
+     90e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     911:	89 f0                	mov    %esi,%eax
+     913:	5b                   	pop    %ebx
+     914:	5e                   	pop    %esi
+     915:	5f                   	pop    %edi
+     916:	5d                   	pop    %ebp
+     917:	c3                   	ret
+     918:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     91f:	90                   	nop
+    return -1;
+     920:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     925:	eb e7                	jmp    90e <stat+0x7e>
+     927:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     92e:	66 90                	xchg   %ax,%ax
+
+00000930 <atoi>:
+{
+     930:	55                   	push   %ebp
+     931:	89 e5                	mov    %esp,%ebp
+     933:	53                   	push   %ebx
+     934:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     937:	0f be 02             	movsbl (%edx),%eax
+     93a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     93d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     940:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     945:	77 1e                	ja     965 <atoi+0x35>
+     947:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     94e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     950:	83 c2 01             	add    $0x1,%edx
+     953:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     956:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     95a:	0f be 02             	movsbl (%edx),%eax
+     95d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     960:	80 fb 09             	cmp    $0x9,%bl
+     963:	76 eb                	jbe    950 <atoi+0x20>
+}
+     965:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     968:	89 c8                	mov    %ecx,%eax
+     96a:	c9                   	leave
+     96b:	c3                   	ret
+     96c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000970 <memmove>:
+{
+     970:	55                   	push   %ebp
+     971:	89 e5                	mov    %esp,%ebp
+     973:	57                   	push   %edi
+     974:	56                   	push   %esi
+     975:	8b 45 10             	mov    0x10(%ebp),%eax
+     978:	8b 55 08             	mov    0x8(%ebp),%edx
+     97b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     97e:	85 c0                	test   %eax,%eax
+     980:	7e 13                	jle    995 <memmove+0x25>
+     982:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     984:	89 d7                	mov    %edx,%edi
+     986:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     98d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     990:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     991:	39 f8                	cmp    %edi,%eax
+     993:	75 fb                	jne    990 <memmove+0x20>
+  return vdst;
+}
+     995:	5e                   	pop    %esi
+     996:	89 d0                	mov    %edx,%eax
+     998:	5f                   	pop    %edi
+     999:	5d                   	pop    %ebp
+     99a:	c3                   	ret
+
+0000099b <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+     99b:	83 3d e8 16 00 00 00 	cmpl   $0x0,0x16e8
+  jle 1f
+     9a2:	7e 0a                	jle    9ae <syscallentry+0x13>
+  movl %esp, %ecx
+     9a4:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+     9a6:	ba ad 09 00 00       	mov    $0x9ad,%edx
+  sysenter
+     9ab:	0f 34                	sysenter
+2:
+  ret
+     9ad:	c3                   	ret
+1:
+  jl 3f
+     9ae:	7c 27                	jl     9d7 <syscallentry+0x3c>
+  pushal
+     9b0:	60                   	pusha
+  movl $1, %eax
+     9b1:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     9b6:	0f a2                	cpuid
+  movl $-1, sysentermode
+     9b8:	c7 05 e8 16 00 00 ff 	movl   $0xffffffff,0x16e8
+     9bf:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     9c2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+     9c8:	74 0a                	je     9d4 <syscallentry+0x39>
+  movl $1, sysentermode
+     9ca:	c7 05 e8 16 00 00 01 	movl   $0x1,0x16e8
+     9d1:	00 00 00 
+4:
+  popal
+     9d4:	61                   	popa
+  jmp syscallentry
+     9d5:	eb c4                	jmp    99b <syscallentry>
+3:
+  int $T_SYSCALL
+     9d7:	cd 40                	int    $0x40
+  ret
+     9d9:	c3                   	ret
+
+000009da <_fork>:
+
+SYSCALLAS(_fork, fork)
+     9da:	b8 01 00 00 00       	mov    $0x1,%eax
+     9df:	eb ba                	jmp    99b <syscallentry>
+
+000009e1 <_exit>:
+SYSCALLAS(_exit, exit)
+     9e1:	b8 02 00 00 00       	mov    $0x2,%eax
+     9e6:	eb b3                	jmp    99b <syscallentry>
+
+000009e8 <wait>:
+SYSCALL(wait)
+     9e8:	b8 03 00 00 00       	mov    $0x3,%eax
+     9ed:	eb ac                	jmp    99b <syscallentry>
+
+000009ef <pipe>:
+SYSCALL(pipe)
+     9ef:	b8 04 00 00 00       	mov    $0x4,%eax
+     9f4:	eb a5                	jmp    99b <syscallentry>
+
+000009f6 <read>:
+SYSCALL(read)
+     9f6:	b8 05 00 00 00       	mov    $0x5,%eax
+     9fb:	eb 9e                	jmp    99b <syscallentry>
+
+000009fd <write>:
+SYSCALL(write)
+     9fd:	b8 10 00 00 00       	mov    $0x10,%eax
+     a02:	eb 97                	jmp    99b <syscallentry>
+
+00000a04 <_close>:
+SYSCALLAS(_close, close)
+     a04:	b8 15 00 00 00       	mov    $0x15,%eax
+     a09:	eb 90                	jmp    99b <syscallentry>
+
+00000a0b <kill>:
+SYSCALL(kill)
+     a0b:	b8 06 00 00 00       	mov    $0x6,%eax
+     a10:	eb 89                	jmp    99b <syscallentry>
+
+00000a12 <_exec>:
+SYSCALLAS(_exec, exec)
+     a12:	b8 07 00 00 00       	mov    $0x7,%eax
+     a17:	eb 82                	jmp    99b <syscallentry>
+
+00000a19 <open>:
+SYSCALL(open)
+     a19:	b8 0f 00 00 00       	mov    $0xf,%eax
+     a1e:	e9 78 ff ff ff       	jmp    99b <syscallentry>
+
+00000a23 <mknod>:
+SYSCALL(mknod)
+     a23:	b8 11 00 00 00       	mov    $0x11,%eax
+     a28:	e9 6e ff ff ff       	jmp    99b <syscallentry>
+
+00000a2d <unlink>:
+SYSCALL(unlink)
+     a2d:	b8 12 00 00 00       	mov    $0x12,%eax
+     a32:	e9 64 ff ff ff       	jmp    99b <syscallentry>
+
+00000a37 <fstat>:
+SYSCALL(fstat)
+     a37:	b8 08 00 00 00       	mov    $0x8,%eax
+     a3c:	e9 5a ff ff ff       	jmp    99b <syscallentry>
+
+00000a41 <link>:
+SYSCALL(link)
+     a41:	b8 13 00 00 00       	mov    $0x13,%eax
+     a46:	e9 50 ff ff ff       	jmp    99b <syscallentry>
+
+00000a4b <mkdir>:
+SYSCALL(mkdir)
+     a4b:	b8 14 00 00 00       	mov    $0x14,%eax
+     a50:	e9 46 ff ff ff       	jmp    99b <syscallentry>
+
+00000a55 <chdir>:
+SYSCALL(chdir)
+     a55:	b8 09 00 00 00       	mov    $0x9,%eax
+     a5a:	e9 3c ff ff ff       	jmp    99b <syscallentry>
+
+00000a5f <dup>:
+SYSCALL(dup)
+     a5f:	b8 0a 00 00 00       	mov    $0xa,%eax
+     a64:	e9 32 ff ff ff       	jmp    99b <syscallentry>
+
+00000a69 <getpid>:
+SYSCALL(getpid)
+     a69:	b8 0b 00 00 00       	mov    $0xb,%eax
+     a6e:	e9 28 ff ff ff       	jmp    99b <syscallentry>
+
+00000a73 <sbrk>:
+SYSCALL(sbrk)
+     a73:	b8 0c 00 00 00       	mov    $0xc,%eax
+     a78:	e9 1e ff ff ff       	jmp    99b <syscallentry>
+
+00000a7d <sleep>:
+SYSCALL(sleep)
+     a7d:	b8 0d 00 00 00       	mov    $0xd,%eax
+     a82:	e9 14 ff ff ff       	jmp    99b <syscallentry>
+
+00000a87 <uptime>:
+SYSCALL(uptime)
+     a87:	b8 0e 00 00 00       	mov    $0xe,%eax
+     a8c:	e9 0a ff ff ff       	jmp    99b <syscallentry>
+
+00000a91 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+     a91:	b8 16 00 00 00       	mov    $0x16,%eax
+     a96:	e9 00 ff ff ff       	jmp    99b <syscallentry>
+
+00000a9b <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+     a9b:	b8 17 00 00 00       	mov    $0x17,%eax
+     aa0:	e9 f6 fe ff ff       	jmp    99b <syscallentry>
+
+00000aa5 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+     aa5:	b8 18 00 00 00       	mov    $0x18,%eax
+     aaa:	e9 ec fe ff ff       	jmp    99b <syscallentry>
+
+00000aaf <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+     aaf:	b8 19 00 00 00       	mov    $0x19,%eax
+     ab4:	e9 e2 fe ff ff       	jmp    99b <syscallentry>
+
+00000ab9 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+     ab9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     abe:	e9 d8 fe ff ff       	jmp    99b <syscallentry>
+
+00000ac3 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+     ac3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     ac8:	e9 ce fe ff ff       	jmp    99b <syscallentry>
+
+00000acd <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+     acd:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     ad2:	e9 c4 fe ff ff       	jmp    99b <syscallentry>
+
+00000ad7 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+     ad7:	b8 20 00 00 00       	mov    $0x20,%eax
+     adc:	e9 ba fe ff ff       	jmp    99b <syscallentry>
+
+00000ae1 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+     ae1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     ae6:	e9 b0 fe ff ff       	jmp    99b <syscallentry>
+
+00000aeb <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+     aeb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     af0:	e9 a6 fe ff ff       	jmp    99b <syscallentry>
+
+00000af5 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+     af5:	b8 21 00 00 00       	mov    $0x21,%eax
+     afa:	e9 9c fe ff ff       	jmp    99b <syscallentry>
+
+00000aff <yield>:
+SYSCALL(yield) // yield the CPU to another process
+     aff:	b8 22 00 00 00       	mov    $0x22,%eax
+     b04:	e9 92 fe ff ff       	jmp    99b <syscallentry>
+
+00000b09 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+     b09:	b8 23 00 00 00       	mov    $0x23,%eax
+     b0e:	e9 88 fe ff ff       	jmp    99b <syscallentry>
+
+00000b13 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+     b13:	b8 24 00 00 00       	mov    $0x24,%eax
+     b18:	e9 7e fe ff ff       	jmp    99b <syscallentry>
+
+00000b1d <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+     b1d:	b8 25 00 00 00       	mov    $0x25,%eax
+     b22:	e9 74 fe ff ff       	jmp    99b <syscallentry>
+
+00000b27 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+     b27:	b8 26 00 00 00       	mov    $0x26,%eax
+     b2c:	e9 6a fe ff ff       	jmp    99b <syscallentry>
+
+00000b31 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+     b31:	b8 27 00 00 00       	mov    $0x27,%eax
+     b36:	e9 60 fe ff ff       	jmp    99b <syscallentry>
+
+00000b3b <mmap>:
+SYSCALL(mmap) // map a file into memory
+     b3b:	b8 28 00 00 00       	mov    $0x28,%eax
+     b40:	e9 56 fe ff ff       	jmp    99b <syscallentry>
+
+00000b45 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+     b45:	b8 29 00 00 00       	mov    $0x29,%eax
+     b4a:	e9 4c fe ff ff       	jmp    99b <syscallentry>
+
+00000b4f <readv>:
+SYSCALL(readv) // read into several buffers
+     b4f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     b54:	e9 42 fe ff ff       	jmp    99b <syscallentry>
+
+00000b59 <writev>:
+SYSCALL(writev) // write from several buffers
+     b59:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     b5e:	e9 38 fe ff ff       	jmp    99b <syscallentry>
+
+00000b63 <pread>:
+SYSCALL(pread) // read at an offset
+     b63:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     b68:	e9 2e fe ff ff       	jmp    99b <syscallentry>
+
+00000b6d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+     b6d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     b72:	e9 24 fe ff ff       	jmp    99b <syscallentry>
+
+00000b77 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+     b77:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     b7c:	e9 1a fe ff ff       	jmp    99b <syscallentry>
+
+00000b81 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+     b81:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     b86:	e9 10 fe ff ff       	jmp    99b <syscallentry>
+
+00000b8b <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+     b8b:	b8 30 00 00 00       	mov    $0x30,%eax
+     b90:	e9 06 fe ff ff       	jmp    99b <syscallentry>
+
+00000b95 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+     b95:	b8 31 00 00 00       	mov    $0x31,%eax
+     b9a:	e9 fc fd ff ff       	jmp    99b <syscallentry>
+
+00000b9f <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+     b9f:	b8 32 00 00 00       	mov    $0x32,%eax
+     ba4:	e9 f2 fd ff ff       	jmp    99b <syscallentry>
+
+00000ba9 <profread>:
+SYSCALL(profread) // drain profiler samples
+     ba9:	b8 33 00 00 00       	mov    $0x33,%eax
+     bae:	e9 e8 fd ff ff       	jmp    99b <syscallentry>
+
+00000bb3 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+     bb3:	b8 34 00 00 00       	mov    $0x34,%eax
+     bb8:	e9 de fd ff ff       	jmp    99b <syscallentry>
+
+00000bbd <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+     bbd:	b8 35 00 00 00       	mov    $0x35,%eax
+     bc2:	e9 d4 fd ff ff       	jmp    99b <syscallentry>
+
+00000bc7 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+     bc7:	b8 36 00 00 00       	mov    $0x36,%eax
+     bcc:	e9 ca fd ff ff       	jmp    99b <syscallentry>
+
+00000bd1 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+     bd1:	b8 37 00 00 00       	mov    $0x37,%eax
+     bd6:	e9 c0 fd ff ff       	jmp    99b <syscallentry>
+     bdb:	66 90                	xchg   %ax,%ax
+     bdd:	66 90                	xchg   %ax,%ax
+     bdf:	90                   	nop
+
+00000be0 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     be0:	55                   	push   %ebp
+     be1:	89 e5                	mov    %esp,%ebp
+     be3:	57                   	push   %edi
+     be4:	56                   	push   %esi
+     be5:	53                   	push   %ebx
+     be6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     be8:	89 d1                	mov    %edx,%ecx
+{
+     bea:	83 ec 3c             	sub    $0x3c,%esp
+     bed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     bf0:	85 d2                	test   %edx,%edx
+     bf2:	0f 89 80 00 00 00    	jns    c78 <printint+0x98>
+     bf8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     bfc:	74 7a                	je     c78 <printint+0x98>
+    x = -xx;
+     bfe:	f7 d9                	neg    %ecx
+    neg = 1;
+     c00:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     c05:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     c08:	31 f6                	xor    %esi,%esi
+     c0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     c10:	89 c8                	mov    %ecx,%eax
+     c12:	31 d2                	xor    %edx,%edx
+     c14:	89 f7                	mov    %esi,%edi
+     c16:	f7 f3                	div    %ebx
+     c18:	8d 76 01             	lea    0x1(%esi),%esi
+     c1b:	0f b6 92 dc 11 00 00 	movzbl 0x11dc(%edx),%edx
+     c22:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     c26:	89 ca                	mov    %ecx,%edx
+     c28:	89 c1                	mov    %eax,%ecx
+     c2a:	39 da                	cmp    %ebx,%edx
+     c2c:	73 e2                	jae    c10 <printint+0x30>
+  if(neg)
+     c2e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     c31:	85 c0                	test   %eax,%eax
+     c33:	74 07                	je     c3c <printint+0x5c>
+    buf[i++] = '-';
+     c35:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     c3a:	89 f7                	mov    %esi,%edi
+     c3c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     c3f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     c42:	01 df                	add    %ebx,%edi
+     c44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     c48:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+     c4b:	83 ec 04             	sub    $0x4,%esp
+     c4e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     c51:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     c54:	6a 01                	push   $0x1
+     c56:	50                   	push   %eax
+     c57:	56                   	push   %esi
+     c58:	e8 e3 f6 ff ff       	call   340 <bufwrite>
+  while(--i >= 0)
+     c5d:	89 f8                	mov    %edi,%eax
+     c5f:	83 c4 10             	add    $0x10,%esp
+     c62:	83 ef 01             	sub    $0x1,%edi
+     c65:	39 d8                	cmp    %ebx,%eax
+     c67:	75 df                	jne    c48 <printint+0x68>
+}
+     c69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c6c:	5b                   	pop    %ebx
+     c6d:	5e                   	pop    %esi
+     c6e:	5f                   	pop    %edi
+     c6f:	5d                   	pop    %ebp
+     c70:	c3                   	ret
+     c71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     c78:	31 c0                	xor    %eax,%eax
+     c7a:	eb 89                	jmp    c05 <printint+0x25>
+     c7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c80 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     c80:	55                   	push   %ebp
+     c81:	89 e5                	mov    %esp,%ebp
+     c83:	57                   	push   %edi
+     c84:	56                   	push   %esi
+     c85:	53                   	push   %ebx
+     c86:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     c89:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c8c:	0f b6 18             	movzbl (%eax),%ebx
+     c8f:	84 db                	test   %bl,%bl
+     c91:	74 6c                	je     cff <printf+0x7f>
+     c93:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+     c96:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+     c99:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     c9b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     c9e:	eb 26                	jmp    cc6 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     ca0:	83 f8 25             	cmp    $0x25,%eax
+     ca3:	74 4b                	je     cf0 <printf+0x70>
+  bufwrite(fd, &c, 1);
+     ca5:	83 ec 04             	sub    $0x4,%esp
+     ca8:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     cab:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     cae:	6a 01                	push   $0x1
+     cb0:	50                   	push   %eax
+     cb1:	ff 75 08             	push   0x8(%ebp)
+     cb4:	e8 87 f6 ff ff       	call   340 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+     cb9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     cbc:	0f b6 1f             	movzbl (%edi),%ebx
+     cbf:	83 c7 01             	add    $0x1,%edi
+     cc2:	84 db                	test   %bl,%bl
+     cc4:	74 39                	je     cff <printf+0x7f>
+    c = fmt[i] & 0xff;
+     cc6:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     cc9:	85 f6                	test   %esi,%esi
+     ccb:	74 d3                	je     ca0 <printf+0x20>
+      }
+    } else if(state == '%'){
+     ccd:	83 fe 25             	cmp    $0x25,%esi
+     cd0:	75 ea                	jne    cbc <printf+0x3c>
+      if(c == 'd'){
+     cd2:	83 f8 25             	cmp    $0x25,%eax
+     cd5:	0f 84 d5 01 00 00    	je     eb0 <printf+0x230>
+     cdb:	83 e8 63             	sub    $0x63,%eax
+     cde:	83 f8 15             	cmp    $0x15,%eax
+     ce1:	77 45                	ja     d28 <printf+0xa8>
+     ce3:	ff 24 85 84 11 00 00 	jmp    *0x1184(,%eax,4)
+     cea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     cf0:	0f b6 1f             	movzbl (%edi),%ebx
+     cf3:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+     cf6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     cfb:	84 db                	test   %bl,%bl
+     cfd:	75 c7                	jne    cc6 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+     cff:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+     d03:	74 0b                	je     d10 <printf+0x90>
+    fflush(fd);
+}
+     d05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d08:	5b                   	pop    %ebx
+     d09:	5e                   	pop    %esi
+     d0a:	5f                   	pop    %edi
+     d0b:	5d                   	pop    %ebp
+     d0c:	c3                   	ret
+     d0d:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+     d10:	83 ec 0c             	sub    $0xc,%esp
+     d13:	6a 02                	push   $0x2
+     d15:	e8 c6 f7 ff ff       	call   4e0 <fflush>
+     d1a:	83 c4 10             	add    $0x10,%esp
+}
+     d1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d20:	5b                   	pop    %ebx
+     d21:	5e                   	pop    %esi
+     d22:	5f                   	pop    %edi
+     d23:	5d                   	pop    %ebp
+     d24:	c3                   	ret
+     d25:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+     d28:	83 ec 04             	sub    $0x4,%esp
+     d2b:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     d2e:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+     d32:	6a 01                	push   $0x1
+     d34:	52                   	push   %edx
+     d35:	89 55 c0             	mov    %edx,-0x40(%ebp)
+     d38:	ff 75 08             	push   0x8(%ebp)
+     d3b:	e8 00 f6 ff ff       	call   340 <bufwrite>
+     d40:	83 c4 0c             	add    $0xc,%esp
+     d43:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     d46:	6a 01                	push   $0x1
+     d48:	8b 55 c0             	mov    -0x40(%ebp),%edx
+     d4b:	52                   	push   %edx
+      state = 0;
+     d4c:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+     d4e:	ff 75 08             	push   0x8(%ebp)
+     d51:	e8 ea f5 ff ff       	call   340 <bufwrite>
+        putc(fd, c);
+     d56:	83 c4 10             	add    $0x10,%esp
+     d59:	e9 5e ff ff ff       	jmp    cbc <printf+0x3c>
+     d5e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+     d60:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     d63:	83 ec 0c             	sub    $0xc,%esp
+     d66:	b9 10 00 00 00       	mov    $0x10,%ecx
+     d6b:	8b 16                	mov    (%esi),%edx
+     d6d:	6a 00                	push   $0x0
+     d6f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+     d72:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+     d75:	e8 66 fe ff ff       	call   be0 <printint>
+        ap++;
+     d7a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     d7d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d80:	31 f6                	xor    %esi,%esi
+     d82:	e9 35 ff ff ff       	jmp    cbc <printf+0x3c>
+     d87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d8e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     d90:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     d93:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     d95:	83 c0 04             	add    $0x4,%eax
+     d98:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+     d9b:	b8 7a 11 00 00       	mov    $0x117a,%eax
+     da0:	85 db                	test   %ebx,%ebx
+     da2:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+     da5:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+     da8:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+     daa:	53                   	push   %ebx
+     dab:	e8 90 f9 ff ff       	call   740 <strlen>
+     db0:	83 c4 0c             	add    $0xc,%esp
+     db3:	50                   	push   %eax
+     db4:	53                   	push   %ebx
+     db5:	ff 75 08             	push   0x8(%ebp)
+     db8:	e8 83 f5 ff ff       	call   340 <bufwrite>
+     dbd:	83 c4 10             	add    $0x10,%esp
+     dc0:	e9 f7 fe ff ff       	jmp    cbc <printf+0x3c>
+     dc5:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+     dc8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+     dcb:	83 ec 04             	sub    $0x4,%esp
+     dce:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+     dd1:	8b 06                	mov    (%esi),%eax
+        ap++;
+     dd3:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+     dd6:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+     dd9:	6a 01                	push   $0x1
+     ddb:	52                   	push   %edx
+     ddc:	ff 75 08             	push   0x8(%ebp)
+     ddf:	e8 5c f5 ff ff       	call   340 <bufwrite>
+        ap++;
+     de4:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     de7:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     dea:	31 f6                	xor    %esi,%esi
+     dec:	e9 cb fe ff ff       	jmp    cbc <printf+0x3c>
+     df1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+     df8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     dfb:	83 ec 0c             	sub    $0xc,%esp
+     dfe:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     e03:	8b 16                	mov    (%esi),%edx
+     e05:	6a 01                	push   $0x1
+     e07:	e9 63 ff ff ff       	jmp    d6f <printf+0xef>
+     e0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+     e10:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     e13:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     e16:	89 7d c0             	mov    %edi,-0x40(%ebp)
+     e19:	89 55 bc             	mov    %edx,-0x44(%ebp)
+     e1c:	8b 18                	mov    (%eax),%ebx
+     e1e:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+     e21:	31 c0                	xor    %eax,%eax
+     e23:	89 c7                	mov    %eax,%edi
+     e25:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+     e28:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+     e2d:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+     e2f:	f7 e1                	mul    %ecx
+     e31:	c1 ea 03             	shr    $0x3,%edx
+     e34:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     e37:	89 d1                	mov    %edx,%ecx
+     e39:	01 c0                	add    %eax,%eax
+     e3b:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     e3d:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+     e3f:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     e41:	be 0a 00 00 00       	mov    $0xa,%esi
+     e46:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+     e48:	89 da                	mov    %ebx,%edx
+     e4a:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+     e4c:	89 fe                	mov    %edi,%esi
+     e4e:	83 c7 01             	add    $0x1,%edi
+     e51:	8d 42 30             	lea    0x30(%edx),%eax
+     e54:	89 da                	mov    %ebx,%edx
+     e56:	8d 14 92             	lea    (%edx,%edx,4),%edx
+     e59:	01 d2                	add    %edx,%edx
+     e5b:	29 d0                	sub    %edx,%eax
+     e5d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+     e61:	89 c8                	mov    %ecx,%eax
+     e63:	09 d8                	or     %ebx,%eax
+     e65:	75 c1                	jne    e28 <printf+0x1a8>
+     e67:	8b 55 bc             	mov    -0x44(%ebp),%edx
+     e6a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     e6d:	01 d6                	add    %edx,%esi
+     e6f:	89 f7                	mov    %esi,%edi
+     e71:	89 d6                	mov    %edx,%esi
+     e73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e77:	90                   	nop
+    putc(fd, buf[i]);
+     e78:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+     e7b:	83 ec 04             	sub    $0x4,%esp
+     e7e:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+     e81:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+     e84:	6a 01                	push   $0x1
+     e86:	50                   	push   %eax
+     e87:	53                   	push   %ebx
+     e88:	e8 b3 f4 ff ff       	call   340 <bufwrite>
+  while(--i >= 0)
+     e8d:	89 fa                	mov    %edi,%edx
+     e8f:	83 c4 10             	add    $0x10,%esp
+     e92:	83 ef 01             	sub    $0x1,%edi
+     e95:	39 d6                	cmp    %edx,%esi
+     e97:	75 df                	jne    e78 <printf+0x1f8>
+        ap += 2;
+     e99:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+     e9d:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+     ea0:	31 f6                	xor    %esi,%esi
+     ea2:	e9 15 fe ff ff       	jmp    cbc <printf+0x3c>
+     ea7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eae:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+     eb0:	83 ec 04             	sub    $0x4,%esp
+     eb3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     eb6:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     eb9:	6a 01                	push   $0x1
+     ebb:	e9 8b fe ff ff       	jmp    d4b <printf+0xcb>
+
+00000ec0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     ec0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     ec1:	a1 a0 27 00 00       	mov    0x27a0,%eax
+{
+     ec6:	89 e5                	mov    %esp,%ebp
+     ec8:	57                   	push   %edi
+     ec9:	56                   	push   %esi
+     eca:	53                   	push   %ebx
+     ecb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     ece:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     ed1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ed8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     eda:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     edc:	39 ca                	cmp    %ecx,%edx
+     ede:	73 30                	jae    f10 <free+0x50>
+     ee0:	39 c1                	cmp    %eax,%ecx
+     ee2:	72 04                	jb     ee8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     ee4:	39 c2                	cmp    %eax,%edx
+     ee6:	72 f0                	jb     ed8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     ee8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     eeb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     eee:	39 f8                	cmp    %edi,%eax
+     ef0:	74 2e                	je     f20 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     ef2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     ef5:	8b 42 04             	mov    0x4(%edx),%eax
+     ef8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     efb:	39 f1                	cmp    %esi,%ecx
+     efd:	74 38                	je     f37 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     eff:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     f01:	5b                   	pop    %ebx
+  freep = p;
+     f02:	89 15 a0 27 00 00    	mov    %edx,0x27a0
+}
+     f08:	5e                   	pop    %esi
+     f09:	5f                   	pop    %edi
+     f0a:	5d                   	pop    %ebp
+     f0b:	c3                   	ret
+     f0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f10:	39 c1                	cmp    %eax,%ecx
+     f12:	72 d0                	jb     ee4 <free+0x24>
+     f14:	eb c2                	jmp    ed8 <free+0x18>
+     f16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f1d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+     f20:	03 70 04             	add    0x4(%eax),%esi
+     f23:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f26:	8b 02                	mov    (%edx),%eax
+     f28:	8b 00                	mov    (%eax),%eax
+     f2a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     f2d:	8b 42 04             	mov    0x4(%edx),%eax
+     f30:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     f33:	39 f1                	cmp    %esi,%ecx
+     f35:	75 c8                	jne    eff <free+0x3f>
+    p->s.size += bp->s.size;
+     f37:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     f3a:	89 15 a0 27 00 00    	mov    %edx,0x27a0
+    p->s.size += bp->s.size;
+     f40:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     f43:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     f46:	89 0a                	mov    %ecx,(%edx)
+}
+     f48:	5b                   	pop    %ebx
+     f49:	5e                   	pop    %esi
+     f4a:	5f                   	pop    %edi
+     f4b:	5d                   	pop    %ebp
+     f4c:	c3                   	ret
+     f4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f50 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     f50:	55                   	push   %ebp
+     f51:	89 e5                	mov    %esp,%ebp
+     f53:	57                   	push   %edi
+     f54:	56                   	push   %esi
+     f55:	53                   	push   %ebx
+     f56:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f59:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+     f5c:	8b 15 a0 27 00 00    	mov    0x27a0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f62:	8d 78 07             	lea    0x7(%eax),%edi
+     f65:	c1 ef 03             	shr    $0x3,%edi
+     f68:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+     f6b:	85 d2                	test   %edx,%edx
+     f6d:	0f 84 8d 00 00 00    	je     1000 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f73:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     f75:	8b 48 04             	mov    0x4(%eax),%ecx
+     f78:	39 f9                	cmp    %edi,%ecx
+     f7a:	73 64                	jae    fe0 <malloc+0x90>
+  if(nu < 4096)
+     f7c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     f81:	39 df                	cmp    %ebx,%edi
+     f83:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     f86:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     f8d:	eb 0a                	jmp    f99 <malloc+0x49>
+     f8f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f90:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     f92:	8b 48 04             	mov    0x4(%eax),%ecx
+     f95:	39 f9                	cmp    %edi,%ecx
+     f97:	73 47                	jae    fe0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     f99:	89 c2                	mov    %eax,%edx
+     f9b:	39 05 a0 27 00 00    	cmp    %eax,0x27a0
+     fa1:	75 ed                	jne    f90 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+     fa3:	83 ec 0c             	sub    $0xc,%esp
+     fa6:	56                   	push   %esi
+     fa7:	e8 c7 fa ff ff       	call   a73 <sbrk>
+  if(p == (char*)-1)
+     fac:	83 c4 10             	add    $0x10,%esp
+     faf:	83 f8 ff             	cmp    $0xffffffff,%eax
+     fb2:	74 1c                	je     fd0 <malloc+0x80>
+  hp->s.size = nu;
+     fb4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+     fb7:	83 ec 0c             	sub    $0xc,%esp
+     fba:	83 c0 08             	add    $0x8,%eax
+     fbd:	50                   	push   %eax
+     fbe:	e8 fd fe ff ff       	call   ec0 <free>
+  return freep;
+     fc3:	8b 15 a0 27 00 00    	mov    0x27a0,%edx
+      if((p = morecore(nunits)) == 0)
+     fc9:	83 c4 10             	add    $0x10,%esp
+     fcc:	85 d2                	test   %edx,%edx
+     fce:	75 c0                	jne    f90 <malloc+0x40>
+        return 0;
+  }
+}
+     fd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     fd3:	31 c0                	xor    %eax,%eax
+}
+     fd5:	5b                   	pop    %ebx
+     fd6:	5e                   	pop    %esi
+     fd7:	5f                   	pop    %edi
+     fd8:	5d                   	pop    %ebp
+     fd9:	c3                   	ret
+     fda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     fe0:	39 cf                	cmp    %ecx,%edi
+     fe2:	74 4c                	je     1030 <malloc+0xe0>
+        p->s.size -= nunits;
+     fe4:	29 f9                	sub    %edi,%ecx
+     fe6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+     fe9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+     fec:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+     fef:	89 15 a0 27 00 00    	mov    %edx,0x27a0
+}
+     ff5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+     ff8:	83 c0 08             	add    $0x8,%eax
+}
+     ffb:	5b                   	pop    %ebx
+     ffc:	5e                   	pop    %esi
+     ffd:	5f                   	pop    %edi
+     ffe:	5d                   	pop    %ebp
+     fff:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1000:	c7 05 a0 27 00 00 a4 	movl   $0x27a4,0x27a0
+    1007:	27 00 00 
+    base.s.size = 0;
+    100a:	b8 a4 27 00 00       	mov    $0x27a4,%eax
+    base.s.ptr = freep = prevp = &base;
+    100f:	c7 05 a4 27 00 00 a4 	movl   $0x27a4,0x27a4
+    1016:	27 00 00 
+    base.s.size = 0;
+    1019:	c7 05 a8 27 00 00 00 	movl   $0x0,0x27a8
+    1020:	00 00 00 
+    if(p->s.size >= nunits){
+    1023:	e9 54 ff ff ff       	jmp    f7c <malloc+0x2c>
+    1028:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    102f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1030:	8b 08                	mov    (%eax),%ecx
+    1032:	89 0a                	mov    %ecx,(%edx)
+    1034:	eb b9                	jmp    fef <malloc+0x9f>
+    1036:	66 90                	xchg   %ax,%ax
+    1038:	66 90                	xchg   %ax,%ax
+    103a:	66 90                	xchg   %ax,%ax
+    103c:	66 90                	xchg   %ax,%ax
+    103e:	66 90                	xchg   %ax,%ax
+
+00001040 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+    1040:	55                   	push   %ebp
+    1041:	89 e5                	mov    %esp,%ebp
+    1043:	57                   	push   %edi
+    1044:	56                   	push   %esi
+    1045:	be 01 00 00 00       	mov    $0x1,%esi
+    104a:	53                   	push   %ebx
+    104b:	83 ec 28             	sub    $0x28,%esp
+    104e:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1051:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1054:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+    1057:	68 00 98 00 00       	push   $0x9800
+    105c:	e8 ef fe ff ff       	call   f50 <malloc>
+    1061:	83 c4 10             	add    $0x10,%esp
+    1064:	89 c7                	mov    %eax,%edi
+    1066:	85 c0                	test   %eax,%eax
+    1068:	74 62                	je     10cc <waitpoll+0x8c>
+    106a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+    1070:	83 ec 0c             	sub    $0xc,%esp
+    1073:	6a 01                	push   $0x1
+    1075:	e8 03 fa ff ff       	call   a7d <sleep>
+    fn();
+    107a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    107d:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+    107f:	58                   	pop    %eax
+    1080:	5a                   	pop    %edx
+    1081:	68 00 02 00 00       	push   $0x200
+    1086:	57                   	push   %edi
+    1087:	e8 eb fa ff ff       	call   b77 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+    108c:	83 c4 10             	add    $0x10,%esp
+    108f:	85 c0                	test   %eax,%eax
+    1091:	7e 2d                	jle    10c0 <waitpoll+0x80>
+    1093:	6b c0 4c             	imul   $0x4c,%eax,%eax
+    1096:	89 fa                	mov    %edi,%edx
+    alive = 0;
+    1098:	31 c9                	xor    %ecx,%ecx
+    109a:	01 f8                	add    %edi,%eax
+    109c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+    10a0:	3b 1a                	cmp    (%edx),%ebx
+    10a2:	75 07                	jne    10ab <waitpoll+0x6b>
+        alive = 1;
+    10a4:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+    10a8:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+    10ab:	83 c2 4c             	add    $0x4c,%edx
+    10ae:	39 d0                	cmp    %edx,%eax
+    10b0:	75 ee                	jne    10a0 <waitpoll+0x60>
+  } while(alive);
+    10b2:	85 c9                	test   %ecx,%ecx
+    10b4:	75 ba                	jne    1070 <waitpoll+0x30>
+    10b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10bd:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+    10c0:	83 ec 0c             	sub    $0xc,%esp
+    10c3:	57                   	push   %edi
+    10c4:	e8 f7 fd ff ff       	call   ec0 <free>
+  wait();
+    10c9:	83 c4 10             	add    $0x10,%esp
+}
+    10cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10cf:	5b                   	pop    %ebx
+    10d0:	5e                   	pop    %esi
+    10d1:	5f                   	pop    %edi
+    10d2:	5d                   	pop    %ebp
+  wait();
+    10d3:	e9 10 f9 ff ff       	jmp    9e8 <wait>
+    10d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10df:	90                   	nop
+
+000010e0 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+    10e0:	55                   	push   %ebp
+    10e1:	89 e5                	mov    %esp,%ebp
+    10e3:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+    10e6:	c7 45 f0 ed 11 00 00 	movl   $0x11ed,-0x10(%ebp)
+    10ed:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+    10f4:	e8 87 f4 ff ff       	call   580 <fork>
+    10f9:	85 c0                	test   %eax,%eax
+    10fb:	78 09                	js     1106 <runps+0x26>
+    return -1;
+  if(pid == 0){
+    10fd:	74 0e                	je     110d <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+    10ff:	e8 e4 f8 ff ff       	call   9e8 <wait>
+}
+    1104:	c9                   	leave
+    1105:	c3                   	ret
+    1106:	c9                   	leave
+    return -1;
+    1107:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    110c:	c3                   	ret
+    exec("ps", argv);
+    110d:	50                   	push   %eax
+    110e:	50                   	push   %eax
+    110f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    1112:	50                   	push   %eax
+    1113:	68 ed 11 00 00       	push   $0x11ed
+    1118:	e8 c3 f4 ff ff       	call   5e0 <exec>
+    printf(2, "exec ps failed\n");
+    111d:	5a                   	pop    %edx
+    111e:	59                   	pop    %ecx
+    111f:	68 f0 11 00 00       	push   $0x11f0
+    1124:	6a 02                	push   $0x2
+    1126:	e8 55 fb ff ff       	call   c80 <printf>
+    exit();
+    112b:	e8 a0 f4 ff ff       	call   5d0 <exit>
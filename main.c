@@ -26,14 +26,20 @@ main(void)
   ioapicinit();    // another interrupt controller
   consoleinit();   // console hardware
   uartinit();      // serial port
+  tscinit();       // measure the cycle counter
   pinit();         // process table
+  traceinit();     // event trace rings
+  profinit();      // profiler sample rings
+  lockbenchinit(); // lock for lockbench
   tvinit();        // trap vectors
   binit();         // buffer cache
   fileinit();      // file table
+  mmapinit();      // shared mapped pages
   ideinit();       // disk 
   startothers();   // start other processors
   kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
   userinit();      // first user process
+  kthread(wbflusher, "wbflusher"); // write-back flusher
   mpmain();        // finish this processor's setup
 }
 
@@ -53,6 +59,7 @@ mpmain(void)
 {
   cprintf("cpu%d: starting %d\n", cpuid(), cpuid());
   idtinit();       // load idt register
+  sysenterinit();  // fast system call entry
   xchg(&(mycpu()->started), 1); // tell startothers() we're up
   scheduler();     // start running processes
 }
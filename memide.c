@@ -12,8 +12,9 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "fcntl.h"
 
-extern uchar _binary_fs_img_start[], _binary_fs_img_size[];
+extern uchar _binary_memfs_img_start[], _binary_memfs_img_size[];
 
 static int disksize;
 static uchar *memdisk;
@@ -21,8 +22,15 @@ static uchar *memdisk;
 void
 ideinit(void)
 {
-  memdisk = _binary_fs_img_start;
-  disksize = (uint)_binary_fs_img_size/BSIZE;
+  memdisk = _binary_memfs_img_start;
+  disksize = (uint)_binary_memfs_img_size/BSIZE;
+}
+
+// There is no controller to program; only "PIO" is available.
+int
+idesetmode(int mode)
+{
+  return mode == IDE_PIO ? IDE_PIO : -1;
 }
 
 // Interrupt handler.
@@ -46,10 +54,10 @@ iderw(struct buf *b)
     panic("iderw: nothing to do");
   if(b->dev != 1)
     panic("iderw: request not for disk 1");
-  if(b->blockno >= disksize)
+  if(b->ioblock >= disksize)
     panic("iderw: block out of range");
 
-  p = memdisk + b->blockno*BSIZE;
+  p = memdisk + b->ioblock*BSIZE;
 
   if(b->flags & B_DIRTY){
     b->flags &= ~B_DIRTY;
@@ -58,3 +66,13 @@ iderw(struct buf *b)
     memmove(b->data, p, BSIZE);
   b->flags |= B_VALID;
 }
+
+// Sync n bufs with disk, one at a time.
+void
+iderwv(struct buf **bs, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    iderw(bs[i]);
+}
@@ -0,0 +1,2013 @@
+
+_mkdir:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  int i, hashed;
+
+  hashed = argc > 1 && strcmp(argv[1], "-h") == 0;
+  19:	83 fe 01             	cmp    $0x1,%esi
+  1c:	7f 13                	jg     31 <main+0x31>
+  if(argc < 2 + hashed){
+    printf(2, "Usage: mkdir [-h] files...\n");
+  1e:	53                   	push   %ebx
+  1f:	53                   	push   %ebx
+  20:	68 b3 0e 00 00       	push   $0xeb3
+  25:	6a 02                	push   $0x2
+  27:	e8 d4 09 00 00       	call   a00 <printf>
+    exit();
+  2c:	e8 1f 03 00 00       	call   350 <exit>
+  hashed = argc > 1 && strcmp(argv[1], "-h") == 0;
+  31:	57                   	push   %edi
+  32:	57                   	push   %edi
+  33:	68 b0 0e 00 00       	push   $0xeb0
+  38:	ff 73 04             	push   0x4(%ebx)
+  3b:	e8 20 04 00 00       	call   460 <strcmp>
+  40:	83 c4 10             	add    $0x10,%esp
+  43:	85 c0                	test   %eax,%eax
+  45:	75 13                	jne    5a <main+0x5a>
+  if(argc < 2 + hashed){
+  47:	83 fe 02             	cmp    $0x2,%esi
+  4a:	74 d2                	je     1e <main+0x1e>
+  hashed = argc > 1 && strcmp(argv[1], "-h") == 0;
+  4c:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+  53:	bf 02 00 00 00       	mov    $0x2,%edi
+  58:	eb 0a                	jmp    64 <main+0x64>
+  5a:	31 c9                	xor    %ecx,%ecx
+  if(argc < 2 + hashed){
+  5c:	bf 01 00 00 00       	mov    $0x1,%edi
+  hashed = argc > 1 && strcmp(argv[1], "-h") == 0;
+  61:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  64:	8d 1c bb             	lea    (%ebx,%edi,4),%ebx
+  67:	eb 21                	jmp    8a <main+0x8a>
+  69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  }
+
+  for(i = 1 + hashed; i < argc; i++){
+    if((hashed ? mkhdir(argv[i]) : mkdir(argv[i])) < 0){
+  70:	83 ec 0c             	sub    $0xc,%esp
+  73:	50                   	push   %eax
+  74:	e8 d8 08 00 00       	call   951 <mkhdir>
+  79:	83 c4 10             	add    $0x10,%esp
+  7c:	85 c0                	test   %eax,%eax
+  7e:	78 23                	js     a3 <main+0xa3>
+  for(i = 1 + hashed; i < argc; i++){
+  80:	83 c7 01             	add    $0x1,%edi
+  83:	83 c3 04             	add    $0x4,%ebx
+  86:	39 fe                	cmp    %edi,%esi
+  88:	74 2b                	je     b5 <main+0xb5>
+    if((hashed ? mkhdir(argv[i]) : mkdir(argv[i])) < 0){
+  8a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8d:	8b 03                	mov    (%ebx),%eax
+  8f:	85 d2                	test   %edx,%edx
+  91:	75 dd                	jne    70 <main+0x70>
+  93:	83 ec 0c             	sub    $0xc,%esp
+  96:	50                   	push   %eax
+  97:	e8 2f 07 00 00       	call   7cb <mkdir>
+  9c:	83 c4 10             	add    $0x10,%esp
+  9f:	85 c0                	test   %eax,%eax
+  a1:	79 dd                	jns    80 <main+0x80>
+      printf(2, "mkdir: %s failed to create\n", argv[i]);
+  a3:	50                   	push   %eax
+  a4:	ff 33                	push   (%ebx)
+  a6:	68 cf 0e 00 00       	push   $0xecf
+  ab:	6a 02                	push   $0x2
+  ad:	e8 4e 09 00 00       	call   a00 <printf>
+      break;
+  b2:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+  b5:	e8 96 02 00 00       	call   350 <exit>
+  ba:	66 90                	xchg   %ax,%ax
+  bc:	66 90                	xchg   %ax,%ax
+  be:	66 90                	xchg   %ax,%ax
+
+000000c0 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	57                   	push   %edi
+  c4:	56                   	push   %esi
+  c5:	53                   	push   %ebx
+  c6:	83 ec 4c             	sub    $0x4c,%esp
+  c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  cf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  d2:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+  d5:	83 fa 0f             	cmp    $0xf,%edx
+  d8:	0f 87 32 01 00 00    	ja     210 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+  de:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+  e4:	8b 80 e0 13 00 00    	mov    0x13e0(%eax),%eax
+  ea:	85 c0                	test   %eax,%eax
+  ec:	0f 84 de 00 00 00    	je     1d0 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+  f2:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+  f8:	8b b0 e4 13 00 00    	mov    0x13e4(%eax),%esi
+  fe:	8d 88 e0 13 00 00    	lea    0x13e0(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+ 104:	8d b8 e8 13 00 00    	lea    0x13e8(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+ 10a:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+ 10d:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+ 110:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+ 113:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+ 119:	0f 8f 01 01 00 00    	jg     220 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+ 11f:	8d 78 08             	lea    0x8(%eax),%edi
+ 122:	8d bc 3e e0 13 00 00 	lea    0x13e0(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 129:	85 db                	test   %ebx,%ebx
+ 12b:	7e 3b                	jle    168 <bufwrite+0xa8>
+ 12d:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+ 130:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+ 133:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 137:	90                   	nop
+    *dst++ = *src++;
+ 138:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 139:	39 c6                	cmp    %eax,%esi
+ 13b:	75 fb                	jne    138 <bufwrite+0x78>
+  ob[fd].n += n;
+ 13d:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 143:	8b 88 e4 13 00 00    	mov    0x13e4(%eax),%ecx
+ 149:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 14b:	83 b8 e0 13 00 00 01 	cmpl   $0x1,0x13e0(%eax)
+  ob[fd].n += n;
+ 152:	89 88 e4 13 00 00    	mov    %ecx,0x13e4(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 158:	74 26                	je     180 <bufwrite+0xc0>
+}
+ 15a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 15d:	5b                   	pop    %ebx
+ 15e:	5e                   	pop    %esi
+ 15f:	5f                   	pop    %edi
+ 160:	5d                   	pop    %ebp
+ 161:	c3                   	ret
+ 162:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+ 168:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 16b:	83 b8 e0 13 00 00 01 	cmpl   $0x1,0x13e0(%eax)
+  ob[fd].n += n;
+ 172:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 175:	75 e3                	jne    15a <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+ 177:	85 db                	test   %ebx,%ebx
+ 179:	74 df                	je     15a <bufwrite+0x9a>
+ 17b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 17f:	90                   	nop
+  src = vsrc;
+ 180:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 183:	01 c3                	add    %eax,%ebx
+ 185:	eb 10                	jmp    197 <bufwrite+0xd7>
+ 187:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18e:	66 90                	xchg   %ax,%ax
+ 190:	83 c0 01             	add    $0x1,%eax
+ 193:	39 d8                	cmp    %ebx,%eax
+ 195:	74 c3                	je     15a <bufwrite+0x9a>
+    if(*p == (char)c)
+ 197:	80 38 0a             	cmpb   $0xa,(%eax)
+ 19a:	75 f4                	jne    190 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 19c:	85 c9                	test   %ecx,%ecx
+ 19e:	7e ba                	jle    15a <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 1a0:	83 ec 04             	sub    $0x4,%esp
+ 1a3:	51                   	push   %ecx
+ 1a4:	ff 75 ac             	push   -0x54(%ebp)
+ 1a7:	52                   	push   %edx
+ 1a8:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+ 1ab:	e8 cd 05 00 00       	call   77d <write>
+    ob[fd].n = 0;
+ 1b0:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+ 1b3:	83 c4 10             	add    $0x10,%esp
+ 1b6:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+ 1bc:	c7 82 e4 13 00 00 00 	movl   $0x0,0x13e4(%edx)
+ 1c3:	00 00 00 
+ 1c6:	eb 92                	jmp    15a <bufwrite+0x9a>
+ 1c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cf:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 1d0:	83 ec 08             	sub    $0x8,%esp
+ 1d3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 1d6:	50                   	push   %eax
+ 1d7:	52                   	push   %edx
+ 1d8:	89 55 b0             	mov    %edx,-0x50(%ebp)
+ 1db:	e8 d7 05 00 00       	call   7b7 <fstat>
+ 1e0:	83 c4 10             	add    $0x10,%esp
+ 1e3:	8b 55 b0             	mov    -0x50(%ebp),%edx
+ 1e6:	89 c1                	mov    %eax,%ecx
+ 1e8:	b8 02 00 00 00       	mov    $0x2,%eax
+ 1ed:	85 c9                	test   %ecx,%ecx
+ 1ef:	75 0d                	jne    1fe <bufwrite+0x13e>
+ 1f1:	31 c0                	xor    %eax,%eax
+ 1f3:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 1f8:	0f 95 c0             	setne  %al
+ 1fb:	83 c0 01             	add    $0x1,%eax
+ 1fe:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+ 204:	89 81 e0 13 00 00    	mov    %eax,0x13e0(%ecx)
+ 20a:	e9 e3 fe ff ff       	jmp    f2 <bufwrite+0x32>
+ 20f:	90                   	nop
+}
+ 210:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 213:	5b                   	pop    %ebx
+ 214:	5e                   	pop    %esi
+ 215:	5f                   	pop    %edi
+ 216:	5d                   	pop    %ebp
+    write(fd, p, n);
+ 217:	e9 61 05 00 00       	jmp    77d <write>
+ 21c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+ 220:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+ 223:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+ 226:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+ 229:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+ 22c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+ 22f:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+ 232:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+ 235:	6a 02                	push   $0x2
+ 237:	50                   	push   %eax
+ 238:	52                   	push   %edx
+ 239:	e8 9b 06 00 00       	call   8d9 <writev>
+    ob[fd].n = 0;
+ 23e:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+ 241:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+ 244:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ 24b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 24e:	5b                   	pop    %ebx
+ 24f:	5e                   	pop    %esi
+ 250:	5f                   	pop    %edi
+ 251:	5d                   	pop    %ebp
+ 252:	c3                   	ret
+ 253:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000260 <fflush>:
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	53                   	push   %ebx
+ 264:	83 ec 04             	sub    $0x4,%esp
+ 267:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 26a:	83 f8 0f             	cmp    $0xf,%eax
+ 26d:	77 16                	ja     285 <fflush+0x25>
+ 26f:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+ 275:	8b 8a e4 13 00 00    	mov    0x13e4(%edx),%ecx
+ 27b:	8d 9a e0 13 00 00    	lea    0x13e0(%edx),%ebx
+ 281:	85 c9                	test   %ecx,%ecx
+ 283:	7f 0b                	jg     290 <fflush+0x30>
+}
+ 285:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 288:	c9                   	leave
+ 289:	c3                   	ret
+ 28a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 290:	83 ec 04             	sub    $0x4,%esp
+ 293:	81 c2 e8 13 00 00    	add    $0x13e8,%edx
+ 299:	51                   	push   %ecx
+ 29a:	52                   	push   %edx
+ 29b:	50                   	push   %eax
+ 29c:	e8 dc 04 00 00       	call   77d <write>
+    ob[fd].n = 0;
+ 2a1:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+ 2a8:	83 c4 10             	add    $0x10,%esp
+}
+ 2ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2ae:	c9                   	leave
+ 2af:	c3                   	ret
+
+000002b0 <fflushall>:
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 2b4:	31 f6                	xor    %esi,%esi
+{
+ 2b6:	53                   	push   %ebx
+ 2b7:	bb e8 13 00 00       	mov    $0x13e8,%ebx
+ 2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 2c0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 2c3:	85 c0                	test   %eax,%eax
+ 2c5:	7e 15                	jle    2dc <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 2c7:	83 ec 04             	sub    $0x4,%esp
+ 2ca:	50                   	push   %eax
+ 2cb:	53                   	push   %ebx
+ 2cc:	56                   	push   %esi
+ 2cd:	e8 ab 04 00 00       	call   77d <write>
+    ob[fd].n = 0;
+ 2d2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 2d9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 2dc:	83 c6 01             	add    $0x1,%esi
+ 2df:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 2e5:	83 fe 10             	cmp    $0x10,%esi
+ 2e8:	75 d6                	jne    2c0 <fflushall+0x10>
+}
+ 2ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2ed:	5b                   	pop    %ebx
+ 2ee:	5e                   	pop    %esi
+ 2ef:	5d                   	pop    %ebp
+ 2f0:	c3                   	ret
+ 2f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ff:	90                   	nop
+
+00000300 <fork>:
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 304:	31 f6                	xor    %esi,%esi
+{
+ 306:	53                   	push   %ebx
+ 307:	bb e8 13 00 00       	mov    $0x13e8,%ebx
+ 30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 310:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 313:	85 c0                	test   %eax,%eax
+ 315:	7e 15                	jle    32c <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 317:	83 ec 04             	sub    $0x4,%esp
+ 31a:	50                   	push   %eax
+ 31b:	53                   	push   %ebx
+ 31c:	56                   	push   %esi
+ 31d:	e8 5b 04 00 00       	call   77d <write>
+    ob[fd].n = 0;
+ 322:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 329:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 32c:	83 c6 01             	add    $0x1,%esi
+ 32f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 335:	83 fe 10             	cmp    $0x10,%esi
+ 338:	75 d6                	jne    310 <fork+0x10>
+}
+ 33a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 33d:	5b                   	pop    %ebx
+ 33e:	5e                   	pop    %esi
+ 33f:	5d                   	pop    %ebp
+  return _fork();
+ 340:	e9 15 04 00 00       	jmp    75a <_fork>
+ 345:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000350 <exit>:
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+ 356:	e8 55 ff ff ff       	call   2b0 <fflushall>
+  _exit();
+ 35b:	e8 01 04 00 00       	call   761 <_exit>
+
+00000360 <exec>:
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	57                   	push   %edi
+ 364:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 365:	31 f6                	xor    %esi,%esi
+{
+ 367:	53                   	push   %ebx
+ 368:	bb e8 13 00 00       	mov    $0x13e8,%ebx
+ 36d:	83 ec 1c             	sub    $0x1c,%esp
+ 370:	8b 45 08             	mov    0x8(%ebp),%eax
+ 373:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 376:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 379:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 380:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 383:	85 c0                	test   %eax,%eax
+ 385:	7e 15                	jle    39c <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 387:	83 ec 04             	sub    $0x4,%esp
+ 38a:	50                   	push   %eax
+ 38b:	53                   	push   %ebx
+ 38c:	56                   	push   %esi
+ 38d:	e8 eb 03 00 00       	call   77d <write>
+    ob[fd].n = 0;
+ 392:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 399:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 39c:	83 c6 01             	add    $0x1,%esi
+ 39f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 3a5:	83 fe 10             	cmp    $0x10,%esi
+ 3a8:	75 d6                	jne    380 <exec+0x20>
+  return _exec(path, argv);
+ 3aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 3ad:	89 7d 0c             	mov    %edi,0xc(%ebp)
+ 3b0:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ 3b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3b6:	5b                   	pop    %ebx
+ 3b7:	5e                   	pop    %esi
+ 3b8:	5f                   	pop    %edi
+ 3b9:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 3ba:	e9 d3 03 00 00       	jmp    792 <_exec>
+ 3bf:	90                   	nop
+
+000003c0 <close>:
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	56                   	push   %esi
+ 3c4:	53                   	push   %ebx
+ 3c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 3c8:	83 fb 0f             	cmp    $0xf,%ebx
+ 3cb:	77 26                	ja     3f3 <close+0x33>
+ 3cd:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 3d3:	8b 90 e4 13 00 00    	mov    0x13e4(%eax),%edx
+ 3d9:	8d b0 e0 13 00 00    	lea    0x13e0(%eax),%esi
+ 3df:	85 d2                	test   %edx,%edx
+ 3e1:	7f 25                	jg     408 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+ 3e3:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 3e9:	c7 80 e0 13 00 00 00 	movl   $0x0,0x13e0(%eax)
+ 3f0:	00 00 00 
+  return _close(fd);
+ 3f3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 3f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3f9:	5b                   	pop    %ebx
+ 3fa:	5e                   	pop    %esi
+ 3fb:	5d                   	pop    %ebp
+  return _close(fd);
+ 3fc:	e9 83 03 00 00       	jmp    784 <_close>
+ 401:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 408:	83 ec 04             	sub    $0x4,%esp
+ 40b:	05 e8 13 00 00       	add    $0x13e8,%eax
+ 410:	52                   	push   %edx
+ 411:	50                   	push   %eax
+ 412:	53                   	push   %ebx
+ 413:	e8 65 03 00 00       	call   77d <write>
+    ob[fd].n = 0;
+ 418:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+ 41f:	83 c4 10             	add    $0x10,%esp
+ 422:	eb bf                	jmp    3e3 <close+0x23>
+ 424:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 42f:	90                   	nop
+
+00000430 <strcpy>:
+{
+ 430:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+ 431:	31 c0                	xor    %eax,%eax
+{
+ 433:	89 e5                	mov    %esp,%ebp
+ 435:	53                   	push   %ebx
+ 436:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 439:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 43c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 440:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 444:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 447:	83 c0 01             	add    $0x1,%eax
+ 44a:	84 d2                	test   %dl,%dl
+ 44c:	75 f2                	jne    440 <strcpy+0x10>
+}
+ 44e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 451:	89 c8                	mov    %ecx,%eax
+ 453:	c9                   	leave
+ 454:	c3                   	ret
+ 455:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <strcmp>:
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	53                   	push   %ebx
+ 464:	8b 55 08             	mov    0x8(%ebp),%edx
+ 467:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 46a:	0f b6 02             	movzbl (%edx),%eax
+ 46d:	84 c0                	test   %al,%al
+ 46f:	75 17                	jne    488 <strcmp+0x28>
+ 471:	eb 3a                	jmp    4ad <strcmp+0x4d>
+ 473:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 477:	90                   	nop
+ 478:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 47c:	83 c2 01             	add    $0x1,%edx
+ 47f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 482:	84 c0                	test   %al,%al
+ 484:	74 1a                	je     4a0 <strcmp+0x40>
+    p++, q++;
+ 486:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 488:	0f b6 19             	movzbl (%ecx),%ebx
+ 48b:	38 c3                	cmp    %al,%bl
+ 48d:	74 e9                	je     478 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 48f:	29 d8                	sub    %ebx,%eax
+}
+ 491:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 494:	c9                   	leave
+ 495:	c3                   	ret
+ 496:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 4a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 4a4:	31 c0                	xor    %eax,%eax
+ 4a6:	29 d8                	sub    %ebx,%eax
+}
+ 4a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4ab:	c9                   	leave
+ 4ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 4ad:	0f b6 19             	movzbl (%ecx),%ebx
+ 4b0:	31 c0                	xor    %eax,%eax
+ 4b2:	eb db                	jmp    48f <strcmp+0x2f>
+ 4b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4bf:	90                   	nop
+
+000004c0 <strlen>:
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+ 4c6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 4c9:	74 15                	je     4e0 <strlen+0x20>
+ 4cb:	31 c0                	xor    %eax,%eax
+ 4cd:	8d 76 00             	lea    0x0(%esi),%esi
+ 4d0:	83 c0 01             	add    $0x1,%eax
+ 4d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 4d7:	89 c1                	mov    %eax,%ecx
+ 4d9:	75 f5                	jne    4d0 <strlen+0x10>
+}
+ 4db:	89 c8                	mov    %ecx,%eax
+ 4dd:	5d                   	pop    %ebp
+ 4de:	c3                   	ret
+ 4df:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 4e0:	31 c9                	xor    %ecx,%ecx
+}
+ 4e2:	5d                   	pop    %ebp
+ 4e3:	89 c8                	mov    %ecx,%eax
+ 4e5:	c3                   	ret
+ 4e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004f0 <memset>:
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	57                   	push   %edi
+ 4f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 4f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4fd:	89 d7                	mov    %edx,%edi
+ 4ff:	fc                   	cld
+ 500:	f3 aa                	rep stos %al,%es:(%edi)
+}
+ 502:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 505:	89 d0                	mov    %edx,%eax
+ 507:	c9                   	leave
+ 508:	c3                   	ret
+ 509:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000510 <strchr>:
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	8b 45 08             	mov    0x8(%ebp),%eax
+ 516:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 51a:	0f b6 10             	movzbl (%eax),%edx
+ 51d:	84 d2                	test   %dl,%dl
+ 51f:	75 12                	jne    533 <strchr+0x23>
+ 521:	eb 1d                	jmp    540 <strchr+0x30>
+ 523:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 527:	90                   	nop
+ 528:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 52c:	83 c0 01             	add    $0x1,%eax
+ 52f:	84 d2                	test   %dl,%dl
+ 531:	74 0d                	je     540 <strchr+0x30>
+    if(*s == c)
+ 533:	38 d1                	cmp    %dl,%cl
+ 535:	75 f1                	jne    528 <strchr+0x18>
+}
+ 537:	5d                   	pop    %ebp
+ 538:	c3                   	ret
+ 539:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 540:	31 c0                	xor    %eax,%eax
+}
+ 542:	5d                   	pop    %ebp
+ 543:	c3                   	ret
+ 544:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 54b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 54f:	90                   	nop
+
+00000550 <memchr>:
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	8b 55 10             	mov    0x10(%ebp),%edx
+ 556:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 559:	85 d2                	test   %edx,%edx
+ 55b:	74 1b                	je     578 <memchr+0x28>
+    if(*p == (char)c)
+ 55d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+ 561:	01 c2                	add    %eax,%edx
+ 563:	eb 0a                	jmp    56f <memchr+0x1f>
+ 565:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+ 568:	83 c0 01             	add    $0x1,%eax
+ 56b:	39 c2                	cmp    %eax,%edx
+ 56d:	74 09                	je     578 <memchr+0x28>
+    if(*p == (char)c)
+ 56f:	38 08                	cmp    %cl,(%eax)
+ 571:	75 f5                	jne    568 <memchr+0x18>
+}
+ 573:	5d                   	pop    %ebp
+ 574:	c3                   	ret
+ 575:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+ 578:	31 c0                	xor    %eax,%eax
+}
+ 57a:	5d                   	pop    %ebp
+ 57b:	c3                   	ret
+ 57c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000580 <gets>:
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+ 584:	31 ff                	xor    %edi,%edi
+{
+ 586:	56                   	push   %esi
+ 587:	be e8 13 00 00       	mov    $0x13e8,%esi
+ 58c:	53                   	push   %ebx
+ 58d:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 590:	8b 46 fc             	mov    -0x4(%esi),%eax
+ 593:	85 c0                	test   %eax,%eax
+ 595:	7e 15                	jle    5ac <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 597:	83 ec 04             	sub    $0x4,%esp
+ 59a:	50                   	push   %eax
+ 59b:	56                   	push   %esi
+ 59c:	57                   	push   %edi
+ 59d:	e8 db 01 00 00       	call   77d <write>
+    ob[fd].n = 0;
+ 5a2:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+ 5a9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 5ac:	83 c7 01             	add    $0x1,%edi
+ 5af:	81 c6 08 01 00 00    	add    $0x108,%esi
+ 5b5:	83 ff 10             	cmp    $0x10,%edi
+ 5b8:	75 d6                	jne    590 <gets+0x10>
+  for(i=0; i+1 < max; ){
+ 5ba:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+ 5bc:	8d 75 e7             	lea    -0x19(%ebp),%esi
+ 5bf:	eb 2e                	jmp    5ef <gets+0x6f>
+ 5c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5c8:	83 ec 04             	sub    $0x4,%esp
+ 5cb:	6a 01                	push   $0x1
+ 5cd:	56                   	push   %esi
+ 5ce:	6a 00                	push   $0x0
+ 5d0:	e8 a1 01 00 00       	call   776 <read>
+    if(cc < 1)
+ 5d5:	83 c4 10             	add    $0x10,%esp
+ 5d8:	85 c0                	test   %eax,%eax
+ 5da:	7e 1d                	jle    5f9 <gets+0x79>
+    buf[i++] = c;
+ 5dc:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 5e0:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5e3:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 5e7:	3c 0a                	cmp    $0xa,%al
+ 5e9:	74 10                	je     5fb <gets+0x7b>
+ 5eb:	3c 0d                	cmp    $0xd,%al
+ 5ed:	74 0c                	je     5fb <gets+0x7b>
+  for(i=0; i+1 < max; ){
+ 5ef:	89 df                	mov    %ebx,%edi
+ 5f1:	83 c3 01             	add    $0x1,%ebx
+ 5f4:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 5f7:	7c cf                	jl     5c8 <gets+0x48>
+ 5f9:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 5fb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5fe:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 602:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 605:	5b                   	pop    %ebx
+ 606:	5e                   	pop    %esi
+ 607:	5f                   	pop    %edi
+ 608:	5d                   	pop    %ebp
+ 609:	c3                   	ret
+ 60a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000610 <stat>:
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	57                   	push   %edi
+ 614:	56                   	push   %esi
+ 615:	53                   	push   %ebx
+ 616:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+ 619:	6a 00                	push   $0x0
+ 61b:	ff 75 08             	push   0x8(%ebp)
+ 61e:	e8 76 01 00 00       	call   799 <open>
+  if(fd < 0)
+ 623:	83 c4 10             	add    $0x10,%esp
+ 626:	85 c0                	test   %eax,%eax
+ 628:	78 76                	js     6a0 <stat+0x90>
+  r = fstat(fd, st);
+ 62a:	83 ec 08             	sub    $0x8,%esp
+ 62d:	ff 75 0c             	push   0xc(%ebp)
+ 630:	89 c3                	mov    %eax,%ebx
+ 632:	50                   	push   %eax
+ 633:	e8 7f 01 00 00       	call   7b7 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 638:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 63b:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 63d:	83 fb 0f             	cmp    $0xf,%ebx
+ 640:	7f 40                	jg     682 <stat+0x72>
+ 642:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 648:	8b 90 e4 13 00 00    	mov    0x13e4(%eax),%edx
+ 64e:	8d b8 e0 13 00 00    	lea    0x13e0(%eax),%edi
+ 654:	85 d2                	test   %edx,%edx
+ 656:	7e 1a                	jle    672 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 658:	83 ec 04             	sub    $0x4,%esp
+ 65b:	05 e8 13 00 00       	add    $0x13e8,%eax
+ 660:	52                   	push   %edx
+ 661:	50                   	push   %eax
+ 662:	53                   	push   %ebx
+ 663:	e8 15 01 00 00       	call   77d <write>
+    ob[fd].n = 0;
+ 668:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+ 66f:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+ 672:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 678:	c7 80 e0 13 00 00 00 	movl   $0x0,0x13e0(%eax)
+ 67f:	00 00 00 
+  return _close(fd);
+ 682:	83 ec 0c             	sub    $0xc,%esp
+ 685:	53                   	push   %ebx
+ 686:	e8 f9 00 00 00       	call   784 <_close>
+ 68b:	83 c4 10             	add    $0x10,%esp
+}
+ 68e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 691:	89 f0                	mov    %esi,%eax
+ 693:	5b                   	pop    %ebx
+ 694:	5e                   	pop    %esi
+ 695:	5f                   	pop    %edi
+ 696:	5d                   	pop    %ebp
+ 697:	c3                   	ret
+ 698:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 69f:	90                   	nop
+    return -1;
+ 6a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 6a5:	eb e7                	jmp    68e <stat+0x7e>
+ 6a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ae:	66 90                	xchg   %ax,%ax
+
+000006b0 <atoi>:
+{
+ 6b0:	55                   	push   %ebp
+ 6b1:	89 e5                	mov    %esp,%ebp
+ 6b3:	53                   	push   %ebx
+ 6b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 6b7:	0f be 02             	movsbl (%edx),%eax
+ 6ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 6bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 6c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 6c5:	77 1e                	ja     6e5 <atoi+0x35>
+ 6c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 6d0:	83 c2 01             	add    $0x1,%edx
+ 6d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 6d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 6da:	0f be 02             	movsbl (%edx),%eax
+ 6dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 6e0:	80 fb 09             	cmp    $0x9,%bl
+ 6e3:	76 eb                	jbe    6d0 <atoi+0x20>
+}
+ 6e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 6e8:	89 c8                	mov    %ecx,%eax
+ 6ea:	c9                   	leave
+ 6eb:	c3                   	ret
+ 6ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006f0 <memmove>:
+{
+ 6f0:	55                   	push   %ebp
+ 6f1:	89 e5                	mov    %esp,%ebp
+ 6f3:	57                   	push   %edi
+ 6f4:	56                   	push   %esi
+ 6f5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 6f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 6fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 6fe:	85 c0                	test   %eax,%eax
+ 700:	7e 13                	jle    715 <memmove+0x25>
+ 702:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 704:	89 d7                	mov    %edx,%edi
+ 706:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 710:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 711:	39 f8                	cmp    %edi,%eax
+ 713:	75 fb                	jne    710 <memmove+0x20>
+  return vdst;
+}
+ 715:	5e                   	pop    %esi
+ 716:	89 d0                	mov    %edx,%eax
+ 718:	5f                   	pop    %edi
+ 719:	5d                   	pop    %ebp
+ 71a:	c3                   	ret
+
+0000071b <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+ 71b:	83 3d dc 13 00 00 00 	cmpl   $0x0,0x13dc
+  jle 1f
+ 722:	7e 0a                	jle    72e <syscallentry+0x13>
+  movl %esp, %ecx
+ 724:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 726:	ba 2d 07 00 00       	mov    $0x72d,%edx
+  sysenter
+ 72b:	0f 34                	sysenter
+2:
+  ret
+ 72d:	c3                   	ret
+1:
+  jl 3f
+ 72e:	7c 27                	jl     757 <syscallentry+0x3c>
+  pushal
+ 730:	60                   	pusha
+  movl $1, %eax
+ 731:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 736:	0f a2                	cpuid
+  movl $-1, sysentermode
+ 738:	c7 05 dc 13 00 00 ff 	movl   $0xffffffff,0x13dc
+ 73f:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 742:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+ 748:	74 0a                	je     754 <syscallentry+0x39>
+  movl $1, sysentermode
+ 74a:	c7 05 dc 13 00 00 01 	movl   $0x1,0x13dc
+ 751:	00 00 00 
+4:
+  popal
+ 754:	61                   	popa
+  jmp syscallentry
+ 755:	eb c4                	jmp    71b <syscallentry>
+3:
+  int $T_SYSCALL
+ 757:	cd 40                	int    $0x40
+  ret
+ 759:	c3                   	ret
+
+0000075a <_fork>:
+
+SYSCALLAS(_fork, fork)
+ 75a:	b8 01 00 00 00       	mov    $0x1,%eax
+ 75f:	eb ba                	jmp    71b <syscallentry>
+
+00000761 <_exit>:
+SYSCALLAS(_exit, exit)
+ 761:	b8 02 00 00 00       	mov    $0x2,%eax
+ 766:	eb b3                	jmp    71b <syscallentry>
+
+00000768 <wait>:
+SYSCALL(wait)
+ 768:	b8 03 00 00 00       	mov    $0x3,%eax
+ 76d:	eb ac                	jmp    71b <syscallentry>
+
+0000076f <pipe>:
+SYSCALL(pipe)
+ 76f:	b8 04 00 00 00       	mov    $0x4,%eax
+ 774:	eb a5                	jmp    71b <syscallentry>
+
+00000776 <read>:
+SYSCALL(read)
+ 776:	b8 05 00 00 00       	mov    $0x5,%eax
+ 77b:	eb 9e                	jmp    71b <syscallentry>
+
+0000077d <write>:
+SYSCALL(write)
+ 77d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 782:	eb 97                	jmp    71b <syscallentry>
+
+00000784 <_close>:
+SYSCALLAS(_close, close)
+ 784:	b8 15 00 00 00       	mov    $0x15,%eax
+ 789:	eb 90                	jmp    71b <syscallentry>
+
+0000078b <kill>:
+SYSCALL(kill)
+ 78b:	b8 06 00 00 00       	mov    $0x6,%eax
+ 790:	eb 89                	jmp    71b <syscallentry>
+
+00000792 <_exec>:
+SYSCALLAS(_exec, exec)
+ 792:	b8 07 00 00 00       	mov    $0x7,%eax
+ 797:	eb 82                	jmp    71b <syscallentry>
+
+00000799 <open>:
+SYSCALL(open)
+ 799:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 79e:	e9 78 ff ff ff       	jmp    71b <syscallentry>
+
+000007a3 <mknod>:
+SYSCALL(mknod)
+ 7a3:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7a8:	e9 6e ff ff ff       	jmp    71b <syscallentry>
+
+000007ad <unlink>:
+SYSCALL(unlink)
+ 7ad:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7b2:	e9 64 ff ff ff       	jmp    71b <syscallentry>
+
+000007b7 <fstat>:
+SYSCALL(fstat)
+ 7b7:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7bc:	e9 5a ff ff ff       	jmp    71b <syscallentry>
+
+000007c1 <link>:
+SYSCALL(link)
+ 7c1:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7c6:	e9 50 ff ff ff       	jmp    71b <syscallentry>
+
+000007cb <mkdir>:
+SYSCALL(mkdir)
+ 7cb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7d0:	e9 46 ff ff ff       	jmp    71b <syscallentry>
+
+000007d5 <chdir>:
+SYSCALL(chdir)
+ 7d5:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7da:	e9 3c ff ff ff       	jmp    71b <syscallentry>
+
+000007df <dup>:
+SYSCALL(dup)
+ 7df:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 7e4:	e9 32 ff ff ff       	jmp    71b <syscallentry>
+
+000007e9 <getpid>:
+SYSCALL(getpid)
+ 7e9:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 7ee:	e9 28 ff ff ff       	jmp    71b <syscallentry>
+
+000007f3 <sbrk>:
+SYSCALL(sbrk)
+ 7f3:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 7f8:	e9 1e ff ff ff       	jmp    71b <syscallentry>
+
+000007fd <sleep>:
+SYSCALL(sleep)
+ 7fd:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 802:	e9 14 ff ff ff       	jmp    71b <syscallentry>
+
+00000807 <uptime>:
+SYSCALL(uptime)
+ 807:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 80c:	e9 0a ff ff ff       	jmp    71b <syscallentry>
+
+00000811 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+ 811:	b8 16 00 00 00       	mov    $0x16,%eax
+ 816:	e9 00 ff ff ff       	jmp    71b <syscallentry>
+
+0000081b <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+ 81b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 820:	e9 f6 fe ff ff       	jmp    71b <syscallentry>
+
+00000825 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+ 825:	b8 18 00 00 00       	mov    $0x18,%eax
+ 82a:	e9 ec fe ff ff       	jmp    71b <syscallentry>
+
+0000082f <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+ 82f:	b8 19 00 00 00       	mov    $0x19,%eax
+ 834:	e9 e2 fe ff ff       	jmp    71b <syscallentry>
+
+00000839 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+ 839:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 83e:	e9 d8 fe ff ff       	jmp    71b <syscallentry>
+
+00000843 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+ 843:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 848:	e9 ce fe ff ff       	jmp    71b <syscallentry>
+
+0000084d <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+ 84d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 852:	e9 c4 fe ff ff       	jmp    71b <syscallentry>
+
+00000857 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+ 857:	b8 20 00 00 00       	mov    $0x20,%eax
+ 85c:	e9 ba fe ff ff       	jmp    71b <syscallentry>
+
+00000861 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+ 861:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 866:	e9 b0 fe ff ff       	jmp    71b <syscallentry>
+
+0000086b <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+ 86b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 870:	e9 a6 fe ff ff       	jmp    71b <syscallentry>
+
+00000875 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+ 875:	b8 21 00 00 00       	mov    $0x21,%eax
+ 87a:	e9 9c fe ff ff       	jmp    71b <syscallentry>
+
+0000087f <yield>:
+SYSCALL(yield) // yield the CPU to another process
+ 87f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 884:	e9 92 fe ff ff       	jmp    71b <syscallentry>
+
+00000889 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+ 889:	b8 23 00 00 00       	mov    $0x23,%eax
+ 88e:	e9 88 fe ff ff       	jmp    71b <syscallentry>
+
+00000893 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+ 893:	b8 24 00 00 00       	mov    $0x24,%eax
+ 898:	e9 7e fe ff ff       	jmp    71b <syscallentry>
+
+0000089d <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+ 89d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 8a2:	e9 74 fe ff ff       	jmp    71b <syscallentry>
+
+000008a7 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+ 8a7:	b8 26 00 00 00       	mov    $0x26,%eax
+ 8ac:	e9 6a fe ff ff       	jmp    71b <syscallentry>
+
+000008b1 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+ 8b1:	b8 27 00 00 00       	mov    $0x27,%eax
+ 8b6:	e9 60 fe ff ff       	jmp    71b <syscallentry>
+
+000008bb <mmap>:
+SYSCALL(mmap) // map a file into memory
+ 8bb:	b8 28 00 00 00       	mov    $0x28,%eax
+ 8c0:	e9 56 fe ff ff       	jmp    71b <syscallentry>
+
+000008c5 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+ 8c5:	b8 29 00 00 00       	mov    $0x29,%eax
+ 8ca:	e9 4c fe ff ff       	jmp    71b <syscallentry>
+
+000008cf <readv>:
+SYSCALL(readv) // read into several buffers
+ 8cf:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 8d4:	e9 42 fe ff ff       	jmp    71b <syscallentry>
+
+000008d9 <writev>:
+SYSCALL(writev) // write from several buffers
+ 8d9:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 8de:	e9 38 fe ff ff       	jmp    71b <syscallentry>
+
+000008e3 <pread>:
+SYSCALL(pread) // read at an offset
+ 8e3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 8e8:	e9 2e fe ff ff       	jmp    71b <syscallentry>
+
+000008ed <pwrite>:
+SYSCALL(pwrite) // write at an offset
+ 8ed:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 8f2:	e9 24 fe ff ff       	jmp    71b <syscallentry>
+
+000008f7 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+ 8f7:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 8fc:	e9 1a fe ff ff       	jmp    71b <syscallentry>
+
+00000901 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+ 901:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 906:	e9 10 fe ff ff       	jmp    71b <syscallentry>
+
+0000090b <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+ 90b:	b8 30 00 00 00       	mov    $0x30,%eax
+ 910:	e9 06 fe ff ff       	jmp    71b <syscallentry>
+
+00000915 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+ 915:	b8 31 00 00 00       	mov    $0x31,%eax
+ 91a:	e9 fc fd ff ff       	jmp    71b <syscallentry>
+
+0000091f <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+ 91f:	b8 32 00 00 00       	mov    $0x32,%eax
+ 924:	e9 f2 fd ff ff       	jmp    71b <syscallentry>
+
+00000929 <profread>:
+SYSCALL(profread) // drain profiler samples
+ 929:	b8 33 00 00 00       	mov    $0x33,%eax
+ 92e:	e9 e8 fd ff ff       	jmp    71b <syscallentry>
+
+00000933 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+ 933:	b8 34 00 00 00       	mov    $0x34,%eax
+ 938:	e9 de fd ff ff       	jmp    71b <syscallentry>
+
+0000093d <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+ 93d:	b8 35 00 00 00       	mov    $0x35,%eax
+ 942:	e9 d4 fd ff ff       	jmp    71b <syscallentry>
+
+00000947 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+ 947:	b8 36 00 00 00       	mov    $0x36,%eax
+ 94c:	e9 ca fd ff ff       	jmp    71b <syscallentry>
+
+00000951 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+ 951:	b8 37 00 00 00       	mov    $0x37,%eax
+ 956:	e9 c0 fd ff ff       	jmp    71b <syscallentry>
+ 95b:	66 90                	xchg   %ax,%ax
+ 95d:	66 90                	xchg   %ax,%ax
+ 95f:	90                   	nop
+
+00000960 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 960:	55                   	push   %ebp
+ 961:	89 e5                	mov    %esp,%ebp
+ 963:	57                   	push   %edi
+ 964:	56                   	push   %esi
+ 965:	53                   	push   %ebx
+ 966:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 968:	89 d1                	mov    %edx,%ecx
+{
+ 96a:	83 ec 3c             	sub    $0x3c,%esp
+ 96d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 970:	85 d2                	test   %edx,%edx
+ 972:	0f 89 80 00 00 00    	jns    9f8 <printint+0x98>
+ 978:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 97c:	74 7a                	je     9f8 <printint+0x98>
+    x = -xx;
+ 97e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 980:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 985:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 988:	31 f6                	xor    %esi,%esi
+ 98a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 990:	89 c8                	mov    %ecx,%eax
+ 992:	31 d2                	xor    %edx,%edx
+ 994:	89 f7                	mov    %esi,%edi
+ 996:	f7 f3                	div    %ebx
+ 998:	8d 76 01             	lea    0x1(%esi),%esi
+ 99b:	0f b6 92 4c 0f 00 00 	movzbl 0xf4c(%edx),%edx
+ 9a2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 9a6:	89 ca                	mov    %ecx,%edx
+ 9a8:	89 c1                	mov    %eax,%ecx
+ 9aa:	39 da                	cmp    %ebx,%edx
+ 9ac:	73 e2                	jae    990 <printint+0x30>
+  if(neg)
+ 9ae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 9b1:	85 c0                	test   %eax,%eax
+ 9b3:	74 07                	je     9bc <printint+0x5c>
+    buf[i++] = '-';
+ 9b5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 9ba:	89 f7                	mov    %esi,%edi
+ 9bc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 9bf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 9c2:	01 df                	add    %ebx,%edi
+ 9c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 9c8:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+ 9cb:	83 ec 04             	sub    $0x4,%esp
+ 9ce:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 9d1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 9d4:	6a 01                	push   $0x1
+ 9d6:	50                   	push   %eax
+ 9d7:	56                   	push   %esi
+ 9d8:	e8 e3 f6 ff ff       	call   c0 <bufwrite>
+  while(--i >= 0)
+ 9dd:	89 f8                	mov    %edi,%eax
+ 9df:	83 c4 10             	add    $0x10,%esp
+ 9e2:	83 ef 01             	sub    $0x1,%edi
+ 9e5:	39 d8                	cmp    %ebx,%eax
+ 9e7:	75 df                	jne    9c8 <printint+0x68>
+}
+ 9e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9ec:	5b                   	pop    %ebx
+ 9ed:	5e                   	pop    %esi
+ 9ee:	5f                   	pop    %edi
+ 9ef:	5d                   	pop    %ebp
+ 9f0:	c3                   	ret
+ 9f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 9f8:	31 c0                	xor    %eax,%eax
+ 9fa:	eb 89                	jmp    985 <printint+0x25>
+ 9fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a00 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ a00:	55                   	push   %ebp
+ a01:	89 e5                	mov    %esp,%ebp
+ a03:	57                   	push   %edi
+ a04:	56                   	push   %esi
+ a05:	53                   	push   %ebx
+ a06:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ a09:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a0c:	0f b6 18             	movzbl (%eax),%ebx
+ a0f:	84 db                	test   %bl,%bl
+ a11:	74 6c                	je     a7f <printf+0x7f>
+ a13:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+ a16:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ a19:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ a1b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ a1e:	eb 26                	jmp    a46 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ a20:	83 f8 25             	cmp    $0x25,%eax
+ a23:	74 4b                	je     a70 <printf+0x70>
+  bufwrite(fd, &c, 1);
+ a25:	83 ec 04             	sub    $0x4,%esp
+ a28:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ a2b:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ a2e:	6a 01                	push   $0x1
+ a30:	50                   	push   %eax
+ a31:	ff 75 08             	push   0x8(%ebp)
+ a34:	e8 87 f6 ff ff       	call   c0 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+ a39:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ a3c:	0f b6 1f             	movzbl (%edi),%ebx
+ a3f:	83 c7 01             	add    $0x1,%edi
+ a42:	84 db                	test   %bl,%bl
+ a44:	74 39                	je     a7f <printf+0x7f>
+    c = fmt[i] & 0xff;
+ a46:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ a49:	85 f6                	test   %esi,%esi
+ a4b:	74 d3                	je     a20 <printf+0x20>
+      }
+    } else if(state == '%'){
+ a4d:	83 fe 25             	cmp    $0x25,%esi
+ a50:	75 ea                	jne    a3c <printf+0x3c>
+      if(c == 'd'){
+ a52:	83 f8 25             	cmp    $0x25,%eax
+ a55:	0f 84 d5 01 00 00    	je     c30 <printf+0x230>
+ a5b:	83 e8 63             	sub    $0x63,%eax
+ a5e:	83 f8 15             	cmp    $0x15,%eax
+ a61:	77 45                	ja     aa8 <printf+0xa8>
+ a63:	ff 24 85 f4 0e 00 00 	jmp    *0xef4(,%eax,4)
+ a6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+ a70:	0f b6 1f             	movzbl (%edi),%ebx
+ a73:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+ a76:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ a7b:	84 db                	test   %bl,%bl
+ a7d:	75 c7                	jne    a46 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+ a7f:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+ a83:	74 0b                	je     a90 <printf+0x90>
+    fflush(fd);
+}
+ a85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a88:	5b                   	pop    %ebx
+ a89:	5e                   	pop    %esi
+ a8a:	5f                   	pop    %edi
+ a8b:	5d                   	pop    %ebp
+ a8c:	c3                   	ret
+ a8d:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+ a90:	83 ec 0c             	sub    $0xc,%esp
+ a93:	6a 02                	push   $0x2
+ a95:	e8 c6 f7 ff ff       	call   260 <fflush>
+ a9a:	83 c4 10             	add    $0x10,%esp
+}
+ a9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ aa0:	5b                   	pop    %ebx
+ aa1:	5e                   	pop    %esi
+ aa2:	5f                   	pop    %edi
+ aa3:	5d                   	pop    %ebp
+ aa4:	c3                   	ret
+ aa5:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+ aa8:	83 ec 04             	sub    $0x4,%esp
+ aab:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ aae:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+ ab2:	6a 01                	push   $0x1
+ ab4:	52                   	push   %edx
+ ab5:	89 55 c0             	mov    %edx,-0x40(%ebp)
+ ab8:	ff 75 08             	push   0x8(%ebp)
+ abb:	e8 00 f6 ff ff       	call   c0 <bufwrite>
+ ac0:	83 c4 0c             	add    $0xc,%esp
+ ac3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ ac6:	6a 01                	push   $0x1
+ ac8:	8b 55 c0             	mov    -0x40(%ebp),%edx
+ acb:	52                   	push   %edx
+      state = 0;
+ acc:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+ ace:	ff 75 08             	push   0x8(%ebp)
+ ad1:	e8 ea f5 ff ff       	call   c0 <bufwrite>
+        putc(fd, c);
+ ad6:	83 c4 10             	add    $0x10,%esp
+ ad9:	e9 5e ff ff ff       	jmp    a3c <printf+0x3c>
+ ade:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+ ae0:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ ae3:	83 ec 0c             	sub    $0xc,%esp
+ ae6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ aeb:	8b 16                	mov    (%esi),%edx
+ aed:	6a 00                	push   $0x0
+ aef:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+ af2:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+ af5:	e8 66 fe ff ff       	call   960 <printint>
+        ap++;
+ afa:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ afd:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b00:	31 f6                	xor    %esi,%esi
+ b02:	e9 35 ff ff ff       	jmp    a3c <printf+0x3c>
+ b07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b0e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+ b10:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ b13:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ b15:	83 c0 04             	add    $0x4,%eax
+ b18:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+ b1b:	b8 eb 0e 00 00       	mov    $0xeeb,%eax
+ b20:	85 db                	test   %ebx,%ebx
+ b22:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+ b25:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+ b28:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+ b2a:	53                   	push   %ebx
+ b2b:	e8 90 f9 ff ff       	call   4c0 <strlen>
+ b30:	83 c4 0c             	add    $0xc,%esp
+ b33:	50                   	push   %eax
+ b34:	53                   	push   %ebx
+ b35:	ff 75 08             	push   0x8(%ebp)
+ b38:	e8 83 f5 ff ff       	call   c0 <bufwrite>
+ b3d:	83 c4 10             	add    $0x10,%esp
+ b40:	e9 f7 fe ff ff       	jmp    a3c <printf+0x3c>
+ b45:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ b48:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+ b4b:	83 ec 04             	sub    $0x4,%esp
+ b4e:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+ b51:	8b 06                	mov    (%esi),%eax
+        ap++;
+ b53:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+ b56:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+ b59:	6a 01                	push   $0x1
+ b5b:	52                   	push   %edx
+ b5c:	ff 75 08             	push   0x8(%ebp)
+ b5f:	e8 5c f5 ff ff       	call   c0 <bufwrite>
+        ap++;
+ b64:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ b67:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b6a:	31 f6                	xor    %esi,%esi
+ b6c:	e9 cb fe ff ff       	jmp    a3c <printf+0x3c>
+ b71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+ b78:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ b7b:	83 ec 0c             	sub    $0xc,%esp
+ b7e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ b83:	8b 16                	mov    (%esi),%edx
+ b85:	6a 01                	push   $0x1
+ b87:	e9 63 ff ff ff       	jmp    aef <printf+0xef>
+ b8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+ b90:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ b93:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ b96:	89 7d c0             	mov    %edi,-0x40(%ebp)
+ b99:	89 55 bc             	mov    %edx,-0x44(%ebp)
+ b9c:	8b 18                	mov    (%eax),%ebx
+ b9e:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+ ba1:	31 c0                	xor    %eax,%eax
+ ba3:	89 c7                	mov    %eax,%edi
+ ba5:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+ ba8:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+ bad:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+ baf:	f7 e1                	mul    %ecx
+ bb1:	c1 ea 03             	shr    $0x3,%edx
+ bb4:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ bb7:	89 d1                	mov    %edx,%ecx
+ bb9:	01 c0                	add    %eax,%eax
+ bbb:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ bbd:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+ bbf:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ bc1:	be 0a 00 00 00       	mov    $0xa,%esi
+ bc6:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+ bc8:	89 da                	mov    %ebx,%edx
+ bca:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+ bcc:	89 fe                	mov    %edi,%esi
+ bce:	83 c7 01             	add    $0x1,%edi
+ bd1:	8d 42 30             	lea    0x30(%edx),%eax
+ bd4:	89 da                	mov    %ebx,%edx
+ bd6:	8d 14 92             	lea    (%edx,%edx,4),%edx
+ bd9:	01 d2                	add    %edx,%edx
+ bdb:	29 d0                	sub    %edx,%eax
+ bdd:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+ be1:	89 c8                	mov    %ecx,%eax
+ be3:	09 d8                	or     %ebx,%eax
+ be5:	75 c1                	jne    ba8 <printf+0x1a8>
+ be7:	8b 55 bc             	mov    -0x44(%ebp),%edx
+ bea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ bed:	01 d6                	add    %edx,%esi
+ bef:	89 f7                	mov    %esi,%edi
+ bf1:	89 d6                	mov    %edx,%esi
+ bf3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ bf7:	90                   	nop
+    putc(fd, buf[i]);
+ bf8:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+ bfb:	83 ec 04             	sub    $0x4,%esp
+ bfe:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+ c01:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+ c04:	6a 01                	push   $0x1
+ c06:	50                   	push   %eax
+ c07:	53                   	push   %ebx
+ c08:	e8 b3 f4 ff ff       	call   c0 <bufwrite>
+  while(--i >= 0)
+ c0d:	89 fa                	mov    %edi,%edx
+ c0f:	83 c4 10             	add    $0x10,%esp
+ c12:	83 ef 01             	sub    $0x1,%edi
+ c15:	39 d6                	cmp    %edx,%esi
+ c17:	75 df                	jne    bf8 <printf+0x1f8>
+        ap += 2;
+ c19:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+ c1d:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+ c20:	31 f6                	xor    %esi,%esi
+ c22:	e9 15 fe ff ff       	jmp    a3c <printf+0x3c>
+ c27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c2e:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+ c30:	83 ec 04             	sub    $0x4,%esp
+ c33:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ c36:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ c39:	6a 01                	push   $0x1
+ c3b:	e9 8b fe ff ff       	jmp    acb <printf+0xcb>
+
+00000c40 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ c40:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c41:	a1 60 24 00 00       	mov    0x2460,%eax
+{
+ c46:	89 e5                	mov    %esp,%ebp
+ c48:	57                   	push   %edi
+ c49:	56                   	push   %esi
+ c4a:	53                   	push   %ebx
+ c4b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ c4e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c58:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c5a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c5c:	39 ca                	cmp    %ecx,%edx
+ c5e:	73 30                	jae    c90 <free+0x50>
+ c60:	39 c1                	cmp    %eax,%ecx
+ c62:	72 04                	jb     c68 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c64:	39 c2                	cmp    %eax,%edx
+ c66:	72 f0                	jb     c58 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ c68:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ c6b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ c6e:	39 f8                	cmp    %edi,%eax
+ c70:	74 2e                	je     ca0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c72:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ c75:	8b 42 04             	mov    0x4(%edx),%eax
+ c78:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c7b:	39 f1                	cmp    %esi,%ecx
+ c7d:	74 38                	je     cb7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ c7f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ c81:	5b                   	pop    %ebx
+  freep = p;
+ c82:	89 15 60 24 00 00    	mov    %edx,0x2460
+}
+ c88:	5e                   	pop    %esi
+ c89:	5f                   	pop    %edi
+ c8a:	5d                   	pop    %ebp
+ c8b:	c3                   	ret
+ c8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c90:	39 c1                	cmp    %eax,%ecx
+ c92:	72 d0                	jb     c64 <free+0x24>
+ c94:	eb c2                	jmp    c58 <free+0x18>
+ c96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c9d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ ca0:	03 70 04             	add    0x4(%eax),%esi
+ ca3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ca6:	8b 02                	mov    (%edx),%eax
+ ca8:	8b 00                	mov    (%eax),%eax
+ caa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ cad:	8b 42 04             	mov    0x4(%edx),%eax
+ cb0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ cb3:	39 f1                	cmp    %esi,%ecx
+ cb5:	75 c8                	jne    c7f <free+0x3f>
+    p->s.size += bp->s.size;
+ cb7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ cba:	89 15 60 24 00 00    	mov    %edx,0x2460
+    p->s.size += bp->s.size;
+ cc0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ cc3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ cc6:	89 0a                	mov    %ecx,(%edx)
+}
+ cc8:	5b                   	pop    %ebx
+ cc9:	5e                   	pop    %esi
+ cca:	5f                   	pop    %edi
+ ccb:	5d                   	pop    %ebp
+ ccc:	c3                   	ret
+ ccd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000cd0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ cd0:	55                   	push   %ebp
+ cd1:	89 e5                	mov    %esp,%ebp
+ cd3:	57                   	push   %edi
+ cd4:	56                   	push   %esi
+ cd5:	53                   	push   %ebx
+ cd6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ cd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ cdc:	8b 15 60 24 00 00    	mov    0x2460,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ce2:	8d 78 07             	lea    0x7(%eax),%edi
+ ce5:	c1 ef 03             	shr    $0x3,%edi
+ ce8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ ceb:	85 d2                	test   %edx,%edx
+ ced:	0f 84 8d 00 00 00    	je     d80 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cf3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ cf5:	8b 48 04             	mov    0x4(%eax),%ecx
+ cf8:	39 f9                	cmp    %edi,%ecx
+ cfa:	73 64                	jae    d60 <malloc+0x90>
+  if(nu < 4096)
+ cfc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ d01:	39 df                	cmp    %ebx,%edi
+ d03:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ d06:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ d0d:	eb 0a                	jmp    d19 <malloc+0x49>
+ d0f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d10:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d12:	8b 48 04             	mov    0x4(%eax),%ecx
+ d15:	39 f9                	cmp    %edi,%ecx
+ d17:	73 47                	jae    d60 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ d19:	89 c2                	mov    %eax,%edx
+ d1b:	39 05 60 24 00 00    	cmp    %eax,0x2460
+ d21:	75 ed                	jne    d10 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ d23:	83 ec 0c             	sub    $0xc,%esp
+ d26:	56                   	push   %esi
+ d27:	e8 c7 fa ff ff       	call   7f3 <sbrk>
+  if(p == (char*)-1)
+ d2c:	83 c4 10             	add    $0x10,%esp
+ d2f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ d32:	74 1c                	je     d50 <malloc+0x80>
+  hp->s.size = nu;
+ d34:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ d37:	83 ec 0c             	sub    $0xc,%esp
+ d3a:	83 c0 08             	add    $0x8,%eax
+ d3d:	50                   	push   %eax
+ d3e:	e8 fd fe ff ff       	call   c40 <free>
+  return freep;
+ d43:	8b 15 60 24 00 00    	mov    0x2460,%edx
+      if((p = morecore(nunits)) == 0)
+ d49:	83 c4 10             	add    $0x10,%esp
+ d4c:	85 d2                	test   %edx,%edx
+ d4e:	75 c0                	jne    d10 <malloc+0x40>
+        return 0;
+  }
+}
+ d50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ d53:	31 c0                	xor    %eax,%eax
+}
+ d55:	5b                   	pop    %ebx
+ d56:	5e                   	pop    %esi
+ d57:	5f                   	pop    %edi
+ d58:	5d                   	pop    %ebp
+ d59:	c3                   	ret
+ d5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ d60:	39 cf                	cmp    %ecx,%edi
+ d62:	74 4c                	je     db0 <malloc+0xe0>
+        p->s.size -= nunits;
+ d64:	29 f9                	sub    %edi,%ecx
+ d66:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ d69:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ d6c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ d6f:	89 15 60 24 00 00    	mov    %edx,0x2460
+}
+ d75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ d78:	83 c0 08             	add    $0x8,%eax
+}
+ d7b:	5b                   	pop    %ebx
+ d7c:	5e                   	pop    %esi
+ d7d:	5f                   	pop    %edi
+ d7e:	5d                   	pop    %ebp
+ d7f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ d80:	c7 05 60 24 00 00 64 	movl   $0x2464,0x2460
+ d87:	24 00 00 
+    base.s.size = 0;
+ d8a:	b8 64 24 00 00       	mov    $0x2464,%eax
+    base.s.ptr = freep = prevp = &base;
+ d8f:	c7 05 64 24 00 00 64 	movl   $0x2464,0x2464
+ d96:	24 00 00 
+    base.s.size = 0;
+ d99:	c7 05 68 24 00 00 00 	movl   $0x0,0x2468
+ da0:	00 00 00 
+    if(p->s.size >= nunits){
+ da3:	e9 54 ff ff ff       	jmp    cfc <malloc+0x2c>
+ da8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ daf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ db0:	8b 08                	mov    (%eax),%ecx
+ db2:	89 0a                	mov    %ecx,(%edx)
+ db4:	eb b9                	jmp    d6f <malloc+0x9f>
+ db6:	66 90                	xchg   %ax,%ax
+ db8:	66 90                	xchg   %ax,%ax
+ dba:	66 90                	xchg   %ax,%ax
+ dbc:	66 90                	xchg   %ax,%ax
+ dbe:	66 90                	xchg   %ax,%ax
+
+00000dc0 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+ dc0:	55                   	push   %ebp
+ dc1:	89 e5                	mov    %esp,%ebp
+ dc3:	57                   	push   %edi
+ dc4:	56                   	push   %esi
+ dc5:	be 01 00 00 00       	mov    $0x1,%esi
+ dca:	53                   	push   %ebx
+ dcb:	83 ec 28             	sub    $0x28,%esp
+ dce:	8b 45 0c             	mov    0xc(%ebp),%eax
+ dd1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ dd4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+ dd7:	68 00 98 00 00       	push   $0x9800
+ ddc:	e8 ef fe ff ff       	call   cd0 <malloc>
+ de1:	83 c4 10             	add    $0x10,%esp
+ de4:	89 c7                	mov    %eax,%edi
+ de6:	85 c0                	test   %eax,%eax
+ de8:	74 62                	je     e4c <waitpoll+0x8c>
+ dea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+ df0:	83 ec 0c             	sub    $0xc,%esp
+ df3:	6a 01                	push   $0x1
+ df5:	e8 03 fa ff ff       	call   7fd <sleep>
+    fn();
+ dfa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ dfd:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+ dff:	58                   	pop    %eax
+ e00:	5a                   	pop    %edx
+ e01:	68 00 02 00 00       	push   $0x200
+ e06:	57                   	push   %edi
+ e07:	e8 eb fa ff ff       	call   8f7 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+ e0c:	83 c4 10             	add    $0x10,%esp
+ e0f:	85 c0                	test   %eax,%eax
+ e11:	7e 2d                	jle    e40 <waitpoll+0x80>
+ e13:	6b c0 4c             	imul   $0x4c,%eax,%eax
+ e16:	89 fa                	mov    %edi,%edx
+    alive = 0;
+ e18:	31 c9                	xor    %ecx,%ecx
+ e1a:	01 f8                	add    %edi,%eax
+ e1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+ e20:	3b 1a                	cmp    (%edx),%ebx
+ e22:	75 07                	jne    e2b <waitpoll+0x6b>
+        alive = 1;
+ e24:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+ e28:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+ e2b:	83 c2 4c             	add    $0x4c,%edx
+ e2e:	39 d0                	cmp    %edx,%eax
+ e30:	75 ee                	jne    e20 <waitpoll+0x60>
+  } while(alive);
+ e32:	85 c9                	test   %ecx,%ecx
+ e34:	75 ba                	jne    df0 <waitpoll+0x30>
+ e36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e3d:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+ e40:	83 ec 0c             	sub    $0xc,%esp
+ e43:	57                   	push   %edi
+ e44:	e8 f7 fd ff ff       	call   c40 <free>
+  wait();
+ e49:	83 c4 10             	add    $0x10,%esp
+}
+ e4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e4f:	5b                   	pop    %ebx
+ e50:	5e                   	pop    %esi
+ e51:	5f                   	pop    %edi
+ e52:	5d                   	pop    %ebp
+  wait();
+ e53:	e9 10 f9 ff ff       	jmp    768 <wait>
+ e58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e5f:	90                   	nop
+
+00000e60 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+ e60:	55                   	push   %ebp
+ e61:	89 e5                	mov    %esp,%ebp
+ e63:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+ e66:	c7 45 f0 5d 0f 00 00 	movl   $0xf5d,-0x10(%ebp)
+ e6d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+ e74:	e8 87 f4 ff ff       	call   300 <fork>
+ e79:	85 c0                	test   %eax,%eax
+ e7b:	78 09                	js     e86 <runps+0x26>
+    return -1;
+  if(pid == 0){
+ e7d:	74 0e                	je     e8d <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+ e7f:	e8 e4 f8 ff ff       	call   768 <wait>
+}
+ e84:	c9                   	leave
+ e85:	c3                   	ret
+ e86:	c9                   	leave
+    return -1;
+ e87:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ e8c:	c3                   	ret
+    exec("ps", argv);
+ e8d:	50                   	push   %eax
+ e8e:	50                   	push   %eax
+ e8f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ e92:	50                   	push   %eax
+ e93:	68 5d 0f 00 00       	push   $0xf5d
+ e98:	e8 c3 f4 ff ff       	call   360 <exec>
+    printf(2, "exec ps failed\n");
+ e9d:	5a                   	pop    %edx
+ e9e:	59                   	pop    %ecx
+ e9f:	68 60 0f 00 00       	push   $0xf60
+ ea4:	6a 02                	push   $0x2
+ ea6:	e8 55 fb ff ff       	call   a00 <printf>
+    exit();
+ eab:	e8 a0 f4 ff ff       	call   350 <exit>
@@ -20,7 +20,8 @@
 // Disk layout:
 // [ boot block | sb block | log | inode blocks | free bit map | data blocks ]
 
-int nbitmap = FSSIZE/(BSIZE*8) + 1;
+int fssize = FSSIZE;  // blocks in this image, at most FSSIZE
+int nbitmap;
 int ninodeblocks = NINODES / IPB + 1;
 int nlog = LOGSIZE;
 int nmeta;    // Number of meta blocks (boot, sb, nlog, inode, bitmap)
@@ -76,8 +77,13 @@ main(int argc, char *argv[])
 
   static_assert(sizeof(int) == 4, "Integers must be 4 bytes!");
 
-  if(argc < 2){
-    fprintf(stderr, "Usage: mkfs fs.img files...\n");
+  if(argc > 2 && strcmp(argv[1], "-s") == 0){
+    fssize = atoi(argv[2]);
+    argc -= 2;
+    argv += 2;
+  }
+  if(argc < 2 || fssize <= 0 || fssize > FSSIZE){
+    fprintf(stderr, "Usage: mkfs [-s blocks] fs.img files...\n");
     exit(1);
   }
 
@@ -91,10 +97,11 @@ main(int argc, char *argv[])
   }
 
   // 1 fs block = 1 disk sector
+  nbitmap = fssize/(BSIZE*8) + 1;
   nmeta = 2 + nlog + ninodeblocks + nbitmap;
-  nblocks = FSSIZE - nmeta;
+  nblocks = fssize - nmeta;
 
-  sb.size = xint(FSSIZE);
+  sb.size = xint(fssize);
   sb.nblocks = xint(nblocks);
   sb.ninodes = xint(NINODES);
   sb.nlog = xint(nlog);
@@ -103,11 +110,11 @@ main(int argc, char *argv[])
   sb.bmapstart = xint(2+nlog+ninodeblocks);
 
   printf("nmeta %d (boot, super, log blocks %u inode blocks %u, bitmap blocks %u) blocks %d total %d\n",
-         nmeta, nlog, ninodeblocks, nbitmap, nblocks, FSSIZE);
+         nmeta, nlog, ninodeblocks, nbitmap, nblocks, fssize);
 
   freeblock = nmeta;     // the first free block that we can allocate
 
-  for(i = 0; i < FSSIZE; i++)
+  for(i = 0; i < fssize; i++)
     wsect(i, zeroes);
 
   memset(buf, 0, sizeof(buf));
@@ -238,20 +245,67 @@ void
 balloc(int used)
 {
   uchar buf[BSIZE];
-  int i;
+  int i, b;
 
   printf("balloc: first %d blocks have been allocated\n", used);
-  assert(used < BSIZE*8);
-  bzero(buf, BSIZE);
-  for(i = 0; i < used; i++){
-    buf[i/8] = buf[i/8] | (0x1 << (i%8));
+  assert(used < nbitmap*BPB);
+  for(b = 0; b < used; b += BPB){
+    bzero(buf, BSIZE);
+    for(i = 0; i < BPB && b + i < used; i++){
+      buf[i/8] = buf[i/8] | (0x1 << (i%8));
+    }
+    printf("balloc: write bitmap block at sector %d\n", sb.bmapstart + b/BPB);
+    wsect(sb.bmapstart + b/BPB, buf);
   }
-  printf("balloc: write bitmap block at sector %d\n", sb.bmapstart);
-  wsect(sb.bmapstart, buf);
 }
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 
+// Return the address of block fbn of din, allocating
+// it and any indirect blocks on the way if necessary.
+uint
+bmap(struct dinode *din, uint fbn)
+{
+  uint indirect[NINDIRECT];
+  uint addr, div, i;
+  int root, depth;
+
+  if(fbn < NDIRECT){
+    if(xint(din->addrs[fbn]) == 0)
+      din->addrs[fbn] = xint(freeblock++);
+    return xint(din->addrs[fbn]);
+  }
+  fbn -= NDIRECT;
+  if(fbn < NINDIRECT){
+    root = NDIRECT;
+    depth = 1;
+    div = 1;
+  } else if(fbn - NINDIRECT < NDINDIRECT){
+    fbn -= NINDIRECT;
+    root = NDIRECT+1;
+    depth = 2;
+    div = NINDIRECT;
+  } else {
+    fbn -= NINDIRECT + NDINDIRECT;
+    root = NDIRECT+2;
+    depth = 3;
+    div = NDINDIRECT;
+  }
+  if(xint(din->addrs[root]) == 0)
+    din->addrs[root] = xint(freeblock++);
+  addr = xint(din->addrs[root]);
+  for(; depth > 0; depth--, div /= NINDIRECT){
+    rsect(addr, (char*)indirect);
+    i = fbn / div % NINDIRECT;
+    if(indirect[i] == 0){
+      indirect[i] = xint(freeblock++);
+      wsect(addr, (char*)indirect);
+    }
+    addr = xint(indirect[i]);
+  }
+  return addr;
+}
+
 void
 iappend(uint inum, void *xp, int n)
 {
@@ -259,7 +313,6 @@ iappend(uint inum, void *xp, int n)
   uint fbn, off, n1;
   struct dinode din;
   char buf[BSIZE];
-  uint indirect[NINDIRECT];
   uint x;
 
   rinode(inum, &din);
@@ -268,22 +321,7 @@ iappend(uint inum, void *xp, int n)
   while(n > 0){
     fbn = off / BSIZE;
     assert(fbn < MAXFILE);
-    if(fbn < NDIRECT){
-      if(xint(din.addrs[fbn]) == 0){
-        din.addrs[fbn] = xint(freeblock++);
-      }
-      x = xint(din.addrs[fbn]);
-    } else {
-      if(xint(din.addrs[NDIRECT]) == 0){
-        din.addrs[NDIRECT] = xint(freeblock++);
-      }
-      rsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      if(indirect[fbn - NDIRECT] == 0){
-        indirect[fbn - NDIRECT] = xint(freeblock++);
-        wsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      }
-      x = xint(indirect[fbn-NDIRECT]);
-    }
+    x = bmap(&din, fbn);
     n1 = min(n, (fbn + 1) * BSIZE - off);
     rsect(x, buf);
     bcopy(p, buf + off - (fbn * BSIZE), n1);
@@ -0,0 +1,424 @@
+// Memory-mapped files.
+//
+// mmap() reserves a range of user addresses from MMAPBASE up and
+// records it in one of the process's vmas; no page is mapped
+// until the process touches it. mmapfault() then reads that page
+// of the file, through the buffer cache, into a page.
+//
+// A MAP_PRIVATE mapping gets a page of its own. All MAP_SHARED
+// mappings of a page of a file, in any process, map one shared
+// page, kept in spages, so they see each other's stores at once.
+// write() to the file also updates the shared pages it covers
+// (see mmapsync()), so a shared page is always the file's newest
+// contents. A mapping that has stored to a page (the hardware
+// sets PTE_D) writes all of it back to the file, through the
+// log, when it unmaps it: by munmap(), exec() or exit(). Until
+// then, read() still sees the file without those stores.
+//
+// A fork()ed child maps its parent's shared pages and gets copies
+// of its private ones, and its own reference to the file.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "memlayout.h"
+#include "x86.h"
+#include "proc.h"
+#include "fs.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "file.h"
+#include "fcntl.h"
+
+// A page of a file that MAP_SHARED mappings have faulted in.
+struct spage {
+  struct inode *ip;   // The file; held by the mappings' files
+  uint off;           // Page-aligned offset in the file
+  char *mem;
+  int ref;            // Mappings of it; 0 if the slot is free
+};
+
+struct {
+  struct spinlock lock;
+  struct spage page[NSPAGE];
+  int n;              // Slots in use
+} spages;
+
+void
+mmapinit(void)
+{
+  initlock(&spages.lock, "spages");
+}
+
+// The shared page for off of ip, or 0. Caller must hold spages.lock.
+static struct spage*
+spfind(struct inode *ip, uint off)
+{
+  struct spage *s;
+
+  for(s = spages.page; s < &spages.page[NSPAGE]; s++)
+    if(s->ref && s->ip == ip && s->off == off)
+      return s;
+  return 0;
+}
+
+// Take a reference to the shared page for off of ip, reading
+// it in if no mapping has it. Returns the page, or 0.
+// Caller must hold ip->lock, which keeps other faults from
+// seeing the page before it is read.
+static char*
+spget(struct inode *ip, uint off)
+{
+  struct spage *s;
+  char *mem;
+
+  acquire(&spages.lock);
+  if((s = spfind(ip, off)) != 0){
+    s->ref++;
+    release(&spages.lock);
+    return s->mem;
+  }
+  for(s = spages.page; s < &spages.page[NSPAGE]; s++)
+    if(s->ref == 0)
+      break;
+  if(s == &spages.page[NSPAGE] || (mem = kalloc()) == 0){
+    release(&spages.lock);
+    return 0;
+  }
+  s->ip = ip;
+  s->off = off;
+  s->mem = mem;
+  s->ref = 1;
+  spages.n++;
+  release(&spages.lock);
+
+  memset(mem, 0, PGSIZE);
+  readi(ip, mem, off, PGSIZE);
+  return mem;
+}
+
+// Drop a reference to the shared page for off of ip,
+// freeing it with the last one.
+static void
+spput(struct inode *ip, uint off)
+{
+  struct spage *s;
+
+  acquire(&spages.lock);
+  if((s = spfind(ip, off)) == 0)
+    panic("spput");
+  if(--s->ref == 0){
+    kfree(s->mem);
+    spages.n--;
+  }
+  release(&spages.lock);
+}
+
+// Bring the shared pages of ip up to date with a write
+// of the n bytes at src to the file at off.
+// Caller must hold ip->lock.
+void
+mmapsync(struct inode *ip, uint off, char *src, uint n)
+{
+  struct spage *s;
+  uint lo, hi;
+
+  // Pages of ip are only added with ip->lock held.
+  if(spages.n == 0)
+    return;
+  acquire(&spages.lock);
+  for(s = spages.page; s < &spages.page[NSPAGE]; s++){
+    if(s->ref == 0 || s->ip != ip || off + n <= s->off || s->off + PGSIZE <= off)
+      continue;
+    lo = off > s->off ? off : s->off;
+    hi = off + n < s->off + PGSIZE ? off + n : s->off + PGSIZE;
+    if(s->mem + lo - s->off != src + lo - off)
+      memmove(s->mem + lo - s->off, src + lo - off, hi - lo);
+  }
+  release(&spages.lock);
+}
+
+static struct vma*
+findvma(struct proc *p, uint va)
+{
+  struct vma *v;
+
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+    if(v->len && va >= v->addr && va < v->addr + v->len)
+      return v;
+  return 0;
+}
+
+// Map len bytes of f from offset off at a free address.
+// Returns the address, or 0.
+uint
+mmap(struct file *f, uint off, uint len, int prot, int flags)
+{
+  struct proc *p = myproc();
+  struct vma *v, *free;
+  uint addr;
+
+  len = PGROUNDUP(len);
+  addr = MMAPBASE;
+again:
+  free = 0;
+  for(v = p->vma; v < &p->vma[NVMA]; v++){
+    if(v->len == 0){
+      if(free == 0)
+        free = v;
+    } else if(addr < v->addr + v->len && v->addr < addr + len){
+      addr = v->addr + v->len;
+      goto again;
+    }
+  }
+  if(free == 0 || addr + len > KERNBASE || addr + len < addr)
+    return 0;
+
+  free->addr = addr;
+  free->len = len;
+  free->prot = prot;
+  free->flags = flags;
+  free->f = filedup(f);
+  free->off = off;
+  return addr;
+}
+
+// Bring in the page of p holding va, if a vma covers
+// it and allows the access. Returns 0 on success.
+int
+mmapfault(struct proc *p, uint va, int write)
+{
+  struct vma *v;
+  struct spage *s;
+  struct inode *ip;
+  pte_t *pte;
+  char *mem;
+  uint off;
+
+  va = PGROUNDDOWN(va);
+  if((v = findvma(p, va)) == 0)
+    return -1;
+  if(write && (v->prot & PROT_WRITE) == 0)
+    return -1;
+  if((pte = walkpgdir(p->pgdir, (char*)va, 0)) != 0 && (*pte & PTE_P))
+    return 0;
+
+  ip = v->f->ip;
+  off = v->off + (va - v->addr);
+  ilock(ip);
+  if(v->flags & MAP_SHARED)
+    mem = spget(ip, off);
+  else if((mem = kalloc()) != 0){
+    // Start from the shared page if there is one,
+    // since it may hold stores not yet in the file.
+    acquire(&spages.lock);
+    if((s = spfind(ip, off)) != 0)
+      memmove(mem, s->mem, PGSIZE);
+    release(&spages.lock);
+    if(s == 0){
+      memset(mem, 0, PGSIZE);
+      readi(ip, mem, off, PGSIZE);
+    }
+  }
+  iunlock(ip);
+  if(mem == 0)
+    return -1;
+  if(mappages(p->pgdir, (char*)va, PGSIZE, V2P(mem),
+              PTE_U | (v->prot & PROT_WRITE ? PTE_W : 0)) < 0){
+    if(v->flags & MAP_SHARED)
+      spput(ip, off);
+    else
+      kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Check that [va, va+n) is mapped with the access a system
+// call's argument needs, and fault it in, so that the kernel
+// does not fault on it later with locks held.
+int
+mmapcheck(struct proc *p, uint va, uint n, int write)
+{
+  uint a, last;
+
+  if(va + n < va)
+    return -1;
+  a = PGROUNDDOWN(va);
+  last = PGROUNDDOWN(n ? va + n - 1 : va);
+  for(;;){
+    if(mmapfault(p, a, write) < 0)
+      return -1;
+    if(a == last)
+      break;
+    a += PGSIZE;
+  }
+  return 0;
+}
+
+// Write the page mem, mapped at va by v, back to the file,
+// a few blocks per transaction as filewrite() does.
+// Does not extend the file. Since write()s update the shared
+// page too, writing all of it loses none of theirs.
+static void
+writeback(struct vma *v, char *mem, uint va)
+{
+  struct inode *ip = v->f->ip;
+  int max = (MAXOPBLOCKS-1-2-5-1) * 512;
+  uint off = v->off + (va - v->addr);
+  int i = 0, n1, busy;
+
+  while(i < PGSIZE){
+    n1 = PGSIZE - i;
+    if(n1 > max)
+      n1 = max;
+
+    begin_op();
+    ilock(ip);
+    busy = 0;
+    if(off + i >= ip->size)
+      n1 = 0;
+    else {
+      if(n1 > ip->size - (off + i))
+        n1 = ip->size - (off + i);
+      if((busy = wbbusy(ip, off + i, n1)) == 0)
+        writei(ip, mem + i, off + i, n1);
+    }
+    iunlock(ip);
+    end_op();
+
+    if(busy){
+      iflush(ip);
+      continue;
+    }
+    if(n1 == 0)
+      break;
+    i += n1;
+  }
+}
+
+// Unmap the pages of v in [lo, hi), writing back
+// the ones of a shared mapping that v has stored to.
+static void
+vmaunmap(struct proc *p, struct vma *v, uint lo, uint hi)
+{
+  pte_t *pte;
+  char *mem;
+  uint a;
+
+  for(a = lo; a < hi; a += PGSIZE){
+    if((pte = walkpgdir(p->pgdir, (char*)a, 0)) == 0 || (*pte & PTE_P) == 0)
+      continue;
+    mem = P2V(PTE_ADDR(*pte));
+    if(v->flags & MAP_SHARED){
+      if(*pte & PTE_D)
+        writeback(v, mem, a);
+      spput(v->f->ip, v->off + (a - v->addr));
+    } else
+      kfree(mem);
+    *pte = 0;
+  }
+  if(p == myproc())
+    lcr3(V2P(p->pgdir));
+}
+
+// Unmap [addr, addr+len) from p. The range may cover parts
+// of several mappings, or the middle of one, which splits it.
+int
+munmap(struct proc *p, uint addr, uint len)
+{
+  struct vma *v, *w;
+  uint end, lo, hi;
+
+  if(addr % PGSIZE || len == 0 || addr + len < addr)
+    return -1;
+  end = PGROUNDUP(addr + len);
+
+  for(v = p->vma; v < &p->vma[NVMA]; v++){
+    if(v->len == 0 || end <= v->addr || v->addr + v->len <= addr)
+      continue;
+    lo = addr > v->addr ? addr : v->addr;
+    hi = end < v->addr + v->len ? end : v->addr + v->len;
+
+    if(lo > v->addr && hi < v->addr + v->len){
+      // Split off the part above the hole into w.
+      for(w = p->vma; w < &p->vma[NVMA] && w->len; w++)
+        ;
+      if(w == &p->vma[NVMA])
+        return -1;
+      *w = *v;
+      w->addr = hi;
+      w->len = v->addr + v->len - hi;
+      w->off = v->off + (hi - v->addr);
+      filedup(w->f);
+      v->len = hi - v->addr;
+    }
+
+    vmaunmap(p, v, lo, hi);
+    if(lo == v->addr && hi == v->addr + v->len){
+      fileclose(v->f);
+      v->len = 0;
+    } else if(lo == v->addr){
+      v->off += hi - lo;
+      v->addr = hi;
+      v->len -= hi - lo;
+    } else
+      v->len = lo - v->addr;
+  }
+  return 0;
+}
+
+// Unmap everything p has mapped, for exit() and exec().
+void
+munmapall(struct proc *p)
+{
+  struct vma *v;
+
+  for(v = p->vma; v < &p->vma[NVMA]; v++){
+    if(v->len){
+      vmaunmap(p, v, v->addr, v->addr + v->len);
+      fileclose(v->f);
+      v->len = 0;
+    }
+  }
+}
+
+// Give child np copies of p's mappings, the shared pages
+// p has faulted in, and copies of the private ones.
+int
+mmapdup(struct proc *p, struct proc *np)
+{
+  struct vma *v, *nv;
+  pte_t *pte;
+  char *mem;
+  uint a;
+
+  for(v = p->vma, nv = np->vma; v < &p->vma[NVMA]; v++, nv++){
+    if(v->len == 0)
+      continue;
+    *nv = *v;
+    filedup(nv->f);
+    for(a = v->addr; a < v->addr + v->len; a += PGSIZE){
+      if((pte = walkpgdir(p->pgdir, (char*)a, 0)) == 0 || (*pte & PTE_P) == 0)
+        continue;
+      if(v->flags & MAP_SHARED){
+        mem = P2V(PTE_ADDR(*pte));
+        if(mappages(np->pgdir, (char*)a, PGSIZE, V2P(mem), *pte & (PTE_U|PTE_W)) < 0)
+          return -1;
+        acquire(&spages.lock);
+        spfind(v->f->ip, v->off + (a - v->addr))->ref++;
+        release(&spages.lock);
+        continue;
+      }
+      if((mem = kalloc()) == 0)
+        return -1;
+      memmove(mem, P2V(PTE_ADDR(*pte)), PGSIZE);
+      if(mappages(np->pgdir, (char*)a, PGSIZE, V2P(mem), *pte & (PTE_U|PTE_W)) < 0){
+        kfree(mem);
+        return -1;
+      }
+    }
+  }
+  return 0;
+}
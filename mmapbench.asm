@@ -0,0 +1,2371 @@
+
+_mmapbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "shared: changes written back\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	56                   	push   %esi
+       e:	53                   	push   %ebx
+       f:	bb 00 01 00 00       	mov    $0x100,%ebx
+      14:	51                   	push   %ecx
+      15:	83 ec 0c             	sub    $0xc,%esp
+  int kb;
+
+  kb = argc > 1 ? atoi(argv[1]) : 256;
+      18:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+      1b:	8b 41 04             	mov    0x4(%ecx),%eax
+  kb = argc > 1 ? atoi(argv[1]) : 256;
+      1e:	7e 10                	jle    30 <main+0x30>
+      20:	83 ec 0c             	sub    $0xc,%esp
+      23:	ff 70 04             	push   0x4(%eax)
+      26:	e8 75 09 00 00       	call   9a0 <atoi>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	89 c3                	mov    %eax,%ebx
+  kb -= kb % 4;
+      30:	89 da                	mov    %ebx,%edx
+  makefile(kb);
+      32:	83 ec 0c             	sub    $0xc,%esp
+  kb -= kb % 4;
+      35:	c1 fa 1f             	sar    $0x1f,%edx
+      38:	c1 ea 1e             	shr    $0x1e,%edx
+      3b:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+      3e:	83 e0 03             	and    $0x3,%eax
+      41:	29 d0                	sub    %edx,%eax
+      43:	29 c3                	sub    %eax,%ebx
+  makefile(kb);
+      45:	53                   	push   %ebx
+
+  run("read 512", readsum, 512, kb);
+  run("read 4096", readsum, 4096, kb);
+  run("mmap", mmapsum, kb*1024, kb);
+      46:	89 de                	mov    %ebx,%esi
+      48:	c1 e6 0a             	shl    $0xa,%esi
+  makefile(kb);
+      4b:	e8 60 01 00 00       	call   1b0 <makefile>
+  run("read 512", readsum, 512, kb);
+      50:	53                   	push   %ebx
+      51:	68 00 02 00 00       	push   $0x200
+      56:	68 b0 00 00 00       	push   $0xb0
+      5b:	68 01 12 00 00       	push   $0x1201
+      60:	e8 fb 01 00 00       	call   260 <run>
+  run("read 4096", readsum, 4096, kb);
+      65:	83 c4 20             	add    $0x20,%esp
+      68:	53                   	push   %ebx
+      69:	68 00 10 00 00       	push   $0x1000
+      6e:	68 b0 00 00 00       	push   $0xb0
+      73:	68 0a 12 00 00       	push   $0x120a
+      78:	e8 e3 01 00 00       	call   260 <run>
+  run("mmap", mmapsum, kb*1024, kb);
+      7d:	53                   	push   %ebx
+      7e:	56                   	push   %esi
+      7f:	68 20 01 00 00       	push   $0x120
+      84:	68 14 12 00 00       	push   $0x1214
+      89:	e8 d2 01 00 00       	call   260 <run>
+  shared(kb*1024);
+      8e:	83 c4 14             	add    $0x14,%esp
+      91:	56                   	push   %esi
+      92:	e8 09 02 00 00       	call   2a0 <shared>
+
+  unlink(FILENAME);
+      97:	c7 04 24 a0 11 00 00 	movl   $0x11a0,(%esp)
+      9e:	e8 fa 09 00 00       	call   a9d <unlink>
+  exit();
+      a3:	e8 98 05 00 00       	call   640 <exit>
+      a8:	66 90                	xchg   %ax,%ax
+      aa:	66 90                	xchg   %ax,%ax
+      ac:	66 90                	xchg   %ax,%ax
+      ae:	66 90                	xchg   %ax,%ax
+
+000000b0 <readsum>:
+{
+      b0:	55                   	push   %ebp
+      b1:	89 e5                	mov    %esp,%ebp
+      b3:	57                   	push   %edi
+  uint sum = 0;
+      b4:	31 ff                	xor    %edi,%edi
+{
+      b6:	56                   	push   %esi
+      b7:	53                   	push   %ebx
+      b8:	83 ec 14             	sub    $0x14,%esp
+      bb:	8b 75 08             	mov    0x8(%ebp),%esi
+  fd = open(FILENAME, O_RDONLY);
+      be:	6a 00                	push   $0x0
+      c0:	68 a0 11 00 00       	push   $0x11a0
+      c5:	e8 bf 09 00 00       	call   a89 <open>
+  while((n = read(fd, buf, bs)) > 0)
+      ca:	83 c4 10             	add    $0x10,%esp
+  fd = open(FILENAME, O_RDONLY);
+      cd:	89 c3                	mov    %eax,%ebx
+  while((n = read(fd, buf, bs)) > 0)
+      cf:	90                   	nop
+      d0:	83 ec 04             	sub    $0x4,%esp
+      d3:	56                   	push   %esi
+      d4:	68 60 18 00 00       	push   $0x1860
+      d9:	53                   	push   %ebx
+      da:	e8 87 09 00 00       	call   a66 <read>
+      df:	83 c4 10             	add    $0x10,%esp
+      e2:	85 c0                	test   %eax,%eax
+      e4:	7e 22                	jle    108 <readsum+0x58>
+    for(i = 0; i < n; i++)
+      e6:	31 d2                	xor    %edx,%edx
+      e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      ef:	90                   	nop
+      sum += (uchar)buf[i];
+      f0:	0f b6 8a 60 18 00 00 	movzbl 0x1860(%edx),%ecx
+    for(i = 0; i < n; i++)
+      f7:	83 c2 01             	add    $0x1,%edx
+      sum += (uchar)buf[i];
+      fa:	01 cf                	add    %ecx,%edi
+    for(i = 0; i < n; i++)
+      fc:	39 d0                	cmp    %edx,%eax
+      fe:	75 f0                	jne    f0 <readsum+0x40>
+     100:	eb ce                	jmp    d0 <readsum+0x20>
+     102:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  close(fd);
+     108:	83 ec 0c             	sub    $0xc,%esp
+     10b:	53                   	push   %ebx
+     10c:	e8 9f 05 00 00       	call   6b0 <close>
+}
+     111:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     114:	89 f8                	mov    %edi,%eax
+     116:	5b                   	pop    %ebx
+     117:	5e                   	pop    %esi
+     118:	5f                   	pop    %edi
+     119:	5d                   	pop    %ebp
+     11a:	c3                   	ret
+     11b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     11f:	90                   	nop
+
+00000120 <mmapsum>:
+{
+     120:	55                   	push   %ebp
+     121:	89 e5                	mov    %esp,%ebp
+     123:	57                   	push   %edi
+     124:	56                   	push   %esi
+     125:	53                   	push   %ebx
+     126:	83 ec 14             	sub    $0x14,%esp
+     129:	8b 75 08             	mov    0x8(%ebp),%esi
+  fd = open(FILENAME, O_RDONLY);
+     12c:	6a 00                	push   $0x0
+     12e:	68 a0 11 00 00       	push   $0x11a0
+     133:	e8 51 09 00 00       	call   a89 <open>
+  if((p = mmap(fd, 0, size, PROT_READ, MAP_PRIVATE)) == (uchar*)-1){
+     138:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+     13f:	6a 01                	push   $0x1
+  fd = open(FILENAME, O_RDONLY);
+     141:	89 c3                	mov    %eax,%ebx
+  if((p = mmap(fd, 0, size, PROT_READ, MAP_PRIVATE)) == (uchar*)-1){
+     143:	56                   	push   %esi
+     144:	6a 00                	push   $0x0
+     146:	50                   	push   %eax
+     147:	e8 5f 0a 00 00       	call   bab <mmap>
+     14c:	83 c4 20             	add    $0x20,%esp
+     14f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     152:	74 40                	je     194 <mmapsum+0x74>
+  close(fd);
+     154:	83 ec 0c             	sub    $0xc,%esp
+     157:	89 c7                	mov    %eax,%edi
+     159:	53                   	push   %ebx
+     15a:	e8 51 05 00 00       	call   6b0 <close>
+  for(i = 0; i < size; i++)
+     15f:	83 c4 10             	add    $0x10,%esp
+     162:	85 f6                	test   %esi,%esi
+     164:	7e 2a                	jle    190 <mmapsum+0x70>
+     166:	89 f8                	mov    %edi,%eax
+     168:	8d 0c 3e             	lea    (%esi,%edi,1),%ecx
+  uint sum = 0;
+     16b:	31 db                	xor    %ebx,%ebx
+     16d:	8d 76 00             	lea    0x0(%esi),%esi
+    sum += p[i];
+     170:	0f b6 10             	movzbl (%eax),%edx
+  for(i = 0; i < size; i++)
+     173:	83 c0 01             	add    $0x1,%eax
+    sum += p[i];
+     176:	01 d3                	add    %edx,%ebx
+  for(i = 0; i < size; i++)
+     178:	39 c8                	cmp    %ecx,%eax
+     17a:	75 f4                	jne    170 <mmapsum+0x50>
+  munmap(p, size);
+     17c:	83 ec 08             	sub    $0x8,%esp
+     17f:	56                   	push   %esi
+     180:	57                   	push   %edi
+     181:	e8 2f 0a 00 00       	call   bb5 <munmap>
+}
+     186:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     189:	89 d8                	mov    %ebx,%eax
+     18b:	5b                   	pop    %ebx
+     18c:	5e                   	pop    %esi
+     18d:	5f                   	pop    %edi
+     18e:	5d                   	pop    %ebp
+     18f:	c3                   	ret
+  uint sum = 0;
+     190:	31 db                	xor    %ebx,%ebx
+     192:	eb e8                	jmp    17c <mmapsum+0x5c>
+    printf(2, "mmapbench: mmap failed\n");
+     194:	50                   	push   %eax
+     195:	50                   	push   %eax
+     196:	68 ae 11 00 00       	push   $0x11ae
+     19b:	6a 02                	push   $0x2
+     19d:	e8 4e 0b 00 00       	call   cf0 <printf>
+    exit();
+     1a2:	e8 99 04 00 00       	call   640 <exit>
+     1a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ae:	66 90                	xchg   %ax,%ax
+
+000001b0 <makefile>:
+{
+     1b0:	55                   	push   %ebp
+     1b1:	89 e5                	mov    %esp,%ebp
+     1b3:	57                   	push   %edi
+     1b4:	56                   	push   %esi
+     1b5:	53                   	push   %ebx
+     1b6:	83 ec 14             	sub    $0x14,%esp
+     1b9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if((fd = open(FILENAME, O_CREATE|O_RDWR)) < 0){
+     1bc:	68 02 02 00 00       	push   $0x202
+     1c1:	68 a0 11 00 00       	push   $0x11a0
+     1c6:	e8 be 08 00 00       	call   a89 <open>
+     1cb:	83 c4 10             	add    $0x10,%esp
+     1ce:	85 c0                	test   %eax,%eax
+     1d0:	78 72                	js     244 <makefile+0x94>
+     1d2:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < sizeof(buf); i++)
+     1d4:	31 c9                	xor    %ecx,%ecx
+    buf[i] = i % 251;
+     1d6:	bb bf bf 8c 82       	mov    $0x828cbfbf,%ebx
+     1db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1df:	90                   	nop
+     1e0:	89 c8                	mov    %ecx,%eax
+     1e2:	f7 e3                	mul    %ebx
+     1e4:	89 c8                	mov    %ecx,%eax
+  for(i = 0; i < sizeof(buf); i++)
+     1e6:	83 c1 01             	add    $0x1,%ecx
+    buf[i] = i % 251;
+     1e9:	c1 ea 07             	shr    $0x7,%edx
+     1ec:	69 d2 fb 00 00 00    	imul   $0xfb,%edx,%edx
+     1f2:	29 d0                	sub    %edx,%eax
+     1f4:	88 81 5f 18 00 00    	mov    %al,0x185f(%ecx)
+  for(i = 0; i < sizeof(buf); i++)
+     1fa:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+     200:	75 de                	jne    1e0 <makefile+0x30>
+  for(i = 0; i < kb/4; i++)
+     202:	85 ff                	test   %edi,%edi
+     204:	8d 5f 03             	lea    0x3(%edi),%ebx
+     207:	0f 49 df             	cmovns %edi,%ebx
+     20a:	c1 fb 02             	sar    $0x2,%ebx
+     20d:	83 ff 03             	cmp    $0x3,%edi
+     210:	7e 23                	jle    235 <makefile+0x85>
+     212:	31 ff                	xor    %edi,%edi
+     214:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, buf, sizeof(buf));
+     218:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < kb/4; i++)
+     21b:	83 c7 01             	add    $0x1,%edi
+    write(fd, buf, sizeof(buf));
+     21e:	68 00 10 00 00       	push   $0x1000
+     223:	68 60 18 00 00       	push   $0x1860
+     228:	56                   	push   %esi
+     229:	e8 3f 08 00 00       	call   a6d <write>
+  for(i = 0; i < kb/4; i++)
+     22e:	83 c4 10             	add    $0x10,%esp
+     231:	39 fb                	cmp    %edi,%ebx
+     233:	7f e3                	jg     218 <makefile+0x68>
+  close(fd);
+     235:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+     238:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     23b:	5b                   	pop    %ebx
+     23c:	5e                   	pop    %esi
+     23d:	5f                   	pop    %edi
+     23e:	5d                   	pop    %ebp
+  close(fd);
+     23f:	e9 6c 04 00 00       	jmp    6b0 <close>
+    printf(2, "mmapbench: cannot create %s\n", FILENAME);
+     244:	50                   	push   %eax
+     245:	68 a0 11 00 00       	push   $0x11a0
+     24a:	68 c6 11 00 00       	push   $0x11c6
+     24f:	6a 02                	push   $0x2
+     251:	e8 9a 0a 00 00       	call   cf0 <printf>
+    exit();
+     256:	e8 e5 03 00 00       	call   640 <exit>
+     25b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     25f:	90                   	nop
+
+00000260 <run>:
+{
+     260:	55                   	push   %ebp
+     261:	89 e5                	mov    %esp,%ebp
+     263:	56                   	push   %esi
+     264:	53                   	push   %ebx
+  t = uptime();
+     265:	e8 8d 08 00 00       	call   af7 <uptime>
+  sum = scan(arg);
+     26a:	83 ec 0c             	sub    $0xc,%esp
+     26d:	ff 75 10             	push   0x10(%ebp)
+  t = uptime();
+     270:	89 c3                	mov    %eax,%ebx
+  sum = scan(arg);
+     272:	ff 55 0c             	call   *0xc(%ebp)
+     275:	89 c6                	mov    %eax,%esi
+  t = uptime() - t;
+     277:	e8 7b 08 00 00       	call   af7 <uptime>
+  printf(1, "%s: %d KB in %d ticks, sum %d\n", name, kb, t, sum);
+     27c:	5a                   	pop    %edx
+     27d:	59                   	pop    %ecx
+     27e:	56                   	push   %esi
+  t = uptime() - t;
+     27f:	29 d8                	sub    %ebx,%eax
+  printf(1, "%s: %d KB in %d ticks, sum %d\n", name, kb, t, sum);
+     281:	50                   	push   %eax
+     282:	ff 75 14             	push   0x14(%ebp)
+     285:	ff 75 08             	push   0x8(%ebp)
+     288:	68 1c 12 00 00       	push   $0x121c
+     28d:	6a 01                	push   $0x1
+     28f:	e8 5c 0a 00 00       	call   cf0 <printf>
+}
+     294:	83 c4 20             	add    $0x20,%esp
+     297:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     29a:	5b                   	pop    %ebx
+     29b:	5e                   	pop    %esi
+     29c:	5d                   	pop    %ebp
+     29d:	c3                   	ret
+     29e:	66 90                	xchg   %ax,%ax
+
+000002a0 <shared>:
+{
+     2a0:	55                   	push   %ebp
+     2a1:	89 e5                	mov    %esp,%ebp
+     2a3:	57                   	push   %edi
+     2a4:	56                   	push   %esi
+     2a5:	53                   	push   %ebx
+     2a6:	83 ec 14             	sub    $0x14,%esp
+     2a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  fd = open(FILENAME, O_RDWR);
+     2ac:	6a 02                	push   $0x2
+     2ae:	68 a0 11 00 00       	push   $0x11a0
+     2b3:	e8 d1 07 00 00       	call   a89 <open>
+  if((p = mmap(fd, 0, size, PROT_READ|PROT_WRITE, MAP_SHARED)) == (char*)-1){
+     2b8:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     2bf:	6a 03                	push   $0x3
+  fd = open(FILENAME, O_RDWR);
+     2c1:	89 c7                	mov    %eax,%edi
+  if((p = mmap(fd, 0, size, PROT_READ|PROT_WRITE, MAP_SHARED)) == (char*)-1){
+     2c3:	53                   	push   %ebx
+     2c4:	6a 00                	push   $0x0
+     2c6:	50                   	push   %eax
+     2c7:	e8 df 08 00 00       	call   bab <mmap>
+     2cc:	83 c4 20             	add    $0x20,%esp
+     2cf:	83 f8 ff             	cmp    $0xffffffff,%eax
+     2d2:	0f 84 b6 00 00 00    	je     38e <shared+0xee>
+     2d8:	89 c1                	mov    %eax,%ecx
+  for(i = 0; i < size; i += 4096)
+     2da:	85 db                	test   %ebx,%ebx
+     2dc:	0f 8e 88 00 00 00    	jle    36a <shared+0xca>
+     2e2:	8d 73 ff             	lea    -0x1(%ebx),%esi
+     2e5:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+     2eb:	81 c6 00 10 00 00    	add    $0x1000,%esi
+     2f1:	8d 14 06             	lea    (%esi,%eax,1),%edx
+     2f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    p[i]++;
+     2f8:	80 00 01             	addb   $0x1,(%eax)
+  for(i = 0; i < size; i += 4096)
+     2fb:	05 00 10 00 00       	add    $0x1000,%eax
+     300:	39 d0                	cmp    %edx,%eax
+     302:	75 f4                	jne    2f8 <shared+0x58>
+  munmap(p, size);
+     304:	83 ec 08             	sub    $0x8,%esp
+     307:	53                   	push   %ebx
+  for(i = 0; i < size; i += 4096){
+     308:	31 db                	xor    %ebx,%ebx
+  munmap(p, size);
+     30a:	51                   	push   %ecx
+     30b:	e8 a5 08 00 00       	call   bb5 <munmap>
+  for(i = 0; i < size; i += 4096){
+     310:	83 c4 10             	add    $0x10,%esp
+     313:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     317:	90                   	nop
+    if(read(fd, buf, sizeof(buf)) != sizeof(buf) || buf[0] != 1){
+     318:	83 ec 04             	sub    $0x4,%esp
+     31b:	68 00 10 00 00       	push   $0x1000
+     320:	68 60 18 00 00       	push   $0x1860
+     325:	57                   	push   %edi
+     326:	e8 3b 07 00 00       	call   a66 <read>
+     32b:	83 c4 10             	add    $0x10,%esp
+     32e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+     333:	75 44                	jne    379 <shared+0xd9>
+     335:	80 3d 60 18 00 00 01 	cmpb   $0x1,0x1860
+     33c:	75 3b                	jne    379 <shared+0xd9>
+  for(i = 0; i < size; i += 4096){
+     33e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+     344:	39 de                	cmp    %ebx,%esi
+     346:	75 d0                	jne    318 <shared+0x78>
+  close(fd);
+     348:	83 ec 0c             	sub    $0xc,%esp
+     34b:	57                   	push   %edi
+     34c:	e8 5f 03 00 00       	call   6b0 <close>
+  printf(1, "shared: changes written back\n");
+     351:	58                   	pop    %eax
+     352:	5a                   	pop    %edx
+     353:	68 e3 11 00 00       	push   $0x11e3
+     358:	6a 01                	push   $0x1
+     35a:	e8 91 09 00 00       	call   cf0 <printf>
+}
+     35f:	83 c4 10             	add    $0x10,%esp
+     362:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     365:	5b                   	pop    %ebx
+     366:	5e                   	pop    %esi
+     367:	5f                   	pop    %edi
+     368:	5d                   	pop    %ebp
+     369:	c3                   	ret
+  munmap(p, size);
+     36a:	83 ec 08             	sub    $0x8,%esp
+     36d:	53                   	push   %ebx
+     36e:	50                   	push   %eax
+     36f:	e8 41 08 00 00       	call   bb5 <munmap>
+     374:	83 c4 10             	add    $0x10,%esp
+     377:	eb cf                	jmp    348 <shared+0xa8>
+      printf(2, "mmapbench: shared write lost at %d\n", i);
+     379:	83 ec 04             	sub    $0x4,%esp
+     37c:	53                   	push   %ebx
+     37d:	68 5c 12 00 00       	push   $0x125c
+     382:	6a 02                	push   $0x2
+     384:	e8 67 09 00 00       	call   cf0 <printf>
+      exit();
+     389:	e8 b2 02 00 00       	call   640 <exit>
+    printf(2, "mmapbench: shared mmap failed\n");
+     38e:	51                   	push   %ecx
+     38f:	51                   	push   %ecx
+     390:	68 3c 12 00 00       	push   $0x123c
+     395:	6a 02                	push   $0x2
+     397:	e8 54 09 00 00       	call   cf0 <printf>
+    exit();
+     39c:	e8 9f 02 00 00       	call   640 <exit>
+     3a1:	66 90                	xchg   %ax,%ax
+     3a3:	66 90                	xchg   %ax,%ax
+     3a5:	66 90                	xchg   %ax,%ax
+     3a7:	66 90                	xchg   %ax,%ax
+     3a9:	66 90                	xchg   %ax,%ax
+     3ab:	66 90                	xchg   %ax,%ax
+     3ad:	66 90                	xchg   %ax,%ax
+     3af:	90                   	nop
+
+000003b0 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+     3b0:	55                   	push   %ebp
+     3b1:	89 e5                	mov    %esp,%ebp
+     3b3:	57                   	push   %edi
+     3b4:	56                   	push   %esi
+     3b5:	53                   	push   %ebx
+     3b6:	83 ec 4c             	sub    $0x4c,%esp
+     3b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     3bc:	8b 55 08             	mov    0x8(%ebp),%edx
+     3bf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     3c2:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+     3c5:	83 fa 0f             	cmp    $0xf,%edx
+     3c8:	0f 87 32 01 00 00    	ja     500 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+     3ce:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     3d4:	8b 80 60 28 00 00    	mov    0x2860(%eax),%eax
+     3da:	85 c0                	test   %eax,%eax
+     3dc:	0f 84 de 00 00 00    	je     4c0 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+     3e2:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     3e8:	8b b0 64 28 00 00    	mov    0x2864(%eax),%esi
+     3ee:	8d 88 60 28 00 00    	lea    0x2860(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+     3f4:	8d b8 68 28 00 00    	lea    0x2868(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+     3fa:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+     3fd:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+     400:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+     403:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+     409:	0f 8f 01 01 00 00    	jg     510 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+     40f:	8d 78 08             	lea    0x8(%eax),%edi
+     412:	8d bc 3e 60 28 00 00 	lea    0x2860(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     419:	85 db                	test   %ebx,%ebx
+     41b:	7e 3b                	jle    458 <bufwrite+0xa8>
+     41d:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+     420:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+     423:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     427:	90                   	nop
+    *dst++ = *src++;
+     428:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     429:	39 c6                	cmp    %eax,%esi
+     42b:	75 fb                	jne    428 <bufwrite+0x78>
+  ob[fd].n += n;
+     42d:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     433:	8b 88 64 28 00 00    	mov    0x2864(%eax),%ecx
+     439:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     43b:	83 b8 60 28 00 00 01 	cmpl   $0x1,0x2860(%eax)
+  ob[fd].n += n;
+     442:	89 88 64 28 00 00    	mov    %ecx,0x2864(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     448:	74 26                	je     470 <bufwrite+0xc0>
+}
+     44a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     44d:	5b                   	pop    %ebx
+     44e:	5e                   	pop    %esi
+     44f:	5f                   	pop    %edi
+     450:	5d                   	pop    %ebp
+     451:	c3                   	ret
+     452:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+     458:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     45b:	83 b8 60 28 00 00 01 	cmpl   $0x1,0x2860(%eax)
+  ob[fd].n += n;
+     462:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     465:	75 e3                	jne    44a <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+     467:	85 db                	test   %ebx,%ebx
+     469:	74 df                	je     44a <bufwrite+0x9a>
+     46b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     46f:	90                   	nop
+  src = vsrc;
+     470:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     473:	01 c3                	add    %eax,%ebx
+     475:	eb 10                	jmp    487 <bufwrite+0xd7>
+     477:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     47e:	66 90                	xchg   %ax,%ax
+     480:	83 c0 01             	add    $0x1,%eax
+     483:	39 d8                	cmp    %ebx,%eax
+     485:	74 c3                	je     44a <bufwrite+0x9a>
+    if(*p == (char)c)
+     487:	80 38 0a             	cmpb   $0xa,(%eax)
+     48a:	75 f4                	jne    480 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     48c:	85 c9                	test   %ecx,%ecx
+     48e:	7e ba                	jle    44a <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+     490:	83 ec 04             	sub    $0x4,%esp
+     493:	51                   	push   %ecx
+     494:	ff 75 ac             	push   -0x54(%ebp)
+     497:	52                   	push   %edx
+     498:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+     49b:	e8 cd 05 00 00       	call   a6d <write>
+    ob[fd].n = 0;
+     4a0:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     4a3:	83 c4 10             	add    $0x10,%esp
+     4a6:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+     4ac:	c7 82 64 28 00 00 00 	movl   $0x0,0x2864(%edx)
+     4b3:	00 00 00 
+     4b6:	eb 92                	jmp    44a <bufwrite+0x9a>
+     4b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4bf:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     4c0:	83 ec 08             	sub    $0x8,%esp
+     4c3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     4c6:	50                   	push   %eax
+     4c7:	52                   	push   %edx
+     4c8:	89 55 b0             	mov    %edx,-0x50(%ebp)
+     4cb:	e8 d7 05 00 00       	call   aa7 <fstat>
+     4d0:	83 c4 10             	add    $0x10,%esp
+     4d3:	8b 55 b0             	mov    -0x50(%ebp),%edx
+     4d6:	89 c1                	mov    %eax,%ecx
+     4d8:	b8 02 00 00 00       	mov    $0x2,%eax
+     4dd:	85 c9                	test   %ecx,%ecx
+     4df:	75 0d                	jne    4ee <bufwrite+0x13e>
+     4e1:	31 c0                	xor    %eax,%eax
+     4e3:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     4e8:	0f 95 c0             	setne  %al
+     4eb:	83 c0 01             	add    $0x1,%eax
+     4ee:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+     4f4:	89 81 60 28 00 00    	mov    %eax,0x2860(%ecx)
+     4fa:	e9 e3 fe ff ff       	jmp    3e2 <bufwrite+0x32>
+     4ff:	90                   	nop
+}
+     500:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     503:	5b                   	pop    %ebx
+     504:	5e                   	pop    %esi
+     505:	5f                   	pop    %edi
+     506:	5d                   	pop    %ebp
+    write(fd, p, n);
+     507:	e9 61 05 00 00       	jmp    a6d <write>
+     50c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+     510:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+     513:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+     516:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+     519:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+     51c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+     51f:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+     522:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+     525:	6a 02                	push   $0x2
+     527:	50                   	push   %eax
+     528:	52                   	push   %edx
+     529:	e8 9b 06 00 00       	call   bc9 <writev>
+    ob[fd].n = 0;
+     52e:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+     531:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+     534:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+     53b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     53e:	5b                   	pop    %ebx
+     53f:	5e                   	pop    %esi
+     540:	5f                   	pop    %edi
+     541:	5d                   	pop    %ebp
+     542:	c3                   	ret
+     543:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     54a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000550 <fflush>:
+{
+     550:	55                   	push   %ebp
+     551:	89 e5                	mov    %esp,%ebp
+     553:	53                   	push   %ebx
+     554:	83 ec 04             	sub    $0x4,%esp
+     557:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     55a:	83 f8 0f             	cmp    $0xf,%eax
+     55d:	77 16                	ja     575 <fflush+0x25>
+     55f:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+     565:	8b 8a 64 28 00 00    	mov    0x2864(%edx),%ecx
+     56b:	8d 9a 60 28 00 00    	lea    0x2860(%edx),%ebx
+     571:	85 c9                	test   %ecx,%ecx
+     573:	7f 0b                	jg     580 <fflush+0x30>
+}
+     575:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     578:	c9                   	leave
+     579:	c3                   	ret
+     57a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     580:	83 ec 04             	sub    $0x4,%esp
+     583:	81 c2 68 28 00 00    	add    $0x2868,%edx
+     589:	51                   	push   %ecx
+     58a:	52                   	push   %edx
+     58b:	50                   	push   %eax
+     58c:	e8 dc 04 00 00       	call   a6d <write>
+    ob[fd].n = 0;
+     591:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     598:	83 c4 10             	add    $0x10,%esp
+}
+     59b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     59e:	c9                   	leave
+     59f:	c3                   	ret
+
+000005a0 <fflushall>:
+{
+     5a0:	55                   	push   %ebp
+     5a1:	89 e5                	mov    %esp,%ebp
+     5a3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     5a4:	31 f6                	xor    %esi,%esi
+{
+     5a6:	53                   	push   %ebx
+     5a7:	bb 68 28 00 00       	mov    $0x2868,%ebx
+     5ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     5b0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     5b3:	85 c0                	test   %eax,%eax
+     5b5:	7e 15                	jle    5cc <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     5b7:	83 ec 04             	sub    $0x4,%esp
+     5ba:	50                   	push   %eax
+     5bb:	53                   	push   %ebx
+     5bc:	56                   	push   %esi
+     5bd:	e8 ab 04 00 00       	call   a6d <write>
+    ob[fd].n = 0;
+     5c2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     5c9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     5cc:	83 c6 01             	add    $0x1,%esi
+     5cf:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     5d5:	83 fe 10             	cmp    $0x10,%esi
+     5d8:	75 d6                	jne    5b0 <fflushall+0x10>
+}
+     5da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5dd:	5b                   	pop    %ebx
+     5de:	5e                   	pop    %esi
+     5df:	5d                   	pop    %ebp
+     5e0:	c3                   	ret
+     5e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5ef:	90                   	nop
+
+000005f0 <fork>:
+{
+     5f0:	55                   	push   %ebp
+     5f1:	89 e5                	mov    %esp,%ebp
+     5f3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     5f4:	31 f6                	xor    %esi,%esi
+{
+     5f6:	53                   	push   %ebx
+     5f7:	bb 68 28 00 00       	mov    $0x2868,%ebx
+     5fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     600:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     603:	85 c0                	test   %eax,%eax
+     605:	7e 15                	jle    61c <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     607:	83 ec 04             	sub    $0x4,%esp
+     60a:	50                   	push   %eax
+     60b:	53                   	push   %ebx
+     60c:	56                   	push   %esi
+     60d:	e8 5b 04 00 00       	call   a6d <write>
+    ob[fd].n = 0;
+     612:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     619:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     61c:	83 c6 01             	add    $0x1,%esi
+     61f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     625:	83 fe 10             	cmp    $0x10,%esi
+     628:	75 d6                	jne    600 <fork+0x10>
+}
+     62a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     62d:	5b                   	pop    %ebx
+     62e:	5e                   	pop    %esi
+     62f:	5d                   	pop    %ebp
+  return _fork();
+     630:	e9 15 04 00 00       	jmp    a4a <_fork>
+     635:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     63c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000640 <exit>:
+{
+     640:	55                   	push   %ebp
+     641:	89 e5                	mov    %esp,%ebp
+     643:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+     646:	e8 55 ff ff ff       	call   5a0 <fflushall>
+  _exit();
+     64b:	e8 01 04 00 00       	call   a51 <_exit>
+
+00000650 <exec>:
+{
+     650:	55                   	push   %ebp
+     651:	89 e5                	mov    %esp,%ebp
+     653:	57                   	push   %edi
+     654:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     655:	31 f6                	xor    %esi,%esi
+{
+     657:	53                   	push   %ebx
+     658:	bb 68 28 00 00       	mov    $0x2868,%ebx
+     65d:	83 ec 1c             	sub    $0x1c,%esp
+     660:	8b 45 08             	mov    0x8(%ebp),%eax
+     663:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     666:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     669:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     670:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     673:	85 c0                	test   %eax,%eax
+     675:	7e 15                	jle    68c <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     677:	83 ec 04             	sub    $0x4,%esp
+     67a:	50                   	push   %eax
+     67b:	53                   	push   %ebx
+     67c:	56                   	push   %esi
+     67d:	e8 eb 03 00 00       	call   a6d <write>
+    ob[fd].n = 0;
+     682:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     689:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     68c:	83 c6 01             	add    $0x1,%esi
+     68f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     695:	83 fe 10             	cmp    $0x10,%esi
+     698:	75 d6                	jne    670 <exec+0x20>
+  return _exec(path, argv);
+     69a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     69d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+     6a0:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     6a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6a6:	5b                   	pop    %ebx
+     6a7:	5e                   	pop    %esi
+     6a8:	5f                   	pop    %edi
+     6a9:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     6aa:	e9 d3 03 00 00       	jmp    a82 <_exec>
+     6af:	90                   	nop
+
+000006b0 <close>:
+{
+     6b0:	55                   	push   %ebp
+     6b1:	89 e5                	mov    %esp,%ebp
+     6b3:	56                   	push   %esi
+     6b4:	53                   	push   %ebx
+     6b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     6b8:	83 fb 0f             	cmp    $0xf,%ebx
+     6bb:	77 26                	ja     6e3 <close+0x33>
+     6bd:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     6c3:	8b 90 64 28 00 00    	mov    0x2864(%eax),%edx
+     6c9:	8d b0 60 28 00 00    	lea    0x2860(%eax),%esi
+     6cf:	85 d2                	test   %edx,%edx
+     6d1:	7f 25                	jg     6f8 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+     6d3:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     6d9:	c7 80 60 28 00 00 00 	movl   $0x0,0x2860(%eax)
+     6e0:	00 00 00 
+  return _close(fd);
+     6e3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     6e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     6e9:	5b                   	pop    %ebx
+     6ea:	5e                   	pop    %esi
+     6eb:	5d                   	pop    %ebp
+  return _close(fd);
+     6ec:	e9 83 03 00 00       	jmp    a74 <_close>
+     6f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     6f8:	83 ec 04             	sub    $0x4,%esp
+     6fb:	05 68 28 00 00       	add    $0x2868,%eax
+     700:	52                   	push   %edx
+     701:	50                   	push   %eax
+     702:	53                   	push   %ebx
+     703:	e8 65 03 00 00       	call   a6d <write>
+    ob[fd].n = 0;
+     708:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+     70f:	83 c4 10             	add    $0x10,%esp
+     712:	eb bf                	jmp    6d3 <close+0x23>
+     714:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     71b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     71f:	90                   	nop
+
+00000720 <strcpy>:
+{
+     720:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+     721:	31 c0                	xor    %eax,%eax
+{
+     723:	89 e5                	mov    %esp,%ebp
+     725:	53                   	push   %ebx
+     726:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     729:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     72c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     730:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     734:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     737:	83 c0 01             	add    $0x1,%eax
+     73a:	84 d2                	test   %dl,%dl
+     73c:	75 f2                	jne    730 <strcpy+0x10>
+}
+     73e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     741:	89 c8                	mov    %ecx,%eax
+     743:	c9                   	leave
+     744:	c3                   	ret
+     745:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     74c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000750 <strcmp>:
+{
+     750:	55                   	push   %ebp
+     751:	89 e5                	mov    %esp,%ebp
+     753:	53                   	push   %ebx
+     754:	8b 55 08             	mov    0x8(%ebp),%edx
+     757:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     75a:	0f b6 02             	movzbl (%edx),%eax
+     75d:	84 c0                	test   %al,%al
+     75f:	75 17                	jne    778 <strcmp+0x28>
+     761:	eb 3a                	jmp    79d <strcmp+0x4d>
+     763:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     767:	90                   	nop
+     768:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     76c:	83 c2 01             	add    $0x1,%edx
+     76f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     772:	84 c0                	test   %al,%al
+     774:	74 1a                	je     790 <strcmp+0x40>
+    p++, q++;
+     776:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     778:	0f b6 19             	movzbl (%ecx),%ebx
+     77b:	38 c3                	cmp    %al,%bl
+     77d:	74 e9                	je     768 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     77f:	29 d8                	sub    %ebx,%eax
+}
+     781:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     784:	c9                   	leave
+     785:	c3                   	ret
+     786:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     78d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     790:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     794:	31 c0                	xor    %eax,%eax
+     796:	29 d8                	sub    %ebx,%eax
+}
+     798:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     79b:	c9                   	leave
+     79c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     79d:	0f b6 19             	movzbl (%ecx),%ebx
+     7a0:	31 c0                	xor    %eax,%eax
+     7a2:	eb db                	jmp    77f <strcmp+0x2f>
+     7a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7af:	90                   	nop
+
+000007b0 <strlen>:
+{
+     7b0:	55                   	push   %ebp
+     7b1:	89 e5                	mov    %esp,%ebp
+     7b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+     7b6:	80 3a 00             	cmpb   $0x0,(%edx)
+     7b9:	74 15                	je     7d0 <strlen+0x20>
+     7bb:	31 c0                	xor    %eax,%eax
+     7bd:	8d 76 00             	lea    0x0(%esi),%esi
+     7c0:	83 c0 01             	add    $0x1,%eax
+     7c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     7c7:	89 c1                	mov    %eax,%ecx
+     7c9:	75 f5                	jne    7c0 <strlen+0x10>
+}
+     7cb:	89 c8                	mov    %ecx,%eax
+     7cd:	5d                   	pop    %ebp
+     7ce:	c3                   	ret
+     7cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+     7d0:	31 c9                	xor    %ecx,%ecx
+}
+     7d2:	5d                   	pop    %ebp
+     7d3:	89 c8                	mov    %ecx,%eax
+     7d5:	c3                   	ret
+     7d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007e0 <memset>:
+{
+     7e0:	55                   	push   %ebp
+     7e1:	89 e5                	mov    %esp,%ebp
+     7e3:	57                   	push   %edi
+     7e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     7e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     7ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+     7ed:	89 d7                	mov    %edx,%edi
+     7ef:	fc                   	cld
+     7f0:	f3 aa                	rep stos %al,%es:(%edi)
+}
+     7f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     7f5:	89 d0                	mov    %edx,%eax
+     7f7:	c9                   	leave
+     7f8:	c3                   	ret
+     7f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000800 <strchr>:
+{
+     800:	55                   	push   %ebp
+     801:	89 e5                	mov    %esp,%ebp
+     803:	8b 45 08             	mov    0x8(%ebp),%eax
+     806:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     80a:	0f b6 10             	movzbl (%eax),%edx
+     80d:	84 d2                	test   %dl,%dl
+     80f:	75 12                	jne    823 <strchr+0x23>
+     811:	eb 1d                	jmp    830 <strchr+0x30>
+     813:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     817:	90                   	nop
+     818:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     81c:	83 c0 01             	add    $0x1,%eax
+     81f:	84 d2                	test   %dl,%dl
+     821:	74 0d                	je     830 <strchr+0x30>
+    if(*s == c)
+     823:	38 d1                	cmp    %dl,%cl
+     825:	75 f1                	jne    818 <strchr+0x18>
+}
+     827:	5d                   	pop    %ebp
+     828:	c3                   	ret
+     829:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     830:	31 c0                	xor    %eax,%eax
+}
+     832:	5d                   	pop    %ebp
+     833:	c3                   	ret
+     834:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     83b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     83f:	90                   	nop
+
+00000840 <memchr>:
+{
+     840:	55                   	push   %ebp
+     841:	89 e5                	mov    %esp,%ebp
+     843:	8b 55 10             	mov    0x10(%ebp),%edx
+     846:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     849:	85 d2                	test   %edx,%edx
+     84b:	74 1b                	je     868 <memchr+0x28>
+    if(*p == (char)c)
+     84d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+     851:	01 c2                	add    %eax,%edx
+     853:	eb 0a                	jmp    85f <memchr+0x1f>
+     855:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+     858:	83 c0 01             	add    $0x1,%eax
+     85b:	39 c2                	cmp    %eax,%edx
+     85d:	74 09                	je     868 <memchr+0x28>
+    if(*p == (char)c)
+     85f:	38 08                	cmp    %cl,(%eax)
+     861:	75 f5                	jne    858 <memchr+0x18>
+}
+     863:	5d                   	pop    %ebp
+     864:	c3                   	ret
+     865:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+     868:	31 c0                	xor    %eax,%eax
+}
+     86a:	5d                   	pop    %ebp
+     86b:	c3                   	ret
+     86c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000870 <gets>:
+{
+     870:	55                   	push   %ebp
+     871:	89 e5                	mov    %esp,%ebp
+     873:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+     874:	31 ff                	xor    %edi,%edi
+{
+     876:	56                   	push   %esi
+     877:	be 68 28 00 00       	mov    $0x2868,%esi
+     87c:	53                   	push   %ebx
+     87d:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     880:	8b 46 fc             	mov    -0x4(%esi),%eax
+     883:	85 c0                	test   %eax,%eax
+     885:	7e 15                	jle    89c <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     887:	83 ec 04             	sub    $0x4,%esp
+     88a:	50                   	push   %eax
+     88b:	56                   	push   %esi
+     88c:	57                   	push   %edi
+     88d:	e8 db 01 00 00       	call   a6d <write>
+    ob[fd].n = 0;
+     892:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+     899:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     89c:	83 c7 01             	add    $0x1,%edi
+     89f:	81 c6 08 01 00 00    	add    $0x108,%esi
+     8a5:	83 ff 10             	cmp    $0x10,%edi
+     8a8:	75 d6                	jne    880 <gets+0x10>
+  for(i=0; i+1 < max; ){
+     8aa:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+     8ac:	8d 75 e7             	lea    -0x19(%ebp),%esi
+     8af:	eb 2e                	jmp    8df <gets+0x6f>
+     8b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8b8:	83 ec 04             	sub    $0x4,%esp
+     8bb:	6a 01                	push   $0x1
+     8bd:	56                   	push   %esi
+     8be:	6a 00                	push   $0x0
+     8c0:	e8 a1 01 00 00       	call   a66 <read>
+    if(cc < 1)
+     8c5:	83 c4 10             	add    $0x10,%esp
+     8c8:	85 c0                	test   %eax,%eax
+     8ca:	7e 1d                	jle    8e9 <gets+0x79>
+    buf[i++] = c;
+     8cc:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     8d0:	8b 55 08             	mov    0x8(%ebp),%edx
+     8d3:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     8d7:	3c 0a                	cmp    $0xa,%al
+     8d9:	74 10                	je     8eb <gets+0x7b>
+     8db:	3c 0d                	cmp    $0xd,%al
+     8dd:	74 0c                	je     8eb <gets+0x7b>
+  for(i=0; i+1 < max; ){
+     8df:	89 df                	mov    %ebx,%edi
+     8e1:	83 c3 01             	add    $0x1,%ebx
+     8e4:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     8e7:	7c cf                	jl     8b8 <gets+0x48>
+     8e9:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     8eb:	8b 45 08             	mov    0x8(%ebp),%eax
+     8ee:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     8f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8f5:	5b                   	pop    %ebx
+     8f6:	5e                   	pop    %esi
+     8f7:	5f                   	pop    %edi
+     8f8:	5d                   	pop    %ebp
+     8f9:	c3                   	ret
+     8fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000900 <stat>:
+{
+     900:	55                   	push   %ebp
+     901:	89 e5                	mov    %esp,%ebp
+     903:	57                   	push   %edi
+     904:	56                   	push   %esi
+     905:	53                   	push   %ebx
+     906:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+     909:	6a 00                	push   $0x0
+     90b:	ff 75 08             	push   0x8(%ebp)
+     90e:	e8 76 01 00 00       	call   a89 <open>
+  if(fd < 0)
+     913:	83 c4 10             	add    $0x10,%esp
+     916:	85 c0                	test   %eax,%eax
+     918:	78 76                	js     990 <stat+0x90>
+  r = fstat(fd, st);
+     91a:	83 ec 08             	sub    $0x8,%esp
+     91d:	ff 75 0c             	push   0xc(%ebp)
+     920:	89 c3                	mov    %eax,%ebx
+     922:	50                   	push   %eax
+     923:	e8 7f 01 00 00       	call   aa7 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     928:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     92b:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     92d:	83 fb 0f             	cmp    $0xf,%ebx
+     930:	7f 40                	jg     972 <stat+0x72>
+     932:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     938:	8b 90 64 28 00 00    	mov    0x2864(%eax),%edx
+     93e:	8d b8 60 28 00 00    	lea    0x2860(%eax),%edi
+     944:	85 d2                	test   %edx,%edx
+     946:	7e 1a                	jle    962 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+     948:	83 ec 04             	sub    $0x4,%esp
+     94b:	05 68 28 00 00       	add    $0x2868,%eax
+     950:	52                   	push   %edx
+     951:	50                   	push   %eax
+     952:	53                   	push   %ebx
+     953:	e8 15 01 00 00       	call   a6d <write>
+    ob[fd].n = 0;
+     958:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+     95f:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+     962:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     968:	c7 80 60 28 00 00 00 	movl   $0x0,0x2860(%eax)
+     96f:	00 00 00 
+  return _close(fd);
+     972:	83 ec 0c             	sub    $0xc,%esp
+     975:	53                   	push   %ebx
+     976:	e8 f9 00 00 00       	call   a74 <_close>
+     97b:	83 c4 10             	add    $0x10,%esp
+}
+     97e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     981:	89 f0                	mov    %esi,%eax
+     983:	5b                   	pop    %ebx
+     984:	5e                   	pop    %esi
+     985:	5f                   	pop    %edi
+     986:	5d                   	pop    %ebp
+     987:	c3                   	ret
+     988:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     98f:	90                   	nop
+    return -1;
+     990:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     995:	eb e7                	jmp    97e <stat+0x7e>
+     997:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     99e:	66 90                	xchg   %ax,%ax
+
+000009a0 <atoi>:
+{
+     9a0:	55                   	push   %ebp
+     9a1:	89 e5                	mov    %esp,%ebp
+     9a3:	53                   	push   %ebx
+     9a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     9a7:	0f be 02             	movsbl (%edx),%eax
+     9aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     9ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     9b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     9b5:	77 1e                	ja     9d5 <atoi+0x35>
+     9b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     9c0:	83 c2 01             	add    $0x1,%edx
+     9c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     9c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     9ca:	0f be 02             	movsbl (%edx),%eax
+     9cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     9d0:	80 fb 09             	cmp    $0x9,%bl
+     9d3:	76 eb                	jbe    9c0 <atoi+0x20>
+}
+     9d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9d8:	89 c8                	mov    %ecx,%eax
+     9da:	c9                   	leave
+     9db:	c3                   	ret
+     9dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000009e0 <memmove>:
+{
+     9e0:	55                   	push   %ebp
+     9e1:	89 e5                	mov    %esp,%ebp
+     9e3:	57                   	push   %edi
+     9e4:	56                   	push   %esi
+     9e5:	8b 45 10             	mov    0x10(%ebp),%eax
+     9e8:	8b 55 08             	mov    0x8(%ebp),%edx
+     9eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     9ee:	85 c0                	test   %eax,%eax
+     9f0:	7e 13                	jle    a05 <memmove+0x25>
+     9f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     9f4:	89 d7                	mov    %edx,%edi
+     9f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     a00:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     a01:	39 f8                	cmp    %edi,%eax
+     a03:	75 fb                	jne    a00 <memmove+0x20>
+  return vdst;
+}
+     a05:	5e                   	pop    %esi
+     a06:	89 d0                	mov    %edx,%eax
+     a08:	5f                   	pop    %edi
+     a09:	5d                   	pop    %ebp
+     a0a:	c3                   	ret
+
+00000a0b <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+     a0b:	83 3d 54 18 00 00 00 	cmpl   $0x0,0x1854
+  jle 1f
+     a12:	7e 0a                	jle    a1e <syscallentry+0x13>
+  movl %esp, %ecx
+     a14:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+     a16:	ba 1d 0a 00 00       	mov    $0xa1d,%edx
+  sysenter
+     a1b:	0f 34                	sysenter
+2:
+  ret
+     a1d:	c3                   	ret
+1:
+  jl 3f
+     a1e:	7c 27                	jl     a47 <syscallentry+0x3c>
+  pushal
+     a20:	60                   	pusha
+  movl $1, %eax
+     a21:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     a26:	0f a2                	cpuid
+  movl $-1, sysentermode
+     a28:	c7 05 54 18 00 00 ff 	movl   $0xffffffff,0x1854
+     a2f:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     a32:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+     a38:	74 0a                	je     a44 <syscallentry+0x39>
+  movl $1, sysentermode
+     a3a:	c7 05 54 18 00 00 01 	movl   $0x1,0x1854
+     a41:	00 00 00 
+4:
+  popal
+     a44:	61                   	popa
+  jmp syscallentry
+     a45:	eb c4                	jmp    a0b <syscallentry>
+3:
+  int $T_SYSCALL
+     a47:	cd 40                	int    $0x40
+  ret
+     a49:	c3                   	ret
+
+00000a4a <_fork>:
+
+SYSCALLAS(_fork, fork)
+     a4a:	b8 01 00 00 00       	mov    $0x1,%eax
+     a4f:	eb ba                	jmp    a0b <syscallentry>
+
+00000a51 <_exit>:
+SYSCALLAS(_exit, exit)
+     a51:	b8 02 00 00 00       	mov    $0x2,%eax
+     a56:	eb b3                	jmp    a0b <syscallentry>
+
+00000a58 <wait>:
+SYSCALL(wait)
+     a58:	b8 03 00 00 00       	mov    $0x3,%eax
+     a5d:	eb ac                	jmp    a0b <syscallentry>
+
+00000a5f <pipe>:
+SYSCALL(pipe)
+     a5f:	b8 04 00 00 00       	mov    $0x4,%eax
+     a64:	eb a5                	jmp    a0b <syscallentry>
+
+00000a66 <read>:
+SYSCALL(read)
+     a66:	b8 05 00 00 00       	mov    $0x5,%eax
+     a6b:	eb 9e                	jmp    a0b <syscallentry>
+
+00000a6d <write>:
+SYSCALL(write)
+     a6d:	b8 10 00 00 00       	mov    $0x10,%eax
+     a72:	eb 97                	jmp    a0b <syscallentry>
+
+00000a74 <_close>:
+SYSCALLAS(_close, close)
+     a74:	b8 15 00 00 00       	mov    $0x15,%eax
+     a79:	eb 90                	jmp    a0b <syscallentry>
+
+00000a7b <kill>:
+SYSCALL(kill)
+     a7b:	b8 06 00 00 00       	mov    $0x6,%eax
+     a80:	eb 89                	jmp    a0b <syscallentry>
+
+00000a82 <_exec>:
+SYSCALLAS(_exec, exec)
+     a82:	b8 07 00 00 00       	mov    $0x7,%eax
+     a87:	eb 82                	jmp    a0b <syscallentry>
+
+00000a89 <open>:
+SYSCALL(open)
+     a89:	b8 0f 00 00 00       	mov    $0xf,%eax
+     a8e:	e9 78 ff ff ff       	jmp    a0b <syscallentry>
+
+00000a93 <mknod>:
+SYSCALL(mknod)
+     a93:	b8 11 00 00 00       	mov    $0x11,%eax
+     a98:	e9 6e ff ff ff       	jmp    a0b <syscallentry>
+
+00000a9d <unlink>:
+SYSCALL(unlink)
+     a9d:	b8 12 00 00 00       	mov    $0x12,%eax
+     aa2:	e9 64 ff ff ff       	jmp    a0b <syscallentry>
+
+00000aa7 <fstat>:
+SYSCALL(fstat)
+     aa7:	b8 08 00 00 00       	mov    $0x8,%eax
+     aac:	e9 5a ff ff ff       	jmp    a0b <syscallentry>
+
+00000ab1 <link>:
+SYSCALL(link)
+     ab1:	b8 13 00 00 00       	mov    $0x13,%eax
+     ab6:	e9 50 ff ff ff       	jmp    a0b <syscallentry>
+
+00000abb <mkdir>:
+SYSCALL(mkdir)
+     abb:	b8 14 00 00 00       	mov    $0x14,%eax
+     ac0:	e9 46 ff ff ff       	jmp    a0b <syscallentry>
+
+00000ac5 <chdir>:
+SYSCALL(chdir)
+     ac5:	b8 09 00 00 00       	mov    $0x9,%eax
+     aca:	e9 3c ff ff ff       	jmp    a0b <syscallentry>
+
+00000acf <dup>:
+SYSCALL(dup)
+     acf:	b8 0a 00 00 00       	mov    $0xa,%eax
+     ad4:	e9 32 ff ff ff       	jmp    a0b <syscallentry>
+
+00000ad9 <getpid>:
+SYSCALL(getpid)
+     ad9:	b8 0b 00 00 00       	mov    $0xb,%eax
+     ade:	e9 28 ff ff ff       	jmp    a0b <syscallentry>
+
+00000ae3 <sbrk>:
+SYSCALL(sbrk)
+     ae3:	b8 0c 00 00 00       	mov    $0xc,%eax
+     ae8:	e9 1e ff ff ff       	jmp    a0b <syscallentry>
+
+00000aed <sleep>:
+SYSCALL(sleep)
+     aed:	b8 0d 00 00 00       	mov    $0xd,%eax
+     af2:	e9 14 ff ff ff       	jmp    a0b <syscallentry>
+
+00000af7 <uptime>:
+SYSCALL(uptime)
+     af7:	b8 0e 00 00 00       	mov    $0xe,%eax
+     afc:	e9 0a ff ff ff       	jmp    a0b <syscallentry>
+
+00000b01 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+     b01:	b8 16 00 00 00       	mov    $0x16,%eax
+     b06:	e9 00 ff ff ff       	jmp    a0b <syscallentry>
+
+00000b0b <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+     b0b:	b8 17 00 00 00       	mov    $0x17,%eax
+     b10:	e9 f6 fe ff ff       	jmp    a0b <syscallentry>
+
+00000b15 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+     b15:	b8 18 00 00 00       	mov    $0x18,%eax
+     b1a:	e9 ec fe ff ff       	jmp    a0b <syscallentry>
+
+00000b1f <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+     b1f:	b8 19 00 00 00       	mov    $0x19,%eax
+     b24:	e9 e2 fe ff ff       	jmp    a0b <syscallentry>
+
+00000b29 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+     b29:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     b2e:	e9 d8 fe ff ff       	jmp    a0b <syscallentry>
+
+00000b33 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+     b33:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     b38:	e9 ce fe ff ff       	jmp    a0b <syscallentry>
+
+00000b3d <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+     b3d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     b42:	e9 c4 fe ff ff       	jmp    a0b <syscallentry>
+
+00000b47 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+     b47:	b8 20 00 00 00       	mov    $0x20,%eax
+     b4c:	e9 ba fe ff ff       	jmp    a0b <syscallentry>
+
+00000b51 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+     b51:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     b56:	e9 b0 fe ff ff       	jmp    a0b <syscallentry>
+
+00000b5b <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+     b5b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     b60:	e9 a6 fe ff ff       	jmp    a0b <syscallentry>
+
+00000b65 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+     b65:	b8 21 00 00 00       	mov    $0x21,%eax
+     b6a:	e9 9c fe ff ff       	jmp    a0b <syscallentry>
+
+00000b6f <yield>:
+SYSCALL(yield) // yield the CPU to another process
+     b6f:	b8 22 00 00 00       	mov    $0x22,%eax
+     b74:	e9 92 fe ff ff       	jmp    a0b <syscallentry>
+
+00000b79 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+     b79:	b8 23 00 00 00       	mov    $0x23,%eax
+     b7e:	e9 88 fe ff ff       	jmp    a0b <syscallentry>
+
+00000b83 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+     b83:	b8 24 00 00 00       	mov    $0x24,%eax
+     b88:	e9 7e fe ff ff       	jmp    a0b <syscallentry>
+
+00000b8d <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+     b8d:	b8 25 00 00 00       	mov    $0x25,%eax
+     b92:	e9 74 fe ff ff       	jmp    a0b <syscallentry>
+
+00000b97 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+     b97:	b8 26 00 00 00       	mov    $0x26,%eax
+     b9c:	e9 6a fe ff ff       	jmp    a0b <syscallentry>
+
+00000ba1 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+     ba1:	b8 27 00 00 00       	mov    $0x27,%eax
+     ba6:	e9 60 fe ff ff       	jmp    a0b <syscallentry>
+
+00000bab <mmap>:
+SYSCALL(mmap) // map a file into memory
+     bab:	b8 28 00 00 00       	mov    $0x28,%eax
+     bb0:	e9 56 fe ff ff       	jmp    a0b <syscallentry>
+
+00000bb5 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+     bb5:	b8 29 00 00 00       	mov    $0x29,%eax
+     bba:	e9 4c fe ff ff       	jmp    a0b <syscallentry>
+
+00000bbf <readv>:
+SYSCALL(readv) // read into several buffers
+     bbf:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     bc4:	e9 42 fe ff ff       	jmp    a0b <syscallentry>
+
+00000bc9 <writev>:
+SYSCALL(writev) // write from several buffers
+     bc9:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     bce:	e9 38 fe ff ff       	jmp    a0b <syscallentry>
+
+00000bd3 <pread>:
+SYSCALL(pread) // read at an offset
+     bd3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     bd8:	e9 2e fe ff ff       	jmp    a0b <syscallentry>
+
+00000bdd <pwrite>:
+SYSCALL(pwrite) // write at an offset
+     bdd:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     be2:	e9 24 fe ff ff       	jmp    a0b <syscallentry>
+
+00000be7 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+     be7:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     bec:	e9 1a fe ff ff       	jmp    a0b <syscallentry>
+
+00000bf1 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+     bf1:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     bf6:	e9 10 fe ff ff       	jmp    a0b <syscallentry>
+
+00000bfb <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+     bfb:	b8 30 00 00 00       	mov    $0x30,%eax
+     c00:	e9 06 fe ff ff       	jmp    a0b <syscallentry>
+
+00000c05 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+     c05:	b8 31 00 00 00       	mov    $0x31,%eax
+     c0a:	e9 fc fd ff ff       	jmp    a0b <syscallentry>
+
+00000c0f <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+     c0f:	b8 32 00 00 00       	mov    $0x32,%eax
+     c14:	e9 f2 fd ff ff       	jmp    a0b <syscallentry>
+
+00000c19 <profread>:
+SYSCALL(profread) // drain profiler samples
+     c19:	b8 33 00 00 00       	mov    $0x33,%eax
+     c1e:	e9 e8 fd ff ff       	jmp    a0b <syscallentry>
+
+00000c23 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+     c23:	b8 34 00 00 00       	mov    $0x34,%eax
+     c28:	e9 de fd ff ff       	jmp    a0b <syscallentry>
+
+00000c2d <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+     c2d:	b8 35 00 00 00       	mov    $0x35,%eax
+     c32:	e9 d4 fd ff ff       	jmp    a0b <syscallentry>
+
+00000c37 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+     c37:	b8 36 00 00 00       	mov    $0x36,%eax
+     c3c:	e9 ca fd ff ff       	jmp    a0b <syscallentry>
+
+00000c41 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+     c41:	b8 37 00 00 00       	mov    $0x37,%eax
+     c46:	e9 c0 fd ff ff       	jmp    a0b <syscallentry>
+     c4b:	66 90                	xchg   %ax,%ax
+     c4d:	66 90                	xchg   %ax,%ax
+     c4f:	90                   	nop
+
+00000c50 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     c50:	55                   	push   %ebp
+     c51:	89 e5                	mov    %esp,%ebp
+     c53:	57                   	push   %edi
+     c54:	56                   	push   %esi
+     c55:	53                   	push   %ebx
+     c56:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     c58:	89 d1                	mov    %edx,%ecx
+{
+     c5a:	83 ec 3c             	sub    $0x3c,%esp
+     c5d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     c60:	85 d2                	test   %edx,%edx
+     c62:	0f 89 80 00 00 00    	jns    ce8 <printint+0x98>
+     c68:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     c6c:	74 7a                	je     ce8 <printint+0x98>
+    x = -xx;
+     c6e:	f7 d9                	neg    %ecx
+    neg = 1;
+     c70:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     c75:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     c78:	31 f6                	xor    %esi,%esi
+     c7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     c80:	89 c8                	mov    %ecx,%eax
+     c82:	31 d2                	xor    %edx,%edx
+     c84:	89 f7                	mov    %esi,%edi
+     c86:	f7 f3                	div    %ebx
+     c88:	8d 76 01             	lea    0x1(%esi),%esi
+     c8b:	0f b6 92 e0 12 00 00 	movzbl 0x12e0(%edx),%edx
+     c92:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     c96:	89 ca                	mov    %ecx,%edx
+     c98:	89 c1                	mov    %eax,%ecx
+     c9a:	39 da                	cmp    %ebx,%edx
+     c9c:	73 e2                	jae    c80 <printint+0x30>
+  if(neg)
+     c9e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     ca1:	85 c0                	test   %eax,%eax
+     ca3:	74 07                	je     cac <printint+0x5c>
+    buf[i++] = '-';
+     ca5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     caa:	89 f7                	mov    %esi,%edi
+     cac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     caf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     cb2:	01 df                	add    %ebx,%edi
+     cb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     cb8:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+     cbb:	83 ec 04             	sub    $0x4,%esp
+     cbe:	88 45 d7             	mov    %al,-0x29(%ebp)
+     cc1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     cc4:	6a 01                	push   $0x1
+     cc6:	50                   	push   %eax
+     cc7:	56                   	push   %esi
+     cc8:	e8 e3 f6 ff ff       	call   3b0 <bufwrite>
+  while(--i >= 0)
+     ccd:	89 f8                	mov    %edi,%eax
+     ccf:	83 c4 10             	add    $0x10,%esp
+     cd2:	83 ef 01             	sub    $0x1,%edi
+     cd5:	39 d8                	cmp    %ebx,%eax
+     cd7:	75 df                	jne    cb8 <printint+0x68>
+}
+     cd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cdc:	5b                   	pop    %ebx
+     cdd:	5e                   	pop    %esi
+     cde:	5f                   	pop    %edi
+     cdf:	5d                   	pop    %ebp
+     ce0:	c3                   	ret
+     ce1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     ce8:	31 c0                	xor    %eax,%eax
+     cea:	eb 89                	jmp    c75 <printint+0x25>
+     cec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000cf0 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     cf0:	55                   	push   %ebp
+     cf1:	89 e5                	mov    %esp,%ebp
+     cf3:	57                   	push   %edi
+     cf4:	56                   	push   %esi
+     cf5:	53                   	push   %ebx
+     cf6:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     cf9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     cfc:	0f b6 18             	movzbl (%eax),%ebx
+     cff:	84 db                	test   %bl,%bl
+     d01:	74 6c                	je     d6f <printf+0x7f>
+     d03:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+     d06:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+     d09:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     d0b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     d0e:	eb 26                	jmp    d36 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     d10:	83 f8 25             	cmp    $0x25,%eax
+     d13:	74 4b                	je     d60 <printf+0x70>
+  bufwrite(fd, &c, 1);
+     d15:	83 ec 04             	sub    $0x4,%esp
+     d18:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     d1b:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     d1e:	6a 01                	push   $0x1
+     d20:	50                   	push   %eax
+     d21:	ff 75 08             	push   0x8(%ebp)
+     d24:	e8 87 f6 ff ff       	call   3b0 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+     d29:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     d2c:	0f b6 1f             	movzbl (%edi),%ebx
+     d2f:	83 c7 01             	add    $0x1,%edi
+     d32:	84 db                	test   %bl,%bl
+     d34:	74 39                	je     d6f <printf+0x7f>
+    c = fmt[i] & 0xff;
+     d36:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     d39:	85 f6                	test   %esi,%esi
+     d3b:	74 d3                	je     d10 <printf+0x20>
+      }
+    } else if(state == '%'){
+     d3d:	83 fe 25             	cmp    $0x25,%esi
+     d40:	75 ea                	jne    d2c <printf+0x3c>
+      if(c == 'd'){
+     d42:	83 f8 25             	cmp    $0x25,%eax
+     d45:	0f 84 d5 01 00 00    	je     f20 <printf+0x230>
+     d4b:	83 e8 63             	sub    $0x63,%eax
+     d4e:	83 f8 15             	cmp    $0x15,%eax
+     d51:	77 45                	ja     d98 <printf+0xa8>
+     d53:	ff 24 85 88 12 00 00 	jmp    *0x1288(,%eax,4)
+     d5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     d60:	0f b6 1f             	movzbl (%edi),%ebx
+     d63:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+     d66:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     d6b:	84 db                	test   %bl,%bl
+     d6d:	75 c7                	jne    d36 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+     d6f:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+     d73:	74 0b                	je     d80 <printf+0x90>
+    fflush(fd);
+}
+     d75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d78:	5b                   	pop    %ebx
+     d79:	5e                   	pop    %esi
+     d7a:	5f                   	pop    %edi
+     d7b:	5d                   	pop    %ebp
+     d7c:	c3                   	ret
+     d7d:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+     d80:	83 ec 0c             	sub    $0xc,%esp
+     d83:	6a 02                	push   $0x2
+     d85:	e8 c6 f7 ff ff       	call   550 <fflush>
+     d8a:	83 c4 10             	add    $0x10,%esp
+}
+     d8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d90:	5b                   	pop    %ebx
+     d91:	5e                   	pop    %esi
+     d92:	5f                   	pop    %edi
+     d93:	5d                   	pop    %ebp
+     d94:	c3                   	ret
+     d95:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+     d98:	83 ec 04             	sub    $0x4,%esp
+     d9b:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     d9e:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+     da2:	6a 01                	push   $0x1
+     da4:	52                   	push   %edx
+     da5:	89 55 c0             	mov    %edx,-0x40(%ebp)
+     da8:	ff 75 08             	push   0x8(%ebp)
+     dab:	e8 00 f6 ff ff       	call   3b0 <bufwrite>
+     db0:	83 c4 0c             	add    $0xc,%esp
+     db3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     db6:	6a 01                	push   $0x1
+     db8:	8b 55 c0             	mov    -0x40(%ebp),%edx
+     dbb:	52                   	push   %edx
+      state = 0;
+     dbc:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+     dbe:	ff 75 08             	push   0x8(%ebp)
+     dc1:	e8 ea f5 ff ff       	call   3b0 <bufwrite>
+        putc(fd, c);
+     dc6:	83 c4 10             	add    $0x10,%esp
+     dc9:	e9 5e ff ff ff       	jmp    d2c <printf+0x3c>
+     dce:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+     dd0:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     dd3:	83 ec 0c             	sub    $0xc,%esp
+     dd6:	b9 10 00 00 00       	mov    $0x10,%ecx
+     ddb:	8b 16                	mov    (%esi),%edx
+     ddd:	6a 00                	push   $0x0
+     ddf:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+     de2:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+     de5:	e8 66 fe ff ff       	call   c50 <printint>
+        ap++;
+     dea:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     ded:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     df0:	31 f6                	xor    %esi,%esi
+     df2:	e9 35 ff ff ff       	jmp    d2c <printf+0x3c>
+     df7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dfe:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     e00:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     e03:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     e05:	83 c0 04             	add    $0x4,%eax
+     e08:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+     e0b:	b8 80 12 00 00       	mov    $0x1280,%eax
+     e10:	85 db                	test   %ebx,%ebx
+     e12:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+     e15:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+     e18:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+     e1a:	53                   	push   %ebx
+     e1b:	e8 90 f9 ff ff       	call   7b0 <strlen>
+     e20:	83 c4 0c             	add    $0xc,%esp
+     e23:	50                   	push   %eax
+     e24:	53                   	push   %ebx
+     e25:	ff 75 08             	push   0x8(%ebp)
+     e28:	e8 83 f5 ff ff       	call   3b0 <bufwrite>
+     e2d:	83 c4 10             	add    $0x10,%esp
+     e30:	e9 f7 fe ff ff       	jmp    d2c <printf+0x3c>
+     e35:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+     e38:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+     e3b:	83 ec 04             	sub    $0x4,%esp
+     e3e:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+     e41:	8b 06                	mov    (%esi),%eax
+        ap++;
+     e43:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+     e46:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+     e49:	6a 01                	push   $0x1
+     e4b:	52                   	push   %edx
+     e4c:	ff 75 08             	push   0x8(%ebp)
+     e4f:	e8 5c f5 ff ff       	call   3b0 <bufwrite>
+        ap++;
+     e54:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     e57:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     e5a:	31 f6                	xor    %esi,%esi
+     e5c:	e9 cb fe ff ff       	jmp    d2c <printf+0x3c>
+     e61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+     e68:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     e6b:	83 ec 0c             	sub    $0xc,%esp
+     e6e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     e73:	8b 16                	mov    (%esi),%edx
+     e75:	6a 01                	push   $0x1
+     e77:	e9 63 ff ff ff       	jmp    ddf <printf+0xef>
+     e7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+     e80:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     e83:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     e86:	89 7d c0             	mov    %edi,-0x40(%ebp)
+     e89:	89 55 bc             	mov    %edx,-0x44(%ebp)
+     e8c:	8b 18                	mov    (%eax),%ebx
+     e8e:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+     e91:	31 c0                	xor    %eax,%eax
+     e93:	89 c7                	mov    %eax,%edi
+     e95:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+     e98:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+     e9d:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+     e9f:	f7 e1                	mul    %ecx
+     ea1:	c1 ea 03             	shr    $0x3,%edx
+     ea4:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     ea7:	89 d1                	mov    %edx,%ecx
+     ea9:	01 c0                	add    %eax,%eax
+     eab:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     ead:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+     eaf:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     eb1:	be 0a 00 00 00       	mov    $0xa,%esi
+     eb6:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+     eb8:	89 da                	mov    %ebx,%edx
+     eba:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+     ebc:	89 fe                	mov    %edi,%esi
+     ebe:	83 c7 01             	add    $0x1,%edi
+     ec1:	8d 42 30             	lea    0x30(%edx),%eax
+     ec4:	89 da                	mov    %ebx,%edx
+     ec6:	8d 14 92             	lea    (%edx,%edx,4),%edx
+     ec9:	01 d2                	add    %edx,%edx
+     ecb:	29 d0                	sub    %edx,%eax
+     ecd:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+     ed1:	89 c8                	mov    %ecx,%eax
+     ed3:	09 d8                	or     %ebx,%eax
+     ed5:	75 c1                	jne    e98 <printf+0x1a8>
+     ed7:	8b 55 bc             	mov    -0x44(%ebp),%edx
+     eda:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     edd:	01 d6                	add    %edx,%esi
+     edf:	89 f7                	mov    %esi,%edi
+     ee1:	89 d6                	mov    %edx,%esi
+     ee3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ee7:	90                   	nop
+    putc(fd, buf[i]);
+     ee8:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+     eeb:	83 ec 04             	sub    $0x4,%esp
+     eee:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+     ef1:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+     ef4:	6a 01                	push   $0x1
+     ef6:	50                   	push   %eax
+     ef7:	53                   	push   %ebx
+     ef8:	e8 b3 f4 ff ff       	call   3b0 <bufwrite>
+  while(--i >= 0)
+     efd:	89 fa                	mov    %edi,%edx
+     eff:	83 c4 10             	add    $0x10,%esp
+     f02:	83 ef 01             	sub    $0x1,%edi
+     f05:	39 d6                	cmp    %edx,%esi
+     f07:	75 df                	jne    ee8 <printf+0x1f8>
+        ap += 2;
+     f09:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+     f0d:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+     f10:	31 f6                	xor    %esi,%esi
+     f12:	e9 15 fe ff ff       	jmp    d2c <printf+0x3c>
+     f17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f1e:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+     f20:	83 ec 04             	sub    $0x4,%esp
+     f23:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     f26:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     f29:	6a 01                	push   $0x1
+     f2b:	e9 8b fe ff ff       	jmp    dbb <printf+0xcb>
+
+00000f30 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     f30:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f31:	a1 e0 38 00 00       	mov    0x38e0,%eax
+{
+     f36:	89 e5                	mov    %esp,%ebp
+     f38:	57                   	push   %edi
+     f39:	56                   	push   %esi
+     f3a:	53                   	push   %ebx
+     f3b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     f3e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f48:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f4a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f4c:	39 ca                	cmp    %ecx,%edx
+     f4e:	73 30                	jae    f80 <free+0x50>
+     f50:	39 c1                	cmp    %eax,%ecx
+     f52:	72 04                	jb     f58 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f54:	39 c2                	cmp    %eax,%edx
+     f56:	72 f0                	jb     f48 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     f58:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     f5b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     f5e:	39 f8                	cmp    %edi,%eax
+     f60:	74 2e                	je     f90 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f62:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     f65:	8b 42 04             	mov    0x4(%edx),%eax
+     f68:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     f6b:	39 f1                	cmp    %esi,%ecx
+     f6d:	74 38                	je     fa7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     f6f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     f71:	5b                   	pop    %ebx
+  freep = p;
+     f72:	89 15 e0 38 00 00    	mov    %edx,0x38e0
+}
+     f78:	5e                   	pop    %esi
+     f79:	5f                   	pop    %edi
+     f7a:	5d                   	pop    %ebp
+     f7b:	c3                   	ret
+     f7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f80:	39 c1                	cmp    %eax,%ecx
+     f82:	72 d0                	jb     f54 <free+0x24>
+     f84:	eb c2                	jmp    f48 <free+0x18>
+     f86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f8d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+     f90:	03 70 04             	add    0x4(%eax),%esi
+     f93:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f96:	8b 02                	mov    (%edx),%eax
+     f98:	8b 00                	mov    (%eax),%eax
+     f9a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     f9d:	8b 42 04             	mov    0x4(%edx),%eax
+     fa0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     fa3:	39 f1                	cmp    %esi,%ecx
+     fa5:	75 c8                	jne    f6f <free+0x3f>
+    p->s.size += bp->s.size;
+     fa7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     faa:	89 15 e0 38 00 00    	mov    %edx,0x38e0
+    p->s.size += bp->s.size;
+     fb0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     fb3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     fb6:	89 0a                	mov    %ecx,(%edx)
+}
+     fb8:	5b                   	pop    %ebx
+     fb9:	5e                   	pop    %esi
+     fba:	5f                   	pop    %edi
+     fbb:	5d                   	pop    %ebp
+     fbc:	c3                   	ret
+     fbd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000fc0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     fc0:	55                   	push   %ebp
+     fc1:	89 e5                	mov    %esp,%ebp
+     fc3:	57                   	push   %edi
+     fc4:	56                   	push   %esi
+     fc5:	53                   	push   %ebx
+     fc6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     fc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+     fcc:	8b 15 e0 38 00 00    	mov    0x38e0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     fd2:	8d 78 07             	lea    0x7(%eax),%edi
+     fd5:	c1 ef 03             	shr    $0x3,%edi
+     fd8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+     fdb:	85 d2                	test   %edx,%edx
+     fdd:	0f 84 8d 00 00 00    	je     1070 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     fe3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     fe5:	8b 48 04             	mov    0x4(%eax),%ecx
+     fe8:	39 f9                	cmp    %edi,%ecx
+     fea:	73 64                	jae    1050 <malloc+0x90>
+  if(nu < 4096)
+     fec:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     ff1:	39 df                	cmp    %ebx,%edi
+     ff3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     ff6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     ffd:	eb 0a                	jmp    1009 <malloc+0x49>
+     fff:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1000:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1002:	8b 48 04             	mov    0x4(%eax),%ecx
+    1005:	39 f9                	cmp    %edi,%ecx
+    1007:	73 47                	jae    1050 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1009:	89 c2                	mov    %eax,%edx
+    100b:	39 05 e0 38 00 00    	cmp    %eax,0x38e0
+    1011:	75 ed                	jne    1000 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1013:	83 ec 0c             	sub    $0xc,%esp
+    1016:	56                   	push   %esi
+    1017:	e8 c7 fa ff ff       	call   ae3 <sbrk>
+  if(p == (char*)-1)
+    101c:	83 c4 10             	add    $0x10,%esp
+    101f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1022:	74 1c                	je     1040 <malloc+0x80>
+  hp->s.size = nu;
+    1024:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1027:	83 ec 0c             	sub    $0xc,%esp
+    102a:	83 c0 08             	add    $0x8,%eax
+    102d:	50                   	push   %eax
+    102e:	e8 fd fe ff ff       	call   f30 <free>
+  return freep;
+    1033:	8b 15 e0 38 00 00    	mov    0x38e0,%edx
+      if((p = morecore(nunits)) == 0)
+    1039:	83 c4 10             	add    $0x10,%esp
+    103c:	85 d2                	test   %edx,%edx
+    103e:	75 c0                	jne    1000 <malloc+0x40>
+        return 0;
+  }
+}
+    1040:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1043:	31 c0                	xor    %eax,%eax
+}
+    1045:	5b                   	pop    %ebx
+    1046:	5e                   	pop    %esi
+    1047:	5f                   	pop    %edi
+    1048:	5d                   	pop    %ebp
+    1049:	c3                   	ret
+    104a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1050:	39 cf                	cmp    %ecx,%edi
+    1052:	74 4c                	je     10a0 <malloc+0xe0>
+        p->s.size -= nunits;
+    1054:	29 f9                	sub    %edi,%ecx
+    1056:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1059:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    105c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    105f:	89 15 e0 38 00 00    	mov    %edx,0x38e0
+}
+    1065:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1068:	83 c0 08             	add    $0x8,%eax
+}
+    106b:	5b                   	pop    %ebx
+    106c:	5e                   	pop    %esi
+    106d:	5f                   	pop    %edi
+    106e:	5d                   	pop    %ebp
+    106f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1070:	c7 05 e0 38 00 00 e4 	movl   $0x38e4,0x38e0
+    1077:	38 00 00 
+    base.s.size = 0;
+    107a:	b8 e4 38 00 00       	mov    $0x38e4,%eax
+    base.s.ptr = freep = prevp = &base;
+    107f:	c7 05 e4 38 00 00 e4 	movl   $0x38e4,0x38e4
+    1086:	38 00 00 
+    base.s.size = 0;
+    1089:	c7 05 e8 38 00 00 00 	movl   $0x0,0x38e8
+    1090:	00 00 00 
+    if(p->s.size >= nunits){
+    1093:	e9 54 ff ff ff       	jmp    fec <malloc+0x2c>
+    1098:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    109f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    10a0:	8b 08                	mov    (%eax),%ecx
+    10a2:	89 0a                	mov    %ecx,(%edx)
+    10a4:	eb b9                	jmp    105f <malloc+0x9f>
+    10a6:	66 90                	xchg   %ax,%ax
+    10a8:	66 90                	xchg   %ax,%ax
+    10aa:	66 90                	xchg   %ax,%ax
+    10ac:	66 90                	xchg   %ax,%ax
+    10ae:	66 90                	xchg   %ax,%ax
+
+000010b0 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+    10b0:	55                   	push   %ebp
+    10b1:	89 e5                	mov    %esp,%ebp
+    10b3:	57                   	push   %edi
+    10b4:	56                   	push   %esi
+    10b5:	be 01 00 00 00       	mov    $0x1,%esi
+    10ba:	53                   	push   %ebx
+    10bb:	83 ec 28             	sub    $0x28,%esp
+    10be:	8b 45 0c             	mov    0xc(%ebp),%eax
+    10c1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    10c4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+    10c7:	68 00 98 00 00       	push   $0x9800
+    10cc:	e8 ef fe ff ff       	call   fc0 <malloc>
+    10d1:	83 c4 10             	add    $0x10,%esp
+    10d4:	89 c7                	mov    %eax,%edi
+    10d6:	85 c0                	test   %eax,%eax
+    10d8:	74 62                	je     113c <waitpoll+0x8c>
+    10da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+    10e0:	83 ec 0c             	sub    $0xc,%esp
+    10e3:	6a 01                	push   $0x1
+    10e5:	e8 03 fa ff ff       	call   aed <sleep>
+    fn();
+    10ea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    10ed:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+    10ef:	58                   	pop    %eax
+    10f0:	5a                   	pop    %edx
+    10f1:	68 00 02 00 00       	push   $0x200
+    10f6:	57                   	push   %edi
+    10f7:	e8 eb fa ff ff       	call   be7 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+    10fc:	83 c4 10             	add    $0x10,%esp
+    10ff:	85 c0                	test   %eax,%eax
+    1101:	7e 2d                	jle    1130 <waitpoll+0x80>
+    1103:	6b c0 4c             	imul   $0x4c,%eax,%eax
+    1106:	89 fa                	mov    %edi,%edx
+    alive = 0;
+    1108:	31 c9                	xor    %ecx,%ecx
+    110a:	01 f8                	add    %edi,%eax
+    110c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+    1110:	3b 1a                	cmp    (%edx),%ebx
+    1112:	75 07                	jne    111b <waitpoll+0x6b>
+        alive = 1;
+    1114:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+    1118:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+    111b:	83 c2 4c             	add    $0x4c,%edx
+    111e:	39 d0                	cmp    %edx,%eax
+    1120:	75 ee                	jne    1110 <waitpoll+0x60>
+  } while(alive);
+    1122:	85 c9                	test   %ecx,%ecx
+    1124:	75 ba                	jne    10e0 <waitpoll+0x30>
+    1126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    112d:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+    1130:	83 ec 0c             	sub    $0xc,%esp
+    1133:	57                   	push   %edi
+    1134:	e8 f7 fd ff ff       	call   f30 <free>
+  wait();
+    1139:	83 c4 10             	add    $0x10,%esp
+}
+    113c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    113f:	5b                   	pop    %ebx
+    1140:	5e                   	pop    %esi
+    1141:	5f                   	pop    %edi
+    1142:	5d                   	pop    %ebp
+  wait();
+    1143:	e9 10 f9 ff ff       	jmp    a58 <wait>
+    1148:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    114f:	90                   	nop
+
+00001150 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+    1150:	55                   	push   %ebp
+    1151:	89 e5                	mov    %esp,%ebp
+    1153:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+    1156:	c7 45 f0 f1 12 00 00 	movl   $0x12f1,-0x10(%ebp)
+    115d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+    1164:	e8 87 f4 ff ff       	call   5f0 <fork>
+    1169:	85 c0                	test   %eax,%eax
+    116b:	78 09                	js     1176 <runps+0x26>
+    return -1;
+  if(pid == 0){
+    116d:	74 0e                	je     117d <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+    116f:	e8 e4 f8 ff ff       	call   a58 <wait>
+}
+    1174:	c9                   	leave
+    1175:	c3                   	ret
+    1176:	c9                   	leave
+    return -1;
+    1177:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    117c:	c3                   	ret
+    exec("ps", argv);
+    117d:	50                   	push   %eax
+    117e:	50                   	push   %eax
+    117f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    1182:	50                   	push   %eax
+    1183:	68 f1 12 00 00       	push   $0x12f1
+    1188:	e8 c3 f4 ff ff       	call   650 <exec>
+    printf(2, "exec ps failed\n");
+    118d:	5a                   	pop    %edx
+    118e:	59                   	pop    %ecx
+    118f:	68 f4 12 00 00       	push   $0x12f4
+    1194:	6a 02                	push   $0x2
+    1196:	e8 55 fb ff ff       	call   cf0 <printf>
+    exit();
+    119b:	e8 a0 f4 ff ff       	call   640 <exit>
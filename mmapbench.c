@@ -0,0 +1,122 @@
+// Compare scanning a file with read() and through mmap(),
+// then check that a MAP_SHARED mapping's changes reach
+// the file when it is unmapped.
+//
+// usage: mmapbench [kb]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define FILENAME "mmapbench.tmp"
+
+char buf[4096];
+
+void
+makefile(int kb)
+{
+  int fd, i;
+
+  if((fd = open(FILENAME, O_CREATE|O_RDWR)) < 0){
+    printf(2, "mmapbench: cannot create %s\n", FILENAME);
+    exit();
+  }
+  for(i = 0; i < sizeof(buf); i++)
+    buf[i] = i % 251;
+  for(i = 0; i < kb/4; i++)
+    write(fd, buf, sizeof(buf));
+  close(fd);
+}
+
+// Sum the file's bytes, reading bs bytes at a time.
+uint
+readsum(int bs)
+{
+  int fd, n, i;
+  uint sum = 0;
+
+  fd = open(FILENAME, O_RDONLY);
+  while((n = read(fd, buf, bs)) > 0)
+    for(i = 0; i < n; i++)
+      sum += (uchar)buf[i];
+  close(fd);
+  return sum;
+}
+
+// Sum the file's bytes through a mapping.
+uint
+mmapsum(int size)
+{
+  int fd, i;
+  uchar *p;
+  uint sum = 0;
+
+  fd = open(FILENAME, O_RDONLY);
+  if((p = mmap(fd, 0, size, PROT_READ, MAP_PRIVATE)) == (uchar*)-1){
+    printf(2, "mmapbench: mmap failed\n");
+    exit();
+  }
+  close(fd);
+  for(i = 0; i < size; i++)
+    sum += p[i];
+  munmap(p, size);
+  return sum;
+}
+
+void
+run(char *name, uint (*scan)(int), int arg, int kb)
+{
+  int t;
+  uint sum;
+
+  t = uptime();
+  sum = scan(arg);
+  t = uptime() - t;
+  printf(1, "%s: %d KB in %d ticks, sum %d\n", name, kb, t, sum);
+}
+
+// Add 1 to the first byte of every page through a shared
+// mapping and check that read() sees it after munmap().
+void
+shared(int size)
+{
+  int fd, i;
+  char *p;
+
+  fd = open(FILENAME, O_RDWR);
+  if((p = mmap(fd, 0, size, PROT_READ|PROT_WRITE, MAP_SHARED)) == (char*)-1){
+    printf(2, "mmapbench: shared mmap failed\n");
+    exit();
+  }
+  for(i = 0; i < size; i += 4096)
+    p[i]++;
+  munmap(p, size);
+
+  for(i = 0; i < size; i += 4096){
+    if(read(fd, buf, sizeof(buf)) != sizeof(buf) || buf[0] != 1){
+      printf(2, "mmapbench: shared write lost at %d\n", i);
+      exit();
+    }
+  }
+  close(fd);
+  printf(1, "shared: changes written back\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  int kb;
+
+  kb = argc > 1 ? atoi(argv[1]) : 256;
+  kb -= kb % 4;
+  makefile(kb);
+
+  run("read 512", readsum, 512, kb);
+  run("read 4096", readsum, 4096, kb);
+  run("mmap", mmapsum, kb*1024, kb);
+  shared(kb*1024);
+
+  unlink(FILENAME);
+  exit();
+}
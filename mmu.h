@@ -11,6 +11,14 @@
 
 #define CR4_PSE         0x00000010      // Page size extension
 
+// Model-specific registers for sysenter
+#define MSR_SYSENTER_CS  0x174          // kernel %cs (%ss is %cs+8)
+#define MSR_SYSENTER_ESP 0x175          // %esp loaded on entry
+#define MSR_SYSENTER_EIP 0x176          // entry point
+
+// CPUID leaf 1 %edx feature flags
+#define CPUID_SEP       0x00000800      // sysenter/sysexit
+
 // various segment selectors.
 #define SEG_KCODE 1  // kernel code
 #define SEG_KDATA 2  // kernel data+stack
@@ -94,6 +102,7 @@ struct segdesc {
 #define PTE_P           0x001   // Present
 #define PTE_W           0x002   // Writeable
 #define PTE_U           0x004   // User
+#define PTE_D           0x040   // Dirty
 #define PTE_PS          0x080   // Page Size
 
 // Address in page table or page directory entry
@@ -101,8 +110,6 @@ struct segdesc {
 #define PTE_FLAGS(pte)  ((uint)(pte) &  0xFFF)
 
 #ifndef __ASSEMBLER__
-typedef uint pte_t;
-
 // Task state segment format
 struct taskstate {
   uint link;         // Old ts selector
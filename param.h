@@ -1,15 +1,23 @@
-#define NPROC        64  // maximum number of processes
+#define NPROC       512  // maximum number of processes
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
+#define NLATBUCKET   32  // buckets in each cpu's run queue latency histogram
+#define NTRACE      256  // events in each cpu's trace ring, a power of 2
+#define NPROFILE    512  // samples in each cpu's profiler ring, a power of 2
 #define NOFILE       16  // open files per process
+#define NVMA          8  // mmap()ed regions per process
+#define NSPAGE      256  // file pages mapped by MAP_SHARED mappings
 #define NFILE       100  // open files per system
-#define NINODE       50  // maximum number of active i-nodes
+#define NINODE      200  // maximum number of cached i-nodes
+#define NDCACHE     128  // directory entries cached by name
+#define NWBUF        16  // max pages of write-back file data
+#define WBTICKS     100  // ticks between write-back flushes
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
-#define MAXOPBLOCKS  10  // max # of blocks any FS op writes
-#define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       1500  // size of file system in blocks
+#define MAXOPBLOCKS  12  // max # of blocks any FS op writes
+#define LOGSIZE      (MAXOPBLOCKS*6)  // max data blocks in on-disk log
+#define NBUF         (LOGSIZE*3)  // size of disk block cache
+#define FSSIZE       65536  // size of file system in blocks
 #define QUANTUM      5     // Time slice for Round Robin scheduling
 
@@ -0,0 +1,2190 @@
+
+_pathbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return uptime() - t;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	56                   	push   %esi
+       e:	53                   	push   %ebx
+       f:	bb d0 07 00 00       	mov    $0x7d0,%ebx
+      14:	51                   	push   %ecx
+      15:	83 ec 4c             	sub    $0x4c,%esp
+  char missing[64];
+  int n, n2;
+
+  n = argc > 1 ? atoi(argv[1]) : 2000;
+      18:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+      1b:	8b 41 04             	mov    0x4(%ecx),%eax
+  n = argc > 1 ? atoi(argv[1]) : 2000;
+      1e:	7e 10                	jle    30 <main+0x30>
+      20:	83 ec 0c             	sub    $0xc,%esp
+      23:	ff 70 04             	push   0x4(%eax)
+      26:	e8 45 08 00 00       	call   870 <atoi>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	89 c3                	mov    %eax,%ebx
+  setup();
+      30:	e8 8b 00 00 00       	call   c0 <setup>
+  strcpy(missing, path);
+      35:	8d 75 a8             	lea    -0x58(%ebp),%esi
+      38:	83 ec 08             	sub    $0x8,%esp
+      3b:	68 80 16 00 00       	push   $0x1680
+      40:	56                   	push   %esi
+      41:	e8 aa 05 00 00       	call   5f0 <strcpy>
+  n2 = strlen(missing);
+      46:	89 34 24             	mov    %esi,(%esp)
+      49:	e8 32 06 00 00       	call   680 <strlen>
+  strcpy(missing + n2 - 4, "none");
+      4e:	5a                   	pop    %edx
+      4f:	59                   	pop    %ecx
+      50:	68 96 10 00 00       	push   $0x1096
+      55:	8d 44 06 fc          	lea    -0x4(%esi,%eax,1),%eax
+      59:	50                   	push   %eax
+      5a:	e8 91 05 00 00       	call   5f0 <strcpy>
+
+  printf(1, "pathbench: %d lookups of %s\n", n, path);
+      5f:	68 80 16 00 00       	push   $0x1680
+      64:	53                   	push   %ebx
+      65:	68 9b 10 00 00       	push   $0x109b
+      6a:	6a 01                	push   $0x1
+      6c:	e8 4f 0b 00 00       	call   bc0 <printf>
+  printf(1, "present: %d ticks\n", lookups(path, n, 1));
+      71:	83 c4 1c             	add    $0x1c,%esp
+      74:	6a 01                	push   $0x1
+      76:	53                   	push   %ebx
+      77:	68 80 16 00 00       	push   $0x1680
+      7c:	e8 8f 01 00 00       	call   210 <lookups>
+      81:	83 c4 0c             	add    $0xc,%esp
+      84:	50                   	push   %eax
+      85:	68 b8 10 00 00       	push   $0x10b8
+      8a:	6a 01                	push   $0x1
+      8c:	e8 2f 0b 00 00       	call   bc0 <printf>
+  printf(1, "absent: %d ticks\n", lookups(missing, n, 0));
+      91:	83 c4 0c             	add    $0xc,%esp
+      94:	6a 00                	push   $0x0
+      96:	53                   	push   %ebx
+      97:	56                   	push   %esi
+      98:	e8 73 01 00 00       	call   210 <lookups>
+      9d:	83 c4 0c             	add    $0xc,%esp
+      a0:	50                   	push   %eax
+      a1:	68 cb 10 00 00       	push   $0x10cb
+      a6:	6a 01                	push   $0x1
+      a8:	e8 13 0b 00 00       	call   bc0 <printf>
+
+  cleanup();
+      ad:	e8 ee 00 00 00       	call   1a0 <cleanup>
+  exit();
+      b2:	e8 59 04 00 00       	call   510 <exit>
+      b7:	66 90                	xchg   %ax,%ax
+      b9:	66 90                	xchg   %ax,%ax
+      bb:	66 90                	xchg   %ax,%ax
+      bd:	66 90                	xchg   %ax,%ax
+      bf:	90                   	nop
+
+000000c0 <setup>:
+{
+      c0:	55                   	push   %ebp
+      c1:	89 e5                	mov    %esp,%ebp
+      c3:	56                   	push   %esi
+      c4:	53                   	push   %ebx
+  mkdir(path);
+      c5:	bb 31 00 00 00       	mov    $0x31,%ebx
+  strcpy(path, "pb");
+      ca:	83 ec 08             	sub    $0x8,%esp
+      cd:	68 70 10 00 00       	push   $0x1070
+      d2:	68 80 16 00 00       	push   $0x1680
+      d7:	e8 14 05 00 00       	call   5f0 <strcpy>
+  mkdir(path);
+      dc:	c7 04 24 80 16 00 00 	movl   $0x1680,(%esp)
+      e3:	e8 a3 08 00 00       	call   98b <mkdir>
+  for(i = 1; i < DEPTH; i++){
+      e8:	0f b7 35 06 11 00 00 	movzwl 0x1106,%esi
+  mkdir(path);
+      ef:	83 c4 10             	add    $0x10,%esp
+      f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    n = strlen(path);
+      f8:	83 ec 0c             	sub    $0xc,%esp
+      fb:	68 80 16 00 00       	push   $0x1680
+     100:	e8 7b 05 00 00       	call   680 <strlen>
+    path[n+2] = '0' + i;
+     105:	88 98 82 16 00 00    	mov    %bl,0x1682(%eax)
+  for(i = 1; i < DEPTH; i++){
+     10b:	83 c3 01             	add    $0x1,%ebx
+    path[n] = '/';
+     10e:	66 89 b0 80 16 00 00 	mov    %si,0x1680(%eax)
+    path[n+3] = 0;
+     115:	c6 80 83 16 00 00 00 	movb   $0x0,0x1683(%eax)
+    mkdir(path);
+     11c:	c7 04 24 80 16 00 00 	movl   $0x1680,(%esp)
+     123:	e8 63 08 00 00       	call   98b <mkdir>
+  for(i = 1; i < DEPTH; i++){
+     128:	83 c4 10             	add    $0x10,%esp
+     12b:	80 fb 36             	cmp    $0x36,%bl
+     12e:	75 c8                	jne    f8 <setup+0x38>
+  n = strlen(path);
+     130:	83 ec 0c             	sub    $0xc,%esp
+     133:	68 80 16 00 00       	push   $0x1680
+     138:	e8 43 05 00 00       	call   680 <strlen>
+  strcpy(path + n, "/file");
+     13d:	5a                   	pop    %edx
+     13e:	59                   	pop    %ecx
+     13f:	68 73 10 00 00       	push   $0x1073
+     144:	05 80 16 00 00       	add    $0x1680,%eax
+     149:	50                   	push   %eax
+     14a:	e8 a1 04 00 00       	call   5f0 <strcpy>
+  if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+     14f:	5b                   	pop    %ebx
+     150:	5e                   	pop    %esi
+     151:	68 02 02 00 00       	push   $0x202
+     156:	68 80 16 00 00       	push   $0x1680
+     15b:	e8 f9 07 00 00       	call   959 <open>
+     160:	83 c4 10             	add    $0x10,%esp
+     163:	85 c0                	test   %eax,%eax
+     165:	78 13                	js     17a <setup+0xba>
+  close(fd);
+     167:	83 ec 0c             	sub    $0xc,%esp
+     16a:	50                   	push   %eax
+     16b:	e8 10 04 00 00       	call   580 <close>
+}
+     170:	83 c4 10             	add    $0x10,%esp
+     173:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     176:	5b                   	pop    %ebx
+     177:	5e                   	pop    %esi
+     178:	5d                   	pop    %ebp
+     179:	c3                   	ret
+    printf(2, "pathbench: cannot create %s\n", path);
+     17a:	50                   	push   %eax
+     17b:	68 80 16 00 00       	push   $0x1680
+     180:	68 79 10 00 00       	push   $0x1079
+     185:	6a 02                	push   $0x2
+     187:	e8 34 0a 00 00       	call   bc0 <printf>
+    exit();
+     18c:	e8 7f 03 00 00       	call   510 <exit>
+     191:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     198:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     19f:	90                   	nop
+
+000001a0 <cleanup>:
+{
+     1a0:	55                   	push   %ebp
+     1a1:	89 e5                	mov    %esp,%ebp
+     1a3:	53                   	push   %ebx
+     1a4:	83 ec 10             	sub    $0x10,%esp
+  unlink(path);
+     1a7:	68 80 16 00 00       	push   $0x1680
+     1ac:	e8 bc 07 00 00       	call   96d <unlink>
+  for(n = strlen(path); n > 0; n--){
+     1b1:	c7 04 24 80 16 00 00 	movl   $0x1680,(%esp)
+     1b8:	e8 c3 04 00 00       	call   680 <strlen>
+     1bd:	83 c4 10             	add    $0x10,%esp
+     1c0:	85 c0                	test   %eax,%eax
+     1c2:	7e 36                	jle    1fa <cleanup+0x5a>
+     1c4:	89 c3                	mov    %eax,%ebx
+     1c6:	eb 0d                	jmp    1d5 <cleanup+0x35>
+     1c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1cf:	90                   	nop
+     1d0:	83 eb 01             	sub    $0x1,%ebx
+     1d3:	74 25                	je     1fa <cleanup+0x5a>
+    if(path[n] == '/'){
+     1d5:	80 bb 80 16 00 00 2f 	cmpb   $0x2f,0x1680(%ebx)
+     1dc:	75 f2                	jne    1d0 <cleanup+0x30>
+      unlink(path);
+     1de:	83 ec 0c             	sub    $0xc,%esp
+      path[n] = 0;
+     1e1:	c6 83 80 16 00 00 00 	movb   $0x0,0x1680(%ebx)
+      unlink(path);
+     1e8:	68 80 16 00 00       	push   $0x1680
+     1ed:	e8 7b 07 00 00       	call   96d <unlink>
+     1f2:	83 c4 10             	add    $0x10,%esp
+  for(n = strlen(path); n > 0; n--){
+     1f5:	83 eb 01             	sub    $0x1,%ebx
+     1f8:	75 db                	jne    1d5 <cleanup+0x35>
+  unlink(path);
+     1fa:	83 ec 0c             	sub    $0xc,%esp
+     1fd:	68 80 16 00 00       	push   $0x1680
+     202:	e8 66 07 00 00       	call   96d <unlink>
+}
+     207:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     20a:	83 c4 10             	add    $0x10,%esp
+     20d:	c9                   	leave
+     20e:	c3                   	ret
+     20f:	90                   	nop
+
+00000210 <lookups>:
+{
+     210:	55                   	push   %ebp
+     211:	89 e5                	mov    %esp,%ebp
+     213:	57                   	push   %edi
+     214:	56                   	push   %esi
+     215:	53                   	push   %ebx
+     216:	83 ec 3c             	sub    $0x3c,%esp
+     219:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  t = uptime();
+     21c:	e8 a6 07 00 00       	call   9c7 <uptime>
+     221:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  for(i = 0; i < n; i++){
+     224:	8b 45 0c             	mov    0xc(%ebp),%eax
+     227:	85 c0                	test   %eax,%eax
+     229:	7e 24                	jle    24f <lookups+0x3f>
+     22b:	31 f6                	xor    %esi,%esi
+     22d:	8d 7d d4             	lea    -0x2c(%ebp),%edi
+    if((stat(p, &st) >= 0) != want){
+     230:	83 ec 08             	sub    $0x8,%esp
+     233:	57                   	push   %edi
+     234:	53                   	push   %ebx
+     235:	e8 96 05 00 00       	call   7d0 <stat>
+     23a:	83 c4 10             	add    $0x10,%esp
+     23d:	f7 d0                	not    %eax
+     23f:	c1 e8 1f             	shr    $0x1f,%eax
+     242:	3b 45 10             	cmp    0x10(%ebp),%eax
+     245:	75 1a                	jne    261 <lookups+0x51>
+  for(i = 0; i < n; i++){
+     247:	83 c6 01             	add    $0x1,%esi
+     24a:	39 75 0c             	cmp    %esi,0xc(%ebp)
+     24d:	75 e1                	jne    230 <lookups+0x20>
+  return uptime() - t;
+     24f:	e8 73 07 00 00       	call   9c7 <uptime>
+     254:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+}
+     257:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     25a:	5b                   	pop    %ebx
+     25b:	5e                   	pop    %esi
+  return uptime() - t;
+     25c:	29 d0                	sub    %edx,%eax
+}
+     25e:	5f                   	pop    %edi
+     25f:	5d                   	pop    %ebp
+     260:	c3                   	ret
+      printf(2, "pathbench: unexpected result for %s\n", p);
+     261:	83 ec 04             	sub    $0x4,%esp
+     264:	53                   	push   %ebx
+     265:	68 e0 10 00 00       	push   $0x10e0
+     26a:	6a 02                	push   $0x2
+     26c:	e8 4f 09 00 00       	call   bc0 <printf>
+      exit();
+     271:	e8 9a 02 00 00       	call   510 <exit>
+     276:	66 90                	xchg   %ax,%ax
+     278:	66 90                	xchg   %ax,%ax
+     27a:	66 90                	xchg   %ax,%ax
+     27c:	66 90                	xchg   %ax,%ax
+     27e:	66 90                	xchg   %ax,%ax
+
+00000280 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+     280:	55                   	push   %ebp
+     281:	89 e5                	mov    %esp,%ebp
+     283:	57                   	push   %edi
+     284:	56                   	push   %esi
+     285:	53                   	push   %ebx
+     286:	83 ec 4c             	sub    $0x4c,%esp
+     289:	8b 45 0c             	mov    0xc(%ebp),%eax
+     28c:	8b 55 08             	mov    0x8(%ebp),%edx
+     28f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     292:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+     295:	83 fa 0f             	cmp    $0xf,%edx
+     298:	0f 87 32 01 00 00    	ja     3d0 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+     29e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     2a4:	8b 80 c0 16 00 00    	mov    0x16c0(%eax),%eax
+     2aa:	85 c0                	test   %eax,%eax
+     2ac:	0f 84 de 00 00 00    	je     390 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+     2b2:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     2b8:	8b b0 c4 16 00 00    	mov    0x16c4(%eax),%esi
+     2be:	8d 88 c0 16 00 00    	lea    0x16c0(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+     2c4:	8d b8 c8 16 00 00    	lea    0x16c8(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+     2ca:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+     2cd:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+     2d0:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+     2d3:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+     2d9:	0f 8f 01 01 00 00    	jg     3e0 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+     2df:	8d 78 08             	lea    0x8(%eax),%edi
+     2e2:	8d bc 3e c0 16 00 00 	lea    0x16c0(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     2e9:	85 db                	test   %ebx,%ebx
+     2eb:	7e 3b                	jle    328 <bufwrite+0xa8>
+     2ed:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+     2f0:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+     2f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2f7:	90                   	nop
+    *dst++ = *src++;
+     2f8:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     2f9:	39 c6                	cmp    %eax,%esi
+     2fb:	75 fb                	jne    2f8 <bufwrite+0x78>
+  ob[fd].n += n;
+     2fd:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     303:	8b 88 c4 16 00 00    	mov    0x16c4(%eax),%ecx
+     309:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     30b:	83 b8 c0 16 00 00 01 	cmpl   $0x1,0x16c0(%eax)
+  ob[fd].n += n;
+     312:	89 88 c4 16 00 00    	mov    %ecx,0x16c4(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     318:	74 26                	je     340 <bufwrite+0xc0>
+}
+     31a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     31d:	5b                   	pop    %ebx
+     31e:	5e                   	pop    %esi
+     31f:	5f                   	pop    %edi
+     320:	5d                   	pop    %ebp
+     321:	c3                   	ret
+     322:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+     328:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     32b:	83 b8 c0 16 00 00 01 	cmpl   $0x1,0x16c0(%eax)
+  ob[fd].n += n;
+     332:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     335:	75 e3                	jne    31a <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+     337:	85 db                	test   %ebx,%ebx
+     339:	74 df                	je     31a <bufwrite+0x9a>
+     33b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     33f:	90                   	nop
+  src = vsrc;
+     340:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     343:	01 c3                	add    %eax,%ebx
+     345:	eb 10                	jmp    357 <bufwrite+0xd7>
+     347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     34e:	66 90                	xchg   %ax,%ax
+     350:	83 c0 01             	add    $0x1,%eax
+     353:	39 d8                	cmp    %ebx,%eax
+     355:	74 c3                	je     31a <bufwrite+0x9a>
+    if(*p == (char)c)
+     357:	80 38 0a             	cmpb   $0xa,(%eax)
+     35a:	75 f4                	jne    350 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     35c:	85 c9                	test   %ecx,%ecx
+     35e:	7e ba                	jle    31a <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+     360:	83 ec 04             	sub    $0x4,%esp
+     363:	51                   	push   %ecx
+     364:	ff 75 ac             	push   -0x54(%ebp)
+     367:	52                   	push   %edx
+     368:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+     36b:	e8 cd 05 00 00       	call   93d <write>
+    ob[fd].n = 0;
+     370:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     373:	83 c4 10             	add    $0x10,%esp
+     376:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+     37c:	c7 82 c4 16 00 00 00 	movl   $0x0,0x16c4(%edx)
+     383:	00 00 00 
+     386:	eb 92                	jmp    31a <bufwrite+0x9a>
+     388:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     38f:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     390:	83 ec 08             	sub    $0x8,%esp
+     393:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     396:	50                   	push   %eax
+     397:	52                   	push   %edx
+     398:	89 55 b0             	mov    %edx,-0x50(%ebp)
+     39b:	e8 d7 05 00 00       	call   977 <fstat>
+     3a0:	83 c4 10             	add    $0x10,%esp
+     3a3:	8b 55 b0             	mov    -0x50(%ebp),%edx
+     3a6:	89 c1                	mov    %eax,%ecx
+     3a8:	b8 02 00 00 00       	mov    $0x2,%eax
+     3ad:	85 c9                	test   %ecx,%ecx
+     3af:	75 0d                	jne    3be <bufwrite+0x13e>
+     3b1:	31 c0                	xor    %eax,%eax
+     3b3:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     3b8:	0f 95 c0             	setne  %al
+     3bb:	83 c0 01             	add    $0x1,%eax
+     3be:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+     3c4:	89 81 c0 16 00 00    	mov    %eax,0x16c0(%ecx)
+     3ca:	e9 e3 fe ff ff       	jmp    2b2 <bufwrite+0x32>
+     3cf:	90                   	nop
+}
+     3d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     3d3:	5b                   	pop    %ebx
+     3d4:	5e                   	pop    %esi
+     3d5:	5f                   	pop    %edi
+     3d6:	5d                   	pop    %ebp
+    write(fd, p, n);
+     3d7:	e9 61 05 00 00       	jmp    93d <write>
+     3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+     3e0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+     3e3:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+     3e6:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+     3e9:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+     3ec:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+     3ef:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+     3f2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+     3f5:	6a 02                	push   $0x2
+     3f7:	50                   	push   %eax
+     3f8:	52                   	push   %edx
+     3f9:	e8 9b 06 00 00       	call   a99 <writev>
+    ob[fd].n = 0;
+     3fe:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+     401:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+     404:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+     40b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     40e:	5b                   	pop    %ebx
+     40f:	5e                   	pop    %esi
+     410:	5f                   	pop    %edi
+     411:	5d                   	pop    %ebp
+     412:	c3                   	ret
+     413:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     41a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000420 <fflush>:
+{
+     420:	55                   	push   %ebp
+     421:	89 e5                	mov    %esp,%ebp
+     423:	53                   	push   %ebx
+     424:	83 ec 04             	sub    $0x4,%esp
+     427:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     42a:	83 f8 0f             	cmp    $0xf,%eax
+     42d:	77 16                	ja     445 <fflush+0x25>
+     42f:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+     435:	8b 8a c4 16 00 00    	mov    0x16c4(%edx),%ecx
+     43b:	8d 9a c0 16 00 00    	lea    0x16c0(%edx),%ebx
+     441:	85 c9                	test   %ecx,%ecx
+     443:	7f 0b                	jg     450 <fflush+0x30>
+}
+     445:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     448:	c9                   	leave
+     449:	c3                   	ret
+     44a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     450:	83 ec 04             	sub    $0x4,%esp
+     453:	81 c2 c8 16 00 00    	add    $0x16c8,%edx
+     459:	51                   	push   %ecx
+     45a:	52                   	push   %edx
+     45b:	50                   	push   %eax
+     45c:	e8 dc 04 00 00       	call   93d <write>
+    ob[fd].n = 0;
+     461:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     468:	83 c4 10             	add    $0x10,%esp
+}
+     46b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     46e:	c9                   	leave
+     46f:	c3                   	ret
+
+00000470 <fflushall>:
+{
+     470:	55                   	push   %ebp
+     471:	89 e5                	mov    %esp,%ebp
+     473:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     474:	31 f6                	xor    %esi,%esi
+{
+     476:	53                   	push   %ebx
+     477:	bb c8 16 00 00       	mov    $0x16c8,%ebx
+     47c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     480:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     483:	85 c0                	test   %eax,%eax
+     485:	7e 15                	jle    49c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     487:	83 ec 04             	sub    $0x4,%esp
+     48a:	50                   	push   %eax
+     48b:	53                   	push   %ebx
+     48c:	56                   	push   %esi
+     48d:	e8 ab 04 00 00       	call   93d <write>
+    ob[fd].n = 0;
+     492:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     499:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     49c:	83 c6 01             	add    $0x1,%esi
+     49f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     4a5:	83 fe 10             	cmp    $0x10,%esi
+     4a8:	75 d6                	jne    480 <fflushall+0x10>
+}
+     4aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4ad:	5b                   	pop    %ebx
+     4ae:	5e                   	pop    %esi
+     4af:	5d                   	pop    %ebp
+     4b0:	c3                   	ret
+     4b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4bf:	90                   	nop
+
+000004c0 <fork>:
+{
+     4c0:	55                   	push   %ebp
+     4c1:	89 e5                	mov    %esp,%ebp
+     4c3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     4c4:	31 f6                	xor    %esi,%esi
+{
+     4c6:	53                   	push   %ebx
+     4c7:	bb c8 16 00 00       	mov    $0x16c8,%ebx
+     4cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     4d0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     4d3:	85 c0                	test   %eax,%eax
+     4d5:	7e 15                	jle    4ec <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     4d7:	83 ec 04             	sub    $0x4,%esp
+     4da:	50                   	push   %eax
+     4db:	53                   	push   %ebx
+     4dc:	56                   	push   %esi
+     4dd:	e8 5b 04 00 00       	call   93d <write>
+    ob[fd].n = 0;
+     4e2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     4e9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     4ec:	83 c6 01             	add    $0x1,%esi
+     4ef:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     4f5:	83 fe 10             	cmp    $0x10,%esi
+     4f8:	75 d6                	jne    4d0 <fork+0x10>
+}
+     4fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4fd:	5b                   	pop    %ebx
+     4fe:	5e                   	pop    %esi
+     4ff:	5d                   	pop    %ebp
+  return _fork();
+     500:	e9 15 04 00 00       	jmp    91a <_fork>
+     505:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     50c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000510 <exit>:
+{
+     510:	55                   	push   %ebp
+     511:	89 e5                	mov    %esp,%ebp
+     513:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+     516:	e8 55 ff ff ff       	call   470 <fflushall>
+  _exit();
+     51b:	e8 01 04 00 00       	call   921 <_exit>
+
+00000520 <exec>:
+{
+     520:	55                   	push   %ebp
+     521:	89 e5                	mov    %esp,%ebp
+     523:	57                   	push   %edi
+     524:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     525:	31 f6                	xor    %esi,%esi
+{
+     527:	53                   	push   %ebx
+     528:	bb c8 16 00 00       	mov    $0x16c8,%ebx
+     52d:	83 ec 1c             	sub    $0x1c,%esp
+     530:	8b 45 08             	mov    0x8(%ebp),%eax
+     533:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     536:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     539:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     540:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     543:	85 c0                	test   %eax,%eax
+     545:	7e 15                	jle    55c <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     547:	83 ec 04             	sub    $0x4,%esp
+     54a:	50                   	push   %eax
+     54b:	53                   	push   %ebx
+     54c:	56                   	push   %esi
+     54d:	e8 eb 03 00 00       	call   93d <write>
+    ob[fd].n = 0;
+     552:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     559:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     55c:	83 c6 01             	add    $0x1,%esi
+     55f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     565:	83 fe 10             	cmp    $0x10,%esi
+     568:	75 d6                	jne    540 <exec+0x20>
+  return _exec(path, argv);
+     56a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     56d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+     570:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     573:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     576:	5b                   	pop    %ebx
+     577:	5e                   	pop    %esi
+     578:	5f                   	pop    %edi
+     579:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     57a:	e9 d3 03 00 00       	jmp    952 <_exec>
+     57f:	90                   	nop
+
+00000580 <close>:
+{
+     580:	55                   	push   %ebp
+     581:	89 e5                	mov    %esp,%ebp
+     583:	56                   	push   %esi
+     584:	53                   	push   %ebx
+     585:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     588:	83 fb 0f             	cmp    $0xf,%ebx
+     58b:	77 26                	ja     5b3 <close+0x33>
+     58d:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     593:	8b 90 c4 16 00 00    	mov    0x16c4(%eax),%edx
+     599:	8d b0 c0 16 00 00    	lea    0x16c0(%eax),%esi
+     59f:	85 d2                	test   %edx,%edx
+     5a1:	7f 25                	jg     5c8 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+     5a3:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     5a9:	c7 80 c0 16 00 00 00 	movl   $0x0,0x16c0(%eax)
+     5b0:	00 00 00 
+  return _close(fd);
+     5b3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     5b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5b9:	5b                   	pop    %ebx
+     5ba:	5e                   	pop    %esi
+     5bb:	5d                   	pop    %ebp
+  return _close(fd);
+     5bc:	e9 83 03 00 00       	jmp    944 <_close>
+     5c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     5c8:	83 ec 04             	sub    $0x4,%esp
+     5cb:	05 c8 16 00 00       	add    $0x16c8,%eax
+     5d0:	52                   	push   %edx
+     5d1:	50                   	push   %eax
+     5d2:	53                   	push   %ebx
+     5d3:	e8 65 03 00 00       	call   93d <write>
+    ob[fd].n = 0;
+     5d8:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+     5df:	83 c4 10             	add    $0x10,%esp
+     5e2:	eb bf                	jmp    5a3 <close+0x23>
+     5e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5ef:	90                   	nop
+
+000005f0 <strcpy>:
+{
+     5f0:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+     5f1:	31 c0                	xor    %eax,%eax
+{
+     5f3:	89 e5                	mov    %esp,%ebp
+     5f5:	53                   	push   %ebx
+     5f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     5f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     5fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     600:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     604:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     607:	83 c0 01             	add    $0x1,%eax
+     60a:	84 d2                	test   %dl,%dl
+     60c:	75 f2                	jne    600 <strcpy+0x10>
+}
+     60e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     611:	89 c8                	mov    %ecx,%eax
+     613:	c9                   	leave
+     614:	c3                   	ret
+     615:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     61c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000620 <strcmp>:
+{
+     620:	55                   	push   %ebp
+     621:	89 e5                	mov    %esp,%ebp
+     623:	53                   	push   %ebx
+     624:	8b 55 08             	mov    0x8(%ebp),%edx
+     627:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     62a:	0f b6 02             	movzbl (%edx),%eax
+     62d:	84 c0                	test   %al,%al
+     62f:	75 17                	jne    648 <strcmp+0x28>
+     631:	eb 3a                	jmp    66d <strcmp+0x4d>
+     633:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     637:	90                   	nop
+     638:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     63c:	83 c2 01             	add    $0x1,%edx
+     63f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     642:	84 c0                	test   %al,%al
+     644:	74 1a                	je     660 <strcmp+0x40>
+    p++, q++;
+     646:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     648:	0f b6 19             	movzbl (%ecx),%ebx
+     64b:	38 c3                	cmp    %al,%bl
+     64d:	74 e9                	je     638 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     64f:	29 d8                	sub    %ebx,%eax
+}
+     651:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     654:	c9                   	leave
+     655:	c3                   	ret
+     656:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     65d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     660:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     664:	31 c0                	xor    %eax,%eax
+     666:	29 d8                	sub    %ebx,%eax
+}
+     668:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     66b:	c9                   	leave
+     66c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     66d:	0f b6 19             	movzbl (%ecx),%ebx
+     670:	31 c0                	xor    %eax,%eax
+     672:	eb db                	jmp    64f <strcmp+0x2f>
+     674:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     67b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     67f:	90                   	nop
+
+00000680 <strlen>:
+{
+     680:	55                   	push   %ebp
+     681:	89 e5                	mov    %esp,%ebp
+     683:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+     686:	80 3a 00             	cmpb   $0x0,(%edx)
+     689:	74 15                	je     6a0 <strlen+0x20>
+     68b:	31 c0                	xor    %eax,%eax
+     68d:	8d 76 00             	lea    0x0(%esi),%esi
+     690:	83 c0 01             	add    $0x1,%eax
+     693:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     697:	89 c1                	mov    %eax,%ecx
+     699:	75 f5                	jne    690 <strlen+0x10>
+}
+     69b:	89 c8                	mov    %ecx,%eax
+     69d:	5d                   	pop    %ebp
+     69e:	c3                   	ret
+     69f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     6a0:	31 c9                	xor    %ecx,%ecx
+}
+     6a2:	5d                   	pop    %ebp
+     6a3:	89 c8                	mov    %ecx,%eax
+     6a5:	c3                   	ret
+     6a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006b0 <memset>:
+{
+     6b0:	55                   	push   %ebp
+     6b1:	89 e5                	mov    %esp,%ebp
+     6b3:	57                   	push   %edi
+     6b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     6b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     6ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+     6bd:	89 d7                	mov    %edx,%edi
+     6bf:	fc                   	cld
+     6c0:	f3 aa                	rep stos %al,%es:(%edi)
+}
+     6c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     6c5:	89 d0                	mov    %edx,%eax
+     6c7:	c9                   	leave
+     6c8:	c3                   	ret
+     6c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000006d0 <strchr>:
+{
+     6d0:	55                   	push   %ebp
+     6d1:	89 e5                	mov    %esp,%ebp
+     6d3:	8b 45 08             	mov    0x8(%ebp),%eax
+     6d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     6da:	0f b6 10             	movzbl (%eax),%edx
+     6dd:	84 d2                	test   %dl,%dl
+     6df:	75 12                	jne    6f3 <strchr+0x23>
+     6e1:	eb 1d                	jmp    700 <strchr+0x30>
+     6e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6e7:	90                   	nop
+     6e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     6ec:	83 c0 01             	add    $0x1,%eax
+     6ef:	84 d2                	test   %dl,%dl
+     6f1:	74 0d                	je     700 <strchr+0x30>
+    if(*s == c)
+     6f3:	38 d1                	cmp    %dl,%cl
+     6f5:	75 f1                	jne    6e8 <strchr+0x18>
+}
+     6f7:	5d                   	pop    %ebp
+     6f8:	c3                   	ret
+     6f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     700:	31 c0                	xor    %eax,%eax
+}
+     702:	5d                   	pop    %ebp
+     703:	c3                   	ret
+     704:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     70b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     70f:	90                   	nop
+
+00000710 <memchr>:
+{
+     710:	55                   	push   %ebp
+     711:	89 e5                	mov    %esp,%ebp
+     713:	8b 55 10             	mov    0x10(%ebp),%edx
+     716:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     719:	85 d2                	test   %edx,%edx
+     71b:	74 1b                	je     738 <memchr+0x28>
+    if(*p == (char)c)
+     71d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+     721:	01 c2                	add    %eax,%edx
+     723:	eb 0a                	jmp    72f <memchr+0x1f>
+     725:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+     728:	83 c0 01             	add    $0x1,%eax
+     72b:	39 c2                	cmp    %eax,%edx
+     72d:	74 09                	je     738 <memchr+0x28>
+    if(*p == (char)c)
+     72f:	38 08                	cmp    %cl,(%eax)
+     731:	75 f5                	jne    728 <memchr+0x18>
+}
+     733:	5d                   	pop    %ebp
+     734:	c3                   	ret
+     735:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+     738:	31 c0                	xor    %eax,%eax
+}
+     73a:	5d                   	pop    %ebp
+     73b:	c3                   	ret
+     73c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000740 <gets>:
+{
+     740:	55                   	push   %ebp
+     741:	89 e5                	mov    %esp,%ebp
+     743:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+     744:	31 ff                	xor    %edi,%edi
+{
+     746:	56                   	push   %esi
+     747:	be c8 16 00 00       	mov    $0x16c8,%esi
+     74c:	53                   	push   %ebx
+     74d:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     750:	8b 46 fc             	mov    -0x4(%esi),%eax
+     753:	85 c0                	test   %eax,%eax
+     755:	7e 15                	jle    76c <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     757:	83 ec 04             	sub    $0x4,%esp
+     75a:	50                   	push   %eax
+     75b:	56                   	push   %esi
+     75c:	57                   	push   %edi
+     75d:	e8 db 01 00 00       	call   93d <write>
+    ob[fd].n = 0;
+     762:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+     769:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     76c:	83 c7 01             	add    $0x1,%edi
+     76f:	81 c6 08 01 00 00    	add    $0x108,%esi
+     775:	83 ff 10             	cmp    $0x10,%edi
+     778:	75 d6                	jne    750 <gets+0x10>
+  for(i=0; i+1 < max; ){
+     77a:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+     77c:	8d 75 e7             	lea    -0x19(%ebp),%esi
+     77f:	eb 2e                	jmp    7af <gets+0x6f>
+     781:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     788:	83 ec 04             	sub    $0x4,%esp
+     78b:	6a 01                	push   $0x1
+     78d:	56                   	push   %esi
+     78e:	6a 00                	push   $0x0
+     790:	e8 a1 01 00 00       	call   936 <read>
+    if(cc < 1)
+     795:	83 c4 10             	add    $0x10,%esp
+     798:	85 c0                	test   %eax,%eax
+     79a:	7e 1d                	jle    7b9 <gets+0x79>
+    buf[i++] = c;
+     79c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     7a0:	8b 55 08             	mov    0x8(%ebp),%edx
+     7a3:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     7a7:	3c 0a                	cmp    $0xa,%al
+     7a9:	74 10                	je     7bb <gets+0x7b>
+     7ab:	3c 0d                	cmp    $0xd,%al
+     7ad:	74 0c                	je     7bb <gets+0x7b>
+  for(i=0; i+1 < max; ){
+     7af:	89 df                	mov    %ebx,%edi
+     7b1:	83 c3 01             	add    $0x1,%ebx
+     7b4:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     7b7:	7c cf                	jl     788 <gets+0x48>
+     7b9:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     7bb:	8b 45 08             	mov    0x8(%ebp),%eax
+     7be:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     7c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     7c5:	5b                   	pop    %ebx
+     7c6:	5e                   	pop    %esi
+     7c7:	5f                   	pop    %edi
+     7c8:	5d                   	pop    %ebp
+     7c9:	c3                   	ret
+     7ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000007d0 <stat>:
+{
+     7d0:	55                   	push   %ebp
+     7d1:	89 e5                	mov    %esp,%ebp
+     7d3:	57                   	push   %edi
+     7d4:	56                   	push   %esi
+     7d5:	53                   	push   %ebx
+     7d6:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+     7d9:	6a 00                	push   $0x0
+     7db:	ff 75 08             	push   0x8(%ebp)
+     7de:	e8 76 01 00 00       	call   959 <open>
+  if(fd < 0)
+     7e3:	83 c4 10             	add    $0x10,%esp
+     7e6:	85 c0                	test   %eax,%eax
+     7e8:	78 76                	js     860 <stat+0x90>
+  r = fstat(fd, st);
+     7ea:	83 ec 08             	sub    $0x8,%esp
+     7ed:	ff 75 0c             	push   0xc(%ebp)
+     7f0:	89 c3                	mov    %eax,%ebx
+     7f2:	50                   	push   %eax
+     7f3:	e8 7f 01 00 00       	call   977 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     7f8:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     7fb:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     7fd:	83 fb 0f             	cmp    $0xf,%ebx
+     800:	7f 40                	jg     842 <stat+0x72>
+     802:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     808:	8b 90 c4 16 00 00    	mov    0x16c4(%eax),%edx
+     80e:	8d b8 c0 16 00 00    	lea    0x16c0(%eax),%edi
+     814:	85 d2                	test   %edx,%edx
+     816:	7e 1a                	jle    832 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+     818:	83 ec 04             	sub    $0x4,%esp
+     81b:	05 c8 16 00 00       	add    $0x16c8,%eax
+     820:	52                   	push   %edx
+     821:	50                   	push   %eax
+     822:	53                   	push   %ebx
+     823:	e8 15 01 00 00       	call   93d <write>
+    ob[fd].n = 0;
+     828:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+     82f:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+     832:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     838:	c7 80 c0 16 00 00 00 	movl   $0x0,0x16c0(%eax)
+     83f:	00 00 00 
+  return _close(fd);
+     842:	83 ec 0c             	sub    $0xc,%esp
+     845:	53                   	push   %ebx
+     846:	e8 f9 00 00 00       	call   944 <_close>
+     84b:	83 c4 10             	add    $0x10,%esp
+}
+     84e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     851:	89 f0                	mov    %esi,%eax
+     853:	5b                   	pop    %ebx
+     854:	5e                   	pop    %esi
+     855:	5f                   	pop    %edi
+     856:	5d                   	pop    %ebp
+     857:	c3                   	ret
+     858:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     85f:	90                   	nop
+    return -1;
+     860:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     865:	eb e7                	jmp    84e <stat+0x7e>
+     867:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     86e:	66 90                	xchg   %ax,%ax
+
+00000870 <atoi>:
+{
+     870:	55                   	push   %ebp
+     871:	89 e5                	mov    %esp,%ebp
+     873:	53                   	push   %ebx
+     874:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     877:	0f be 02             	movsbl (%edx),%eax
+     87a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     87d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     880:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     885:	77 1e                	ja     8a5 <atoi+0x35>
+     887:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     88e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     890:	83 c2 01             	add    $0x1,%edx
+     893:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     896:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     89a:	0f be 02             	movsbl (%edx),%eax
+     89d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     8a0:	80 fb 09             	cmp    $0x9,%bl
+     8a3:	76 eb                	jbe    890 <atoi+0x20>
+}
+     8a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8a8:	89 c8                	mov    %ecx,%eax
+     8aa:	c9                   	leave
+     8ab:	c3                   	ret
+     8ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008b0 <memmove>:
+{
+     8b0:	55                   	push   %ebp
+     8b1:	89 e5                	mov    %esp,%ebp
+     8b3:	57                   	push   %edi
+     8b4:	56                   	push   %esi
+     8b5:	8b 45 10             	mov    0x10(%ebp),%eax
+     8b8:	8b 55 08             	mov    0x8(%ebp),%edx
+     8bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     8be:	85 c0                	test   %eax,%eax
+     8c0:	7e 13                	jle    8d5 <memmove+0x25>
+     8c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     8c4:	89 d7                	mov    %edx,%edi
+     8c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     8d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     8d1:	39 f8                	cmp    %edi,%eax
+     8d3:	75 fb                	jne    8d0 <memmove+0x20>
+  return vdst;
+}
+     8d5:	5e                   	pop    %esi
+     8d6:	89 d0                	mov    %edx,%eax
+     8d8:	5f                   	pop    %edi
+     8d9:	5d                   	pop    %ebp
+     8da:	c3                   	ret
+
+000008db <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+     8db:	83 3d 74 16 00 00 00 	cmpl   $0x0,0x1674
+  jle 1f
+     8e2:	7e 0a                	jle    8ee <syscallentry+0x13>
+  movl %esp, %ecx
+     8e4:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+     8e6:	ba ed 08 00 00       	mov    $0x8ed,%edx
+  sysenter
+     8eb:	0f 34                	sysenter
+2:
+  ret
+     8ed:	c3                   	ret
+1:
+  jl 3f
+     8ee:	7c 27                	jl     917 <syscallentry+0x3c>
+  pushal
+     8f0:	60                   	pusha
+  movl $1, %eax
+     8f1:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     8f6:	0f a2                	cpuid
+  movl $-1, sysentermode
+     8f8:	c7 05 74 16 00 00 ff 	movl   $0xffffffff,0x1674
+     8ff:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     902:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+     908:	74 0a                	je     914 <syscallentry+0x39>
+  movl $1, sysentermode
+     90a:	c7 05 74 16 00 00 01 	movl   $0x1,0x1674
+     911:	00 00 00 
+4:
+  popal
+     914:	61                   	popa
+  jmp syscallentry
+     915:	eb c4                	jmp    8db <syscallentry>
+3:
+  int $T_SYSCALL
+     917:	cd 40                	int    $0x40
+  ret
+     919:	c3                   	ret
+
+0000091a <_fork>:
+
+SYSCALLAS(_fork, fork)
+     91a:	b8 01 00 00 00       	mov    $0x1,%eax
+     91f:	eb ba                	jmp    8db <syscallentry>
+
+00000921 <_exit>:
+SYSCALLAS(_exit, exit)
+     921:	b8 02 00 00 00       	mov    $0x2,%eax
+     926:	eb b3                	jmp    8db <syscallentry>
+
+00000928 <wait>:
+SYSCALL(wait)
+     928:	b8 03 00 00 00       	mov    $0x3,%eax
+     92d:	eb ac                	jmp    8db <syscallentry>
+
+0000092f <pipe>:
+SYSCALL(pipe)
+     92f:	b8 04 00 00 00       	mov    $0x4,%eax
+     934:	eb a5                	jmp    8db <syscallentry>
+
+00000936 <read>:
+SYSCALL(read)
+     936:	b8 05 00 00 00       	mov    $0x5,%eax
+     93b:	eb 9e                	jmp    8db <syscallentry>
+
+0000093d <write>:
+SYSCALL(write)
+     93d:	b8 10 00 00 00       	mov    $0x10,%eax
+     942:	eb 97                	jmp    8db <syscallentry>
+
+00000944 <_close>:
+SYSCALLAS(_close, close)
+     944:	b8 15 00 00 00       	mov    $0x15,%eax
+     949:	eb 90                	jmp    8db <syscallentry>
+
+0000094b <kill>:
+SYSCALL(kill)
+     94b:	b8 06 00 00 00       	mov    $0x6,%eax
+     950:	eb 89                	jmp    8db <syscallentry>
+
+00000952 <_exec>:
+SYSCALLAS(_exec, exec)
+     952:	b8 07 00 00 00       	mov    $0x7,%eax
+     957:	eb 82                	jmp    8db <syscallentry>
+
+00000959 <open>:
+SYSCALL(open)
+     959:	b8 0f 00 00 00       	mov    $0xf,%eax
+     95e:	e9 78 ff ff ff       	jmp    8db <syscallentry>
+
+00000963 <mknod>:
+SYSCALL(mknod)
+     963:	b8 11 00 00 00       	mov    $0x11,%eax
+     968:	e9 6e ff ff ff       	jmp    8db <syscallentry>
+
+0000096d <unlink>:
+SYSCALL(unlink)
+     96d:	b8 12 00 00 00       	mov    $0x12,%eax
+     972:	e9 64 ff ff ff       	jmp    8db <syscallentry>
+
+00000977 <fstat>:
+SYSCALL(fstat)
+     977:	b8 08 00 00 00       	mov    $0x8,%eax
+     97c:	e9 5a ff ff ff       	jmp    8db <syscallentry>
+
+00000981 <link>:
+SYSCALL(link)
+     981:	b8 13 00 00 00       	mov    $0x13,%eax
+     986:	e9 50 ff ff ff       	jmp    8db <syscallentry>
+
+0000098b <mkdir>:
+SYSCALL(mkdir)
+     98b:	b8 14 00 00 00       	mov    $0x14,%eax
+     990:	e9 46 ff ff ff       	jmp    8db <syscallentry>
+
+00000995 <chdir>:
+SYSCALL(chdir)
+     995:	b8 09 00 00 00       	mov    $0x9,%eax
+     99a:	e9 3c ff ff ff       	jmp    8db <syscallentry>
+
+0000099f <dup>:
+SYSCALL(dup)
+     99f:	b8 0a 00 00 00       	mov    $0xa,%eax
+     9a4:	e9 32 ff ff ff       	jmp    8db <syscallentry>
+
+000009a9 <getpid>:
+SYSCALL(getpid)
+     9a9:	b8 0b 00 00 00       	mov    $0xb,%eax
+     9ae:	e9 28 ff ff ff       	jmp    8db <syscallentry>
+
+000009b3 <sbrk>:
+SYSCALL(sbrk)
+     9b3:	b8 0c 00 00 00       	mov    $0xc,%eax
+     9b8:	e9 1e ff ff ff       	jmp    8db <syscallentry>
+
+000009bd <sleep>:
+SYSCALL(sleep)
+     9bd:	b8 0d 00 00 00       	mov    $0xd,%eax
+     9c2:	e9 14 ff ff ff       	jmp    8db <syscallentry>
+
+000009c7 <uptime>:
+SYSCALL(uptime)
+     9c7:	b8 0e 00 00 00       	mov    $0xe,%eax
+     9cc:	e9 0a ff ff ff       	jmp    8db <syscallentry>
+
+000009d1 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+     9d1:	b8 16 00 00 00       	mov    $0x16,%eax
+     9d6:	e9 00 ff ff ff       	jmp    8db <syscallentry>
+
+000009db <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+     9db:	b8 17 00 00 00       	mov    $0x17,%eax
+     9e0:	e9 f6 fe ff ff       	jmp    8db <syscallentry>
+
+000009e5 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+     9e5:	b8 18 00 00 00       	mov    $0x18,%eax
+     9ea:	e9 ec fe ff ff       	jmp    8db <syscallentry>
+
+000009ef <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+     9ef:	b8 19 00 00 00       	mov    $0x19,%eax
+     9f4:	e9 e2 fe ff ff       	jmp    8db <syscallentry>
+
+000009f9 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+     9f9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     9fe:	e9 d8 fe ff ff       	jmp    8db <syscallentry>
+
+00000a03 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+     a03:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     a08:	e9 ce fe ff ff       	jmp    8db <syscallentry>
+
+00000a0d <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+     a0d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     a12:	e9 c4 fe ff ff       	jmp    8db <syscallentry>
+
+00000a17 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+     a17:	b8 20 00 00 00       	mov    $0x20,%eax
+     a1c:	e9 ba fe ff ff       	jmp    8db <syscallentry>
+
+00000a21 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+     a21:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     a26:	e9 b0 fe ff ff       	jmp    8db <syscallentry>
+
+00000a2b <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+     a2b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     a30:	e9 a6 fe ff ff       	jmp    8db <syscallentry>
+
+00000a35 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+     a35:	b8 21 00 00 00       	mov    $0x21,%eax
+     a3a:	e9 9c fe ff ff       	jmp    8db <syscallentry>
+
+00000a3f <yield>:
+SYSCALL(yield) // yield the CPU to another process
+     a3f:	b8 22 00 00 00       	mov    $0x22,%eax
+     a44:	e9 92 fe ff ff       	jmp    8db <syscallentry>
+
+00000a49 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+     a49:	b8 23 00 00 00       	mov    $0x23,%eax
+     a4e:	e9 88 fe ff ff       	jmp    8db <syscallentry>
+
+00000a53 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+     a53:	b8 24 00 00 00       	mov    $0x24,%eax
+     a58:	e9 7e fe ff ff       	jmp    8db <syscallentry>
+
+00000a5d <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+     a5d:	b8 25 00 00 00       	mov    $0x25,%eax
+     a62:	e9 74 fe ff ff       	jmp    8db <syscallentry>
+
+00000a67 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+     a67:	b8 26 00 00 00       	mov    $0x26,%eax
+     a6c:	e9 6a fe ff ff       	jmp    8db <syscallentry>
+
+00000a71 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+     a71:	b8 27 00 00 00       	mov    $0x27,%eax
+     a76:	e9 60 fe ff ff       	jmp    8db <syscallentry>
+
+00000a7b <mmap>:
+SYSCALL(mmap) // map a file into memory
+     a7b:	b8 28 00 00 00       	mov    $0x28,%eax
+     a80:	e9 56 fe ff ff       	jmp    8db <syscallentry>
+
+00000a85 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+     a85:	b8 29 00 00 00       	mov    $0x29,%eax
+     a8a:	e9 4c fe ff ff       	jmp    8db <syscallentry>
+
+00000a8f <readv>:
+SYSCALL(readv) // read into several buffers
+     a8f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     a94:	e9 42 fe ff ff       	jmp    8db <syscallentry>
+
+00000a99 <writev>:
+SYSCALL(writev) // write from several buffers
+     a99:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     a9e:	e9 38 fe ff ff       	jmp    8db <syscallentry>
+
+00000aa3 <pread>:
+SYSCALL(pread) // read at an offset
+     aa3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     aa8:	e9 2e fe ff ff       	jmp    8db <syscallentry>
+
+00000aad <pwrite>:
+SYSCALL(pwrite) // write at an offset
+     aad:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     ab2:	e9 24 fe ff ff       	jmp    8db <syscallentry>
+
+00000ab7 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+     ab7:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     abc:	e9 1a fe ff ff       	jmp    8db <syscallentry>
+
+00000ac1 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+     ac1:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     ac6:	e9 10 fe ff ff       	jmp    8db <syscallentry>
+
+00000acb <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+     acb:	b8 30 00 00 00       	mov    $0x30,%eax
+     ad0:	e9 06 fe ff ff       	jmp    8db <syscallentry>
+
+00000ad5 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+     ad5:	b8 31 00 00 00       	mov    $0x31,%eax
+     ada:	e9 fc fd ff ff       	jmp    8db <syscallentry>
+
+00000adf <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+     adf:	b8 32 00 00 00       	mov    $0x32,%eax
+     ae4:	e9 f2 fd ff ff       	jmp    8db <syscallentry>
+
+00000ae9 <profread>:
+SYSCALL(profread) // drain profiler samples
+     ae9:	b8 33 00 00 00       	mov    $0x33,%eax
+     aee:	e9 e8 fd ff ff       	jmp    8db <syscallentry>
+
+00000af3 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+     af3:	b8 34 00 00 00       	mov    $0x34,%eax
+     af8:	e9 de fd ff ff       	jmp    8db <syscallentry>
+
+00000afd <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+     afd:	b8 35 00 00 00       	mov    $0x35,%eax
+     b02:	e9 d4 fd ff ff       	jmp    8db <syscallentry>
+
+00000b07 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+     b07:	b8 36 00 00 00       	mov    $0x36,%eax
+     b0c:	e9 ca fd ff ff       	jmp    8db <syscallentry>
+
+00000b11 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+     b11:	b8 37 00 00 00       	mov    $0x37,%eax
+     b16:	e9 c0 fd ff ff       	jmp    8db <syscallentry>
+     b1b:	66 90                	xchg   %ax,%ax
+     b1d:	66 90                	xchg   %ax,%ax
+     b1f:	90                   	nop
+
+00000b20 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     b20:	55                   	push   %ebp
+     b21:	89 e5                	mov    %esp,%ebp
+     b23:	57                   	push   %edi
+     b24:	56                   	push   %esi
+     b25:	53                   	push   %ebx
+     b26:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     b28:	89 d1                	mov    %edx,%ecx
+{
+     b2a:	83 ec 3c             	sub    $0x3c,%esp
+     b2d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     b30:	85 d2                	test   %edx,%edx
+     b32:	0f 89 80 00 00 00    	jns    bb8 <printint+0x98>
+     b38:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     b3c:	74 7a                	je     bb8 <printint+0x98>
+    x = -xx;
+     b3e:	f7 d9                	neg    %ecx
+    neg = 1;
+     b40:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     b45:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     b48:	31 f6                	xor    %esi,%esi
+     b4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     b50:	89 c8                	mov    %ecx,%eax
+     b52:	31 d2                	xor    %edx,%edx
+     b54:	89 f7                	mov    %esi,%edi
+     b56:	f7 f3                	div    %ebx
+     b58:	8d 76 01             	lea    0x1(%esi),%esi
+     b5b:	0f b6 92 68 11 00 00 	movzbl 0x1168(%edx),%edx
+     b62:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     b66:	89 ca                	mov    %ecx,%edx
+     b68:	89 c1                	mov    %eax,%ecx
+     b6a:	39 da                	cmp    %ebx,%edx
+     b6c:	73 e2                	jae    b50 <printint+0x30>
+  if(neg)
+     b6e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     b71:	85 c0                	test   %eax,%eax
+     b73:	74 07                	je     b7c <printint+0x5c>
+    buf[i++] = '-';
+     b75:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     b7a:	89 f7                	mov    %esi,%edi
+     b7c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     b7f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     b82:	01 df                	add    %ebx,%edi
+     b84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     b88:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+     b8b:	83 ec 04             	sub    $0x4,%esp
+     b8e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     b91:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     b94:	6a 01                	push   $0x1
+     b96:	50                   	push   %eax
+     b97:	56                   	push   %esi
+     b98:	e8 e3 f6 ff ff       	call   280 <bufwrite>
+  while(--i >= 0)
+     b9d:	89 f8                	mov    %edi,%eax
+     b9f:	83 c4 10             	add    $0x10,%esp
+     ba2:	83 ef 01             	sub    $0x1,%edi
+     ba5:	39 d8                	cmp    %ebx,%eax
+     ba7:	75 df                	jne    b88 <printint+0x68>
+}
+     ba9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bac:	5b                   	pop    %ebx
+     bad:	5e                   	pop    %esi
+     bae:	5f                   	pop    %edi
+     baf:	5d                   	pop    %ebp
+     bb0:	c3                   	ret
+     bb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     bb8:	31 c0                	xor    %eax,%eax
+     bba:	eb 89                	jmp    b45 <printint+0x25>
+     bbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000bc0 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     bc0:	55                   	push   %ebp
+     bc1:	89 e5                	mov    %esp,%ebp
+     bc3:	57                   	push   %edi
+     bc4:	56                   	push   %esi
+     bc5:	53                   	push   %ebx
+     bc6:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     bc9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     bcc:	0f b6 18             	movzbl (%eax),%ebx
+     bcf:	84 db                	test   %bl,%bl
+     bd1:	74 6c                	je     c3f <printf+0x7f>
+     bd3:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+     bd6:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+     bd9:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     bdb:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     bde:	eb 26                	jmp    c06 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     be0:	83 f8 25             	cmp    $0x25,%eax
+     be3:	74 4b                	je     c30 <printf+0x70>
+  bufwrite(fd, &c, 1);
+     be5:	83 ec 04             	sub    $0x4,%esp
+     be8:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     beb:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     bee:	6a 01                	push   $0x1
+     bf0:	50                   	push   %eax
+     bf1:	ff 75 08             	push   0x8(%ebp)
+     bf4:	e8 87 f6 ff ff       	call   280 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+     bf9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     bfc:	0f b6 1f             	movzbl (%edi),%ebx
+     bff:	83 c7 01             	add    $0x1,%edi
+     c02:	84 db                	test   %bl,%bl
+     c04:	74 39                	je     c3f <printf+0x7f>
+    c = fmt[i] & 0xff;
+     c06:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     c09:	85 f6                	test   %esi,%esi
+     c0b:	74 d3                	je     be0 <printf+0x20>
+      }
+    } else if(state == '%'){
+     c0d:	83 fe 25             	cmp    $0x25,%esi
+     c10:	75 ea                	jne    bfc <printf+0x3c>
+      if(c == 'd'){
+     c12:	83 f8 25             	cmp    $0x25,%eax
+     c15:	0f 84 d5 01 00 00    	je     df0 <printf+0x230>
+     c1b:	83 e8 63             	sub    $0x63,%eax
+     c1e:	83 f8 15             	cmp    $0x15,%eax
+     c21:	77 45                	ja     c68 <printf+0xa8>
+     c23:	ff 24 85 10 11 00 00 	jmp    *0x1110(,%eax,4)
+     c2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     c30:	0f b6 1f             	movzbl (%edi),%ebx
+     c33:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+     c36:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     c3b:	84 db                	test   %bl,%bl
+     c3d:	75 c7                	jne    c06 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+     c3f:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+     c43:	74 0b                	je     c50 <printf+0x90>
+    fflush(fd);
+}
+     c45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c48:	5b                   	pop    %ebx
+     c49:	5e                   	pop    %esi
+     c4a:	5f                   	pop    %edi
+     c4b:	5d                   	pop    %ebp
+     c4c:	c3                   	ret
+     c4d:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+     c50:	83 ec 0c             	sub    $0xc,%esp
+     c53:	6a 02                	push   $0x2
+     c55:	e8 c6 f7 ff ff       	call   420 <fflush>
+     c5a:	83 c4 10             	add    $0x10,%esp
+}
+     c5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c60:	5b                   	pop    %ebx
+     c61:	5e                   	pop    %esi
+     c62:	5f                   	pop    %edi
+     c63:	5d                   	pop    %ebp
+     c64:	c3                   	ret
+     c65:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+     c68:	83 ec 04             	sub    $0x4,%esp
+     c6b:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     c6e:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+     c72:	6a 01                	push   $0x1
+     c74:	52                   	push   %edx
+     c75:	89 55 c0             	mov    %edx,-0x40(%ebp)
+     c78:	ff 75 08             	push   0x8(%ebp)
+     c7b:	e8 00 f6 ff ff       	call   280 <bufwrite>
+     c80:	83 c4 0c             	add    $0xc,%esp
+     c83:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     c86:	6a 01                	push   $0x1
+     c88:	8b 55 c0             	mov    -0x40(%ebp),%edx
+     c8b:	52                   	push   %edx
+      state = 0;
+     c8c:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+     c8e:	ff 75 08             	push   0x8(%ebp)
+     c91:	e8 ea f5 ff ff       	call   280 <bufwrite>
+        putc(fd, c);
+     c96:	83 c4 10             	add    $0x10,%esp
+     c99:	e9 5e ff ff ff       	jmp    bfc <printf+0x3c>
+     c9e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+     ca0:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     ca3:	83 ec 0c             	sub    $0xc,%esp
+     ca6:	b9 10 00 00 00       	mov    $0x10,%ecx
+     cab:	8b 16                	mov    (%esi),%edx
+     cad:	6a 00                	push   $0x0
+     caf:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+     cb2:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+     cb5:	e8 66 fe ff ff       	call   b20 <printint>
+        ap++;
+     cba:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     cbd:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     cc0:	31 f6                	xor    %esi,%esi
+     cc2:	e9 35 ff ff ff       	jmp    bfc <printf+0x3c>
+     cc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cce:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     cd0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     cd3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     cd5:	83 c0 04             	add    $0x4,%eax
+     cd8:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+     cdb:	b8 08 11 00 00       	mov    $0x1108,%eax
+     ce0:	85 db                	test   %ebx,%ebx
+     ce2:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+     ce5:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+     ce8:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+     cea:	53                   	push   %ebx
+     ceb:	e8 90 f9 ff ff       	call   680 <strlen>
+     cf0:	83 c4 0c             	add    $0xc,%esp
+     cf3:	50                   	push   %eax
+     cf4:	53                   	push   %ebx
+     cf5:	ff 75 08             	push   0x8(%ebp)
+     cf8:	e8 83 f5 ff ff       	call   280 <bufwrite>
+     cfd:	83 c4 10             	add    $0x10,%esp
+     d00:	e9 f7 fe ff ff       	jmp    bfc <printf+0x3c>
+     d05:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+     d08:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+     d0b:	83 ec 04             	sub    $0x4,%esp
+     d0e:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+     d11:	8b 06                	mov    (%esi),%eax
+        ap++;
+     d13:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+     d16:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+     d19:	6a 01                	push   $0x1
+     d1b:	52                   	push   %edx
+     d1c:	ff 75 08             	push   0x8(%ebp)
+     d1f:	e8 5c f5 ff ff       	call   280 <bufwrite>
+        ap++;
+     d24:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     d27:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d2a:	31 f6                	xor    %esi,%esi
+     d2c:	e9 cb fe ff ff       	jmp    bfc <printf+0x3c>
+     d31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+     d38:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     d3b:	83 ec 0c             	sub    $0xc,%esp
+     d3e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     d43:	8b 16                	mov    (%esi),%edx
+     d45:	6a 01                	push   $0x1
+     d47:	e9 63 ff ff ff       	jmp    caf <printf+0xef>
+     d4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+     d50:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     d53:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     d56:	89 7d c0             	mov    %edi,-0x40(%ebp)
+     d59:	89 55 bc             	mov    %edx,-0x44(%ebp)
+     d5c:	8b 18                	mov    (%eax),%ebx
+     d5e:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+     d61:	31 c0                	xor    %eax,%eax
+     d63:	89 c7                	mov    %eax,%edi
+     d65:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+     d68:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+     d6d:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+     d6f:	f7 e1                	mul    %ecx
+     d71:	c1 ea 03             	shr    $0x3,%edx
+     d74:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     d77:	89 d1                	mov    %edx,%ecx
+     d79:	01 c0                	add    %eax,%eax
+     d7b:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     d7d:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+     d7f:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     d81:	be 0a 00 00 00       	mov    $0xa,%esi
+     d86:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+     d88:	89 da                	mov    %ebx,%edx
+     d8a:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+     d8c:	89 fe                	mov    %edi,%esi
+     d8e:	83 c7 01             	add    $0x1,%edi
+     d91:	8d 42 30             	lea    0x30(%edx),%eax
+     d94:	89 da                	mov    %ebx,%edx
+     d96:	8d 14 92             	lea    (%edx,%edx,4),%edx
+     d99:	01 d2                	add    %edx,%edx
+     d9b:	29 d0                	sub    %edx,%eax
+     d9d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+     da1:	89 c8                	mov    %ecx,%eax
+     da3:	09 d8                	or     %ebx,%eax
+     da5:	75 c1                	jne    d68 <printf+0x1a8>
+     da7:	8b 55 bc             	mov    -0x44(%ebp),%edx
+     daa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     dad:	01 d6                	add    %edx,%esi
+     daf:	89 f7                	mov    %esi,%edi
+     db1:	89 d6                	mov    %edx,%esi
+     db3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     db7:	90                   	nop
+    putc(fd, buf[i]);
+     db8:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+     dbb:	83 ec 04             	sub    $0x4,%esp
+     dbe:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+     dc1:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+     dc4:	6a 01                	push   $0x1
+     dc6:	50                   	push   %eax
+     dc7:	53                   	push   %ebx
+     dc8:	e8 b3 f4 ff ff       	call   280 <bufwrite>
+  while(--i >= 0)
+     dcd:	89 fa                	mov    %edi,%edx
+     dcf:	83 c4 10             	add    $0x10,%esp
+     dd2:	83 ef 01             	sub    $0x1,%edi
+     dd5:	39 d6                	cmp    %edx,%esi
+     dd7:	75 df                	jne    db8 <printf+0x1f8>
+        ap += 2;
+     dd9:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+     ddd:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+     de0:	31 f6                	xor    %esi,%esi
+     de2:	e9 15 fe ff ff       	jmp    bfc <printf+0x3c>
+     de7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dee:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+     df0:	83 ec 04             	sub    $0x4,%esp
+     df3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     df6:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     df9:	6a 01                	push   $0x1
+     dfb:	e9 8b fe ff ff       	jmp    c8b <printf+0xcb>
+
+00000e00 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     e00:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e01:	a1 40 27 00 00       	mov    0x2740,%eax
+{
+     e06:	89 e5                	mov    %esp,%ebp
+     e08:	57                   	push   %edi
+     e09:	56                   	push   %esi
+     e0a:	53                   	push   %ebx
+     e0b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     e0e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e18:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e1a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e1c:	39 ca                	cmp    %ecx,%edx
+     e1e:	73 30                	jae    e50 <free+0x50>
+     e20:	39 c1                	cmp    %eax,%ecx
+     e22:	72 04                	jb     e28 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e24:	39 c2                	cmp    %eax,%edx
+     e26:	72 f0                	jb     e18 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     e28:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     e2b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     e2e:	39 f8                	cmp    %edi,%eax
+     e30:	74 2e                	je     e60 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e32:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     e35:	8b 42 04             	mov    0x4(%edx),%eax
+     e38:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     e3b:	39 f1                	cmp    %esi,%ecx
+     e3d:	74 38                	je     e77 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     e3f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     e41:	5b                   	pop    %ebx
+  freep = p;
+     e42:	89 15 40 27 00 00    	mov    %edx,0x2740
+}
+     e48:	5e                   	pop    %esi
+     e49:	5f                   	pop    %edi
+     e4a:	5d                   	pop    %ebp
+     e4b:	c3                   	ret
+     e4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e50:	39 c1                	cmp    %eax,%ecx
+     e52:	72 d0                	jb     e24 <free+0x24>
+     e54:	eb c2                	jmp    e18 <free+0x18>
+     e56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e5d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+     e60:	03 70 04             	add    0x4(%eax),%esi
+     e63:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e66:	8b 02                	mov    (%edx),%eax
+     e68:	8b 00                	mov    (%eax),%eax
+     e6a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     e6d:	8b 42 04             	mov    0x4(%edx),%eax
+     e70:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     e73:	39 f1                	cmp    %esi,%ecx
+     e75:	75 c8                	jne    e3f <free+0x3f>
+    p->s.size += bp->s.size;
+     e77:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     e7a:	89 15 40 27 00 00    	mov    %edx,0x2740
+    p->s.size += bp->s.size;
+     e80:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     e83:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     e86:	89 0a                	mov    %ecx,(%edx)
+}
+     e88:	5b                   	pop    %ebx
+     e89:	5e                   	pop    %esi
+     e8a:	5f                   	pop    %edi
+     e8b:	5d                   	pop    %ebp
+     e8c:	c3                   	ret
+     e8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e90 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     e90:	55                   	push   %ebp
+     e91:	89 e5                	mov    %esp,%ebp
+     e93:	57                   	push   %edi
+     e94:	56                   	push   %esi
+     e95:	53                   	push   %ebx
+     e96:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     e99:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+     e9c:	8b 15 40 27 00 00    	mov    0x2740,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     ea2:	8d 78 07             	lea    0x7(%eax),%edi
+     ea5:	c1 ef 03             	shr    $0x3,%edi
+     ea8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+     eab:	85 d2                	test   %edx,%edx
+     ead:	0f 84 8d 00 00 00    	je     f40 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     eb3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     eb5:	8b 48 04             	mov    0x4(%eax),%ecx
+     eb8:	39 f9                	cmp    %edi,%ecx
+     eba:	73 64                	jae    f20 <malloc+0x90>
+  if(nu < 4096)
+     ebc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     ec1:	39 df                	cmp    %ebx,%edi
+     ec3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     ec6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     ecd:	eb 0a                	jmp    ed9 <malloc+0x49>
+     ecf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     ed0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     ed2:	8b 48 04             	mov    0x4(%eax),%ecx
+     ed5:	39 f9                	cmp    %edi,%ecx
+     ed7:	73 47                	jae    f20 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     ed9:	89 c2                	mov    %eax,%edx
+     edb:	39 05 40 27 00 00    	cmp    %eax,0x2740
+     ee1:	75 ed                	jne    ed0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+     ee3:	83 ec 0c             	sub    $0xc,%esp
+     ee6:	56                   	push   %esi
+     ee7:	e8 c7 fa ff ff       	call   9b3 <sbrk>
+  if(p == (char*)-1)
+     eec:	83 c4 10             	add    $0x10,%esp
+     eef:	83 f8 ff             	cmp    $0xffffffff,%eax
+     ef2:	74 1c                	je     f10 <malloc+0x80>
+  hp->s.size = nu;
+     ef4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+     ef7:	83 ec 0c             	sub    $0xc,%esp
+     efa:	83 c0 08             	add    $0x8,%eax
+     efd:	50                   	push   %eax
+     efe:	e8 fd fe ff ff       	call   e00 <free>
+  return freep;
+     f03:	8b 15 40 27 00 00    	mov    0x2740,%edx
+      if((p = morecore(nunits)) == 0)
+     f09:	83 c4 10             	add    $0x10,%esp
+     f0c:	85 d2                	test   %edx,%edx
+     f0e:	75 c0                	jne    ed0 <malloc+0x40>
+        return 0;
+  }
+}
+     f10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     f13:	31 c0                	xor    %eax,%eax
+}
+     f15:	5b                   	pop    %ebx
+     f16:	5e                   	pop    %esi
+     f17:	5f                   	pop    %edi
+     f18:	5d                   	pop    %ebp
+     f19:	c3                   	ret
+     f1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     f20:	39 cf                	cmp    %ecx,%edi
+     f22:	74 4c                	je     f70 <malloc+0xe0>
+        p->s.size -= nunits;
+     f24:	29 f9                	sub    %edi,%ecx
+     f26:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+     f29:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+     f2c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+     f2f:	89 15 40 27 00 00    	mov    %edx,0x2740
+}
+     f35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+     f38:	83 c0 08             	add    $0x8,%eax
+}
+     f3b:	5b                   	pop    %ebx
+     f3c:	5e                   	pop    %esi
+     f3d:	5f                   	pop    %edi
+     f3e:	5d                   	pop    %ebp
+     f3f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+     f40:	c7 05 40 27 00 00 44 	movl   $0x2744,0x2740
+     f47:	27 00 00 
+    base.s.size = 0;
+     f4a:	b8 44 27 00 00       	mov    $0x2744,%eax
+    base.s.ptr = freep = prevp = &base;
+     f4f:	c7 05 44 27 00 00 44 	movl   $0x2744,0x2744
+     f56:	27 00 00 
+    base.s.size = 0;
+     f59:	c7 05 48 27 00 00 00 	movl   $0x0,0x2748
+     f60:	00 00 00 
+    if(p->s.size >= nunits){
+     f63:	e9 54 ff ff ff       	jmp    ebc <malloc+0x2c>
+     f68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f6f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+     f70:	8b 08                	mov    (%eax),%ecx
+     f72:	89 0a                	mov    %ecx,(%edx)
+     f74:	eb b9                	jmp    f2f <malloc+0x9f>
+     f76:	66 90                	xchg   %ax,%ax
+     f78:	66 90                	xchg   %ax,%ax
+     f7a:	66 90                	xchg   %ax,%ax
+     f7c:	66 90                	xchg   %ax,%ax
+     f7e:	66 90                	xchg   %ax,%ax
+
+00000f80 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+     f80:	55                   	push   %ebp
+     f81:	89 e5                	mov    %esp,%ebp
+     f83:	57                   	push   %edi
+     f84:	56                   	push   %esi
+     f85:	be 01 00 00 00       	mov    $0x1,%esi
+     f8a:	53                   	push   %ebx
+     f8b:	83 ec 28             	sub    $0x28,%esp
+     f8e:	8b 45 0c             	mov    0xc(%ebp),%eax
+     f91:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     f94:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+     f97:	68 00 98 00 00       	push   $0x9800
+     f9c:	e8 ef fe ff ff       	call   e90 <malloc>
+     fa1:	83 c4 10             	add    $0x10,%esp
+     fa4:	89 c7                	mov    %eax,%edi
+     fa6:	85 c0                	test   %eax,%eax
+     fa8:	74 62                	je     100c <waitpoll+0x8c>
+     faa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+     fb0:	83 ec 0c             	sub    $0xc,%esp
+     fb3:	6a 01                	push   $0x1
+     fb5:	e8 03 fa ff ff       	call   9bd <sleep>
+    fn();
+     fba:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     fbd:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+     fbf:	58                   	pop    %eax
+     fc0:	5a                   	pop    %edx
+     fc1:	68 00 02 00 00       	push   $0x200
+     fc6:	57                   	push   %edi
+     fc7:	e8 eb fa ff ff       	call   ab7 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+     fcc:	83 c4 10             	add    $0x10,%esp
+     fcf:	85 c0                	test   %eax,%eax
+     fd1:	7e 2d                	jle    1000 <waitpoll+0x80>
+     fd3:	6b c0 4c             	imul   $0x4c,%eax,%eax
+     fd6:	89 fa                	mov    %edi,%edx
+    alive = 0;
+     fd8:	31 c9                	xor    %ecx,%ecx
+     fda:	01 f8                	add    %edi,%eax
+     fdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+     fe0:	3b 1a                	cmp    (%edx),%ebx
+     fe2:	75 07                	jne    feb <waitpoll+0x6b>
+        alive = 1;
+     fe4:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+     fe8:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+     feb:	83 c2 4c             	add    $0x4c,%edx
+     fee:	39 d0                	cmp    %edx,%eax
+     ff0:	75 ee                	jne    fe0 <waitpoll+0x60>
+  } while(alive);
+     ff2:	85 c9                	test   %ecx,%ecx
+     ff4:	75 ba                	jne    fb0 <waitpoll+0x30>
+     ff6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ffd:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+    1000:	83 ec 0c             	sub    $0xc,%esp
+    1003:	57                   	push   %edi
+    1004:	e8 f7 fd ff ff       	call   e00 <free>
+  wait();
+    1009:	83 c4 10             	add    $0x10,%esp
+}
+    100c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    100f:	5b                   	pop    %ebx
+    1010:	5e                   	pop    %esi
+    1011:	5f                   	pop    %edi
+    1012:	5d                   	pop    %ebp
+  wait();
+    1013:	e9 10 f9 ff ff       	jmp    928 <wait>
+    1018:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    101f:	90                   	nop
+
+00001020 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+    1020:	55                   	push   %ebp
+    1021:	89 e5                	mov    %esp,%ebp
+    1023:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+    1026:	c7 45 f0 79 11 00 00 	movl   $0x1179,-0x10(%ebp)
+    102d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+    1034:	e8 87 f4 ff ff       	call   4c0 <fork>
+    1039:	85 c0                	test   %eax,%eax
+    103b:	78 09                	js     1046 <runps+0x26>
+    return -1;
+  if(pid == 0){
+    103d:	74 0e                	je     104d <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+    103f:	e8 e4 f8 ff ff       	call   928 <wait>
+}
+    1044:	c9                   	leave
+    1045:	c3                   	ret
+    1046:	c9                   	leave
+    return -1;
+    1047:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    104c:	c3                   	ret
+    exec("ps", argv);
+    104d:	50                   	push   %eax
+    104e:	50                   	push   %eax
+    104f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    1052:	50                   	push   %eax
+    1053:	68 79 11 00 00       	push   $0x1179
+    1058:	e8 c3 f4 ff ff       	call   520 <exec>
+    printf(2, "exec ps failed\n");
+    105d:	5a                   	pop    %edx
+    105e:	59                   	pop    %ecx
+    105f:	68 7c 11 00 00       	push   $0x117c
+    1064:	6a 02                	push   $0x2
+    1066:	e8 55 fb ff ff       	call   bc0 <printf>
+    exit();
+    106b:	e8 a0 f4 ff ff       	call   510 <exit>
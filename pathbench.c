@@ -0,0 +1,93 @@
+// Time repeated lookups of a deep path, both of a file that
+// exists and of one that does not, to measure name lookup.
+//
+// usage: pathbench [n]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define DEPTH 6
+
+char path[64];
+
+// Create DEPTH nested directories pb/d1/... and a file
+// at the bottom.  Leaves the file's path in path.
+void
+setup(void)
+{
+  int i, fd, n;
+
+  strcpy(path, "pb");
+  mkdir(path);
+  for(i = 1; i < DEPTH; i++){
+    n = strlen(path);
+    path[n] = '/';
+    path[n+1] = 'd';
+    path[n+2] = '0' + i;
+    path[n+3] = 0;
+    mkdir(path);
+  }
+  n = strlen(path);
+  strcpy(path + n, "/file");
+  if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+    printf(2, "pathbench: cannot create %s\n", path);
+    exit();
+  }
+  close(fd);
+}
+
+// Remove the file and directories made by setup(),
+// deepest first.
+void
+cleanup(void)
+{
+  int n;
+
+  unlink(path);
+  for(n = strlen(path); n > 0; n--){
+    if(path[n] == '/'){
+      path[n] = 0;
+      unlink(path);
+    }
+  }
+  unlink(path);
+}
+
+// stat() path n times; returns the ticks taken.
+int
+lookups(char *p, int n, int want)
+{
+  struct stat st;
+  int i, t;
+
+  t = uptime();
+  for(i = 0; i < n; i++){
+    if((stat(p, &st) >= 0) != want){
+      printf(2, "pathbench: unexpected result for %s\n", p);
+      exit();
+    }
+  }
+  return uptime() - t;
+}
+
+int
+main(int argc, char *argv[])
+{
+  char missing[64];
+  int n, n2;
+
+  n = argc > 1 ? atoi(argv[1]) : 2000;
+  setup();
+  strcpy(missing, path);
+  n2 = strlen(missing);
+  strcpy(missing + n2 - 4, "none");
+
+  printf(1, "pathbench: %d lookups of %s\n", n, path);
+  printf(1, "present: %d ticks\n", lookups(path, n, 1));
+  printf(1, "absent: %d ticks\n", lookups(missing, n, 0));
+
+  cleanup();
+  exit();
+}
@@ -7,6 +7,7 @@
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
+#include "uio.h"
 
 #define PIPESIZE 512
 
@@ -69,6 +70,7 @@ pipeclose(struct pipe *p, int writable)
   }
   if(p->readopen == 0 && p->writeopen == 0){
     release(&p->lock);
+    droplock(&p->lock);
     kfree((char*)p);
   } else
     release(&p->lock);
@@ -100,7 +102,20 @@ pipewrite(struct pipe *p, char *addr, int n)
 int
 piperead(struct pipe *p, char *addr, int n)
 {
-  int i;
+  struct iovec v;
+
+  v.base = addr;
+  v.len = n;
+  return pipereadv(p, &v, 1);
+}
+
+// Read into the iovcnt buffers of iov, in order, whatever
+// the pipe holds once it holds anything.
+int
+pipereadv(struct pipe *p, struct iovec *iov, int iovcnt)
+{
+  int i, j, tot;
+  char *addr;
 
   acquire(&p->lock);
   while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
@@ -110,12 +125,17 @@ piperead(struct pipe *p, char *addr, int n)
     }
     sleep(&p->nread, &p->lock); //DOC: piperead-sleep
   }
-  for(i = 0; i < n; i++){  //DOC: piperead-copy
-    if(p->nread == p->nwrite)
-      break;
-    addr[i] = p->data[p->nread++ % PIPESIZE];
+  tot = 0;
+  for(j = 0; j < iovcnt && p->nread != p->nwrite; j++){
+    addr = iov[j].base;
+    for(i = 0; i < iov[j].len; i++){  //DOC: piperead-copy
+      if(p->nread == p->nwrite)
+        break;
+      addr[i] = p->data[p->nread++ % PIPESIZE];
+    }
+    tot += i;
   }
   wakeup(&p->nwrite);  //DOC: piperead-wakeup
   release(&p->lock);
-  return i;
+  return tot;
 }
@@ -1,11 +1,12 @@
 #include "types.h"
 #include "stat.h"
 #include "user.h"
+#include "x86.h"
 
 static void
 putc(int fd, char c)
 {
-  write(fd, &c, 1);
+  bufwrite(fd, &c, 1);
 }
 
 static void
@@ -35,7 +36,28 @@ printint(int fd, int xx, int base, int sgn)
     putc(fd, buf[i]);
 }
 
-// Print to the given fd. Only understands %d, %x, %p, %s.
+// Print x in decimal, with div64() since there is
+// no libgcc for 64-bit division.
+static void
+printlong(int fd, uint64 x)
+{
+  char buf[20];
+  int i;
+  uint64 q;
+
+  i = 0;
+  do{
+    q = div64(x, 10);
+    buf[i++] = '0' + (x - q*10);
+  }while((x = q) != 0);
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+}
+
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
 void
 printf(int fd, const char *fmt, ...)
 {
@@ -57,6 +79,9 @@ printf(int fd, const char *fmt, ...)
       if(c == 'd'){
         printint(fd, *ap, 10, 1);
         ap++;
+      } else if(c == 'l'){
+        printlong(fd, *(uint64*)ap);
+        ap += 2;
       } else if(c == 'x' || c == 'p'){
         printint(fd, *ap, 16, 0);
         ap++;
@@ -65,10 +90,7 @@ printf(int fd, const char *fmt, ...)
         ap++;
         if(s == 0)
           s = "(null)";
-        while(*s != 0){
-          putc(fd, *s);
-          s++;
-        }
+        bufwrite(fd, s, strlen(s));
       } else if(c == 'c'){
         putc(fd, *ap);
         ap++;
@@ -82,4 +104,6 @@ printf(int fd, const char *fmt, ...)
       state = 0;
     }
   }
+  if(fd == 2)
+    fflush(fd);
 }
@@ -7,10 +7,35 @@
 #include "proc.h"
 #include "spinlock.h"
 #include "fcntl.h" // Include for scheduler policy defines
-
+#include "procinfo.h"
+#include "schedlat.h"
+#include "trace.h"
+
+#define NWAITQ 64  // Wait queue hash buckets, a power of 2
+
+// Sleeping processes are queued, oldest first, on the wait
+// queue that their chan hashes to, so that wakeup() looks at
+// only those and not at every proc.
+struct waitq {
+  struct proc *head;
+  struct proc *tail;
+};
+
+#define NPIDHASH 64  // Pid hash buckets, a power of 2
+
+// Procs are carved from pages as needed, up to NPROC of them,
+// and go on a free list when wait() reaps them; the pages are
+// never freed, so a stale proc pointer still points at a proc.
+// The live ones are on a list, oldest first, for the scheduler
+// to walk, and in a hash table by pid.
 struct {
   struct spinlock lock;
-  struct proc proc[NPROC];
+  struct proc *all;            // Live procs, oldest first
+  struct proc *last;
+  struct proc *free;           // Reaped procs, linked by next
+  int nproc;                   // Procs carved so far
+  struct proc *pidhash[NPIDHASH];
+  struct waitq waitq[NWAITQ];
 } ptable;
 
 static struct proc *initproc;
@@ -80,46 +105,234 @@ myproc(void) {
   return p;
 }
 
+static struct waitq*
+waitq(void *chan)
+{
+  uint h = (uint)chan;
+
+  h ^= h >> 6;
+  h ^= h >> 12;
+  return &ptable.waitq[h & (NWAITQ-1)];
+}
+
+// Caller must hold ptable.lock.
+static void
+enqueue(struct proc *p)
+{
+  struct waitq *q = waitq(p->chan);
+
+  p->qnext = 0;
+  p->qprev = q->tail;
+  if(q->tail)
+    q->tail->qnext = p;
+  else
+    q->head = p;
+  q->tail = p;
+}
+
+// Caller must hold ptable.lock.
+static void
+dequeue(struct proc *p)
+{
+  struct waitq *q = waitq(p->chan);
+
+  if(p->qprev)
+    p->qprev->qnext = p->qnext;
+  else
+    q->head = p->qnext;
+  if(p->qnext)
+    p->qnext->qprev = p->qprev;
+  else
+    q->tail = p->qprev;
+  p->qnext = p->qprev = 0;
+}
+
 //PAGEBREAK: 32
-// Look in the process table for an UNUSED proc.
-// If found, change state to EMBRYO and initialize
-// state required to run in the kernel.
-// Otherwise return 0.
+// Put p on the run queue, charging it for any time it
+// slept. Caller must hold ptable.lock.
+static void
+makerunnable(struct proc *p)
+{
+  uint64 now = rdtsc();
+
+  if(p->state == SLEEPING){
+    dequeue(p);
+    p->sleepcycles += now - p->since;
+    trace(TR_WAKEUP, p->pid, myproc() ? myproc()->pid : 0);
+  }
+  p->state = RUNNABLE;
+  p->since = now;
+}
+
+// c is about to run p: charge p for the time it sat
+// RUNNABLE, and count it in c's latency histogram,
+// whose bucket i holds waits of 2^i to 2^(i+1)-1 cycles.
+// sched() charges p for the time it then runs.
+static void
+dispatched(struct cpu *c, struct proc *p)
+{
+  uint64 now, lat;
+  int i;
+
+  now = rdtsc();
+  lat = now - p->since;
+  p->since = now;
+  p->rqwait += lat;
+  for(i = 0; i < NLATBUCKET-1 && (lat >> (i+1)) != 0; i++)
+    ;
+  c->lathist[i]++;
+  c->dispatches++;
+  trace(TR_SWITCHIN, p->pid, 0);
+}
+
+// Copy out the dispatch latency histograms of up to max CPUs.
+// Returns the number copied.
+int
+schedlat(struct schedlat *sl, int max)
+{
+  int i;
+
+  if(max > ncpu)
+    max = ncpu;
+  acquire(&ptable.lock);
+  for(i = 0; i < max; i++){
+    sl[i].dispatches = cpus[i].dispatches;
+    memmove(sl[i].hist, cpus[i].lathist, sizeof(sl[i].hist));
+  }
+  release(&ptable.lock);
+  return max;
+}
+
+// The live process with the given pid, or 0.
+// Caller must hold ptable.lock.
+static struct proc*
+findproc(int pid)
+{
+  struct proc *p;
+
+  for(p = ptable.pidhash[pid & (NPIDHASH-1)]; p; p = p->hnext)
+    if(p->pid == pid)
+      return p;
+  return 0;
+}
+
+// Make p a child of parent. Caller must hold ptable.lock.
+static void
+addchild(struct proc *parent, struct proc *p)
+{
+  p->parent = parent;
+  p->sibprev = 0;
+  p->sibnext = parent->child;
+  if(parent->child)
+    parent->child->sibprev = p;
+  parent->child = p;
+}
+
+// Caller must hold ptable.lock.
+static void
+removechild(struct proc *p)
+{
+  if(p->sibprev)
+    p->sibprev->sibnext = p->sibnext;
+  else
+    p->parent->child = p->sibnext;
+  if(p->sibnext)
+    p->sibnext->sibprev = p->sibprev;
+  p->parent = p->sibnext = p->sibprev = 0;
+}
+
+// Take p off the live list, the pid hash and its parent's
+// children, free its kernel stack and put it on the free list.
+// The caller frees its memory. Caller must hold ptable.lock.
+static void
+freeproc(struct proc *p)
+{
+  struct proc **pp;
+
+  if(p->prev)
+    p->prev->next = p->next;
+  else
+    ptable.all = p->next;
+  if(p->next)
+    p->next->prev = p->prev;
+  else
+    ptable.last = p->prev;
+  for(pp = &ptable.pidhash[p->pid & (NPIDHASH-1)]; *pp != p; pp = &(*pp)->hnext)
+    ;
+  *pp = p->hnext;
+  if(p->parent)
+    removechild(p);
+
+  if(p->kstack)
+    kfree(p->kstack);
+  p->kstack = 0;
+  p->pid = 0;
+  p->name[0] = 0;
+  p->killed = 0;
+  p->state = UNUSED;
+  p->next = ptable.free;
+  ptable.free = p;
+}
+
+// Take a proc from the free list, carving a new page of
+// them if it is empty and NPROC allows. If found, change
+// state to EMBRYO and initialize state required to run in
+// the kernel. Otherwise return 0.
 static struct proc*
 allocproc(void)
 {
   struct proc *p;
-  char *sp;
+  char *sp, *pg;
+  int i;
 
   acquire(&ptable.lock);
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == UNUSED)
-      goto found;
-
-  release(&ptable.lock);
-  return 0;
+  if(ptable.free == 0 && ptable.nproc < NPROC && (pg = kalloc()) != 0){
+    memset(pg, 0, PGSIZE);
+    for(i = 0; i < PGSIZE/sizeof(*p) && ptable.nproc < NPROC; i++){
+      p = (struct proc*)pg + i;
+      p->next = ptable.free;
+      ptable.free = p;
+      ptable.nproc++;
+    }
+  }
+  if((p = ptable.free) == 0){
+    release(&ptable.lock);
+    return 0;
+  }
+  ptable.free = p->next;
 
-found:
   p->state = EMBRYO;
   p->pid = nextpid++;
-  p->createtime = ticks;     // Set creation time
+  p->next = 0;
+  p->prev = ptable.last;
+  if(ptable.last)
+    ptable.last->next = p;
+  else
+    ptable.all = p;
+  ptable.last = p;
+  p->hnext = ptable.pidhash[p->pid & (NPIDHASH-1)];
+  ptable.pidhash[p->pid & (NPIDHASH-1)] = p;
   p->syscall_count = 0;
   p->good_syscall_count = 0;
-  p->runtime = 0;
-  p->sleeptime = 0;
-  p->exittime = 0;
   p->priority = 60;          // Default priority
   p->estimated_burst = 5;    // Default burst time guess
   p->last_burst_ticks = 0;   // Initialize last burst counter
   p->ticks = 0;              // Initialize ticks counter
   p->yield_request = 0;      // Initialize yield request flag
+  p->created = p->since = rdtsc();
+  p->exited = 0;
+  p->runcycles = 0;
+  p->sleepcycles = 0;
+  p->rqwait = 0;
 
   release(&ptable.lock);
 
   // Allocate kernel stack.
   if((p->kstack = kalloc()) == 0){
-    p->state = UNUSED;
+    acquire(&ptable.lock);
+    freeproc(p);
+    release(&ptable.lock);
     return 0;
   }
   sp = p->kstack + KSTACKSIZE;
@@ -141,6 +354,24 @@ found:
   return p;
 }
 
+// Start a kernel thread running fn, which must not return.
+// It has the kernel's page table and no user memory.
+void
+kthread(void (*fn)(void), char *name)
+{
+  struct proc *p;
+
+  if((p = allocproc()) == 0 || (p->pgdir = setupkvm()) == 0)
+    panic("kthread");
+  // forkret returns into fn instead of trapret.
+  *(uint*)(p->context + 1) = (uint)fn;
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  acquire(&ptable.lock);
+  makerunnable(p);
+  release(&ptable.lock);
+}
+
 //PAGEBREAK: 32
 // Set up first user process.
 void
@@ -173,7 +404,7 @@ userinit(void)
   // writes to be visible, and the lock is also needed
   // because the assignment might not be atomic.
   acquire(&ptable.lock);
-  p->state = RUNNABLE;
+  makerunnable(p);
   release(&ptable.lock);
 }
 
@@ -187,6 +418,8 @@ growproc(int n)
   
   sz = curproc->sz;
   if(n > 0){
+    if(sz + n > MMAPBASE)
+      return -1;
     if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
       return -1;
   } else if(n < 0){
@@ -215,13 +448,20 @@ fork(void)
 
   // Copy process state from proc.
   if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
-    kfree(np->kstack);
-    np->kstack = 0;
-    np->state = UNUSED;
+    acquire(&ptable.lock);
+    freeproc(np);
+    release(&ptable.lock);
+    return -1;
+  }
+  if(mmapdup(curproc, np) < 0){
+    munmapall(np);
+    freevm(np->pgdir);
+    acquire(&ptable.lock);
+    freeproc(np);
+    release(&ptable.lock);
     return -1;
   }
   np->sz = curproc->sz;
-  np->parent = curproc;
   *np->tf = *curproc->tf;
 
   // Clear %eax so that fork returns 0 in the child.
@@ -235,10 +475,12 @@ fork(void)
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
 
   pid = np->pid;
+  trace(TR_FORK, curproc->pid, pid);
 
   acquire(&ptable.lock);
 
-  np->state = RUNNABLE;
+  addchild(curproc, np);
+  makerunnable(np);
 
   release(&ptable.lock);
 
@@ -258,6 +500,8 @@ exit(void)
   if(curproc == initproc)
     panic("init exiting");
 
+  munmapall(curproc);
+
   // Close all open files.
   for(fd = 0; fd < NOFILE; fd++){
     if(curproc->ofile[fd]){
@@ -277,16 +521,15 @@ exit(void)
   wakeup1(curproc->parent);
 
   // Pass abandoned children to init.
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->parent == curproc){
-      p->parent = initproc;
-      if(p->state == ZOMBIE)
-        wakeup1(initproc);
-    }
+  while((p = curproc->child) != 0){
+    removechild(p);
+    addchild(initproc, p);
+    if(p->state == ZOMBIE)
+      wakeup1(initproc);
   }
 
-  // In the exit() function before setting state to ZOMBIE
-  curproc->exittime = ticks;
+  curproc->exited = rdtsc();
+  trace(TR_EXIT, curproc->pid, 0);
 
   // Jump into the scheduler, never to return.
   curproc->state = ZOMBIE;
@@ -305,23 +548,14 @@ wait(void)
 
   acquire(&ptable.lock);
   for(;;){
-    // Scan through table looking for exited children.
-    havekids = 0;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->parent != curproc)
-        continue;
-      havekids = 1;
+    // Scan through children looking for exited ones.
+    havekids = curproc->child != 0;
+    for(p = curproc->child; p; p = p->sibnext){
       if(p->state == ZOMBIE){
         // Found one.
         pid = p->pid;
-        kfree(p->kstack);
-        p->kstack = 0;
         freevm(p->pgdir);
-        p->pid = 0;
-        p->parent = 0;
-        p->name[0] = 0;
-        p->killed = 0;
-        p->state = UNUSED;
+        freeproc(p);
         release(&ptable.lock);
         return pid;
       }
@@ -339,7 +573,7 @@ wait(void)
 }
 
 int
-waitx(int *wtime, int *rtime)
+waitx(uint64 *wtime, uint64 *rtime)
 {
   struct proc *p;
   int havekids, pid;
@@ -347,26 +581,17 @@ waitx(int *wtime, int *rtime)
 
   acquire(&ptable.lock);
   for(;;){
-    // Scan through table looking for exited children
-    havekids = 0;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->parent != curproc)
-        continue;
-      havekids = 1;
+    // Scan through children looking for exited ones
+    havekids = curproc->child != 0;
+    for(p = curproc->child; p; p = p->sibnext){
       if(p->state == ZOMBIE){
         // Found one
         pid = p->pid;
-        *wtime = p->exittime - p->createtime - p->runtime;
-        *rtime = p->runtime;
+        *wtime = tsc2us(p->exited - p->created - p->runcycles);
+        *rtime = tsc2us(p->runcycles);
         // Clean up as in wait()
-        kfree(p->kstack);
-        p->kstack = 0;
         freevm(p->pgdir);
-        p->pid = 0;
-        p->parent = 0;
-        p->name[0] = 0;
-        p->killed = 0;
-        p->state = UNUSED;
+        freeproc(p);
         release(&ptable.lock);
         return pid;
       }
@@ -407,10 +632,10 @@ scheduler(void)
     if (current_scheduler == SCHED_FCFS) {
       // FCFS scheduler implementation
       struct proc *firstproc = 0;
-      for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+      for(p = ptable.all; p; p = p->next){
         if(p->state != RUNNABLE)
           continue;
-        if(firstproc == 0 || p->createtime < firstproc->createtime)
+        if(firstproc == 0 || p->created < firstproc->created)
           firstproc = p;
       }
       if(firstproc){
@@ -419,6 +644,7 @@ scheduler(void)
         c->proc = p;
         switchuvm(p);
         p->state = RUNNING;
+        dispatched(c, p);
         swtch(&(c->scheduler), p->context);
         switchkvm();
         c->proc = 0;
@@ -426,13 +652,9 @@ scheduler(void)
     } else if (current_scheduler == SCHED_SJF) {
       // SJF scheduler implementation
       struct proc *shortest_proc = 0;
-      for(p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
+      for(p = ptable.all; p; p = p->next) {
         if(p->state != RUNNABLE)
           continue;
-        
-        // Add debug prints to verify values
-        // cprintf("SJF considering PID %d, burst: %d\n", p->pid, p->estimated_burst);
-        
         if(shortest_proc == 0 || p->estimated_burst < shortest_proc->estimated_burst)
           shortest_proc = p;
       }
@@ -441,6 +663,7 @@ scheduler(void)
         c->proc = p;
         switchuvm(p);
         p->state = RUNNING;
+        dispatched(c, p);
         swtch(&(c->scheduler), p->context);
         switchkvm();
         // Update estimated burst (assuming SJF implementation does this)
@@ -449,65 +672,31 @@ scheduler(void)
         c->proc = 0;
       }
     } else if (current_scheduler == SCHED_BJF) {
-       // cprintf("DEBUG: BJF scheduler entered\n"); // Keep this if needed
-       struct proc *highestPriorityProc = 0;
-       struct proc *p_iter;
-       int runnable_found = 0; // Flag to check if any runnable process exists
-
-       // --- Start of ACTUAL BJF logic ---
-       for(p_iter = ptable.proc; p_iter < &ptable.proc[NPROC]; p_iter++){
-         if(p_iter->state != RUNNABLE)
-           continue;
-
-         runnable_found = 1;
-
-         // CHANGE: Only print for every 10th process or similar
-         if(p_iter->pid % 10 == 0) {
-           cprintf("DEBUG: BJF considering PID %d, Priority %d\n", 
-                   p_iter->pid, p_iter->priority);
-         }
-
-         // Check if this process is better than the current best
-         if (highestPriorityProc == 0 ||                                  
-             p_iter->priority < highestPriorityProc->priority ||           
-             (p_iter->priority == highestPriorityProc->priority &&        
-              p_iter->createtime < highestPriorityProc->createtime)) {    
-           highestPriorityProc = p_iter;
-           // CHANGE: Only print when actually selecting a new best
-           if(p_iter->pid % 10 == 0) {
-             cprintf("DEBUG: BJF selected new best: PID %d, prio: %d\n", 
-                    p_iter->pid, p_iter->priority);
-           }
-         }
-       }
-       // --- End of BJF logic ---
-
-       if(highestPriorityProc){ // If we found a best process
-         p = highestPriorityProc; // Assign it to 'p' for switching
-         // cprintf("DEBUG: BJF selected PID %d to run\n", p->pid); // Keep this if needed
-         c->proc = p;
-         switchuvm(p);
-         p->state = RUNNING;
-         swtch(&(c->scheduler), p->context);
-         switchkvm();
-         c->proc = 0;
-         // cprintf("DEBUG: BJF returned from PID %d\n", p->pid); // Optional
-       } else {
-         // This part should ideally only be reached if the system is idle (no runnable processes)
-         // If runnable_found is 1 here, there's still an issue in the selection logic above.
-         if (runnable_found) {
-            cprintf("DEBUG: BJF ERROR: Found runnable processes but selected none!\n");
-         } else {
-            // cprintf("DEBUG: BJF: No runnable process found this cycle.\n"); // Normal idle case
-         }
-         // Without a process to run, we might loop. Consider adding a halt or pause if truly idle.
-         // For now, it will just loop back and check again.
-       }
+      // BJF: lowest priority value first, then oldest.
+      // tracedump shows its decisions as TR_SWITCHIN events.
+      struct proc *best = 0;
+      for(p = ptable.all; p; p = p->next){
+        if(p->state != RUNNABLE)
+          continue;
+        if(best == 0 || p->priority < best->priority ||
+           (p->priority == best->priority && p->created < best->created))
+          best = p;
+      }
+      if(best){
+        p = best;
+        c->proc = p;
+        switchuvm(p);
+        p->state = RUNNING;
+        dispatched(c, p);
+        swtch(&(c->scheduler), p->context);
+        switchkvm();
+        c->proc = 0;
+      }
     } else if (current_scheduler == SCHED_RANDOM) {
       // Random scheduler implementation
       struct proc *chosen_proc = 0;
       int runnable_count = 0;
-      for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+      for(p = ptable.all; p; p = p->next){
         if(p->state == RUNNABLE) {
           runnable_count++;
         }
@@ -515,7 +704,7 @@ scheduler(void)
       if (runnable_count > 0) {
         int target_idx = rand() % runnable_count;
         int current_idx = 0;
-        for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+        for(p = ptable.all; p; p = p->next){
           if(p->state != RUNNABLE)
             continue;
           if(current_idx == target_idx) {
@@ -529,6 +718,7 @@ scheduler(void)
           c->proc = p;
           switchuvm(p);
           p->state = RUNNING;
+          dispatched(c, p);
           swtch(&(c->scheduler), p->context);
           switchkvm();
           c->proc = 0;
@@ -536,13 +726,14 @@ scheduler(void)
       }
     } else { // Default or SCHED_RR
       // Round Robin scheduler
-      for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+      for(p = ptable.all; p; p = p->next){
         if(p->state != RUNNABLE)
           continue;
         // Switch to chosen process.
         c->proc = p;
         switchuvm(p);
         p->state = RUNNING;
+        dispatched(c, p);
         // p->ticks = 0; // Reset ticks if your RR uses it
         swtch(&(c->scheduler), p->context);
         switchkvm();
@@ -564,6 +755,7 @@ void
 sched(void)
 {
   int intena;
+  uint64 now;
   struct proc *p = myproc();
 
   if(!holding(&ptable.lock))
@@ -574,6 +766,10 @@ sched(void)
     panic("sched running");
   if(readeflags()&FL_IF)
     panic("sched interruptible");
+  now = rdtsc();
+  p->runcycles += now - p->since;
+  p->since = now;
+  trace(TR_SWITCHOUT, p->pid, p->state);
   intena = mycpu()->intena;
   swtch(&p->context, mycpu()->scheduler);
   mycpu()->intena = intena;
@@ -584,7 +780,7 @@ void
 yield(void)
 {
   acquire(&ptable.lock);
-  myproc()->state = RUNNABLE;
+  makerunnable(myproc());
   myproc()->yield_request = 0;  // Reset yield request after yielding
   sched();
   release(&ptable.lock);
@@ -606,6 +802,7 @@ forkret(void)
     first = 0;
     iinit(ROOTDEV);
     initlog(ROOTDEV);
+    ballocinit(ROOTDEV);
   }
 
   // Return to "caller", actually trapret (see allocproc).
@@ -635,18 +832,13 @@ sleep(void *chan, struct spinlock *lk)
     release(lk);
   }
 
-  // In the sleep() function before sched()
-  uint start_ticks = ticks;
-
   // Go to sleep.
   p->chan = chan;
   p->state = SLEEPING;
+  enqueue(p);
 
   sched();
 
-  // After sched() returns
-  p->sleeptime += ticks - start_ticks;
-
   // Tidy up.
   p->chan = 0;
 
@@ -663,11 +855,13 @@ sleep(void *chan, struct spinlock *lk)
 static void
 wakeup1(void *chan)
 {
-  struct proc *p;
+  struct proc *p, *next;
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
+  for(p = waitq(chan)->head; p; p = next){
+    next = p->qnext;
+    if(p->chan == chan)
+      makerunnable(p);
+  }
 }
 
 // Wake up all processes sleeping on chan.
@@ -679,6 +873,24 @@ wakeup(void *chan)
   release(&ptable.lock);
 }
 
+// Wake up the process that has slept longest on chan,
+// for when only one of them could go on anyway.
+// Returns 1 if there was one, 0 if not.
+int
+wakeup_one(void *chan)
+{
+  struct proc *p;
+
+  acquire(&ptable.lock);
+  for(p = waitq(chan)->head; p; p = p->qnext)
+    if(p->chan == chan)
+      break;
+  if(p)
+    makerunnable(p);
+  release(&ptable.lock);
+  return p != 0;
+}
+
 // Kill the process with the given pid.
 // Process won't exit until it returns
 // to user space (see trap in trap.c).
@@ -688,15 +900,13 @@ kill(int pid)
   struct proc *p;
 
   acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->pid == pid){
-      p->killed = 1;
-      // Wake process from sleep if necessary.
-      if(p->state == SLEEPING)
-        p->state = RUNNABLE;
-      release(&ptable.lock);
-      return 0;
-    }
+  if((p = findproc(pid)) != 0){
+    p->killed = 1;
+    // Wake process from sleep if necessary.
+    if(p->state == SLEEPING)
+      makerunnable(p);
+    release(&ptable.lock);
+    return 0;
   }
   release(&ptable.lock);
   return -1;
@@ -721,7 +931,7 @@ procdump(void)
   struct proc *p;
   char *state;
   uint pc[10];
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.all; p; p = p->next){
     if(p->state == UNUSED)
       continue;
     if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
@@ -738,6 +948,77 @@ procdump(void)
   }
 }
 
+// Copy a snapshot of up to max processes into pi.
+// Returns the number copied.
+int
+getprocinfo(struct procinfo *pi, int max)
+{
+  static int states[] = {
+  [UNUSED]    PS_UNUSED,
+  [EMBRYO]    PS_EMBRYO,
+  [SLEEPING]  PS_SLEEPING,
+  [RUNNABLE]  PS_RUNNABLE,
+  [RUNNING]   PS_RUNNING,
+  [ZOMBIE]    PS_ZOMBIE
+  };
+  struct proc *p;
+  int i, n;
+
+  n = 0;
+  acquire(&ptable.lock);
+  for(p = ptable.all; p && n < max; p = p->next){
+    if(p->state == UNUSED)
+      continue;
+    pi->pid = p->pid;
+    pi->ppid = p->parent ? p->parent->pid : 0;
+    pi->state = states[p->state];
+    pi->priority = p->priority;
+    pi->runtime = tsc2us(p->runcycles);
+    pi->sleeptime = tsc2us(p->sleepcycles);
+    pi->syscalls = p->syscall_count;
+    pi->goodsyscalls = p->good_syscall_count;
+    pi->estimated_burst = p->estimated_burst;
+    pi->ticks = p->ticks;
+    pi->rqwait = tsc2us(p->rqwait +
+                        (p->state == RUNNABLE ? rdtsc() - p->since : 0));
+    pi->cpu = -1;
+    if(p->state == RUNNING)
+      for(i = 0; i < ncpu; i++)
+        if(cpus[i].proc == p)
+          pi->cpu = i;
+    safestrcpy(pi->name, p->name, sizeof(pi->name));
+    pi++;
+    n++;
+  }
+  release(&ptable.lock);
+  return n;
+}
+
+// Milliseconds from the creation of the process with the
+// given pid to its exit, or to now if it is still running;
+// -1 if there is no such process.
+int
+proclifetime(int pid)
+{
+  struct proc *p;
+  int lifetime;
+
+  lifetime = -1;
+  acquire(&ptable.lock);
+  if((p = findproc(pid)) != 0)
+    lifetime = div64((p->exited ? p->exited : rdtsc()) - p->created, tsckhz);
+  release(&ptable.lock);
+  return lifetime;
+}
+
+void
+setscheduler(int policy)
+{
+  acquire(&ptable.lock);
+  current_scheduler = policy;
+  release(&ptable.lock);
+}
+
 int
 get_uncle_count(int pid)
 {
@@ -747,12 +1028,8 @@ get_uncle_count(int pid)
   acquire(&ptable.lock);
 
   // Find process by pid
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->state != UNUSED && p->pid == pid){
-      parent = p->parent;
-      break;
-    }
-  }
+  if((p = findproc(pid)) != 0)
+    parent = p->parent;
 
   if(parent == 0){
     release(&ptable.lock);
@@ -767,8 +1044,8 @@ get_uncle_count(int pid)
   }
 
   // Count grandparent's children excluding the parent
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->state != UNUSED && p->parent == grandparent && p != parent){
+  for(p = grandparent->child; p; p = p->sibnext){
+    if(p != parent){
       uncle_count++;
     }
   }
@@ -8,6 +8,10 @@ struct cpu {
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
   struct proc *proc;           // The process running on this cpu or null
+  uint dispatches;             // Processes this cpu has run
+  uint lathist[NLATBUCKET];    // Their run queue waits, by log2 cycles
+  int timermul;                // Timer interrupts per clock tick
+  int subtick;                 // Of which this many since the last tick
 };
 
 extern struct cpu cpus[NCPU];
@@ -32,6 +36,16 @@ struct context {
   uint eip;
 };
 
+// A region of memory mapped from a file by mmap().
+struct vma {
+  uint addr;                   // Start, page aligned
+  uint len;                    // Length, page multiple; 0 if unused
+  int prot;                    // PROT_READ, PROT_WRITE
+  int flags;                   // MAP_SHARED or MAP_PRIVATE
+  struct file *f;              // The file mapped
+  uint off;                    // Offset of addr in the file
+};
+
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
 // Per-process state
@@ -42,24 +56,35 @@ struct proc {
   enum procstate state;        // Process state
   int pid;                     // Process ID
   struct proc *parent;         // Parent process
+  struct proc *child;          // First of its children
+  struct proc *sibnext;        // Parent's other children
+  struct proc *sibprev;
+  struct proc *next;           // Live procs, or the free list
+  struct proc *prev;
+  struct proc *hnext;          // Pid hash chain
   struct trapframe *tf;        // Trap frame for current syscall
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
+  struct proc *qnext;          // Wait queue of chan's hash bucket
+  struct proc *qprev;
   int killed;                  // If non-zero, have been killed
   struct file *ofile[NOFILE];  // Open files
   struct inode *cwd;           // Current directory
   char name[16];               // Process name (debugging)
-  uint createtime;             // When process was created
   uint syscall_count;          // Total number of syscalls made
   uint good_syscall_count;     // Number of successful syscalls
-  uint runtime;                // Total time spent running on CPU
-  uint sleeptime;              // Total time spent sleeping
-  uint exittime;               // When process exited
   int priority;                // Process priority
   int estimated_burst;         // Estimated CPU burst time
   int last_burst_ticks;        // Last recorded actual CPU burst
   uint ticks;                  // Number of timer ticks the process has consumed
   int yield_request;           // Flag to indicate process should yield
+  uint64 created;              // TSC at allocproc()
+  uint64 exited;               // TSC at exit()
+  uint64 since;                // TSC at last change of state
+  uint64 runcycles;            // TSC cycles spent RUNNING
+  uint64 sleepcycles;          // TSC cycles spent SLEEPING
+  uint64 rqwait;               // TSC cycles spent RUNNABLE
+  struct vma vma[NVMA];        // mmap()ed regions
 };
 
 // Process memory is laid out contiguously, low addresses first:
@@ -67,3 +92,5 @@ struct proc {
 //   original data and bss
 //   fixed-size stack
 //   expandable heap
+//   ...
+//   mmap()ed files, from MMAPBASE up
@@ -0,0 +1,25 @@
+// One process, as returned by the getprocinfo system call.
+struct procinfo {
+  int pid;
+  int ppid;                // parent's pid, or 0
+  int state;               // PS_*, below
+  int priority;
+  uint64 runtime;          // microseconds spent running
+  uint64 sleeptime;        // microseconds spent sleeping
+  uint syscalls;           // system calls made
+  uint goodsyscalls;       // and of those, successful
+  int estimated_burst;
+  uint ticks;              // timer ticks in the current slice
+  uint64 rqwait;           // microseconds spent RUNNABLE
+  int cpu;                 // cpu it is running on, or -1
+  char name[16];
+};
+
+// Values of state, kept apart from enum procstate in proc.h
+// so that user programs need not follow its numbering.
+#define PS_UNUSED   0
+#define PS_EMBRYO   1
+#define PS_SLEEPING 2
+#define PS_RUNNABLE 3
+#define PS_RUNNING  4
+#define PS_ZOMBIE   5
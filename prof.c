@@ -0,0 +1,105 @@
+// Sampling profiler.
+//
+// While profiling, each CPU's lapic timer interrupts profmul
+// times per clock tick, and every interrupt records the
+// interrupted eip in that CPU's ring, the same way trace.c
+// does. Only one interrupt in profmul counts as a tick, so
+// ticks, time slices and sleep() keep their length.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "prof.h"
+
+#define TICKHZ  100  // clock ticks per second
+#define MAXMUL  20   // most samples per tick
+
+static struct {
+  struct profsample s[NPROFILE];
+  volatile uint head;     // next slot to fill
+  volatile uint tail;     // next slot to read
+} ring[NCPU];
+
+static struct spinlock proflock;
+static int profmul;  // samples per tick, or 0 if off
+
+void
+profinit(void)
+{
+  initlock(&proflock, "prof");
+}
+
+// Called on each timer interrupt, with interrupts off.
+// Takes a sample if profiling, and returns 1 if this
+// interrupt is not a clock tick.
+int
+proftick(struct trapframe *tf)
+{
+  struct cpu *c = mycpu();
+  struct profsample *s;
+  int mul, cpu;
+
+  mul = profmul ? profmul : 1;
+  if(c->timermul != mul){
+    c->timermul = mul;
+    c->subtick = 0;
+    lapicrate(mul);
+  }
+  if(profmul == 0)
+    return 0;
+
+  cpu = c - cpus;
+  if(ring[cpu].head - ring[cpu].tail < NPROFILE){
+    s = &ring[cpu].s[ring[cpu].head % NPROFILE];
+    s->eip = tf->eip;
+    s->pid = c->proc ? c->proc->pid : 0;
+    s->cpu = cpu;
+    s->user = (tf->cs&3) == DPL_USER;
+    __sync_synchronize();
+    ring[cpu].head++;
+  }
+  if(++c->subtick < mul)
+    return 1;
+  c->subtick = 0;
+  return 0;
+}
+
+// Sample hz times a second, rounded to a multiple of the
+// clock rate, or stop if hz is 0. Returns the rate chosen.
+int
+profctl(int hz)
+{
+  int mul;
+
+  mul = hz / TICKHZ;
+  if(hz > 0 && mul < 1)
+    mul = 1;
+  if(mul > MAXMUL)
+    mul = MAXMUL;
+  profmul = mul;
+  return mul * TICKHZ;
+}
+
+// Move up to n samples into buf. Returns the number moved.
+int
+profread(struct profsample *buf, int n)
+{
+  int cpu, i;
+
+  i = 0;
+  acquire(&proflock);
+  for(cpu = 0; cpu < ncpu; cpu++){
+    while(i < n && ring[cpu].tail != ring[cpu].head){
+      __sync_synchronize();
+      buf[i++] = ring[cpu].s[ring[cpu].tail % NPROFILE];
+      __sync_synchronize();
+      ring[cpu].tail++;
+    }
+  }
+  release(&proflock);
+  return i;
+}
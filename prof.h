@@ -0,0 +1,8 @@
+// Profiler samples, returned by the profread system call.
+struct profsample {
+  uint eip;        // where the timer interrupt found the cpu
+  int pid;         // process running, or 0
+  uchar cpu;
+  uchar user;      // 1 if eip is a user address
+  ushort pad;
+};
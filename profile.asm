@@ -0,0 +1,2750 @@
+
+_profile:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return lo > 0 ? &t->s[lo-1] : 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+  struct sym *s, *best;
+  struct symtab *t, *bt;
+  int hz, pid, i, k, other, unknown;
+  char *prog;
+
+  hz = 1000;
+       e:	bf e8 03 00 00       	mov    $0x3e8,%edi
+{
+      13:	56                   	push   %esi
+  i = 1;
+      14:	be 01 00 00 00       	mov    $0x1,%esi
+{
+      19:	53                   	push   %ebx
+      1a:	51                   	push   %ecx
+      1b:	83 ec 18             	sub    $0x18,%esp
+      1e:	8b 19                	mov    (%ecx),%ebx
+      20:	8b 51 04             	mov    0x4(%ecx),%edx
+  if(argc > 2 && strcmp(argv[1], "-f") == 0){
+      23:	83 fb 02             	cmp    $0x2,%ebx
+      26:	7f 17                	jg     3f <main+0x3f>
+    hz = atoi(argv[2]);
+    i = 3;
+  }
+  if(i >= argc){
+      28:	39 de                	cmp    %ebx,%esi
+      2a:	7c 33                	jl     5f <main+0x5f>
+    printf(2, "usage: profile [-f hz] command [args...]\n");
+      2c:	51                   	push   %ecx
+      2d:	51                   	push   %ecx
+      2e:	68 f0 15 00 00       	push   $0x15f0
+      33:	6a 02                	push   $0x2
+      35:	e8 76 10 00 00       	call   10b0 <printf>
+    exit();
+      3a:	e8 c1 09 00 00       	call   a00 <exit>
+  if(argc > 2 && strcmp(argv[1], "-f") == 0){
+      3f:	50                   	push   %eax
+      40:	50                   	push   %eax
+      41:	68 89 15 00 00       	push   $0x1589
+      46:	ff 72 04             	push   0x4(%edx)
+      49:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+      4c:	e8 bf 0a 00 00       	call   b10 <strcmp>
+      51:	83 c4 10             	add    $0x10,%esp
+      54:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+      57:	85 c0                	test   %eax,%eax
+      59:	0f 84 17 02 00 00    	je     276 <main+0x276>
+  }
+  prog = argv[i];
+      5f:	8d 1c b2             	lea    (%edx,%esi,4),%ebx
+      62:	8b 33                	mov    (%ebx),%esi
+  if(strchr(prog, '/'))
+      64:	52                   	push   %edx
+      65:	52                   	push   %edx
+      66:	6a 2f                	push   $0x2f
+      68:	56                   	push   %esi
+      69:	e8 52 0b 00 00       	call   bc0 <strchr>
+      6e:	83 c4 10             	add    $0x10,%esp
+      71:	85 c0                	test   %eax,%eax
+      73:	74 24                	je     99 <main+0x99>
+    for(prog += strlen(prog); prog[-1] != '/'; prog--)
+      75:	83 ec 0c             	sub    $0xc,%esp
+      78:	56                   	push   %esi
+      79:	e8 f2 0a 00 00       	call   b70 <strlen>
+      7e:	83 c4 10             	add    $0x10,%esp
+      81:	01 c6                	add    %eax,%esi
+      83:	80 7e ff 2f          	cmpb   $0x2f,-0x1(%esi)
+      87:	74 10                	je     99 <main+0x99>
+      89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      90:	83 ee 01             	sub    $0x1,%esi
+      93:	80 7e ff 2f          	cmpb   $0x2f,-0x1(%esi)
+      97:	75 f7                	jne    90 <main+0x90>
+      ;
+  ktab.what = "kernel";
+  utab.what = prog;
+  loadsyms(prog);
+      99:	83 ec 0c             	sub    $0xc,%esp
+  utab.what = prog;
+      9c:	89 35 00 9f 01 00    	mov    %esi,0x19f00
+  loadsyms(prog);
+      a2:	56                   	push   %esi
+  ktab.what = "kernel";
+      a3:	c7 05 20 1f 02 00 82 	movl   $0x1582,0x21f20
+      aa:	15 00 00 
+  loadsyms(prog);
+      ad:	e8 ce 03 00 00       	call   480 <loadsyms>
+
+  drain();
+      b2:	e8 59 02 00 00       	call   310 <drain>
+  nsamp = 0;
+      b7:	31 c0                	xor    %eax,%eax
+  hz = profctl(hz);
+      b9:	89 3c 24             	mov    %edi,(%esp)
+  nsamp = 0;
+      bc:	a3 e4 1e 00 00       	mov    %eax,0x1ee4
+  hz = profctl(hz);
+      c1:	e8 09 0f 00 00       	call   fcf <profctl>
+      c6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  if((pid = fork()) < 0){
+      c9:	e8 e2 08 00 00       	call   9b0 <fork>
+      ce:	83 c4 10             	add    $0x10,%esp
+      d1:	89 c2                	mov    %eax,%edx
+      d3:	85 c0                	test   %eax,%eax
+      d5:	0f 88 88 01 00 00    	js     263 <main+0x263>
+    printf(2, "profile: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+      db:	0f 84 62 01 00 00    	je     243 <main+0x243>
+    exec(argv[i], argv + i);
+    printf(2, "profile: exec %s failed\n", argv[i]);
+    exit();
+  }
+  waitpoll(pid, drain);
+      e1:	50                   	push   %eax
+      e2:	50                   	push   %eax
+      e3:	68 10 03 00 00       	push   $0x310
+      e8:	52                   	push   %edx
+      e9:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+      ec:	e8 7f 13 00 00       	call   1470 <waitpoll>
+  profctl(0);
+      f1:	31 c0                	xor    %eax,%eax
+      f3:	89 04 24             	mov    %eax,(%esp)
+      f6:	e8 d4 0e 00 00       	call   fcf <profctl>
+  drain();
+      fb:	e8 10 02 00 00       	call   310 <drain>
+
+  other = unknown = 0;
+  for(i = 0; i < nsamp; i++){
+     100:	8b 35 e4 1e 00 00    	mov    0x1ee4,%esi
+     106:	83 c4 10             	add    $0x10,%esp
+     109:	85 f6                	test   %esi,%esi
+     10b:	0f 8e b1 01 00 00    	jle    2c2 <main+0x2c2>
+  other = unknown = 0;
+     111:	31 ff                	xor    %edi,%edi
+     113:	bb 00 1f 00 00       	mov    $0x1f00,%ebx
+  for(i = 0; i < nsamp; i++){
+     118:	31 c0                	xor    %eax,%eax
+  other = unknown = 0;
+     11a:	89 7d dc             	mov    %edi,-0x24(%ebp)
+     11d:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  for(i = 0; i < nsamp; i++){
+     120:	89 df                	mov    %ebx,%edi
+     122:	89 c3                	mov    %eax,%ebx
+     124:	eb 1b                	jmp    141 <main+0x141>
+    if(samp[i].user && samp[i].pid != pid){
+     126:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+      other++;
+      continue;
+    }
+    t = samp[i].user ? &utab : &ktab;
+     129:	b8 00 9f 01 00       	mov    $0x19f00,%eax
+    if(samp[i].user && samp[i].pid != pid){
+     12e:	39 4f 04             	cmp    %ecx,0x4(%edi)
+     131:	74 19                	je     14c <main+0x14c>
+      other++;
+     133:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+  for(i = 0; i < nsamp; i++){
+     137:	83 c3 01             	add    $0x1,%ebx
+     13a:	83 c7 0c             	add    $0xc,%edi
+     13d:	39 f3                	cmp    %esi,%ebx
+     13f:	74 2f                	je     170 <main+0x170>
+    if(samp[i].user && samp[i].pid != pid){
+     141:	80 7f 09 00          	cmpb   $0x0,0x9(%edi)
+     145:	75 df                	jne    126 <main+0x126>
+    t = samp[i].user ? &utab : &ktab;
+     147:	b8 20 1f 02 00       	mov    $0x21f20,%eax
+    if((s = lookup(t, samp[i].eip)) != 0)
+     14c:	83 ec 08             	sub    $0x8,%esp
+     14f:	ff 37                	push   (%edi)
+     151:	50                   	push   %eax
+     152:	e8 b9 05 00 00       	call   710 <lookup>
+     157:	83 c4 10             	add    $0x10,%esp
+     15a:	85 c0                	test   %eax,%eax
+     15c:	0f 84 31 01 00 00    	je     293 <main+0x293>
+  for(i = 0; i < nsamp; i++){
+     162:	83 c3 01             	add    $0x1,%ebx
+      s->hits++;
+     165:	83 40 04 01          	addl   $0x1,0x4(%eax)
+  for(i = 0; i < nsamp; i++){
+     169:	83 c7 0c             	add    $0xc,%edi
+     16c:	39 f3                	cmp    %esi,%ebx
+     16e:	75 d1                	jne    141 <main+0x141>
+    else
+      unknown++;
+  }
+
+  printf(1, "%d samples at %d Hz", nsamp, hz);
+     170:	ff 75 d8             	push   -0x28(%ebp)
+     173:	56                   	push   %esi
+     174:	68 bb 15 00 00       	push   $0x15bb
+     179:	6a 01                	push   $0x1
+     17b:	e8 30 0f 00 00       	call   10b0 <printf>
+  if(dropped)
+     180:	a1 e0 1e 00 00       	mov    0x1ee0,%eax
+     185:	83 c4 10             	add    $0x10,%esp
+     188:	85 c0                	test   %eax,%eax
+     18a:	0f 85 1c 01 00 00    	jne    2ac <main+0x2ac>
+    printf(1, ", %d more dropped", dropped);
+  printf(1, "; %d in other processes, %d unknown\n", other, unknown);
+     190:	ff 75 dc             	push   -0x24(%ebp)
+     193:	ff 75 e0             	push   -0x20(%ebp)
+     196:	68 1c 16 00 00       	push   $0x161c
+     19b:	6a 01                	push   $0x1
+     19d:	e8 0e 0f 00 00       	call   10b0 <printf>
+     1a2:	c7 45 e0 19 00 00 00 	movl   $0x19,-0x20(%ebp)
+     1a9:	83 c4 10             	add    $0x10,%esp
+     1ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(k = 0; k < NSHOW; k++){
+    best = 0;
+    bt = 0;
+    for(t = &ktab; t; t = (t == &ktab ? &utab : 0))
+     1b0:	c7 45 e4 02 00 00 00 	movl   $0x2,-0x1c(%ebp)
+    bt = 0;
+     1b7:	31 ff                	xor    %edi,%edi
+    for(t = &ktab; t; t = (t == &ktab ? &utab : 0))
+     1b9:	be 20 1f 02 00       	mov    $0x21f20,%esi
+    best = 0;
+     1be:	31 db                	xor    %ebx,%ebx
+      for(s = t->s; s < t->s + t->n; s++)
+     1c0:	8b 8e 04 80 00 00    	mov    0x8004(%esi),%ecx
+     1c6:	8d 46 04             	lea    0x4(%esi),%eax
+     1c9:	c1 e1 05             	shl    $0x5,%ecx
+     1cc:	01 c1                	add    %eax,%ecx
+     1ce:	39 c8                	cmp    %ecx,%eax
+     1d0:	73 21                	jae    1f3 <main+0x1f3>
+     1d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        if(s->hits > 0 && (best == 0 || s->hits > best->hits)){
+     1d8:	8b 50 04             	mov    0x4(%eax),%edx
+     1db:	85 d2                	test   %edx,%edx
+     1dd:	7e 0d                	jle    1ec <main+0x1ec>
+     1df:	85 db                	test   %ebx,%ebx
+     1e1:	74 05                	je     1e8 <main+0x1e8>
+     1e3:	3b 53 04             	cmp    0x4(%ebx),%edx
+     1e6:	7e 04                	jle    1ec <main+0x1ec>
+     1e8:	89 f7                	mov    %esi,%edi
+     1ea:	89 c3                	mov    %eax,%ebx
+      for(s = t->s; s < t->s + t->n; s++)
+     1ec:	83 c0 20             	add    $0x20,%eax
+     1ef:	39 c8                	cmp    %ecx,%eax
+     1f1:	72 e5                	jb     1d8 <main+0x1d8>
+    for(t = &ktab; t; t = (t == &ktab ? &utab : 0))
+     1f3:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+     1f7:	be 00 9f 01 00       	mov    $0x19f00,%esi
+     1fc:	0f 85 9e 00 00 00    	jne    2a0 <main+0x2a0>
+          best = s;
+          bt = t;
+        }
+    if(best == 0)
+     202:	85 db                	test   %ebx,%ebx
+     204:	74 38                	je     23e <main+0x23e>
+      break;
+    printf(1, "%d\t%d%%\t%s\t%s\n", best->hits,
+           best->hits * 100 / nsamp, bt->what, best->name);
+     206:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    printf(1, "%d\t%d%%\t%s\t%s\n", best->hits,
+     209:	83 ec 08             	sub    $0x8,%esp
+           best->hits * 100 / nsamp, bt->what, best->name);
+     20c:	8d 43 08             	lea    0x8(%ebx),%eax
+    printf(1, "%d\t%d%%\t%s\t%s\n", best->hits,
+     20f:	50                   	push   %eax
+           best->hits * 100 / nsamp, bt->what, best->name);
+     210:	6b c1 64             	imul   $0x64,%ecx,%eax
+    printf(1, "%d\t%d%%\t%s\t%s\n", best->hits,
+     213:	ff 37                	push   (%edi)
+     215:	99                   	cltd
+     216:	f7 3d e4 1e 00 00    	idivl  0x1ee4
+     21c:	50                   	push   %eax
+     21d:	51                   	push   %ecx
+     21e:	68 e1 15 00 00       	push   $0x15e1
+     223:	6a 01                	push   $0x1
+     225:	e8 86 0e 00 00       	call   10b0 <printf>
+  for(k = 0; k < NSHOW; k++){
+     22a:	83 c4 20             	add    $0x20,%esp
+     22d:	83 6d e0 01          	subl   $0x1,-0x20(%ebp)
+    best->hits = 0;
+     231:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  for(k = 0; k < NSHOW; k++){
+     238:	0f 85 72 ff ff ff    	jne    1b0 <main+0x1b0>
+  }
+  exit();
+     23e:	e8 bd 07 00 00       	call   a00 <exit>
+    exec(argv[i], argv + i);
+     243:	50                   	push   %eax
+     244:	50                   	push   %eax
+     245:	53                   	push   %ebx
+     246:	ff 33                	push   (%ebx)
+     248:	e8 c3 07 00 00       	call   a10 <exec>
+    printf(2, "profile: exec %s failed\n", argv[i]);
+     24d:	83 c4 0c             	add    $0xc,%esp
+     250:	ff 33                	push   (%ebx)
+     252:	68 a2 15 00 00       	push   $0x15a2
+     257:	6a 02                	push   $0x2
+     259:	e8 52 0e 00 00       	call   10b0 <printf>
+    exit();
+     25e:	e8 9d 07 00 00       	call   a00 <exit>
+    printf(2, "profile: fork failed\n");
+     263:	50                   	push   %eax
+     264:	50                   	push   %eax
+     265:	68 8c 15 00 00       	push   $0x158c
+     26a:	6a 02                	push   $0x2
+     26c:	e8 3f 0e 00 00       	call   10b0 <printf>
+    exit();
+     271:	e8 8a 07 00 00       	call   a00 <exit>
+    hz = atoi(argv[2]);
+     276:	83 ec 0c             	sub    $0xc,%esp
+     279:	ff 72 08             	push   0x8(%edx)
+    i = 3;
+     27c:	be 03 00 00 00       	mov    $0x3,%esi
+    hz = atoi(argv[2]);
+     281:	e8 da 0a 00 00       	call   d60 <atoi>
+    i = 3;
+     286:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    hz = atoi(argv[2]);
+     289:	83 c4 10             	add    $0x10,%esp
+     28c:	89 c7                	mov    %eax,%edi
+    i = 3;
+     28e:	e9 95 fd ff ff       	jmp    28 <main+0x28>
+      unknown++;
+     293:	83 45 dc 01          	addl   $0x1,-0x24(%ebp)
+     297:	e9 9b fe ff ff       	jmp    137 <main+0x137>
+     29c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2a0:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+     2a7:	e9 14 ff ff ff       	jmp    1c0 <main+0x1c0>
+    printf(1, ", %d more dropped", dropped);
+     2ac:	52                   	push   %edx
+     2ad:	50                   	push   %eax
+     2ae:	68 cf 15 00 00       	push   $0x15cf
+     2b3:	6a 01                	push   $0x1
+     2b5:	e8 f6 0d 00 00       	call   10b0 <printf>
+     2ba:	83 c4 10             	add    $0x10,%esp
+     2bd:	e9 ce fe ff ff       	jmp    190 <main+0x190>
+  other = unknown = 0;
+     2c2:	31 c9                	xor    %ecx,%ecx
+     2c4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+     2c7:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     2ca:	e9 a1 fe ff ff       	jmp    170 <main+0x170>
+     2cf:	90                   	nop
+
+000002d0 <drain.part.0>:
+drain(void)
+     2d0:	55                   	push   %ebp
+     2d1:	89 e5                	mov    %esp,%ebp
+     2d3:	53                   	push   %ebx
+     2d4:	8d 9d f8 fc ff ff    	lea    -0x308(%ebp),%ebx
+     2da:	81 ec 04 03 00 00    	sub    $0x304,%esp
+     2e0:	eb 0c                	jmp    2ee <drain.part.0+0x1e>
+     2e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      dropped += n;
+     2e8:	01 05 e0 1e 00 00    	add    %eax,0x1ee0
+    while((n = profread(tmp, 64)) > 0)
+     2ee:	83 ec 08             	sub    $0x8,%esp
+     2f1:	6a 40                	push   $0x40
+     2f3:	53                   	push   %ebx
+     2f4:	e8 e0 0c 00 00       	call   fd9 <profread>
+     2f9:	83 c4 10             	add    $0x10,%esp
+     2fc:	85 c0                	test   %eax,%eax
+     2fe:	7f e8                	jg     2e8 <drain.part.0+0x18>
+}
+     300:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     303:	c9                   	leave
+     304:	c3                   	ret
+     305:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <drain>:
+{
+     310:	55                   	push   %ebp
+     311:	89 e5                	mov    %esp,%ebp
+     313:	53                   	push   %ebx
+  while((n = profread(samp + nsamp, MAXSAMP - nsamp)) > 0)
+     314:	bb 00 20 00 00       	mov    $0x2000,%ebx
+{
+     319:	83 ec 04             	sub    $0x4,%esp
+  while((n = profread(samp + nsamp, MAXSAMP - nsamp)) > 0)
+     31c:	a1 e4 1e 00 00       	mov    0x1ee4,%eax
+     321:	eb 10                	jmp    333 <drain+0x23>
+     323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     327:	90                   	nop
+    nsamp += n;
+     328:	03 05 e4 1e 00 00    	add    0x1ee4,%eax
+     32e:	a3 e4 1e 00 00       	mov    %eax,0x1ee4
+  while((n = profread(samp + nsamp, MAXSAMP - nsamp)) > 0)
+     333:	89 da                	mov    %ebx,%edx
+     335:	83 ec 08             	sub    $0x8,%esp
+     338:	29 c2                	sub    %eax,%edx
+     33a:	8d 04 40             	lea    (%eax,%eax,2),%eax
+     33d:	8d 04 85 00 1f 00 00 	lea    0x1f00(,%eax,4),%eax
+     344:	52                   	push   %edx
+     345:	50                   	push   %eax
+     346:	e8 8e 0c 00 00       	call   fd9 <profread>
+     34b:	83 c4 10             	add    $0x10,%esp
+     34e:	85 c0                	test   %eax,%eax
+     350:	7f d6                	jg     328 <drain+0x18>
+  if(nsamp == MAXSAMP){
+     352:	81 3d e4 1e 00 00 00 	cmpl   $0x2000,0x1ee4
+     359:	20 00 00 
+     35c:	74 0a                	je     368 <drain+0x58>
+}
+     35e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     361:	c9                   	leave
+     362:	c3                   	ret
+     363:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     367:	90                   	nop
+     368:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     36b:	c9                   	leave
+     36c:	e9 5f ff ff ff       	jmp    2d0 <drain.part.0>
+     371:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     378:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     37f:	90                   	nop
+
+00000380 <getline>:
+{
+     380:	55                   	push   %ebp
+     381:	89 e5                	mov    %esp,%ebp
+     383:	56                   	push   %esi
+     384:	53                   	push   %ebx
+  i = 0;
+     385:	31 db                	xor    %ebx,%ebx
+{
+     387:	8b 75 08             	mov    0x8(%ebp),%esi
+    if(rpos == rlen){
+     38a:	a1 44 1c 00 00       	mov    0x1c44,%eax
+     38f:	eb 2b                	jmp    3bc <getline+0x3c>
+     391:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      rpos++;
+     398:	89 c2                	mov    %eax,%edx
+     39a:	83 c0 01             	add    $0x1,%eax
+    if(rbuf[rpos] == '\n'){
+     39d:	0f b6 92 60 1c 00 00 	movzbl 0x1c60(%edx),%edx
+     3a4:	80 fa 0a             	cmp    $0xa,%dl
+     3a7:	74 57                	je     400 <getline+0x80>
+    if(i < sizeof(linebuf) - 1)
+     3a9:	83 fb 7e             	cmp    $0x7e,%ebx
+     3ac:	7f 09                	jg     3b7 <getline+0x37>
+      linebuf[i++] = rbuf[rpos];
+     3ae:	88 93 60 1e 00 00    	mov    %dl,0x1e60(%ebx)
+     3b4:	83 c3 01             	add    $0x1,%ebx
+    rpos++;
+     3b7:	a3 44 1c 00 00       	mov    %eax,0x1c44
+    if(rpos == rlen){
+     3bc:	39 05 40 1c 00 00    	cmp    %eax,0x1c40
+     3c2:	75 d4                	jne    398 <getline+0x18>
+      if((rlen = read(fd, rbuf, sizeof(rbuf))) <= 0)
+     3c4:	83 ec 04             	sub    $0x4,%esp
+     3c7:	68 00 02 00 00       	push   $0x200
+     3cc:	68 60 1c 00 00       	push   $0x1c60
+     3d1:	56                   	push   %esi
+     3d2:	e8 4f 0a 00 00       	call   e26 <read>
+     3d7:	83 c4 10             	add    $0x10,%esp
+     3da:	a3 40 1c 00 00       	mov    %eax,0x1c40
+     3df:	85 c0                	test   %eax,%eax
+     3e1:	7e 22                	jle    405 <getline+0x85>
+     3e3:	31 d2                	xor    %edx,%edx
+    if(rbuf[rpos] == '\n'){
+     3e5:	b8 01 00 00 00       	mov    $0x1,%eax
+     3ea:	0f b6 92 60 1c 00 00 	movzbl 0x1c60(%edx),%edx
+     3f1:	80 fa 0a             	cmp    $0xa,%dl
+     3f4:	75 b3                	jne    3a9 <getline+0x29>
+     3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3fd:	8d 76 00             	lea    0x0(%esi),%esi
+      rpos++;
+     400:	a3 44 1c 00 00       	mov    %eax,0x1c44
+  linebuf[i] = 0;
+     405:	c6 83 60 1e 00 00 00 	movb   $0x0,0x1e60(%ebx)
+  return i > 0 || rlen > 0;
+     40c:	b8 01 00 00 00       	mov    $0x1,%eax
+     411:	85 db                	test   %ebx,%ebx
+     413:	75 0d                	jne    422 <getline+0xa2>
+     415:	8b 15 40 1c 00 00    	mov    0x1c40,%edx
+     41b:	31 c0                	xor    %eax,%eax
+     41d:	85 d2                	test   %edx,%edx
+     41f:	0f 9f c0             	setg   %al
+}
+     422:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     425:	5b                   	pop    %ebx
+     426:	5e                   	pop    %esi
+     427:	5d                   	pop    %ebp
+     428:	c3                   	ret
+     429:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000430 <hex>:
+{
+     430:	55                   	push   %ebp
+  for(x = 0; ; s++){
+     431:	31 c0                	xor    %eax,%eax
+{
+     433:	89 e5                	mov    %esp,%ebp
+     435:	53                   	push   %ebx
+     436:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     439:	eb 0f                	jmp    44a <hex+0x1a>
+     43b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     43f:	90                   	nop
+      x = x*16 + *s - '0';
+     440:	c1 e0 04             	shl    $0x4,%eax
+     443:	8d 44 10 d0          	lea    -0x30(%eax,%edx,1),%eax
+  for(x = 0; ; s++){
+     447:	83 c1 01             	add    $0x1,%ecx
+    if(*s >= '0' && *s <= '9')
+     44a:	0f be 11             	movsbl (%ecx),%edx
+     44d:	8d 5a d0             	lea    -0x30(%edx),%ebx
+     450:	80 fb 09             	cmp    $0x9,%bl
+     453:	76 eb                	jbe    440 <hex+0x10>
+    else if(*s >= 'a' && *s <= 'f')
+     455:	8d 5a 9f             	lea    -0x61(%edx),%ebx
+     458:	80 fb 05             	cmp    $0x5,%bl
+     45b:	77 13                	ja     470 <hex+0x40>
+      x = x*16 + *s - 'a' + 10;
+     45d:	c1 e0 04             	shl    $0x4,%eax
+     460:	8d 44 10 a9          	lea    -0x57(%eax,%edx,1),%eax
+     464:	eb e1                	jmp    447 <hex+0x17>
+     466:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     46d:	8d 76 00             	lea    0x0(%esi),%esi
+}
+     470:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     473:	c9                   	leave
+     474:	c3                   	ret
+     475:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     47c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <loadsyms>:
+{
+     480:	55                   	push   %ebp
+     481:	89 e5                	mov    %esp,%ebp
+     483:	57                   	push   %edi
+     484:	56                   	push   %esi
+     485:	31 f6                	xor    %esi,%esi
+     487:	53                   	push   %ebx
+     488:	83 ec 44             	sub    $0x44,%esp
+  if((fd = open("/syms", O_RDONLY)) < 0){
+     48b:	6a 00                	push   $0x0
+     48d:	68 60 15 00 00       	push   $0x1560
+     492:	e8 b2 09 00 00       	call   e49 <open>
+     497:	83 c4 10             	add    $0x10,%esp
+     49a:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     49d:	85 c0                	test   %eax,%eax
+     49f:	0f 88 4b 02 00 00    	js     6f0 <loadsyms+0x270>
+     4a5:	8d 76 00             	lea    0x0(%esi),%esi
+  while(getline(fd)){
+     4a8:	83 ec 0c             	sub    $0xc,%esp
+     4ab:	ff 75 c4             	push   -0x3c(%ebp)
+     4ae:	e8 cd fe ff ff       	call   380 <getline>
+     4b3:	83 c4 10             	add    $0x10,%esp
+     4b6:	85 c0                	test   %eax,%eax
+     4b8:	0f 84 0f 01 00 00    	je     5cd <loadsyms+0x14d>
+    if(linebuf[0] == '='){
+     4be:	80 3d 60 1e 00 00 3d 	cmpb   $0x3d,0x1e60
+     4c5:	0f 84 b9 00 00 00    	je     584 <loadsyms+0x104>
+    if(t == 0 || t->n == MAXSYM || (p = strchr(linebuf, ' ')) == 0)
+     4cb:	85 f6                	test   %esi,%esi
+     4cd:	0f 84 f3 00 00 00    	je     5c6 <loadsyms+0x146>
+     4d3:	81 be 04 80 00 00 00 	cmpl   $0x400,0x8004(%esi)
+     4da:	04 00 00 
+     4dd:	74 c9                	je     4a8 <loadsyms+0x28>
+     4df:	83 ec 08             	sub    $0x8,%esp
+     4e2:	6a 20                	push   $0x20
+     4e4:	68 60 1e 00 00       	push   $0x1e60
+     4e9:	e8 d2 06 00 00       	call   bc0 <strchr>
+     4ee:	83 c4 10             	add    $0x10,%esp
+     4f1:	89 c7                	mov    %eax,%edi
+     4f3:	85 c0                	test   %eax,%eax
+     4f5:	74 b1                	je     4a8 <loadsyms+0x28>
+    s = &t->s[t->n++];
+     4f7:	8b 86 04 80 00 00    	mov    0x8004(%esi),%eax
+     4fd:	b9 60 1e 00 00       	mov    $0x1e60,%ecx
+     502:	8d 50 01             	lea    0x1(%eax),%edx
+     505:	89 45 c0             	mov    %eax,-0x40(%ebp)
+     508:	89 96 04 80 00 00    	mov    %edx,0x8004(%esi)
+  for(x = 0; ; s++){
+     50e:	31 d2                	xor    %edx,%edx
+     510:	eb 10                	jmp    522 <loadsyms+0xa2>
+     512:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      x = x*16 + *s - '0';
+     518:	c1 e2 04             	shl    $0x4,%edx
+     51b:	8d 54 02 d0          	lea    -0x30(%edx,%eax,1),%edx
+  for(x = 0; ; s++){
+     51f:	83 c1 01             	add    $0x1,%ecx
+    if(*s >= '0' && *s <= '9')
+     522:	0f be 01             	movsbl (%ecx),%eax
+     525:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     528:	80 fb 09             	cmp    $0x9,%bl
+     52b:	76 eb                	jbe    518 <loadsyms+0x98>
+    else if(*s >= 'a' && *s <= 'f')
+     52d:	8d 58 9f             	lea    -0x61(%eax),%ebx
+     530:	80 fb 05             	cmp    $0x5,%bl
+     533:	77 09                	ja     53e <loadsyms+0xbe>
+      x = x*16 + *s - 'a' + 10;
+     535:	c1 e2 04             	shl    $0x4,%edx
+     538:	8d 54 02 a9          	lea    -0x57(%edx,%eax,1),%edx
+     53c:	eb e1                	jmp    51f <loadsyms+0x9f>
+    s->addr = hex(linebuf);
+     53e:	8b 45 c0             	mov    -0x40(%ebp),%eax
+     541:	89 c1                	mov    %eax,%ecx
+     543:	c1 e1 05             	shl    $0x5,%ecx
+     546:	01 f1                	add    %esi,%ecx
+     548:	89 51 04             	mov    %edx,0x4(%ecx)
+    for(i = 0; p[i+1] && i < sizeof(s->name) - 1; i++)
+     54b:	0f b6 5f 01          	movzbl 0x1(%edi),%ebx
+     54f:	31 d2                	xor    %edx,%edx
+     551:	84 db                	test   %bl,%bl
+     553:	75 10                	jne    565 <loadsyms+0xe5>
+     555:	eb 1e                	jmp    575 <loadsyms+0xf5>
+     557:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     55e:	66 90                	xchg   %ax,%ax
+     560:	83 fa 17             	cmp    $0x17,%edx
+     563:	74 10                	je     575 <loadsyms+0xf5>
+      s->name[i] = p[i+1];
+     565:	88 5c 11 0c          	mov    %bl,0xc(%ecx,%edx,1)
+    for(i = 0; p[i+1] && i < sizeof(s->name) - 1; i++)
+     569:	83 c2 01             	add    $0x1,%edx
+     56c:	0f b6 5c 17 01       	movzbl 0x1(%edi,%edx,1),%ebx
+     571:	84 db                	test   %bl,%bl
+     573:	75 eb                	jne    560 <loadsyms+0xe0>
+    s->name[i] = 0;
+     575:	c1 e0 05             	shl    $0x5,%eax
+     578:	01 f0                	add    %esi,%eax
+     57a:	c6 44 02 0c 00       	movb   $0x0,0xc(%edx,%eax,1)
+     57f:	e9 24 ff ff ff       	jmp    4a8 <loadsyms+0x28>
+      if(strcmp(linebuf + 2, "kernel") == 0)
+     584:	83 ec 08             	sub    $0x8,%esp
+        t = &ktab;
+     587:	be 20 1f 02 00       	mov    $0x21f20,%esi
+      if(strcmp(linebuf + 2, "kernel") == 0)
+     58c:	68 82 15 00 00       	push   $0x1582
+     591:	68 62 1e 00 00       	push   $0x1e62
+     596:	e8 75 05 00 00       	call   b10 <strcmp>
+     59b:	83 c4 10             	add    $0x10,%esp
+     59e:	85 c0                	test   %eax,%eax
+     5a0:	0f 84 02 ff ff ff    	je     4a8 <loadsyms+0x28>
+      else if(strcmp(linebuf + 2, prog) == 0)
+     5a6:	83 ec 08             	sub    $0x8,%esp
+     5a9:	ff 75 08             	push   0x8(%ebp)
+        t = &utab;
+     5ac:	be 00 9f 01 00       	mov    $0x19f00,%esi
+      else if(strcmp(linebuf + 2, prog) == 0)
+     5b1:	68 62 1e 00 00       	push   $0x1e62
+     5b6:	e8 55 05 00 00       	call   b10 <strcmp>
+     5bb:	83 c4 10             	add    $0x10,%esp
+     5be:	85 c0                	test   %eax,%eax
+     5c0:	0f 84 e2 fe ff ff    	je     4a8 <loadsyms+0x28>
+        t = 0;
+     5c6:	31 f6                	xor    %esi,%esi
+     5c8:	e9 db fe ff ff       	jmp    4a8 <loadsyms+0x28>
+  close(fd);
+     5cd:	83 ec 0c             	sub    $0xc,%esp
+     5d0:	ff 75 c4             	push   -0x3c(%ebp)
+     5d3:	bb 02 00 00 00       	mov    $0x2,%ebx
+  for(t = &ktab; t; t = (t == &ktab ? &utab : 0)){
+     5d8:	bf 20 1f 02 00       	mov    $0x21f20,%edi
+  close(fd);
+     5dd:	e8 8e 04 00 00       	call   a70 <close>
+  for(t = &ktab; t; t = (t == &ktab ? &utab : 0)){
+     5e2:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+  close(fd);
+     5e5:	83 c4 10             	add    $0x10,%esp
+    for(i = 1; i < t->n; i++){
+     5e8:	8b 87 04 80 00 00    	mov    0x8004(%edi),%eax
+     5ee:	be 01 00 00 00       	mov    $0x1,%esi
+     5f3:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     5f6:	83 f8 01             	cmp    $0x1,%eax
+     5f9:	0f 8e cd 00 00 00    	jle    6cc <loadsyms+0x24c>
+     5ff:	90                   	nop
+      tmp = t->s[i];
+     600:	89 f0                	mov    %esi,%eax
+     602:	89 f1                	mov    %esi,%ecx
+     604:	c1 e0 05             	shl    $0x5,%eax
+     607:	8b 54 07 08          	mov    0x8(%edi,%eax,1),%edx
+     60b:	8b 5c 07 04          	mov    0x4(%edi,%eax,1),%ebx
+     60f:	89 55 cc             	mov    %edx,-0x34(%ebp)
+     612:	8b 54 07 0c          	mov    0xc(%edi,%eax,1),%edx
+     616:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+     619:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     61c:	8b 54 07 10          	mov    0x10(%edi,%eax,1),%edx
+     620:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     623:	8b 54 07 14          	mov    0x14(%edi,%eax,1),%edx
+     627:	89 55 d8             	mov    %edx,-0x28(%ebp)
+     62a:	8b 54 07 18          	mov    0x18(%edi,%eax,1),%edx
+     62e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+     631:	8b 54 07 1c          	mov    0x1c(%edi,%eax,1),%edx
+     635:	89 55 e0             	mov    %edx,-0x20(%ebp)
+     638:	8b 54 07 20          	mov    0x20(%edi,%eax,1),%edx
+     63c:	01 f8                	add    %edi,%eax
+     63e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+      for(j = i; j > 0 && t->s[j-1].addr > tmp.addr; j--)
+     641:	eb 3c                	jmp    67f <loadsyms+0x1ff>
+     643:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     647:	90                   	nop
+        t->s[j] = t->s[j-1];
+     648:	8b 50 e4             	mov    -0x1c(%eax),%edx
+      for(j = i; j > 0 && t->s[j-1].addr > tmp.addr; j--)
+     64b:	83 e8 20             	sub    $0x20,%eax
+        t->s[j] = t->s[j-1];
+     64e:	89 50 24             	mov    %edx,0x24(%eax)
+     651:	8b 50 08             	mov    0x8(%eax),%edx
+     654:	89 50 28             	mov    %edx,0x28(%eax)
+     657:	8b 50 0c             	mov    0xc(%eax),%edx
+     65a:	89 50 2c             	mov    %edx,0x2c(%eax)
+     65d:	8b 50 10             	mov    0x10(%eax),%edx
+     660:	89 50 30             	mov    %edx,0x30(%eax)
+     663:	8b 50 14             	mov    0x14(%eax),%edx
+     666:	89 50 34             	mov    %edx,0x34(%eax)
+     669:	8b 50 18             	mov    0x18(%eax),%edx
+     66c:	89 50 38             	mov    %edx,0x38(%eax)
+     66f:	8b 50 1c             	mov    0x1c(%eax),%edx
+     672:	89 50 3c             	mov    %edx,0x3c(%eax)
+     675:	8b 50 20             	mov    0x20(%eax),%edx
+     678:	89 50 40             	mov    %edx,0x40(%eax)
+      for(j = i; j > 0 && t->s[j-1].addr > tmp.addr; j--)
+     67b:	85 c9                	test   %ecx,%ecx
+     67d:	74 61                	je     6e0 <loadsyms+0x260>
+     67f:	89 ca                	mov    %ecx,%edx
+     681:	8d 49 ff             	lea    -0x1(%ecx),%ecx
+     684:	3b 58 e4             	cmp    -0x1c(%eax),%ebx
+     687:	72 bf                	jb     648 <loadsyms+0x1c8>
+      t->s[j] = tmp;
+     689:	8b 45 c8             	mov    -0x38(%ebp),%eax
+     68c:	c1 e2 05             	shl    $0x5,%edx
+    for(i = 1; i < t->n; i++){
+     68f:	83 c6 01             	add    $0x1,%esi
+      t->s[j] = tmp;
+     692:	01 fa                	add    %edi,%edx
+     694:	89 42 04             	mov    %eax,0x4(%edx)
+     697:	8b 45 cc             	mov    -0x34(%ebp),%eax
+     69a:	89 42 08             	mov    %eax,0x8(%edx)
+     69d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     6a0:	89 42 0c             	mov    %eax,0xc(%edx)
+     6a3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     6a6:	89 42 10             	mov    %eax,0x10(%edx)
+     6a9:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     6ac:	89 42 14             	mov    %eax,0x14(%edx)
+     6af:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     6b2:	89 42 18             	mov    %eax,0x18(%edx)
+     6b5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     6b8:	89 42 1c             	mov    %eax,0x1c(%edx)
+     6bb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     6be:	89 42 20             	mov    %eax,0x20(%edx)
+    for(i = 1; i < t->n; i++){
+     6c1:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     6c4:	39 c6                	cmp    %eax,%esi
+     6c6:	0f 85 34 ff ff ff    	jne    600 <loadsyms+0x180>
+  for(t = &ktab; t; t = (t == &ktab ? &utab : 0)){
+     6cc:	83 7d c0 01          	cmpl   $0x1,-0x40(%ebp)
+     6d0:	bf 00 9f 01 00       	mov    $0x19f00,%edi
+     6d5:	75 0d                	jne    6e4 <loadsyms+0x264>
+}
+     6d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6da:	5b                   	pop    %ebx
+     6db:	5e                   	pop    %esi
+     6dc:	5f                   	pop    %edi
+     6dd:	5d                   	pop    %ebp
+     6de:	c3                   	ret
+     6df:	90                   	nop
+     6e0:	31 d2                	xor    %edx,%edx
+     6e2:	eb a5                	jmp    689 <loadsyms+0x209>
+     6e4:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+     6eb:	e9 f8 fe ff ff       	jmp    5e8 <loadsyms+0x168>
+    printf(2, "profile: cannot open /syms\n");
+     6f0:	83 ec 08             	sub    $0x8,%esp
+     6f3:	68 66 15 00 00       	push   $0x1566
+     6f8:	6a 02                	push   $0x2
+     6fa:	e8 b1 09 00 00       	call   10b0 <printf>
+     6ff:	83 c4 10             	add    $0x10,%esp
+}
+     702:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     705:	5b                   	pop    %ebx
+     706:	5e                   	pop    %esi
+     707:	5f                   	pop    %edi
+     708:	5d                   	pop    %ebp
+     709:	c3                   	ret
+     70a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000710 <lookup>:
+{
+     710:	55                   	push   %ebp
+  lo = 0;
+     711:	31 c9                	xor    %ecx,%ecx
+{
+     713:	89 e5                	mov    %esp,%ebp
+     715:	57                   	push   %edi
+     716:	56                   	push   %esi
+     717:	53                   	push   %ebx
+     718:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     71b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  hi = t->n;
+     71e:	8b 93 04 80 00 00    	mov    0x8004(%ebx),%edx
+  while(lo < hi){
+     724:	eb 1c                	jmp    742 <lookup+0x32>
+     726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     72d:	8d 76 00             	lea    0x0(%esi),%esi
+    mid = (lo + hi) / 2;
+     730:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+     733:	d1 f8                	sar    %eax
+    if(t->s[mid].addr <= addr)
+     735:	89 c7                	mov    %eax,%edi
+     737:	c1 e7 05             	shl    $0x5,%edi
+     73a:	3b 74 3b 04          	cmp    0x4(%ebx,%edi,1),%esi
+     73e:	73 20                	jae    760 <lookup+0x50>
+    mid = (lo + hi) / 2;
+     740:	89 c2                	mov    %eax,%edx
+  while(lo < hi){
+     742:	39 ca                	cmp    %ecx,%edx
+     744:	7f ea                	jg     730 <lookup+0x20>
+  return lo > 0 ? &t->s[lo-1] : 0;
+     746:	31 c0                	xor    %eax,%eax
+     748:	85 c9                	test   %ecx,%ecx
+     74a:	74 07                	je     753 <lookup+0x43>
+     74c:	c1 e1 05             	shl    $0x5,%ecx
+     74f:	8d 44 0b e4          	lea    -0x1c(%ebx,%ecx,1),%eax
+}
+     753:	5b                   	pop    %ebx
+     754:	5e                   	pop    %esi
+     755:	5f                   	pop    %edi
+     756:	5d                   	pop    %ebp
+     757:	c3                   	ret
+     758:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     75f:	90                   	nop
+      lo = mid + 1;
+     760:	8d 48 01             	lea    0x1(%eax),%ecx
+     763:	eb dd                	jmp    742 <lookup+0x32>
+     765:	66 90                	xchg   %ax,%ax
+     767:	66 90                	xchg   %ax,%ax
+     769:	66 90                	xchg   %ax,%ax
+     76b:	66 90                	xchg   %ax,%ax
+     76d:	66 90                	xchg   %ax,%ax
+     76f:	90                   	nop
+
+00000770 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+     770:	55                   	push   %ebp
+     771:	89 e5                	mov    %esp,%ebp
+     773:	57                   	push   %edi
+     774:	56                   	push   %esi
+     775:	53                   	push   %ebx
+     776:	83 ec 4c             	sub    $0x4c,%esp
+     779:	8b 45 0c             	mov    0xc(%ebp),%eax
+     77c:	8b 55 08             	mov    0x8(%ebp),%edx
+     77f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     782:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+     785:	83 fa 0f             	cmp    $0xf,%edx
+     788:	0f 87 32 01 00 00    	ja     8c0 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+     78e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     794:	8b 80 40 9f 02 00    	mov    0x29f40(%eax),%eax
+     79a:	85 c0                	test   %eax,%eax
+     79c:	0f 84 de 00 00 00    	je     880 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+     7a2:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     7a8:	8b b0 44 9f 02 00    	mov    0x29f44(%eax),%esi
+     7ae:	8d 88 40 9f 02 00    	lea    0x29f40(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+     7b4:	8d b8 48 9f 02 00    	lea    0x29f48(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+     7ba:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+     7bd:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+     7c0:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+     7c3:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+     7c9:	0f 8f 01 01 00 00    	jg     8d0 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+     7cf:	8d 78 08             	lea    0x8(%eax),%edi
+     7d2:	8d bc 3e 40 9f 02 00 	lea    0x29f40(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     7d9:	85 db                	test   %ebx,%ebx
+     7db:	7e 3b                	jle    818 <bufwrite+0xa8>
+     7dd:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+     7e0:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+     7e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7e7:	90                   	nop
+    *dst++ = *src++;
+     7e8:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     7e9:	39 c6                	cmp    %eax,%esi
+     7eb:	75 fb                	jne    7e8 <bufwrite+0x78>
+  ob[fd].n += n;
+     7ed:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     7f3:	8b 88 44 9f 02 00    	mov    0x29f44(%eax),%ecx
+     7f9:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     7fb:	83 b8 40 9f 02 00 01 	cmpl   $0x1,0x29f40(%eax)
+  ob[fd].n += n;
+     802:	89 88 44 9f 02 00    	mov    %ecx,0x29f44(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     808:	74 26                	je     830 <bufwrite+0xc0>
+}
+     80a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     80d:	5b                   	pop    %ebx
+     80e:	5e                   	pop    %esi
+     80f:	5f                   	pop    %edi
+     810:	5d                   	pop    %ebp
+     811:	c3                   	ret
+     812:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+     818:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     81b:	83 b8 40 9f 02 00 01 	cmpl   $0x1,0x29f40(%eax)
+  ob[fd].n += n;
+     822:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     825:	75 e3                	jne    80a <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+     827:	85 db                	test   %ebx,%ebx
+     829:	74 df                	je     80a <bufwrite+0x9a>
+     82b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     82f:	90                   	nop
+  src = vsrc;
+     830:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     833:	01 c3                	add    %eax,%ebx
+     835:	eb 10                	jmp    847 <bufwrite+0xd7>
+     837:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     83e:	66 90                	xchg   %ax,%ax
+     840:	83 c0 01             	add    $0x1,%eax
+     843:	39 d8                	cmp    %ebx,%eax
+     845:	74 c3                	je     80a <bufwrite+0x9a>
+    if(*p == (char)c)
+     847:	80 38 0a             	cmpb   $0xa,(%eax)
+     84a:	75 f4                	jne    840 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     84c:	85 c9                	test   %ecx,%ecx
+     84e:	7e ba                	jle    80a <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+     850:	83 ec 04             	sub    $0x4,%esp
+     853:	51                   	push   %ecx
+     854:	ff 75 ac             	push   -0x54(%ebp)
+     857:	52                   	push   %edx
+     858:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+     85b:	e8 cd 05 00 00       	call   e2d <write>
+    ob[fd].n = 0;
+     860:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     863:	83 c4 10             	add    $0x10,%esp
+     866:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+     86c:	c7 82 44 9f 02 00 00 	movl   $0x0,0x29f44(%edx)
+     873:	00 00 00 
+     876:	eb 92                	jmp    80a <bufwrite+0x9a>
+     878:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     87f:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     880:	83 ec 08             	sub    $0x8,%esp
+     883:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     886:	50                   	push   %eax
+     887:	52                   	push   %edx
+     888:	89 55 b0             	mov    %edx,-0x50(%ebp)
+     88b:	e8 d7 05 00 00       	call   e67 <fstat>
+     890:	83 c4 10             	add    $0x10,%esp
+     893:	8b 55 b0             	mov    -0x50(%ebp),%edx
+     896:	89 c1                	mov    %eax,%ecx
+     898:	b8 02 00 00 00       	mov    $0x2,%eax
+     89d:	85 c9                	test   %ecx,%ecx
+     89f:	75 0d                	jne    8ae <bufwrite+0x13e>
+     8a1:	31 c0                	xor    %eax,%eax
+     8a3:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     8a8:	0f 95 c0             	setne  %al
+     8ab:	83 c0 01             	add    $0x1,%eax
+     8ae:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+     8b4:	89 81 40 9f 02 00    	mov    %eax,0x29f40(%ecx)
+     8ba:	e9 e3 fe ff ff       	jmp    7a2 <bufwrite+0x32>
+     8bf:	90                   	nop
+}
+     8c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8c3:	5b                   	pop    %ebx
+     8c4:	5e                   	pop    %esi
+     8c5:	5f                   	pop    %edi
+     8c6:	5d                   	pop    %ebp
+    write(fd, p, n);
+     8c7:	e9 61 05 00 00       	jmp    e2d <write>
+     8cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+     8d0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+     8d3:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+     8d6:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+     8d9:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+     8dc:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+     8df:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+     8e2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+     8e5:	6a 02                	push   $0x2
+     8e7:	50                   	push   %eax
+     8e8:	52                   	push   %edx
+     8e9:	e8 9b 06 00 00       	call   f89 <writev>
+    ob[fd].n = 0;
+     8ee:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+     8f1:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+     8f4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+     8fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8fe:	5b                   	pop    %ebx
+     8ff:	5e                   	pop    %esi
+     900:	5f                   	pop    %edi
+     901:	5d                   	pop    %ebp
+     902:	c3                   	ret
+     903:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     90a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000910 <fflush>:
+{
+     910:	55                   	push   %ebp
+     911:	89 e5                	mov    %esp,%ebp
+     913:	53                   	push   %ebx
+     914:	83 ec 04             	sub    $0x4,%esp
+     917:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     91a:	83 f8 0f             	cmp    $0xf,%eax
+     91d:	77 16                	ja     935 <fflush+0x25>
+     91f:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+     925:	8b 8a 44 9f 02 00    	mov    0x29f44(%edx),%ecx
+     92b:	8d 9a 40 9f 02 00    	lea    0x29f40(%edx),%ebx
+     931:	85 c9                	test   %ecx,%ecx
+     933:	7f 0b                	jg     940 <fflush+0x30>
+}
+     935:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     938:	c9                   	leave
+     939:	c3                   	ret
+     93a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     940:	83 ec 04             	sub    $0x4,%esp
+     943:	81 c2 48 9f 02 00    	add    $0x29f48,%edx
+     949:	51                   	push   %ecx
+     94a:	52                   	push   %edx
+     94b:	50                   	push   %eax
+     94c:	e8 dc 04 00 00       	call   e2d <write>
+    ob[fd].n = 0;
+     951:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     958:	83 c4 10             	add    $0x10,%esp
+}
+     95b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     95e:	c9                   	leave
+     95f:	c3                   	ret
+
+00000960 <fflushall>:
+{
+     960:	55                   	push   %ebp
+     961:	89 e5                	mov    %esp,%ebp
+     963:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     964:	31 f6                	xor    %esi,%esi
+{
+     966:	53                   	push   %ebx
+     967:	bb 48 9f 02 00       	mov    $0x29f48,%ebx
+     96c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     970:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     973:	85 c0                	test   %eax,%eax
+     975:	7e 15                	jle    98c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     977:	83 ec 04             	sub    $0x4,%esp
+     97a:	50                   	push   %eax
+     97b:	53                   	push   %ebx
+     97c:	56                   	push   %esi
+     97d:	e8 ab 04 00 00       	call   e2d <write>
+    ob[fd].n = 0;
+     982:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     989:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     98c:	83 c6 01             	add    $0x1,%esi
+     98f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     995:	83 fe 10             	cmp    $0x10,%esi
+     998:	75 d6                	jne    970 <fflushall+0x10>
+}
+     99a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     99d:	5b                   	pop    %ebx
+     99e:	5e                   	pop    %esi
+     99f:	5d                   	pop    %ebp
+     9a0:	c3                   	ret
+     9a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9af:	90                   	nop
+
+000009b0 <fork>:
+{
+     9b0:	55                   	push   %ebp
+     9b1:	89 e5                	mov    %esp,%ebp
+     9b3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     9b4:	31 f6                	xor    %esi,%esi
+{
+     9b6:	53                   	push   %ebx
+     9b7:	bb 48 9f 02 00       	mov    $0x29f48,%ebx
+     9bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     9c0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     9c3:	85 c0                	test   %eax,%eax
+     9c5:	7e 15                	jle    9dc <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     9c7:	83 ec 04             	sub    $0x4,%esp
+     9ca:	50                   	push   %eax
+     9cb:	53                   	push   %ebx
+     9cc:	56                   	push   %esi
+     9cd:	e8 5b 04 00 00       	call   e2d <write>
+    ob[fd].n = 0;
+     9d2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     9d9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     9dc:	83 c6 01             	add    $0x1,%esi
+     9df:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     9e5:	83 fe 10             	cmp    $0x10,%esi
+     9e8:	75 d6                	jne    9c0 <fork+0x10>
+}
+     9ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     9ed:	5b                   	pop    %ebx
+     9ee:	5e                   	pop    %esi
+     9ef:	5d                   	pop    %ebp
+  return _fork();
+     9f0:	e9 15 04 00 00       	jmp    e0a <_fork>
+     9f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a00 <exit>:
+{
+     a00:	55                   	push   %ebp
+     a01:	89 e5                	mov    %esp,%ebp
+     a03:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+     a06:	e8 55 ff ff ff       	call   960 <fflushall>
+  _exit();
+     a0b:	e8 01 04 00 00       	call   e11 <_exit>
+
+00000a10 <exec>:
+{
+     a10:	55                   	push   %ebp
+     a11:	89 e5                	mov    %esp,%ebp
+     a13:	57                   	push   %edi
+     a14:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     a15:	31 f6                	xor    %esi,%esi
+{
+     a17:	53                   	push   %ebx
+     a18:	bb 48 9f 02 00       	mov    $0x29f48,%ebx
+     a1d:	83 ec 1c             	sub    $0x1c,%esp
+     a20:	8b 45 08             	mov    0x8(%ebp),%eax
+     a23:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     a26:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     a29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     a30:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     a33:	85 c0                	test   %eax,%eax
+     a35:	7e 15                	jle    a4c <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     a37:	83 ec 04             	sub    $0x4,%esp
+     a3a:	50                   	push   %eax
+     a3b:	53                   	push   %ebx
+     a3c:	56                   	push   %esi
+     a3d:	e8 eb 03 00 00       	call   e2d <write>
+    ob[fd].n = 0;
+     a42:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     a49:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     a4c:	83 c6 01             	add    $0x1,%esi
+     a4f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     a55:	83 fe 10             	cmp    $0x10,%esi
+     a58:	75 d6                	jne    a30 <exec+0x20>
+  return _exec(path, argv);
+     a5a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     a5d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+     a60:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     a63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a66:	5b                   	pop    %ebx
+     a67:	5e                   	pop    %esi
+     a68:	5f                   	pop    %edi
+     a69:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     a6a:	e9 d3 03 00 00       	jmp    e42 <_exec>
+     a6f:	90                   	nop
+
+00000a70 <close>:
+{
+     a70:	55                   	push   %ebp
+     a71:	89 e5                	mov    %esp,%ebp
+     a73:	56                   	push   %esi
+     a74:	53                   	push   %ebx
+     a75:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     a78:	83 fb 0f             	cmp    $0xf,%ebx
+     a7b:	77 26                	ja     aa3 <close+0x33>
+     a7d:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     a83:	8b 90 44 9f 02 00    	mov    0x29f44(%eax),%edx
+     a89:	8d b0 40 9f 02 00    	lea    0x29f40(%eax),%esi
+     a8f:	85 d2                	test   %edx,%edx
+     a91:	7f 25                	jg     ab8 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+     a93:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     a99:	c7 80 40 9f 02 00 00 	movl   $0x0,0x29f40(%eax)
+     aa0:	00 00 00 
+  return _close(fd);
+     aa3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     aa6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     aa9:	5b                   	pop    %ebx
+     aaa:	5e                   	pop    %esi
+     aab:	5d                   	pop    %ebp
+  return _close(fd);
+     aac:	e9 83 03 00 00       	jmp    e34 <_close>
+     ab1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     ab8:	83 ec 04             	sub    $0x4,%esp
+     abb:	05 48 9f 02 00       	add    $0x29f48,%eax
+     ac0:	52                   	push   %edx
+     ac1:	50                   	push   %eax
+     ac2:	53                   	push   %ebx
+     ac3:	e8 65 03 00 00       	call   e2d <write>
+    ob[fd].n = 0;
+     ac8:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+     acf:	83 c4 10             	add    $0x10,%esp
+     ad2:	eb bf                	jmp    a93 <close+0x23>
+     ad4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     adb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     adf:	90                   	nop
+
+00000ae0 <strcpy>:
+{
+     ae0:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+     ae1:	31 c0                	xor    %eax,%eax
+{
+     ae3:	89 e5                	mov    %esp,%ebp
+     ae5:	53                   	push   %ebx
+     ae6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     ae9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     aec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     af0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     af4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     af7:	83 c0 01             	add    $0x1,%eax
+     afa:	84 d2                	test   %dl,%dl
+     afc:	75 f2                	jne    af0 <strcpy+0x10>
+}
+     afe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b01:	89 c8                	mov    %ecx,%eax
+     b03:	c9                   	leave
+     b04:	c3                   	ret
+     b05:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b10 <strcmp>:
+{
+     b10:	55                   	push   %ebp
+     b11:	89 e5                	mov    %esp,%ebp
+     b13:	53                   	push   %ebx
+     b14:	8b 55 08             	mov    0x8(%ebp),%edx
+     b17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     b1a:	0f b6 02             	movzbl (%edx),%eax
+     b1d:	84 c0                	test   %al,%al
+     b1f:	75 17                	jne    b38 <strcmp+0x28>
+     b21:	eb 3a                	jmp    b5d <strcmp+0x4d>
+     b23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b27:	90                   	nop
+     b28:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     b2c:	83 c2 01             	add    $0x1,%edx
+     b2f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     b32:	84 c0                	test   %al,%al
+     b34:	74 1a                	je     b50 <strcmp+0x40>
+    p++, q++;
+     b36:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     b38:	0f b6 19             	movzbl (%ecx),%ebx
+     b3b:	38 c3                	cmp    %al,%bl
+     b3d:	74 e9                	je     b28 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     b3f:	29 d8                	sub    %ebx,%eax
+}
+     b41:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b44:	c9                   	leave
+     b45:	c3                   	ret
+     b46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b4d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     b50:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     b54:	31 c0                	xor    %eax,%eax
+     b56:	29 d8                	sub    %ebx,%eax
+}
+     b58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b5b:	c9                   	leave
+     b5c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     b5d:	0f b6 19             	movzbl (%ecx),%ebx
+     b60:	31 c0                	xor    %eax,%eax
+     b62:	eb db                	jmp    b3f <strcmp+0x2f>
+     b64:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b6f:	90                   	nop
+
+00000b70 <strlen>:
+{
+     b70:	55                   	push   %ebp
+     b71:	89 e5                	mov    %esp,%ebp
+     b73:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+     b76:	80 3a 00             	cmpb   $0x0,(%edx)
+     b79:	74 15                	je     b90 <strlen+0x20>
+     b7b:	31 c0                	xor    %eax,%eax
+     b7d:	8d 76 00             	lea    0x0(%esi),%esi
+     b80:	83 c0 01             	add    $0x1,%eax
+     b83:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     b87:	89 c1                	mov    %eax,%ecx
+     b89:	75 f5                	jne    b80 <strlen+0x10>
+}
+     b8b:	89 c8                	mov    %ecx,%eax
+     b8d:	5d                   	pop    %ebp
+     b8e:	c3                   	ret
+     b8f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     b90:	31 c9                	xor    %ecx,%ecx
+}
+     b92:	5d                   	pop    %ebp
+     b93:	89 c8                	mov    %ecx,%eax
+     b95:	c3                   	ret
+     b96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ba0 <memset>:
+{
+     ba0:	55                   	push   %ebp
+     ba1:	89 e5                	mov    %esp,%ebp
+     ba3:	57                   	push   %edi
+     ba4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     ba7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     baa:	8b 45 0c             	mov    0xc(%ebp),%eax
+     bad:	89 d7                	mov    %edx,%edi
+     baf:	fc                   	cld
+     bb0:	f3 aa                	rep stos %al,%es:(%edi)
+}
+     bb2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     bb5:	89 d0                	mov    %edx,%eax
+     bb7:	c9                   	leave
+     bb8:	c3                   	ret
+     bb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000bc0 <strchr>:
+{
+     bc0:	55                   	push   %ebp
+     bc1:	89 e5                	mov    %esp,%ebp
+     bc3:	8b 45 08             	mov    0x8(%ebp),%eax
+     bc6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     bca:	0f b6 10             	movzbl (%eax),%edx
+     bcd:	84 d2                	test   %dl,%dl
+     bcf:	75 12                	jne    be3 <strchr+0x23>
+     bd1:	eb 1d                	jmp    bf0 <strchr+0x30>
+     bd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bd7:	90                   	nop
+     bd8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     bdc:	83 c0 01             	add    $0x1,%eax
+     bdf:	84 d2                	test   %dl,%dl
+     be1:	74 0d                	je     bf0 <strchr+0x30>
+    if(*s == c)
+     be3:	38 d1                	cmp    %dl,%cl
+     be5:	75 f1                	jne    bd8 <strchr+0x18>
+}
+     be7:	5d                   	pop    %ebp
+     be8:	c3                   	ret
+     be9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     bf0:	31 c0                	xor    %eax,%eax
+}
+     bf2:	5d                   	pop    %ebp
+     bf3:	c3                   	ret
+     bf4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bff:	90                   	nop
+
+00000c00 <memchr>:
+{
+     c00:	55                   	push   %ebp
+     c01:	89 e5                	mov    %esp,%ebp
+     c03:	8b 55 10             	mov    0x10(%ebp),%edx
+     c06:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     c09:	85 d2                	test   %edx,%edx
+     c0b:	74 1b                	je     c28 <memchr+0x28>
+    if(*p == (char)c)
+     c0d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+     c11:	01 c2                	add    %eax,%edx
+     c13:	eb 0a                	jmp    c1f <memchr+0x1f>
+     c15:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+     c18:	83 c0 01             	add    $0x1,%eax
+     c1b:	39 c2                	cmp    %eax,%edx
+     c1d:	74 09                	je     c28 <memchr+0x28>
+    if(*p == (char)c)
+     c1f:	38 08                	cmp    %cl,(%eax)
+     c21:	75 f5                	jne    c18 <memchr+0x18>
+}
+     c23:	5d                   	pop    %ebp
+     c24:	c3                   	ret
+     c25:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+     c28:	31 c0                	xor    %eax,%eax
+}
+     c2a:	5d                   	pop    %ebp
+     c2b:	c3                   	ret
+     c2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c30 <gets>:
+{
+     c30:	55                   	push   %ebp
+     c31:	89 e5                	mov    %esp,%ebp
+     c33:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+     c34:	31 ff                	xor    %edi,%edi
+{
+     c36:	56                   	push   %esi
+     c37:	be 48 9f 02 00       	mov    $0x29f48,%esi
+     c3c:	53                   	push   %ebx
+     c3d:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     c40:	8b 46 fc             	mov    -0x4(%esi),%eax
+     c43:	85 c0                	test   %eax,%eax
+     c45:	7e 15                	jle    c5c <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     c47:	83 ec 04             	sub    $0x4,%esp
+     c4a:	50                   	push   %eax
+     c4b:	56                   	push   %esi
+     c4c:	57                   	push   %edi
+     c4d:	e8 db 01 00 00       	call   e2d <write>
+    ob[fd].n = 0;
+     c52:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+     c59:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     c5c:	83 c7 01             	add    $0x1,%edi
+     c5f:	81 c6 08 01 00 00    	add    $0x108,%esi
+     c65:	83 ff 10             	cmp    $0x10,%edi
+     c68:	75 d6                	jne    c40 <gets+0x10>
+  for(i=0; i+1 < max; ){
+     c6a:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+     c6c:	8d 75 e7             	lea    -0x19(%ebp),%esi
+     c6f:	eb 2e                	jmp    c9f <gets+0x6f>
+     c71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c78:	83 ec 04             	sub    $0x4,%esp
+     c7b:	6a 01                	push   $0x1
+     c7d:	56                   	push   %esi
+     c7e:	6a 00                	push   $0x0
+     c80:	e8 a1 01 00 00       	call   e26 <read>
+    if(cc < 1)
+     c85:	83 c4 10             	add    $0x10,%esp
+     c88:	85 c0                	test   %eax,%eax
+     c8a:	7e 1d                	jle    ca9 <gets+0x79>
+    buf[i++] = c;
+     c8c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     c90:	8b 55 08             	mov    0x8(%ebp),%edx
+     c93:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     c97:	3c 0a                	cmp    $0xa,%al
+     c99:	74 10                	je     cab <gets+0x7b>
+     c9b:	3c 0d                	cmp    $0xd,%al
+     c9d:	74 0c                	je     cab <gets+0x7b>
+  for(i=0; i+1 < max; ){
+     c9f:	89 df                	mov    %ebx,%edi
+     ca1:	83 c3 01             	add    $0x1,%ebx
+     ca4:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     ca7:	7c cf                	jl     c78 <gets+0x48>
+     ca9:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     cab:	8b 45 08             	mov    0x8(%ebp),%eax
+     cae:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     cb2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cb5:	5b                   	pop    %ebx
+     cb6:	5e                   	pop    %esi
+     cb7:	5f                   	pop    %edi
+     cb8:	5d                   	pop    %ebp
+     cb9:	c3                   	ret
+     cba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000cc0 <stat>:
+{
+     cc0:	55                   	push   %ebp
+     cc1:	89 e5                	mov    %esp,%ebp
+     cc3:	57                   	push   %edi
+     cc4:	56                   	push   %esi
+     cc5:	53                   	push   %ebx
+     cc6:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+     cc9:	6a 00                	push   $0x0
+     ccb:	ff 75 08             	push   0x8(%ebp)
+     cce:	e8 76 01 00 00       	call   e49 <open>
+  if(fd < 0)
+     cd3:	83 c4 10             	add    $0x10,%esp
+     cd6:	85 c0                	test   %eax,%eax
+     cd8:	78 76                	js     d50 <stat+0x90>
+  r = fstat(fd, st);
+     cda:	83 ec 08             	sub    $0x8,%esp
+     cdd:	ff 75 0c             	push   0xc(%ebp)
+     ce0:	89 c3                	mov    %eax,%ebx
+     ce2:	50                   	push   %eax
+     ce3:	e8 7f 01 00 00       	call   e67 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     ce8:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     ceb:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     ced:	83 fb 0f             	cmp    $0xf,%ebx
+     cf0:	7f 40                	jg     d32 <stat+0x72>
+     cf2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     cf8:	8b 90 44 9f 02 00    	mov    0x29f44(%eax),%edx
+     cfe:	8d b8 40 9f 02 00    	lea    0x29f40(%eax),%edi
+     d04:	85 d2                	test   %edx,%edx
+     d06:	7e 1a                	jle    d22 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+     d08:	83 ec 04             	sub    $0x4,%esp
+     d0b:	05 48 9f 02 00       	add    $0x29f48,%eax
+     d10:	52                   	push   %edx
+     d11:	50                   	push   %eax
+     d12:	53                   	push   %ebx
+     d13:	e8 15 01 00 00       	call   e2d <write>
+    ob[fd].n = 0;
+     d18:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+     d1f:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+     d22:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     d28:	c7 80 40 9f 02 00 00 	movl   $0x0,0x29f40(%eax)
+     d2f:	00 00 00 
+  return _close(fd);
+     d32:	83 ec 0c             	sub    $0xc,%esp
+     d35:	53                   	push   %ebx
+     d36:	e8 f9 00 00 00       	call   e34 <_close>
+     d3b:	83 c4 10             	add    $0x10,%esp
+}
+     d3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d41:	89 f0                	mov    %esi,%eax
+     d43:	5b                   	pop    %ebx
+     d44:	5e                   	pop    %esi
+     d45:	5f                   	pop    %edi
+     d46:	5d                   	pop    %ebp
+     d47:	c3                   	ret
+     d48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d4f:	90                   	nop
+    return -1;
+     d50:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     d55:	eb e7                	jmp    d3e <stat+0x7e>
+     d57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d5e:	66 90                	xchg   %ax,%ax
+
+00000d60 <atoi>:
+{
+     d60:	55                   	push   %ebp
+     d61:	89 e5                	mov    %esp,%ebp
+     d63:	53                   	push   %ebx
+     d64:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     d67:	0f be 02             	movsbl (%edx),%eax
+     d6a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     d6d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     d70:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     d75:	77 1e                	ja     d95 <atoi+0x35>
+     d77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d7e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     d80:	83 c2 01             	add    $0x1,%edx
+     d83:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     d86:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     d8a:	0f be 02             	movsbl (%edx),%eax
+     d8d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     d90:	80 fb 09             	cmp    $0x9,%bl
+     d93:	76 eb                	jbe    d80 <atoi+0x20>
+}
+     d95:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d98:	89 c8                	mov    %ecx,%eax
+     d9a:	c9                   	leave
+     d9b:	c3                   	ret
+     d9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000da0 <memmove>:
+{
+     da0:	55                   	push   %ebp
+     da1:	89 e5                	mov    %esp,%ebp
+     da3:	57                   	push   %edi
+     da4:	56                   	push   %esi
+     da5:	8b 45 10             	mov    0x10(%ebp),%eax
+     da8:	8b 55 08             	mov    0x8(%ebp),%edx
+     dab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     dae:	85 c0                	test   %eax,%eax
+     db0:	7e 13                	jle    dc5 <memmove+0x25>
+     db2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     db4:	89 d7                	mov    %edx,%edi
+     db6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dbd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     dc0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     dc1:	39 f8                	cmp    %edi,%eax
+     dc3:	75 fb                	jne    dc0 <memmove+0x20>
+  return vdst;
+}
+     dc5:	5e                   	pop    %esi
+     dc6:	89 d0                	mov    %edx,%eax
+     dc8:	5f                   	pop    %edi
+     dc9:	5d                   	pop    %ebp
+     dca:	c3                   	ret
+
+00000dcb <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+     dcb:	83 3d 3c 1c 00 00 00 	cmpl   $0x0,0x1c3c
+  jle 1f
+     dd2:	7e 0a                	jle    dde <syscallentry+0x13>
+  movl %esp, %ecx
+     dd4:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+     dd6:	ba dd 0d 00 00       	mov    $0xddd,%edx
+  sysenter
+     ddb:	0f 34                	sysenter
+2:
+  ret
+     ddd:	c3                   	ret
+1:
+  jl 3f
+     dde:	7c 27                	jl     e07 <syscallentry+0x3c>
+  pushal
+     de0:	60                   	pusha
+  movl $1, %eax
+     de1:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     de6:	0f a2                	cpuid
+  movl $-1, sysentermode
+     de8:	c7 05 3c 1c 00 00 ff 	movl   $0xffffffff,0x1c3c
+     def:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     df2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+     df8:	74 0a                	je     e04 <syscallentry+0x39>
+  movl $1, sysentermode
+     dfa:	c7 05 3c 1c 00 00 01 	movl   $0x1,0x1c3c
+     e01:	00 00 00 
+4:
+  popal
+     e04:	61                   	popa
+  jmp syscallentry
+     e05:	eb c4                	jmp    dcb <syscallentry>
+3:
+  int $T_SYSCALL
+     e07:	cd 40                	int    $0x40
+  ret
+     e09:	c3                   	ret
+
+00000e0a <_fork>:
+
+SYSCALLAS(_fork, fork)
+     e0a:	b8 01 00 00 00       	mov    $0x1,%eax
+     e0f:	eb ba                	jmp    dcb <syscallentry>
+
+00000e11 <_exit>:
+SYSCALLAS(_exit, exit)
+     e11:	b8 02 00 00 00       	mov    $0x2,%eax
+     e16:	eb b3                	jmp    dcb <syscallentry>
+
+00000e18 <wait>:
+SYSCALL(wait)
+     e18:	b8 03 00 00 00       	mov    $0x3,%eax
+     e1d:	eb ac                	jmp    dcb <syscallentry>
+
+00000e1f <pipe>:
+SYSCALL(pipe)
+     e1f:	b8 04 00 00 00       	mov    $0x4,%eax
+     e24:	eb a5                	jmp    dcb <syscallentry>
+
+00000e26 <read>:
+SYSCALL(read)
+     e26:	b8 05 00 00 00       	mov    $0x5,%eax
+     e2b:	eb 9e                	jmp    dcb <syscallentry>
+
+00000e2d <write>:
+SYSCALL(write)
+     e2d:	b8 10 00 00 00       	mov    $0x10,%eax
+     e32:	eb 97                	jmp    dcb <syscallentry>
+
+00000e34 <_close>:
+SYSCALLAS(_close, close)
+     e34:	b8 15 00 00 00       	mov    $0x15,%eax
+     e39:	eb 90                	jmp    dcb <syscallentry>
+
+00000e3b <kill>:
+SYSCALL(kill)
+     e3b:	b8 06 00 00 00       	mov    $0x6,%eax
+     e40:	eb 89                	jmp    dcb <syscallentry>
+
+00000e42 <_exec>:
+SYSCALLAS(_exec, exec)
+     e42:	b8 07 00 00 00       	mov    $0x7,%eax
+     e47:	eb 82                	jmp    dcb <syscallentry>
+
+00000e49 <open>:
+SYSCALL(open)
+     e49:	b8 0f 00 00 00       	mov    $0xf,%eax
+     e4e:	e9 78 ff ff ff       	jmp    dcb <syscallentry>
+
+00000e53 <mknod>:
+SYSCALL(mknod)
+     e53:	b8 11 00 00 00       	mov    $0x11,%eax
+     e58:	e9 6e ff ff ff       	jmp    dcb <syscallentry>
+
+00000e5d <unlink>:
+SYSCALL(unlink)
+     e5d:	b8 12 00 00 00       	mov    $0x12,%eax
+     e62:	e9 64 ff ff ff       	jmp    dcb <syscallentry>
+
+00000e67 <fstat>:
+SYSCALL(fstat)
+     e67:	b8 08 00 00 00       	mov    $0x8,%eax
+     e6c:	e9 5a ff ff ff       	jmp    dcb <syscallentry>
+
+00000e71 <link>:
+SYSCALL(link)
+     e71:	b8 13 00 00 00       	mov    $0x13,%eax
+     e76:	e9 50 ff ff ff       	jmp    dcb <syscallentry>
+
+00000e7b <mkdir>:
+SYSCALL(mkdir)
+     e7b:	b8 14 00 00 00       	mov    $0x14,%eax
+     e80:	e9 46 ff ff ff       	jmp    dcb <syscallentry>
+
+00000e85 <chdir>:
+SYSCALL(chdir)
+     e85:	b8 09 00 00 00       	mov    $0x9,%eax
+     e8a:	e9 3c ff ff ff       	jmp    dcb <syscallentry>
+
+00000e8f <dup>:
+SYSCALL(dup)
+     e8f:	b8 0a 00 00 00       	mov    $0xa,%eax
+     e94:	e9 32 ff ff ff       	jmp    dcb <syscallentry>
+
+00000e99 <getpid>:
+SYSCALL(getpid)
+     e99:	b8 0b 00 00 00       	mov    $0xb,%eax
+     e9e:	e9 28 ff ff ff       	jmp    dcb <syscallentry>
+
+00000ea3 <sbrk>:
+SYSCALL(sbrk)
+     ea3:	b8 0c 00 00 00       	mov    $0xc,%eax
+     ea8:	e9 1e ff ff ff       	jmp    dcb <syscallentry>
+
+00000ead <sleep>:
+SYSCALL(sleep)
+     ead:	b8 0d 00 00 00       	mov    $0xd,%eax
+     eb2:	e9 14 ff ff ff       	jmp    dcb <syscallentry>
+
+00000eb7 <uptime>:
+SYSCALL(uptime)
+     eb7:	b8 0e 00 00 00       	mov    $0xe,%eax
+     ebc:	e9 0a ff ff ff       	jmp    dcb <syscallentry>
+
+00000ec1 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+     ec1:	b8 16 00 00 00       	mov    $0x16,%eax
+     ec6:	e9 00 ff ff ff       	jmp    dcb <syscallentry>
+
+00000ecb <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+     ecb:	b8 17 00 00 00       	mov    $0x17,%eax
+     ed0:	e9 f6 fe ff ff       	jmp    dcb <syscallentry>
+
+00000ed5 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+     ed5:	b8 18 00 00 00       	mov    $0x18,%eax
+     eda:	e9 ec fe ff ff       	jmp    dcb <syscallentry>
+
+00000edf <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+     edf:	b8 19 00 00 00       	mov    $0x19,%eax
+     ee4:	e9 e2 fe ff ff       	jmp    dcb <syscallentry>
+
+00000ee9 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+     ee9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     eee:	e9 d8 fe ff ff       	jmp    dcb <syscallentry>
+
+00000ef3 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+     ef3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     ef8:	e9 ce fe ff ff       	jmp    dcb <syscallentry>
+
+00000efd <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+     efd:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     f02:	e9 c4 fe ff ff       	jmp    dcb <syscallentry>
+
+00000f07 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+     f07:	b8 20 00 00 00       	mov    $0x20,%eax
+     f0c:	e9 ba fe ff ff       	jmp    dcb <syscallentry>
+
+00000f11 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+     f11:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     f16:	e9 b0 fe ff ff       	jmp    dcb <syscallentry>
+
+00000f1b <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+     f1b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     f20:	e9 a6 fe ff ff       	jmp    dcb <syscallentry>
+
+00000f25 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+     f25:	b8 21 00 00 00       	mov    $0x21,%eax
+     f2a:	e9 9c fe ff ff       	jmp    dcb <syscallentry>
+
+00000f2f <yield>:
+SYSCALL(yield) // yield the CPU to another process
+     f2f:	b8 22 00 00 00       	mov    $0x22,%eax
+     f34:	e9 92 fe ff ff       	jmp    dcb <syscallentry>
+
+00000f39 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+     f39:	b8 23 00 00 00       	mov    $0x23,%eax
+     f3e:	e9 88 fe ff ff       	jmp    dcb <syscallentry>
+
+00000f43 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+     f43:	b8 24 00 00 00       	mov    $0x24,%eax
+     f48:	e9 7e fe ff ff       	jmp    dcb <syscallentry>
+
+00000f4d <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+     f4d:	b8 25 00 00 00       	mov    $0x25,%eax
+     f52:	e9 74 fe ff ff       	jmp    dcb <syscallentry>
+
+00000f57 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+     f57:	b8 26 00 00 00       	mov    $0x26,%eax
+     f5c:	e9 6a fe ff ff       	jmp    dcb <syscallentry>
+
+00000f61 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+     f61:	b8 27 00 00 00       	mov    $0x27,%eax
+     f66:	e9 60 fe ff ff       	jmp    dcb <syscallentry>
+
+00000f6b <mmap>:
+SYSCALL(mmap) // map a file into memory
+     f6b:	b8 28 00 00 00       	mov    $0x28,%eax
+     f70:	e9 56 fe ff ff       	jmp    dcb <syscallentry>
+
+00000f75 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+     f75:	b8 29 00 00 00       	mov    $0x29,%eax
+     f7a:	e9 4c fe ff ff       	jmp    dcb <syscallentry>
+
+00000f7f <readv>:
+SYSCALL(readv) // read into several buffers
+     f7f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     f84:	e9 42 fe ff ff       	jmp    dcb <syscallentry>
+
+00000f89 <writev>:
+SYSCALL(writev) // write from several buffers
+     f89:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     f8e:	e9 38 fe ff ff       	jmp    dcb <syscallentry>
+
+00000f93 <pread>:
+SYSCALL(pread) // read at an offset
+     f93:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     f98:	e9 2e fe ff ff       	jmp    dcb <syscallentry>
+
+00000f9d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+     f9d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     fa2:	e9 24 fe ff ff       	jmp    dcb <syscallentry>
+
+00000fa7 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+     fa7:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     fac:	e9 1a fe ff ff       	jmp    dcb <syscallentry>
+
+00000fb1 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+     fb1:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     fb6:	e9 10 fe ff ff       	jmp    dcb <syscallentry>
+
+00000fbb <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+     fbb:	b8 30 00 00 00       	mov    $0x30,%eax
+     fc0:	e9 06 fe ff ff       	jmp    dcb <syscallentry>
+
+00000fc5 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+     fc5:	b8 31 00 00 00       	mov    $0x31,%eax
+     fca:	e9 fc fd ff ff       	jmp    dcb <syscallentry>
+
+00000fcf <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+     fcf:	b8 32 00 00 00       	mov    $0x32,%eax
+     fd4:	e9 f2 fd ff ff       	jmp    dcb <syscallentry>
+
+00000fd9 <profread>:
+SYSCALL(profread) // drain profiler samples
+     fd9:	b8 33 00 00 00       	mov    $0x33,%eax
+     fde:	e9 e8 fd ff ff       	jmp    dcb <syscallentry>
+
+00000fe3 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+     fe3:	b8 34 00 00 00       	mov    $0x34,%eax
+     fe8:	e9 de fd ff ff       	jmp    dcb <syscallentry>
+
+00000fed <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+     fed:	b8 35 00 00 00       	mov    $0x35,%eax
+     ff2:	e9 d4 fd ff ff       	jmp    dcb <syscallentry>
+
+00000ff7 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+     ff7:	b8 36 00 00 00       	mov    $0x36,%eax
+     ffc:	e9 ca fd ff ff       	jmp    dcb <syscallentry>
+
+00001001 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+    1001:	b8 37 00 00 00       	mov    $0x37,%eax
+    1006:	e9 c0 fd ff ff       	jmp    dcb <syscallentry>
+    100b:	66 90                	xchg   %ax,%ax
+    100d:	66 90                	xchg   %ax,%ax
+    100f:	90                   	nop
+
+00001010 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1010:	55                   	push   %ebp
+    1011:	89 e5                	mov    %esp,%ebp
+    1013:	57                   	push   %edi
+    1014:	56                   	push   %esi
+    1015:	53                   	push   %ebx
+    1016:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1018:	89 d1                	mov    %edx,%ecx
+{
+    101a:	83 ec 3c             	sub    $0x3c,%esp
+    101d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1020:	85 d2                	test   %edx,%edx
+    1022:	0f 89 80 00 00 00    	jns    10a8 <printint+0x98>
+    1028:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    102c:	74 7a                	je     10a8 <printint+0x98>
+    x = -xx;
+    102e:	f7 d9                	neg    %ecx
+    neg = 1;
+    1030:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1035:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1038:	31 f6                	xor    %esi,%esi
+    103a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1040:	89 c8                	mov    %ecx,%eax
+    1042:	31 d2                	xor    %edx,%edx
+    1044:	89 f7                	mov    %esi,%edi
+    1046:	f7 f3                	div    %ebx
+    1048:	8d 76 01             	lea    0x1(%esi),%esi
+    104b:	0f b6 92 a0 16 00 00 	movzbl 0x16a0(%edx),%edx
+    1052:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1056:	89 ca                	mov    %ecx,%edx
+    1058:	89 c1                	mov    %eax,%ecx
+    105a:	39 da                	cmp    %ebx,%edx
+    105c:	73 e2                	jae    1040 <printint+0x30>
+  if(neg)
+    105e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1061:	85 c0                	test   %eax,%eax
+    1063:	74 07                	je     106c <printint+0x5c>
+    buf[i++] = '-';
+    1065:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    106a:	89 f7                	mov    %esi,%edi
+    106c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    106f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1072:	01 df                	add    %ebx,%edi
+    1074:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1078:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+    107b:	83 ec 04             	sub    $0x4,%esp
+    107e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1081:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1084:	6a 01                	push   $0x1
+    1086:	50                   	push   %eax
+    1087:	56                   	push   %esi
+    1088:	e8 e3 f6 ff ff       	call   770 <bufwrite>
+  while(--i >= 0)
+    108d:	89 f8                	mov    %edi,%eax
+    108f:	83 c4 10             	add    $0x10,%esp
+    1092:	83 ef 01             	sub    $0x1,%edi
+    1095:	39 d8                	cmp    %ebx,%eax
+    1097:	75 df                	jne    1078 <printint+0x68>
+}
+    1099:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    109c:	5b                   	pop    %ebx
+    109d:	5e                   	pop    %esi
+    109e:	5f                   	pop    %edi
+    109f:	5d                   	pop    %ebp
+    10a0:	c3                   	ret
+    10a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    10a8:	31 c0                	xor    %eax,%eax
+    10aa:	eb 89                	jmp    1035 <printint+0x25>
+    10ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000010b0 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    10b0:	55                   	push   %ebp
+    10b1:	89 e5                	mov    %esp,%ebp
+    10b3:	57                   	push   %edi
+    10b4:	56                   	push   %esi
+    10b5:	53                   	push   %ebx
+    10b6:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    10b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+    10bc:	0f b6 18             	movzbl (%eax),%ebx
+    10bf:	84 db                	test   %bl,%bl
+    10c1:	74 6c                	je     112f <printf+0x7f>
+    10c3:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+    10c6:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+    10c9:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+    10cb:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    10ce:	eb 26                	jmp    10f6 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    10d0:	83 f8 25             	cmp    $0x25,%eax
+    10d3:	74 4b                	je     1120 <printf+0x70>
+  bufwrite(fd, &c, 1);
+    10d5:	83 ec 04             	sub    $0x4,%esp
+    10d8:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    10db:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+    10de:	6a 01                	push   $0x1
+    10e0:	50                   	push   %eax
+    10e1:	ff 75 08             	push   0x8(%ebp)
+    10e4:	e8 87 f6 ff ff       	call   770 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+    10e9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    10ec:	0f b6 1f             	movzbl (%edi),%ebx
+    10ef:	83 c7 01             	add    $0x1,%edi
+    10f2:	84 db                	test   %bl,%bl
+    10f4:	74 39                	je     112f <printf+0x7f>
+    c = fmt[i] & 0xff;
+    10f6:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    10f9:	85 f6                	test   %esi,%esi
+    10fb:	74 d3                	je     10d0 <printf+0x20>
+      }
+    } else if(state == '%'){
+    10fd:	83 fe 25             	cmp    $0x25,%esi
+    1100:	75 ea                	jne    10ec <printf+0x3c>
+      if(c == 'd'){
+    1102:	83 f8 25             	cmp    $0x25,%eax
+    1105:	0f 84 d5 01 00 00    	je     12e0 <printf+0x230>
+    110b:	83 e8 63             	sub    $0x63,%eax
+    110e:	83 f8 15             	cmp    $0x15,%eax
+    1111:	77 45                	ja     1158 <printf+0xa8>
+    1113:	ff 24 85 48 16 00 00 	jmp    *0x1648(,%eax,4)
+    111a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+    1120:	0f b6 1f             	movzbl (%edi),%ebx
+    1123:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+    1126:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    112b:	84 db                	test   %bl,%bl
+    112d:	75 c7                	jne    10f6 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+    112f:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+    1133:	74 0b                	je     1140 <printf+0x90>
+    fflush(fd);
+}
+    1135:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1138:	5b                   	pop    %ebx
+    1139:	5e                   	pop    %esi
+    113a:	5f                   	pop    %edi
+    113b:	5d                   	pop    %ebp
+    113c:	c3                   	ret
+    113d:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+    1140:	83 ec 0c             	sub    $0xc,%esp
+    1143:	6a 02                	push   $0x2
+    1145:	e8 c6 f7 ff ff       	call   910 <fflush>
+    114a:	83 c4 10             	add    $0x10,%esp
+}
+    114d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1150:	5b                   	pop    %ebx
+    1151:	5e                   	pop    %esi
+    1152:	5f                   	pop    %edi
+    1153:	5d                   	pop    %ebp
+    1154:	c3                   	ret
+    1155:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+    1158:	83 ec 04             	sub    $0x4,%esp
+    115b:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+    115e:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+    1162:	6a 01                	push   $0x1
+    1164:	52                   	push   %edx
+    1165:	89 55 c0             	mov    %edx,-0x40(%ebp)
+    1168:	ff 75 08             	push   0x8(%ebp)
+    116b:	e8 00 f6 ff ff       	call   770 <bufwrite>
+    1170:	83 c4 0c             	add    $0xc,%esp
+    1173:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+    1176:	6a 01                	push   $0x1
+    1178:	8b 55 c0             	mov    -0x40(%ebp),%edx
+    117b:	52                   	push   %edx
+      state = 0;
+    117c:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+    117e:	ff 75 08             	push   0x8(%ebp)
+    1181:	e8 ea f5 ff ff       	call   770 <bufwrite>
+        putc(fd, c);
+    1186:	83 c4 10             	add    $0x10,%esp
+    1189:	e9 5e ff ff ff       	jmp    10ec <printf+0x3c>
+    118e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+    1190:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+    1193:	83 ec 0c             	sub    $0xc,%esp
+    1196:	b9 10 00 00 00       	mov    $0x10,%ecx
+    119b:	8b 16                	mov    (%esi),%edx
+    119d:	6a 00                	push   $0x0
+    119f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+    11a2:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+    11a5:	e8 66 fe ff ff       	call   1010 <printint>
+        ap++;
+    11aa:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+    11ad:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    11b0:	31 f6                	xor    %esi,%esi
+    11b2:	e9 35 ff ff ff       	jmp    10ec <printf+0x3c>
+    11b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11be:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+    11c0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    11c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    11c5:	83 c0 04             	add    $0x4,%eax
+    11c8:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+    11cb:	b8 41 16 00 00       	mov    $0x1641,%eax
+    11d0:	85 db                	test   %ebx,%ebx
+    11d2:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+    11d5:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+    11d8:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+    11da:	53                   	push   %ebx
+    11db:	e8 90 f9 ff ff       	call   b70 <strlen>
+    11e0:	83 c4 0c             	add    $0xc,%esp
+    11e3:	50                   	push   %eax
+    11e4:	53                   	push   %ebx
+    11e5:	ff 75 08             	push   0x8(%ebp)
+    11e8:	e8 83 f5 ff ff       	call   770 <bufwrite>
+    11ed:	83 c4 10             	add    $0x10,%esp
+    11f0:	e9 f7 fe ff ff       	jmp    10ec <printf+0x3c>
+    11f5:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+    11f8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+    11fb:	83 ec 04             	sub    $0x4,%esp
+    11fe:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+    1201:	8b 06                	mov    (%esi),%eax
+        ap++;
+    1203:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+    1206:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+    1209:	6a 01                	push   $0x1
+    120b:	52                   	push   %edx
+    120c:	ff 75 08             	push   0x8(%ebp)
+    120f:	e8 5c f5 ff ff       	call   770 <bufwrite>
+        ap++;
+    1214:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+    1217:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    121a:	31 f6                	xor    %esi,%esi
+    121c:	e9 cb fe ff ff       	jmp    10ec <printf+0x3c>
+    1221:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+    1228:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+    122b:	83 ec 0c             	sub    $0xc,%esp
+    122e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    1233:	8b 16                	mov    (%esi),%edx
+    1235:	6a 01                	push   $0x1
+    1237:	e9 63 ff ff ff       	jmp    119f <printf+0xef>
+    123c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+    1240:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1243:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+    1246:	89 7d c0             	mov    %edi,-0x40(%ebp)
+    1249:	89 55 bc             	mov    %edx,-0x44(%ebp)
+    124c:	8b 18                	mov    (%eax),%ebx
+    124e:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+    1251:	31 c0                	xor    %eax,%eax
+    1253:	89 c7                	mov    %eax,%edi
+    1255:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+    1258:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+    125d:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+    125f:	f7 e1                	mul    %ecx
+    1261:	c1 ea 03             	shr    $0x3,%edx
+    1264:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    1267:	89 d1                	mov    %edx,%ecx
+    1269:	01 c0                	add    %eax,%eax
+    126b:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+    126d:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+    126f:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+    1271:	be 0a 00 00 00       	mov    $0xa,%esi
+    1276:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+    1278:	89 da                	mov    %ebx,%edx
+    127a:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+    127c:	89 fe                	mov    %edi,%esi
+    127e:	83 c7 01             	add    $0x1,%edi
+    1281:	8d 42 30             	lea    0x30(%edx),%eax
+    1284:	89 da                	mov    %ebx,%edx
+    1286:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    1289:	01 d2                	add    %edx,%edx
+    128b:	29 d0                	sub    %edx,%eax
+    128d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+    1291:	89 c8                	mov    %ecx,%eax
+    1293:	09 d8                	or     %ebx,%eax
+    1295:	75 c1                	jne    1258 <printf+0x1a8>
+    1297:	8b 55 bc             	mov    -0x44(%ebp),%edx
+    129a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    129d:	01 d6                	add    %edx,%esi
+    129f:	89 f7                	mov    %esi,%edi
+    12a1:	89 d6                	mov    %edx,%esi
+    12a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12a7:	90                   	nop
+    putc(fd, buf[i]);
+    12a8:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+    12ab:	83 ec 04             	sub    $0x4,%esp
+    12ae:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+    12b1:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+    12b4:	6a 01                	push   $0x1
+    12b6:	50                   	push   %eax
+    12b7:	53                   	push   %ebx
+    12b8:	e8 b3 f4 ff ff       	call   770 <bufwrite>
+  while(--i >= 0)
+    12bd:	89 fa                	mov    %edi,%edx
+    12bf:	83 c4 10             	add    $0x10,%esp
+    12c2:	83 ef 01             	sub    $0x1,%edi
+    12c5:	39 d6                	cmp    %edx,%esi
+    12c7:	75 df                	jne    12a8 <printf+0x1f8>
+        ap += 2;
+    12c9:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+    12cd:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+    12d0:	31 f6                	xor    %esi,%esi
+    12d2:	e9 15 fe ff ff       	jmp    10ec <printf+0x3c>
+    12d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12de:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+    12e0:	83 ec 04             	sub    $0x4,%esp
+    12e3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+    12e6:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+    12e9:	6a 01                	push   $0x1
+    12eb:	e9 8b fe ff ff       	jmp    117b <printf+0xcb>
+
+000012f0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    12f0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    12f1:	a1 c0 af 02 00       	mov    0x2afc0,%eax
+{
+    12f6:	89 e5                	mov    %esp,%ebp
+    12f8:	57                   	push   %edi
+    12f9:	56                   	push   %esi
+    12fa:	53                   	push   %ebx
+    12fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    12fe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1301:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1308:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    130a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    130c:	39 ca                	cmp    %ecx,%edx
+    130e:	73 30                	jae    1340 <free+0x50>
+    1310:	39 c1                	cmp    %eax,%ecx
+    1312:	72 04                	jb     1318 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1314:	39 c2                	cmp    %eax,%edx
+    1316:	72 f0                	jb     1308 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1318:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    131b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    131e:	39 f8                	cmp    %edi,%eax
+    1320:	74 2e                	je     1350 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1322:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1325:	8b 42 04             	mov    0x4(%edx),%eax
+    1328:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    132b:	39 f1                	cmp    %esi,%ecx
+    132d:	74 38                	je     1367 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    132f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1331:	5b                   	pop    %ebx
+  freep = p;
+    1332:	89 15 c0 af 02 00    	mov    %edx,0x2afc0
+}
+    1338:	5e                   	pop    %esi
+    1339:	5f                   	pop    %edi
+    133a:	5d                   	pop    %ebp
+    133b:	c3                   	ret
+    133c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1340:	39 c1                	cmp    %eax,%ecx
+    1342:	72 d0                	jb     1314 <free+0x24>
+    1344:	eb c2                	jmp    1308 <free+0x18>
+    1346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    134d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1350:	03 70 04             	add    0x4(%eax),%esi
+    1353:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1356:	8b 02                	mov    (%edx),%eax
+    1358:	8b 00                	mov    (%eax),%eax
+    135a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    135d:	8b 42 04             	mov    0x4(%edx),%eax
+    1360:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1363:	39 f1                	cmp    %esi,%ecx
+    1365:	75 c8                	jne    132f <free+0x3f>
+    p->s.size += bp->s.size;
+    1367:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    136a:	89 15 c0 af 02 00    	mov    %edx,0x2afc0
+    p->s.size += bp->s.size;
+    1370:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1373:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1376:	89 0a                	mov    %ecx,(%edx)
+}
+    1378:	5b                   	pop    %ebx
+    1379:	5e                   	pop    %esi
+    137a:	5f                   	pop    %edi
+    137b:	5d                   	pop    %ebp
+    137c:	c3                   	ret
+    137d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001380 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1380:	55                   	push   %ebp
+    1381:	89 e5                	mov    %esp,%ebp
+    1383:	57                   	push   %edi
+    1384:	56                   	push   %esi
+    1385:	53                   	push   %ebx
+    1386:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1389:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    138c:	8b 15 c0 af 02 00    	mov    0x2afc0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1392:	8d 78 07             	lea    0x7(%eax),%edi
+    1395:	c1 ef 03             	shr    $0x3,%edi
+    1398:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    139b:	85 d2                	test   %edx,%edx
+    139d:	0f 84 8d 00 00 00    	je     1430 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    13a3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    13a5:	8b 48 04             	mov    0x4(%eax),%ecx
+    13a8:	39 f9                	cmp    %edi,%ecx
+    13aa:	73 64                	jae    1410 <malloc+0x90>
+  if(nu < 4096)
+    13ac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    13b1:	39 df                	cmp    %ebx,%edi
+    13b3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    13b6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    13bd:	eb 0a                	jmp    13c9 <malloc+0x49>
+    13bf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    13c0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    13c2:	8b 48 04             	mov    0x4(%eax),%ecx
+    13c5:	39 f9                	cmp    %edi,%ecx
+    13c7:	73 47                	jae    1410 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    13c9:	89 c2                	mov    %eax,%edx
+    13cb:	39 05 c0 af 02 00    	cmp    %eax,0x2afc0
+    13d1:	75 ed                	jne    13c0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    13d3:	83 ec 0c             	sub    $0xc,%esp
+    13d6:	56                   	push   %esi
+    13d7:	e8 c7 fa ff ff       	call   ea3 <sbrk>
+  if(p == (char*)-1)
+    13dc:	83 c4 10             	add    $0x10,%esp
+    13df:	83 f8 ff             	cmp    $0xffffffff,%eax
+    13e2:	74 1c                	je     1400 <malloc+0x80>
+  hp->s.size = nu;
+    13e4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    13e7:	83 ec 0c             	sub    $0xc,%esp
+    13ea:	83 c0 08             	add    $0x8,%eax
+    13ed:	50                   	push   %eax
+    13ee:	e8 fd fe ff ff       	call   12f0 <free>
+  return freep;
+    13f3:	8b 15 c0 af 02 00    	mov    0x2afc0,%edx
+      if((p = morecore(nunits)) == 0)
+    13f9:	83 c4 10             	add    $0x10,%esp
+    13fc:	85 d2                	test   %edx,%edx
+    13fe:	75 c0                	jne    13c0 <malloc+0x40>
+        return 0;
+  }
+}
+    1400:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1403:	31 c0                	xor    %eax,%eax
+}
+    1405:	5b                   	pop    %ebx
+    1406:	5e                   	pop    %esi
+    1407:	5f                   	pop    %edi
+    1408:	5d                   	pop    %ebp
+    1409:	c3                   	ret
+    140a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1410:	39 cf                	cmp    %ecx,%edi
+    1412:	74 4c                	je     1460 <malloc+0xe0>
+        p->s.size -= nunits;
+    1414:	29 f9                	sub    %edi,%ecx
+    1416:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1419:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    141c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    141f:	89 15 c0 af 02 00    	mov    %edx,0x2afc0
+}
+    1425:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1428:	83 c0 08             	add    $0x8,%eax
+}
+    142b:	5b                   	pop    %ebx
+    142c:	5e                   	pop    %esi
+    142d:	5f                   	pop    %edi
+    142e:	5d                   	pop    %ebp
+    142f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1430:	c7 05 c0 af 02 00 c4 	movl   $0x2afc4,0x2afc0
+    1437:	af 02 00 
+    base.s.size = 0;
+    143a:	b8 c4 af 02 00       	mov    $0x2afc4,%eax
+    base.s.ptr = freep = prevp = &base;
+    143f:	c7 05 c4 af 02 00 c4 	movl   $0x2afc4,0x2afc4
+    1446:	af 02 00 
+    base.s.size = 0;
+    1449:	c7 05 c8 af 02 00 00 	movl   $0x0,0x2afc8
+    1450:	00 00 00 
+    if(p->s.size >= nunits){
+    1453:	e9 54 ff ff ff       	jmp    13ac <malloc+0x2c>
+    1458:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    145f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1460:	8b 08                	mov    (%eax),%ecx
+    1462:	89 0a                	mov    %ecx,(%edx)
+    1464:	eb b9                	jmp    141f <malloc+0x9f>
+    1466:	66 90                	xchg   %ax,%ax
+    1468:	66 90                	xchg   %ax,%ax
+    146a:	66 90                	xchg   %ax,%ax
+    146c:	66 90                	xchg   %ax,%ax
+    146e:	66 90                	xchg   %ax,%ax
+
+00001470 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+    1470:	55                   	push   %ebp
+    1471:	89 e5                	mov    %esp,%ebp
+    1473:	57                   	push   %edi
+    1474:	56                   	push   %esi
+    1475:	be 01 00 00 00       	mov    $0x1,%esi
+    147a:	53                   	push   %ebx
+    147b:	83 ec 28             	sub    $0x28,%esp
+    147e:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1481:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1484:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+    1487:	68 00 98 00 00       	push   $0x9800
+    148c:	e8 ef fe ff ff       	call   1380 <malloc>
+    1491:	83 c4 10             	add    $0x10,%esp
+    1494:	89 c7                	mov    %eax,%edi
+    1496:	85 c0                	test   %eax,%eax
+    1498:	74 62                	je     14fc <waitpoll+0x8c>
+    149a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+    14a0:	83 ec 0c             	sub    $0xc,%esp
+    14a3:	6a 01                	push   $0x1
+    14a5:	e8 03 fa ff ff       	call   ead <sleep>
+    fn();
+    14aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    14ad:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+    14af:	58                   	pop    %eax
+    14b0:	5a                   	pop    %edx
+    14b1:	68 00 02 00 00       	push   $0x200
+    14b6:	57                   	push   %edi
+    14b7:	e8 eb fa ff ff       	call   fa7 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+    14bc:	83 c4 10             	add    $0x10,%esp
+    14bf:	85 c0                	test   %eax,%eax
+    14c1:	7e 2d                	jle    14f0 <waitpoll+0x80>
+    14c3:	6b c0 4c             	imul   $0x4c,%eax,%eax
+    14c6:	89 fa                	mov    %edi,%edx
+    alive = 0;
+    14c8:	31 c9                	xor    %ecx,%ecx
+    14ca:	01 f8                	add    %edi,%eax
+    14cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+    14d0:	3b 1a                	cmp    (%edx),%ebx
+    14d2:	75 07                	jne    14db <waitpoll+0x6b>
+        alive = 1;
+    14d4:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+    14d8:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+    14db:	83 c2 4c             	add    $0x4c,%edx
+    14de:	39 d0                	cmp    %edx,%eax
+    14e0:	75 ee                	jne    14d0 <waitpoll+0x60>
+  } while(alive);
+    14e2:	85 c9                	test   %ecx,%ecx
+    14e4:	75 ba                	jne    14a0 <waitpoll+0x30>
+    14e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14ed:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+    14f0:	83 ec 0c             	sub    $0xc,%esp
+    14f3:	57                   	push   %edi
+    14f4:	e8 f7 fd ff ff       	call   12f0 <free>
+  wait();
+    14f9:	83 c4 10             	add    $0x10,%esp
+}
+    14fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14ff:	5b                   	pop    %ebx
+    1500:	5e                   	pop    %esi
+    1501:	5f                   	pop    %edi
+    1502:	5d                   	pop    %ebp
+  wait();
+    1503:	e9 10 f9 ff ff       	jmp    e18 <wait>
+    1508:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    150f:	90                   	nop
+
+00001510 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+    1510:	55                   	push   %ebp
+    1511:	89 e5                	mov    %esp,%ebp
+    1513:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+    1516:	c7 45 f0 b1 16 00 00 	movl   $0x16b1,-0x10(%ebp)
+    151d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+    1524:	e8 87 f4 ff ff       	call   9b0 <fork>
+    1529:	85 c0                	test   %eax,%eax
+    152b:	78 09                	js     1536 <runps+0x26>
+    return -1;
+  if(pid == 0){
+    152d:	74 0e                	je     153d <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+    152f:	e8 e4 f8 ff ff       	call   e18 <wait>
+}
+    1534:	c9                   	leave
+    1535:	c3                   	ret
+    1536:	c9                   	leave
+    return -1;
+    1537:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    153c:	c3                   	ret
+    exec("ps", argv);
+    153d:	50                   	push   %eax
+    153e:	50                   	push   %eax
+    153f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    1542:	50                   	push   %eax
+    1543:	68 b1 16 00 00       	push   $0x16b1
+    1548:	e8 c3 f4 ff ff       	call   a10 <exec>
+    printf(2, "exec ps failed\n");
+    154d:	5a                   	pop    %edx
+    154e:	59                   	pop    %ecx
+    154f:	68 b4 16 00 00       	push   $0x16b4
+    1554:	6a 02                	push   $0x2
+    1556:	e8 55 fb ff ff       	call   10b0 <printf>
+    exit();
+    155b:	e8 a0 f4 ff ff       	call   a00 <exit>
@@ -0,0 +1,230 @@
+// Profile a command: sample where each CPU is, user or kernel,
+// on timer interrupts while it runs, then count the samples
+// by function, using the symbol tables in /syms.
+//
+// usage: profile [-f hz] command [args...]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "prof.h"
+
+#define MAXSAMP 8192
+#define MAXSYM  1024
+#define NSHOW   25
+
+struct sym {
+  uint addr;
+  int hits;
+  char name[24];
+};
+
+struct symtab {
+  char *what;
+  struct sym s[MAXSYM];
+  int n;
+} ktab, utab;
+
+struct profsample samp[MAXSAMP];
+int nsamp, dropped;
+
+void
+drain(void)
+{
+  int n;
+
+  while((n = profread(samp + nsamp, MAXSAMP - nsamp)) > 0)
+    nsamp += n;
+  if(nsamp == MAXSAMP){
+    // Full; read and count the rest.
+    struct profsample tmp[64];
+    while((n = profread(tmp, 64)) > 0)
+      dropped += n;
+  }
+}
+
+char linebuf[128];
+char rbuf[512];
+int rpos, rlen;
+
+// Read a line of fd into linebuf. Returns 0 at end of file.
+int
+getline(int fd)
+{
+  int i;
+
+  i = 0;
+  for(;;){
+    if(rpos == rlen){
+      if((rlen = read(fd, rbuf, sizeof(rbuf))) <= 0)
+        break;
+      rpos = 0;
+    }
+    if(rbuf[rpos] == '\n'){
+      rpos++;
+      break;
+    }
+    if(i < sizeof(linebuf) - 1)
+      linebuf[i++] = rbuf[rpos];
+    rpos++;
+  }
+  linebuf[i] = 0;
+  return i > 0 || rlen > 0;
+}
+
+uint
+hex(char *s)
+{
+  uint x;
+
+  for(x = 0; ; s++){
+    if(*s >= '0' && *s <= '9')
+      x = x*16 + *s - '0';
+    else if(*s >= 'a' && *s <= 'f')
+      x = x*16 + *s - 'a' + 10;
+    else
+      return x;
+  }
+}
+
+// Load the kernel's and prog's symbols from /syms, where a
+// line "= name" begins each program's "address symbol" lines.
+void
+loadsyms(char *prog)
+{
+  struct symtab *t;
+  struct sym *s, tmp;
+  int fd, i, j;
+  char *p;
+
+  if((fd = open("/syms", O_RDONLY)) < 0){
+    printf(2, "profile: cannot open /syms\n");
+    return;
+  }
+  t = 0;
+  while(getline(fd)){
+    if(linebuf[0] == '='){
+      if(strcmp(linebuf + 2, "kernel") == 0)
+        t = &ktab;
+      else if(strcmp(linebuf + 2, prog) == 0)
+        t = &utab;
+      else
+        t = 0;
+      continue;
+    }
+    if(t == 0 || t->n == MAXSYM || (p = strchr(linebuf, ' ')) == 0)
+      continue;
+    s = &t->s[t->n++];
+    s->addr = hex(linebuf);
+    for(i = 0; p[i+1] && i < sizeof(s->name) - 1; i++)
+      s->name[i] = p[i+1];
+    s->name[i] = 0;
+  }
+  close(fd);
+
+  // Sort by address.
+  for(t = &ktab; t; t = (t == &ktab ? &utab : 0)){
+    for(i = 1; i < t->n; i++){
+      tmp = t->s[i];
+      for(j = i; j > 0 && t->s[j-1].addr > tmp.addr; j--)
+        t->s[j] = t->s[j-1];
+      t->s[j] = tmp;
+    }
+  }
+}
+
+// The symbol at or below addr.
+struct sym*
+lookup(struct symtab *t, uint addr)
+{
+  int lo, hi, mid;
+
+  lo = 0;
+  hi = t->n;
+  while(lo < hi){
+    mid = (lo + hi) / 2;
+    if(t->s[mid].addr <= addr)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo > 0 ? &t->s[lo-1] : 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct sym *s, *best;
+  struct symtab *t, *bt;
+  int hz, pid, i, k, other, unknown;
+  char *prog;
+
+  hz = 1000;
+  i = 1;
+  if(argc > 2 && strcmp(argv[1], "-f") == 0){
+    hz = atoi(argv[2]);
+    i = 3;
+  }
+  if(i >= argc){
+    printf(2, "usage: profile [-f hz] command [args...]\n");
+    exit();
+  }
+  prog = argv[i];
+  if(strchr(prog, '/'))
+    for(prog += strlen(prog); prog[-1] != '/'; prog--)
+      ;
+  ktab.what = "kernel";
+  utab.what = prog;
+  loadsyms(prog);
+
+  drain();
+  nsamp = 0;
+  hz = profctl(hz);
+  if((pid = fork()) < 0){
+    printf(2, "profile: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    exec(argv[i], argv + i);
+    printf(2, "profile: exec %s failed\n", argv[i]);
+    exit();
+  }
+  waitpoll(pid, drain);
+  profctl(0);
+  drain();
+
+  other = unknown = 0;
+  for(i = 0; i < nsamp; i++){
+    if(samp[i].user && samp[i].pid != pid){
+      other++;
+      continue;
+    }
+    t = samp[i].user ? &utab : &ktab;
+    if((s = lookup(t, samp[i].eip)) != 0)
+      s->hits++;
+    else
+      unknown++;
+  }
+
+  printf(1, "%d samples at %d Hz", nsamp, hz);
+  if(dropped)
+    printf(1, ", %d more dropped", dropped);
+  printf(1, "; %d in other processes, %d unknown\n", other, unknown);
+  for(k = 0; k < NSHOW; k++){
+    best = 0;
+    bt = 0;
+    for(t = &ktab; t; t = (t == &ktab ? &utab : 0))
+      for(s = t->s; s < t->s + t->n; s++)
+        if(s->hits > 0 && (best == 0 || s->hits > best->hits)){
+          best = s;
+          bt = t;
+        }
+    if(best == 0)
+      break;
+    printf(1, "%d\t%d%%\t%s\t%s\n", best->hits,
+           best->hits * 100 / nsamp, bt->what, best->name);
+    best->hits = 0;
+  }
+  exit();
+}
@@ -0,0 +1,2067 @@
+
+_ps:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+struct procinfo pi[NPROC];
+
+// Print the process table, from a getprocinfo() snapshot.
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 30             	sub    $0x30,%esp
+  struct procinfo *p;
+  int n;
+
+  if((n = getprocinfo(pi, NPROC)) < 0){
+  14:	68 00 02 00 00       	push   $0x200
+  19:	68 20 15 00 00       	push   $0x1520
+  1e:	e8 74 09 00 00       	call   997 <getprocinfo>
+  23:	83 c4 10             	add    $0x10,%esp
+  26:	85 c0                	test   %eax,%eax
+  28:	0f 88 1b 01 00 00    	js     149 <main+0x149>
+  2e:	89 c3                	mov    %eax,%ebx
+    printf(2, "ps: getprocinfo failed\n");
+    exit();
+  }
+  printf(1, "PID\tSTATE\t\tPRIO\tRUN ms\tSLEEP ms\tCALLS\tBURST\tTICKS\tCPU\tNAME\n");
+  30:	50                   	push   %eax
+  for(p = pi; p < pi + n; p++){
+  31:	6b db 4c             	imul   $0x4c,%ebx,%ebx
+  printf(1, "PID\tSTATE\t\tPRIO\tRUN ms\tSLEEP ms\tCALLS\tBURST\tTICKS\tCPU\tNAME\n");
+  34:	50                   	push   %eax
+  35:	68 c4 0f 00 00       	push   $0xfc4
+  3a:	6a 01                	push   $0x1
+  3c:	e8 5f 0a 00 00       	call   aa0 <printf>
+  for(p = pi; p < pi + n; p++){
+  41:	8d 83 20 15 00 00    	lea    0x1520(%ebx),%eax
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  4d:	3d 20 15 00 00       	cmp    $0x1520,%eax
+  52:	0f 86 ec 00 00 00    	jbe    144 <main+0x144>
+  58:	bf 20 15 00 00       	mov    $0x1520,%edi
+  5d:	eb 38                	jmp    97 <main+0x97>
+  5f:	90                   	nop
+           states[p->state], p->priority, div64(p->runtime, 1000),
+           div64(p->sleeptime, 1000), p->syscalls, p->estimated_burst, p->ticks);
+    if(p->cpu < 0)
+      printf(1, "-");
+    else
+      printf(1, "%d", p->cpu);
+  60:	83 ec 04             	sub    $0x4,%esp
+  63:	50                   	push   %eax
+  64:	68 84 0f 00 00       	push   $0xf84
+  69:	6a 01                	push   $0x1
+  6b:	e8 30 0a 00 00       	call   aa0 <printf>
+  70:	83 c4 10             	add    $0x10,%esp
+    printf(1, "\t%s\n", p->name);
+  73:	83 ec 04             	sub    $0x4,%esp
+  76:	8d 47 3c             	lea    0x3c(%edi),%eax
+  for(p = pi; p < pi + n; p++){
+  79:	83 c7 4c             	add    $0x4c,%edi
+    printf(1, "\t%s\n", p->name);
+  7c:	50                   	push   %eax
+  7d:	68 87 0f 00 00       	push   $0xf87
+  82:	6a 01                	push   $0x1
+  84:	e8 17 0a 00 00       	call   aa0 <printf>
+  for(p = pi; p < pi + n; p++){
+  89:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8c:	83 c4 10             	add    $0x10,%esp
+  8f:	39 c7                	cmp    %eax,%edi
+  91:	0f 83 ad 00 00 00    	jae    144 <main+0x144>
+    printf(1, "%d\t%s\t%d\t%l\t%l\t\t%d\t%d\t%d\t", p->pid,
+  97:	8b 4f 1c             	mov    0x1c(%edi),%ecx
+div64(uint64 n, uint d)
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  9a:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+  9f:	be e8 03 00 00       	mov    $0x3e8,%esi
+  r = (uint)(n >> 32) % d;
+  a4:	f7 e1                	mul    %ecx
+  a6:	89 d3                	mov    %edx,%ebx
+  a8:	c1 ea 06             	shr    $0x6,%edx
+  ab:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+  return ((uint64)hi << 32) | lo;
+  b1:	c1 eb 06             	shr    $0x6,%ebx
+  r = (uint)(n >> 32) % d;
+  b4:	29 c1                	sub    %eax,%ecx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+  b6:	8b 47 18             	mov    0x18(%edi),%eax
+  r = (uint)(n >> 32) % d;
+  b9:	89 ca                	mov    %ecx,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+  bb:	f7 f6                	div    %esi
+  bd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  r = (uint)(n >> 32) % d;
+  c0:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+  c5:	f7 67 14             	mull   0x14(%edi)
+  c8:	ff 77 2c             	push   0x2c(%edi)
+  cb:	ff 77 28             	push   0x28(%edi)
+  ce:	89 d1                	mov    %edx,%ecx
+  d0:	c1 ea 06             	shr    $0x6,%edx
+  d3:	ff 77 20             	push   0x20(%edi)
+  d6:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+  dc:	8b 57 14             	mov    0x14(%edi),%edx
+  return ((uint64)hi << 32) | lo;
+  df:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  e2:	c1 e9 06             	shr    $0x6,%ecx
+  e5:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  r = (uint)(n >> 32) % d;
+  e8:	29 c2                	sub    %eax,%edx
+  return ((uint64)hi << 32) | lo;
+  ea:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+  ed:	8b 47 10             	mov    0x10(%edi),%eax
+  f0:	ff 75 e4             	push   -0x1c(%ebp)
+  f3:	f7 f6                	div    %esi
+  f5:	ff 75 e0             	push   -0x20(%ebp)
+  return ((uint64)hi << 32) | lo;
+  f8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  fb:	8b 47 08             	mov    0x8(%edi),%eax
+  fe:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+ 101:	ff 75 dc             	push   -0x24(%ebp)
+ 104:	ff 75 d8             	push   -0x28(%ebp)
+ 107:	ff 77 0c             	push   0xc(%edi)
+ 10a:	ff 34 85 00 10 00 00 	push   0x1000(,%eax,4)
+ 111:	ff 37                	push   (%edi)
+ 113:	68 68 0f 00 00       	push   $0xf68
+ 118:	6a 01                	push   $0x1
+ 11a:	e8 81 09 00 00       	call   aa0 <printf>
+    if(p->cpu < 0)
+ 11f:	8b 47 38             	mov    0x38(%edi),%eax
+ 122:	83 c4 30             	add    $0x30,%esp
+ 125:	85 c0                	test   %eax,%eax
+ 127:	0f 89 33 ff ff ff    	jns    60 <main+0x60>
+      printf(1, "-");
+ 12d:	83 ec 08             	sub    $0x8,%esp
+ 130:	68 82 0f 00 00       	push   $0xf82
+ 135:	6a 01                	push   $0x1
+ 137:	e8 64 09 00 00       	call   aa0 <printf>
+ 13c:	83 c4 10             	add    $0x10,%esp
+ 13f:	e9 2f ff ff ff       	jmp    73 <main+0x73>
+  }
+  exit();
+ 144:	e8 a7 02 00 00       	call   3f0 <exit>
+    printf(2, "ps: getprocinfo failed\n");
+ 149:	52                   	push   %edx
+ 14a:	52                   	push   %edx
+ 14b:	68 50 0f 00 00       	push   $0xf50
+ 150:	6a 02                	push   $0x2
+ 152:	e8 49 09 00 00       	call   aa0 <printf>
+    exit();
+ 157:	e8 94 02 00 00       	call   3f0 <exit>
+ 15c:	66 90                	xchg   %ax,%ax
+ 15e:	66 90                	xchg   %ax,%ax
+
+00000160 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	57                   	push   %edi
+ 164:	56                   	push   %esi
+ 165:	53                   	push   %ebx
+ 166:	83 ec 4c             	sub    $0x4c,%esp
+ 169:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 16c:	8b 55 08             	mov    0x8(%ebp),%edx
+ 16f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 172:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+ 175:	83 fa 0f             	cmp    $0xf,%edx
+ 178:	0f 87 32 01 00 00    	ja     2b0 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+ 17e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 184:	8b 80 20 ad 00 00    	mov    0xad20(%eax),%eax
+ 18a:	85 c0                	test   %eax,%eax
+ 18c:	0f 84 de 00 00 00    	je     270 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+ 192:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 198:	8b b0 24 ad 00 00    	mov    0xad24(%eax),%esi
+ 19e:	8d 88 20 ad 00 00    	lea    0xad20(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+ 1a4:	8d b8 28 ad 00 00    	lea    0xad28(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+ 1aa:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+ 1ad:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+ 1b0:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+ 1b3:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+ 1b9:	0f 8f 01 01 00 00    	jg     2c0 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+ 1bf:	8d 78 08             	lea    0x8(%eax),%edi
+ 1c2:	8d bc 3e 20 ad 00 00 	lea    0xad20(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 1c9:	85 db                	test   %ebx,%ebx
+ 1cb:	7e 3b                	jle    208 <bufwrite+0xa8>
+ 1cd:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+ 1d0:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+ 1d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1d7:	90                   	nop
+    *dst++ = *src++;
+ 1d8:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 1d9:	39 c6                	cmp    %eax,%esi
+ 1db:	75 fb                	jne    1d8 <bufwrite+0x78>
+  ob[fd].n += n;
+ 1dd:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 1e3:	8b 88 24 ad 00 00    	mov    0xad24(%eax),%ecx
+ 1e9:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 1eb:	83 b8 20 ad 00 00 01 	cmpl   $0x1,0xad20(%eax)
+  ob[fd].n += n;
+ 1f2:	89 88 24 ad 00 00    	mov    %ecx,0xad24(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 1f8:	74 26                	je     220 <bufwrite+0xc0>
+}
+ 1fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1fd:	5b                   	pop    %ebx
+ 1fe:	5e                   	pop    %esi
+ 1ff:	5f                   	pop    %edi
+ 200:	5d                   	pop    %ebp
+ 201:	c3                   	ret
+ 202:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+ 208:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 20b:	83 b8 20 ad 00 00 01 	cmpl   $0x1,0xad20(%eax)
+  ob[fd].n += n;
+ 212:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 215:	75 e3                	jne    1fa <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+ 217:	85 db                	test   %ebx,%ebx
+ 219:	74 df                	je     1fa <bufwrite+0x9a>
+ 21b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 21f:	90                   	nop
+  src = vsrc;
+ 220:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 223:	01 c3                	add    %eax,%ebx
+ 225:	eb 10                	jmp    237 <bufwrite+0xd7>
+ 227:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22e:	66 90                	xchg   %ax,%ax
+ 230:	83 c0 01             	add    $0x1,%eax
+ 233:	39 d8                	cmp    %ebx,%eax
+ 235:	74 c3                	je     1fa <bufwrite+0x9a>
+    if(*p == (char)c)
+ 237:	80 38 0a             	cmpb   $0xa,(%eax)
+ 23a:	75 f4                	jne    230 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 23c:	85 c9                	test   %ecx,%ecx
+ 23e:	7e ba                	jle    1fa <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 240:	83 ec 04             	sub    $0x4,%esp
+ 243:	51                   	push   %ecx
+ 244:	ff 75 ac             	push   -0x54(%ebp)
+ 247:	52                   	push   %edx
+ 248:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+ 24b:	e8 cd 05 00 00       	call   81d <write>
+    ob[fd].n = 0;
+ 250:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+ 253:	83 c4 10             	add    $0x10,%esp
+ 256:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+ 25c:	c7 82 24 ad 00 00 00 	movl   $0x0,0xad24(%edx)
+ 263:	00 00 00 
+ 266:	eb 92                	jmp    1fa <bufwrite+0x9a>
+ 268:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 270:	83 ec 08             	sub    $0x8,%esp
+ 273:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 276:	50                   	push   %eax
+ 277:	52                   	push   %edx
+ 278:	89 55 b0             	mov    %edx,-0x50(%ebp)
+ 27b:	e8 d7 05 00 00       	call   857 <fstat>
+ 280:	83 c4 10             	add    $0x10,%esp
+ 283:	8b 55 b0             	mov    -0x50(%ebp),%edx
+ 286:	89 c1                	mov    %eax,%ecx
+ 288:	b8 02 00 00 00       	mov    $0x2,%eax
+ 28d:	85 c9                	test   %ecx,%ecx
+ 28f:	75 0d                	jne    29e <bufwrite+0x13e>
+ 291:	31 c0                	xor    %eax,%eax
+ 293:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 298:	0f 95 c0             	setne  %al
+ 29b:	83 c0 01             	add    $0x1,%eax
+ 29e:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+ 2a4:	89 81 20 ad 00 00    	mov    %eax,0xad20(%ecx)
+ 2aa:	e9 e3 fe ff ff       	jmp    192 <bufwrite+0x32>
+ 2af:	90                   	nop
+}
+ 2b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2b3:	5b                   	pop    %ebx
+ 2b4:	5e                   	pop    %esi
+ 2b5:	5f                   	pop    %edi
+ 2b6:	5d                   	pop    %ebp
+    write(fd, p, n);
+ 2b7:	e9 61 05 00 00       	jmp    81d <write>
+ 2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+ 2c0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+ 2c3:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+ 2c6:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+ 2c9:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+ 2cc:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+ 2cf:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+ 2d2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+ 2d5:	6a 02                	push   $0x2
+ 2d7:	50                   	push   %eax
+ 2d8:	52                   	push   %edx
+ 2d9:	e8 9b 06 00 00       	call   979 <writev>
+    ob[fd].n = 0;
+ 2de:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+ 2e1:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+ 2e4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ 2eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2ee:	5b                   	pop    %ebx
+ 2ef:	5e                   	pop    %esi
+ 2f0:	5f                   	pop    %edi
+ 2f1:	5d                   	pop    %ebp
+ 2f2:	c3                   	ret
+ 2f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000300 <fflush>:
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	53                   	push   %ebx
+ 304:	83 ec 04             	sub    $0x4,%esp
+ 307:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 30a:	83 f8 0f             	cmp    $0xf,%eax
+ 30d:	77 16                	ja     325 <fflush+0x25>
+ 30f:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+ 315:	8b 8a 24 ad 00 00    	mov    0xad24(%edx),%ecx
+ 31b:	8d 9a 20 ad 00 00    	lea    0xad20(%edx),%ebx
+ 321:	85 c9                	test   %ecx,%ecx
+ 323:	7f 0b                	jg     330 <fflush+0x30>
+}
+ 325:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 328:	c9                   	leave
+ 329:	c3                   	ret
+ 32a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 330:	83 ec 04             	sub    $0x4,%esp
+ 333:	81 c2 28 ad 00 00    	add    $0xad28,%edx
+ 339:	51                   	push   %ecx
+ 33a:	52                   	push   %edx
+ 33b:	50                   	push   %eax
+ 33c:	e8 dc 04 00 00       	call   81d <write>
+    ob[fd].n = 0;
+ 341:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+ 348:	83 c4 10             	add    $0x10,%esp
+}
+ 34b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 34e:	c9                   	leave
+ 34f:	c3                   	ret
+
+00000350 <fflushall>:
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 354:	31 f6                	xor    %esi,%esi
+{
+ 356:	53                   	push   %ebx
+ 357:	bb 28 ad 00 00       	mov    $0xad28,%ebx
+ 35c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 360:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 363:	85 c0                	test   %eax,%eax
+ 365:	7e 15                	jle    37c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 367:	83 ec 04             	sub    $0x4,%esp
+ 36a:	50                   	push   %eax
+ 36b:	53                   	push   %ebx
+ 36c:	56                   	push   %esi
+ 36d:	e8 ab 04 00 00       	call   81d <write>
+    ob[fd].n = 0;
+ 372:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 379:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 37c:	83 c6 01             	add    $0x1,%esi
+ 37f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 385:	83 fe 10             	cmp    $0x10,%esi
+ 388:	75 d6                	jne    360 <fflushall+0x10>
+}
+ 38a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 38d:	5b                   	pop    %ebx
+ 38e:	5e                   	pop    %esi
+ 38f:	5d                   	pop    %ebp
+ 390:	c3                   	ret
+ 391:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 398:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39f:	90                   	nop
+
+000003a0 <fork>:
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 3a4:	31 f6                	xor    %esi,%esi
+{
+ 3a6:	53                   	push   %ebx
+ 3a7:	bb 28 ad 00 00       	mov    $0xad28,%ebx
+ 3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 3b0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 3b3:	85 c0                	test   %eax,%eax
+ 3b5:	7e 15                	jle    3cc <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 3b7:	83 ec 04             	sub    $0x4,%esp
+ 3ba:	50                   	push   %eax
+ 3bb:	53                   	push   %ebx
+ 3bc:	56                   	push   %esi
+ 3bd:	e8 5b 04 00 00       	call   81d <write>
+    ob[fd].n = 0;
+ 3c2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 3c9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 3cc:	83 c6 01             	add    $0x1,%esi
+ 3cf:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 3d5:	83 fe 10             	cmp    $0x10,%esi
+ 3d8:	75 d6                	jne    3b0 <fork+0x10>
+}
+ 3da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3dd:	5b                   	pop    %ebx
+ 3de:	5e                   	pop    %esi
+ 3df:	5d                   	pop    %ebp
+  return _fork();
+ 3e0:	e9 15 04 00 00       	jmp    7fa <_fork>
+ 3e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003f0 <exit>:
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+ 3f6:	e8 55 ff ff ff       	call   350 <fflushall>
+  _exit();
+ 3fb:	e8 01 04 00 00       	call   801 <_exit>
+
+00000400 <exec>:
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 405:	31 f6                	xor    %esi,%esi
+{
+ 407:	53                   	push   %ebx
+ 408:	bb 28 ad 00 00       	mov    $0xad28,%ebx
+ 40d:	83 ec 1c             	sub    $0x1c,%esp
+ 410:	8b 45 08             	mov    0x8(%ebp),%eax
+ 413:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 416:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 420:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 423:	85 c0                	test   %eax,%eax
+ 425:	7e 15                	jle    43c <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 427:	83 ec 04             	sub    $0x4,%esp
+ 42a:	50                   	push   %eax
+ 42b:	53                   	push   %ebx
+ 42c:	56                   	push   %esi
+ 42d:	e8 eb 03 00 00       	call   81d <write>
+    ob[fd].n = 0;
+ 432:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 439:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 43c:	83 c6 01             	add    $0x1,%esi
+ 43f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 445:	83 fe 10             	cmp    $0x10,%esi
+ 448:	75 d6                	jne    420 <exec+0x20>
+  return _exec(path, argv);
+ 44a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 44d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+ 450:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ 453:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 456:	5b                   	pop    %ebx
+ 457:	5e                   	pop    %esi
+ 458:	5f                   	pop    %edi
+ 459:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 45a:	e9 d3 03 00 00       	jmp    832 <_exec>
+ 45f:	90                   	nop
+
+00000460 <close>:
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	56                   	push   %esi
+ 464:	53                   	push   %ebx
+ 465:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 468:	83 fb 0f             	cmp    $0xf,%ebx
+ 46b:	77 26                	ja     493 <close+0x33>
+ 46d:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 473:	8b 90 24 ad 00 00    	mov    0xad24(%eax),%edx
+ 479:	8d b0 20 ad 00 00    	lea    0xad20(%eax),%esi
+ 47f:	85 d2                	test   %edx,%edx
+ 481:	7f 25                	jg     4a8 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+ 483:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 489:	c7 80 20 ad 00 00 00 	movl   $0x0,0xad20(%eax)
+ 490:	00 00 00 
+  return _close(fd);
+ 493:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 496:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 499:	5b                   	pop    %ebx
+ 49a:	5e                   	pop    %esi
+ 49b:	5d                   	pop    %ebp
+  return _close(fd);
+ 49c:	e9 83 03 00 00       	jmp    824 <_close>
+ 4a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 4a8:	83 ec 04             	sub    $0x4,%esp
+ 4ab:	05 28 ad 00 00       	add    $0xad28,%eax
+ 4b0:	52                   	push   %edx
+ 4b1:	50                   	push   %eax
+ 4b2:	53                   	push   %ebx
+ 4b3:	e8 65 03 00 00       	call   81d <write>
+    ob[fd].n = 0;
+ 4b8:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+ 4bf:	83 c4 10             	add    $0x10,%esp
+ 4c2:	eb bf                	jmp    483 <close+0x23>
+ 4c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4cf:	90                   	nop
+
+000004d0 <strcpy>:
+{
+ 4d0:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+ 4d1:	31 c0                	xor    %eax,%eax
+{
+ 4d3:	89 e5                	mov    %esp,%ebp
+ 4d5:	53                   	push   %ebx
+ 4d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 4d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 4dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 4e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 4e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 4e7:	83 c0 01             	add    $0x1,%eax
+ 4ea:	84 d2                	test   %dl,%dl
+ 4ec:	75 f2                	jne    4e0 <strcpy+0x10>
+}
+ 4ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4f1:	89 c8                	mov    %ecx,%eax
+ 4f3:	c9                   	leave
+ 4f4:	c3                   	ret
+ 4f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000500 <strcmp>:
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	53                   	push   %ebx
+ 504:	8b 55 08             	mov    0x8(%ebp),%edx
+ 507:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 50a:	0f b6 02             	movzbl (%edx),%eax
+ 50d:	84 c0                	test   %al,%al
+ 50f:	75 17                	jne    528 <strcmp+0x28>
+ 511:	eb 3a                	jmp    54d <strcmp+0x4d>
+ 513:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 517:	90                   	nop
+ 518:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 51c:	83 c2 01             	add    $0x1,%edx
+ 51f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 522:	84 c0                	test   %al,%al
+ 524:	74 1a                	je     540 <strcmp+0x40>
+    p++, q++;
+ 526:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 528:	0f b6 19             	movzbl (%ecx),%ebx
+ 52b:	38 c3                	cmp    %al,%bl
+ 52d:	74 e9                	je     518 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 52f:	29 d8                	sub    %ebx,%eax
+}
+ 531:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 534:	c9                   	leave
+ 535:	c3                   	ret
+ 536:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 540:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 544:	31 c0                	xor    %eax,%eax
+ 546:	29 d8                	sub    %ebx,%eax
+}
+ 548:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 54b:	c9                   	leave
+ 54c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 54d:	0f b6 19             	movzbl (%ecx),%ebx
+ 550:	31 c0                	xor    %eax,%eax
+ 552:	eb db                	jmp    52f <strcmp+0x2f>
+ 554:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 55f:	90                   	nop
+
+00000560 <strlen>:
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+ 566:	80 3a 00             	cmpb   $0x0,(%edx)
+ 569:	74 15                	je     580 <strlen+0x20>
+ 56b:	31 c0                	xor    %eax,%eax
+ 56d:	8d 76 00             	lea    0x0(%esi),%esi
+ 570:	83 c0 01             	add    $0x1,%eax
+ 573:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 577:	89 c1                	mov    %eax,%ecx
+ 579:	75 f5                	jne    570 <strlen+0x10>
+}
+ 57b:	89 c8                	mov    %ecx,%eax
+ 57d:	5d                   	pop    %ebp
+ 57e:	c3                   	ret
+ 57f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 580:	31 c9                	xor    %ecx,%ecx
+}
+ 582:	5d                   	pop    %ebp
+ 583:	89 c8                	mov    %ecx,%eax
+ 585:	c3                   	ret
+ 586:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000590 <memset>:
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	57                   	push   %edi
+ 594:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("cld; rep stosb" :
+ 597:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 59a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 59d:	89 d7                	mov    %edx,%edi
+ 59f:	fc                   	cld
+ 5a0:	f3 aa                	rep stos %al,%es:(%edi)
+}
+ 5a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 5a5:	89 d0                	mov    %edx,%eax
+ 5a7:	c9                   	leave
+ 5a8:	c3                   	ret
+ 5a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005b0 <strchr>:
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 5ba:	0f b6 10             	movzbl (%eax),%edx
+ 5bd:	84 d2                	test   %dl,%dl
+ 5bf:	75 12                	jne    5d3 <strchr+0x23>
+ 5c1:	eb 1d                	jmp    5e0 <strchr+0x30>
+ 5c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5c7:	90                   	nop
+ 5c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 5cc:	83 c0 01             	add    $0x1,%eax
+ 5cf:	84 d2                	test   %dl,%dl
+ 5d1:	74 0d                	je     5e0 <strchr+0x30>
+    if(*s == c)
+ 5d3:	38 d1                	cmp    %dl,%cl
+ 5d5:	75 f1                	jne    5c8 <strchr+0x18>
+}
+ 5d7:	5d                   	pop    %ebp
+ 5d8:	c3                   	ret
+ 5d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 5e0:	31 c0                	xor    %eax,%eax
+}
+ 5e2:	5d                   	pop    %ebp
+ 5e3:	c3                   	ret
+ 5e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5ef:	90                   	nop
+
+000005f0 <memchr>:
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	8b 55 10             	mov    0x10(%ebp),%edx
+ 5f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 5f9:	85 d2                	test   %edx,%edx
+ 5fb:	74 1b                	je     618 <memchr+0x28>
+    if(*p == (char)c)
+ 5fd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+ 601:	01 c2                	add    %eax,%edx
+ 603:	eb 0a                	jmp    60f <memchr+0x1f>
+ 605:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+ 608:	83 c0 01             	add    $0x1,%eax
+ 60b:	39 c2                	cmp    %eax,%edx
+ 60d:	74 09                	je     618 <memchr+0x28>
+    if(*p == (char)c)
+ 60f:	38 08                	cmp    %cl,(%eax)
+ 611:	75 f5                	jne    608 <memchr+0x18>
+}
+ 613:	5d                   	pop    %ebp
+ 614:	c3                   	ret
+ 615:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+ 618:	31 c0                	xor    %eax,%eax
+}
+ 61a:	5d                   	pop    %ebp
+ 61b:	c3                   	ret
+ 61c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000620 <gets>:
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+ 624:	31 ff                	xor    %edi,%edi
+{
+ 626:	56                   	push   %esi
+ 627:	be 28 ad 00 00       	mov    $0xad28,%esi
+ 62c:	53                   	push   %ebx
+ 62d:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 630:	8b 46 fc             	mov    -0x4(%esi),%eax
+ 633:	85 c0                	test   %eax,%eax
+ 635:	7e 15                	jle    64c <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 637:	83 ec 04             	sub    $0x4,%esp
+ 63a:	50                   	push   %eax
+ 63b:	56                   	push   %esi
+ 63c:	57                   	push   %edi
+ 63d:	e8 db 01 00 00       	call   81d <write>
+    ob[fd].n = 0;
+ 642:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+ 649:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 64c:	83 c7 01             	add    $0x1,%edi
+ 64f:	81 c6 08 01 00 00    	add    $0x108,%esi
+ 655:	83 ff 10             	cmp    $0x10,%edi
+ 658:	75 d6                	jne    630 <gets+0x10>
+  for(i=0; i+1 < max; ){
+ 65a:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+ 65c:	8d 75 e7             	lea    -0x19(%ebp),%esi
+ 65f:	eb 2e                	jmp    68f <gets+0x6f>
+ 661:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 668:	83 ec 04             	sub    $0x4,%esp
+ 66b:	6a 01                	push   $0x1
+ 66d:	56                   	push   %esi
+ 66e:	6a 00                	push   $0x0
+ 670:	e8 a1 01 00 00       	call   816 <read>
+    if(cc < 1)
+ 675:	83 c4 10             	add    $0x10,%esp
+ 678:	85 c0                	test   %eax,%eax
+ 67a:	7e 1d                	jle    699 <gets+0x79>
+    buf[i++] = c;
+ 67c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 680:	8b 55 08             	mov    0x8(%ebp),%edx
+ 683:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 687:	3c 0a                	cmp    $0xa,%al
+ 689:	74 10                	je     69b <gets+0x7b>
+ 68b:	3c 0d                	cmp    $0xd,%al
+ 68d:	74 0c                	je     69b <gets+0x7b>
+  for(i=0; i+1 < max; ){
+ 68f:	89 df                	mov    %ebx,%edi
+ 691:	83 c3 01             	add    $0x1,%ebx
+ 694:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 697:	7c cf                	jl     668 <gets+0x48>
+ 699:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 69b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 69e:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 6a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6a5:	5b                   	pop    %ebx
+ 6a6:	5e                   	pop    %esi
+ 6a7:	5f                   	pop    %edi
+ 6a8:	5d                   	pop    %ebp
+ 6a9:	c3                   	ret
+ 6aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000006b0 <stat>:
+{
+ 6b0:	55                   	push   %ebp
+ 6b1:	89 e5                	mov    %esp,%ebp
+ 6b3:	57                   	push   %edi
+ 6b4:	56                   	push   %esi
+ 6b5:	53                   	push   %ebx
+ 6b6:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+ 6b9:	6a 00                	push   $0x0
+ 6bb:	ff 75 08             	push   0x8(%ebp)
+ 6be:	e8 76 01 00 00       	call   839 <open>
+  if(fd < 0)
+ 6c3:	83 c4 10             	add    $0x10,%esp
+ 6c6:	85 c0                	test   %eax,%eax
+ 6c8:	78 76                	js     740 <stat+0x90>
+  r = fstat(fd, st);
+ 6ca:	83 ec 08             	sub    $0x8,%esp
+ 6cd:	ff 75 0c             	push   0xc(%ebp)
+ 6d0:	89 c3                	mov    %eax,%ebx
+ 6d2:	50                   	push   %eax
+ 6d3:	e8 7f 01 00 00       	call   857 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 6d8:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 6db:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 6dd:	83 fb 0f             	cmp    $0xf,%ebx
+ 6e0:	7f 40                	jg     722 <stat+0x72>
+ 6e2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 6e8:	8b 90 24 ad 00 00    	mov    0xad24(%eax),%edx
+ 6ee:	8d b8 20 ad 00 00    	lea    0xad20(%eax),%edi
+ 6f4:	85 d2                	test   %edx,%edx
+ 6f6:	7e 1a                	jle    712 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 6f8:	83 ec 04             	sub    $0x4,%esp
+ 6fb:	05 28 ad 00 00       	add    $0xad28,%eax
+ 700:	52                   	push   %edx
+ 701:	50                   	push   %eax
+ 702:	53                   	push   %ebx
+ 703:	e8 15 01 00 00       	call   81d <write>
+    ob[fd].n = 0;
+ 708:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+ 70f:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+ 712:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 718:	c7 80 20 ad 00 00 00 	movl   $0x0,0xad20(%eax)
+ 71f:	00 00 00 
+  return _close(fd);
+ 722:	83 ec 0c             	sub    $0xc,%esp
+ 725:	53                   	push   %ebx
+ 726:	e8 f9 00 00 00       	call   824 <_close>
+ 72b:	83 c4 10             	add    $0x10,%esp
+}
+ 72e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 731:	89 f0                	mov    %esi,%eax
+ 733:	5b                   	pop    %ebx
+ 734:	5e                   	pop    %esi
+ 735:	5f                   	pop    %edi
+ 736:	5d                   	pop    %ebp
+ 737:	c3                   	ret
+ 738:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73f:	90                   	nop
+    return -1;
+ 740:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 745:	eb e7                	jmp    72e <stat+0x7e>
+ 747:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74e:	66 90                	xchg   %ax,%ax
+
+00000750 <atoi>:
+{
+ 750:	55                   	push   %ebp
+ 751:	89 e5                	mov    %esp,%ebp
+ 753:	53                   	push   %ebx
+ 754:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 757:	0f be 02             	movsbl (%edx),%eax
+ 75a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 75d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 760:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 765:	77 1e                	ja     785 <atoi+0x35>
+ 767:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 770:	83 c2 01             	add    $0x1,%edx
+ 773:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 776:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 77a:	0f be 02             	movsbl (%edx),%eax
+ 77d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 780:	80 fb 09             	cmp    $0x9,%bl
+ 783:	76 eb                	jbe    770 <atoi+0x20>
+}
+ 785:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 788:	89 c8                	mov    %ecx,%eax
+ 78a:	c9                   	leave
+ 78b:	c3                   	ret
+ 78c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000790 <memmove>:
+{
+ 790:	55                   	push   %ebp
+ 791:	89 e5                	mov    %esp,%ebp
+ 793:	57                   	push   %edi
+ 794:	56                   	push   %esi
+ 795:	8b 45 10             	mov    0x10(%ebp),%eax
+ 798:	8b 55 08             	mov    0x8(%ebp),%edx
+ 79b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 79e:	85 c0                	test   %eax,%eax
+ 7a0:	7e 13                	jle    7b5 <memmove+0x25>
+ 7a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 7a4:	89 d7                	mov    %edx,%edi
+ 7a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 7b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 7b1:	39 f8                	cmp    %edi,%eax
+ 7b3:	75 fb                	jne    7b0 <memmove+0x20>
+  return vdst;
+}
+ 7b5:	5e                   	pop    %esi
+ 7b6:	89 d0                	mov    %edx,%eax
+ 7b8:	5f                   	pop    %edi
+ 7b9:	5d                   	pop    %ebp
+ 7ba:	c3                   	ret
+
+000007bb <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+ 7bb:	83 3d 08 15 00 00 00 	cmpl   $0x0,0x1508
+  jle 1f
+ 7c2:	7e 0a                	jle    7ce <syscallentry+0x13>
+  movl %esp, %ecx
+ 7c4:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 7c6:	ba cd 07 00 00       	mov    $0x7cd,%edx
+  sysenter
+ 7cb:	0f 34                	sysenter
+2:
+  ret
+ 7cd:	c3                   	ret
+1:
+  jl 3f
+ 7ce:	7c 27                	jl     7f7 <syscallentry+0x3c>
+  pushal
+ 7d0:	60                   	pusha
+  movl $1, %eax
+ 7d1:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 7d6:	0f a2                	cpuid
+  movl $-1, sysentermode
+ 7d8:	c7 05 08 15 00 00 ff 	movl   $0xffffffff,0x1508
+ 7df:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 7e2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+ 7e8:	74 0a                	je     7f4 <syscallentry+0x39>
+  movl $1, sysentermode
+ 7ea:	c7 05 08 15 00 00 01 	movl   $0x1,0x1508
+ 7f1:	00 00 00 
+4:
+  popal
+ 7f4:	61                   	popa
+  jmp syscallentry
+ 7f5:	eb c4                	jmp    7bb <syscallentry>
+3:
+  int $T_SYSCALL
+ 7f7:	cd 40                	int    $0x40
+  ret
+ 7f9:	c3                   	ret
+
+000007fa <_fork>:
+
+SYSCALLAS(_fork, fork)
+ 7fa:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7ff:	eb ba                	jmp    7bb <syscallentry>
+
+00000801 <_exit>:
+SYSCALLAS(_exit, exit)
+ 801:	b8 02 00 00 00       	mov    $0x2,%eax
+ 806:	eb b3                	jmp    7bb <syscallentry>
+
+00000808 <wait>:
+SYSCALL(wait)
+ 808:	b8 03 00 00 00       	mov    $0x3,%eax
+ 80d:	eb ac                	jmp    7bb <syscallentry>
+
+0000080f <pipe>:
+SYSCALL(pipe)
+ 80f:	b8 04 00 00 00       	mov    $0x4,%eax
+ 814:	eb a5                	jmp    7bb <syscallentry>
+
+00000816 <read>:
+SYSCALL(read)
+ 816:	b8 05 00 00 00       	mov    $0x5,%eax
+ 81b:	eb 9e                	jmp    7bb <syscallentry>
+
+0000081d <write>:
+SYSCALL(write)
+ 81d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 822:	eb 97                	jmp    7bb <syscallentry>
+
+00000824 <_close>:
+SYSCALLAS(_close, close)
+ 824:	b8 15 00 00 00       	mov    $0x15,%eax
+ 829:	eb 90                	jmp    7bb <syscallentry>
+
+0000082b <kill>:
+SYSCALL(kill)
+ 82b:	b8 06 00 00 00       	mov    $0x6,%eax
+ 830:	eb 89                	jmp    7bb <syscallentry>
+
+00000832 <_exec>:
+SYSCALLAS(_exec, exec)
+ 832:	b8 07 00 00 00       	mov    $0x7,%eax
+ 837:	eb 82                	jmp    7bb <syscallentry>
+
+00000839 <open>:
+SYSCALL(open)
+ 839:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 83e:	e9 78 ff ff ff       	jmp    7bb <syscallentry>
+
+00000843 <mknod>:
+SYSCALL(mknod)
+ 843:	b8 11 00 00 00       	mov    $0x11,%eax
+ 848:	e9 6e ff ff ff       	jmp    7bb <syscallentry>
+
+0000084d <unlink>:
+SYSCALL(unlink)
+ 84d:	b8 12 00 00 00       	mov    $0x12,%eax
+ 852:	e9 64 ff ff ff       	jmp    7bb <syscallentry>
+
+00000857 <fstat>:
+SYSCALL(fstat)
+ 857:	b8 08 00 00 00       	mov    $0x8,%eax
+ 85c:	e9 5a ff ff ff       	jmp    7bb <syscallentry>
+
+00000861 <link>:
+SYSCALL(link)
+ 861:	b8 13 00 00 00       	mov    $0x13,%eax
+ 866:	e9 50 ff ff ff       	jmp    7bb <syscallentry>
+
+0000086b <mkdir>:
+SYSCALL(mkdir)
+ 86b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 870:	e9 46 ff ff ff       	jmp    7bb <syscallentry>
+
+00000875 <chdir>:
+SYSCALL(chdir)
+ 875:	b8 09 00 00 00       	mov    $0x9,%eax
+ 87a:	e9 3c ff ff ff       	jmp    7bb <syscallentry>
+
+0000087f <dup>:
+SYSCALL(dup)
+ 87f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 884:	e9 32 ff ff ff       	jmp    7bb <syscallentry>
+
+00000889 <getpid>:
+SYSCALL(getpid)
+ 889:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 88e:	e9 28 ff ff ff       	jmp    7bb <syscallentry>
+
+00000893 <sbrk>:
+SYSCALL(sbrk)
+ 893:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 898:	e9 1e ff ff ff       	jmp    7bb <syscallentry>
+
+0000089d <sleep>:
+SYSCALL(sleep)
+ 89d:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 8a2:	e9 14 ff ff ff       	jmp    7bb <syscallentry>
+
+000008a7 <uptime>:
+SYSCALL(uptime)
+ 8a7:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 8ac:	e9 0a ff ff ff       	jmp    7bb <syscallentry>
+
+000008b1 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+ 8b1:	b8 16 00 00 00       	mov    $0x16,%eax
+ 8b6:	e9 00 ff ff ff       	jmp    7bb <syscallentry>
+
+000008bb <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+ 8bb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 8c0:	e9 f6 fe ff ff       	jmp    7bb <syscallentry>
+
+000008c5 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+ 8c5:	b8 18 00 00 00       	mov    $0x18,%eax
+ 8ca:	e9 ec fe ff ff       	jmp    7bb <syscallentry>
+
+000008cf <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+ 8cf:	b8 19 00 00 00       	mov    $0x19,%eax
+ 8d4:	e9 e2 fe ff ff       	jmp    7bb <syscallentry>
+
+000008d9 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+ 8d9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 8de:	e9 d8 fe ff ff       	jmp    7bb <syscallentry>
+
+000008e3 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+ 8e3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 8e8:	e9 ce fe ff ff       	jmp    7bb <syscallentry>
+
+000008ed <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+ 8ed:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 8f2:	e9 c4 fe ff ff       	jmp    7bb <syscallentry>
+
+000008f7 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+ 8f7:	b8 20 00 00 00       	mov    $0x20,%eax
+ 8fc:	e9 ba fe ff ff       	jmp    7bb <syscallentry>
+
+00000901 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+ 901:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 906:	e9 b0 fe ff ff       	jmp    7bb <syscallentry>
+
+0000090b <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+ 90b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 910:	e9 a6 fe ff ff       	jmp    7bb <syscallentry>
+
+00000915 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+ 915:	b8 21 00 00 00       	mov    $0x21,%eax
+ 91a:	e9 9c fe ff ff       	jmp    7bb <syscallentry>
+
+0000091f <yield>:
+SYSCALL(yield) // yield the CPU to another process
+ 91f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 924:	e9 92 fe ff ff       	jmp    7bb <syscallentry>
+
+00000929 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+ 929:	b8 23 00 00 00       	mov    $0x23,%eax
+ 92e:	e9 88 fe ff ff       	jmp    7bb <syscallentry>
+
+00000933 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+ 933:	b8 24 00 00 00       	mov    $0x24,%eax
+ 938:	e9 7e fe ff ff       	jmp    7bb <syscallentry>
+
+0000093d <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+ 93d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 942:	e9 74 fe ff ff       	jmp    7bb <syscallentry>
+
+00000947 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+ 947:	b8 26 00 00 00       	mov    $0x26,%eax
+ 94c:	e9 6a fe ff ff       	jmp    7bb <syscallentry>
+
+00000951 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+ 951:	b8 27 00 00 00       	mov    $0x27,%eax
+ 956:	e9 60 fe ff ff       	jmp    7bb <syscallentry>
+
+0000095b <mmap>:
+SYSCALL(mmap) // map a file into memory
+ 95b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 960:	e9 56 fe ff ff       	jmp    7bb <syscallentry>
+
+00000965 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+ 965:	b8 29 00 00 00       	mov    $0x29,%eax
+ 96a:	e9 4c fe ff ff       	jmp    7bb <syscallentry>
+
+0000096f <readv>:
+SYSCALL(readv) // read into several buffers
+ 96f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 974:	e9 42 fe ff ff       	jmp    7bb <syscallentry>
+
+00000979 <writev>:
+SYSCALL(writev) // write from several buffers
+ 979:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 97e:	e9 38 fe ff ff       	jmp    7bb <syscallentry>
+
+00000983 <pread>:
+SYSCALL(pread) // read at an offset
+ 983:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 988:	e9 2e fe ff ff       	jmp    7bb <syscallentry>
+
+0000098d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+ 98d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 992:	e9 24 fe ff ff       	jmp    7bb <syscallentry>
+
+00000997 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+ 997:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 99c:	e9 1a fe ff ff       	jmp    7bb <syscallentry>
+
+000009a1 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+ 9a1:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 9a6:	e9 10 fe ff ff       	jmp    7bb <syscallentry>
+
+000009ab <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+ 9ab:	b8 30 00 00 00       	mov    $0x30,%eax
+ 9b0:	e9 06 fe ff ff       	jmp    7bb <syscallentry>
+
+000009b5 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+ 9b5:	b8 31 00 00 00       	mov    $0x31,%eax
+ 9ba:	e9 fc fd ff ff       	jmp    7bb <syscallentry>
+
+000009bf <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+ 9bf:	b8 32 00 00 00       	mov    $0x32,%eax
+ 9c4:	e9 f2 fd ff ff       	jmp    7bb <syscallentry>
+
+000009c9 <profread>:
+SYSCALL(profread) // drain profiler samples
+ 9c9:	b8 33 00 00 00       	mov    $0x33,%eax
+ 9ce:	e9 e8 fd ff ff       	jmp    7bb <syscallentry>
+
+000009d3 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+ 9d3:	b8 34 00 00 00       	mov    $0x34,%eax
+ 9d8:	e9 de fd ff ff       	jmp    7bb <syscallentry>
+
+000009dd <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+ 9dd:	b8 35 00 00 00       	mov    $0x35,%eax
+ 9e2:	e9 d4 fd ff ff       	jmp    7bb <syscallentry>
+
+000009e7 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+ 9e7:	b8 36 00 00 00       	mov    $0x36,%eax
+ 9ec:	e9 ca fd ff ff       	jmp    7bb <syscallentry>
+
+000009f1 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+ 9f1:	b8 37 00 00 00       	mov    $0x37,%eax
+ 9f6:	e9 c0 fd ff ff       	jmp    7bb <syscallentry>
+ 9fb:	66 90                	xchg   %ax,%ax
+ 9fd:	66 90                	xchg   %ax,%ax
+ 9ff:	90                   	nop
+
+00000a00 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a00:	55                   	push   %ebp
+ a01:	89 e5                	mov    %esp,%ebp
+ a03:	57                   	push   %edi
+ a04:	56                   	push   %esi
+ a05:	53                   	push   %ebx
+ a06:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ a08:	89 d1                	mov    %edx,%ecx
+{
+ a0a:	83 ec 3c             	sub    $0x3c,%esp
+ a0d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ a10:	85 d2                	test   %edx,%edx
+ a12:	0f 89 80 00 00 00    	jns    a98 <printint+0x98>
+ a18:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ a1c:	74 7a                	je     a98 <printint+0x98>
+    x = -xx;
+ a1e:	f7 d9                	neg    %ecx
+    neg = 1;
+ a20:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ a25:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ a28:	31 f6                	xor    %esi,%esi
+ a2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ a30:	89 c8                	mov    %ecx,%eax
+ a32:	31 d2                	xor    %edx,%edx
+ a34:	89 f7                	mov    %esi,%edi
+ a36:	f7 f3                	div    %ebx
+ a38:	8d 76 01             	lea    0x1(%esi),%esi
+ a3b:	0f b6 92 78 10 00 00 	movzbl 0x1078(%edx),%edx
+ a42:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ a46:	89 ca                	mov    %ecx,%edx
+ a48:	89 c1                	mov    %eax,%ecx
+ a4a:	39 da                	cmp    %ebx,%edx
+ a4c:	73 e2                	jae    a30 <printint+0x30>
+  if(neg)
+ a4e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ a51:	85 c0                	test   %eax,%eax
+ a53:	74 07                	je     a5c <printint+0x5c>
+    buf[i++] = '-';
+ a55:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ a5a:	89 f7                	mov    %esi,%edi
+ a5c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ a5f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ a62:	01 df                	add    %ebx,%edi
+ a64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ a68:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+ a6b:	83 ec 04             	sub    $0x4,%esp
+ a6e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ a71:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ a74:	6a 01                	push   $0x1
+ a76:	50                   	push   %eax
+ a77:	56                   	push   %esi
+ a78:	e8 e3 f6 ff ff       	call   160 <bufwrite>
+  while(--i >= 0)
+ a7d:	89 f8                	mov    %edi,%eax
+ a7f:	83 c4 10             	add    $0x10,%esp
+ a82:	83 ef 01             	sub    $0x1,%edi
+ a85:	39 d8                	cmp    %ebx,%eax
+ a87:	75 df                	jne    a68 <printint+0x68>
+}
+ a89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a8c:	5b                   	pop    %ebx
+ a8d:	5e                   	pop    %esi
+ a8e:	5f                   	pop    %edi
+ a8f:	5d                   	pop    %ebp
+ a90:	c3                   	ret
+ a91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ a98:	31 c0                	xor    %eax,%eax
+ a9a:	eb 89                	jmp    a25 <printint+0x25>
+ a9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000aa0 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ aa0:	55                   	push   %ebp
+ aa1:	89 e5                	mov    %esp,%ebp
+ aa3:	57                   	push   %edi
+ aa4:	56                   	push   %esi
+ aa5:	53                   	push   %ebx
+ aa6:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ aa9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ aac:	0f b6 18             	movzbl (%eax),%ebx
+ aaf:	84 db                	test   %bl,%bl
+ ab1:	74 6c                	je     b1f <printf+0x7f>
+ ab3:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+ ab6:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ ab9:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ abb:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ abe:	eb 26                	jmp    ae6 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ ac0:	83 f8 25             	cmp    $0x25,%eax
+ ac3:	74 4b                	je     b10 <printf+0x70>
+  bufwrite(fd, &c, 1);
+ ac5:	83 ec 04             	sub    $0x4,%esp
+ ac8:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ acb:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ ace:	6a 01                	push   $0x1
+ ad0:	50                   	push   %eax
+ ad1:	ff 75 08             	push   0x8(%ebp)
+ ad4:	e8 87 f6 ff ff       	call   160 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+ ad9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ adc:	0f b6 1f             	movzbl (%edi),%ebx
+ adf:	83 c7 01             	add    $0x1,%edi
+ ae2:	84 db                	test   %bl,%bl
+ ae4:	74 39                	je     b1f <printf+0x7f>
+    c = fmt[i] & 0xff;
+ ae6:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ ae9:	85 f6                	test   %esi,%esi
+ aeb:	74 d3                	je     ac0 <printf+0x20>
+      }
+    } else if(state == '%'){
+ aed:	83 fe 25             	cmp    $0x25,%esi
+ af0:	75 ea                	jne    adc <printf+0x3c>
+      if(c == 'd'){
+ af2:	83 f8 25             	cmp    $0x25,%eax
+ af5:	0f 84 d5 01 00 00    	je     cd0 <printf+0x230>
+ afb:	83 e8 63             	sub    $0x63,%eax
+ afe:	83 f8 15             	cmp    $0x15,%eax
+ b01:	77 45                	ja     b48 <printf+0xa8>
+ b03:	ff 24 85 20 10 00 00 	jmp    *0x1020(,%eax,4)
+ b0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+ b10:	0f b6 1f             	movzbl (%edi),%ebx
+ b13:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+ b16:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ b1b:	84 db                	test   %bl,%bl
+ b1d:	75 c7                	jne    ae6 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+ b1f:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+ b23:	74 0b                	je     b30 <printf+0x90>
+    fflush(fd);
+}
+ b25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b28:	5b                   	pop    %ebx
+ b29:	5e                   	pop    %esi
+ b2a:	5f                   	pop    %edi
+ b2b:	5d                   	pop    %ebp
+ b2c:	c3                   	ret
+ b2d:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+ b30:	83 ec 0c             	sub    $0xc,%esp
+ b33:	6a 02                	push   $0x2
+ b35:	e8 c6 f7 ff ff       	call   300 <fflush>
+ b3a:	83 c4 10             	add    $0x10,%esp
+}
+ b3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b40:	5b                   	pop    %ebx
+ b41:	5e                   	pop    %esi
+ b42:	5f                   	pop    %edi
+ b43:	5d                   	pop    %ebp
+ b44:	c3                   	ret
+ b45:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+ b48:	83 ec 04             	sub    $0x4,%esp
+ b4b:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ b4e:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+ b52:	6a 01                	push   $0x1
+ b54:	52                   	push   %edx
+ b55:	89 55 c0             	mov    %edx,-0x40(%ebp)
+ b58:	ff 75 08             	push   0x8(%ebp)
+ b5b:	e8 00 f6 ff ff       	call   160 <bufwrite>
+ b60:	83 c4 0c             	add    $0xc,%esp
+ b63:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ b66:	6a 01                	push   $0x1
+ b68:	8b 55 c0             	mov    -0x40(%ebp),%edx
+ b6b:	52                   	push   %edx
+      state = 0;
+ b6c:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+ b6e:	ff 75 08             	push   0x8(%ebp)
+ b71:	e8 ea f5 ff ff       	call   160 <bufwrite>
+        putc(fd, c);
+ b76:	83 c4 10             	add    $0x10,%esp
+ b79:	e9 5e ff ff ff       	jmp    adc <printf+0x3c>
+ b7e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+ b80:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ b83:	83 ec 0c             	sub    $0xc,%esp
+ b86:	b9 10 00 00 00       	mov    $0x10,%ecx
+ b8b:	8b 16                	mov    (%esi),%edx
+ b8d:	6a 00                	push   $0x0
+ b8f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+ b92:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+ b95:	e8 66 fe ff ff       	call   a00 <printint>
+        ap++;
+ b9a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ b9d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ ba0:	31 f6                	xor    %esi,%esi
+ ba2:	e9 35 ff ff ff       	jmp    adc <printf+0x3c>
+ ba7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bae:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+ bb0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ bb3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ bb5:	83 c0 04             	add    $0x4,%eax
+ bb8:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+ bbb:	b8 18 10 00 00       	mov    $0x1018,%eax
+ bc0:	85 db                	test   %ebx,%ebx
+ bc2:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+ bc5:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+ bc8:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+ bca:	53                   	push   %ebx
+ bcb:	e8 90 f9 ff ff       	call   560 <strlen>
+ bd0:	83 c4 0c             	add    $0xc,%esp
+ bd3:	50                   	push   %eax
+ bd4:	53                   	push   %ebx
+ bd5:	ff 75 08             	push   0x8(%ebp)
+ bd8:	e8 83 f5 ff ff       	call   160 <bufwrite>
+ bdd:	83 c4 10             	add    $0x10,%esp
+ be0:	e9 f7 fe ff ff       	jmp    adc <printf+0x3c>
+ be5:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ be8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+ beb:	83 ec 04             	sub    $0x4,%esp
+ bee:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+ bf1:	8b 06                	mov    (%esi),%eax
+        ap++;
+ bf3:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+ bf6:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+ bf9:	6a 01                	push   $0x1
+ bfb:	52                   	push   %edx
+ bfc:	ff 75 08             	push   0x8(%ebp)
+ bff:	e8 5c f5 ff ff       	call   160 <bufwrite>
+        ap++;
+ c04:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ c07:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c0a:	31 f6                	xor    %esi,%esi
+ c0c:	e9 cb fe ff ff       	jmp    adc <printf+0x3c>
+ c11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+ c18:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ c1b:	83 ec 0c             	sub    $0xc,%esp
+ c1e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ c23:	8b 16                	mov    (%esi),%edx
+ c25:	6a 01                	push   $0x1
+ c27:	e9 63 ff ff ff       	jmp    b8f <printf+0xef>
+ c2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+ c30:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ c33:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ c36:	89 7d c0             	mov    %edi,-0x40(%ebp)
+ c39:	89 55 bc             	mov    %edx,-0x44(%ebp)
+ c3c:	8b 18                	mov    (%eax),%ebx
+ c3e:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+ c41:	31 c0                	xor    %eax,%eax
+ c43:	89 c7                	mov    %eax,%edi
+ c45:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+ c48:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+ c4d:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+ c4f:	f7 e1                	mul    %ecx
+ c51:	c1 ea 03             	shr    $0x3,%edx
+ c54:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ c57:	89 d1                	mov    %edx,%ecx
+ c59:	01 c0                	add    %eax,%eax
+ c5b:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ c5d:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+ c5f:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ c61:	be 0a 00 00 00       	mov    $0xa,%esi
+ c66:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+ c68:	89 da                	mov    %ebx,%edx
+ c6a:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+ c6c:	89 fe                	mov    %edi,%esi
+ c6e:	83 c7 01             	add    $0x1,%edi
+ c71:	8d 42 30             	lea    0x30(%edx),%eax
+ c74:	89 da                	mov    %ebx,%edx
+ c76:	8d 14 92             	lea    (%edx,%edx,4),%edx
+ c79:	01 d2                	add    %edx,%edx
+ c7b:	29 d0                	sub    %edx,%eax
+ c7d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+ c81:	89 c8                	mov    %ecx,%eax
+ c83:	09 d8                	or     %ebx,%eax
+ c85:	75 c1                	jne    c48 <printf+0x1a8>
+ c87:	8b 55 bc             	mov    -0x44(%ebp),%edx
+ c8a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ c8d:	01 d6                	add    %edx,%esi
+ c8f:	89 f7                	mov    %esi,%edi
+ c91:	89 d6                	mov    %edx,%esi
+ c93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c97:	90                   	nop
+    putc(fd, buf[i]);
+ c98:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+ c9b:	83 ec 04             	sub    $0x4,%esp
+ c9e:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+ ca1:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+ ca4:	6a 01                	push   $0x1
+ ca6:	50                   	push   %eax
+ ca7:	53                   	push   %ebx
+ ca8:	e8 b3 f4 ff ff       	call   160 <bufwrite>
+  while(--i >= 0)
+ cad:	89 fa                	mov    %edi,%edx
+ caf:	83 c4 10             	add    $0x10,%esp
+ cb2:	83 ef 01             	sub    $0x1,%edi
+ cb5:	39 d6                	cmp    %edx,%esi
+ cb7:	75 df                	jne    c98 <printf+0x1f8>
+        ap += 2;
+ cb9:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+ cbd:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+ cc0:	31 f6                	xor    %esi,%esi
+ cc2:	e9 15 fe ff ff       	jmp    adc <printf+0x3c>
+ cc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cce:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+ cd0:	83 ec 04             	sub    $0x4,%esp
+ cd3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ cd6:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ cd9:	6a 01                	push   $0x1
+ cdb:	e9 8b fe ff ff       	jmp    b6b <printf+0xcb>
+
+00000ce0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ ce0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ce1:	a1 a0 bd 00 00       	mov    0xbda0,%eax
+{
+ ce6:	89 e5                	mov    %esp,%ebp
+ ce8:	57                   	push   %edi
+ ce9:	56                   	push   %esi
+ cea:	53                   	push   %ebx
+ ceb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ cee:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cf1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cf8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cfa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cfc:	39 ca                	cmp    %ecx,%edx
+ cfe:	73 30                	jae    d30 <free+0x50>
+ d00:	39 c1                	cmp    %eax,%ecx
+ d02:	72 04                	jb     d08 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d04:	39 c2                	cmp    %eax,%edx
+ d06:	72 f0                	jb     cf8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ d08:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ d0b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ d0e:	39 f8                	cmp    %edi,%eax
+ d10:	74 2e                	je     d40 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d12:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ d15:	8b 42 04             	mov    0x4(%edx),%eax
+ d18:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d1b:	39 f1                	cmp    %esi,%ecx
+ d1d:	74 38                	je     d57 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ d1f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ d21:	5b                   	pop    %ebx
+  freep = p;
+ d22:	89 15 a0 bd 00 00    	mov    %edx,0xbda0
+}
+ d28:	5e                   	pop    %esi
+ d29:	5f                   	pop    %edi
+ d2a:	5d                   	pop    %ebp
+ d2b:	c3                   	ret
+ d2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d30:	39 c1                	cmp    %eax,%ecx
+ d32:	72 d0                	jb     d04 <free+0x24>
+ d34:	eb c2                	jmp    cf8 <free+0x18>
+ d36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d3d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ d40:	03 70 04             	add    0x4(%eax),%esi
+ d43:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d46:	8b 02                	mov    (%edx),%eax
+ d48:	8b 00                	mov    (%eax),%eax
+ d4a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ d4d:	8b 42 04             	mov    0x4(%edx),%eax
+ d50:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d53:	39 f1                	cmp    %esi,%ecx
+ d55:	75 c8                	jne    d1f <free+0x3f>
+    p->s.size += bp->s.size;
+ d57:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ d5a:	89 15 a0 bd 00 00    	mov    %edx,0xbda0
+    p->s.size += bp->s.size;
+ d60:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ d63:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ d66:	89 0a                	mov    %ecx,(%edx)
+}
+ d68:	5b                   	pop    %ebx
+ d69:	5e                   	pop    %esi
+ d6a:	5f                   	pop    %edi
+ d6b:	5d                   	pop    %ebp
+ d6c:	c3                   	ret
+ d6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d70 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ d70:	55                   	push   %ebp
+ d71:	89 e5                	mov    %esp,%ebp
+ d73:	57                   	push   %edi
+ d74:	56                   	push   %esi
+ d75:	53                   	push   %ebx
+ d76:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d79:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ d7c:	8b 15 a0 bd 00 00    	mov    0xbda0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d82:	8d 78 07             	lea    0x7(%eax),%edi
+ d85:	c1 ef 03             	shr    $0x3,%edi
+ d88:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ d8b:	85 d2                	test   %edx,%edx
+ d8d:	0f 84 8d 00 00 00    	je     e20 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d93:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d95:	8b 48 04             	mov    0x4(%eax),%ecx
+ d98:	39 f9                	cmp    %edi,%ecx
+ d9a:	73 64                	jae    e00 <malloc+0x90>
+  if(nu < 4096)
+ d9c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ da1:	39 df                	cmp    %ebx,%edi
+ da3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ da6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ dad:	eb 0a                	jmp    db9 <malloc+0x49>
+ daf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ db0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ db2:	8b 48 04             	mov    0x4(%eax),%ecx
+ db5:	39 f9                	cmp    %edi,%ecx
+ db7:	73 47                	jae    e00 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ db9:	89 c2                	mov    %eax,%edx
+ dbb:	39 05 a0 bd 00 00    	cmp    %eax,0xbda0
+ dc1:	75 ed                	jne    db0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ dc3:	83 ec 0c             	sub    $0xc,%esp
+ dc6:	56                   	push   %esi
+ dc7:	e8 c7 fa ff ff       	call   893 <sbrk>
+  if(p == (char*)-1)
+ dcc:	83 c4 10             	add    $0x10,%esp
+ dcf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ dd2:	74 1c                	je     df0 <malloc+0x80>
+  hp->s.size = nu;
+ dd4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ dd7:	83 ec 0c             	sub    $0xc,%esp
+ dda:	83 c0 08             	add    $0x8,%eax
+ ddd:	50                   	push   %eax
+ dde:	e8 fd fe ff ff       	call   ce0 <free>
+  return freep;
+ de3:	8b 15 a0 bd 00 00    	mov    0xbda0,%edx
+      if((p = morecore(nunits)) == 0)
+ de9:	83 c4 10             	add    $0x10,%esp
+ dec:	85 d2                	test   %edx,%edx
+ dee:	75 c0                	jne    db0 <malloc+0x40>
+        return 0;
+  }
+}
+ df0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ df3:	31 c0                	xor    %eax,%eax
+}
+ df5:	5b                   	pop    %ebx
+ df6:	5e                   	pop    %esi
+ df7:	5f                   	pop    %edi
+ df8:	5d                   	pop    %ebp
+ df9:	c3                   	ret
+ dfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ e00:	39 cf                	cmp    %ecx,%edi
+ e02:	74 4c                	je     e50 <malloc+0xe0>
+        p->s.size -= nunits;
+ e04:	29 f9                	sub    %edi,%ecx
+ e06:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ e09:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ e0c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ e0f:	89 15 a0 bd 00 00    	mov    %edx,0xbda0
+}
+ e15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ e18:	83 c0 08             	add    $0x8,%eax
+}
+ e1b:	5b                   	pop    %ebx
+ e1c:	5e                   	pop    %esi
+ e1d:	5f                   	pop    %edi
+ e1e:	5d                   	pop    %ebp
+ e1f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ e20:	c7 05 a0 bd 00 00 a4 	movl   $0xbda4,0xbda0
+ e27:	bd 00 00 
+    base.s.size = 0;
+ e2a:	b8 a4 bd 00 00       	mov    $0xbda4,%eax
+    base.s.ptr = freep = prevp = &base;
+ e2f:	c7 05 a4 bd 00 00 a4 	movl   $0xbda4,0xbda4
+ e36:	bd 00 00 
+    base.s.size = 0;
+ e39:	c7 05 a8 bd 00 00 00 	movl   $0x0,0xbda8
+ e40:	00 00 00 
+    if(p->s.size >= nunits){
+ e43:	e9 54 ff ff ff       	jmp    d9c <malloc+0x2c>
+ e48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e4f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ e50:	8b 08                	mov    (%eax),%ecx
+ e52:	89 0a                	mov    %ecx,(%edx)
+ e54:	eb b9                	jmp    e0f <malloc+0x9f>
+ e56:	66 90                	xchg   %ax,%ax
+ e58:	66 90                	xchg   %ax,%ax
+ e5a:	66 90                	xchg   %ax,%ax
+ e5c:	66 90                	xchg   %ax,%ax
+ e5e:	66 90                	xchg   %ax,%ax
+
+00000e60 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+ e60:	55                   	push   %ebp
+ e61:	89 e5                	mov    %esp,%ebp
+ e63:	57                   	push   %edi
+ e64:	56                   	push   %esi
+ e65:	be 01 00 00 00       	mov    $0x1,%esi
+ e6a:	53                   	push   %ebx
+ e6b:	83 ec 28             	sub    $0x28,%esp
+ e6e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ e71:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ e74:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+ e77:	68 00 98 00 00       	push   $0x9800
+ e7c:	e8 ef fe ff ff       	call   d70 <malloc>
+ e81:	83 c4 10             	add    $0x10,%esp
+ e84:	89 c7                	mov    %eax,%edi
+ e86:	85 c0                	test   %eax,%eax
+ e88:	74 62                	je     eec <waitpoll+0x8c>
+ e8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+ e90:	83 ec 0c             	sub    $0xc,%esp
+ e93:	6a 01                	push   $0x1
+ e95:	e8 03 fa ff ff       	call   89d <sleep>
+    fn();
+ e9a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ e9d:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+ e9f:	58                   	pop    %eax
+ ea0:	5a                   	pop    %edx
+ ea1:	68 00 02 00 00       	push   $0x200
+ ea6:	57                   	push   %edi
+ ea7:	e8 eb fa ff ff       	call   997 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+ eac:	83 c4 10             	add    $0x10,%esp
+ eaf:	85 c0                	test   %eax,%eax
+ eb1:	7e 2d                	jle    ee0 <waitpoll+0x80>
+ eb3:	6b c0 4c             	imul   $0x4c,%eax,%eax
+ eb6:	89 fa                	mov    %edi,%edx
+    alive = 0;
+ eb8:	31 c9                	xor    %ecx,%ecx
+ eba:	01 f8                	add    %edi,%eax
+ ebc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+ ec0:	3b 1a                	cmp    (%edx),%ebx
+ ec2:	75 07                	jne    ecb <waitpoll+0x6b>
+        alive = 1;
+ ec4:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+ ec8:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+ ecb:	83 c2 4c             	add    $0x4c,%edx
+ ece:	39 d0                	cmp    %edx,%eax
+ ed0:	75 ee                	jne    ec0 <waitpoll+0x60>
+  } while(alive);
+ ed2:	85 c9                	test   %ecx,%ecx
+ ed4:	75 ba                	jne    e90 <waitpoll+0x30>
+ ed6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ edd:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+ ee0:	83 ec 0c             	sub    $0xc,%esp
+ ee3:	57                   	push   %edi
+ ee4:	e8 f7 fd ff ff       	call   ce0 <free>
+  wait();
+ ee9:	83 c4 10             	add    $0x10,%esp
+}
+ eec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ eef:	5b                   	pop    %ebx
+ ef0:	5e                   	pop    %esi
+ ef1:	5f                   	pop    %edi
+ ef2:	5d                   	pop    %ebp
+  wait();
+ ef3:	e9 10 f9 ff ff       	jmp    808 <wait>
+ ef8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ eff:	90                   	nop
+
+00000f00 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+ f00:	55                   	push   %ebp
+ f01:	89 e5                	mov    %esp,%ebp
+ f03:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+ f06:	c7 45 f0 89 10 00 00 	movl   $0x1089,-0x10(%ebp)
+ f0d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+ f14:	e8 87 f4 ff ff       	call   3a0 <fork>
+ f19:	85 c0                	test   %eax,%eax
+ f1b:	78 09                	js     f26 <runps+0x26>
+    return -1;
+  if(pid == 0){
+ f1d:	74 0e                	je     f2d <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+ f1f:	e8 e4 f8 ff ff       	call   808 <wait>
+}
+ f24:	c9                   	leave
+ f25:	c3                   	ret
+ f26:	c9                   	leave
+    return -1;
+ f27:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ f2c:	c3                   	ret
+    exec("ps", argv);
+ f2d:	50                   	push   %eax
+ f2e:	50                   	push   %eax
+ f2f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ f32:	50                   	push   %eax
+ f33:	68 89 10 00 00       	push   $0x1089
+ f38:	e8 c3 f4 ff ff       	call   400 <exec>
+    printf(2, "exec ps failed\n");
+ f3d:	5a                   	pop    %edx
+ f3e:	59                   	pop    %ecx
+ f3f:	68 8c 10 00 00       	push   $0x108c
+ f44:	6a 02                	push   $0x2
+ f46:	e8 55 fb ff ff       	call   aa0 <printf>
+    exit();
+ f4b:	e8 a0 f4 ff ff       	call   3f0 <exit>
@@ -1,10 +1,42 @@
 #include "types.h"
 #include "stat.h"
 #include "user.h"
+#include "x86.h"
+#include "param.h"
+#include "procinfo.h"
 
+static char *states[] = {
+[PS_UNUSED]    "UNUSED  ",
+[PS_EMBRYO]    "EMBRYO  ",
+[PS_SLEEPING]  "SLEEPING",
+[PS_RUNNABLE]  "RUNNABLE",
+[PS_RUNNING]   "RUNNING ",
+[PS_ZOMBIE]    "ZOMBIE  "
+};
+
+struct procinfo pi[NPROC];
+
+// Print the process table, from a getprocinfo() snapshot.
 int
 main(int argc, char *argv[])
 {
-  ps();
+  struct procinfo *p;
+  int n;
+
+  if((n = getprocinfo(pi, NPROC)) < 0){
+    printf(2, "ps: getprocinfo failed\n");
+    exit();
+  }
+  printf(1, "PID\tSTATE\t\tPRIO\tRUN ms\tSLEEP ms\tCALLS\tBURST\tTICKS\tCPU\tNAME\n");
+  for(p = pi; p < pi + n; p++){
+    printf(1, "%d\t%s\t%d\t%l\t%l\t\t%d\t%d\t%d\t", p->pid,
+           states[p->state], p->priority, div64(p->runtime, 1000),
+           div64(p->sleeptime, 1000), p->syscalls, p->estimated_burst, p->ticks);
+    if(p->cpu < 0)
+      printf(1, "-");
+    else
+      printf(1, "%d", p->cpu);
+    printf(1, "\t%s\n", p->name);
+  }
   exit();
 }
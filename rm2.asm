@@ -0,0 +1,1986 @@
+
+_rm2:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 01 00 00 00       	mov    $0x1,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1c:	8b 31                	mov    (%ecx),%esi
+  1e:	83 c3 04             	add    $0x4,%ebx
+  int i;
+
+  if(argc < 2){
+  21:	83 fe 01             	cmp    $0x1,%esi
+  24:	7f 14                	jg     3a <main+0x3a>
+  26:	eb 3a                	jmp    62 <main+0x62>
+  28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+    printf(2, "Usage: rm files...\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	83 c7 01             	add    $0x1,%edi
+  33:	83 c3 04             	add    $0x4,%ebx
+  36:	39 fe                	cmp    %edi,%esi
+  38:	74 23                	je     5d <main+0x5d>
+    if(unlink(argv[i]) < 0){
+  3a:	83 ec 0c             	sub    $0xc,%esp
+  3d:	ff 33                	push   (%ebx)
+  3f:	e8 29 07 00 00       	call   76d <unlink>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	85 c0                	test   %eax,%eax
+  49:	79 e5                	jns    30 <main+0x30>
+      printf(2, "rm: %s failed to delete\n", argv[i]);
+  4b:	50                   	push   %eax
+  4c:	ff 33                	push   (%ebx)
+  4e:	68 84 0e 00 00       	push   $0xe84
+  53:	6a 02                	push   $0x2
+  55:	e8 66 09 00 00       	call   9c0 <printf>
+      break;
+  5a:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+  5d:	e8 ae 02 00 00       	call   310 <exit>
+    printf(2, "Usage: rm files...\n");
+  62:	52                   	push   %edx
+  63:	52                   	push   %edx
+  64:	68 70 0e 00 00       	push   $0xe70
+  69:	6a 02                	push   $0x2
+  6b:	e8 50 09 00 00       	call   9c0 <printf>
+    exit();
+  70:	e8 9b 02 00 00       	call   310 <exit>
+  75:	66 90                	xchg   %ax,%ax
+  77:	66 90                	xchg   %ax,%ax
+  79:	66 90                	xchg   %ax,%ax
+  7b:	66 90                	xchg   %ax,%ax
+  7d:	66 90                	xchg   %ax,%ax
+  7f:	90                   	nop
+
+00000080 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+  80:	55                   	push   %ebp
+  81:	89 e5                	mov    %esp,%ebp
+  83:	57                   	push   %edi
+  84:	56                   	push   %esi
+  85:	53                   	push   %ebx
+  86:	83 ec 4c             	sub    $0x4c,%esp
+  89:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  8f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  92:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+  95:	83 fa 0f             	cmp    $0xf,%edx
+  98:	0f 87 32 01 00 00    	ja     1d0 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+  9e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+  a4:	8b 80 a0 13 00 00    	mov    0x13a0(%eax),%eax
+  aa:	85 c0                	test   %eax,%eax
+  ac:	0f 84 de 00 00 00    	je     190 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+  b2:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+  b8:	8b b0 a4 13 00 00    	mov    0x13a4(%eax),%esi
+  be:	8d 88 a0 13 00 00    	lea    0x13a0(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+  c4:	8d b8 a8 13 00 00    	lea    0x13a8(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+  ca:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+  cd:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+  d0:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+  d3:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+  d9:	0f 8f 01 01 00 00    	jg     1e0 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+  df:	8d 78 08             	lea    0x8(%eax),%edi
+  e2:	8d bc 3e a0 13 00 00 	lea    0x13a0(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+  e9:	85 db                	test   %ebx,%ebx
+  eb:	7e 3b                	jle    128 <bufwrite+0xa8>
+  ed:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+  f0:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  f7:	90                   	nop
+    *dst++ = *src++;
+  f8:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+  f9:	39 c6                	cmp    %eax,%esi
+  fb:	75 fb                	jne    f8 <bufwrite+0x78>
+  ob[fd].n += n;
+  fd:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 103:	8b 88 a4 13 00 00    	mov    0x13a4(%eax),%ecx
+ 109:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 10b:	83 b8 a0 13 00 00 01 	cmpl   $0x1,0x13a0(%eax)
+  ob[fd].n += n;
+ 112:	89 88 a4 13 00 00    	mov    %ecx,0x13a4(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 118:	74 26                	je     140 <bufwrite+0xc0>
+}
+ 11a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 11d:	5b                   	pop    %ebx
+ 11e:	5e                   	pop    %esi
+ 11f:	5f                   	pop    %edi
+ 120:	5d                   	pop    %ebp
+ 121:	c3                   	ret
+ 122:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+ 128:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 12b:	83 b8 a0 13 00 00 01 	cmpl   $0x1,0x13a0(%eax)
+  ob[fd].n += n;
+ 132:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 135:	75 e3                	jne    11a <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+ 137:	85 db                	test   %ebx,%ebx
+ 139:	74 df                	je     11a <bufwrite+0x9a>
+ 13b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 13f:	90                   	nop
+  src = vsrc;
+ 140:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 143:	01 c3                	add    %eax,%ebx
+ 145:	eb 10                	jmp    157 <bufwrite+0xd7>
+ 147:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14e:	66 90                	xchg   %ax,%ax
+ 150:	83 c0 01             	add    $0x1,%eax
+ 153:	39 d8                	cmp    %ebx,%eax
+ 155:	74 c3                	je     11a <bufwrite+0x9a>
+    if(*p == (char)c)
+ 157:	80 38 0a             	cmpb   $0xa,(%eax)
+ 15a:	75 f4                	jne    150 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 15c:	85 c9                	test   %ecx,%ecx
+ 15e:	7e ba                	jle    11a <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 160:	83 ec 04             	sub    $0x4,%esp
+ 163:	51                   	push   %ecx
+ 164:	ff 75 ac             	push   -0x54(%ebp)
+ 167:	52                   	push   %edx
+ 168:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+ 16b:	e8 cd 05 00 00       	call   73d <write>
+    ob[fd].n = 0;
+ 170:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+ 173:	83 c4 10             	add    $0x10,%esp
+ 176:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+ 17c:	c7 82 a4 13 00 00 00 	movl   $0x0,0x13a4(%edx)
+ 183:	00 00 00 
+ 186:	eb 92                	jmp    11a <bufwrite+0x9a>
+ 188:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18f:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 190:	83 ec 08             	sub    $0x8,%esp
+ 193:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 196:	50                   	push   %eax
+ 197:	52                   	push   %edx
+ 198:	89 55 b0             	mov    %edx,-0x50(%ebp)
+ 19b:	e8 d7 05 00 00       	call   777 <fstat>
+ 1a0:	83 c4 10             	add    $0x10,%esp
+ 1a3:	8b 55 b0             	mov    -0x50(%ebp),%edx
+ 1a6:	89 c1                	mov    %eax,%ecx
+ 1a8:	b8 02 00 00 00       	mov    $0x2,%eax
+ 1ad:	85 c9                	test   %ecx,%ecx
+ 1af:	75 0d                	jne    1be <bufwrite+0x13e>
+ 1b1:	31 c0                	xor    %eax,%eax
+ 1b3:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 1b8:	0f 95 c0             	setne  %al
+ 1bb:	83 c0 01             	add    $0x1,%eax
+ 1be:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+ 1c4:	89 81 a0 13 00 00    	mov    %eax,0x13a0(%ecx)
+ 1ca:	e9 e3 fe ff ff       	jmp    b2 <bufwrite+0x32>
+ 1cf:	90                   	nop
+}
+ 1d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1d3:	5b                   	pop    %ebx
+ 1d4:	5e                   	pop    %esi
+ 1d5:	5f                   	pop    %edi
+ 1d6:	5d                   	pop    %ebp
+    write(fd, p, n);
+ 1d7:	e9 61 05 00 00       	jmp    73d <write>
+ 1dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+ 1e0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+ 1e3:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+ 1e6:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+ 1e9:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+ 1ec:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+ 1ef:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+ 1f2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+ 1f5:	6a 02                	push   $0x2
+ 1f7:	50                   	push   %eax
+ 1f8:	52                   	push   %edx
+ 1f9:	e8 9b 06 00 00       	call   899 <writev>
+    ob[fd].n = 0;
+ 1fe:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+ 201:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+ 204:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ 20b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 20e:	5b                   	pop    %ebx
+ 20f:	5e                   	pop    %esi
+ 210:	5f                   	pop    %edi
+ 211:	5d                   	pop    %ebp
+ 212:	c3                   	ret
+ 213:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000220 <fflush>:
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	53                   	push   %ebx
+ 224:	83 ec 04             	sub    $0x4,%esp
+ 227:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 22a:	83 f8 0f             	cmp    $0xf,%eax
+ 22d:	77 16                	ja     245 <fflush+0x25>
+ 22f:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+ 235:	8b 8a a4 13 00 00    	mov    0x13a4(%edx),%ecx
+ 23b:	8d 9a a0 13 00 00    	lea    0x13a0(%edx),%ebx
+ 241:	85 c9                	test   %ecx,%ecx
+ 243:	7f 0b                	jg     250 <fflush+0x30>
+}
+ 245:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 248:	c9                   	leave
+ 249:	c3                   	ret
+ 24a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 250:	83 ec 04             	sub    $0x4,%esp
+ 253:	81 c2 a8 13 00 00    	add    $0x13a8,%edx
+ 259:	51                   	push   %ecx
+ 25a:	52                   	push   %edx
+ 25b:	50                   	push   %eax
+ 25c:	e8 dc 04 00 00       	call   73d <write>
+    ob[fd].n = 0;
+ 261:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+ 268:	83 c4 10             	add    $0x10,%esp
+}
+ 26b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 26e:	c9                   	leave
+ 26f:	c3                   	ret
+
+00000270 <fflushall>:
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 274:	31 f6                	xor    %esi,%esi
+{
+ 276:	53                   	push   %ebx
+ 277:	bb a8 13 00 00       	mov    $0x13a8,%ebx
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 280:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 283:	85 c0                	test   %eax,%eax
+ 285:	7e 15                	jle    29c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 287:	83 ec 04             	sub    $0x4,%esp
+ 28a:	50                   	push   %eax
+ 28b:	53                   	push   %ebx
+ 28c:	56                   	push   %esi
+ 28d:	e8 ab 04 00 00       	call   73d <write>
+    ob[fd].n = 0;
+ 292:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 299:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 29c:	83 c6 01             	add    $0x1,%esi
+ 29f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 2a5:	83 fe 10             	cmp    $0x10,%esi
+ 2a8:	75 d6                	jne    280 <fflushall+0x10>
+}
+ 2aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2ad:	5b                   	pop    %ebx
+ 2ae:	5e                   	pop    %esi
+ 2af:	5d                   	pop    %ebp
+ 2b0:	c3                   	ret
+ 2b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bf:	90                   	nop
+
+000002c0 <fork>:
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 2c4:	31 f6                	xor    %esi,%esi
+{
+ 2c6:	53                   	push   %ebx
+ 2c7:	bb a8 13 00 00       	mov    $0x13a8,%ebx
+ 2cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 2d0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 2d3:	85 c0                	test   %eax,%eax
+ 2d5:	7e 15                	jle    2ec <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 2d7:	83 ec 04             	sub    $0x4,%esp
+ 2da:	50                   	push   %eax
+ 2db:	53                   	push   %ebx
+ 2dc:	56                   	push   %esi
+ 2dd:	e8 5b 04 00 00       	call   73d <write>
+    ob[fd].n = 0;
+ 2e2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 2e9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 2ec:	83 c6 01             	add    $0x1,%esi
+ 2ef:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 2f5:	83 fe 10             	cmp    $0x10,%esi
+ 2f8:	75 d6                	jne    2d0 <fork+0x10>
+}
+ 2fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2fd:	5b                   	pop    %ebx
+ 2fe:	5e                   	pop    %esi
+ 2ff:	5d                   	pop    %ebp
+  return _fork();
+ 300:	e9 15 04 00 00       	jmp    71a <_fork>
+ 305:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <exit>:
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+ 316:	e8 55 ff ff ff       	call   270 <fflushall>
+  _exit();
+ 31b:	e8 01 04 00 00       	call   721 <_exit>
+
+00000320 <exec>:
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	57                   	push   %edi
+ 324:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 325:	31 f6                	xor    %esi,%esi
+{
+ 327:	53                   	push   %ebx
+ 328:	bb a8 13 00 00       	mov    $0x13a8,%ebx
+ 32d:	83 ec 1c             	sub    $0x1c,%esp
+ 330:	8b 45 08             	mov    0x8(%ebp),%eax
+ 333:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 336:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 340:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 343:	85 c0                	test   %eax,%eax
+ 345:	7e 15                	jle    35c <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 347:	83 ec 04             	sub    $0x4,%esp
+ 34a:	50                   	push   %eax
+ 34b:	53                   	push   %ebx
+ 34c:	56                   	push   %esi
+ 34d:	e8 eb 03 00 00       	call   73d <write>
+    ob[fd].n = 0;
+ 352:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 359:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 35c:	83 c6 01             	add    $0x1,%esi
+ 35f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 365:	83 fe 10             	cmp    $0x10,%esi
+ 368:	75 d6                	jne    340 <exec+0x20>
+  return _exec(path, argv);
+ 36a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 36d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+ 370:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ 373:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 376:	5b                   	pop    %ebx
+ 377:	5e                   	pop    %esi
+ 378:	5f                   	pop    %edi
+ 379:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 37a:	e9 d3 03 00 00       	jmp    752 <_exec>
+ 37f:	90                   	nop
+
+00000380 <close>:
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	56                   	push   %esi
+ 384:	53                   	push   %ebx
+ 385:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 388:	83 fb 0f             	cmp    $0xf,%ebx
+ 38b:	77 26                	ja     3b3 <close+0x33>
+ 38d:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 393:	8b 90 a4 13 00 00    	mov    0x13a4(%eax),%edx
+ 399:	8d b0 a0 13 00 00    	lea    0x13a0(%eax),%esi
+ 39f:	85 d2                	test   %edx,%edx
+ 3a1:	7f 25                	jg     3c8 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+ 3a3:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 3a9:	c7 80 a0 13 00 00 00 	movl   $0x0,0x13a0(%eax)
+ 3b0:	00 00 00 
+  return _close(fd);
+ 3b3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 3b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3b9:	5b                   	pop    %ebx
+ 3ba:	5e                   	pop    %esi
+ 3bb:	5d                   	pop    %ebp
+  return _close(fd);
+ 3bc:	e9 83 03 00 00       	jmp    744 <_close>
+ 3c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 3c8:	83 ec 04             	sub    $0x4,%esp
+ 3cb:	05 a8 13 00 00       	add    $0x13a8,%eax
+ 3d0:	52                   	push   %edx
+ 3d1:	50                   	push   %eax
+ 3d2:	53                   	push   %ebx
+ 3d3:	e8 65 03 00 00       	call   73d <write>
+    ob[fd].n = 0;
+ 3d8:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+ 3df:	83 c4 10             	add    $0x10,%esp
+ 3e2:	eb bf                	jmp    3a3 <close+0x23>
+ 3e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ef:	90                   	nop
+
+000003f0 <strcpy>:
+{
+ 3f0:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+ 3f1:	31 c0                	xor    %eax,%eax
+{
+ 3f3:	89 e5                	mov    %esp,%ebp
+ 3f5:	53                   	push   %ebx
+ 3f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 400:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 404:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 407:	83 c0 01             	add    $0x1,%eax
+ 40a:	84 d2                	test   %dl,%dl
+ 40c:	75 f2                	jne    400 <strcpy+0x10>
+}
+ 40e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 411:	89 c8                	mov    %ecx,%eax
+ 413:	c9                   	leave
+ 414:	c3                   	ret
+ 415:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <strcmp>:
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	53                   	push   %ebx
+ 424:	8b 55 08             	mov    0x8(%ebp),%edx
+ 427:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 42a:	0f b6 02             	movzbl (%edx),%eax
+ 42d:	84 c0                	test   %al,%al
+ 42f:	75 17                	jne    448 <strcmp+0x28>
+ 431:	eb 3a                	jmp    46d <strcmp+0x4d>
+ 433:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 437:	90                   	nop
+ 438:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 43c:	83 c2 01             	add    $0x1,%edx
+ 43f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 442:	84 c0                	test   %al,%al
+ 444:	74 1a                	je     460 <strcmp+0x40>
+    p++, q++;
+ 446:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 448:	0f b6 19             	movzbl (%ecx),%ebx
+ 44b:	38 c3                	cmp    %al,%bl
+ 44d:	74 e9                	je     438 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 44f:	29 d8                	sub    %ebx,%eax
+}
+ 451:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 454:	c9                   	leave
+ 455:	c3                   	ret
+ 456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 460:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 464:	31 c0                	xor    %eax,%eax
+ 466:	29 d8                	sub    %ebx,%eax
+}
+ 468:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 46b:	c9                   	leave
+ 46c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 46d:	0f b6 19             	movzbl (%ecx),%ebx
+ 470:	31 c0                	xor    %eax,%eax
+ 472:	eb db                	jmp    44f <strcmp+0x2f>
+ 474:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 47f:	90                   	nop
+
+00000480 <strlen>:
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+ 486:	80 3a 00             	cmpb   $0x0,(%edx)
+ 489:	74 15                	je     4a0 <strlen+0x20>
+ 48b:	31 c0                	xor    %eax,%eax
+ 48d:	8d 76 00             	lea    0x0(%esi),%esi
+ 490:	83 c0 01             	add    $0x1,%eax
+ 493:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 497:	89 c1                	mov    %eax,%ecx
+ 499:	75 f5                	jne    490 <strlen+0x10>
+}
+ 49b:	89 c8                	mov    %ecx,%eax
+ 49d:	5d                   	pop    %ebp
+ 49e:	c3                   	ret
+ 49f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 4a0:	31 c9                	xor    %ecx,%ecx
+}
+ 4a2:	5d                   	pop    %ebp
+ 4a3:	89 c8                	mov    %ecx,%eax
+ 4a5:	c3                   	ret
+ 4a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004b0 <memset>:
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	57                   	push   %edi
+ 4b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 4b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4bd:	89 d7                	mov    %edx,%edi
+ 4bf:	fc                   	cld
+ 4c0:	f3 aa                	rep stos %al,%es:(%edi)
+}
+ 4c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 4c5:	89 d0                	mov    %edx,%eax
+ 4c7:	c9                   	leave
+ 4c8:	c3                   	ret
+ 4c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004d0 <strchr>:
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 4da:	0f b6 10             	movzbl (%eax),%edx
+ 4dd:	84 d2                	test   %dl,%dl
+ 4df:	75 12                	jne    4f3 <strchr+0x23>
+ 4e1:	eb 1d                	jmp    500 <strchr+0x30>
+ 4e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4e7:	90                   	nop
+ 4e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 4ec:	83 c0 01             	add    $0x1,%eax
+ 4ef:	84 d2                	test   %dl,%dl
+ 4f1:	74 0d                	je     500 <strchr+0x30>
+    if(*s == c)
+ 4f3:	38 d1                	cmp    %dl,%cl
+ 4f5:	75 f1                	jne    4e8 <strchr+0x18>
+}
+ 4f7:	5d                   	pop    %ebp
+ 4f8:	c3                   	ret
+ 4f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 500:	31 c0                	xor    %eax,%eax
+}
+ 502:	5d                   	pop    %ebp
+ 503:	c3                   	ret
+ 504:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 50f:	90                   	nop
+
+00000510 <memchr>:
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	8b 55 10             	mov    0x10(%ebp),%edx
+ 516:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 519:	85 d2                	test   %edx,%edx
+ 51b:	74 1b                	je     538 <memchr+0x28>
+    if(*p == (char)c)
+ 51d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+ 521:	01 c2                	add    %eax,%edx
+ 523:	eb 0a                	jmp    52f <memchr+0x1f>
+ 525:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+ 528:	83 c0 01             	add    $0x1,%eax
+ 52b:	39 c2                	cmp    %eax,%edx
+ 52d:	74 09                	je     538 <memchr+0x28>
+    if(*p == (char)c)
+ 52f:	38 08                	cmp    %cl,(%eax)
+ 531:	75 f5                	jne    528 <memchr+0x18>
+}
+ 533:	5d                   	pop    %ebp
+ 534:	c3                   	ret
+ 535:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+ 538:	31 c0                	xor    %eax,%eax
+}
+ 53a:	5d                   	pop    %ebp
+ 53b:	c3                   	ret
+ 53c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000540 <gets>:
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+ 544:	31 ff                	xor    %edi,%edi
+{
+ 546:	56                   	push   %esi
+ 547:	be a8 13 00 00       	mov    $0x13a8,%esi
+ 54c:	53                   	push   %ebx
+ 54d:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 550:	8b 46 fc             	mov    -0x4(%esi),%eax
+ 553:	85 c0                	test   %eax,%eax
+ 555:	7e 15                	jle    56c <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 557:	83 ec 04             	sub    $0x4,%esp
+ 55a:	50                   	push   %eax
+ 55b:	56                   	push   %esi
+ 55c:	57                   	push   %edi
+ 55d:	e8 db 01 00 00       	call   73d <write>
+    ob[fd].n = 0;
+ 562:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+ 569:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 56c:	83 c7 01             	add    $0x1,%edi
+ 56f:	81 c6 08 01 00 00    	add    $0x108,%esi
+ 575:	83 ff 10             	cmp    $0x10,%edi
+ 578:	75 d6                	jne    550 <gets+0x10>
+  for(i=0; i+1 < max; ){
+ 57a:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+ 57c:	8d 75 e7             	lea    -0x19(%ebp),%esi
+ 57f:	eb 2e                	jmp    5af <gets+0x6f>
+ 581:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 588:	83 ec 04             	sub    $0x4,%esp
+ 58b:	6a 01                	push   $0x1
+ 58d:	56                   	push   %esi
+ 58e:	6a 00                	push   $0x0
+ 590:	e8 a1 01 00 00       	call   736 <read>
+    if(cc < 1)
+ 595:	83 c4 10             	add    $0x10,%esp
+ 598:	85 c0                	test   %eax,%eax
+ 59a:	7e 1d                	jle    5b9 <gets+0x79>
+    buf[i++] = c;
+ 59c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 5a0:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5a3:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 5a7:	3c 0a                	cmp    $0xa,%al
+ 5a9:	74 10                	je     5bb <gets+0x7b>
+ 5ab:	3c 0d                	cmp    $0xd,%al
+ 5ad:	74 0c                	je     5bb <gets+0x7b>
+  for(i=0; i+1 < max; ){
+ 5af:	89 df                	mov    %ebx,%edi
+ 5b1:	83 c3 01             	add    $0x1,%ebx
+ 5b4:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 5b7:	7c cf                	jl     588 <gets+0x48>
+ 5b9:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 5bb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5be:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 5c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5c5:	5b                   	pop    %ebx
+ 5c6:	5e                   	pop    %esi
+ 5c7:	5f                   	pop    %edi
+ 5c8:	5d                   	pop    %ebp
+ 5c9:	c3                   	ret
+ 5ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000005d0 <stat>:
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	57                   	push   %edi
+ 5d4:	56                   	push   %esi
+ 5d5:	53                   	push   %ebx
+ 5d6:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+ 5d9:	6a 00                	push   $0x0
+ 5db:	ff 75 08             	push   0x8(%ebp)
+ 5de:	e8 76 01 00 00       	call   759 <open>
+  if(fd < 0)
+ 5e3:	83 c4 10             	add    $0x10,%esp
+ 5e6:	85 c0                	test   %eax,%eax
+ 5e8:	78 76                	js     660 <stat+0x90>
+  r = fstat(fd, st);
+ 5ea:	83 ec 08             	sub    $0x8,%esp
+ 5ed:	ff 75 0c             	push   0xc(%ebp)
+ 5f0:	89 c3                	mov    %eax,%ebx
+ 5f2:	50                   	push   %eax
+ 5f3:	e8 7f 01 00 00       	call   777 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 5f8:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 5fb:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 5fd:	83 fb 0f             	cmp    $0xf,%ebx
+ 600:	7f 40                	jg     642 <stat+0x72>
+ 602:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 608:	8b 90 a4 13 00 00    	mov    0x13a4(%eax),%edx
+ 60e:	8d b8 a0 13 00 00    	lea    0x13a0(%eax),%edi
+ 614:	85 d2                	test   %edx,%edx
+ 616:	7e 1a                	jle    632 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 618:	83 ec 04             	sub    $0x4,%esp
+ 61b:	05 a8 13 00 00       	add    $0x13a8,%eax
+ 620:	52                   	push   %edx
+ 621:	50                   	push   %eax
+ 622:	53                   	push   %ebx
+ 623:	e8 15 01 00 00       	call   73d <write>
+    ob[fd].n = 0;
+ 628:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+ 62f:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+ 632:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 638:	c7 80 a0 13 00 00 00 	movl   $0x0,0x13a0(%eax)
+ 63f:	00 00 00 
+  return _close(fd);
+ 642:	83 ec 0c             	sub    $0xc,%esp
+ 645:	53                   	push   %ebx
+ 646:	e8 f9 00 00 00       	call   744 <_close>
+ 64b:	83 c4 10             	add    $0x10,%esp
+}
+ 64e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 651:	89 f0                	mov    %esi,%eax
+ 653:	5b                   	pop    %ebx
+ 654:	5e                   	pop    %esi
+ 655:	5f                   	pop    %edi
+ 656:	5d                   	pop    %ebp
+ 657:	c3                   	ret
+ 658:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 65f:	90                   	nop
+    return -1;
+ 660:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 665:	eb e7                	jmp    64e <stat+0x7e>
+ 667:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66e:	66 90                	xchg   %ax,%ax
+
+00000670 <atoi>:
+{
+ 670:	55                   	push   %ebp
+ 671:	89 e5                	mov    %esp,%ebp
+ 673:	53                   	push   %ebx
+ 674:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 677:	0f be 02             	movsbl (%edx),%eax
+ 67a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 67d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 680:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 685:	77 1e                	ja     6a5 <atoi+0x35>
+ 687:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 68e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 690:	83 c2 01             	add    $0x1,%edx
+ 693:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 696:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 69a:	0f be 02             	movsbl (%edx),%eax
+ 69d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 6a0:	80 fb 09             	cmp    $0x9,%bl
+ 6a3:	76 eb                	jbe    690 <atoi+0x20>
+}
+ 6a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 6a8:	89 c8                	mov    %ecx,%eax
+ 6aa:	c9                   	leave
+ 6ab:	c3                   	ret
+ 6ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006b0 <memmove>:
+{
+ 6b0:	55                   	push   %ebp
+ 6b1:	89 e5                	mov    %esp,%ebp
+ 6b3:	57                   	push   %edi
+ 6b4:	56                   	push   %esi
+ 6b5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 6b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 6bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 6be:	85 c0                	test   %eax,%eax
+ 6c0:	7e 13                	jle    6d5 <memmove+0x25>
+ 6c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 6c4:	89 d7                	mov    %edx,%edi
+ 6c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 6d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 6d1:	39 f8                	cmp    %edi,%eax
+ 6d3:	75 fb                	jne    6d0 <memmove+0x20>
+  return vdst;
+}
+ 6d5:	5e                   	pop    %esi
+ 6d6:	89 d0                	mov    %edx,%eax
+ 6d8:	5f                   	pop    %edi
+ 6d9:	5d                   	pop    %ebp
+ 6da:	c3                   	ret
+
+000006db <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+ 6db:	83 3d 90 13 00 00 00 	cmpl   $0x0,0x1390
+  jle 1f
+ 6e2:	7e 0a                	jle    6ee <syscallentry+0x13>
+  movl %esp, %ecx
+ 6e4:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 6e6:	ba ed 06 00 00       	mov    $0x6ed,%edx
+  sysenter
+ 6eb:	0f 34                	sysenter
+2:
+  ret
+ 6ed:	c3                   	ret
+1:
+  jl 3f
+ 6ee:	7c 27                	jl     717 <syscallentry+0x3c>
+  pushal
+ 6f0:	60                   	pusha
+  movl $1, %eax
+ 6f1:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 6f6:	0f a2                	cpuid
+  movl $-1, sysentermode
+ 6f8:	c7 05 90 13 00 00 ff 	movl   $0xffffffff,0x1390
+ 6ff:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 702:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+ 708:	74 0a                	je     714 <syscallentry+0x39>
+  movl $1, sysentermode
+ 70a:	c7 05 90 13 00 00 01 	movl   $0x1,0x1390
+ 711:	00 00 00 
+4:
+  popal
+ 714:	61                   	popa
+  jmp syscallentry
+ 715:	eb c4                	jmp    6db <syscallentry>
+3:
+  int $T_SYSCALL
+ 717:	cd 40                	int    $0x40
+  ret
+ 719:	c3                   	ret
+
+0000071a <_fork>:
+
+SYSCALLAS(_fork, fork)
+ 71a:	b8 01 00 00 00       	mov    $0x1,%eax
+ 71f:	eb ba                	jmp    6db <syscallentry>
+
+00000721 <_exit>:
+SYSCALLAS(_exit, exit)
+ 721:	b8 02 00 00 00       	mov    $0x2,%eax
+ 726:	eb b3                	jmp    6db <syscallentry>
+
+00000728 <wait>:
+SYSCALL(wait)
+ 728:	b8 03 00 00 00       	mov    $0x3,%eax
+ 72d:	eb ac                	jmp    6db <syscallentry>
+
+0000072f <pipe>:
+SYSCALL(pipe)
+ 72f:	b8 04 00 00 00       	mov    $0x4,%eax
+ 734:	eb a5                	jmp    6db <syscallentry>
+
+00000736 <read>:
+SYSCALL(read)
+ 736:	b8 05 00 00 00       	mov    $0x5,%eax
+ 73b:	eb 9e                	jmp    6db <syscallentry>
+
+0000073d <write>:
+SYSCALL(write)
+ 73d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 742:	eb 97                	jmp    6db <syscallentry>
+
+00000744 <_close>:
+SYSCALLAS(_close, close)
+ 744:	b8 15 00 00 00       	mov    $0x15,%eax
+ 749:	eb 90                	jmp    6db <syscallentry>
+
+0000074b <kill>:
+SYSCALL(kill)
+ 74b:	b8 06 00 00 00       	mov    $0x6,%eax
+ 750:	eb 89                	jmp    6db <syscallentry>
+
+00000752 <_exec>:
+SYSCALLAS(_exec, exec)
+ 752:	b8 07 00 00 00       	mov    $0x7,%eax
+ 757:	eb 82                	jmp    6db <syscallentry>
+
+00000759 <open>:
+SYSCALL(open)
+ 759:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 75e:	e9 78 ff ff ff       	jmp    6db <syscallentry>
+
+00000763 <mknod>:
+SYSCALL(mknod)
+ 763:	b8 11 00 00 00       	mov    $0x11,%eax
+ 768:	e9 6e ff ff ff       	jmp    6db <syscallentry>
+
+0000076d <unlink>:
+SYSCALL(unlink)
+ 76d:	b8 12 00 00 00       	mov    $0x12,%eax
+ 772:	e9 64 ff ff ff       	jmp    6db <syscallentry>
+
+00000777 <fstat>:
+SYSCALL(fstat)
+ 777:	b8 08 00 00 00       	mov    $0x8,%eax
+ 77c:	e9 5a ff ff ff       	jmp    6db <syscallentry>
+
+00000781 <link>:
+SYSCALL(link)
+ 781:	b8 13 00 00 00       	mov    $0x13,%eax
+ 786:	e9 50 ff ff ff       	jmp    6db <syscallentry>
+
+0000078b <mkdir>:
+SYSCALL(mkdir)
+ 78b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 790:	e9 46 ff ff ff       	jmp    6db <syscallentry>
+
+00000795 <chdir>:
+SYSCALL(chdir)
+ 795:	b8 09 00 00 00       	mov    $0x9,%eax
+ 79a:	e9 3c ff ff ff       	jmp    6db <syscallentry>
+
+0000079f <dup>:
+SYSCALL(dup)
+ 79f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 7a4:	e9 32 ff ff ff       	jmp    6db <syscallentry>
+
+000007a9 <getpid>:
+SYSCALL(getpid)
+ 7a9:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 7ae:	e9 28 ff ff ff       	jmp    6db <syscallentry>
+
+000007b3 <sbrk>:
+SYSCALL(sbrk)
+ 7b3:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 7b8:	e9 1e ff ff ff       	jmp    6db <syscallentry>
+
+000007bd <sleep>:
+SYSCALL(sleep)
+ 7bd:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 7c2:	e9 14 ff ff ff       	jmp    6db <syscallentry>
+
+000007c7 <uptime>:
+SYSCALL(uptime)
+ 7c7:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 7cc:	e9 0a ff ff ff       	jmp    6db <syscallentry>
+
+000007d1 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+ 7d1:	b8 16 00 00 00       	mov    $0x16,%eax
+ 7d6:	e9 00 ff ff ff       	jmp    6db <syscallentry>
+
+000007db <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+ 7db:	b8 17 00 00 00       	mov    $0x17,%eax
+ 7e0:	e9 f6 fe ff ff       	jmp    6db <syscallentry>
+
+000007e5 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+ 7e5:	b8 18 00 00 00       	mov    $0x18,%eax
+ 7ea:	e9 ec fe ff ff       	jmp    6db <syscallentry>
+
+000007ef <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+ 7ef:	b8 19 00 00 00       	mov    $0x19,%eax
+ 7f4:	e9 e2 fe ff ff       	jmp    6db <syscallentry>
+
+000007f9 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+ 7f9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 7fe:	e9 d8 fe ff ff       	jmp    6db <syscallentry>
+
+00000803 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+ 803:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 808:	e9 ce fe ff ff       	jmp    6db <syscallentry>
+
+0000080d <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+ 80d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 812:	e9 c4 fe ff ff       	jmp    6db <syscallentry>
+
+00000817 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+ 817:	b8 20 00 00 00       	mov    $0x20,%eax
+ 81c:	e9 ba fe ff ff       	jmp    6db <syscallentry>
+
+00000821 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+ 821:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 826:	e9 b0 fe ff ff       	jmp    6db <syscallentry>
+
+0000082b <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+ 82b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 830:	e9 a6 fe ff ff       	jmp    6db <syscallentry>
+
+00000835 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+ 835:	b8 21 00 00 00       	mov    $0x21,%eax
+ 83a:	e9 9c fe ff ff       	jmp    6db <syscallentry>
+
+0000083f <yield>:
+SYSCALL(yield) // yield the CPU to another process
+ 83f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 844:	e9 92 fe ff ff       	jmp    6db <syscallentry>
+
+00000849 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+ 849:	b8 23 00 00 00       	mov    $0x23,%eax
+ 84e:	e9 88 fe ff ff       	jmp    6db <syscallentry>
+
+00000853 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+ 853:	b8 24 00 00 00       	mov    $0x24,%eax
+ 858:	e9 7e fe ff ff       	jmp    6db <syscallentry>
+
+0000085d <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+ 85d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 862:	e9 74 fe ff ff       	jmp    6db <syscallentry>
+
+00000867 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+ 867:	b8 26 00 00 00       	mov    $0x26,%eax
+ 86c:	e9 6a fe ff ff       	jmp    6db <syscallentry>
+
+00000871 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+ 871:	b8 27 00 00 00       	mov    $0x27,%eax
+ 876:	e9 60 fe ff ff       	jmp    6db <syscallentry>
+
+0000087b <mmap>:
+SYSCALL(mmap) // map a file into memory
+ 87b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 880:	e9 56 fe ff ff       	jmp    6db <syscallentry>
+
+00000885 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+ 885:	b8 29 00 00 00       	mov    $0x29,%eax
+ 88a:	e9 4c fe ff ff       	jmp    6db <syscallentry>
+
+0000088f <readv>:
+SYSCALL(readv) // read into several buffers
+ 88f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 894:	e9 42 fe ff ff       	jmp    6db <syscallentry>
+
+00000899 <writev>:
+SYSCALL(writev) // write from several buffers
+ 899:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 89e:	e9 38 fe ff ff       	jmp    6db <syscallentry>
+
+000008a3 <pread>:
+SYSCALL(pread) // read at an offset
+ 8a3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 8a8:	e9 2e fe ff ff       	jmp    6db <syscallentry>
+
+000008ad <pwrite>:
+SYSCALL(pwrite) // write at an offset
+ 8ad:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 8b2:	e9 24 fe ff ff       	jmp    6db <syscallentry>
+
+000008b7 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+ 8b7:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 8bc:	e9 1a fe ff ff       	jmp    6db <syscallentry>
+
+000008c1 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+ 8c1:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 8c6:	e9 10 fe ff ff       	jmp    6db <syscallentry>
+
+000008cb <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+ 8cb:	b8 30 00 00 00       	mov    $0x30,%eax
+ 8d0:	e9 06 fe ff ff       	jmp    6db <syscallentry>
+
+000008d5 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+ 8d5:	b8 31 00 00 00       	mov    $0x31,%eax
+ 8da:	e9 fc fd ff ff       	jmp    6db <syscallentry>
+
+000008df <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+ 8df:	b8 32 00 00 00       	mov    $0x32,%eax
+ 8e4:	e9 f2 fd ff ff       	jmp    6db <syscallentry>
+
+000008e9 <profread>:
+SYSCALL(profread) // drain profiler samples
+ 8e9:	b8 33 00 00 00       	mov    $0x33,%eax
+ 8ee:	e9 e8 fd ff ff       	jmp    6db <syscallentry>
+
+000008f3 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+ 8f3:	b8 34 00 00 00       	mov    $0x34,%eax
+ 8f8:	e9 de fd ff ff       	jmp    6db <syscallentry>
+
+000008fd <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+ 8fd:	b8 35 00 00 00       	mov    $0x35,%eax
+ 902:	e9 d4 fd ff ff       	jmp    6db <syscallentry>
+
+00000907 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+ 907:	b8 36 00 00 00       	mov    $0x36,%eax
+ 90c:	e9 ca fd ff ff       	jmp    6db <syscallentry>
+
+00000911 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+ 911:	b8 37 00 00 00       	mov    $0x37,%eax
+ 916:	e9 c0 fd ff ff       	jmp    6db <syscallentry>
+ 91b:	66 90                	xchg   %ax,%ax
+ 91d:	66 90                	xchg   %ax,%ax
+ 91f:	90                   	nop
+
+00000920 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 920:	55                   	push   %ebp
+ 921:	89 e5                	mov    %esp,%ebp
+ 923:	57                   	push   %edi
+ 924:	56                   	push   %esi
+ 925:	53                   	push   %ebx
+ 926:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 928:	89 d1                	mov    %edx,%ecx
+{
+ 92a:	83 ec 3c             	sub    $0x3c,%esp
+ 92d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 930:	85 d2                	test   %edx,%edx
+ 932:	0f 89 80 00 00 00    	jns    9b8 <printint+0x98>
+ 938:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 93c:	74 7a                	je     9b8 <printint+0x98>
+    x = -xx;
+ 93e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 940:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 945:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 948:	31 f6                	xor    %esi,%esi
+ 94a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 950:	89 c8                	mov    %ecx,%eax
+ 952:	31 d2                	xor    %edx,%edx
+ 954:	89 f7                	mov    %esi,%edi
+ 956:	f7 f3                	div    %ebx
+ 958:	8d 76 01             	lea    0x1(%esi),%esi
+ 95b:	0f b6 92 fc 0e 00 00 	movzbl 0xefc(%edx),%edx
+ 962:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 966:	89 ca                	mov    %ecx,%edx
+ 968:	89 c1                	mov    %eax,%ecx
+ 96a:	39 da                	cmp    %ebx,%edx
+ 96c:	73 e2                	jae    950 <printint+0x30>
+  if(neg)
+ 96e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 971:	85 c0                	test   %eax,%eax
+ 973:	74 07                	je     97c <printint+0x5c>
+    buf[i++] = '-';
+ 975:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 97a:	89 f7                	mov    %esi,%edi
+ 97c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 97f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 982:	01 df                	add    %ebx,%edi
+ 984:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 988:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+ 98b:	83 ec 04             	sub    $0x4,%esp
+ 98e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 991:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 994:	6a 01                	push   $0x1
+ 996:	50                   	push   %eax
+ 997:	56                   	push   %esi
+ 998:	e8 e3 f6 ff ff       	call   80 <bufwrite>
+  while(--i >= 0)
+ 99d:	89 f8                	mov    %edi,%eax
+ 99f:	83 c4 10             	add    $0x10,%esp
+ 9a2:	83 ef 01             	sub    $0x1,%edi
+ 9a5:	39 d8                	cmp    %ebx,%eax
+ 9a7:	75 df                	jne    988 <printint+0x68>
+}
+ 9a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9ac:	5b                   	pop    %ebx
+ 9ad:	5e                   	pop    %esi
+ 9ae:	5f                   	pop    %edi
+ 9af:	5d                   	pop    %ebp
+ 9b0:	c3                   	ret
+ 9b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 9b8:	31 c0                	xor    %eax,%eax
+ 9ba:	eb 89                	jmp    945 <printint+0x25>
+ 9bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000009c0 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 9c0:	55                   	push   %ebp
+ 9c1:	89 e5                	mov    %esp,%ebp
+ 9c3:	57                   	push   %edi
+ 9c4:	56                   	push   %esi
+ 9c5:	53                   	push   %ebx
+ 9c6:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 9c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 9cc:	0f b6 18             	movzbl (%eax),%ebx
+ 9cf:	84 db                	test   %bl,%bl
+ 9d1:	74 6c                	je     a3f <printf+0x7f>
+ 9d3:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+ 9d6:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ 9d9:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 9db:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 9de:	eb 26                	jmp    a06 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 9e0:	83 f8 25             	cmp    $0x25,%eax
+ 9e3:	74 4b                	je     a30 <printf+0x70>
+  bufwrite(fd, &c, 1);
+ 9e5:	83 ec 04             	sub    $0x4,%esp
+ 9e8:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 9eb:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ 9ee:	6a 01                	push   $0x1
+ 9f0:	50                   	push   %eax
+ 9f1:	ff 75 08             	push   0x8(%ebp)
+ 9f4:	e8 87 f6 ff ff       	call   80 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+ 9f9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 9fc:	0f b6 1f             	movzbl (%edi),%ebx
+ 9ff:	83 c7 01             	add    $0x1,%edi
+ a02:	84 db                	test   %bl,%bl
+ a04:	74 39                	je     a3f <printf+0x7f>
+    c = fmt[i] & 0xff;
+ a06:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ a09:	85 f6                	test   %esi,%esi
+ a0b:	74 d3                	je     9e0 <printf+0x20>
+      }
+    } else if(state == '%'){
+ a0d:	83 fe 25             	cmp    $0x25,%esi
+ a10:	75 ea                	jne    9fc <printf+0x3c>
+      if(c == 'd'){
+ a12:	83 f8 25             	cmp    $0x25,%eax
+ a15:	0f 84 d5 01 00 00    	je     bf0 <printf+0x230>
+ a1b:	83 e8 63             	sub    $0x63,%eax
+ a1e:	83 f8 15             	cmp    $0x15,%eax
+ a21:	77 45                	ja     a68 <printf+0xa8>
+ a23:	ff 24 85 a4 0e 00 00 	jmp    *0xea4(,%eax,4)
+ a2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+ a30:	0f b6 1f             	movzbl (%edi),%ebx
+ a33:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+ a36:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ a3b:	84 db                	test   %bl,%bl
+ a3d:	75 c7                	jne    a06 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+ a3f:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+ a43:	74 0b                	je     a50 <printf+0x90>
+    fflush(fd);
+}
+ a45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a48:	5b                   	pop    %ebx
+ a49:	5e                   	pop    %esi
+ a4a:	5f                   	pop    %edi
+ a4b:	5d                   	pop    %ebp
+ a4c:	c3                   	ret
+ a4d:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+ a50:	83 ec 0c             	sub    $0xc,%esp
+ a53:	6a 02                	push   $0x2
+ a55:	e8 c6 f7 ff ff       	call   220 <fflush>
+ a5a:	83 c4 10             	add    $0x10,%esp
+}
+ a5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a60:	5b                   	pop    %ebx
+ a61:	5e                   	pop    %esi
+ a62:	5f                   	pop    %edi
+ a63:	5d                   	pop    %ebp
+ a64:	c3                   	ret
+ a65:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+ a68:	83 ec 04             	sub    $0x4,%esp
+ a6b:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ a6e:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+ a72:	6a 01                	push   $0x1
+ a74:	52                   	push   %edx
+ a75:	89 55 c0             	mov    %edx,-0x40(%ebp)
+ a78:	ff 75 08             	push   0x8(%ebp)
+ a7b:	e8 00 f6 ff ff       	call   80 <bufwrite>
+ a80:	83 c4 0c             	add    $0xc,%esp
+ a83:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ a86:	6a 01                	push   $0x1
+ a88:	8b 55 c0             	mov    -0x40(%ebp),%edx
+ a8b:	52                   	push   %edx
+      state = 0;
+ a8c:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+ a8e:	ff 75 08             	push   0x8(%ebp)
+ a91:	e8 ea f5 ff ff       	call   80 <bufwrite>
+        putc(fd, c);
+ a96:	83 c4 10             	add    $0x10,%esp
+ a99:	e9 5e ff ff ff       	jmp    9fc <printf+0x3c>
+ a9e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+ aa0:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ aa3:	83 ec 0c             	sub    $0xc,%esp
+ aa6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ aab:	8b 16                	mov    (%esi),%edx
+ aad:	6a 00                	push   $0x0
+ aaf:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+ ab2:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+ ab5:	e8 66 fe ff ff       	call   920 <printint>
+        ap++;
+ aba:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ abd:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ ac0:	31 f6                	xor    %esi,%esi
+ ac2:	e9 35 ff ff ff       	jmp    9fc <printf+0x3c>
+ ac7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ace:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+ ad0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ ad3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ ad5:	83 c0 04             	add    $0x4,%eax
+ ad8:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+ adb:	b8 9d 0e 00 00       	mov    $0xe9d,%eax
+ ae0:	85 db                	test   %ebx,%ebx
+ ae2:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+ ae5:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+ ae8:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+ aea:	53                   	push   %ebx
+ aeb:	e8 90 f9 ff ff       	call   480 <strlen>
+ af0:	83 c4 0c             	add    $0xc,%esp
+ af3:	50                   	push   %eax
+ af4:	53                   	push   %ebx
+ af5:	ff 75 08             	push   0x8(%ebp)
+ af8:	e8 83 f5 ff ff       	call   80 <bufwrite>
+ afd:	83 c4 10             	add    $0x10,%esp
+ b00:	e9 f7 fe ff ff       	jmp    9fc <printf+0x3c>
+ b05:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ b08:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+ b0b:	83 ec 04             	sub    $0x4,%esp
+ b0e:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+ b11:	8b 06                	mov    (%esi),%eax
+        ap++;
+ b13:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+ b16:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+ b19:	6a 01                	push   $0x1
+ b1b:	52                   	push   %edx
+ b1c:	ff 75 08             	push   0x8(%ebp)
+ b1f:	e8 5c f5 ff ff       	call   80 <bufwrite>
+        ap++;
+ b24:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ b27:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b2a:	31 f6                	xor    %esi,%esi
+ b2c:	e9 cb fe ff ff       	jmp    9fc <printf+0x3c>
+ b31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+ b38:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ b3b:	83 ec 0c             	sub    $0xc,%esp
+ b3e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ b43:	8b 16                	mov    (%esi),%edx
+ b45:	6a 01                	push   $0x1
+ b47:	e9 63 ff ff ff       	jmp    aaf <printf+0xef>
+ b4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+ b50:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ b53:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ b56:	89 7d c0             	mov    %edi,-0x40(%ebp)
+ b59:	89 55 bc             	mov    %edx,-0x44(%ebp)
+ b5c:	8b 18                	mov    (%eax),%ebx
+ b5e:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+ b61:	31 c0                	xor    %eax,%eax
+ b63:	89 c7                	mov    %eax,%edi
+ b65:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+ b68:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+ b6d:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+ b6f:	f7 e1                	mul    %ecx
+ b71:	c1 ea 03             	shr    $0x3,%edx
+ b74:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ b77:	89 d1                	mov    %edx,%ecx
+ b79:	01 c0                	add    %eax,%eax
+ b7b:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ b7d:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+ b7f:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ b81:	be 0a 00 00 00       	mov    $0xa,%esi
+ b86:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+ b88:	89 da                	mov    %ebx,%edx
+ b8a:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+ b8c:	89 fe                	mov    %edi,%esi
+ b8e:	83 c7 01             	add    $0x1,%edi
+ b91:	8d 42 30             	lea    0x30(%edx),%eax
+ b94:	89 da                	mov    %ebx,%edx
+ b96:	8d 14 92             	lea    (%edx,%edx,4),%edx
+ b99:	01 d2                	add    %edx,%edx
+ b9b:	29 d0                	sub    %edx,%eax
+ b9d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+ ba1:	89 c8                	mov    %ecx,%eax
+ ba3:	09 d8                	or     %ebx,%eax
+ ba5:	75 c1                	jne    b68 <printf+0x1a8>
+ ba7:	8b 55 bc             	mov    -0x44(%ebp),%edx
+ baa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ bad:	01 d6                	add    %edx,%esi
+ baf:	89 f7                	mov    %esi,%edi
+ bb1:	89 d6                	mov    %edx,%esi
+ bb3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ bb7:	90                   	nop
+    putc(fd, buf[i]);
+ bb8:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+ bbb:	83 ec 04             	sub    $0x4,%esp
+ bbe:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+ bc1:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+ bc4:	6a 01                	push   $0x1
+ bc6:	50                   	push   %eax
+ bc7:	53                   	push   %ebx
+ bc8:	e8 b3 f4 ff ff       	call   80 <bufwrite>
+  while(--i >= 0)
+ bcd:	89 fa                	mov    %edi,%edx
+ bcf:	83 c4 10             	add    $0x10,%esp
+ bd2:	83 ef 01             	sub    $0x1,%edi
+ bd5:	39 d6                	cmp    %edx,%esi
+ bd7:	75 df                	jne    bb8 <printf+0x1f8>
+        ap += 2;
+ bd9:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+ bdd:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+ be0:	31 f6                	xor    %esi,%esi
+ be2:	e9 15 fe ff ff       	jmp    9fc <printf+0x3c>
+ be7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bee:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+ bf0:	83 ec 04             	sub    $0x4,%esp
+ bf3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ bf6:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ bf9:	6a 01                	push   $0x1
+ bfb:	e9 8b fe ff ff       	jmp    a8b <printf+0xcb>
+
+00000c00 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ c00:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c01:	a1 20 24 00 00       	mov    0x2420,%eax
+{
+ c06:	89 e5                	mov    %esp,%ebp
+ c08:	57                   	push   %edi
+ c09:	56                   	push   %esi
+ c0a:	53                   	push   %ebx
+ c0b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ c0e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c18:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c1a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c1c:	39 ca                	cmp    %ecx,%edx
+ c1e:	73 30                	jae    c50 <free+0x50>
+ c20:	39 c1                	cmp    %eax,%ecx
+ c22:	72 04                	jb     c28 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c24:	39 c2                	cmp    %eax,%edx
+ c26:	72 f0                	jb     c18 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ c28:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ c2b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ c2e:	39 f8                	cmp    %edi,%eax
+ c30:	74 2e                	je     c60 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c32:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ c35:	8b 42 04             	mov    0x4(%edx),%eax
+ c38:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c3b:	39 f1                	cmp    %esi,%ecx
+ c3d:	74 38                	je     c77 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ c3f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ c41:	5b                   	pop    %ebx
+  freep = p;
+ c42:	89 15 20 24 00 00    	mov    %edx,0x2420
+}
+ c48:	5e                   	pop    %esi
+ c49:	5f                   	pop    %edi
+ c4a:	5d                   	pop    %ebp
+ c4b:	c3                   	ret
+ c4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c50:	39 c1                	cmp    %eax,%ecx
+ c52:	72 d0                	jb     c24 <free+0x24>
+ c54:	eb c2                	jmp    c18 <free+0x18>
+ c56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c5d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ c60:	03 70 04             	add    0x4(%eax),%esi
+ c63:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c66:	8b 02                	mov    (%edx),%eax
+ c68:	8b 00                	mov    (%eax),%eax
+ c6a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ c6d:	8b 42 04             	mov    0x4(%edx),%eax
+ c70:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c73:	39 f1                	cmp    %esi,%ecx
+ c75:	75 c8                	jne    c3f <free+0x3f>
+    p->s.size += bp->s.size;
+ c77:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ c7a:	89 15 20 24 00 00    	mov    %edx,0x2420
+    p->s.size += bp->s.size;
+ c80:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ c83:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ c86:	89 0a                	mov    %ecx,(%edx)
+}
+ c88:	5b                   	pop    %ebx
+ c89:	5e                   	pop    %esi
+ c8a:	5f                   	pop    %edi
+ c8b:	5d                   	pop    %ebp
+ c8c:	c3                   	ret
+ c8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c90 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ c90:	55                   	push   %ebp
+ c91:	89 e5                	mov    %esp,%ebp
+ c93:	57                   	push   %edi
+ c94:	56                   	push   %esi
+ c95:	53                   	push   %ebx
+ c96:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c99:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ c9c:	8b 15 20 24 00 00    	mov    0x2420,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ca2:	8d 78 07             	lea    0x7(%eax),%edi
+ ca5:	c1 ef 03             	shr    $0x3,%edi
+ ca8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ cab:	85 d2                	test   %edx,%edx
+ cad:	0f 84 8d 00 00 00    	je     d40 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cb3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ cb5:	8b 48 04             	mov    0x4(%eax),%ecx
+ cb8:	39 f9                	cmp    %edi,%ecx
+ cba:	73 64                	jae    d20 <malloc+0x90>
+  if(nu < 4096)
+ cbc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ cc1:	39 df                	cmp    %ebx,%edi
+ cc3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ cc6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ ccd:	eb 0a                	jmp    cd9 <malloc+0x49>
+ ccf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cd0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ cd2:	8b 48 04             	mov    0x4(%eax),%ecx
+ cd5:	39 f9                	cmp    %edi,%ecx
+ cd7:	73 47                	jae    d20 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ cd9:	89 c2                	mov    %eax,%edx
+ cdb:	39 05 20 24 00 00    	cmp    %eax,0x2420
+ ce1:	75 ed                	jne    cd0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ ce3:	83 ec 0c             	sub    $0xc,%esp
+ ce6:	56                   	push   %esi
+ ce7:	e8 c7 fa ff ff       	call   7b3 <sbrk>
+  if(p == (char*)-1)
+ cec:	83 c4 10             	add    $0x10,%esp
+ cef:	83 f8 ff             	cmp    $0xffffffff,%eax
+ cf2:	74 1c                	je     d10 <malloc+0x80>
+  hp->s.size = nu;
+ cf4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ cf7:	83 ec 0c             	sub    $0xc,%esp
+ cfa:	83 c0 08             	add    $0x8,%eax
+ cfd:	50                   	push   %eax
+ cfe:	e8 fd fe ff ff       	call   c00 <free>
+  return freep;
+ d03:	8b 15 20 24 00 00    	mov    0x2420,%edx
+      if((p = morecore(nunits)) == 0)
+ d09:	83 c4 10             	add    $0x10,%esp
+ d0c:	85 d2                	test   %edx,%edx
+ d0e:	75 c0                	jne    cd0 <malloc+0x40>
+        return 0;
+  }
+}
+ d10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ d13:	31 c0                	xor    %eax,%eax
+}
+ d15:	5b                   	pop    %ebx
+ d16:	5e                   	pop    %esi
+ d17:	5f                   	pop    %edi
+ d18:	5d                   	pop    %ebp
+ d19:	c3                   	ret
+ d1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ d20:	39 cf                	cmp    %ecx,%edi
+ d22:	74 4c                	je     d70 <malloc+0xe0>
+        p->s.size -= nunits;
+ d24:	29 f9                	sub    %edi,%ecx
+ d26:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ d29:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ d2c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ d2f:	89 15 20 24 00 00    	mov    %edx,0x2420
+}
+ d35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ d38:	83 c0 08             	add    $0x8,%eax
+}
+ d3b:	5b                   	pop    %ebx
+ d3c:	5e                   	pop    %esi
+ d3d:	5f                   	pop    %edi
+ d3e:	5d                   	pop    %ebp
+ d3f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ d40:	c7 05 20 24 00 00 24 	movl   $0x2424,0x2420
+ d47:	24 00 00 
+    base.s.size = 0;
+ d4a:	b8 24 24 00 00       	mov    $0x2424,%eax
+    base.s.ptr = freep = prevp = &base;
+ d4f:	c7 05 24 24 00 00 24 	movl   $0x2424,0x2424
+ d56:	24 00 00 
+    base.s.size = 0;
+ d59:	c7 05 28 24 00 00 00 	movl   $0x0,0x2428
+ d60:	00 00 00 
+    if(p->s.size >= nunits){
+ d63:	e9 54 ff ff ff       	jmp    cbc <malloc+0x2c>
+ d68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d6f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ d70:	8b 08                	mov    (%eax),%ecx
+ d72:	89 0a                	mov    %ecx,(%edx)
+ d74:	eb b9                	jmp    d2f <malloc+0x9f>
+ d76:	66 90                	xchg   %ax,%ax
+ d78:	66 90                	xchg   %ax,%ax
+ d7a:	66 90                	xchg   %ax,%ax
+ d7c:	66 90                	xchg   %ax,%ax
+ d7e:	66 90                	xchg   %ax,%ax
+
+00000d80 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+ d80:	55                   	push   %ebp
+ d81:	89 e5                	mov    %esp,%ebp
+ d83:	57                   	push   %edi
+ d84:	56                   	push   %esi
+ d85:	be 01 00 00 00       	mov    $0x1,%esi
+ d8a:	53                   	push   %ebx
+ d8b:	83 ec 28             	sub    $0x28,%esp
+ d8e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ d91:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ d94:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+ d97:	68 00 98 00 00       	push   $0x9800
+ d9c:	e8 ef fe ff ff       	call   c90 <malloc>
+ da1:	83 c4 10             	add    $0x10,%esp
+ da4:	89 c7                	mov    %eax,%edi
+ da6:	85 c0                	test   %eax,%eax
+ da8:	74 62                	je     e0c <waitpoll+0x8c>
+ daa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+ db0:	83 ec 0c             	sub    $0xc,%esp
+ db3:	6a 01                	push   $0x1
+ db5:	e8 03 fa ff ff       	call   7bd <sleep>
+    fn();
+ dba:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ dbd:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+ dbf:	58                   	pop    %eax
+ dc0:	5a                   	pop    %edx
+ dc1:	68 00 02 00 00       	push   $0x200
+ dc6:	57                   	push   %edi
+ dc7:	e8 eb fa ff ff       	call   8b7 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+ dcc:	83 c4 10             	add    $0x10,%esp
+ dcf:	85 c0                	test   %eax,%eax
+ dd1:	7e 2d                	jle    e00 <waitpoll+0x80>
+ dd3:	6b c0 4c             	imul   $0x4c,%eax,%eax
+ dd6:	89 fa                	mov    %edi,%edx
+    alive = 0;
+ dd8:	31 c9                	xor    %ecx,%ecx
+ dda:	01 f8                	add    %edi,%eax
+ ddc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+ de0:	3b 1a                	cmp    (%edx),%ebx
+ de2:	75 07                	jne    deb <waitpoll+0x6b>
+        alive = 1;
+ de4:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+ de8:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+ deb:	83 c2 4c             	add    $0x4c,%edx
+ dee:	39 d0                	cmp    %edx,%eax
+ df0:	75 ee                	jne    de0 <waitpoll+0x60>
+  } while(alive);
+ df2:	85 c9                	test   %ecx,%ecx
+ df4:	75 ba                	jne    db0 <waitpoll+0x30>
+ df6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dfd:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+ e00:	83 ec 0c             	sub    $0xc,%esp
+ e03:	57                   	push   %edi
+ e04:	e8 f7 fd ff ff       	call   c00 <free>
+  wait();
+ e09:	83 c4 10             	add    $0x10,%esp
+}
+ e0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e0f:	5b                   	pop    %ebx
+ e10:	5e                   	pop    %esi
+ e11:	5f                   	pop    %edi
+ e12:	5d                   	pop    %ebp
+  wait();
+ e13:	e9 10 f9 ff ff       	jmp    728 <wait>
+ e18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e1f:	90                   	nop
+
+00000e20 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+ e20:	55                   	push   %ebp
+ e21:	89 e5                	mov    %esp,%ebp
+ e23:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+ e26:	c7 45 f0 0d 0f 00 00 	movl   $0xf0d,-0x10(%ebp)
+ e2d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+ e34:	e8 87 f4 ff ff       	call   2c0 <fork>
+ e39:	85 c0                	test   %eax,%eax
+ e3b:	78 09                	js     e46 <runps+0x26>
+    return -1;
+  if(pid == 0){
+ e3d:	74 0e                	je     e4d <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+ e3f:	e8 e4 f8 ff ff       	call   728 <wait>
+}
+ e44:	c9                   	leave
+ e45:	c3                   	ret
+ e46:	c9                   	leave
+    return -1;
+ e47:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ e4c:	c3                   	ret
+    exec("ps", argv);
+ e4d:	50                   	push   %eax
+ e4e:	50                   	push   %eax
+ e4f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ e52:	50                   	push   %eax
+ e53:	68 0d 0f 00 00       	push   $0xf0d
+ e58:	e8 c3 f4 ff ff       	call   320 <exec>
+    printf(2, "exec ps failed\n");
+ e5d:	5a                   	pop    %edx
+ e5e:	59                   	pop    %ecx
+ e5f:	68 10 0f 00 00       	push   $0xf10
+ e64:	6a 02                	push   $0x2
+ e66:	e8 55 fb ff ff       	call   9c0 <printf>
+    exit();
+ e6b:	e8 a0 f4 ff ff       	call   310 <exit>
@@ -0,0 +1,71 @@
+// Run several processes that compute and yield(), then report
+// how long each has waited on the run queue, from getprocinfo(),
+// and each CPU's dispatch latency histogram, from schedlat().
+//
+// usage: rqlat [nproc [rounds]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "procinfo.h"
+#include "schedlat.h"
+
+struct schedlat before[NCPU], after[NCPU];
+struct procinfo pi[NPROC];
+
+void
+child(int rounds)
+{
+  volatile int x;
+  int i, j;
+
+  x = 0;
+  for(i = 0; i < rounds; i++){
+    for(j = 0; j < 100000; j++)
+      x += j;
+    yield();
+  }
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  int nproc, rounds, ncpu, i, b, n, pid;
+
+  nproc = argc > 1 ? atoi(argv[1]) : 4;
+  rounds = argc > 2 ? atoi(argv[2]) : 200;
+
+  ncpu = schedlat(before, NCPU);
+  for(i = 0; i < nproc; i++){
+    if((pid = fork()) < 0){
+      printf(2, "rqlat: fork failed\n");
+      break;
+    }
+    if(pid == 0)
+      child(rounds);
+  }
+
+  sleep(10);
+  n = getprocinfo(pi, NPROC);
+  printf(1, "pid\trun queue wait (us)\n");
+  for(i = 0; i < n; i++)
+    if(pi[i].ppid == getpid())
+      printf(1, "%d\t%l%s\n", pi[i].pid, pi[i].rqwait,
+             pi[i].state == PS_ZOMBIE ? "\t(exited)" : "");
+
+  while(wait() >= 0)
+    ;
+  schedlat(after, NCPU);
+
+  for(i = 0; i < ncpu; i++){
+    printf(1, "cpu%d: %d dispatches\n", i,
+           after[i].dispatches - before[i].dispatches);
+    for(b = 0; b < NLATBUCKET; b++)
+      if(after[i].hist[b] != before[i].hist[b])
+        printf(1, "  2^%d cycles: %d\n", b,
+               after[i].hist[b] - before[i].hist[b]);
+  }
+  exit();
+}
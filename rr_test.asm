@@ -0,0 +1,2144 @@
+
+_rr_test:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#define LOOPS 5
+#define REPORT_INTERVAL 50000000ULL // Use unsigned long long
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 34             	sub    $0x34,%esp
+  // Set the scheduler policy to RR for this test
+  if (setschedpolicy(SCHED_RR) < 0) {
+  14:	6a 04                	push   $0x4
+  16:	e8 5c 09 00 00       	call   977 <setschedpolicy>
+  1b:	83 c4 10             	add    $0x10,%esp
+  1e:	85 c0                	test   %eax,%eax
+  20:	0f 88 bd 00 00 00    	js     e3 <main+0xe3>
+    printf(1, "Error setting scheduler policy to RR\n");
+    exit();
+  }
+  printf(1, "Set scheduler to RR (policy %d)\n", SCHED_RR);
+  26:	50                   	push   %eax
+  27:	6a 04                	push   $0x4
+  29:	68 f8 0f 00 00       	push   $0xff8
+  2e:	6a 01                	push   $0x1
+  30:	e8 eb 0a 00 00       	call   b20 <printf>
+
+  printf(1, "Round Robin (RR) Scheduler Test\n");
+  35:	58                   	pop    %eax
+  36:	5a                   	pop    %edx
+  37:	68 1c 10 00 00       	push   $0x101c
+  3c:	6a 01                	push   $0x1
+  3e:	e8 dd 0a 00 00       	call   b20 <printf>
+  printf(1, "-------------------------------\n");
+  43:	59                   	pop    %ecx
+  44:	5b                   	pop    %ebx
+  45:	68 40 10 00 00       	push   $0x1040
+  4a:	6a 01                	push   $0x1
+  4c:	e8 cf 0a 00 00       	call   b20 <printf>
+  printf(1, "Creating 3 long-running processes that report progress periodically\n");
+  51:	5e                   	pop    %esi
+  52:	5f                   	pop    %edi
+  53:	68 64 10 00 00       	push   $0x1064
+  58:	6a 01                	push   $0x1
+  printf(1, "RR should interleave their execution, visible in progress reports\n");
+
+  int pid, i;
+
+  for(i = 0; i < 3; i++) {
+  5a:	31 f6                	xor    %esi,%esi
+  printf(1, "Creating 3 long-running processes that report progress periodically\n");
+  5c:	e8 bf 0a 00 00       	call   b20 <printf>
+  printf(1, "RR should interleave their execution, visible in progress reports\n");
+  61:	58                   	pop    %eax
+  62:	5a                   	pop    %edx
+  63:	68 ac 10 00 00       	push   $0x10ac
+  68:	6a 01                	push   $0x1
+  6a:	e8 b1 0a 00 00       	call   b20 <printf>
+  6f:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+  72:	e8 a9 03 00 00       	call   420 <fork>
+    if(pid < 0) {
+  77:	85 c0                	test   %eax,%eax
+  79:	78 7b                	js     f6 <main+0xf6>
+      printf(1, "Error: fork failed\n");
+      exit();
+    }
+    if(pid == 0) {
+  7b:	0f 84 88 00 00 00    	je     109 <main+0x109>
+  for(i = 0; i < 3; i++) {
+  81:	83 c6 01             	add    $0x1,%esi
+  84:	83 fe 03             	cmp    $0x3,%esi
+  87:	75 e9                	jne    72 <main+0x72>
+      exit();
+    }
+  }
+
+  // Parent waits for all children
+  printf(1, "Parent waiting for children...\n");
+  89:	50                   	push   %eax
+  8a:	50                   	push   %eax
+  8b:	68 88 11 00 00       	push   $0x1188
+  90:	6a 01                	push   $0x1
+  92:	e8 89 0a 00 00       	call   b20 <printf>
+  printf(1, "Observe the interleaved progress reports from children.\n");
+  97:	5a                   	pop    %edx
+  98:	59                   	pop    %ecx
+  99:	68 a8 11 00 00       	push   $0x11a8
+  9e:	6a 01                	push   $0x1
+  a0:	e8 7b 0a 00 00       	call   b20 <printf>
+  printf(1, "This indicates Round Robin is working correctly.\n");
+  a5:	5b                   	pop    %ebx
+  a6:	5e                   	pop    %esi
+  a7:	68 e4 11 00 00       	push   $0x11e4
+  ac:	6a 01                	push   $0x1
+  ae:	e8 6d 0a 00 00       	call   b20 <printf>
+  for(i = 0; i < 3; i++) {
+    wait();
+  b3:	e8 d0 07 00 00       	call   888 <wait>
+  b8:	e8 cb 07 00 00       	call   888 <wait>
+  bd:	e8 c6 07 00 00       	call   888 <wait>
+  }
+
+  printf(1, "All child processes have completed\n");
+  c2:	5f                   	pop    %edi
+  c3:	58                   	pop    %eax
+  c4:	68 18 12 00 00       	push   $0x1218
+  c9:	6a 01                	push   $0x1
+  cb:	e8 50 0a 00 00       	call   b20 <printf>
+  printf(1, "RR scheduler test completed\n");
+  d0:	58                   	pop    %eax
+  d1:	5a                   	pop    %edx
+  d2:	68 6c 12 00 00       	push   $0x126c
+  d7:	6a 01                	push   $0x1
+  d9:	e8 42 0a 00 00       	call   b20 <printf>
+
+  exit();
+  de:	e8 8d 03 00 00       	call   470 <exit>
+    printf(1, "Error setting scheduler policy to RR\n");
+  e3:	51                   	push   %ecx
+  e4:	51                   	push   %ecx
+  e5:	68 d0 0f 00 00       	push   $0xfd0
+  ea:	6a 01                	push   $0x1
+  ec:	e8 2f 0a 00 00       	call   b20 <printf>
+    exit();
+  f1:	e8 7a 03 00 00       	call   470 <exit>
+      printf(1, "Error: fork failed\n");
+  f6:	50                   	push   %eax
+  f7:	50                   	push   %eax
+  f8:	68 3c 12 00 00       	push   $0x123c
+  fd:	6a 01                	push   $0x1
+  ff:	e8 1c 0a 00 00       	call   b20 <printf>
+      exit();
+ 104:	e8 67 03 00 00       	call   470 <exit>
+      int mypid = getpid();
+ 109:	89 c3                	mov    %eax,%ebx
+ 10b:	e8 f9 07 00 00       	call   909 <getpid>
+ 110:	89 c7                	mov    %eax,%edi
+ 112:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      printf(1, "Child %d (PID %d) created. Total computation units: %d\n", child_id, mypid, total_work);
+ 115:	50                   	push   %eax
+ 116:	50                   	push   %eax
+ 117:	6a 00                	push   $0x0
+ 119:	68 80 b2 e6 0e       	push   $0xee6b280
+ 11e:	57                   	push   %edi
+ 11f:	56                   	push   %esi
+ 120:	68 f0 10 00 00       	push   $0x10f0
+ 125:	6a 01                	push   $0x1
+ 127:	e8 f4 09 00 00       	call   b20 <printf>
+      printf(1, "Child %d (PID %d) starting long computation...\n", child_id, mypid);
+ 12c:	83 c4 20             	add    $0x20,%esp
+ 12f:	57                   	push   %edi
+          for(j = 0; j < REPORT_INTERVAL; j++) {
+ 130:	31 ff                	xor    %edi,%edi
+      printf(1, "Child %d (PID %d) starting long computation...\n", child_id, mypid);
+ 132:	56                   	push   %esi
+ 133:	68 28 11 00 00       	push   $0x1128
+ 138:	6a 01                	push   $0x1
+ 13a:	e8 e1 09 00 00       	call   b20 <printf>
+          for(j = 0; j < REPORT_INTERVAL; j++) {
+ 13f:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+      printf(1, "Child %d (PID %d) starting long computation...\n", child_id, mypid);
+ 142:	83 c4 10             	add    $0x10,%esp
+          for(j = 0; j < REPORT_INTERVAL; j++) {
+ 145:	b9 7f f0 fa 02       	mov    $0x2faf07f,%ecx
+ 14a:	31 f6                	xor    %esi,%esi
+ 14c:	89 75 e0             	mov    %esi,-0x20(%ebp)
+ 14f:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+ 152:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 155:	89 fe                	mov    %edi,%esi
+ 157:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 15a:	39 c1                	cmp    %eax,%ecx
+ 15c:	19 d6                	sbb    %edx,%esi
+ 15e:	72 36                	jb     196 <main+0x196>
+ 160:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 163:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+ 170:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 173:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 176:	89 fb                	mov    %edi,%ebx
+ 178:	83 c0 01             	add    $0x1,%eax
+ 17b:	83 d2 00             	adc    $0x0,%edx
+ 17e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 181:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 184:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 187:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 18a:	39 c1                	cmp    %eax,%ecx
+ 18c:	19 d3                	sbb    %edx,%ebx
+ 18e:	73 e0                	jae    170 <main+0x170>
+ 190:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 193:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+          printf(1, "  [RR Progress] Child %d (PID %d): Lap %d/%d\n", child_id, mypid, k + 1, LOOPS);
+ 196:	83 c3 01             	add    $0x1,%ebx
+ 199:	51                   	push   %ecx
+ 19a:	51                   	push   %ecx
+ 19b:	6a 05                	push   $0x5
+ 19d:	53                   	push   %ebx
+ 19e:	ff 75 cc             	push   -0x34(%ebp)
+ 1a1:	ff 75 d4             	push   -0x2c(%ebp)
+ 1a4:	68 58 11 00 00       	push   $0x1158
+ 1a9:	6a 01                	push   $0x1
+ 1ab:	e8 70 09 00 00       	call   b20 <printf>
+      for (k = 0; k < LOOPS; k++) {
+ 1b0:	83 c4 20             	add    $0x20,%esp
+ 1b3:	83 fb 05             	cmp    $0x5,%ebx
+ 1b6:	b9 7f f0 fa 02       	mov    $0x2faf07f,%ecx
+ 1bb:	75 8d                	jne    14a <main+0x14a>
+      printf(1, "Child %d (PID %d) finished\n", child_id, mypid);
+ 1bd:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 1c0:	ff 75 cc             	push   -0x34(%ebp)
+ 1c3:	56                   	push   %esi
+ 1c4:	68 50 12 00 00       	push   $0x1250
+ 1c9:	6a 01                	push   $0x1
+ 1cb:	e8 50 09 00 00       	call   b20 <printf>
+      exit();
+ 1d0:	e8 9b 02 00 00       	call   470 <exit>
+ 1d5:	66 90                	xchg   %ax,%ax
+ 1d7:	66 90                	xchg   %ax,%ax
+ 1d9:	66 90                	xchg   %ax,%ax
+ 1db:	66 90                	xchg   %ax,%ax
+ 1dd:	66 90                	xchg   %ax,%ax
+ 1df:	90                   	nop
+
+000001e0 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	56                   	push   %esi
+ 1e5:	53                   	push   %ebx
+ 1e6:	83 ec 4c             	sub    $0x4c,%esp
+ 1e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ec:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 1f2:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+ 1f5:	83 fa 0f             	cmp    $0xf,%edx
+ 1f8:	0f 87 32 01 00 00    	ja     330 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+ 1fe:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 204:	8b 80 80 17 00 00    	mov    0x1780(%eax),%eax
+ 20a:	85 c0                	test   %eax,%eax
+ 20c:	0f 84 de 00 00 00    	je     2f0 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+ 212:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 218:	8b b0 84 17 00 00    	mov    0x1784(%eax),%esi
+ 21e:	8d 88 80 17 00 00    	lea    0x1780(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+ 224:	8d b8 88 17 00 00    	lea    0x1788(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+ 22a:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+ 22d:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+ 230:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+ 233:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+ 239:	0f 8f 01 01 00 00    	jg     340 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+ 23f:	8d 78 08             	lea    0x8(%eax),%edi
+ 242:	8d bc 3e 80 17 00 00 	lea    0x1780(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 249:	85 db                	test   %ebx,%ebx
+ 24b:	7e 3b                	jle    288 <bufwrite+0xa8>
+ 24d:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+ 250:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+ 253:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 257:	90                   	nop
+    *dst++ = *src++;
+ 258:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 259:	39 c6                	cmp    %eax,%esi
+ 25b:	75 fb                	jne    258 <bufwrite+0x78>
+  ob[fd].n += n;
+ 25d:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 263:	8b 88 84 17 00 00    	mov    0x1784(%eax),%ecx
+ 269:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 26b:	83 b8 80 17 00 00 01 	cmpl   $0x1,0x1780(%eax)
+  ob[fd].n += n;
+ 272:	89 88 84 17 00 00    	mov    %ecx,0x1784(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 278:	74 26                	je     2a0 <bufwrite+0xc0>
+}
+ 27a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 27d:	5b                   	pop    %ebx
+ 27e:	5e                   	pop    %esi
+ 27f:	5f                   	pop    %edi
+ 280:	5d                   	pop    %ebp
+ 281:	c3                   	ret
+ 282:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+ 288:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 28b:	83 b8 80 17 00 00 01 	cmpl   $0x1,0x1780(%eax)
+  ob[fd].n += n;
+ 292:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 295:	75 e3                	jne    27a <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+ 297:	85 db                	test   %ebx,%ebx
+ 299:	74 df                	je     27a <bufwrite+0x9a>
+ 29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+  src = vsrc;
+ 2a0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 2a3:	01 c3                	add    %eax,%ebx
+ 2a5:	eb 10                	jmp    2b7 <bufwrite+0xd7>
+ 2a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ae:	66 90                	xchg   %ax,%ax
+ 2b0:	83 c0 01             	add    $0x1,%eax
+ 2b3:	39 d8                	cmp    %ebx,%eax
+ 2b5:	74 c3                	je     27a <bufwrite+0x9a>
+    if(*p == (char)c)
+ 2b7:	80 38 0a             	cmpb   $0xa,(%eax)
+ 2ba:	75 f4                	jne    2b0 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 2bc:	85 c9                	test   %ecx,%ecx
+ 2be:	7e ba                	jle    27a <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 2c0:	83 ec 04             	sub    $0x4,%esp
+ 2c3:	51                   	push   %ecx
+ 2c4:	ff 75 ac             	push   -0x54(%ebp)
+ 2c7:	52                   	push   %edx
+ 2c8:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+ 2cb:	e8 cd 05 00 00       	call   89d <write>
+    ob[fd].n = 0;
+ 2d0:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+ 2d3:	83 c4 10             	add    $0x10,%esp
+ 2d6:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+ 2dc:	c7 82 84 17 00 00 00 	movl   $0x0,0x1784(%edx)
+ 2e3:	00 00 00 
+ 2e6:	eb 92                	jmp    27a <bufwrite+0x9a>
+ 2e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 2f0:	83 ec 08             	sub    $0x8,%esp
+ 2f3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 2f6:	50                   	push   %eax
+ 2f7:	52                   	push   %edx
+ 2f8:	89 55 b0             	mov    %edx,-0x50(%ebp)
+ 2fb:	e8 d7 05 00 00       	call   8d7 <fstat>
+ 300:	83 c4 10             	add    $0x10,%esp
+ 303:	8b 55 b0             	mov    -0x50(%ebp),%edx
+ 306:	89 c1                	mov    %eax,%ecx
+ 308:	b8 02 00 00 00       	mov    $0x2,%eax
+ 30d:	85 c9                	test   %ecx,%ecx
+ 30f:	75 0d                	jne    31e <bufwrite+0x13e>
+ 311:	31 c0                	xor    %eax,%eax
+ 313:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 318:	0f 95 c0             	setne  %al
+ 31b:	83 c0 01             	add    $0x1,%eax
+ 31e:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+ 324:	89 81 80 17 00 00    	mov    %eax,0x1780(%ecx)
+ 32a:	e9 e3 fe ff ff       	jmp    212 <bufwrite+0x32>
+ 32f:	90                   	nop
+}
+ 330:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 333:	5b                   	pop    %ebx
+ 334:	5e                   	pop    %esi
+ 335:	5f                   	pop    %edi
+ 336:	5d                   	pop    %ebp
+    write(fd, p, n);
+ 337:	e9 61 05 00 00       	jmp    89d <write>
+ 33c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+ 340:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+ 343:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+ 346:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+ 349:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+ 34c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+ 34f:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+ 352:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+ 355:	6a 02                	push   $0x2
+ 357:	50                   	push   %eax
+ 358:	52                   	push   %edx
+ 359:	e8 9b 06 00 00       	call   9f9 <writev>
+    ob[fd].n = 0;
+ 35e:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+ 361:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+ 364:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ 36b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 36e:	5b                   	pop    %ebx
+ 36f:	5e                   	pop    %esi
+ 370:	5f                   	pop    %edi
+ 371:	5d                   	pop    %ebp
+ 372:	c3                   	ret
+ 373:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000380 <fflush>:
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	53                   	push   %ebx
+ 384:	83 ec 04             	sub    $0x4,%esp
+ 387:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 38a:	83 f8 0f             	cmp    $0xf,%eax
+ 38d:	77 16                	ja     3a5 <fflush+0x25>
+ 38f:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+ 395:	8b 8a 84 17 00 00    	mov    0x1784(%edx),%ecx
+ 39b:	8d 9a 80 17 00 00    	lea    0x1780(%edx),%ebx
+ 3a1:	85 c9                	test   %ecx,%ecx
+ 3a3:	7f 0b                	jg     3b0 <fflush+0x30>
+}
+ 3a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3a8:	c9                   	leave
+ 3a9:	c3                   	ret
+ 3aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 3b0:	83 ec 04             	sub    $0x4,%esp
+ 3b3:	81 c2 88 17 00 00    	add    $0x1788,%edx
+ 3b9:	51                   	push   %ecx
+ 3ba:	52                   	push   %edx
+ 3bb:	50                   	push   %eax
+ 3bc:	e8 dc 04 00 00       	call   89d <write>
+    ob[fd].n = 0;
+ 3c1:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+ 3c8:	83 c4 10             	add    $0x10,%esp
+}
+ 3cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3ce:	c9                   	leave
+ 3cf:	c3                   	ret
+
+000003d0 <fflushall>:
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 3d4:	31 f6                	xor    %esi,%esi
+{
+ 3d6:	53                   	push   %ebx
+ 3d7:	bb 88 17 00 00       	mov    $0x1788,%ebx
+ 3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 3e0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 3e3:	85 c0                	test   %eax,%eax
+ 3e5:	7e 15                	jle    3fc <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 3e7:	83 ec 04             	sub    $0x4,%esp
+ 3ea:	50                   	push   %eax
+ 3eb:	53                   	push   %ebx
+ 3ec:	56                   	push   %esi
+ 3ed:	e8 ab 04 00 00       	call   89d <write>
+    ob[fd].n = 0;
+ 3f2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 3f9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 3fc:	83 c6 01             	add    $0x1,%esi
+ 3ff:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 405:	83 fe 10             	cmp    $0x10,%esi
+ 408:	75 d6                	jne    3e0 <fflushall+0x10>
+}
+ 40a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 40d:	5b                   	pop    %ebx
+ 40e:	5e                   	pop    %esi
+ 40f:	5d                   	pop    %ebp
+ 410:	c3                   	ret
+ 411:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 418:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41f:	90                   	nop
+
+00000420 <fork>:
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 424:	31 f6                	xor    %esi,%esi
+{
+ 426:	53                   	push   %ebx
+ 427:	bb 88 17 00 00       	mov    $0x1788,%ebx
+ 42c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 430:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 433:	85 c0                	test   %eax,%eax
+ 435:	7e 15                	jle    44c <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 437:	83 ec 04             	sub    $0x4,%esp
+ 43a:	50                   	push   %eax
+ 43b:	53                   	push   %ebx
+ 43c:	56                   	push   %esi
+ 43d:	e8 5b 04 00 00       	call   89d <write>
+    ob[fd].n = 0;
+ 442:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 449:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 44c:	83 c6 01             	add    $0x1,%esi
+ 44f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 455:	83 fe 10             	cmp    $0x10,%esi
+ 458:	75 d6                	jne    430 <fork+0x10>
+}
+ 45a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 45d:	5b                   	pop    %ebx
+ 45e:	5e                   	pop    %esi
+ 45f:	5d                   	pop    %ebp
+  return _fork();
+ 460:	e9 15 04 00 00       	jmp    87a <_fork>
+ 465:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000470 <exit>:
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+ 476:	e8 55 ff ff ff       	call   3d0 <fflushall>
+  _exit();
+ 47b:	e8 01 04 00 00       	call   881 <_exit>
+
+00000480 <exec>:
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	57                   	push   %edi
+ 484:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 485:	31 f6                	xor    %esi,%esi
+{
+ 487:	53                   	push   %ebx
+ 488:	bb 88 17 00 00       	mov    $0x1788,%ebx
+ 48d:	83 ec 1c             	sub    $0x1c,%esp
+ 490:	8b 45 08             	mov    0x8(%ebp),%eax
+ 493:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 496:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 499:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 4a0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 4a3:	85 c0                	test   %eax,%eax
+ 4a5:	7e 15                	jle    4bc <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 4a7:	83 ec 04             	sub    $0x4,%esp
+ 4aa:	50                   	push   %eax
+ 4ab:	53                   	push   %ebx
+ 4ac:	56                   	push   %esi
+ 4ad:	e8 eb 03 00 00       	call   89d <write>
+    ob[fd].n = 0;
+ 4b2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 4b9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 4bc:	83 c6 01             	add    $0x1,%esi
+ 4bf:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 4c5:	83 fe 10             	cmp    $0x10,%esi
+ 4c8:	75 d6                	jne    4a0 <exec+0x20>
+  return _exec(path, argv);
+ 4ca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 4cd:	89 7d 0c             	mov    %edi,0xc(%ebp)
+ 4d0:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ 4d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4d6:	5b                   	pop    %ebx
+ 4d7:	5e                   	pop    %esi
+ 4d8:	5f                   	pop    %edi
+ 4d9:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 4da:	e9 d3 03 00 00       	jmp    8b2 <_exec>
+ 4df:	90                   	nop
+
+000004e0 <close>:
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	56                   	push   %esi
+ 4e4:	53                   	push   %ebx
+ 4e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 4e8:	83 fb 0f             	cmp    $0xf,%ebx
+ 4eb:	77 26                	ja     513 <close+0x33>
+ 4ed:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 4f3:	8b 90 84 17 00 00    	mov    0x1784(%eax),%edx
+ 4f9:	8d b0 80 17 00 00    	lea    0x1780(%eax),%esi
+ 4ff:	85 d2                	test   %edx,%edx
+ 501:	7f 25                	jg     528 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+ 503:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 509:	c7 80 80 17 00 00 00 	movl   $0x0,0x1780(%eax)
+ 510:	00 00 00 
+  return _close(fd);
+ 513:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 516:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 519:	5b                   	pop    %ebx
+ 51a:	5e                   	pop    %esi
+ 51b:	5d                   	pop    %ebp
+  return _close(fd);
+ 51c:	e9 83 03 00 00       	jmp    8a4 <_close>
+ 521:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 528:	83 ec 04             	sub    $0x4,%esp
+ 52b:	05 88 17 00 00       	add    $0x1788,%eax
+ 530:	52                   	push   %edx
+ 531:	50                   	push   %eax
+ 532:	53                   	push   %ebx
+ 533:	e8 65 03 00 00       	call   89d <write>
+    ob[fd].n = 0;
+ 538:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+ 53f:	83 c4 10             	add    $0x10,%esp
+ 542:	eb bf                	jmp    503 <close+0x23>
+ 544:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 54b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 54f:	90                   	nop
+
+00000550 <strcpy>:
+{
+ 550:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+ 551:	31 c0                	xor    %eax,%eax
+{
+ 553:	89 e5                	mov    %esp,%ebp
+ 555:	53                   	push   %ebx
+ 556:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 559:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 55c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 560:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 564:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 567:	83 c0 01             	add    $0x1,%eax
+ 56a:	84 d2                	test   %dl,%dl
+ 56c:	75 f2                	jne    560 <strcpy+0x10>
+}
+ 56e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 571:	89 c8                	mov    %ecx,%eax
+ 573:	c9                   	leave
+ 574:	c3                   	ret
+ 575:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000580 <strcmp>:
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	53                   	push   %ebx
+ 584:	8b 55 08             	mov    0x8(%ebp),%edx
+ 587:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 58a:	0f b6 02             	movzbl (%edx),%eax
+ 58d:	84 c0                	test   %al,%al
+ 58f:	75 17                	jne    5a8 <strcmp+0x28>
+ 591:	eb 3a                	jmp    5cd <strcmp+0x4d>
+ 593:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 597:	90                   	nop
+ 598:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 59c:	83 c2 01             	add    $0x1,%edx
+ 59f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 5a2:	84 c0                	test   %al,%al
+ 5a4:	74 1a                	je     5c0 <strcmp+0x40>
+    p++, q++;
+ 5a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 5a8:	0f b6 19             	movzbl (%ecx),%ebx
+ 5ab:	38 c3                	cmp    %al,%bl
+ 5ad:	74 e9                	je     598 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 5af:	29 d8                	sub    %ebx,%eax
+}
+ 5b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5b4:	c9                   	leave
+ 5b5:	c3                   	ret
+ 5b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 5c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 5c4:	31 c0                	xor    %eax,%eax
+ 5c6:	29 d8                	sub    %ebx,%eax
+}
+ 5c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5cb:	c9                   	leave
+ 5cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 5cd:	0f b6 19             	movzbl (%ecx),%ebx
+ 5d0:	31 c0                	xor    %eax,%eax
+ 5d2:	eb db                	jmp    5af <strcmp+0x2f>
+ 5d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5df:	90                   	nop
+
+000005e0 <strlen>:
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+ 5e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+ 5e6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 5e9:	74 15                	je     600 <strlen+0x20>
+ 5eb:	31 c0                	xor    %eax,%eax
+ 5ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 5f0:	83 c0 01             	add    $0x1,%eax
+ 5f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 5f7:	89 c1                	mov    %eax,%ecx
+ 5f9:	75 f5                	jne    5f0 <strlen+0x10>
+}
+ 5fb:	89 c8                	mov    %ecx,%eax
+ 5fd:	5d                   	pop    %ebp
+ 5fe:	c3                   	ret
+ 5ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 600:	31 c9                	xor    %ecx,%ecx
+}
+ 602:	5d                   	pop    %ebp
+ 603:	89 c8                	mov    %ecx,%eax
+ 605:	c3                   	ret
+ 606:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000610 <memset>:
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	57                   	push   %edi
+ 614:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 617:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 61a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 61d:	89 d7                	mov    %edx,%edi
+ 61f:	fc                   	cld
+ 620:	f3 aa                	rep stos %al,%es:(%edi)
+}
+ 622:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 625:	89 d0                	mov    %edx,%eax
+ 627:	c9                   	leave
+ 628:	c3                   	ret
+ 629:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000630 <strchr>:
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	8b 45 08             	mov    0x8(%ebp),%eax
+ 636:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 63a:	0f b6 10             	movzbl (%eax),%edx
+ 63d:	84 d2                	test   %dl,%dl
+ 63f:	75 12                	jne    653 <strchr+0x23>
+ 641:	eb 1d                	jmp    660 <strchr+0x30>
+ 643:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 647:	90                   	nop
+ 648:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 64c:	83 c0 01             	add    $0x1,%eax
+ 64f:	84 d2                	test   %dl,%dl
+ 651:	74 0d                	je     660 <strchr+0x30>
+    if(*s == c)
+ 653:	38 d1                	cmp    %dl,%cl
+ 655:	75 f1                	jne    648 <strchr+0x18>
+}
+ 657:	5d                   	pop    %ebp
+ 658:	c3                   	ret
+ 659:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 660:	31 c0                	xor    %eax,%eax
+}
+ 662:	5d                   	pop    %ebp
+ 663:	c3                   	ret
+ 664:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 66f:	90                   	nop
+
+00000670 <memchr>:
+{
+ 670:	55                   	push   %ebp
+ 671:	89 e5                	mov    %esp,%ebp
+ 673:	8b 55 10             	mov    0x10(%ebp),%edx
+ 676:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 679:	85 d2                	test   %edx,%edx
+ 67b:	74 1b                	je     698 <memchr+0x28>
+    if(*p == (char)c)
+ 67d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+ 681:	01 c2                	add    %eax,%edx
+ 683:	eb 0a                	jmp    68f <memchr+0x1f>
+ 685:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+ 688:	83 c0 01             	add    $0x1,%eax
+ 68b:	39 c2                	cmp    %eax,%edx
+ 68d:	74 09                	je     698 <memchr+0x28>
+    if(*p == (char)c)
+ 68f:	38 08                	cmp    %cl,(%eax)
+ 691:	75 f5                	jne    688 <memchr+0x18>
+}
+ 693:	5d                   	pop    %ebp
+ 694:	c3                   	ret
+ 695:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+ 698:	31 c0                	xor    %eax,%eax
+}
+ 69a:	5d                   	pop    %ebp
+ 69b:	c3                   	ret
+ 69c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006a0 <gets>:
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+ 6a4:	31 ff                	xor    %edi,%edi
+{
+ 6a6:	56                   	push   %esi
+ 6a7:	be 88 17 00 00       	mov    $0x1788,%esi
+ 6ac:	53                   	push   %ebx
+ 6ad:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 6b0:	8b 46 fc             	mov    -0x4(%esi),%eax
+ 6b3:	85 c0                	test   %eax,%eax
+ 6b5:	7e 15                	jle    6cc <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 6b7:	83 ec 04             	sub    $0x4,%esp
+ 6ba:	50                   	push   %eax
+ 6bb:	56                   	push   %esi
+ 6bc:	57                   	push   %edi
+ 6bd:	e8 db 01 00 00       	call   89d <write>
+    ob[fd].n = 0;
+ 6c2:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+ 6c9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 6cc:	83 c7 01             	add    $0x1,%edi
+ 6cf:	81 c6 08 01 00 00    	add    $0x108,%esi
+ 6d5:	83 ff 10             	cmp    $0x10,%edi
+ 6d8:	75 d6                	jne    6b0 <gets+0x10>
+  for(i=0; i+1 < max; ){
+ 6da:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+ 6dc:	8d 75 e7             	lea    -0x19(%ebp),%esi
+ 6df:	eb 2e                	jmp    70f <gets+0x6f>
+ 6e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6e8:	83 ec 04             	sub    $0x4,%esp
+ 6eb:	6a 01                	push   $0x1
+ 6ed:	56                   	push   %esi
+ 6ee:	6a 00                	push   $0x0
+ 6f0:	e8 a1 01 00 00       	call   896 <read>
+    if(cc < 1)
+ 6f5:	83 c4 10             	add    $0x10,%esp
+ 6f8:	85 c0                	test   %eax,%eax
+ 6fa:	7e 1d                	jle    719 <gets+0x79>
+    buf[i++] = c;
+ 6fc:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 700:	8b 55 08             	mov    0x8(%ebp),%edx
+ 703:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 707:	3c 0a                	cmp    $0xa,%al
+ 709:	74 10                	je     71b <gets+0x7b>
+ 70b:	3c 0d                	cmp    $0xd,%al
+ 70d:	74 0c                	je     71b <gets+0x7b>
+  for(i=0; i+1 < max; ){
+ 70f:	89 df                	mov    %ebx,%edi
+ 711:	83 c3 01             	add    $0x1,%ebx
+ 714:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 717:	7c cf                	jl     6e8 <gets+0x48>
+ 719:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 71b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 71e:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 722:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 725:	5b                   	pop    %ebx
+ 726:	5e                   	pop    %esi
+ 727:	5f                   	pop    %edi
+ 728:	5d                   	pop    %ebp
+ 729:	c3                   	ret
+ 72a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000730 <stat>:
+{
+ 730:	55                   	push   %ebp
+ 731:	89 e5                	mov    %esp,%ebp
+ 733:	57                   	push   %edi
+ 734:	56                   	push   %esi
+ 735:	53                   	push   %ebx
+ 736:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+ 739:	6a 00                	push   $0x0
+ 73b:	ff 75 08             	push   0x8(%ebp)
+ 73e:	e8 76 01 00 00       	call   8b9 <open>
+  if(fd < 0)
+ 743:	83 c4 10             	add    $0x10,%esp
+ 746:	85 c0                	test   %eax,%eax
+ 748:	78 76                	js     7c0 <stat+0x90>
+  r = fstat(fd, st);
+ 74a:	83 ec 08             	sub    $0x8,%esp
+ 74d:	ff 75 0c             	push   0xc(%ebp)
+ 750:	89 c3                	mov    %eax,%ebx
+ 752:	50                   	push   %eax
+ 753:	e8 7f 01 00 00       	call   8d7 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 758:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 75b:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 75d:	83 fb 0f             	cmp    $0xf,%ebx
+ 760:	7f 40                	jg     7a2 <stat+0x72>
+ 762:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 768:	8b 90 84 17 00 00    	mov    0x1784(%eax),%edx
+ 76e:	8d b8 80 17 00 00    	lea    0x1780(%eax),%edi
+ 774:	85 d2                	test   %edx,%edx
+ 776:	7e 1a                	jle    792 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 778:	83 ec 04             	sub    $0x4,%esp
+ 77b:	05 88 17 00 00       	add    $0x1788,%eax
+ 780:	52                   	push   %edx
+ 781:	50                   	push   %eax
+ 782:	53                   	push   %ebx
+ 783:	e8 15 01 00 00       	call   89d <write>
+    ob[fd].n = 0;
+ 788:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+ 78f:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+ 792:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 798:	c7 80 80 17 00 00 00 	movl   $0x0,0x1780(%eax)
+ 79f:	00 00 00 
+  return _close(fd);
+ 7a2:	83 ec 0c             	sub    $0xc,%esp
+ 7a5:	53                   	push   %ebx
+ 7a6:	e8 f9 00 00 00       	call   8a4 <_close>
+ 7ab:	83 c4 10             	add    $0x10,%esp
+}
+ 7ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7b1:	89 f0                	mov    %esi,%eax
+ 7b3:	5b                   	pop    %ebx
+ 7b4:	5e                   	pop    %esi
+ 7b5:	5f                   	pop    %edi
+ 7b6:	5d                   	pop    %ebp
+ 7b7:	c3                   	ret
+ 7b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7bf:	90                   	nop
+    return -1;
+ 7c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 7c5:	eb e7                	jmp    7ae <stat+0x7e>
+ 7c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ce:	66 90                	xchg   %ax,%ax
+
+000007d0 <atoi>:
+{
+ 7d0:	55                   	push   %ebp
+ 7d1:	89 e5                	mov    %esp,%ebp
+ 7d3:	53                   	push   %ebx
+ 7d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 7d7:	0f be 02             	movsbl (%edx),%eax
+ 7da:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 7dd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 7e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 7e5:	77 1e                	ja     805 <atoi+0x35>
+ 7e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 7f0:	83 c2 01             	add    $0x1,%edx
+ 7f3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 7f6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 7fa:	0f be 02             	movsbl (%edx),%eax
+ 7fd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 800:	80 fb 09             	cmp    $0x9,%bl
+ 803:	76 eb                	jbe    7f0 <atoi+0x20>
+}
+ 805:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 808:	89 c8                	mov    %ecx,%eax
+ 80a:	c9                   	leave
+ 80b:	c3                   	ret
+ 80c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000810 <memmove>:
+{
+ 810:	55                   	push   %ebp
+ 811:	89 e5                	mov    %esp,%ebp
+ 813:	57                   	push   %edi
+ 814:	56                   	push   %esi
+ 815:	8b 45 10             	mov    0x10(%ebp),%eax
+ 818:	8b 55 08             	mov    0x8(%ebp),%edx
+ 81b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 81e:	85 c0                	test   %eax,%eax
+ 820:	7e 13                	jle    835 <memmove+0x25>
+ 822:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 824:	89 d7                	mov    %edx,%edi
+ 826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 82d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 830:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 831:	39 f8                	cmp    %edi,%eax
+ 833:	75 fb                	jne    830 <memmove+0x20>
+  return vdst;
+}
+ 835:	5e                   	pop    %esi
+ 836:	89 d0                	mov    %edx,%eax
+ 838:	5f                   	pop    %edi
+ 839:	5d                   	pop    %ebp
+ 83a:	c3                   	ret
+
+0000083b <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+ 83b:	83 3d 78 17 00 00 00 	cmpl   $0x0,0x1778
+  jle 1f
+ 842:	7e 0a                	jle    84e <syscallentry+0x13>
+  movl %esp, %ecx
+ 844:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 846:	ba 4d 08 00 00       	mov    $0x84d,%edx
+  sysenter
+ 84b:	0f 34                	sysenter
+2:
+  ret
+ 84d:	c3                   	ret
+1:
+  jl 3f
+ 84e:	7c 27                	jl     877 <syscallentry+0x3c>
+  pushal
+ 850:	60                   	pusha
+  movl $1, %eax
+ 851:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 856:	0f a2                	cpuid
+  movl $-1, sysentermode
+ 858:	c7 05 78 17 00 00 ff 	movl   $0xffffffff,0x1778
+ 85f:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 862:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+ 868:	74 0a                	je     874 <syscallentry+0x39>
+  movl $1, sysentermode
+ 86a:	c7 05 78 17 00 00 01 	movl   $0x1,0x1778
+ 871:	00 00 00 
+4:
+  popal
+ 874:	61                   	popa
+  jmp syscallentry
+ 875:	eb c4                	jmp    83b <syscallentry>
+3:
+  int $T_SYSCALL
+ 877:	cd 40                	int    $0x40
+  ret
+ 879:	c3                   	ret
+
+0000087a <_fork>:
+
+SYSCALLAS(_fork, fork)
+ 87a:	b8 01 00 00 00       	mov    $0x1,%eax
+ 87f:	eb ba                	jmp    83b <syscallentry>
+
+00000881 <_exit>:
+SYSCALLAS(_exit, exit)
+ 881:	b8 02 00 00 00       	mov    $0x2,%eax
+ 886:	eb b3                	jmp    83b <syscallentry>
+
+00000888 <wait>:
+SYSCALL(wait)
+ 888:	b8 03 00 00 00       	mov    $0x3,%eax
+ 88d:	eb ac                	jmp    83b <syscallentry>
+
+0000088f <pipe>:
+SYSCALL(pipe)
+ 88f:	b8 04 00 00 00       	mov    $0x4,%eax
+ 894:	eb a5                	jmp    83b <syscallentry>
+
+00000896 <read>:
+SYSCALL(read)
+ 896:	b8 05 00 00 00       	mov    $0x5,%eax
+ 89b:	eb 9e                	jmp    83b <syscallentry>
+
+0000089d <write>:
+SYSCALL(write)
+ 89d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 8a2:	eb 97                	jmp    83b <syscallentry>
+
+000008a4 <_close>:
+SYSCALLAS(_close, close)
+ 8a4:	b8 15 00 00 00       	mov    $0x15,%eax
+ 8a9:	eb 90                	jmp    83b <syscallentry>
+
+000008ab <kill>:
+SYSCALL(kill)
+ 8ab:	b8 06 00 00 00       	mov    $0x6,%eax
+ 8b0:	eb 89                	jmp    83b <syscallentry>
+
+000008b2 <_exec>:
+SYSCALLAS(_exec, exec)
+ 8b2:	b8 07 00 00 00       	mov    $0x7,%eax
+ 8b7:	eb 82                	jmp    83b <syscallentry>
+
+000008b9 <open>:
+SYSCALL(open)
+ 8b9:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 8be:	e9 78 ff ff ff       	jmp    83b <syscallentry>
+
+000008c3 <mknod>:
+SYSCALL(mknod)
+ 8c3:	b8 11 00 00 00       	mov    $0x11,%eax
+ 8c8:	e9 6e ff ff ff       	jmp    83b <syscallentry>
+
+000008cd <unlink>:
+SYSCALL(unlink)
+ 8cd:	b8 12 00 00 00       	mov    $0x12,%eax
+ 8d2:	e9 64 ff ff ff       	jmp    83b <syscallentry>
+
+000008d7 <fstat>:
+SYSCALL(fstat)
+ 8d7:	b8 08 00 00 00       	mov    $0x8,%eax
+ 8dc:	e9 5a ff ff ff       	jmp    83b <syscallentry>
+
+000008e1 <link>:
+SYSCALL(link)
+ 8e1:	b8 13 00 00 00       	mov    $0x13,%eax
+ 8e6:	e9 50 ff ff ff       	jmp    83b <syscallentry>
+
+000008eb <mkdir>:
+SYSCALL(mkdir)
+ 8eb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 8f0:	e9 46 ff ff ff       	jmp    83b <syscallentry>
+
+000008f5 <chdir>:
+SYSCALL(chdir)
+ 8f5:	b8 09 00 00 00       	mov    $0x9,%eax
+ 8fa:	e9 3c ff ff ff       	jmp    83b <syscallentry>
+
+000008ff <dup>:
+SYSCALL(dup)
+ 8ff:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 904:	e9 32 ff ff ff       	jmp    83b <syscallentry>
+
+00000909 <getpid>:
+SYSCALL(getpid)
+ 909:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 90e:	e9 28 ff ff ff       	jmp    83b <syscallentry>
+
+00000913 <sbrk>:
+SYSCALL(sbrk)
+ 913:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 918:	e9 1e ff ff ff       	jmp    83b <syscallentry>
+
+0000091d <sleep>:
+SYSCALL(sleep)
+ 91d:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 922:	e9 14 ff ff ff       	jmp    83b <syscallentry>
+
+00000927 <uptime>:
+SYSCALL(uptime)
+ 927:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 92c:	e9 0a ff ff ff       	jmp    83b <syscallentry>
+
+00000931 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+ 931:	b8 16 00 00 00       	mov    $0x16,%eax
+ 936:	e9 00 ff ff ff       	jmp    83b <syscallentry>
+
+0000093b <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+ 93b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 940:	e9 f6 fe ff ff       	jmp    83b <syscallentry>
+
+00000945 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+ 945:	b8 18 00 00 00       	mov    $0x18,%eax
+ 94a:	e9 ec fe ff ff       	jmp    83b <syscallentry>
+
+0000094f <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+ 94f:	b8 19 00 00 00       	mov    $0x19,%eax
+ 954:	e9 e2 fe ff ff       	jmp    83b <syscallentry>
+
+00000959 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+ 959:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 95e:	e9 d8 fe ff ff       	jmp    83b <syscallentry>
+
+00000963 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+ 963:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 968:	e9 ce fe ff ff       	jmp    83b <syscallentry>
+
+0000096d <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+ 96d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 972:	e9 c4 fe ff ff       	jmp    83b <syscallentry>
+
+00000977 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+ 977:	b8 20 00 00 00       	mov    $0x20,%eax
+ 97c:	e9 ba fe ff ff       	jmp    83b <syscallentry>
+
+00000981 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+ 981:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 986:	e9 b0 fe ff ff       	jmp    83b <syscallentry>
+
+0000098b <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+ 98b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 990:	e9 a6 fe ff ff       	jmp    83b <syscallentry>
+
+00000995 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+ 995:	b8 21 00 00 00       	mov    $0x21,%eax
+ 99a:	e9 9c fe ff ff       	jmp    83b <syscallentry>
+
+0000099f <yield>:
+SYSCALL(yield) // yield the CPU to another process
+ 99f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 9a4:	e9 92 fe ff ff       	jmp    83b <syscallentry>
+
+000009a9 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+ 9a9:	b8 23 00 00 00       	mov    $0x23,%eax
+ 9ae:	e9 88 fe ff ff       	jmp    83b <syscallentry>
+
+000009b3 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+ 9b3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 9b8:	e9 7e fe ff ff       	jmp    83b <syscallentry>
+
+000009bd <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+ 9bd:	b8 25 00 00 00       	mov    $0x25,%eax
+ 9c2:	e9 74 fe ff ff       	jmp    83b <syscallentry>
+
+000009c7 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+ 9c7:	b8 26 00 00 00       	mov    $0x26,%eax
+ 9cc:	e9 6a fe ff ff       	jmp    83b <syscallentry>
+
+000009d1 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+ 9d1:	b8 27 00 00 00       	mov    $0x27,%eax
+ 9d6:	e9 60 fe ff ff       	jmp    83b <syscallentry>
+
+000009db <mmap>:
+SYSCALL(mmap) // map a file into memory
+ 9db:	b8 28 00 00 00       	mov    $0x28,%eax
+ 9e0:	e9 56 fe ff ff       	jmp    83b <syscallentry>
+
+000009e5 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+ 9e5:	b8 29 00 00 00       	mov    $0x29,%eax
+ 9ea:	e9 4c fe ff ff       	jmp    83b <syscallentry>
+
+000009ef <readv>:
+SYSCALL(readv) // read into several buffers
+ 9ef:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 9f4:	e9 42 fe ff ff       	jmp    83b <syscallentry>
+
+000009f9 <writev>:
+SYSCALL(writev) // write from several buffers
+ 9f9:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 9fe:	e9 38 fe ff ff       	jmp    83b <syscallentry>
+
+00000a03 <pread>:
+SYSCALL(pread) // read at an offset
+ a03:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ a08:	e9 2e fe ff ff       	jmp    83b <syscallentry>
+
+00000a0d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+ a0d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ a12:	e9 24 fe ff ff       	jmp    83b <syscallentry>
+
+00000a17 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+ a17:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ a1c:	e9 1a fe ff ff       	jmp    83b <syscallentry>
+
+00000a21 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+ a21:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ a26:	e9 10 fe ff ff       	jmp    83b <syscallentry>
+
+00000a2b <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+ a2b:	b8 30 00 00 00       	mov    $0x30,%eax
+ a30:	e9 06 fe ff ff       	jmp    83b <syscallentry>
+
+00000a35 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+ a35:	b8 31 00 00 00       	mov    $0x31,%eax
+ a3a:	e9 fc fd ff ff       	jmp    83b <syscallentry>
+
+00000a3f <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+ a3f:	b8 32 00 00 00       	mov    $0x32,%eax
+ a44:	e9 f2 fd ff ff       	jmp    83b <syscallentry>
+
+00000a49 <profread>:
+SYSCALL(profread) // drain profiler samples
+ a49:	b8 33 00 00 00       	mov    $0x33,%eax
+ a4e:	e9 e8 fd ff ff       	jmp    83b <syscallentry>
+
+00000a53 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+ a53:	b8 34 00 00 00       	mov    $0x34,%eax
+ a58:	e9 de fd ff ff       	jmp    83b <syscallentry>
+
+00000a5d <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+ a5d:	b8 35 00 00 00       	mov    $0x35,%eax
+ a62:	e9 d4 fd ff ff       	jmp    83b <syscallentry>
+
+00000a67 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+ a67:	b8 36 00 00 00       	mov    $0x36,%eax
+ a6c:	e9 ca fd ff ff       	jmp    83b <syscallentry>
+
+00000a71 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+ a71:	b8 37 00 00 00       	mov    $0x37,%eax
+ a76:	e9 c0 fd ff ff       	jmp    83b <syscallentry>
+ a7b:	66 90                	xchg   %ax,%ax
+ a7d:	66 90                	xchg   %ax,%ax
+ a7f:	90                   	nop
+
+00000a80 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a80:	55                   	push   %ebp
+ a81:	89 e5                	mov    %esp,%ebp
+ a83:	57                   	push   %edi
+ a84:	56                   	push   %esi
+ a85:	53                   	push   %ebx
+ a86:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ a88:	89 d1                	mov    %edx,%ecx
+{
+ a8a:	83 ec 3c             	sub    $0x3c,%esp
+ a8d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ a90:	85 d2                	test   %edx,%edx
+ a92:	0f 89 80 00 00 00    	jns    b18 <printint+0x98>
+ a98:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ a9c:	74 7a                	je     b18 <printint+0x98>
+    x = -xx;
+ a9e:	f7 d9                	neg    %ecx
+    neg = 1;
+ aa0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ aa5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ aa8:	31 f6                	xor    %esi,%esi
+ aaa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ ab0:	89 c8                	mov    %ecx,%eax
+ ab2:	31 d2                	xor    %edx,%edx
+ ab4:	89 f7                	mov    %esi,%edi
+ ab6:	f7 f3                	div    %ebx
+ ab8:	8d 76 01             	lea    0x1(%esi),%esi
+ abb:	0f b6 92 e8 12 00 00 	movzbl 0x12e8(%edx),%edx
+ ac2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ ac6:	89 ca                	mov    %ecx,%edx
+ ac8:	89 c1                	mov    %eax,%ecx
+ aca:	39 da                	cmp    %ebx,%edx
+ acc:	73 e2                	jae    ab0 <printint+0x30>
+  if(neg)
+ ace:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ ad1:	85 c0                	test   %eax,%eax
+ ad3:	74 07                	je     adc <printint+0x5c>
+    buf[i++] = '-';
+ ad5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ ada:	89 f7                	mov    %esi,%edi
+ adc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ adf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ ae2:	01 df                	add    %ebx,%edi
+ ae4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ ae8:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+ aeb:	83 ec 04             	sub    $0x4,%esp
+ aee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ af1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ af4:	6a 01                	push   $0x1
+ af6:	50                   	push   %eax
+ af7:	56                   	push   %esi
+ af8:	e8 e3 f6 ff ff       	call   1e0 <bufwrite>
+  while(--i >= 0)
+ afd:	89 f8                	mov    %edi,%eax
+ aff:	83 c4 10             	add    $0x10,%esp
+ b02:	83 ef 01             	sub    $0x1,%edi
+ b05:	39 d8                	cmp    %ebx,%eax
+ b07:	75 df                	jne    ae8 <printint+0x68>
+}
+ b09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b0c:	5b                   	pop    %ebx
+ b0d:	5e                   	pop    %esi
+ b0e:	5f                   	pop    %edi
+ b0f:	5d                   	pop    %ebp
+ b10:	c3                   	ret
+ b11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ b18:	31 c0                	xor    %eax,%eax
+ b1a:	eb 89                	jmp    aa5 <printint+0x25>
+ b1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b20 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ b20:	55                   	push   %ebp
+ b21:	89 e5                	mov    %esp,%ebp
+ b23:	57                   	push   %edi
+ b24:	56                   	push   %esi
+ b25:	53                   	push   %ebx
+ b26:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ b29:	8b 45 0c             	mov    0xc(%ebp),%eax
+ b2c:	0f b6 18             	movzbl (%eax),%ebx
+ b2f:	84 db                	test   %bl,%bl
+ b31:	74 6c                	je     b9f <printf+0x7f>
+ b33:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+ b36:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ b39:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ b3b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ b3e:	eb 26                	jmp    b66 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ b40:	83 f8 25             	cmp    $0x25,%eax
+ b43:	74 4b                	je     b90 <printf+0x70>
+  bufwrite(fd, &c, 1);
+ b45:	83 ec 04             	sub    $0x4,%esp
+ b48:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ b4b:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ b4e:	6a 01                	push   $0x1
+ b50:	50                   	push   %eax
+ b51:	ff 75 08             	push   0x8(%ebp)
+ b54:	e8 87 f6 ff ff       	call   1e0 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+ b59:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ b5c:	0f b6 1f             	movzbl (%edi),%ebx
+ b5f:	83 c7 01             	add    $0x1,%edi
+ b62:	84 db                	test   %bl,%bl
+ b64:	74 39                	je     b9f <printf+0x7f>
+    c = fmt[i] & 0xff;
+ b66:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ b69:	85 f6                	test   %esi,%esi
+ b6b:	74 d3                	je     b40 <printf+0x20>
+      }
+    } else if(state == '%'){
+ b6d:	83 fe 25             	cmp    $0x25,%esi
+ b70:	75 ea                	jne    b5c <printf+0x3c>
+      if(c == 'd'){
+ b72:	83 f8 25             	cmp    $0x25,%eax
+ b75:	0f 84 d5 01 00 00    	je     d50 <printf+0x230>
+ b7b:	83 e8 63             	sub    $0x63,%eax
+ b7e:	83 f8 15             	cmp    $0x15,%eax
+ b81:	77 45                	ja     bc8 <printf+0xa8>
+ b83:	ff 24 85 90 12 00 00 	jmp    *0x1290(,%eax,4)
+ b8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+ b90:	0f b6 1f             	movzbl (%edi),%ebx
+ b93:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+ b96:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ b9b:	84 db                	test   %bl,%bl
+ b9d:	75 c7                	jne    b66 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+ b9f:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+ ba3:	74 0b                	je     bb0 <printf+0x90>
+    fflush(fd);
+}
+ ba5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ba8:	5b                   	pop    %ebx
+ ba9:	5e                   	pop    %esi
+ baa:	5f                   	pop    %edi
+ bab:	5d                   	pop    %ebp
+ bac:	c3                   	ret
+ bad:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+ bb0:	83 ec 0c             	sub    $0xc,%esp
+ bb3:	6a 02                	push   $0x2
+ bb5:	e8 c6 f7 ff ff       	call   380 <fflush>
+ bba:	83 c4 10             	add    $0x10,%esp
+}
+ bbd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ bc0:	5b                   	pop    %ebx
+ bc1:	5e                   	pop    %esi
+ bc2:	5f                   	pop    %edi
+ bc3:	5d                   	pop    %ebp
+ bc4:	c3                   	ret
+ bc5:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+ bc8:	83 ec 04             	sub    $0x4,%esp
+ bcb:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ bce:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+ bd2:	6a 01                	push   $0x1
+ bd4:	52                   	push   %edx
+ bd5:	89 55 c0             	mov    %edx,-0x40(%ebp)
+ bd8:	ff 75 08             	push   0x8(%ebp)
+ bdb:	e8 00 f6 ff ff       	call   1e0 <bufwrite>
+ be0:	83 c4 0c             	add    $0xc,%esp
+ be3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ be6:	6a 01                	push   $0x1
+ be8:	8b 55 c0             	mov    -0x40(%ebp),%edx
+ beb:	52                   	push   %edx
+      state = 0;
+ bec:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+ bee:	ff 75 08             	push   0x8(%ebp)
+ bf1:	e8 ea f5 ff ff       	call   1e0 <bufwrite>
+        putc(fd, c);
+ bf6:	83 c4 10             	add    $0x10,%esp
+ bf9:	e9 5e ff ff ff       	jmp    b5c <printf+0x3c>
+ bfe:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+ c00:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ c03:	83 ec 0c             	sub    $0xc,%esp
+ c06:	b9 10 00 00 00       	mov    $0x10,%ecx
+ c0b:	8b 16                	mov    (%esi),%edx
+ c0d:	6a 00                	push   $0x0
+ c0f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+ c12:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+ c15:	e8 66 fe ff ff       	call   a80 <printint>
+        ap++;
+ c1a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ c1d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c20:	31 f6                	xor    %esi,%esi
+ c22:	e9 35 ff ff ff       	jmp    b5c <printf+0x3c>
+ c27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c2e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+ c30:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ c33:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ c35:	83 c0 04             	add    $0x4,%eax
+ c38:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+ c3b:	b8 89 12 00 00       	mov    $0x1289,%eax
+ c40:	85 db                	test   %ebx,%ebx
+ c42:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+ c45:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+ c48:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+ c4a:	53                   	push   %ebx
+ c4b:	e8 90 f9 ff ff       	call   5e0 <strlen>
+ c50:	83 c4 0c             	add    $0xc,%esp
+ c53:	50                   	push   %eax
+ c54:	53                   	push   %ebx
+ c55:	ff 75 08             	push   0x8(%ebp)
+ c58:	e8 83 f5 ff ff       	call   1e0 <bufwrite>
+ c5d:	83 c4 10             	add    $0x10,%esp
+ c60:	e9 f7 fe ff ff       	jmp    b5c <printf+0x3c>
+ c65:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ c68:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+ c6b:	83 ec 04             	sub    $0x4,%esp
+ c6e:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+ c71:	8b 06                	mov    (%esi),%eax
+        ap++;
+ c73:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+ c76:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+ c79:	6a 01                	push   $0x1
+ c7b:	52                   	push   %edx
+ c7c:	ff 75 08             	push   0x8(%ebp)
+ c7f:	e8 5c f5 ff ff       	call   1e0 <bufwrite>
+        ap++;
+ c84:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ c87:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c8a:	31 f6                	xor    %esi,%esi
+ c8c:	e9 cb fe ff ff       	jmp    b5c <printf+0x3c>
+ c91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+ c98:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ c9b:	83 ec 0c             	sub    $0xc,%esp
+ c9e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ ca3:	8b 16                	mov    (%esi),%edx
+ ca5:	6a 01                	push   $0x1
+ ca7:	e9 63 ff ff ff       	jmp    c0f <printf+0xef>
+ cac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+ cb0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ cb3:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ cb6:	89 7d c0             	mov    %edi,-0x40(%ebp)
+ cb9:	89 55 bc             	mov    %edx,-0x44(%ebp)
+ cbc:	8b 18                	mov    (%eax),%ebx
+ cbe:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+ cc1:	31 c0                	xor    %eax,%eax
+ cc3:	89 c7                	mov    %eax,%edi
+ cc5:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+ cc8:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+ ccd:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+ ccf:	f7 e1                	mul    %ecx
+ cd1:	c1 ea 03             	shr    $0x3,%edx
+ cd4:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ cd7:	89 d1                	mov    %edx,%ecx
+ cd9:	01 c0                	add    %eax,%eax
+ cdb:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ cdd:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+ cdf:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ ce1:	be 0a 00 00 00       	mov    $0xa,%esi
+ ce6:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+ ce8:	89 da                	mov    %ebx,%edx
+ cea:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+ cec:	89 fe                	mov    %edi,%esi
+ cee:	83 c7 01             	add    $0x1,%edi
+ cf1:	8d 42 30             	lea    0x30(%edx),%eax
+ cf4:	89 da                	mov    %ebx,%edx
+ cf6:	8d 14 92             	lea    (%edx,%edx,4),%edx
+ cf9:	01 d2                	add    %edx,%edx
+ cfb:	29 d0                	sub    %edx,%eax
+ cfd:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+ d01:	89 c8                	mov    %ecx,%eax
+ d03:	09 d8                	or     %ebx,%eax
+ d05:	75 c1                	jne    cc8 <printf+0x1a8>
+ d07:	8b 55 bc             	mov    -0x44(%ebp),%edx
+ d0a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ d0d:	01 d6                	add    %edx,%esi
+ d0f:	89 f7                	mov    %esi,%edi
+ d11:	89 d6                	mov    %edx,%esi
+ d13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d17:	90                   	nop
+    putc(fd, buf[i]);
+ d18:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+ d1b:	83 ec 04             	sub    $0x4,%esp
+ d1e:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+ d21:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+ d24:	6a 01                	push   $0x1
+ d26:	50                   	push   %eax
+ d27:	53                   	push   %ebx
+ d28:	e8 b3 f4 ff ff       	call   1e0 <bufwrite>
+  while(--i >= 0)
+ d2d:	89 fa                	mov    %edi,%edx
+ d2f:	83 c4 10             	add    $0x10,%esp
+ d32:	83 ef 01             	sub    $0x1,%edi
+ d35:	39 d6                	cmp    %edx,%esi
+ d37:	75 df                	jne    d18 <printf+0x1f8>
+        ap += 2;
+ d39:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+ d3d:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+ d40:	31 f6                	xor    %esi,%esi
+ d42:	e9 15 fe ff ff       	jmp    b5c <printf+0x3c>
+ d47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d4e:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+ d50:	83 ec 04             	sub    $0x4,%esp
+ d53:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ d56:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ d59:	6a 01                	push   $0x1
+ d5b:	e9 8b fe ff ff       	jmp    beb <printf+0xcb>
+
+00000d60 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ d60:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d61:	a1 00 28 00 00       	mov    0x2800,%eax
+{
+ d66:	89 e5                	mov    %esp,%ebp
+ d68:	57                   	push   %edi
+ d69:	56                   	push   %esi
+ d6a:	53                   	push   %ebx
+ d6b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ d6e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d78:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d7a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d7c:	39 ca                	cmp    %ecx,%edx
+ d7e:	73 30                	jae    db0 <free+0x50>
+ d80:	39 c1                	cmp    %eax,%ecx
+ d82:	72 04                	jb     d88 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d84:	39 c2                	cmp    %eax,%edx
+ d86:	72 f0                	jb     d78 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ d88:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ d8b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ d8e:	39 f8                	cmp    %edi,%eax
+ d90:	74 2e                	je     dc0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d92:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ d95:	8b 42 04             	mov    0x4(%edx),%eax
+ d98:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d9b:	39 f1                	cmp    %esi,%ecx
+ d9d:	74 38                	je     dd7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ d9f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ da1:	5b                   	pop    %ebx
+  freep = p;
+ da2:	89 15 00 28 00 00    	mov    %edx,0x2800
+}
+ da8:	5e                   	pop    %esi
+ da9:	5f                   	pop    %edi
+ daa:	5d                   	pop    %ebp
+ dab:	c3                   	ret
+ dac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ db0:	39 c1                	cmp    %eax,%ecx
+ db2:	72 d0                	jb     d84 <free+0x24>
+ db4:	eb c2                	jmp    d78 <free+0x18>
+ db6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dbd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ dc0:	03 70 04             	add    0x4(%eax),%esi
+ dc3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ dc6:	8b 02                	mov    (%edx),%eax
+ dc8:	8b 00                	mov    (%eax),%eax
+ dca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ dcd:	8b 42 04             	mov    0x4(%edx),%eax
+ dd0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ dd3:	39 f1                	cmp    %esi,%ecx
+ dd5:	75 c8                	jne    d9f <free+0x3f>
+    p->s.size += bp->s.size;
+ dd7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ dda:	89 15 00 28 00 00    	mov    %edx,0x2800
+    p->s.size += bp->s.size;
+ de0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ de3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ de6:	89 0a                	mov    %ecx,(%edx)
+}
+ de8:	5b                   	pop    %ebx
+ de9:	5e                   	pop    %esi
+ dea:	5f                   	pop    %edi
+ deb:	5d                   	pop    %ebp
+ dec:	c3                   	ret
+ ded:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000df0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ df0:	55                   	push   %ebp
+ df1:	89 e5                	mov    %esp,%ebp
+ df3:	57                   	push   %edi
+ df4:	56                   	push   %esi
+ df5:	53                   	push   %ebx
+ df6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ df9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ dfc:	8b 15 00 28 00 00    	mov    0x2800,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e02:	8d 78 07             	lea    0x7(%eax),%edi
+ e05:	c1 ef 03             	shr    $0x3,%edi
+ e08:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ e0b:	85 d2                	test   %edx,%edx
+ e0d:	0f 84 8d 00 00 00    	je     ea0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e13:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ e15:	8b 48 04             	mov    0x4(%eax),%ecx
+ e18:	39 f9                	cmp    %edi,%ecx
+ e1a:	73 64                	jae    e80 <malloc+0x90>
+  if(nu < 4096)
+ e1c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ e21:	39 df                	cmp    %ebx,%edi
+ e23:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ e26:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ e2d:	eb 0a                	jmp    e39 <malloc+0x49>
+ e2f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e30:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ e32:	8b 48 04             	mov    0x4(%eax),%ecx
+ e35:	39 f9                	cmp    %edi,%ecx
+ e37:	73 47                	jae    e80 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ e39:	89 c2                	mov    %eax,%edx
+ e3b:	39 05 00 28 00 00    	cmp    %eax,0x2800
+ e41:	75 ed                	jne    e30 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ e43:	83 ec 0c             	sub    $0xc,%esp
+ e46:	56                   	push   %esi
+ e47:	e8 c7 fa ff ff       	call   913 <sbrk>
+  if(p == (char*)-1)
+ e4c:	83 c4 10             	add    $0x10,%esp
+ e4f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ e52:	74 1c                	je     e70 <malloc+0x80>
+  hp->s.size = nu;
+ e54:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ e57:	83 ec 0c             	sub    $0xc,%esp
+ e5a:	83 c0 08             	add    $0x8,%eax
+ e5d:	50                   	push   %eax
+ e5e:	e8 fd fe ff ff       	call   d60 <free>
+  return freep;
+ e63:	8b 15 00 28 00 00    	mov    0x2800,%edx
+      if((p = morecore(nunits)) == 0)
+ e69:	83 c4 10             	add    $0x10,%esp
+ e6c:	85 d2                	test   %edx,%edx
+ e6e:	75 c0                	jne    e30 <malloc+0x40>
+        return 0;
+  }
+}
+ e70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ e73:	31 c0                	xor    %eax,%eax
+}
+ e75:	5b                   	pop    %ebx
+ e76:	5e                   	pop    %esi
+ e77:	5f                   	pop    %edi
+ e78:	5d                   	pop    %ebp
+ e79:	c3                   	ret
+ e7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ e80:	39 cf                	cmp    %ecx,%edi
+ e82:	74 4c                	je     ed0 <malloc+0xe0>
+        p->s.size -= nunits;
+ e84:	29 f9                	sub    %edi,%ecx
+ e86:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ e89:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ e8c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ e8f:	89 15 00 28 00 00    	mov    %edx,0x2800
+}
+ e95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ e98:	83 c0 08             	add    $0x8,%eax
+}
+ e9b:	5b                   	pop    %ebx
+ e9c:	5e                   	pop    %esi
+ e9d:	5f                   	pop    %edi
+ e9e:	5d                   	pop    %ebp
+ e9f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ ea0:	c7 05 00 28 00 00 04 	movl   $0x2804,0x2800
+ ea7:	28 00 00 
+    base.s.size = 0;
+ eaa:	b8 04 28 00 00       	mov    $0x2804,%eax
+    base.s.ptr = freep = prevp = &base;
+ eaf:	c7 05 04 28 00 00 04 	movl   $0x2804,0x2804
+ eb6:	28 00 00 
+    base.s.size = 0;
+ eb9:	c7 05 08 28 00 00 00 	movl   $0x0,0x2808
+ ec0:	00 00 00 
+    if(p->s.size >= nunits){
+ ec3:	e9 54 ff ff ff       	jmp    e1c <malloc+0x2c>
+ ec8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ecf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ed0:	8b 08                	mov    (%eax),%ecx
+ ed2:	89 0a                	mov    %ecx,(%edx)
+ ed4:	eb b9                	jmp    e8f <malloc+0x9f>
+ ed6:	66 90                	xchg   %ax,%ax
+ ed8:	66 90                	xchg   %ax,%ax
+ eda:	66 90                	xchg   %ax,%ax
+ edc:	66 90                	xchg   %ax,%ax
+ ede:	66 90                	xchg   %ax,%ax
+
+00000ee0 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+ ee0:	55                   	push   %ebp
+ ee1:	89 e5                	mov    %esp,%ebp
+ ee3:	57                   	push   %edi
+ ee4:	56                   	push   %esi
+ ee5:	be 01 00 00 00       	mov    $0x1,%esi
+ eea:	53                   	push   %ebx
+ eeb:	83 ec 28             	sub    $0x28,%esp
+ eee:	8b 45 0c             	mov    0xc(%ebp),%eax
+ ef1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ ef4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+ ef7:	68 00 98 00 00       	push   $0x9800
+ efc:	e8 ef fe ff ff       	call   df0 <malloc>
+ f01:	83 c4 10             	add    $0x10,%esp
+ f04:	89 c7                	mov    %eax,%edi
+ f06:	85 c0                	test   %eax,%eax
+ f08:	74 62                	je     f6c <waitpoll+0x8c>
+ f0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+ f10:	83 ec 0c             	sub    $0xc,%esp
+ f13:	6a 01                	push   $0x1
+ f15:	e8 03 fa ff ff       	call   91d <sleep>
+    fn();
+ f1a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ f1d:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+ f1f:	58                   	pop    %eax
+ f20:	5a                   	pop    %edx
+ f21:	68 00 02 00 00       	push   $0x200
+ f26:	57                   	push   %edi
+ f27:	e8 eb fa ff ff       	call   a17 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+ f2c:	83 c4 10             	add    $0x10,%esp
+ f2f:	85 c0                	test   %eax,%eax
+ f31:	7e 2d                	jle    f60 <waitpoll+0x80>
+ f33:	6b c0 4c             	imul   $0x4c,%eax,%eax
+ f36:	89 fa                	mov    %edi,%edx
+    alive = 0;
+ f38:	31 c9                	xor    %ecx,%ecx
+ f3a:	01 f8                	add    %edi,%eax
+ f3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+ f40:	3b 1a                	cmp    (%edx),%ebx
+ f42:	75 07                	jne    f4b <waitpoll+0x6b>
+        alive = 1;
+ f44:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+ f48:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+ f4b:	83 c2 4c             	add    $0x4c,%edx
+ f4e:	39 d0                	cmp    %edx,%eax
+ f50:	75 ee                	jne    f40 <waitpoll+0x60>
+  } while(alive);
+ f52:	85 c9                	test   %ecx,%ecx
+ f54:	75 ba                	jne    f10 <waitpoll+0x30>
+ f56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f5d:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+ f60:	83 ec 0c             	sub    $0xc,%esp
+ f63:	57                   	push   %edi
+ f64:	e8 f7 fd ff ff       	call   d60 <free>
+  wait();
+ f69:	83 c4 10             	add    $0x10,%esp
+}
+ f6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ f6f:	5b                   	pop    %ebx
+ f70:	5e                   	pop    %esi
+ f71:	5f                   	pop    %edi
+ f72:	5d                   	pop    %ebp
+  wait();
+ f73:	e9 10 f9 ff ff       	jmp    888 <wait>
+ f78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f7f:	90                   	nop
+
+00000f80 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+ f80:	55                   	push   %ebp
+ f81:	89 e5                	mov    %esp,%ebp
+ f83:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+ f86:	c7 45 f0 f9 12 00 00 	movl   $0x12f9,-0x10(%ebp)
+ f8d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+ f94:	e8 87 f4 ff ff       	call   420 <fork>
+ f99:	85 c0                	test   %eax,%eax
+ f9b:	78 09                	js     fa6 <runps+0x26>
+    return -1;
+  if(pid == 0){
+ f9d:	74 0e                	je     fad <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+ f9f:	e8 e4 f8 ff ff       	call   888 <wait>
+}
+ fa4:	c9                   	leave
+ fa5:	c3                   	ret
+ fa6:	c9                   	leave
+    return -1;
+ fa7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ fac:	c3                   	ret
+    exec("ps", argv);
+ fad:	50                   	push   %eax
+ fae:	50                   	push   %eax
+ faf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ fb2:	50                   	push   %eax
+ fb3:	68 f9 12 00 00       	push   $0x12f9
+ fb8:	e8 c3 f4 ff ff       	call   480 <exec>
+    printf(2, "exec ps failed\n");
+ fbd:	5a                   	pop    %edx
+ fbe:	59                   	pop    %ecx
+ fbf:	68 fc 12 00 00       	push   $0x12fc
+ fc4:	6a 02                	push   $0x2
+ fc6:	e8 55 fb ff ff       	call   b20 <printf>
+    exit();
+ fcb:	e8 a0 f4 ff ff       	call   470 <exit>
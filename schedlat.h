@@ -0,0 +1,7 @@
+// One CPU's run queue latency, returned by the schedlat system
+// call: hist[i] counts processes it dispatched after they had
+// been RUNNABLE for 2^i to 2^(i+1)-1 TSC cycles.
+struct schedlat {
+  uint dispatches;
+  uint hist[NLATBUCKET];
+};
@@ -0,0 +1,3245 @@
+
+_schedtest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+}
+
+// Add this prototype after your child_workload() function and before main()
+int numDigits(uint64 n);  // Function prototype
+
+int main(int argc, char *argv[]) {
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+    // Define our scheduler types
+    scheduler_result results[5]; // Array for 5 scheduler types
+    int num_schedulers = 5;
+    
+    // Initialize scheduler info
+    strcpy(results[0].name, "FCFS");
+       f:	8d b5 94 fe ff ff    	lea    -0x16c(%ebp),%esi
+int main(int argc, char *argv[]) {
+      15:	53                   	push   %ebx
+      16:	51                   	push   %ecx
+      17:	81 ec 80 01 00 00    	sub    $0x180,%esp
+    strcpy(results[0].name, "FCFS");
+      1d:	68 34 1e 00 00       	push   $0x1e34
+      22:	56                   	push   %esi
+      23:	e8 88 0e 00 00       	call   eb0 <strcpy>
+    results[0].policy = SCHED_FCFS;
+      28:	c7 85 a8 fe ff ff 00 	movl   $0x0,-0x158(%ebp)
+      2f:	00 00 00 
+    
+    strcpy(results[1].name, "SJF");
+      32:	5f                   	pop    %edi
+      33:	58                   	pop    %eax
+      34:	8d 85 d8 fe ff ff    	lea    -0x128(%ebp),%eax
+      3a:	68 39 1e 00 00       	push   $0x1e39
+      3f:	50                   	push   %eax
+      40:	e8 6b 0e 00 00       	call   eb0 <strcpy>
+    results[1].policy = SCHED_SJF;
+      45:	c7 85 ec fe ff ff 01 	movl   $0x1,-0x114(%ebp)
+      4c:	00 00 00 
+    
+    strcpy(results[2].name, "BJF");
+      4f:	58                   	pop    %eax
+      50:	8d 85 1c ff ff ff    	lea    -0xe4(%ebp),%eax
+      56:	5a                   	pop    %edx
+      57:	68 3d 1e 00 00       	push   $0x1e3d
+      5c:	50                   	push   %eax
+      5d:	e8 4e 0e 00 00       	call   eb0 <strcpy>
+    results[2].policy = SCHED_BJF;
+    
+    strcpy(results[3].name, "Random");
+      62:	8d 85 60 ff ff ff    	lea    -0xa0(%ebp),%eax
+    results[2].policy = SCHED_BJF;
+      68:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%ebp)
+      6f:	00 00 00 
+    strcpy(results[3].name, "Random");
+      72:	59                   	pop    %ecx
+      73:	5b                   	pop    %ebx
+      74:	68 41 1e 00 00       	push   $0x1e41
+    results[3].policy = SCHED_RANDOM;
+    
+    strcpy(results[4].name, "Round Robin");
+    results[4].policy = SCHED_RR;
+
+    printf(1, "=== Starting Scheduler Comparison Test ===\n");
+      79:	89 f3                	mov    %esi,%ebx
+    strcpy(results[3].name, "Random");
+      7b:	50                   	push   %eax
+      7c:	e8 2f 0e 00 00       	call   eb0 <strcpy>
+    results[3].policy = SCHED_RANDOM;
+      81:	c7 85 74 ff ff ff 03 	movl   $0x3,-0x8c(%ebp)
+      88:	00 00 00 
+    strcpy(results[4].name, "Round Robin");
+      8b:	5f                   	pop    %edi
+      8c:	89 f7                	mov    %esi,%edi
+      8e:	58                   	pop    %eax
+      8f:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+      92:	68 48 1e 00 00       	push   $0x1e48
+      97:	50                   	push   %eax
+      98:	e8 13 0e 00 00       	call   eb0 <strcpy>
+    results[4].policy = SCHED_RR;
+      9d:	c7 45 b8 04 00 00 00 	movl   $0x4,-0x48(%ebp)
+    printf(1, "=== Starting Scheduler Comparison Test ===\n");
+      a4:	58                   	pop    %eax
+      a5:	5a                   	pop    %edx
+      a6:	68 98 1b 00 00       	push   $0x1b98
+      ab:	6a 01                	push   $0x1
+      ad:	e8 ce 13 00 00       	call   1480 <printf>
+    
+    // Run test for each scheduler type
+    for (int s = 0; s < num_schedulers; s++) {
+      b2:	83 c4 10             	add    $0x10,%esp
+      b5:	eb 2a                	jmp    e1 <main+0xe1>
+      b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      be:	66 90                	xchg   %ax,%ax
+            printf(2, "Failed to set scheduler policy to %s\n", results[s].name);
+            continue;
+        }
+        
+        // Run the test with this scheduler
+        if (run_scheduler_test(results[s].policy, &results[s]) < 0) {
+      c0:	83 ec 08             	sub    $0x8,%esp
+      c3:	53                   	push   %ebx
+      c4:	ff 73 14             	push   0x14(%ebx)
+      c7:	e8 14 07 00 00       	call   7e0 <run_scheduler_test>
+      cc:	83 c4 10             	add    $0x10,%esp
+      cf:	85 c0                	test   %eax,%eax
+      d1:	0f 88 eb 02 00 00    	js     3c2 <main+0x3c2>
+    for (int s = 0; s < num_schedulers; s++) {
+      d7:	83 c3 44             	add    $0x44,%ebx
+      da:	8d 45 e8             	lea    -0x18(%ebp),%eax
+      dd:	39 d8                	cmp    %ebx,%eax
+      df:	74 3d                	je     11e <main+0x11e>
+        printf(1, "\n\n=== Testing %s Scheduler ===\n", results[s].name);
+      e1:	83 ec 04             	sub    $0x4,%esp
+      e4:	53                   	push   %ebx
+      e5:	68 c4 1b 00 00       	push   $0x1bc4
+      ea:	6a 01                	push   $0x1
+      ec:	e8 8f 13 00 00       	call   1480 <printf>
+        if (setschedpolicy(results[s].policy) < 0) {
+      f1:	5e                   	pop    %esi
+      f2:	ff 73 14             	push   0x14(%ebx)
+      f5:	e8 dd 11 00 00       	call   12d7 <setschedpolicy>
+      fa:	83 c4 10             	add    $0x10,%esp
+      fd:	85 c0                	test   %eax,%eax
+      ff:	79 bf                	jns    c0 <main+0xc0>
+            printf(2, "Failed to set scheduler policy to %s\n", results[s].name);
+     101:	83 ec 04             	sub    $0x4,%esp
+     104:	53                   	push   %ebx
+    for (int s = 0; s < num_schedulers; s++) {
+     105:	83 c3 44             	add    $0x44,%ebx
+            printf(2, "Failed to set scheduler policy to %s\n", results[s].name);
+     108:	68 e4 1b 00 00       	push   $0x1be4
+     10d:	6a 02                	push   $0x2
+     10f:	e8 6c 13 00 00       	call   1480 <printf>
+    for (int s = 0; s < num_schedulers; s++) {
+     114:	8d 45 e8             	lea    -0x18(%ebp),%eax
+            continue;
+     117:	83 c4 10             	add    $0x10,%esp
+    for (int s = 0; s < num_schedulers; s++) {
+     11a:	39 d8                	cmp    %ebx,%eax
+     11c:	75 c3                	jne    e1 <main+0xe1>
+            printf(2, "Test failed for %s scheduler\n", results[s].name);
+        }
+    }
+    
+    // Print comprehensive comparison table
+    printf(1, "\n\n=== SCHEDULER COMPARISON RESULTS ===\n");
+     11e:	83 ec 08             	sub    $0x8,%esp
+     121:	68 0c 1c 00 00       	push   $0x1c0c
+     126:	6a 01                	push   $0x1
+     128:	e8 53 13 00 00       	call   1480 <printf>
+    printf(1, "+----------------+----------------+----------------+----------------+\n");
+     12d:	5b                   	pop    %ebx
+     12e:	5e                   	pop    %esi
+     12f:	68 34 1c 00 00       	push   $0x1c34
+     134:	6a 01                	push   $0x1
+div64(uint64 n, uint d)
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+     136:	89 fe                	mov    %edi,%esi
+     138:	e8 43 13 00 00       	call   1480 <printf>
+    printf(1, "| Scheduler      | Avg Wait (us)  | Avg Run (us)   | Avg Turn (us)  |\n");
+     13d:	58                   	pop    %eax
+     13e:	5a                   	pop    %edx
+     13f:	68 7c 1c 00 00       	push   $0x1c7c
+     144:	6a 01                	push   $0x1
+     146:	e8 35 13 00 00       	call   1480 <printf>
+    printf(1, "+----------------+----------------+----------------+----------------+\n");
+     14b:	59                   	pop    %ecx
+     14c:	5b                   	pop    %ebx
+     14d:	68 34 1c 00 00       	push   $0x1c34
+     152:	6a 01                	push   $0x1
+     154:	e8 27 13 00 00       	call   1480 <printf>
+     159:	83 c4 10             	add    $0x10,%esp
+     15c:	eb 23                	jmp    181 <main+0x181>
+     15e:	66 90                	xchg   %ax,%ax
+            for (int sp = 0; sp < 14 - numDigits(results[s].avg_turnaround); sp++) {
+                printf(1, " ");
+            }
+            printf(1, " |\n");
+        } else {
+            printf(1, "| %s              | N/A            | N/A            | N/A            |\n", 
+     160:	83 ec 04             	sub    $0x4,%esp
+     163:	56                   	push   %esi
+    for (int s = 0; s < num_schedulers; s++) {
+     164:	83 c6 44             	add    $0x44,%esi
+            printf(1, "| %s              | N/A            | N/A            | N/A            |\n", 
+     167:	68 c4 1c 00 00       	push   $0x1cc4
+     16c:	6a 01                	push   $0x1
+     16e:	e8 0d 13 00 00       	call   1480 <printf>
+    for (int s = 0; s < num_schedulers; s++) {
+     173:	8d 45 e8             	lea    -0x18(%ebp),%eax
+            printf(1, "| %s              | N/A            | N/A            | N/A            |\n", 
+     176:	83 c4 10             	add    $0x10,%esp
+    for (int s = 0; s < num_schedulers; s++) {
+     179:	39 f0                	cmp    %esi,%eax
+     17b:	0f 84 1f 02 00 00    	je     3a0 <main+0x3a0>
+        if (results[s].completed > 0) {
+     181:	8b 4e 18             	mov    0x18(%esi),%ecx
+     184:	85 c9                	test   %ecx,%ecx
+     186:	7e d8                	jle    160 <main+0x160>
+            printf(1, "| %s", results[s].name);
+     188:	83 ec 04             	sub    $0x4,%esp
+            for (int sp = 0; sp < 14 - strlen(results[s].name); sp++) {
+     18b:	31 db                	xor    %ebx,%ebx
+            printf(1, "| %s", results[s].name);
+     18d:	56                   	push   %esi
+     18e:	68 72 1e 00 00       	push   $0x1e72
+     193:	6a 01                	push   $0x1
+     195:	e8 e6 12 00 00       	call   1480 <printf>
+            for (int sp = 0; sp < 14 - strlen(results[s].name); sp++) {
+     19a:	83 c4 10             	add    $0x10,%esp
+     19d:	eb 16                	jmp    1b5 <main+0x1b5>
+     19f:	90                   	nop
+                printf(1, " ");
+     1a0:	83 ec 08             	sub    $0x8,%esp
+            for (int sp = 0; sp < 14 - strlen(results[s].name); sp++) {
+     1a3:	83 c3 01             	add    $0x1,%ebx
+                printf(1, " ");
+     1a6:	68 77 1e 00 00       	push   $0x1e77
+     1ab:	6a 01                	push   $0x1
+     1ad:	e8 ce 12 00 00       	call   1480 <printf>
+            for (int sp = 0; sp < 14 - strlen(results[s].name); sp++) {
+     1b2:	83 c4 10             	add    $0x10,%esp
+     1b5:	83 ec 0c             	sub    $0xc,%esp
+     1b8:	56                   	push   %esi
+     1b9:	e8 82 0d 00 00       	call   f40 <strlen>
+     1be:	83 c4 10             	add    $0x10,%esp
+     1c1:	89 c2                	mov    %eax,%edx
+     1c3:	b8 0e 00 00 00       	mov    $0xe,%eax
+     1c8:	29 d0                	sub    %edx,%eax
+     1ca:	39 c3                	cmp    %eax,%ebx
+     1cc:	72 d2                	jb     1a0 <main+0x1a0>
+            printf(1, " | %l", results[s].avg_wtime);
+     1ce:	ff 76 30             	push   0x30(%esi)
+     1d1:	ff 76 2c             	push   0x2c(%esi)
+     1d4:	68 79 1e 00 00       	push   $0x1e79
+     1d9:	6a 01                	push   $0x1
+     1db:	e8 a0 12 00 00       	call   1480 <printf>
+            for (int sp = 0; sp < 14 - numDigits(results[s].avg_wtime); sp++) {
+     1e0:	83 c4 10             	add    $0x10,%esp
+     1e3:	c7 85 80 fe ff ff 00 	movl   $0x0,-0x180(%ebp)
+     1ea:	00 00 00 
+     1ed:	8d 76 00             	lea    0x0(%esi),%esi
+     1f0:	8b 5e 2c             	mov    0x2c(%esi),%ebx
+     1f3:	8b 4e 30             	mov    0x30(%esi),%ecx
+    exit();
+}
+
+// Add this helper function before main()
+int numDigits(uint64 n) {
+    int count = 0;
+     1f6:	89 b5 84 fe ff ff    	mov    %esi,-0x17c(%ebp)
+     1fc:	31 ff                	xor    %edi,%edi
+     1fe:	66 90                	xchg   %ax,%ax
+     200:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+    do {
+        count++;
+     205:	83 c7 01             	add    $0x1,%edi
+     208:	f7 e1                	mul    %ecx
+     20a:	c1 ea 03             	shr    $0x3,%edx
+     20d:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     210:	89 d6                	mov    %edx,%esi
+     212:	01 c0                	add    %eax,%eax
+     214:	29 c1                	sub    %eax,%ecx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     216:	89 d8                	mov    %ebx,%eax
+     218:	bb 0a 00 00 00       	mov    $0xa,%ebx
+  r = (uint)(n >> 32) % d;
+     21d:	89 ca                	mov    %ecx,%edx
+  return ((uint64)hi << 32) | lo;
+     21f:	89 f1                	mov    %esi,%ecx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     221:	f7 f3                	div    %ebx
+     223:	89 c3                	mov    %eax,%ebx
+        n = div64(n, 10);
+    } while (n > 0);
+     225:	89 f0                	mov    %esi,%eax
+     227:	09 d8                	or     %ebx,%eax
+     229:	75 d5                	jne    200 <main+0x200>
+            for (int sp = 0; sp < 14 - numDigits(results[s].avg_wtime); sp++) {
+     22b:	b8 0e 00 00 00       	mov    $0xe,%eax
+     230:	8b b5 84 fe ff ff    	mov    -0x17c(%ebp),%esi
+     236:	29 f8                	sub    %edi,%eax
+     238:	8b bd 80 fe ff ff    	mov    -0x180(%ebp),%edi
+     23e:	39 f8                	cmp    %edi,%eax
+     240:	7e 1e                	jle    260 <main+0x260>
+                printf(1, " ");
+     242:	83 ec 08             	sub    $0x8,%esp
+     245:	68 77 1e 00 00       	push   $0x1e77
+     24a:	6a 01                	push   $0x1
+     24c:	e8 2f 12 00 00       	call   1480 <printf>
+            for (int sp = 0; sp < 14 - numDigits(results[s].avg_wtime); sp++) {
+     251:	83 85 80 fe ff ff 01 	addl   $0x1,-0x180(%ebp)
+     258:	83 c4 10             	add    $0x10,%esp
+     25b:	eb 93                	jmp    1f0 <main+0x1f0>
+     25d:	8d 76 00             	lea    0x0(%esi),%esi
+            printf(1, " | %l", results[s].avg_rtime);
+     260:	ff 76 38             	push   0x38(%esi)
+     263:	ff 76 34             	push   0x34(%esi)
+     266:	68 79 1e 00 00       	push   $0x1e79
+     26b:	6a 01                	push   $0x1
+     26d:	e8 0e 12 00 00       	call   1480 <printf>
+            for (int sp = 0; sp < 14 - numDigits(results[s].avg_rtime); sp++) {
+     272:	83 c4 10             	add    $0x10,%esp
+     275:	c7 85 80 fe ff ff 00 	movl   $0x0,-0x180(%ebp)
+     27c:	00 00 00 
+     27f:	90                   	nop
+     280:	8b 5e 34             	mov    0x34(%esi),%ebx
+     283:	8b 4e 38             	mov    0x38(%esi),%ecx
+    int count = 0;
+     286:	89 b5 84 fe ff ff    	mov    %esi,-0x17c(%ebp)
+     28c:	31 ff                	xor    %edi,%edi
+     28e:	66 90                	xchg   %ax,%ax
+  r = (uint)(n >> 32) % d;
+     290:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+        count++;
+     295:	83 c7 01             	add    $0x1,%edi
+     298:	f7 e1                	mul    %ecx
+     29a:	c1 ea 03             	shr    $0x3,%edx
+     29d:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     2a0:	89 d6                	mov    %edx,%esi
+     2a2:	89 ca                	mov    %ecx,%edx
+     2a4:	01 c0                	add    %eax,%eax
+  return ((uint64)hi << 32) | lo;
+     2a6:	89 f1                	mov    %esi,%ecx
+  r = (uint)(n >> 32) % d;
+     2a8:	29 c2                	sub    %eax,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     2aa:	89 d8                	mov    %ebx,%eax
+     2ac:	bb 0a 00 00 00       	mov    $0xa,%ebx
+     2b1:	f7 f3                	div    %ebx
+     2b3:	89 c3                	mov    %eax,%ebx
+    } while (n > 0);
+     2b5:	89 f0                	mov    %esi,%eax
+     2b7:	09 d8                	or     %ebx,%eax
+     2b9:	75 d5                	jne    290 <main+0x290>
+            for (int sp = 0; sp < 14 - numDigits(results[s].avg_rtime); sp++) {
+     2bb:	b8 0e 00 00 00       	mov    $0xe,%eax
+     2c0:	8b b5 84 fe ff ff    	mov    -0x17c(%ebp),%esi
+     2c6:	29 f8                	sub    %edi,%eax
+     2c8:	8b bd 80 fe ff ff    	mov    -0x180(%ebp),%edi
+     2ce:	39 f8                	cmp    %edi,%eax
+     2d0:	7e 1e                	jle    2f0 <main+0x2f0>
+                printf(1, " ");
+     2d2:	83 ec 08             	sub    $0x8,%esp
+     2d5:	68 77 1e 00 00       	push   $0x1e77
+     2da:	6a 01                	push   $0x1
+     2dc:	e8 9f 11 00 00       	call   1480 <printf>
+            for (int sp = 0; sp < 14 - numDigits(results[s].avg_rtime); sp++) {
+     2e1:	83 85 80 fe ff ff 01 	addl   $0x1,-0x180(%ebp)
+     2e8:	83 c4 10             	add    $0x10,%esp
+     2eb:	eb 93                	jmp    280 <main+0x280>
+     2ed:	8d 76 00             	lea    0x0(%esi),%esi
+            printf(1, " | %l", results[s].avg_turnaround);
+     2f0:	ff 76 40             	push   0x40(%esi)
+     2f3:	ff 76 3c             	push   0x3c(%esi)
+     2f6:	68 79 1e 00 00       	push   $0x1e79
+     2fb:	6a 01                	push   $0x1
+     2fd:	e8 7e 11 00 00       	call   1480 <printf>
+            for (int sp = 0; sp < 14 - numDigits(results[s].avg_turnaround); sp++) {
+     302:	83 c4 10             	add    $0x10,%esp
+     305:	c7 85 80 fe ff ff 00 	movl   $0x0,-0x180(%ebp)
+     30c:	00 00 00 
+     30f:	90                   	nop
+     310:	8b 5e 3c             	mov    0x3c(%esi),%ebx
+     313:	8b 4e 40             	mov    0x40(%esi),%ecx
+    int count = 0;
+     316:	89 b5 84 fe ff ff    	mov    %esi,-0x17c(%ebp)
+     31c:	31 ff                	xor    %edi,%edi
+     31e:	66 90                	xchg   %ax,%ax
+  r = (uint)(n >> 32) % d;
+     320:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+        count++;
+     325:	83 c7 01             	add    $0x1,%edi
+     328:	f7 e1                	mul    %ecx
+     32a:	c1 ea 03             	shr    $0x3,%edx
+     32d:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     330:	89 d6                	mov    %edx,%esi
+     332:	01 c0                	add    %eax,%eax
+     334:	29 c1                	sub    %eax,%ecx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     336:	89 d8                	mov    %ebx,%eax
+     338:	bb 0a 00 00 00       	mov    $0xa,%ebx
+  r = (uint)(n >> 32) % d;
+     33d:	89 ca                	mov    %ecx,%edx
+  return ((uint64)hi << 32) | lo;
+     33f:	89 f1                	mov    %esi,%ecx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     341:	f7 f3                	div    %ebx
+     343:	89 c3                	mov    %eax,%ebx
+    } while (n > 0);
+     345:	89 f0                	mov    %esi,%eax
+     347:	09 d8                	or     %ebx,%eax
+     349:	75 d5                	jne    320 <main+0x320>
+            for (int sp = 0; sp < 14 - numDigits(results[s].avg_turnaround); sp++) {
+     34b:	b8 0e 00 00 00       	mov    $0xe,%eax
+     350:	8b b5 84 fe ff ff    	mov    -0x17c(%ebp),%esi
+     356:	29 f8                	sub    %edi,%eax
+     358:	8b bd 80 fe ff ff    	mov    -0x180(%ebp),%edi
+     35e:	39 f8                	cmp    %edi,%eax
+     360:	7e 1e                	jle    380 <main+0x380>
+                printf(1, " ");
+     362:	83 ec 08             	sub    $0x8,%esp
+     365:	68 77 1e 00 00       	push   $0x1e77
+     36a:	6a 01                	push   $0x1
+     36c:	e8 0f 11 00 00       	call   1480 <printf>
+            for (int sp = 0; sp < 14 - numDigits(results[s].avg_turnaround); sp++) {
+     371:	83 85 80 fe ff ff 01 	addl   $0x1,-0x180(%ebp)
+     378:	83 c4 10             	add    $0x10,%esp
+     37b:	eb 93                	jmp    310 <main+0x310>
+     37d:	8d 76 00             	lea    0x0(%esi),%esi
+            printf(1, " |\n");
+     380:	83 ec 08             	sub    $0x8,%esp
+    for (int s = 0; s < num_schedulers; s++) {
+     383:	83 c6 44             	add    $0x44,%esi
+            printf(1, " |\n");
+     386:	68 7f 1e 00 00       	push   $0x1e7f
+     38b:	6a 01                	push   $0x1
+     38d:	e8 ee 10 00 00       	call   1480 <printf>
+    for (int s = 0; s < num_schedulers; s++) {
+     392:	8d 45 e8             	lea    -0x18(%ebp),%eax
+     395:	83 c4 10             	add    $0x10,%esp
+     398:	39 f0                	cmp    %esi,%eax
+     39a:	0f 85 e1 fd ff ff    	jne    181 <main+0x181>
+    printf(1, "+----------------+----------------+----------------+----------------+\n");
+     3a0:	83 ec 08             	sub    $0x8,%esp
+     3a3:	68 34 1c 00 00       	push   $0x1c34
+     3a8:	6a 01                	push   $0x1
+     3aa:	e8 d1 10 00 00       	call   1480 <printf>
+    printf(1, "Scheduler comparison completed. Exiting.\n");
+     3af:	58                   	pop    %eax
+     3b0:	5a                   	pop    %edx
+     3b1:	68 0c 1d 00 00       	push   $0x1d0c
+     3b6:	6a 01                	push   $0x1
+     3b8:	e8 c3 10 00 00       	call   1480 <printf>
+    exit();
+     3bd:	e8 0e 0a 00 00       	call   dd0 <exit>
+            printf(2, "Test failed for %s scheduler\n", results[s].name);
+     3c2:	83 ec 04             	sub    $0x4,%esp
+     3c5:	53                   	push   %ebx
+     3c6:	68 54 1e 00 00       	push   $0x1e54
+     3cb:	6a 02                	push   $0x2
+     3cd:	e8 ae 10 00 00       	call   1480 <printf>
+     3d2:	83 c4 10             	add    $0x10,%esp
+     3d5:	e9 fd fc ff ff       	jmp    d7 <main+0xd7>
+     3da:	66 90                	xchg   %ax,%ax
+     3dc:	66 90                	xchg   %ax,%ax
+     3de:	66 90                	xchg   %ax,%ax
+
+000003e0 <cpu_work>:
+int cpu_work(int num) {
+     3e0:	55                   	push   %ebp
+     3e1:	89 e5                	mov    %esp,%ebp
+     3e3:	57                   	push   %edi
+    int result = 0;
+     3e4:	31 ff                	xor    %edi,%edi
+int cpu_work(int num) {
+     3e6:	56                   	push   %esi
+     3e7:	53                   	push   %ebx
+     3e8:	83 ec 10             	sub    $0x10,%esp
+    for (i = 0; i < num; i++) {
+     3eb:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+int cpu_work(int num) {
+     3f2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    for (i = 0; i < num; i++) {
+     3f5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     3f8:	39 c1                	cmp    %eax,%ecx
+     3fa:	0f 8e 86 00 00 00    	jle    486 <cpu_work+0xa6>
+            result += (i * j) % 10;
+     400:	be 67 66 66 66       	mov    $0x66666667,%esi
+            result %= 10000; // Keep result bounded
+     405:	bb ad 8b db 68       	mov    $0x68db8bad,%ebx
+     40a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        for (j = 0; j < 100000; j++) {
+     410:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     417:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     41a:	3d 9f 86 01 00       	cmp    $0x1869f,%eax
+     41f:	7f 54                	jg     475 <cpu_work+0x95>
+     421:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+            result += (i * j) % 10;
+     428:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     42b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     42e:	0f af c8             	imul   %eax,%ecx
+     431:	89 c8                	mov    %ecx,%eax
+     433:	f7 ee                	imul   %esi
+     435:	89 c8                	mov    %ecx,%eax
+     437:	c1 f8 1f             	sar    $0x1f,%eax
+     43a:	c1 fa 02             	sar    $0x2,%edx
+     43d:	29 c2                	sub    %eax,%edx
+     43f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     442:	01 c0                	add    %eax,%eax
+     444:	29 c1                	sub    %eax,%ecx
+     446:	01 f9                	add    %edi,%ecx
+            result %= 10000; // Keep result bounded
+     448:	89 c8                	mov    %ecx,%eax
+     44a:	f7 eb                	imul   %ebx
+     44c:	89 c8                	mov    %ecx,%eax
+     44e:	c1 f8 1f             	sar    $0x1f,%eax
+     451:	89 d7                	mov    %edx,%edi
+     453:	c1 ff 0c             	sar    $0xc,%edi
+     456:	29 c7                	sub    %eax,%edi
+     458:	69 c7 10 27 00 00    	imul   $0x2710,%edi,%eax
+     45e:	89 cf                	mov    %ecx,%edi
+     460:	29 c7                	sub    %eax,%edi
+        for (j = 0; j < 100000; j++) {
+     462:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     465:	83 c0 01             	add    $0x1,%eax
+     468:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     46b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     46e:	3d 9f 86 01 00       	cmp    $0x1869f,%eax
+     473:	7e b3                	jle    428 <cpu_work+0x48>
+    for (i = 0; i < num; i++) {
+     475:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     478:	83 c0 01             	add    $0x1,%eax
+     47b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     47e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     481:	3b 45 08             	cmp    0x8(%ebp),%eax
+     484:	7c 8a                	jl     410 <cpu_work+0x30>
+}
+     486:	83 c4 10             	add    $0x10,%esp
+     489:	89 f8                	mov    %edi,%eax
+     48b:	5b                   	pop    %ebx
+     48c:	5e                   	pop    %esi
+     48d:	5f                   	pop    %edi
+     48e:	5d                   	pop    %ebp
+     48f:	c3                   	ret
+
+00000490 <schedtest_copy_file>:
+int schedtest_copy_file(char *src, char *dest) { // Renamed function
+     490:	55                   	push   %ebp
+     491:	89 e5                	mov    %esp,%ebp
+     493:	57                   	push   %edi
+     494:	56                   	push   %esi
+     495:	53                   	push   %ebx
+     496:	81 ec 24 02 00 00    	sub    $0x224,%esp
+    if ((fds = open(src, O_RDONLY)) < 0) {
+     49c:	6a 00                	push   $0x0
+     49e:	ff 75 08             	push   0x8(%ebp)
+     4a1:	e8 73 0d 00 00       	call   1219 <open>
+     4a6:	83 c4 10             	add    $0x10,%esp
+     4a9:	85 c0                	test   %eax,%eax
+     4ab:	0f 88 cc 00 00 00    	js     57d <schedtest_copy_file+0xed>
+    if ((fdd = open(dest, O_CREATE | O_WRONLY)) < 0) {
+     4b1:	83 ec 08             	sub    $0x8,%esp
+     4b4:	89 c6                	mov    %eax,%esi
+     4b6:	68 01 02 00 00       	push   $0x201
+     4bb:	ff 75 0c             	push   0xc(%ebp)
+     4be:	e8 56 0d 00 00       	call   1219 <open>
+     4c3:	83 c4 10             	add    $0x10,%esp
+     4c6:	89 85 e4 fd ff ff    	mov    %eax,-0x21c(%ebp)
+     4cc:	85 c0                	test   %eax,%eax
+     4ce:	0f 88 c0 00 00 00    	js     594 <schedtest_copy_file+0x104>
+     4d4:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+     4da:	eb 1b                	jmp    4f7 <schedtest_copy_file+0x67>
+     4dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        if (write(fdd, buf, n) != n) {
+     4e0:	83 ec 04             	sub    $0x4,%esp
+     4e3:	57                   	push   %edi
+     4e4:	53                   	push   %ebx
+     4e5:	ff b5 e4 fd ff ff    	push   -0x21c(%ebp)
+     4eb:	e8 0d 0d 00 00       	call   11fd <write>
+     4f0:	83 c4 10             	add    $0x10,%esp
+     4f3:	39 f8                	cmp    %edi,%eax
+     4f5:	75 41                	jne    538 <schedtest_copy_file+0xa8>
+    while ((n = read(fds, buf, sizeof(buf))) > 0) {
+     4f7:	83 ec 04             	sub    $0x4,%esp
+     4fa:	68 00 02 00 00       	push   $0x200
+     4ff:	53                   	push   %ebx
+     500:	56                   	push   %esi
+     501:	e8 f0 0c 00 00       	call   11f6 <read>
+     506:	83 c4 10             	add    $0x10,%esp
+     509:	89 c7                	mov    %eax,%edi
+     50b:	85 c0                	test   %eax,%eax
+     50d:	7f d1                	jg     4e0 <schedtest_copy_file+0x50>
+    if (n < 0) {
+     50f:	75 5f                	jne    570 <schedtest_copy_file+0xe0>
+    close(fds);
+     511:	83 ec 0c             	sub    $0xc,%esp
+     514:	56                   	push   %esi
+     515:	e8 26 09 00 00       	call   e40 <close>
+    close(fdd);
+     51a:	5a                   	pop    %edx
+     51b:	ff b5 e4 fd ff ff    	push   -0x21c(%ebp)
+     521:	e8 1a 09 00 00       	call   e40 <close>
+     526:	83 c4 10             	add    $0x10,%esp
+}
+     529:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     52c:	89 f8                	mov    %edi,%eax
+     52e:	5b                   	pop    %ebx
+     52f:	5e                   	pop    %esi
+     530:	5f                   	pop    %edi
+     531:	5d                   	pop    %ebp
+     532:	c3                   	ret
+     533:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     537:	90                   	nop
+            printf(2, "schedtest: write error to %s\n", dest);
+     538:	83 ec 04             	sub    $0x4,%esp
+     53b:	ff 75 0c             	push   0xc(%ebp)
+     53e:	68 36 1d 00 00       	push   $0x1d36
+        printf(2, "schedtest: read error from %s\n", src);
+     543:	6a 02                	push   $0x2
+     545:	e8 36 0f 00 00       	call   1480 <printf>
+    close(fds);
+     54a:	89 34 24             	mov    %esi,(%esp)
+     54d:	e8 ee 08 00 00       	call   e40 <close>
+    close(fdd);
+     552:	58                   	pop    %eax
+     553:	ff b5 e4 fd ff ff    	push   -0x21c(%ebp)
+     559:	e8 e2 08 00 00       	call   e40 <close>
+     55e:	83 c4 10             	add    $0x10,%esp
+        return -1;
+     561:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+     566:	eb c1                	jmp    529 <schedtest_copy_file+0x99>
+     568:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     56f:	90                   	nop
+        printf(2, "schedtest: read error from %s\n", src);
+     570:	83 ec 04             	sub    $0x4,%esp
+     573:	ff 75 08             	push   0x8(%ebp)
+     576:	68 74 19 00 00       	push   $0x1974
+     57b:	eb c6                	jmp    543 <schedtest_copy_file+0xb3>
+        printf(2, "schedtest: cannot open source %s\n", src);
+     57d:	83 ec 04             	sub    $0x4,%esp
+     580:	ff 75 08             	push   0x8(%ebp)
+     583:	68 30 19 00 00       	push   $0x1930
+     588:	6a 02                	push   $0x2
+     58a:	e8 f1 0e 00 00       	call   1480 <printf>
+        return -1;
+     58f:	83 c4 10             	add    $0x10,%esp
+     592:	eb cd                	jmp    561 <schedtest_copy_file+0xd1>
+        printf(2, "schedtest: cannot open dest %s\n", dest);
+     594:	83 ec 04             	sub    $0x4,%esp
+     597:	ff 75 0c             	push   0xc(%ebp)
+     59a:	68 54 19 00 00       	push   $0x1954
+     59f:	6a 02                	push   $0x2
+     5a1:	e8 da 0e 00 00       	call   1480 <printf>
+        close(fds);
+     5a6:	89 34 24             	mov    %esi,(%esp)
+     5a9:	e8 92 08 00 00       	call   e40 <close>
+        return -1;
+     5ae:	83 c4 10             	add    $0x10,%esp
+     5b1:	eb ae                	jmp    561 <schedtest_copy_file+0xd1>
+     5b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000005c0 <child_workload>:
+void child_workload() {
+     5c0:	55                   	push   %ebp
+     5c1:	89 e5                	mov    %esp,%ebp
+     5c3:	57                   	push   %edi
+     5c4:	56                   	push   %esi
+     5c5:	53                   	push   %ebx
+     5c6:	83 ec 4c             	sub    $0x4c,%esp
+    int my_pid = getpid();
+     5c9:	e8 9b 0c 00 00       	call   1269 <getpid>
+     5ce:	89 c3                	mov    %eax,%ebx
+    start_syscalls = getnumsyscalls(); // Uncommented
+     5d0:	e8 e4 0c 00 00       	call   12b9 <getnumsyscalls>
+    printf(1, "Child %d: Starting workload.\n", my_pid);
+     5d5:	83 ec 04             	sub    $0x4,%esp
+    start_syscalls = getnumsyscalls(); // Uncommented
+     5d8:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+    printf(1, "Child %d: Starting workload.\n", my_pid);
+     5db:	53                   	push   %ebx
+     5dc:	68 54 1d 00 00       	push   $0x1d54
+     5e1:	6a 01                	push   $0x1
+     5e3:	e8 98 0e 00 00       	call   1480 <printf>
+    printf(1, "Child %d: Performing CPU work...\n", my_pid);
+     5e8:	83 c4 0c             	add    $0xc,%esp
+     5eb:	53                   	push   %ebx
+     5ec:	68 94 19 00 00       	push   $0x1994
+     5f1:	6a 01                	push   $0x1
+     5f3:	e8 88 0e 00 00       	call   1480 <printf>
+    cpu_work(my_pid % 5 + 1); // Vary workload slightly based on PID
+     5f8:	b8 67 66 66 66       	mov    $0x66666667,%eax
+     5fd:	f7 eb                	imul   %ebx
+     5ff:	89 d8                	mov    %ebx,%eax
+     601:	c1 f8 1f             	sar    $0x1f,%eax
+     604:	d1 fa                	sar    %edx
+     606:	29 c2                	sub    %eax,%edx
+     608:	89 d8                	mov    %ebx,%eax
+     60a:	8d 14 92             	lea    (%edx,%edx,4),%edx
+     60d:	29 d0                	sub    %edx,%eax
+     60f:	83 c0 01             	add    $0x1,%eax
+     612:	89 04 24             	mov    %eax,(%esp)
+     615:	e8 c6 fd ff ff       	call   3e0 <cpu_work>
+    printf(1, "Child %d: Getting uncle count...\n", my_pid);
+     61a:	83 c4 0c             	add    $0xc,%esp
+     61d:	53                   	push   %ebx
+     61e:	68 b8 19 00 00       	push   $0x19b8
+     623:	6a 01                	push   $0x1
+     625:	e8 56 0e 00 00       	call   1480 <printf>
+    uncles = get_uncle_count(my_pid); // Use your syscall
+     62a:	89 1c 24             	mov    %ebx,(%esp)
+     62d:	e8 73 0c 00 00       	call   12a5 <get_uncle_count>
+    printf(1, "Child %d: Performing I/O work (file copy)...\n", my_pid);
+     632:	83 c4 0c             	add    $0xc,%esp
+    uncles = get_uncle_count(my_pid); // Use your syscall
+     635:	89 45 b0             	mov    %eax,-0x50(%ebp)
+    printf(1, "Child %d: Performing I/O work (file copy)...\n", my_pid);
+     638:	53                   	push   %ebx
+     639:	68 dc 19 00 00       	push   $0x19dc
+     63e:	6a 01                	push   $0x1
+     640:	e8 3b 0e 00 00       	call   1480 <printf>
+    if (temp_pid == 0) {
+     645:	83 c4 10             	add    $0x10,%esp
+     648:	85 db                	test   %ebx,%ebx
+     64a:	74 77                	je     6c3 <child_workload+0x103>
+        while (temp_pid > 0) {
+     64c:	0f 8e 29 01 00 00    	jle    77b <child_workload+0x1bb>
+     652:	8d 7d bc             	lea    -0x44(%ebp),%edi
+            pid_str[i++] = (temp_pid % 10) + '0';
+     655:	89 5d ac             	mov    %ebx,-0x54(%ebp)
+        while (temp_pid > 0) {
+     658:	89 de                	mov    %ebx,%esi
+    i = 0;
+     65a:	31 c9                	xor    %ecx,%ecx
+            pid_str[i++] = (temp_pid % 10) + '0';
+     65c:	89 7d a8             	mov    %edi,-0x58(%ebp)
+     65f:	90                   	nop
+     660:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+     665:	89 cb                	mov    %ecx,%ebx
+     667:	83 c1 01             	add    $0x1,%ecx
+     66a:	f7 e6                	mul    %esi
+     66c:	89 f0                	mov    %esi,%eax
+     66e:	c1 ea 03             	shr    $0x3,%edx
+     671:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+     674:	01 ff                	add    %edi,%edi
+     676:	29 f8                	sub    %edi,%eax
+     678:	83 c0 30             	add    $0x30,%eax
+     67b:	88 44 0d bb          	mov    %al,-0x45(%ebp,%ecx,1)
+            temp_pid /= 10;
+     67f:	89 f0                	mov    %esi,%eax
+     681:	89 d6                	mov    %edx,%esi
+        while (temp_pid > 0) {
+     683:	83 f8 09             	cmp    $0x9,%eax
+     686:	7f d8                	jg     660 <child_workload+0xa0>
+    pid_str[i] = '\0'; // Null terminate the reversed string
+     688:	c6 44 0d bc 00       	movb   $0x0,-0x44(%ebp,%ecx,1)
+    for (j = 0; j < i / 2; j++) {
+     68d:	d1 f9                	sar    %ecx
+     68f:	89 de                	mov    %ebx,%esi
+     691:	8b 7d a8             	mov    -0x58(%ebp),%edi
+     694:	8b 5d ac             	mov    -0x54(%ebp),%ebx
+     697:	74 38                	je     6d1 <child_workload+0x111>
+     699:	89 f2                	mov    %esi,%edx
+     69b:	01 f9                	add    %edi,%ecx
+     69d:	89 f8                	mov    %edi,%eax
+     69f:	01 fa                	add    %edi,%edx
+     6a1:	89 ce                	mov    %ecx,%esi
+     6a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6a7:	90                   	nop
+        pid_str[j] = pid_str[i - 1 - j];
+     6a8:	0f b6 1a             	movzbl (%edx),%ebx
+        char tmp = pid_str[j];
+     6ab:	0f b6 08             	movzbl (%eax),%ecx
+    for (j = 0; j < i / 2; j++) {
+     6ae:	83 c0 01             	add    $0x1,%eax
+     6b1:	83 ea 01             	sub    $0x1,%edx
+        pid_str[j] = pid_str[i - 1 - j];
+     6b4:	88 58 ff             	mov    %bl,-0x1(%eax)
+        pid_str[i - 1 - j] = tmp;
+     6b7:	88 4a 01             	mov    %cl,0x1(%edx)
+    for (j = 0; j < i / 2; j++) {
+     6ba:	39 c6                	cmp    %eax,%esi
+     6bc:	75 ea                	jne    6a8 <child_workload+0xe8>
+     6be:	8b 5d ac             	mov    -0x54(%ebp),%ebx
+     6c1:	eb 0e                	jmp    6d1 <child_workload+0x111>
+        pid_str[i++] = '0';
+     6c3:	0f b7 05 84 1e 00 00 	movzwl 0x1e84,%eax
+     6ca:	8d 7d bc             	lea    -0x44(%ebp),%edi
+     6cd:	66 89 45 bc          	mov    %ax,-0x44(%ebp)
+    strcpy(p, "dest_");
+     6d1:	83 ec 08             	sub    $0x8,%esp
+     6d4:	8d 75 c8             	lea    -0x38(%ebp),%esi
+     6d7:	68 72 1d 00 00       	push   $0x1d72
+     6dc:	56                   	push   %esi
+     6dd:	e8 ce 07 00 00       	call   eb0 <strcpy>
+    p += strlen("dest_");
+     6e2:	c7 04 24 72 1d 00 00 	movl   $0x1d72,(%esp)
+     6e9:	e8 52 08 00 00       	call   f40 <strlen>
+     6ee:	8d 14 06             	lea    (%esi,%eax,1),%edx
+    strcpy(p, pid_str);
+     6f1:	58                   	pop    %eax
+     6f2:	59                   	pop    %ecx
+     6f3:	57                   	push   %edi
+     6f4:	52                   	push   %edx
+     6f5:	89 55 ac             	mov    %edx,-0x54(%ebp)
+     6f8:	e8 b3 07 00 00       	call   eb0 <strcpy>
+    p += strlen(pid_str);
+     6fd:	89 3c 24             	mov    %edi,(%esp)
+     700:	e8 3b 08 00 00       	call   f40 <strlen>
+    strcpy(p, ".txt");
+     705:	5f                   	pop    %edi
+     706:	5a                   	pop    %edx
+     707:	68 85 1d 00 00       	push   $0x1d85
+    p += strlen(pid_str);
+     70c:	8b 55 ac             	mov    -0x54(%ebp),%edx
+     70f:	01 c2                	add    %eax,%edx
+    strcpy(p, ".txt");
+     711:	52                   	push   %edx
+     712:	e8 99 07 00 00       	call   eb0 <strcpy>
+    if (schedtest_copy_file("src_copy_file.txt", dest_filename) == 0) {
+     717:	59                   	pop    %ecx
+     718:	5f                   	pop    %edi
+     719:	56                   	push   %esi
+     71a:	68 78 1d 00 00       	push   $0x1d78
+     71f:	e8 6c fd ff ff       	call   490 <schedtest_copy_file>
+     724:	83 c4 10             	add    $0x10,%esp
+     727:	85 c0                	test   %eax,%eax
+     729:	75 3d                	jne    768 <child_workload+0x1a8>
+        unlink(dest_filename); // Clean up the copied file
+     72b:	83 ec 0c             	sub    $0xc,%esp
+     72e:	56                   	push   %esi
+     72f:	e8 f9 0a 00 00       	call   122d <unlink>
+     734:	83 c4 10             	add    $0x10,%esp
+    end_syscalls = getnumsyscalls(); // Uncommented
+     737:	e8 7d 0b 00 00       	call   12b9 <getnumsyscalls>
+    lifetime = get_process_lifetime(my_pid); // Uncommented
+     73c:	83 ec 0c             	sub    $0xc,%esp
+     73f:	53                   	push   %ebx
+    end_syscalls = getnumsyscalls(); // Uncommented
+     740:	89 c6                	mov    %eax,%esi
+    lifetime = get_process_lifetime(my_pid); // Uncommented
+     742:	e8 68 0b 00 00       	call   12af <get_process_lifetime>
+    printf(1, "Child %d finished: Uncles=%d, Lifetime=%d ms, Syscalls Used=%d\n",
+     747:	8b 7d b4             	mov    -0x4c(%ebp),%edi
+     74a:	5a                   	pop    %edx
+     74b:	59                   	pop    %ecx
+     74c:	29 fe                	sub    %edi,%esi
+     74e:	56                   	push   %esi
+     74f:	50                   	push   %eax
+     750:	ff 75 b0             	push   -0x50(%ebp)
+     753:	53                   	push   %ebx
+     754:	68 0c 1a 00 00       	push   $0x1a0c
+     759:	6a 01                	push   $0x1
+     75b:	e8 20 0d 00 00       	call   1480 <printf>
+    exit(); // Child must exit
+     760:	83 c4 20             	add    $0x20,%esp
+     763:	e8 68 06 00 00       	call   dd0 <exit>
+        printf(2, "Child %d: File copy failed.\n", my_pid);
+     768:	56                   	push   %esi
+     769:	53                   	push   %ebx
+     76a:	68 8a 1d 00 00       	push   $0x1d8a
+     76f:	6a 02                	push   $0x2
+     771:	e8 0a 0d 00 00       	call   1480 <printf>
+     776:	83 c4 10             	add    $0x10,%esp
+     779:	eb bc                	jmp    737 <child_workload+0x177>
+    pid_str[i] = '\0'; // Null terminate the reversed string
+     77b:	c6 45 bc 00          	movb   $0x0,-0x44(%ebp)
+    for (j = 0; j < i / 2; j++) {
+     77f:	8d 7d bc             	lea    -0x44(%ebp),%edi
+     782:	e9 4a ff ff ff       	jmp    6d1 <child_workload+0x111>
+     787:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     78e:	66 90                	xchg   %ax,%ax
+
+00000790 <numDigits>:
+int numDigits(uint64 n) {
+     790:	55                   	push   %ebp
+     791:	89 e5                	mov    %esp,%ebp
+     793:	57                   	push   %edi
+    int count = 0;
+     794:	31 ff                	xor    %edi,%edi
+int numDigits(uint64 n) {
+     796:	56                   	push   %esi
+     797:	53                   	push   %ebx
+     798:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     79b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     79e:	66 90                	xchg   %ax,%ax
+  r = (uint)(n >> 32) % d;
+     7a0:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+        count++;
+     7a5:	83 c7 01             	add    $0x1,%edi
+     7a8:	f7 e1                	mul    %ecx
+     7aa:	c1 ea 03             	shr    $0x3,%edx
+     7ad:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     7b0:	89 d6                	mov    %edx,%esi
+     7b2:	01 c0                	add    %eax,%eax
+     7b4:	29 c1                	sub    %eax,%ecx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     7b6:	89 d8                	mov    %ebx,%eax
+     7b8:	bb 0a 00 00 00       	mov    $0xa,%ebx
+  r = (uint)(n >> 32) % d;
+     7bd:	89 ca                	mov    %ecx,%edx
+  return ((uint64)hi << 32) | lo;
+     7bf:	89 f1                	mov    %esi,%ecx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     7c1:	f7 f3                	div    %ebx
+     7c3:	89 c3                	mov    %eax,%ebx
+    } while (n > 0);
+     7c5:	89 f0                	mov    %esi,%eax
+     7c7:	09 d8                	or     %ebx,%eax
+     7c9:	75 d5                	jne    7a0 <numDigits+0x10>
+    return count;
+}
+     7cb:	5b                   	pop    %ebx
+     7cc:	89 f8                	mov    %edi,%eax
+     7ce:	5e                   	pop    %esi
+     7cf:	5f                   	pop    %edi
+     7d0:	5d                   	pop    %ebp
+     7d1:	c3                   	ret
+     7d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000007e0 <run_scheduler_test>:
+
+// Add this function to run a test with the specified scheduler
+int run_scheduler_test(int policy, scheduler_result *result) {
+     7e0:	55                   	push   %ebp
+     7e1:	89 e5                	mov    %esp,%ebp
+     7e3:	57                   	push   %edi
+     7e4:	56                   	push   %esi
+     7e5:	53                   	push   %ebx
+     7e6:	83 ec 60             	sub    $0x60,%esp
+     7e9:	8b 75 08             	mov    0x8(%ebp),%esi
+    int fd;
+    const char *src_filename = "src_copy_file.txt";
+    const char *file_content = "This is the source file content for the copy test.\n";
+
+    // 1. Setup: Create the source file
+    printf(1, "Creating source file '%s'...\n", src_filename);
+     7ec:	68 78 1d 00 00       	push   $0x1d78
+     7f1:	68 a7 1d 00 00       	push   $0x1da7
+     7f6:	6a 01                	push   $0x1
+     7f8:	e8 83 0c 00 00       	call   1480 <printf>
+    unlink(src_filename); // Remove if it exists
+     7fd:	c7 04 24 78 1d 00 00 	movl   $0x1d78,(%esp)
+     804:	e8 24 0a 00 00       	call   122d <unlink>
+    if ((fd = open(src_filename, O_CREATE | O_WRONLY)) < 0) {
+     809:	58                   	pop    %eax
+     80a:	5a                   	pop    %edx
+     80b:	68 01 02 00 00       	push   $0x201
+     810:	68 78 1d 00 00       	push   $0x1d78
+     815:	e8 ff 09 00 00       	call   1219 <open>
+     81a:	83 c4 10             	add    $0x10,%esp
+     81d:	85 c0                	test   %eax,%eax
+     81f:	0f 88 f6 02 00 00    	js     b1b <run_scheduler_test+0x33b>
+        printf(2, "Failed to create source file.\n");
+        return -1;
+    }
+    if (write(fd, file_content, strlen(file_content)) != strlen(file_content)) {
+     825:	83 ec 0c             	sub    $0xc,%esp
+     828:	89 c3                	mov    %eax,%ebx
+     82a:	68 6c 1a 00 00       	push   $0x1a6c
+     82f:	e8 0c 07 00 00       	call   f40 <strlen>
+     834:	83 c4 0c             	add    $0xc,%esp
+     837:	50                   	push   %eax
+     838:	68 6c 1a 00 00       	push   $0x1a6c
+     83d:	53                   	push   %ebx
+     83e:	e8 ba 09 00 00       	call   11fd <write>
+     843:	c7 04 24 6c 1a 00 00 	movl   $0x1a6c,(%esp)
+     84a:	89 c7                	mov    %eax,%edi
+     84c:	e8 ef 06 00 00       	call   f40 <strlen>
+     851:	83 c4 10             	add    $0x10,%esp
+     854:	39 c7                	cmp    %eax,%edi
+     856:	0f 85 a3 02 00 00    	jne    aff <run_scheduler_test+0x31f>
+         printf(2, "Failed to write to source file.\n");
+         close(fd);
+         return -1;
+    }
+    close(fd);
+     85c:	83 ec 0c             	sub    $0xc,%esp
+
+    // 2. Forking Children
+    printf(1, "Forking %d children...\n", num_children);
+    for (i = 0; i < num_children; i++) {
+     85f:	31 ff                	xor    %edi,%edi
+    close(fd);
+     861:	53                   	push   %ebx
+     862:	e8 d9 05 00 00       	call   e40 <close>
+    printf(1, "Forking %d children...\n", num_children);
+     867:	83 c4 0c             	add    $0xc,%esp
+     86a:	6a 05                	push   $0x5
+     86c:	68 c5 1d 00 00       	push   $0x1dc5
+     871:	6a 01                	push   $0x1
+     873:	e8 08 0c 00 00       	call   1480 <printf>
+     878:	83 c4 10             	add    $0x10,%esp
+     87b:	eb 0b                	jmp    888 <run_scheduler_test+0xa8>
+     87d:	8d 76 00             	lea    0x0(%esi),%esi
+    for (i = 0; i < num_children; i++) {
+     880:	83 c7 01             	add    $0x1,%edi
+     883:	83 ff 05             	cmp    $0x5,%edi
+     886:	74 6d                	je     8f5 <run_scheduler_test+0x115>
+        int pid = fork();
+     888:	e8 f3 04 00 00       	call   d80 <fork>
+     88d:	89 c3                	mov    %eax,%ebx
+        if (pid < 0) {
+     88f:	85 c0                	test   %eax,%eax
+     891:	0f 88 29 02 00 00    	js     ac0 <run_scheduler_test+0x2e0>
+            for(int j = 0; j < i; j++) {
+                kill(pids[j]);
+                wait(); // Clean up zombies
+            }
+            return -1;
+        } else if (pid == 0) {
+     897:	0f 84 92 02 00 00    	je     b2f <run_scheduler_test+0x34f>
+            // Child process
+            child_workload();
+            // child_workload calls exit(), so this part is unreachable
+        } else {
+            // Parent process
+            pids[i] = pid;
+     89d:	89 44 bd d4          	mov    %eax,-0x2c(%ebp,%edi,4)
+            printf(1, "Forked child %d with PID %d.\n", i, pid);
+     8a1:	50                   	push   %eax
+     8a2:	57                   	push   %edi
+     8a3:	68 eb 1d 00 00       	push   $0x1deb
+     8a8:	6a 01                	push   $0x1
+     8aa:	e8 d1 0b 00 00       	call   1480 <printf>
+
+            // Set priority for BJF testing if needed
+            if (policy == SCHED_BJF) {
+     8af:	83 c4 10             	add    $0x10,%esp
+     8b2:	83 fe 02             	cmp    $0x2,%esi
+     8b5:	75 c9                	jne    880 <run_scheduler_test+0xa0>
+                int initial_priority = (i % 3) + 1; // Example: 1, 2, 3, 1, 2...
+     8b7:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+     8bc:	f7 e7                	mul    %edi
+     8be:	89 d0                	mov    %edx,%eax
+     8c0:	83 e2 fe             	and    $0xfffffffe,%edx
+     8c3:	d1 e8                	shr    %eax
+     8c5:	01 c2                	add    %eax,%edx
+     8c7:	89 f8                	mov    %edi,%eax
+    for (i = 0; i < num_children; i++) {
+     8c9:	83 c7 01             	add    $0x1,%edi
+                int initial_priority = (i % 3) + 1; // Example: 1, 2, 3, 1, 2...
+     8cc:	29 d0                	sub    %edx,%eax
+     8ce:	83 c0 01             	add    $0x1,%eax
+                printf(1, "Setting initial priority for PID %d to %d\n", pid, initial_priority);
+     8d1:	50                   	push   %eax
+     8d2:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+     8d5:	53                   	push   %ebx
+     8d6:	68 c4 1a 00 00       	push   $0x1ac4
+     8db:	6a 01                	push   $0x1
+     8dd:	e8 9e 0b 00 00       	call   1480 <printf>
+                set_priority(initial_priority);
+     8e2:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+     8e5:	89 04 24             	mov    %eax,(%esp)
+     8e8:	e8 f4 09 00 00       	call   12e1 <set_priority>
+     8ed:	83 c4 10             	add    $0x10,%esp
+    for (i = 0; i < num_children; i++) {
+     8f0:	83 ff 05             	cmp    $0x5,%edi
+     8f3:	75 93                	jne    888 <run_scheduler_test+0xa8>
+            }
+        }
+    }
+
+    // 3. Data Collection & Monitoring
+    printf(1, "Waiting for children to complete...\n");
+     8f5:	83 ec 08             	sub    $0x8,%esp
+     8f8:	8d 5d c8             	lea    -0x38(%ebp),%ebx
+     8fb:	68 f0 1a 00 00       	push   $0x1af0
+     900:	6a 01                	push   $0x1
+     902:	e8 79 0b 00 00       	call   1480 <printf>
+    int completed_children = 0;
+     907:	c7 45 b4 00 00 00 00 	movl   $0x0,-0x4c(%ebp)
+    printf(1, "Waiting for children to complete...\n");
+     90e:	83 c4 10             	add    $0x10,%esp
+    uint64 total_rtime = 0;
+     911:	c7 45 a0 00 00 00 00 	movl   $0x0,-0x60(%ebp)
+     918:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+    uint64 total_wtime = 0;
+     91f:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%ebp)
+     926:	c7 45 ac 00 00 00 00 	movl   $0x0,-0x54(%ebp)
+     92d:	8d 76 00             	lea    0x0(%esi),%esi
+
+    while (completed_children < num_children) {
+        uint64 wtime, rtime;
+        int ret_pid = waitx(&wtime, &rtime); // Wait for ANY child
+     930:	83 ec 08             	sub    $0x8,%esp
+     933:	8d 45 c0             	lea    -0x40(%ebp),%eax
+     936:	53                   	push   %ebx
+     937:	50                   	push   %eax
+     938:	e8 90 09 00 00       	call   12cd <waitx>
+
+        if (ret_pid > 0) {
+     93d:	83 c4 10             	add    $0x10,%esp
+     940:	85 c0                	test   %eax,%eax
+     942:	0f 8f 98 00 00 00    	jg     9e0 <run_scheduler_test+0x200>
+                if(pids[j] == ret_pid) {
+                    pids[j] = -1; // Mark as completed
+                    break;
+                }
+            }
+        } else if (ret_pid == -1) {
+     948:	83 f8 ff             	cmp    $0xffffffff,%eax
+     94b:	75 e3                	jne    930 <run_scheduler_test+0x150>
+             printf(2, "waitx error.\n");
+     94d:	83 ec 08             	sub    $0x8,%esp
+     950:	68 09 1e 00 00       	push   $0x1e09
+     955:	6a 02                	push   $0x2
+     957:	e8 24 0b 00 00       	call   1480 <printf>
+             break;
+        }
+    }
+
+    // Final ps run, once no children are left
+    printf(1, "\n--- Final Process Status ---\n");
+     95c:	59                   	pop    %ecx
+     95d:	5b                   	pop    %ebx
+     95e:	68 54 1b 00 00       	push   $0x1b54
+     963:	6a 01                	push   $0x1
+     965:	e8 16 0b 00 00       	call   1480 <printf>
+    runps();
+     96a:	e8 71 0f 00 00       	call   18e0 <runps>
+    printf(1, "---------------------------\n");
+     96f:	5e                   	pop    %esi
+     970:	5f                   	pop    %edi
+     971:	68 17 1e 00 00       	push   $0x1e17
+     976:	6a 01                	push   $0x1
+     978:	e8 03 0b 00 00       	call   1480 <printf>
+
+    // Store results for this scheduler
+    result->completed = completed_children;
+     97d:	8b 45 0c             	mov    0xc(%ebp),%eax
+     980:	8b 4d b4             	mov    -0x4c(%ebp),%ecx
+    result->total_wtime = total_wtime;
+    result->total_rtime = total_rtime;
+    
+    if (completed_children > 0) {
+     983:	83 c4 10             	add    $0x10,%esp
+    result->total_wtime = total_wtime;
+     986:	8b 55 ac             	mov    -0x54(%ebp),%edx
+    result->completed = completed_children;
+     989:	89 48 18             	mov    %ecx,0x18(%eax)
+    result->total_wtime = total_wtime;
+     98c:	89 c6                	mov    %eax,%esi
+     98e:	8b 45 a8             	mov    -0x58(%ebp),%eax
+     991:	89 56 20             	mov    %edx,0x20(%esi)
+    result->total_rtime = total_rtime;
+     994:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+    result->total_wtime = total_wtime;
+     997:	89 46 1c             	mov    %eax,0x1c(%esi)
+    result->total_rtime = total_rtime;
+     99a:	8b 45 a0             	mov    -0x60(%ebp),%eax
+     99d:	89 56 28             	mov    %edx,0x28(%esi)
+     9a0:	89 46 24             	mov    %eax,0x24(%esi)
+    if (completed_children > 0) {
+     9a3:	85 c9                	test   %ecx,%ecx
+     9a5:	0f 85 bb 00 00 00    	jne    a66 <run_scheduler_test+0x286>
+        result->avg_rtime = div64(total_rtime, completed_children);
+        result->avg_turnaround = div64(total_wtime + total_rtime, completed_children);
+    }
+
+    // Cleanup
+    printf(1, "Cleaning up source file '%s'...\n", src_filename);
+     9ab:	83 ec 04             	sub    $0x4,%esp
+     9ae:	68 78 1d 00 00       	push   $0x1d78
+     9b3:	68 74 1b 00 00       	push   $0x1b74
+     9b8:	6a 01                	push   $0x1
+     9ba:	e8 c1 0a 00 00       	call   1480 <printf>
+    unlink(src_filename);
+     9bf:	c7 04 24 78 1d 00 00 	movl   $0x1d78,(%esp)
+     9c6:	e8 62 08 00 00       	call   122d <unlink>
+    
+    return 0;
+     9cb:	83 c4 10             	add    $0x10,%esp
+     9ce:	31 c0                	xor    %eax,%eax
+     9d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9d3:	5b                   	pop    %ebx
+     9d4:	5e                   	pop    %esi
+     9d5:	5f                   	pop    %edi
+     9d6:	5d                   	pop    %ebp
+     9d7:	c3                   	ret
+     9d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9df:	90                   	nop
+            total_wtime += wtime;
+     9e0:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     9e3:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+            total_rtime += rtime;
+     9e6:	8b 55 c8             	mov    -0x38(%ebp),%edx
+     9e9:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+            completed_children++;
+     9ec:	83 45 b4 01          	addl   $0x1,-0x4c(%ebp)
+            total_wtime += wtime;
+     9f0:	01 75 a8             	add    %esi,-0x58(%ebp)
+     9f3:	11 7d ac             	adc    %edi,-0x54(%ebp)
+            total_rtime += rtime;
+     9f6:	01 55 a0             	add    %edx,-0x60(%ebp)
+     9f9:	11 4d a4             	adc    %ecx,-0x5c(%ebp)
+            printf(1, "Child PID %d finished. Wait Time = %l us, Run Time = %l us\n", 
+     9fc:	83 ec 04             	sub    $0x4,%esp
+     9ff:	51                   	push   %ecx
+     a00:	52                   	push   %edx
+     a01:	57                   	push   %edi
+     a02:	56                   	push   %esi
+     a03:	50                   	push   %eax
+     a04:	68 18 1b 00 00       	push   $0x1b18
+     a09:	6a 01                	push   $0x1
+     a0b:	e8 70 0a 00 00       	call   1480 <printf>
+    while (completed_children < num_children) {
+     a10:	83 c4 20             	add    $0x20,%esp
+     a13:	83 7d b4 05          	cmpl   $0x5,-0x4c(%ebp)
+     a17:	0f 85 13 ff ff ff    	jne    930 <run_scheduler_test+0x150>
+    printf(1, "\n--- Final Process Status ---\n");
+     a1d:	83 ec 08             	sub    $0x8,%esp
+     a20:	68 54 1b 00 00       	push   $0x1b54
+     a25:	6a 01                	push   $0x1
+     a27:	e8 54 0a 00 00       	call   1480 <printf>
+    runps();
+     a2c:	e8 af 0e 00 00       	call   18e0 <runps>
+    printf(1, "---------------------------\n");
+     a31:	58                   	pop    %eax
+     a32:	5a                   	pop    %edx
+     a33:	68 17 1e 00 00       	push   $0x1e17
+     a38:	6a 01                	push   $0x1
+     a3a:	e8 41 0a 00 00       	call   1480 <printf>
+    result->completed = completed_children;
+     a3f:	8b 45 0c             	mov    0xc(%ebp),%eax
+    result->total_wtime = total_wtime;
+     a42:	8b 55 ac             	mov    -0x54(%ebp),%edx
+    result->total_rtime = total_rtime;
+     a45:	83 c4 10             	add    $0x10,%esp
+    result->completed = completed_children;
+     a48:	c7 40 18 05 00 00 00 	movl   $0x5,0x18(%eax)
+    result->total_wtime = total_wtime;
+     a4f:	89 c6                	mov    %eax,%esi
+     a51:	8b 45 a8             	mov    -0x58(%ebp),%eax
+     a54:	89 56 20             	mov    %edx,0x20(%esi)
+    result->total_rtime = total_rtime;
+     a57:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+    result->total_wtime = total_wtime;
+     a5a:	89 46 1c             	mov    %eax,0x1c(%esi)
+    result->total_rtime = total_rtime;
+     a5d:	8b 45 a0             	mov    -0x60(%ebp),%eax
+     a60:	89 56 28             	mov    %edx,0x28(%esi)
+     a63:	89 46 24             	mov    %eax,0x24(%esi)
+  hi = (uint)(n >> 32) / d;
+     a66:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+     a69:	8b 45 ac             	mov    -0x54(%ebp),%eax
+     a6c:	31 d2                	xor    %edx,%edx
+     a6e:	8b 75 a8             	mov    -0x58(%ebp),%esi
+     a71:	8b 7d a4             	mov    -0x5c(%ebp),%edi
+     a74:	f7 f3                	div    %ebx
+     a76:	89 c1                	mov    %eax,%ecx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     a78:	89 f0                	mov    %esi,%eax
+  hi = (uint)(n >> 32) / d;
+     a7a:	8b 75 a0             	mov    -0x60(%ebp),%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     a7d:	f7 f3                	div    %ebx
+  return ((uint64)hi << 32) | lo;
+     a7f:	8b 55 0c             	mov    0xc(%ebp),%edx
+     a82:	89 42 2c             	mov    %eax,0x2c(%edx)
+  hi = (uint)(n >> 32) / d;
+     a85:	89 f8                	mov    %edi,%eax
+  return ((uint64)hi << 32) | lo;
+     a87:	89 4a 30             	mov    %ecx,0x30(%edx)
+  hi = (uint)(n >> 32) / d;
+     a8a:	31 d2                	xor    %edx,%edx
+     a8c:	f7 f3                	div    %ebx
+     a8e:	89 c1                	mov    %eax,%ecx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     a90:	89 f0                	mov    %esi,%eax
+     a92:	f7 f3                	div    %ebx
+  return ((uint64)hi << 32) | lo;
+     a94:	8b 55 0c             	mov    0xc(%ebp),%edx
+        result->avg_turnaround = div64(total_wtime + total_rtime, completed_children);
+     a97:	03 75 a8             	add    -0x58(%ebp),%esi
+     a9a:	13 7d ac             	adc    -0x54(%ebp),%edi
+     a9d:	89 42 34             	mov    %eax,0x34(%edx)
+  hi = (uint)(n >> 32) / d;
+     aa0:	89 f8                	mov    %edi,%eax
+  return ((uint64)hi << 32) | lo;
+     aa2:	89 4a 38             	mov    %ecx,0x38(%edx)
+  hi = (uint)(n >> 32) / d;
+     aa5:	31 d2                	xor    %edx,%edx
+     aa7:	f7 f3                	div    %ebx
+     aa9:	89 c1                	mov    %eax,%ecx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     aab:	89 f0                	mov    %esi,%eax
+  return ((uint64)hi << 32) | lo;
+     aad:	8b 75 0c             	mov    0xc(%ebp),%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     ab0:	f7 f3                	div    %ebx
+  return ((uint64)hi << 32) | lo;
+     ab2:	89 4e 40             	mov    %ecx,0x40(%esi)
+     ab5:	89 46 3c             	mov    %eax,0x3c(%esi)
+     ab8:	e9 ee fe ff ff       	jmp    9ab <run_scheduler_test+0x1cb>
+     abd:	8d 76 00             	lea    0x0(%esi),%esi
+            printf(2, "Fork failed.\n");
+     ac0:	83 ec 08             	sub    $0x8,%esp
+     ac3:	68 dd 1d 00 00       	push   $0x1ddd
+     ac8:	6a 02                	push   $0x2
+     aca:	e8 b1 09 00 00       	call   1480 <printf>
+            for(int j = 0; j < i; j++) {
+     acf:	83 c4 10             	add    $0x10,%esp
+     ad2:	85 ff                	test   %edi,%edi
+     ad4:	74 1f                	je     af5 <run_scheduler_test+0x315>
+     ad6:	8d 5d d4             	lea    -0x2c(%ebp),%ebx
+     ad9:	8d 34 bb             	lea    (%ebx,%edi,4),%esi
+                kill(pids[j]);
+     adc:	83 ec 0c             	sub    $0xc,%esp
+     adf:	ff 33                	push   (%ebx)
+            for(int j = 0; j < i; j++) {
+     ae1:	83 c3 04             	add    $0x4,%ebx
+                kill(pids[j]);
+     ae4:	e8 22 07 00 00       	call   120b <kill>
+                wait(); // Clean up zombies
+     ae9:	e8 fa 06 00 00       	call   11e8 <wait>
+            for(int j = 0; j < i; j++) {
+     aee:	83 c4 10             	add    $0x10,%esp
+     af1:	39 f3                	cmp    %esi,%ebx
+     af3:	75 e7                	jne    adc <run_scheduler_test+0x2fc>
+        return -1;
+     af5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     afa:	e9 d1 fe ff ff       	jmp    9d0 <run_scheduler_test+0x1f0>
+         printf(2, "Failed to write to source file.\n");
+     aff:	83 ec 08             	sub    $0x8,%esp
+     b02:	68 a0 1a 00 00       	push   $0x1aa0
+     b07:	6a 02                	push   $0x2
+     b09:	e8 72 09 00 00       	call   1480 <printf>
+         close(fd);
+     b0e:	89 1c 24             	mov    %ebx,(%esp)
+     b11:	e8 2a 03 00 00       	call   e40 <close>
+         return -1;
+     b16:	83 c4 10             	add    $0x10,%esp
+     b19:	eb da                	jmp    af5 <run_scheduler_test+0x315>
+        printf(2, "Failed to create source file.\n");
+     b1b:	83 ec 08             	sub    $0x8,%esp
+     b1e:	68 4c 1a 00 00       	push   $0x1a4c
+     b23:	6a 02                	push   $0x2
+     b25:	e8 56 09 00 00       	call   1480 <printf>
+        return -1;
+     b2a:	83 c4 10             	add    $0x10,%esp
+     b2d:	eb c6                	jmp    af5 <run_scheduler_test+0x315>
+            child_workload();
+     b2f:	e8 8c fa ff ff       	call   5c0 <child_workload>
+     b34:	66 90                	xchg   %ax,%ax
+     b36:	66 90                	xchg   %ax,%ax
+     b38:	66 90                	xchg   %ax,%ax
+     b3a:	66 90                	xchg   %ax,%ax
+     b3c:	66 90                	xchg   %ax,%ax
+     b3e:	66 90                	xchg   %ax,%ax
+
+00000b40 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+     b40:	55                   	push   %ebp
+     b41:	89 e5                	mov    %esp,%ebp
+     b43:	57                   	push   %edi
+     b44:	56                   	push   %esi
+     b45:	53                   	push   %ebx
+     b46:	83 ec 4c             	sub    $0x4c,%esp
+     b49:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b4c:	8b 55 08             	mov    0x8(%ebp),%edx
+     b4f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     b52:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+     b55:	83 fa 0f             	cmp    $0xf,%edx
+     b58:	0f 87 32 01 00 00    	ja     c90 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+     b5e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     b64:	8b 80 60 24 00 00    	mov    0x2460(%eax),%eax
+     b6a:	85 c0                	test   %eax,%eax
+     b6c:	0f 84 de 00 00 00    	je     c50 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+     b72:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     b78:	8b b0 64 24 00 00    	mov    0x2464(%eax),%esi
+     b7e:	8d 88 60 24 00 00    	lea    0x2460(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+     b84:	8d b8 68 24 00 00    	lea    0x2468(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+     b8a:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+     b8d:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+     b90:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+     b93:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+     b99:	0f 8f 01 01 00 00    	jg     ca0 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+     b9f:	8d 78 08             	lea    0x8(%eax),%edi
+     ba2:	8d bc 3e 60 24 00 00 	lea    0x2460(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     ba9:	85 db                	test   %ebx,%ebx
+     bab:	7e 3b                	jle    be8 <bufwrite+0xa8>
+     bad:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+     bb0:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+     bb3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bb7:	90                   	nop
+    *dst++ = *src++;
+     bb8:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     bb9:	39 c6                	cmp    %eax,%esi
+     bbb:	75 fb                	jne    bb8 <bufwrite+0x78>
+  ob[fd].n += n;
+     bbd:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     bc3:	8b 88 64 24 00 00    	mov    0x2464(%eax),%ecx
+     bc9:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     bcb:	83 b8 60 24 00 00 01 	cmpl   $0x1,0x2460(%eax)
+  ob[fd].n += n;
+     bd2:	89 88 64 24 00 00    	mov    %ecx,0x2464(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     bd8:	74 26                	je     c00 <bufwrite+0xc0>
+}
+     bda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bdd:	5b                   	pop    %ebx
+     bde:	5e                   	pop    %esi
+     bdf:	5f                   	pop    %edi
+     be0:	5d                   	pop    %ebp
+     be1:	c3                   	ret
+     be2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+     be8:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     beb:	83 b8 60 24 00 00 01 	cmpl   $0x1,0x2460(%eax)
+  ob[fd].n += n;
+     bf2:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     bf5:	75 e3                	jne    bda <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+     bf7:	85 db                	test   %ebx,%ebx
+     bf9:	74 df                	je     bda <bufwrite+0x9a>
+     bfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bff:	90                   	nop
+  src = vsrc;
+     c00:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     c03:	01 c3                	add    %eax,%ebx
+     c05:	eb 10                	jmp    c17 <bufwrite+0xd7>
+     c07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c0e:	66 90                	xchg   %ax,%ax
+     c10:	83 c0 01             	add    $0x1,%eax
+     c13:	39 d8                	cmp    %ebx,%eax
+     c15:	74 c3                	je     bda <bufwrite+0x9a>
+    if(*p == (char)c)
+     c17:	80 38 0a             	cmpb   $0xa,(%eax)
+     c1a:	75 f4                	jne    c10 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     c1c:	85 c9                	test   %ecx,%ecx
+     c1e:	7e ba                	jle    bda <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+     c20:	83 ec 04             	sub    $0x4,%esp
+     c23:	51                   	push   %ecx
+     c24:	ff 75 ac             	push   -0x54(%ebp)
+     c27:	52                   	push   %edx
+     c28:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+     c2b:	e8 cd 05 00 00       	call   11fd <write>
+    ob[fd].n = 0;
+     c30:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     c33:	83 c4 10             	add    $0x10,%esp
+     c36:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+     c3c:	c7 82 64 24 00 00 00 	movl   $0x0,0x2464(%edx)
+     c43:	00 00 00 
+     c46:	eb 92                	jmp    bda <bufwrite+0x9a>
+     c48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c4f:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     c50:	83 ec 08             	sub    $0x8,%esp
+     c53:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     c56:	50                   	push   %eax
+     c57:	52                   	push   %edx
+     c58:	89 55 b0             	mov    %edx,-0x50(%ebp)
+     c5b:	e8 d7 05 00 00       	call   1237 <fstat>
+     c60:	83 c4 10             	add    $0x10,%esp
+     c63:	8b 55 b0             	mov    -0x50(%ebp),%edx
+     c66:	89 c1                	mov    %eax,%ecx
+     c68:	b8 02 00 00 00       	mov    $0x2,%eax
+     c6d:	85 c9                	test   %ecx,%ecx
+     c6f:	75 0d                	jne    c7e <bufwrite+0x13e>
+     c71:	31 c0                	xor    %eax,%eax
+     c73:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     c78:	0f 95 c0             	setne  %al
+     c7b:	83 c0 01             	add    $0x1,%eax
+     c7e:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+     c84:	89 81 60 24 00 00    	mov    %eax,0x2460(%ecx)
+     c8a:	e9 e3 fe ff ff       	jmp    b72 <bufwrite+0x32>
+     c8f:	90                   	nop
+}
+     c90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c93:	5b                   	pop    %ebx
+     c94:	5e                   	pop    %esi
+     c95:	5f                   	pop    %edi
+     c96:	5d                   	pop    %ebp
+    write(fd, p, n);
+     c97:	e9 61 05 00 00       	jmp    11fd <write>
+     c9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+     ca0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+     ca3:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+     ca6:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+     ca9:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+     cac:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+     caf:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+     cb2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+     cb5:	6a 02                	push   $0x2
+     cb7:	50                   	push   %eax
+     cb8:	52                   	push   %edx
+     cb9:	e8 9b 06 00 00       	call   1359 <writev>
+    ob[fd].n = 0;
+     cbe:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+     cc1:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+     cc4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+     ccb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cce:	5b                   	pop    %ebx
+     ccf:	5e                   	pop    %esi
+     cd0:	5f                   	pop    %edi
+     cd1:	5d                   	pop    %ebp
+     cd2:	c3                   	ret
+     cd3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ce0 <fflush>:
+{
+     ce0:	55                   	push   %ebp
+     ce1:	89 e5                	mov    %esp,%ebp
+     ce3:	53                   	push   %ebx
+     ce4:	83 ec 04             	sub    $0x4,%esp
+     ce7:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     cea:	83 f8 0f             	cmp    $0xf,%eax
+     ced:	77 16                	ja     d05 <fflush+0x25>
+     cef:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+     cf5:	8b 8a 64 24 00 00    	mov    0x2464(%edx),%ecx
+     cfb:	8d 9a 60 24 00 00    	lea    0x2460(%edx),%ebx
+     d01:	85 c9                	test   %ecx,%ecx
+     d03:	7f 0b                	jg     d10 <fflush+0x30>
+}
+     d05:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d08:	c9                   	leave
+     d09:	c3                   	ret
+     d0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     d10:	83 ec 04             	sub    $0x4,%esp
+     d13:	81 c2 68 24 00 00    	add    $0x2468,%edx
+     d19:	51                   	push   %ecx
+     d1a:	52                   	push   %edx
+     d1b:	50                   	push   %eax
+     d1c:	e8 dc 04 00 00       	call   11fd <write>
+    ob[fd].n = 0;
+     d21:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     d28:	83 c4 10             	add    $0x10,%esp
+}
+     d2b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d2e:	c9                   	leave
+     d2f:	c3                   	ret
+
+00000d30 <fflushall>:
+{
+     d30:	55                   	push   %ebp
+     d31:	89 e5                	mov    %esp,%ebp
+     d33:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     d34:	31 f6                	xor    %esi,%esi
+{
+     d36:	53                   	push   %ebx
+     d37:	bb 68 24 00 00       	mov    $0x2468,%ebx
+     d3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     d40:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     d43:	85 c0                	test   %eax,%eax
+     d45:	7e 15                	jle    d5c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     d47:	83 ec 04             	sub    $0x4,%esp
+     d4a:	50                   	push   %eax
+     d4b:	53                   	push   %ebx
+     d4c:	56                   	push   %esi
+     d4d:	e8 ab 04 00 00       	call   11fd <write>
+    ob[fd].n = 0;
+     d52:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     d59:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     d5c:	83 c6 01             	add    $0x1,%esi
+     d5f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     d65:	83 fe 10             	cmp    $0x10,%esi
+     d68:	75 d6                	jne    d40 <fflushall+0x10>
+}
+     d6a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d6d:	5b                   	pop    %ebx
+     d6e:	5e                   	pop    %esi
+     d6f:	5d                   	pop    %ebp
+     d70:	c3                   	ret
+     d71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d7f:	90                   	nop
+
+00000d80 <fork>:
+{
+     d80:	55                   	push   %ebp
+     d81:	89 e5                	mov    %esp,%ebp
+     d83:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     d84:	31 f6                	xor    %esi,%esi
+{
+     d86:	53                   	push   %ebx
+     d87:	bb 68 24 00 00       	mov    $0x2468,%ebx
+     d8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     d90:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     d93:	85 c0                	test   %eax,%eax
+     d95:	7e 15                	jle    dac <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     d97:	83 ec 04             	sub    $0x4,%esp
+     d9a:	50                   	push   %eax
+     d9b:	53                   	push   %ebx
+     d9c:	56                   	push   %esi
+     d9d:	e8 5b 04 00 00       	call   11fd <write>
+    ob[fd].n = 0;
+     da2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     da9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     dac:	83 c6 01             	add    $0x1,%esi
+     daf:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     db5:	83 fe 10             	cmp    $0x10,%esi
+     db8:	75 d6                	jne    d90 <fork+0x10>
+}
+     dba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     dbd:	5b                   	pop    %ebx
+     dbe:	5e                   	pop    %esi
+     dbf:	5d                   	pop    %ebp
+  return _fork();
+     dc0:	e9 15 04 00 00       	jmp    11da <_fork>
+     dc5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000dd0 <exit>:
+{
+     dd0:	55                   	push   %ebp
+     dd1:	89 e5                	mov    %esp,%ebp
+     dd3:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+     dd6:	e8 55 ff ff ff       	call   d30 <fflushall>
+  _exit();
+     ddb:	e8 01 04 00 00       	call   11e1 <_exit>
+
+00000de0 <exec>:
+{
+     de0:	55                   	push   %ebp
+     de1:	89 e5                	mov    %esp,%ebp
+     de3:	57                   	push   %edi
+     de4:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     de5:	31 f6                	xor    %esi,%esi
+{
+     de7:	53                   	push   %ebx
+     de8:	bb 68 24 00 00       	mov    $0x2468,%ebx
+     ded:	83 ec 1c             	sub    $0x1c,%esp
+     df0:	8b 45 08             	mov    0x8(%ebp),%eax
+     df3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     df6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     df9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     e00:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     e03:	85 c0                	test   %eax,%eax
+     e05:	7e 15                	jle    e1c <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     e07:	83 ec 04             	sub    $0x4,%esp
+     e0a:	50                   	push   %eax
+     e0b:	53                   	push   %ebx
+     e0c:	56                   	push   %esi
+     e0d:	e8 eb 03 00 00       	call   11fd <write>
+    ob[fd].n = 0;
+     e12:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     e19:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     e1c:	83 c6 01             	add    $0x1,%esi
+     e1f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     e25:	83 fe 10             	cmp    $0x10,%esi
+     e28:	75 d6                	jne    e00 <exec+0x20>
+  return _exec(path, argv);
+     e2a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     e2d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+     e30:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     e33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e36:	5b                   	pop    %ebx
+     e37:	5e                   	pop    %esi
+     e38:	5f                   	pop    %edi
+     e39:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     e3a:	e9 d3 03 00 00       	jmp    1212 <_exec>
+     e3f:	90                   	nop
+
+00000e40 <close>:
+{
+     e40:	55                   	push   %ebp
+     e41:	89 e5                	mov    %esp,%ebp
+     e43:	56                   	push   %esi
+     e44:	53                   	push   %ebx
+     e45:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     e48:	83 fb 0f             	cmp    $0xf,%ebx
+     e4b:	77 26                	ja     e73 <close+0x33>
+     e4d:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     e53:	8b 90 64 24 00 00    	mov    0x2464(%eax),%edx
+     e59:	8d b0 60 24 00 00    	lea    0x2460(%eax),%esi
+     e5f:	85 d2                	test   %edx,%edx
+     e61:	7f 25                	jg     e88 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+     e63:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     e69:	c7 80 60 24 00 00 00 	movl   $0x0,0x2460(%eax)
+     e70:	00 00 00 
+  return _close(fd);
+     e73:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     e76:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e79:	5b                   	pop    %ebx
+     e7a:	5e                   	pop    %esi
+     e7b:	5d                   	pop    %ebp
+  return _close(fd);
+     e7c:	e9 83 03 00 00       	jmp    1204 <_close>
+     e81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     e88:	83 ec 04             	sub    $0x4,%esp
+     e8b:	05 68 24 00 00       	add    $0x2468,%eax
+     e90:	52                   	push   %edx
+     e91:	50                   	push   %eax
+     e92:	53                   	push   %ebx
+     e93:	e8 65 03 00 00       	call   11fd <write>
+    ob[fd].n = 0;
+     e98:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+     e9f:	83 c4 10             	add    $0x10,%esp
+     ea2:	eb bf                	jmp    e63 <close+0x23>
+     ea4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     eaf:	90                   	nop
+
+00000eb0 <strcpy>:
+{
+     eb0:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+     eb1:	31 c0                	xor    %eax,%eax
+{
+     eb3:	89 e5                	mov    %esp,%ebp
+     eb5:	53                   	push   %ebx
+     eb6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     eb9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     ebc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     ec0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     ec4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     ec7:	83 c0 01             	add    $0x1,%eax
+     eca:	84 d2                	test   %dl,%dl
+     ecc:	75 f2                	jne    ec0 <strcpy+0x10>
+}
+     ece:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ed1:	89 c8                	mov    %ecx,%eax
+     ed3:	c9                   	leave
+     ed4:	c3                   	ret
+     ed5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     edc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ee0 <strcmp>:
+{
+     ee0:	55                   	push   %ebp
+     ee1:	89 e5                	mov    %esp,%ebp
+     ee3:	53                   	push   %ebx
+     ee4:	8b 55 08             	mov    0x8(%ebp),%edx
+     ee7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     eea:	0f b6 02             	movzbl (%edx),%eax
+     eed:	84 c0                	test   %al,%al
+     eef:	75 17                	jne    f08 <strcmp+0x28>
+     ef1:	eb 3a                	jmp    f2d <strcmp+0x4d>
+     ef3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ef7:	90                   	nop
+     ef8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     efc:	83 c2 01             	add    $0x1,%edx
+     eff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     f02:	84 c0                	test   %al,%al
+     f04:	74 1a                	je     f20 <strcmp+0x40>
+    p++, q++;
+     f06:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     f08:	0f b6 19             	movzbl (%ecx),%ebx
+     f0b:	38 c3                	cmp    %al,%bl
+     f0d:	74 e9                	je     ef8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     f0f:	29 d8                	sub    %ebx,%eax
+}
+     f11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f14:	c9                   	leave
+     f15:	c3                   	ret
+     f16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f1d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     f20:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     f24:	31 c0                	xor    %eax,%eax
+     f26:	29 d8                	sub    %ebx,%eax
+}
+     f28:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f2b:	c9                   	leave
+     f2c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     f2d:	0f b6 19             	movzbl (%ecx),%ebx
+     f30:	31 c0                	xor    %eax,%eax
+     f32:	eb db                	jmp    f0f <strcmp+0x2f>
+     f34:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f3f:	90                   	nop
+
+00000f40 <strlen>:
+{
+     f40:	55                   	push   %ebp
+     f41:	89 e5                	mov    %esp,%ebp
+     f43:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+     f46:	80 3a 00             	cmpb   $0x0,(%edx)
+     f49:	74 15                	je     f60 <strlen+0x20>
+     f4b:	31 c0                	xor    %eax,%eax
+     f4d:	8d 76 00             	lea    0x0(%esi),%esi
+     f50:	83 c0 01             	add    $0x1,%eax
+     f53:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     f57:	89 c1                	mov    %eax,%ecx
+     f59:	75 f5                	jne    f50 <strlen+0x10>
+}
+     f5b:	89 c8                	mov    %ecx,%eax
+     f5d:	5d                   	pop    %ebp
+     f5e:	c3                   	ret
+     f5f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     f60:	31 c9                	xor    %ecx,%ecx
+}
+     f62:	5d                   	pop    %ebp
+     f63:	89 c8                	mov    %ecx,%eax
+     f65:	c3                   	ret
+     f66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f70 <memset>:
+{
+     f70:	55                   	push   %ebp
+     f71:	89 e5                	mov    %esp,%ebp
+     f73:	57                   	push   %edi
+     f74:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("cld; rep stosb" :
+     f77:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     f7a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     f7d:	89 d7                	mov    %edx,%edi
+     f7f:	fc                   	cld
+     f80:	f3 aa                	rep stos %al,%es:(%edi)
+}
+     f82:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     f85:	89 d0                	mov    %edx,%eax
+     f87:	c9                   	leave
+     f88:	c3                   	ret
+     f89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000f90 <strchr>:
+{
+     f90:	55                   	push   %ebp
+     f91:	89 e5                	mov    %esp,%ebp
+     f93:	8b 45 08             	mov    0x8(%ebp),%eax
+     f96:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     f9a:	0f b6 10             	movzbl (%eax),%edx
+     f9d:	84 d2                	test   %dl,%dl
+     f9f:	75 12                	jne    fb3 <strchr+0x23>
+     fa1:	eb 1d                	jmp    fc0 <strchr+0x30>
+     fa3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     fa7:	90                   	nop
+     fa8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     fac:	83 c0 01             	add    $0x1,%eax
+     faf:	84 d2                	test   %dl,%dl
+     fb1:	74 0d                	je     fc0 <strchr+0x30>
+    if(*s == c)
+     fb3:	38 d1                	cmp    %dl,%cl
+     fb5:	75 f1                	jne    fa8 <strchr+0x18>
+}
+     fb7:	5d                   	pop    %ebp
+     fb8:	c3                   	ret
+     fb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     fc0:	31 c0                	xor    %eax,%eax
+}
+     fc2:	5d                   	pop    %ebp
+     fc3:	c3                   	ret
+     fc4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fcb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     fcf:	90                   	nop
+
+00000fd0 <memchr>:
+{
+     fd0:	55                   	push   %ebp
+     fd1:	89 e5                	mov    %esp,%ebp
+     fd3:	8b 55 10             	mov    0x10(%ebp),%edx
+     fd6:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     fd9:	85 d2                	test   %edx,%edx
+     fdb:	74 1b                	je     ff8 <memchr+0x28>
+    if(*p == (char)c)
+     fdd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+     fe1:	01 c2                	add    %eax,%edx
+     fe3:	eb 0a                	jmp    fef <memchr+0x1f>
+     fe5:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+     fe8:	83 c0 01             	add    $0x1,%eax
+     feb:	39 c2                	cmp    %eax,%edx
+     fed:	74 09                	je     ff8 <memchr+0x28>
+    if(*p == (char)c)
+     fef:	38 08                	cmp    %cl,(%eax)
+     ff1:	75 f5                	jne    fe8 <memchr+0x18>
+}
+     ff3:	5d                   	pop    %ebp
+     ff4:	c3                   	ret
+     ff5:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+     ff8:	31 c0                	xor    %eax,%eax
+}
+     ffa:	5d                   	pop    %ebp
+     ffb:	c3                   	ret
+     ffc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001000 <gets>:
+{
+    1000:	55                   	push   %ebp
+    1001:	89 e5                	mov    %esp,%ebp
+    1003:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+    1004:	31 ff                	xor    %edi,%edi
+{
+    1006:	56                   	push   %esi
+    1007:	be 68 24 00 00       	mov    $0x2468,%esi
+    100c:	53                   	push   %ebx
+    100d:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+    1010:	8b 46 fc             	mov    -0x4(%esi),%eax
+    1013:	85 c0                	test   %eax,%eax
+    1015:	7e 15                	jle    102c <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+    1017:	83 ec 04             	sub    $0x4,%esp
+    101a:	50                   	push   %eax
+    101b:	56                   	push   %esi
+    101c:	57                   	push   %edi
+    101d:	e8 db 01 00 00       	call   11fd <write>
+    ob[fd].n = 0;
+    1022:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+    1029:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+    102c:	83 c7 01             	add    $0x1,%edi
+    102f:	81 c6 08 01 00 00    	add    $0x108,%esi
+    1035:	83 ff 10             	cmp    $0x10,%edi
+    1038:	75 d6                	jne    1010 <gets+0x10>
+  for(i=0; i+1 < max; ){
+    103a:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+    103c:	8d 75 e7             	lea    -0x19(%ebp),%esi
+    103f:	eb 2e                	jmp    106f <gets+0x6f>
+    1041:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1048:	83 ec 04             	sub    $0x4,%esp
+    104b:	6a 01                	push   $0x1
+    104d:	56                   	push   %esi
+    104e:	6a 00                	push   $0x0
+    1050:	e8 a1 01 00 00       	call   11f6 <read>
+    if(cc < 1)
+    1055:	83 c4 10             	add    $0x10,%esp
+    1058:	85 c0                	test   %eax,%eax
+    105a:	7e 1d                	jle    1079 <gets+0x79>
+    buf[i++] = c;
+    105c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1060:	8b 55 08             	mov    0x8(%ebp),%edx
+    1063:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    1067:	3c 0a                	cmp    $0xa,%al
+    1069:	74 10                	je     107b <gets+0x7b>
+    106b:	3c 0d                	cmp    $0xd,%al
+    106d:	74 0c                	je     107b <gets+0x7b>
+  for(i=0; i+1 < max; ){
+    106f:	89 df                	mov    %ebx,%edi
+    1071:	83 c3 01             	add    $0x1,%ebx
+    1074:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    1077:	7c cf                	jl     1048 <gets+0x48>
+    1079:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+    107b:	8b 45 08             	mov    0x8(%ebp),%eax
+    107e:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+    1082:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1085:	5b                   	pop    %ebx
+    1086:	5e                   	pop    %esi
+    1087:	5f                   	pop    %edi
+    1088:	5d                   	pop    %ebp
+    1089:	c3                   	ret
+    108a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001090 <stat>:
+{
+    1090:	55                   	push   %ebp
+    1091:	89 e5                	mov    %esp,%ebp
+    1093:	57                   	push   %edi
+    1094:	56                   	push   %esi
+    1095:	53                   	push   %ebx
+    1096:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+    1099:	6a 00                	push   $0x0
+    109b:	ff 75 08             	push   0x8(%ebp)
+    109e:	e8 76 01 00 00       	call   1219 <open>
+  if(fd < 0)
+    10a3:	83 c4 10             	add    $0x10,%esp
+    10a6:	85 c0                	test   %eax,%eax
+    10a8:	78 76                	js     1120 <stat+0x90>
+  r = fstat(fd, st);
+    10aa:	83 ec 08             	sub    $0x8,%esp
+    10ad:	ff 75 0c             	push   0xc(%ebp)
+    10b0:	89 c3                	mov    %eax,%ebx
+    10b2:	50                   	push   %eax
+    10b3:	e8 7f 01 00 00       	call   1237 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+    10b8:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+    10bb:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+    10bd:	83 fb 0f             	cmp    $0xf,%ebx
+    10c0:	7f 40                	jg     1102 <stat+0x72>
+    10c2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+    10c8:	8b 90 64 24 00 00    	mov    0x2464(%eax),%edx
+    10ce:	8d b8 60 24 00 00    	lea    0x2460(%eax),%edi
+    10d4:	85 d2                	test   %edx,%edx
+    10d6:	7e 1a                	jle    10f2 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+    10d8:	83 ec 04             	sub    $0x4,%esp
+    10db:	05 68 24 00 00       	add    $0x2468,%eax
+    10e0:	52                   	push   %edx
+    10e1:	50                   	push   %eax
+    10e2:	53                   	push   %ebx
+    10e3:	e8 15 01 00 00       	call   11fd <write>
+    ob[fd].n = 0;
+    10e8:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+    10ef:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+    10f2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+    10f8:	c7 80 60 24 00 00 00 	movl   $0x0,0x2460(%eax)
+    10ff:	00 00 00 
+  return _close(fd);
+    1102:	83 ec 0c             	sub    $0xc,%esp
+    1105:	53                   	push   %ebx
+    1106:	e8 f9 00 00 00       	call   1204 <_close>
+    110b:	83 c4 10             	add    $0x10,%esp
+}
+    110e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1111:	89 f0                	mov    %esi,%eax
+    1113:	5b                   	pop    %ebx
+    1114:	5e                   	pop    %esi
+    1115:	5f                   	pop    %edi
+    1116:	5d                   	pop    %ebp
+    1117:	c3                   	ret
+    1118:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    111f:	90                   	nop
+    return -1;
+    1120:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1125:	eb e7                	jmp    110e <stat+0x7e>
+    1127:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    112e:	66 90                	xchg   %ax,%ax
+
+00001130 <atoi>:
+{
+    1130:	55                   	push   %ebp
+    1131:	89 e5                	mov    %esp,%ebp
+    1133:	53                   	push   %ebx
+    1134:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+    1137:	0f be 02             	movsbl (%edx),%eax
+    113a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    113d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1140:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1145:	77 1e                	ja     1165 <atoi+0x35>
+    1147:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    114e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1150:	83 c2 01             	add    $0x1,%edx
+    1153:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1156:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    115a:	0f be 02             	movsbl (%edx),%eax
+    115d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1160:	80 fb 09             	cmp    $0x9,%bl
+    1163:	76 eb                	jbe    1150 <atoi+0x20>
+}
+    1165:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1168:	89 c8                	mov    %ecx,%eax
+    116a:	c9                   	leave
+    116b:	c3                   	ret
+    116c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001170 <memmove>:
+{
+    1170:	55                   	push   %ebp
+    1171:	89 e5                	mov    %esp,%ebp
+    1173:	57                   	push   %edi
+    1174:	56                   	push   %esi
+    1175:	8b 45 10             	mov    0x10(%ebp),%eax
+    1178:	8b 55 08             	mov    0x8(%ebp),%edx
+    117b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+    117e:	85 c0                	test   %eax,%eax
+    1180:	7e 13                	jle    1195 <memmove+0x25>
+    1182:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1184:	89 d7                	mov    %edx,%edi
+    1186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    118d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1190:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1191:	39 f8                	cmp    %edi,%eax
+    1193:	75 fb                	jne    1190 <memmove+0x20>
+  return vdst;
+}
+    1195:	5e                   	pop    %esi
+    1196:	89 d0                	mov    %edx,%eax
+    1198:	5f                   	pop    %edi
+    1199:	5d                   	pop    %ebp
+    119a:	c3                   	ret
+
+0000119b <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+    119b:	83 3d 58 24 00 00 00 	cmpl   $0x0,0x2458
+  jle 1f
+    11a2:	7e 0a                	jle    11ae <syscallentry+0x13>
+  movl %esp, %ecx
+    11a4:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+    11a6:	ba ad 11 00 00       	mov    $0x11ad,%edx
+  sysenter
+    11ab:	0f 34                	sysenter
+2:
+  ret
+    11ad:	c3                   	ret
+1:
+  jl 3f
+    11ae:	7c 27                	jl     11d7 <syscallentry+0x3c>
+  pushal
+    11b0:	60                   	pusha
+  movl $1, %eax
+    11b1:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+    11b6:	0f a2                	cpuid
+  movl $-1, sysentermode
+    11b8:	c7 05 58 24 00 00 ff 	movl   $0xffffffff,0x2458
+    11bf:	ff ff ff 
+  testl $CPUID_SEP, %edx
+    11c2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+    11c8:	74 0a                	je     11d4 <syscallentry+0x39>
+  movl $1, sysentermode
+    11ca:	c7 05 58 24 00 00 01 	movl   $0x1,0x2458
+    11d1:	00 00 00 
+4:
+  popal
+    11d4:	61                   	popa
+  jmp syscallentry
+    11d5:	eb c4                	jmp    119b <syscallentry>
+3:
+  int $T_SYSCALL
+    11d7:	cd 40                	int    $0x40
+  ret
+    11d9:	c3                   	ret
+
+000011da <_fork>:
+
+SYSCALLAS(_fork, fork)
+    11da:	b8 01 00 00 00       	mov    $0x1,%eax
+    11df:	eb ba                	jmp    119b <syscallentry>
+
+000011e1 <_exit>:
+SYSCALLAS(_exit, exit)
+    11e1:	b8 02 00 00 00       	mov    $0x2,%eax
+    11e6:	eb b3                	jmp    119b <syscallentry>
+
+000011e8 <wait>:
+SYSCALL(wait)
+    11e8:	b8 03 00 00 00       	mov    $0x3,%eax
+    11ed:	eb ac                	jmp    119b <syscallentry>
+
+000011ef <pipe>:
+SYSCALL(pipe)
+    11ef:	b8 04 00 00 00       	mov    $0x4,%eax
+    11f4:	eb a5                	jmp    119b <syscallentry>
+
+000011f6 <read>:
+SYSCALL(read)
+    11f6:	b8 05 00 00 00       	mov    $0x5,%eax
+    11fb:	eb 9e                	jmp    119b <syscallentry>
+
+000011fd <write>:
+SYSCALL(write)
+    11fd:	b8 10 00 00 00       	mov    $0x10,%eax
+    1202:	eb 97                	jmp    119b <syscallentry>
+
+00001204 <_close>:
+SYSCALLAS(_close, close)
+    1204:	b8 15 00 00 00       	mov    $0x15,%eax
+    1209:	eb 90                	jmp    119b <syscallentry>
+
+0000120b <kill>:
+SYSCALL(kill)
+    120b:	b8 06 00 00 00       	mov    $0x6,%eax
+    1210:	eb 89                	jmp    119b <syscallentry>
+
+00001212 <_exec>:
+SYSCALLAS(_exec, exec)
+    1212:	b8 07 00 00 00       	mov    $0x7,%eax
+    1217:	eb 82                	jmp    119b <syscallentry>
+
+00001219 <open>:
+SYSCALL(open)
+    1219:	b8 0f 00 00 00       	mov    $0xf,%eax
+    121e:	e9 78 ff ff ff       	jmp    119b <syscallentry>
+
+00001223 <mknod>:
+SYSCALL(mknod)
+    1223:	b8 11 00 00 00       	mov    $0x11,%eax
+    1228:	e9 6e ff ff ff       	jmp    119b <syscallentry>
+
+0000122d <unlink>:
+SYSCALL(unlink)
+    122d:	b8 12 00 00 00       	mov    $0x12,%eax
+    1232:	e9 64 ff ff ff       	jmp    119b <syscallentry>
+
+00001237 <fstat>:
+SYSCALL(fstat)
+    1237:	b8 08 00 00 00       	mov    $0x8,%eax
+    123c:	e9 5a ff ff ff       	jmp    119b <syscallentry>
+
+00001241 <link>:
+SYSCALL(link)
+    1241:	b8 13 00 00 00       	mov    $0x13,%eax
+    1246:	e9 50 ff ff ff       	jmp    119b <syscallentry>
+
+0000124b <mkdir>:
+SYSCALL(mkdir)
+    124b:	b8 14 00 00 00       	mov    $0x14,%eax
+    1250:	e9 46 ff ff ff       	jmp    119b <syscallentry>
+
+00001255 <chdir>:
+SYSCALL(chdir)
+    1255:	b8 09 00 00 00       	mov    $0x9,%eax
+    125a:	e9 3c ff ff ff       	jmp    119b <syscallentry>
+
+0000125f <dup>:
+SYSCALL(dup)
+    125f:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1264:	e9 32 ff ff ff       	jmp    119b <syscallentry>
+
+00001269 <getpid>:
+SYSCALL(getpid)
+    1269:	b8 0b 00 00 00       	mov    $0xb,%eax
+    126e:	e9 28 ff ff ff       	jmp    119b <syscallentry>
+
+00001273 <sbrk>:
+SYSCALL(sbrk)
+    1273:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1278:	e9 1e ff ff ff       	jmp    119b <syscallentry>
+
+0000127d <sleep>:
+SYSCALL(sleep)
+    127d:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1282:	e9 14 ff ff ff       	jmp    119b <syscallentry>
+
+00001287 <uptime>:
+SYSCALL(uptime)
+    1287:	b8 0e 00 00 00       	mov    $0xe,%eax
+    128c:	e9 0a ff ff ff       	jmp    119b <syscallentry>
+
+00001291 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+    1291:	b8 16 00 00 00       	mov    $0x16,%eax
+    1296:	e9 00 ff ff ff       	jmp    119b <syscallentry>
+
+0000129b <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+    129b:	b8 17 00 00 00       	mov    $0x17,%eax
+    12a0:	e9 f6 fe ff ff       	jmp    119b <syscallentry>
+
+000012a5 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+    12a5:	b8 18 00 00 00       	mov    $0x18,%eax
+    12aa:	e9 ec fe ff ff       	jmp    119b <syscallentry>
+
+000012af <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+    12af:	b8 19 00 00 00       	mov    $0x19,%eax
+    12b4:	e9 e2 fe ff ff       	jmp    119b <syscallentry>
+
+000012b9 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+    12b9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    12be:	e9 d8 fe ff ff       	jmp    119b <syscallentry>
+
+000012c3 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+    12c3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    12c8:	e9 ce fe ff ff       	jmp    119b <syscallentry>
+
+000012cd <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+    12cd:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    12d2:	e9 c4 fe ff ff       	jmp    119b <syscallentry>
+
+000012d7 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+    12d7:	b8 20 00 00 00       	mov    $0x20,%eax
+    12dc:	e9 ba fe ff ff       	jmp    119b <syscallentry>
+
+000012e1 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+    12e1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    12e6:	e9 b0 fe ff ff       	jmp    119b <syscallentry>
+
+000012eb <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+    12eb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    12f0:	e9 a6 fe ff ff       	jmp    119b <syscallentry>
+
+000012f5 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+    12f5:	b8 21 00 00 00       	mov    $0x21,%eax
+    12fa:	e9 9c fe ff ff       	jmp    119b <syscallentry>
+
+000012ff <yield>:
+SYSCALL(yield) // yield the CPU to another process
+    12ff:	b8 22 00 00 00       	mov    $0x22,%eax
+    1304:	e9 92 fe ff ff       	jmp    119b <syscallentry>
+
+00001309 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+    1309:	b8 23 00 00 00       	mov    $0x23,%eax
+    130e:	e9 88 fe ff ff       	jmp    119b <syscallentry>
+
+00001313 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+    1313:	b8 24 00 00 00       	mov    $0x24,%eax
+    1318:	e9 7e fe ff ff       	jmp    119b <syscallentry>
+
+0000131d <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+    131d:	b8 25 00 00 00       	mov    $0x25,%eax
+    1322:	e9 74 fe ff ff       	jmp    119b <syscallentry>
+
+00001327 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+    1327:	b8 26 00 00 00       	mov    $0x26,%eax
+    132c:	e9 6a fe ff ff       	jmp    119b <syscallentry>
+
+00001331 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+    1331:	b8 27 00 00 00       	mov    $0x27,%eax
+    1336:	e9 60 fe ff ff       	jmp    119b <syscallentry>
+
+0000133b <mmap>:
+SYSCALL(mmap) // map a file into memory
+    133b:	b8 28 00 00 00       	mov    $0x28,%eax
+    1340:	e9 56 fe ff ff       	jmp    119b <syscallentry>
+
+00001345 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+    1345:	b8 29 00 00 00       	mov    $0x29,%eax
+    134a:	e9 4c fe ff ff       	jmp    119b <syscallentry>
+
+0000134f <readv>:
+SYSCALL(readv) // read into several buffers
+    134f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1354:	e9 42 fe ff ff       	jmp    119b <syscallentry>
+
+00001359 <writev>:
+SYSCALL(writev) // write from several buffers
+    1359:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    135e:	e9 38 fe ff ff       	jmp    119b <syscallentry>
+
+00001363 <pread>:
+SYSCALL(pread) // read at an offset
+    1363:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    1368:	e9 2e fe ff ff       	jmp    119b <syscallentry>
+
+0000136d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+    136d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    1372:	e9 24 fe ff ff       	jmp    119b <syscallentry>
+
+00001377 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+    1377:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    137c:	e9 1a fe ff ff       	jmp    119b <syscallentry>
+
+00001381 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+    1381:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    1386:	e9 10 fe ff ff       	jmp    119b <syscallentry>
+
+0000138b <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+    138b:	b8 30 00 00 00       	mov    $0x30,%eax
+    1390:	e9 06 fe ff ff       	jmp    119b <syscallentry>
+
+00001395 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+    1395:	b8 31 00 00 00       	mov    $0x31,%eax
+    139a:	e9 fc fd ff ff       	jmp    119b <syscallentry>
+
+0000139f <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+    139f:	b8 32 00 00 00       	mov    $0x32,%eax
+    13a4:	e9 f2 fd ff ff       	jmp    119b <syscallentry>
+
+000013a9 <profread>:
+SYSCALL(profread) // drain profiler samples
+    13a9:	b8 33 00 00 00       	mov    $0x33,%eax
+    13ae:	e9 e8 fd ff ff       	jmp    119b <syscallentry>
+
+000013b3 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+    13b3:	b8 34 00 00 00       	mov    $0x34,%eax
+    13b8:	e9 de fd ff ff       	jmp    119b <syscallentry>
+
+000013bd <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+    13bd:	b8 35 00 00 00       	mov    $0x35,%eax
+    13c2:	e9 d4 fd ff ff       	jmp    119b <syscallentry>
+
+000013c7 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+    13c7:	b8 36 00 00 00       	mov    $0x36,%eax
+    13cc:	e9 ca fd ff ff       	jmp    119b <syscallentry>
+
+000013d1 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+    13d1:	b8 37 00 00 00       	mov    $0x37,%eax
+    13d6:	e9 c0 fd ff ff       	jmp    119b <syscallentry>
+    13db:	66 90                	xchg   %ax,%ax
+    13dd:	66 90                	xchg   %ax,%ax
+    13df:	90                   	nop
+
+000013e0 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    13e0:	55                   	push   %ebp
+    13e1:	89 e5                	mov    %esp,%ebp
+    13e3:	57                   	push   %edi
+    13e4:	56                   	push   %esi
+    13e5:	53                   	push   %ebx
+    13e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    13e8:	89 d1                	mov    %edx,%ecx
+{
+    13ea:	83 ec 3c             	sub    $0x3c,%esp
+    13ed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    13f0:	85 d2                	test   %edx,%edx
+    13f2:	0f 89 80 00 00 00    	jns    1478 <printint+0x98>
+    13f8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    13fc:	74 7a                	je     1478 <printint+0x98>
+    x = -xx;
+    13fe:	f7 d9                	neg    %ecx
+    neg = 1;
+    1400:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1405:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1408:	31 f6                	xor    %esi,%esi
+    140a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1410:	89 c8                	mov    %ecx,%eax
+    1412:	31 d2                	xor    %edx,%edx
+    1414:	89 f7                	mov    %esi,%edi
+    1416:	f7 f3                	div    %ebx
+    1418:	8d 76 01             	lea    0x1(%esi),%esi
+    141b:	0f b6 92 e8 1e 00 00 	movzbl 0x1ee8(%edx),%edx
+    1422:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1426:	89 ca                	mov    %ecx,%edx
+    1428:	89 c1                	mov    %eax,%ecx
+    142a:	39 da                	cmp    %ebx,%edx
+    142c:	73 e2                	jae    1410 <printint+0x30>
+  if(neg)
+    142e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1431:	85 c0                	test   %eax,%eax
+    1433:	74 07                	je     143c <printint+0x5c>
+    buf[i++] = '-';
+    1435:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    143a:	89 f7                	mov    %esi,%edi
+    143c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    143f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1442:	01 df                	add    %ebx,%edi
+    1444:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1448:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+    144b:	83 ec 04             	sub    $0x4,%esp
+    144e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1451:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1454:	6a 01                	push   $0x1
+    1456:	50                   	push   %eax
+    1457:	56                   	push   %esi
+    1458:	e8 e3 f6 ff ff       	call   b40 <bufwrite>
+  while(--i >= 0)
+    145d:	89 f8                	mov    %edi,%eax
+    145f:	83 c4 10             	add    $0x10,%esp
+    1462:	83 ef 01             	sub    $0x1,%edi
+    1465:	39 d8                	cmp    %ebx,%eax
+    1467:	75 df                	jne    1448 <printint+0x68>
+}
+    1469:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    146c:	5b                   	pop    %ebx
+    146d:	5e                   	pop    %esi
+    146e:	5f                   	pop    %edi
+    146f:	5d                   	pop    %ebp
+    1470:	c3                   	ret
+    1471:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1478:	31 c0                	xor    %eax,%eax
+    147a:	eb 89                	jmp    1405 <printint+0x25>
+    147c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001480 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1480:	55                   	push   %ebp
+    1481:	89 e5                	mov    %esp,%ebp
+    1483:	57                   	push   %edi
+    1484:	56                   	push   %esi
+    1485:	53                   	push   %ebx
+    1486:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1489:	8b 45 0c             	mov    0xc(%ebp),%eax
+    148c:	0f b6 18             	movzbl (%eax),%ebx
+    148f:	84 db                	test   %bl,%bl
+    1491:	74 6c                	je     14ff <printf+0x7f>
+    1493:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+    1496:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+    1499:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+    149b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    149e:	eb 26                	jmp    14c6 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    14a0:	83 f8 25             	cmp    $0x25,%eax
+    14a3:	74 4b                	je     14f0 <printf+0x70>
+  bufwrite(fd, &c, 1);
+    14a5:	83 ec 04             	sub    $0x4,%esp
+    14a8:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    14ab:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+    14ae:	6a 01                	push   $0x1
+    14b0:	50                   	push   %eax
+    14b1:	ff 75 08             	push   0x8(%ebp)
+    14b4:	e8 87 f6 ff ff       	call   b40 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+    14b9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    14bc:	0f b6 1f             	movzbl (%edi),%ebx
+    14bf:	83 c7 01             	add    $0x1,%edi
+    14c2:	84 db                	test   %bl,%bl
+    14c4:	74 39                	je     14ff <printf+0x7f>
+    c = fmt[i] & 0xff;
+    14c6:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    14c9:	85 f6                	test   %esi,%esi
+    14cb:	74 d3                	je     14a0 <printf+0x20>
+      }
+    } else if(state == '%'){
+    14cd:	83 fe 25             	cmp    $0x25,%esi
+    14d0:	75 ea                	jne    14bc <printf+0x3c>
+      if(c == 'd'){
+    14d2:	83 f8 25             	cmp    $0x25,%eax
+    14d5:	0f 84 d5 01 00 00    	je     16b0 <printf+0x230>
+    14db:	83 e8 63             	sub    $0x63,%eax
+    14de:	83 f8 15             	cmp    $0x15,%eax
+    14e1:	77 45                	ja     1528 <printf+0xa8>
+    14e3:	ff 24 85 90 1e 00 00 	jmp    *0x1e90(,%eax,4)
+    14ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+    14f0:	0f b6 1f             	movzbl (%edi),%ebx
+    14f3:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+    14f6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    14fb:	84 db                	test   %bl,%bl
+    14fd:	75 c7                	jne    14c6 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+    14ff:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+    1503:	74 0b                	je     1510 <printf+0x90>
+    fflush(fd);
+}
+    1505:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1508:	5b                   	pop    %ebx
+    1509:	5e                   	pop    %esi
+    150a:	5f                   	pop    %edi
+    150b:	5d                   	pop    %ebp
+    150c:	c3                   	ret
+    150d:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+    1510:	83 ec 0c             	sub    $0xc,%esp
+    1513:	6a 02                	push   $0x2
+    1515:	e8 c6 f7 ff ff       	call   ce0 <fflush>
+    151a:	83 c4 10             	add    $0x10,%esp
+}
+    151d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1520:	5b                   	pop    %ebx
+    1521:	5e                   	pop    %esi
+    1522:	5f                   	pop    %edi
+    1523:	5d                   	pop    %ebp
+    1524:	c3                   	ret
+    1525:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+    1528:	83 ec 04             	sub    $0x4,%esp
+    152b:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+    152e:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+    1532:	6a 01                	push   $0x1
+    1534:	52                   	push   %edx
+    1535:	89 55 c0             	mov    %edx,-0x40(%ebp)
+    1538:	ff 75 08             	push   0x8(%ebp)
+    153b:	e8 00 f6 ff ff       	call   b40 <bufwrite>
+    1540:	83 c4 0c             	add    $0xc,%esp
+    1543:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+    1546:	6a 01                	push   $0x1
+    1548:	8b 55 c0             	mov    -0x40(%ebp),%edx
+    154b:	52                   	push   %edx
+      state = 0;
+    154c:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+    154e:	ff 75 08             	push   0x8(%ebp)
+    1551:	e8 ea f5 ff ff       	call   b40 <bufwrite>
+        putc(fd, c);
+    1556:	83 c4 10             	add    $0x10,%esp
+    1559:	e9 5e ff ff ff       	jmp    14bc <printf+0x3c>
+    155e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+    1560:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+    1563:	83 ec 0c             	sub    $0xc,%esp
+    1566:	b9 10 00 00 00       	mov    $0x10,%ecx
+    156b:	8b 16                	mov    (%esi),%edx
+    156d:	6a 00                	push   $0x0
+    156f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+    1572:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+    1575:	e8 66 fe ff ff       	call   13e0 <printint>
+        ap++;
+    157a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+    157d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1580:	31 f6                	xor    %esi,%esi
+    1582:	e9 35 ff ff ff       	jmp    14bc <printf+0x3c>
+    1587:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    158e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+    1590:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1593:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1595:	83 c0 04             	add    $0x4,%eax
+    1598:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+    159b:	b8 86 1e 00 00       	mov    $0x1e86,%eax
+    15a0:	85 db                	test   %ebx,%ebx
+    15a2:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+    15a5:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+    15a8:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+    15aa:	53                   	push   %ebx
+    15ab:	e8 90 f9 ff ff       	call   f40 <strlen>
+    15b0:	83 c4 0c             	add    $0xc,%esp
+    15b3:	50                   	push   %eax
+    15b4:	53                   	push   %ebx
+    15b5:	ff 75 08             	push   0x8(%ebp)
+    15b8:	e8 83 f5 ff ff       	call   b40 <bufwrite>
+    15bd:	83 c4 10             	add    $0x10,%esp
+    15c0:	e9 f7 fe ff ff       	jmp    14bc <printf+0x3c>
+    15c5:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+    15c8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+    15cb:	83 ec 04             	sub    $0x4,%esp
+    15ce:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+    15d1:	8b 06                	mov    (%esi),%eax
+        ap++;
+    15d3:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+    15d6:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+    15d9:	6a 01                	push   $0x1
+    15db:	52                   	push   %edx
+    15dc:	ff 75 08             	push   0x8(%ebp)
+    15df:	e8 5c f5 ff ff       	call   b40 <bufwrite>
+        ap++;
+    15e4:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+    15e7:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    15ea:	31 f6                	xor    %esi,%esi
+    15ec:	e9 cb fe ff ff       	jmp    14bc <printf+0x3c>
+    15f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+    15f8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+    15fb:	83 ec 0c             	sub    $0xc,%esp
+    15fe:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    1603:	8b 16                	mov    (%esi),%edx
+    1605:	6a 01                	push   $0x1
+    1607:	e9 63 ff ff ff       	jmp    156f <printf+0xef>
+    160c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+    1610:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1613:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+    1616:	89 7d c0             	mov    %edi,-0x40(%ebp)
+    1619:	89 55 bc             	mov    %edx,-0x44(%ebp)
+    161c:	8b 18                	mov    (%eax),%ebx
+    161e:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+    1621:	31 c0                	xor    %eax,%eax
+    1623:	89 c7                	mov    %eax,%edi
+    1625:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+    1628:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+    162d:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+    162f:	f7 e1                	mul    %ecx
+    1631:	c1 ea 03             	shr    $0x3,%edx
+    1634:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    1637:	89 d1                	mov    %edx,%ecx
+    1639:	01 c0                	add    %eax,%eax
+    163b:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+    163d:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+    163f:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+    1641:	be 0a 00 00 00       	mov    $0xa,%esi
+    1646:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+    1648:	89 da                	mov    %ebx,%edx
+    164a:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+    164c:	89 fe                	mov    %edi,%esi
+    164e:	83 c7 01             	add    $0x1,%edi
+    1651:	8d 42 30             	lea    0x30(%edx),%eax
+    1654:	89 da                	mov    %ebx,%edx
+    1656:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    1659:	01 d2                	add    %edx,%edx
+    165b:	29 d0                	sub    %edx,%eax
+    165d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+    1661:	89 c8                	mov    %ecx,%eax
+    1663:	09 d8                	or     %ebx,%eax
+    1665:	75 c1                	jne    1628 <printf+0x1a8>
+    1667:	8b 55 bc             	mov    -0x44(%ebp),%edx
+    166a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    166d:	01 d6                	add    %edx,%esi
+    166f:	89 f7                	mov    %esi,%edi
+    1671:	89 d6                	mov    %edx,%esi
+    1673:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1677:	90                   	nop
+    putc(fd, buf[i]);
+    1678:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+    167b:	83 ec 04             	sub    $0x4,%esp
+    167e:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+    1681:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+    1684:	6a 01                	push   $0x1
+    1686:	50                   	push   %eax
+    1687:	53                   	push   %ebx
+    1688:	e8 b3 f4 ff ff       	call   b40 <bufwrite>
+  while(--i >= 0)
+    168d:	89 fa                	mov    %edi,%edx
+    168f:	83 c4 10             	add    $0x10,%esp
+    1692:	83 ef 01             	sub    $0x1,%edi
+    1695:	39 d6                	cmp    %edx,%esi
+    1697:	75 df                	jne    1678 <printf+0x1f8>
+        ap += 2;
+    1699:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+    169d:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+    16a0:	31 f6                	xor    %esi,%esi
+    16a2:	e9 15 fe ff ff       	jmp    14bc <printf+0x3c>
+    16a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16ae:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+    16b0:	83 ec 04             	sub    $0x4,%esp
+    16b3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+    16b6:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+    16b9:	6a 01                	push   $0x1
+    16bb:	e9 8b fe ff ff       	jmp    154b <printf+0xcb>
+
+000016c0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    16c0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    16c1:	a1 e0 34 00 00       	mov    0x34e0,%eax
+{
+    16c6:	89 e5                	mov    %esp,%ebp
+    16c8:	57                   	push   %edi
+    16c9:	56                   	push   %esi
+    16ca:	53                   	push   %ebx
+    16cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    16ce:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    16d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16d8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    16da:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    16dc:	39 ca                	cmp    %ecx,%edx
+    16de:	73 30                	jae    1710 <free+0x50>
+    16e0:	39 c1                	cmp    %eax,%ecx
+    16e2:	72 04                	jb     16e8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    16e4:	39 c2                	cmp    %eax,%edx
+    16e6:	72 f0                	jb     16d8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    16e8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    16eb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    16ee:	39 f8                	cmp    %edi,%eax
+    16f0:	74 2e                	je     1720 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    16f2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    16f5:	8b 42 04             	mov    0x4(%edx),%eax
+    16f8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    16fb:	39 f1                	cmp    %esi,%ecx
+    16fd:	74 38                	je     1737 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    16ff:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1701:	5b                   	pop    %ebx
+  freep = p;
+    1702:	89 15 e0 34 00 00    	mov    %edx,0x34e0
+}
+    1708:	5e                   	pop    %esi
+    1709:	5f                   	pop    %edi
+    170a:	5d                   	pop    %ebp
+    170b:	c3                   	ret
+    170c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1710:	39 c1                	cmp    %eax,%ecx
+    1712:	72 d0                	jb     16e4 <free+0x24>
+    1714:	eb c2                	jmp    16d8 <free+0x18>
+    1716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    171d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1720:	03 70 04             	add    0x4(%eax),%esi
+    1723:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1726:	8b 02                	mov    (%edx),%eax
+    1728:	8b 00                	mov    (%eax),%eax
+    172a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    172d:	8b 42 04             	mov    0x4(%edx),%eax
+    1730:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1733:	39 f1                	cmp    %esi,%ecx
+    1735:	75 c8                	jne    16ff <free+0x3f>
+    p->s.size += bp->s.size;
+    1737:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    173a:	89 15 e0 34 00 00    	mov    %edx,0x34e0
+    p->s.size += bp->s.size;
+    1740:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1743:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1746:	89 0a                	mov    %ecx,(%edx)
+}
+    1748:	5b                   	pop    %ebx
+    1749:	5e                   	pop    %esi
+    174a:	5f                   	pop    %edi
+    174b:	5d                   	pop    %ebp
+    174c:	c3                   	ret
+    174d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001750 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1750:	55                   	push   %ebp
+    1751:	89 e5                	mov    %esp,%ebp
+    1753:	57                   	push   %edi
+    1754:	56                   	push   %esi
+    1755:	53                   	push   %ebx
+    1756:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1759:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    175c:	8b 15 e0 34 00 00    	mov    0x34e0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1762:	8d 78 07             	lea    0x7(%eax),%edi
+    1765:	c1 ef 03             	shr    $0x3,%edi
+    1768:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    176b:	85 d2                	test   %edx,%edx
+    176d:	0f 84 8d 00 00 00    	je     1800 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1773:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1775:	8b 48 04             	mov    0x4(%eax),%ecx
+    1778:	39 f9                	cmp    %edi,%ecx
+    177a:	73 64                	jae    17e0 <malloc+0x90>
+  if(nu < 4096)
+    177c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1781:	39 df                	cmp    %ebx,%edi
+    1783:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1786:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    178d:	eb 0a                	jmp    1799 <malloc+0x49>
+    178f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1790:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1792:	8b 48 04             	mov    0x4(%eax),%ecx
+    1795:	39 f9                	cmp    %edi,%ecx
+    1797:	73 47                	jae    17e0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1799:	89 c2                	mov    %eax,%edx
+    179b:	39 05 e0 34 00 00    	cmp    %eax,0x34e0
+    17a1:	75 ed                	jne    1790 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    17a3:	83 ec 0c             	sub    $0xc,%esp
+    17a6:	56                   	push   %esi
+    17a7:	e8 c7 fa ff ff       	call   1273 <sbrk>
+  if(p == (char*)-1)
+    17ac:	83 c4 10             	add    $0x10,%esp
+    17af:	83 f8 ff             	cmp    $0xffffffff,%eax
+    17b2:	74 1c                	je     17d0 <malloc+0x80>
+  hp->s.size = nu;
+    17b4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    17b7:	83 ec 0c             	sub    $0xc,%esp
+    17ba:	83 c0 08             	add    $0x8,%eax
+    17bd:	50                   	push   %eax
+    17be:	e8 fd fe ff ff       	call   16c0 <free>
+  return freep;
+    17c3:	8b 15 e0 34 00 00    	mov    0x34e0,%edx
+      if((p = morecore(nunits)) == 0)
+    17c9:	83 c4 10             	add    $0x10,%esp
+    17cc:	85 d2                	test   %edx,%edx
+    17ce:	75 c0                	jne    1790 <malloc+0x40>
+        return 0;
+  }
+}
+    17d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    17d3:	31 c0                	xor    %eax,%eax
+}
+    17d5:	5b                   	pop    %ebx
+    17d6:	5e                   	pop    %esi
+    17d7:	5f                   	pop    %edi
+    17d8:	5d                   	pop    %ebp
+    17d9:	c3                   	ret
+    17da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    17e0:	39 cf                	cmp    %ecx,%edi
+    17e2:	74 4c                	je     1830 <malloc+0xe0>
+        p->s.size -= nunits;
+    17e4:	29 f9                	sub    %edi,%ecx
+    17e6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    17e9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    17ec:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    17ef:	89 15 e0 34 00 00    	mov    %edx,0x34e0
+}
+    17f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    17f8:	83 c0 08             	add    $0x8,%eax
+}
+    17fb:	5b                   	pop    %ebx
+    17fc:	5e                   	pop    %esi
+    17fd:	5f                   	pop    %edi
+    17fe:	5d                   	pop    %ebp
+    17ff:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1800:	c7 05 e0 34 00 00 e4 	movl   $0x34e4,0x34e0
+    1807:	34 00 00 
+    base.s.size = 0;
+    180a:	b8 e4 34 00 00       	mov    $0x34e4,%eax
+    base.s.ptr = freep = prevp = &base;
+    180f:	c7 05 e4 34 00 00 e4 	movl   $0x34e4,0x34e4
+    1816:	34 00 00 
+    base.s.size = 0;
+    1819:	c7 05 e8 34 00 00 00 	movl   $0x0,0x34e8
+    1820:	00 00 00 
+    if(p->s.size >= nunits){
+    1823:	e9 54 ff ff ff       	jmp    177c <malloc+0x2c>
+    1828:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    182f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1830:	8b 08                	mov    (%eax),%ecx
+    1832:	89 0a                	mov    %ecx,(%edx)
+    1834:	eb b9                	jmp    17ef <malloc+0x9f>
+    1836:	66 90                	xchg   %ax,%ax
+    1838:	66 90                	xchg   %ax,%ax
+    183a:	66 90                	xchg   %ax,%ax
+    183c:	66 90                	xchg   %ax,%ax
+    183e:	66 90                	xchg   %ax,%ax
+
+00001840 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+    1840:	55                   	push   %ebp
+    1841:	89 e5                	mov    %esp,%ebp
+    1843:	57                   	push   %edi
+    1844:	56                   	push   %esi
+    1845:	be 01 00 00 00       	mov    $0x1,%esi
+    184a:	53                   	push   %ebx
+    184b:	83 ec 28             	sub    $0x28,%esp
+    184e:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1851:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1854:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+    1857:	68 00 98 00 00       	push   $0x9800
+    185c:	e8 ef fe ff ff       	call   1750 <malloc>
+    1861:	83 c4 10             	add    $0x10,%esp
+    1864:	89 c7                	mov    %eax,%edi
+    1866:	85 c0                	test   %eax,%eax
+    1868:	74 62                	je     18cc <waitpoll+0x8c>
+    186a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+    1870:	83 ec 0c             	sub    $0xc,%esp
+    1873:	6a 01                	push   $0x1
+    1875:	e8 03 fa ff ff       	call   127d <sleep>
+    fn();
+    187a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    187d:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+    187f:	58                   	pop    %eax
+    1880:	5a                   	pop    %edx
+    1881:	68 00 02 00 00       	push   $0x200
+    1886:	57                   	push   %edi
+    1887:	e8 eb fa ff ff       	call   1377 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+    188c:	83 c4 10             	add    $0x10,%esp
+    188f:	85 c0                	test   %eax,%eax
+    1891:	7e 2d                	jle    18c0 <waitpoll+0x80>
+    1893:	6b c0 4c             	imul   $0x4c,%eax,%eax
+    1896:	89 fa                	mov    %edi,%edx
+    alive = 0;
+    1898:	31 c9                	xor    %ecx,%ecx
+    189a:	01 f8                	add    %edi,%eax
+    189c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+    18a0:	3b 1a                	cmp    (%edx),%ebx
+    18a2:	75 07                	jne    18ab <waitpoll+0x6b>
+        alive = 1;
+    18a4:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+    18a8:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+    18ab:	83 c2 4c             	add    $0x4c,%edx
+    18ae:	39 d0                	cmp    %edx,%eax
+    18b0:	75 ee                	jne    18a0 <waitpoll+0x60>
+  } while(alive);
+    18b2:	85 c9                	test   %ecx,%ecx
+    18b4:	75 ba                	jne    1870 <waitpoll+0x30>
+    18b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18bd:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+    18c0:	83 ec 0c             	sub    $0xc,%esp
+    18c3:	57                   	push   %edi
+    18c4:	e8 f7 fd ff ff       	call   16c0 <free>
+  wait();
+    18c9:	83 c4 10             	add    $0x10,%esp
+}
+    18cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    18cf:	5b                   	pop    %ebx
+    18d0:	5e                   	pop    %esi
+    18d1:	5f                   	pop    %edi
+    18d2:	5d                   	pop    %ebp
+  wait();
+    18d3:	e9 10 f9 ff ff       	jmp    11e8 <wait>
+    18d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18df:	90                   	nop
+
+000018e0 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+    18e0:	55                   	push   %ebp
+    18e1:	89 e5                	mov    %esp,%ebp
+    18e3:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+    18e6:	c7 45 f0 f9 1e 00 00 	movl   $0x1ef9,-0x10(%ebp)
+    18ed:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+    18f4:	e8 87 f4 ff ff       	call   d80 <fork>
+    18f9:	85 c0                	test   %eax,%eax
+    18fb:	78 09                	js     1906 <runps+0x26>
+    return -1;
+  if(pid == 0){
+    18fd:	74 0e                	je     190d <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+    18ff:	e8 e4 f8 ff ff       	call   11e8 <wait>
+}
+    1904:	c9                   	leave
+    1905:	c3                   	ret
+    1906:	c9                   	leave
+    return -1;
+    1907:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    190c:	c3                   	ret
+    exec("ps", argv);
+    190d:	50                   	push   %eax
+    190e:	50                   	push   %eax
+    190f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    1912:	50                   	push   %eax
+    1913:	68 f9 1e 00 00       	push   $0x1ef9
+    1918:	e8 c3 f4 ff ff       	call   de0 <exec>
+    printf(2, "exec ps failed\n");
+    191d:	5a                   	pop    %edx
+    191e:	59                   	pop    %ecx
+    191f:	68 fc 1e 00 00       	push   $0x1efc
+    1924:	6a 02                	push   $0x2
+    1926:	e8 55 fb ff ff       	call   1480 <printf>
+    exit();
+    192b:	e8 a0 f4 ff ff       	call   dd0 <exit>
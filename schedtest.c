@@ -2,17 +2,18 @@
 #include "stat.h"
 #include "user.h"
 #include "fcntl.h" // Already included, make sure it's there
+#include "x86.h"
 
 // Structure to store results for each scheduler
 typedef struct {
     char name[20];       // Scheduler name
     int policy;          // Scheduler policy number
     int completed;       // Completed children
-    int total_wtime;     // Total wait time
-    int total_rtime;     // Total run time
-    int avg_wtime;       // Average wait time
-    int avg_rtime;       // Average run time
-    int avg_turnaround;  // Average turnaround time
+    uint64 total_wtime;  // Total wait time, us
+    uint64 total_rtime;  // Total run time, us
+    uint64 avg_wtime;    // Average wait time, us
+    uint64 avg_rtime;    // Average run time, us
+    uint64 avg_turnaround; // Average turnaround time, us
 } scheduler_result;
 
 // Function to run test with a specific scheduler
@@ -141,13 +142,13 @@ void child_workload() {
     lifetime = get_process_lifetime(my_pid); // Uncommented
 
     // Uncommented optional parts in printf
-    printf(1, "Child %d finished: Uncles=%d, Lifetime=%d, Syscalls Used=%d\n",
+    printf(1, "Child %d finished: Uncles=%d, Lifetime=%d ms, Syscalls Used=%d\n",
            my_pid, uncles, lifetime, end_syscalls - start_syscalls);
     exit(); // Child must exit
 }
 
 // Add this prototype after your child_workload() function and before main()
-int numDigits(int n);  // Function prototype
+int numDigits(uint64 n);  // Function prototype
 
 int main(int argc, char *argv[]) {
     // Define our scheduler types
@@ -191,7 +192,7 @@ int main(int argc, char *argv[]) {
     // Print comprehensive comparison table
     printf(1, "\n\n=== SCHEDULER COMPARISON RESULTS ===\n");
     printf(1, "+----------------+----------------+----------------+----------------+\n");
-    printf(1, "| Scheduler      | Avg Wait Time | Avg Run Time   | Avg Turnaround |\n");
+    printf(1, "| Scheduler      | Avg Wait (us)  | Avg Run (us)   | Avg Turn (us)  |\n");
     printf(1, "+----------------+----------------+----------------+----------------+\n");
     
     for (int s = 0; s < num_schedulers; s++) {
@@ -201,17 +202,17 @@ int main(int argc, char *argv[]) {
             for (int sp = 0; sp < 14 - strlen(results[s].name); sp++) {
                 printf(1, " ");
             }
-            printf(1, " | %d", results[s].avg_wtime);
+            printf(1, " | %l", results[s].avg_wtime);
             // Add spaces to align (up to 14 characters)
             for (int sp = 0; sp < 14 - numDigits(results[s].avg_wtime); sp++) {
                 printf(1, " ");
             }
-            printf(1, " | %d", results[s].avg_rtime);
+            printf(1, " | %l", results[s].avg_rtime);
             // Add spaces to align
             for (int sp = 0; sp < 14 - numDigits(results[s].avg_rtime); sp++) {
                 printf(1, " ");
             }
-            printf(1, " | %d", results[s].avg_turnaround);
+            printf(1, " | %l", results[s].avg_turnaround);
             // Add spaces to align
             for (int sp = 0; sp < 14 - numDigits(results[s].avg_turnaround); sp++) {
                 printf(1, " ");
@@ -229,17 +230,12 @@ int main(int argc, char *argv[]) {
 }
 
 // Add this helper function before main()
-int numDigits(int n) {
-    if (n == 0) return 1;
+int numDigits(uint64 n) {
     int count = 0;
-    if (n < 0) {
-        count = 1;  // Count the negative sign
-        n = -n;
-    }
-    while (n > 0) {
+    do {
         count++;
-        n /= 10;
-    }
+        n = div64(n, 10);
+    } while (n > 0);
     return count;
 }
 
@@ -248,8 +244,8 @@ int run_scheduler_test(int policy, scheduler_result *result) {
     int num_children = 5; // Number of child processes to create
     int pids[num_children];
     int i;
-    int total_wtime = 0;
-    int total_rtime = 0;
+    uint64 total_wtime = 0;
+    uint64 total_rtime = 0;
     int completed_children = 0;
     int fd;
     const char *src_filename = "src_copy_file.txt";
@@ -301,17 +297,16 @@ int run_scheduler_test(int policy, scheduler_result *result) {
 
     // 3. Data Collection & Monitoring
     printf(1, "Waiting for children to complete...\n");
-    ps(); // Show initial state
 
     while (completed_children < num_children) {
-        int wtime, rtime;
+        uint64 wtime, rtime;
         int ret_pid = waitx(&wtime, &rtime); // Wait for ANY child
 
         if (ret_pid > 0) {
             completed_children++;
             total_wtime += wtime;
             total_rtime += rtime;
-            printf(1, "Child PID %d finished. Wait Time = %d, Run Time = %d\n", 
+            printf(1, "Child PID %d finished. Wait Time = %l us, Run Time = %l us\n", 
                    ret_pid, wtime, rtime);
 
             // Find which child index this was
@@ -327,9 +322,9 @@ int run_scheduler_test(int policy, scheduler_result *result) {
         }
     }
 
-    // Final ps() call
+    // Final ps run, once no children are left
     printf(1, "\n--- Final Process Status ---\n");
-    ps();
+    runps();
     printf(1, "---------------------------\n");
 
     // Store results for this scheduler
@@ -338,9 +333,9 @@ int run_scheduler_test(int policy, scheduler_result *result) {
     result->total_rtime = total_rtime;
     
     if (completed_children > 0) {
-        result->avg_wtime = total_wtime / completed_children;
-        result->avg_rtime = total_rtime / completed_children;
-        result->avg_turnaround = (total_wtime + total_rtime) / completed_children;
+        result->avg_wtime = div64(total_wtime, completed_children);
+        result->avg_rtime = div64(total_rtime, completed_children);
+        result->avg_turnaround = div64(total_wtime + total_rtime, completed_children);
     }
 
     // Cleanup
@@ -0,0 +1,2453 @@
+
+_scheduling_comparator:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+void create_test_workload(char *filename) {
+    // Create a test file with some content
+    copy_file("README", filename);
+}
+
+int main(int argc, char *argv[]) {
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	81 ec 28 01 00 00    	sub    $0x128,%esp
+    if (argc < 2) {
+      17:	83 39 01             	cmpl   $0x1,(%ecx)
+int main(int argc, char *argv[]) {
+      1a:	8b 59 04             	mov    0x4(%ecx),%ebx
+    if (argc < 2) {
+      1d:	0f 8e 4a 04 00 00    	jle    46d <main+0x46d>
+        printf(2, "Usage: scheduling_comparator <program_to_run> [args...]\n");
+        exit();
+    }
+
+    char *program_name = argv[1];
+      23:	8b 43 04             	mov    0x4(%ebx),%eax
+    if (use_workload) {
+        create_test_workload(test_file);
+    }
+
+    // Define the schedulers to test
+    struct SchedResult results[] = {
+      26:	8d bd 20 ff ff ff    	lea    -0xe0(%ebp),%edi
+      2c:	be 00 18 00 00       	mov    $0x1800,%esi
+      31:	b9 32 00 00 00       	mov    $0x32,%ecx
+      36:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    char *program_name = argv[1];
+      38:	89 85 f8 fe ff ff    	mov    %eax,-0x108(%ebp)
+    };
+    int num_schedulers = sizeof(results) / sizeof(results[0]);
+    // int original_policy = 0; // Store current policy if available
+
+    // Use a random seed based on the digital root if needed
+    int seed = find_digit_root(uptime());
+      3e:	e8 74 0c 00 00       	call   cb7 <uptime>
+      43:	83 ec 0c             	sub    $0xc,%esp
+      46:	50                   	push   %eax
+      47:	e8 75 0c 00 00       	call   cc1 <find_digit_root>
+    printf(1, "--- Scheduling Policy Comparison for '%s' (Seed: %d) ---\n", program_name, seed);
+      4c:	50                   	push   %eax
+      4d:	ff b5 f8 fe ff ff    	push   -0x108(%ebp)
+      53:	68 64 14 00 00       	push   $0x1464
+      58:	6a 01                	push   $0x1
+      5a:	e8 51 0e 00 00       	call   eb0 <printf>
+
+    for (int i = 0; i < num_schedulers; i++) {
+      5f:	8d 8d 20 ff ff ff    	lea    -0xe0(%ebp),%ecx
+            printf(1, "Child %d metrics during execution: Life: %d ticks, Uncles: %d\n", 
+                  pid, results[i].lifetime, results[i].uncles);
+                  
+            // Wait for the child and collect stats
+            uint64 wtime, rtime;
+            int status = waitx(&wtime, &rtime);
+      65:	89 9d e0 fe ff ff    	mov    %ebx,-0x120(%ebp)
+      6b:	83 c4 20             	add    $0x20,%esp
+      6e:	89 8d e4 fe ff ff    	mov    %ecx,-0x11c(%ebp)
+    printf(1, "--- Scheduling Policy Comparison for '%s' (Seed: %d) ---\n", program_name, seed);
+      74:	89 ce                	mov    %ecx,%esi
+      76:	e9 55 01 00 00       	jmp    1d0 <main+0x1d0>
+      7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      7f:	90                   	nop
+            printf(1, "Policy set to %s\n", results[i].name);
+      80:	83 ec 04             	sub    $0x4,%esp
+      83:	57                   	push   %edi
+      84:	68 84 13 00 00       	push   $0x1384
+      89:	6a 01                	push   $0x1
+      8b:	e8 20 0e 00 00       	call   eb0 <printf>
+        if (results[i].policy == SCHED_BJF) {
+      90:	83 c4 10             	add    $0x10,%esp
+      93:	83 fb 02             	cmp    $0x2,%ebx
+      96:	0f 84 f6 03 00 00    	je     492 <main+0x492>
+        if (results[i].policy == SCHED_SJF) {
+      9c:	83 fb 01             	cmp    $0x1,%ebx
+      9f:	0f 84 db 03 00 00    	je     480 <main+0x480>
+        int start_syscalls = getnumsyscalls();
+      a5:	e8 3f 0c 00 00       	call   ce9 <getnumsyscalls>
+      aa:	89 85 00 ff ff ff    	mov    %eax,-0x100(%ebp)
+        int start_goodsyscalls = getnumsyscallsgood();
+      b0:	e8 3e 0c 00 00       	call   cf3 <getnumsyscallsgood>
+      b5:	89 85 fc fe ff ff    	mov    %eax,-0x104(%ebp)
+        int pid = fork();
+      bb:	e8 f0 06 00 00       	call   7b0 <fork>
+      c0:	89 c3                	mov    %eax,%ebx
+        if (pid < 0) {
+      c2:	85 c0                	test   %eax,%eax
+      c4:	0f 88 da 03 00 00    	js     4a4 <main+0x4a4>
+        } else if (pid == 0) {
+      ca:	0f 84 16 04 00 00    	je     4e6 <main+0x4e6>
+            sleep(20); // Small delay to ensure child process has started
+      d0:	83 ec 0c             	sub    $0xc,%esp
+      d3:	6a 14                	push   $0x14
+      d5:	e8 d3 0b 00 00       	call   cad <sleep>
+            results[i].lifetime = get_process_lifetime(pid);
+      da:	89 1c 24             	mov    %ebx,(%esp)
+      dd:	e8 fd 0b 00 00       	call   cdf <get_process_lifetime>
+      e2:	89 46 20             	mov    %eax,0x20(%esi)
+      e5:	89 85 04 ff ff ff    	mov    %eax,-0xfc(%ebp)
+            results[i].uncles = get_uncle_count(pid);
+      eb:	89 1c 24             	mov    %ebx,(%esp)
+      ee:	e8 e2 0b 00 00       	call   cd5 <get_uncle_count>
+      f3:	89 85 f0 fe ff ff    	mov    %eax,-0x110(%ebp)
+      f9:	89 46 24             	mov    %eax,0x24(%esi)
+            printf(1, "Child %d metrics during execution: Life: %d ticks, Uncles: %d\n", 
+      fc:	89 04 24             	mov    %eax,(%esp)
+      ff:	ff b5 04 ff ff ff    	push   -0xfc(%ebp)
+     105:	53                   	push   %ebx
+     106:	68 fc 14 00 00       	push   $0x14fc
+     10b:	6a 01                	push   $0x1
+     10d:	e8 9e 0d 00 00       	call   eb0 <printf>
+            int status = waitx(&wtime, &rtime);
+     112:	83 c4 18             	add    $0x18,%esp
+     115:	8d 85 18 ff ff ff    	lea    -0xe8(%ebp),%eax
+     11b:	50                   	push   %eax
+     11c:	8d 85 10 ff ff ff    	lea    -0xf0(%ebp),%eax
+     122:	50                   	push   %eax
+     123:	e8 d5 0b 00 00       	call   cfd <waitx>
+            
+            if (status < 0) {
+     128:	83 c4 10             	add    $0x10,%esp
+     12b:	85 c0                	test   %eax,%eax
+     12d:	0f 88 d6 00 00 00    	js     209 <main+0x209>
+                printf(2, "Waitx failed for policy %s\n", results[i].name);
+            } else {
+                results[i].wtime = wtime;
+     133:	8b 95 14 ff ff ff    	mov    -0xec(%ebp),%edx
+     139:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+     13f:	8b 85 10 ff ff ff    	mov    -0xf0(%ebp),%eax
+     145:	89 56 14             	mov    %edx,0x14(%esi)
+                results[i].rtime = rtime;
+     148:	8b 95 1c ff ff ff    	mov    -0xe4(%ebp),%edx
+                results[i].wtime = wtime;
+     14e:	89 46 10             	mov    %eax,0x10(%esi)
+                results[i].rtime = rtime;
+     151:	8b 85 18 ff ff ff    	mov    -0xe8(%ebp),%eax
+     157:	89 56 0c             	mov    %edx,0xc(%esi)
+     15a:	89 46 08             	mov    %eax,0x8(%esi)
+                results[i].syscalls = getnumsyscalls() - start_syscalls;
+     15d:	e8 87 0b 00 00       	call   ce9 <getnumsyscalls>
+     162:	8b bd 00 ff ff ff    	mov    -0x100(%ebp),%edi
+     168:	29 f8                	sub    %edi,%eax
+     16a:	89 46 18             	mov    %eax,0x18(%esi)
+     16d:	89 85 00 ff ff ff    	mov    %eax,-0x100(%ebp)
+                results[i].goodsyscalls = getnumsyscallsgood() - start_goodsyscalls;
+     173:	e8 7b 0b 00 00       	call   cf3 <getnumsyscallsgood>
+     178:	8b bd fc fe ff ff    	mov    -0x104(%ebp),%edi
+     17e:	29 f8                	sub    %edi,%eax
+     180:	89 46 1c             	mov    %eax,0x1c(%esi)
+                
+                printf(1, "PID %d finished. Status: %d, Wait: %l us, Run: %l us, Life: %d ms, Syscalls: %d/%d, Uncles: %d\n",
+     183:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+     189:	8b 8d 00 ff ff ff    	mov    -0x100(%ebp),%ecx
+     18f:	51                   	push   %ecx
+     190:	50                   	push   %eax
+     191:	ff b5 04 ff ff ff    	push   -0xfc(%ebp)
+     197:	ff b5 1c ff ff ff    	push   -0xe4(%ebp)
+     19d:	ff b5 18 ff ff ff    	push   -0xe8(%ebp)
+     1a3:	ff b5 14 ff ff ff    	push   -0xec(%ebp)
+     1a9:	ff b5 10 ff ff ff    	push   -0xf0(%ebp)
+     1af:	8b 95 e8 fe ff ff    	mov    -0x118(%ebp),%edx
+     1b5:	52                   	push   %edx
+     1b6:	53                   	push   %ebx
+     1b7:	68 3c 15 00 00       	push   $0x153c
+     1bc:	6a 01                	push   $0x1
+     1be:	e8 ed 0c 00 00       	call   eb0 <printf>
+     1c3:	83 c4 30             	add    $0x30,%esp
+    for (int i = 0; i < num_schedulers; i++) {
+     1c6:	83 c6 28             	add    $0x28,%esi
+     1c9:	8d 45 e8             	lea    -0x18(%ebp),%eax
+     1cc:	39 c6                	cmp    %eax,%esi
+     1ce:	74 4c                	je     21c <main+0x21c>
+        printf(1, "\nTesting Scheduler: %s (%d)\n", results[i].name, results[i].policy);
+     1d0:	8b 1e                	mov    (%esi),%ebx
+     1d2:	8b 7e 04             	mov    0x4(%esi),%edi
+     1d5:	53                   	push   %ebx
+     1d6:	57                   	push   %edi
+     1d7:	68 67 13 00 00       	push   $0x1367
+     1dc:	6a 01                	push   $0x1
+     1de:	e8 cd 0c 00 00       	call   eb0 <printf>
+        if (setschedpolicy(results[i].policy) < 0) {
+     1e3:	89 1c 24             	mov    %ebx,(%esp)
+     1e6:	e8 1c 0b 00 00       	call   d07 <setschedpolicy>
+     1eb:	83 c4 10             	add    $0x10,%esp
+     1ee:	85 c0                	test   %eax,%eax
+     1f0:	0f 89 8a fe ff ff    	jns    80 <main+0x80>
+            printf(2, "Error setting scheduler policy %s\n", results[i].name);
+     1f6:	50                   	push   %eax
+     1f7:	57                   	push   %edi
+     1f8:	68 a0 14 00 00       	push   $0x14a0
+     1fd:	6a 02                	push   $0x2
+     1ff:	e8 ac 0c 00 00       	call   eb0 <printf>
+            continue; 
+     204:	83 c4 10             	add    $0x10,%esp
+     207:	eb bd                	jmp    1c6 <main+0x1c6>
+                printf(2, "Waitx failed for policy %s\n", results[i].name);
+     209:	50                   	push   %eax
+     20a:	57                   	push   %edi
+     20b:	68 b5 13 00 00       	push   $0x13b5
+     210:	6a 02                	push   $0x2
+     212:	e8 99 0c 00 00       	call   eb0 <printf>
+     217:	83 c4 10             	add    $0x10,%esp
+     21a:	eb aa                	jmp    1c6 <main+0x1c6>
+            }
+        }
+    }
+
+    // Show process table (optional)
+    printf(1, "\nProcess table at completion:\n");
+     21c:	8b 8d e4 fe ff ff    	mov    -0x11c(%ebp),%ecx
+     222:	89 8d 00 ff ff ff    	mov    %ecx,-0x100(%ebp)
+     228:	53                   	push   %ebx
+     229:	53                   	push   %ebx
+     22a:	68 9c 15 00 00       	push   $0x159c
+     22f:	6a 01                	push   $0x1
+     231:	e8 7a 0c 00 00       	call   eb0 <printf>
+    runps();
+     236:	e8 d5 10 00 00       	call   1310 <runps>
+
+    // Print summary table
+    printf(1, "\n--- Comparison Summary ---\n");
+     23b:	5e                   	pop    %esi
+     23c:	5f                   	pop    %edi
+     23d:	68 d1 13 00 00       	push   $0x13d1
+     242:	6a 01                	push   $0x1
+    printf(1, "Scheduler | Wait (us) | Run (us) | Total (us) | Syscalls | Lifetime (ms)    | Uncles\n");
+    printf(1, "----------|-----------|----------|------------|----------|------------------|-------\n");
+
+    uint64 best_rtime = 0;
+     244:	31 f6                	xor    %esi,%esi
+    printf(1, "\n--- Comparison Summary ---\n");
+     246:	e8 65 0c 00 00       	call   eb0 <printf>
+    printf(1, "Scheduler | Wait (us) | Run (us) | Total (us) | Syscalls | Lifetime (ms)    | Uncles\n");
+     24b:	58                   	pop    %eax
+     24c:	5a                   	pop    %edx
+     24d:	68 bc 15 00 00       	push   $0x15bc
+     252:	6a 01                	push   $0x1
+     254:	e8 57 0c 00 00       	call   eb0 <printf>
+    printf(1, "----------|-----------|----------|------------|----------|------------------|-------\n");
+     259:	59                   	pop    %ecx
+     25a:	5b                   	pop    %ebx
+     25b:	68 14 16 00 00       	push   $0x1614
+     260:	6a 01                	push   $0x1
+    uint64 best_total_time = 0;
+    int best_rtime_idx = -1;
+    int best_total_time_idx = -1;
+
+    for (int i = 0; i < num_schedulers; i++) {
+     262:	31 db                	xor    %ebx,%ebx
+    printf(1, "----------|-----------|----------|------------|----------|------------------|-------\n");
+     264:	e8 47 0c 00 00       	call   eb0 <printf>
+    uint64 best_rtime = 0;
+     269:	89 b5 d0 fe ff ff    	mov    %esi,-0x130(%ebp)
+    printf(1, "----------|-----------|----------|------------|----------|------------------|-------\n");
+     26f:	83 c4 10             	add    $0x10,%esp
+    int best_total_time_idx = -1;
+     272:	c7 85 f8 fe ff ff ff 	movl   $0xffffffff,-0x108(%ebp)
+     279:	ff ff ff 
+    int best_rtime_idx = -1;
+     27c:	c7 85 dc fe ff ff ff 	movl   $0xffffffff,-0x124(%ebp)
+     283:	ff ff ff 
+    uint64 best_rtime = 0;
+     286:	89 b5 d4 fe ff ff    	mov    %esi,-0x12c(%ebp)
+     28c:	89 b5 e4 fe ff ff    	mov    %esi,-0x11c(%ebp)
+     292:	89 b5 e0 fe ff ff    	mov    %esi,-0x120(%ebp)
+     298:	89 9d 04 ff ff ff    	mov    %ebx,-0xfc(%ebp)
+     29e:	66 90                	xchg   %ax,%ax
+        if (results[i].rtime != -1) { // Check if the test ran successfully
+     2a0:	8b 9d 00 ff ff ff    	mov    -0x100(%ebp),%ebx
+            uint64 total_time = results[i].rtime + results[i].wtime;
+            
+            printf(1, "%s | %l       | %l      | %l         | %d/%d    | %d               | %d\n",
+     2a6:	8b 43 04             	mov    0x4(%ebx),%eax
+        if (results[i].rtime != -1) { // Check if the test ran successfully
+     2a9:	8b 73 08             	mov    0x8(%ebx),%esi
+     2ac:	8b 7b 0c             	mov    0xc(%ebx),%edi
+            printf(1, "%s | %l       | %l      | %l         | %d/%d    | %d               | %d\n",
+     2af:	89 85 fc fe ff ff    	mov    %eax,-0x104(%ebp)
+        if (results[i].rtime != -1) { // Check if the test ran successfully
+     2b5:	89 f0                	mov    %esi,%eax
+     2b7:	89 fa                	mov    %edi,%edx
+     2b9:	f7 d0                	not    %eax
+     2bb:	f7 d2                	not    %edx
+     2bd:	09 d0                	or     %edx,%eax
+     2bf:	0f 84 8b 01 00 00    	je     450 <main+0x450>
+            uint64 total_time = results[i].rtime + results[i].wtime;
+     2c5:	8b 4b 10             	mov    0x10(%ebx),%ecx
+     2c8:	89 d8                	mov    %ebx,%eax
+     2ca:	8b 5b 14             	mov    0x14(%ebx),%ebx
+     2cd:	89 8d f0 fe ff ff    	mov    %ecx,-0x110(%ebp)
+     2d3:	89 f1                	mov    %esi,%ecx
+     2d5:	03 8d f0 fe ff ff    	add    -0x110(%ebp),%ecx
+     2db:	89 9d f4 fe ff ff    	mov    %ebx,-0x10c(%ebp)
+     2e1:	89 fb                	mov    %edi,%ebx
+     2e3:	13 9d f4 fe ff ff    	adc    -0x10c(%ebp),%ebx
+            printf(1, "%s | %l       | %l      | %l         | %d/%d    | %d               | %d\n",
+     2e9:	83 ec 0c             	sub    $0xc,%esp
+            uint64 total_time = results[i].rtime + results[i].wtime;
+     2ec:	89 8d e8 fe ff ff    	mov    %ecx,-0x118(%ebp)
+     2f2:	89 9d ec fe ff ff    	mov    %ebx,-0x114(%ebp)
+            printf(1, "%s | %l       | %l      | %l         | %d/%d    | %d               | %d\n",
+     2f8:	ff 70 24             	push   0x24(%eax)
+     2fb:	ff 70 20             	push   0x20(%eax)
+     2fe:	ff 70 18             	push   0x18(%eax)
+     301:	ff 70 1c             	push   0x1c(%eax)
+     304:	53                   	push   %ebx
+     305:	51                   	push   %ecx
+     306:	57                   	push   %edi
+     307:	56                   	push   %esi
+     308:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+     30e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+     314:	ff b5 fc fe ff ff    	push   -0x104(%ebp)
+     31a:	68 6c 16 00 00       	push   $0x166c
+     31f:	6a 01                	push   $0x1
+     321:	e8 8a 0b 00 00       	call   eb0 <printf>
+                   results[i].name, results[i].wtime, results[i].rtime, total_time,
+                   results[i].goodsyscalls, results[i].syscalls, 
+                   results[i].lifetime, results[i].uncles);
+
+            // Track best runtime
+            if (best_rtime_idx == -1 || results[i].rtime < best_rtime) {
+     326:	8b 85 e4 fe ff ff    	mov    -0x11c(%ebp),%eax
+     32c:	83 c4 40             	add    $0x40,%esp
+     32f:	39 c6                	cmp    %eax,%esi
+     331:	89 f8                	mov    %edi,%eax
+     333:	1b 85 e0 fe ff ff    	sbb    -0x120(%ebp),%eax
+     339:	72 09                	jb     344 <main+0x344>
+     33b:	83 bd dc fe ff ff ff 	cmpl   $0xffffffff,-0x124(%ebp)
+     342:	75 18                	jne    35c <main+0x35c>
+     344:	8b 85 04 ff ff ff    	mov    -0xfc(%ebp),%eax
+     34a:	89 b5 e4 fe ff ff    	mov    %esi,-0x11c(%ebp)
+     350:	89 bd e0 fe ff ff    	mov    %edi,-0x120(%ebp)
+     356:	89 85 dc fe ff ff    	mov    %eax,-0x124(%ebp)
+                best_rtime = results[i].rtime;
+                best_rtime_idx = i;
+            }
+            // Track best total time
+            if (best_total_time_idx == -1 || total_time < best_total_time) {
+     35c:	83 bd f8 fe ff ff ff 	cmpl   $0xffffffff,-0x108(%ebp)
+     363:	74 20                	je     385 <main+0x385>
+     365:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+     36b:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+     371:	8b 95 ec fe ff ff    	mov    -0x114(%ebp),%edx
+     377:	8b 9d d4 fe ff ff    	mov    -0x12c(%ebp),%ebx
+     37d:	39 c8                	cmp    %ecx,%eax
+     37f:	89 d0                	mov    %edx,%eax
+     381:	19 d8                	sbb    %ebx,%eax
+     383:	73 24                	jae    3a9 <main+0x3a9>
+     385:	8b 85 04 ff ff ff    	mov    -0xfc(%ebp),%eax
+            uint64 total_time = results[i].rtime + results[i].wtime;
+     38b:	8b 95 ec fe ff ff    	mov    -0x114(%ebp),%edx
+            if (best_total_time_idx == -1 || total_time < best_total_time) {
+     391:	89 85 f8 fe ff ff    	mov    %eax,-0x108(%ebp)
+            uint64 total_time = results[i].rtime + results[i].wtime;
+     397:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+     39d:	89 95 d4 fe ff ff    	mov    %edx,-0x12c(%ebp)
+     3a3:	89 85 d0 fe ff ff    	mov    %eax,-0x130(%ebp)
+    for (int i = 0; i < num_schedulers; i++) {
+     3a9:	83 85 04 ff ff ff 01 	addl   $0x1,-0xfc(%ebp)
+     3b0:	8b 85 04 ff ff ff    	mov    -0xfc(%ebp),%eax
+     3b6:	83 85 00 ff ff ff 28 	addl   $0x28,-0x100(%ebp)
+     3bd:	83 f8 05             	cmp    $0x5,%eax
+     3c0:	0f 85 da fe ff ff    	jne    2a0 <main+0x2a0>
+                   results[i].name);
+        }
+    }
+
+    // Suggest best scheduler
+    printf(1, "\n--- Suggestion ---\n");
+     3c6:	51                   	push   %ecx
+     3c7:	51                   	push   %ecx
+     3c8:	68 ee 13 00 00       	push   $0x13ee
+     3cd:	6a 01                	push   $0x1
+     3cf:	e8 dc 0a 00 00       	call   eb0 <printf>
+    if (best_rtime_idx != -1) {
+     3d4:	8b 85 dc fe ff ff    	mov    -0x124(%ebp),%eax
+     3da:	83 c4 10             	add    $0x10,%esp
+     3dd:	83 f8 ff             	cmp    $0xffffffff,%eax
+     3e0:	0f 84 d4 00 00 00    	je     4ba <main+0x4ba>
+        printf(1, "Best scheduler based on Run Time: %s (Runtime: %l us)\n",
+     3e6:	6b c0 28             	imul   $0x28,%eax,%eax
+     3e9:	83 ec 0c             	sub    $0xc,%esp
+     3ec:	ff b4 05 2c ff ff ff 	push   -0xd4(%ebp,%eax,1)
+     3f3:	ff b4 05 28 ff ff ff 	push   -0xd8(%ebp,%eax,1)
+     3fa:	ff b4 05 24 ff ff ff 	push   -0xdc(%ebp,%eax,1)
+     401:	68 04 17 00 00       	push   $0x1704
+     406:	6a 01                	push   $0x1
+     408:	e8 a3 0a 00 00       	call   eb0 <printf>
+     40d:	83 c4 20             	add    $0x20,%esp
+               results[best_rtime_idx].name, results[best_rtime_idx].rtime);
+    } else {
+        printf(1, "Could not determine best scheduler based on runtime.\n");
+    }
+    
+    if (best_total_time_idx != -1) {
+     410:	8b 85 f8 fe ff ff    	mov    -0x108(%ebp),%eax
+     416:	83 f8 ff             	cmp    $0xffffffff,%eax
+     419:	0f 84 b1 00 00 00    	je     4d0 <main+0x4d0>
+        printf(1, "Best scheduler based on Total Time: %s (Total Time: %l us)\n",
+     41f:	6b c0 28             	imul   $0x28,%eax,%eax
+     422:	83 ec 0c             	sub    $0xc,%esp
+     425:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+     42b:	ff b5 d0 fe ff ff    	push   -0x130(%ebp)
+     431:	ff b4 05 24 ff ff ff 	push   -0xdc(%ebp,%eax,1)
+     438:	68 74 17 00 00       	push   $0x1774
+     43d:	6a 01                	push   $0x1
+     43f:	e8 6c 0a 00 00       	call   eb0 <printf>
+     444:	83 c4 20             	add    $0x20,%esp
+    // Clean up test file if created
+    if (use_workload) {
+        unlink(test_file);
+    }
+
+    exit();
+     447:	e8 b4 03 00 00       	call   800 <exit>
+     44c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+            printf(1, "%s | ---       | ---      | ---        | ---      | ---              | ---\n", 
+     450:	83 ec 04             	sub    $0x4,%esp
+     453:	ff b5 fc fe ff ff    	push   -0x104(%ebp)
+     459:	68 b8 16 00 00       	push   $0x16b8
+     45e:	6a 01                	push   $0x1
+     460:	e8 4b 0a 00 00       	call   eb0 <printf>
+     465:	83 c4 10             	add    $0x10,%esp
+     468:	e9 3c ff ff ff       	jmp    3a9 <main+0x3a9>
+        printf(2, "Usage: scheduling_comparator <program_to_run> [args...]\n");
+     46d:	50                   	push   %eax
+     46e:	50                   	push   %eax
+     46f:	68 28 14 00 00       	push   $0x1428
+     474:	6a 02                	push   $0x2
+     476:	e8 35 0a 00 00       	call   eb0 <printf>
+        exit();
+     47b:	e8 80 03 00 00       	call   800 <exit>
+            set_burst_estimate(50);
+     480:	83 ec 0c             	sub    $0xc,%esp
+     483:	6a 32                	push   $0x32
+     485:	e8 9b 08 00 00       	call   d25 <set_burst_estimate>
+     48a:	83 c4 10             	add    $0x10,%esp
+     48d:	e9 13 fc ff ff       	jmp    a5 <main+0xa5>
+            set_priority(10); // Medium priority
+     492:	83 ec 0c             	sub    $0xc,%esp
+     495:	6a 0a                	push   $0xa
+     497:	e8 75 08 00 00       	call   d11 <set_priority>
+     49c:	83 c4 10             	add    $0x10,%esp
+     49f:	e9 01 fc ff ff       	jmp    a5 <main+0xa5>
+            printf(2, "Fork failed\n");
+     4a4:	50                   	push   %eax
+     4a5:	50                   	push   %eax
+     4a6:	68 96 13 00 00       	push   $0x1396
+     4ab:	6a 02                	push   $0x2
+     4ad:	e8 fe 09 00 00       	call   eb0 <printf>
+            continue;
+     4b2:	83 c4 10             	add    $0x10,%esp
+     4b5:	e9 0c fd ff ff       	jmp    1c6 <main+0x1c6>
+        printf(1, "Could not determine best scheduler based on runtime.\n");
+     4ba:	52                   	push   %edx
+     4bb:	52                   	push   %edx
+     4bc:	68 3c 17 00 00       	push   $0x173c
+     4c1:	6a 01                	push   $0x1
+     4c3:	e8 e8 09 00 00       	call   eb0 <printf>
+     4c8:	83 c4 10             	add    $0x10,%esp
+     4cb:	e9 40 ff ff ff       	jmp    410 <main+0x410>
+        printf(1, "Could not determine best scheduler based on total time.\n");
+     4d0:	50                   	push   %eax
+     4d1:	50                   	push   %eax
+     4d2:	68 b0 17 00 00       	push   $0x17b0
+     4d7:	6a 01                	push   $0x1
+     4d9:	e8 d2 09 00 00       	call   eb0 <printf>
+     4de:	83 c4 10             	add    $0x10,%esp
+     4e1:	e9 61 ff ff ff       	jmp    447 <main+0x447>
+            int my_lifetime = get_process_lifetime(getpid());
+     4e6:	8b 9d e0 fe ff ff    	mov    -0x120(%ebp),%ebx
+     4ec:	e8 a8 07 00 00       	call   c99 <getpid>
+     4f1:	83 ec 0c             	sub    $0xc,%esp
+     4f4:	50                   	push   %eax
+    char **program_args = argv + 1; // Pass remaining args to the target program
+     4f5:	83 c3 04             	add    $0x4,%ebx
+            int my_lifetime = get_process_lifetime(getpid());
+     4f8:	e8 e2 07 00 00       	call   cdf <get_process_lifetime>
+     4fd:	89 c6                	mov    %eax,%esi
+            int my_uncles = get_uncle_count(getpid());
+     4ff:	e8 95 07 00 00       	call   c99 <getpid>
+     504:	89 04 24             	mov    %eax,(%esp)
+     507:	e8 c9 07 00 00       	call   cd5 <get_uncle_count>
+     50c:	89 c7                	mov    %eax,%edi
+            printf(1, "Child process %d before exec: Lifetime=%d, Uncles=%d\n", 
+     50e:	e8 86 07 00 00       	call   c99 <getpid>
+     513:	89 3c 24             	mov    %edi,(%esp)
+     516:	56                   	push   %esi
+     517:	50                   	push   %eax
+     518:	68 c4 14 00 00       	push   $0x14c4
+     51d:	6a 01                	push   $0x1
+     51f:	e8 8c 09 00 00       	call   eb0 <printf>
+            exec(program_name, program_args);
+     524:	83 c4 18             	add    $0x18,%esp
+     527:	53                   	push   %ebx
+     528:	8b bd f8 fe ff ff    	mov    -0x108(%ebp),%edi
+     52e:	57                   	push   %edi
+     52f:	e8 dc 02 00 00       	call   810 <exec>
+            printf(2, "Exec '%s' failed\n", program_name);
+     534:	83 c4 0c             	add    $0xc,%esp
+     537:	57                   	push   %edi
+     538:	68 a3 13 00 00       	push   $0x13a3
+     53d:	6a 02                	push   $0x2
+     53f:	e8 6c 09 00 00       	call   eb0 <printf>
+            exit(); // Child exits on failure
+     544:	e8 b7 02 00 00       	call   800 <exit>
+     549:	66 90                	xchg   %ax,%ax
+     54b:	66 90                	xchg   %ax,%ax
+     54d:	66 90                	xchg   %ax,%ax
+     54f:	90                   	nop
+
+00000550 <create_test_workload>:
+void create_test_workload(char *filename) {
+     550:	55                   	push   %ebp
+     551:	89 e5                	mov    %esp,%ebp
+     553:	83 ec 10             	sub    $0x10,%esp
+    copy_file("README", filename);
+     556:	ff 75 08             	push   0x8(%ebp)
+     559:	68 60 13 00 00       	push   $0x1360
+     55e:	e8 68 07 00 00       	call   ccb <copy_file>
+}
+     563:	83 c4 10             	add    $0x10,%esp
+     566:	c9                   	leave
+     567:	c3                   	ret
+     568:	66 90                	xchg   %ax,%ax
+     56a:	66 90                	xchg   %ax,%ax
+     56c:	66 90                	xchg   %ax,%ax
+     56e:	66 90                	xchg   %ax,%ax
+
+00000570 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+     570:	55                   	push   %ebp
+     571:	89 e5                	mov    %esp,%ebp
+     573:	57                   	push   %edi
+     574:	56                   	push   %esi
+     575:	53                   	push   %ebx
+     576:	83 ec 4c             	sub    $0x4c,%esp
+     579:	8b 45 0c             	mov    0xc(%ebp),%eax
+     57c:	8b 55 08             	mov    0x8(%ebp),%edx
+     57f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     582:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+     585:	83 fa 0f             	cmp    $0xf,%edx
+     588:	0f 87 32 01 00 00    	ja     6c0 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+     58e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     594:	8b 80 e0 1d 00 00    	mov    0x1de0(%eax),%eax
+     59a:	85 c0                	test   %eax,%eax
+     59c:	0f 84 de 00 00 00    	je     680 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+     5a2:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     5a8:	8b b0 e4 1d 00 00    	mov    0x1de4(%eax),%esi
+     5ae:	8d 88 e0 1d 00 00    	lea    0x1de0(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+     5b4:	8d b8 e8 1d 00 00    	lea    0x1de8(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+     5ba:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+     5bd:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+     5c0:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+     5c3:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+     5c9:	0f 8f 01 01 00 00    	jg     6d0 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+     5cf:	8d 78 08             	lea    0x8(%eax),%edi
+     5d2:	8d bc 3e e0 1d 00 00 	lea    0x1de0(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     5d9:	85 db                	test   %ebx,%ebx
+     5db:	7e 3b                	jle    618 <bufwrite+0xa8>
+     5dd:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+     5e0:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+     5e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5e7:	90                   	nop
+    *dst++ = *src++;
+     5e8:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     5e9:	39 c6                	cmp    %eax,%esi
+     5eb:	75 fb                	jne    5e8 <bufwrite+0x78>
+  ob[fd].n += n;
+     5ed:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     5f3:	8b 88 e4 1d 00 00    	mov    0x1de4(%eax),%ecx
+     5f9:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     5fb:	83 b8 e0 1d 00 00 01 	cmpl   $0x1,0x1de0(%eax)
+  ob[fd].n += n;
+     602:	89 88 e4 1d 00 00    	mov    %ecx,0x1de4(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     608:	74 26                	je     630 <bufwrite+0xc0>
+}
+     60a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     60d:	5b                   	pop    %ebx
+     60e:	5e                   	pop    %esi
+     60f:	5f                   	pop    %edi
+     610:	5d                   	pop    %ebp
+     611:	c3                   	ret
+     612:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+     618:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     61b:	83 b8 e0 1d 00 00 01 	cmpl   $0x1,0x1de0(%eax)
+  ob[fd].n += n;
+     622:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     625:	75 e3                	jne    60a <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+     627:	85 db                	test   %ebx,%ebx
+     629:	74 df                	je     60a <bufwrite+0x9a>
+     62b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     62f:	90                   	nop
+  src = vsrc;
+     630:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     633:	01 c3                	add    %eax,%ebx
+     635:	eb 10                	jmp    647 <bufwrite+0xd7>
+     637:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     63e:	66 90                	xchg   %ax,%ax
+     640:	83 c0 01             	add    $0x1,%eax
+     643:	39 d8                	cmp    %ebx,%eax
+     645:	74 c3                	je     60a <bufwrite+0x9a>
+    if(*p == (char)c)
+     647:	80 38 0a             	cmpb   $0xa,(%eax)
+     64a:	75 f4                	jne    640 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     64c:	85 c9                	test   %ecx,%ecx
+     64e:	7e ba                	jle    60a <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+     650:	83 ec 04             	sub    $0x4,%esp
+     653:	51                   	push   %ecx
+     654:	ff 75 ac             	push   -0x54(%ebp)
+     657:	52                   	push   %edx
+     658:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+     65b:	e8 cd 05 00 00       	call   c2d <write>
+    ob[fd].n = 0;
+     660:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     663:	83 c4 10             	add    $0x10,%esp
+     666:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+     66c:	c7 82 e4 1d 00 00 00 	movl   $0x0,0x1de4(%edx)
+     673:	00 00 00 
+     676:	eb 92                	jmp    60a <bufwrite+0x9a>
+     678:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     67f:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     680:	83 ec 08             	sub    $0x8,%esp
+     683:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     686:	50                   	push   %eax
+     687:	52                   	push   %edx
+     688:	89 55 b0             	mov    %edx,-0x50(%ebp)
+     68b:	e8 d7 05 00 00       	call   c67 <fstat>
+     690:	83 c4 10             	add    $0x10,%esp
+     693:	8b 55 b0             	mov    -0x50(%ebp),%edx
+     696:	89 c1                	mov    %eax,%ecx
+     698:	b8 02 00 00 00       	mov    $0x2,%eax
+     69d:	85 c9                	test   %ecx,%ecx
+     69f:	75 0d                	jne    6ae <bufwrite+0x13e>
+     6a1:	31 c0                	xor    %eax,%eax
+     6a3:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     6a8:	0f 95 c0             	setne  %al
+     6ab:	83 c0 01             	add    $0x1,%eax
+     6ae:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+     6b4:	89 81 e0 1d 00 00    	mov    %eax,0x1de0(%ecx)
+     6ba:	e9 e3 fe ff ff       	jmp    5a2 <bufwrite+0x32>
+     6bf:	90                   	nop
+}
+     6c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6c3:	5b                   	pop    %ebx
+     6c4:	5e                   	pop    %esi
+     6c5:	5f                   	pop    %edi
+     6c6:	5d                   	pop    %ebp
+    write(fd, p, n);
+     6c7:	e9 61 05 00 00       	jmp    c2d <write>
+     6cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+     6d0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+     6d3:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+     6d6:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+     6d9:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+     6dc:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+     6df:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+     6e2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+     6e5:	6a 02                	push   $0x2
+     6e7:	50                   	push   %eax
+     6e8:	52                   	push   %edx
+     6e9:	e8 9b 06 00 00       	call   d89 <writev>
+    ob[fd].n = 0;
+     6ee:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+     6f1:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+     6f4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+     6fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6fe:	5b                   	pop    %ebx
+     6ff:	5e                   	pop    %esi
+     700:	5f                   	pop    %edi
+     701:	5d                   	pop    %ebp
+     702:	c3                   	ret
+     703:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     70a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000710 <fflush>:
+{
+     710:	55                   	push   %ebp
+     711:	89 e5                	mov    %esp,%ebp
+     713:	53                   	push   %ebx
+     714:	83 ec 04             	sub    $0x4,%esp
+     717:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     71a:	83 f8 0f             	cmp    $0xf,%eax
+     71d:	77 16                	ja     735 <fflush+0x25>
+     71f:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+     725:	8b 8a e4 1d 00 00    	mov    0x1de4(%edx),%ecx
+     72b:	8d 9a e0 1d 00 00    	lea    0x1de0(%edx),%ebx
+     731:	85 c9                	test   %ecx,%ecx
+     733:	7f 0b                	jg     740 <fflush+0x30>
+}
+     735:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     738:	c9                   	leave
+     739:	c3                   	ret
+     73a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     740:	83 ec 04             	sub    $0x4,%esp
+     743:	81 c2 e8 1d 00 00    	add    $0x1de8,%edx
+     749:	51                   	push   %ecx
+     74a:	52                   	push   %edx
+     74b:	50                   	push   %eax
+     74c:	e8 dc 04 00 00       	call   c2d <write>
+    ob[fd].n = 0;
+     751:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     758:	83 c4 10             	add    $0x10,%esp
+}
+     75b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     75e:	c9                   	leave
+     75f:	c3                   	ret
+
+00000760 <fflushall>:
+{
+     760:	55                   	push   %ebp
+     761:	89 e5                	mov    %esp,%ebp
+     763:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     764:	31 f6                	xor    %esi,%esi
+{
+     766:	53                   	push   %ebx
+     767:	bb e8 1d 00 00       	mov    $0x1de8,%ebx
+     76c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     770:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     773:	85 c0                	test   %eax,%eax
+     775:	7e 15                	jle    78c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     777:	83 ec 04             	sub    $0x4,%esp
+     77a:	50                   	push   %eax
+     77b:	53                   	push   %ebx
+     77c:	56                   	push   %esi
+     77d:	e8 ab 04 00 00       	call   c2d <write>
+    ob[fd].n = 0;
+     782:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     789:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     78c:	83 c6 01             	add    $0x1,%esi
+     78f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     795:	83 fe 10             	cmp    $0x10,%esi
+     798:	75 d6                	jne    770 <fflushall+0x10>
+}
+     79a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     79d:	5b                   	pop    %ebx
+     79e:	5e                   	pop    %esi
+     79f:	5d                   	pop    %ebp
+     7a0:	c3                   	ret
+     7a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7af:	90                   	nop
+
+000007b0 <fork>:
+{
+     7b0:	55                   	push   %ebp
+     7b1:	89 e5                	mov    %esp,%ebp
+     7b3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     7b4:	31 f6                	xor    %esi,%esi
+{
+     7b6:	53                   	push   %ebx
+     7b7:	bb e8 1d 00 00       	mov    $0x1de8,%ebx
+     7bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     7c0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     7c3:	85 c0                	test   %eax,%eax
+     7c5:	7e 15                	jle    7dc <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     7c7:	83 ec 04             	sub    $0x4,%esp
+     7ca:	50                   	push   %eax
+     7cb:	53                   	push   %ebx
+     7cc:	56                   	push   %esi
+     7cd:	e8 5b 04 00 00       	call   c2d <write>
+    ob[fd].n = 0;
+     7d2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     7d9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     7dc:	83 c6 01             	add    $0x1,%esi
+     7df:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     7e5:	83 fe 10             	cmp    $0x10,%esi
+     7e8:	75 d6                	jne    7c0 <fork+0x10>
+}
+     7ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     7ed:	5b                   	pop    %ebx
+     7ee:	5e                   	pop    %esi
+     7ef:	5d                   	pop    %ebp
+  return _fork();
+     7f0:	e9 15 04 00 00       	jmp    c0a <_fork>
+     7f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000800 <exit>:
+{
+     800:	55                   	push   %ebp
+     801:	89 e5                	mov    %esp,%ebp
+     803:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+     806:	e8 55 ff ff ff       	call   760 <fflushall>
+  _exit();
+     80b:	e8 01 04 00 00       	call   c11 <_exit>
+
+00000810 <exec>:
+{
+     810:	55                   	push   %ebp
+     811:	89 e5                	mov    %esp,%ebp
+     813:	57                   	push   %edi
+     814:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     815:	31 f6                	xor    %esi,%esi
+{
+     817:	53                   	push   %ebx
+     818:	bb e8 1d 00 00       	mov    $0x1de8,%ebx
+     81d:	83 ec 1c             	sub    $0x1c,%esp
+     820:	8b 45 08             	mov    0x8(%ebp),%eax
+     823:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     826:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     829:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     830:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     833:	85 c0                	test   %eax,%eax
+     835:	7e 15                	jle    84c <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     837:	83 ec 04             	sub    $0x4,%esp
+     83a:	50                   	push   %eax
+     83b:	53                   	push   %ebx
+     83c:	56                   	push   %esi
+     83d:	e8 eb 03 00 00       	call   c2d <write>
+    ob[fd].n = 0;
+     842:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     849:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     84c:	83 c6 01             	add    $0x1,%esi
+     84f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     855:	83 fe 10             	cmp    $0x10,%esi
+     858:	75 d6                	jne    830 <exec+0x20>
+  return _exec(path, argv);
+     85a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     85d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+     860:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     863:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     866:	5b                   	pop    %ebx
+     867:	5e                   	pop    %esi
+     868:	5f                   	pop    %edi
+     869:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     86a:	e9 d3 03 00 00       	jmp    c42 <_exec>
+     86f:	90                   	nop
+
+00000870 <close>:
+{
+     870:	55                   	push   %ebp
+     871:	89 e5                	mov    %esp,%ebp
+     873:	56                   	push   %esi
+     874:	53                   	push   %ebx
+     875:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     878:	83 fb 0f             	cmp    $0xf,%ebx
+     87b:	77 26                	ja     8a3 <close+0x33>
+     87d:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     883:	8b 90 e4 1d 00 00    	mov    0x1de4(%eax),%edx
+     889:	8d b0 e0 1d 00 00    	lea    0x1de0(%eax),%esi
+     88f:	85 d2                	test   %edx,%edx
+     891:	7f 25                	jg     8b8 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+     893:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     899:	c7 80 e0 1d 00 00 00 	movl   $0x0,0x1de0(%eax)
+     8a0:	00 00 00 
+  return _close(fd);
+     8a3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     8a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     8a9:	5b                   	pop    %ebx
+     8aa:	5e                   	pop    %esi
+     8ab:	5d                   	pop    %ebp
+  return _close(fd);
+     8ac:	e9 83 03 00 00       	jmp    c34 <_close>
+     8b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     8b8:	83 ec 04             	sub    $0x4,%esp
+     8bb:	05 e8 1d 00 00       	add    $0x1de8,%eax
+     8c0:	52                   	push   %edx
+     8c1:	50                   	push   %eax
+     8c2:	53                   	push   %ebx
+     8c3:	e8 65 03 00 00       	call   c2d <write>
+    ob[fd].n = 0;
+     8c8:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+     8cf:	83 c4 10             	add    $0x10,%esp
+     8d2:	eb bf                	jmp    893 <close+0x23>
+     8d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     8df:	90                   	nop
+
+000008e0 <strcpy>:
+{
+     8e0:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+     8e1:	31 c0                	xor    %eax,%eax
+{
+     8e3:	89 e5                	mov    %esp,%ebp
+     8e5:	53                   	push   %ebx
+     8e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     8e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     8ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     8f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     8f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     8f7:	83 c0 01             	add    $0x1,%eax
+     8fa:	84 d2                	test   %dl,%dl
+     8fc:	75 f2                	jne    8f0 <strcpy+0x10>
+}
+     8fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     901:	89 c8                	mov    %ecx,%eax
+     903:	c9                   	leave
+     904:	c3                   	ret
+     905:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     90c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000910 <strcmp>:
+{
+     910:	55                   	push   %ebp
+     911:	89 e5                	mov    %esp,%ebp
+     913:	53                   	push   %ebx
+     914:	8b 55 08             	mov    0x8(%ebp),%edx
+     917:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     91a:	0f b6 02             	movzbl (%edx),%eax
+     91d:	84 c0                	test   %al,%al
+     91f:	75 17                	jne    938 <strcmp+0x28>
+     921:	eb 3a                	jmp    95d <strcmp+0x4d>
+     923:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     927:	90                   	nop
+     928:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     92c:	83 c2 01             	add    $0x1,%edx
+     92f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     932:	84 c0                	test   %al,%al
+     934:	74 1a                	je     950 <strcmp+0x40>
+    p++, q++;
+     936:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     938:	0f b6 19             	movzbl (%ecx),%ebx
+     93b:	38 c3                	cmp    %al,%bl
+     93d:	74 e9                	je     928 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     93f:	29 d8                	sub    %ebx,%eax
+}
+     941:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     944:	c9                   	leave
+     945:	c3                   	ret
+     946:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     94d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     950:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     954:	31 c0                	xor    %eax,%eax
+     956:	29 d8                	sub    %ebx,%eax
+}
+     958:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     95b:	c9                   	leave
+     95c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     95d:	0f b6 19             	movzbl (%ecx),%ebx
+     960:	31 c0                	xor    %eax,%eax
+     962:	eb db                	jmp    93f <strcmp+0x2f>
+     964:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     96b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     96f:	90                   	nop
+
+00000970 <strlen>:
+{
+     970:	55                   	push   %ebp
+     971:	89 e5                	mov    %esp,%ebp
+     973:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+     976:	80 3a 00             	cmpb   $0x0,(%edx)
+     979:	74 15                	je     990 <strlen+0x20>
+     97b:	31 c0                	xor    %eax,%eax
+     97d:	8d 76 00             	lea    0x0(%esi),%esi
+     980:	83 c0 01             	add    $0x1,%eax
+     983:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     987:	89 c1                	mov    %eax,%ecx
+     989:	75 f5                	jne    980 <strlen+0x10>
+}
+     98b:	89 c8                	mov    %ecx,%eax
+     98d:	5d                   	pop    %ebp
+     98e:	c3                   	ret
+     98f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     990:	31 c9                	xor    %ecx,%ecx
+}
+     992:	5d                   	pop    %ebp
+     993:	89 c8                	mov    %ecx,%eax
+     995:	c3                   	ret
+     996:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     99d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009a0 <memset>:
+{
+     9a0:	55                   	push   %ebp
+     9a1:	89 e5                	mov    %esp,%ebp
+     9a3:	57                   	push   %edi
+     9a4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     9a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     9aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+     9ad:	89 d7                	mov    %edx,%edi
+     9af:	fc                   	cld
+     9b0:	f3 aa                	rep stos %al,%es:(%edi)
+}
+     9b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     9b5:	89 d0                	mov    %edx,%eax
+     9b7:	c9                   	leave
+     9b8:	c3                   	ret
+     9b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000009c0 <strchr>:
+{
+     9c0:	55                   	push   %ebp
+     9c1:	89 e5                	mov    %esp,%ebp
+     9c3:	8b 45 08             	mov    0x8(%ebp),%eax
+     9c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     9ca:	0f b6 10             	movzbl (%eax),%edx
+     9cd:	84 d2                	test   %dl,%dl
+     9cf:	75 12                	jne    9e3 <strchr+0x23>
+     9d1:	eb 1d                	jmp    9f0 <strchr+0x30>
+     9d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     9d7:	90                   	nop
+     9d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     9dc:	83 c0 01             	add    $0x1,%eax
+     9df:	84 d2                	test   %dl,%dl
+     9e1:	74 0d                	je     9f0 <strchr+0x30>
+    if(*s == c)
+     9e3:	38 d1                	cmp    %dl,%cl
+     9e5:	75 f1                	jne    9d8 <strchr+0x18>
+}
+     9e7:	5d                   	pop    %ebp
+     9e8:	c3                   	ret
+     9e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     9f0:	31 c0                	xor    %eax,%eax
+}
+     9f2:	5d                   	pop    %ebp
+     9f3:	c3                   	ret
+     9f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     9ff:	90                   	nop
+
+00000a00 <memchr>:
+{
+     a00:	55                   	push   %ebp
+     a01:	89 e5                	mov    %esp,%ebp
+     a03:	8b 55 10             	mov    0x10(%ebp),%edx
+     a06:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     a09:	85 d2                	test   %edx,%edx
+     a0b:	74 1b                	je     a28 <memchr+0x28>
+    if(*p == (char)c)
+     a0d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+     a11:	01 c2                	add    %eax,%edx
+     a13:	eb 0a                	jmp    a1f <memchr+0x1f>
+     a15:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+     a18:	83 c0 01             	add    $0x1,%eax
+     a1b:	39 c2                	cmp    %eax,%edx
+     a1d:	74 09                	je     a28 <memchr+0x28>
+    if(*p == (char)c)
+     a1f:	38 08                	cmp    %cl,(%eax)
+     a21:	75 f5                	jne    a18 <memchr+0x18>
+}
+     a23:	5d                   	pop    %ebp
+     a24:	c3                   	ret
+     a25:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+     a28:	31 c0                	xor    %eax,%eax
+}
+     a2a:	5d                   	pop    %ebp
+     a2b:	c3                   	ret
+     a2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a30 <gets>:
+{
+     a30:	55                   	push   %ebp
+     a31:	89 e5                	mov    %esp,%ebp
+     a33:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+     a34:	31 ff                	xor    %edi,%edi
+{
+     a36:	56                   	push   %esi
+     a37:	be e8 1d 00 00       	mov    $0x1de8,%esi
+     a3c:	53                   	push   %ebx
+     a3d:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     a40:	8b 46 fc             	mov    -0x4(%esi),%eax
+     a43:	85 c0                	test   %eax,%eax
+     a45:	7e 15                	jle    a5c <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     a47:	83 ec 04             	sub    $0x4,%esp
+     a4a:	50                   	push   %eax
+     a4b:	56                   	push   %esi
+     a4c:	57                   	push   %edi
+     a4d:	e8 db 01 00 00       	call   c2d <write>
+    ob[fd].n = 0;
+     a52:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+     a59:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     a5c:	83 c7 01             	add    $0x1,%edi
+     a5f:	81 c6 08 01 00 00    	add    $0x108,%esi
+     a65:	83 ff 10             	cmp    $0x10,%edi
+     a68:	75 d6                	jne    a40 <gets+0x10>
+  for(i=0; i+1 < max; ){
+     a6a:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+     a6c:	8d 75 e7             	lea    -0x19(%ebp),%esi
+     a6f:	eb 2e                	jmp    a9f <gets+0x6f>
+     a71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a78:	83 ec 04             	sub    $0x4,%esp
+     a7b:	6a 01                	push   $0x1
+     a7d:	56                   	push   %esi
+     a7e:	6a 00                	push   $0x0
+     a80:	e8 a1 01 00 00       	call   c26 <read>
+    if(cc < 1)
+     a85:	83 c4 10             	add    $0x10,%esp
+     a88:	85 c0                	test   %eax,%eax
+     a8a:	7e 1d                	jle    aa9 <gets+0x79>
+    buf[i++] = c;
+     a8c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     a90:	8b 55 08             	mov    0x8(%ebp),%edx
+     a93:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     a97:	3c 0a                	cmp    $0xa,%al
+     a99:	74 10                	je     aab <gets+0x7b>
+     a9b:	3c 0d                	cmp    $0xd,%al
+     a9d:	74 0c                	je     aab <gets+0x7b>
+  for(i=0; i+1 < max; ){
+     a9f:	89 df                	mov    %ebx,%edi
+     aa1:	83 c3 01             	add    $0x1,%ebx
+     aa4:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     aa7:	7c cf                	jl     a78 <gets+0x48>
+     aa9:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     aab:	8b 45 08             	mov    0x8(%ebp),%eax
+     aae:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     ab2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ab5:	5b                   	pop    %ebx
+     ab6:	5e                   	pop    %esi
+     ab7:	5f                   	pop    %edi
+     ab8:	5d                   	pop    %ebp
+     ab9:	c3                   	ret
+     aba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ac0 <stat>:
+{
+     ac0:	55                   	push   %ebp
+     ac1:	89 e5                	mov    %esp,%ebp
+     ac3:	57                   	push   %edi
+     ac4:	56                   	push   %esi
+     ac5:	53                   	push   %ebx
+     ac6:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+     ac9:	6a 00                	push   $0x0
+     acb:	ff 75 08             	push   0x8(%ebp)
+     ace:	e8 76 01 00 00       	call   c49 <open>
+  if(fd < 0)
+     ad3:	83 c4 10             	add    $0x10,%esp
+     ad6:	85 c0                	test   %eax,%eax
+     ad8:	78 76                	js     b50 <stat+0x90>
+  r = fstat(fd, st);
+     ada:	83 ec 08             	sub    $0x8,%esp
+     add:	ff 75 0c             	push   0xc(%ebp)
+     ae0:	89 c3                	mov    %eax,%ebx
+     ae2:	50                   	push   %eax
+     ae3:	e8 7f 01 00 00       	call   c67 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     ae8:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     aeb:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     aed:	83 fb 0f             	cmp    $0xf,%ebx
+     af0:	7f 40                	jg     b32 <stat+0x72>
+     af2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     af8:	8b 90 e4 1d 00 00    	mov    0x1de4(%eax),%edx
+     afe:	8d b8 e0 1d 00 00    	lea    0x1de0(%eax),%edi
+     b04:	85 d2                	test   %edx,%edx
+     b06:	7e 1a                	jle    b22 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+     b08:	83 ec 04             	sub    $0x4,%esp
+     b0b:	05 e8 1d 00 00       	add    $0x1de8,%eax
+     b10:	52                   	push   %edx
+     b11:	50                   	push   %eax
+     b12:	53                   	push   %ebx
+     b13:	e8 15 01 00 00       	call   c2d <write>
+    ob[fd].n = 0;
+     b18:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+     b1f:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+     b22:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     b28:	c7 80 e0 1d 00 00 00 	movl   $0x0,0x1de0(%eax)
+     b2f:	00 00 00 
+  return _close(fd);
+     b32:	83 ec 0c             	sub    $0xc,%esp
+     b35:	53                   	push   %ebx
+     b36:	e8 f9 00 00 00       	call   c34 <_close>
+     b3b:	83 c4 10             	add    $0x10,%esp
+}
+     b3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b41:	89 f0                	mov    %esi,%eax
+     b43:	5b                   	pop    %ebx
+     b44:	5e                   	pop    %esi
+     b45:	5f                   	pop    %edi
+     b46:	5d                   	pop    %ebp
+     b47:	c3                   	ret
+     b48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b4f:	90                   	nop
+    return -1;
+     b50:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     b55:	eb e7                	jmp    b3e <stat+0x7e>
+     b57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b5e:	66 90                	xchg   %ax,%ax
+
+00000b60 <atoi>:
+{
+     b60:	55                   	push   %ebp
+     b61:	89 e5                	mov    %esp,%ebp
+     b63:	53                   	push   %ebx
+     b64:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     b67:	0f be 02             	movsbl (%edx),%eax
+     b6a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     b6d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     b70:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     b75:	77 1e                	ja     b95 <atoi+0x35>
+     b77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b7e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     b80:	83 c2 01             	add    $0x1,%edx
+     b83:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     b86:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     b8a:	0f be 02             	movsbl (%edx),%eax
+     b8d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     b90:	80 fb 09             	cmp    $0x9,%bl
+     b93:	76 eb                	jbe    b80 <atoi+0x20>
+}
+     b95:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b98:	89 c8                	mov    %ecx,%eax
+     b9a:	c9                   	leave
+     b9b:	c3                   	ret
+     b9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ba0 <memmove>:
+{
+     ba0:	55                   	push   %ebp
+     ba1:	89 e5                	mov    %esp,%ebp
+     ba3:	57                   	push   %edi
+     ba4:	56                   	push   %esi
+     ba5:	8b 45 10             	mov    0x10(%ebp),%eax
+     ba8:	8b 55 08             	mov    0x8(%ebp),%edx
+     bab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     bae:	85 c0                	test   %eax,%eax
+     bb0:	7e 13                	jle    bc5 <memmove+0x25>
+     bb2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     bb4:	89 d7                	mov    %edx,%edi
+     bb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bbd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     bc0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     bc1:	39 f8                	cmp    %edi,%eax
+     bc3:	75 fb                	jne    bc0 <memmove+0x20>
+  return vdst;
+}
+     bc5:	5e                   	pop    %esi
+     bc6:	89 d0                	mov    %edx,%eax
+     bc8:	5f                   	pop    %edi
+     bc9:	5d                   	pop    %ebp
+     bca:	c3                   	ret
+
+00000bcb <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+     bcb:	83 3d d8 1d 00 00 00 	cmpl   $0x0,0x1dd8
+  jle 1f
+     bd2:	7e 0a                	jle    bde <syscallentry+0x13>
+  movl %esp, %ecx
+     bd4:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+     bd6:	ba dd 0b 00 00       	mov    $0xbdd,%edx
+  sysenter
+     bdb:	0f 34                	sysenter
+2:
+  ret
+     bdd:	c3                   	ret
+1:
+  jl 3f
+     bde:	7c 27                	jl     c07 <syscallentry+0x3c>
+  pushal
+     be0:	60                   	pusha
+  movl $1, %eax
+     be1:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     be6:	0f a2                	cpuid
+  movl $-1, sysentermode
+     be8:	c7 05 d8 1d 00 00 ff 	movl   $0xffffffff,0x1dd8
+     bef:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     bf2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+     bf8:	74 0a                	je     c04 <syscallentry+0x39>
+  movl $1, sysentermode
+     bfa:	c7 05 d8 1d 00 00 01 	movl   $0x1,0x1dd8
+     c01:	00 00 00 
+4:
+  popal
+     c04:	61                   	popa
+  jmp syscallentry
+     c05:	eb c4                	jmp    bcb <syscallentry>
+3:
+  int $T_SYSCALL
+     c07:	cd 40                	int    $0x40
+  ret
+     c09:	c3                   	ret
+
+00000c0a <_fork>:
+
+SYSCALLAS(_fork, fork)
+     c0a:	b8 01 00 00 00       	mov    $0x1,%eax
+     c0f:	eb ba                	jmp    bcb <syscallentry>
+
+00000c11 <_exit>:
+SYSCALLAS(_exit, exit)
+     c11:	b8 02 00 00 00       	mov    $0x2,%eax
+     c16:	eb b3                	jmp    bcb <syscallentry>
+
+00000c18 <wait>:
+SYSCALL(wait)
+     c18:	b8 03 00 00 00       	mov    $0x3,%eax
+     c1d:	eb ac                	jmp    bcb <syscallentry>
+
+00000c1f <pipe>:
+SYSCALL(pipe)
+     c1f:	b8 04 00 00 00       	mov    $0x4,%eax
+     c24:	eb a5                	jmp    bcb <syscallentry>
+
+00000c26 <read>:
+SYSCALL(read)
+     c26:	b8 05 00 00 00       	mov    $0x5,%eax
+     c2b:	eb 9e                	jmp    bcb <syscallentry>
+
+00000c2d <write>:
+SYSCALL(write)
+     c2d:	b8 10 00 00 00       	mov    $0x10,%eax
+     c32:	eb 97                	jmp    bcb <syscallentry>
+
+00000c34 <_close>:
+SYSCALLAS(_close, close)
+     c34:	b8 15 00 00 00       	mov    $0x15,%eax
+     c39:	eb 90                	jmp    bcb <syscallentry>
+
+00000c3b <kill>:
+SYSCALL(kill)
+     c3b:	b8 06 00 00 00       	mov    $0x6,%eax
+     c40:	eb 89                	jmp    bcb <syscallentry>
+
+00000c42 <_exec>:
+SYSCALLAS(_exec, exec)
+     c42:	b8 07 00 00 00       	mov    $0x7,%eax
+     c47:	eb 82                	jmp    bcb <syscallentry>
+
+00000c49 <open>:
+SYSCALL(open)
+     c49:	b8 0f 00 00 00       	mov    $0xf,%eax
+     c4e:	e9 78 ff ff ff       	jmp    bcb <syscallentry>
+
+00000c53 <mknod>:
+SYSCALL(mknod)
+     c53:	b8 11 00 00 00       	mov    $0x11,%eax
+     c58:	e9 6e ff ff ff       	jmp    bcb <syscallentry>
+
+00000c5d <unlink>:
+SYSCALL(unlink)
+     c5d:	b8 12 00 00 00       	mov    $0x12,%eax
+     c62:	e9 64 ff ff ff       	jmp    bcb <syscallentry>
+
+00000c67 <fstat>:
+SYSCALL(fstat)
+     c67:	b8 08 00 00 00       	mov    $0x8,%eax
+     c6c:	e9 5a ff ff ff       	jmp    bcb <syscallentry>
+
+00000c71 <link>:
+SYSCALL(link)
+     c71:	b8 13 00 00 00       	mov    $0x13,%eax
+     c76:	e9 50 ff ff ff       	jmp    bcb <syscallentry>
+
+00000c7b <mkdir>:
+SYSCALL(mkdir)
+     c7b:	b8 14 00 00 00       	mov    $0x14,%eax
+     c80:	e9 46 ff ff ff       	jmp    bcb <syscallentry>
+
+00000c85 <chdir>:
+SYSCALL(chdir)
+     c85:	b8 09 00 00 00       	mov    $0x9,%eax
+     c8a:	e9 3c ff ff ff       	jmp    bcb <syscallentry>
+
+00000c8f <dup>:
+SYSCALL(dup)
+     c8f:	b8 0a 00 00 00       	mov    $0xa,%eax
+     c94:	e9 32 ff ff ff       	jmp    bcb <syscallentry>
+
+00000c99 <getpid>:
+SYSCALL(getpid)
+     c99:	b8 0b 00 00 00       	mov    $0xb,%eax
+     c9e:	e9 28 ff ff ff       	jmp    bcb <syscallentry>
+
+00000ca3 <sbrk>:
+SYSCALL(sbrk)
+     ca3:	b8 0c 00 00 00       	mov    $0xc,%eax
+     ca8:	e9 1e ff ff ff       	jmp    bcb <syscallentry>
+
+00000cad <sleep>:
+SYSCALL(sleep)
+     cad:	b8 0d 00 00 00       	mov    $0xd,%eax
+     cb2:	e9 14 ff ff ff       	jmp    bcb <syscallentry>
+
+00000cb7 <uptime>:
+SYSCALL(uptime)
+     cb7:	b8 0e 00 00 00       	mov    $0xe,%eax
+     cbc:	e9 0a ff ff ff       	jmp    bcb <syscallentry>
+
+00000cc1 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+     cc1:	b8 16 00 00 00       	mov    $0x16,%eax
+     cc6:	e9 00 ff ff ff       	jmp    bcb <syscallentry>
+
+00000ccb <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+     ccb:	b8 17 00 00 00       	mov    $0x17,%eax
+     cd0:	e9 f6 fe ff ff       	jmp    bcb <syscallentry>
+
+00000cd5 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+     cd5:	b8 18 00 00 00       	mov    $0x18,%eax
+     cda:	e9 ec fe ff ff       	jmp    bcb <syscallentry>
+
+00000cdf <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+     cdf:	b8 19 00 00 00       	mov    $0x19,%eax
+     ce4:	e9 e2 fe ff ff       	jmp    bcb <syscallentry>
+
+00000ce9 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+     ce9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     cee:	e9 d8 fe ff ff       	jmp    bcb <syscallentry>
+
+00000cf3 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+     cf3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     cf8:	e9 ce fe ff ff       	jmp    bcb <syscallentry>
+
+00000cfd <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+     cfd:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     d02:	e9 c4 fe ff ff       	jmp    bcb <syscallentry>
+
+00000d07 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+     d07:	b8 20 00 00 00       	mov    $0x20,%eax
+     d0c:	e9 ba fe ff ff       	jmp    bcb <syscallentry>
+
+00000d11 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+     d11:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     d16:	e9 b0 fe ff ff       	jmp    bcb <syscallentry>
+
+00000d1b <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+     d1b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     d20:	e9 a6 fe ff ff       	jmp    bcb <syscallentry>
+
+00000d25 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+     d25:	b8 21 00 00 00       	mov    $0x21,%eax
+     d2a:	e9 9c fe ff ff       	jmp    bcb <syscallentry>
+
+00000d2f <yield>:
+SYSCALL(yield) // yield the CPU to another process
+     d2f:	b8 22 00 00 00       	mov    $0x22,%eax
+     d34:	e9 92 fe ff ff       	jmp    bcb <syscallentry>
+
+00000d39 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+     d39:	b8 23 00 00 00       	mov    $0x23,%eax
+     d3e:	e9 88 fe ff ff       	jmp    bcb <syscallentry>
+
+00000d43 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+     d43:	b8 24 00 00 00       	mov    $0x24,%eax
+     d48:	e9 7e fe ff ff       	jmp    bcb <syscallentry>
+
+00000d4d <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+     d4d:	b8 25 00 00 00       	mov    $0x25,%eax
+     d52:	e9 74 fe ff ff       	jmp    bcb <syscallentry>
+
+00000d57 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+     d57:	b8 26 00 00 00       	mov    $0x26,%eax
+     d5c:	e9 6a fe ff ff       	jmp    bcb <syscallentry>
+
+00000d61 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+     d61:	b8 27 00 00 00       	mov    $0x27,%eax
+     d66:	e9 60 fe ff ff       	jmp    bcb <syscallentry>
+
+00000d6b <mmap>:
+SYSCALL(mmap) // map a file into memory
+     d6b:	b8 28 00 00 00       	mov    $0x28,%eax
+     d70:	e9 56 fe ff ff       	jmp    bcb <syscallentry>
+
+00000d75 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+     d75:	b8 29 00 00 00       	mov    $0x29,%eax
+     d7a:	e9 4c fe ff ff       	jmp    bcb <syscallentry>
+
+00000d7f <readv>:
+SYSCALL(readv) // read into several buffers
+     d7f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     d84:	e9 42 fe ff ff       	jmp    bcb <syscallentry>
+
+00000d89 <writev>:
+SYSCALL(writev) // write from several buffers
+     d89:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     d8e:	e9 38 fe ff ff       	jmp    bcb <syscallentry>
+
+00000d93 <pread>:
+SYSCALL(pread) // read at an offset
+     d93:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     d98:	e9 2e fe ff ff       	jmp    bcb <syscallentry>
+
+00000d9d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+     d9d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     da2:	e9 24 fe ff ff       	jmp    bcb <syscallentry>
+
+00000da7 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+     da7:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     dac:	e9 1a fe ff ff       	jmp    bcb <syscallentry>
+
+00000db1 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+     db1:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     db6:	e9 10 fe ff ff       	jmp    bcb <syscallentry>
+
+00000dbb <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+     dbb:	b8 30 00 00 00       	mov    $0x30,%eax
+     dc0:	e9 06 fe ff ff       	jmp    bcb <syscallentry>
+
+00000dc5 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+     dc5:	b8 31 00 00 00       	mov    $0x31,%eax
+     dca:	e9 fc fd ff ff       	jmp    bcb <syscallentry>
+
+00000dcf <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+     dcf:	b8 32 00 00 00       	mov    $0x32,%eax
+     dd4:	e9 f2 fd ff ff       	jmp    bcb <syscallentry>
+
+00000dd9 <profread>:
+SYSCALL(profread) // drain profiler samples
+     dd9:	b8 33 00 00 00       	mov    $0x33,%eax
+     dde:	e9 e8 fd ff ff       	jmp    bcb <syscallentry>
+
+00000de3 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+     de3:	b8 34 00 00 00       	mov    $0x34,%eax
+     de8:	e9 de fd ff ff       	jmp    bcb <syscallentry>
+
+00000ded <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+     ded:	b8 35 00 00 00       	mov    $0x35,%eax
+     df2:	e9 d4 fd ff ff       	jmp    bcb <syscallentry>
+
+00000df7 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+     df7:	b8 36 00 00 00       	mov    $0x36,%eax
+     dfc:	e9 ca fd ff ff       	jmp    bcb <syscallentry>
+
+00000e01 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+     e01:	b8 37 00 00 00       	mov    $0x37,%eax
+     e06:	e9 c0 fd ff ff       	jmp    bcb <syscallentry>
+     e0b:	66 90                	xchg   %ax,%ax
+     e0d:	66 90                	xchg   %ax,%ax
+     e0f:	90                   	nop
+
+00000e10 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     e10:	55                   	push   %ebp
+     e11:	89 e5                	mov    %esp,%ebp
+     e13:	57                   	push   %edi
+     e14:	56                   	push   %esi
+     e15:	53                   	push   %ebx
+     e16:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     e18:	89 d1                	mov    %edx,%ecx
+{
+     e1a:	83 ec 3c             	sub    $0x3c,%esp
+     e1d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     e20:	85 d2                	test   %edx,%edx
+     e22:	0f 89 80 00 00 00    	jns    ea8 <printint+0x98>
+     e28:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     e2c:	74 7a                	je     ea8 <printint+0x98>
+    x = -xx;
+     e2e:	f7 d9                	neg    %ecx
+    neg = 1;
+     e30:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     e35:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     e38:	31 f6                	xor    %esi,%esi
+     e3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     e40:	89 c8                	mov    %ecx,%eax
+     e42:	31 d2                	xor    %edx,%edx
+     e44:	89 f7                	mov    %esi,%edi
+     e46:	f7 f3                	div    %ebx
+     e48:	8d 76 01             	lea    0x1(%esi),%esi
+     e4b:	0f b6 92 28 19 00 00 	movzbl 0x1928(%edx),%edx
+     e52:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     e56:	89 ca                	mov    %ecx,%edx
+     e58:	89 c1                	mov    %eax,%ecx
+     e5a:	39 da                	cmp    %ebx,%edx
+     e5c:	73 e2                	jae    e40 <printint+0x30>
+  if(neg)
+     e5e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     e61:	85 c0                	test   %eax,%eax
+     e63:	74 07                	je     e6c <printint+0x5c>
+    buf[i++] = '-';
+     e65:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     e6a:	89 f7                	mov    %esi,%edi
+     e6c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     e6f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     e72:	01 df                	add    %ebx,%edi
+     e74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     e78:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+     e7b:	83 ec 04             	sub    $0x4,%esp
+     e7e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     e81:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     e84:	6a 01                	push   $0x1
+     e86:	50                   	push   %eax
+     e87:	56                   	push   %esi
+     e88:	e8 e3 f6 ff ff       	call   570 <bufwrite>
+  while(--i >= 0)
+     e8d:	89 f8                	mov    %edi,%eax
+     e8f:	83 c4 10             	add    $0x10,%esp
+     e92:	83 ef 01             	sub    $0x1,%edi
+     e95:	39 d8                	cmp    %ebx,%eax
+     e97:	75 df                	jne    e78 <printint+0x68>
+}
+     e99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e9c:	5b                   	pop    %ebx
+     e9d:	5e                   	pop    %esi
+     e9e:	5f                   	pop    %edi
+     e9f:	5d                   	pop    %ebp
+     ea0:	c3                   	ret
+     ea1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     ea8:	31 c0                	xor    %eax,%eax
+     eaa:	eb 89                	jmp    e35 <printint+0x25>
+     eac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000eb0 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     eb0:	55                   	push   %ebp
+     eb1:	89 e5                	mov    %esp,%ebp
+     eb3:	57                   	push   %edi
+     eb4:	56                   	push   %esi
+     eb5:	53                   	push   %ebx
+     eb6:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     eb9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     ebc:	0f b6 18             	movzbl (%eax),%ebx
+     ebf:	84 db                	test   %bl,%bl
+     ec1:	74 6c                	je     f2f <printf+0x7f>
+     ec3:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+     ec6:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+     ec9:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     ecb:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     ece:	eb 26                	jmp    ef6 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     ed0:	83 f8 25             	cmp    $0x25,%eax
+     ed3:	74 4b                	je     f20 <printf+0x70>
+  bufwrite(fd, &c, 1);
+     ed5:	83 ec 04             	sub    $0x4,%esp
+     ed8:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     edb:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     ede:	6a 01                	push   $0x1
+     ee0:	50                   	push   %eax
+     ee1:	ff 75 08             	push   0x8(%ebp)
+     ee4:	e8 87 f6 ff ff       	call   570 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+     ee9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     eec:	0f b6 1f             	movzbl (%edi),%ebx
+     eef:	83 c7 01             	add    $0x1,%edi
+     ef2:	84 db                	test   %bl,%bl
+     ef4:	74 39                	je     f2f <printf+0x7f>
+    c = fmt[i] & 0xff;
+     ef6:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     ef9:	85 f6                	test   %esi,%esi
+     efb:	74 d3                	je     ed0 <printf+0x20>
+      }
+    } else if(state == '%'){
+     efd:	83 fe 25             	cmp    $0x25,%esi
+     f00:	75 ea                	jne    eec <printf+0x3c>
+      if(c == 'd'){
+     f02:	83 f8 25             	cmp    $0x25,%eax
+     f05:	0f 84 d5 01 00 00    	je     10e0 <printf+0x230>
+     f0b:	83 e8 63             	sub    $0x63,%eax
+     f0e:	83 f8 15             	cmp    $0x15,%eax
+     f11:	77 45                	ja     f58 <printf+0xa8>
+     f13:	ff 24 85 d0 18 00 00 	jmp    *0x18d0(,%eax,4)
+     f1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     f20:	0f b6 1f             	movzbl (%edi),%ebx
+     f23:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+     f26:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     f2b:	84 db                	test   %bl,%bl
+     f2d:	75 c7                	jne    ef6 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+     f2f:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+     f33:	74 0b                	je     f40 <printf+0x90>
+    fflush(fd);
+}
+     f35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f38:	5b                   	pop    %ebx
+     f39:	5e                   	pop    %esi
+     f3a:	5f                   	pop    %edi
+     f3b:	5d                   	pop    %ebp
+     f3c:	c3                   	ret
+     f3d:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+     f40:	83 ec 0c             	sub    $0xc,%esp
+     f43:	6a 02                	push   $0x2
+     f45:	e8 c6 f7 ff ff       	call   710 <fflush>
+     f4a:	83 c4 10             	add    $0x10,%esp
+}
+     f4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f50:	5b                   	pop    %ebx
+     f51:	5e                   	pop    %esi
+     f52:	5f                   	pop    %edi
+     f53:	5d                   	pop    %ebp
+     f54:	c3                   	ret
+     f55:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+     f58:	83 ec 04             	sub    $0x4,%esp
+     f5b:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     f5e:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+     f62:	6a 01                	push   $0x1
+     f64:	52                   	push   %edx
+     f65:	89 55 c0             	mov    %edx,-0x40(%ebp)
+     f68:	ff 75 08             	push   0x8(%ebp)
+     f6b:	e8 00 f6 ff ff       	call   570 <bufwrite>
+     f70:	83 c4 0c             	add    $0xc,%esp
+     f73:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     f76:	6a 01                	push   $0x1
+     f78:	8b 55 c0             	mov    -0x40(%ebp),%edx
+     f7b:	52                   	push   %edx
+      state = 0;
+     f7c:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+     f7e:	ff 75 08             	push   0x8(%ebp)
+     f81:	e8 ea f5 ff ff       	call   570 <bufwrite>
+        putc(fd, c);
+     f86:	83 c4 10             	add    $0x10,%esp
+     f89:	e9 5e ff ff ff       	jmp    eec <printf+0x3c>
+     f8e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+     f90:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     f93:	83 ec 0c             	sub    $0xc,%esp
+     f96:	b9 10 00 00 00       	mov    $0x10,%ecx
+     f9b:	8b 16                	mov    (%esi),%edx
+     f9d:	6a 00                	push   $0x0
+     f9f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+     fa2:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+     fa5:	e8 66 fe ff ff       	call   e10 <printint>
+        ap++;
+     faa:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     fad:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     fb0:	31 f6                	xor    %esi,%esi
+     fb2:	e9 35 ff ff ff       	jmp    eec <printf+0x3c>
+     fb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fbe:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     fc0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     fc3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     fc5:	83 c0 04             	add    $0x4,%eax
+     fc8:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+     fcb:	b8 c8 18 00 00       	mov    $0x18c8,%eax
+     fd0:	85 db                	test   %ebx,%ebx
+     fd2:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+     fd5:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+     fd8:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+     fda:	53                   	push   %ebx
+     fdb:	e8 90 f9 ff ff       	call   970 <strlen>
+     fe0:	83 c4 0c             	add    $0xc,%esp
+     fe3:	50                   	push   %eax
+     fe4:	53                   	push   %ebx
+     fe5:	ff 75 08             	push   0x8(%ebp)
+     fe8:	e8 83 f5 ff ff       	call   570 <bufwrite>
+     fed:	83 c4 10             	add    $0x10,%esp
+     ff0:	e9 f7 fe ff ff       	jmp    eec <printf+0x3c>
+     ff5:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+     ff8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+     ffb:	83 ec 04             	sub    $0x4,%esp
+     ffe:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+    1001:	8b 06                	mov    (%esi),%eax
+        ap++;
+    1003:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+    1006:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+    1009:	6a 01                	push   $0x1
+    100b:	52                   	push   %edx
+    100c:	ff 75 08             	push   0x8(%ebp)
+    100f:	e8 5c f5 ff ff       	call   570 <bufwrite>
+        ap++;
+    1014:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+    1017:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    101a:	31 f6                	xor    %esi,%esi
+    101c:	e9 cb fe ff ff       	jmp    eec <printf+0x3c>
+    1021:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+    1028:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+    102b:	83 ec 0c             	sub    $0xc,%esp
+    102e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    1033:	8b 16                	mov    (%esi),%edx
+    1035:	6a 01                	push   $0x1
+    1037:	e9 63 ff ff ff       	jmp    f9f <printf+0xef>
+    103c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+    1040:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1043:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+    1046:	89 7d c0             	mov    %edi,-0x40(%ebp)
+    1049:	89 55 bc             	mov    %edx,-0x44(%ebp)
+    104c:	8b 18                	mov    (%eax),%ebx
+    104e:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+    1051:	31 c0                	xor    %eax,%eax
+    1053:	89 c7                	mov    %eax,%edi
+    1055:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+    1058:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+    105d:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+    105f:	f7 e1                	mul    %ecx
+    1061:	c1 ea 03             	shr    $0x3,%edx
+    1064:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    1067:	89 d1                	mov    %edx,%ecx
+    1069:	01 c0                	add    %eax,%eax
+    106b:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+    106d:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+    106f:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+    1071:	be 0a 00 00 00       	mov    $0xa,%esi
+    1076:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+    1078:	89 da                	mov    %ebx,%edx
+    107a:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+    107c:	89 fe                	mov    %edi,%esi
+    107e:	83 c7 01             	add    $0x1,%edi
+    1081:	8d 42 30             	lea    0x30(%edx),%eax
+    1084:	89 da                	mov    %ebx,%edx
+    1086:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    1089:	01 d2                	add    %edx,%edx
+    108b:	29 d0                	sub    %edx,%eax
+    108d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+    1091:	89 c8                	mov    %ecx,%eax
+    1093:	09 d8                	or     %ebx,%eax
+    1095:	75 c1                	jne    1058 <printf+0x1a8>
+    1097:	8b 55 bc             	mov    -0x44(%ebp),%edx
+    109a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    109d:	01 d6                	add    %edx,%esi
+    109f:	89 f7                	mov    %esi,%edi
+    10a1:	89 d6                	mov    %edx,%esi
+    10a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10a7:	90                   	nop
+    putc(fd, buf[i]);
+    10a8:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+    10ab:	83 ec 04             	sub    $0x4,%esp
+    10ae:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+    10b1:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+    10b4:	6a 01                	push   $0x1
+    10b6:	50                   	push   %eax
+    10b7:	53                   	push   %ebx
+    10b8:	e8 b3 f4 ff ff       	call   570 <bufwrite>
+  while(--i >= 0)
+    10bd:	89 fa                	mov    %edi,%edx
+    10bf:	83 c4 10             	add    $0x10,%esp
+    10c2:	83 ef 01             	sub    $0x1,%edi
+    10c5:	39 d6                	cmp    %edx,%esi
+    10c7:	75 df                	jne    10a8 <printf+0x1f8>
+        ap += 2;
+    10c9:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+    10cd:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+    10d0:	31 f6                	xor    %esi,%esi
+    10d2:	e9 15 fe ff ff       	jmp    eec <printf+0x3c>
+    10d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10de:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+    10e0:	83 ec 04             	sub    $0x4,%esp
+    10e3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+    10e6:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+    10e9:	6a 01                	push   $0x1
+    10eb:	e9 8b fe ff ff       	jmp    f7b <printf+0xcb>
+
+000010f0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    10f0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    10f1:	a1 60 2e 00 00       	mov    0x2e60,%eax
+{
+    10f6:	89 e5                	mov    %esp,%ebp
+    10f8:	57                   	push   %edi
+    10f9:	56                   	push   %esi
+    10fa:	53                   	push   %ebx
+    10fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    10fe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1101:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1108:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    110a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    110c:	39 ca                	cmp    %ecx,%edx
+    110e:	73 30                	jae    1140 <free+0x50>
+    1110:	39 c1                	cmp    %eax,%ecx
+    1112:	72 04                	jb     1118 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1114:	39 c2                	cmp    %eax,%edx
+    1116:	72 f0                	jb     1108 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1118:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    111b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    111e:	39 f8                	cmp    %edi,%eax
+    1120:	74 2e                	je     1150 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1122:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1125:	8b 42 04             	mov    0x4(%edx),%eax
+    1128:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    112b:	39 f1                	cmp    %esi,%ecx
+    112d:	74 38                	je     1167 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    112f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1131:	5b                   	pop    %ebx
+  freep = p;
+    1132:	89 15 60 2e 00 00    	mov    %edx,0x2e60
+}
+    1138:	5e                   	pop    %esi
+    1139:	5f                   	pop    %edi
+    113a:	5d                   	pop    %ebp
+    113b:	c3                   	ret
+    113c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1140:	39 c1                	cmp    %eax,%ecx
+    1142:	72 d0                	jb     1114 <free+0x24>
+    1144:	eb c2                	jmp    1108 <free+0x18>
+    1146:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    114d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1150:	03 70 04             	add    0x4(%eax),%esi
+    1153:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1156:	8b 02                	mov    (%edx),%eax
+    1158:	8b 00                	mov    (%eax),%eax
+    115a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    115d:	8b 42 04             	mov    0x4(%edx),%eax
+    1160:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1163:	39 f1                	cmp    %esi,%ecx
+    1165:	75 c8                	jne    112f <free+0x3f>
+    p->s.size += bp->s.size;
+    1167:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    116a:	89 15 60 2e 00 00    	mov    %edx,0x2e60
+    p->s.size += bp->s.size;
+    1170:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1173:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1176:	89 0a                	mov    %ecx,(%edx)
+}
+    1178:	5b                   	pop    %ebx
+    1179:	5e                   	pop    %esi
+    117a:	5f                   	pop    %edi
+    117b:	5d                   	pop    %ebp
+    117c:	c3                   	ret
+    117d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001180 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1180:	55                   	push   %ebp
+    1181:	89 e5                	mov    %esp,%ebp
+    1183:	57                   	push   %edi
+    1184:	56                   	push   %esi
+    1185:	53                   	push   %ebx
+    1186:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1189:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    118c:	8b 15 60 2e 00 00    	mov    0x2e60,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1192:	8d 78 07             	lea    0x7(%eax),%edi
+    1195:	c1 ef 03             	shr    $0x3,%edi
+    1198:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    119b:	85 d2                	test   %edx,%edx
+    119d:	0f 84 8d 00 00 00    	je     1230 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    11a3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    11a5:	8b 48 04             	mov    0x4(%eax),%ecx
+    11a8:	39 f9                	cmp    %edi,%ecx
+    11aa:	73 64                	jae    1210 <malloc+0x90>
+  if(nu < 4096)
+    11ac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    11b1:	39 df                	cmp    %ebx,%edi
+    11b3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    11b6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    11bd:	eb 0a                	jmp    11c9 <malloc+0x49>
+    11bf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    11c0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    11c2:	8b 48 04             	mov    0x4(%eax),%ecx
+    11c5:	39 f9                	cmp    %edi,%ecx
+    11c7:	73 47                	jae    1210 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    11c9:	89 c2                	mov    %eax,%edx
+    11cb:	39 05 60 2e 00 00    	cmp    %eax,0x2e60
+    11d1:	75 ed                	jne    11c0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    11d3:	83 ec 0c             	sub    $0xc,%esp
+    11d6:	56                   	push   %esi
+    11d7:	e8 c7 fa ff ff       	call   ca3 <sbrk>
+  if(p == (char*)-1)
+    11dc:	83 c4 10             	add    $0x10,%esp
+    11df:	83 f8 ff             	cmp    $0xffffffff,%eax
+    11e2:	74 1c                	je     1200 <malloc+0x80>
+  hp->s.size = nu;
+    11e4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    11e7:	83 ec 0c             	sub    $0xc,%esp
+    11ea:	83 c0 08             	add    $0x8,%eax
+    11ed:	50                   	push   %eax
+    11ee:	e8 fd fe ff ff       	call   10f0 <free>
+  return freep;
+    11f3:	8b 15 60 2e 00 00    	mov    0x2e60,%edx
+      if((p = morecore(nunits)) == 0)
+    11f9:	83 c4 10             	add    $0x10,%esp
+    11fc:	85 d2                	test   %edx,%edx
+    11fe:	75 c0                	jne    11c0 <malloc+0x40>
+        return 0;
+  }
+}
+    1200:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1203:	31 c0                	xor    %eax,%eax
+}
+    1205:	5b                   	pop    %ebx
+    1206:	5e                   	pop    %esi
+    1207:	5f                   	pop    %edi
+    1208:	5d                   	pop    %ebp
+    1209:	c3                   	ret
+    120a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1210:	39 cf                	cmp    %ecx,%edi
+    1212:	74 4c                	je     1260 <malloc+0xe0>
+        p->s.size -= nunits;
+    1214:	29 f9                	sub    %edi,%ecx
+    1216:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1219:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    121c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    121f:	89 15 60 2e 00 00    	mov    %edx,0x2e60
+}
+    1225:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1228:	83 c0 08             	add    $0x8,%eax
+}
+    122b:	5b                   	pop    %ebx
+    122c:	5e                   	pop    %esi
+    122d:	5f                   	pop    %edi
+    122e:	5d                   	pop    %ebp
+    122f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1230:	c7 05 60 2e 00 00 64 	movl   $0x2e64,0x2e60
+    1237:	2e 00 00 
+    base.s.size = 0;
+    123a:	b8 64 2e 00 00       	mov    $0x2e64,%eax
+    base.s.ptr = freep = prevp = &base;
+    123f:	c7 05 64 2e 00 00 64 	movl   $0x2e64,0x2e64
+    1246:	2e 00 00 
+    base.s.size = 0;
+    1249:	c7 05 68 2e 00 00 00 	movl   $0x0,0x2e68
+    1250:	00 00 00 
+    if(p->s.size >= nunits){
+    1253:	e9 54 ff ff ff       	jmp    11ac <malloc+0x2c>
+    1258:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    125f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1260:	8b 08                	mov    (%eax),%ecx
+    1262:	89 0a                	mov    %ecx,(%edx)
+    1264:	eb b9                	jmp    121f <malloc+0x9f>
+    1266:	66 90                	xchg   %ax,%ax
+    1268:	66 90                	xchg   %ax,%ax
+    126a:	66 90                	xchg   %ax,%ax
+    126c:	66 90                	xchg   %ax,%ax
+    126e:	66 90                	xchg   %ax,%ax
+
+00001270 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+    1270:	55                   	push   %ebp
+    1271:	89 e5                	mov    %esp,%ebp
+    1273:	57                   	push   %edi
+    1274:	56                   	push   %esi
+    1275:	be 01 00 00 00       	mov    $0x1,%esi
+    127a:	53                   	push   %ebx
+    127b:	83 ec 28             	sub    $0x28,%esp
+    127e:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1281:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1284:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+    1287:	68 00 98 00 00       	push   $0x9800
+    128c:	e8 ef fe ff ff       	call   1180 <malloc>
+    1291:	83 c4 10             	add    $0x10,%esp
+    1294:	89 c7                	mov    %eax,%edi
+    1296:	85 c0                	test   %eax,%eax
+    1298:	74 62                	je     12fc <waitpoll+0x8c>
+    129a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+    12a0:	83 ec 0c             	sub    $0xc,%esp
+    12a3:	6a 01                	push   $0x1
+    12a5:	e8 03 fa ff ff       	call   cad <sleep>
+    fn();
+    12aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    12ad:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+    12af:	58                   	pop    %eax
+    12b0:	5a                   	pop    %edx
+    12b1:	68 00 02 00 00       	push   $0x200
+    12b6:	57                   	push   %edi
+    12b7:	e8 eb fa ff ff       	call   da7 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+    12bc:	83 c4 10             	add    $0x10,%esp
+    12bf:	85 c0                	test   %eax,%eax
+    12c1:	7e 2d                	jle    12f0 <waitpoll+0x80>
+    12c3:	6b c0 4c             	imul   $0x4c,%eax,%eax
+    12c6:	89 fa                	mov    %edi,%edx
+    alive = 0;
+    12c8:	31 c9                	xor    %ecx,%ecx
+    12ca:	01 f8                	add    %edi,%eax
+    12cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+    12d0:	3b 1a                	cmp    (%edx),%ebx
+    12d2:	75 07                	jne    12db <waitpoll+0x6b>
+        alive = 1;
+    12d4:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+    12d8:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+    12db:	83 c2 4c             	add    $0x4c,%edx
+    12de:	39 d0                	cmp    %edx,%eax
+    12e0:	75 ee                	jne    12d0 <waitpoll+0x60>
+  } while(alive);
+    12e2:	85 c9                	test   %ecx,%ecx
+    12e4:	75 ba                	jne    12a0 <waitpoll+0x30>
+    12e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ed:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+    12f0:	83 ec 0c             	sub    $0xc,%esp
+    12f3:	57                   	push   %edi
+    12f4:	e8 f7 fd ff ff       	call   10f0 <free>
+  wait();
+    12f9:	83 c4 10             	add    $0x10,%esp
+}
+    12fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12ff:	5b                   	pop    %ebx
+    1300:	5e                   	pop    %esi
+    1301:	5f                   	pop    %edi
+    1302:	5d                   	pop    %ebp
+  wait();
+    1303:	e9 10 f9 ff ff       	jmp    c18 <wait>
+    1308:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    130f:	90                   	nop
+
+00001310 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+    1310:	55                   	push   %ebp
+    1311:	89 e5                	mov    %esp,%ebp
+    1313:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+    1316:	c7 45 f0 39 19 00 00 	movl   $0x1939,-0x10(%ebp)
+    131d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+    1324:	e8 87 f4 ff ff       	call   7b0 <fork>
+    1329:	85 c0                	test   %eax,%eax
+    132b:	78 09                	js     1336 <runps+0x26>
+    return -1;
+  if(pid == 0){
+    132d:	74 0e                	je     133d <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+    132f:	e8 e4 f8 ff ff       	call   c18 <wait>
+}
+    1334:	c9                   	leave
+    1335:	c3                   	ret
+    1336:	c9                   	leave
+    return -1;
+    1337:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    133c:	c3                   	ret
+    exec("ps", argv);
+    133d:	50                   	push   %eax
+    133e:	50                   	push   %eax
+    133f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    1342:	50                   	push   %eax
+    1343:	68 39 19 00 00       	push   $0x1939
+    1348:	e8 c3 f4 ff ff       	call   810 <exec>
+    printf(2, "exec ps failed\n");
+    134d:	5a                   	pop    %edx
+    134e:	59                   	pop    %ecx
+    134f:	68 3c 19 00 00       	push   $0x193c
+    1354:	6a 02                	push   $0x2
+    1356:	e8 55 fb ff ff       	call   eb0 <printf>
+    exit();
+    135b:	e8 a0 f4 ff ff       	call   800 <exit>
@@ -2,13 +2,14 @@
 #include "stat.h"
 #include "user.h"
 #include "fcntl.h" // Include for scheduler policy defines
+#include "x86.h"
 
 // Structure to hold results for one scheduler
 struct SchedResult {
     int policy;
     char *name;
-    int rtime;         // Runtime
-    int wtime;         // Wait time
+    uint64 rtime;      // Runtime, us (-1 if not run)
+    uint64 wtime;      // Wait time, us
     int syscalls;      // Total syscalls
     int goodsyscalls;  // Successful syscalls
     int lifetime;      // Process lifetime
@@ -105,11 +106,11 @@ int main(int argc, char *argv[]) {
             
             results[i].lifetime = get_process_lifetime(pid);
             results[i].uncles = get_uncle_count(pid);
-            printf(1, "Child %d metrics during execution: Life: %d, Uncles: %d\n", 
+            printf(1, "Child %d metrics during execution: Life: %d ticks, Uncles: %d\n", 
                   pid, results[i].lifetime, results[i].uncles);
                   
             // Wait for the child and collect stats
-            int wtime, rtime;
+            uint64 wtime, rtime;
             int status = waitx(&wtime, &rtime);
             
             if (status < 0) {
@@ -120,7 +121,7 @@ int main(int argc, char *argv[]) {
                 results[i].syscalls = getnumsyscalls() - start_syscalls;
                 results[i].goodsyscalls = getnumsyscallsgood() - start_goodsyscalls;
                 
-                printf(1, "PID %d finished. Status: %d, Wait: %d, Run: %d, Life: %d, Syscalls: %d/%d, Uncles: %d\n",
+                printf(1, "PID %d finished. Status: %d, Wait: %l us, Run: %l us, Life: %d ms, Syscalls: %d/%d, Uncles: %d\n",
                       pid, status, wtime, rtime, results[i].lifetime, 
                       results[i].goodsyscalls, results[i].syscalls, results[i].uncles);
             }
@@ -129,23 +130,23 @@ int main(int argc, char *argv[]) {
 
     // Show process table (optional)
     printf(1, "\nProcess table at completion:\n");
-    ps();
+    runps();
 
     // Print summary table
     printf(1, "\n--- Comparison Summary ---\n");
-    printf(1, "Scheduler | Wait Time | Run Time | Total | Syscalls | Lifetime | Uncles\n");
-    printf(1, "----------|-----------|----------|-------|----------|----------|-------\n");
+    printf(1, "Scheduler | Wait (us) | Run (us) | Total (us) | Syscalls | Lifetime (ms)    | Uncles\n");
+    printf(1, "----------|-----------|----------|------------|----------|------------------|-------\n");
 
-    int best_rtime = -1;
-    int best_total_time = -1;
+    uint64 best_rtime = 0;
+    uint64 best_total_time = 0;
     int best_rtime_idx = -1;
     int best_total_time_idx = -1;
 
     for (int i = 0; i < num_schedulers; i++) {
         if (results[i].rtime != -1) { // Check if the test ran successfully
-            int total_time = results[i].rtime + results[i].wtime;
+            uint64 total_time = results[i].rtime + results[i].wtime;
             
-            printf(1, "%s | %d       | %d      | %d    | %d/%d    | %d       | %d\n",
+            printf(1, "%s | %l       | %l      | %l         | %d/%d    | %d               | %d\n",
                    results[i].name, results[i].wtime, results[i].rtime, total_time,
                    results[i].goodsyscalls, results[i].syscalls, 
                    results[i].lifetime, results[i].uncles);
@@ -161,7 +162,7 @@ int main(int argc, char *argv[]) {
                 best_total_time_idx = i;
             }
         } else {
-            printf(1, "%s | ---       | ---      | ---   | ---      | ---      | ---\n", 
+            printf(1, "%s | ---       | ---      | ---        | ---      | ---              | ---\n", 
                    results[i].name);
         }
     }
@@ -169,14 +170,14 @@ int main(int argc, char *argv[]) {
     // Suggest best scheduler
     printf(1, "\n--- Suggestion ---\n");
     if (best_rtime_idx != -1) {
-        printf(1, "Best scheduler based on Run Time: %s (Runtime: %d)\n",
+        printf(1, "Best scheduler based on Run Time: %s (Runtime: %l us)\n",
                results[best_rtime_idx].name, results[best_rtime_idx].rtime);
     } else {
         printf(1, "Could not determine best scheduler based on runtime.\n");
     }
     
     if (best_total_time_idx != -1) {
-        printf(1, "Best scheduler based on Total Time: %s (Total Time: %d)\n",
+        printf(1, "Best scheduler based on Total Time: %s (Total Time: %l us)\n",
                results[best_total_time_idx].name, best_total_time);
     } else {
         printf(1, "Could not determine best scheduler based on total time.\n");
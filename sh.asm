@@ -0,0 +1,3497 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return 0;
+}
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 04             	sub    $0x4,%esp
+  static char buf[100];
+  int fd;
+
+  // Ensure that three file descriptors are open.
+  while((fd = open("console", O_RDWR)) >= 0){
+      11:	eb 0e                	jmp    21 <main+0x21>
+      13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      17:	90                   	nop
+    if(fd >= 3){
+      18:	83 f8 02             	cmp    $0x2,%eax
+      1b:	0f 8f 96 00 00 00    	jg     b7 <main+0xb7>
+  while((fd = open("console", O_RDWR)) >= 0){
+      21:	83 ec 08             	sub    $0x8,%esp
+      24:	6a 02                	push   $0x2
+      26:	68 51 1a 00 00       	push   $0x1a51
+      2b:	e8 69 12 00 00       	call   1299 <open>
+      30:	83 c4 10             	add    $0x10,%esp
+      33:	85 c0                	test   %eax,%eax
+      35:	79 e1                	jns    18 <main+0x18>
+      37:	eb 2e                	jmp    67 <main+0x67>
+      39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    }
+  }
+
+  // Read and run input commands.
+  while(getcmd(buf, sizeof(buf)) >= 0){
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      40:	80 3d c2 22 00 00 20 	cmpb   $0x20,0x22c2
+      47:	0f 84 8d 00 00 00    	je     da <main+0xda>
+      4d:	8d 76 00             	lea    0x0(%esi),%esi
+int
+fork1(void)
+{
+  int pid;
+
+  pid = fork();
+      50:	e8 ab 0d 00 00       	call   e00 <fork>
+  if(pid == -1)
+      55:	83 f8 ff             	cmp    $0xffffffff,%eax
+      58:	0f 84 c1 00 00 00    	je     11f <main+0x11f>
+    if(fork1() == 0)
+      5e:	85 c0                	test   %eax,%eax
+      60:	74 63                	je     c5 <main+0xc5>
+    wait();
+      62:	e8 01 12 00 00       	call   1268 <wait>
+  printf(2, "$ ");
+      67:	83 ec 08             	sub    $0x8,%esp
+      6a:	68 b0 19 00 00       	push   $0x19b0
+      6f:	6a 02                	push   $0x2
+      71:	e8 8a 14 00 00       	call   1500 <printf>
+  memset(buf, 0, nbuf);
+      76:	83 c4 0c             	add    $0xc,%esp
+      79:	6a 64                	push   $0x64
+      7b:	6a 00                	push   $0x0
+      7d:	68 c0 22 00 00       	push   $0x22c0
+      82:	e8 69 0f 00 00       	call   ff0 <memset>
+  gets(buf, nbuf);
+      87:	58                   	pop    %eax
+      88:	5a                   	pop    %edx
+      89:	6a 64                	push   $0x64
+      8b:	68 c0 22 00 00       	push   $0x22c0
+      90:	e8 eb 0f 00 00       	call   1080 <gets>
+  if(buf[0] == 0) // EOF
+      95:	0f b6 05 c0 22 00 00 	movzbl 0x22c0,%eax
+      9c:	83 c4 10             	add    $0x10,%esp
+      9f:	84 c0                	test   %al,%al
+      a1:	74 0f                	je     b2 <main+0xb2>
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      a3:	3c 63                	cmp    $0x63,%al
+      a5:	75 a9                	jne    50 <main+0x50>
+      a7:	80 3d c1 22 00 00 64 	cmpb   $0x64,0x22c1
+      ae:	75 a0                	jne    50 <main+0x50>
+      b0:	eb 8e                	jmp    40 <main+0x40>
+  exit();
+      b2:	e8 99 0d 00 00       	call   e50 <exit>
+      close(fd);
+      b7:	83 ec 0c             	sub    $0xc,%esp
+      ba:	50                   	push   %eax
+      bb:	e8 00 0e 00 00       	call   ec0 <close>
+      break;
+      c0:	83 c4 10             	add    $0x10,%esp
+      c3:	eb a2                	jmp    67 <main+0x67>
+      runcmd(parsecmd(buf));
+      c5:	83 ec 0c             	sub    $0xc,%esp
+      c8:	68 c0 22 00 00       	push   $0x22c0
+      cd:	e8 7e 0a 00 00       	call   b50 <parsecmd>
+      d2:	89 04 24             	mov    %eax,(%esp)
+      d5:	e8 d6 00 00 00       	call   1b0 <runcmd>
+      buf[strlen(buf)-1] = 0;  // chop \n
+      da:	83 ec 0c             	sub    $0xc,%esp
+      dd:	68 c0 22 00 00       	push   $0x22c0
+      e2:	e8 d9 0e 00 00       	call   fc0 <strlen>
+      if(chdir(buf+3) < 0)
+      e7:	c7 04 24 c3 22 00 00 	movl   $0x22c3,(%esp)
+      buf[strlen(buf)-1] = 0;  // chop \n
+      ee:	c6 80 bf 22 00 00 00 	movb   $0x0,0x22bf(%eax)
+      if(chdir(buf+3) < 0)
+      f5:	e8 db 11 00 00       	call   12d5 <chdir>
+      fa:	83 c4 10             	add    $0x10,%esp
+      fd:	85 c0                	test   %eax,%eax
+      ff:	0f 89 62 ff ff ff    	jns    67 <main+0x67>
+        printf(2, "cannot cd %s\n", buf+3);
+     105:	51                   	push   %ecx
+     106:	68 c3 22 00 00       	push   $0x22c3
+     10b:	68 59 1a 00 00       	push   $0x1a59
+     110:	6a 02                	push   $0x2
+     112:	e8 e9 13 00 00       	call   1500 <printf>
+     117:	83 c4 10             	add    $0x10,%esp
+     11a:	e9 48 ff ff ff       	jmp    67 <main+0x67>
+    panic("fork");
+     11f:	83 ec 0c             	sub    $0xc,%esp
+     122:	68 b3 19 00 00       	push   $0x19b3
+     127:	e8 44 00 00 00       	call   170 <panic>
+     12c:	66 90                	xchg   %ax,%ax
+     12e:	66 90                	xchg   %ax,%ax
+
+00000130 <getcmd>:
+{
+     130:	55                   	push   %ebp
+     131:	89 e5                	mov    %esp,%ebp
+     133:	56                   	push   %esi
+     134:	53                   	push   %ebx
+     135:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     138:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "$ ");
+     13b:	83 ec 08             	sub    $0x8,%esp
+     13e:	68 b0 19 00 00       	push   $0x19b0
+     143:	6a 02                	push   $0x2
+     145:	e8 b6 13 00 00       	call   1500 <printf>
+  memset(buf, 0, nbuf);
+     14a:	83 c4 0c             	add    $0xc,%esp
+     14d:	56                   	push   %esi
+     14e:	6a 00                	push   $0x0
+     150:	53                   	push   %ebx
+     151:	e8 9a 0e 00 00       	call   ff0 <memset>
+  gets(buf, nbuf);
+     156:	58                   	pop    %eax
+     157:	5a                   	pop    %edx
+     158:	56                   	push   %esi
+     159:	53                   	push   %ebx
+     15a:	e8 21 0f 00 00       	call   1080 <gets>
+  if(buf[0] == 0) // EOF
+     15f:	83 c4 10             	add    $0x10,%esp
+     162:	80 3b 01             	cmpb   $0x1,(%ebx)
+     165:	19 c0                	sbb    %eax,%eax
+}
+     167:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     16a:	5b                   	pop    %ebx
+     16b:	5e                   	pop    %esi
+     16c:	5d                   	pop    %ebp
+     16d:	c3                   	ret
+     16e:	66 90                	xchg   %ax,%ax
+
+00000170 <panic>:
+{
+     170:	55                   	push   %ebp
+     171:	89 e5                	mov    %esp,%ebp
+     173:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+     176:	ff 75 08             	push   0x8(%ebp)
+     179:	68 4d 1a 00 00       	push   $0x1a4d
+     17e:	6a 02                	push   $0x2
+     180:	e8 7b 13 00 00       	call   1500 <printf>
+  exit();
+     185:	e8 c6 0c 00 00       	call   e50 <exit>
+     18a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000190 <fork1>:
+{
+     190:	55                   	push   %ebp
+     191:	89 e5                	mov    %esp,%ebp
+     193:	83 ec 08             	sub    $0x8,%esp
+  pid = fork();
+     196:	e8 65 0c 00 00       	call   e00 <fork>
+  if(pid == -1)
+     19b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     19e:	74 02                	je     1a2 <fork1+0x12>
+  return pid;
+}
+     1a0:	c9                   	leave
+     1a1:	c3                   	ret
+    panic("fork");
+     1a2:	83 ec 0c             	sub    $0xc,%esp
+     1a5:	68 b3 19 00 00       	push   $0x19b3
+     1aa:	e8 c1 ff ff ff       	call   170 <panic>
+     1af:	90                   	nop
+
+000001b0 <runcmd>:
+{
+     1b0:	55                   	push   %ebp
+     1b1:	89 e5                	mov    %esp,%ebp
+     1b3:	53                   	push   %ebx
+     1b4:	83 ec 14             	sub    $0x14,%esp
+     1b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+     1ba:	85 db                	test   %ebx,%ebx
+     1bc:	74 3a                	je     1f8 <runcmd+0x48>
+  switch(cmd->type){
+     1be:	83 3b 05             	cmpl   $0x5,(%ebx)
+     1c1:	0f 87 e6 00 00 00    	ja     2ad <runcmd+0xfd>
+     1c7:	8b 03                	mov    (%ebx),%eax
+     1c9:	ff 24 85 68 1a 00 00 	jmp    *0x1a68(,%eax,4)
+    if(ecmd->argv[0] == 0)
+     1d0:	8b 43 04             	mov    0x4(%ebx),%eax
+     1d3:	85 c0                	test   %eax,%eax
+     1d5:	74 21                	je     1f8 <runcmd+0x48>
+    exec(ecmd->argv[0], ecmd->argv);
+     1d7:	8d 53 04             	lea    0x4(%ebx),%edx
+     1da:	51                   	push   %ecx
+     1db:	51                   	push   %ecx
+     1dc:	52                   	push   %edx
+     1dd:	50                   	push   %eax
+     1de:	e8 7d 0c 00 00       	call   e60 <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+     1e3:	83 c4 0c             	add    $0xc,%esp
+     1e6:	ff 73 04             	push   0x4(%ebx)
+     1e9:	68 bf 19 00 00       	push   $0x19bf
+     1ee:	6a 02                	push   $0x2
+     1f0:	e8 0b 13 00 00       	call   1500 <printf>
+    break;
+     1f5:	83 c4 10             	add    $0x10,%esp
+    exit();
+     1f8:	e8 53 0c 00 00       	call   e50 <exit>
+    if(fork1() == 0)
+     1fd:	e8 8e ff ff ff       	call   190 <fork1>
+     202:	85 c0                	test   %eax,%eax
+     204:	75 f2                	jne    1f8 <runcmd+0x48>
+     206:	e9 97 00 00 00       	jmp    2a2 <runcmd+0xf2>
+    if(pipe(p) < 0)
+     20b:	83 ec 0c             	sub    $0xc,%esp
+     20e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     211:	50                   	push   %eax
+     212:	e8 58 10 00 00       	call   126f <pipe>
+     217:	83 c4 10             	add    $0x10,%esp
+     21a:	85 c0                	test   %eax,%eax
+     21c:	0f 88 ad 00 00 00    	js     2cf <runcmd+0x11f>
+    if(fork1() == 0){
+     222:	e8 69 ff ff ff       	call   190 <fork1>
+     227:	85 c0                	test   %eax,%eax
+     229:	0f 84 ad 00 00 00    	je     2dc <runcmd+0x12c>
+    if(fork1() == 0){
+     22f:	e8 5c ff ff ff       	call   190 <fork1>
+     234:	85 c0                	test   %eax,%eax
+     236:	0f 85 ce 00 00 00    	jne    30a <runcmd+0x15a>
+      close(0);
+     23c:	83 ec 0c             	sub    $0xc,%esp
+     23f:	6a 00                	push   $0x0
+     241:	e8 7a 0c 00 00       	call   ec0 <close>
+      dup(p[0]);
+     246:	5a                   	pop    %edx
+     247:	ff 75 f0             	push   -0x10(%ebp)
+     24a:	e8 90 10 00 00       	call   12df <dup>
+      close(p[0]);
+     24f:	59                   	pop    %ecx
+     250:	ff 75 f0             	push   -0x10(%ebp)
+     253:	e8 68 0c 00 00       	call   ec0 <close>
+      close(p[1]);
+     258:	58                   	pop    %eax
+     259:	ff 75 f4             	push   -0xc(%ebp)
+     25c:	e8 5f 0c 00 00       	call   ec0 <close>
+      runcmd(pcmd->right);
+     261:	58                   	pop    %eax
+     262:	ff 73 08             	push   0x8(%ebx)
+     265:	e8 46 ff ff ff       	call   1b0 <runcmd>
+    if(fork1() == 0)
+     26a:	e8 21 ff ff ff       	call   190 <fork1>
+     26f:	85 c0                	test   %eax,%eax
+     271:	74 2f                	je     2a2 <runcmd+0xf2>
+    wait();
+     273:	e8 f0 0f 00 00       	call   1268 <wait>
+    runcmd(lcmd->right);
+     278:	83 ec 0c             	sub    $0xc,%esp
+     27b:	ff 73 08             	push   0x8(%ebx)
+     27e:	e8 2d ff ff ff       	call   1b0 <runcmd>
+    close(rcmd->fd);
+     283:	83 ec 0c             	sub    $0xc,%esp
+     286:	ff 73 14             	push   0x14(%ebx)
+     289:	e8 32 0c 00 00       	call   ec0 <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+     28e:	58                   	pop    %eax
+     28f:	5a                   	pop    %edx
+     290:	ff 73 10             	push   0x10(%ebx)
+     293:	ff 73 08             	push   0x8(%ebx)
+     296:	e8 fe 0f 00 00       	call   1299 <open>
+     29b:	83 c4 10             	add    $0x10,%esp
+     29e:	85 c0                	test   %eax,%eax
+     2a0:	78 18                	js     2ba <runcmd+0x10a>
+      runcmd(bcmd->cmd);
+     2a2:	83 ec 0c             	sub    $0xc,%esp
+     2a5:	ff 73 04             	push   0x4(%ebx)
+     2a8:	e8 03 ff ff ff       	call   1b0 <runcmd>
+    panic("runcmd");
+     2ad:	83 ec 0c             	sub    $0xc,%esp
+     2b0:	68 b8 19 00 00       	push   $0x19b8
+     2b5:	e8 b6 fe ff ff       	call   170 <panic>
+      printf(2, "open %s failed\n", rcmd->file);
+     2ba:	51                   	push   %ecx
+     2bb:	ff 73 08             	push   0x8(%ebx)
+     2be:	68 cf 19 00 00       	push   $0x19cf
+     2c3:	6a 02                	push   $0x2
+     2c5:	e8 36 12 00 00       	call   1500 <printf>
+      exit();
+     2ca:	e8 81 0b 00 00       	call   e50 <exit>
+      panic("pipe");
+     2cf:	83 ec 0c             	sub    $0xc,%esp
+     2d2:	68 df 19 00 00       	push   $0x19df
+     2d7:	e8 94 fe ff ff       	call   170 <panic>
+      close(1);
+     2dc:	83 ec 0c             	sub    $0xc,%esp
+     2df:	6a 01                	push   $0x1
+     2e1:	e8 da 0b 00 00       	call   ec0 <close>
+      dup(p[1]);
+     2e6:	58                   	pop    %eax
+     2e7:	ff 75 f4             	push   -0xc(%ebp)
+     2ea:	e8 f0 0f 00 00       	call   12df <dup>
+      close(p[0]);
+     2ef:	58                   	pop    %eax
+     2f0:	ff 75 f0             	push   -0x10(%ebp)
+     2f3:	e8 c8 0b 00 00       	call   ec0 <close>
+      close(p[1]);
+     2f8:	58                   	pop    %eax
+     2f9:	ff 75 f4             	push   -0xc(%ebp)
+     2fc:	e8 bf 0b 00 00       	call   ec0 <close>
+      runcmd(pcmd->left);
+     301:	5a                   	pop    %edx
+     302:	ff 73 04             	push   0x4(%ebx)
+     305:	e8 a6 fe ff ff       	call   1b0 <runcmd>
+    close(p[0]);
+     30a:	83 ec 0c             	sub    $0xc,%esp
+     30d:	ff 75 f0             	push   -0x10(%ebp)
+     310:	e8 ab 0b 00 00       	call   ec0 <close>
+    close(p[1]);
+     315:	58                   	pop    %eax
+     316:	ff 75 f4             	push   -0xc(%ebp)
+     319:	e8 a2 0b 00 00       	call   ec0 <close>
+    wait();
+     31e:	e8 45 0f 00 00       	call   1268 <wait>
+    wait();
+     323:	e8 40 0f 00 00       	call   1268 <wait>
+    break;
+     328:	83 c4 10             	add    $0x10,%esp
+     32b:	e9 c8 fe ff ff       	jmp    1f8 <runcmd+0x48>
+
+00000330 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     330:	55                   	push   %ebp
+     331:	89 e5                	mov    %esp,%ebp
+     333:	53                   	push   %ebx
+     334:	83 ec 10             	sub    $0x10,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     337:	6a 54                	push   $0x54
+     339:	e8 92 14 00 00       	call   17d0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     33e:	83 c4 0c             	add    $0xc,%esp
+     341:	6a 54                	push   $0x54
+  cmd = malloc(sizeof(*cmd));
+     343:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     345:	6a 00                	push   $0x0
+     347:	50                   	push   %eax
+     348:	e8 a3 0c 00 00       	call   ff0 <memset>
+  cmd->type = EXEC;
+     34d:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  return (struct cmd*)cmd;
+}
+     353:	89 d8                	mov    %ebx,%eax
+     355:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     358:	c9                   	leave
+     359:	c3                   	ret
+     35a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000360 <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     360:	55                   	push   %ebp
+     361:	89 e5                	mov    %esp,%ebp
+     363:	53                   	push   %ebx
+     364:	83 ec 10             	sub    $0x10,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     367:	6a 18                	push   $0x18
+     369:	e8 62 14 00 00       	call   17d0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     36e:	83 c4 0c             	add    $0xc,%esp
+     371:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     373:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     375:	6a 00                	push   $0x0
+     377:	50                   	push   %eax
+     378:	e8 73 0c 00 00       	call   ff0 <memset>
+  cmd->type = REDIR;
+  cmd->cmd = subcmd;
+     37d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = REDIR;
+     380:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+     386:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+     389:	8b 45 0c             	mov    0xc(%ebp),%eax
+     38c:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+     38f:	8b 45 10             	mov    0x10(%ebp),%eax
+     392:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+     395:	8b 45 14             	mov    0x14(%ebp),%eax
+     398:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+     39b:	8b 45 18             	mov    0x18(%ebp),%eax
+     39e:	89 43 14             	mov    %eax,0x14(%ebx)
+  return (struct cmd*)cmd;
+}
+     3a1:	89 d8                	mov    %ebx,%eax
+     3a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3a6:	c9                   	leave
+     3a7:	c3                   	ret
+     3a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3af:	90                   	nop
+
+000003b0 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     3b0:	55                   	push   %ebp
+     3b1:	89 e5                	mov    %esp,%ebp
+     3b3:	53                   	push   %ebx
+     3b4:	83 ec 10             	sub    $0x10,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     3b7:	6a 0c                	push   $0xc
+     3b9:	e8 12 14 00 00       	call   17d0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     3be:	83 c4 0c             	add    $0xc,%esp
+     3c1:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     3c3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     3c5:	6a 00                	push   $0x0
+     3c7:	50                   	push   %eax
+     3c8:	e8 23 0c 00 00       	call   ff0 <memset>
+  cmd->type = PIPE;
+  cmd->left = left;
+     3cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = PIPE;
+     3d0:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+     3d6:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     3d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     3dc:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     3df:	89 d8                	mov    %ebx,%eax
+     3e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3e4:	c9                   	leave
+     3e5:	c3                   	ret
+     3e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003f0 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     3f0:	55                   	push   %ebp
+     3f1:	89 e5                	mov    %esp,%ebp
+     3f3:	53                   	push   %ebx
+     3f4:	83 ec 10             	sub    $0x10,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     3f7:	6a 0c                	push   $0xc
+     3f9:	e8 d2 13 00 00       	call   17d0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     3fe:	83 c4 0c             	add    $0xc,%esp
+     401:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     403:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     405:	6a 00                	push   $0x0
+     407:	50                   	push   %eax
+     408:	e8 e3 0b 00 00       	call   ff0 <memset>
+  cmd->type = LIST;
+  cmd->left = left;
+     40d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = LIST;
+     410:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+     416:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     419:	8b 45 0c             	mov    0xc(%ebp),%eax
+     41c:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     41f:	89 d8                	mov    %ebx,%eax
+     421:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     424:	c9                   	leave
+     425:	c3                   	ret
+     426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     42d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000430 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     430:	55                   	push   %ebp
+     431:	89 e5                	mov    %esp,%ebp
+     433:	53                   	push   %ebx
+     434:	83 ec 10             	sub    $0x10,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     437:	6a 08                	push   $0x8
+     439:	e8 92 13 00 00       	call   17d0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     43e:	83 c4 0c             	add    $0xc,%esp
+     441:	6a 08                	push   $0x8
+  cmd = malloc(sizeof(*cmd));
+     443:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     445:	6a 00                	push   $0x0
+     447:	50                   	push   %eax
+     448:	e8 a3 0b 00 00       	call   ff0 <memset>
+  cmd->type = BACK;
+  cmd->cmd = subcmd;
+     44d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = BACK;
+     450:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+     456:	89 43 04             	mov    %eax,0x4(%ebx)
+  return (struct cmd*)cmd;
+}
+     459:	89 d8                	mov    %ebx,%eax
+     45b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     45e:	c9                   	leave
+     45f:	c3                   	ret
+
+00000460 <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     460:	55                   	push   %ebp
+     461:	89 e5                	mov    %esp,%ebp
+     463:	57                   	push   %edi
+     464:	56                   	push   %esi
+     465:	53                   	push   %ebx
+     466:	83 ec 0c             	sub    $0xc,%esp
+  char *s;
+  int ret;
+
+  s = *ps;
+     469:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+     46c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     46f:	8b 75 10             	mov    0x10(%ebp),%esi
+  s = *ps;
+     472:	8b 38                	mov    (%eax),%edi
+  while(s < es && strchr(whitespace, *s))
+     474:	39 df                	cmp    %ebx,%edi
+     476:	72 0f                	jb     487 <gettoken+0x27>
+     478:	eb 25                	jmp    49f <gettoken+0x3f>
+     47a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    s++;
+     480:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     483:	39 fb                	cmp    %edi,%ebx
+     485:	74 18                	je     49f <gettoken+0x3f>
+     487:	0f be 07             	movsbl (%edi),%eax
+     48a:	83 ec 08             	sub    $0x8,%esp
+     48d:	50                   	push   %eax
+     48e:	68 98 22 00 00       	push   $0x2298
+     493:	e8 78 0b 00 00       	call   1010 <strchr>
+     498:	83 c4 10             	add    $0x10,%esp
+     49b:	85 c0                	test   %eax,%eax
+     49d:	75 e1                	jne    480 <gettoken+0x20>
+  if(q)
+     49f:	85 f6                	test   %esi,%esi
+     4a1:	74 02                	je     4a5 <gettoken+0x45>
+    *q = s;
+     4a3:	89 3e                	mov    %edi,(%esi)
+  ret = *s;
+     4a5:	0f b6 07             	movzbl (%edi),%eax
+  switch(*s){
+     4a8:	3c 3c                	cmp    $0x3c,%al
+     4aa:	0f 8f d0 00 00 00    	jg     580 <gettoken+0x120>
+     4b0:	3c 3a                	cmp    $0x3a,%al
+     4b2:	0f 8f bc 00 00 00    	jg     574 <gettoken+0x114>
+     4b8:	84 c0                	test   %al,%al
+     4ba:	75 44                	jne    500 <gettoken+0xa0>
+     4bc:	31 f6                	xor    %esi,%esi
+    ret = 'a';
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+      s++;
+    break;
+  }
+  if(eq)
+     4be:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     4c1:	85 c9                	test   %ecx,%ecx
+     4c3:	74 05                	je     4ca <gettoken+0x6a>
+    *eq = s;
+     4c5:	8b 45 14             	mov    0x14(%ebp),%eax
+     4c8:	89 38                	mov    %edi,(%eax)
+
+  while(s < es && strchr(whitespace, *s))
+     4ca:	39 df                	cmp    %ebx,%edi
+     4cc:	72 09                	jb     4d7 <gettoken+0x77>
+     4ce:	eb 1f                	jmp    4ef <gettoken+0x8f>
+    s++;
+     4d0:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     4d3:	39 fb                	cmp    %edi,%ebx
+     4d5:	74 18                	je     4ef <gettoken+0x8f>
+     4d7:	0f be 07             	movsbl (%edi),%eax
+     4da:	83 ec 08             	sub    $0x8,%esp
+     4dd:	50                   	push   %eax
+     4de:	68 98 22 00 00       	push   $0x2298
+     4e3:	e8 28 0b 00 00       	call   1010 <strchr>
+     4e8:	83 c4 10             	add    $0x10,%esp
+     4eb:	85 c0                	test   %eax,%eax
+     4ed:	75 e1                	jne    4d0 <gettoken+0x70>
+  *ps = s;
+     4ef:	8b 45 08             	mov    0x8(%ebp),%eax
+     4f2:	89 38                	mov    %edi,(%eax)
+  return ret;
+}
+     4f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4f7:	89 f0                	mov    %esi,%eax
+     4f9:	5b                   	pop    %ebx
+     4fa:	5e                   	pop    %esi
+     4fb:	5f                   	pop    %edi
+     4fc:	5d                   	pop    %ebp
+     4fd:	c3                   	ret
+     4fe:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     500:	79 66                	jns    568 <gettoken+0x108>
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     502:	39 df                	cmp    %ebx,%edi
+     504:	72 39                	jb     53f <gettoken+0xdf>
+  if(eq)
+     506:	8b 55 14             	mov    0x14(%ebp),%edx
+     509:	85 d2                	test   %edx,%edx
+     50b:	0f 84 b3 00 00 00    	je     5c4 <gettoken+0x164>
+    *eq = s;
+     511:	8b 45 14             	mov    0x14(%ebp),%eax
+     514:	89 38                	mov    %edi,(%eax)
+  while(s < es && strchr(whitespace, *s))
+     516:	e9 a9 00 00 00       	jmp    5c4 <gettoken+0x164>
+     51b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     51f:	90                   	nop
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     520:	0f be 07             	movsbl (%edi),%eax
+     523:	83 ec 08             	sub    $0x8,%esp
+     526:	50                   	push   %eax
+     527:	68 90 22 00 00       	push   $0x2290
+     52c:	e8 df 0a 00 00       	call   1010 <strchr>
+     531:	83 c4 10             	add    $0x10,%esp
+     534:	85 c0                	test   %eax,%eax
+     536:	75 1f                	jne    557 <gettoken+0xf7>
+      s++;
+     538:	83 c7 01             	add    $0x1,%edi
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     53b:	39 fb                	cmp    %edi,%ebx
+     53d:	74 77                	je     5b6 <gettoken+0x156>
+     53f:	0f be 07             	movsbl (%edi),%eax
+     542:	83 ec 08             	sub    $0x8,%esp
+     545:	50                   	push   %eax
+     546:	68 98 22 00 00       	push   $0x2298
+     54b:	e8 c0 0a 00 00       	call   1010 <strchr>
+     550:	83 c4 10             	add    $0x10,%esp
+     553:	85 c0                	test   %eax,%eax
+     555:	74 c9                	je     520 <gettoken+0xc0>
+    ret = 'a';
+     557:	be 61 00 00 00       	mov    $0x61,%esi
+     55c:	e9 5d ff ff ff       	jmp    4be <gettoken+0x5e>
+     561:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  switch(*s){
+     568:	3c 26                	cmp    $0x26,%al
+     56a:	74 08                	je     574 <gettoken+0x114>
+     56c:	8d 48 d8             	lea    -0x28(%eax),%ecx
+     56f:	80 f9 01             	cmp    $0x1,%cl
+     572:	77 8e                	ja     502 <gettoken+0xa2>
+  ret = *s;
+     574:	0f be f0             	movsbl %al,%esi
+    s++;
+     577:	83 c7 01             	add    $0x1,%edi
+    break;
+     57a:	e9 3f ff ff ff       	jmp    4be <gettoken+0x5e>
+     57f:	90                   	nop
+  switch(*s){
+     580:	3c 3e                	cmp    $0x3e,%al
+     582:	75 1c                	jne    5a0 <gettoken+0x140>
+    if(*s == '>'){
+     584:	80 7f 01 3e          	cmpb   $0x3e,0x1(%edi)
+     588:	74 1f                	je     5a9 <gettoken+0x149>
+    s++;
+     58a:	83 c7 01             	add    $0x1,%edi
+  ret = *s;
+     58d:	be 3e 00 00 00       	mov    $0x3e,%esi
+     592:	e9 27 ff ff ff       	jmp    4be <gettoken+0x5e>
+     597:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     59e:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     5a0:	3c 7c                	cmp    $0x7c,%al
+     5a2:	74 d0                	je     574 <gettoken+0x114>
+     5a4:	e9 59 ff ff ff       	jmp    502 <gettoken+0xa2>
+      s++;
+     5a9:	83 c7 02             	add    $0x2,%edi
+      ret = '+';
+     5ac:	be 2b 00 00 00       	mov    $0x2b,%esi
+     5b1:	e9 08 ff ff ff       	jmp    4be <gettoken+0x5e>
+  if(eq)
+     5b6:	8b 45 14             	mov    0x14(%ebp),%eax
+     5b9:	85 c0                	test   %eax,%eax
+     5bb:	74 05                	je     5c2 <gettoken+0x162>
+    *eq = s;
+     5bd:	8b 45 14             	mov    0x14(%ebp),%eax
+     5c0:	89 18                	mov    %ebx,(%eax)
+      s++;
+     5c2:	89 df                	mov    %ebx,%edi
+    ret = 'a';
+     5c4:	be 61 00 00 00       	mov    $0x61,%esi
+     5c9:	e9 21 ff ff ff       	jmp    4ef <gettoken+0x8f>
+     5ce:	66 90                	xchg   %ax,%ax
+
+000005d0 <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     5d0:	55                   	push   %ebp
+     5d1:	89 e5                	mov    %esp,%ebp
+     5d3:	57                   	push   %edi
+     5d4:	56                   	push   %esi
+     5d5:	53                   	push   %ebx
+     5d6:	83 ec 0c             	sub    $0xc,%esp
+     5d9:	8b 7d 08             	mov    0x8(%ebp),%edi
+     5dc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s;
+
+  s = *ps;
+     5df:	8b 1f                	mov    (%edi),%ebx
+  while(s < es && strchr(whitespace, *s))
+     5e1:	39 f3                	cmp    %esi,%ebx
+     5e3:	72 12                	jb     5f7 <peek+0x27>
+     5e5:	eb 28                	jmp    60f <peek+0x3f>
+     5e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5ee:	66 90                	xchg   %ax,%ax
+    s++;
+     5f0:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     5f3:	39 de                	cmp    %ebx,%esi
+     5f5:	74 18                	je     60f <peek+0x3f>
+     5f7:	0f be 03             	movsbl (%ebx),%eax
+     5fa:	83 ec 08             	sub    $0x8,%esp
+     5fd:	50                   	push   %eax
+     5fe:	68 98 22 00 00       	push   $0x2298
+     603:	e8 08 0a 00 00       	call   1010 <strchr>
+     608:	83 c4 10             	add    $0x10,%esp
+     60b:	85 c0                	test   %eax,%eax
+     60d:	75 e1                	jne    5f0 <peek+0x20>
+  *ps = s;
+     60f:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+     611:	0f be 03             	movsbl (%ebx),%eax
+     614:	31 d2                	xor    %edx,%edx
+     616:	84 c0                	test   %al,%al
+     618:	75 0e                	jne    628 <peek+0x58>
+}
+     61a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     61d:	89 d0                	mov    %edx,%eax
+     61f:	5b                   	pop    %ebx
+     620:	5e                   	pop    %esi
+     621:	5f                   	pop    %edi
+     622:	5d                   	pop    %ebp
+     623:	c3                   	ret
+     624:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return *s && strchr(toks, *s);
+     628:	83 ec 08             	sub    $0x8,%esp
+     62b:	50                   	push   %eax
+     62c:	ff 75 10             	push   0x10(%ebp)
+     62f:	e8 dc 09 00 00       	call   1010 <strchr>
+     634:	83 c4 10             	add    $0x10,%esp
+     637:	31 d2                	xor    %edx,%edx
+     639:	85 c0                	test   %eax,%eax
+     63b:	0f 95 c2             	setne  %dl
+}
+     63e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     641:	5b                   	pop    %ebx
+     642:	89 d0                	mov    %edx,%eax
+     644:	5e                   	pop    %esi
+     645:	5f                   	pop    %edi
+     646:	5d                   	pop    %ebp
+     647:	c3                   	ret
+     648:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     64f:	90                   	nop
+
+00000650 <parseredirs>:
+  return cmd;
+}
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     650:	55                   	push   %ebp
+     651:	89 e5                	mov    %esp,%ebp
+     653:	57                   	push   %edi
+     654:	56                   	push   %esi
+     655:	53                   	push   %ebx
+     656:	83 ec 2c             	sub    $0x2c,%esp
+     659:	8b 75 0c             	mov    0xc(%ebp),%esi
+     65c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     65f:	90                   	nop
+     660:	83 ec 04             	sub    $0x4,%esp
+     663:	68 01 1a 00 00       	push   $0x1a01
+     668:	53                   	push   %ebx
+     669:	56                   	push   %esi
+     66a:	e8 61 ff ff ff       	call   5d0 <peek>
+     66f:	83 c4 10             	add    $0x10,%esp
+     672:	85 c0                	test   %eax,%eax
+     674:	0f 84 f6 00 00 00    	je     770 <parseredirs+0x120>
+    tok = gettoken(ps, es, 0, 0);
+     67a:	6a 00                	push   $0x0
+     67c:	6a 00                	push   $0x0
+     67e:	53                   	push   %ebx
+     67f:	56                   	push   %esi
+     680:	e8 db fd ff ff       	call   460 <gettoken>
+     685:	89 c7                	mov    %eax,%edi
+    if(gettoken(ps, es, &q, &eq) != 'a')
+     687:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     68a:	50                   	push   %eax
+     68b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     68e:	50                   	push   %eax
+     68f:	53                   	push   %ebx
+     690:	56                   	push   %esi
+     691:	e8 ca fd ff ff       	call   460 <gettoken>
+     696:	83 c4 20             	add    $0x20,%esp
+     699:	83 f8 61             	cmp    $0x61,%eax
+     69c:	0f 85 d9 00 00 00    	jne    77b <parseredirs+0x12b>
+      panic("missing file for redirection");
+    switch(tok){
+     6a2:	83 ff 3c             	cmp    $0x3c,%edi
+     6a5:	74 69                	je     710 <parseredirs+0xc0>
+     6a7:	83 ff 3e             	cmp    $0x3e,%edi
+     6aa:	74 05                	je     6b1 <parseredirs+0x61>
+     6ac:	83 ff 2b             	cmp    $0x2b,%edi
+     6af:	75 af                	jne    660 <parseredirs+0x10>
+      break;
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+      break;
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     6b1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     6b4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     6b7:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     6ba:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     6bd:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     6c0:	6a 18                	push   $0x18
+     6c2:	e8 09 11 00 00       	call   17d0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     6c7:	83 c4 0c             	add    $0xc,%esp
+     6ca:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     6cc:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     6ce:	6a 00                	push   $0x0
+     6d0:	50                   	push   %eax
+     6d1:	e8 1a 09 00 00       	call   ff0 <memset>
+  cmd->type = REDIR;
+     6d6:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  cmd->cmd = subcmd;
+     6dc:	8b 45 08             	mov    0x8(%ebp),%eax
+      break;
+     6df:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     6e2:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     6e5:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     6e8:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     6eb:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->mode = mode;
+     6ee:	c7 47 10 01 02 00 00 	movl   $0x201,0x10(%edi)
+  cmd->efile = efile;
+     6f5:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->fd = fd;
+     6f8:	c7 47 14 01 00 00 00 	movl   $0x1,0x14(%edi)
+      break;
+     6ff:	89 7d 08             	mov    %edi,0x8(%ebp)
+     702:	e9 59 ff ff ff       	jmp    660 <parseredirs+0x10>
+     707:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     70e:	66 90                	xchg   %ax,%ax
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     710:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     713:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     716:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     719:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     71c:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     71f:	6a 18                	push   $0x18
+     721:	e8 aa 10 00 00       	call   17d0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     726:	83 c4 0c             	add    $0xc,%esp
+     729:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     72b:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     72d:	6a 00                	push   $0x0
+     72f:	50                   	push   %eax
+     730:	e8 bb 08 00 00       	call   ff0 <memset>
+  cmd->cmd = subcmd;
+     735:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->file = file;
+     738:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+      break;
+     73b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  cmd->efile = efile;
+     73e:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->type = REDIR;
+     741:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+      break;
+     747:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     74a:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     74d:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     750:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->mode = mode;
+     753:	c7 47 10 00 00 00 00 	movl   $0x0,0x10(%edi)
+  cmd->fd = fd;
+     75a:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+      break;
+     761:	e9 fa fe ff ff       	jmp    660 <parseredirs+0x10>
+     766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     76d:	8d 76 00             	lea    0x0(%esi),%esi
+    }
+  }
+  return cmd;
+}
+     770:	8b 45 08             	mov    0x8(%ebp),%eax
+     773:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     776:	5b                   	pop    %ebx
+     777:	5e                   	pop    %esi
+     778:	5f                   	pop    %edi
+     779:	5d                   	pop    %ebp
+     77a:	c3                   	ret
+      panic("missing file for redirection");
+     77b:	83 ec 0c             	sub    $0xc,%esp
+     77e:	68 e4 19 00 00       	push   $0x19e4
+     783:	e8 e8 f9 ff ff       	call   170 <panic>
+     788:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     78f:	90                   	nop
+
+00000790 <parseexec>:
+  return cmd;
+}
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     790:	55                   	push   %ebp
+     791:	89 e5                	mov    %esp,%ebp
+     793:	57                   	push   %edi
+     794:	56                   	push   %esi
+     795:	53                   	push   %ebx
+     796:	83 ec 30             	sub    $0x30,%esp
+     799:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     79c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+     79f:	68 04 1a 00 00       	push   $0x1a04
+     7a4:	56                   	push   %esi
+     7a5:	53                   	push   %ebx
+     7a6:	e8 25 fe ff ff       	call   5d0 <peek>
+     7ab:	83 c4 10             	add    $0x10,%esp
+     7ae:	85 c0                	test   %eax,%eax
+     7b0:	0f 85 aa 00 00 00    	jne    860 <parseexec+0xd0>
+  cmd = malloc(sizeof(*cmd));
+     7b6:	83 ec 0c             	sub    $0xc,%esp
+     7b9:	89 c7                	mov    %eax,%edi
+     7bb:	6a 54                	push   $0x54
+     7bd:	e8 0e 10 00 00       	call   17d0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     7c2:	83 c4 0c             	add    $0xc,%esp
+     7c5:	6a 54                	push   $0x54
+     7c7:	6a 00                	push   $0x0
+     7c9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     7cc:	50                   	push   %eax
+     7cd:	e8 1e 08 00 00       	call   ff0 <memset>
+  cmd->type = EXEC;
+     7d2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+
+  ret = execcmd();
+  cmd = (struct execcmd*)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+     7d5:	83 c4 0c             	add    $0xc,%esp
+  cmd->type = EXEC;
+     7d8:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  ret = parseredirs(ret, ps, es);
+     7de:	56                   	push   %esi
+     7df:	53                   	push   %ebx
+     7e0:	50                   	push   %eax
+     7e1:	e8 6a fe ff ff       	call   650 <parseredirs>
+  while(!peek(ps, es, "|)&;")){
+     7e6:	83 c4 10             	add    $0x10,%esp
+  ret = parseredirs(ret, ps, es);
+     7e9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     7ec:	eb 15                	jmp    803 <parseexec+0x73>
+     7ee:	66 90                	xchg   %ax,%ax
+    cmd->argv[argc] = q;
+    cmd->eargv[argc] = eq;
+    argc++;
+    if(argc >= MAXARGS)
+      panic("too many args");
+    ret = parseredirs(ret, ps, es);
+     7f0:	83 ec 04             	sub    $0x4,%esp
+     7f3:	56                   	push   %esi
+     7f4:	53                   	push   %ebx
+     7f5:	ff 75 d4             	push   -0x2c(%ebp)
+     7f8:	e8 53 fe ff ff       	call   650 <parseredirs>
+     7fd:	83 c4 10             	add    $0x10,%esp
+     800:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     803:	83 ec 04             	sub    $0x4,%esp
+     806:	68 1b 1a 00 00       	push   $0x1a1b
+     80b:	56                   	push   %esi
+     80c:	53                   	push   %ebx
+     80d:	e8 be fd ff ff       	call   5d0 <peek>
+     812:	83 c4 10             	add    $0x10,%esp
+     815:	85 c0                	test   %eax,%eax
+     817:	75 5f                	jne    878 <parseexec+0xe8>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     819:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     81c:	50                   	push   %eax
+     81d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     820:	50                   	push   %eax
+     821:	56                   	push   %esi
+     822:	53                   	push   %ebx
+     823:	e8 38 fc ff ff       	call   460 <gettoken>
+     828:	83 c4 10             	add    $0x10,%esp
+     82b:	85 c0                	test   %eax,%eax
+     82d:	74 49                	je     878 <parseexec+0xe8>
+    if(tok != 'a')
+     82f:	83 f8 61             	cmp    $0x61,%eax
+     832:	75 62                	jne    896 <parseexec+0x106>
+    cmd->argv[argc] = q;
+     834:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     837:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     83a:	89 44 ba 04          	mov    %eax,0x4(%edx,%edi,4)
+    cmd->eargv[argc] = eq;
+     83e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     841:	89 44 ba 2c          	mov    %eax,0x2c(%edx,%edi,4)
+    argc++;
+     845:	83 c7 01             	add    $0x1,%edi
+    if(argc >= MAXARGS)
+     848:	83 ff 0a             	cmp    $0xa,%edi
+     84b:	75 a3                	jne    7f0 <parseexec+0x60>
+      panic("too many args");
+     84d:	83 ec 0c             	sub    $0xc,%esp
+     850:	68 0d 1a 00 00       	push   $0x1a0d
+     855:	e8 16 f9 ff ff       	call   170 <panic>
+     85a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return parseblock(ps, es);
+     860:	89 75 0c             	mov    %esi,0xc(%ebp)
+     863:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  }
+  cmd->argv[argc] = 0;
+  cmd->eargv[argc] = 0;
+  return ret;
+}
+     866:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     869:	5b                   	pop    %ebx
+     86a:	5e                   	pop    %esi
+     86b:	5f                   	pop    %edi
+     86c:	5d                   	pop    %ebp
+    return parseblock(ps, es);
+     86d:	e9 ae 01 00 00       	jmp    a20 <parseblock>
+     872:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  cmd->argv[argc] = 0;
+     878:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     87b:	c7 44 b8 04 00 00 00 	movl   $0x0,0x4(%eax,%edi,4)
+     882:	00 
+  cmd->eargv[argc] = 0;
+     883:	c7 44 b8 2c 00 00 00 	movl   $0x0,0x2c(%eax,%edi,4)
+     88a:	00 
+}
+     88b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     88e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     891:	5b                   	pop    %ebx
+     892:	5e                   	pop    %esi
+     893:	5f                   	pop    %edi
+     894:	5d                   	pop    %ebp
+     895:	c3                   	ret
+      panic("syntax");
+     896:	83 ec 0c             	sub    $0xc,%esp
+     899:	68 06 1a 00 00       	push   $0x1a06
+     89e:	e8 cd f8 ff ff       	call   170 <panic>
+     8a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008b0 <parsepipe>:
+{
+     8b0:	55                   	push   %ebp
+     8b1:	89 e5                	mov    %esp,%ebp
+     8b3:	57                   	push   %edi
+     8b4:	56                   	push   %esi
+     8b5:	53                   	push   %ebx
+     8b6:	83 ec 14             	sub    $0x14,%esp
+     8b9:	8b 75 08             	mov    0x8(%ebp),%esi
+     8bc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+     8bf:	57                   	push   %edi
+     8c0:	56                   	push   %esi
+     8c1:	e8 ca fe ff ff       	call   790 <parseexec>
+  if(peek(ps, es, "|")){
+     8c6:	83 c4 0c             	add    $0xc,%esp
+     8c9:	68 20 1a 00 00       	push   $0x1a20
+  cmd = parseexec(ps, es);
+     8ce:	89 c3                	mov    %eax,%ebx
+  if(peek(ps, es, "|")){
+     8d0:	57                   	push   %edi
+     8d1:	56                   	push   %esi
+     8d2:	e8 f9 fc ff ff       	call   5d0 <peek>
+     8d7:	83 c4 10             	add    $0x10,%esp
+     8da:	85 c0                	test   %eax,%eax
+     8dc:	75 12                	jne    8f0 <parsepipe+0x40>
+}
+     8de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8e1:	89 d8                	mov    %ebx,%eax
+     8e3:	5b                   	pop    %ebx
+     8e4:	5e                   	pop    %esi
+     8e5:	5f                   	pop    %edi
+     8e6:	5d                   	pop    %ebp
+     8e7:	c3                   	ret
+     8e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ef:	90                   	nop
+    gettoken(ps, es, 0, 0);
+     8f0:	6a 00                	push   $0x0
+     8f2:	6a 00                	push   $0x0
+     8f4:	57                   	push   %edi
+     8f5:	56                   	push   %esi
+     8f6:	e8 65 fb ff ff       	call   460 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     8fb:	58                   	pop    %eax
+     8fc:	5a                   	pop    %edx
+     8fd:	57                   	push   %edi
+     8fe:	56                   	push   %esi
+     8ff:	e8 ac ff ff ff       	call   8b0 <parsepipe>
+  cmd = malloc(sizeof(*cmd));
+     904:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     90b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     90d:	e8 be 0e 00 00       	call   17d0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     912:	83 c4 0c             	add    $0xc,%esp
+     915:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     917:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     919:	6a 00                	push   $0x0
+     91b:	50                   	push   %eax
+     91c:	e8 cf 06 00 00       	call   ff0 <memset>
+  cmd->left = left;
+     921:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     924:	83 c4 10             	add    $0x10,%esp
+     927:	89 f3                	mov    %esi,%ebx
+  cmd->type = PIPE;
+     929:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+}
+     92f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     931:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     934:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     937:	5b                   	pop    %ebx
+     938:	5e                   	pop    %esi
+     939:	5f                   	pop    %edi
+     93a:	5d                   	pop    %ebp
+     93b:	c3                   	ret
+     93c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000940 <parseline>:
+{
+     940:	55                   	push   %ebp
+     941:	89 e5                	mov    %esp,%ebp
+     943:	57                   	push   %edi
+     944:	56                   	push   %esi
+     945:	53                   	push   %ebx
+     946:	83 ec 24             	sub    $0x24,%esp
+     949:	8b 75 08             	mov    0x8(%ebp),%esi
+     94c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+     94f:	57                   	push   %edi
+     950:	56                   	push   %esi
+     951:	e8 5a ff ff ff       	call   8b0 <parsepipe>
+  while(peek(ps, es, "&")){
+     956:	83 c4 10             	add    $0x10,%esp
+  cmd = parsepipe(ps, es);
+     959:	89 c3                	mov    %eax,%ebx
+  while(peek(ps, es, "&")){
+     95b:	eb 3b                	jmp    998 <parseline+0x58>
+     95d:	8d 76 00             	lea    0x0(%esi),%esi
+    gettoken(ps, es, 0, 0);
+     960:	6a 00                	push   $0x0
+     962:	6a 00                	push   $0x0
+     964:	57                   	push   %edi
+     965:	56                   	push   %esi
+     966:	e8 f5 fa ff ff       	call   460 <gettoken>
+  cmd = malloc(sizeof(*cmd));
+     96b:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+     972:	e8 59 0e 00 00       	call   17d0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     977:	83 c4 0c             	add    $0xc,%esp
+     97a:	6a 08                	push   $0x8
+     97c:	6a 00                	push   $0x0
+     97e:	50                   	push   %eax
+     97f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     982:	e8 69 06 00 00       	call   ff0 <memset>
+  cmd->type = BACK;
+     987:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  cmd->cmd = subcmd;
+     98a:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+     98d:	c7 02 05 00 00 00    	movl   $0x5,(%edx)
+  cmd->cmd = subcmd;
+     993:	89 5a 04             	mov    %ebx,0x4(%edx)
+     996:	89 d3                	mov    %edx,%ebx
+  while(peek(ps, es, "&")){
+     998:	83 ec 04             	sub    $0x4,%esp
+     99b:	68 22 1a 00 00       	push   $0x1a22
+     9a0:	57                   	push   %edi
+     9a1:	56                   	push   %esi
+     9a2:	e8 29 fc ff ff       	call   5d0 <peek>
+     9a7:	83 c4 10             	add    $0x10,%esp
+     9aa:	85 c0                	test   %eax,%eax
+     9ac:	75 b2                	jne    960 <parseline+0x20>
+  if(peek(ps, es, ";")){
+     9ae:	83 ec 04             	sub    $0x4,%esp
+     9b1:	68 1e 1a 00 00       	push   $0x1a1e
+     9b6:	57                   	push   %edi
+     9b7:	56                   	push   %esi
+     9b8:	e8 13 fc ff ff       	call   5d0 <peek>
+     9bd:	83 c4 10             	add    $0x10,%esp
+     9c0:	85 c0                	test   %eax,%eax
+     9c2:	75 0c                	jne    9d0 <parseline+0x90>
+}
+     9c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9c7:	89 d8                	mov    %ebx,%eax
+     9c9:	5b                   	pop    %ebx
+     9ca:	5e                   	pop    %esi
+     9cb:	5f                   	pop    %edi
+     9cc:	5d                   	pop    %ebp
+     9cd:	c3                   	ret
+     9ce:	66 90                	xchg   %ax,%ax
+    gettoken(ps, es, 0, 0);
+     9d0:	6a 00                	push   $0x0
+     9d2:	6a 00                	push   $0x0
+     9d4:	57                   	push   %edi
+     9d5:	56                   	push   %esi
+     9d6:	e8 85 fa ff ff       	call   460 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     9db:	58                   	pop    %eax
+     9dc:	5a                   	pop    %edx
+     9dd:	57                   	push   %edi
+     9de:	56                   	push   %esi
+     9df:	e8 5c ff ff ff       	call   940 <parseline>
+  cmd = malloc(sizeof(*cmd));
+     9e4:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = listcmd(cmd, parseline(ps, es));
+     9eb:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     9ed:	e8 de 0d 00 00       	call   17d0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     9f2:	83 c4 0c             	add    $0xc,%esp
+     9f5:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     9f7:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     9f9:	6a 00                	push   $0x0
+     9fb:	50                   	push   %eax
+     9fc:	e8 ef 05 00 00       	call   ff0 <memset>
+  cmd->left = left;
+     a01:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     a04:	83 c4 10             	add    $0x10,%esp
+     a07:	89 f3                	mov    %esi,%ebx
+  cmd->type = LIST;
+     a09:	c7 06 04 00 00 00    	movl   $0x4,(%esi)
+}
+     a0f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     a11:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     a14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a17:	5b                   	pop    %ebx
+     a18:	5e                   	pop    %esi
+     a19:	5f                   	pop    %edi
+     a1a:	5d                   	pop    %ebp
+     a1b:	c3                   	ret
+     a1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a20 <parseblock>:
+{
+     a20:	55                   	push   %ebp
+     a21:	89 e5                	mov    %esp,%ebp
+     a23:	57                   	push   %edi
+     a24:	56                   	push   %esi
+     a25:	53                   	push   %ebx
+     a26:	83 ec 10             	sub    $0x10,%esp
+     a29:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     a2c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(!peek(ps, es, "("))
+     a2f:	68 04 1a 00 00       	push   $0x1a04
+     a34:	56                   	push   %esi
+     a35:	53                   	push   %ebx
+     a36:	e8 95 fb ff ff       	call   5d0 <peek>
+     a3b:	83 c4 10             	add    $0x10,%esp
+     a3e:	85 c0                	test   %eax,%eax
+     a40:	74 4a                	je     a8c <parseblock+0x6c>
+  gettoken(ps, es, 0, 0);
+     a42:	6a 00                	push   $0x0
+     a44:	6a 00                	push   $0x0
+     a46:	56                   	push   %esi
+     a47:	53                   	push   %ebx
+     a48:	e8 13 fa ff ff       	call   460 <gettoken>
+  cmd = parseline(ps, es);
+     a4d:	58                   	pop    %eax
+     a4e:	5a                   	pop    %edx
+     a4f:	56                   	push   %esi
+     a50:	53                   	push   %ebx
+     a51:	e8 ea fe ff ff       	call   940 <parseline>
+  if(!peek(ps, es, ")"))
+     a56:	83 c4 0c             	add    $0xc,%esp
+     a59:	68 40 1a 00 00       	push   $0x1a40
+  cmd = parseline(ps, es);
+     a5e:	89 c7                	mov    %eax,%edi
+  if(!peek(ps, es, ")"))
+     a60:	56                   	push   %esi
+     a61:	53                   	push   %ebx
+     a62:	e8 69 fb ff ff       	call   5d0 <peek>
+     a67:	83 c4 10             	add    $0x10,%esp
+     a6a:	85 c0                	test   %eax,%eax
+     a6c:	74 2b                	je     a99 <parseblock+0x79>
+  gettoken(ps, es, 0, 0);
+     a6e:	6a 00                	push   $0x0
+     a70:	6a 00                	push   $0x0
+     a72:	56                   	push   %esi
+     a73:	53                   	push   %ebx
+     a74:	e8 e7 f9 ff ff       	call   460 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     a79:	83 c4 0c             	add    $0xc,%esp
+     a7c:	56                   	push   %esi
+     a7d:	53                   	push   %ebx
+     a7e:	57                   	push   %edi
+     a7f:	e8 cc fb ff ff       	call   650 <parseredirs>
+}
+     a84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a87:	5b                   	pop    %ebx
+     a88:	5e                   	pop    %esi
+     a89:	5f                   	pop    %edi
+     a8a:	5d                   	pop    %ebp
+     a8b:	c3                   	ret
+    panic("parseblock");
+     a8c:	83 ec 0c             	sub    $0xc,%esp
+     a8f:	68 24 1a 00 00       	push   $0x1a24
+     a94:	e8 d7 f6 ff ff       	call   170 <panic>
+    panic("syntax - missing )");
+     a99:	83 ec 0c             	sub    $0xc,%esp
+     a9c:	68 2f 1a 00 00       	push   $0x1a2f
+     aa1:	e8 ca f6 ff ff       	call   170 <panic>
+     aa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ab0 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     ab0:	55                   	push   %ebp
+     ab1:	89 e5                	mov    %esp,%ebp
+     ab3:	53                   	push   %ebx
+     ab4:	83 ec 04             	sub    $0x4,%esp
+     ab7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     aba:	85 db                	test   %ebx,%ebx
+     abc:	0f 84 7e 00 00 00    	je     b40 <nulterminate+0x90>
+    return 0;
+
+  switch(cmd->type){
+     ac2:	83 3b 05             	cmpl   $0x5,(%ebx)
+     ac5:	77 20                	ja     ae7 <nulterminate+0x37>
+     ac7:	8b 03                	mov    (%ebx),%eax
+     ac9:	ff 24 85 80 1a 00 00 	jmp    *0x1a80(,%eax,4)
+    nulterminate(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    nulterminate(lcmd->left);
+     ad0:	83 ec 0c             	sub    $0xc,%esp
+     ad3:	ff 73 04             	push   0x4(%ebx)
+     ad6:	e8 d5 ff ff ff       	call   ab0 <nulterminate>
+    nulterminate(lcmd->right);
+     adb:	58                   	pop    %eax
+     adc:	ff 73 08             	push   0x8(%ebx)
+     adf:	e8 cc ff ff ff       	call   ab0 <nulterminate>
+    break;
+     ae4:	83 c4 10             	add    $0x10,%esp
+    return 0;
+     ae7:	89 d8                	mov    %ebx,%eax
+    bcmd = (struct backcmd*)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+     ae9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     aec:	c9                   	leave
+     aed:	c3                   	ret
+     aee:	66 90                	xchg   %ax,%ax
+    nulterminate(bcmd->cmd);
+     af0:	83 ec 0c             	sub    $0xc,%esp
+     af3:	ff 73 04             	push   0x4(%ebx)
+     af6:	e8 b5 ff ff ff       	call   ab0 <nulterminate>
+    break;
+     afb:	83 c4 10             	add    $0x10,%esp
+     afe:	eb e7                	jmp    ae7 <nulterminate+0x37>
+    for(i=0; ecmd->argv[i]; i++)
+     b00:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     b03:	8d 43 08             	lea    0x8(%ebx),%eax
+     b06:	85 c9                	test   %ecx,%ecx
+     b08:	74 dd                	je     ae7 <nulterminate+0x37>
+     b0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      *ecmd->eargv[i] = 0;
+     b10:	8b 50 24             	mov    0x24(%eax),%edx
+    for(i=0; ecmd->argv[i]; i++)
+     b13:	83 c0 04             	add    $0x4,%eax
+      *ecmd->eargv[i] = 0;
+     b16:	c6 02 00             	movb   $0x0,(%edx)
+    for(i=0; ecmd->argv[i]; i++)
+     b19:	8b 50 fc             	mov    -0x4(%eax),%edx
+     b1c:	85 d2                	test   %edx,%edx
+     b1e:	75 f0                	jne    b10 <nulterminate+0x60>
+     b20:	eb c5                	jmp    ae7 <nulterminate+0x37>
+     b22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    nulterminate(rcmd->cmd);
+     b28:	83 ec 0c             	sub    $0xc,%esp
+     b2b:	ff 73 04             	push   0x4(%ebx)
+     b2e:	e8 7d ff ff ff       	call   ab0 <nulterminate>
+    *rcmd->efile = 0;
+     b33:	8b 43 0c             	mov    0xc(%ebx),%eax
+    break;
+     b36:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+     b39:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     b3c:	eb a9                	jmp    ae7 <nulterminate+0x37>
+     b3e:	66 90                	xchg   %ax,%ax
+    return 0;
+     b40:	31 c0                	xor    %eax,%eax
+     b42:	eb a5                	jmp    ae9 <nulterminate+0x39>
+     b44:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b4f:	90                   	nop
+
+00000b50 <parsecmd>:
+{
+     b50:	55                   	push   %ebp
+     b51:	89 e5                	mov    %esp,%ebp
+     b53:	57                   	push   %edi
+     b54:	56                   	push   %esi
+  cmd = parseline(&s, es);
+     b55:	8d 7d 08             	lea    0x8(%ebp),%edi
+{
+     b58:	53                   	push   %ebx
+     b59:	83 ec 18             	sub    $0x18,%esp
+  es = s + strlen(s);
+     b5c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     b5f:	53                   	push   %ebx
+     b60:	e8 5b 04 00 00       	call   fc0 <strlen>
+  cmd = parseline(&s, es);
+     b65:	59                   	pop    %ecx
+     b66:	5e                   	pop    %esi
+  es = s + strlen(s);
+     b67:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+     b69:	53                   	push   %ebx
+     b6a:	57                   	push   %edi
+     b6b:	e8 d0 fd ff ff       	call   940 <parseline>
+  peek(&s, es, "");
+     b70:	83 c4 0c             	add    $0xc,%esp
+     b73:	68 ce 19 00 00       	push   $0x19ce
+  cmd = parseline(&s, es);
+     b78:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+     b7a:	53                   	push   %ebx
+     b7b:	57                   	push   %edi
+     b7c:	e8 4f fa ff ff       	call   5d0 <peek>
+  if(s != es){
+     b81:	8b 45 08             	mov    0x8(%ebp),%eax
+     b84:	83 c4 10             	add    $0x10,%esp
+     b87:	39 d8                	cmp    %ebx,%eax
+     b89:	75 13                	jne    b9e <parsecmd+0x4e>
+  nulterminate(cmd);
+     b8b:	83 ec 0c             	sub    $0xc,%esp
+     b8e:	56                   	push   %esi
+     b8f:	e8 1c ff ff ff       	call   ab0 <nulterminate>
+}
+     b94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b97:	89 f0                	mov    %esi,%eax
+     b99:	5b                   	pop    %ebx
+     b9a:	5e                   	pop    %esi
+     b9b:	5f                   	pop    %edi
+     b9c:	5d                   	pop    %ebp
+     b9d:	c3                   	ret
+    printf(2, "leftovers: %s\n", s);
+     b9e:	52                   	push   %edx
+     b9f:	50                   	push   %eax
+     ba0:	68 42 1a 00 00       	push   $0x1a42
+     ba5:	6a 02                	push   $0x2
+     ba7:	e8 54 09 00 00       	call   1500 <printf>
+    panic("syntax");
+     bac:	c7 04 24 06 1a 00 00 	movl   $0x1a06,(%esp)
+     bb3:	e8 b8 f5 ff ff       	call   170 <panic>
+     bb8:	66 90                	xchg   %ax,%ax
+     bba:	66 90                	xchg   %ax,%ax
+     bbc:	66 90                	xchg   %ax,%ax
+     bbe:	66 90                	xchg   %ax,%ax
+
+00000bc0 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+     bc0:	55                   	push   %ebp
+     bc1:	89 e5                	mov    %esp,%ebp
+     bc3:	57                   	push   %edi
+     bc4:	56                   	push   %esi
+     bc5:	53                   	push   %ebx
+     bc6:	83 ec 4c             	sub    $0x4c,%esp
+     bc9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     bcc:	8b 55 08             	mov    0x8(%ebp),%edx
+     bcf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     bd2:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+     bd5:	83 fa 0f             	cmp    $0xf,%edx
+     bd8:	0f 87 32 01 00 00    	ja     d10 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+     bde:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     be4:	8b 80 40 23 00 00    	mov    0x2340(%eax),%eax
+     bea:	85 c0                	test   %eax,%eax
+     bec:	0f 84 de 00 00 00    	je     cd0 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+     bf2:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     bf8:	8b b0 44 23 00 00    	mov    0x2344(%eax),%esi
+     bfe:	8d 88 40 23 00 00    	lea    0x2340(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+     c04:	8d b8 48 23 00 00    	lea    0x2348(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+     c0a:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+     c0d:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+     c10:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+     c13:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+     c19:	0f 8f 01 01 00 00    	jg     d20 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+     c1f:	8d 78 08             	lea    0x8(%eax),%edi
+     c22:	8d bc 3e 40 23 00 00 	lea    0x2340(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     c29:	85 db                	test   %ebx,%ebx
+     c2b:	7e 3b                	jle    c68 <bufwrite+0xa8>
+     c2d:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+     c30:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+     c33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c37:	90                   	nop
+    *dst++ = *src++;
+     c38:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     c39:	39 c6                	cmp    %eax,%esi
+     c3b:	75 fb                	jne    c38 <bufwrite+0x78>
+  ob[fd].n += n;
+     c3d:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     c43:	8b 88 44 23 00 00    	mov    0x2344(%eax),%ecx
+     c49:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     c4b:	83 b8 40 23 00 00 01 	cmpl   $0x1,0x2340(%eax)
+  ob[fd].n += n;
+     c52:	89 88 44 23 00 00    	mov    %ecx,0x2344(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     c58:	74 26                	je     c80 <bufwrite+0xc0>
+}
+     c5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c5d:	5b                   	pop    %ebx
+     c5e:	5e                   	pop    %esi
+     c5f:	5f                   	pop    %edi
+     c60:	5d                   	pop    %ebp
+     c61:	c3                   	ret
+     c62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+     c68:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     c6b:	83 b8 40 23 00 00 01 	cmpl   $0x1,0x2340(%eax)
+  ob[fd].n += n;
+     c72:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     c75:	75 e3                	jne    c5a <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+     c77:	85 db                	test   %ebx,%ebx
+     c79:	74 df                	je     c5a <bufwrite+0x9a>
+     c7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c7f:	90                   	nop
+  src = vsrc;
+     c80:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     c83:	01 c3                	add    %eax,%ebx
+     c85:	eb 10                	jmp    c97 <bufwrite+0xd7>
+     c87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c8e:	66 90                	xchg   %ax,%ax
+     c90:	83 c0 01             	add    $0x1,%eax
+     c93:	39 d8                	cmp    %ebx,%eax
+     c95:	74 c3                	je     c5a <bufwrite+0x9a>
+    if(*p == (char)c)
+     c97:	80 38 0a             	cmpb   $0xa,(%eax)
+     c9a:	75 f4                	jne    c90 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     c9c:	85 c9                	test   %ecx,%ecx
+     c9e:	7e ba                	jle    c5a <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+     ca0:	83 ec 04             	sub    $0x4,%esp
+     ca3:	51                   	push   %ecx
+     ca4:	ff 75 ac             	push   -0x54(%ebp)
+     ca7:	52                   	push   %edx
+     ca8:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+     cab:	e8 cd 05 00 00       	call   127d <write>
+    ob[fd].n = 0;
+     cb0:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     cb3:	83 c4 10             	add    $0x10,%esp
+     cb6:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+     cbc:	c7 82 44 23 00 00 00 	movl   $0x0,0x2344(%edx)
+     cc3:	00 00 00 
+     cc6:	eb 92                	jmp    c5a <bufwrite+0x9a>
+     cc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ccf:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     cd0:	83 ec 08             	sub    $0x8,%esp
+     cd3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     cd6:	50                   	push   %eax
+     cd7:	52                   	push   %edx
+     cd8:	89 55 b0             	mov    %edx,-0x50(%ebp)
+     cdb:	e8 d7 05 00 00       	call   12b7 <fstat>
+     ce0:	83 c4 10             	add    $0x10,%esp
+     ce3:	8b 55 b0             	mov    -0x50(%ebp),%edx
+     ce6:	89 c1                	mov    %eax,%ecx
+     ce8:	b8 02 00 00 00       	mov    $0x2,%eax
+     ced:	85 c9                	test   %ecx,%ecx
+     cef:	75 0d                	jne    cfe <bufwrite+0x13e>
+     cf1:	31 c0                	xor    %eax,%eax
+     cf3:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     cf8:	0f 95 c0             	setne  %al
+     cfb:	83 c0 01             	add    $0x1,%eax
+     cfe:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+     d04:	89 81 40 23 00 00    	mov    %eax,0x2340(%ecx)
+     d0a:	e9 e3 fe ff ff       	jmp    bf2 <bufwrite+0x32>
+     d0f:	90                   	nop
+}
+     d10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d13:	5b                   	pop    %ebx
+     d14:	5e                   	pop    %esi
+     d15:	5f                   	pop    %edi
+     d16:	5d                   	pop    %ebp
+    write(fd, p, n);
+     d17:	e9 61 05 00 00       	jmp    127d <write>
+     d1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+     d20:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+     d23:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+     d26:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+     d29:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+     d2c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+     d2f:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+     d32:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+     d35:	6a 02                	push   $0x2
+     d37:	50                   	push   %eax
+     d38:	52                   	push   %edx
+     d39:	e8 9b 06 00 00       	call   13d9 <writev>
+    ob[fd].n = 0;
+     d3e:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+     d41:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+     d44:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+     d4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d4e:	5b                   	pop    %ebx
+     d4f:	5e                   	pop    %esi
+     d50:	5f                   	pop    %edi
+     d51:	5d                   	pop    %ebp
+     d52:	c3                   	ret
+     d53:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000d60 <fflush>:
+{
+     d60:	55                   	push   %ebp
+     d61:	89 e5                	mov    %esp,%ebp
+     d63:	53                   	push   %ebx
+     d64:	83 ec 04             	sub    $0x4,%esp
+     d67:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     d6a:	83 f8 0f             	cmp    $0xf,%eax
+     d6d:	77 16                	ja     d85 <fflush+0x25>
+     d6f:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+     d75:	8b 8a 44 23 00 00    	mov    0x2344(%edx),%ecx
+     d7b:	8d 9a 40 23 00 00    	lea    0x2340(%edx),%ebx
+     d81:	85 c9                	test   %ecx,%ecx
+     d83:	7f 0b                	jg     d90 <fflush+0x30>
+}
+     d85:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d88:	c9                   	leave
+     d89:	c3                   	ret
+     d8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     d90:	83 ec 04             	sub    $0x4,%esp
+     d93:	81 c2 48 23 00 00    	add    $0x2348,%edx
+     d99:	51                   	push   %ecx
+     d9a:	52                   	push   %edx
+     d9b:	50                   	push   %eax
+     d9c:	e8 dc 04 00 00       	call   127d <write>
+    ob[fd].n = 0;
+     da1:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     da8:	83 c4 10             	add    $0x10,%esp
+}
+     dab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     dae:	c9                   	leave
+     daf:	c3                   	ret
+
+00000db0 <fflushall>:
+{
+     db0:	55                   	push   %ebp
+     db1:	89 e5                	mov    %esp,%ebp
+     db3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     db4:	31 f6                	xor    %esi,%esi
+{
+     db6:	53                   	push   %ebx
+     db7:	bb 48 23 00 00       	mov    $0x2348,%ebx
+     dbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     dc0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     dc3:	85 c0                	test   %eax,%eax
+     dc5:	7e 15                	jle    ddc <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     dc7:	83 ec 04             	sub    $0x4,%esp
+     dca:	50                   	push   %eax
+     dcb:	53                   	push   %ebx
+     dcc:	56                   	push   %esi
+     dcd:	e8 ab 04 00 00       	call   127d <write>
+    ob[fd].n = 0;
+     dd2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     dd9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     ddc:	83 c6 01             	add    $0x1,%esi
+     ddf:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     de5:	83 fe 10             	cmp    $0x10,%esi
+     de8:	75 d6                	jne    dc0 <fflushall+0x10>
+}
+     dea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ded:	5b                   	pop    %ebx
+     dee:	5e                   	pop    %esi
+     def:	5d                   	pop    %ebp
+     df0:	c3                   	ret
+     df1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     df8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dff:	90                   	nop
+
+00000e00 <fork>:
+{
+     e00:	55                   	push   %ebp
+     e01:	89 e5                	mov    %esp,%ebp
+     e03:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     e04:	31 f6                	xor    %esi,%esi
+{
+     e06:	53                   	push   %ebx
+     e07:	bb 48 23 00 00       	mov    $0x2348,%ebx
+     e0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     e10:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     e13:	85 c0                	test   %eax,%eax
+     e15:	7e 15                	jle    e2c <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     e17:	83 ec 04             	sub    $0x4,%esp
+     e1a:	50                   	push   %eax
+     e1b:	53                   	push   %ebx
+     e1c:	56                   	push   %esi
+     e1d:	e8 5b 04 00 00       	call   127d <write>
+    ob[fd].n = 0;
+     e22:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     e29:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     e2c:	83 c6 01             	add    $0x1,%esi
+     e2f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     e35:	83 fe 10             	cmp    $0x10,%esi
+     e38:	75 d6                	jne    e10 <fork+0x10>
+}
+     e3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e3d:	5b                   	pop    %ebx
+     e3e:	5e                   	pop    %esi
+     e3f:	5d                   	pop    %ebp
+  return _fork();
+     e40:	e9 15 04 00 00       	jmp    125a <_fork>
+     e45:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000e50 <exit>:
+{
+     e50:	55                   	push   %ebp
+     e51:	89 e5                	mov    %esp,%ebp
+     e53:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+     e56:	e8 55 ff ff ff       	call   db0 <fflushall>
+  _exit();
+     e5b:	e8 01 04 00 00       	call   1261 <_exit>
+
+00000e60 <exec>:
+{
+     e60:	55                   	push   %ebp
+     e61:	89 e5                	mov    %esp,%ebp
+     e63:	57                   	push   %edi
+     e64:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     e65:	31 f6                	xor    %esi,%esi
+{
+     e67:	53                   	push   %ebx
+     e68:	bb 48 23 00 00       	mov    $0x2348,%ebx
+     e6d:	83 ec 1c             	sub    $0x1c,%esp
+     e70:	8b 45 08             	mov    0x8(%ebp),%eax
+     e73:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     e76:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     e79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     e80:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     e83:	85 c0                	test   %eax,%eax
+     e85:	7e 15                	jle    e9c <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     e87:	83 ec 04             	sub    $0x4,%esp
+     e8a:	50                   	push   %eax
+     e8b:	53                   	push   %ebx
+     e8c:	56                   	push   %esi
+     e8d:	e8 eb 03 00 00       	call   127d <write>
+    ob[fd].n = 0;
+     e92:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     e99:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     e9c:	83 c6 01             	add    $0x1,%esi
+     e9f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     ea5:	83 fe 10             	cmp    $0x10,%esi
+     ea8:	75 d6                	jne    e80 <exec+0x20>
+  return _exec(path, argv);
+     eaa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     ead:	89 7d 0c             	mov    %edi,0xc(%ebp)
+     eb0:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     eb3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     eb6:	5b                   	pop    %ebx
+     eb7:	5e                   	pop    %esi
+     eb8:	5f                   	pop    %edi
+     eb9:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     eba:	e9 d3 03 00 00       	jmp    1292 <_exec>
+     ebf:	90                   	nop
+
+00000ec0 <close>:
+{
+     ec0:	55                   	push   %ebp
+     ec1:	89 e5                	mov    %esp,%ebp
+     ec3:	56                   	push   %esi
+     ec4:	53                   	push   %ebx
+     ec5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     ec8:	83 fb 0f             	cmp    $0xf,%ebx
+     ecb:	77 26                	ja     ef3 <close+0x33>
+     ecd:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     ed3:	8b 90 44 23 00 00    	mov    0x2344(%eax),%edx
+     ed9:	8d b0 40 23 00 00    	lea    0x2340(%eax),%esi
+     edf:	85 d2                	test   %edx,%edx
+     ee1:	7f 25                	jg     f08 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+     ee3:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     ee9:	c7 80 40 23 00 00 00 	movl   $0x0,0x2340(%eax)
+     ef0:	00 00 00 
+  return _close(fd);
+     ef3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     ef6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ef9:	5b                   	pop    %ebx
+     efa:	5e                   	pop    %esi
+     efb:	5d                   	pop    %ebp
+  return _close(fd);
+     efc:	e9 83 03 00 00       	jmp    1284 <_close>
+     f01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     f08:	83 ec 04             	sub    $0x4,%esp
+     f0b:	05 48 23 00 00       	add    $0x2348,%eax
+     f10:	52                   	push   %edx
+     f11:	50                   	push   %eax
+     f12:	53                   	push   %ebx
+     f13:	e8 65 03 00 00       	call   127d <write>
+    ob[fd].n = 0;
+     f18:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+     f1f:	83 c4 10             	add    $0x10,%esp
+     f22:	eb bf                	jmp    ee3 <close+0x23>
+     f24:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f2f:	90                   	nop
+
+00000f30 <strcpy>:
+{
+     f30:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+     f31:	31 c0                	xor    %eax,%eax
+{
+     f33:	89 e5                	mov    %esp,%ebp
+     f35:	53                   	push   %ebx
+     f36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     f39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     f3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     f40:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     f44:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     f47:	83 c0 01             	add    $0x1,%eax
+     f4a:	84 d2                	test   %dl,%dl
+     f4c:	75 f2                	jne    f40 <strcpy+0x10>
+}
+     f4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f51:	89 c8                	mov    %ecx,%eax
+     f53:	c9                   	leave
+     f54:	c3                   	ret
+     f55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000f60 <strcmp>:
+{
+     f60:	55                   	push   %ebp
+     f61:	89 e5                	mov    %esp,%ebp
+     f63:	53                   	push   %ebx
+     f64:	8b 55 08             	mov    0x8(%ebp),%edx
+     f67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     f6a:	0f b6 02             	movzbl (%edx),%eax
+     f6d:	84 c0                	test   %al,%al
+     f6f:	75 17                	jne    f88 <strcmp+0x28>
+     f71:	eb 3a                	jmp    fad <strcmp+0x4d>
+     f73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f77:	90                   	nop
+     f78:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     f7c:	83 c2 01             	add    $0x1,%edx
+     f7f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     f82:	84 c0                	test   %al,%al
+     f84:	74 1a                	je     fa0 <strcmp+0x40>
+    p++, q++;
+     f86:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     f88:	0f b6 19             	movzbl (%ecx),%ebx
+     f8b:	38 c3                	cmp    %al,%bl
+     f8d:	74 e9                	je     f78 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     f8f:	29 d8                	sub    %ebx,%eax
+}
+     f91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f94:	c9                   	leave
+     f95:	c3                   	ret
+     f96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f9d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     fa0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     fa4:	31 c0                	xor    %eax,%eax
+     fa6:	29 d8                	sub    %ebx,%eax
+}
+     fa8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     fab:	c9                   	leave
+     fac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     fad:	0f b6 19             	movzbl (%ecx),%ebx
+     fb0:	31 c0                	xor    %eax,%eax
+     fb2:	eb db                	jmp    f8f <strcmp+0x2f>
+     fb4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     fbf:	90                   	nop
+
+00000fc0 <strlen>:
+{
+     fc0:	55                   	push   %ebp
+     fc1:	89 e5                	mov    %esp,%ebp
+     fc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+     fc6:	80 3a 00             	cmpb   $0x0,(%edx)
+     fc9:	74 15                	je     fe0 <strlen+0x20>
+     fcb:	31 c0                	xor    %eax,%eax
+     fcd:	8d 76 00             	lea    0x0(%esi),%esi
+     fd0:	83 c0 01             	add    $0x1,%eax
+     fd3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     fd7:	89 c1                	mov    %eax,%ecx
+     fd9:	75 f5                	jne    fd0 <strlen+0x10>
+}
+     fdb:	89 c8                	mov    %ecx,%eax
+     fdd:	5d                   	pop    %ebp
+     fde:	c3                   	ret
+     fdf:	90                   	nop
+  for(n = 0; s[n]; n++)
+     fe0:	31 c9                	xor    %ecx,%ecx
+}
+     fe2:	5d                   	pop    %ebp
+     fe3:	89 c8                	mov    %ecx,%eax
+     fe5:	c3                   	ret
+     fe6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fed:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ff0 <memset>:
+{
+     ff0:	55                   	push   %ebp
+     ff1:	89 e5                	mov    %esp,%ebp
+     ff3:	57                   	push   %edi
+     ff4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     ff7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     ffa:	8b 45 0c             	mov    0xc(%ebp),%eax
+     ffd:	89 d7                	mov    %edx,%edi
+     fff:	fc                   	cld
+    1000:	f3 aa                	rep stos %al,%es:(%edi)
+}
+    1002:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1005:	89 d0                	mov    %edx,%eax
+    1007:	c9                   	leave
+    1008:	c3                   	ret
+    1009:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001010 <strchr>:
+{
+    1010:	55                   	push   %ebp
+    1011:	89 e5                	mov    %esp,%ebp
+    1013:	8b 45 08             	mov    0x8(%ebp),%eax
+    1016:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    101a:	0f b6 10             	movzbl (%eax),%edx
+    101d:	84 d2                	test   %dl,%dl
+    101f:	75 12                	jne    1033 <strchr+0x23>
+    1021:	eb 1d                	jmp    1040 <strchr+0x30>
+    1023:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1027:	90                   	nop
+    1028:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    102c:	83 c0 01             	add    $0x1,%eax
+    102f:	84 d2                	test   %dl,%dl
+    1031:	74 0d                	je     1040 <strchr+0x30>
+    if(*s == c)
+    1033:	38 d1                	cmp    %dl,%cl
+    1035:	75 f1                	jne    1028 <strchr+0x18>
+}
+    1037:	5d                   	pop    %ebp
+    1038:	c3                   	ret
+    1039:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1040:	31 c0                	xor    %eax,%eax
+}
+    1042:	5d                   	pop    %ebp
+    1043:	c3                   	ret
+    1044:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    104b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    104f:	90                   	nop
+
+00001050 <memchr>:
+{
+    1050:	55                   	push   %ebp
+    1051:	89 e5                	mov    %esp,%ebp
+    1053:	8b 55 10             	mov    0x10(%ebp),%edx
+    1056:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+    1059:	85 d2                	test   %edx,%edx
+    105b:	74 1b                	je     1078 <memchr+0x28>
+    if(*p == (char)c)
+    105d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+    1061:	01 c2                	add    %eax,%edx
+    1063:	eb 0a                	jmp    106f <memchr+0x1f>
+    1065:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+    1068:	83 c0 01             	add    $0x1,%eax
+    106b:	39 c2                	cmp    %eax,%edx
+    106d:	74 09                	je     1078 <memchr+0x28>
+    if(*p == (char)c)
+    106f:	38 08                	cmp    %cl,(%eax)
+    1071:	75 f5                	jne    1068 <memchr+0x18>
+}
+    1073:	5d                   	pop    %ebp
+    1074:	c3                   	ret
+    1075:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+    1078:	31 c0                	xor    %eax,%eax
+}
+    107a:	5d                   	pop    %ebp
+    107b:	c3                   	ret
+    107c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001080 <gets>:
+{
+    1080:	55                   	push   %ebp
+    1081:	89 e5                	mov    %esp,%ebp
+    1083:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+    1084:	31 ff                	xor    %edi,%edi
+{
+    1086:	56                   	push   %esi
+    1087:	be 48 23 00 00       	mov    $0x2348,%esi
+    108c:	53                   	push   %ebx
+    108d:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+    1090:	8b 46 fc             	mov    -0x4(%esi),%eax
+    1093:	85 c0                	test   %eax,%eax
+    1095:	7e 15                	jle    10ac <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+    1097:	83 ec 04             	sub    $0x4,%esp
+    109a:	50                   	push   %eax
+    109b:	56                   	push   %esi
+    109c:	57                   	push   %edi
+    109d:	e8 db 01 00 00       	call   127d <write>
+    ob[fd].n = 0;
+    10a2:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+    10a9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+    10ac:	83 c7 01             	add    $0x1,%edi
+    10af:	81 c6 08 01 00 00    	add    $0x108,%esi
+    10b5:	83 ff 10             	cmp    $0x10,%edi
+    10b8:	75 d6                	jne    1090 <gets+0x10>
+  for(i=0; i+1 < max; ){
+    10ba:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+    10bc:	8d 75 e7             	lea    -0x19(%ebp),%esi
+    10bf:	eb 2e                	jmp    10ef <gets+0x6f>
+    10c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10c8:	83 ec 04             	sub    $0x4,%esp
+    10cb:	6a 01                	push   $0x1
+    10cd:	56                   	push   %esi
+    10ce:	6a 00                	push   $0x0
+    10d0:	e8 a1 01 00 00       	call   1276 <read>
+    if(cc < 1)
+    10d5:	83 c4 10             	add    $0x10,%esp
+    10d8:	85 c0                	test   %eax,%eax
+    10da:	7e 1d                	jle    10f9 <gets+0x79>
+    buf[i++] = c;
+    10dc:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    10e0:	8b 55 08             	mov    0x8(%ebp),%edx
+    10e3:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    10e7:	3c 0a                	cmp    $0xa,%al
+    10e9:	74 10                	je     10fb <gets+0x7b>
+    10eb:	3c 0d                	cmp    $0xd,%al
+    10ed:	74 0c                	je     10fb <gets+0x7b>
+  for(i=0; i+1 < max; ){
+    10ef:	89 df                	mov    %ebx,%edi
+    10f1:	83 c3 01             	add    $0x1,%ebx
+    10f4:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    10f7:	7c cf                	jl     10c8 <gets+0x48>
+    10f9:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+    10fb:	8b 45 08             	mov    0x8(%ebp),%eax
+    10fe:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+    1102:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1105:	5b                   	pop    %ebx
+    1106:	5e                   	pop    %esi
+    1107:	5f                   	pop    %edi
+    1108:	5d                   	pop    %ebp
+    1109:	c3                   	ret
+    110a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001110 <stat>:
+{
+    1110:	55                   	push   %ebp
+    1111:	89 e5                	mov    %esp,%ebp
+    1113:	57                   	push   %edi
+    1114:	56                   	push   %esi
+    1115:	53                   	push   %ebx
+    1116:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+    1119:	6a 00                	push   $0x0
+    111b:	ff 75 08             	push   0x8(%ebp)
+    111e:	e8 76 01 00 00       	call   1299 <open>
+  if(fd < 0)
+    1123:	83 c4 10             	add    $0x10,%esp
+    1126:	85 c0                	test   %eax,%eax
+    1128:	78 76                	js     11a0 <stat+0x90>
+  r = fstat(fd, st);
+    112a:	83 ec 08             	sub    $0x8,%esp
+    112d:	ff 75 0c             	push   0xc(%ebp)
+    1130:	89 c3                	mov    %eax,%ebx
+    1132:	50                   	push   %eax
+    1133:	e8 7f 01 00 00       	call   12b7 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+    1138:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+    113b:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+    113d:	83 fb 0f             	cmp    $0xf,%ebx
+    1140:	7f 40                	jg     1182 <stat+0x72>
+    1142:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+    1148:	8b 90 44 23 00 00    	mov    0x2344(%eax),%edx
+    114e:	8d b8 40 23 00 00    	lea    0x2340(%eax),%edi
+    1154:	85 d2                	test   %edx,%edx
+    1156:	7e 1a                	jle    1172 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+    1158:	83 ec 04             	sub    $0x4,%esp
+    115b:	05 48 23 00 00       	add    $0x2348,%eax
+    1160:	52                   	push   %edx
+    1161:	50                   	push   %eax
+    1162:	53                   	push   %ebx
+    1163:	e8 15 01 00 00       	call   127d <write>
+    ob[fd].n = 0;
+    1168:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+    116f:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+    1172:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+    1178:	c7 80 40 23 00 00 00 	movl   $0x0,0x2340(%eax)
+    117f:	00 00 00 
+  return _close(fd);
+    1182:	83 ec 0c             	sub    $0xc,%esp
+    1185:	53                   	push   %ebx
+    1186:	e8 f9 00 00 00       	call   1284 <_close>
+    118b:	83 c4 10             	add    $0x10,%esp
+}
+    118e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1191:	89 f0                	mov    %esi,%eax
+    1193:	5b                   	pop    %ebx
+    1194:	5e                   	pop    %esi
+    1195:	5f                   	pop    %edi
+    1196:	5d                   	pop    %ebp
+    1197:	c3                   	ret
+    1198:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    119f:	90                   	nop
+    return -1;
+    11a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    11a5:	eb e7                	jmp    118e <stat+0x7e>
+    11a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ae:	66 90                	xchg   %ax,%ax
+
+000011b0 <atoi>:
+{
+    11b0:	55                   	push   %ebp
+    11b1:	89 e5                	mov    %esp,%ebp
+    11b3:	53                   	push   %ebx
+    11b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+    11b7:	0f be 02             	movsbl (%edx),%eax
+    11ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    11bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    11c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    11c5:	77 1e                	ja     11e5 <atoi+0x35>
+    11c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    11d0:	83 c2 01             	add    $0x1,%edx
+    11d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    11d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    11da:	0f be 02             	movsbl (%edx),%eax
+    11dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    11e0:	80 fb 09             	cmp    $0x9,%bl
+    11e3:	76 eb                	jbe    11d0 <atoi+0x20>
+}
+    11e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    11e8:	89 c8                	mov    %ecx,%eax
+    11ea:	c9                   	leave
+    11eb:	c3                   	ret
+    11ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000011f0 <memmove>:
+{
+    11f0:	55                   	push   %ebp
+    11f1:	89 e5                	mov    %esp,%ebp
+    11f3:	57                   	push   %edi
+    11f4:	56                   	push   %esi
+    11f5:	8b 45 10             	mov    0x10(%ebp),%eax
+    11f8:	8b 55 08             	mov    0x8(%ebp),%edx
+    11fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+    11fe:	85 c0                	test   %eax,%eax
+    1200:	7e 13                	jle    1215 <memmove+0x25>
+    1202:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1204:	89 d7                	mov    %edx,%edi
+    1206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    120d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1210:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1211:	39 f8                	cmp    %edi,%eax
+    1213:	75 fb                	jne    1210 <memmove+0x20>
+  return vdst;
+}
+    1215:	5e                   	pop    %esi
+    1216:	89 d0                	mov    %edx,%eax
+    1218:	5f                   	pop    %edi
+    1219:	5d                   	pop    %ebp
+    121a:	c3                   	ret
+
+0000121b <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+    121b:	83 3d 9e 22 00 00 00 	cmpl   $0x0,0x229e
+  jle 1f
+    1222:	7e 0a                	jle    122e <syscallentry+0x13>
+  movl %esp, %ecx
+    1224:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+    1226:	ba 2d 12 00 00       	mov    $0x122d,%edx
+  sysenter
+    122b:	0f 34                	sysenter
+2:
+  ret
+    122d:	c3                   	ret
+1:
+  jl 3f
+    122e:	7c 27                	jl     1257 <syscallentry+0x3c>
+  pushal
+    1230:	60                   	pusha
+  movl $1, %eax
+    1231:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+    1236:	0f a2                	cpuid
+  movl $-1, sysentermode
+    1238:	c7 05 9e 22 00 00 ff 	movl   $0xffffffff,0x229e
+    123f:	ff ff ff 
+  testl $CPUID_SEP, %edx
+    1242:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+    1248:	74 0a                	je     1254 <syscallentry+0x39>
+  movl $1, sysentermode
+    124a:	c7 05 9e 22 00 00 01 	movl   $0x1,0x229e
+    1251:	00 00 00 
+4:
+  popal
+    1254:	61                   	popa
+  jmp syscallentry
+    1255:	eb c4                	jmp    121b <syscallentry>
+3:
+  int $T_SYSCALL
+    1257:	cd 40                	int    $0x40
+  ret
+    1259:	c3                   	ret
+
+0000125a <_fork>:
+
+SYSCALLAS(_fork, fork)
+    125a:	b8 01 00 00 00       	mov    $0x1,%eax
+    125f:	eb ba                	jmp    121b <syscallentry>
+
+00001261 <_exit>:
+SYSCALLAS(_exit, exit)
+    1261:	b8 02 00 00 00       	mov    $0x2,%eax
+    1266:	eb b3                	jmp    121b <syscallentry>
+
+00001268 <wait>:
+SYSCALL(wait)
+    1268:	b8 03 00 00 00       	mov    $0x3,%eax
+    126d:	eb ac                	jmp    121b <syscallentry>
+
+0000126f <pipe>:
+SYSCALL(pipe)
+    126f:	b8 04 00 00 00       	mov    $0x4,%eax
+    1274:	eb a5                	jmp    121b <syscallentry>
+
+00001276 <read>:
+SYSCALL(read)
+    1276:	b8 05 00 00 00       	mov    $0x5,%eax
+    127b:	eb 9e                	jmp    121b <syscallentry>
+
+0000127d <write>:
+SYSCALL(write)
+    127d:	b8 10 00 00 00       	mov    $0x10,%eax
+    1282:	eb 97                	jmp    121b <syscallentry>
+
+00001284 <_close>:
+SYSCALLAS(_close, close)
+    1284:	b8 15 00 00 00       	mov    $0x15,%eax
+    1289:	eb 90                	jmp    121b <syscallentry>
+
+0000128b <kill>:
+SYSCALL(kill)
+    128b:	b8 06 00 00 00       	mov    $0x6,%eax
+    1290:	eb 89                	jmp    121b <syscallentry>
+
+00001292 <_exec>:
+SYSCALLAS(_exec, exec)
+    1292:	b8 07 00 00 00       	mov    $0x7,%eax
+    1297:	eb 82                	jmp    121b <syscallentry>
+
+00001299 <open>:
+SYSCALL(open)
+    1299:	b8 0f 00 00 00       	mov    $0xf,%eax
+    129e:	e9 78 ff ff ff       	jmp    121b <syscallentry>
+
+000012a3 <mknod>:
+SYSCALL(mknod)
+    12a3:	b8 11 00 00 00       	mov    $0x11,%eax
+    12a8:	e9 6e ff ff ff       	jmp    121b <syscallentry>
+
+000012ad <unlink>:
+SYSCALL(unlink)
+    12ad:	b8 12 00 00 00       	mov    $0x12,%eax
+    12b2:	e9 64 ff ff ff       	jmp    121b <syscallentry>
+
+000012b7 <fstat>:
+SYSCALL(fstat)
+    12b7:	b8 08 00 00 00       	mov    $0x8,%eax
+    12bc:	e9 5a ff ff ff       	jmp    121b <syscallentry>
+
+000012c1 <link>:
+SYSCALL(link)
+    12c1:	b8 13 00 00 00       	mov    $0x13,%eax
+    12c6:	e9 50 ff ff ff       	jmp    121b <syscallentry>
+
+000012cb <mkdir>:
+SYSCALL(mkdir)
+    12cb:	b8 14 00 00 00       	mov    $0x14,%eax
+    12d0:	e9 46 ff ff ff       	jmp    121b <syscallentry>
+
+000012d5 <chdir>:
+SYSCALL(chdir)
+    12d5:	b8 09 00 00 00       	mov    $0x9,%eax
+    12da:	e9 3c ff ff ff       	jmp    121b <syscallentry>
+
+000012df <dup>:
+SYSCALL(dup)
+    12df:	b8 0a 00 00 00       	mov    $0xa,%eax
+    12e4:	e9 32 ff ff ff       	jmp    121b <syscallentry>
+
+000012e9 <getpid>:
+SYSCALL(getpid)
+    12e9:	b8 0b 00 00 00       	mov    $0xb,%eax
+    12ee:	e9 28 ff ff ff       	jmp    121b <syscallentry>
+
+000012f3 <sbrk>:
+SYSCALL(sbrk)
+    12f3:	b8 0c 00 00 00       	mov    $0xc,%eax
+    12f8:	e9 1e ff ff ff       	jmp    121b <syscallentry>
+
+000012fd <sleep>:
+SYSCALL(sleep)
+    12fd:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1302:	e9 14 ff ff ff       	jmp    121b <syscallentry>
+
+00001307 <uptime>:
+SYSCALL(uptime)
+    1307:	b8 0e 00 00 00       	mov    $0xe,%eax
+    130c:	e9 0a ff ff ff       	jmp    121b <syscallentry>
+
+00001311 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+    1311:	b8 16 00 00 00       	mov    $0x16,%eax
+    1316:	e9 00 ff ff ff       	jmp    121b <syscallentry>
+
+0000131b <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+    131b:	b8 17 00 00 00       	mov    $0x17,%eax
+    1320:	e9 f6 fe ff ff       	jmp    121b <syscallentry>
+
+00001325 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+    1325:	b8 18 00 00 00       	mov    $0x18,%eax
+    132a:	e9 ec fe ff ff       	jmp    121b <syscallentry>
+
+0000132f <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+    132f:	b8 19 00 00 00       	mov    $0x19,%eax
+    1334:	e9 e2 fe ff ff       	jmp    121b <syscallentry>
+
+00001339 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+    1339:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    133e:	e9 d8 fe ff ff       	jmp    121b <syscallentry>
+
+00001343 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+    1343:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1348:	e9 ce fe ff ff       	jmp    121b <syscallentry>
+
+0000134d <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+    134d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1352:	e9 c4 fe ff ff       	jmp    121b <syscallentry>
+
+00001357 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+    1357:	b8 20 00 00 00       	mov    $0x20,%eax
+    135c:	e9 ba fe ff ff       	jmp    121b <syscallentry>
+
+00001361 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+    1361:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1366:	e9 b0 fe ff ff       	jmp    121b <syscallentry>
+
+0000136b <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+    136b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1370:	e9 a6 fe ff ff       	jmp    121b <syscallentry>
+
+00001375 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+    1375:	b8 21 00 00 00       	mov    $0x21,%eax
+    137a:	e9 9c fe ff ff       	jmp    121b <syscallentry>
+
+0000137f <yield>:
+SYSCALL(yield) // yield the CPU to another process
+    137f:	b8 22 00 00 00       	mov    $0x22,%eax
+    1384:	e9 92 fe ff ff       	jmp    121b <syscallentry>
+
+00001389 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+    1389:	b8 23 00 00 00       	mov    $0x23,%eax
+    138e:	e9 88 fe ff ff       	jmp    121b <syscallentry>
+
+00001393 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+    1393:	b8 24 00 00 00       	mov    $0x24,%eax
+    1398:	e9 7e fe ff ff       	jmp    121b <syscallentry>
+
+0000139d <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+    139d:	b8 25 00 00 00       	mov    $0x25,%eax
+    13a2:	e9 74 fe ff ff       	jmp    121b <syscallentry>
+
+000013a7 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+    13a7:	b8 26 00 00 00       	mov    $0x26,%eax
+    13ac:	e9 6a fe ff ff       	jmp    121b <syscallentry>
+
+000013b1 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+    13b1:	b8 27 00 00 00       	mov    $0x27,%eax
+    13b6:	e9 60 fe ff ff       	jmp    121b <syscallentry>
+
+000013bb <mmap>:
+SYSCALL(mmap) // map a file into memory
+    13bb:	b8 28 00 00 00       	mov    $0x28,%eax
+    13c0:	e9 56 fe ff ff       	jmp    121b <syscallentry>
+
+000013c5 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+    13c5:	b8 29 00 00 00       	mov    $0x29,%eax
+    13ca:	e9 4c fe ff ff       	jmp    121b <syscallentry>
+
+000013cf <readv>:
+SYSCALL(readv) // read into several buffers
+    13cf:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    13d4:	e9 42 fe ff ff       	jmp    121b <syscallentry>
+
+000013d9 <writev>:
+SYSCALL(writev) // write from several buffers
+    13d9:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    13de:	e9 38 fe ff ff       	jmp    121b <syscallentry>
+
+000013e3 <pread>:
+SYSCALL(pread) // read at an offset
+    13e3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    13e8:	e9 2e fe ff ff       	jmp    121b <syscallentry>
+
+000013ed <pwrite>:
+SYSCALL(pwrite) // write at an offset
+    13ed:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    13f2:	e9 24 fe ff ff       	jmp    121b <syscallentry>
+
+000013f7 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+    13f7:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    13fc:	e9 1a fe ff ff       	jmp    121b <syscallentry>
+
+00001401 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+    1401:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    1406:	e9 10 fe ff ff       	jmp    121b <syscallentry>
+
+0000140b <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+    140b:	b8 30 00 00 00       	mov    $0x30,%eax
+    1410:	e9 06 fe ff ff       	jmp    121b <syscallentry>
+
+00001415 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+    1415:	b8 31 00 00 00       	mov    $0x31,%eax
+    141a:	e9 fc fd ff ff       	jmp    121b <syscallentry>
+
+0000141f <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+    141f:	b8 32 00 00 00       	mov    $0x32,%eax
+    1424:	e9 f2 fd ff ff       	jmp    121b <syscallentry>
+
+00001429 <profread>:
+SYSCALL(profread) // drain profiler samples
+    1429:	b8 33 00 00 00       	mov    $0x33,%eax
+    142e:	e9 e8 fd ff ff       	jmp    121b <syscallentry>
+
+00001433 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+    1433:	b8 34 00 00 00       	mov    $0x34,%eax
+    1438:	e9 de fd ff ff       	jmp    121b <syscallentry>
+
+0000143d <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+    143d:	b8 35 00 00 00       	mov    $0x35,%eax
+    1442:	e9 d4 fd ff ff       	jmp    121b <syscallentry>
+
+00001447 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+    1447:	b8 36 00 00 00       	mov    $0x36,%eax
+    144c:	e9 ca fd ff ff       	jmp    121b <syscallentry>
+
+00001451 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+    1451:	b8 37 00 00 00       	mov    $0x37,%eax
+    1456:	e9 c0 fd ff ff       	jmp    121b <syscallentry>
+    145b:	66 90                	xchg   %ax,%ax
+    145d:	66 90                	xchg   %ax,%ax
+    145f:	90                   	nop
+
+00001460 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1460:	55                   	push   %ebp
+    1461:	89 e5                	mov    %esp,%ebp
+    1463:	57                   	push   %edi
+    1464:	56                   	push   %esi
+    1465:	53                   	push   %ebx
+    1466:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1468:	89 d1                	mov    %edx,%ecx
+{
+    146a:	83 ec 3c             	sub    $0x3c,%esp
+    146d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1470:	85 d2                	test   %edx,%edx
+    1472:	0f 89 80 00 00 00    	jns    14f8 <printint+0x98>
+    1478:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    147c:	74 7a                	je     14f8 <printint+0x98>
+    x = -xx;
+    147e:	f7 d9                	neg    %ecx
+    neg = 1;
+    1480:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1485:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1488:	31 f6                	xor    %esi,%esi
+    148a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1490:	89 c8                	mov    %ecx,%eax
+    1492:	31 d2                	xor    %edx,%edx
+    1494:	89 f7                	mov    %esi,%edi
+    1496:	f7 f3                	div    %ebx
+    1498:	8d 76 01             	lea    0x1(%esi),%esi
+    149b:	0f b6 92 f8 1a 00 00 	movzbl 0x1af8(%edx),%edx
+    14a2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    14a6:	89 ca                	mov    %ecx,%edx
+    14a8:	89 c1                	mov    %eax,%ecx
+    14aa:	39 da                	cmp    %ebx,%edx
+    14ac:	73 e2                	jae    1490 <printint+0x30>
+  if(neg)
+    14ae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    14b1:	85 c0                	test   %eax,%eax
+    14b3:	74 07                	je     14bc <printint+0x5c>
+    buf[i++] = '-';
+    14b5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    14ba:	89 f7                	mov    %esi,%edi
+    14bc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    14bf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    14c2:	01 df                	add    %ebx,%edi
+    14c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    14c8:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+    14cb:	83 ec 04             	sub    $0x4,%esp
+    14ce:	88 45 d7             	mov    %al,-0x29(%ebp)
+    14d1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    14d4:	6a 01                	push   $0x1
+    14d6:	50                   	push   %eax
+    14d7:	56                   	push   %esi
+    14d8:	e8 e3 f6 ff ff       	call   bc0 <bufwrite>
+  while(--i >= 0)
+    14dd:	89 f8                	mov    %edi,%eax
+    14df:	83 c4 10             	add    $0x10,%esp
+    14e2:	83 ef 01             	sub    $0x1,%edi
+    14e5:	39 d8                	cmp    %ebx,%eax
+    14e7:	75 df                	jne    14c8 <printint+0x68>
+}
+    14e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14ec:	5b                   	pop    %ebx
+    14ed:	5e                   	pop    %esi
+    14ee:	5f                   	pop    %edi
+    14ef:	5d                   	pop    %ebp
+    14f0:	c3                   	ret
+    14f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    14f8:	31 c0                	xor    %eax,%eax
+    14fa:	eb 89                	jmp    1485 <printint+0x25>
+    14fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001500 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1500:	55                   	push   %ebp
+    1501:	89 e5                	mov    %esp,%ebp
+    1503:	57                   	push   %edi
+    1504:	56                   	push   %esi
+    1505:	53                   	push   %ebx
+    1506:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1509:	8b 45 0c             	mov    0xc(%ebp),%eax
+    150c:	0f b6 18             	movzbl (%eax),%ebx
+    150f:	84 db                	test   %bl,%bl
+    1511:	74 6c                	je     157f <printf+0x7f>
+    1513:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+    1516:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+    1519:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+    151b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    151e:	eb 26                	jmp    1546 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    1520:	83 f8 25             	cmp    $0x25,%eax
+    1523:	74 4b                	je     1570 <printf+0x70>
+  bufwrite(fd, &c, 1);
+    1525:	83 ec 04             	sub    $0x4,%esp
+    1528:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    152b:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+    152e:	6a 01                	push   $0x1
+    1530:	50                   	push   %eax
+    1531:	ff 75 08             	push   0x8(%ebp)
+    1534:	e8 87 f6 ff ff       	call   bc0 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+    1539:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    153c:	0f b6 1f             	movzbl (%edi),%ebx
+    153f:	83 c7 01             	add    $0x1,%edi
+    1542:	84 db                	test   %bl,%bl
+    1544:	74 39                	je     157f <printf+0x7f>
+    c = fmt[i] & 0xff;
+    1546:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    1549:	85 f6                	test   %esi,%esi
+    154b:	74 d3                	je     1520 <printf+0x20>
+      }
+    } else if(state == '%'){
+    154d:	83 fe 25             	cmp    $0x25,%esi
+    1550:	75 ea                	jne    153c <printf+0x3c>
+      if(c == 'd'){
+    1552:	83 f8 25             	cmp    $0x25,%eax
+    1555:	0f 84 d5 01 00 00    	je     1730 <printf+0x230>
+    155b:	83 e8 63             	sub    $0x63,%eax
+    155e:	83 f8 15             	cmp    $0x15,%eax
+    1561:	77 45                	ja     15a8 <printf+0xa8>
+    1563:	ff 24 85 a0 1a 00 00 	jmp    *0x1aa0(,%eax,4)
+    156a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+    1570:	0f b6 1f             	movzbl (%edi),%ebx
+    1573:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+    1576:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    157b:	84 db                	test   %bl,%bl
+    157d:	75 c7                	jne    1546 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+    157f:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+    1583:	74 0b                	je     1590 <printf+0x90>
+    fflush(fd);
+}
+    1585:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1588:	5b                   	pop    %ebx
+    1589:	5e                   	pop    %esi
+    158a:	5f                   	pop    %edi
+    158b:	5d                   	pop    %ebp
+    158c:	c3                   	ret
+    158d:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+    1590:	83 ec 0c             	sub    $0xc,%esp
+    1593:	6a 02                	push   $0x2
+    1595:	e8 c6 f7 ff ff       	call   d60 <fflush>
+    159a:	83 c4 10             	add    $0x10,%esp
+}
+    159d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15a0:	5b                   	pop    %ebx
+    15a1:	5e                   	pop    %esi
+    15a2:	5f                   	pop    %edi
+    15a3:	5d                   	pop    %ebp
+    15a4:	c3                   	ret
+    15a5:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+    15a8:	83 ec 04             	sub    $0x4,%esp
+    15ab:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+    15ae:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+    15b2:	6a 01                	push   $0x1
+    15b4:	52                   	push   %edx
+    15b5:	89 55 c0             	mov    %edx,-0x40(%ebp)
+    15b8:	ff 75 08             	push   0x8(%ebp)
+    15bb:	e8 00 f6 ff ff       	call   bc0 <bufwrite>
+    15c0:	83 c4 0c             	add    $0xc,%esp
+    15c3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+    15c6:	6a 01                	push   $0x1
+    15c8:	8b 55 c0             	mov    -0x40(%ebp),%edx
+    15cb:	52                   	push   %edx
+      state = 0;
+    15cc:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+    15ce:	ff 75 08             	push   0x8(%ebp)
+    15d1:	e8 ea f5 ff ff       	call   bc0 <bufwrite>
+        putc(fd, c);
+    15d6:	83 c4 10             	add    $0x10,%esp
+    15d9:	e9 5e ff ff ff       	jmp    153c <printf+0x3c>
+    15de:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+    15e0:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+    15e3:	83 ec 0c             	sub    $0xc,%esp
+    15e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    15eb:	8b 16                	mov    (%esi),%edx
+    15ed:	6a 00                	push   $0x0
+    15ef:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+    15f2:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+    15f5:	e8 66 fe ff ff       	call   1460 <printint>
+        ap++;
+    15fa:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+    15fd:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1600:	31 f6                	xor    %esi,%esi
+    1602:	e9 35 ff ff ff       	jmp    153c <printf+0x3c>
+    1607:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    160e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+    1610:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1613:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1615:	83 c0 04             	add    $0x4,%eax
+    1618:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+    161b:	b8 98 1a 00 00       	mov    $0x1a98,%eax
+    1620:	85 db                	test   %ebx,%ebx
+    1622:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+    1625:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+    1628:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+    162a:	53                   	push   %ebx
+    162b:	e8 90 f9 ff ff       	call   fc0 <strlen>
+    1630:	83 c4 0c             	add    $0xc,%esp
+    1633:	50                   	push   %eax
+    1634:	53                   	push   %ebx
+    1635:	ff 75 08             	push   0x8(%ebp)
+    1638:	e8 83 f5 ff ff       	call   bc0 <bufwrite>
+    163d:	83 c4 10             	add    $0x10,%esp
+    1640:	e9 f7 fe ff ff       	jmp    153c <printf+0x3c>
+    1645:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+    1648:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+    164b:	83 ec 04             	sub    $0x4,%esp
+    164e:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+    1651:	8b 06                	mov    (%esi),%eax
+        ap++;
+    1653:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+    1656:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+    1659:	6a 01                	push   $0x1
+    165b:	52                   	push   %edx
+    165c:	ff 75 08             	push   0x8(%ebp)
+    165f:	e8 5c f5 ff ff       	call   bc0 <bufwrite>
+        ap++;
+    1664:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+    1667:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    166a:	31 f6                	xor    %esi,%esi
+    166c:	e9 cb fe ff ff       	jmp    153c <printf+0x3c>
+    1671:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+    1678:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+    167b:	83 ec 0c             	sub    $0xc,%esp
+    167e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    1683:	8b 16                	mov    (%esi),%edx
+    1685:	6a 01                	push   $0x1
+    1687:	e9 63 ff ff ff       	jmp    15ef <printf+0xef>
+    168c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+    1690:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1693:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+    1696:	89 7d c0             	mov    %edi,-0x40(%ebp)
+    1699:	89 55 bc             	mov    %edx,-0x44(%ebp)
+    169c:	8b 18                	mov    (%eax),%ebx
+    169e:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+    16a1:	31 c0                	xor    %eax,%eax
+    16a3:	89 c7                	mov    %eax,%edi
+    16a5:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+    16a8:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+    16ad:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+    16af:	f7 e1                	mul    %ecx
+    16b1:	c1 ea 03             	shr    $0x3,%edx
+    16b4:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    16b7:	89 d1                	mov    %edx,%ecx
+    16b9:	01 c0                	add    %eax,%eax
+    16bb:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+    16bd:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+    16bf:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+    16c1:	be 0a 00 00 00       	mov    $0xa,%esi
+    16c6:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+    16c8:	89 da                	mov    %ebx,%edx
+    16ca:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+    16cc:	89 fe                	mov    %edi,%esi
+    16ce:	83 c7 01             	add    $0x1,%edi
+    16d1:	8d 42 30             	lea    0x30(%edx),%eax
+    16d4:	89 da                	mov    %ebx,%edx
+    16d6:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    16d9:	01 d2                	add    %edx,%edx
+    16db:	29 d0                	sub    %edx,%eax
+    16dd:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+    16e1:	89 c8                	mov    %ecx,%eax
+    16e3:	09 d8                	or     %ebx,%eax
+    16e5:	75 c1                	jne    16a8 <printf+0x1a8>
+    16e7:	8b 55 bc             	mov    -0x44(%ebp),%edx
+    16ea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    16ed:	01 d6                	add    %edx,%esi
+    16ef:	89 f7                	mov    %esi,%edi
+    16f1:	89 d6                	mov    %edx,%esi
+    16f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    16f7:	90                   	nop
+    putc(fd, buf[i]);
+    16f8:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+    16fb:	83 ec 04             	sub    $0x4,%esp
+    16fe:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+    1701:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+    1704:	6a 01                	push   $0x1
+    1706:	50                   	push   %eax
+    1707:	53                   	push   %ebx
+    1708:	e8 b3 f4 ff ff       	call   bc0 <bufwrite>
+  while(--i >= 0)
+    170d:	89 fa                	mov    %edi,%edx
+    170f:	83 c4 10             	add    $0x10,%esp
+    1712:	83 ef 01             	sub    $0x1,%edi
+    1715:	39 d6                	cmp    %edx,%esi
+    1717:	75 df                	jne    16f8 <printf+0x1f8>
+        ap += 2;
+    1719:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+    171d:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+    1720:	31 f6                	xor    %esi,%esi
+    1722:	e9 15 fe ff ff       	jmp    153c <printf+0x3c>
+    1727:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    172e:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+    1730:	83 ec 04             	sub    $0x4,%esp
+    1733:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+    1736:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+    1739:	6a 01                	push   $0x1
+    173b:	e9 8b fe ff ff       	jmp    15cb <printf+0xcb>
+
+00001740 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1740:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1741:	a1 c0 33 00 00       	mov    0x33c0,%eax
+{
+    1746:	89 e5                	mov    %esp,%ebp
+    1748:	57                   	push   %edi
+    1749:	56                   	push   %esi
+    174a:	53                   	push   %ebx
+    174b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    174e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1751:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1758:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    175a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    175c:	39 ca                	cmp    %ecx,%edx
+    175e:	73 30                	jae    1790 <free+0x50>
+    1760:	39 c1                	cmp    %eax,%ecx
+    1762:	72 04                	jb     1768 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1764:	39 c2                	cmp    %eax,%edx
+    1766:	72 f0                	jb     1758 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1768:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    176b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    176e:	39 f8                	cmp    %edi,%eax
+    1770:	74 2e                	je     17a0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1772:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1775:	8b 42 04             	mov    0x4(%edx),%eax
+    1778:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    177b:	39 f1                	cmp    %esi,%ecx
+    177d:	74 38                	je     17b7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    177f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1781:	5b                   	pop    %ebx
+  freep = p;
+    1782:	89 15 c0 33 00 00    	mov    %edx,0x33c0
+}
+    1788:	5e                   	pop    %esi
+    1789:	5f                   	pop    %edi
+    178a:	5d                   	pop    %ebp
+    178b:	c3                   	ret
+    178c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1790:	39 c1                	cmp    %eax,%ecx
+    1792:	72 d0                	jb     1764 <free+0x24>
+    1794:	eb c2                	jmp    1758 <free+0x18>
+    1796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    179d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    17a0:	03 70 04             	add    0x4(%eax),%esi
+    17a3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    17a6:	8b 02                	mov    (%edx),%eax
+    17a8:	8b 00                	mov    (%eax),%eax
+    17aa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    17ad:	8b 42 04             	mov    0x4(%edx),%eax
+    17b0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    17b3:	39 f1                	cmp    %esi,%ecx
+    17b5:	75 c8                	jne    177f <free+0x3f>
+    p->s.size += bp->s.size;
+    17b7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    17ba:	89 15 c0 33 00 00    	mov    %edx,0x33c0
+    p->s.size += bp->s.size;
+    17c0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    17c3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    17c6:	89 0a                	mov    %ecx,(%edx)
+}
+    17c8:	5b                   	pop    %ebx
+    17c9:	5e                   	pop    %esi
+    17ca:	5f                   	pop    %edi
+    17cb:	5d                   	pop    %ebp
+    17cc:	c3                   	ret
+    17cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000017d0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    17d0:	55                   	push   %ebp
+    17d1:	89 e5                	mov    %esp,%ebp
+    17d3:	57                   	push   %edi
+    17d4:	56                   	push   %esi
+    17d5:	53                   	push   %ebx
+    17d6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    17d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    17dc:	8b 15 c0 33 00 00    	mov    0x33c0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    17e2:	8d 78 07             	lea    0x7(%eax),%edi
+    17e5:	c1 ef 03             	shr    $0x3,%edi
+    17e8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    17eb:	85 d2                	test   %edx,%edx
+    17ed:	0f 84 8d 00 00 00    	je     1880 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    17f3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    17f5:	8b 48 04             	mov    0x4(%eax),%ecx
+    17f8:	39 f9                	cmp    %edi,%ecx
+    17fa:	73 64                	jae    1860 <malloc+0x90>
+  if(nu < 4096)
+    17fc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1801:	39 df                	cmp    %ebx,%edi
+    1803:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1806:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    180d:	eb 0a                	jmp    1819 <malloc+0x49>
+    180f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1810:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1812:	8b 48 04             	mov    0x4(%eax),%ecx
+    1815:	39 f9                	cmp    %edi,%ecx
+    1817:	73 47                	jae    1860 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1819:	89 c2                	mov    %eax,%edx
+    181b:	39 05 c0 33 00 00    	cmp    %eax,0x33c0
+    1821:	75 ed                	jne    1810 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1823:	83 ec 0c             	sub    $0xc,%esp
+    1826:	56                   	push   %esi
+    1827:	e8 c7 fa ff ff       	call   12f3 <sbrk>
+  if(p == (char*)-1)
+    182c:	83 c4 10             	add    $0x10,%esp
+    182f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1832:	74 1c                	je     1850 <malloc+0x80>
+  hp->s.size = nu;
+    1834:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1837:	83 ec 0c             	sub    $0xc,%esp
+    183a:	83 c0 08             	add    $0x8,%eax
+    183d:	50                   	push   %eax
+    183e:	e8 fd fe ff ff       	call   1740 <free>
+  return freep;
+    1843:	8b 15 c0 33 00 00    	mov    0x33c0,%edx
+      if((p = morecore(nunits)) == 0)
+    1849:	83 c4 10             	add    $0x10,%esp
+    184c:	85 d2                	test   %edx,%edx
+    184e:	75 c0                	jne    1810 <malloc+0x40>
+        return 0;
+  }
+}
+    1850:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1853:	31 c0                	xor    %eax,%eax
+}
+    1855:	5b                   	pop    %ebx
+    1856:	5e                   	pop    %esi
+    1857:	5f                   	pop    %edi
+    1858:	5d                   	pop    %ebp
+    1859:	c3                   	ret
+    185a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1860:	39 cf                	cmp    %ecx,%edi
+    1862:	74 4c                	je     18b0 <malloc+0xe0>
+        p->s.size -= nunits;
+    1864:	29 f9                	sub    %edi,%ecx
+    1866:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1869:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    186c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    186f:	89 15 c0 33 00 00    	mov    %edx,0x33c0
+}
+    1875:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1878:	83 c0 08             	add    $0x8,%eax
+}
+    187b:	5b                   	pop    %ebx
+    187c:	5e                   	pop    %esi
+    187d:	5f                   	pop    %edi
+    187e:	5d                   	pop    %ebp
+    187f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1880:	c7 05 c0 33 00 00 c4 	movl   $0x33c4,0x33c0
+    1887:	33 00 00 
+    base.s.size = 0;
+    188a:	b8 c4 33 00 00       	mov    $0x33c4,%eax
+    base.s.ptr = freep = prevp = &base;
+    188f:	c7 05 c4 33 00 00 c4 	movl   $0x33c4,0x33c4
+    1896:	33 00 00 
+    base.s.size = 0;
+    1899:	c7 05 c8 33 00 00 00 	movl   $0x0,0x33c8
+    18a0:	00 00 00 
+    if(p->s.size >= nunits){
+    18a3:	e9 54 ff ff ff       	jmp    17fc <malloc+0x2c>
+    18a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18af:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    18b0:	8b 08                	mov    (%eax),%ecx
+    18b2:	89 0a                	mov    %ecx,(%edx)
+    18b4:	eb b9                	jmp    186f <malloc+0x9f>
+    18b6:	66 90                	xchg   %ax,%ax
+    18b8:	66 90                	xchg   %ax,%ax
+    18ba:	66 90                	xchg   %ax,%ax
+    18bc:	66 90                	xchg   %ax,%ax
+    18be:	66 90                	xchg   %ax,%ax
+
+000018c0 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+    18c0:	55                   	push   %ebp
+    18c1:	89 e5                	mov    %esp,%ebp
+    18c3:	57                   	push   %edi
+    18c4:	56                   	push   %esi
+    18c5:	be 01 00 00 00       	mov    $0x1,%esi
+    18ca:	53                   	push   %ebx
+    18cb:	83 ec 28             	sub    $0x28,%esp
+    18ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+    18d1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    18d4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+    18d7:	68 00 98 00 00       	push   $0x9800
+    18dc:	e8 ef fe ff ff       	call   17d0 <malloc>
+    18e1:	83 c4 10             	add    $0x10,%esp
+    18e4:	89 c7                	mov    %eax,%edi
+    18e6:	85 c0                	test   %eax,%eax
+    18e8:	74 62                	je     194c <waitpoll+0x8c>
+    18ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+    18f0:	83 ec 0c             	sub    $0xc,%esp
+    18f3:	6a 01                	push   $0x1
+    18f5:	e8 03 fa ff ff       	call   12fd <sleep>
+    fn();
+    18fa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    18fd:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+    18ff:	58                   	pop    %eax
+    1900:	5a                   	pop    %edx
+    1901:	68 00 02 00 00       	push   $0x200
+    1906:	57                   	push   %edi
+    1907:	e8 eb fa ff ff       	call   13f7 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+    190c:	83 c4 10             	add    $0x10,%esp
+    190f:	85 c0                	test   %eax,%eax
+    1911:	7e 2d                	jle    1940 <waitpoll+0x80>
+    1913:	6b c0 4c             	imul   $0x4c,%eax,%eax
+    1916:	89 fa                	mov    %edi,%edx
+    alive = 0;
+    1918:	31 c9                	xor    %ecx,%ecx
+    191a:	01 f8                	add    %edi,%eax
+    191c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+    1920:	3b 1a                	cmp    (%edx),%ebx
+    1922:	75 07                	jne    192b <waitpoll+0x6b>
+        alive = 1;
+    1924:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+    1928:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+    192b:	83 c2 4c             	add    $0x4c,%edx
+    192e:	39 d0                	cmp    %edx,%eax
+    1930:	75 ee                	jne    1920 <waitpoll+0x60>
+  } while(alive);
+    1932:	85 c9                	test   %ecx,%ecx
+    1934:	75 ba                	jne    18f0 <waitpoll+0x30>
+    1936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    193d:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+    1940:	83 ec 0c             	sub    $0xc,%esp
+    1943:	57                   	push   %edi
+    1944:	e8 f7 fd ff ff       	call   1740 <free>
+  wait();
+    1949:	83 c4 10             	add    $0x10,%esp
+}
+    194c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    194f:	5b                   	pop    %ebx
+    1950:	5e                   	pop    %esi
+    1951:	5f                   	pop    %edi
+    1952:	5d                   	pop    %ebp
+  wait();
+    1953:	e9 10 f9 ff ff       	jmp    1268 <wait>
+    1958:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    195f:	90                   	nop
+
+00001960 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+    1960:	55                   	push   %ebp
+    1961:	89 e5                	mov    %esp,%ebp
+    1963:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+    1966:	c7 45 f0 09 1b 00 00 	movl   $0x1b09,-0x10(%ebp)
+    196d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+    1974:	e8 87 f4 ff ff       	call   e00 <fork>
+    1979:	85 c0                	test   %eax,%eax
+    197b:	78 09                	js     1986 <runps+0x26>
+    return -1;
+  if(pid == 0){
+    197d:	74 0e                	je     198d <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+    197f:	e8 e4 f8 ff ff       	call   1268 <wait>
+}
+    1984:	c9                   	leave
+    1985:	c3                   	ret
+    1986:	c9                   	leave
+    return -1;
+    1987:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    198c:	c3                   	ret
+    exec("ps", argv);
+    198d:	50                   	push   %eax
+    198e:	50                   	push   %eax
+    198f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    1992:	50                   	push   %eax
+    1993:	68 09 1b 00 00       	push   $0x1b09
+    1998:	e8 c3 f4 ff ff       	call   e60 <exec>
+    printf(2, "exec ps failed\n");
+    199d:	5a                   	pop    %edx
+    199e:	59                   	pop    %ecx
+    199f:	68 0c 1b 00 00       	push   $0x1b0c
+    19a4:	6a 02                	push   $0x2
+    19a6:	e8 55 fb ff ff       	call   1500 <printf>
+    exit();
+    19ab:	e8 a0 f4 ff ff       	call   e50 <exit>
@@ -0,0 +1,2100 @@
+
+_sjf_test:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "user.h"
+#include "fcntl.h" // Include for scheduler policy defines
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 28             	sub    $0x28,%esp
+  // Set the scheduler policy to SJF for this test
+  if (setschedpolicy(SCHED_SJF) < 0) {
+  13:	6a 01                	push   $0x1
+  15:	e8 fd 08 00 00       	call   917 <setschedpolicy>
+  1a:	83 c4 10             	add    $0x10,%esp
+  1d:	85 c0                	test   %eax,%eax
+  1f:	0f 88 c0 00 00 00    	js     e5 <main+0xe5>
+    printf(1, "Error setting scheduler policy to SJF\n");
+    exit();
+  }
+  printf(1, "Set scheduler to SJF (policy %d)\n", SCHED_SJF);
+  25:	56                   	push   %esi
+  26:	6a 01                	push   $0x1
+  28:	68 98 0f 00 00       	push   $0xf98
+  2d:	6a 01                	push   $0x1
+  2f:	e8 8c 0a 00 00       	call   ac0 <printf>
+
+  printf(1, "Shortest Job First (SJF) Scheduler Test\n");
+  34:	58                   	pop    %eax
+  35:	5a                   	pop    %edx
+  36:	68 bc 0f 00 00       	push   $0xfbc
+  3b:	6a 01                	push   $0x1
+  3d:	e8 7e 0a 00 00       	call   ac0 <printf>
+  printf(1, "----------------------------------------\n");
+  42:	59                   	pop    %ecx
+  43:	5b                   	pop    %ebx
+  44:	68 e8 0f 00 00       	push   $0xfe8
+  49:	6a 01                	push   $0x1
+
+  // Fork multiple processes with different computation lengths
+  // SJF should prioritize the shorter jobs first
+  int computation_lengths[] = {2000000, 1000000, 5000000}; // Medium, Short, Long
+
+  for(i = 0; i < 3; i++) {
+  4b:	31 db                	xor    %ebx,%ebx
+  printf(1, "----------------------------------------\n");
+  4d:	e8 6e 0a 00 00       	call   ac0 <printf>
+  printf(1, "Creating processes with varying computation times:\n");
+  52:	5e                   	pop    %esi
+  53:	58                   	pop    %eax
+  54:	68 14 10 00 00       	push   $0x1014
+  59:	6a 01                	push   $0x1
+  5b:	e8 60 0a 00 00       	call   ac0 <printf>
+  printf(1, "Process 0: Medium (2M), Process 1: Short (1M), Process 2: Long (5M)\n");
+  60:	58                   	pop    %eax
+  61:	5a                   	pop    %edx
+  62:	68 48 10 00 00       	push   $0x1048
+  67:	6a 01                	push   $0x1
+  69:	e8 52 0a 00 00       	call   ac0 <printf>
+  int computation_lengths[] = {2000000, 1000000, 5000000}; // Medium, Short, Long
+  6e:	c7 45 dc 80 84 1e 00 	movl   $0x1e8480,-0x24(%ebp)
+  75:	83 c4 10             	add    $0x10,%esp
+  78:	c7 45 e0 40 42 0f 00 	movl   $0xf4240,-0x20(%ebp)
+  7f:	c7 45 e4 40 4b 4c 00 	movl   $0x4c4b40,-0x1c(%ebp)
+    pid = fork();
+  86:	e8 35 03 00 00       	call   3c0 <fork>
+    if(pid < 0) {
+  8b:	85 c0                	test   %eax,%eax
+  8d:	78 69                	js     f8 <main+0xf8>
+      printf(1, "Error: fork failed\n");
+      exit();
+    }
+    if(pid == 0) {
+  8f:	74 7a                	je     10b <main+0x10b>
+  for(i = 0; i < 3; i++) {
+  91:	83 c3 01             	add    $0x1,%ebx
+  94:	83 fb 03             	cmp    $0x3,%ebx
+  97:	75 ed                	jne    86 <main+0x86>
+      exit();
+    }
+  }
+
+  // Parent waits for all children
+  printf(1, "Parent waiting for children (expect finish order: 1, 0, 2)...\n");
+  99:	50                   	push   %eax
+  9a:	50                   	push   %eax
+  9b:	68 f0 10 00 00       	push   $0x10f0
+  a0:	6a 01                	push   $0x1
+  a2:	e8 19 0a 00 00       	call   ac0 <printf>
+  for(i = 0; i < 3; i++) {
+    wait();
+  a7:	e8 7c 07 00 00       	call   828 <wait>
+  ac:	e8 77 07 00 00       	call   828 <wait>
+  b1:	e8 72 07 00 00       	call   828 <wait>
+  }
+
+  printf(1, "All child processes have completed\n");
+  b6:	5a                   	pop    %edx
+  b7:	59                   	pop    %ecx
+  b8:	68 30 11 00 00       	push   $0x1130
+  bd:	6a 01                	push   $0x1
+  bf:	e8 fc 09 00 00       	call   ac0 <printf>
+  printf(1, "Observe the finish order - shorter jobs should finish first.\n");
+  c4:	5b                   	pop    %ebx
+  c5:	5e                   	pop    %esi
+  c6:	68 54 11 00 00       	push   $0x1154
+  cb:	6a 01                	push   $0x1
+  cd:	e8 ee 09 00 00       	call   ac0 <printf>
+  printf(1, "SJF scheduler test completed\n");
+  d2:	58                   	pop    %eax
+  d3:	5a                   	pop    %edx
+  d4:	68 c2 11 00 00       	push   $0x11c2
+  d9:	6a 01                	push   $0x1
+  db:	e8 e0 09 00 00       	call   ac0 <printf>
+
+  exit();
+  e0:	e8 2b 03 00 00       	call   410 <exit>
+    printf(1, "Error setting scheduler policy to SJF\n");
+  e5:	51                   	push   %ecx
+  e6:	51                   	push   %ecx
+  e7:	68 70 0f 00 00       	push   $0xf70
+  ec:	6a 01                	push   $0x1
+  ee:	e8 cd 09 00 00       	call   ac0 <printf>
+    exit();
+  f3:	e8 18 03 00 00       	call   410 <exit>
+      printf(1, "Error: fork failed\n");
+  f8:	53                   	push   %ebx
+  f9:	53                   	push   %ebx
+  fa:	68 92 11 00 00       	push   $0x1192
+  ff:	6a 01                	push   $0x1
+ 101:	e8 ba 09 00 00       	call   ac0 <printf>
+      exit();
+ 106:	e8 05 03 00 00       	call   410 <exit>
+      int len = computation_lengths[i];
+ 10b:	8b 74 9d dc          	mov    -0x24(%ebp,%ebx,4),%esi
+      set_burst_estimate(len);
+ 10f:	83 ec 0c             	sub    $0xc,%esp
+ 112:	56                   	push   %esi
+ 113:	e8 1d 08 00 00       	call   935 <set_burst_estimate>
+      printf(1, "Child %d (PID %d) created. Computation length: %d\n", i, getpid(), len);
+ 118:	e8 8c 07 00 00       	call   8a9 <getpid>
+ 11d:	89 34 24             	mov    %esi,(%esp)
+ 120:	50                   	push   %eax
+ 121:	53                   	push   %ebx
+ 122:	68 90 10 00 00       	push   $0x1090
+ 127:	6a 01                	push   $0x1
+ 129:	e8 92 09 00 00       	call   ac0 <printf>
+      printf(1, "Child %d (PID %d) starting computation...\n", i, getpid());
+ 12e:	83 c4 20             	add    $0x20,%esp
+ 131:	e8 73 07 00 00       	call   8a9 <getpid>
+ 136:	50                   	push   %eax
+ 137:	53                   	push   %ebx
+ 138:	68 c4 10 00 00       	push   $0x10c4
+ 13d:	6a 01                	push   $0x1
+ 13f:	e8 7c 09 00 00       	call   ac0 <printf>
+      for(j = 0; j < len; j++) {
+ 144:	31 c9                	xor    %ecx,%ecx
+ 146:	83 c4 10             	add    $0x10,%esp
+ 149:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+ 14c:	eb 09                	jmp    157 <main+0x157>
+ 14e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 151:	83 c0 01             	add    $0x1,%eax
+ 154:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 157:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 15a:	39 f0                	cmp    %esi,%eax
+ 15c:	7c f0                	jl     14e <main+0x14e>
+      printf(1, "Child %d (PID %d) finished\n", i, getpid());
+ 15e:	e8 46 07 00 00       	call   8a9 <getpid>
+ 163:	50                   	push   %eax
+ 164:	53                   	push   %ebx
+ 165:	68 a6 11 00 00       	push   $0x11a6
+ 16a:	6a 01                	push   $0x1
+ 16c:	e8 4f 09 00 00       	call   ac0 <printf>
+      exit();
+ 171:	e8 9a 02 00 00       	call   410 <exit>
+ 176:	66 90                	xchg   %ax,%ax
+ 178:	66 90                	xchg   %ax,%ax
+ 17a:	66 90                	xchg   %ax,%ax
+ 17c:	66 90                	xchg   %ax,%ax
+ 17e:	66 90                	xchg   %ax,%ax
+
+00000180 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	57                   	push   %edi
+ 184:	56                   	push   %esi
+ 185:	53                   	push   %ebx
+ 186:	83 ec 4c             	sub    $0x4c,%esp
+ 189:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 18c:	8b 55 08             	mov    0x8(%ebp),%edx
+ 18f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 192:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+ 195:	83 fa 0f             	cmp    $0xf,%edx
+ 198:	0f 87 32 01 00 00    	ja     2d0 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+ 19e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 1a4:	8b 80 e0 16 00 00    	mov    0x16e0(%eax),%eax
+ 1aa:	85 c0                	test   %eax,%eax
+ 1ac:	0f 84 de 00 00 00    	je     290 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+ 1b2:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 1b8:	8b b0 e4 16 00 00    	mov    0x16e4(%eax),%esi
+ 1be:	8d 88 e0 16 00 00    	lea    0x16e0(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+ 1c4:	8d b8 e8 16 00 00    	lea    0x16e8(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+ 1ca:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+ 1cd:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+ 1d0:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+ 1d3:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+ 1d9:	0f 8f 01 01 00 00    	jg     2e0 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+ 1df:	8d 78 08             	lea    0x8(%eax),%edi
+ 1e2:	8d bc 3e e0 16 00 00 	lea    0x16e0(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 1e9:	85 db                	test   %ebx,%ebx
+ 1eb:	7e 3b                	jle    228 <bufwrite+0xa8>
+ 1ed:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+ 1f0:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+ 1f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1f7:	90                   	nop
+    *dst++ = *src++;
+ 1f8:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 1f9:	39 c6                	cmp    %eax,%esi
+ 1fb:	75 fb                	jne    1f8 <bufwrite+0x78>
+  ob[fd].n += n;
+ 1fd:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 203:	8b 88 e4 16 00 00    	mov    0x16e4(%eax),%ecx
+ 209:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 20b:	83 b8 e0 16 00 00 01 	cmpl   $0x1,0x16e0(%eax)
+  ob[fd].n += n;
+ 212:	89 88 e4 16 00 00    	mov    %ecx,0x16e4(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 218:	74 26                	je     240 <bufwrite+0xc0>
+}
+ 21a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 21d:	5b                   	pop    %ebx
+ 21e:	5e                   	pop    %esi
+ 21f:	5f                   	pop    %edi
+ 220:	5d                   	pop    %ebp
+ 221:	c3                   	ret
+ 222:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+ 228:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 22b:	83 b8 e0 16 00 00 01 	cmpl   $0x1,0x16e0(%eax)
+  ob[fd].n += n;
+ 232:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 235:	75 e3                	jne    21a <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+ 237:	85 db                	test   %ebx,%ebx
+ 239:	74 df                	je     21a <bufwrite+0x9a>
+ 23b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+  src = vsrc;
+ 240:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 243:	01 c3                	add    %eax,%ebx
+ 245:	eb 10                	jmp    257 <bufwrite+0xd7>
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+ 250:	83 c0 01             	add    $0x1,%eax
+ 253:	39 d8                	cmp    %ebx,%eax
+ 255:	74 c3                	je     21a <bufwrite+0x9a>
+    if(*p == (char)c)
+ 257:	80 38 0a             	cmpb   $0xa,(%eax)
+ 25a:	75 f4                	jne    250 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 25c:	85 c9                	test   %ecx,%ecx
+ 25e:	7e ba                	jle    21a <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 260:	83 ec 04             	sub    $0x4,%esp
+ 263:	51                   	push   %ecx
+ 264:	ff 75 ac             	push   -0x54(%ebp)
+ 267:	52                   	push   %edx
+ 268:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+ 26b:	e8 cd 05 00 00       	call   83d <write>
+    ob[fd].n = 0;
+ 270:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+ 273:	83 c4 10             	add    $0x10,%esp
+ 276:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+ 27c:	c7 82 e4 16 00 00 00 	movl   $0x0,0x16e4(%edx)
+ 283:	00 00 00 
+ 286:	eb 92                	jmp    21a <bufwrite+0x9a>
+ 288:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28f:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 290:	83 ec 08             	sub    $0x8,%esp
+ 293:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 296:	50                   	push   %eax
+ 297:	52                   	push   %edx
+ 298:	89 55 b0             	mov    %edx,-0x50(%ebp)
+ 29b:	e8 d7 05 00 00       	call   877 <fstat>
+ 2a0:	83 c4 10             	add    $0x10,%esp
+ 2a3:	8b 55 b0             	mov    -0x50(%ebp),%edx
+ 2a6:	89 c1                	mov    %eax,%ecx
+ 2a8:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2ad:	85 c9                	test   %ecx,%ecx
+ 2af:	75 0d                	jne    2be <bufwrite+0x13e>
+ 2b1:	31 c0                	xor    %eax,%eax
+ 2b3:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 2b8:	0f 95 c0             	setne  %al
+ 2bb:	83 c0 01             	add    $0x1,%eax
+ 2be:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+ 2c4:	89 81 e0 16 00 00    	mov    %eax,0x16e0(%ecx)
+ 2ca:	e9 e3 fe ff ff       	jmp    1b2 <bufwrite+0x32>
+ 2cf:	90                   	nop
+}
+ 2d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2d3:	5b                   	pop    %ebx
+ 2d4:	5e                   	pop    %esi
+ 2d5:	5f                   	pop    %edi
+ 2d6:	5d                   	pop    %ebp
+    write(fd, p, n);
+ 2d7:	e9 61 05 00 00       	jmp    83d <write>
+ 2dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+ 2e0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+ 2e3:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+ 2e6:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+ 2e9:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+ 2ec:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+ 2ef:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+ 2f2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+ 2f5:	6a 02                	push   $0x2
+ 2f7:	50                   	push   %eax
+ 2f8:	52                   	push   %edx
+ 2f9:	e8 9b 06 00 00       	call   999 <writev>
+    ob[fd].n = 0;
+ 2fe:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+ 301:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+ 304:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ 30b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 30e:	5b                   	pop    %ebx
+ 30f:	5e                   	pop    %esi
+ 310:	5f                   	pop    %edi
+ 311:	5d                   	pop    %ebp
+ 312:	c3                   	ret
+ 313:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000320 <fflush>:
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	53                   	push   %ebx
+ 324:	83 ec 04             	sub    $0x4,%esp
+ 327:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 32a:	83 f8 0f             	cmp    $0xf,%eax
+ 32d:	77 16                	ja     345 <fflush+0x25>
+ 32f:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+ 335:	8b 8a e4 16 00 00    	mov    0x16e4(%edx),%ecx
+ 33b:	8d 9a e0 16 00 00    	lea    0x16e0(%edx),%ebx
+ 341:	85 c9                	test   %ecx,%ecx
+ 343:	7f 0b                	jg     350 <fflush+0x30>
+}
+ 345:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 348:	c9                   	leave
+ 349:	c3                   	ret
+ 34a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 350:	83 ec 04             	sub    $0x4,%esp
+ 353:	81 c2 e8 16 00 00    	add    $0x16e8,%edx
+ 359:	51                   	push   %ecx
+ 35a:	52                   	push   %edx
+ 35b:	50                   	push   %eax
+ 35c:	e8 dc 04 00 00       	call   83d <write>
+    ob[fd].n = 0;
+ 361:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+ 368:	83 c4 10             	add    $0x10,%esp
+}
+ 36b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 36e:	c9                   	leave
+ 36f:	c3                   	ret
+
+00000370 <fflushall>:
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 374:	31 f6                	xor    %esi,%esi
+{
+ 376:	53                   	push   %ebx
+ 377:	bb e8 16 00 00       	mov    $0x16e8,%ebx
+ 37c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 380:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 383:	85 c0                	test   %eax,%eax
+ 385:	7e 15                	jle    39c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 387:	83 ec 04             	sub    $0x4,%esp
+ 38a:	50                   	push   %eax
+ 38b:	53                   	push   %ebx
+ 38c:	56                   	push   %esi
+ 38d:	e8 ab 04 00 00       	call   83d <write>
+    ob[fd].n = 0;
+ 392:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 399:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 39c:	83 c6 01             	add    $0x1,%esi
+ 39f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 3a5:	83 fe 10             	cmp    $0x10,%esi
+ 3a8:	75 d6                	jne    380 <fflushall+0x10>
+}
+ 3aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3ad:	5b                   	pop    %ebx
+ 3ae:	5e                   	pop    %esi
+ 3af:	5d                   	pop    %ebp
+ 3b0:	c3                   	ret
+ 3b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bf:	90                   	nop
+
+000003c0 <fork>:
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 3c4:	31 f6                	xor    %esi,%esi
+{
+ 3c6:	53                   	push   %ebx
+ 3c7:	bb e8 16 00 00       	mov    $0x16e8,%ebx
+ 3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 3d0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 3d3:	85 c0                	test   %eax,%eax
+ 3d5:	7e 15                	jle    3ec <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 3d7:	83 ec 04             	sub    $0x4,%esp
+ 3da:	50                   	push   %eax
+ 3db:	53                   	push   %ebx
+ 3dc:	56                   	push   %esi
+ 3dd:	e8 5b 04 00 00       	call   83d <write>
+    ob[fd].n = 0;
+ 3e2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 3e9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 3ec:	83 c6 01             	add    $0x1,%esi
+ 3ef:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 3f5:	83 fe 10             	cmp    $0x10,%esi
+ 3f8:	75 d6                	jne    3d0 <fork+0x10>
+}
+ 3fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3fd:	5b                   	pop    %ebx
+ 3fe:	5e                   	pop    %esi
+ 3ff:	5d                   	pop    %ebp
+  return _fork();
+ 400:	e9 15 04 00 00       	jmp    81a <_fork>
+ 405:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000410 <exit>:
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+ 416:	e8 55 ff ff ff       	call   370 <fflushall>
+  _exit();
+ 41b:	e8 01 04 00 00       	call   821 <_exit>
+
+00000420 <exec>:
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	57                   	push   %edi
+ 424:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 425:	31 f6                	xor    %esi,%esi
+{
+ 427:	53                   	push   %ebx
+ 428:	bb e8 16 00 00       	mov    $0x16e8,%ebx
+ 42d:	83 ec 1c             	sub    $0x1c,%esp
+ 430:	8b 45 08             	mov    0x8(%ebp),%eax
+ 433:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 436:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 439:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 440:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 443:	85 c0                	test   %eax,%eax
+ 445:	7e 15                	jle    45c <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 447:	83 ec 04             	sub    $0x4,%esp
+ 44a:	50                   	push   %eax
+ 44b:	53                   	push   %ebx
+ 44c:	56                   	push   %esi
+ 44d:	e8 eb 03 00 00       	call   83d <write>
+    ob[fd].n = 0;
+ 452:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 459:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 45c:	83 c6 01             	add    $0x1,%esi
+ 45f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 465:	83 fe 10             	cmp    $0x10,%esi
+ 468:	75 d6                	jne    440 <exec+0x20>
+  return _exec(path, argv);
+ 46a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 46d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+ 470:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ 473:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 476:	5b                   	pop    %ebx
+ 477:	5e                   	pop    %esi
+ 478:	5f                   	pop    %edi
+ 479:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 47a:	e9 d3 03 00 00       	jmp    852 <_exec>
+ 47f:	90                   	nop
+
+00000480 <close>:
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	56                   	push   %esi
+ 484:	53                   	push   %ebx
+ 485:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 488:	83 fb 0f             	cmp    $0xf,%ebx
+ 48b:	77 26                	ja     4b3 <close+0x33>
+ 48d:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 493:	8b 90 e4 16 00 00    	mov    0x16e4(%eax),%edx
+ 499:	8d b0 e0 16 00 00    	lea    0x16e0(%eax),%esi
+ 49f:	85 d2                	test   %edx,%edx
+ 4a1:	7f 25                	jg     4c8 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+ 4a3:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 4a9:	c7 80 e0 16 00 00 00 	movl   $0x0,0x16e0(%eax)
+ 4b0:	00 00 00 
+  return _close(fd);
+ 4b3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 4b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4b9:	5b                   	pop    %ebx
+ 4ba:	5e                   	pop    %esi
+ 4bb:	5d                   	pop    %ebp
+  return _close(fd);
+ 4bc:	e9 83 03 00 00       	jmp    844 <_close>
+ 4c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 4c8:	83 ec 04             	sub    $0x4,%esp
+ 4cb:	05 e8 16 00 00       	add    $0x16e8,%eax
+ 4d0:	52                   	push   %edx
+ 4d1:	50                   	push   %eax
+ 4d2:	53                   	push   %ebx
+ 4d3:	e8 65 03 00 00       	call   83d <write>
+    ob[fd].n = 0;
+ 4d8:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+ 4df:	83 c4 10             	add    $0x10,%esp
+ 4e2:	eb bf                	jmp    4a3 <close+0x23>
+ 4e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4ef:	90                   	nop
+
+000004f0 <strcpy>:
+{
+ 4f0:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+ 4f1:	31 c0                	xor    %eax,%eax
+{
+ 4f3:	89 e5                	mov    %esp,%ebp
+ 4f5:	53                   	push   %ebx
+ 4f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 4f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 4fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 500:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 504:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 507:	83 c0 01             	add    $0x1,%eax
+ 50a:	84 d2                	test   %dl,%dl
+ 50c:	75 f2                	jne    500 <strcpy+0x10>
+}
+ 50e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 511:	89 c8                	mov    %ecx,%eax
+ 513:	c9                   	leave
+ 514:	c3                   	ret
+ 515:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <strcmp>:
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	53                   	push   %ebx
+ 524:	8b 55 08             	mov    0x8(%ebp),%edx
+ 527:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 52a:	0f b6 02             	movzbl (%edx),%eax
+ 52d:	84 c0                	test   %al,%al
+ 52f:	75 17                	jne    548 <strcmp+0x28>
+ 531:	eb 3a                	jmp    56d <strcmp+0x4d>
+ 533:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 537:	90                   	nop
+ 538:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 53c:	83 c2 01             	add    $0x1,%edx
+ 53f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 542:	84 c0                	test   %al,%al
+ 544:	74 1a                	je     560 <strcmp+0x40>
+    p++, q++;
+ 546:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 548:	0f b6 19             	movzbl (%ecx),%ebx
+ 54b:	38 c3                	cmp    %al,%bl
+ 54d:	74 e9                	je     538 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 54f:	29 d8                	sub    %ebx,%eax
+}
+ 551:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 554:	c9                   	leave
+ 555:	c3                   	ret
+ 556:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 560:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 564:	31 c0                	xor    %eax,%eax
+ 566:	29 d8                	sub    %ebx,%eax
+}
+ 568:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 56b:	c9                   	leave
+ 56c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 56d:	0f b6 19             	movzbl (%ecx),%ebx
+ 570:	31 c0                	xor    %eax,%eax
+ 572:	eb db                	jmp    54f <strcmp+0x2f>
+ 574:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 57f:	90                   	nop
+
+00000580 <strlen>:
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+ 586:	80 3a 00             	cmpb   $0x0,(%edx)
+ 589:	74 15                	je     5a0 <strlen+0x20>
+ 58b:	31 c0                	xor    %eax,%eax
+ 58d:	8d 76 00             	lea    0x0(%esi),%esi
+ 590:	83 c0 01             	add    $0x1,%eax
+ 593:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 597:	89 c1                	mov    %eax,%ecx
+ 599:	75 f5                	jne    590 <strlen+0x10>
+}
+ 59b:	89 c8                	mov    %ecx,%eax
+ 59d:	5d                   	pop    %ebp
+ 59e:	c3                   	ret
+ 59f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 5a0:	31 c9                	xor    %ecx,%ecx
+}
+ 5a2:	5d                   	pop    %ebp
+ 5a3:	89 c8                	mov    %ecx,%eax
+ 5a5:	c3                   	ret
+ 5a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005b0 <memset>:
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 5b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5bd:	89 d7                	mov    %edx,%edi
+ 5bf:	fc                   	cld
+ 5c0:	f3 aa                	rep stos %al,%es:(%edi)
+}
+ 5c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 5c5:	89 d0                	mov    %edx,%eax
+ 5c7:	c9                   	leave
+ 5c8:	c3                   	ret
+ 5c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005d0 <strchr>:
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 5da:	0f b6 10             	movzbl (%eax),%edx
+ 5dd:	84 d2                	test   %dl,%dl
+ 5df:	75 12                	jne    5f3 <strchr+0x23>
+ 5e1:	eb 1d                	jmp    600 <strchr+0x30>
+ 5e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5e7:	90                   	nop
+ 5e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 5ec:	83 c0 01             	add    $0x1,%eax
+ 5ef:	84 d2                	test   %dl,%dl
+ 5f1:	74 0d                	je     600 <strchr+0x30>
+    if(*s == c)
+ 5f3:	38 d1                	cmp    %dl,%cl
+ 5f5:	75 f1                	jne    5e8 <strchr+0x18>
+}
+ 5f7:	5d                   	pop    %ebp
+ 5f8:	c3                   	ret
+ 5f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 600:	31 c0                	xor    %eax,%eax
+}
+ 602:	5d                   	pop    %ebp
+ 603:	c3                   	ret
+ 604:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 60f:	90                   	nop
+
+00000610 <memchr>:
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	8b 55 10             	mov    0x10(%ebp),%edx
+ 616:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 619:	85 d2                	test   %edx,%edx
+ 61b:	74 1b                	je     638 <memchr+0x28>
+    if(*p == (char)c)
+ 61d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+ 621:	01 c2                	add    %eax,%edx
+ 623:	eb 0a                	jmp    62f <memchr+0x1f>
+ 625:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+ 628:	83 c0 01             	add    $0x1,%eax
+ 62b:	39 c2                	cmp    %eax,%edx
+ 62d:	74 09                	je     638 <memchr+0x28>
+    if(*p == (char)c)
+ 62f:	38 08                	cmp    %cl,(%eax)
+ 631:	75 f5                	jne    628 <memchr+0x18>
+}
+ 633:	5d                   	pop    %ebp
+ 634:	c3                   	ret
+ 635:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+ 638:	31 c0                	xor    %eax,%eax
+}
+ 63a:	5d                   	pop    %ebp
+ 63b:	c3                   	ret
+ 63c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000640 <gets>:
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+ 644:	31 ff                	xor    %edi,%edi
+{
+ 646:	56                   	push   %esi
+ 647:	be e8 16 00 00       	mov    $0x16e8,%esi
+ 64c:	53                   	push   %ebx
+ 64d:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 650:	8b 46 fc             	mov    -0x4(%esi),%eax
+ 653:	85 c0                	test   %eax,%eax
+ 655:	7e 15                	jle    66c <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 657:	83 ec 04             	sub    $0x4,%esp
+ 65a:	50                   	push   %eax
+ 65b:	56                   	push   %esi
+ 65c:	57                   	push   %edi
+ 65d:	e8 db 01 00 00       	call   83d <write>
+    ob[fd].n = 0;
+ 662:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+ 669:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 66c:	83 c7 01             	add    $0x1,%edi
+ 66f:	81 c6 08 01 00 00    	add    $0x108,%esi
+ 675:	83 ff 10             	cmp    $0x10,%edi
+ 678:	75 d6                	jne    650 <gets+0x10>
+  for(i=0; i+1 < max; ){
+ 67a:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+ 67c:	8d 75 e7             	lea    -0x19(%ebp),%esi
+ 67f:	eb 2e                	jmp    6af <gets+0x6f>
+ 681:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 688:	83 ec 04             	sub    $0x4,%esp
+ 68b:	6a 01                	push   $0x1
+ 68d:	56                   	push   %esi
+ 68e:	6a 00                	push   $0x0
+ 690:	e8 a1 01 00 00       	call   836 <read>
+    if(cc < 1)
+ 695:	83 c4 10             	add    $0x10,%esp
+ 698:	85 c0                	test   %eax,%eax
+ 69a:	7e 1d                	jle    6b9 <gets+0x79>
+    buf[i++] = c;
+ 69c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 6a0:	8b 55 08             	mov    0x8(%ebp),%edx
+ 6a3:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 6a7:	3c 0a                	cmp    $0xa,%al
+ 6a9:	74 10                	je     6bb <gets+0x7b>
+ 6ab:	3c 0d                	cmp    $0xd,%al
+ 6ad:	74 0c                	je     6bb <gets+0x7b>
+  for(i=0; i+1 < max; ){
+ 6af:	89 df                	mov    %ebx,%edi
+ 6b1:	83 c3 01             	add    $0x1,%ebx
+ 6b4:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 6b7:	7c cf                	jl     688 <gets+0x48>
+ 6b9:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 6bb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6be:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 6c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6c5:	5b                   	pop    %ebx
+ 6c6:	5e                   	pop    %esi
+ 6c7:	5f                   	pop    %edi
+ 6c8:	5d                   	pop    %ebp
+ 6c9:	c3                   	ret
+ 6ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000006d0 <stat>:
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	57                   	push   %edi
+ 6d4:	56                   	push   %esi
+ 6d5:	53                   	push   %ebx
+ 6d6:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+ 6d9:	6a 00                	push   $0x0
+ 6db:	ff 75 08             	push   0x8(%ebp)
+ 6de:	e8 76 01 00 00       	call   859 <open>
+  if(fd < 0)
+ 6e3:	83 c4 10             	add    $0x10,%esp
+ 6e6:	85 c0                	test   %eax,%eax
+ 6e8:	78 76                	js     760 <stat+0x90>
+  r = fstat(fd, st);
+ 6ea:	83 ec 08             	sub    $0x8,%esp
+ 6ed:	ff 75 0c             	push   0xc(%ebp)
+ 6f0:	89 c3                	mov    %eax,%ebx
+ 6f2:	50                   	push   %eax
+ 6f3:	e8 7f 01 00 00       	call   877 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 6f8:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 6fb:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 6fd:	83 fb 0f             	cmp    $0xf,%ebx
+ 700:	7f 40                	jg     742 <stat+0x72>
+ 702:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 708:	8b 90 e4 16 00 00    	mov    0x16e4(%eax),%edx
+ 70e:	8d b8 e0 16 00 00    	lea    0x16e0(%eax),%edi
+ 714:	85 d2                	test   %edx,%edx
+ 716:	7e 1a                	jle    732 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 718:	83 ec 04             	sub    $0x4,%esp
+ 71b:	05 e8 16 00 00       	add    $0x16e8,%eax
+ 720:	52                   	push   %edx
+ 721:	50                   	push   %eax
+ 722:	53                   	push   %ebx
+ 723:	e8 15 01 00 00       	call   83d <write>
+    ob[fd].n = 0;
+ 728:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+ 72f:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+ 732:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 738:	c7 80 e0 16 00 00 00 	movl   $0x0,0x16e0(%eax)
+ 73f:	00 00 00 
+  return _close(fd);
+ 742:	83 ec 0c             	sub    $0xc,%esp
+ 745:	53                   	push   %ebx
+ 746:	e8 f9 00 00 00       	call   844 <_close>
+ 74b:	83 c4 10             	add    $0x10,%esp
+}
+ 74e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 751:	89 f0                	mov    %esi,%eax
+ 753:	5b                   	pop    %ebx
+ 754:	5e                   	pop    %esi
+ 755:	5f                   	pop    %edi
+ 756:	5d                   	pop    %ebp
+ 757:	c3                   	ret
+ 758:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 75f:	90                   	nop
+    return -1;
+ 760:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 765:	eb e7                	jmp    74e <stat+0x7e>
+ 767:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76e:	66 90                	xchg   %ax,%ax
+
+00000770 <atoi>:
+{
+ 770:	55                   	push   %ebp
+ 771:	89 e5                	mov    %esp,%ebp
+ 773:	53                   	push   %ebx
+ 774:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 777:	0f be 02             	movsbl (%edx),%eax
+ 77a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 77d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 780:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 785:	77 1e                	ja     7a5 <atoi+0x35>
+ 787:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 78e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 790:	83 c2 01             	add    $0x1,%edx
+ 793:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 796:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 79a:	0f be 02             	movsbl (%edx),%eax
+ 79d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 7a0:	80 fb 09             	cmp    $0x9,%bl
+ 7a3:	76 eb                	jbe    790 <atoi+0x20>
+}
+ 7a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 7a8:	89 c8                	mov    %ecx,%eax
+ 7aa:	c9                   	leave
+ 7ab:	c3                   	ret
+ 7ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007b0 <memmove>:
+{
+ 7b0:	55                   	push   %ebp
+ 7b1:	89 e5                	mov    %esp,%ebp
+ 7b3:	57                   	push   %edi
+ 7b4:	56                   	push   %esi
+ 7b5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 7b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 7bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 7be:	85 c0                	test   %eax,%eax
+ 7c0:	7e 13                	jle    7d5 <memmove+0x25>
+ 7c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 7c4:	89 d7                	mov    %edx,%edi
+ 7c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 7d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 7d1:	39 f8                	cmp    %edi,%eax
+ 7d3:	75 fb                	jne    7d0 <memmove+0x20>
+  return vdst;
+}
+ 7d5:	5e                   	pop    %esi
+ 7d6:	89 d0                	mov    %edx,%eax
+ 7d8:	5f                   	pop    %edi
+ 7d9:	5d                   	pop    %ebp
+ 7da:	c3                   	ret
+
+000007db <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+ 7db:	83 3d cc 16 00 00 00 	cmpl   $0x0,0x16cc
+  jle 1f
+ 7e2:	7e 0a                	jle    7ee <syscallentry+0x13>
+  movl %esp, %ecx
+ 7e4:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 7e6:	ba ed 07 00 00       	mov    $0x7ed,%edx
+  sysenter
+ 7eb:	0f 34                	sysenter
+2:
+  ret
+ 7ed:	c3                   	ret
+1:
+  jl 3f
+ 7ee:	7c 27                	jl     817 <syscallentry+0x3c>
+  pushal
+ 7f0:	60                   	pusha
+  movl $1, %eax
+ 7f1:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 7f6:	0f a2                	cpuid
+  movl $-1, sysentermode
+ 7f8:	c7 05 cc 16 00 00 ff 	movl   $0xffffffff,0x16cc
+ 7ff:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 802:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+ 808:	74 0a                	je     814 <syscallentry+0x39>
+  movl $1, sysentermode
+ 80a:	c7 05 cc 16 00 00 01 	movl   $0x1,0x16cc
+ 811:	00 00 00 
+4:
+  popal
+ 814:	61                   	popa
+  jmp syscallentry
+ 815:	eb c4                	jmp    7db <syscallentry>
+3:
+  int $T_SYSCALL
+ 817:	cd 40                	int    $0x40
+  ret
+ 819:	c3                   	ret
+
+0000081a <_fork>:
+
+SYSCALLAS(_fork, fork)
+ 81a:	b8 01 00 00 00       	mov    $0x1,%eax
+ 81f:	eb ba                	jmp    7db <syscallentry>
+
+00000821 <_exit>:
+SYSCALLAS(_exit, exit)
+ 821:	b8 02 00 00 00       	mov    $0x2,%eax
+ 826:	eb b3                	jmp    7db <syscallentry>
+
+00000828 <wait>:
+SYSCALL(wait)
+ 828:	b8 03 00 00 00       	mov    $0x3,%eax
+ 82d:	eb ac                	jmp    7db <syscallentry>
+
+0000082f <pipe>:
+SYSCALL(pipe)
+ 82f:	b8 04 00 00 00       	mov    $0x4,%eax
+ 834:	eb a5                	jmp    7db <syscallentry>
+
+00000836 <read>:
+SYSCALL(read)
+ 836:	b8 05 00 00 00       	mov    $0x5,%eax
+ 83b:	eb 9e                	jmp    7db <syscallentry>
+
+0000083d <write>:
+SYSCALL(write)
+ 83d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 842:	eb 97                	jmp    7db <syscallentry>
+
+00000844 <_close>:
+SYSCALLAS(_close, close)
+ 844:	b8 15 00 00 00       	mov    $0x15,%eax
+ 849:	eb 90                	jmp    7db <syscallentry>
+
+0000084b <kill>:
+SYSCALL(kill)
+ 84b:	b8 06 00 00 00       	mov    $0x6,%eax
+ 850:	eb 89                	jmp    7db <syscallentry>
+
+00000852 <_exec>:
+SYSCALLAS(_exec, exec)
+ 852:	b8 07 00 00 00       	mov    $0x7,%eax
+ 857:	eb 82                	jmp    7db <syscallentry>
+
+00000859 <open>:
+SYSCALL(open)
+ 859:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 85e:	e9 78 ff ff ff       	jmp    7db <syscallentry>
+
+00000863 <mknod>:
+SYSCALL(mknod)
+ 863:	b8 11 00 00 00       	mov    $0x11,%eax
+ 868:	e9 6e ff ff ff       	jmp    7db <syscallentry>
+
+0000086d <unlink>:
+SYSCALL(unlink)
+ 86d:	b8 12 00 00 00       	mov    $0x12,%eax
+ 872:	e9 64 ff ff ff       	jmp    7db <syscallentry>
+
+00000877 <fstat>:
+SYSCALL(fstat)
+ 877:	b8 08 00 00 00       	mov    $0x8,%eax
+ 87c:	e9 5a ff ff ff       	jmp    7db <syscallentry>
+
+00000881 <link>:
+SYSCALL(link)
+ 881:	b8 13 00 00 00       	mov    $0x13,%eax
+ 886:	e9 50 ff ff ff       	jmp    7db <syscallentry>
+
+0000088b <mkdir>:
+SYSCALL(mkdir)
+ 88b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 890:	e9 46 ff ff ff       	jmp    7db <syscallentry>
+
+00000895 <chdir>:
+SYSCALL(chdir)
+ 895:	b8 09 00 00 00       	mov    $0x9,%eax
+ 89a:	e9 3c ff ff ff       	jmp    7db <syscallentry>
+
+0000089f <dup>:
+SYSCALL(dup)
+ 89f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 8a4:	e9 32 ff ff ff       	jmp    7db <syscallentry>
+
+000008a9 <getpid>:
+SYSCALL(getpid)
+ 8a9:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 8ae:	e9 28 ff ff ff       	jmp    7db <syscallentry>
+
+000008b3 <sbrk>:
+SYSCALL(sbrk)
+ 8b3:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 8b8:	e9 1e ff ff ff       	jmp    7db <syscallentry>
+
+000008bd <sleep>:
+SYSCALL(sleep)
+ 8bd:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 8c2:	e9 14 ff ff ff       	jmp    7db <syscallentry>
+
+000008c7 <uptime>:
+SYSCALL(uptime)
+ 8c7:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 8cc:	e9 0a ff ff ff       	jmp    7db <syscallentry>
+
+000008d1 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+ 8d1:	b8 16 00 00 00       	mov    $0x16,%eax
+ 8d6:	e9 00 ff ff ff       	jmp    7db <syscallentry>
+
+000008db <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+ 8db:	b8 17 00 00 00       	mov    $0x17,%eax
+ 8e0:	e9 f6 fe ff ff       	jmp    7db <syscallentry>
+
+000008e5 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+ 8e5:	b8 18 00 00 00       	mov    $0x18,%eax
+ 8ea:	e9 ec fe ff ff       	jmp    7db <syscallentry>
+
+000008ef <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+ 8ef:	b8 19 00 00 00       	mov    $0x19,%eax
+ 8f4:	e9 e2 fe ff ff       	jmp    7db <syscallentry>
+
+000008f9 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+ 8f9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 8fe:	e9 d8 fe ff ff       	jmp    7db <syscallentry>
+
+00000903 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+ 903:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 908:	e9 ce fe ff ff       	jmp    7db <syscallentry>
+
+0000090d <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+ 90d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 912:	e9 c4 fe ff ff       	jmp    7db <syscallentry>
+
+00000917 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+ 917:	b8 20 00 00 00       	mov    $0x20,%eax
+ 91c:	e9 ba fe ff ff       	jmp    7db <syscallentry>
+
+00000921 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+ 921:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 926:	e9 b0 fe ff ff       	jmp    7db <syscallentry>
+
+0000092b <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+ 92b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 930:	e9 a6 fe ff ff       	jmp    7db <syscallentry>
+
+00000935 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+ 935:	b8 21 00 00 00       	mov    $0x21,%eax
+ 93a:	e9 9c fe ff ff       	jmp    7db <syscallentry>
+
+0000093f <yield>:
+SYSCALL(yield) // yield the CPU to another process
+ 93f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 944:	e9 92 fe ff ff       	jmp    7db <syscallentry>
+
+00000949 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+ 949:	b8 23 00 00 00       	mov    $0x23,%eax
+ 94e:	e9 88 fe ff ff       	jmp    7db <syscallentry>
+
+00000953 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+ 953:	b8 24 00 00 00       	mov    $0x24,%eax
+ 958:	e9 7e fe ff ff       	jmp    7db <syscallentry>
+
+0000095d <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+ 95d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 962:	e9 74 fe ff ff       	jmp    7db <syscallentry>
+
+00000967 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+ 967:	b8 26 00 00 00       	mov    $0x26,%eax
+ 96c:	e9 6a fe ff ff       	jmp    7db <syscallentry>
+
+00000971 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+ 971:	b8 27 00 00 00       	mov    $0x27,%eax
+ 976:	e9 60 fe ff ff       	jmp    7db <syscallentry>
+
+0000097b <mmap>:
+SYSCALL(mmap) // map a file into memory
+ 97b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 980:	e9 56 fe ff ff       	jmp    7db <syscallentry>
+
+00000985 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+ 985:	b8 29 00 00 00       	mov    $0x29,%eax
+ 98a:	e9 4c fe ff ff       	jmp    7db <syscallentry>
+
+0000098f <readv>:
+SYSCALL(readv) // read into several buffers
+ 98f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 994:	e9 42 fe ff ff       	jmp    7db <syscallentry>
+
+00000999 <writev>:
+SYSCALL(writev) // write from several buffers
+ 999:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 99e:	e9 38 fe ff ff       	jmp    7db <syscallentry>
+
+000009a3 <pread>:
+SYSCALL(pread) // read at an offset
+ 9a3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 9a8:	e9 2e fe ff ff       	jmp    7db <syscallentry>
+
+000009ad <pwrite>:
+SYSCALL(pwrite) // write at an offset
+ 9ad:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 9b2:	e9 24 fe ff ff       	jmp    7db <syscallentry>
+
+000009b7 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+ 9b7:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 9bc:	e9 1a fe ff ff       	jmp    7db <syscallentry>
+
+000009c1 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+ 9c1:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 9c6:	e9 10 fe ff ff       	jmp    7db <syscallentry>
+
+000009cb <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+ 9cb:	b8 30 00 00 00       	mov    $0x30,%eax
+ 9d0:	e9 06 fe ff ff       	jmp    7db <syscallentry>
+
+000009d5 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+ 9d5:	b8 31 00 00 00       	mov    $0x31,%eax
+ 9da:	e9 fc fd ff ff       	jmp    7db <syscallentry>
+
+000009df <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+ 9df:	b8 32 00 00 00       	mov    $0x32,%eax
+ 9e4:	e9 f2 fd ff ff       	jmp    7db <syscallentry>
+
+000009e9 <profread>:
+SYSCALL(profread) // drain profiler samples
+ 9e9:	b8 33 00 00 00       	mov    $0x33,%eax
+ 9ee:	e9 e8 fd ff ff       	jmp    7db <syscallentry>
+
+000009f3 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+ 9f3:	b8 34 00 00 00       	mov    $0x34,%eax
+ 9f8:	e9 de fd ff ff       	jmp    7db <syscallentry>
+
+000009fd <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+ 9fd:	b8 35 00 00 00       	mov    $0x35,%eax
+ a02:	e9 d4 fd ff ff       	jmp    7db <syscallentry>
+
+00000a07 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+ a07:	b8 36 00 00 00       	mov    $0x36,%eax
+ a0c:	e9 ca fd ff ff       	jmp    7db <syscallentry>
+
+00000a11 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+ a11:	b8 37 00 00 00       	mov    $0x37,%eax
+ a16:	e9 c0 fd ff ff       	jmp    7db <syscallentry>
+ a1b:	66 90                	xchg   %ax,%ax
+ a1d:	66 90                	xchg   %ax,%ax
+ a1f:	90                   	nop
+
+00000a20 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a20:	55                   	push   %ebp
+ a21:	89 e5                	mov    %esp,%ebp
+ a23:	57                   	push   %edi
+ a24:	56                   	push   %esi
+ a25:	53                   	push   %ebx
+ a26:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ a28:	89 d1                	mov    %edx,%ecx
+{
+ a2a:	83 ec 3c             	sub    $0x3c,%esp
+ a2d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ a30:	85 d2                	test   %edx,%edx
+ a32:	0f 89 80 00 00 00    	jns    ab8 <printint+0x98>
+ a38:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ a3c:	74 7a                	je     ab8 <printint+0x98>
+    x = -xx;
+ a3e:	f7 d9                	neg    %ecx
+    neg = 1;
+ a40:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ a45:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ a48:	31 f6                	xor    %esi,%esi
+ a4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ a50:	89 c8                	mov    %ecx,%eax
+ a52:	31 d2                	xor    %edx,%edx
+ a54:	89 f7                	mov    %esi,%edi
+ a56:	f7 f3                	div    %ebx
+ a58:	8d 76 01             	lea    0x1(%esi),%esi
+ a5b:	0f b6 92 40 12 00 00 	movzbl 0x1240(%edx),%edx
+ a62:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ a66:	89 ca                	mov    %ecx,%edx
+ a68:	89 c1                	mov    %eax,%ecx
+ a6a:	39 da                	cmp    %ebx,%edx
+ a6c:	73 e2                	jae    a50 <printint+0x30>
+  if(neg)
+ a6e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ a71:	85 c0                	test   %eax,%eax
+ a73:	74 07                	je     a7c <printint+0x5c>
+    buf[i++] = '-';
+ a75:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ a7a:	89 f7                	mov    %esi,%edi
+ a7c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ a7f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ a82:	01 df                	add    %ebx,%edi
+ a84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ a88:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+ a8b:	83 ec 04             	sub    $0x4,%esp
+ a8e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ a91:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ a94:	6a 01                	push   $0x1
+ a96:	50                   	push   %eax
+ a97:	56                   	push   %esi
+ a98:	e8 e3 f6 ff ff       	call   180 <bufwrite>
+  while(--i >= 0)
+ a9d:	89 f8                	mov    %edi,%eax
+ a9f:	83 c4 10             	add    $0x10,%esp
+ aa2:	83 ef 01             	sub    $0x1,%edi
+ aa5:	39 d8                	cmp    %ebx,%eax
+ aa7:	75 df                	jne    a88 <printint+0x68>
+}
+ aa9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ aac:	5b                   	pop    %ebx
+ aad:	5e                   	pop    %esi
+ aae:	5f                   	pop    %edi
+ aaf:	5d                   	pop    %ebp
+ ab0:	c3                   	ret
+ ab1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ ab8:	31 c0                	xor    %eax,%eax
+ aba:	eb 89                	jmp    a45 <printint+0x25>
+ abc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ac0 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ ac0:	55                   	push   %ebp
+ ac1:	89 e5                	mov    %esp,%ebp
+ ac3:	57                   	push   %edi
+ ac4:	56                   	push   %esi
+ ac5:	53                   	push   %ebx
+ ac6:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ ac9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ acc:	0f b6 18             	movzbl (%eax),%ebx
+ acf:	84 db                	test   %bl,%bl
+ ad1:	74 6c                	je     b3f <printf+0x7f>
+ ad3:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+ ad6:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ ad9:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ adb:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ ade:	eb 26                	jmp    b06 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ ae0:	83 f8 25             	cmp    $0x25,%eax
+ ae3:	74 4b                	je     b30 <printf+0x70>
+  bufwrite(fd, &c, 1);
+ ae5:	83 ec 04             	sub    $0x4,%esp
+ ae8:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ aeb:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ aee:	6a 01                	push   $0x1
+ af0:	50                   	push   %eax
+ af1:	ff 75 08             	push   0x8(%ebp)
+ af4:	e8 87 f6 ff ff       	call   180 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+ af9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ afc:	0f b6 1f             	movzbl (%edi),%ebx
+ aff:	83 c7 01             	add    $0x1,%edi
+ b02:	84 db                	test   %bl,%bl
+ b04:	74 39                	je     b3f <printf+0x7f>
+    c = fmt[i] & 0xff;
+ b06:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ b09:	85 f6                	test   %esi,%esi
+ b0b:	74 d3                	je     ae0 <printf+0x20>
+      }
+    } else if(state == '%'){
+ b0d:	83 fe 25             	cmp    $0x25,%esi
+ b10:	75 ea                	jne    afc <printf+0x3c>
+      if(c == 'd'){
+ b12:	83 f8 25             	cmp    $0x25,%eax
+ b15:	0f 84 d5 01 00 00    	je     cf0 <printf+0x230>
+ b1b:	83 e8 63             	sub    $0x63,%eax
+ b1e:	83 f8 15             	cmp    $0x15,%eax
+ b21:	77 45                	ja     b68 <printf+0xa8>
+ b23:	ff 24 85 e8 11 00 00 	jmp    *0x11e8(,%eax,4)
+ b2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+ b30:	0f b6 1f             	movzbl (%edi),%ebx
+ b33:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+ b36:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ b3b:	84 db                	test   %bl,%bl
+ b3d:	75 c7                	jne    b06 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+ b3f:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+ b43:	74 0b                	je     b50 <printf+0x90>
+    fflush(fd);
+}
+ b45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b48:	5b                   	pop    %ebx
+ b49:	5e                   	pop    %esi
+ b4a:	5f                   	pop    %edi
+ b4b:	5d                   	pop    %ebp
+ b4c:	c3                   	ret
+ b4d:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+ b50:	83 ec 0c             	sub    $0xc,%esp
+ b53:	6a 02                	push   $0x2
+ b55:	e8 c6 f7 ff ff       	call   320 <fflush>
+ b5a:	83 c4 10             	add    $0x10,%esp
+}
+ b5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b60:	5b                   	pop    %ebx
+ b61:	5e                   	pop    %esi
+ b62:	5f                   	pop    %edi
+ b63:	5d                   	pop    %ebp
+ b64:	c3                   	ret
+ b65:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+ b68:	83 ec 04             	sub    $0x4,%esp
+ b6b:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ b6e:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+ b72:	6a 01                	push   $0x1
+ b74:	52                   	push   %edx
+ b75:	89 55 c0             	mov    %edx,-0x40(%ebp)
+ b78:	ff 75 08             	push   0x8(%ebp)
+ b7b:	e8 00 f6 ff ff       	call   180 <bufwrite>
+ b80:	83 c4 0c             	add    $0xc,%esp
+ b83:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ b86:	6a 01                	push   $0x1
+ b88:	8b 55 c0             	mov    -0x40(%ebp),%edx
+ b8b:	52                   	push   %edx
+      state = 0;
+ b8c:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+ b8e:	ff 75 08             	push   0x8(%ebp)
+ b91:	e8 ea f5 ff ff       	call   180 <bufwrite>
+        putc(fd, c);
+ b96:	83 c4 10             	add    $0x10,%esp
+ b99:	e9 5e ff ff ff       	jmp    afc <printf+0x3c>
+ b9e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+ ba0:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ ba3:	83 ec 0c             	sub    $0xc,%esp
+ ba6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ bab:	8b 16                	mov    (%esi),%edx
+ bad:	6a 00                	push   $0x0
+ baf:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+ bb2:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+ bb5:	e8 66 fe ff ff       	call   a20 <printint>
+        ap++;
+ bba:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ bbd:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ bc0:	31 f6                	xor    %esi,%esi
+ bc2:	e9 35 ff ff ff       	jmp    afc <printf+0x3c>
+ bc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bce:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+ bd0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ bd3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ bd5:	83 c0 04             	add    $0x4,%eax
+ bd8:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+ bdb:	b8 e0 11 00 00       	mov    $0x11e0,%eax
+ be0:	85 db                	test   %ebx,%ebx
+ be2:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+ be5:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+ be8:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+ bea:	53                   	push   %ebx
+ beb:	e8 90 f9 ff ff       	call   580 <strlen>
+ bf0:	83 c4 0c             	add    $0xc,%esp
+ bf3:	50                   	push   %eax
+ bf4:	53                   	push   %ebx
+ bf5:	ff 75 08             	push   0x8(%ebp)
+ bf8:	e8 83 f5 ff ff       	call   180 <bufwrite>
+ bfd:	83 c4 10             	add    $0x10,%esp
+ c00:	e9 f7 fe ff ff       	jmp    afc <printf+0x3c>
+ c05:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ c08:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+ c0b:	83 ec 04             	sub    $0x4,%esp
+ c0e:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+ c11:	8b 06                	mov    (%esi),%eax
+        ap++;
+ c13:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+ c16:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+ c19:	6a 01                	push   $0x1
+ c1b:	52                   	push   %edx
+ c1c:	ff 75 08             	push   0x8(%ebp)
+ c1f:	e8 5c f5 ff ff       	call   180 <bufwrite>
+        ap++;
+ c24:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ c27:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c2a:	31 f6                	xor    %esi,%esi
+ c2c:	e9 cb fe ff ff       	jmp    afc <printf+0x3c>
+ c31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+ c38:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ c3b:	83 ec 0c             	sub    $0xc,%esp
+ c3e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ c43:	8b 16                	mov    (%esi),%edx
+ c45:	6a 01                	push   $0x1
+ c47:	e9 63 ff ff ff       	jmp    baf <printf+0xef>
+ c4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+ c50:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ c53:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ c56:	89 7d c0             	mov    %edi,-0x40(%ebp)
+ c59:	89 55 bc             	mov    %edx,-0x44(%ebp)
+ c5c:	8b 18                	mov    (%eax),%ebx
+ c5e:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+ c61:	31 c0                	xor    %eax,%eax
+ c63:	89 c7                	mov    %eax,%edi
+ c65:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+ c68:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+ c6d:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+ c6f:	f7 e1                	mul    %ecx
+ c71:	c1 ea 03             	shr    $0x3,%edx
+ c74:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ c77:	89 d1                	mov    %edx,%ecx
+ c79:	01 c0                	add    %eax,%eax
+ c7b:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ c7d:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+ c7f:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ c81:	be 0a 00 00 00       	mov    $0xa,%esi
+ c86:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+ c88:	89 da                	mov    %ebx,%edx
+ c8a:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+ c8c:	89 fe                	mov    %edi,%esi
+ c8e:	83 c7 01             	add    $0x1,%edi
+ c91:	8d 42 30             	lea    0x30(%edx),%eax
+ c94:	89 da                	mov    %ebx,%edx
+ c96:	8d 14 92             	lea    (%edx,%edx,4),%edx
+ c99:	01 d2                	add    %edx,%edx
+ c9b:	29 d0                	sub    %edx,%eax
+ c9d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+ ca1:	89 c8                	mov    %ecx,%eax
+ ca3:	09 d8                	or     %ebx,%eax
+ ca5:	75 c1                	jne    c68 <printf+0x1a8>
+ ca7:	8b 55 bc             	mov    -0x44(%ebp),%edx
+ caa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ cad:	01 d6                	add    %edx,%esi
+ caf:	89 f7                	mov    %esi,%edi
+ cb1:	89 d6                	mov    %edx,%esi
+ cb3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ cb7:	90                   	nop
+    putc(fd, buf[i]);
+ cb8:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+ cbb:	83 ec 04             	sub    $0x4,%esp
+ cbe:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+ cc1:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+ cc4:	6a 01                	push   $0x1
+ cc6:	50                   	push   %eax
+ cc7:	53                   	push   %ebx
+ cc8:	e8 b3 f4 ff ff       	call   180 <bufwrite>
+  while(--i >= 0)
+ ccd:	89 fa                	mov    %edi,%edx
+ ccf:	83 c4 10             	add    $0x10,%esp
+ cd2:	83 ef 01             	sub    $0x1,%edi
+ cd5:	39 d6                	cmp    %edx,%esi
+ cd7:	75 df                	jne    cb8 <printf+0x1f8>
+        ap += 2;
+ cd9:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+ cdd:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+ ce0:	31 f6                	xor    %esi,%esi
+ ce2:	e9 15 fe ff ff       	jmp    afc <printf+0x3c>
+ ce7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cee:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+ cf0:	83 ec 04             	sub    $0x4,%esp
+ cf3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ cf6:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ cf9:	6a 01                	push   $0x1
+ cfb:	e9 8b fe ff ff       	jmp    b8b <printf+0xcb>
+
+00000d00 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ d00:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d01:	a1 60 27 00 00       	mov    0x2760,%eax
+{
+ d06:	89 e5                	mov    %esp,%ebp
+ d08:	57                   	push   %edi
+ d09:	56                   	push   %esi
+ d0a:	53                   	push   %ebx
+ d0b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ d0e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d18:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d1a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d1c:	39 ca                	cmp    %ecx,%edx
+ d1e:	73 30                	jae    d50 <free+0x50>
+ d20:	39 c1                	cmp    %eax,%ecx
+ d22:	72 04                	jb     d28 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d24:	39 c2                	cmp    %eax,%edx
+ d26:	72 f0                	jb     d18 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ d28:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ d2b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ d2e:	39 f8                	cmp    %edi,%eax
+ d30:	74 2e                	je     d60 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d32:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ d35:	8b 42 04             	mov    0x4(%edx),%eax
+ d38:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d3b:	39 f1                	cmp    %esi,%ecx
+ d3d:	74 38                	je     d77 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ d3f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ d41:	5b                   	pop    %ebx
+  freep = p;
+ d42:	89 15 60 27 00 00    	mov    %edx,0x2760
+}
+ d48:	5e                   	pop    %esi
+ d49:	5f                   	pop    %edi
+ d4a:	5d                   	pop    %ebp
+ d4b:	c3                   	ret
+ d4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d50:	39 c1                	cmp    %eax,%ecx
+ d52:	72 d0                	jb     d24 <free+0x24>
+ d54:	eb c2                	jmp    d18 <free+0x18>
+ d56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d5d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ d60:	03 70 04             	add    0x4(%eax),%esi
+ d63:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d66:	8b 02                	mov    (%edx),%eax
+ d68:	8b 00                	mov    (%eax),%eax
+ d6a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ d6d:	8b 42 04             	mov    0x4(%edx),%eax
+ d70:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d73:	39 f1                	cmp    %esi,%ecx
+ d75:	75 c8                	jne    d3f <free+0x3f>
+    p->s.size += bp->s.size;
+ d77:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ d7a:	89 15 60 27 00 00    	mov    %edx,0x2760
+    p->s.size += bp->s.size;
+ d80:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ d83:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ d86:	89 0a                	mov    %ecx,(%edx)
+}
+ d88:	5b                   	pop    %ebx
+ d89:	5e                   	pop    %esi
+ d8a:	5f                   	pop    %edi
+ d8b:	5d                   	pop    %ebp
+ d8c:	c3                   	ret
+ d8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d90 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ d90:	55                   	push   %ebp
+ d91:	89 e5                	mov    %esp,%ebp
+ d93:	57                   	push   %edi
+ d94:	56                   	push   %esi
+ d95:	53                   	push   %ebx
+ d96:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d99:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ d9c:	8b 15 60 27 00 00    	mov    0x2760,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ da2:	8d 78 07             	lea    0x7(%eax),%edi
+ da5:	c1 ef 03             	shr    $0x3,%edi
+ da8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ dab:	85 d2                	test   %edx,%edx
+ dad:	0f 84 8d 00 00 00    	je     e40 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ db3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ db5:	8b 48 04             	mov    0x4(%eax),%ecx
+ db8:	39 f9                	cmp    %edi,%ecx
+ dba:	73 64                	jae    e20 <malloc+0x90>
+  if(nu < 4096)
+ dbc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ dc1:	39 df                	cmp    %ebx,%edi
+ dc3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ dc6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ dcd:	eb 0a                	jmp    dd9 <malloc+0x49>
+ dcf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ dd0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ dd2:	8b 48 04             	mov    0x4(%eax),%ecx
+ dd5:	39 f9                	cmp    %edi,%ecx
+ dd7:	73 47                	jae    e20 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ dd9:	89 c2                	mov    %eax,%edx
+ ddb:	39 05 60 27 00 00    	cmp    %eax,0x2760
+ de1:	75 ed                	jne    dd0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ de3:	83 ec 0c             	sub    $0xc,%esp
+ de6:	56                   	push   %esi
+ de7:	e8 c7 fa ff ff       	call   8b3 <sbrk>
+  if(p == (char*)-1)
+ dec:	83 c4 10             	add    $0x10,%esp
+ def:	83 f8 ff             	cmp    $0xffffffff,%eax
+ df2:	74 1c                	je     e10 <malloc+0x80>
+  hp->s.size = nu;
+ df4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ df7:	83 ec 0c             	sub    $0xc,%esp
+ dfa:	83 c0 08             	add    $0x8,%eax
+ dfd:	50                   	push   %eax
+ dfe:	e8 fd fe ff ff       	call   d00 <free>
+  return freep;
+ e03:	8b 15 60 27 00 00    	mov    0x2760,%edx
+      if((p = morecore(nunits)) == 0)
+ e09:	83 c4 10             	add    $0x10,%esp
+ e0c:	85 d2                	test   %edx,%edx
+ e0e:	75 c0                	jne    dd0 <malloc+0x40>
+        return 0;
+  }
+}
+ e10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ e13:	31 c0                	xor    %eax,%eax
+}
+ e15:	5b                   	pop    %ebx
+ e16:	5e                   	pop    %esi
+ e17:	5f                   	pop    %edi
+ e18:	5d                   	pop    %ebp
+ e19:	c3                   	ret
+ e1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ e20:	39 cf                	cmp    %ecx,%edi
+ e22:	74 4c                	je     e70 <malloc+0xe0>
+        p->s.size -= nunits;
+ e24:	29 f9                	sub    %edi,%ecx
+ e26:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ e29:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ e2c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ e2f:	89 15 60 27 00 00    	mov    %edx,0x2760
+}
+ e35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ e38:	83 c0 08             	add    $0x8,%eax
+}
+ e3b:	5b                   	pop    %ebx
+ e3c:	5e                   	pop    %esi
+ e3d:	5f                   	pop    %edi
+ e3e:	5d                   	pop    %ebp
+ e3f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ e40:	c7 05 60 27 00 00 64 	movl   $0x2764,0x2760
+ e47:	27 00 00 
+    base.s.size = 0;
+ e4a:	b8 64 27 00 00       	mov    $0x2764,%eax
+    base.s.ptr = freep = prevp = &base;
+ e4f:	c7 05 64 27 00 00 64 	movl   $0x2764,0x2764
+ e56:	27 00 00 
+    base.s.size = 0;
+ e59:	c7 05 68 27 00 00 00 	movl   $0x0,0x2768
+ e60:	00 00 00 
+    if(p->s.size >= nunits){
+ e63:	e9 54 ff ff ff       	jmp    dbc <malloc+0x2c>
+ e68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e6f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ e70:	8b 08                	mov    (%eax),%ecx
+ e72:	89 0a                	mov    %ecx,(%edx)
+ e74:	eb b9                	jmp    e2f <malloc+0x9f>
+ e76:	66 90                	xchg   %ax,%ax
+ e78:	66 90                	xchg   %ax,%ax
+ e7a:	66 90                	xchg   %ax,%ax
+ e7c:	66 90                	xchg   %ax,%ax
+ e7e:	66 90                	xchg   %ax,%ax
+
+00000e80 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+ e80:	55                   	push   %ebp
+ e81:	89 e5                	mov    %esp,%ebp
+ e83:	57                   	push   %edi
+ e84:	56                   	push   %esi
+ e85:	be 01 00 00 00       	mov    $0x1,%esi
+ e8a:	53                   	push   %ebx
+ e8b:	83 ec 28             	sub    $0x28,%esp
+ e8e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ e91:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ e94:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+ e97:	68 00 98 00 00       	push   $0x9800
+ e9c:	e8 ef fe ff ff       	call   d90 <malloc>
+ ea1:	83 c4 10             	add    $0x10,%esp
+ ea4:	89 c7                	mov    %eax,%edi
+ ea6:	85 c0                	test   %eax,%eax
+ ea8:	74 62                	je     f0c <waitpoll+0x8c>
+ eaa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+ eb0:	83 ec 0c             	sub    $0xc,%esp
+ eb3:	6a 01                	push   $0x1
+ eb5:	e8 03 fa ff ff       	call   8bd <sleep>
+    fn();
+ eba:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ ebd:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+ ebf:	58                   	pop    %eax
+ ec0:	5a                   	pop    %edx
+ ec1:	68 00 02 00 00       	push   $0x200
+ ec6:	57                   	push   %edi
+ ec7:	e8 eb fa ff ff       	call   9b7 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+ ecc:	83 c4 10             	add    $0x10,%esp
+ ecf:	85 c0                	test   %eax,%eax
+ ed1:	7e 2d                	jle    f00 <waitpoll+0x80>
+ ed3:	6b c0 4c             	imul   $0x4c,%eax,%eax
+ ed6:	89 fa                	mov    %edi,%edx
+    alive = 0;
+ ed8:	31 c9                	xor    %ecx,%ecx
+ eda:	01 f8                	add    %edi,%eax
+ edc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+ ee0:	3b 1a                	cmp    (%edx),%ebx
+ ee2:	75 07                	jne    eeb <waitpoll+0x6b>
+        alive = 1;
+ ee4:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+ ee8:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+ eeb:	83 c2 4c             	add    $0x4c,%edx
+ eee:	39 d0                	cmp    %edx,%eax
+ ef0:	75 ee                	jne    ee0 <waitpoll+0x60>
+  } while(alive);
+ ef2:	85 c9                	test   %ecx,%ecx
+ ef4:	75 ba                	jne    eb0 <waitpoll+0x30>
+ ef6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ efd:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+ f00:	83 ec 0c             	sub    $0xc,%esp
+ f03:	57                   	push   %edi
+ f04:	e8 f7 fd ff ff       	call   d00 <free>
+  wait();
+ f09:	83 c4 10             	add    $0x10,%esp
+}
+ f0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ f0f:	5b                   	pop    %ebx
+ f10:	5e                   	pop    %esi
+ f11:	5f                   	pop    %edi
+ f12:	5d                   	pop    %ebp
+  wait();
+ f13:	e9 10 f9 ff ff       	jmp    828 <wait>
+ f18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f1f:	90                   	nop
+
+00000f20 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+ f20:	55                   	push   %ebp
+ f21:	89 e5                	mov    %esp,%ebp
+ f23:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+ f26:	c7 45 f0 51 12 00 00 	movl   $0x1251,-0x10(%ebp)
+ f2d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+ f34:	e8 87 f4 ff ff       	call   3c0 <fork>
+ f39:	85 c0                	test   %eax,%eax
+ f3b:	78 09                	js     f46 <runps+0x26>
+    return -1;
+  if(pid == 0){
+ f3d:	74 0e                	je     f4d <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+ f3f:	e8 e4 f8 ff ff       	call   828 <wait>
+}
+ f44:	c9                   	leave
+ f45:	c3                   	ret
+ f46:	c9                   	leave
+    return -1;
+ f47:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ f4c:	c3                   	ret
+    exec("ps", argv);
+ f4d:	50                   	push   %eax
+ f4e:	50                   	push   %eax
+ f4f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ f52:	50                   	push   %eax
+ f53:	68 51 12 00 00       	push   $0x1251
+ f58:	e8 c3 f4 ff ff       	call   420 <exec>
+    printf(2, "exec ps failed\n");
+ f5d:	5a                   	pop    %edx
+ f5e:	59                   	pop    %ecx
+ f5f:	68 54 12 00 00       	push   $0x1254
+ f64:	6a 02                	push   $0x2
+ f66:	e8 55 fb ff ff       	call   ac0 <printf>
+    exit();
+ f6b:	e8 a0 f4 ff ff       	call   410 <exit>
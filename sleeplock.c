@@ -13,21 +13,51 @@
 void
 initsleeplock(struct sleeplock *lk, char *name)
 {
-  initlock(&lk->lk, "sleep lock");
+  initlock(&lk->lk, name);
+  lk->lk.insleeplock = 1;
   lk->name = name;
   lk->locked = 0;
   lk->pid = 0;
+  lk->owner = 0;
+  lk->sleepers = 0;
+  lk->nspinwait = lk->nsleep = 0;
 }
 
+// Wait for the lock by spinning while its holder is running
+// on another CPU, since then it will likely let go soon, and
+// by sleeping otherwise, as when the holder waits for the disk.
 void
 acquiresleep(struct sleeplock *lk)
 {
+  struct proc *p = myproc();
+  volatile struct proc *o;
+  int spun, slept;
+
+  spun = slept = 0;
   acquire(&lk->lk);
   while (lk->locked) {
+    o = lk->owner;
+    if(o && o != p && o->state == RUNNING){
+      release(&lk->lk);
+      while(*(volatile uint*)&lk->locked &&
+            *(struct proc *volatile*)&lk->owner == o && o->state == RUNNING)
+        pause();
+      spun = 1;
+      acquire(&lk->lk);
+      continue;
+    }
+    lk->sleepers++;
     sleep(lk, &lk->lk);
+    lk->sleepers--;
+    slept = 1;
   }
   lk->locked = 1;
-  lk->pid = myproc()->pid;
+  lk->pid = p->pid;
+  lk->owner = p;
+  if(slept)
+    lk->nsleep++;
+  else if(spun)
+    lk->nspinwait++;
   release(&lk->lk);
 }
 
@@ -37,7 +67,11 @@ releasesleep(struct sleeplock *lk)
   acquire(&lk->lk);
   lk->locked = 0;
   lk->pid = 0;
-  wakeup(lk);
+  lk->owner = 0;
+  // Only one waiter can have the lock; waking all would
+  // just send the rest back to sleep.
+  if(lk->sleepers)
+    wakeup_one(lk);
   release(&lk->lk);
 }
 
@@ -1,10 +1,18 @@
 // Long-term locks for processes
+// lk comes first, so that lockstat() can find the
+// sleeplock from it.
 struct sleeplock {
-  uint locked;       // Is the lock held?
   struct spinlock lk; // spinlock protecting this sleep lock
+  uint locked;       // Is the lock held?
   
   // For debugging:
   char *name;        // Name of lock.
   int pid;           // Process holding lock
+  struct proc *owner; // And its proc, for acquiresleep() to spin on
+  int sleepers;      // Processes asleep in acquiresleep()
+
+  // For lockstat:
+  uint nspinwait;    // Waits that ended by spinning
+  uint nsleep;       // and that slept
 };
 
@@ -8,29 +8,137 @@
 #include "mmu.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "sleeplock.h"
+#include "lockstat.h"
+
+// Every lock initlock() has seen, for lockstat(). The list
+// is guarded by a bare xchg flag, not a spinlock, because
+// initlock() runs before mycpu() works (kinit1), and
+// acquire() needs mycpu().
+static struct spinlock *locks;
+static uint listbusy;
+
+static uint
+locklist(void)
+{
+  uint eflags;
+
+  eflags = readeflags();
+  cli();
+  while(xchg(&listbusy, 1) != 0)
+    ;
+  __sync_synchronize();
+  return eflags;
+}
+
+static void
+unlocklist(uint eflags)
+{
+  __sync_synchronize();
+  asm volatile("movl $0, %0" : "+m" (listbusy) : );
+  if(eflags & FL_IF)
+    sti();
+}
 
 void
 initlock(struct spinlock *lk, char *name)
 {
+  uint eflags;
+
   lk->name = name;
-  lk->locked = 0;
+  lk->ticket = lk->serving = 0;
   lk->cpu = 0;
+  lk->nacquire = lk->ncontend = 0;
+  lk->spin = lk->maxhold = 0;
+  lk->insleeplock = 0;
+
+  eflags = locklist();
+  lk->prev = 0;
+  lk->next = locks;
+  if(locks)
+    locks->prev = lk;
+  locks = lk;
+  unlocklist(eflags);
+}
+
+// Take lk off the list before freeing the memory it is in.
+void
+droplock(struct spinlock *lk)
+{
+  uint eflags;
+
+  eflags = locklist();
+  if(lk->prev)
+    lk->prev->next = lk->next;
+  else
+    locks = lk->next;
+  if(lk->next)
+    lk->next->prev = lk->prev;
+  unlocklist(eflags);
+}
+
+// Copy out the counters of up to max locks, then zero
+// them all if reset. The record of a sleeplock's lk also
+// has the sleeplock's counters. Returns the number copied.
+int
+lockstat(struct lockstat *ls, int max, int reset)
+{
+  struct spinlock *lk;
+  struct sleeplock *sl;
+  uint eflags;
+  int n;
+
+  n = 0;
+  eflags = locklist();
+  for(lk = locks; lk; lk = lk->next){
+    sl = lk->insleeplock ? (struct sleeplock*)lk : 0;
+    if(n < max){
+      safestrcpy(ls->name, lk->name, sizeof(ls->name));
+      ls->nacquire = lk->nacquire;
+      ls->ncontend = lk->ncontend;
+      ls->spin = lk->spin;
+      ls->maxhold = lk->maxhold;
+      ls->nspinwait = sl ? sl->nspinwait : 0;
+      ls->nsleep = sl ? sl->nsleep : 0;
+      ls++;
+      n++;
+    }
+    // Racy, but only against other counting.
+    if(reset){
+      lk->nacquire = lk->ncontend = 0;
+      lk->spin = lk->maxhold = 0;
+      if(sl)
+        sl->nspinwait = sl->nsleep = 0;
+    }
+  }
+  unlocklist(eflags);
+  return n;
 }
 
 // Acquire the lock.
-// Loops (spins) until the lock is acquired.
+// Takes a ticket and loops (spins) until it is served.
+// Waiters only read lk->serving, so they share its cache
+// line until release() writes it, and get the lock in turn.
 // Holding a lock for a long time may cause
 // other CPUs to waste time spinning to acquire it.
 void
 acquire(struct spinlock *lk)
 {
+  uint me;
+
   pushcli(); // disable interrupts to avoid deadlock.
   if(holding(lk))
     panic("acquire");
 
-  // The xchg is atomic.
-  while(xchg(&lk->locked, 1) != 0)
-    ;
+  // The lock'ed xadd is atomic.
+  me = __sync_fetch_and_add(&lk->ticket, 1);
+  if(lk->serving != me){
+    uint64 t0 = rdtsc();
+    while(lk->serving != me)
+      pause();
+    lk->spin += rdtsc() - t0;
+    lk->ncontend++;
+  }
 
   // Tell the C compiler and the processor to not move loads or stores
   // past this point, to ensure that the critical section's memory
@@ -40,15 +148,22 @@ acquire(struct spinlock *lk)
   // Record info about lock acquisition for debugging.
   lk->cpu = mycpu();
   getcallerpcs(&lk, lk->pcs);
+  lk->nacquire++;
+  lk->acquired = rdtsc();
 }
 
 // Release the lock.
 void
 release(struct spinlock *lk)
 {
+  uint64 held;
+
   if(!holding(lk))
     panic("release");
 
+  held = rdtsc() - lk->acquired;
+  if(held > lk->maxhold)
+    lk->maxhold = held;
   lk->pcs[0] = 0;
   lk->cpu = 0;
 
@@ -59,14 +174,47 @@ release(struct spinlock *lk)
   // stores; __sync_synchronize() tells them both not to.
   __sync_synchronize();
 
-  // Release the lock, equivalent to lk->locked = 0.
-  // This code can't use a C assignment, since it might
-  // not be atomic. A real OS would use C atomics here.
-  asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+  // Serve the next ticket. Only the holder writes
+  // lk->serving, so a plain aligned store will do.
+  lk->serving = lk->serving + 1;
 
   popcli();
 }
 
+// For lockbench: a lock shared by all callers, registered
+// like any other so that lockstat shows it.
+#define LOCKBENCHMAX 1000  // longest run, in ticks
+static struct spinlock benchlock;
+static uint benchcount;
+
+void
+lockbenchinit(void)
+{
+  initlock(&benchlock, "bench");
+}
+
+// Take and drop benchlock until n clock ticks have passed
+// or the caller is killed. Returns how many times this
+// caller got it, or -1 if n is out of range.
+int
+lockbench(int n)
+{
+  uint end;
+  int got;
+
+  if(n < 0 || n > LOCKBENCHMAX)
+    return -1;
+  got = 0;
+  end = ticks + n;
+  while((int)(ticks - end) < 0 && !myproc()->killed){
+    acquire(&benchlock);
+    benchcount++;
+    release(&benchlock);
+    got++;
+  }
+  return got;
+}
+
 // Record the current call stack in pcs[] by following the %ebp chain.
 void
 getcallerpcs(void *v, uint pcs[])
@@ -91,7 +239,7 @@ holding(struct spinlock *lock)
 {
   int r;
   pushcli();
-  r = lock->locked && lock->cpu == mycpu();
+  r = lock->serving != lock->ticket && lock->cpu == mycpu();
   popcli();
   return r;
 }
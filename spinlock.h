@@ -1,11 +1,23 @@
-// Mutual exclusion lock.
+// Mutual exclusion lock: a ticket lock, which CPUs get
+// in the order they asked for it. It is held while
+// serving != ticket.
 struct spinlock {
-  uint locked;       // Is the lock held?
+  volatile uint ticket;   // Ticket the next acquire() takes
+  volatile uint serving;  // Ticket that holds the lock
 
   // For debugging:
   char *name;        // Name of lock.
   struct cpu *cpu;   // The cpu holding the lock.
   uint pcs[10];      // The call stack (an array of program counters)
                      // that locked the lock.
+
+  // For lockstat:
+  uint nacquire;     // Times acquired
+  uint ncontend;     // Times acquire() had to spin
+  uint64 spin;       // TSC cycles spent spinning
+  uint64 maxhold;    // Longest hold, in TSC cycles
+  uint64 acquired;   // TSC when last acquired
+  int insleeplock;   // Is the lk of a struct sleeplock
+  struct spinlock *next, *prev;  // All locks, from initlock()
 };
 
@@ -0,0 +1,2364 @@
+
+_statbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 48             	sub    $0x48,%esp
+      14:	8b 39                	mov    (%ecx),%edi
+      16:	8b 51 04             	mov    0x4(%ecx),%edx
+  struct icachestat a, b;
+  int nproc, rounds, i, t;
+
+  nproc = argc > 1 ? atoi(argv[1]) : 4;
+      19:	83 ff 01             	cmp    $0x1,%edi
+      1c:	0f 8f ae 00 00 00    	jg     d0 <main+0xd0>
+  rounds = argc > 2 ? atoi(argv[2]) : 20;
+
+  setup();
+      22:	e8 69 01 00 00       	call   190 <setup>
+  icachestat(&a);
+      27:	83 ec 0c             	sub    $0xc,%esp
+      2a:	8d 45 c0             	lea    -0x40(%ebp),%eax
+  nproc = argc > 1 ? atoi(argv[1]) : 4;
+      2d:	bb 04 00 00 00       	mov    $0x4,%ebx
+  icachestat(&a);
+      32:	50                   	push   %eax
+  rounds = argc > 2 ? atoi(argv[2]) : 20;
+      33:	be 14 00 00 00       	mov    $0x14,%esi
+  icachestat(&a);
+      38:	e8 a4 0b 00 00       	call   be1 <icachestat>
+  t = uptime();
+      3d:	e8 f5 0a 00 00       	call   b37 <uptime>
+      42:	83 c4 10             	add    $0x10,%esp
+      45:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  for(i = 0; i < nproc; i++){
+      48:	31 ff                	xor    %edi,%edi
+      4a:	eb 0b                	jmp    57 <main+0x57>
+      4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      50:	83 c7 01             	add    $0x1,%edi
+      53:	39 df                	cmp    %ebx,%edi
+      55:	7d 17                	jge    6e <main+0x6e>
+    if(fork() == 0){
+      57:	e8 d4 05 00 00       	call   630 <fork>
+      5c:	85 c0                	test   %eax,%eax
+      5e:	75 f0                	jne    50 <main+0x50>
+      statter(i, rounds);
+      60:	51                   	push   %ecx
+      61:	51                   	push   %ecx
+      62:	56                   	push   %esi
+      63:	57                   	push   %edi
+      64:	e8 97 02 00 00       	call   300 <statter>
+      exit();
+      69:	e8 12 06 00 00       	call   680 <exit>
+    }
+  }
+  for(i = 0; i < nproc; i++)
+      6e:	31 ff                	xor    %edi,%edi
+    wait();
+      70:	e8 23 0a 00 00       	call   a98 <wait>
+  for(i = 0; i < nproc; i++)
+      75:	83 c7 01             	add    $0x1,%edi
+      78:	39 df                	cmp    %ebx,%edi
+      7a:	75 f4                	jne    70 <main+0x70>
+  t = uptime() - t;
+      7c:	e8 b6 0a 00 00       	call   b37 <uptime>
+      81:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+  icachestat(&b);
+      84:	83 ec 0c             	sub    $0xc,%esp
+
+  printf(1, "%d procs x %d stats: %d ticks, %d hits, %d misses, "
+      87:	c1 e6 06             	shl    $0x6,%esi
+  t = uptime() - t;
+      8a:	29 d0                	sub    %edx,%eax
+      8c:	89 c7                	mov    %eax,%edi
+  icachestat(&b);
+      8e:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+      91:	50                   	push   %eax
+      92:	e8 4a 0b 00 00       	call   be1 <icachestat>
+  printf(1, "%d procs x %d stats: %d ticks, %d hits, %d misses, "
+      97:	58                   	pop    %eax
+      98:	5a                   	pop    %edx
+      99:	ff 75 e4             	push   -0x1c(%ebp)
+      9c:	ff 75 e0             	push   -0x20(%ebp)
+      9f:	8b 45 dc             	mov    -0x24(%ebp),%eax
+      a2:	2b 45 c8             	sub    -0x38(%ebp),%eax
+      a5:	50                   	push   %eax
+      a6:	8b 45 d8             	mov    -0x28(%ebp),%eax
+      a9:	2b 45 c4             	sub    -0x3c(%ebp),%eax
+      ac:	50                   	push   %eax
+      ad:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+      b0:	2b 45 c0             	sub    -0x40(%ebp),%eax
+      b3:	50                   	push   %eax
+      b4:	57                   	push   %edi
+      b5:	56                   	push   %esi
+      b6:	53                   	push   %ebx
+      b7:	68 18 12 00 00       	push   $0x1218
+      bc:	6a 01                	push   $0x1
+      be:	e8 6d 0c 00 00       	call   d30 <printf>
+         "%d evicted, %d entries, %d idle\n",
+         nproc, rounds*NDIR*NFILE, t, b.hits - a.hits,
+         b.misses - a.misses, b.evicted - a.evicted, b.entries, b.idle);
+  cleanup();
+      c3:	83 c4 30             	add    $0x30,%esp
+      c6:	e8 95 01 00 00       	call   260 <cleanup>
+  exit();
+      cb:	e8 b0 05 00 00       	call   680 <exit>
+  nproc = argc > 1 ? atoi(argv[1]) : 4;
+      d0:	83 ec 0c             	sub    $0xc,%esp
+      d3:	ff 72 04             	push   0x4(%edx)
+  rounds = argc > 2 ? atoi(argv[2]) : 20;
+      d6:	be 14 00 00 00       	mov    $0x14,%esi
+  nproc = argc > 1 ? atoi(argv[1]) : 4;
+      db:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+      de:	e8 fd 08 00 00       	call   9e0 <atoi>
+  rounds = argc > 2 ? atoi(argv[2]) : 20;
+      e3:	83 c4 10             	add    $0x10,%esp
+  nproc = argc > 1 ? atoi(argv[1]) : 4;
+      e6:	89 c3                	mov    %eax,%ebx
+  rounds = argc > 2 ? atoi(argv[2]) : 20;
+      e8:	83 ff 02             	cmp    $0x2,%edi
+      eb:	74 13                	je     100 <main+0x100>
+      ed:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+      f0:	83 ec 0c             	sub    $0xc,%esp
+      f3:	ff 72 08             	push   0x8(%edx)
+      f6:	e8 e5 08 00 00       	call   9e0 <atoi>
+      fb:	83 c4 10             	add    $0x10,%esp
+      fe:	89 c6                	mov    %eax,%esi
+  setup();
+     100:	e8 8b 00 00 00       	call   190 <setup>
+  icachestat(&a);
+     105:	83 ec 0c             	sub    $0xc,%esp
+     108:	8d 45 c0             	lea    -0x40(%ebp),%eax
+     10b:	50                   	push   %eax
+     10c:	e8 d0 0a 00 00       	call   be1 <icachestat>
+  t = uptime();
+     111:	e8 21 0a 00 00       	call   b37 <uptime>
+  for(i = 0; i < nproc; i++){
+     116:	83 c4 10             	add    $0x10,%esp
+  t = uptime();
+     119:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  for(i = 0; i < nproc; i++){
+     11c:	85 db                	test   %ebx,%ebx
+     11e:	0f 8f 24 ff ff ff    	jg     48 <main+0x48>
+     124:	e9 53 ff ff ff       	jmp    7c <main+0x7c>
+     129:	66 90                	xchg   %ax,%ax
+     12b:	66 90                	xchg   %ax,%ax
+     12d:	66 90                	xchg   %ax,%ax
+     12f:	90                   	nop
+
+00000130 <mkpath>:
+{
+     130:	55                   	push   %ebp
+  path[0] = 's';
+     131:	0f b7 05 6c 12 00 00 	movzwl 0x126c,%eax
+     138:	66 a3 20 18 00 00    	mov    %ax,0x1820
+{
+     13e:	89 e5                	mov    %esp,%ebp
+  path[2] = '0' + d;
+     140:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+{
+     144:	8b 55 0c             	mov    0xc(%ebp),%edx
+  path[2] = '0' + d;
+     147:	83 c0 30             	add    $0x30,%eax
+     14a:	a2 22 18 00 00       	mov    %al,0x1822
+  if(f >= 0){
+     14f:	85 d2                	test   %edx,%edx
+     151:	78 25                	js     178 <mkpath+0x48>
+    path[3] = '/';
+     153:	0f b7 05 6e 12 00 00 	movzwl 0x126e,%eax
+    path[5] = '0' + f;
+     15a:	83 c2 30             	add    $0x30,%edx
+}
+     15d:	5d                   	pop    %ebp
+    path[6] = 0;
+     15e:	c6 05 26 18 00 00 00 	movb   $0x0,0x1826
+    path[5] = '0' + f;
+     165:	88 15 25 18 00 00    	mov    %dl,0x1825
+    path[3] = '/';
+     16b:	66 a3 23 18 00 00    	mov    %ax,0x1823
+}
+     171:	c3                   	ret
+     172:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  path[3] = 0;
+     178:	c6 05 23 18 00 00 00 	movb   $0x0,0x1823
+}
+     17f:	5d                   	pop    %ebp
+     180:	c3                   	ret
+     181:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     188:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     18f:	90                   	nop
+
+00000190 <setup>:
+{
+     190:	55                   	push   %ebp
+     191:	89 e5                	mov    %esp,%ebp
+     193:	57                   	push   %edi
+     194:	56                   	push   %esi
+     195:	be 30 00 00 00       	mov    $0x30,%esi
+     19a:	53                   	push   %ebx
+     19b:	83 ec 0c             	sub    $0xc,%esp
+     19e:	0f b7 3d 6c 12 00 00 	movzwl 0x126c,%edi
+     1a5:	8d 76 00             	lea    0x0(%esi),%esi
+    mkdir(path);
+     1a8:	83 ec 0c             	sub    $0xc,%esp
+  path[2] = '0' + d;
+     1ab:	89 f0                	mov    %esi,%eax
+  path[0] = 's';
+     1ad:	66 89 3d 20 18 00 00 	mov    %di,0x1820
+    mkdir(path);
+     1b4:	bb 30 00 00 00       	mov    $0x30,%ebx
+  path[2] = '0' + d;
+     1b9:	a2 22 18 00 00       	mov    %al,0x1822
+  path[3] = 0;
+     1be:	c6 05 23 18 00 00 00 	movb   $0x0,0x1823
+    mkdir(path);
+     1c5:	68 20 18 00 00       	push   $0x1820
+     1ca:	e8 2c 09 00 00       	call   afb <mkdir>
+     1cf:	83 c4 10             	add    $0x10,%esp
+     1d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  path[2] = '0' + d;
+     1d8:	89 f0                	mov    %esi,%eax
+      if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+     1da:	83 ec 08             	sub    $0x8,%esp
+  path[0] = 's';
+     1dd:	66 89 3d 20 18 00 00 	mov    %di,0x1820
+  path[2] = '0' + d;
+     1e4:	a2 22 18 00 00       	mov    %al,0x1822
+    path[3] = '/';
+     1e9:	b8 2f 66 00 00       	mov    $0x662f,%eax
+     1ee:	66 a3 23 18 00 00    	mov    %ax,0x1823
+    path[5] = '0' + f;
+     1f4:	88 1d 25 18 00 00    	mov    %bl,0x1825
+    path[6] = 0;
+     1fa:	c6 05 26 18 00 00 00 	movb   $0x0,0x1826
+      if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+     201:	68 02 02 00 00       	push   $0x202
+     206:	68 20 18 00 00       	push   $0x1820
+     20b:	e8 b9 08 00 00       	call   ac9 <open>
+     210:	83 c4 10             	add    $0x10,%esp
+     213:	85 c0                	test   %eax,%eax
+     215:	78 29                	js     240 <setup+0xb0>
+      close(fd);
+     217:	83 ec 0c             	sub    $0xc,%esp
+    for(f = 0; f < NFILE; f++){
+     21a:	83 c3 01             	add    $0x1,%ebx
+      close(fd);
+     21d:	50                   	push   %eax
+     21e:	e8 cd 04 00 00       	call   6f0 <close>
+    for(f = 0; f < NFILE; f++){
+     223:	83 c4 10             	add    $0x10,%esp
+     226:	80 fb 38             	cmp    $0x38,%bl
+     229:	75 ad                	jne    1d8 <setup+0x48>
+  for(d = 0; d < NDIR; d++){
+     22b:	83 c6 01             	add    $0x1,%esi
+     22e:	89 f0                	mov    %esi,%eax
+     230:	3c 38                	cmp    $0x38,%al
+     232:	0f 85 70 ff ff ff    	jne    1a8 <setup+0x18>
+}
+     238:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     23b:	5b                   	pop    %ebx
+     23c:	5e                   	pop    %esi
+     23d:	5f                   	pop    %edi
+     23e:	5d                   	pop    %ebp
+     23f:	c3                   	ret
+        printf(2, "statbench: cannot create %s\n", path);
+     240:	83 ec 04             	sub    $0x4,%esp
+     243:	68 20 18 00 00       	push   $0x1820
+     248:	68 e0 11 00 00       	push   $0x11e0
+     24d:	6a 02                	push   $0x2
+     24f:	e8 dc 0a 00 00       	call   d30 <printf>
+        exit();
+     254:	e8 27 04 00 00       	call   680 <exit>
+     259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <cleanup>:
+{
+     260:	55                   	push   %ebp
+     261:	89 e5                	mov    %esp,%ebp
+     263:	57                   	push   %edi
+     264:	56                   	push   %esi
+  path[2] = '0' + d;
+     265:	be 30 00 00 00       	mov    $0x30,%esi
+{
+     26a:	53                   	push   %ebx
+     26b:	83 ec 0c             	sub    $0xc,%esp
+     26e:	0f b7 3d 6c 12 00 00 	movzwl 0x126c,%edi
+     275:	8d 76 00             	lea    0x0(%esi),%esi
+  path[2] = '0' + d;
+     278:	bb 30 00 00 00       	mov    $0x30,%ebx
+     27d:	8d 76 00             	lea    0x0(%esi),%esi
+     280:	89 f0                	mov    %esi,%eax
+      unlink(path);
+     282:	83 ec 0c             	sub    $0xc,%esp
+    path[5] = '0' + f;
+     285:	88 1d 25 18 00 00    	mov    %bl,0x1825
+    for(f = 0; f < NFILE; f++){
+     28b:	83 c3 01             	add    $0x1,%ebx
+  path[2] = '0' + d;
+     28e:	a2 22 18 00 00       	mov    %al,0x1822
+    path[3] = '/';
+     293:	b8 2f 66 00 00       	mov    $0x662f,%eax
+  path[0] = 's';
+     298:	66 89 3d 20 18 00 00 	mov    %di,0x1820
+    path[3] = '/';
+     29f:	66 a3 23 18 00 00    	mov    %ax,0x1823
+    path[6] = 0;
+     2a5:	c6 05 26 18 00 00 00 	movb   $0x0,0x1826
+      unlink(path);
+     2ac:	68 20 18 00 00       	push   $0x1820
+     2b1:	e8 27 08 00 00       	call   add <unlink>
+    for(f = 0; f < NFILE; f++){
+     2b6:	83 c4 10             	add    $0x10,%esp
+     2b9:	80 fb 38             	cmp    $0x38,%bl
+     2bc:	75 c2                	jne    280 <cleanup+0x20>
+  path[2] = '0' + d;
+     2be:	89 f0                	mov    %esi,%eax
+    unlink(path);
+     2c0:	83 ec 0c             	sub    $0xc,%esp
+  for(d = 0; d < NDIR; d++){
+     2c3:	83 c6 01             	add    $0x1,%esi
+  path[0] = 's';
+     2c6:	66 89 3d 20 18 00 00 	mov    %di,0x1820
+  path[2] = '0' + d;
+     2cd:	a2 22 18 00 00       	mov    %al,0x1822
+  path[3] = 0;
+     2d2:	c6 05 23 18 00 00 00 	movb   $0x0,0x1823
+    unlink(path);
+     2d9:	68 20 18 00 00       	push   $0x1820
+     2de:	e8 fa 07 00 00       	call   add <unlink>
+  for(d = 0; d < NDIR; d++){
+     2e3:	89 f0                	mov    %esi,%eax
+     2e5:	83 c4 10             	add    $0x10,%esp
+     2e8:	3c 38                	cmp    $0x38,%al
+     2ea:	75 8c                	jne    278 <cleanup+0x18>
+}
+     2ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     2ef:	5b                   	pop    %ebx
+     2f0:	5e                   	pop    %esi
+     2f1:	5f                   	pop    %edi
+     2f2:	5d                   	pop    %ebp
+     2f3:	c3                   	ret
+     2f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2ff:	90                   	nop
+
+00000300 <statter>:
+{
+     300:	55                   	push   %ebp
+     301:	89 e5                	mov    %esp,%ebp
+     303:	57                   	push   %edi
+     304:	56                   	push   %esi
+     305:	53                   	push   %ebx
+     306:	83 ec 3c             	sub    $0x3c,%esp
+  for(r = 0; r < rounds; r++){
+     309:	8b 55 0c             	mov    0xc(%ebp),%edx
+     30c:	85 d2                	test   %edx,%edx
+     30e:	0f 8e ad 00 00 00    	jle    3c1 <statter+0xc1>
+     314:	8b 55 08             	mov    0x8(%ebp),%edx
+     317:	0f b7 3d 6c 12 00 00 	movzwl 0x126c,%edi
+     31e:	31 c0                	xor    %eax,%eax
+     320:	8d 75 d4             	lea    -0x2c(%ebp),%esi
+     323:	83 c2 08             	add    $0x8,%edx
+     326:	89 55 bc             	mov    %edx,-0x44(%ebp)
+     329:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    for(d = 0; d < NDIR; d++){
+     330:	89 45 b8             	mov    %eax,-0x48(%ebp)
+     333:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     33d:	8d 76 00             	lea    0x0(%esi),%esi
+        mkpath((d + id) % NDIR, f);
+     340:	89 c8                	mov    %ecx,%eax
+     342:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+     345:	c1 f8 1f             	sar    $0x1f,%eax
+     348:	c1 e8 1d             	shr    $0x1d,%eax
+     34b:	8d 1c 01             	lea    (%ecx,%eax,1),%ebx
+     34e:	83 e3 07             	and    $0x7,%ebx
+     351:	29 c3                	sub    %eax,%ebx
+  path[2] = '0' + d;
+     353:	8d 43 30             	lea    0x30(%ebx),%eax
+     356:	bb 30 00 00 00       	mov    $0x30,%ebx
+     35b:	88 45 c7             	mov    %al,-0x39(%ebp)
+     35e:	66 90                	xchg   %ax,%ax
+     360:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+        if(stat(path, &st) < 0){
+     364:	83 ec 08             	sub    $0x8,%esp
+  path[0] = 's';
+     367:	66 89 3d 20 18 00 00 	mov    %di,0x1820
+    path[5] = '0' + f;
+     36e:	88 1d 25 18 00 00    	mov    %bl,0x1825
+  path[2] = '0' + d;
+     374:	a2 22 18 00 00       	mov    %al,0x1822
+    path[3] = '/';
+     379:	b8 2f 66 00 00       	mov    $0x662f,%eax
+     37e:	66 a3 23 18 00 00    	mov    %ax,0x1823
+    path[6] = 0;
+     384:	c6 05 26 18 00 00 00 	movb   $0x0,0x1826
+        if(stat(path, &st) < 0){
+     38b:	56                   	push   %esi
+     38c:	68 20 18 00 00       	push   $0x1820
+     391:	e8 aa 05 00 00       	call   940 <stat>
+     396:	83 c4 10             	add    $0x10,%esp
+     399:	85 c0                	test   %eax,%eax
+     39b:	78 2c                	js     3c9 <statter+0xc9>
+      for(f = 0; f < NFILE; f++){
+     39d:	83 c3 01             	add    $0x1,%ebx
+     3a0:	80 fb 38             	cmp    $0x38,%bl
+     3a3:	75 bb                	jne    360 <statter+0x60>
+    for(d = 0; d < NDIR; d++){
+     3a5:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+     3a8:	8b 45 bc             	mov    -0x44(%ebp),%eax
+     3ab:	83 c1 01             	add    $0x1,%ecx
+     3ae:	39 c1                	cmp    %eax,%ecx
+     3b0:	75 8e                	jne    340 <statter+0x40>
+  for(r = 0; r < rounds; r++){
+     3b2:	8b 45 b8             	mov    -0x48(%ebp),%eax
+     3b5:	83 c0 01             	add    $0x1,%eax
+     3b8:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     3bb:	0f 85 6f ff ff ff    	jne    330 <statter+0x30>
+}
+     3c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     3c4:	5b                   	pop    %ebx
+     3c5:	5e                   	pop    %esi
+     3c6:	5f                   	pop    %edi
+     3c7:	5d                   	pop    %ebp
+     3c8:	c3                   	ret
+          printf(2, "statbench: cannot stat %s\n", path);
+     3c9:	83 ec 04             	sub    $0x4,%esp
+     3cc:	68 20 18 00 00       	push   $0x1820
+     3d1:	68 fd 11 00 00       	push   $0x11fd
+     3d6:	6a 02                	push   $0x2
+     3d8:	e8 53 09 00 00       	call   d30 <printf>
+          exit();
+     3dd:	e8 9e 02 00 00       	call   680 <exit>
+     3e2:	66 90                	xchg   %ax,%ax
+     3e4:	66 90                	xchg   %ax,%ax
+     3e6:	66 90                	xchg   %ax,%ax
+     3e8:	66 90                	xchg   %ax,%ax
+     3ea:	66 90                	xchg   %ax,%ax
+     3ec:	66 90                	xchg   %ax,%ax
+     3ee:	66 90                	xchg   %ax,%ax
+
+000003f0 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+     3f0:	55                   	push   %ebp
+     3f1:	89 e5                	mov    %esp,%ebp
+     3f3:	57                   	push   %edi
+     3f4:	56                   	push   %esi
+     3f5:	53                   	push   %ebx
+     3f6:	83 ec 4c             	sub    $0x4c,%esp
+     3f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     3fc:	8b 55 08             	mov    0x8(%ebp),%edx
+     3ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     402:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+     405:	83 fa 0f             	cmp    $0xf,%edx
+     408:	0f 87 32 01 00 00    	ja     540 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+     40e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     414:	8b 80 40 18 00 00    	mov    0x1840(%eax),%eax
+     41a:	85 c0                	test   %eax,%eax
+     41c:	0f 84 de 00 00 00    	je     500 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+     422:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     428:	8b b0 44 18 00 00    	mov    0x1844(%eax),%esi
+     42e:	8d 88 40 18 00 00    	lea    0x1840(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+     434:	8d b8 48 18 00 00    	lea    0x1848(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+     43a:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+     43d:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+     440:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+     443:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+     449:	0f 8f 01 01 00 00    	jg     550 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+     44f:	8d 78 08             	lea    0x8(%eax),%edi
+     452:	8d bc 3e 40 18 00 00 	lea    0x1840(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     459:	85 db                	test   %ebx,%ebx
+     45b:	7e 3b                	jle    498 <bufwrite+0xa8>
+     45d:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+     460:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+     463:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     467:	90                   	nop
+    *dst++ = *src++;
+     468:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     469:	39 c6                	cmp    %eax,%esi
+     46b:	75 fb                	jne    468 <bufwrite+0x78>
+  ob[fd].n += n;
+     46d:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     473:	8b 88 44 18 00 00    	mov    0x1844(%eax),%ecx
+     479:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     47b:	83 b8 40 18 00 00 01 	cmpl   $0x1,0x1840(%eax)
+  ob[fd].n += n;
+     482:	89 88 44 18 00 00    	mov    %ecx,0x1844(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     488:	74 26                	je     4b0 <bufwrite+0xc0>
+}
+     48a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     48d:	5b                   	pop    %ebx
+     48e:	5e                   	pop    %esi
+     48f:	5f                   	pop    %edi
+     490:	5d                   	pop    %ebp
+     491:	c3                   	ret
+     492:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+     498:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     49b:	83 b8 40 18 00 00 01 	cmpl   $0x1,0x1840(%eax)
+  ob[fd].n += n;
+     4a2:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     4a5:	75 e3                	jne    48a <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+     4a7:	85 db                	test   %ebx,%ebx
+     4a9:	74 df                	je     48a <bufwrite+0x9a>
+     4ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4af:	90                   	nop
+  src = vsrc;
+     4b0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     4b3:	01 c3                	add    %eax,%ebx
+     4b5:	eb 10                	jmp    4c7 <bufwrite+0xd7>
+     4b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4be:	66 90                	xchg   %ax,%ax
+     4c0:	83 c0 01             	add    $0x1,%eax
+     4c3:	39 d8                	cmp    %ebx,%eax
+     4c5:	74 c3                	je     48a <bufwrite+0x9a>
+    if(*p == (char)c)
+     4c7:	80 38 0a             	cmpb   $0xa,(%eax)
+     4ca:	75 f4                	jne    4c0 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     4cc:	85 c9                	test   %ecx,%ecx
+     4ce:	7e ba                	jle    48a <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+     4d0:	83 ec 04             	sub    $0x4,%esp
+     4d3:	51                   	push   %ecx
+     4d4:	ff 75 ac             	push   -0x54(%ebp)
+     4d7:	52                   	push   %edx
+     4d8:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+     4db:	e8 cd 05 00 00       	call   aad <write>
+    ob[fd].n = 0;
+     4e0:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     4e3:	83 c4 10             	add    $0x10,%esp
+     4e6:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+     4ec:	c7 82 44 18 00 00 00 	movl   $0x0,0x1844(%edx)
+     4f3:	00 00 00 
+     4f6:	eb 92                	jmp    48a <bufwrite+0x9a>
+     4f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ff:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     500:	83 ec 08             	sub    $0x8,%esp
+     503:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     506:	50                   	push   %eax
+     507:	52                   	push   %edx
+     508:	89 55 b0             	mov    %edx,-0x50(%ebp)
+     50b:	e8 d7 05 00 00       	call   ae7 <fstat>
+     510:	83 c4 10             	add    $0x10,%esp
+     513:	8b 55 b0             	mov    -0x50(%ebp),%edx
+     516:	89 c1                	mov    %eax,%ecx
+     518:	b8 02 00 00 00       	mov    $0x2,%eax
+     51d:	85 c9                	test   %ecx,%ecx
+     51f:	75 0d                	jne    52e <bufwrite+0x13e>
+     521:	31 c0                	xor    %eax,%eax
+     523:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     528:	0f 95 c0             	setne  %al
+     52b:	83 c0 01             	add    $0x1,%eax
+     52e:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+     534:	89 81 40 18 00 00    	mov    %eax,0x1840(%ecx)
+     53a:	e9 e3 fe ff ff       	jmp    422 <bufwrite+0x32>
+     53f:	90                   	nop
+}
+     540:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     543:	5b                   	pop    %ebx
+     544:	5e                   	pop    %esi
+     545:	5f                   	pop    %edi
+     546:	5d                   	pop    %ebp
+    write(fd, p, n);
+     547:	e9 61 05 00 00       	jmp    aad <write>
+     54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+     550:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+     553:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+     556:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+     559:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+     55c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+     55f:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+     562:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+     565:	6a 02                	push   $0x2
+     567:	50                   	push   %eax
+     568:	52                   	push   %edx
+     569:	e8 9b 06 00 00       	call   c09 <writev>
+    ob[fd].n = 0;
+     56e:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+     571:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+     574:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+     57b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     57e:	5b                   	pop    %ebx
+     57f:	5e                   	pop    %esi
+     580:	5f                   	pop    %edi
+     581:	5d                   	pop    %ebp
+     582:	c3                   	ret
+     583:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     58a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000590 <fflush>:
+{
+     590:	55                   	push   %ebp
+     591:	89 e5                	mov    %esp,%ebp
+     593:	53                   	push   %ebx
+     594:	83 ec 04             	sub    $0x4,%esp
+     597:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     59a:	83 f8 0f             	cmp    $0xf,%eax
+     59d:	77 16                	ja     5b5 <fflush+0x25>
+     59f:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+     5a5:	8b 8a 44 18 00 00    	mov    0x1844(%edx),%ecx
+     5ab:	8d 9a 40 18 00 00    	lea    0x1840(%edx),%ebx
+     5b1:	85 c9                	test   %ecx,%ecx
+     5b3:	7f 0b                	jg     5c0 <fflush+0x30>
+}
+     5b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5b8:	c9                   	leave
+     5b9:	c3                   	ret
+     5ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     5c0:	83 ec 04             	sub    $0x4,%esp
+     5c3:	81 c2 48 18 00 00    	add    $0x1848,%edx
+     5c9:	51                   	push   %ecx
+     5ca:	52                   	push   %edx
+     5cb:	50                   	push   %eax
+     5cc:	e8 dc 04 00 00       	call   aad <write>
+    ob[fd].n = 0;
+     5d1:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     5d8:	83 c4 10             	add    $0x10,%esp
+}
+     5db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5de:	c9                   	leave
+     5df:	c3                   	ret
+
+000005e0 <fflushall>:
+{
+     5e0:	55                   	push   %ebp
+     5e1:	89 e5                	mov    %esp,%ebp
+     5e3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     5e4:	31 f6                	xor    %esi,%esi
+{
+     5e6:	53                   	push   %ebx
+     5e7:	bb 48 18 00 00       	mov    $0x1848,%ebx
+     5ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     5f0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     5f3:	85 c0                	test   %eax,%eax
+     5f5:	7e 15                	jle    60c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     5f7:	83 ec 04             	sub    $0x4,%esp
+     5fa:	50                   	push   %eax
+     5fb:	53                   	push   %ebx
+     5fc:	56                   	push   %esi
+     5fd:	e8 ab 04 00 00       	call   aad <write>
+    ob[fd].n = 0;
+     602:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     609:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     60c:	83 c6 01             	add    $0x1,%esi
+     60f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     615:	83 fe 10             	cmp    $0x10,%esi
+     618:	75 d6                	jne    5f0 <fflushall+0x10>
+}
+     61a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     61d:	5b                   	pop    %ebx
+     61e:	5e                   	pop    %esi
+     61f:	5d                   	pop    %ebp
+     620:	c3                   	ret
+     621:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     628:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     62f:	90                   	nop
+
+00000630 <fork>:
+{
+     630:	55                   	push   %ebp
+     631:	89 e5                	mov    %esp,%ebp
+     633:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     634:	31 f6                	xor    %esi,%esi
+{
+     636:	53                   	push   %ebx
+     637:	bb 48 18 00 00       	mov    $0x1848,%ebx
+     63c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     640:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     643:	85 c0                	test   %eax,%eax
+     645:	7e 15                	jle    65c <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     647:	83 ec 04             	sub    $0x4,%esp
+     64a:	50                   	push   %eax
+     64b:	53                   	push   %ebx
+     64c:	56                   	push   %esi
+     64d:	e8 5b 04 00 00       	call   aad <write>
+    ob[fd].n = 0;
+     652:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     659:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     65c:	83 c6 01             	add    $0x1,%esi
+     65f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     665:	83 fe 10             	cmp    $0x10,%esi
+     668:	75 d6                	jne    640 <fork+0x10>
+}
+     66a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     66d:	5b                   	pop    %ebx
+     66e:	5e                   	pop    %esi
+     66f:	5d                   	pop    %ebp
+  return _fork();
+     670:	e9 15 04 00 00       	jmp    a8a <_fork>
+     675:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     67c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000680 <exit>:
+{
+     680:	55                   	push   %ebp
+     681:	89 e5                	mov    %esp,%ebp
+     683:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+     686:	e8 55 ff ff ff       	call   5e0 <fflushall>
+  _exit();
+     68b:	e8 01 04 00 00       	call   a91 <_exit>
+
+00000690 <exec>:
+{
+     690:	55                   	push   %ebp
+     691:	89 e5                	mov    %esp,%ebp
+     693:	57                   	push   %edi
+     694:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     695:	31 f6                	xor    %esi,%esi
+{
+     697:	53                   	push   %ebx
+     698:	bb 48 18 00 00       	mov    $0x1848,%ebx
+     69d:	83 ec 1c             	sub    $0x1c,%esp
+     6a0:	8b 45 08             	mov    0x8(%ebp),%eax
+     6a3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     6a6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     6a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     6b0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     6b3:	85 c0                	test   %eax,%eax
+     6b5:	7e 15                	jle    6cc <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     6b7:	83 ec 04             	sub    $0x4,%esp
+     6ba:	50                   	push   %eax
+     6bb:	53                   	push   %ebx
+     6bc:	56                   	push   %esi
+     6bd:	e8 eb 03 00 00       	call   aad <write>
+    ob[fd].n = 0;
+     6c2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     6c9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     6cc:	83 c6 01             	add    $0x1,%esi
+     6cf:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     6d5:	83 fe 10             	cmp    $0x10,%esi
+     6d8:	75 d6                	jne    6b0 <exec+0x20>
+  return _exec(path, argv);
+     6da:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     6dd:	89 7d 0c             	mov    %edi,0xc(%ebp)
+     6e0:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     6e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6e6:	5b                   	pop    %ebx
+     6e7:	5e                   	pop    %esi
+     6e8:	5f                   	pop    %edi
+     6e9:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     6ea:	e9 d3 03 00 00       	jmp    ac2 <_exec>
+     6ef:	90                   	nop
+
+000006f0 <close>:
+{
+     6f0:	55                   	push   %ebp
+     6f1:	89 e5                	mov    %esp,%ebp
+     6f3:	56                   	push   %esi
+     6f4:	53                   	push   %ebx
+     6f5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     6f8:	83 fb 0f             	cmp    $0xf,%ebx
+     6fb:	77 26                	ja     723 <close+0x33>
+     6fd:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     703:	8b 90 44 18 00 00    	mov    0x1844(%eax),%edx
+     709:	8d b0 40 18 00 00    	lea    0x1840(%eax),%esi
+     70f:	85 d2                	test   %edx,%edx
+     711:	7f 25                	jg     738 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+     713:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     719:	c7 80 40 18 00 00 00 	movl   $0x0,0x1840(%eax)
+     720:	00 00 00 
+  return _close(fd);
+     723:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     726:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     729:	5b                   	pop    %ebx
+     72a:	5e                   	pop    %esi
+     72b:	5d                   	pop    %ebp
+  return _close(fd);
+     72c:	e9 83 03 00 00       	jmp    ab4 <_close>
+     731:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     738:	83 ec 04             	sub    $0x4,%esp
+     73b:	05 48 18 00 00       	add    $0x1848,%eax
+     740:	52                   	push   %edx
+     741:	50                   	push   %eax
+     742:	53                   	push   %ebx
+     743:	e8 65 03 00 00       	call   aad <write>
+    ob[fd].n = 0;
+     748:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+     74f:	83 c4 10             	add    $0x10,%esp
+     752:	eb bf                	jmp    713 <close+0x23>
+     754:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     75b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     75f:	90                   	nop
+
+00000760 <strcpy>:
+{
+     760:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+     761:	31 c0                	xor    %eax,%eax
+{
+     763:	89 e5                	mov    %esp,%ebp
+     765:	53                   	push   %ebx
+     766:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     769:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     76c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     770:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     774:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     777:	83 c0 01             	add    $0x1,%eax
+     77a:	84 d2                	test   %dl,%dl
+     77c:	75 f2                	jne    770 <strcpy+0x10>
+}
+     77e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     781:	89 c8                	mov    %ecx,%eax
+     783:	c9                   	leave
+     784:	c3                   	ret
+     785:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     78c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000790 <strcmp>:
+{
+     790:	55                   	push   %ebp
+     791:	89 e5                	mov    %esp,%ebp
+     793:	53                   	push   %ebx
+     794:	8b 55 08             	mov    0x8(%ebp),%edx
+     797:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     79a:	0f b6 02             	movzbl (%edx),%eax
+     79d:	84 c0                	test   %al,%al
+     79f:	75 17                	jne    7b8 <strcmp+0x28>
+     7a1:	eb 3a                	jmp    7dd <strcmp+0x4d>
+     7a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7a7:	90                   	nop
+     7a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     7ac:	83 c2 01             	add    $0x1,%edx
+     7af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     7b2:	84 c0                	test   %al,%al
+     7b4:	74 1a                	je     7d0 <strcmp+0x40>
+    p++, q++;
+     7b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     7b8:	0f b6 19             	movzbl (%ecx),%ebx
+     7bb:	38 c3                	cmp    %al,%bl
+     7bd:	74 e9                	je     7a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     7bf:	29 d8                	sub    %ebx,%eax
+}
+     7c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7c4:	c9                   	leave
+     7c5:	c3                   	ret
+     7c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     7d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     7d4:	31 c0                	xor    %eax,%eax
+     7d6:	29 d8                	sub    %ebx,%eax
+}
+     7d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7db:	c9                   	leave
+     7dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     7dd:	0f b6 19             	movzbl (%ecx),%ebx
+     7e0:	31 c0                	xor    %eax,%eax
+     7e2:	eb db                	jmp    7bf <strcmp+0x2f>
+     7e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7ef:	90                   	nop
+
+000007f0 <strlen>:
+{
+     7f0:	55                   	push   %ebp
+     7f1:	89 e5                	mov    %esp,%ebp
+     7f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+     7f6:	80 3a 00             	cmpb   $0x0,(%edx)
+     7f9:	74 15                	je     810 <strlen+0x20>
+     7fb:	31 c0                	xor    %eax,%eax
+     7fd:	8d 76 00             	lea    0x0(%esi),%esi
+     800:	83 c0 01             	add    $0x1,%eax
+     803:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     807:	89 c1                	mov    %eax,%ecx
+     809:	75 f5                	jne    800 <strlen+0x10>
+}
+     80b:	89 c8                	mov    %ecx,%eax
+     80d:	5d                   	pop    %ebp
+     80e:	c3                   	ret
+     80f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     810:	31 c9                	xor    %ecx,%ecx
+}
+     812:	5d                   	pop    %ebp
+     813:	89 c8                	mov    %ecx,%eax
+     815:	c3                   	ret
+     816:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     81d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000820 <memset>:
+{
+     820:	55                   	push   %ebp
+     821:	89 e5                	mov    %esp,%ebp
+     823:	57                   	push   %edi
+     824:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     827:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     82a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     82d:	89 d7                	mov    %edx,%edi
+     82f:	fc                   	cld
+     830:	f3 aa                	rep stos %al,%es:(%edi)
+}
+     832:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     835:	89 d0                	mov    %edx,%eax
+     837:	c9                   	leave
+     838:	c3                   	ret
+     839:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000840 <strchr>:
+{
+     840:	55                   	push   %ebp
+     841:	89 e5                	mov    %esp,%ebp
+     843:	8b 45 08             	mov    0x8(%ebp),%eax
+     846:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     84a:	0f b6 10             	movzbl (%eax),%edx
+     84d:	84 d2                	test   %dl,%dl
+     84f:	75 12                	jne    863 <strchr+0x23>
+     851:	eb 1d                	jmp    870 <strchr+0x30>
+     853:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     857:	90                   	nop
+     858:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     85c:	83 c0 01             	add    $0x1,%eax
+     85f:	84 d2                	test   %dl,%dl
+     861:	74 0d                	je     870 <strchr+0x30>
+    if(*s == c)
+     863:	38 d1                	cmp    %dl,%cl
+     865:	75 f1                	jne    858 <strchr+0x18>
+}
+     867:	5d                   	pop    %ebp
+     868:	c3                   	ret
+     869:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     870:	31 c0                	xor    %eax,%eax
+}
+     872:	5d                   	pop    %ebp
+     873:	c3                   	ret
+     874:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     87b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     87f:	90                   	nop
+
+00000880 <memchr>:
+{
+     880:	55                   	push   %ebp
+     881:	89 e5                	mov    %esp,%ebp
+     883:	8b 55 10             	mov    0x10(%ebp),%edx
+     886:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     889:	85 d2                	test   %edx,%edx
+     88b:	74 1b                	je     8a8 <memchr+0x28>
+    if(*p == (char)c)
+     88d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+     891:	01 c2                	add    %eax,%edx
+     893:	eb 0a                	jmp    89f <memchr+0x1f>
+     895:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+     898:	83 c0 01             	add    $0x1,%eax
+     89b:	39 c2                	cmp    %eax,%edx
+     89d:	74 09                	je     8a8 <memchr+0x28>
+    if(*p == (char)c)
+     89f:	38 08                	cmp    %cl,(%eax)
+     8a1:	75 f5                	jne    898 <memchr+0x18>
+}
+     8a3:	5d                   	pop    %ebp
+     8a4:	c3                   	ret
+     8a5:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+     8a8:	31 c0                	xor    %eax,%eax
+}
+     8aa:	5d                   	pop    %ebp
+     8ab:	c3                   	ret
+     8ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008b0 <gets>:
+{
+     8b0:	55                   	push   %ebp
+     8b1:	89 e5                	mov    %esp,%ebp
+     8b3:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+     8b4:	31 ff                	xor    %edi,%edi
+{
+     8b6:	56                   	push   %esi
+     8b7:	be 48 18 00 00       	mov    $0x1848,%esi
+     8bc:	53                   	push   %ebx
+     8bd:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     8c0:	8b 46 fc             	mov    -0x4(%esi),%eax
+     8c3:	85 c0                	test   %eax,%eax
+     8c5:	7e 15                	jle    8dc <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     8c7:	83 ec 04             	sub    $0x4,%esp
+     8ca:	50                   	push   %eax
+     8cb:	56                   	push   %esi
+     8cc:	57                   	push   %edi
+     8cd:	e8 db 01 00 00       	call   aad <write>
+    ob[fd].n = 0;
+     8d2:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+     8d9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     8dc:	83 c7 01             	add    $0x1,%edi
+     8df:	81 c6 08 01 00 00    	add    $0x108,%esi
+     8e5:	83 ff 10             	cmp    $0x10,%edi
+     8e8:	75 d6                	jne    8c0 <gets+0x10>
+  for(i=0; i+1 < max; ){
+     8ea:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+     8ec:	8d 75 e7             	lea    -0x19(%ebp),%esi
+     8ef:	eb 2e                	jmp    91f <gets+0x6f>
+     8f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8f8:	83 ec 04             	sub    $0x4,%esp
+     8fb:	6a 01                	push   $0x1
+     8fd:	56                   	push   %esi
+     8fe:	6a 00                	push   $0x0
+     900:	e8 a1 01 00 00       	call   aa6 <read>
+    if(cc < 1)
+     905:	83 c4 10             	add    $0x10,%esp
+     908:	85 c0                	test   %eax,%eax
+     90a:	7e 1d                	jle    929 <gets+0x79>
+    buf[i++] = c;
+     90c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     910:	8b 55 08             	mov    0x8(%ebp),%edx
+     913:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     917:	3c 0a                	cmp    $0xa,%al
+     919:	74 10                	je     92b <gets+0x7b>
+     91b:	3c 0d                	cmp    $0xd,%al
+     91d:	74 0c                	je     92b <gets+0x7b>
+  for(i=0; i+1 < max; ){
+     91f:	89 df                	mov    %ebx,%edi
+     921:	83 c3 01             	add    $0x1,%ebx
+     924:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     927:	7c cf                	jl     8f8 <gets+0x48>
+     929:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     92b:	8b 45 08             	mov    0x8(%ebp),%eax
+     92e:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     932:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     935:	5b                   	pop    %ebx
+     936:	5e                   	pop    %esi
+     937:	5f                   	pop    %edi
+     938:	5d                   	pop    %ebp
+     939:	c3                   	ret
+     93a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000940 <stat>:
+{
+     940:	55                   	push   %ebp
+     941:	89 e5                	mov    %esp,%ebp
+     943:	57                   	push   %edi
+     944:	56                   	push   %esi
+     945:	53                   	push   %ebx
+     946:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+     949:	6a 00                	push   $0x0
+     94b:	ff 75 08             	push   0x8(%ebp)
+     94e:	e8 76 01 00 00       	call   ac9 <open>
+  if(fd < 0)
+     953:	83 c4 10             	add    $0x10,%esp
+     956:	85 c0                	test   %eax,%eax
+     958:	78 76                	js     9d0 <stat+0x90>
+  r = fstat(fd, st);
+     95a:	83 ec 08             	sub    $0x8,%esp
+     95d:	ff 75 0c             	push   0xc(%ebp)
+     960:	89 c3                	mov    %eax,%ebx
+     962:	50                   	push   %eax
+     963:	e8 7f 01 00 00       	call   ae7 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     968:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     96b:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     96d:	83 fb 0f             	cmp    $0xf,%ebx
+     970:	7f 40                	jg     9b2 <stat+0x72>
+     972:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     978:	8b 90 44 18 00 00    	mov    0x1844(%eax),%edx
+     97e:	8d b8 40 18 00 00    	lea    0x1840(%eax),%edi
+     984:	85 d2                	test   %edx,%edx
+     986:	7e 1a                	jle    9a2 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+     988:	83 ec 04             	sub    $0x4,%esp
+     98b:	05 48 18 00 00       	add    $0x1848,%eax
+     990:	52                   	push   %edx
+     991:	50                   	push   %eax
+     992:	53                   	push   %ebx
+     993:	e8 15 01 00 00       	call   aad <write>
+    ob[fd].n = 0;
+     998:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+     99f:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+     9a2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     9a8:	c7 80 40 18 00 00 00 	movl   $0x0,0x1840(%eax)
+     9af:	00 00 00 
+  return _close(fd);
+     9b2:	83 ec 0c             	sub    $0xc,%esp
+     9b5:	53                   	push   %ebx
+     9b6:	e8 f9 00 00 00       	call   ab4 <_close>
+     9bb:	83 c4 10             	add    $0x10,%esp
+}
+     9be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9c1:	89 f0                	mov    %esi,%eax
+     9c3:	5b                   	pop    %ebx
+     9c4:	5e                   	pop    %esi
+     9c5:	5f                   	pop    %edi
+     9c6:	5d                   	pop    %ebp
+     9c7:	c3                   	ret
+     9c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9cf:	90                   	nop
+    return -1;
+     9d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     9d5:	eb e7                	jmp    9be <stat+0x7e>
+     9d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9de:	66 90                	xchg   %ax,%ax
+
+000009e0 <atoi>:
+{
+     9e0:	55                   	push   %ebp
+     9e1:	89 e5                	mov    %esp,%ebp
+     9e3:	53                   	push   %ebx
+     9e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     9e7:	0f be 02             	movsbl (%edx),%eax
+     9ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     9ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     9f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     9f5:	77 1e                	ja     a15 <atoi+0x35>
+     9f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     a00:	83 c2 01             	add    $0x1,%edx
+     a03:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     a06:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     a0a:	0f be 02             	movsbl (%edx),%eax
+     a0d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     a10:	80 fb 09             	cmp    $0x9,%bl
+     a13:	76 eb                	jbe    a00 <atoi+0x20>
+}
+     a15:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a18:	89 c8                	mov    %ecx,%eax
+     a1a:	c9                   	leave
+     a1b:	c3                   	ret
+     a1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a20 <memmove>:
+{
+     a20:	55                   	push   %ebp
+     a21:	89 e5                	mov    %esp,%ebp
+     a23:	57                   	push   %edi
+     a24:	56                   	push   %esi
+     a25:	8b 45 10             	mov    0x10(%ebp),%eax
+     a28:	8b 55 08             	mov    0x8(%ebp),%edx
+     a2b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     a2e:	85 c0                	test   %eax,%eax
+     a30:	7e 13                	jle    a45 <memmove+0x25>
+     a32:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     a34:	89 d7                	mov    %edx,%edi
+     a36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a3d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     a40:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     a41:	39 f8                	cmp    %edi,%eax
+     a43:	75 fb                	jne    a40 <memmove+0x20>
+  return vdst;
+}
+     a45:	5e                   	pop    %esi
+     a46:	89 d0                	mov    %edx,%eax
+     a48:	5f                   	pop    %edi
+     a49:	5d                   	pop    %ebp
+     a4a:	c3                   	ret
+
+00000a4b <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+     a4b:	83 3d 18 18 00 00 00 	cmpl   $0x0,0x1818
+  jle 1f
+     a52:	7e 0a                	jle    a5e <syscallentry+0x13>
+  movl %esp, %ecx
+     a54:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+     a56:	ba 5d 0a 00 00       	mov    $0xa5d,%edx
+  sysenter
+     a5b:	0f 34                	sysenter
+2:
+  ret
+     a5d:	c3                   	ret
+1:
+  jl 3f
+     a5e:	7c 27                	jl     a87 <syscallentry+0x3c>
+  pushal
+     a60:	60                   	pusha
+  movl $1, %eax
+     a61:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     a66:	0f a2                	cpuid
+  movl $-1, sysentermode
+     a68:	c7 05 18 18 00 00 ff 	movl   $0xffffffff,0x1818
+     a6f:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     a72:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+     a78:	74 0a                	je     a84 <syscallentry+0x39>
+  movl $1, sysentermode
+     a7a:	c7 05 18 18 00 00 01 	movl   $0x1,0x1818
+     a81:	00 00 00 
+4:
+  popal
+     a84:	61                   	popa
+  jmp syscallentry
+     a85:	eb c4                	jmp    a4b <syscallentry>
+3:
+  int $T_SYSCALL
+     a87:	cd 40                	int    $0x40
+  ret
+     a89:	c3                   	ret
+
+00000a8a <_fork>:
+
+SYSCALLAS(_fork, fork)
+     a8a:	b8 01 00 00 00       	mov    $0x1,%eax
+     a8f:	eb ba                	jmp    a4b <syscallentry>
+
+00000a91 <_exit>:
+SYSCALLAS(_exit, exit)
+     a91:	b8 02 00 00 00       	mov    $0x2,%eax
+     a96:	eb b3                	jmp    a4b <syscallentry>
+
+00000a98 <wait>:
+SYSCALL(wait)
+     a98:	b8 03 00 00 00       	mov    $0x3,%eax
+     a9d:	eb ac                	jmp    a4b <syscallentry>
+
+00000a9f <pipe>:
+SYSCALL(pipe)
+     a9f:	b8 04 00 00 00       	mov    $0x4,%eax
+     aa4:	eb a5                	jmp    a4b <syscallentry>
+
+00000aa6 <read>:
+SYSCALL(read)
+     aa6:	b8 05 00 00 00       	mov    $0x5,%eax
+     aab:	eb 9e                	jmp    a4b <syscallentry>
+
+00000aad <write>:
+SYSCALL(write)
+     aad:	b8 10 00 00 00       	mov    $0x10,%eax
+     ab2:	eb 97                	jmp    a4b <syscallentry>
+
+00000ab4 <_close>:
+SYSCALLAS(_close, close)
+     ab4:	b8 15 00 00 00       	mov    $0x15,%eax
+     ab9:	eb 90                	jmp    a4b <syscallentry>
+
+00000abb <kill>:
+SYSCALL(kill)
+     abb:	b8 06 00 00 00       	mov    $0x6,%eax
+     ac0:	eb 89                	jmp    a4b <syscallentry>
+
+00000ac2 <_exec>:
+SYSCALLAS(_exec, exec)
+     ac2:	b8 07 00 00 00       	mov    $0x7,%eax
+     ac7:	eb 82                	jmp    a4b <syscallentry>
+
+00000ac9 <open>:
+SYSCALL(open)
+     ac9:	b8 0f 00 00 00       	mov    $0xf,%eax
+     ace:	e9 78 ff ff ff       	jmp    a4b <syscallentry>
+
+00000ad3 <mknod>:
+SYSCALL(mknod)
+     ad3:	b8 11 00 00 00       	mov    $0x11,%eax
+     ad8:	e9 6e ff ff ff       	jmp    a4b <syscallentry>
+
+00000add <unlink>:
+SYSCALL(unlink)
+     add:	b8 12 00 00 00       	mov    $0x12,%eax
+     ae2:	e9 64 ff ff ff       	jmp    a4b <syscallentry>
+
+00000ae7 <fstat>:
+SYSCALL(fstat)
+     ae7:	b8 08 00 00 00       	mov    $0x8,%eax
+     aec:	e9 5a ff ff ff       	jmp    a4b <syscallentry>
+
+00000af1 <link>:
+SYSCALL(link)
+     af1:	b8 13 00 00 00       	mov    $0x13,%eax
+     af6:	e9 50 ff ff ff       	jmp    a4b <syscallentry>
+
+00000afb <mkdir>:
+SYSCALL(mkdir)
+     afb:	b8 14 00 00 00       	mov    $0x14,%eax
+     b00:	e9 46 ff ff ff       	jmp    a4b <syscallentry>
+
+00000b05 <chdir>:
+SYSCALL(chdir)
+     b05:	b8 09 00 00 00       	mov    $0x9,%eax
+     b0a:	e9 3c ff ff ff       	jmp    a4b <syscallentry>
+
+00000b0f <dup>:
+SYSCALL(dup)
+     b0f:	b8 0a 00 00 00       	mov    $0xa,%eax
+     b14:	e9 32 ff ff ff       	jmp    a4b <syscallentry>
+
+00000b19 <getpid>:
+SYSCALL(getpid)
+     b19:	b8 0b 00 00 00       	mov    $0xb,%eax
+     b1e:	e9 28 ff ff ff       	jmp    a4b <syscallentry>
+
+00000b23 <sbrk>:
+SYSCALL(sbrk)
+     b23:	b8 0c 00 00 00       	mov    $0xc,%eax
+     b28:	e9 1e ff ff ff       	jmp    a4b <syscallentry>
+
+00000b2d <sleep>:
+SYSCALL(sleep)
+     b2d:	b8 0d 00 00 00       	mov    $0xd,%eax
+     b32:	e9 14 ff ff ff       	jmp    a4b <syscallentry>
+
+00000b37 <uptime>:
+SYSCALL(uptime)
+     b37:	b8 0e 00 00 00       	mov    $0xe,%eax
+     b3c:	e9 0a ff ff ff       	jmp    a4b <syscallentry>
+
+00000b41 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+     b41:	b8 16 00 00 00       	mov    $0x16,%eax
+     b46:	e9 00 ff ff ff       	jmp    a4b <syscallentry>
+
+00000b4b <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+     b4b:	b8 17 00 00 00       	mov    $0x17,%eax
+     b50:	e9 f6 fe ff ff       	jmp    a4b <syscallentry>
+
+00000b55 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+     b55:	b8 18 00 00 00       	mov    $0x18,%eax
+     b5a:	e9 ec fe ff ff       	jmp    a4b <syscallentry>
+
+00000b5f <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+     b5f:	b8 19 00 00 00       	mov    $0x19,%eax
+     b64:	e9 e2 fe ff ff       	jmp    a4b <syscallentry>
+
+00000b69 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+     b69:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     b6e:	e9 d8 fe ff ff       	jmp    a4b <syscallentry>
+
+00000b73 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+     b73:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     b78:	e9 ce fe ff ff       	jmp    a4b <syscallentry>
+
+00000b7d <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+     b7d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     b82:	e9 c4 fe ff ff       	jmp    a4b <syscallentry>
+
+00000b87 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+     b87:	b8 20 00 00 00       	mov    $0x20,%eax
+     b8c:	e9 ba fe ff ff       	jmp    a4b <syscallentry>
+
+00000b91 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+     b91:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     b96:	e9 b0 fe ff ff       	jmp    a4b <syscallentry>
+
+00000b9b <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+     b9b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     ba0:	e9 a6 fe ff ff       	jmp    a4b <syscallentry>
+
+00000ba5 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+     ba5:	b8 21 00 00 00       	mov    $0x21,%eax
+     baa:	e9 9c fe ff ff       	jmp    a4b <syscallentry>
+
+00000baf <yield>:
+SYSCALL(yield) // yield the CPU to another process
+     baf:	b8 22 00 00 00       	mov    $0x22,%eax
+     bb4:	e9 92 fe ff ff       	jmp    a4b <syscallentry>
+
+00000bb9 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+     bb9:	b8 23 00 00 00       	mov    $0x23,%eax
+     bbe:	e9 88 fe ff ff       	jmp    a4b <syscallentry>
+
+00000bc3 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+     bc3:	b8 24 00 00 00       	mov    $0x24,%eax
+     bc8:	e9 7e fe ff ff       	jmp    a4b <syscallentry>
+
+00000bcd <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+     bcd:	b8 25 00 00 00       	mov    $0x25,%eax
+     bd2:	e9 74 fe ff ff       	jmp    a4b <syscallentry>
+
+00000bd7 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+     bd7:	b8 26 00 00 00       	mov    $0x26,%eax
+     bdc:	e9 6a fe ff ff       	jmp    a4b <syscallentry>
+
+00000be1 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+     be1:	b8 27 00 00 00       	mov    $0x27,%eax
+     be6:	e9 60 fe ff ff       	jmp    a4b <syscallentry>
+
+00000beb <mmap>:
+SYSCALL(mmap) // map a file into memory
+     beb:	b8 28 00 00 00       	mov    $0x28,%eax
+     bf0:	e9 56 fe ff ff       	jmp    a4b <syscallentry>
+
+00000bf5 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+     bf5:	b8 29 00 00 00       	mov    $0x29,%eax
+     bfa:	e9 4c fe ff ff       	jmp    a4b <syscallentry>
+
+00000bff <readv>:
+SYSCALL(readv) // read into several buffers
+     bff:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     c04:	e9 42 fe ff ff       	jmp    a4b <syscallentry>
+
+00000c09 <writev>:
+SYSCALL(writev) // write from several buffers
+     c09:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     c0e:	e9 38 fe ff ff       	jmp    a4b <syscallentry>
+
+00000c13 <pread>:
+SYSCALL(pread) // read at an offset
+     c13:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     c18:	e9 2e fe ff ff       	jmp    a4b <syscallentry>
+
+00000c1d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+     c1d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     c22:	e9 24 fe ff ff       	jmp    a4b <syscallentry>
+
+00000c27 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+     c27:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     c2c:	e9 1a fe ff ff       	jmp    a4b <syscallentry>
+
+00000c31 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+     c31:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     c36:	e9 10 fe ff ff       	jmp    a4b <syscallentry>
+
+00000c3b <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+     c3b:	b8 30 00 00 00       	mov    $0x30,%eax
+     c40:	e9 06 fe ff ff       	jmp    a4b <syscallentry>
+
+00000c45 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+     c45:	b8 31 00 00 00       	mov    $0x31,%eax
+     c4a:	e9 fc fd ff ff       	jmp    a4b <syscallentry>
+
+00000c4f <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+     c4f:	b8 32 00 00 00       	mov    $0x32,%eax
+     c54:	e9 f2 fd ff ff       	jmp    a4b <syscallentry>
+
+00000c59 <profread>:
+SYSCALL(profread) // drain profiler samples
+     c59:	b8 33 00 00 00       	mov    $0x33,%eax
+     c5e:	e9 e8 fd ff ff       	jmp    a4b <syscallentry>
+
+00000c63 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+     c63:	b8 34 00 00 00       	mov    $0x34,%eax
+     c68:	e9 de fd ff ff       	jmp    a4b <syscallentry>
+
+00000c6d <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+     c6d:	b8 35 00 00 00       	mov    $0x35,%eax
+     c72:	e9 d4 fd ff ff       	jmp    a4b <syscallentry>
+
+00000c77 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+     c77:	b8 36 00 00 00       	mov    $0x36,%eax
+     c7c:	e9 ca fd ff ff       	jmp    a4b <syscallentry>
+
+00000c81 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+     c81:	b8 37 00 00 00       	mov    $0x37,%eax
+     c86:	e9 c0 fd ff ff       	jmp    a4b <syscallentry>
+     c8b:	66 90                	xchg   %ax,%ax
+     c8d:	66 90                	xchg   %ax,%ax
+     c8f:	90                   	nop
+
+00000c90 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     c90:	55                   	push   %ebp
+     c91:	89 e5                	mov    %esp,%ebp
+     c93:	57                   	push   %edi
+     c94:	56                   	push   %esi
+     c95:	53                   	push   %ebx
+     c96:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     c98:	89 d1                	mov    %edx,%ecx
+{
+     c9a:	83 ec 3c             	sub    $0x3c,%esp
+     c9d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     ca0:	85 d2                	test   %edx,%edx
+     ca2:	0f 89 80 00 00 00    	jns    d28 <printint+0x98>
+     ca8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     cac:	74 7a                	je     d28 <printint+0x98>
+    x = -xx;
+     cae:	f7 d9                	neg    %ecx
+    neg = 1;
+     cb0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     cb5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     cb8:	31 f6                	xor    %esi,%esi
+     cba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     cc0:	89 c8                	mov    %ecx,%eax
+     cc2:	31 d2                	xor    %edx,%edx
+     cc4:	89 f7                	mov    %esi,%edi
+     cc6:	f7 f3                	div    %ebx
+     cc8:	8d 76 01             	lea    0x1(%esi),%esi
+     ccb:	0f b6 92 d0 12 00 00 	movzbl 0x12d0(%edx),%edx
+     cd2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     cd6:	89 ca                	mov    %ecx,%edx
+     cd8:	89 c1                	mov    %eax,%ecx
+     cda:	39 da                	cmp    %ebx,%edx
+     cdc:	73 e2                	jae    cc0 <printint+0x30>
+  if(neg)
+     cde:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     ce1:	85 c0                	test   %eax,%eax
+     ce3:	74 07                	je     cec <printint+0x5c>
+    buf[i++] = '-';
+     ce5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     cea:	89 f7                	mov    %esi,%edi
+     cec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     cef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     cf2:	01 df                	add    %ebx,%edi
+     cf4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     cf8:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+     cfb:	83 ec 04             	sub    $0x4,%esp
+     cfe:	88 45 d7             	mov    %al,-0x29(%ebp)
+     d01:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     d04:	6a 01                	push   $0x1
+     d06:	50                   	push   %eax
+     d07:	56                   	push   %esi
+     d08:	e8 e3 f6 ff ff       	call   3f0 <bufwrite>
+  while(--i >= 0)
+     d0d:	89 f8                	mov    %edi,%eax
+     d0f:	83 c4 10             	add    $0x10,%esp
+     d12:	83 ef 01             	sub    $0x1,%edi
+     d15:	39 d8                	cmp    %ebx,%eax
+     d17:	75 df                	jne    cf8 <printint+0x68>
+}
+     d19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d1c:	5b                   	pop    %ebx
+     d1d:	5e                   	pop    %esi
+     d1e:	5f                   	pop    %edi
+     d1f:	5d                   	pop    %ebp
+     d20:	c3                   	ret
+     d21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     d28:	31 c0                	xor    %eax,%eax
+     d2a:	eb 89                	jmp    cb5 <printint+0x25>
+     d2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000d30 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     d30:	55                   	push   %ebp
+     d31:	89 e5                	mov    %esp,%ebp
+     d33:	57                   	push   %edi
+     d34:	56                   	push   %esi
+     d35:	53                   	push   %ebx
+     d36:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     d39:	8b 45 0c             	mov    0xc(%ebp),%eax
+     d3c:	0f b6 18             	movzbl (%eax),%ebx
+     d3f:	84 db                	test   %bl,%bl
+     d41:	74 6c                	je     daf <printf+0x7f>
+     d43:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+     d46:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+     d49:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     d4b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     d4e:	eb 26                	jmp    d76 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     d50:	83 f8 25             	cmp    $0x25,%eax
+     d53:	74 4b                	je     da0 <printf+0x70>
+  bufwrite(fd, &c, 1);
+     d55:	83 ec 04             	sub    $0x4,%esp
+     d58:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     d5b:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     d5e:	6a 01                	push   $0x1
+     d60:	50                   	push   %eax
+     d61:	ff 75 08             	push   0x8(%ebp)
+     d64:	e8 87 f6 ff ff       	call   3f0 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+     d69:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     d6c:	0f b6 1f             	movzbl (%edi),%ebx
+     d6f:	83 c7 01             	add    $0x1,%edi
+     d72:	84 db                	test   %bl,%bl
+     d74:	74 39                	je     daf <printf+0x7f>
+    c = fmt[i] & 0xff;
+     d76:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     d79:	85 f6                	test   %esi,%esi
+     d7b:	74 d3                	je     d50 <printf+0x20>
+      }
+    } else if(state == '%'){
+     d7d:	83 fe 25             	cmp    $0x25,%esi
+     d80:	75 ea                	jne    d6c <printf+0x3c>
+      if(c == 'd'){
+     d82:	83 f8 25             	cmp    $0x25,%eax
+     d85:	0f 84 d5 01 00 00    	je     f60 <printf+0x230>
+     d8b:	83 e8 63             	sub    $0x63,%eax
+     d8e:	83 f8 15             	cmp    $0x15,%eax
+     d91:	77 45                	ja     dd8 <printf+0xa8>
+     d93:	ff 24 85 78 12 00 00 	jmp    *0x1278(,%eax,4)
+     d9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     da0:	0f b6 1f             	movzbl (%edi),%ebx
+     da3:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+     da6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     dab:	84 db                	test   %bl,%bl
+     dad:	75 c7                	jne    d76 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+     daf:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+     db3:	74 0b                	je     dc0 <printf+0x90>
+    fflush(fd);
+}
+     db5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     db8:	5b                   	pop    %ebx
+     db9:	5e                   	pop    %esi
+     dba:	5f                   	pop    %edi
+     dbb:	5d                   	pop    %ebp
+     dbc:	c3                   	ret
+     dbd:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+     dc0:	83 ec 0c             	sub    $0xc,%esp
+     dc3:	6a 02                	push   $0x2
+     dc5:	e8 c6 f7 ff ff       	call   590 <fflush>
+     dca:	83 c4 10             	add    $0x10,%esp
+}
+     dcd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     dd0:	5b                   	pop    %ebx
+     dd1:	5e                   	pop    %esi
+     dd2:	5f                   	pop    %edi
+     dd3:	5d                   	pop    %ebp
+     dd4:	c3                   	ret
+     dd5:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+     dd8:	83 ec 04             	sub    $0x4,%esp
+     ddb:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     dde:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+     de2:	6a 01                	push   $0x1
+     de4:	52                   	push   %edx
+     de5:	89 55 c0             	mov    %edx,-0x40(%ebp)
+     de8:	ff 75 08             	push   0x8(%ebp)
+     deb:	e8 00 f6 ff ff       	call   3f0 <bufwrite>
+     df0:	83 c4 0c             	add    $0xc,%esp
+     df3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     df6:	6a 01                	push   $0x1
+     df8:	8b 55 c0             	mov    -0x40(%ebp),%edx
+     dfb:	52                   	push   %edx
+      state = 0;
+     dfc:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+     dfe:	ff 75 08             	push   0x8(%ebp)
+     e01:	e8 ea f5 ff ff       	call   3f0 <bufwrite>
+        putc(fd, c);
+     e06:	83 c4 10             	add    $0x10,%esp
+     e09:	e9 5e ff ff ff       	jmp    d6c <printf+0x3c>
+     e0e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+     e10:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     e13:	83 ec 0c             	sub    $0xc,%esp
+     e16:	b9 10 00 00 00       	mov    $0x10,%ecx
+     e1b:	8b 16                	mov    (%esi),%edx
+     e1d:	6a 00                	push   $0x0
+     e1f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+     e22:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+     e25:	e8 66 fe ff ff       	call   c90 <printint>
+        ap++;
+     e2a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     e2d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     e30:	31 f6                	xor    %esi,%esi
+     e32:	e9 35 ff ff ff       	jmp    d6c <printf+0x3c>
+     e37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e3e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     e40:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     e43:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     e45:	83 c0 04             	add    $0x4,%eax
+     e48:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+     e4b:	b8 70 12 00 00       	mov    $0x1270,%eax
+     e50:	85 db                	test   %ebx,%ebx
+     e52:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+     e55:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+     e58:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+     e5a:	53                   	push   %ebx
+     e5b:	e8 90 f9 ff ff       	call   7f0 <strlen>
+     e60:	83 c4 0c             	add    $0xc,%esp
+     e63:	50                   	push   %eax
+     e64:	53                   	push   %ebx
+     e65:	ff 75 08             	push   0x8(%ebp)
+     e68:	e8 83 f5 ff ff       	call   3f0 <bufwrite>
+     e6d:	83 c4 10             	add    $0x10,%esp
+     e70:	e9 f7 fe ff ff       	jmp    d6c <printf+0x3c>
+     e75:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+     e78:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+     e7b:	83 ec 04             	sub    $0x4,%esp
+     e7e:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+     e81:	8b 06                	mov    (%esi),%eax
+        ap++;
+     e83:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+     e86:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+     e89:	6a 01                	push   $0x1
+     e8b:	52                   	push   %edx
+     e8c:	ff 75 08             	push   0x8(%ebp)
+     e8f:	e8 5c f5 ff ff       	call   3f0 <bufwrite>
+        ap++;
+     e94:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     e97:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     e9a:	31 f6                	xor    %esi,%esi
+     e9c:	e9 cb fe ff ff       	jmp    d6c <printf+0x3c>
+     ea1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+     ea8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     eab:	83 ec 0c             	sub    $0xc,%esp
+     eae:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     eb3:	8b 16                	mov    (%esi),%edx
+     eb5:	6a 01                	push   $0x1
+     eb7:	e9 63 ff ff ff       	jmp    e1f <printf+0xef>
+     ebc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+     ec0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     ec3:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     ec6:	89 7d c0             	mov    %edi,-0x40(%ebp)
+     ec9:	89 55 bc             	mov    %edx,-0x44(%ebp)
+     ecc:	8b 18                	mov    (%eax),%ebx
+     ece:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+     ed1:	31 c0                	xor    %eax,%eax
+     ed3:	89 c7                	mov    %eax,%edi
+     ed5:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+     ed8:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+     edd:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+     edf:	f7 e1                	mul    %ecx
+     ee1:	c1 ea 03             	shr    $0x3,%edx
+     ee4:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     ee7:	89 d1                	mov    %edx,%ecx
+     ee9:	01 c0                	add    %eax,%eax
+     eeb:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     eed:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+     eef:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     ef1:	be 0a 00 00 00       	mov    $0xa,%esi
+     ef6:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+     ef8:	89 da                	mov    %ebx,%edx
+     efa:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+     efc:	89 fe                	mov    %edi,%esi
+     efe:	83 c7 01             	add    $0x1,%edi
+     f01:	8d 42 30             	lea    0x30(%edx),%eax
+     f04:	89 da                	mov    %ebx,%edx
+     f06:	8d 14 92             	lea    (%edx,%edx,4),%edx
+     f09:	01 d2                	add    %edx,%edx
+     f0b:	29 d0                	sub    %edx,%eax
+     f0d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+     f11:	89 c8                	mov    %ecx,%eax
+     f13:	09 d8                	or     %ebx,%eax
+     f15:	75 c1                	jne    ed8 <printf+0x1a8>
+     f17:	8b 55 bc             	mov    -0x44(%ebp),%edx
+     f1a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     f1d:	01 d6                	add    %edx,%esi
+     f1f:	89 f7                	mov    %esi,%edi
+     f21:	89 d6                	mov    %edx,%esi
+     f23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f27:	90                   	nop
+    putc(fd, buf[i]);
+     f28:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+     f2b:	83 ec 04             	sub    $0x4,%esp
+     f2e:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+     f31:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+     f34:	6a 01                	push   $0x1
+     f36:	50                   	push   %eax
+     f37:	53                   	push   %ebx
+     f38:	e8 b3 f4 ff ff       	call   3f0 <bufwrite>
+  while(--i >= 0)
+     f3d:	89 fa                	mov    %edi,%edx
+     f3f:	83 c4 10             	add    $0x10,%esp
+     f42:	83 ef 01             	sub    $0x1,%edi
+     f45:	39 d6                	cmp    %edx,%esi
+     f47:	75 df                	jne    f28 <printf+0x1f8>
+        ap += 2;
+     f49:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+     f4d:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+     f50:	31 f6                	xor    %esi,%esi
+     f52:	e9 15 fe ff ff       	jmp    d6c <printf+0x3c>
+     f57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f5e:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+     f60:	83 ec 04             	sub    $0x4,%esp
+     f63:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     f66:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     f69:	6a 01                	push   $0x1
+     f6b:	e9 8b fe ff ff       	jmp    dfb <printf+0xcb>
+
+00000f70 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     f70:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f71:	a1 c0 28 00 00       	mov    0x28c0,%eax
+{
+     f76:	89 e5                	mov    %esp,%ebp
+     f78:	57                   	push   %edi
+     f79:	56                   	push   %esi
+     f7a:	53                   	push   %ebx
+     f7b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     f7e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f88:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f8a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f8c:	39 ca                	cmp    %ecx,%edx
+     f8e:	73 30                	jae    fc0 <free+0x50>
+     f90:	39 c1                	cmp    %eax,%ecx
+     f92:	72 04                	jb     f98 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f94:	39 c2                	cmp    %eax,%edx
+     f96:	72 f0                	jb     f88 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     f98:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     f9b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     f9e:	39 f8                	cmp    %edi,%eax
+     fa0:	74 2e                	je     fd0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     fa2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     fa5:	8b 42 04             	mov    0x4(%edx),%eax
+     fa8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     fab:	39 f1                	cmp    %esi,%ecx
+     fad:	74 38                	je     fe7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     faf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     fb1:	5b                   	pop    %ebx
+  freep = p;
+     fb2:	89 15 c0 28 00 00    	mov    %edx,0x28c0
+}
+     fb8:	5e                   	pop    %esi
+     fb9:	5f                   	pop    %edi
+     fba:	5d                   	pop    %ebp
+     fbb:	c3                   	ret
+     fbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     fc0:	39 c1                	cmp    %eax,%ecx
+     fc2:	72 d0                	jb     f94 <free+0x24>
+     fc4:	eb c2                	jmp    f88 <free+0x18>
+     fc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fcd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+     fd0:	03 70 04             	add    0x4(%eax),%esi
+     fd3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     fd6:	8b 02                	mov    (%edx),%eax
+     fd8:	8b 00                	mov    (%eax),%eax
+     fda:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     fdd:	8b 42 04             	mov    0x4(%edx),%eax
+     fe0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     fe3:	39 f1                	cmp    %esi,%ecx
+     fe5:	75 c8                	jne    faf <free+0x3f>
+    p->s.size += bp->s.size;
+     fe7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     fea:	89 15 c0 28 00 00    	mov    %edx,0x28c0
+    p->s.size += bp->s.size;
+     ff0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     ff3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     ff6:	89 0a                	mov    %ecx,(%edx)
+}
+     ff8:	5b                   	pop    %ebx
+     ff9:	5e                   	pop    %esi
+     ffa:	5f                   	pop    %edi
+     ffb:	5d                   	pop    %ebp
+     ffc:	c3                   	ret
+     ffd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001000 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1000:	55                   	push   %ebp
+    1001:	89 e5                	mov    %esp,%ebp
+    1003:	57                   	push   %edi
+    1004:	56                   	push   %esi
+    1005:	53                   	push   %ebx
+    1006:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1009:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    100c:	8b 15 c0 28 00 00    	mov    0x28c0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1012:	8d 78 07             	lea    0x7(%eax),%edi
+    1015:	c1 ef 03             	shr    $0x3,%edi
+    1018:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    101b:	85 d2                	test   %edx,%edx
+    101d:	0f 84 8d 00 00 00    	je     10b0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1023:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1025:	8b 48 04             	mov    0x4(%eax),%ecx
+    1028:	39 f9                	cmp    %edi,%ecx
+    102a:	73 64                	jae    1090 <malloc+0x90>
+  if(nu < 4096)
+    102c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1031:	39 df                	cmp    %ebx,%edi
+    1033:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1036:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    103d:	eb 0a                	jmp    1049 <malloc+0x49>
+    103f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1040:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1042:	8b 48 04             	mov    0x4(%eax),%ecx
+    1045:	39 f9                	cmp    %edi,%ecx
+    1047:	73 47                	jae    1090 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1049:	89 c2                	mov    %eax,%edx
+    104b:	39 05 c0 28 00 00    	cmp    %eax,0x28c0
+    1051:	75 ed                	jne    1040 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1053:	83 ec 0c             	sub    $0xc,%esp
+    1056:	56                   	push   %esi
+    1057:	e8 c7 fa ff ff       	call   b23 <sbrk>
+  if(p == (char*)-1)
+    105c:	83 c4 10             	add    $0x10,%esp
+    105f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1062:	74 1c                	je     1080 <malloc+0x80>
+  hp->s.size = nu;
+    1064:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1067:	83 ec 0c             	sub    $0xc,%esp
+    106a:	83 c0 08             	add    $0x8,%eax
+    106d:	50                   	push   %eax
+    106e:	e8 fd fe ff ff       	call   f70 <free>
+  return freep;
+    1073:	8b 15 c0 28 00 00    	mov    0x28c0,%edx
+      if((p = morecore(nunits)) == 0)
+    1079:	83 c4 10             	add    $0x10,%esp
+    107c:	85 d2                	test   %edx,%edx
+    107e:	75 c0                	jne    1040 <malloc+0x40>
+        return 0;
+  }
+}
+    1080:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1083:	31 c0                	xor    %eax,%eax
+}
+    1085:	5b                   	pop    %ebx
+    1086:	5e                   	pop    %esi
+    1087:	5f                   	pop    %edi
+    1088:	5d                   	pop    %ebp
+    1089:	c3                   	ret
+    108a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1090:	39 cf                	cmp    %ecx,%edi
+    1092:	74 4c                	je     10e0 <malloc+0xe0>
+        p->s.size -= nunits;
+    1094:	29 f9                	sub    %edi,%ecx
+    1096:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1099:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    109c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    109f:	89 15 c0 28 00 00    	mov    %edx,0x28c0
+}
+    10a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    10a8:	83 c0 08             	add    $0x8,%eax
+}
+    10ab:	5b                   	pop    %ebx
+    10ac:	5e                   	pop    %esi
+    10ad:	5f                   	pop    %edi
+    10ae:	5d                   	pop    %ebp
+    10af:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    10b0:	c7 05 c0 28 00 00 c4 	movl   $0x28c4,0x28c0
+    10b7:	28 00 00 
+    base.s.size = 0;
+    10ba:	b8 c4 28 00 00       	mov    $0x28c4,%eax
+    base.s.ptr = freep = prevp = &base;
+    10bf:	c7 05 c4 28 00 00 c4 	movl   $0x28c4,0x28c4
+    10c6:	28 00 00 
+    base.s.size = 0;
+    10c9:	c7 05 c8 28 00 00 00 	movl   $0x0,0x28c8
+    10d0:	00 00 00 
+    if(p->s.size >= nunits){
+    10d3:	e9 54 ff ff ff       	jmp    102c <malloc+0x2c>
+    10d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10df:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    10e0:	8b 08                	mov    (%eax),%ecx
+    10e2:	89 0a                	mov    %ecx,(%edx)
+    10e4:	eb b9                	jmp    109f <malloc+0x9f>
+    10e6:	66 90                	xchg   %ax,%ax
+    10e8:	66 90                	xchg   %ax,%ax
+    10ea:	66 90                	xchg   %ax,%ax
+    10ec:	66 90                	xchg   %ax,%ax
+    10ee:	66 90                	xchg   %ax,%ax
+
+000010f0 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+    10f0:	55                   	push   %ebp
+    10f1:	89 e5                	mov    %esp,%ebp
+    10f3:	57                   	push   %edi
+    10f4:	56                   	push   %esi
+    10f5:	be 01 00 00 00       	mov    $0x1,%esi
+    10fa:	53                   	push   %ebx
+    10fb:	83 ec 28             	sub    $0x28,%esp
+    10fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1101:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1104:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+    1107:	68 00 98 00 00       	push   $0x9800
+    110c:	e8 ef fe ff ff       	call   1000 <malloc>
+    1111:	83 c4 10             	add    $0x10,%esp
+    1114:	89 c7                	mov    %eax,%edi
+    1116:	85 c0                	test   %eax,%eax
+    1118:	74 62                	je     117c <waitpoll+0x8c>
+    111a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+    1120:	83 ec 0c             	sub    $0xc,%esp
+    1123:	6a 01                	push   $0x1
+    1125:	e8 03 fa ff ff       	call   b2d <sleep>
+    fn();
+    112a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    112d:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+    112f:	58                   	pop    %eax
+    1130:	5a                   	pop    %edx
+    1131:	68 00 02 00 00       	push   $0x200
+    1136:	57                   	push   %edi
+    1137:	e8 eb fa ff ff       	call   c27 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+    113c:	83 c4 10             	add    $0x10,%esp
+    113f:	85 c0                	test   %eax,%eax
+    1141:	7e 2d                	jle    1170 <waitpoll+0x80>
+    1143:	6b c0 4c             	imul   $0x4c,%eax,%eax
+    1146:	89 fa                	mov    %edi,%edx
+    alive = 0;
+    1148:	31 c9                	xor    %ecx,%ecx
+    114a:	01 f8                	add    %edi,%eax
+    114c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+    1150:	3b 1a                	cmp    (%edx),%ebx
+    1152:	75 07                	jne    115b <waitpoll+0x6b>
+        alive = 1;
+    1154:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+    1158:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+    115b:	83 c2 4c             	add    $0x4c,%edx
+    115e:	39 d0                	cmp    %edx,%eax
+    1160:	75 ee                	jne    1150 <waitpoll+0x60>
+  } while(alive);
+    1162:	85 c9                	test   %ecx,%ecx
+    1164:	75 ba                	jne    1120 <waitpoll+0x30>
+    1166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    116d:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+    1170:	83 ec 0c             	sub    $0xc,%esp
+    1173:	57                   	push   %edi
+    1174:	e8 f7 fd ff ff       	call   f70 <free>
+  wait();
+    1179:	83 c4 10             	add    $0x10,%esp
+}
+    117c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    117f:	5b                   	pop    %ebx
+    1180:	5e                   	pop    %esi
+    1181:	5f                   	pop    %edi
+    1182:	5d                   	pop    %ebp
+  wait();
+    1183:	e9 10 f9 ff ff       	jmp    a98 <wait>
+    1188:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    118f:	90                   	nop
+
+00001190 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+    1190:	55                   	push   %ebp
+    1191:	89 e5                	mov    %esp,%ebp
+    1193:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+    1196:	c7 45 f0 e1 12 00 00 	movl   $0x12e1,-0x10(%ebp)
+    119d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+    11a4:	e8 87 f4 ff ff       	call   630 <fork>
+    11a9:	85 c0                	test   %eax,%eax
+    11ab:	78 09                	js     11b6 <runps+0x26>
+    return -1;
+  if(pid == 0){
+    11ad:	74 0e                	je     11bd <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+    11af:	e8 e4 f8 ff ff       	call   a98 <wait>
+}
+    11b4:	c9                   	leave
+    11b5:	c3                   	ret
+    11b6:	c9                   	leave
+    return -1;
+    11b7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11bc:	c3                   	ret
+    exec("ps", argv);
+    11bd:	50                   	push   %eax
+    11be:	50                   	push   %eax
+    11bf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    11c2:	50                   	push   %eax
+    11c3:	68 e1 12 00 00       	push   $0x12e1
+    11c8:	e8 c3 f4 ff ff       	call   690 <exec>
+    printf(2, "exec ps failed\n");
+    11cd:	5a                   	pop    %edx
+    11ce:	59                   	pop    %ecx
+    11cf:	68 e4 12 00 00       	push   $0x12e4
+    11d4:	6a 02                	push   $0x2
+    11d6:	e8 55 fb ff ff       	call   d30 <printf>
+    exit();
+    11db:	e8 a0 f4 ff ff       	call   680 <exit>
@@ -0,0 +1,118 @@
+// Have several processes stat() files spread over several
+// directories at once, and report the time taken and the
+// inode cache counters from icachestat().
+//
+// usage: statbench [nproc [rounds]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "icachestat.h"
+
+#define NDIR 8
+#define NFILE 8
+
+char path[16];
+
+// Set path to "sb<d>/f<f>", or "sb<d>" if f < 0.
+void
+mkpath(int d, int f)
+{
+  path[0] = 's';
+  path[1] = 'b';
+  path[2] = '0' + d;
+  path[3] = 0;
+  if(f >= 0){
+    path[3] = '/';
+    path[4] = 'f';
+    path[5] = '0' + f;
+    path[6] = 0;
+  }
+}
+
+void
+setup(void)
+{
+  int d, f, fd;
+
+  for(d = 0; d < NDIR; d++){
+    mkpath(d, -1);
+    mkdir(path);
+    for(f = 0; f < NFILE; f++){
+      mkpath(d, f);
+      if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+        printf(2, "statbench: cannot create %s\n", path);
+        exit();
+      }
+      close(fd);
+    }
+  }
+}
+
+void
+cleanup(void)
+{
+  int d, f;
+
+  for(d = 0; d < NDIR; d++){
+    for(f = 0; f < NFILE; f++){
+      mkpath(d, f);
+      unlink(path);
+    }
+    mkpath(d, -1);
+    unlink(path);
+  }
+}
+
+// stat() every file rounds times, starting
+// from a different directory in each process.
+void
+statter(int id, int rounds)
+{
+  struct stat st;
+  int r, d, f;
+
+  for(r = 0; r < rounds; r++){
+    for(d = 0; d < NDIR; d++){
+      for(f = 0; f < NFILE; f++){
+        mkpath((d + id) % NDIR, f);
+        if(stat(path, &st) < 0){
+          printf(2, "statbench: cannot stat %s\n", path);
+          exit();
+        }
+      }
+    }
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct icachestat a, b;
+  int nproc, rounds, i, t;
+
+  nproc = argc > 1 ? atoi(argv[1]) : 4;
+  rounds = argc > 2 ? atoi(argv[2]) : 20;
+
+  setup();
+  icachestat(&a);
+  t = uptime();
+  for(i = 0; i < nproc; i++){
+    if(fork() == 0){
+      statter(i, rounds);
+      exit();
+    }
+  }
+  for(i = 0; i < nproc; i++)
+    wait();
+  t = uptime() - t;
+  icachestat(&b);
+
+  printf(1, "%d procs x %d stats: %d ticks, %d hits, %d misses, "
+         "%d evicted, %d entries, %d idle\n",
+         nproc, rounds*NDIR*NFILE, t, b.hits - a.hits,
+         b.misses - a.misses, b.evicted - a.evicted, b.entries, b.idle);
+  cleanup();
+  exit();
+}
@@ -0,0 +1,2119 @@
+
+_streambench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char buf[4096];
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 00 20 00 00       	mov    $0x2000,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 19                	mov    (%ecx),%ebx
+  1b:	8b 71 04             	mov    0x4(%ecx),%esi
+  int fd, kb, i, n, t;
+
+  kb = fsfree() / 2 * BSIZE / 1024;
+  1e:	e8 24 0a 00 00       	call   a47 <fsfree>
+  if(kb > 8192)
+  23:	3d 03 80 00 00       	cmp    $0x8003,%eax
+  28:	7f 0a                	jg     34 <main+0x34>
+  kb = fsfree() / 2 * BSIZE / 1024;
+  2a:	b9 04 00 00 00       	mov    $0x4,%ecx
+  2f:	99                   	cltd
+  30:	f7 f9                	idiv   %ecx
+  32:	89 c7                	mov    %eax,%edi
+    kb = 8192;
+  if(argc > 1)
+  34:	83 fb 01             	cmp    $0x1,%ebx
+  37:	7e 10                	jle    49 <main+0x49>
+    kb = atoi(argv[1]);
+  39:	83 ec 0c             	sub    $0xc,%esp
+  3c:	ff 76 04             	push   0x4(%esi)
+  3f:	e8 6c 07 00 00       	call   7b0 <atoi>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	89 c7                	mov    %eax,%edi
+
+  if((fd = open(FILENAME, O_CREATE|O_RDWR)) < 0){
+  49:	83 ec 08             	sub    $0x8,%esp
+  4c:	68 02 02 00 00       	push   $0x202
+  51:	68 b0 0f 00 00       	push   $0xfb0
+  56:	e8 3e 08 00 00       	call   899 <open>
+  5b:	83 c4 10             	add    $0x10,%esp
+  5e:	89 c3                	mov    %eax,%ebx
+  60:	85 c0                	test   %eax,%eax
+  62:	78 64                	js     c8 <main+0xc8>
+    printf(2, "streambench: cannot create %s\n", FILENAME);
+    exit();
+  }
+  t = uptime();
+  64:	e8 9e 08 00 00       	call   907 <uptime>
+  for(i = 0; i < kb/4; i++){
+  69:	b9 04 00 00 00       	mov    $0x4,%ecx
+  t = uptime();
+  6e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < kb/4; i++){
+  71:	89 f8                	mov    %edi,%eax
+  73:	99                   	cltd
+  74:	f7 f9                	idiv   %ecx
+  76:	83 ff 03             	cmp    $0x3,%edi
+  79:	bf 00 00 00 00       	mov    $0x0,%edi
+  7e:	89 c6                	mov    %eax,%esi
+  80:	7f 0d                	jg     8f <main+0x8f>
+  82:	eb 5b                	jmp    df <main+0xdf>
+  84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  88:	83 c7 01             	add    $0x1,%edi
+  8b:	39 fe                	cmp    %edi,%esi
+  8d:	7e 50                	jle    df <main+0xdf>
+    ((int*)buf)[0] = i;
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+  8f:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+  92:	89 3d 80 15 00 00    	mov    %edi,0x1580
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+  98:	68 00 10 00 00       	push   $0x1000
+  9d:	68 80 15 00 00       	push   $0x1580
+  a2:	53                   	push   %ebx
+  a3:	e8 d5 07 00 00       	call   87d <write>
+  a8:	83 c4 10             	add    $0x10,%esp
+  ab:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  b0:	74 d6                	je     88 <main+0x88>
+      printf(2, "streambench: write failed at %d KB\n", 4*i);
+  b2:	c1 e7 02             	shl    $0x2,%edi
+  b5:	51                   	push   %ecx
+  b6:	57                   	push   %edi
+  b7:	68 30 10 00 00       	push   $0x1030
+  bc:	6a 02                	push   $0x2
+  be:	e8 3d 0a 00 00       	call   b00 <printf>
+      exit();
+  c3:	e8 88 03 00 00       	call   450 <exit>
+    printf(2, "streambench: cannot create %s\n", FILENAME);
+  c8:	53                   	push   %ebx
+  c9:	68 b0 0f 00 00       	push   $0xfb0
+  ce:	68 10 10 00 00       	push   $0x1010
+  d3:	6a 02                	push   $0x2
+  d5:	e8 26 0a 00 00       	call   b00 <printf>
+    exit();
+  da:	e8 71 03 00 00       	call   450 <exit>
+    }
+  }
+  close(fd);
+  df:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "write: %d KB in %d ticks\n", 4*i, uptime() - t);
+  e2:	c1 e7 02             	shl    $0x2,%edi
+  close(fd);
+  e5:	53                   	push   %ebx
+  e6:	e8 d5 03 00 00       	call   4c0 <close>
+  printf(1, "write: %d KB in %d ticks\n", 4*i, uptime() - t);
+  eb:	e8 17 08 00 00       	call   907 <uptime>
+  f0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  f3:	29 d0                	sub    %edx,%eax
+  f5:	50                   	push   %eax
+  f6:	57                   	push   %edi
+  f7:	68 c0 0f 00 00       	push   $0xfc0
+  fc:	6a 01                	push   $0x1
+  fe:	e8 fd 09 00 00       	call   b00 <printf>
+
+  if((fd = open(FILENAME, O_RDONLY)) < 0){
+ 103:	83 c4 18             	add    $0x18,%esp
+ 106:	6a 00                	push   $0x0
+ 108:	68 b0 0f 00 00       	push   $0xfb0
+ 10d:	e8 87 07 00 00       	call   899 <open>
+ 112:	83 c4 10             	add    $0x10,%esp
+ 115:	89 c6                	mov    %eax,%esi
+ 117:	85 c0                	test   %eax,%eax
+ 119:	78 70                	js     18b <main+0x18b>
+    printf(2, "streambench: cannot open %s\n", FILENAME);
+    exit();
+  }
+  t = uptime();
+ 11b:	e8 e7 07 00 00       	call   907 <uptime>
+  for(i = 0; (n = read(fd, buf, sizeof(buf))) == sizeof(buf); i++){
+ 120:	31 db                	xor    %ebx,%ebx
+  t = uptime();
+ 122:	89 c7                	mov    %eax,%edi
+  for(i = 0; (n = read(fd, buf, sizeof(buf))) == sizeof(buf); i++){
+ 124:	eb 15                	jmp    13b <main+0x13b>
+ 126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(((int*)buf)[0] != i){
+ 130:	39 1d 80 15 00 00    	cmp    %ebx,0x1580
+ 136:	75 6a                	jne    1a2 <main+0x1a2>
+  for(i = 0; (n = read(fd, buf, sizeof(buf))) == sizeof(buf); i++){
+ 138:	83 c3 01             	add    $0x1,%ebx
+ 13b:	83 ec 04             	sub    $0x4,%esp
+ 13e:	68 00 10 00 00       	push   $0x1000
+ 143:	68 80 15 00 00       	push   $0x1580
+ 148:	56                   	push   %esi
+ 149:	e8 28 07 00 00       	call   876 <read>
+ 14e:	83 c4 10             	add    $0x10,%esp
+ 151:	3d 00 10 00 00       	cmp    $0x1000,%eax
+ 156:	74 d8                	je     130 <main+0x130>
+      printf(2, "streambench: bad data at %d KB\n", 4*i);
+      exit();
+    }
+  }
+  close(fd);
+ 158:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "read: %d KB in %d ticks\n", 4*i, uptime() - t);
+ 15b:	c1 e3 02             	shl    $0x2,%ebx
+  close(fd);
+ 15e:	56                   	push   %esi
+ 15f:	e8 5c 03 00 00       	call   4c0 <close>
+  printf(1, "read: %d KB in %d ticks\n", 4*i, uptime() - t);
+ 164:	e8 9e 07 00 00       	call   907 <uptime>
+ 169:	29 f8                	sub    %edi,%eax
+ 16b:	50                   	push   %eax
+ 16c:	53                   	push   %ebx
+ 16d:	68 f7 0f 00 00       	push   $0xff7
+ 172:	6a 01                	push   $0x1
+ 174:	e8 87 09 00 00       	call   b00 <printf>
+
+  unlink(FILENAME);
+ 179:	83 c4 14             	add    $0x14,%esp
+ 17c:	68 b0 0f 00 00       	push   $0xfb0
+ 181:	e8 27 07 00 00       	call   8ad <unlink>
+  exit();
+ 186:	e8 c5 02 00 00       	call   450 <exit>
+    printf(2, "streambench: cannot open %s\n", FILENAME);
+ 18b:	52                   	push   %edx
+ 18c:	68 b0 0f 00 00       	push   $0xfb0
+ 191:	68 da 0f 00 00       	push   $0xfda
+ 196:	6a 02                	push   $0x2
+ 198:	e8 63 09 00 00       	call   b00 <printf>
+    exit();
+ 19d:	e8 ae 02 00 00       	call   450 <exit>
+      printf(2, "streambench: bad data at %d KB\n", 4*i);
+ 1a2:	c1 e3 02             	shl    $0x2,%ebx
+ 1a5:	50                   	push   %eax
+ 1a6:	53                   	push   %ebx
+ 1a7:	68 54 10 00 00       	push   $0x1054
+ 1ac:	6a 02                	push   $0x2
+ 1ae:	e8 4d 09 00 00       	call   b00 <printf>
+      exit();
+ 1b3:	e8 98 02 00 00       	call   450 <exit>
+ 1b8:	66 90                	xchg   %ax,%ax
+ 1ba:	66 90                	xchg   %ax,%ax
+ 1bc:	66 90                	xchg   %ax,%ax
+ 1be:	66 90                	xchg   %ax,%ax
+
+000001c0 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	57                   	push   %edi
+ 1c4:	56                   	push   %esi
+ 1c5:	53                   	push   %ebx
+ 1c6:	83 ec 4c             	sub    $0x4c,%esp
+ 1c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1cc:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1cf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 1d2:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+ 1d5:	83 fa 0f             	cmp    $0xf,%edx
+ 1d8:	0f 87 32 01 00 00    	ja     310 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+ 1de:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 1e4:	8b 80 80 25 00 00    	mov    0x2580(%eax),%eax
+ 1ea:	85 c0                	test   %eax,%eax
+ 1ec:	0f 84 de 00 00 00    	je     2d0 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+ 1f2:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 1f8:	8b b0 84 25 00 00    	mov    0x2584(%eax),%esi
+ 1fe:	8d 88 80 25 00 00    	lea    0x2580(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+ 204:	8d b8 88 25 00 00    	lea    0x2588(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+ 20a:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+ 20d:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+ 210:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+ 213:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+ 219:	0f 8f 01 01 00 00    	jg     320 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+ 21f:	8d 78 08             	lea    0x8(%eax),%edi
+ 222:	8d bc 3e 80 25 00 00 	lea    0x2580(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 229:	85 db                	test   %ebx,%ebx
+ 22b:	7e 3b                	jle    268 <bufwrite+0xa8>
+ 22d:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+ 230:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+ 233:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 237:	90                   	nop
+    *dst++ = *src++;
+ 238:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 239:	39 c6                	cmp    %eax,%esi
+ 23b:	75 fb                	jne    238 <bufwrite+0x78>
+  ob[fd].n += n;
+ 23d:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 243:	8b 88 84 25 00 00    	mov    0x2584(%eax),%ecx
+ 249:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 24b:	83 b8 80 25 00 00 01 	cmpl   $0x1,0x2580(%eax)
+  ob[fd].n += n;
+ 252:	89 88 84 25 00 00    	mov    %ecx,0x2584(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 258:	74 26                	je     280 <bufwrite+0xc0>
+}
+ 25a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 25d:	5b                   	pop    %ebx
+ 25e:	5e                   	pop    %esi
+ 25f:	5f                   	pop    %edi
+ 260:	5d                   	pop    %ebp
+ 261:	c3                   	ret
+ 262:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+ 268:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 26b:	83 b8 80 25 00 00 01 	cmpl   $0x1,0x2580(%eax)
+  ob[fd].n += n;
+ 272:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 275:	75 e3                	jne    25a <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+ 277:	85 db                	test   %ebx,%ebx
+ 279:	74 df                	je     25a <bufwrite+0x9a>
+ 27b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 27f:	90                   	nop
+  src = vsrc;
+ 280:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 283:	01 c3                	add    %eax,%ebx
+ 285:	eb 10                	jmp    297 <bufwrite+0xd7>
+ 287:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28e:	66 90                	xchg   %ax,%ax
+ 290:	83 c0 01             	add    $0x1,%eax
+ 293:	39 d8                	cmp    %ebx,%eax
+ 295:	74 c3                	je     25a <bufwrite+0x9a>
+    if(*p == (char)c)
+ 297:	80 38 0a             	cmpb   $0xa,(%eax)
+ 29a:	75 f4                	jne    290 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 29c:	85 c9                	test   %ecx,%ecx
+ 29e:	7e ba                	jle    25a <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 2a0:	83 ec 04             	sub    $0x4,%esp
+ 2a3:	51                   	push   %ecx
+ 2a4:	ff 75 ac             	push   -0x54(%ebp)
+ 2a7:	52                   	push   %edx
+ 2a8:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+ 2ab:	e8 cd 05 00 00       	call   87d <write>
+    ob[fd].n = 0;
+ 2b0:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+ 2b3:	83 c4 10             	add    $0x10,%esp
+ 2b6:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+ 2bc:	c7 82 84 25 00 00 00 	movl   $0x0,0x2584(%edx)
+ 2c3:	00 00 00 
+ 2c6:	eb 92                	jmp    25a <bufwrite+0x9a>
+ 2c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cf:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 2d0:	83 ec 08             	sub    $0x8,%esp
+ 2d3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 2d6:	50                   	push   %eax
+ 2d7:	52                   	push   %edx
+ 2d8:	89 55 b0             	mov    %edx,-0x50(%ebp)
+ 2db:	e8 d7 05 00 00       	call   8b7 <fstat>
+ 2e0:	83 c4 10             	add    $0x10,%esp
+ 2e3:	8b 55 b0             	mov    -0x50(%ebp),%edx
+ 2e6:	89 c1                	mov    %eax,%ecx
+ 2e8:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2ed:	85 c9                	test   %ecx,%ecx
+ 2ef:	75 0d                	jne    2fe <bufwrite+0x13e>
+ 2f1:	31 c0                	xor    %eax,%eax
+ 2f3:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 2f8:	0f 95 c0             	setne  %al
+ 2fb:	83 c0 01             	add    $0x1,%eax
+ 2fe:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+ 304:	89 81 80 25 00 00    	mov    %eax,0x2580(%ecx)
+ 30a:	e9 e3 fe ff ff       	jmp    1f2 <bufwrite+0x32>
+ 30f:	90                   	nop
+}
+ 310:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 313:	5b                   	pop    %ebx
+ 314:	5e                   	pop    %esi
+ 315:	5f                   	pop    %edi
+ 316:	5d                   	pop    %ebp
+    write(fd, p, n);
+ 317:	e9 61 05 00 00       	jmp    87d <write>
+ 31c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+ 320:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+ 323:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+ 326:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+ 329:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+ 32c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+ 32f:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+ 332:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+ 335:	6a 02                	push   $0x2
+ 337:	50                   	push   %eax
+ 338:	52                   	push   %edx
+ 339:	e8 9b 06 00 00       	call   9d9 <writev>
+    ob[fd].n = 0;
+ 33e:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+ 341:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+ 344:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ 34b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 34e:	5b                   	pop    %ebx
+ 34f:	5e                   	pop    %esi
+ 350:	5f                   	pop    %edi
+ 351:	5d                   	pop    %ebp
+ 352:	c3                   	ret
+ 353:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000360 <fflush>:
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	53                   	push   %ebx
+ 364:	83 ec 04             	sub    $0x4,%esp
+ 367:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 36a:	83 f8 0f             	cmp    $0xf,%eax
+ 36d:	77 16                	ja     385 <fflush+0x25>
+ 36f:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+ 375:	8b 8a 84 25 00 00    	mov    0x2584(%edx),%ecx
+ 37b:	8d 9a 80 25 00 00    	lea    0x2580(%edx),%ebx
+ 381:	85 c9                	test   %ecx,%ecx
+ 383:	7f 0b                	jg     390 <fflush+0x30>
+}
+ 385:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 388:	c9                   	leave
+ 389:	c3                   	ret
+ 38a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 390:	83 ec 04             	sub    $0x4,%esp
+ 393:	81 c2 88 25 00 00    	add    $0x2588,%edx
+ 399:	51                   	push   %ecx
+ 39a:	52                   	push   %edx
+ 39b:	50                   	push   %eax
+ 39c:	e8 dc 04 00 00       	call   87d <write>
+    ob[fd].n = 0;
+ 3a1:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+ 3a8:	83 c4 10             	add    $0x10,%esp
+}
+ 3ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3ae:	c9                   	leave
+ 3af:	c3                   	ret
+
+000003b0 <fflushall>:
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 3b4:	31 f6                	xor    %esi,%esi
+{
+ 3b6:	53                   	push   %ebx
+ 3b7:	bb 88 25 00 00       	mov    $0x2588,%ebx
+ 3bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 3c0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 3c3:	85 c0                	test   %eax,%eax
+ 3c5:	7e 15                	jle    3dc <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 3c7:	83 ec 04             	sub    $0x4,%esp
+ 3ca:	50                   	push   %eax
+ 3cb:	53                   	push   %ebx
+ 3cc:	56                   	push   %esi
+ 3cd:	e8 ab 04 00 00       	call   87d <write>
+    ob[fd].n = 0;
+ 3d2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 3d9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 3dc:	83 c6 01             	add    $0x1,%esi
+ 3df:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 3e5:	83 fe 10             	cmp    $0x10,%esi
+ 3e8:	75 d6                	jne    3c0 <fflushall+0x10>
+}
+ 3ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3ed:	5b                   	pop    %ebx
+ 3ee:	5e                   	pop    %esi
+ 3ef:	5d                   	pop    %ebp
+ 3f0:	c3                   	ret
+ 3f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ff:	90                   	nop
+
+00000400 <fork>:
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 404:	31 f6                	xor    %esi,%esi
+{
+ 406:	53                   	push   %ebx
+ 407:	bb 88 25 00 00       	mov    $0x2588,%ebx
+ 40c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 410:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 413:	85 c0                	test   %eax,%eax
+ 415:	7e 15                	jle    42c <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 417:	83 ec 04             	sub    $0x4,%esp
+ 41a:	50                   	push   %eax
+ 41b:	53                   	push   %ebx
+ 41c:	56                   	push   %esi
+ 41d:	e8 5b 04 00 00       	call   87d <write>
+    ob[fd].n = 0;
+ 422:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 429:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 42c:	83 c6 01             	add    $0x1,%esi
+ 42f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 435:	83 fe 10             	cmp    $0x10,%esi
+ 438:	75 d6                	jne    410 <fork+0x10>
+}
+ 43a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 43d:	5b                   	pop    %ebx
+ 43e:	5e                   	pop    %esi
+ 43f:	5d                   	pop    %ebp
+  return _fork();
+ 440:	e9 15 04 00 00       	jmp    85a <_fork>
+ 445:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <exit>:
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+ 456:	e8 55 ff ff ff       	call   3b0 <fflushall>
+  _exit();
+ 45b:	e8 01 04 00 00       	call   861 <_exit>
+
+00000460 <exec>:
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 465:	31 f6                	xor    %esi,%esi
+{
+ 467:	53                   	push   %ebx
+ 468:	bb 88 25 00 00       	mov    $0x2588,%ebx
+ 46d:	83 ec 1c             	sub    $0x1c,%esp
+ 470:	8b 45 08             	mov    0x8(%ebp),%eax
+ 473:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 476:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 480:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 483:	85 c0                	test   %eax,%eax
+ 485:	7e 15                	jle    49c <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 487:	83 ec 04             	sub    $0x4,%esp
+ 48a:	50                   	push   %eax
+ 48b:	53                   	push   %ebx
+ 48c:	56                   	push   %esi
+ 48d:	e8 eb 03 00 00       	call   87d <write>
+    ob[fd].n = 0;
+ 492:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 499:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 49c:	83 c6 01             	add    $0x1,%esi
+ 49f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 4a5:	83 fe 10             	cmp    $0x10,%esi
+ 4a8:	75 d6                	jne    480 <exec+0x20>
+  return _exec(path, argv);
+ 4aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 4ad:	89 7d 0c             	mov    %edi,0xc(%ebp)
+ 4b0:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ 4b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4b6:	5b                   	pop    %ebx
+ 4b7:	5e                   	pop    %esi
+ 4b8:	5f                   	pop    %edi
+ 4b9:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 4ba:	e9 d3 03 00 00       	jmp    892 <_exec>
+ 4bf:	90                   	nop
+
+000004c0 <close>:
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	56                   	push   %esi
+ 4c4:	53                   	push   %ebx
+ 4c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 4c8:	83 fb 0f             	cmp    $0xf,%ebx
+ 4cb:	77 26                	ja     4f3 <close+0x33>
+ 4cd:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 4d3:	8b 90 84 25 00 00    	mov    0x2584(%eax),%edx
+ 4d9:	8d b0 80 25 00 00    	lea    0x2580(%eax),%esi
+ 4df:	85 d2                	test   %edx,%edx
+ 4e1:	7f 25                	jg     508 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+ 4e3:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 4e9:	c7 80 80 25 00 00 00 	movl   $0x0,0x2580(%eax)
+ 4f0:	00 00 00 
+  return _close(fd);
+ 4f3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 4f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4f9:	5b                   	pop    %ebx
+ 4fa:	5e                   	pop    %esi
+ 4fb:	5d                   	pop    %ebp
+  return _close(fd);
+ 4fc:	e9 83 03 00 00       	jmp    884 <_close>
+ 501:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 508:	83 ec 04             	sub    $0x4,%esp
+ 50b:	05 88 25 00 00       	add    $0x2588,%eax
+ 510:	52                   	push   %edx
+ 511:	50                   	push   %eax
+ 512:	53                   	push   %ebx
+ 513:	e8 65 03 00 00       	call   87d <write>
+    ob[fd].n = 0;
+ 518:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+ 51f:	83 c4 10             	add    $0x10,%esp
+ 522:	eb bf                	jmp    4e3 <close+0x23>
+ 524:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 52f:	90                   	nop
+
+00000530 <strcpy>:
+{
+ 530:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+ 531:	31 c0                	xor    %eax,%eax
+{
+ 533:	89 e5                	mov    %esp,%ebp
+ 535:	53                   	push   %ebx
+ 536:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 539:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 53c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 540:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 544:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 547:	83 c0 01             	add    $0x1,%eax
+ 54a:	84 d2                	test   %dl,%dl
+ 54c:	75 f2                	jne    540 <strcpy+0x10>
+}
+ 54e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 551:	89 c8                	mov    %ecx,%eax
+ 553:	c9                   	leave
+ 554:	c3                   	ret
+ 555:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000560 <strcmp>:
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	53                   	push   %ebx
+ 564:	8b 55 08             	mov    0x8(%ebp),%edx
+ 567:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 56a:	0f b6 02             	movzbl (%edx),%eax
+ 56d:	84 c0                	test   %al,%al
+ 56f:	75 17                	jne    588 <strcmp+0x28>
+ 571:	eb 3a                	jmp    5ad <strcmp+0x4d>
+ 573:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 577:	90                   	nop
+ 578:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 57c:	83 c2 01             	add    $0x1,%edx
+ 57f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 582:	84 c0                	test   %al,%al
+ 584:	74 1a                	je     5a0 <strcmp+0x40>
+    p++, q++;
+ 586:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 588:	0f b6 19             	movzbl (%ecx),%ebx
+ 58b:	38 c3                	cmp    %al,%bl
+ 58d:	74 e9                	je     578 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 58f:	29 d8                	sub    %ebx,%eax
+}
+ 591:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 594:	c9                   	leave
+ 595:	c3                   	ret
+ 596:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 5a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 5a4:	31 c0                	xor    %eax,%eax
+ 5a6:	29 d8                	sub    %ebx,%eax
+}
+ 5a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5ab:	c9                   	leave
+ 5ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 5ad:	0f b6 19             	movzbl (%ecx),%ebx
+ 5b0:	31 c0                	xor    %eax,%eax
+ 5b2:	eb db                	jmp    58f <strcmp+0x2f>
+ 5b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5bf:	90                   	nop
+
+000005c0 <strlen>:
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+ 5c6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 5c9:	74 15                	je     5e0 <strlen+0x20>
+ 5cb:	31 c0                	xor    %eax,%eax
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+ 5d0:	83 c0 01             	add    $0x1,%eax
+ 5d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 5d7:	89 c1                	mov    %eax,%ecx
+ 5d9:	75 f5                	jne    5d0 <strlen+0x10>
+}
+ 5db:	89 c8                	mov    %ecx,%eax
+ 5dd:	5d                   	pop    %ebp
+ 5de:	c3                   	ret
+ 5df:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 5e0:	31 c9                	xor    %ecx,%ecx
+}
+ 5e2:	5d                   	pop    %ebp
+ 5e3:	89 c8                	mov    %ecx,%eax
+ 5e5:	c3                   	ret
+ 5e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005f0 <memset>:
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	57                   	push   %edi
+ 5f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 5f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5fd:	89 d7                	mov    %edx,%edi
+ 5ff:	fc                   	cld
+ 600:	f3 aa                	rep stos %al,%es:(%edi)
+}
+ 602:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 605:	89 d0                	mov    %edx,%eax
+ 607:	c9                   	leave
+ 608:	c3                   	ret
+ 609:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000610 <strchr>:
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	8b 45 08             	mov    0x8(%ebp),%eax
+ 616:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 61a:	0f b6 10             	movzbl (%eax),%edx
+ 61d:	84 d2                	test   %dl,%dl
+ 61f:	75 12                	jne    633 <strchr+0x23>
+ 621:	eb 1d                	jmp    640 <strchr+0x30>
+ 623:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 627:	90                   	nop
+ 628:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 62c:	83 c0 01             	add    $0x1,%eax
+ 62f:	84 d2                	test   %dl,%dl
+ 631:	74 0d                	je     640 <strchr+0x30>
+    if(*s == c)
+ 633:	38 d1                	cmp    %dl,%cl
+ 635:	75 f1                	jne    628 <strchr+0x18>
+}
+ 637:	5d                   	pop    %ebp
+ 638:	c3                   	ret
+ 639:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 640:	31 c0                	xor    %eax,%eax
+}
+ 642:	5d                   	pop    %ebp
+ 643:	c3                   	ret
+ 644:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 64b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 64f:	90                   	nop
+
+00000650 <memchr>:
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	8b 55 10             	mov    0x10(%ebp),%edx
+ 656:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 659:	85 d2                	test   %edx,%edx
+ 65b:	74 1b                	je     678 <memchr+0x28>
+    if(*p == (char)c)
+ 65d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+ 661:	01 c2                	add    %eax,%edx
+ 663:	eb 0a                	jmp    66f <memchr+0x1f>
+ 665:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+ 668:	83 c0 01             	add    $0x1,%eax
+ 66b:	39 c2                	cmp    %eax,%edx
+ 66d:	74 09                	je     678 <memchr+0x28>
+    if(*p == (char)c)
+ 66f:	38 08                	cmp    %cl,(%eax)
+ 671:	75 f5                	jne    668 <memchr+0x18>
+}
+ 673:	5d                   	pop    %ebp
+ 674:	c3                   	ret
+ 675:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+ 678:	31 c0                	xor    %eax,%eax
+}
+ 67a:	5d                   	pop    %ebp
+ 67b:	c3                   	ret
+ 67c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000680 <gets>:
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+ 683:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+ 684:	31 ff                	xor    %edi,%edi
+{
+ 686:	56                   	push   %esi
+ 687:	be 88 25 00 00       	mov    $0x2588,%esi
+ 68c:	53                   	push   %ebx
+ 68d:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 690:	8b 46 fc             	mov    -0x4(%esi),%eax
+ 693:	85 c0                	test   %eax,%eax
+ 695:	7e 15                	jle    6ac <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 697:	83 ec 04             	sub    $0x4,%esp
+ 69a:	50                   	push   %eax
+ 69b:	56                   	push   %esi
+ 69c:	57                   	push   %edi
+ 69d:	e8 db 01 00 00       	call   87d <write>
+    ob[fd].n = 0;
+ 6a2:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+ 6a9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 6ac:	83 c7 01             	add    $0x1,%edi
+ 6af:	81 c6 08 01 00 00    	add    $0x108,%esi
+ 6b5:	83 ff 10             	cmp    $0x10,%edi
+ 6b8:	75 d6                	jne    690 <gets+0x10>
+  for(i=0; i+1 < max; ){
+ 6ba:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+ 6bc:	8d 75 e7             	lea    -0x19(%ebp),%esi
+ 6bf:	eb 2e                	jmp    6ef <gets+0x6f>
+ 6c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6c8:	83 ec 04             	sub    $0x4,%esp
+ 6cb:	6a 01                	push   $0x1
+ 6cd:	56                   	push   %esi
+ 6ce:	6a 00                	push   $0x0
+ 6d0:	e8 a1 01 00 00       	call   876 <read>
+    if(cc < 1)
+ 6d5:	83 c4 10             	add    $0x10,%esp
+ 6d8:	85 c0                	test   %eax,%eax
+ 6da:	7e 1d                	jle    6f9 <gets+0x79>
+    buf[i++] = c;
+ 6dc:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 6e0:	8b 55 08             	mov    0x8(%ebp),%edx
+ 6e3:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 6e7:	3c 0a                	cmp    $0xa,%al
+ 6e9:	74 10                	je     6fb <gets+0x7b>
+ 6eb:	3c 0d                	cmp    $0xd,%al
+ 6ed:	74 0c                	je     6fb <gets+0x7b>
+  for(i=0; i+1 < max; ){
+ 6ef:	89 df                	mov    %ebx,%edi
+ 6f1:	83 c3 01             	add    $0x1,%ebx
+ 6f4:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 6f7:	7c cf                	jl     6c8 <gets+0x48>
+ 6f9:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 6fb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6fe:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 702:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 705:	5b                   	pop    %ebx
+ 706:	5e                   	pop    %esi
+ 707:	5f                   	pop    %edi
+ 708:	5d                   	pop    %ebp
+ 709:	c3                   	ret
+ 70a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000710 <stat>:
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	57                   	push   %edi
+ 714:	56                   	push   %esi
+ 715:	53                   	push   %ebx
+ 716:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+ 719:	6a 00                	push   $0x0
+ 71b:	ff 75 08             	push   0x8(%ebp)
+ 71e:	e8 76 01 00 00       	call   899 <open>
+  if(fd < 0)
+ 723:	83 c4 10             	add    $0x10,%esp
+ 726:	85 c0                	test   %eax,%eax
+ 728:	78 76                	js     7a0 <stat+0x90>
+  r = fstat(fd, st);
+ 72a:	83 ec 08             	sub    $0x8,%esp
+ 72d:	ff 75 0c             	push   0xc(%ebp)
+ 730:	89 c3                	mov    %eax,%ebx
+ 732:	50                   	push   %eax
+ 733:	e8 7f 01 00 00       	call   8b7 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 738:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 73b:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 73d:	83 fb 0f             	cmp    $0xf,%ebx
+ 740:	7f 40                	jg     782 <stat+0x72>
+ 742:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 748:	8b 90 84 25 00 00    	mov    0x2584(%eax),%edx
+ 74e:	8d b8 80 25 00 00    	lea    0x2580(%eax),%edi
+ 754:	85 d2                	test   %edx,%edx
+ 756:	7e 1a                	jle    772 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 758:	83 ec 04             	sub    $0x4,%esp
+ 75b:	05 88 25 00 00       	add    $0x2588,%eax
+ 760:	52                   	push   %edx
+ 761:	50                   	push   %eax
+ 762:	53                   	push   %ebx
+ 763:	e8 15 01 00 00       	call   87d <write>
+    ob[fd].n = 0;
+ 768:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+ 76f:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+ 772:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 778:	c7 80 80 25 00 00 00 	movl   $0x0,0x2580(%eax)
+ 77f:	00 00 00 
+  return _close(fd);
+ 782:	83 ec 0c             	sub    $0xc,%esp
+ 785:	53                   	push   %ebx
+ 786:	e8 f9 00 00 00       	call   884 <_close>
+ 78b:	83 c4 10             	add    $0x10,%esp
+}
+ 78e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 791:	89 f0                	mov    %esi,%eax
+ 793:	5b                   	pop    %ebx
+ 794:	5e                   	pop    %esi
+ 795:	5f                   	pop    %edi
+ 796:	5d                   	pop    %ebp
+ 797:	c3                   	ret
+ 798:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79f:	90                   	nop
+    return -1;
+ 7a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 7a5:	eb e7                	jmp    78e <stat+0x7e>
+ 7a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ae:	66 90                	xchg   %ax,%ax
+
+000007b0 <atoi>:
+{
+ 7b0:	55                   	push   %ebp
+ 7b1:	89 e5                	mov    %esp,%ebp
+ 7b3:	53                   	push   %ebx
+ 7b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 7b7:	0f be 02             	movsbl (%edx),%eax
+ 7ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 7bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 7c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 7c5:	77 1e                	ja     7e5 <atoi+0x35>
+ 7c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 7d0:	83 c2 01             	add    $0x1,%edx
+ 7d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 7d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 7da:	0f be 02             	movsbl (%edx),%eax
+ 7dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 7e0:	80 fb 09             	cmp    $0x9,%bl
+ 7e3:	76 eb                	jbe    7d0 <atoi+0x20>
+}
+ 7e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 7e8:	89 c8                	mov    %ecx,%eax
+ 7ea:	c9                   	leave
+ 7eb:	c3                   	ret
+ 7ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007f0 <memmove>:
+{
+ 7f0:	55                   	push   %ebp
+ 7f1:	89 e5                	mov    %esp,%ebp
+ 7f3:	57                   	push   %edi
+ 7f4:	56                   	push   %esi
+ 7f5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 7f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 7fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 7fe:	85 c0                	test   %eax,%eax
+ 800:	7e 13                	jle    815 <memmove+0x25>
+ 802:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 804:	89 d7                	mov    %edx,%edi
+ 806:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 80d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 810:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 811:	39 f8                	cmp    %edi,%eax
+ 813:	75 fb                	jne    810 <memmove+0x20>
+  return vdst;
+}
+ 815:	5e                   	pop    %esi
+ 816:	89 d0                	mov    %edx,%eax
+ 818:	5f                   	pop    %edi
+ 819:	5d                   	pop    %ebp
+ 81a:	c3                   	ret
+
+0000081b <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+ 81b:	83 3d 68 15 00 00 00 	cmpl   $0x0,0x1568
+  jle 1f
+ 822:	7e 0a                	jle    82e <syscallentry+0x13>
+  movl %esp, %ecx
+ 824:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 826:	ba 2d 08 00 00       	mov    $0x82d,%edx
+  sysenter
+ 82b:	0f 34                	sysenter
+2:
+  ret
+ 82d:	c3                   	ret
+1:
+  jl 3f
+ 82e:	7c 27                	jl     857 <syscallentry+0x3c>
+  pushal
+ 830:	60                   	pusha
+  movl $1, %eax
+ 831:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 836:	0f a2                	cpuid
+  movl $-1, sysentermode
+ 838:	c7 05 68 15 00 00 ff 	movl   $0xffffffff,0x1568
+ 83f:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 842:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+ 848:	74 0a                	je     854 <syscallentry+0x39>
+  movl $1, sysentermode
+ 84a:	c7 05 68 15 00 00 01 	movl   $0x1,0x1568
+ 851:	00 00 00 
+4:
+  popal
+ 854:	61                   	popa
+  jmp syscallentry
+ 855:	eb c4                	jmp    81b <syscallentry>
+3:
+  int $T_SYSCALL
+ 857:	cd 40                	int    $0x40
+  ret
+ 859:	c3                   	ret
+
+0000085a <_fork>:
+
+SYSCALLAS(_fork, fork)
+ 85a:	b8 01 00 00 00       	mov    $0x1,%eax
+ 85f:	eb ba                	jmp    81b <syscallentry>
+
+00000861 <_exit>:
+SYSCALLAS(_exit, exit)
+ 861:	b8 02 00 00 00       	mov    $0x2,%eax
+ 866:	eb b3                	jmp    81b <syscallentry>
+
+00000868 <wait>:
+SYSCALL(wait)
+ 868:	b8 03 00 00 00       	mov    $0x3,%eax
+ 86d:	eb ac                	jmp    81b <syscallentry>
+
+0000086f <pipe>:
+SYSCALL(pipe)
+ 86f:	b8 04 00 00 00       	mov    $0x4,%eax
+ 874:	eb a5                	jmp    81b <syscallentry>
+
+00000876 <read>:
+SYSCALL(read)
+ 876:	b8 05 00 00 00       	mov    $0x5,%eax
+ 87b:	eb 9e                	jmp    81b <syscallentry>
+
+0000087d <write>:
+SYSCALL(write)
+ 87d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 882:	eb 97                	jmp    81b <syscallentry>
+
+00000884 <_close>:
+SYSCALLAS(_close, close)
+ 884:	b8 15 00 00 00       	mov    $0x15,%eax
+ 889:	eb 90                	jmp    81b <syscallentry>
+
+0000088b <kill>:
+SYSCALL(kill)
+ 88b:	b8 06 00 00 00       	mov    $0x6,%eax
+ 890:	eb 89                	jmp    81b <syscallentry>
+
+00000892 <_exec>:
+SYSCALLAS(_exec, exec)
+ 892:	b8 07 00 00 00       	mov    $0x7,%eax
+ 897:	eb 82                	jmp    81b <syscallentry>
+
+00000899 <open>:
+SYSCALL(open)
+ 899:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 89e:	e9 78 ff ff ff       	jmp    81b <syscallentry>
+
+000008a3 <mknod>:
+SYSCALL(mknod)
+ 8a3:	b8 11 00 00 00       	mov    $0x11,%eax
+ 8a8:	e9 6e ff ff ff       	jmp    81b <syscallentry>
+
+000008ad <unlink>:
+SYSCALL(unlink)
+ 8ad:	b8 12 00 00 00       	mov    $0x12,%eax
+ 8b2:	e9 64 ff ff ff       	jmp    81b <syscallentry>
+
+000008b7 <fstat>:
+SYSCALL(fstat)
+ 8b7:	b8 08 00 00 00       	mov    $0x8,%eax
+ 8bc:	e9 5a ff ff ff       	jmp    81b <syscallentry>
+
+000008c1 <link>:
+SYSCALL(link)
+ 8c1:	b8 13 00 00 00       	mov    $0x13,%eax
+ 8c6:	e9 50 ff ff ff       	jmp    81b <syscallentry>
+
+000008cb <mkdir>:
+SYSCALL(mkdir)
+ 8cb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 8d0:	e9 46 ff ff ff       	jmp    81b <syscallentry>
+
+000008d5 <chdir>:
+SYSCALL(chdir)
+ 8d5:	b8 09 00 00 00       	mov    $0x9,%eax
+ 8da:	e9 3c ff ff ff       	jmp    81b <syscallentry>
+
+000008df <dup>:
+SYSCALL(dup)
+ 8df:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 8e4:	e9 32 ff ff ff       	jmp    81b <syscallentry>
+
+000008e9 <getpid>:
+SYSCALL(getpid)
+ 8e9:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 8ee:	e9 28 ff ff ff       	jmp    81b <syscallentry>
+
+000008f3 <sbrk>:
+SYSCALL(sbrk)
+ 8f3:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 8f8:	e9 1e ff ff ff       	jmp    81b <syscallentry>
+
+000008fd <sleep>:
+SYSCALL(sleep)
+ 8fd:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 902:	e9 14 ff ff ff       	jmp    81b <syscallentry>
+
+00000907 <uptime>:
+SYSCALL(uptime)
+ 907:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 90c:	e9 0a ff ff ff       	jmp    81b <syscallentry>
+
+00000911 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+ 911:	b8 16 00 00 00       	mov    $0x16,%eax
+ 916:	e9 00 ff ff ff       	jmp    81b <syscallentry>
+
+0000091b <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+ 91b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 920:	e9 f6 fe ff ff       	jmp    81b <syscallentry>
+
+00000925 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+ 925:	b8 18 00 00 00       	mov    $0x18,%eax
+ 92a:	e9 ec fe ff ff       	jmp    81b <syscallentry>
+
+0000092f <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+ 92f:	b8 19 00 00 00       	mov    $0x19,%eax
+ 934:	e9 e2 fe ff ff       	jmp    81b <syscallentry>
+
+00000939 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+ 939:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 93e:	e9 d8 fe ff ff       	jmp    81b <syscallentry>
+
+00000943 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+ 943:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 948:	e9 ce fe ff ff       	jmp    81b <syscallentry>
+
+0000094d <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+ 94d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 952:	e9 c4 fe ff ff       	jmp    81b <syscallentry>
+
+00000957 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+ 957:	b8 20 00 00 00       	mov    $0x20,%eax
+ 95c:	e9 ba fe ff ff       	jmp    81b <syscallentry>
+
+00000961 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+ 961:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 966:	e9 b0 fe ff ff       	jmp    81b <syscallentry>
+
+0000096b <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+ 96b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 970:	e9 a6 fe ff ff       	jmp    81b <syscallentry>
+
+00000975 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+ 975:	b8 21 00 00 00       	mov    $0x21,%eax
+ 97a:	e9 9c fe ff ff       	jmp    81b <syscallentry>
+
+0000097f <yield>:
+SYSCALL(yield) // yield the CPU to another process
+ 97f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 984:	e9 92 fe ff ff       	jmp    81b <syscallentry>
+
+00000989 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+ 989:	b8 23 00 00 00       	mov    $0x23,%eax
+ 98e:	e9 88 fe ff ff       	jmp    81b <syscallentry>
+
+00000993 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+ 993:	b8 24 00 00 00       	mov    $0x24,%eax
+ 998:	e9 7e fe ff ff       	jmp    81b <syscallentry>
+
+0000099d <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+ 99d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 9a2:	e9 74 fe ff ff       	jmp    81b <syscallentry>
+
+000009a7 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+ 9a7:	b8 26 00 00 00       	mov    $0x26,%eax
+ 9ac:	e9 6a fe ff ff       	jmp    81b <syscallentry>
+
+000009b1 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+ 9b1:	b8 27 00 00 00       	mov    $0x27,%eax
+ 9b6:	e9 60 fe ff ff       	jmp    81b <syscallentry>
+
+000009bb <mmap>:
+SYSCALL(mmap) // map a file into memory
+ 9bb:	b8 28 00 00 00       	mov    $0x28,%eax
+ 9c0:	e9 56 fe ff ff       	jmp    81b <syscallentry>
+
+000009c5 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+ 9c5:	b8 29 00 00 00       	mov    $0x29,%eax
+ 9ca:	e9 4c fe ff ff       	jmp    81b <syscallentry>
+
+000009cf <readv>:
+SYSCALL(readv) // read into several buffers
+ 9cf:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 9d4:	e9 42 fe ff ff       	jmp    81b <syscallentry>
+
+000009d9 <writev>:
+SYSCALL(writev) // write from several buffers
+ 9d9:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 9de:	e9 38 fe ff ff       	jmp    81b <syscallentry>
+
+000009e3 <pread>:
+SYSCALL(pread) // read at an offset
+ 9e3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 9e8:	e9 2e fe ff ff       	jmp    81b <syscallentry>
+
+000009ed <pwrite>:
+SYSCALL(pwrite) // write at an offset
+ 9ed:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 9f2:	e9 24 fe ff ff       	jmp    81b <syscallentry>
+
+000009f7 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+ 9f7:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 9fc:	e9 1a fe ff ff       	jmp    81b <syscallentry>
+
+00000a01 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+ a01:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ a06:	e9 10 fe ff ff       	jmp    81b <syscallentry>
+
+00000a0b <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+ a0b:	b8 30 00 00 00       	mov    $0x30,%eax
+ a10:	e9 06 fe ff ff       	jmp    81b <syscallentry>
+
+00000a15 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+ a15:	b8 31 00 00 00       	mov    $0x31,%eax
+ a1a:	e9 fc fd ff ff       	jmp    81b <syscallentry>
+
+00000a1f <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+ a1f:	b8 32 00 00 00       	mov    $0x32,%eax
+ a24:	e9 f2 fd ff ff       	jmp    81b <syscallentry>
+
+00000a29 <profread>:
+SYSCALL(profread) // drain profiler samples
+ a29:	b8 33 00 00 00       	mov    $0x33,%eax
+ a2e:	e9 e8 fd ff ff       	jmp    81b <syscallentry>
+
+00000a33 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+ a33:	b8 34 00 00 00       	mov    $0x34,%eax
+ a38:	e9 de fd ff ff       	jmp    81b <syscallentry>
+
+00000a3d <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+ a3d:	b8 35 00 00 00       	mov    $0x35,%eax
+ a42:	e9 d4 fd ff ff       	jmp    81b <syscallentry>
+
+00000a47 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+ a47:	b8 36 00 00 00       	mov    $0x36,%eax
+ a4c:	e9 ca fd ff ff       	jmp    81b <syscallentry>
+
+00000a51 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+ a51:	b8 37 00 00 00       	mov    $0x37,%eax
+ a56:	e9 c0 fd ff ff       	jmp    81b <syscallentry>
+ a5b:	66 90                	xchg   %ax,%ax
+ a5d:	66 90                	xchg   %ax,%ax
+ a5f:	90                   	nop
+
+00000a60 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a60:	55                   	push   %ebp
+ a61:	89 e5                	mov    %esp,%ebp
+ a63:	57                   	push   %edi
+ a64:	56                   	push   %esi
+ a65:	53                   	push   %ebx
+ a66:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ a68:	89 d1                	mov    %edx,%ecx
+{
+ a6a:	83 ec 3c             	sub    $0x3c,%esp
+ a6d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ a70:	85 d2                	test   %edx,%edx
+ a72:	0f 89 80 00 00 00    	jns    af8 <printint+0x98>
+ a78:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ a7c:	74 7a                	je     af8 <printint+0x98>
+    x = -xx;
+ a7e:	f7 d9                	neg    %ecx
+    neg = 1;
+ a80:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ a85:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ a88:	31 f6                	xor    %esi,%esi
+ a8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ a90:	89 c8                	mov    %ecx,%eax
+ a92:	31 d2                	xor    %edx,%edx
+ a94:	89 f7                	mov    %esi,%edi
+ a96:	f7 f3                	div    %ebx
+ a98:	8d 76 01             	lea    0x1(%esi),%esi
+ a9b:	0f b6 92 d4 10 00 00 	movzbl 0x10d4(%edx),%edx
+ aa2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ aa6:	89 ca                	mov    %ecx,%edx
+ aa8:	89 c1                	mov    %eax,%ecx
+ aaa:	39 da                	cmp    %ebx,%edx
+ aac:	73 e2                	jae    a90 <printint+0x30>
+  if(neg)
+ aae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ ab1:	85 c0                	test   %eax,%eax
+ ab3:	74 07                	je     abc <printint+0x5c>
+    buf[i++] = '-';
+ ab5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ aba:	89 f7                	mov    %esi,%edi
+ abc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ abf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ ac2:	01 df                	add    %ebx,%edi
+ ac4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ ac8:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+ acb:	83 ec 04             	sub    $0x4,%esp
+ ace:	88 45 d7             	mov    %al,-0x29(%ebp)
+ ad1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ ad4:	6a 01                	push   $0x1
+ ad6:	50                   	push   %eax
+ ad7:	56                   	push   %esi
+ ad8:	e8 e3 f6 ff ff       	call   1c0 <bufwrite>
+  while(--i >= 0)
+ add:	89 f8                	mov    %edi,%eax
+ adf:	83 c4 10             	add    $0x10,%esp
+ ae2:	83 ef 01             	sub    $0x1,%edi
+ ae5:	39 d8                	cmp    %ebx,%eax
+ ae7:	75 df                	jne    ac8 <printint+0x68>
+}
+ ae9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ aec:	5b                   	pop    %ebx
+ aed:	5e                   	pop    %esi
+ aee:	5f                   	pop    %edi
+ aef:	5d                   	pop    %ebp
+ af0:	c3                   	ret
+ af1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ af8:	31 c0                	xor    %eax,%eax
+ afa:	eb 89                	jmp    a85 <printint+0x25>
+ afc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b00 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ b00:	55                   	push   %ebp
+ b01:	89 e5                	mov    %esp,%ebp
+ b03:	57                   	push   %edi
+ b04:	56                   	push   %esi
+ b05:	53                   	push   %ebx
+ b06:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ b09:	8b 45 0c             	mov    0xc(%ebp),%eax
+ b0c:	0f b6 18             	movzbl (%eax),%ebx
+ b0f:	84 db                	test   %bl,%bl
+ b11:	74 6c                	je     b7f <printf+0x7f>
+ b13:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+ b16:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ b19:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ b1b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ b1e:	eb 26                	jmp    b46 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ b20:	83 f8 25             	cmp    $0x25,%eax
+ b23:	74 4b                	je     b70 <printf+0x70>
+  bufwrite(fd, &c, 1);
+ b25:	83 ec 04             	sub    $0x4,%esp
+ b28:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ b2b:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ b2e:	6a 01                	push   $0x1
+ b30:	50                   	push   %eax
+ b31:	ff 75 08             	push   0x8(%ebp)
+ b34:	e8 87 f6 ff ff       	call   1c0 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+ b39:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ b3c:	0f b6 1f             	movzbl (%edi),%ebx
+ b3f:	83 c7 01             	add    $0x1,%edi
+ b42:	84 db                	test   %bl,%bl
+ b44:	74 39                	je     b7f <printf+0x7f>
+    c = fmt[i] & 0xff;
+ b46:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ b49:	85 f6                	test   %esi,%esi
+ b4b:	74 d3                	je     b20 <printf+0x20>
+      }
+    } else if(state == '%'){
+ b4d:	83 fe 25             	cmp    $0x25,%esi
+ b50:	75 ea                	jne    b3c <printf+0x3c>
+      if(c == 'd'){
+ b52:	83 f8 25             	cmp    $0x25,%eax
+ b55:	0f 84 d5 01 00 00    	je     d30 <printf+0x230>
+ b5b:	83 e8 63             	sub    $0x63,%eax
+ b5e:	83 f8 15             	cmp    $0x15,%eax
+ b61:	77 45                	ja     ba8 <printf+0xa8>
+ b63:	ff 24 85 7c 10 00 00 	jmp    *0x107c(,%eax,4)
+ b6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+ b70:	0f b6 1f             	movzbl (%edi),%ebx
+ b73:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+ b76:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ b7b:	84 db                	test   %bl,%bl
+ b7d:	75 c7                	jne    b46 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+ b7f:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+ b83:	74 0b                	je     b90 <printf+0x90>
+    fflush(fd);
+}
+ b85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b88:	5b                   	pop    %ebx
+ b89:	5e                   	pop    %esi
+ b8a:	5f                   	pop    %edi
+ b8b:	5d                   	pop    %ebp
+ b8c:	c3                   	ret
+ b8d:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+ b90:	83 ec 0c             	sub    $0xc,%esp
+ b93:	6a 02                	push   $0x2
+ b95:	e8 c6 f7 ff ff       	call   360 <fflush>
+ b9a:	83 c4 10             	add    $0x10,%esp
+}
+ b9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ba0:	5b                   	pop    %ebx
+ ba1:	5e                   	pop    %esi
+ ba2:	5f                   	pop    %edi
+ ba3:	5d                   	pop    %ebp
+ ba4:	c3                   	ret
+ ba5:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+ ba8:	83 ec 04             	sub    $0x4,%esp
+ bab:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ bae:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+ bb2:	6a 01                	push   $0x1
+ bb4:	52                   	push   %edx
+ bb5:	89 55 c0             	mov    %edx,-0x40(%ebp)
+ bb8:	ff 75 08             	push   0x8(%ebp)
+ bbb:	e8 00 f6 ff ff       	call   1c0 <bufwrite>
+ bc0:	83 c4 0c             	add    $0xc,%esp
+ bc3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ bc6:	6a 01                	push   $0x1
+ bc8:	8b 55 c0             	mov    -0x40(%ebp),%edx
+ bcb:	52                   	push   %edx
+      state = 0;
+ bcc:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+ bce:	ff 75 08             	push   0x8(%ebp)
+ bd1:	e8 ea f5 ff ff       	call   1c0 <bufwrite>
+        putc(fd, c);
+ bd6:	83 c4 10             	add    $0x10,%esp
+ bd9:	e9 5e ff ff ff       	jmp    b3c <printf+0x3c>
+ bde:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+ be0:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ be3:	83 ec 0c             	sub    $0xc,%esp
+ be6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ beb:	8b 16                	mov    (%esi),%edx
+ bed:	6a 00                	push   $0x0
+ bef:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+ bf2:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+ bf5:	e8 66 fe ff ff       	call   a60 <printint>
+        ap++;
+ bfa:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ bfd:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c00:	31 f6                	xor    %esi,%esi
+ c02:	e9 35 ff ff ff       	jmp    b3c <printf+0x3c>
+ c07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c0e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+ c10:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ c13:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ c15:	83 c0 04             	add    $0x4,%eax
+ c18:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+ c1b:	b8 74 10 00 00       	mov    $0x1074,%eax
+ c20:	85 db                	test   %ebx,%ebx
+ c22:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+ c25:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+ c28:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+ c2a:	53                   	push   %ebx
+ c2b:	e8 90 f9 ff ff       	call   5c0 <strlen>
+ c30:	83 c4 0c             	add    $0xc,%esp
+ c33:	50                   	push   %eax
+ c34:	53                   	push   %ebx
+ c35:	ff 75 08             	push   0x8(%ebp)
+ c38:	e8 83 f5 ff ff       	call   1c0 <bufwrite>
+ c3d:	83 c4 10             	add    $0x10,%esp
+ c40:	e9 f7 fe ff ff       	jmp    b3c <printf+0x3c>
+ c45:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ c48:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+ c4b:	83 ec 04             	sub    $0x4,%esp
+ c4e:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+ c51:	8b 06                	mov    (%esi),%eax
+        ap++;
+ c53:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+ c56:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+ c59:	6a 01                	push   $0x1
+ c5b:	52                   	push   %edx
+ c5c:	ff 75 08             	push   0x8(%ebp)
+ c5f:	e8 5c f5 ff ff       	call   1c0 <bufwrite>
+        ap++;
+ c64:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ c67:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c6a:	31 f6                	xor    %esi,%esi
+ c6c:	e9 cb fe ff ff       	jmp    b3c <printf+0x3c>
+ c71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+ c78:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ c7b:	83 ec 0c             	sub    $0xc,%esp
+ c7e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ c83:	8b 16                	mov    (%esi),%edx
+ c85:	6a 01                	push   $0x1
+ c87:	e9 63 ff ff ff       	jmp    bef <printf+0xef>
+ c8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+ c90:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ c93:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ c96:	89 7d c0             	mov    %edi,-0x40(%ebp)
+ c99:	89 55 bc             	mov    %edx,-0x44(%ebp)
+ c9c:	8b 18                	mov    (%eax),%ebx
+ c9e:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+ ca1:	31 c0                	xor    %eax,%eax
+ ca3:	89 c7                	mov    %eax,%edi
+ ca5:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+ ca8:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+ cad:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+ caf:	f7 e1                	mul    %ecx
+ cb1:	c1 ea 03             	shr    $0x3,%edx
+ cb4:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ cb7:	89 d1                	mov    %edx,%ecx
+ cb9:	01 c0                	add    %eax,%eax
+ cbb:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ cbd:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+ cbf:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ cc1:	be 0a 00 00 00       	mov    $0xa,%esi
+ cc6:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+ cc8:	89 da                	mov    %ebx,%edx
+ cca:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+ ccc:	89 fe                	mov    %edi,%esi
+ cce:	83 c7 01             	add    $0x1,%edi
+ cd1:	8d 42 30             	lea    0x30(%edx),%eax
+ cd4:	89 da                	mov    %ebx,%edx
+ cd6:	8d 14 92             	lea    (%edx,%edx,4),%edx
+ cd9:	01 d2                	add    %edx,%edx
+ cdb:	29 d0                	sub    %edx,%eax
+ cdd:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+ ce1:	89 c8                	mov    %ecx,%eax
+ ce3:	09 d8                	or     %ebx,%eax
+ ce5:	75 c1                	jne    ca8 <printf+0x1a8>
+ ce7:	8b 55 bc             	mov    -0x44(%ebp),%edx
+ cea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ ced:	01 d6                	add    %edx,%esi
+ cef:	89 f7                	mov    %esi,%edi
+ cf1:	89 d6                	mov    %edx,%esi
+ cf3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ cf7:	90                   	nop
+    putc(fd, buf[i]);
+ cf8:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+ cfb:	83 ec 04             	sub    $0x4,%esp
+ cfe:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+ d01:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+ d04:	6a 01                	push   $0x1
+ d06:	50                   	push   %eax
+ d07:	53                   	push   %ebx
+ d08:	e8 b3 f4 ff ff       	call   1c0 <bufwrite>
+  while(--i >= 0)
+ d0d:	89 fa                	mov    %edi,%edx
+ d0f:	83 c4 10             	add    $0x10,%esp
+ d12:	83 ef 01             	sub    $0x1,%edi
+ d15:	39 d6                	cmp    %edx,%esi
+ d17:	75 df                	jne    cf8 <printf+0x1f8>
+        ap += 2;
+ d19:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+ d1d:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+ d20:	31 f6                	xor    %esi,%esi
+ d22:	e9 15 fe ff ff       	jmp    b3c <printf+0x3c>
+ d27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d2e:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+ d30:	83 ec 04             	sub    $0x4,%esp
+ d33:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ d36:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ d39:	6a 01                	push   $0x1
+ d3b:	e9 8b fe ff ff       	jmp    bcb <printf+0xcb>
+
+00000d40 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ d40:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d41:	a1 00 36 00 00       	mov    0x3600,%eax
+{
+ d46:	89 e5                	mov    %esp,%ebp
+ d48:	57                   	push   %edi
+ d49:	56                   	push   %esi
+ d4a:	53                   	push   %ebx
+ d4b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ d4e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d58:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d5a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d5c:	39 ca                	cmp    %ecx,%edx
+ d5e:	73 30                	jae    d90 <free+0x50>
+ d60:	39 c1                	cmp    %eax,%ecx
+ d62:	72 04                	jb     d68 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d64:	39 c2                	cmp    %eax,%edx
+ d66:	72 f0                	jb     d58 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ d68:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ d6b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ d6e:	39 f8                	cmp    %edi,%eax
+ d70:	74 2e                	je     da0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d72:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ d75:	8b 42 04             	mov    0x4(%edx),%eax
+ d78:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d7b:	39 f1                	cmp    %esi,%ecx
+ d7d:	74 38                	je     db7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ d7f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ d81:	5b                   	pop    %ebx
+  freep = p;
+ d82:	89 15 00 36 00 00    	mov    %edx,0x3600
+}
+ d88:	5e                   	pop    %esi
+ d89:	5f                   	pop    %edi
+ d8a:	5d                   	pop    %ebp
+ d8b:	c3                   	ret
+ d8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d90:	39 c1                	cmp    %eax,%ecx
+ d92:	72 d0                	jb     d64 <free+0x24>
+ d94:	eb c2                	jmp    d58 <free+0x18>
+ d96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d9d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ da0:	03 70 04             	add    0x4(%eax),%esi
+ da3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ da6:	8b 02                	mov    (%edx),%eax
+ da8:	8b 00                	mov    (%eax),%eax
+ daa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ dad:	8b 42 04             	mov    0x4(%edx),%eax
+ db0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ db3:	39 f1                	cmp    %esi,%ecx
+ db5:	75 c8                	jne    d7f <free+0x3f>
+    p->s.size += bp->s.size;
+ db7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ dba:	89 15 00 36 00 00    	mov    %edx,0x3600
+    p->s.size += bp->s.size;
+ dc0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ dc3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ dc6:	89 0a                	mov    %ecx,(%edx)
+}
+ dc8:	5b                   	pop    %ebx
+ dc9:	5e                   	pop    %esi
+ dca:	5f                   	pop    %edi
+ dcb:	5d                   	pop    %ebp
+ dcc:	c3                   	ret
+ dcd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000dd0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ dd0:	55                   	push   %ebp
+ dd1:	89 e5                	mov    %esp,%ebp
+ dd3:	57                   	push   %edi
+ dd4:	56                   	push   %esi
+ dd5:	53                   	push   %ebx
+ dd6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ dd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ ddc:	8b 15 00 36 00 00    	mov    0x3600,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ de2:	8d 78 07             	lea    0x7(%eax),%edi
+ de5:	c1 ef 03             	shr    $0x3,%edi
+ de8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ deb:	85 d2                	test   %edx,%edx
+ ded:	0f 84 8d 00 00 00    	je     e80 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ df3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ df5:	8b 48 04             	mov    0x4(%eax),%ecx
+ df8:	39 f9                	cmp    %edi,%ecx
+ dfa:	73 64                	jae    e60 <malloc+0x90>
+  if(nu < 4096)
+ dfc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ e01:	39 df                	cmp    %ebx,%edi
+ e03:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ e06:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ e0d:	eb 0a                	jmp    e19 <malloc+0x49>
+ e0f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e10:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ e12:	8b 48 04             	mov    0x4(%eax),%ecx
+ e15:	39 f9                	cmp    %edi,%ecx
+ e17:	73 47                	jae    e60 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ e19:	89 c2                	mov    %eax,%edx
+ e1b:	39 05 00 36 00 00    	cmp    %eax,0x3600
+ e21:	75 ed                	jne    e10 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ e23:	83 ec 0c             	sub    $0xc,%esp
+ e26:	56                   	push   %esi
+ e27:	e8 c7 fa ff ff       	call   8f3 <sbrk>
+  if(p == (char*)-1)
+ e2c:	83 c4 10             	add    $0x10,%esp
+ e2f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ e32:	74 1c                	je     e50 <malloc+0x80>
+  hp->s.size = nu;
+ e34:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ e37:	83 ec 0c             	sub    $0xc,%esp
+ e3a:	83 c0 08             	add    $0x8,%eax
+ e3d:	50                   	push   %eax
+ e3e:	e8 fd fe ff ff       	call   d40 <free>
+  return freep;
+ e43:	8b 15 00 36 00 00    	mov    0x3600,%edx
+      if((p = morecore(nunits)) == 0)
+ e49:	83 c4 10             	add    $0x10,%esp
+ e4c:	85 d2                	test   %edx,%edx
+ e4e:	75 c0                	jne    e10 <malloc+0x40>
+        return 0;
+  }
+}
+ e50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ e53:	31 c0                	xor    %eax,%eax
+}
+ e55:	5b                   	pop    %ebx
+ e56:	5e                   	pop    %esi
+ e57:	5f                   	pop    %edi
+ e58:	5d                   	pop    %ebp
+ e59:	c3                   	ret
+ e5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ e60:	39 cf                	cmp    %ecx,%edi
+ e62:	74 4c                	je     eb0 <malloc+0xe0>
+        p->s.size -= nunits;
+ e64:	29 f9                	sub    %edi,%ecx
+ e66:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ e69:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ e6c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ e6f:	89 15 00 36 00 00    	mov    %edx,0x3600
+}
+ e75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ e78:	83 c0 08             	add    $0x8,%eax
+}
+ e7b:	5b                   	pop    %ebx
+ e7c:	5e                   	pop    %esi
+ e7d:	5f                   	pop    %edi
+ e7e:	5d                   	pop    %ebp
+ e7f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ e80:	c7 05 00 36 00 00 04 	movl   $0x3604,0x3600
+ e87:	36 00 00 
+    base.s.size = 0;
+ e8a:	b8 04 36 00 00       	mov    $0x3604,%eax
+    base.s.ptr = freep = prevp = &base;
+ e8f:	c7 05 04 36 00 00 04 	movl   $0x3604,0x3604
+ e96:	36 00 00 
+    base.s.size = 0;
+ e99:	c7 05 08 36 00 00 00 	movl   $0x0,0x3608
+ ea0:	00 00 00 
+    if(p->s.size >= nunits){
+ ea3:	e9 54 ff ff ff       	jmp    dfc <malloc+0x2c>
+ ea8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ eaf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ eb0:	8b 08                	mov    (%eax),%ecx
+ eb2:	89 0a                	mov    %ecx,(%edx)
+ eb4:	eb b9                	jmp    e6f <malloc+0x9f>
+ eb6:	66 90                	xchg   %ax,%ax
+ eb8:	66 90                	xchg   %ax,%ax
+ eba:	66 90                	xchg   %ax,%ax
+ ebc:	66 90                	xchg   %ax,%ax
+ ebe:	66 90                	xchg   %ax,%ax
+
+00000ec0 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+ ec0:	55                   	push   %ebp
+ ec1:	89 e5                	mov    %esp,%ebp
+ ec3:	57                   	push   %edi
+ ec4:	56                   	push   %esi
+ ec5:	be 01 00 00 00       	mov    $0x1,%esi
+ eca:	53                   	push   %ebx
+ ecb:	83 ec 28             	sub    $0x28,%esp
+ ece:	8b 45 0c             	mov    0xc(%ebp),%eax
+ ed1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ ed4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+ ed7:	68 00 98 00 00       	push   $0x9800
+ edc:	e8 ef fe ff ff       	call   dd0 <malloc>
+ ee1:	83 c4 10             	add    $0x10,%esp
+ ee4:	89 c7                	mov    %eax,%edi
+ ee6:	85 c0                	test   %eax,%eax
+ ee8:	74 62                	je     f4c <waitpoll+0x8c>
+ eea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+ ef0:	83 ec 0c             	sub    $0xc,%esp
+ ef3:	6a 01                	push   $0x1
+ ef5:	e8 03 fa ff ff       	call   8fd <sleep>
+    fn();
+ efa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ efd:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+ eff:	58                   	pop    %eax
+ f00:	5a                   	pop    %edx
+ f01:	68 00 02 00 00       	push   $0x200
+ f06:	57                   	push   %edi
+ f07:	e8 eb fa ff ff       	call   9f7 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+ f0c:	83 c4 10             	add    $0x10,%esp
+ f0f:	85 c0                	test   %eax,%eax
+ f11:	7e 2d                	jle    f40 <waitpoll+0x80>
+ f13:	6b c0 4c             	imul   $0x4c,%eax,%eax
+ f16:	89 fa                	mov    %edi,%edx
+    alive = 0;
+ f18:	31 c9                	xor    %ecx,%ecx
+ f1a:	01 f8                	add    %edi,%eax
+ f1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+ f20:	3b 1a                	cmp    (%edx),%ebx
+ f22:	75 07                	jne    f2b <waitpoll+0x6b>
+        alive = 1;
+ f24:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+ f28:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+ f2b:	83 c2 4c             	add    $0x4c,%edx
+ f2e:	39 d0                	cmp    %edx,%eax
+ f30:	75 ee                	jne    f20 <waitpoll+0x60>
+  } while(alive);
+ f32:	85 c9                	test   %ecx,%ecx
+ f34:	75 ba                	jne    ef0 <waitpoll+0x30>
+ f36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f3d:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+ f40:	83 ec 0c             	sub    $0xc,%esp
+ f43:	57                   	push   %edi
+ f44:	e8 f7 fd ff ff       	call   d40 <free>
+  wait();
+ f49:	83 c4 10             	add    $0x10,%esp
+}
+ f4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ f4f:	5b                   	pop    %ebx
+ f50:	5e                   	pop    %esi
+ f51:	5f                   	pop    %edi
+ f52:	5d                   	pop    %ebp
+  wait();
+ f53:	e9 10 f9 ff ff       	jmp    868 <wait>
+ f58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f5f:	90                   	nop
+
+00000f60 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+ f60:	55                   	push   %ebp
+ f61:	89 e5                	mov    %esp,%ebp
+ f63:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+ f66:	c7 45 f0 e5 10 00 00 	movl   $0x10e5,-0x10(%ebp)
+ f6d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+ f74:	e8 87 f4 ff ff       	call   400 <fork>
+ f79:	85 c0                	test   %eax,%eax
+ f7b:	78 09                	js     f86 <runps+0x26>
+    return -1;
+  if(pid == 0){
+ f7d:	74 0e                	je     f8d <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+ f7f:	e8 e4 f8 ff ff       	call   868 <wait>
+}
+ f84:	c9                   	leave
+ f85:	c3                   	ret
+ f86:	c9                   	leave
+    return -1;
+ f87:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ f8c:	c3                   	ret
+    exec("ps", argv);
+ f8d:	50                   	push   %eax
+ f8e:	50                   	push   %eax
+ f8f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ f92:	50                   	push   %eax
+ f93:	68 e5 10 00 00       	push   $0x10e5
+ f98:	e8 c3 f4 ff ff       	call   460 <exec>
+    printf(2, "exec ps failed\n");
+ f9d:	5a                   	pop    %edx
+ f9e:	59                   	pop    %ecx
+ f9f:	68 e8 10 00 00       	push   $0x10e8
+ fa4:	6a 02                	push   $0x2
+ fa6:	e8 55 fb ff ff       	call   b00 <printf>
+    exit();
+ fab:	e8 a0 f4 ff ff       	call   450 <exit>
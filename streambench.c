@@ -0,0 +1,59 @@
+// Stream a large file to disk and back, to time block
+// mapping through the indirect block trees.  By default
+// the file is 8 MB, or half the free space if that is less.
+//
+// usage: streambench [kb]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "fs.h"
+
+#define FILENAME "streambench.tmp"
+
+char buf[4096];
+
+int
+main(int argc, char *argv[])
+{
+  int fd, kb, i, n, t;
+
+  kb = fsfree() / 2 * BSIZE / 1024;
+  if(kb > 8192)
+    kb = 8192;
+  if(argc > 1)
+    kb = atoi(argv[1]);
+
+  if((fd = open(FILENAME, O_CREATE|O_RDWR)) < 0){
+    printf(2, "streambench: cannot create %s\n", FILENAME);
+    exit();
+  }
+  t = uptime();
+  for(i = 0; i < kb/4; i++){
+    ((int*)buf)[0] = i;
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+      printf(2, "streambench: write failed at %d KB\n", 4*i);
+      exit();
+    }
+  }
+  close(fd);
+  printf(1, "write: %d KB in %d ticks\n", 4*i, uptime() - t);
+
+  if((fd = open(FILENAME, O_RDONLY)) < 0){
+    printf(2, "streambench: cannot open %s\n", FILENAME);
+    exit();
+  }
+  t = uptime();
+  for(i = 0; (n = read(fd, buf, sizeof(buf))) == sizeof(buf); i++){
+    if(((int*)buf)[0] != i){
+      printf(2, "streambench: bad data at %d KB\n", 4*i);
+      exit();
+    }
+  }
+  close(fd);
+  printf(1, "read: %d KB in %d ticks\n", 4*i, uptime() - t);
+
+  unlink(FILENAME);
+  exit();
+}
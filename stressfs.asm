@@ -0,0 +1,2050 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+  int fd, i;
+  char path[] = "stressfs0";
+   7:	b8 30 00 00 00       	mov    $0x30,%eax
+{
+   c:	ff 71 fc             	push   -0x4(%ecx)
+   f:	55                   	push   %ebp
+  10:	89 e5                	mov    %esp,%ebp
+  12:	57                   	push   %edi
+  13:	56                   	push   %esi
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+  memset(data, 'a', sizeof(data));
+  14:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+{
+  1a:	53                   	push   %ebx
+
+  for(i = 0; i < 4; i++)
+  1b:	31 db                	xor    %ebx,%ebx
+{
+  1d:	51                   	push   %ecx
+  1e:	81 ec 20 02 00 00    	sub    $0x220,%esp
+  char path[] = "stressfs0";
+  24:	66 89 85 e6 fd ff ff 	mov    %ax,-0x21a(%ebp)
+  2b:	c7 85 de fd ff ff 73 	movl   $0x65727473,-0x222(%ebp)
+  32:	74 72 65 
+  35:	c7 85 e2 fd ff ff 73 	movl   $0x73667373,-0x21e(%ebp)
+  3c:	73 66 73 
+  printf(1, "stressfs starting\n");
+  3f:	68 10 0f 00 00       	push   $0xf10
+  44:	6a 01                	push   $0x1
+  46:	e8 15 0a 00 00       	call   a60 <printf>
+  memset(data, 'a', sizeof(data));
+  4b:	83 c4 0c             	add    $0xc,%esp
+  4e:	68 00 02 00 00       	push   $0x200
+  53:	6a 61                	push   $0x61
+  55:	56                   	push   %esi
+  56:	e8 f5 04 00 00       	call   550 <memset>
+  5b:	83 c4 10             	add    $0x10,%esp
+    if(fork() > 0)
+  5e:	e8 fd 02 00 00       	call   360 <fork>
+  63:	85 c0                	test   %eax,%eax
+  65:	7f 08                	jg     6f <main+0x6f>
+  for(i = 0; i < 4; i++)
+  67:	83 c3 01             	add    $0x1,%ebx
+  6a:	83 fb 04             	cmp    $0x4,%ebx
+  6d:	75 ef                	jne    5e <main+0x5e>
+      break;
+
+  printf(1, "write %d\n", i);
+  6f:	83 ec 04             	sub    $0x4,%esp
+  72:	53                   	push   %ebx
+  73:	68 23 0f 00 00       	push   $0xf23
+  78:	6a 01                	push   $0x1
+  7a:	e8 e1 09 00 00       	call   a60 <printf>
+
+  path[8] += i;
+  7f:	00 9d e6 fd ff ff    	add    %bl,-0x21a(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+  85:	5f                   	pop    %edi
+  86:	bb 14 00 00 00       	mov    $0x14,%ebx
+  8b:	58                   	pop    %eax
+  8c:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  92:	68 02 02 00 00       	push   $0x202
+  97:	50                   	push   %eax
+  98:	e8 5c 07 00 00       	call   7f9 <open>
+  9d:	83 c4 10             	add    $0x10,%esp
+  a0:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < 20; i++)
+  a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+  a8:	83 ec 04             	sub    $0x4,%esp
+  ab:	68 00 02 00 00       	push   $0x200
+  b0:	56                   	push   %esi
+  b1:	57                   	push   %edi
+  b2:	e8 26 07 00 00       	call   7dd <write>
+  for(i = 0; i < 20; i++)
+  b7:	83 c4 10             	add    $0x10,%esp
+  ba:	83 eb 01             	sub    $0x1,%ebx
+  bd:	75 e9                	jne    a8 <main+0xa8>
+  close(fd);
+  bf:	83 ec 0c             	sub    $0xc,%esp
+  c2:	57                   	push   %edi
+  c3:	e8 58 03 00 00       	call   420 <close>
+
+  printf(1, "read\n");
+  c8:	58                   	pop    %eax
+  c9:	5a                   	pop    %edx
+  ca:	68 2d 0f 00 00       	push   $0xf2d
+  cf:	6a 01                	push   $0x1
+  d1:	e8 8a 09 00 00       	call   a60 <printf>
+
+  fd = open(path, O_RDONLY);
+  d6:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  dc:	59                   	pop    %ecx
+  dd:	5b                   	pop    %ebx
+  de:	6a 00                	push   $0x0
+  e0:	bb 14 00 00 00       	mov    $0x14,%ebx
+  e5:	50                   	push   %eax
+  e6:	e8 0e 07 00 00       	call   7f9 <open>
+  eb:	83 c4 10             	add    $0x10,%esp
+  ee:	89 c7                	mov    %eax,%edi
+  for (i = 0; i < 20; i++)
+    read(fd, data, sizeof(data));
+  f0:	83 ec 04             	sub    $0x4,%esp
+  f3:	68 00 02 00 00       	push   $0x200
+  f8:	56                   	push   %esi
+  f9:	57                   	push   %edi
+  fa:	e8 d7 06 00 00       	call   7d6 <read>
+  for (i = 0; i < 20; i++)
+  ff:	83 c4 10             	add    $0x10,%esp
+ 102:	83 eb 01             	sub    $0x1,%ebx
+ 105:	75 e9                	jne    f0 <main+0xf0>
+  close(fd);
+ 107:	83 ec 0c             	sub    $0xc,%esp
+ 10a:	57                   	push   %edi
+ 10b:	e8 10 03 00 00       	call   420 <close>
+
+  wait();
+ 110:	e8 b3 06 00 00       	call   7c8 <wait>
+
+  exit();
+ 115:	e8 96 02 00 00       	call   3b0 <exit>
+ 11a:	66 90                	xchg   %ax,%ax
+ 11c:	66 90                	xchg   %ax,%ax
+ 11e:	66 90                	xchg   %ax,%ax
+
+00000120 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	57                   	push   %edi
+ 124:	56                   	push   %esi
+ 125:	53                   	push   %ebx
+ 126:	83 ec 4c             	sub    $0x4c,%esp
+ 129:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 12c:	8b 55 08             	mov    0x8(%ebp),%edx
+ 12f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 132:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+ 135:	83 fa 0f             	cmp    $0xf,%edx
+ 138:	0f 87 32 01 00 00    	ja     270 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+ 13e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 144:	8b 80 40 14 00 00    	mov    0x1440(%eax),%eax
+ 14a:	85 c0                	test   %eax,%eax
+ 14c:	0f 84 de 00 00 00    	je     230 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+ 152:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 158:	8b b0 44 14 00 00    	mov    0x1444(%eax),%esi
+ 15e:	8d 88 40 14 00 00    	lea    0x1440(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+ 164:	8d b8 48 14 00 00    	lea    0x1448(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+ 16a:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+ 16d:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+ 170:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+ 173:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+ 179:	0f 8f 01 01 00 00    	jg     280 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+ 17f:	8d 78 08             	lea    0x8(%eax),%edi
+ 182:	8d bc 3e 40 14 00 00 	lea    0x1440(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 189:	85 db                	test   %ebx,%ebx
+ 18b:	7e 3b                	jle    1c8 <bufwrite+0xa8>
+ 18d:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+ 190:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+ 193:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 197:	90                   	nop
+    *dst++ = *src++;
+ 198:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 199:	39 c6                	cmp    %eax,%esi
+ 19b:	75 fb                	jne    198 <bufwrite+0x78>
+  ob[fd].n += n;
+ 19d:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 1a3:	8b 88 44 14 00 00    	mov    0x1444(%eax),%ecx
+ 1a9:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 1ab:	83 b8 40 14 00 00 01 	cmpl   $0x1,0x1440(%eax)
+  ob[fd].n += n;
+ 1b2:	89 88 44 14 00 00    	mov    %ecx,0x1444(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 1b8:	74 26                	je     1e0 <bufwrite+0xc0>
+}
+ 1ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1bd:	5b                   	pop    %ebx
+ 1be:	5e                   	pop    %esi
+ 1bf:	5f                   	pop    %edi
+ 1c0:	5d                   	pop    %ebp
+ 1c1:	c3                   	ret
+ 1c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+ 1c8:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 1cb:	83 b8 40 14 00 00 01 	cmpl   $0x1,0x1440(%eax)
+  ob[fd].n += n;
+ 1d2:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 1d5:	75 e3                	jne    1ba <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+ 1d7:	85 db                	test   %ebx,%ebx
+ 1d9:	74 df                	je     1ba <bufwrite+0x9a>
+ 1db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1df:	90                   	nop
+  src = vsrc;
+ 1e0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 1e3:	01 c3                	add    %eax,%ebx
+ 1e5:	eb 10                	jmp    1f7 <bufwrite+0xd7>
+ 1e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ee:	66 90                	xchg   %ax,%ax
+ 1f0:	83 c0 01             	add    $0x1,%eax
+ 1f3:	39 d8                	cmp    %ebx,%eax
+ 1f5:	74 c3                	je     1ba <bufwrite+0x9a>
+    if(*p == (char)c)
+ 1f7:	80 38 0a             	cmpb   $0xa,(%eax)
+ 1fa:	75 f4                	jne    1f0 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 1fc:	85 c9                	test   %ecx,%ecx
+ 1fe:	7e ba                	jle    1ba <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 200:	83 ec 04             	sub    $0x4,%esp
+ 203:	51                   	push   %ecx
+ 204:	ff 75 ac             	push   -0x54(%ebp)
+ 207:	52                   	push   %edx
+ 208:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+ 20b:	e8 cd 05 00 00       	call   7dd <write>
+    ob[fd].n = 0;
+ 210:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+ 213:	83 c4 10             	add    $0x10,%esp
+ 216:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+ 21c:	c7 82 44 14 00 00 00 	movl   $0x0,0x1444(%edx)
+ 223:	00 00 00 
+ 226:	eb 92                	jmp    1ba <bufwrite+0x9a>
+ 228:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22f:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 230:	83 ec 08             	sub    $0x8,%esp
+ 233:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 236:	50                   	push   %eax
+ 237:	52                   	push   %edx
+ 238:	89 55 b0             	mov    %edx,-0x50(%ebp)
+ 23b:	e8 d7 05 00 00       	call   817 <fstat>
+ 240:	83 c4 10             	add    $0x10,%esp
+ 243:	8b 55 b0             	mov    -0x50(%ebp),%edx
+ 246:	89 c1                	mov    %eax,%ecx
+ 248:	b8 02 00 00 00       	mov    $0x2,%eax
+ 24d:	85 c9                	test   %ecx,%ecx
+ 24f:	75 0d                	jne    25e <bufwrite+0x13e>
+ 251:	31 c0                	xor    %eax,%eax
+ 253:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 258:	0f 95 c0             	setne  %al
+ 25b:	83 c0 01             	add    $0x1,%eax
+ 25e:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+ 264:	89 81 40 14 00 00    	mov    %eax,0x1440(%ecx)
+ 26a:	e9 e3 fe ff ff       	jmp    152 <bufwrite+0x32>
+ 26f:	90                   	nop
+}
+ 270:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 273:	5b                   	pop    %ebx
+ 274:	5e                   	pop    %esi
+ 275:	5f                   	pop    %edi
+ 276:	5d                   	pop    %ebp
+    write(fd, p, n);
+ 277:	e9 61 05 00 00       	jmp    7dd <write>
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+ 280:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+ 283:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+ 286:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+ 289:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+ 28c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+ 28f:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+ 292:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+ 295:	6a 02                	push   $0x2
+ 297:	50                   	push   %eax
+ 298:	52                   	push   %edx
+ 299:	e8 9b 06 00 00       	call   939 <writev>
+    ob[fd].n = 0;
+ 29e:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+ 2a1:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+ 2a4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ 2ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2ae:	5b                   	pop    %ebx
+ 2af:	5e                   	pop    %esi
+ 2b0:	5f                   	pop    %edi
+ 2b1:	5d                   	pop    %ebp
+ 2b2:	c3                   	ret
+ 2b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000002c0 <fflush>:
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	53                   	push   %ebx
+ 2c4:	83 ec 04             	sub    $0x4,%esp
+ 2c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 2ca:	83 f8 0f             	cmp    $0xf,%eax
+ 2cd:	77 16                	ja     2e5 <fflush+0x25>
+ 2cf:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+ 2d5:	8b 8a 44 14 00 00    	mov    0x1444(%edx),%ecx
+ 2db:	8d 9a 40 14 00 00    	lea    0x1440(%edx),%ebx
+ 2e1:	85 c9                	test   %ecx,%ecx
+ 2e3:	7f 0b                	jg     2f0 <fflush+0x30>
+}
+ 2e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2e8:	c9                   	leave
+ 2e9:	c3                   	ret
+ 2ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 2f0:	83 ec 04             	sub    $0x4,%esp
+ 2f3:	81 c2 48 14 00 00    	add    $0x1448,%edx
+ 2f9:	51                   	push   %ecx
+ 2fa:	52                   	push   %edx
+ 2fb:	50                   	push   %eax
+ 2fc:	e8 dc 04 00 00       	call   7dd <write>
+    ob[fd].n = 0;
+ 301:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+ 308:	83 c4 10             	add    $0x10,%esp
+}
+ 30b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 30e:	c9                   	leave
+ 30f:	c3                   	ret
+
+00000310 <fflushall>:
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 314:	31 f6                	xor    %esi,%esi
+{
+ 316:	53                   	push   %ebx
+ 317:	bb 48 14 00 00       	mov    $0x1448,%ebx
+ 31c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 320:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 323:	85 c0                	test   %eax,%eax
+ 325:	7e 15                	jle    33c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 327:	83 ec 04             	sub    $0x4,%esp
+ 32a:	50                   	push   %eax
+ 32b:	53                   	push   %ebx
+ 32c:	56                   	push   %esi
+ 32d:	e8 ab 04 00 00       	call   7dd <write>
+    ob[fd].n = 0;
+ 332:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 339:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 33c:	83 c6 01             	add    $0x1,%esi
+ 33f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 345:	83 fe 10             	cmp    $0x10,%esi
+ 348:	75 d6                	jne    320 <fflushall+0x10>
+}
+ 34a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 34d:	5b                   	pop    %ebx
+ 34e:	5e                   	pop    %esi
+ 34f:	5d                   	pop    %ebp
+ 350:	c3                   	ret
+ 351:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 358:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35f:	90                   	nop
+
+00000360 <fork>:
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 364:	31 f6                	xor    %esi,%esi
+{
+ 366:	53                   	push   %ebx
+ 367:	bb 48 14 00 00       	mov    $0x1448,%ebx
+ 36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 370:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 373:	85 c0                	test   %eax,%eax
+ 375:	7e 15                	jle    38c <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 377:	83 ec 04             	sub    $0x4,%esp
+ 37a:	50                   	push   %eax
+ 37b:	53                   	push   %ebx
+ 37c:	56                   	push   %esi
+ 37d:	e8 5b 04 00 00       	call   7dd <write>
+    ob[fd].n = 0;
+ 382:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 389:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 38c:	83 c6 01             	add    $0x1,%esi
+ 38f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 395:	83 fe 10             	cmp    $0x10,%esi
+ 398:	75 d6                	jne    370 <fork+0x10>
+}
+ 39a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 39d:	5b                   	pop    %ebx
+ 39e:	5e                   	pop    %esi
+ 39f:	5d                   	pop    %ebp
+  return _fork();
+ 3a0:	e9 15 04 00 00       	jmp    7ba <_fork>
+ 3a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003b0 <exit>:
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+ 3b6:	e8 55 ff ff ff       	call   310 <fflushall>
+  _exit();
+ 3bb:	e8 01 04 00 00       	call   7c1 <_exit>
+
+000003c0 <exec>:
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	57                   	push   %edi
+ 3c4:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 3c5:	31 f6                	xor    %esi,%esi
+{
+ 3c7:	53                   	push   %ebx
+ 3c8:	bb 48 14 00 00       	mov    $0x1448,%ebx
+ 3cd:	83 ec 1c             	sub    $0x1c,%esp
+ 3d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 3d6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 3d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 3e0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 3e3:	85 c0                	test   %eax,%eax
+ 3e5:	7e 15                	jle    3fc <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 3e7:	83 ec 04             	sub    $0x4,%esp
+ 3ea:	50                   	push   %eax
+ 3eb:	53                   	push   %ebx
+ 3ec:	56                   	push   %esi
+ 3ed:	e8 eb 03 00 00       	call   7dd <write>
+    ob[fd].n = 0;
+ 3f2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 3f9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 3fc:	83 c6 01             	add    $0x1,%esi
+ 3ff:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 405:	83 fe 10             	cmp    $0x10,%esi
+ 408:	75 d6                	jne    3e0 <exec+0x20>
+  return _exec(path, argv);
+ 40a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 40d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+ 410:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ 413:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 416:	5b                   	pop    %ebx
+ 417:	5e                   	pop    %esi
+ 418:	5f                   	pop    %edi
+ 419:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 41a:	e9 d3 03 00 00       	jmp    7f2 <_exec>
+ 41f:	90                   	nop
+
+00000420 <close>:
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	56                   	push   %esi
+ 424:	53                   	push   %ebx
+ 425:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 428:	83 fb 0f             	cmp    $0xf,%ebx
+ 42b:	77 26                	ja     453 <close+0x33>
+ 42d:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 433:	8b 90 44 14 00 00    	mov    0x1444(%eax),%edx
+ 439:	8d b0 40 14 00 00    	lea    0x1440(%eax),%esi
+ 43f:	85 d2                	test   %edx,%edx
+ 441:	7f 25                	jg     468 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+ 443:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 449:	c7 80 40 14 00 00 00 	movl   $0x0,0x1440(%eax)
+ 450:	00 00 00 
+  return _close(fd);
+ 453:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 456:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 459:	5b                   	pop    %ebx
+ 45a:	5e                   	pop    %esi
+ 45b:	5d                   	pop    %ebp
+  return _close(fd);
+ 45c:	e9 83 03 00 00       	jmp    7e4 <_close>
+ 461:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 468:	83 ec 04             	sub    $0x4,%esp
+ 46b:	05 48 14 00 00       	add    $0x1448,%eax
+ 470:	52                   	push   %edx
+ 471:	50                   	push   %eax
+ 472:	53                   	push   %ebx
+ 473:	e8 65 03 00 00       	call   7dd <write>
+    ob[fd].n = 0;
+ 478:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+ 47f:	83 c4 10             	add    $0x10,%esp
+ 482:	eb bf                	jmp    443 <close+0x23>
+ 484:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 48f:	90                   	nop
+
+00000490 <strcpy>:
+{
+ 490:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+ 491:	31 c0                	xor    %eax,%eax
+{
+ 493:	89 e5                	mov    %esp,%ebp
+ 495:	53                   	push   %ebx
+ 496:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 499:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 49c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 4a0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 4a4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 4a7:	83 c0 01             	add    $0x1,%eax
+ 4aa:	84 d2                	test   %dl,%dl
+ 4ac:	75 f2                	jne    4a0 <strcpy+0x10>
+}
+ 4ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4b1:	89 c8                	mov    %ecx,%eax
+ 4b3:	c9                   	leave
+ 4b4:	c3                   	ret
+ 4b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <strcmp>:
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	53                   	push   %ebx
+ 4c4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 4ca:	0f b6 02             	movzbl (%edx),%eax
+ 4cd:	84 c0                	test   %al,%al
+ 4cf:	75 17                	jne    4e8 <strcmp+0x28>
+ 4d1:	eb 3a                	jmp    50d <strcmp+0x4d>
+ 4d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4d7:	90                   	nop
+ 4d8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 4dc:	83 c2 01             	add    $0x1,%edx
+ 4df:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 4e2:	84 c0                	test   %al,%al
+ 4e4:	74 1a                	je     500 <strcmp+0x40>
+    p++, q++;
+ 4e6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 4e8:	0f b6 19             	movzbl (%ecx),%ebx
+ 4eb:	38 c3                	cmp    %al,%bl
+ 4ed:	74 e9                	je     4d8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 4ef:	29 d8                	sub    %ebx,%eax
+}
+ 4f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4f4:	c9                   	leave
+ 4f5:	c3                   	ret
+ 4f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 500:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 504:	31 c0                	xor    %eax,%eax
+ 506:	29 d8                	sub    %ebx,%eax
+}
+ 508:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 50b:	c9                   	leave
+ 50c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 50d:	0f b6 19             	movzbl (%ecx),%ebx
+ 510:	31 c0                	xor    %eax,%eax
+ 512:	eb db                	jmp    4ef <strcmp+0x2f>
+ 514:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 51f:	90                   	nop
+
+00000520 <strlen>:
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+ 526:	80 3a 00             	cmpb   $0x0,(%edx)
+ 529:	74 15                	je     540 <strlen+0x20>
+ 52b:	31 c0                	xor    %eax,%eax
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+ 530:	83 c0 01             	add    $0x1,%eax
+ 533:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 537:	89 c1                	mov    %eax,%ecx
+ 539:	75 f5                	jne    530 <strlen+0x10>
+}
+ 53b:	89 c8                	mov    %ecx,%eax
+ 53d:	5d                   	pop    %ebp
+ 53e:	c3                   	ret
+ 53f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 540:	31 c9                	xor    %ecx,%ecx
+}
+ 542:	5d                   	pop    %ebp
+ 543:	89 c8                	mov    %ecx,%eax
+ 545:	c3                   	ret
+ 546:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 54d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000550 <memset>:
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 557:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 55a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 55d:	89 d7                	mov    %edx,%edi
+ 55f:	fc                   	cld
+ 560:	f3 aa                	rep stos %al,%es:(%edi)
+}
+ 562:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 565:	89 d0                	mov    %edx,%eax
+ 567:	c9                   	leave
+ 568:	c3                   	ret
+ 569:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000570 <strchr>:
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	8b 45 08             	mov    0x8(%ebp),%eax
+ 576:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 57a:	0f b6 10             	movzbl (%eax),%edx
+ 57d:	84 d2                	test   %dl,%dl
+ 57f:	75 12                	jne    593 <strchr+0x23>
+ 581:	eb 1d                	jmp    5a0 <strchr+0x30>
+ 583:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 587:	90                   	nop
+ 588:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 58c:	83 c0 01             	add    $0x1,%eax
+ 58f:	84 d2                	test   %dl,%dl
+ 591:	74 0d                	je     5a0 <strchr+0x30>
+    if(*s == c)
+ 593:	38 d1                	cmp    %dl,%cl
+ 595:	75 f1                	jne    588 <strchr+0x18>
+}
+ 597:	5d                   	pop    %ebp
+ 598:	c3                   	ret
+ 599:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 5a0:	31 c0                	xor    %eax,%eax
+}
+ 5a2:	5d                   	pop    %ebp
+ 5a3:	c3                   	ret
+ 5a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5af:	90                   	nop
+
+000005b0 <memchr>:
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	8b 55 10             	mov    0x10(%ebp),%edx
+ 5b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 5b9:	85 d2                	test   %edx,%edx
+ 5bb:	74 1b                	je     5d8 <memchr+0x28>
+    if(*p == (char)c)
+ 5bd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+ 5c1:	01 c2                	add    %eax,%edx
+ 5c3:	eb 0a                	jmp    5cf <memchr+0x1f>
+ 5c5:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+ 5c8:	83 c0 01             	add    $0x1,%eax
+ 5cb:	39 c2                	cmp    %eax,%edx
+ 5cd:	74 09                	je     5d8 <memchr+0x28>
+    if(*p == (char)c)
+ 5cf:	38 08                	cmp    %cl,(%eax)
+ 5d1:	75 f5                	jne    5c8 <memchr+0x18>
+}
+ 5d3:	5d                   	pop    %ebp
+ 5d4:	c3                   	ret
+ 5d5:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+ 5d8:	31 c0                	xor    %eax,%eax
+}
+ 5da:	5d                   	pop    %ebp
+ 5db:	c3                   	ret
+ 5dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005e0 <gets>:
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+ 5e3:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+ 5e4:	31 ff                	xor    %edi,%edi
+{
+ 5e6:	56                   	push   %esi
+ 5e7:	be 48 14 00 00       	mov    $0x1448,%esi
+ 5ec:	53                   	push   %ebx
+ 5ed:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 5f0:	8b 46 fc             	mov    -0x4(%esi),%eax
+ 5f3:	85 c0                	test   %eax,%eax
+ 5f5:	7e 15                	jle    60c <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 5f7:	83 ec 04             	sub    $0x4,%esp
+ 5fa:	50                   	push   %eax
+ 5fb:	56                   	push   %esi
+ 5fc:	57                   	push   %edi
+ 5fd:	e8 db 01 00 00       	call   7dd <write>
+    ob[fd].n = 0;
+ 602:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+ 609:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 60c:	83 c7 01             	add    $0x1,%edi
+ 60f:	81 c6 08 01 00 00    	add    $0x108,%esi
+ 615:	83 ff 10             	cmp    $0x10,%edi
+ 618:	75 d6                	jne    5f0 <gets+0x10>
+  for(i=0; i+1 < max; ){
+ 61a:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+ 61c:	8d 75 e7             	lea    -0x19(%ebp),%esi
+ 61f:	eb 2e                	jmp    64f <gets+0x6f>
+ 621:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 628:	83 ec 04             	sub    $0x4,%esp
+ 62b:	6a 01                	push   $0x1
+ 62d:	56                   	push   %esi
+ 62e:	6a 00                	push   $0x0
+ 630:	e8 a1 01 00 00       	call   7d6 <read>
+    if(cc < 1)
+ 635:	83 c4 10             	add    $0x10,%esp
+ 638:	85 c0                	test   %eax,%eax
+ 63a:	7e 1d                	jle    659 <gets+0x79>
+    buf[i++] = c;
+ 63c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 640:	8b 55 08             	mov    0x8(%ebp),%edx
+ 643:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 647:	3c 0a                	cmp    $0xa,%al
+ 649:	74 10                	je     65b <gets+0x7b>
+ 64b:	3c 0d                	cmp    $0xd,%al
+ 64d:	74 0c                	je     65b <gets+0x7b>
+  for(i=0; i+1 < max; ){
+ 64f:	89 df                	mov    %ebx,%edi
+ 651:	83 c3 01             	add    $0x1,%ebx
+ 654:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 657:	7c cf                	jl     628 <gets+0x48>
+ 659:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 65b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 65e:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 662:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 665:	5b                   	pop    %ebx
+ 666:	5e                   	pop    %esi
+ 667:	5f                   	pop    %edi
+ 668:	5d                   	pop    %ebp
+ 669:	c3                   	ret
+ 66a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000670 <stat>:
+{
+ 670:	55                   	push   %ebp
+ 671:	89 e5                	mov    %esp,%ebp
+ 673:	57                   	push   %edi
+ 674:	56                   	push   %esi
+ 675:	53                   	push   %ebx
+ 676:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+ 679:	6a 00                	push   $0x0
+ 67b:	ff 75 08             	push   0x8(%ebp)
+ 67e:	e8 76 01 00 00       	call   7f9 <open>
+  if(fd < 0)
+ 683:	83 c4 10             	add    $0x10,%esp
+ 686:	85 c0                	test   %eax,%eax
+ 688:	78 76                	js     700 <stat+0x90>
+  r = fstat(fd, st);
+ 68a:	83 ec 08             	sub    $0x8,%esp
+ 68d:	ff 75 0c             	push   0xc(%ebp)
+ 690:	89 c3                	mov    %eax,%ebx
+ 692:	50                   	push   %eax
+ 693:	e8 7f 01 00 00       	call   817 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 698:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 69b:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 69d:	83 fb 0f             	cmp    $0xf,%ebx
+ 6a0:	7f 40                	jg     6e2 <stat+0x72>
+ 6a2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 6a8:	8b 90 44 14 00 00    	mov    0x1444(%eax),%edx
+ 6ae:	8d b8 40 14 00 00    	lea    0x1440(%eax),%edi
+ 6b4:	85 d2                	test   %edx,%edx
+ 6b6:	7e 1a                	jle    6d2 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 6b8:	83 ec 04             	sub    $0x4,%esp
+ 6bb:	05 48 14 00 00       	add    $0x1448,%eax
+ 6c0:	52                   	push   %edx
+ 6c1:	50                   	push   %eax
+ 6c2:	53                   	push   %ebx
+ 6c3:	e8 15 01 00 00       	call   7dd <write>
+    ob[fd].n = 0;
+ 6c8:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+ 6cf:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+ 6d2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 6d8:	c7 80 40 14 00 00 00 	movl   $0x0,0x1440(%eax)
+ 6df:	00 00 00 
+  return _close(fd);
+ 6e2:	83 ec 0c             	sub    $0xc,%esp
+ 6e5:	53                   	push   %ebx
+ 6e6:	e8 f9 00 00 00       	call   7e4 <_close>
+ 6eb:	83 c4 10             	add    $0x10,%esp
+}
+ 6ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6f1:	89 f0                	mov    %esi,%eax
+ 6f3:	5b                   	pop    %ebx
+ 6f4:	5e                   	pop    %esi
+ 6f5:	5f                   	pop    %edi
+ 6f6:	5d                   	pop    %ebp
+ 6f7:	c3                   	ret
+ 6f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ff:	90                   	nop
+    return -1;
+ 700:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 705:	eb e7                	jmp    6ee <stat+0x7e>
+ 707:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70e:	66 90                	xchg   %ax,%ax
+
+00000710 <atoi>:
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	53                   	push   %ebx
+ 714:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 717:	0f be 02             	movsbl (%edx),%eax
+ 71a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 71d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 720:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 725:	77 1e                	ja     745 <atoi+0x35>
+ 727:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 72e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 730:	83 c2 01             	add    $0x1,%edx
+ 733:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 736:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 73a:	0f be 02             	movsbl (%edx),%eax
+ 73d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 740:	80 fb 09             	cmp    $0x9,%bl
+ 743:	76 eb                	jbe    730 <atoi+0x20>
+}
+ 745:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 748:	89 c8                	mov    %ecx,%eax
+ 74a:	c9                   	leave
+ 74b:	c3                   	ret
+ 74c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000750 <memmove>:
+{
+ 750:	55                   	push   %ebp
+ 751:	89 e5                	mov    %esp,%ebp
+ 753:	57                   	push   %edi
+ 754:	56                   	push   %esi
+ 755:	8b 45 10             	mov    0x10(%ebp),%eax
+ 758:	8b 55 08             	mov    0x8(%ebp),%edx
+ 75b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 75e:	85 c0                	test   %eax,%eax
+ 760:	7e 13                	jle    775 <memmove+0x25>
+ 762:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 764:	89 d7                	mov    %edx,%edi
+ 766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 770:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 771:	39 f8                	cmp    %edi,%eax
+ 773:	75 fb                	jne    770 <memmove+0x20>
+  return vdst;
+}
+ 775:	5e                   	pop    %esi
+ 776:	89 d0                	mov    %edx,%eax
+ 778:	5f                   	pop    %edi
+ 779:	5d                   	pop    %ebp
+ 77a:	c3                   	ret
+
+0000077b <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+ 77b:	83 3d 28 14 00 00 00 	cmpl   $0x0,0x1428
+  jle 1f
+ 782:	7e 0a                	jle    78e <syscallentry+0x13>
+  movl %esp, %ecx
+ 784:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 786:	ba 8d 07 00 00       	mov    $0x78d,%edx
+  sysenter
+ 78b:	0f 34                	sysenter
+2:
+  ret
+ 78d:	c3                   	ret
+1:
+  jl 3f
+ 78e:	7c 27                	jl     7b7 <syscallentry+0x3c>
+  pushal
+ 790:	60                   	pusha
+  movl $1, %eax
+ 791:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 796:	0f a2                	cpuid
+  movl $-1, sysentermode
+ 798:	c7 05 28 14 00 00 ff 	movl   $0xffffffff,0x1428
+ 79f:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 7a2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+ 7a8:	74 0a                	je     7b4 <syscallentry+0x39>
+  movl $1, sysentermode
+ 7aa:	c7 05 28 14 00 00 01 	movl   $0x1,0x1428
+ 7b1:	00 00 00 
+4:
+  popal
+ 7b4:	61                   	popa
+  jmp syscallentry
+ 7b5:	eb c4                	jmp    77b <syscallentry>
+3:
+  int $T_SYSCALL
+ 7b7:	cd 40                	int    $0x40
+  ret
+ 7b9:	c3                   	ret
+
+000007ba <_fork>:
+
+SYSCALLAS(_fork, fork)
+ 7ba:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7bf:	eb ba                	jmp    77b <syscallentry>
+
+000007c1 <_exit>:
+SYSCALLAS(_exit, exit)
+ 7c1:	b8 02 00 00 00       	mov    $0x2,%eax
+ 7c6:	eb b3                	jmp    77b <syscallentry>
+
+000007c8 <wait>:
+SYSCALL(wait)
+ 7c8:	b8 03 00 00 00       	mov    $0x3,%eax
+ 7cd:	eb ac                	jmp    77b <syscallentry>
+
+000007cf <pipe>:
+SYSCALL(pipe)
+ 7cf:	b8 04 00 00 00       	mov    $0x4,%eax
+ 7d4:	eb a5                	jmp    77b <syscallentry>
+
+000007d6 <read>:
+SYSCALL(read)
+ 7d6:	b8 05 00 00 00       	mov    $0x5,%eax
+ 7db:	eb 9e                	jmp    77b <syscallentry>
+
+000007dd <write>:
+SYSCALL(write)
+ 7dd:	b8 10 00 00 00       	mov    $0x10,%eax
+ 7e2:	eb 97                	jmp    77b <syscallentry>
+
+000007e4 <_close>:
+SYSCALLAS(_close, close)
+ 7e4:	b8 15 00 00 00       	mov    $0x15,%eax
+ 7e9:	eb 90                	jmp    77b <syscallentry>
+
+000007eb <kill>:
+SYSCALL(kill)
+ 7eb:	b8 06 00 00 00       	mov    $0x6,%eax
+ 7f0:	eb 89                	jmp    77b <syscallentry>
+
+000007f2 <_exec>:
+SYSCALLAS(_exec, exec)
+ 7f2:	b8 07 00 00 00       	mov    $0x7,%eax
+ 7f7:	eb 82                	jmp    77b <syscallentry>
+
+000007f9 <open>:
+SYSCALL(open)
+ 7f9:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 7fe:	e9 78 ff ff ff       	jmp    77b <syscallentry>
+
+00000803 <mknod>:
+SYSCALL(mknod)
+ 803:	b8 11 00 00 00       	mov    $0x11,%eax
+ 808:	e9 6e ff ff ff       	jmp    77b <syscallentry>
+
+0000080d <unlink>:
+SYSCALL(unlink)
+ 80d:	b8 12 00 00 00       	mov    $0x12,%eax
+ 812:	e9 64 ff ff ff       	jmp    77b <syscallentry>
+
+00000817 <fstat>:
+SYSCALL(fstat)
+ 817:	b8 08 00 00 00       	mov    $0x8,%eax
+ 81c:	e9 5a ff ff ff       	jmp    77b <syscallentry>
+
+00000821 <link>:
+SYSCALL(link)
+ 821:	b8 13 00 00 00       	mov    $0x13,%eax
+ 826:	e9 50 ff ff ff       	jmp    77b <syscallentry>
+
+0000082b <mkdir>:
+SYSCALL(mkdir)
+ 82b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 830:	e9 46 ff ff ff       	jmp    77b <syscallentry>
+
+00000835 <chdir>:
+SYSCALL(chdir)
+ 835:	b8 09 00 00 00       	mov    $0x9,%eax
+ 83a:	e9 3c ff ff ff       	jmp    77b <syscallentry>
+
+0000083f <dup>:
+SYSCALL(dup)
+ 83f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 844:	e9 32 ff ff ff       	jmp    77b <syscallentry>
+
+00000849 <getpid>:
+SYSCALL(getpid)
+ 849:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 84e:	e9 28 ff ff ff       	jmp    77b <syscallentry>
+
+00000853 <sbrk>:
+SYSCALL(sbrk)
+ 853:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 858:	e9 1e ff ff ff       	jmp    77b <syscallentry>
+
+0000085d <sleep>:
+SYSCALL(sleep)
+ 85d:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 862:	e9 14 ff ff ff       	jmp    77b <syscallentry>
+
+00000867 <uptime>:
+SYSCALL(uptime)
+ 867:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 86c:	e9 0a ff ff ff       	jmp    77b <syscallentry>
+
+00000871 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+ 871:	b8 16 00 00 00       	mov    $0x16,%eax
+ 876:	e9 00 ff ff ff       	jmp    77b <syscallentry>
+
+0000087b <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+ 87b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 880:	e9 f6 fe ff ff       	jmp    77b <syscallentry>
+
+00000885 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+ 885:	b8 18 00 00 00       	mov    $0x18,%eax
+ 88a:	e9 ec fe ff ff       	jmp    77b <syscallentry>
+
+0000088f <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+ 88f:	b8 19 00 00 00       	mov    $0x19,%eax
+ 894:	e9 e2 fe ff ff       	jmp    77b <syscallentry>
+
+00000899 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+ 899:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 89e:	e9 d8 fe ff ff       	jmp    77b <syscallentry>
+
+000008a3 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+ 8a3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 8a8:	e9 ce fe ff ff       	jmp    77b <syscallentry>
+
+000008ad <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+ 8ad:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 8b2:	e9 c4 fe ff ff       	jmp    77b <syscallentry>
+
+000008b7 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+ 8b7:	b8 20 00 00 00       	mov    $0x20,%eax
+ 8bc:	e9 ba fe ff ff       	jmp    77b <syscallentry>
+
+000008c1 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+ 8c1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 8c6:	e9 b0 fe ff ff       	jmp    77b <syscallentry>
+
+000008cb <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+ 8cb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 8d0:	e9 a6 fe ff ff       	jmp    77b <syscallentry>
+
+000008d5 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+ 8d5:	b8 21 00 00 00       	mov    $0x21,%eax
+ 8da:	e9 9c fe ff ff       	jmp    77b <syscallentry>
+
+000008df <yield>:
+SYSCALL(yield) // yield the CPU to another process
+ 8df:	b8 22 00 00 00       	mov    $0x22,%eax
+ 8e4:	e9 92 fe ff ff       	jmp    77b <syscallentry>
+
+000008e9 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+ 8e9:	b8 23 00 00 00       	mov    $0x23,%eax
+ 8ee:	e9 88 fe ff ff       	jmp    77b <syscallentry>
+
+000008f3 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+ 8f3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 8f8:	e9 7e fe ff ff       	jmp    77b <syscallentry>
+
+000008fd <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+ 8fd:	b8 25 00 00 00       	mov    $0x25,%eax
+ 902:	e9 74 fe ff ff       	jmp    77b <syscallentry>
+
+00000907 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+ 907:	b8 26 00 00 00       	mov    $0x26,%eax
+ 90c:	e9 6a fe ff ff       	jmp    77b <syscallentry>
+
+00000911 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+ 911:	b8 27 00 00 00       	mov    $0x27,%eax
+ 916:	e9 60 fe ff ff       	jmp    77b <syscallentry>
+
+0000091b <mmap>:
+SYSCALL(mmap) // map a file into memory
+ 91b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 920:	e9 56 fe ff ff       	jmp    77b <syscallentry>
+
+00000925 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+ 925:	b8 29 00 00 00       	mov    $0x29,%eax
+ 92a:	e9 4c fe ff ff       	jmp    77b <syscallentry>
+
+0000092f <readv>:
+SYSCALL(readv) // read into several buffers
+ 92f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 934:	e9 42 fe ff ff       	jmp    77b <syscallentry>
+
+00000939 <writev>:
+SYSCALL(writev) // write from several buffers
+ 939:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 93e:	e9 38 fe ff ff       	jmp    77b <syscallentry>
+
+00000943 <pread>:
+SYSCALL(pread) // read at an offset
+ 943:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 948:	e9 2e fe ff ff       	jmp    77b <syscallentry>
+
+0000094d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+ 94d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 952:	e9 24 fe ff ff       	jmp    77b <syscallentry>
+
+00000957 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+ 957:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 95c:	e9 1a fe ff ff       	jmp    77b <syscallentry>
+
+00000961 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+ 961:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 966:	e9 10 fe ff ff       	jmp    77b <syscallentry>
+
+0000096b <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+ 96b:	b8 30 00 00 00       	mov    $0x30,%eax
+ 970:	e9 06 fe ff ff       	jmp    77b <syscallentry>
+
+00000975 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+ 975:	b8 31 00 00 00       	mov    $0x31,%eax
+ 97a:	e9 fc fd ff ff       	jmp    77b <syscallentry>
+
+0000097f <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+ 97f:	b8 32 00 00 00       	mov    $0x32,%eax
+ 984:	e9 f2 fd ff ff       	jmp    77b <syscallentry>
+
+00000989 <profread>:
+SYSCALL(profread) // drain profiler samples
+ 989:	b8 33 00 00 00       	mov    $0x33,%eax
+ 98e:	e9 e8 fd ff ff       	jmp    77b <syscallentry>
+
+00000993 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+ 993:	b8 34 00 00 00       	mov    $0x34,%eax
+ 998:	e9 de fd ff ff       	jmp    77b <syscallentry>
+
+0000099d <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+ 99d:	b8 35 00 00 00       	mov    $0x35,%eax
+ 9a2:	e9 d4 fd ff ff       	jmp    77b <syscallentry>
+
+000009a7 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+ 9a7:	b8 36 00 00 00       	mov    $0x36,%eax
+ 9ac:	e9 ca fd ff ff       	jmp    77b <syscallentry>
+
+000009b1 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+ 9b1:	b8 37 00 00 00       	mov    $0x37,%eax
+ 9b6:	e9 c0 fd ff ff       	jmp    77b <syscallentry>
+ 9bb:	66 90                	xchg   %ax,%ax
+ 9bd:	66 90                	xchg   %ax,%ax
+ 9bf:	90                   	nop
+
+000009c0 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 9c0:	55                   	push   %ebp
+ 9c1:	89 e5                	mov    %esp,%ebp
+ 9c3:	57                   	push   %edi
+ 9c4:	56                   	push   %esi
+ 9c5:	53                   	push   %ebx
+ 9c6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 9c8:	89 d1                	mov    %edx,%ecx
+{
+ 9ca:	83 ec 3c             	sub    $0x3c,%esp
+ 9cd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 9d0:	85 d2                	test   %edx,%edx
+ 9d2:	0f 89 80 00 00 00    	jns    a58 <printint+0x98>
+ 9d8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 9dc:	74 7a                	je     a58 <printint+0x98>
+    x = -xx;
+ 9de:	f7 d9                	neg    %ecx
+    neg = 1;
+ 9e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 9e5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 9e8:	31 f6                	xor    %esi,%esi
+ 9ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 9f0:	89 c8                	mov    %ecx,%eax
+ 9f2:	31 d2                	xor    %edx,%edx
+ 9f4:	89 f7                	mov    %esi,%edi
+ 9f6:	f7 f3                	div    %ebx
+ 9f8:	8d 76 01             	lea    0x1(%esi),%esi
+ 9fb:	0f b6 92 94 0f 00 00 	movzbl 0xf94(%edx),%edx
+ a02:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ a06:	89 ca                	mov    %ecx,%edx
+ a08:	89 c1                	mov    %eax,%ecx
+ a0a:	39 da                	cmp    %ebx,%edx
+ a0c:	73 e2                	jae    9f0 <printint+0x30>
+  if(neg)
+ a0e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ a11:	85 c0                	test   %eax,%eax
+ a13:	74 07                	je     a1c <printint+0x5c>
+    buf[i++] = '-';
+ a15:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ a1a:	89 f7                	mov    %esi,%edi
+ a1c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ a1f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ a22:	01 df                	add    %ebx,%edi
+ a24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ a28:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+ a2b:	83 ec 04             	sub    $0x4,%esp
+ a2e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ a31:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ a34:	6a 01                	push   $0x1
+ a36:	50                   	push   %eax
+ a37:	56                   	push   %esi
+ a38:	e8 e3 f6 ff ff       	call   120 <bufwrite>
+  while(--i >= 0)
+ a3d:	89 f8                	mov    %edi,%eax
+ a3f:	83 c4 10             	add    $0x10,%esp
+ a42:	83 ef 01             	sub    $0x1,%edi
+ a45:	39 d8                	cmp    %ebx,%eax
+ a47:	75 df                	jne    a28 <printint+0x68>
+}
+ a49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a4c:	5b                   	pop    %ebx
+ a4d:	5e                   	pop    %esi
+ a4e:	5f                   	pop    %edi
+ a4f:	5d                   	pop    %ebp
+ a50:	c3                   	ret
+ a51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ a58:	31 c0                	xor    %eax,%eax
+ a5a:	eb 89                	jmp    9e5 <printint+0x25>
+ a5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a60 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ a60:	55                   	push   %ebp
+ a61:	89 e5                	mov    %esp,%ebp
+ a63:	57                   	push   %edi
+ a64:	56                   	push   %esi
+ a65:	53                   	push   %ebx
+ a66:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ a69:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a6c:	0f b6 18             	movzbl (%eax),%ebx
+ a6f:	84 db                	test   %bl,%bl
+ a71:	74 6c                	je     adf <printf+0x7f>
+ a73:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+ a76:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ a79:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ a7b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ a7e:	eb 26                	jmp    aa6 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ a80:	83 f8 25             	cmp    $0x25,%eax
+ a83:	74 4b                	je     ad0 <printf+0x70>
+  bufwrite(fd, &c, 1);
+ a85:	83 ec 04             	sub    $0x4,%esp
+ a88:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ a8b:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ a8e:	6a 01                	push   $0x1
+ a90:	50                   	push   %eax
+ a91:	ff 75 08             	push   0x8(%ebp)
+ a94:	e8 87 f6 ff ff       	call   120 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+ a99:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ a9c:	0f b6 1f             	movzbl (%edi),%ebx
+ a9f:	83 c7 01             	add    $0x1,%edi
+ aa2:	84 db                	test   %bl,%bl
+ aa4:	74 39                	je     adf <printf+0x7f>
+    c = fmt[i] & 0xff;
+ aa6:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ aa9:	85 f6                	test   %esi,%esi
+ aab:	74 d3                	je     a80 <printf+0x20>
+      }
+    } else if(state == '%'){
+ aad:	83 fe 25             	cmp    $0x25,%esi
+ ab0:	75 ea                	jne    a9c <printf+0x3c>
+      if(c == 'd'){
+ ab2:	83 f8 25             	cmp    $0x25,%eax
+ ab5:	0f 84 d5 01 00 00    	je     c90 <printf+0x230>
+ abb:	83 e8 63             	sub    $0x63,%eax
+ abe:	83 f8 15             	cmp    $0x15,%eax
+ ac1:	77 45                	ja     b08 <printf+0xa8>
+ ac3:	ff 24 85 3c 0f 00 00 	jmp    *0xf3c(,%eax,4)
+ aca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+ ad0:	0f b6 1f             	movzbl (%edi),%ebx
+ ad3:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+ ad6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ adb:	84 db                	test   %bl,%bl
+ add:	75 c7                	jne    aa6 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+ adf:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+ ae3:	74 0b                	je     af0 <printf+0x90>
+    fflush(fd);
+}
+ ae5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ae8:	5b                   	pop    %ebx
+ ae9:	5e                   	pop    %esi
+ aea:	5f                   	pop    %edi
+ aeb:	5d                   	pop    %ebp
+ aec:	c3                   	ret
+ aed:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+ af0:	83 ec 0c             	sub    $0xc,%esp
+ af3:	6a 02                	push   $0x2
+ af5:	e8 c6 f7 ff ff       	call   2c0 <fflush>
+ afa:	83 c4 10             	add    $0x10,%esp
+}
+ afd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b00:	5b                   	pop    %ebx
+ b01:	5e                   	pop    %esi
+ b02:	5f                   	pop    %edi
+ b03:	5d                   	pop    %ebp
+ b04:	c3                   	ret
+ b05:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+ b08:	83 ec 04             	sub    $0x4,%esp
+ b0b:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ b0e:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+ b12:	6a 01                	push   $0x1
+ b14:	52                   	push   %edx
+ b15:	89 55 c0             	mov    %edx,-0x40(%ebp)
+ b18:	ff 75 08             	push   0x8(%ebp)
+ b1b:	e8 00 f6 ff ff       	call   120 <bufwrite>
+ b20:	83 c4 0c             	add    $0xc,%esp
+ b23:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ b26:	6a 01                	push   $0x1
+ b28:	8b 55 c0             	mov    -0x40(%ebp),%edx
+ b2b:	52                   	push   %edx
+      state = 0;
+ b2c:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+ b2e:	ff 75 08             	push   0x8(%ebp)
+ b31:	e8 ea f5 ff ff       	call   120 <bufwrite>
+        putc(fd, c);
+ b36:	83 c4 10             	add    $0x10,%esp
+ b39:	e9 5e ff ff ff       	jmp    a9c <printf+0x3c>
+ b3e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+ b40:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ b43:	83 ec 0c             	sub    $0xc,%esp
+ b46:	b9 10 00 00 00       	mov    $0x10,%ecx
+ b4b:	8b 16                	mov    (%esi),%edx
+ b4d:	6a 00                	push   $0x0
+ b4f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+ b52:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+ b55:	e8 66 fe ff ff       	call   9c0 <printint>
+        ap++;
+ b5a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ b5d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b60:	31 f6                	xor    %esi,%esi
+ b62:	e9 35 ff ff ff       	jmp    a9c <printf+0x3c>
+ b67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b6e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+ b70:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ b73:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ b75:	83 c0 04             	add    $0x4,%eax
+ b78:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+ b7b:	b8 33 0f 00 00       	mov    $0xf33,%eax
+ b80:	85 db                	test   %ebx,%ebx
+ b82:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+ b85:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+ b88:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+ b8a:	53                   	push   %ebx
+ b8b:	e8 90 f9 ff ff       	call   520 <strlen>
+ b90:	83 c4 0c             	add    $0xc,%esp
+ b93:	50                   	push   %eax
+ b94:	53                   	push   %ebx
+ b95:	ff 75 08             	push   0x8(%ebp)
+ b98:	e8 83 f5 ff ff       	call   120 <bufwrite>
+ b9d:	83 c4 10             	add    $0x10,%esp
+ ba0:	e9 f7 fe ff ff       	jmp    a9c <printf+0x3c>
+ ba5:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ ba8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+ bab:	83 ec 04             	sub    $0x4,%esp
+ bae:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+ bb1:	8b 06                	mov    (%esi),%eax
+        ap++;
+ bb3:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+ bb6:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+ bb9:	6a 01                	push   $0x1
+ bbb:	52                   	push   %edx
+ bbc:	ff 75 08             	push   0x8(%ebp)
+ bbf:	e8 5c f5 ff ff       	call   120 <bufwrite>
+        ap++;
+ bc4:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ bc7:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ bca:	31 f6                	xor    %esi,%esi
+ bcc:	e9 cb fe ff ff       	jmp    a9c <printf+0x3c>
+ bd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+ bd8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ bdb:	83 ec 0c             	sub    $0xc,%esp
+ bde:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ be3:	8b 16                	mov    (%esi),%edx
+ be5:	6a 01                	push   $0x1
+ be7:	e9 63 ff ff ff       	jmp    b4f <printf+0xef>
+ bec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+ bf0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ bf3:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ bf6:	89 7d c0             	mov    %edi,-0x40(%ebp)
+ bf9:	89 55 bc             	mov    %edx,-0x44(%ebp)
+ bfc:	8b 18                	mov    (%eax),%ebx
+ bfe:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+ c01:	31 c0                	xor    %eax,%eax
+ c03:	89 c7                	mov    %eax,%edi
+ c05:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+ c08:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+ c0d:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+ c0f:	f7 e1                	mul    %ecx
+ c11:	c1 ea 03             	shr    $0x3,%edx
+ c14:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ c17:	89 d1                	mov    %edx,%ecx
+ c19:	01 c0                	add    %eax,%eax
+ c1b:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ c1d:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+ c1f:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ c21:	be 0a 00 00 00       	mov    $0xa,%esi
+ c26:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+ c28:	89 da                	mov    %ebx,%edx
+ c2a:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+ c2c:	89 fe                	mov    %edi,%esi
+ c2e:	83 c7 01             	add    $0x1,%edi
+ c31:	8d 42 30             	lea    0x30(%edx),%eax
+ c34:	89 da                	mov    %ebx,%edx
+ c36:	8d 14 92             	lea    (%edx,%edx,4),%edx
+ c39:	01 d2                	add    %edx,%edx
+ c3b:	29 d0                	sub    %edx,%eax
+ c3d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+ c41:	89 c8                	mov    %ecx,%eax
+ c43:	09 d8                	or     %ebx,%eax
+ c45:	75 c1                	jne    c08 <printf+0x1a8>
+ c47:	8b 55 bc             	mov    -0x44(%ebp),%edx
+ c4a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ c4d:	01 d6                	add    %edx,%esi
+ c4f:	89 f7                	mov    %esi,%edi
+ c51:	89 d6                	mov    %edx,%esi
+ c53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c57:	90                   	nop
+    putc(fd, buf[i]);
+ c58:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+ c5b:	83 ec 04             	sub    $0x4,%esp
+ c5e:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+ c61:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+ c64:	6a 01                	push   $0x1
+ c66:	50                   	push   %eax
+ c67:	53                   	push   %ebx
+ c68:	e8 b3 f4 ff ff       	call   120 <bufwrite>
+  while(--i >= 0)
+ c6d:	89 fa                	mov    %edi,%edx
+ c6f:	83 c4 10             	add    $0x10,%esp
+ c72:	83 ef 01             	sub    $0x1,%edi
+ c75:	39 d6                	cmp    %edx,%esi
+ c77:	75 df                	jne    c58 <printf+0x1f8>
+        ap += 2;
+ c79:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+ c7d:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+ c80:	31 f6                	xor    %esi,%esi
+ c82:	e9 15 fe ff ff       	jmp    a9c <printf+0x3c>
+ c87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c8e:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+ c90:	83 ec 04             	sub    $0x4,%esp
+ c93:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ c96:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ c99:	6a 01                	push   $0x1
+ c9b:	e9 8b fe ff ff       	jmp    b2b <printf+0xcb>
+
+00000ca0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ ca0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ca1:	a1 c0 24 00 00       	mov    0x24c0,%eax
+{
+ ca6:	89 e5                	mov    %esp,%ebp
+ ca8:	57                   	push   %edi
+ ca9:	56                   	push   %esi
+ caa:	53                   	push   %ebx
+ cab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ cae:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cb8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cba:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cbc:	39 ca                	cmp    %ecx,%edx
+ cbe:	73 30                	jae    cf0 <free+0x50>
+ cc0:	39 c1                	cmp    %eax,%ecx
+ cc2:	72 04                	jb     cc8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cc4:	39 c2                	cmp    %eax,%edx
+ cc6:	72 f0                	jb     cb8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ cc8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ ccb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ cce:	39 f8                	cmp    %edi,%eax
+ cd0:	74 2e                	je     d00 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ cd2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ cd5:	8b 42 04             	mov    0x4(%edx),%eax
+ cd8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ cdb:	39 f1                	cmp    %esi,%ecx
+ cdd:	74 38                	je     d17 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ cdf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ ce1:	5b                   	pop    %ebx
+  freep = p;
+ ce2:	89 15 c0 24 00 00    	mov    %edx,0x24c0
+}
+ ce8:	5e                   	pop    %esi
+ ce9:	5f                   	pop    %edi
+ cea:	5d                   	pop    %ebp
+ ceb:	c3                   	ret
+ cec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cf0:	39 c1                	cmp    %eax,%ecx
+ cf2:	72 d0                	jb     cc4 <free+0x24>
+ cf4:	eb c2                	jmp    cb8 <free+0x18>
+ cf6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cfd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ d00:	03 70 04             	add    0x4(%eax),%esi
+ d03:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d06:	8b 02                	mov    (%edx),%eax
+ d08:	8b 00                	mov    (%eax),%eax
+ d0a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ d0d:	8b 42 04             	mov    0x4(%edx),%eax
+ d10:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d13:	39 f1                	cmp    %esi,%ecx
+ d15:	75 c8                	jne    cdf <free+0x3f>
+    p->s.size += bp->s.size;
+ d17:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ d1a:	89 15 c0 24 00 00    	mov    %edx,0x24c0
+    p->s.size += bp->s.size;
+ d20:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ d23:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ d26:	89 0a                	mov    %ecx,(%edx)
+}
+ d28:	5b                   	pop    %ebx
+ d29:	5e                   	pop    %esi
+ d2a:	5f                   	pop    %edi
+ d2b:	5d                   	pop    %ebp
+ d2c:	c3                   	ret
+ d2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d30 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ d30:	55                   	push   %ebp
+ d31:	89 e5                	mov    %esp,%ebp
+ d33:	57                   	push   %edi
+ d34:	56                   	push   %esi
+ d35:	53                   	push   %ebx
+ d36:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d39:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ d3c:	8b 15 c0 24 00 00    	mov    0x24c0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d42:	8d 78 07             	lea    0x7(%eax),%edi
+ d45:	c1 ef 03             	shr    $0x3,%edi
+ d48:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ d4b:	85 d2                	test   %edx,%edx
+ d4d:	0f 84 8d 00 00 00    	je     de0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d53:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d55:	8b 48 04             	mov    0x4(%eax),%ecx
+ d58:	39 f9                	cmp    %edi,%ecx
+ d5a:	73 64                	jae    dc0 <malloc+0x90>
+  if(nu < 4096)
+ d5c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ d61:	39 df                	cmp    %ebx,%edi
+ d63:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ d66:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ d6d:	eb 0a                	jmp    d79 <malloc+0x49>
+ d6f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d70:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d72:	8b 48 04             	mov    0x4(%eax),%ecx
+ d75:	39 f9                	cmp    %edi,%ecx
+ d77:	73 47                	jae    dc0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ d79:	89 c2                	mov    %eax,%edx
+ d7b:	39 05 c0 24 00 00    	cmp    %eax,0x24c0
+ d81:	75 ed                	jne    d70 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ d83:	83 ec 0c             	sub    $0xc,%esp
+ d86:	56                   	push   %esi
+ d87:	e8 c7 fa ff ff       	call   853 <sbrk>
+  if(p == (char*)-1)
+ d8c:	83 c4 10             	add    $0x10,%esp
+ d8f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ d92:	74 1c                	je     db0 <malloc+0x80>
+  hp->s.size = nu;
+ d94:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ d97:	83 ec 0c             	sub    $0xc,%esp
+ d9a:	83 c0 08             	add    $0x8,%eax
+ d9d:	50                   	push   %eax
+ d9e:	e8 fd fe ff ff       	call   ca0 <free>
+  return freep;
+ da3:	8b 15 c0 24 00 00    	mov    0x24c0,%edx
+      if((p = morecore(nunits)) == 0)
+ da9:	83 c4 10             	add    $0x10,%esp
+ dac:	85 d2                	test   %edx,%edx
+ dae:	75 c0                	jne    d70 <malloc+0x40>
+        return 0;
+  }
+}
+ db0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ db3:	31 c0                	xor    %eax,%eax
+}
+ db5:	5b                   	pop    %ebx
+ db6:	5e                   	pop    %esi
+ db7:	5f                   	pop    %edi
+ db8:	5d                   	pop    %ebp
+ db9:	c3                   	ret
+ dba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ dc0:	39 cf                	cmp    %ecx,%edi
+ dc2:	74 4c                	je     e10 <malloc+0xe0>
+        p->s.size -= nunits;
+ dc4:	29 f9                	sub    %edi,%ecx
+ dc6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ dc9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ dcc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ dcf:	89 15 c0 24 00 00    	mov    %edx,0x24c0
+}
+ dd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ dd8:	83 c0 08             	add    $0x8,%eax
+}
+ ddb:	5b                   	pop    %ebx
+ ddc:	5e                   	pop    %esi
+ ddd:	5f                   	pop    %edi
+ dde:	5d                   	pop    %ebp
+ ddf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ de0:	c7 05 c0 24 00 00 c4 	movl   $0x24c4,0x24c0
+ de7:	24 00 00 
+    base.s.size = 0;
+ dea:	b8 c4 24 00 00       	mov    $0x24c4,%eax
+    base.s.ptr = freep = prevp = &base;
+ def:	c7 05 c4 24 00 00 c4 	movl   $0x24c4,0x24c4
+ df6:	24 00 00 
+    base.s.size = 0;
+ df9:	c7 05 c8 24 00 00 00 	movl   $0x0,0x24c8
+ e00:	00 00 00 
+    if(p->s.size >= nunits){
+ e03:	e9 54 ff ff ff       	jmp    d5c <malloc+0x2c>
+ e08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e0f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ e10:	8b 08                	mov    (%eax),%ecx
+ e12:	89 0a                	mov    %ecx,(%edx)
+ e14:	eb b9                	jmp    dcf <malloc+0x9f>
+ e16:	66 90                	xchg   %ax,%ax
+ e18:	66 90                	xchg   %ax,%ax
+ e1a:	66 90                	xchg   %ax,%ax
+ e1c:	66 90                	xchg   %ax,%ax
+ e1e:	66 90                	xchg   %ax,%ax
+
+00000e20 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+ e20:	55                   	push   %ebp
+ e21:	89 e5                	mov    %esp,%ebp
+ e23:	57                   	push   %edi
+ e24:	56                   	push   %esi
+ e25:	be 01 00 00 00       	mov    $0x1,%esi
+ e2a:	53                   	push   %ebx
+ e2b:	83 ec 28             	sub    $0x28,%esp
+ e2e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ e31:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ e34:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+ e37:	68 00 98 00 00       	push   $0x9800
+ e3c:	e8 ef fe ff ff       	call   d30 <malloc>
+ e41:	83 c4 10             	add    $0x10,%esp
+ e44:	89 c7                	mov    %eax,%edi
+ e46:	85 c0                	test   %eax,%eax
+ e48:	74 62                	je     eac <waitpoll+0x8c>
+ e4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+ e50:	83 ec 0c             	sub    $0xc,%esp
+ e53:	6a 01                	push   $0x1
+ e55:	e8 03 fa ff ff       	call   85d <sleep>
+    fn();
+ e5a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ e5d:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+ e5f:	58                   	pop    %eax
+ e60:	5a                   	pop    %edx
+ e61:	68 00 02 00 00       	push   $0x200
+ e66:	57                   	push   %edi
+ e67:	e8 eb fa ff ff       	call   957 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+ e6c:	83 c4 10             	add    $0x10,%esp
+ e6f:	85 c0                	test   %eax,%eax
+ e71:	7e 2d                	jle    ea0 <waitpoll+0x80>
+ e73:	6b c0 4c             	imul   $0x4c,%eax,%eax
+ e76:	89 fa                	mov    %edi,%edx
+    alive = 0;
+ e78:	31 c9                	xor    %ecx,%ecx
+ e7a:	01 f8                	add    %edi,%eax
+ e7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+ e80:	3b 1a                	cmp    (%edx),%ebx
+ e82:	75 07                	jne    e8b <waitpoll+0x6b>
+        alive = 1;
+ e84:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+ e88:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+ e8b:	83 c2 4c             	add    $0x4c,%edx
+ e8e:	39 d0                	cmp    %edx,%eax
+ e90:	75 ee                	jne    e80 <waitpoll+0x60>
+  } while(alive);
+ e92:	85 c9                	test   %ecx,%ecx
+ e94:	75 ba                	jne    e50 <waitpoll+0x30>
+ e96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e9d:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+ ea0:	83 ec 0c             	sub    $0xc,%esp
+ ea3:	57                   	push   %edi
+ ea4:	e8 f7 fd ff ff       	call   ca0 <free>
+  wait();
+ ea9:	83 c4 10             	add    $0x10,%esp
+}
+ eac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ eaf:	5b                   	pop    %ebx
+ eb0:	5e                   	pop    %esi
+ eb1:	5f                   	pop    %edi
+ eb2:	5d                   	pop    %ebp
+  wait();
+ eb3:	e9 10 f9 ff ff       	jmp    7c8 <wait>
+ eb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ebf:	90                   	nop
+
+00000ec0 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+ ec0:	55                   	push   %ebp
+ ec1:	89 e5                	mov    %esp,%ebp
+ ec3:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+ ec6:	c7 45 f0 a5 0f 00 00 	movl   $0xfa5,-0x10(%ebp)
+ ecd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+ ed4:	e8 87 f4 ff ff       	call   360 <fork>
+ ed9:	85 c0                	test   %eax,%eax
+ edb:	78 09                	js     ee6 <runps+0x26>
+    return -1;
+  if(pid == 0){
+ edd:	74 0e                	je     eed <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+ edf:	e8 e4 f8 ff ff       	call   7c8 <wait>
+}
+ ee4:	c9                   	leave
+ ee5:	c3                   	ret
+ ee6:	c9                   	leave
+    return -1;
+ ee7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ eec:	c3                   	ret
+    exec("ps", argv);
+ eed:	50                   	push   %eax
+ eee:	50                   	push   %eax
+ eef:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ ef2:	50                   	push   %eax
+ ef3:	68 a5 0f 00 00       	push   $0xfa5
+ ef8:	e8 c3 f4 ff ff       	call   3c0 <exec>
+    printf(2, "exec ps failed\n");
+ efd:	5a                   	pop    %edx
+ efe:	59                   	pop    %ecx
+ eff:	68 a8 0f 00 00       	push   $0xfa8
+ f04:	6a 02                	push   $0x2
+ f06:	e8 55 fb ff ff       	call   a60 <printf>
+    exit();
+ f0b:	e8 a0 f4 ff ff       	call   3b0 <exit>
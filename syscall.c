@@ -6,6 +6,7 @@
 #include "proc.h"
 #include "x86.h"
 #include "syscall.h"
+#include "trace.h"
 
 // User code makes a system call with INT T_SYSCALL.
 // System call number in %eax.
@@ -52,6 +53,21 @@ argint(int n, int *ip)
   return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
 }
 
+// Check that the user buffer [addr, addr+size) is valid, for
+// the kernel to write to if write is set, or only read.
+// Faults in any part of it that is in an mmap()ed region.
+int
+fetchbuf(uint addr, int size, int write)
+{
+  struct proc *curproc = myproc();
+
+  if(size < 0)
+    return -1;
+  if(addr >= curproc->sz || addr+size > curproc->sz)
+    return mmapcheck(curproc, addr, size, write);
+  return 0;
+}
+
 // Fetch the nth word-sized system call argument as a pointer
 // to a block of memory of size bytes.  Check that the pointer
 // lies within the process address space.
@@ -59,11 +75,21 @@ int
 argptr(int n, char **pp, int size)
 {
   int i;
-  struct proc *curproc = myproc();
- 
-  if(argint(n, &i) < 0)
+
+  if(argint(n, &i) < 0 || fetchbuf(i, size, 1) < 0)
     return -1;
-  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+  *pp = (char*)i;
+  return 0;
+}
+
+// Like argptr(), for a buffer the kernel only reads,
+// which may also be in a read-only mmap()ed region.
+int
+argptr_ro(int n, char **pp, int size)
+{
+  int i;
+
+  if(argint(n, &i) < 0 || fetchbuf(i, size, 0) < 0)
     return -1;
   *pp = (char*)i;
   return 0;
@@ -110,11 +136,31 @@ extern int sys_getnumsyscalls(void);
 extern int sys_getnumsyscallsgood(void);
 extern int sys_waitx(void);
 extern int sys_set_priority(void);
-extern int sys_ps(void);  // Add ps syscall
 extern int sys_test_rr(void);
 extern int sys_setschedpolicy(void); // Add extern for new syscall
 extern int sys_set_burst_estimate(void);
 extern int sys_yield(void); // Add with other extern declarations
+extern int sys_setidemode(void);
+extern int sys_logstat(void);
+extern int sys_fsync(void);
+extern int sys_copy_file_range(void);
+extern int sys_icachestat(void);
+extern int sys_mmap(void);
+extern int sys_munmap(void);
+extern int sys_readv(void);
+extern int sys_writev(void);
+extern int sys_pread(void);
+extern int sys_pwrite(void);
+extern int sys_getprocinfo(void);
+extern int sys_schedlat(void);
+extern int sys_tracectl(void);
+extern int sys_traceread(void);
+extern int sys_profctl(void);
+extern int sys_profread(void);
+extern int sys_lockstat(void);
+extern int sys_lockbench(void);
+extern int sys_fsfree(void);
+extern int sys_mkhdir(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -146,11 +192,31 @@ static int (*syscalls[])(void) = {
 [SYS_getnumsyscallsgood]  sys_getnumsyscallsgood,
 [SYS_waitx]    sys_waitx,
 [SYS_set_priority] sys_set_priority,
-[SYS_ps]      sys_ps,  // Add ps syscall
 [SYS_test_rr] sys_test_rr,
 [SYS_setschedpolicy] sys_setschedpolicy, // Add entry for new syscall
 [SYS_set_burst_estimate] sys_set_burst_estimate,
 [SYS_yield]    sys_yield,
+[SYS_setidemode] sys_setidemode,
+[SYS_logstat] sys_logstat,
+[SYS_fsync]   sys_fsync,
+[SYS_copy_file_range] sys_copy_file_range,
+[SYS_icachestat] sys_icachestat,
+[SYS_mmap]    sys_mmap,
+[SYS_munmap]  sys_munmap,
+[SYS_readv]   sys_readv,
+[SYS_writev]  sys_writev,
+[SYS_pread]   sys_pread,
+[SYS_pwrite]  sys_pwrite,
+[SYS_getprocinfo] sys_getprocinfo,
+[SYS_schedlat] sys_schedlat,
+[SYS_tracectl] sys_tracectl,
+[SYS_traceread] sys_traceread,
+[SYS_profctl] sys_profctl,
+[SYS_profread] sys_profread,
+[SYS_lockstat] sys_lockstat,
+[SYS_lockbench] sys_lockbench,
+[SYS_fsfree]  sys_fsfree,
+[SYS_mkhdir]  sys_mkhdir,
 };
 
 void
@@ -165,7 +231,9 @@ syscall(void)
     if (curproc->pid > 0)
       curproc->syscall_count++;
     
+    trace(TR_SYSCALL, curproc->pid, num);
     ret = syscalls[num]();
+    trace(TR_SYSRET, curproc->pid, num);
     
     if (ret >= 0 && curproc->pid > 0)
       curproc->good_syscall_count++;
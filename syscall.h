@@ -28,8 +28,28 @@
 #define SYS_getnumsyscallsgood 27
 #define SYS_waitx 28
 #define SYS_set_priority 29
-#define SYS_ps      30
 #define SYS_test_rr 31  // New system call for testing RR
 #define SYS_setschedpolicy 32 // New system call for setting scheduling policy
 #define SYS_set_burst_estimate 33
 #define SYS_yield     34
+#define SYS_setidemode 35
+#define SYS_logstat 36
+#define SYS_fsync 37
+#define SYS_copy_file_range 38
+#define SYS_icachestat 39
+#define SYS_mmap 40
+#define SYS_munmap 41
+#define SYS_readv 42
+#define SYS_writev 43
+#define SYS_pread 44
+#define SYS_pwrite 45
+#define SYS_getprocinfo 46
+#define SYS_schedlat 47
+#define SYS_tracectl 48
+#define SYS_traceread 49
+#define SYS_profctl 50
+#define SYS_profread 51
+#define SYS_lockstat 52
+#define SYS_lockbench 53
+#define SYS_fsfree 54
+#define SYS_mkhdir 55
@@ -0,0 +1,2120 @@
+
+_syscallbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%s: %d cycles per call\n", name, (uint)div64(t, n));
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	be a0 86 01 00       	mov    $0x186a0,%esi
+  13:	53                   	push   %ebx
+  14:	51                   	push   %ecx
+  15:	83 ec 0c             	sub    $0xc,%esp
+  uint eax, ebx, ecx, edx;
+  int n;
+
+  n = argc > 1 ? atoi(argv[1]) : 100000;
+  18:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  1b:	8b 41 04             	mov    0x4(%ecx),%eax
+  n = argc > 1 ? atoi(argv[1]) : 100000;
+  1e:	7e 1a                	jle    3a <main+0x3a>
+  20:	83 ec 0c             	sub    $0xc,%esp
+  23:	ff 70 04             	push   0x4(%eax)
+  26:	e8 55 07 00 00       	call   780 <atoi>
+  if(n <= 0)
+  2b:	ba 01 00 00 00       	mov    $0x1,%edx
+  30:	85 c0                	test   %eax,%eax
+  32:	0f 4f d0             	cmovg  %eax,%edx
+  35:	83 c4 10             	add    $0x10,%esp
+  38:	89 d6                	mov    %edx,%esi
+    n = 1;
+
+  run("getpid int", intcall, SYS_getpid, n);
+  3a:	56                   	push   %esi
+  3b:	6a 0b                	push   $0xb
+  3d:	68 e0 00 00 00       	push   $0xe0
+  42:	68 98 0f 00 00       	push   $0xf98
+  47:	e8 c4 00 00 00       	call   110 <run>
+  run("yield int", intcall, SYS_yield, n);
+  4c:	56                   	push   %esi
+  4d:	6a 22                	push   $0x22
+  4f:	68 e0 00 00 00       	push   $0xe0
+  54:	68 a3 0f 00 00       	push   $0xfa3
+  59:	e8 b2 00 00 00       	call   110 <run>
+}
+
+static inline void
+cpuinfo(uint op, uint *eax, uint *ebx, uint *ecx, uint *edx)
+{
+  asm volatile("cpuid" :
+  5e:	b8 01 00 00 00       	mov    $0x1,%eax
+  63:	0f a2                	cpuid
+
+  cpuinfo(1, &eax, &ebx, &ecx, &edx);
+  if((edx & CPUID_SEP) == 0){
+  65:	83 c4 20             	add    $0x20,%esp
+  68:	80 e6 08             	and    $0x8,%dh
+  6b:	75 13                	jne    80 <main+0x80>
+    printf(1, "syscallbench: no sysenter on this cpu\n");
+  6d:	52                   	push   %edx
+  6e:	52                   	push   %edx
+  6f:	68 cc 0f 00 00       	push   $0xfcc
+  74:	6a 01                	push   $0x1
+  76:	e8 55 0a 00 00       	call   ad0 <printf>
+    exit();
+  7b:	e8 a0 03 00 00       	call   420 <exit>
+  asm volatile("movl %%esp, %%ecx\n"
+  80:	b8 0b 00 00 00       	mov    $0xb,%eax
+  85:	89 e1                	mov    %esp,%ecx
+  87:	ba 8e 00 00 00       	mov    $0x8e,%edx
+  8c:	0f 34                	sysenter
+  8e:	89 c3                	mov    %eax,%ebx
+  }
+  if(sysentercall(SYS_getpid) != getpid()){
+  90:	e8 24 08 00 00       	call   8b9 <getpid>
+  95:	39 d8                	cmp    %ebx,%eax
+  97:	74 13                	je     ac <main+0xac>
+    printf(2, "syscallbench: sysenter getpid is wrong\n");
+  99:	50                   	push   %eax
+  9a:	50                   	push   %eax
+  9b:	68 f4 0f 00 00       	push   $0xff4
+  a0:	6a 02                	push   $0x2
+  a2:	e8 29 0a 00 00       	call   ad0 <printf>
+    exit();
+  a7:	e8 74 03 00 00       	call   420 <exit>
+  }
+  run("getpid sysenter", sysentercall, SYS_getpid, n);
+  ac:	56                   	push   %esi
+  ad:	6a 0b                	push   $0xb
+  af:	68 f0 00 00 00       	push   $0xf0
+  b4:	68 ad 0f 00 00       	push   $0xfad
+  b9:	e8 52 00 00 00       	call   110 <run>
+  run("yield sysenter", sysentercall, SYS_yield, n);
+  be:	56                   	push   %esi
+  bf:	6a 22                	push   $0x22
+  c1:	68 f0 00 00 00       	push   $0xf0
+  c6:	68 bd 0f 00 00       	push   $0xfbd
+  cb:	e8 40 00 00 00       	call   110 <run>
+  exit();
+  d0:	83 c4 20             	add    $0x20,%esp
+  d3:	e8 48 03 00 00       	call   420 <exit>
+  d8:	66 90                	xchg   %ax,%ax
+  da:	66 90                	xchg   %ax,%ax
+  dc:	66 90                	xchg   %ax,%ax
+  de:	66 90                	xchg   %ax,%ax
+
+000000e0 <intcall>:
+{
+  e0:	55                   	push   %ebp
+  e1:	89 e5                	mov    %esp,%ebp
+  asm volatile("int %1" : "=a" (r) : "i" (T_SYSCALL), "a" (num) : "memory");
+  e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  e6:	cd 40                	int    $0x40
+}
+  e8:	5d                   	pop    %ebp
+  e9:	c3                   	ret
+  ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000000f0 <sysentercall>:
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  asm volatile("movl %%esp, %%ecx\n"
+  f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  f6:	89 e1                	mov    %esp,%ecx
+  f8:	ba ff 00 00 00       	mov    $0xff,%edx
+  fd:	0f 34                	sysenter
+}
+  ff:	5d                   	pop    %ebp
+ 100:	c3                   	ret
+ 101:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 108:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10f:	90                   	nop
+
+00000110 <run>:
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	57                   	push   %edi
+ 114:	56                   	push   %esi
+ 115:	53                   	push   %ebx
+ 116:	83 ec 1c             	sub    $0x1c,%esp
+ 119:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 11c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 11f:	8b 7d 10             	mov    0x10(%ebp),%edi
+ 122:	8b 5d 14             	mov    0x14(%ebp),%ebx
+ 125:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+  asm volatile("rdtsc" : "=A" (t));
+ 128:	0f 31                	rdtsc
+ 12a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 12d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  for(i = 0; i < n; i++)
+ 130:	85 db                	test   %ebx,%ebx
+ 132:	7e 22                	jle    156 <run+0x46>
+ 134:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ 137:	31 f6                	xor    %esi,%esi
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    call(num);
+ 140:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < n; i++)
+ 143:	83 c6 01             	add    $0x1,%esi
+    call(num);
+ 146:	57                   	push   %edi
+ 147:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 14a:	ff d0                	call   *%eax
+  for(i = 0; i < n; i++)
+ 14c:	83 c4 10             	add    $0x10,%esp
+ 14f:	39 f3                	cmp    %esi,%ebx
+ 151:	75 ed                	jne    140 <run+0x30>
+ 153:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 156:	0f 31                	rdtsc
+  t = rdtsc() - t;
+ 158:	2b 45 d8             	sub    -0x28(%ebp),%eax
+ 15b:	1b 55 dc             	sbb    -0x24(%ebp),%edx
+  printf(1, "%s: %d cycles per call\n", name, (uint)div64(t, n));
+ 15e:	89 4d 10             	mov    %ecx,0x10(%ebp)
+  t = rdtsc() - t;
+ 161:	89 c6                	mov    %eax,%esi
+static inline uint64
+div64(uint64 n, uint d)
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+ 163:	89 d0                	mov    %edx,%eax
+ 165:	31 d2                	xor    %edx,%edx
+  printf(1, "%s: %d cycles per call\n", name, (uint)div64(t, n));
+ 167:	c7 45 0c 80 0f 00 00 	movl   $0xf80,0xc(%ebp)
+ 16e:	f7 f3                	div    %ebx
+ 170:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ 177:	89 f0                	mov    %esi,%eax
+ 179:	f7 f3                	div    %ebx
+ 17b:	89 45 14             	mov    %eax,0x14(%ebp)
+}
+ 17e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 181:	5b                   	pop    %ebx
+ 182:	5e                   	pop    %esi
+ 183:	5f                   	pop    %edi
+ 184:	5d                   	pop    %ebp
+  printf(1, "%s: %d cycles per call\n", name, (uint)div64(t, n));
+ 185:	e9 46 09 00 00       	jmp    ad0 <printf>
+ 18a:	66 90                	xchg   %ax,%ax
+ 18c:	66 90                	xchg   %ax,%ax
+ 18e:	66 90                	xchg   %ax,%ax
+
+00000190 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	57                   	push   %edi
+ 194:	56                   	push   %esi
+ 195:	53                   	push   %ebx
+ 196:	83 ec 4c             	sub    $0x4c,%esp
+ 199:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 19c:	8b 55 08             	mov    0x8(%ebp),%edx
+ 19f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 1a2:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+ 1a5:	83 fa 0f             	cmp    $0xf,%edx
+ 1a8:	0f 87 32 01 00 00    	ja     2e0 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+ 1ae:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 1b4:	8b 80 80 15 00 00    	mov    0x1580(%eax),%eax
+ 1ba:	85 c0                	test   %eax,%eax
+ 1bc:	0f 84 de 00 00 00    	je     2a0 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+ 1c2:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 1c8:	8b b0 84 15 00 00    	mov    0x1584(%eax),%esi
+ 1ce:	8d 88 80 15 00 00    	lea    0x1580(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+ 1d4:	8d b8 88 15 00 00    	lea    0x1588(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+ 1da:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+ 1dd:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+ 1e0:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+ 1e3:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+ 1e9:	0f 8f 01 01 00 00    	jg     2f0 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+ 1ef:	8d 78 08             	lea    0x8(%eax),%edi
+ 1f2:	8d bc 3e 80 15 00 00 	lea    0x1580(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 1f9:	85 db                	test   %ebx,%ebx
+ 1fb:	7e 3b                	jle    238 <bufwrite+0xa8>
+ 1fd:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+ 200:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+ 203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 207:	90                   	nop
+    *dst++ = *src++;
+ 208:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 209:	39 c6                	cmp    %eax,%esi
+ 20b:	75 fb                	jne    208 <bufwrite+0x78>
+  ob[fd].n += n;
+ 20d:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 213:	8b 88 84 15 00 00    	mov    0x1584(%eax),%ecx
+ 219:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 21b:	83 b8 80 15 00 00 01 	cmpl   $0x1,0x1580(%eax)
+  ob[fd].n += n;
+ 222:	89 88 84 15 00 00    	mov    %ecx,0x1584(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 228:	74 26                	je     250 <bufwrite+0xc0>
+}
+ 22a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 22d:	5b                   	pop    %ebx
+ 22e:	5e                   	pop    %esi
+ 22f:	5f                   	pop    %edi
+ 230:	5d                   	pop    %ebp
+ 231:	c3                   	ret
+ 232:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+ 238:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 23b:	83 b8 80 15 00 00 01 	cmpl   $0x1,0x1580(%eax)
+  ob[fd].n += n;
+ 242:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 245:	75 e3                	jne    22a <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+ 247:	85 db                	test   %ebx,%ebx
+ 249:	74 df                	je     22a <bufwrite+0x9a>
+ 24b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 24f:	90                   	nop
+  src = vsrc;
+ 250:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 253:	01 c3                	add    %eax,%ebx
+ 255:	eb 10                	jmp    267 <bufwrite+0xd7>
+ 257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25e:	66 90                	xchg   %ax,%ax
+ 260:	83 c0 01             	add    $0x1,%eax
+ 263:	39 d8                	cmp    %ebx,%eax
+ 265:	74 c3                	je     22a <bufwrite+0x9a>
+    if(*p == (char)c)
+ 267:	80 38 0a             	cmpb   $0xa,(%eax)
+ 26a:	75 f4                	jne    260 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 26c:	85 c9                	test   %ecx,%ecx
+ 26e:	7e ba                	jle    22a <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 270:	83 ec 04             	sub    $0x4,%esp
+ 273:	51                   	push   %ecx
+ 274:	ff 75 ac             	push   -0x54(%ebp)
+ 277:	52                   	push   %edx
+ 278:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+ 27b:	e8 cd 05 00 00       	call   84d <write>
+    ob[fd].n = 0;
+ 280:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+ 283:	83 c4 10             	add    $0x10,%esp
+ 286:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+ 28c:	c7 82 84 15 00 00 00 	movl   $0x0,0x1584(%edx)
+ 293:	00 00 00 
+ 296:	eb 92                	jmp    22a <bufwrite+0x9a>
+ 298:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 2a0:	83 ec 08             	sub    $0x8,%esp
+ 2a3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 2a6:	50                   	push   %eax
+ 2a7:	52                   	push   %edx
+ 2a8:	89 55 b0             	mov    %edx,-0x50(%ebp)
+ 2ab:	e8 d7 05 00 00       	call   887 <fstat>
+ 2b0:	83 c4 10             	add    $0x10,%esp
+ 2b3:	8b 55 b0             	mov    -0x50(%ebp),%edx
+ 2b6:	89 c1                	mov    %eax,%ecx
+ 2b8:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2bd:	85 c9                	test   %ecx,%ecx
+ 2bf:	75 0d                	jne    2ce <bufwrite+0x13e>
+ 2c1:	31 c0                	xor    %eax,%eax
+ 2c3:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 2c8:	0f 95 c0             	setne  %al
+ 2cb:	83 c0 01             	add    $0x1,%eax
+ 2ce:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+ 2d4:	89 81 80 15 00 00    	mov    %eax,0x1580(%ecx)
+ 2da:	e9 e3 fe ff ff       	jmp    1c2 <bufwrite+0x32>
+ 2df:	90                   	nop
+}
+ 2e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2e3:	5b                   	pop    %ebx
+ 2e4:	5e                   	pop    %esi
+ 2e5:	5f                   	pop    %edi
+ 2e6:	5d                   	pop    %ebp
+    write(fd, p, n);
+ 2e7:	e9 61 05 00 00       	jmp    84d <write>
+ 2ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+ 2f0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+ 2f3:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+ 2f6:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+ 2f9:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+ 2fc:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+ 2ff:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+ 302:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+ 305:	6a 02                	push   $0x2
+ 307:	50                   	push   %eax
+ 308:	52                   	push   %edx
+ 309:	e8 9b 06 00 00       	call   9a9 <writev>
+    ob[fd].n = 0;
+ 30e:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+ 311:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+ 314:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ 31b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 31e:	5b                   	pop    %ebx
+ 31f:	5e                   	pop    %esi
+ 320:	5f                   	pop    %edi
+ 321:	5d                   	pop    %ebp
+ 322:	c3                   	ret
+ 323:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000330 <fflush>:
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	53                   	push   %ebx
+ 334:	83 ec 04             	sub    $0x4,%esp
+ 337:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 33a:	83 f8 0f             	cmp    $0xf,%eax
+ 33d:	77 16                	ja     355 <fflush+0x25>
+ 33f:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+ 345:	8b 8a 84 15 00 00    	mov    0x1584(%edx),%ecx
+ 34b:	8d 9a 80 15 00 00    	lea    0x1580(%edx),%ebx
+ 351:	85 c9                	test   %ecx,%ecx
+ 353:	7f 0b                	jg     360 <fflush+0x30>
+}
+ 355:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 358:	c9                   	leave
+ 359:	c3                   	ret
+ 35a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 360:	83 ec 04             	sub    $0x4,%esp
+ 363:	81 c2 88 15 00 00    	add    $0x1588,%edx
+ 369:	51                   	push   %ecx
+ 36a:	52                   	push   %edx
+ 36b:	50                   	push   %eax
+ 36c:	e8 dc 04 00 00       	call   84d <write>
+    ob[fd].n = 0;
+ 371:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+ 378:	83 c4 10             	add    $0x10,%esp
+}
+ 37b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 37e:	c9                   	leave
+ 37f:	c3                   	ret
+
+00000380 <fflushall>:
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 384:	31 f6                	xor    %esi,%esi
+{
+ 386:	53                   	push   %ebx
+ 387:	bb 88 15 00 00       	mov    $0x1588,%ebx
+ 38c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 390:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 393:	85 c0                	test   %eax,%eax
+ 395:	7e 15                	jle    3ac <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 397:	83 ec 04             	sub    $0x4,%esp
+ 39a:	50                   	push   %eax
+ 39b:	53                   	push   %ebx
+ 39c:	56                   	push   %esi
+ 39d:	e8 ab 04 00 00       	call   84d <write>
+    ob[fd].n = 0;
+ 3a2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 3a9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 3ac:	83 c6 01             	add    $0x1,%esi
+ 3af:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 3b5:	83 fe 10             	cmp    $0x10,%esi
+ 3b8:	75 d6                	jne    390 <fflushall+0x10>
+}
+ 3ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3bd:	5b                   	pop    %ebx
+ 3be:	5e                   	pop    %esi
+ 3bf:	5d                   	pop    %ebp
+ 3c0:	c3                   	ret
+ 3c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cf:	90                   	nop
+
+000003d0 <fork>:
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 3d4:	31 f6                	xor    %esi,%esi
+{
+ 3d6:	53                   	push   %ebx
+ 3d7:	bb 88 15 00 00       	mov    $0x1588,%ebx
+ 3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 3e0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 3e3:	85 c0                	test   %eax,%eax
+ 3e5:	7e 15                	jle    3fc <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 3e7:	83 ec 04             	sub    $0x4,%esp
+ 3ea:	50                   	push   %eax
+ 3eb:	53                   	push   %ebx
+ 3ec:	56                   	push   %esi
+ 3ed:	e8 5b 04 00 00       	call   84d <write>
+    ob[fd].n = 0;
+ 3f2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 3f9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 3fc:	83 c6 01             	add    $0x1,%esi
+ 3ff:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 405:	83 fe 10             	cmp    $0x10,%esi
+ 408:	75 d6                	jne    3e0 <fork+0x10>
+}
+ 40a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 40d:	5b                   	pop    %ebx
+ 40e:	5e                   	pop    %esi
+ 40f:	5d                   	pop    %ebp
+  return _fork();
+ 410:	e9 15 04 00 00       	jmp    82a <_fork>
+ 415:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <exit>:
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+ 426:	e8 55 ff ff ff       	call   380 <fflushall>
+  _exit();
+ 42b:	e8 01 04 00 00       	call   831 <_exit>
+
+00000430 <exec>:
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	57                   	push   %edi
+ 434:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 435:	31 f6                	xor    %esi,%esi
+{
+ 437:	53                   	push   %ebx
+ 438:	bb 88 15 00 00       	mov    $0x1588,%ebx
+ 43d:	83 ec 1c             	sub    $0x1c,%esp
+ 440:	8b 45 08             	mov    0x8(%ebp),%eax
+ 443:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 446:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 450:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 453:	85 c0                	test   %eax,%eax
+ 455:	7e 15                	jle    46c <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 457:	83 ec 04             	sub    $0x4,%esp
+ 45a:	50                   	push   %eax
+ 45b:	53                   	push   %ebx
+ 45c:	56                   	push   %esi
+ 45d:	e8 eb 03 00 00       	call   84d <write>
+    ob[fd].n = 0;
+ 462:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 469:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 46c:	83 c6 01             	add    $0x1,%esi
+ 46f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 475:	83 fe 10             	cmp    $0x10,%esi
+ 478:	75 d6                	jne    450 <exec+0x20>
+  return _exec(path, argv);
+ 47a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 47d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+ 480:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ 483:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 486:	5b                   	pop    %ebx
+ 487:	5e                   	pop    %esi
+ 488:	5f                   	pop    %edi
+ 489:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 48a:	e9 d3 03 00 00       	jmp    862 <_exec>
+ 48f:	90                   	nop
+
+00000490 <close>:
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	56                   	push   %esi
+ 494:	53                   	push   %ebx
+ 495:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 498:	83 fb 0f             	cmp    $0xf,%ebx
+ 49b:	77 26                	ja     4c3 <close+0x33>
+ 49d:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 4a3:	8b 90 84 15 00 00    	mov    0x1584(%eax),%edx
+ 4a9:	8d b0 80 15 00 00    	lea    0x1580(%eax),%esi
+ 4af:	85 d2                	test   %edx,%edx
+ 4b1:	7f 25                	jg     4d8 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+ 4b3:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 4b9:	c7 80 80 15 00 00 00 	movl   $0x0,0x1580(%eax)
+ 4c0:	00 00 00 
+  return _close(fd);
+ 4c3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 4c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4c9:	5b                   	pop    %ebx
+ 4ca:	5e                   	pop    %esi
+ 4cb:	5d                   	pop    %ebp
+  return _close(fd);
+ 4cc:	e9 83 03 00 00       	jmp    854 <_close>
+ 4d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 4d8:	83 ec 04             	sub    $0x4,%esp
+ 4db:	05 88 15 00 00       	add    $0x1588,%eax
+ 4e0:	52                   	push   %edx
+ 4e1:	50                   	push   %eax
+ 4e2:	53                   	push   %ebx
+ 4e3:	e8 65 03 00 00       	call   84d <write>
+    ob[fd].n = 0;
+ 4e8:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+ 4ef:	83 c4 10             	add    $0x10,%esp
+ 4f2:	eb bf                	jmp    4b3 <close+0x23>
+ 4f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4ff:	90                   	nop
+
+00000500 <strcpy>:
+{
+ 500:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+ 501:	31 c0                	xor    %eax,%eax
+{
+ 503:	89 e5                	mov    %esp,%ebp
+ 505:	53                   	push   %ebx
+ 506:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 509:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 50c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 510:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 514:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 517:	83 c0 01             	add    $0x1,%eax
+ 51a:	84 d2                	test   %dl,%dl
+ 51c:	75 f2                	jne    510 <strcpy+0x10>
+}
+ 51e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 521:	89 c8                	mov    %ecx,%eax
+ 523:	c9                   	leave
+ 524:	c3                   	ret
+ 525:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000530 <strcmp>:
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	53                   	push   %ebx
+ 534:	8b 55 08             	mov    0x8(%ebp),%edx
+ 537:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 53a:	0f b6 02             	movzbl (%edx),%eax
+ 53d:	84 c0                	test   %al,%al
+ 53f:	75 17                	jne    558 <strcmp+0x28>
+ 541:	eb 3a                	jmp    57d <strcmp+0x4d>
+ 543:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 547:	90                   	nop
+ 548:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 54c:	83 c2 01             	add    $0x1,%edx
+ 54f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 552:	84 c0                	test   %al,%al
+ 554:	74 1a                	je     570 <strcmp+0x40>
+    p++, q++;
+ 556:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 558:	0f b6 19             	movzbl (%ecx),%ebx
+ 55b:	38 c3                	cmp    %al,%bl
+ 55d:	74 e9                	je     548 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 55f:	29 d8                	sub    %ebx,%eax
+}
+ 561:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 564:	c9                   	leave
+ 565:	c3                   	ret
+ 566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 570:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 574:	31 c0                	xor    %eax,%eax
+ 576:	29 d8                	sub    %ebx,%eax
+}
+ 578:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 57b:	c9                   	leave
+ 57c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 57d:	0f b6 19             	movzbl (%ecx),%ebx
+ 580:	31 c0                	xor    %eax,%eax
+ 582:	eb db                	jmp    55f <strcmp+0x2f>
+ 584:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 58f:	90                   	nop
+
+00000590 <strlen>:
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+ 596:	80 3a 00             	cmpb   $0x0,(%edx)
+ 599:	74 15                	je     5b0 <strlen+0x20>
+ 59b:	31 c0                	xor    %eax,%eax
+ 59d:	8d 76 00             	lea    0x0(%esi),%esi
+ 5a0:	83 c0 01             	add    $0x1,%eax
+ 5a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 5a7:	89 c1                	mov    %eax,%ecx
+ 5a9:	75 f5                	jne    5a0 <strlen+0x10>
+}
+ 5ab:	89 c8                	mov    %ecx,%eax
+ 5ad:	5d                   	pop    %ebp
+ 5ae:	c3                   	ret
+ 5af:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 5b0:	31 c9                	xor    %ecx,%ecx
+}
+ 5b2:	5d                   	pop    %ebp
+ 5b3:	89 c8                	mov    %ecx,%eax
+ 5b5:	c3                   	ret
+ 5b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005c0 <memset>:
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	57                   	push   %edi
+ 5c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("cld; rep stosb" :
+ 5c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5cd:	89 d7                	mov    %edx,%edi
+ 5cf:	fc                   	cld
+ 5d0:	f3 aa                	rep stos %al,%es:(%edi)
+}
+ 5d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 5d5:	89 d0                	mov    %edx,%eax
+ 5d7:	c9                   	leave
+ 5d8:	c3                   	ret
+ 5d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005e0 <strchr>:
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+ 5e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 5ea:	0f b6 10             	movzbl (%eax),%edx
+ 5ed:	84 d2                	test   %dl,%dl
+ 5ef:	75 12                	jne    603 <strchr+0x23>
+ 5f1:	eb 1d                	jmp    610 <strchr+0x30>
+ 5f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5f7:	90                   	nop
+ 5f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 5fc:	83 c0 01             	add    $0x1,%eax
+ 5ff:	84 d2                	test   %dl,%dl
+ 601:	74 0d                	je     610 <strchr+0x30>
+    if(*s == c)
+ 603:	38 d1                	cmp    %dl,%cl
+ 605:	75 f1                	jne    5f8 <strchr+0x18>
+}
+ 607:	5d                   	pop    %ebp
+ 608:	c3                   	ret
+ 609:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 610:	31 c0                	xor    %eax,%eax
+}
+ 612:	5d                   	pop    %ebp
+ 613:	c3                   	ret
+ 614:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 61f:	90                   	nop
+
+00000620 <memchr>:
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	8b 55 10             	mov    0x10(%ebp),%edx
+ 626:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 629:	85 d2                	test   %edx,%edx
+ 62b:	74 1b                	je     648 <memchr+0x28>
+    if(*p == (char)c)
+ 62d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+ 631:	01 c2                	add    %eax,%edx
+ 633:	eb 0a                	jmp    63f <memchr+0x1f>
+ 635:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+ 638:	83 c0 01             	add    $0x1,%eax
+ 63b:	39 c2                	cmp    %eax,%edx
+ 63d:	74 09                	je     648 <memchr+0x28>
+    if(*p == (char)c)
+ 63f:	38 08                	cmp    %cl,(%eax)
+ 641:	75 f5                	jne    638 <memchr+0x18>
+}
+ 643:	5d                   	pop    %ebp
+ 644:	c3                   	ret
+ 645:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+ 648:	31 c0                	xor    %eax,%eax
+}
+ 64a:	5d                   	pop    %ebp
+ 64b:	c3                   	ret
+ 64c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000650 <gets>:
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+ 654:	31 ff                	xor    %edi,%edi
+{
+ 656:	56                   	push   %esi
+ 657:	be 88 15 00 00       	mov    $0x1588,%esi
+ 65c:	53                   	push   %ebx
+ 65d:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 660:	8b 46 fc             	mov    -0x4(%esi),%eax
+ 663:	85 c0                	test   %eax,%eax
+ 665:	7e 15                	jle    67c <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 667:	83 ec 04             	sub    $0x4,%esp
+ 66a:	50                   	push   %eax
+ 66b:	56                   	push   %esi
+ 66c:	57                   	push   %edi
+ 66d:	e8 db 01 00 00       	call   84d <write>
+    ob[fd].n = 0;
+ 672:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+ 679:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 67c:	83 c7 01             	add    $0x1,%edi
+ 67f:	81 c6 08 01 00 00    	add    $0x108,%esi
+ 685:	83 ff 10             	cmp    $0x10,%edi
+ 688:	75 d6                	jne    660 <gets+0x10>
+  for(i=0; i+1 < max; ){
+ 68a:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+ 68c:	8d 75 e7             	lea    -0x19(%ebp),%esi
+ 68f:	eb 2e                	jmp    6bf <gets+0x6f>
+ 691:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 698:	83 ec 04             	sub    $0x4,%esp
+ 69b:	6a 01                	push   $0x1
+ 69d:	56                   	push   %esi
+ 69e:	6a 00                	push   $0x0
+ 6a0:	e8 a1 01 00 00       	call   846 <read>
+    if(cc < 1)
+ 6a5:	83 c4 10             	add    $0x10,%esp
+ 6a8:	85 c0                	test   %eax,%eax
+ 6aa:	7e 1d                	jle    6c9 <gets+0x79>
+    buf[i++] = c;
+ 6ac:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 6b0:	8b 55 08             	mov    0x8(%ebp),%edx
+ 6b3:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 6b7:	3c 0a                	cmp    $0xa,%al
+ 6b9:	74 10                	je     6cb <gets+0x7b>
+ 6bb:	3c 0d                	cmp    $0xd,%al
+ 6bd:	74 0c                	je     6cb <gets+0x7b>
+  for(i=0; i+1 < max; ){
+ 6bf:	89 df                	mov    %ebx,%edi
+ 6c1:	83 c3 01             	add    $0x1,%ebx
+ 6c4:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 6c7:	7c cf                	jl     698 <gets+0x48>
+ 6c9:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 6cb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6ce:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 6d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6d5:	5b                   	pop    %ebx
+ 6d6:	5e                   	pop    %esi
+ 6d7:	5f                   	pop    %edi
+ 6d8:	5d                   	pop    %ebp
+ 6d9:	c3                   	ret
+ 6da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000006e0 <stat>:
+{
+ 6e0:	55                   	push   %ebp
+ 6e1:	89 e5                	mov    %esp,%ebp
+ 6e3:	57                   	push   %edi
+ 6e4:	56                   	push   %esi
+ 6e5:	53                   	push   %ebx
+ 6e6:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+ 6e9:	6a 00                	push   $0x0
+ 6eb:	ff 75 08             	push   0x8(%ebp)
+ 6ee:	e8 76 01 00 00       	call   869 <open>
+  if(fd < 0)
+ 6f3:	83 c4 10             	add    $0x10,%esp
+ 6f6:	85 c0                	test   %eax,%eax
+ 6f8:	78 76                	js     770 <stat+0x90>
+  r = fstat(fd, st);
+ 6fa:	83 ec 08             	sub    $0x8,%esp
+ 6fd:	ff 75 0c             	push   0xc(%ebp)
+ 700:	89 c3                	mov    %eax,%ebx
+ 702:	50                   	push   %eax
+ 703:	e8 7f 01 00 00       	call   887 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 708:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 70b:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 70d:	83 fb 0f             	cmp    $0xf,%ebx
+ 710:	7f 40                	jg     752 <stat+0x72>
+ 712:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 718:	8b 90 84 15 00 00    	mov    0x1584(%eax),%edx
+ 71e:	8d b8 80 15 00 00    	lea    0x1580(%eax),%edi
+ 724:	85 d2                	test   %edx,%edx
+ 726:	7e 1a                	jle    742 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 728:	83 ec 04             	sub    $0x4,%esp
+ 72b:	05 88 15 00 00       	add    $0x1588,%eax
+ 730:	52                   	push   %edx
+ 731:	50                   	push   %eax
+ 732:	53                   	push   %ebx
+ 733:	e8 15 01 00 00       	call   84d <write>
+    ob[fd].n = 0;
+ 738:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+ 73f:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+ 742:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 748:	c7 80 80 15 00 00 00 	movl   $0x0,0x1580(%eax)
+ 74f:	00 00 00 
+  return _close(fd);
+ 752:	83 ec 0c             	sub    $0xc,%esp
+ 755:	53                   	push   %ebx
+ 756:	e8 f9 00 00 00       	call   854 <_close>
+ 75b:	83 c4 10             	add    $0x10,%esp
+}
+ 75e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 761:	89 f0                	mov    %esi,%eax
+ 763:	5b                   	pop    %ebx
+ 764:	5e                   	pop    %esi
+ 765:	5f                   	pop    %edi
+ 766:	5d                   	pop    %ebp
+ 767:	c3                   	ret
+ 768:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76f:	90                   	nop
+    return -1;
+ 770:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 775:	eb e7                	jmp    75e <stat+0x7e>
+ 777:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 77e:	66 90                	xchg   %ax,%ax
+
+00000780 <atoi>:
+{
+ 780:	55                   	push   %ebp
+ 781:	89 e5                	mov    %esp,%ebp
+ 783:	53                   	push   %ebx
+ 784:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 787:	0f be 02             	movsbl (%edx),%eax
+ 78a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 78d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 790:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 795:	77 1e                	ja     7b5 <atoi+0x35>
+ 797:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 7a0:	83 c2 01             	add    $0x1,%edx
+ 7a3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 7a6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 7aa:	0f be 02             	movsbl (%edx),%eax
+ 7ad:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 7b0:	80 fb 09             	cmp    $0x9,%bl
+ 7b3:	76 eb                	jbe    7a0 <atoi+0x20>
+}
+ 7b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 7b8:	89 c8                	mov    %ecx,%eax
+ 7ba:	c9                   	leave
+ 7bb:	c3                   	ret
+ 7bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007c0 <memmove>:
+{
+ 7c0:	55                   	push   %ebp
+ 7c1:	89 e5                	mov    %esp,%ebp
+ 7c3:	57                   	push   %edi
+ 7c4:	56                   	push   %esi
+ 7c5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 7c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 7cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 7ce:	85 c0                	test   %eax,%eax
+ 7d0:	7e 13                	jle    7e5 <memmove+0x25>
+ 7d2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 7d4:	89 d7                	mov    %edx,%edi
+ 7d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7dd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 7e0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 7e1:	39 f8                	cmp    %edi,%eax
+ 7e3:	75 fb                	jne    7e0 <memmove+0x20>
+  return vdst;
+}
+ 7e5:	5e                   	pop    %esi
+ 7e6:	89 d0                	mov    %edx,%eax
+ 7e8:	5f                   	pop    %edi
+ 7e9:	5d                   	pop    %ebp
+ 7ea:	c3                   	ret
+
+000007eb <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+ 7eb:	83 3d 74 15 00 00 00 	cmpl   $0x0,0x1574
+  jle 1f
+ 7f2:	7e 0a                	jle    7fe <syscallentry+0x13>
+  movl %esp, %ecx
+ 7f4:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 7f6:	ba fd 07 00 00       	mov    $0x7fd,%edx
+  sysenter
+ 7fb:	0f 34                	sysenter
+2:
+  ret
+ 7fd:	c3                   	ret
+1:
+  jl 3f
+ 7fe:	7c 27                	jl     827 <syscallentry+0x3c>
+  pushal
+ 800:	60                   	pusha
+  movl $1, %eax
+ 801:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 806:	0f a2                	cpuid
+  movl $-1, sysentermode
+ 808:	c7 05 74 15 00 00 ff 	movl   $0xffffffff,0x1574
+ 80f:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 812:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+ 818:	74 0a                	je     824 <syscallentry+0x39>
+  movl $1, sysentermode
+ 81a:	c7 05 74 15 00 00 01 	movl   $0x1,0x1574
+ 821:	00 00 00 
+4:
+  popal
+ 824:	61                   	popa
+  jmp syscallentry
+ 825:	eb c4                	jmp    7eb <syscallentry>
+3:
+  int $T_SYSCALL
+ 827:	cd 40                	int    $0x40
+  ret
+ 829:	c3                   	ret
+
+0000082a <_fork>:
+
+SYSCALLAS(_fork, fork)
+ 82a:	b8 01 00 00 00       	mov    $0x1,%eax
+ 82f:	eb ba                	jmp    7eb <syscallentry>
+
+00000831 <_exit>:
+SYSCALLAS(_exit, exit)
+ 831:	b8 02 00 00 00       	mov    $0x2,%eax
+ 836:	eb b3                	jmp    7eb <syscallentry>
+
+00000838 <wait>:
+SYSCALL(wait)
+ 838:	b8 03 00 00 00       	mov    $0x3,%eax
+ 83d:	eb ac                	jmp    7eb <syscallentry>
+
+0000083f <pipe>:
+SYSCALL(pipe)
+ 83f:	b8 04 00 00 00       	mov    $0x4,%eax
+ 844:	eb a5                	jmp    7eb <syscallentry>
+
+00000846 <read>:
+SYSCALL(read)
+ 846:	b8 05 00 00 00       	mov    $0x5,%eax
+ 84b:	eb 9e                	jmp    7eb <syscallentry>
+
+0000084d <write>:
+SYSCALL(write)
+ 84d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 852:	eb 97                	jmp    7eb <syscallentry>
+
+00000854 <_close>:
+SYSCALLAS(_close, close)
+ 854:	b8 15 00 00 00       	mov    $0x15,%eax
+ 859:	eb 90                	jmp    7eb <syscallentry>
+
+0000085b <kill>:
+SYSCALL(kill)
+ 85b:	b8 06 00 00 00       	mov    $0x6,%eax
+ 860:	eb 89                	jmp    7eb <syscallentry>
+
+00000862 <_exec>:
+SYSCALLAS(_exec, exec)
+ 862:	b8 07 00 00 00       	mov    $0x7,%eax
+ 867:	eb 82                	jmp    7eb <syscallentry>
+
+00000869 <open>:
+SYSCALL(open)
+ 869:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 86e:	e9 78 ff ff ff       	jmp    7eb <syscallentry>
+
+00000873 <mknod>:
+SYSCALL(mknod)
+ 873:	b8 11 00 00 00       	mov    $0x11,%eax
+ 878:	e9 6e ff ff ff       	jmp    7eb <syscallentry>
+
+0000087d <unlink>:
+SYSCALL(unlink)
+ 87d:	b8 12 00 00 00       	mov    $0x12,%eax
+ 882:	e9 64 ff ff ff       	jmp    7eb <syscallentry>
+
+00000887 <fstat>:
+SYSCALL(fstat)
+ 887:	b8 08 00 00 00       	mov    $0x8,%eax
+ 88c:	e9 5a ff ff ff       	jmp    7eb <syscallentry>
+
+00000891 <link>:
+SYSCALL(link)
+ 891:	b8 13 00 00 00       	mov    $0x13,%eax
+ 896:	e9 50 ff ff ff       	jmp    7eb <syscallentry>
+
+0000089b <mkdir>:
+SYSCALL(mkdir)
+ 89b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 8a0:	e9 46 ff ff ff       	jmp    7eb <syscallentry>
+
+000008a5 <chdir>:
+SYSCALL(chdir)
+ 8a5:	b8 09 00 00 00       	mov    $0x9,%eax
+ 8aa:	e9 3c ff ff ff       	jmp    7eb <syscallentry>
+
+000008af <dup>:
+SYSCALL(dup)
+ 8af:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 8b4:	e9 32 ff ff ff       	jmp    7eb <syscallentry>
+
+000008b9 <getpid>:
+SYSCALL(getpid)
+ 8b9:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 8be:	e9 28 ff ff ff       	jmp    7eb <syscallentry>
+
+000008c3 <sbrk>:
+SYSCALL(sbrk)
+ 8c3:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 8c8:	e9 1e ff ff ff       	jmp    7eb <syscallentry>
+
+000008cd <sleep>:
+SYSCALL(sleep)
+ 8cd:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 8d2:	e9 14 ff ff ff       	jmp    7eb <syscallentry>
+
+000008d7 <uptime>:
+SYSCALL(uptime)
+ 8d7:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 8dc:	e9 0a ff ff ff       	jmp    7eb <syscallentry>
+
+000008e1 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+ 8e1:	b8 16 00 00 00       	mov    $0x16,%eax
+ 8e6:	e9 00 ff ff ff       	jmp    7eb <syscallentry>
+
+000008eb <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+ 8eb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 8f0:	e9 f6 fe ff ff       	jmp    7eb <syscallentry>
+
+000008f5 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+ 8f5:	b8 18 00 00 00       	mov    $0x18,%eax
+ 8fa:	e9 ec fe ff ff       	jmp    7eb <syscallentry>
+
+000008ff <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+ 8ff:	b8 19 00 00 00       	mov    $0x19,%eax
+ 904:	e9 e2 fe ff ff       	jmp    7eb <syscallentry>
+
+00000909 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+ 909:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 90e:	e9 d8 fe ff ff       	jmp    7eb <syscallentry>
+
+00000913 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+ 913:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 918:	e9 ce fe ff ff       	jmp    7eb <syscallentry>
+
+0000091d <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+ 91d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 922:	e9 c4 fe ff ff       	jmp    7eb <syscallentry>
+
+00000927 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+ 927:	b8 20 00 00 00       	mov    $0x20,%eax
+ 92c:	e9 ba fe ff ff       	jmp    7eb <syscallentry>
+
+00000931 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+ 931:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 936:	e9 b0 fe ff ff       	jmp    7eb <syscallentry>
+
+0000093b <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+ 93b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 940:	e9 a6 fe ff ff       	jmp    7eb <syscallentry>
+
+00000945 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+ 945:	b8 21 00 00 00       	mov    $0x21,%eax
+ 94a:	e9 9c fe ff ff       	jmp    7eb <syscallentry>
+
+0000094f <yield>:
+SYSCALL(yield) // yield the CPU to another process
+ 94f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 954:	e9 92 fe ff ff       	jmp    7eb <syscallentry>
+
+00000959 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+ 959:	b8 23 00 00 00       	mov    $0x23,%eax
+ 95e:	e9 88 fe ff ff       	jmp    7eb <syscallentry>
+
+00000963 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+ 963:	b8 24 00 00 00       	mov    $0x24,%eax
+ 968:	e9 7e fe ff ff       	jmp    7eb <syscallentry>
+
+0000096d <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+ 96d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 972:	e9 74 fe ff ff       	jmp    7eb <syscallentry>
+
+00000977 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+ 977:	b8 26 00 00 00       	mov    $0x26,%eax
+ 97c:	e9 6a fe ff ff       	jmp    7eb <syscallentry>
+
+00000981 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+ 981:	b8 27 00 00 00       	mov    $0x27,%eax
+ 986:	e9 60 fe ff ff       	jmp    7eb <syscallentry>
+
+0000098b <mmap>:
+SYSCALL(mmap) // map a file into memory
+ 98b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 990:	e9 56 fe ff ff       	jmp    7eb <syscallentry>
+
+00000995 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+ 995:	b8 29 00 00 00       	mov    $0x29,%eax
+ 99a:	e9 4c fe ff ff       	jmp    7eb <syscallentry>
+
+0000099f <readv>:
+SYSCALL(readv) // read into several buffers
+ 99f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 9a4:	e9 42 fe ff ff       	jmp    7eb <syscallentry>
+
+000009a9 <writev>:
+SYSCALL(writev) // write from several buffers
+ 9a9:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 9ae:	e9 38 fe ff ff       	jmp    7eb <syscallentry>
+
+000009b3 <pread>:
+SYSCALL(pread) // read at an offset
+ 9b3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 9b8:	e9 2e fe ff ff       	jmp    7eb <syscallentry>
+
+000009bd <pwrite>:
+SYSCALL(pwrite) // write at an offset
+ 9bd:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 9c2:	e9 24 fe ff ff       	jmp    7eb <syscallentry>
+
+000009c7 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+ 9c7:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 9cc:	e9 1a fe ff ff       	jmp    7eb <syscallentry>
+
+000009d1 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+ 9d1:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 9d6:	e9 10 fe ff ff       	jmp    7eb <syscallentry>
+
+000009db <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+ 9db:	b8 30 00 00 00       	mov    $0x30,%eax
+ 9e0:	e9 06 fe ff ff       	jmp    7eb <syscallentry>
+
+000009e5 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+ 9e5:	b8 31 00 00 00       	mov    $0x31,%eax
+ 9ea:	e9 fc fd ff ff       	jmp    7eb <syscallentry>
+
+000009ef <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+ 9ef:	b8 32 00 00 00       	mov    $0x32,%eax
+ 9f4:	e9 f2 fd ff ff       	jmp    7eb <syscallentry>
+
+000009f9 <profread>:
+SYSCALL(profread) // drain profiler samples
+ 9f9:	b8 33 00 00 00       	mov    $0x33,%eax
+ 9fe:	e9 e8 fd ff ff       	jmp    7eb <syscallentry>
+
+00000a03 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+ a03:	b8 34 00 00 00       	mov    $0x34,%eax
+ a08:	e9 de fd ff ff       	jmp    7eb <syscallentry>
+
+00000a0d <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+ a0d:	b8 35 00 00 00       	mov    $0x35,%eax
+ a12:	e9 d4 fd ff ff       	jmp    7eb <syscallentry>
+
+00000a17 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+ a17:	b8 36 00 00 00       	mov    $0x36,%eax
+ a1c:	e9 ca fd ff ff       	jmp    7eb <syscallentry>
+
+00000a21 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+ a21:	b8 37 00 00 00       	mov    $0x37,%eax
+ a26:	e9 c0 fd ff ff       	jmp    7eb <syscallentry>
+ a2b:	66 90                	xchg   %ax,%ax
+ a2d:	66 90                	xchg   %ax,%ax
+ a2f:	90                   	nop
+
+00000a30 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a30:	55                   	push   %ebp
+ a31:	89 e5                	mov    %esp,%ebp
+ a33:	57                   	push   %edi
+ a34:	56                   	push   %esi
+ a35:	53                   	push   %ebx
+ a36:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ a38:	89 d1                	mov    %edx,%ecx
+{
+ a3a:	83 ec 3c             	sub    $0x3c,%esp
+ a3d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ a40:	85 d2                	test   %edx,%edx
+ a42:	0f 89 80 00 00 00    	jns    ac8 <printint+0x98>
+ a48:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ a4c:	74 7a                	je     ac8 <printint+0x98>
+    x = -xx;
+ a4e:	f7 d9                	neg    %ecx
+    neg = 1;
+ a50:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ a55:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ a58:	31 f6                	xor    %esi,%esi
+ a5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ a60:	89 c8                	mov    %ecx,%eax
+ a62:	31 d2                	xor    %edx,%edx
+ a64:	89 f7                	mov    %esi,%edi
+ a66:	f7 f3                	div    %ebx
+ a68:	8d 76 01             	lea    0x1(%esi),%esi
+ a6b:	0f b6 92 7c 10 00 00 	movzbl 0x107c(%edx),%edx
+ a72:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ a76:	89 ca                	mov    %ecx,%edx
+ a78:	89 c1                	mov    %eax,%ecx
+ a7a:	39 da                	cmp    %ebx,%edx
+ a7c:	73 e2                	jae    a60 <printint+0x30>
+  if(neg)
+ a7e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ a81:	85 c0                	test   %eax,%eax
+ a83:	74 07                	je     a8c <printint+0x5c>
+    buf[i++] = '-';
+ a85:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ a8a:	89 f7                	mov    %esi,%edi
+ a8c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ a8f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ a92:	01 df                	add    %ebx,%edi
+ a94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ a98:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+ a9b:	83 ec 04             	sub    $0x4,%esp
+ a9e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ aa1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ aa4:	6a 01                	push   $0x1
+ aa6:	50                   	push   %eax
+ aa7:	56                   	push   %esi
+ aa8:	e8 e3 f6 ff ff       	call   190 <bufwrite>
+  while(--i >= 0)
+ aad:	89 f8                	mov    %edi,%eax
+ aaf:	83 c4 10             	add    $0x10,%esp
+ ab2:	83 ef 01             	sub    $0x1,%edi
+ ab5:	39 d8                	cmp    %ebx,%eax
+ ab7:	75 df                	jne    a98 <printint+0x68>
+}
+ ab9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ abc:	5b                   	pop    %ebx
+ abd:	5e                   	pop    %esi
+ abe:	5f                   	pop    %edi
+ abf:	5d                   	pop    %ebp
+ ac0:	c3                   	ret
+ ac1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ ac8:	31 c0                	xor    %eax,%eax
+ aca:	eb 89                	jmp    a55 <printint+0x25>
+ acc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ad0 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ ad0:	55                   	push   %ebp
+ ad1:	89 e5                	mov    %esp,%ebp
+ ad3:	57                   	push   %edi
+ ad4:	56                   	push   %esi
+ ad5:	53                   	push   %ebx
+ ad6:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ ad9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ adc:	0f b6 18             	movzbl (%eax),%ebx
+ adf:	84 db                	test   %bl,%bl
+ ae1:	74 6c                	je     b4f <printf+0x7f>
+ ae3:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+ ae6:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ ae9:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ aeb:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ aee:	eb 26                	jmp    b16 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ af0:	83 f8 25             	cmp    $0x25,%eax
+ af3:	74 4b                	je     b40 <printf+0x70>
+  bufwrite(fd, &c, 1);
+ af5:	83 ec 04             	sub    $0x4,%esp
+ af8:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ afb:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ afe:	6a 01                	push   $0x1
+ b00:	50                   	push   %eax
+ b01:	ff 75 08             	push   0x8(%ebp)
+ b04:	e8 87 f6 ff ff       	call   190 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+ b09:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ b0c:	0f b6 1f             	movzbl (%edi),%ebx
+ b0f:	83 c7 01             	add    $0x1,%edi
+ b12:	84 db                	test   %bl,%bl
+ b14:	74 39                	je     b4f <printf+0x7f>
+    c = fmt[i] & 0xff;
+ b16:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ b19:	85 f6                	test   %esi,%esi
+ b1b:	74 d3                	je     af0 <printf+0x20>
+      }
+    } else if(state == '%'){
+ b1d:	83 fe 25             	cmp    $0x25,%esi
+ b20:	75 ea                	jne    b0c <printf+0x3c>
+      if(c == 'd'){
+ b22:	83 f8 25             	cmp    $0x25,%eax
+ b25:	0f 84 d5 01 00 00    	je     d00 <printf+0x230>
+ b2b:	83 e8 63             	sub    $0x63,%eax
+ b2e:	83 f8 15             	cmp    $0x15,%eax
+ b31:	77 45                	ja     b78 <printf+0xa8>
+ b33:	ff 24 85 24 10 00 00 	jmp    *0x1024(,%eax,4)
+ b3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+ b40:	0f b6 1f             	movzbl (%edi),%ebx
+ b43:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+ b46:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ b4b:	84 db                	test   %bl,%bl
+ b4d:	75 c7                	jne    b16 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+ b4f:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+ b53:	74 0b                	je     b60 <printf+0x90>
+    fflush(fd);
+}
+ b55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b58:	5b                   	pop    %ebx
+ b59:	5e                   	pop    %esi
+ b5a:	5f                   	pop    %edi
+ b5b:	5d                   	pop    %ebp
+ b5c:	c3                   	ret
+ b5d:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+ b60:	83 ec 0c             	sub    $0xc,%esp
+ b63:	6a 02                	push   $0x2
+ b65:	e8 c6 f7 ff ff       	call   330 <fflush>
+ b6a:	83 c4 10             	add    $0x10,%esp
+}
+ b6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b70:	5b                   	pop    %ebx
+ b71:	5e                   	pop    %esi
+ b72:	5f                   	pop    %edi
+ b73:	5d                   	pop    %ebp
+ b74:	c3                   	ret
+ b75:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+ b78:	83 ec 04             	sub    $0x4,%esp
+ b7b:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ b7e:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+ b82:	6a 01                	push   $0x1
+ b84:	52                   	push   %edx
+ b85:	89 55 c0             	mov    %edx,-0x40(%ebp)
+ b88:	ff 75 08             	push   0x8(%ebp)
+ b8b:	e8 00 f6 ff ff       	call   190 <bufwrite>
+ b90:	83 c4 0c             	add    $0xc,%esp
+ b93:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ b96:	6a 01                	push   $0x1
+ b98:	8b 55 c0             	mov    -0x40(%ebp),%edx
+ b9b:	52                   	push   %edx
+      state = 0;
+ b9c:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+ b9e:	ff 75 08             	push   0x8(%ebp)
+ ba1:	e8 ea f5 ff ff       	call   190 <bufwrite>
+        putc(fd, c);
+ ba6:	83 c4 10             	add    $0x10,%esp
+ ba9:	e9 5e ff ff ff       	jmp    b0c <printf+0x3c>
+ bae:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+ bb0:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ bb3:	83 ec 0c             	sub    $0xc,%esp
+ bb6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ bbb:	8b 16                	mov    (%esi),%edx
+ bbd:	6a 00                	push   $0x0
+ bbf:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+ bc2:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+ bc5:	e8 66 fe ff ff       	call   a30 <printint>
+        ap++;
+ bca:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ bcd:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ bd0:	31 f6                	xor    %esi,%esi
+ bd2:	e9 35 ff ff ff       	jmp    b0c <printf+0x3c>
+ bd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bde:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+ be0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ be3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ be5:	83 c0 04             	add    $0x4,%eax
+ be8:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+ beb:	b8 1c 10 00 00       	mov    $0x101c,%eax
+ bf0:	85 db                	test   %ebx,%ebx
+ bf2:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+ bf5:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+ bf8:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+ bfa:	53                   	push   %ebx
+ bfb:	e8 90 f9 ff ff       	call   590 <strlen>
+ c00:	83 c4 0c             	add    $0xc,%esp
+ c03:	50                   	push   %eax
+ c04:	53                   	push   %ebx
+ c05:	ff 75 08             	push   0x8(%ebp)
+ c08:	e8 83 f5 ff ff       	call   190 <bufwrite>
+ c0d:	83 c4 10             	add    $0x10,%esp
+ c10:	e9 f7 fe ff ff       	jmp    b0c <printf+0x3c>
+ c15:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ c18:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+ c1b:	83 ec 04             	sub    $0x4,%esp
+ c1e:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+ c21:	8b 06                	mov    (%esi),%eax
+        ap++;
+ c23:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+ c26:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+ c29:	6a 01                	push   $0x1
+ c2b:	52                   	push   %edx
+ c2c:	ff 75 08             	push   0x8(%ebp)
+ c2f:	e8 5c f5 ff ff       	call   190 <bufwrite>
+        ap++;
+ c34:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ c37:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c3a:	31 f6                	xor    %esi,%esi
+ c3c:	e9 cb fe ff ff       	jmp    b0c <printf+0x3c>
+ c41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+ c48:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ c4b:	83 ec 0c             	sub    $0xc,%esp
+ c4e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ c53:	8b 16                	mov    (%esi),%edx
+ c55:	6a 01                	push   $0x1
+ c57:	e9 63 ff ff ff       	jmp    bbf <printf+0xef>
+ c5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+ c60:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ c63:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ c66:	89 7d c0             	mov    %edi,-0x40(%ebp)
+ c69:	89 55 bc             	mov    %edx,-0x44(%ebp)
+ c6c:	8b 18                	mov    (%eax),%ebx
+ c6e:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+ c71:	31 c0                	xor    %eax,%eax
+ c73:	89 c7                	mov    %eax,%edi
+ c75:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+ c78:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+ c7d:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+ c7f:	f7 e1                	mul    %ecx
+ c81:	c1 ea 03             	shr    $0x3,%edx
+ c84:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ c87:	89 d1                	mov    %edx,%ecx
+ c89:	01 c0                	add    %eax,%eax
+ c8b:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ c8d:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+ c8f:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ c91:	be 0a 00 00 00       	mov    $0xa,%esi
+ c96:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+ c98:	89 da                	mov    %ebx,%edx
+ c9a:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+ c9c:	89 fe                	mov    %edi,%esi
+ c9e:	83 c7 01             	add    $0x1,%edi
+ ca1:	8d 42 30             	lea    0x30(%edx),%eax
+ ca4:	89 da                	mov    %ebx,%edx
+ ca6:	8d 14 92             	lea    (%edx,%edx,4),%edx
+ ca9:	01 d2                	add    %edx,%edx
+ cab:	29 d0                	sub    %edx,%eax
+ cad:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+ cb1:	89 c8                	mov    %ecx,%eax
+ cb3:	09 d8                	or     %ebx,%eax
+ cb5:	75 c1                	jne    c78 <printf+0x1a8>
+ cb7:	8b 55 bc             	mov    -0x44(%ebp),%edx
+ cba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ cbd:	01 d6                	add    %edx,%esi
+ cbf:	89 f7                	mov    %esi,%edi
+ cc1:	89 d6                	mov    %edx,%esi
+ cc3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ cc7:	90                   	nop
+    putc(fd, buf[i]);
+ cc8:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+ ccb:	83 ec 04             	sub    $0x4,%esp
+ cce:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+ cd1:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+ cd4:	6a 01                	push   $0x1
+ cd6:	50                   	push   %eax
+ cd7:	53                   	push   %ebx
+ cd8:	e8 b3 f4 ff ff       	call   190 <bufwrite>
+  while(--i >= 0)
+ cdd:	89 fa                	mov    %edi,%edx
+ cdf:	83 c4 10             	add    $0x10,%esp
+ ce2:	83 ef 01             	sub    $0x1,%edi
+ ce5:	39 d6                	cmp    %edx,%esi
+ ce7:	75 df                	jne    cc8 <printf+0x1f8>
+        ap += 2;
+ ce9:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+ ced:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+ cf0:	31 f6                	xor    %esi,%esi
+ cf2:	e9 15 fe ff ff       	jmp    b0c <printf+0x3c>
+ cf7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cfe:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+ d00:	83 ec 04             	sub    $0x4,%esp
+ d03:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ d06:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ d09:	6a 01                	push   $0x1
+ d0b:	e9 8b fe ff ff       	jmp    b9b <printf+0xcb>
+
+00000d10 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ d10:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d11:	a1 00 26 00 00       	mov    0x2600,%eax
+{
+ d16:	89 e5                	mov    %esp,%ebp
+ d18:	57                   	push   %edi
+ d19:	56                   	push   %esi
+ d1a:	53                   	push   %ebx
+ d1b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ d1e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d28:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d2a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d2c:	39 ca                	cmp    %ecx,%edx
+ d2e:	73 30                	jae    d60 <free+0x50>
+ d30:	39 c1                	cmp    %eax,%ecx
+ d32:	72 04                	jb     d38 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d34:	39 c2                	cmp    %eax,%edx
+ d36:	72 f0                	jb     d28 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ d38:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ d3b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ d3e:	39 f8                	cmp    %edi,%eax
+ d40:	74 2e                	je     d70 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d42:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ d45:	8b 42 04             	mov    0x4(%edx),%eax
+ d48:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d4b:	39 f1                	cmp    %esi,%ecx
+ d4d:	74 38                	je     d87 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ d4f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ d51:	5b                   	pop    %ebx
+  freep = p;
+ d52:	89 15 00 26 00 00    	mov    %edx,0x2600
+}
+ d58:	5e                   	pop    %esi
+ d59:	5f                   	pop    %edi
+ d5a:	5d                   	pop    %ebp
+ d5b:	c3                   	ret
+ d5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d60:	39 c1                	cmp    %eax,%ecx
+ d62:	72 d0                	jb     d34 <free+0x24>
+ d64:	eb c2                	jmp    d28 <free+0x18>
+ d66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d6d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ d70:	03 70 04             	add    0x4(%eax),%esi
+ d73:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d76:	8b 02                	mov    (%edx),%eax
+ d78:	8b 00                	mov    (%eax),%eax
+ d7a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ d7d:	8b 42 04             	mov    0x4(%edx),%eax
+ d80:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d83:	39 f1                	cmp    %esi,%ecx
+ d85:	75 c8                	jne    d4f <free+0x3f>
+    p->s.size += bp->s.size;
+ d87:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ d8a:	89 15 00 26 00 00    	mov    %edx,0x2600
+    p->s.size += bp->s.size;
+ d90:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ d93:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ d96:	89 0a                	mov    %ecx,(%edx)
+}
+ d98:	5b                   	pop    %ebx
+ d99:	5e                   	pop    %esi
+ d9a:	5f                   	pop    %edi
+ d9b:	5d                   	pop    %ebp
+ d9c:	c3                   	ret
+ d9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000da0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ da0:	55                   	push   %ebp
+ da1:	89 e5                	mov    %esp,%ebp
+ da3:	57                   	push   %edi
+ da4:	56                   	push   %esi
+ da5:	53                   	push   %ebx
+ da6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ da9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ dac:	8b 15 00 26 00 00    	mov    0x2600,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ db2:	8d 78 07             	lea    0x7(%eax),%edi
+ db5:	c1 ef 03             	shr    $0x3,%edi
+ db8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ dbb:	85 d2                	test   %edx,%edx
+ dbd:	0f 84 8d 00 00 00    	je     e50 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ dc3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ dc5:	8b 48 04             	mov    0x4(%eax),%ecx
+ dc8:	39 f9                	cmp    %edi,%ecx
+ dca:	73 64                	jae    e30 <malloc+0x90>
+  if(nu < 4096)
+ dcc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ dd1:	39 df                	cmp    %ebx,%edi
+ dd3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ dd6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ ddd:	eb 0a                	jmp    de9 <malloc+0x49>
+ ddf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ de0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ de2:	8b 48 04             	mov    0x4(%eax),%ecx
+ de5:	39 f9                	cmp    %edi,%ecx
+ de7:	73 47                	jae    e30 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ de9:	89 c2                	mov    %eax,%edx
+ deb:	39 05 00 26 00 00    	cmp    %eax,0x2600
+ df1:	75 ed                	jne    de0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ df3:	83 ec 0c             	sub    $0xc,%esp
+ df6:	56                   	push   %esi
+ df7:	e8 c7 fa ff ff       	call   8c3 <sbrk>
+  if(p == (char*)-1)
+ dfc:	83 c4 10             	add    $0x10,%esp
+ dff:	83 f8 ff             	cmp    $0xffffffff,%eax
+ e02:	74 1c                	je     e20 <malloc+0x80>
+  hp->s.size = nu;
+ e04:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ e07:	83 ec 0c             	sub    $0xc,%esp
+ e0a:	83 c0 08             	add    $0x8,%eax
+ e0d:	50                   	push   %eax
+ e0e:	e8 fd fe ff ff       	call   d10 <free>
+  return freep;
+ e13:	8b 15 00 26 00 00    	mov    0x2600,%edx
+      if((p = morecore(nunits)) == 0)
+ e19:	83 c4 10             	add    $0x10,%esp
+ e1c:	85 d2                	test   %edx,%edx
+ e1e:	75 c0                	jne    de0 <malloc+0x40>
+        return 0;
+  }
+}
+ e20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ e23:	31 c0                	xor    %eax,%eax
+}
+ e25:	5b                   	pop    %ebx
+ e26:	5e                   	pop    %esi
+ e27:	5f                   	pop    %edi
+ e28:	5d                   	pop    %ebp
+ e29:	c3                   	ret
+ e2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ e30:	39 cf                	cmp    %ecx,%edi
+ e32:	74 4c                	je     e80 <malloc+0xe0>
+        p->s.size -= nunits;
+ e34:	29 f9                	sub    %edi,%ecx
+ e36:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ e39:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ e3c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ e3f:	89 15 00 26 00 00    	mov    %edx,0x2600
+}
+ e45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ e48:	83 c0 08             	add    $0x8,%eax
+}
+ e4b:	5b                   	pop    %ebx
+ e4c:	5e                   	pop    %esi
+ e4d:	5f                   	pop    %edi
+ e4e:	5d                   	pop    %ebp
+ e4f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ e50:	c7 05 00 26 00 00 04 	movl   $0x2604,0x2600
+ e57:	26 00 00 
+    base.s.size = 0;
+ e5a:	b8 04 26 00 00       	mov    $0x2604,%eax
+    base.s.ptr = freep = prevp = &base;
+ e5f:	c7 05 04 26 00 00 04 	movl   $0x2604,0x2604
+ e66:	26 00 00 
+    base.s.size = 0;
+ e69:	c7 05 08 26 00 00 00 	movl   $0x0,0x2608
+ e70:	00 00 00 
+    if(p->s.size >= nunits){
+ e73:	e9 54 ff ff ff       	jmp    dcc <malloc+0x2c>
+ e78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e7f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ e80:	8b 08                	mov    (%eax),%ecx
+ e82:	89 0a                	mov    %ecx,(%edx)
+ e84:	eb b9                	jmp    e3f <malloc+0x9f>
+ e86:	66 90                	xchg   %ax,%ax
+ e88:	66 90                	xchg   %ax,%ax
+ e8a:	66 90                	xchg   %ax,%ax
+ e8c:	66 90                	xchg   %ax,%ax
+ e8e:	66 90                	xchg   %ax,%ax
+
+00000e90 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+ e90:	55                   	push   %ebp
+ e91:	89 e5                	mov    %esp,%ebp
+ e93:	57                   	push   %edi
+ e94:	56                   	push   %esi
+ e95:	be 01 00 00 00       	mov    $0x1,%esi
+ e9a:	53                   	push   %ebx
+ e9b:	83 ec 28             	sub    $0x28,%esp
+ e9e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ ea1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ ea4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+ ea7:	68 00 98 00 00       	push   $0x9800
+ eac:	e8 ef fe ff ff       	call   da0 <malloc>
+ eb1:	83 c4 10             	add    $0x10,%esp
+ eb4:	89 c7                	mov    %eax,%edi
+ eb6:	85 c0                	test   %eax,%eax
+ eb8:	74 62                	je     f1c <waitpoll+0x8c>
+ eba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+ ec0:	83 ec 0c             	sub    $0xc,%esp
+ ec3:	6a 01                	push   $0x1
+ ec5:	e8 03 fa ff ff       	call   8cd <sleep>
+    fn();
+ eca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ ecd:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+ ecf:	58                   	pop    %eax
+ ed0:	5a                   	pop    %edx
+ ed1:	68 00 02 00 00       	push   $0x200
+ ed6:	57                   	push   %edi
+ ed7:	e8 eb fa ff ff       	call   9c7 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+ edc:	83 c4 10             	add    $0x10,%esp
+ edf:	85 c0                	test   %eax,%eax
+ ee1:	7e 2d                	jle    f10 <waitpoll+0x80>
+ ee3:	6b c0 4c             	imul   $0x4c,%eax,%eax
+ ee6:	89 fa                	mov    %edi,%edx
+    alive = 0;
+ ee8:	31 c9                	xor    %ecx,%ecx
+ eea:	01 f8                	add    %edi,%eax
+ eec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+ ef0:	3b 1a                	cmp    (%edx),%ebx
+ ef2:	75 07                	jne    efb <waitpoll+0x6b>
+        alive = 1;
+ ef4:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+ ef8:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+ efb:	83 c2 4c             	add    $0x4c,%edx
+ efe:	39 d0                	cmp    %edx,%eax
+ f00:	75 ee                	jne    ef0 <waitpoll+0x60>
+  } while(alive);
+ f02:	85 c9                	test   %ecx,%ecx
+ f04:	75 ba                	jne    ec0 <waitpoll+0x30>
+ f06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f0d:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+ f10:	83 ec 0c             	sub    $0xc,%esp
+ f13:	57                   	push   %edi
+ f14:	e8 f7 fd ff ff       	call   d10 <free>
+  wait();
+ f19:	83 c4 10             	add    $0x10,%esp
+}
+ f1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ f1f:	5b                   	pop    %ebx
+ f20:	5e                   	pop    %esi
+ f21:	5f                   	pop    %edi
+ f22:	5d                   	pop    %ebp
+  wait();
+ f23:	e9 10 f9 ff ff       	jmp    838 <wait>
+ f28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f2f:	90                   	nop
+
+00000f30 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+ f30:	55                   	push   %ebp
+ f31:	89 e5                	mov    %esp,%ebp
+ f33:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+ f36:	c7 45 f0 8d 10 00 00 	movl   $0x108d,-0x10(%ebp)
+ f3d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+ f44:	e8 87 f4 ff ff       	call   3d0 <fork>
+ f49:	85 c0                	test   %eax,%eax
+ f4b:	78 09                	js     f56 <runps+0x26>
+    return -1;
+  if(pid == 0){
+ f4d:	74 0e                	je     f5d <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+ f4f:	e8 e4 f8 ff ff       	call   838 <wait>
+}
+ f54:	c9                   	leave
+ f55:	c3                   	ret
+ f56:	c9                   	leave
+    return -1;
+ f57:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ f5c:	c3                   	ret
+    exec("ps", argv);
+ f5d:	50                   	push   %eax
+ f5e:	50                   	push   %eax
+ f5f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ f62:	50                   	push   %eax
+ f63:	68 8d 10 00 00       	push   $0x108d
+ f68:	e8 c3 f4 ff ff       	call   430 <exec>
+    printf(2, "exec ps failed\n");
+ f6d:	5a                   	pop    %edx
+ f6e:	59                   	pop    %ecx
+ f6f:	68 90 10 00 00       	push   $0x1090
+ f74:	6a 02                	push   $0x2
+ f76:	e8 55 fb ff ff       	call   ad0 <printf>
+    exit();
+ f7b:	e8 a0 f4 ff ff       	call   420 <exit>
@@ -0,0 +1,75 @@
+// Time getpid() and yield() entering the kernel through
+// int $T_SYSCALL and through sysenter, in TSC cycles per call.
+//
+// usage: syscallbench [calls]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "syscall.h"
+#include "traps.h"
+#include "mmu.h"
+#include "x86.h"
+
+static int
+intcall(int num)
+{
+  int r;
+
+  asm volatile("int %1" : "=a" (r) : "i" (T_SYSCALL), "a" (num) : "memory");
+  return r;
+}
+
+// The same calling sequence as syscallentry in usys.S.
+static int
+sysentercall(int num)
+{
+  int r;
+
+  asm volatile("movl %%esp, %%ecx\n"
+               "movl $1f, %%edx\n"
+               "sysenter\n"
+               "1:"
+               : "=a" (r) : "a" (num) : "ecx", "edx", "memory");
+  return r;
+}
+
+void
+run(char *name, int (*call)(int), int num, int n)
+{
+  uint64 t;
+  int i;
+
+  t = rdtsc();
+  for(i = 0; i < n; i++)
+    call(num);
+  t = rdtsc() - t;
+  printf(1, "%s: %d cycles per call\n", name, (uint)div64(t, n));
+}
+
+int
+main(int argc, char *argv[])
+{
+  uint eax, ebx, ecx, edx;
+  int n;
+
+  n = argc > 1 ? atoi(argv[1]) : 100000;
+  if(n <= 0)
+    n = 1;
+
+  run("getpid int", intcall, SYS_getpid, n);
+  run("yield int", intcall, SYS_yield, n);
+
+  cpuinfo(1, &eax, &ebx, &ecx, &edx);
+  if((edx & CPUID_SEP) == 0){
+    printf(1, "syscallbench: no sysenter on this cpu\n");
+    exit();
+  }
+  if(sysentercall(SYS_getpid) != getpid()){
+    printf(2, "syscallbench: sysenter getpid is wrong\n");
+    exit();
+  }
+  run("getpid sysenter", sysentercall, SYS_getpid, n);
+  run("yield sysenter", sysentercall, SYS_yield, n);
+  exit();
+}
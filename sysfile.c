@@ -15,6 +15,9 @@
 #include "sleeplock.h"
 #include "file.h"
 #include "fcntl.h"
+#include "logstat.h"
+#include "icachestat.h"
+#include "uio.h"
 
 // Fetch the nth word-sized system call argument as a file descriptor
 // and return both the descriptor and the corresponding struct file.
@@ -85,11 +88,88 @@ sys_write(void)
   int n;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr_ro(1, &p, n) < 0)
     return -1;
   return filewrite(f, p, n);
 }
 
+// Fetch the iovcnt-entry iovec array that is the nth system
+// call argument into iov, checking each buffer.
+static int
+argiov(int n, struct iovec *iov, int iovcnt, int write)
+{
+  char *p;
+  int i;
+
+  if(iovcnt <= 0 || iovcnt > NIOV)
+    return -1;
+  if(argptr_ro(n, &p, iovcnt*sizeof(iov[0])) < 0)
+    return -1;
+  memmove(iov, p, iovcnt*sizeof(iov[0]));
+  for(i = 0; i < iovcnt; i++)
+    if(fetchbuf((uint)iov[i].base, iov[i].len, write) < 0)
+      return -1;
+  return 0;
+}
+
+int
+sys_readv(void)
+{
+  struct file *f;
+  struct iovec iov[NIOV];
+  int n;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argiov(1, iov, n, 1) < 0)
+    return -1;
+  return filereadv(f, iov, n, &f->off);
+}
+
+int
+sys_writev(void)
+{
+  struct file *f;
+  struct iovec iov[NIOV];
+  int n;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argiov(1, iov, n, 0) < 0)
+    return -1;
+  return filewritev(f, iov, n, &f->off);
+}
+
+// Read at a given offset, leaving the file's own alone.
+int
+sys_pread(void)
+{
+  struct file *f;
+  struct iovec v;
+  int n, off;
+  char *p;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0 ||
+     argint(3, &off) < 0 || off < 0 || f->type != FD_INODE)
+    return -1;
+  v.base = p;
+  v.len = n;
+  return filereadv(f, &v, 1, (uint*)&off);
+}
+
+// Write at a given offset, leaving the file's own alone.
+int
+sys_pwrite(void)
+{
+  struct file *f;
+  struct iovec v;
+  int n, off;
+  char *p;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr_ro(1, &p, n) < 0 ||
+     argint(3, &off) < 0 || off < 0 || f->type != FD_INODE)
+    return -1;
+  v.base = p;
+  v.len = n;
+  return filewritev(f, &v, 1, (uint*)&off);
+}
+
 int
 sys_close(void)
 {
@@ -185,7 +265,6 @@ int
 sys_unlink(void)
 {
   struct inode *ip, *dp;
-  struct dirent de;
   char name[DIRSIZ], *path;
   uint off;
 
@@ -215,9 +294,7 @@ sys_unlink(void)
     goto bad;
   }
 
-  memset(&de, 0, sizeof(de));
-  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-    panic("unlink: writei");
+  dirunlink(dp, name, off);
   if(ip->type == T_DIR){
     dp->nlink--;
     iupdate(dp);
@@ -267,19 +344,30 @@ create(char *path, short type, short major, short minor)
   iupdate(ip);
 
   if(type == T_DIR){  // Create . and .. entries.
-    dp->nlink++;  // for ".."
-    iupdate(dp);
     // No ip->nlink++ for ".": avoid cyclic ref count.
     if(dirlink(ip, ".", ip->inum) < 0 || dirlink(ip, "..", dp->inum) < 0)
-      panic("create dots");
+      goto fail;
   }
 
   if(dirlink(dp, name, ip->inum) < 0)
-    panic("create: dirlink");
+    goto fail;
+
+  if(type == T_DIR){
+    dp->nlink++;  // for ".."
+    iupdate(dp);
+  }
 
   iunlockput(dp);
 
   return ip;
+
+fail:
+  // The disk is full: free ip again.
+  ip->nlink = 0;
+  iupdate(ip);
+  iunlockput(ip);
+  iunlockput(dp);
+  return 0;
 }
 
 int
@@ -332,14 +420,14 @@ sys_open(void)
   return fd;
 }
 
-int
-sys_mkdir(void)
+static int
+mkdir1(short major)
 {
   char *path;
   struct inode *ip;
 
   begin_op();
-  if(argstr(0, &path) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
+  if(argstr(0, &path) < 0 || (ip = create(path, T_DIR, major, 0)) == 0){
     end_op();
     return -1;
   }
@@ -348,6 +436,20 @@ sys_mkdir(void)
   return 0;
 }
 
+int
+sys_mkdir(void)
+{
+  return mkdir1(0);
+}
+
+// Make a hashed directory, for one that will hold
+// many more names than a few blocks' worth.
+int
+sys_mkhdir(void)
+{
+  return mkdir1(DIRHASHED);
+}
+
 int
 sys_mknod(void)
 {
@@ -443,58 +545,153 @@ sys_pipe(void)
   return 0;
 }
 
-int sys_copy_file(void) {
+// Copy file src to dest, creating dest if needed.
+int
+sys_copy_file(void)
+{
   char *src, *dest;
   struct inode *ip_src, *ip_dest;
-  int n;
   uint off_src = 0, off_dest = 0;
-  char buf[512];
+  int r;
 
-  // Get arguments from user
-  if (argstr(0, &src) < 0 || argstr(1, &dest) < 0)
+  if(argstr(0, &src) < 0 || argstr(1, &dest) < 0)
     return -1;
 
   begin_op();
-
-  // Get source inode
-  if ((ip_src = namei(src)) == 0) {
+  if((ip_src = namei(src)) == 0){
     end_op();
     return -1;
   }
   ilock(ip_src);
-
-  // Check if source is a regular file
-  if (ip_src->type != T_FILE) {
+  if(ip_src->type != T_FILE){
     iunlockput(ip_src);
     end_op();
     return -1;
   }
-
-  // Create destination file
-  if ((ip_dest = create(dest, T_FILE, 0, 0)) == 0) {
-    iunlockput(ip_src);
+  iunlock(ip_src);
+  if((ip_dest = create(dest, T_FILE, 0, 0)) == 0){
+    iput(ip_src);
     end_op();
     return -1;
   }
+  iunlock(ip_dest);
+  end_op();
 
-  // Copy data
-  while (off_src < ip_src->size) {
-    n = readi(ip_src, buf, off_src, sizeof(buf));
-    if (n <= 0)
-      break;
-    if (writei(ip_dest, buf, off_dest, n) != n) {
-      iunlockput(ip_src);
-      iunlockput(ip_dest);
-      end_op();
-      return -1;
-    }
-    off_src += n;
-    off_dest += n;
-  }
+  r = copyrange(ip_src, &off_src, ip_dest, &off_dest, MAXFILE*BSIZE);
 
-  iunlockput(ip_src);
-  iunlockput(ip_dest);
+  begin_op();
+  iput(ip_src);
+  iput(ip_dest);
   end_op();
+  return r < 0 ? -1 : 0;
+}
 
+// Copy up to n bytes between two open files,
+// from and to their current offsets.
+int
+sys_copy_file_range(void)
+{
+  struct file *in, *out;
+  int n;
+
+  if(argfd(0, 0, &in) < 0 || argfd(1, 0, &out) < 0 || argint(2, &n) < 0)
+    return -1;
+  return filecopy(in, out, n);
+}
+
+// Switch the disk driver between PIO and DMA transfers.
+// Returns the previous mode, or -1 if the mode is unavailable.
+int
+sys_setidemode(void)
+{
+  int mode;
+
+  if(argint(0, &mode) < 0)
+    return -1;
+  return idesetmode(mode);
+}
+
+// Copy the log traffic counters to user space.
+int
+sys_logstat(void)
+{
+  struct logstat *st;
+
+  if(argptr(0, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  log_stat(st);
+  return 0;
+}
+
+// Map a file into memory. Returns the address, or -1.
+int
+sys_mmap(void)
+{
+  struct file *f;
+  int off, len, prot, flags, type;
+  uint addr;
+
+  if(argfd(0, 0, &f) < 0 || argint(1, &off) < 0 || argint(2, &len) < 0 ||
+     argint(3, &prot) < 0 || argint(4, &flags) < 0)
+    return -1;
+  if(off < 0 || off % PGSIZE || len <= 0)
+    return -1;
+  if(flags != MAP_SHARED && flags != MAP_PRIVATE)
+    return -1;
+  if(f->type != FD_INODE || !f->readable)
+    return -1;
+  if(flags == MAP_SHARED && (prot & PROT_WRITE) && !f->writable)
+    return -1;
+  ilock(f->ip);
+  type = f->ip->type;
+  iunlock(f->ip);
+  if(type != T_FILE)
+    return -1;
+
+  if((addr = mmap(f, off, len, prot, flags)) == 0)
+    return -1;
+  return addr;
+}
+
+int
+sys_munmap(void)
+{
+  int addr, len;
+
+  if(argint(0, &addr) < 0 || argint(1, &len) < 0)
+    return -1;
+  return munmap(myproc(), addr, len);
+}
+
+int
+sys_icachestat(void)
+{
+  struct icachestat *st;
+
+  if(argptr(0, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  icache_stat(st);
+  return 0;
+}
+
+// Number of free blocks on the root disk.
+int
+sys_fsfree(void)
+{
+  return bfreecount();
+}
+
+// Put fd's buffered data on disk and wait
+// until it and its metadata are committed.
+int
+sys_fsync(void)
+{
+  struct file *f;
+
+  if(argfd(0, 0, &f) < 0 || f->type != FD_INODE)
+    return -1;
+  if(f->writable)
+    iflush(f->ip);
+  log_sync();
   return 0;
 }
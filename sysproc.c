@@ -8,19 +8,16 @@
 #include "proc.h"
 #include "spinlock.h"  // Add this line
 #include "fcntl.h" // Include for scheduler policy defines
-
-extern struct {
-  struct spinlock lock;
-  struct proc proc[NPROC];
-} ptable;
+#include "procinfo.h"
+#include "schedlat.h"
+#include "trace.h"
+#include "prof.h"
+#include "lockstat.h"
 
 // Also include for tickslock
 extern struct spinlock tickslock;
 extern uint ticks;
 
-// Extern the global scheduler variable from proc.c
-extern int current_scheduler;
-
 int
 sys_fork(void)
 {
@@ -144,26 +141,11 @@ int
 sys_get_process_lifetime(void)
 {
   int pid;
-  struct proc *p;
-  uint lifetime = 0;
 
   if(argint(0, &pid) < 0)
     return -1;
 
-  acquire(&ptable.lock);
-
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->state != UNUSED && p->pid == pid){
-      acquire(&tickslock);
-      lifetime = ticks - p->createtime;
-      release(&tickslock);
-      release(&ptable.lock);
-      return lifetime;
-    }
-  }
-
-  release(&ptable.lock);
-  return -1; // PID not found
+  return proclifetime(pid);
 }
 
 int
@@ -181,10 +163,10 @@ sys_getnumsyscallsgood(void)
 int
 sys_waitx(void)
 {
-  int *wtime, *rtime;
+  uint64 *wtime, *rtime;
   
-  if(argptr(0, (char**)&wtime, sizeof(int)) < 0 || 
-     argptr(1, (char**)&rtime, sizeof(int)) < 0)
+  if(argptr(0, (char**)&wtime, sizeof(*wtime)) < 0 || 
+     argptr(1, (char**)&rtime, sizeof(*rtime)) < 0)
     return -1;
   
   return waitx(wtime, rtime);
@@ -204,39 +186,119 @@ sys_set_priority(void)
   return 0;
 }
 
-// System call to display process information
+// Copy out a snapshot of the process table,
+// for ps to format in user space.
 int
-sys_ps(void)
+sys_getprocinfo(void)
 {
-  struct proc *p;
-  static char *states[] = {
-    [UNUSED]    "UNUSED  ",
-    [EMBRYO]    "EMBRYO  ",
-    [SLEEPING]  "SLEEPING",
-    [RUNNABLE]  "RUNNABLE",
-    [RUNNING]   "RUNNING ",
-    [ZOMBIE]    "ZOMBIE  "
-  };
-  
-  cprintf("PID\tSTATE\t\tPRIORITY\tRUNTIME\tBURST\tNAME\n");
-  cprintf("--------------------------------------------------\n");
-  
-  acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->state == UNUSED)
-      continue;
-    
-    cprintf("%d\t%s\t%d\t\t%d\t%d\t%s\n", 
-      p->pid, 
-      states[p->state], 
-      p->priority, 
-      p->runtime,
-      p->estimated_burst,
-      p->name);
-  }
-  release(&ptable.lock);
-  
-  return 0;
+  struct procinfo *pi;
+  int max;
+
+  if(argint(1, &max) < 0 || max < 0)
+    return -1;
+  if(max > NPROC)
+    max = NPROC;
+  if(argptr(0, (void*)&pi, max*sizeof(*pi)) < 0)
+    return -1;
+  return getprocinfo(pi, max);
+}
+
+// Copy out each CPU's run queue latency histogram.
+int
+sys_schedlat(void)
+{
+  struct schedlat *sl;
+  int max;
+
+  if(argint(1, &max) < 0 || max < 0)
+    return -1;
+  if(max > NCPU)
+    max = NCPU;
+  if(argptr(0, (void*)&sl, max*sizeof(*sl)) < 0)
+    return -1;
+  return schedlat(sl, max);
+}
+
+// Turn kernel event tracing on or off.
+int
+sys_tracectl(void)
+{
+  int on;
+
+  if(argint(0, &on) < 0)
+    return -1;
+  return tracectl(on);
+}
+
+// Drain up to n trace events into the caller's buffer.
+int
+sys_traceread(void)
+{
+  struct traceev *buf;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0)
+    return -1;
+  if(n > NCPU*(NTRACE+1))
+    n = NCPU*(NTRACE+1);
+  if(argptr(0, (void*)&buf, n*sizeof(*buf)) < 0)
+    return -1;
+  return traceread(buf, n);
+}
+
+// Start the profiler at about hz samples a second, or stop it.
+int
+sys_profctl(void)
+{
+  int hz;
+
+  if(argint(0, &hz) < 0)
+    return -1;
+  return profctl(hz);
+}
+
+// Drain up to n profiler samples into the caller's buffer.
+int
+sys_profread(void)
+{
+  struct profsample *buf;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0)
+    return -1;
+  if(n > NCPU*NPROFILE)
+    n = NCPU*NPROFILE;
+  if(argptr(0, (void*)&buf, n*sizeof(*buf)) < 0)
+    return -1;
+  return profread(buf, n);
+}
+
+// Copy out the counters of up to max spinlocks,
+// and zero them if reset is set.
+int
+sys_lockstat(void)
+{
+  struct lockstat *ls;
+  int max, reset;
+
+  if(argint(1, &max) < 0 || argint(2, &reset) < 0 || max < 0)
+    return -1;
+  if(max > MAXLOCKSTAT)
+    max = MAXLOCKSTAT;
+  if(argptr(0, (void*)&ls, max*sizeof(*ls)) < 0)
+    return -1;
+  return lockstat(ls, max, reset);
+}
+
+// Contend for a shared spinlock for n ticks.
+int
+sys_lockbench(void)
+{
+  int n;
+
+  if(argint(0, &n) < 0)
+    return -1;
+  return lockbench(n);
 }
 
 int
@@ -331,10 +393,7 @@ sys_setschedpolicy(void)
      return -1; // Invalid policy number
   }
 
-  // Acquire lock to safely modify the global variable
-  acquire(&ptable.lock);
-  current_scheduler = policy;
-  release(&ptable.lock);
+  setscheduler(policy);
 
   cprintf("Scheduler policy changed to %d\n", policy); // Optional: confirmation message
 
@@ -0,0 +1,1945 @@
+
+_testprio:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+int main() {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "Setting priority to 10...\n");
+  11:	68 30 0e 00 00       	push   $0xe30
+  16:	6a 01                	push   $0x1
+  18:	e8 63 09 00 00       	call   980 <printf>
+  set_priority(10);
+  1d:	c7 04 24 0a 00 00 00 	movl   $0xa,(%esp)
+  24:	e8 b8 07 00 00       	call   7e1 <set_priority>
+  printf(1, "Priority set. Process continues.\n");
+  29:	58                   	pop    %eax
+  2a:	5a                   	pop    %edx
+  2b:	68 4c 0e 00 00       	push   $0xe4c
+  30:	6a 01                	push   $0x1
+  32:	e8 49 09 00 00       	call   980 <printf>
+
+  exit();
+  37:	e8 94 02 00 00       	call   2d0 <exit>
+  3c:	66 90                	xchg   %ax,%ax
+  3e:	66 90                	xchg   %ax,%ax
+
+00000040 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+  40:	55                   	push   %ebp
+  41:	89 e5                	mov    %esp,%ebp
+  43:	57                   	push   %edi
+  44:	56                   	push   %esi
+  45:	53                   	push   %ebx
+  46:	83 ec 4c             	sub    $0x4c,%esp
+  49:	8b 45 0c             	mov    0xc(%ebp),%eax
+  4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  4f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  52:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+  55:	83 fa 0f             	cmp    $0xf,%edx
+  58:	0f 87 32 01 00 00    	ja     190 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+  5e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+  64:	8b 80 60 13 00 00    	mov    0x1360(%eax),%eax
+  6a:	85 c0                	test   %eax,%eax
+  6c:	0f 84 de 00 00 00    	je     150 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+  72:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+  78:	8b b0 64 13 00 00    	mov    0x1364(%eax),%esi
+  7e:	8d 88 60 13 00 00    	lea    0x1360(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+  84:	8d b8 68 13 00 00    	lea    0x1368(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+  8a:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+  8d:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+  90:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+  93:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+  99:	0f 8f 01 01 00 00    	jg     1a0 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+  9f:	8d 78 08             	lea    0x8(%eax),%edi
+  a2:	8d bc 3e 60 13 00 00 	lea    0x1360(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+  a9:	85 db                	test   %ebx,%ebx
+  ab:	7e 3b                	jle    e8 <bufwrite+0xa8>
+  ad:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+  b0:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  b7:	90                   	nop
+    *dst++ = *src++;
+  b8:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+  b9:	39 c6                	cmp    %eax,%esi
+  bb:	75 fb                	jne    b8 <bufwrite+0x78>
+  ob[fd].n += n;
+  bd:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+  c3:	8b 88 64 13 00 00    	mov    0x1364(%eax),%ecx
+  c9:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+  cb:	83 b8 60 13 00 00 01 	cmpl   $0x1,0x1360(%eax)
+  ob[fd].n += n;
+  d2:	89 88 64 13 00 00    	mov    %ecx,0x1364(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+  d8:	74 26                	je     100 <bufwrite+0xc0>
+}
+  da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  dd:	5b                   	pop    %ebx
+  de:	5e                   	pop    %esi
+  df:	5f                   	pop    %edi
+  e0:	5d                   	pop    %ebp
+  e1:	c3                   	ret
+  e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+  e8:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+  eb:	83 b8 60 13 00 00 01 	cmpl   $0x1,0x1360(%eax)
+  ob[fd].n += n;
+  f2:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+  f5:	75 e3                	jne    da <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+  f7:	85 db                	test   %ebx,%ebx
+  f9:	74 df                	je     da <bufwrite+0x9a>
+  fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ff:	90                   	nop
+  src = vsrc;
+ 100:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 103:	01 c3                	add    %eax,%ebx
+ 105:	eb 10                	jmp    117 <bufwrite+0xd7>
+ 107:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10e:	66 90                	xchg   %ax,%ax
+ 110:	83 c0 01             	add    $0x1,%eax
+ 113:	39 d8                	cmp    %ebx,%eax
+ 115:	74 c3                	je     da <bufwrite+0x9a>
+    if(*p == (char)c)
+ 117:	80 38 0a             	cmpb   $0xa,(%eax)
+ 11a:	75 f4                	jne    110 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 11c:	85 c9                	test   %ecx,%ecx
+ 11e:	7e ba                	jle    da <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 120:	83 ec 04             	sub    $0x4,%esp
+ 123:	51                   	push   %ecx
+ 124:	ff 75 ac             	push   -0x54(%ebp)
+ 127:	52                   	push   %edx
+ 128:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+ 12b:	e8 cd 05 00 00       	call   6fd <write>
+    ob[fd].n = 0;
+ 130:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+ 133:	83 c4 10             	add    $0x10,%esp
+ 136:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+ 13c:	c7 82 64 13 00 00 00 	movl   $0x0,0x1364(%edx)
+ 143:	00 00 00 
+ 146:	eb 92                	jmp    da <bufwrite+0x9a>
+ 148:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14f:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 150:	83 ec 08             	sub    $0x8,%esp
+ 153:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 156:	50                   	push   %eax
+ 157:	52                   	push   %edx
+ 158:	89 55 b0             	mov    %edx,-0x50(%ebp)
+ 15b:	e8 d7 05 00 00       	call   737 <fstat>
+ 160:	83 c4 10             	add    $0x10,%esp
+ 163:	8b 55 b0             	mov    -0x50(%ebp),%edx
+ 166:	89 c1                	mov    %eax,%ecx
+ 168:	b8 02 00 00 00       	mov    $0x2,%eax
+ 16d:	85 c9                	test   %ecx,%ecx
+ 16f:	75 0d                	jne    17e <bufwrite+0x13e>
+ 171:	31 c0                	xor    %eax,%eax
+ 173:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 178:	0f 95 c0             	setne  %al
+ 17b:	83 c0 01             	add    $0x1,%eax
+ 17e:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+ 184:	89 81 60 13 00 00    	mov    %eax,0x1360(%ecx)
+ 18a:	e9 e3 fe ff ff       	jmp    72 <bufwrite+0x32>
+ 18f:	90                   	nop
+}
+ 190:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 193:	5b                   	pop    %ebx
+ 194:	5e                   	pop    %esi
+ 195:	5f                   	pop    %edi
+ 196:	5d                   	pop    %ebp
+    write(fd, p, n);
+ 197:	e9 61 05 00 00       	jmp    6fd <write>
+ 19c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+ 1a0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+ 1a3:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+ 1a6:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+ 1a9:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+ 1ac:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+ 1af:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+ 1b2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+ 1b5:	6a 02                	push   $0x2
+ 1b7:	50                   	push   %eax
+ 1b8:	52                   	push   %edx
+ 1b9:	e8 9b 06 00 00       	call   859 <writev>
+    ob[fd].n = 0;
+ 1be:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+ 1c1:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+ 1c4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ 1cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1ce:	5b                   	pop    %ebx
+ 1cf:	5e                   	pop    %esi
+ 1d0:	5f                   	pop    %edi
+ 1d1:	5d                   	pop    %ebp
+ 1d2:	c3                   	ret
+ 1d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000001e0 <fflush>:
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	53                   	push   %ebx
+ 1e4:	83 ec 04             	sub    $0x4,%esp
+ 1e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 1ea:	83 f8 0f             	cmp    $0xf,%eax
+ 1ed:	77 16                	ja     205 <fflush+0x25>
+ 1ef:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+ 1f5:	8b 8a 64 13 00 00    	mov    0x1364(%edx),%ecx
+ 1fb:	8d 9a 60 13 00 00    	lea    0x1360(%edx),%ebx
+ 201:	85 c9                	test   %ecx,%ecx
+ 203:	7f 0b                	jg     210 <fflush+0x30>
+}
+ 205:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 208:	c9                   	leave
+ 209:	c3                   	ret
+ 20a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 210:	83 ec 04             	sub    $0x4,%esp
+ 213:	81 c2 68 13 00 00    	add    $0x1368,%edx
+ 219:	51                   	push   %ecx
+ 21a:	52                   	push   %edx
+ 21b:	50                   	push   %eax
+ 21c:	e8 dc 04 00 00       	call   6fd <write>
+    ob[fd].n = 0;
+ 221:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+ 228:	83 c4 10             	add    $0x10,%esp
+}
+ 22b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 22e:	c9                   	leave
+ 22f:	c3                   	ret
+
+00000230 <fflushall>:
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 234:	31 f6                	xor    %esi,%esi
+{
+ 236:	53                   	push   %ebx
+ 237:	bb 68 13 00 00       	mov    $0x1368,%ebx
+ 23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 240:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 243:	85 c0                	test   %eax,%eax
+ 245:	7e 15                	jle    25c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 247:	83 ec 04             	sub    $0x4,%esp
+ 24a:	50                   	push   %eax
+ 24b:	53                   	push   %ebx
+ 24c:	56                   	push   %esi
+ 24d:	e8 ab 04 00 00       	call   6fd <write>
+    ob[fd].n = 0;
+ 252:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 259:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 25c:	83 c6 01             	add    $0x1,%esi
+ 25f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 265:	83 fe 10             	cmp    $0x10,%esi
+ 268:	75 d6                	jne    240 <fflushall+0x10>
+}
+ 26a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 26d:	5b                   	pop    %ebx
+ 26e:	5e                   	pop    %esi
+ 26f:	5d                   	pop    %ebp
+ 270:	c3                   	ret
+ 271:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 278:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27f:	90                   	nop
+
+00000280 <fork>:
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 284:	31 f6                	xor    %esi,%esi
+{
+ 286:	53                   	push   %ebx
+ 287:	bb 68 13 00 00       	mov    $0x1368,%ebx
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 290:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 293:	85 c0                	test   %eax,%eax
+ 295:	7e 15                	jle    2ac <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 297:	83 ec 04             	sub    $0x4,%esp
+ 29a:	50                   	push   %eax
+ 29b:	53                   	push   %ebx
+ 29c:	56                   	push   %esi
+ 29d:	e8 5b 04 00 00       	call   6fd <write>
+    ob[fd].n = 0;
+ 2a2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 2a9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 2ac:	83 c6 01             	add    $0x1,%esi
+ 2af:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 2b5:	83 fe 10             	cmp    $0x10,%esi
+ 2b8:	75 d6                	jne    290 <fork+0x10>
+}
+ 2ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2bd:	5b                   	pop    %ebx
+ 2be:	5e                   	pop    %esi
+ 2bf:	5d                   	pop    %ebp
+  return _fork();
+ 2c0:	e9 15 04 00 00       	jmp    6da <_fork>
+ 2c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002d0 <exit>:
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+ 2d6:	e8 55 ff ff ff       	call   230 <fflushall>
+  _exit();
+ 2db:	e8 01 04 00 00       	call   6e1 <_exit>
+
+000002e0 <exec>:
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	57                   	push   %edi
+ 2e4:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 2e5:	31 f6                	xor    %esi,%esi
+{
+ 2e7:	53                   	push   %ebx
+ 2e8:	bb 68 13 00 00       	mov    $0x1368,%ebx
+ 2ed:	83 ec 1c             	sub    $0x1c,%esp
+ 2f0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 2f6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 300:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 303:	85 c0                	test   %eax,%eax
+ 305:	7e 15                	jle    31c <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 307:	83 ec 04             	sub    $0x4,%esp
+ 30a:	50                   	push   %eax
+ 30b:	53                   	push   %ebx
+ 30c:	56                   	push   %esi
+ 30d:	e8 eb 03 00 00       	call   6fd <write>
+    ob[fd].n = 0;
+ 312:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 319:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 31c:	83 c6 01             	add    $0x1,%esi
+ 31f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 325:	83 fe 10             	cmp    $0x10,%esi
+ 328:	75 d6                	jne    300 <exec+0x20>
+  return _exec(path, argv);
+ 32a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 32d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+ 330:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ 333:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 336:	5b                   	pop    %ebx
+ 337:	5e                   	pop    %esi
+ 338:	5f                   	pop    %edi
+ 339:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 33a:	e9 d3 03 00 00       	jmp    712 <_exec>
+ 33f:	90                   	nop
+
+00000340 <close>:
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	56                   	push   %esi
+ 344:	53                   	push   %ebx
+ 345:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 348:	83 fb 0f             	cmp    $0xf,%ebx
+ 34b:	77 26                	ja     373 <close+0x33>
+ 34d:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 353:	8b 90 64 13 00 00    	mov    0x1364(%eax),%edx
+ 359:	8d b0 60 13 00 00    	lea    0x1360(%eax),%esi
+ 35f:	85 d2                	test   %edx,%edx
+ 361:	7f 25                	jg     388 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+ 363:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 369:	c7 80 60 13 00 00 00 	movl   $0x0,0x1360(%eax)
+ 370:	00 00 00 
+  return _close(fd);
+ 373:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 376:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 379:	5b                   	pop    %ebx
+ 37a:	5e                   	pop    %esi
+ 37b:	5d                   	pop    %ebp
+  return _close(fd);
+ 37c:	e9 83 03 00 00       	jmp    704 <_close>
+ 381:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 388:	83 ec 04             	sub    $0x4,%esp
+ 38b:	05 68 13 00 00       	add    $0x1368,%eax
+ 390:	52                   	push   %edx
+ 391:	50                   	push   %eax
+ 392:	53                   	push   %ebx
+ 393:	e8 65 03 00 00       	call   6fd <write>
+    ob[fd].n = 0;
+ 398:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+ 39f:	83 c4 10             	add    $0x10,%esp
+ 3a2:	eb bf                	jmp    363 <close+0x23>
+ 3a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3af:	90                   	nop
+
+000003b0 <strcpy>:
+{
+ 3b0:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+ 3b1:	31 c0                	xor    %eax,%eax
+{
+ 3b3:	89 e5                	mov    %esp,%ebp
+ 3b5:	53                   	push   %ebx
+ 3b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 3c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 3c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 3c7:	83 c0 01             	add    $0x1,%eax
+ 3ca:	84 d2                	test   %dl,%dl
+ 3cc:	75 f2                	jne    3c0 <strcpy+0x10>
+}
+ 3ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3d1:	89 c8                	mov    %ecx,%eax
+ 3d3:	c9                   	leave
+ 3d4:	c3                   	ret
+ 3d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <strcmp>:
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	53                   	push   %ebx
+ 3e4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 3ea:	0f b6 02             	movzbl (%edx),%eax
+ 3ed:	84 c0                	test   %al,%al
+ 3ef:	75 17                	jne    408 <strcmp+0x28>
+ 3f1:	eb 3a                	jmp    42d <strcmp+0x4d>
+ 3f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3f7:	90                   	nop
+ 3f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 3fc:	83 c2 01             	add    $0x1,%edx
+ 3ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 402:	84 c0                	test   %al,%al
+ 404:	74 1a                	je     420 <strcmp+0x40>
+    p++, q++;
+ 406:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 408:	0f b6 19             	movzbl (%ecx),%ebx
+ 40b:	38 c3                	cmp    %al,%bl
+ 40d:	74 e9                	je     3f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 40f:	29 d8                	sub    %ebx,%eax
+}
+ 411:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 414:	c9                   	leave
+ 415:	c3                   	ret
+ 416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 420:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 424:	31 c0                	xor    %eax,%eax
+ 426:	29 d8                	sub    %ebx,%eax
+}
+ 428:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 42b:	c9                   	leave
+ 42c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 42d:	0f b6 19             	movzbl (%ecx),%ebx
+ 430:	31 c0                	xor    %eax,%eax
+ 432:	eb db                	jmp    40f <strcmp+0x2f>
+ 434:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 43f:	90                   	nop
+
+00000440 <strlen>:
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+ 446:	80 3a 00             	cmpb   $0x0,(%edx)
+ 449:	74 15                	je     460 <strlen+0x20>
+ 44b:	31 c0                	xor    %eax,%eax
+ 44d:	8d 76 00             	lea    0x0(%esi),%esi
+ 450:	83 c0 01             	add    $0x1,%eax
+ 453:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 457:	89 c1                	mov    %eax,%ecx
+ 459:	75 f5                	jne    450 <strlen+0x10>
+}
+ 45b:	89 c8                	mov    %ecx,%eax
+ 45d:	5d                   	pop    %ebp
+ 45e:	c3                   	ret
+ 45f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 460:	31 c9                	xor    %ecx,%ecx
+}
+ 462:	5d                   	pop    %ebp
+ 463:	89 c8                	mov    %ecx,%eax
+ 465:	c3                   	ret
+ 466:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000470 <memset>:
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	57                   	push   %edi
+ 474:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 477:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 47a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 47d:	89 d7                	mov    %edx,%edi
+ 47f:	fc                   	cld
+ 480:	f3 aa                	rep stos %al,%es:(%edi)
+}
+ 482:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 485:	89 d0                	mov    %edx,%eax
+ 487:	c9                   	leave
+ 488:	c3                   	ret
+ 489:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <strchr>:
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	8b 45 08             	mov    0x8(%ebp),%eax
+ 496:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 49a:	0f b6 10             	movzbl (%eax),%edx
+ 49d:	84 d2                	test   %dl,%dl
+ 49f:	75 12                	jne    4b3 <strchr+0x23>
+ 4a1:	eb 1d                	jmp    4c0 <strchr+0x30>
+ 4a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4a7:	90                   	nop
+ 4a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 4ac:	83 c0 01             	add    $0x1,%eax
+ 4af:	84 d2                	test   %dl,%dl
+ 4b1:	74 0d                	je     4c0 <strchr+0x30>
+    if(*s == c)
+ 4b3:	38 d1                	cmp    %dl,%cl
+ 4b5:	75 f1                	jne    4a8 <strchr+0x18>
+}
+ 4b7:	5d                   	pop    %ebp
+ 4b8:	c3                   	ret
+ 4b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 4c0:	31 c0                	xor    %eax,%eax
+}
+ 4c2:	5d                   	pop    %ebp
+ 4c3:	c3                   	ret
+ 4c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4cf:	90                   	nop
+
+000004d0 <memchr>:
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	8b 55 10             	mov    0x10(%ebp),%edx
+ 4d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 4d9:	85 d2                	test   %edx,%edx
+ 4db:	74 1b                	je     4f8 <memchr+0x28>
+    if(*p == (char)c)
+ 4dd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+ 4e1:	01 c2                	add    %eax,%edx
+ 4e3:	eb 0a                	jmp    4ef <memchr+0x1f>
+ 4e5:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+ 4e8:	83 c0 01             	add    $0x1,%eax
+ 4eb:	39 c2                	cmp    %eax,%edx
+ 4ed:	74 09                	je     4f8 <memchr+0x28>
+    if(*p == (char)c)
+ 4ef:	38 08                	cmp    %cl,(%eax)
+ 4f1:	75 f5                	jne    4e8 <memchr+0x18>
+}
+ 4f3:	5d                   	pop    %ebp
+ 4f4:	c3                   	ret
+ 4f5:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+ 4f8:	31 c0                	xor    %eax,%eax
+}
+ 4fa:	5d                   	pop    %ebp
+ 4fb:	c3                   	ret
+ 4fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000500 <gets>:
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+ 504:	31 ff                	xor    %edi,%edi
+{
+ 506:	56                   	push   %esi
+ 507:	be 68 13 00 00       	mov    $0x1368,%esi
+ 50c:	53                   	push   %ebx
+ 50d:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 510:	8b 46 fc             	mov    -0x4(%esi),%eax
+ 513:	85 c0                	test   %eax,%eax
+ 515:	7e 15                	jle    52c <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 517:	83 ec 04             	sub    $0x4,%esp
+ 51a:	50                   	push   %eax
+ 51b:	56                   	push   %esi
+ 51c:	57                   	push   %edi
+ 51d:	e8 db 01 00 00       	call   6fd <write>
+    ob[fd].n = 0;
+ 522:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+ 529:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 52c:	83 c7 01             	add    $0x1,%edi
+ 52f:	81 c6 08 01 00 00    	add    $0x108,%esi
+ 535:	83 ff 10             	cmp    $0x10,%edi
+ 538:	75 d6                	jne    510 <gets+0x10>
+  for(i=0; i+1 < max; ){
+ 53a:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+ 53c:	8d 75 e7             	lea    -0x19(%ebp),%esi
+ 53f:	eb 2e                	jmp    56f <gets+0x6f>
+ 541:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 548:	83 ec 04             	sub    $0x4,%esp
+ 54b:	6a 01                	push   $0x1
+ 54d:	56                   	push   %esi
+ 54e:	6a 00                	push   $0x0
+ 550:	e8 a1 01 00 00       	call   6f6 <read>
+    if(cc < 1)
+ 555:	83 c4 10             	add    $0x10,%esp
+ 558:	85 c0                	test   %eax,%eax
+ 55a:	7e 1d                	jle    579 <gets+0x79>
+    buf[i++] = c;
+ 55c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 560:	8b 55 08             	mov    0x8(%ebp),%edx
+ 563:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 567:	3c 0a                	cmp    $0xa,%al
+ 569:	74 10                	je     57b <gets+0x7b>
+ 56b:	3c 0d                	cmp    $0xd,%al
+ 56d:	74 0c                	je     57b <gets+0x7b>
+  for(i=0; i+1 < max; ){
+ 56f:	89 df                	mov    %ebx,%edi
+ 571:	83 c3 01             	add    $0x1,%ebx
+ 574:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 577:	7c cf                	jl     548 <gets+0x48>
+ 579:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 57b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 57e:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 582:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 585:	5b                   	pop    %ebx
+ 586:	5e                   	pop    %esi
+ 587:	5f                   	pop    %edi
+ 588:	5d                   	pop    %ebp
+ 589:	c3                   	ret
+ 58a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000590 <stat>:
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	57                   	push   %edi
+ 594:	56                   	push   %esi
+ 595:	53                   	push   %ebx
+ 596:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+ 599:	6a 00                	push   $0x0
+ 59b:	ff 75 08             	push   0x8(%ebp)
+ 59e:	e8 76 01 00 00       	call   719 <open>
+  if(fd < 0)
+ 5a3:	83 c4 10             	add    $0x10,%esp
+ 5a6:	85 c0                	test   %eax,%eax
+ 5a8:	78 76                	js     620 <stat+0x90>
+  r = fstat(fd, st);
+ 5aa:	83 ec 08             	sub    $0x8,%esp
+ 5ad:	ff 75 0c             	push   0xc(%ebp)
+ 5b0:	89 c3                	mov    %eax,%ebx
+ 5b2:	50                   	push   %eax
+ 5b3:	e8 7f 01 00 00       	call   737 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 5b8:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 5bb:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 5bd:	83 fb 0f             	cmp    $0xf,%ebx
+ 5c0:	7f 40                	jg     602 <stat+0x72>
+ 5c2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 5c8:	8b 90 64 13 00 00    	mov    0x1364(%eax),%edx
+ 5ce:	8d b8 60 13 00 00    	lea    0x1360(%eax),%edi
+ 5d4:	85 d2                	test   %edx,%edx
+ 5d6:	7e 1a                	jle    5f2 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 5d8:	83 ec 04             	sub    $0x4,%esp
+ 5db:	05 68 13 00 00       	add    $0x1368,%eax
+ 5e0:	52                   	push   %edx
+ 5e1:	50                   	push   %eax
+ 5e2:	53                   	push   %ebx
+ 5e3:	e8 15 01 00 00       	call   6fd <write>
+    ob[fd].n = 0;
+ 5e8:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+ 5ef:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+ 5f2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 5f8:	c7 80 60 13 00 00 00 	movl   $0x0,0x1360(%eax)
+ 5ff:	00 00 00 
+  return _close(fd);
+ 602:	83 ec 0c             	sub    $0xc,%esp
+ 605:	53                   	push   %ebx
+ 606:	e8 f9 00 00 00       	call   704 <_close>
+ 60b:	83 c4 10             	add    $0x10,%esp
+}
+ 60e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 611:	89 f0                	mov    %esi,%eax
+ 613:	5b                   	pop    %ebx
+ 614:	5e                   	pop    %esi
+ 615:	5f                   	pop    %edi
+ 616:	5d                   	pop    %ebp
+ 617:	c3                   	ret
+ 618:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61f:	90                   	nop
+    return -1;
+ 620:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 625:	eb e7                	jmp    60e <stat+0x7e>
+ 627:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 62e:	66 90                	xchg   %ax,%ax
+
+00000630 <atoi>:
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	53                   	push   %ebx
+ 634:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 637:	0f be 02             	movsbl (%edx),%eax
+ 63a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 63d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 640:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 645:	77 1e                	ja     665 <atoi+0x35>
+ 647:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 64e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 650:	83 c2 01             	add    $0x1,%edx
+ 653:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 656:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 65a:	0f be 02             	movsbl (%edx),%eax
+ 65d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 660:	80 fb 09             	cmp    $0x9,%bl
+ 663:	76 eb                	jbe    650 <atoi+0x20>
+}
+ 665:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 668:	89 c8                	mov    %ecx,%eax
+ 66a:	c9                   	leave
+ 66b:	c3                   	ret
+ 66c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000670 <memmove>:
+{
+ 670:	55                   	push   %ebp
+ 671:	89 e5                	mov    %esp,%ebp
+ 673:	57                   	push   %edi
+ 674:	56                   	push   %esi
+ 675:	8b 45 10             	mov    0x10(%ebp),%eax
+ 678:	8b 55 08             	mov    0x8(%ebp),%edx
+ 67b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 67e:	85 c0                	test   %eax,%eax
+ 680:	7e 13                	jle    695 <memmove+0x25>
+ 682:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 684:	89 d7                	mov    %edx,%edi
+ 686:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 68d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 690:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 691:	39 f8                	cmp    %edi,%eax
+ 693:	75 fb                	jne    690 <memmove+0x20>
+  return vdst;
+}
+ 695:	5e                   	pop    %esi
+ 696:	89 d0                	mov    %edx,%eax
+ 698:	5f                   	pop    %edi
+ 699:	5d                   	pop    %ebp
+ 69a:	c3                   	ret
+
+0000069b <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+ 69b:	83 3d 54 13 00 00 00 	cmpl   $0x0,0x1354
+  jle 1f
+ 6a2:	7e 0a                	jle    6ae <syscallentry+0x13>
+  movl %esp, %ecx
+ 6a4:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 6a6:	ba ad 06 00 00       	mov    $0x6ad,%edx
+  sysenter
+ 6ab:	0f 34                	sysenter
+2:
+  ret
+ 6ad:	c3                   	ret
+1:
+  jl 3f
+ 6ae:	7c 27                	jl     6d7 <syscallentry+0x3c>
+  pushal
+ 6b0:	60                   	pusha
+  movl $1, %eax
+ 6b1:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 6b6:	0f a2                	cpuid
+  movl $-1, sysentermode
+ 6b8:	c7 05 54 13 00 00 ff 	movl   $0xffffffff,0x1354
+ 6bf:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 6c2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+ 6c8:	74 0a                	je     6d4 <syscallentry+0x39>
+  movl $1, sysentermode
+ 6ca:	c7 05 54 13 00 00 01 	movl   $0x1,0x1354
+ 6d1:	00 00 00 
+4:
+  popal
+ 6d4:	61                   	popa
+  jmp syscallentry
+ 6d5:	eb c4                	jmp    69b <syscallentry>
+3:
+  int $T_SYSCALL
+ 6d7:	cd 40                	int    $0x40
+  ret
+ 6d9:	c3                   	ret
+
+000006da <_fork>:
+
+SYSCALLAS(_fork, fork)
+ 6da:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6df:	eb ba                	jmp    69b <syscallentry>
+
+000006e1 <_exit>:
+SYSCALLAS(_exit, exit)
+ 6e1:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6e6:	eb b3                	jmp    69b <syscallentry>
+
+000006e8 <wait>:
+SYSCALL(wait)
+ 6e8:	b8 03 00 00 00       	mov    $0x3,%eax
+ 6ed:	eb ac                	jmp    69b <syscallentry>
+
+000006ef <pipe>:
+SYSCALL(pipe)
+ 6ef:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6f4:	eb a5                	jmp    69b <syscallentry>
+
+000006f6 <read>:
+SYSCALL(read)
+ 6f6:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6fb:	eb 9e                	jmp    69b <syscallentry>
+
+000006fd <write>:
+SYSCALL(write)
+ 6fd:	b8 10 00 00 00       	mov    $0x10,%eax
+ 702:	eb 97                	jmp    69b <syscallentry>
+
+00000704 <_close>:
+SYSCALLAS(_close, close)
+ 704:	b8 15 00 00 00       	mov    $0x15,%eax
+ 709:	eb 90                	jmp    69b <syscallentry>
+
+0000070b <kill>:
+SYSCALL(kill)
+ 70b:	b8 06 00 00 00       	mov    $0x6,%eax
+ 710:	eb 89                	jmp    69b <syscallentry>
+
+00000712 <_exec>:
+SYSCALLAS(_exec, exec)
+ 712:	b8 07 00 00 00       	mov    $0x7,%eax
+ 717:	eb 82                	jmp    69b <syscallentry>
+
+00000719 <open>:
+SYSCALL(open)
+ 719:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 71e:	e9 78 ff ff ff       	jmp    69b <syscallentry>
+
+00000723 <mknod>:
+SYSCALL(mknod)
+ 723:	b8 11 00 00 00       	mov    $0x11,%eax
+ 728:	e9 6e ff ff ff       	jmp    69b <syscallentry>
+
+0000072d <unlink>:
+SYSCALL(unlink)
+ 72d:	b8 12 00 00 00       	mov    $0x12,%eax
+ 732:	e9 64 ff ff ff       	jmp    69b <syscallentry>
+
+00000737 <fstat>:
+SYSCALL(fstat)
+ 737:	b8 08 00 00 00       	mov    $0x8,%eax
+ 73c:	e9 5a ff ff ff       	jmp    69b <syscallentry>
+
+00000741 <link>:
+SYSCALL(link)
+ 741:	b8 13 00 00 00       	mov    $0x13,%eax
+ 746:	e9 50 ff ff ff       	jmp    69b <syscallentry>
+
+0000074b <mkdir>:
+SYSCALL(mkdir)
+ 74b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 750:	e9 46 ff ff ff       	jmp    69b <syscallentry>
+
+00000755 <chdir>:
+SYSCALL(chdir)
+ 755:	b8 09 00 00 00       	mov    $0x9,%eax
+ 75a:	e9 3c ff ff ff       	jmp    69b <syscallentry>
+
+0000075f <dup>:
+SYSCALL(dup)
+ 75f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 764:	e9 32 ff ff ff       	jmp    69b <syscallentry>
+
+00000769 <getpid>:
+SYSCALL(getpid)
+ 769:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 76e:	e9 28 ff ff ff       	jmp    69b <syscallentry>
+
+00000773 <sbrk>:
+SYSCALL(sbrk)
+ 773:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 778:	e9 1e ff ff ff       	jmp    69b <syscallentry>
+
+0000077d <sleep>:
+SYSCALL(sleep)
+ 77d:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 782:	e9 14 ff ff ff       	jmp    69b <syscallentry>
+
+00000787 <uptime>:
+SYSCALL(uptime)
+ 787:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 78c:	e9 0a ff ff ff       	jmp    69b <syscallentry>
+
+00000791 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+ 791:	b8 16 00 00 00       	mov    $0x16,%eax
+ 796:	e9 00 ff ff ff       	jmp    69b <syscallentry>
+
+0000079b <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+ 79b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 7a0:	e9 f6 fe ff ff       	jmp    69b <syscallentry>
+
+000007a5 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+ 7a5:	b8 18 00 00 00       	mov    $0x18,%eax
+ 7aa:	e9 ec fe ff ff       	jmp    69b <syscallentry>
+
+000007af <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+ 7af:	b8 19 00 00 00       	mov    $0x19,%eax
+ 7b4:	e9 e2 fe ff ff       	jmp    69b <syscallentry>
+
+000007b9 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+ 7b9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 7be:	e9 d8 fe ff ff       	jmp    69b <syscallentry>
+
+000007c3 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+ 7c3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 7c8:	e9 ce fe ff ff       	jmp    69b <syscallentry>
+
+000007cd <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+ 7cd:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 7d2:	e9 c4 fe ff ff       	jmp    69b <syscallentry>
+
+000007d7 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+ 7d7:	b8 20 00 00 00       	mov    $0x20,%eax
+ 7dc:	e9 ba fe ff ff       	jmp    69b <syscallentry>
+
+000007e1 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+ 7e1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 7e6:	e9 b0 fe ff ff       	jmp    69b <syscallentry>
+
+000007eb <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+ 7eb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 7f0:	e9 a6 fe ff ff       	jmp    69b <syscallentry>
+
+000007f5 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+ 7f5:	b8 21 00 00 00       	mov    $0x21,%eax
+ 7fa:	e9 9c fe ff ff       	jmp    69b <syscallentry>
+
+000007ff <yield>:
+SYSCALL(yield) // yield the CPU to another process
+ 7ff:	b8 22 00 00 00       	mov    $0x22,%eax
+ 804:	e9 92 fe ff ff       	jmp    69b <syscallentry>
+
+00000809 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+ 809:	b8 23 00 00 00       	mov    $0x23,%eax
+ 80e:	e9 88 fe ff ff       	jmp    69b <syscallentry>
+
+00000813 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+ 813:	b8 24 00 00 00       	mov    $0x24,%eax
+ 818:	e9 7e fe ff ff       	jmp    69b <syscallentry>
+
+0000081d <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+ 81d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 822:	e9 74 fe ff ff       	jmp    69b <syscallentry>
+
+00000827 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+ 827:	b8 26 00 00 00       	mov    $0x26,%eax
+ 82c:	e9 6a fe ff ff       	jmp    69b <syscallentry>
+
+00000831 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+ 831:	b8 27 00 00 00       	mov    $0x27,%eax
+ 836:	e9 60 fe ff ff       	jmp    69b <syscallentry>
+
+0000083b <mmap>:
+SYSCALL(mmap) // map a file into memory
+ 83b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 840:	e9 56 fe ff ff       	jmp    69b <syscallentry>
+
+00000845 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+ 845:	b8 29 00 00 00       	mov    $0x29,%eax
+ 84a:	e9 4c fe ff ff       	jmp    69b <syscallentry>
+
+0000084f <readv>:
+SYSCALL(readv) // read into several buffers
+ 84f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 854:	e9 42 fe ff ff       	jmp    69b <syscallentry>
+
+00000859 <writev>:
+SYSCALL(writev) // write from several buffers
+ 859:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 85e:	e9 38 fe ff ff       	jmp    69b <syscallentry>
+
+00000863 <pread>:
+SYSCALL(pread) // read at an offset
+ 863:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 868:	e9 2e fe ff ff       	jmp    69b <syscallentry>
+
+0000086d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+ 86d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 872:	e9 24 fe ff ff       	jmp    69b <syscallentry>
+
+00000877 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+ 877:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 87c:	e9 1a fe ff ff       	jmp    69b <syscallentry>
+
+00000881 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+ 881:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 886:	e9 10 fe ff ff       	jmp    69b <syscallentry>
+
+0000088b <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+ 88b:	b8 30 00 00 00       	mov    $0x30,%eax
+ 890:	e9 06 fe ff ff       	jmp    69b <syscallentry>
+
+00000895 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+ 895:	b8 31 00 00 00       	mov    $0x31,%eax
+ 89a:	e9 fc fd ff ff       	jmp    69b <syscallentry>
+
+0000089f <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+ 89f:	b8 32 00 00 00       	mov    $0x32,%eax
+ 8a4:	e9 f2 fd ff ff       	jmp    69b <syscallentry>
+
+000008a9 <profread>:
+SYSCALL(profread) // drain profiler samples
+ 8a9:	b8 33 00 00 00       	mov    $0x33,%eax
+ 8ae:	e9 e8 fd ff ff       	jmp    69b <syscallentry>
+
+000008b3 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+ 8b3:	b8 34 00 00 00       	mov    $0x34,%eax
+ 8b8:	e9 de fd ff ff       	jmp    69b <syscallentry>
+
+000008bd <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+ 8bd:	b8 35 00 00 00       	mov    $0x35,%eax
+ 8c2:	e9 d4 fd ff ff       	jmp    69b <syscallentry>
+
+000008c7 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+ 8c7:	b8 36 00 00 00       	mov    $0x36,%eax
+ 8cc:	e9 ca fd ff ff       	jmp    69b <syscallentry>
+
+000008d1 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+ 8d1:	b8 37 00 00 00       	mov    $0x37,%eax
+ 8d6:	e9 c0 fd ff ff       	jmp    69b <syscallentry>
+ 8db:	66 90                	xchg   %ax,%ax
+ 8dd:	66 90                	xchg   %ax,%ax
+ 8df:	90                   	nop
+
+000008e0 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 8e0:	55                   	push   %ebp
+ 8e1:	89 e5                	mov    %esp,%ebp
+ 8e3:	57                   	push   %edi
+ 8e4:	56                   	push   %esi
+ 8e5:	53                   	push   %ebx
+ 8e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 8e8:	89 d1                	mov    %edx,%ecx
+{
+ 8ea:	83 ec 3c             	sub    $0x3c,%esp
+ 8ed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 8f0:	85 d2                	test   %edx,%edx
+ 8f2:	0f 89 80 00 00 00    	jns    978 <printint+0x98>
+ 8f8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 8fc:	74 7a                	je     978 <printint+0x98>
+    x = -xx;
+ 8fe:	f7 d9                	neg    %ecx
+    neg = 1;
+ 900:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 905:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 908:	31 f6                	xor    %esi,%esi
+ 90a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 910:	89 c8                	mov    %ecx,%eax
+ 912:	31 d2                	xor    %edx,%edx
+ 914:	89 f7                	mov    %esi,%edi
+ 916:	f7 f3                	div    %ebx
+ 918:	8d 76 01             	lea    0x1(%esi),%esi
+ 91b:	0f b6 92 d0 0e 00 00 	movzbl 0xed0(%edx),%edx
+ 922:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 926:	89 ca                	mov    %ecx,%edx
+ 928:	89 c1                	mov    %eax,%ecx
+ 92a:	39 da                	cmp    %ebx,%edx
+ 92c:	73 e2                	jae    910 <printint+0x30>
+  if(neg)
+ 92e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 931:	85 c0                	test   %eax,%eax
+ 933:	74 07                	je     93c <printint+0x5c>
+    buf[i++] = '-';
+ 935:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 93a:	89 f7                	mov    %esi,%edi
+ 93c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 93f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 942:	01 df                	add    %ebx,%edi
+ 944:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 948:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+ 94b:	83 ec 04             	sub    $0x4,%esp
+ 94e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 951:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 954:	6a 01                	push   $0x1
+ 956:	50                   	push   %eax
+ 957:	56                   	push   %esi
+ 958:	e8 e3 f6 ff ff       	call   40 <bufwrite>
+  while(--i >= 0)
+ 95d:	89 f8                	mov    %edi,%eax
+ 95f:	83 c4 10             	add    $0x10,%esp
+ 962:	83 ef 01             	sub    $0x1,%edi
+ 965:	39 d8                	cmp    %ebx,%eax
+ 967:	75 df                	jne    948 <printint+0x68>
+}
+ 969:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 96c:	5b                   	pop    %ebx
+ 96d:	5e                   	pop    %esi
+ 96e:	5f                   	pop    %edi
+ 96f:	5d                   	pop    %ebp
+ 970:	c3                   	ret
+ 971:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 978:	31 c0                	xor    %eax,%eax
+ 97a:	eb 89                	jmp    905 <printint+0x25>
+ 97c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000980 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 980:	55                   	push   %ebp
+ 981:	89 e5                	mov    %esp,%ebp
+ 983:	57                   	push   %edi
+ 984:	56                   	push   %esi
+ 985:	53                   	push   %ebx
+ 986:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 989:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 98c:	0f b6 18             	movzbl (%eax),%ebx
+ 98f:	84 db                	test   %bl,%bl
+ 991:	74 6c                	je     9ff <printf+0x7f>
+ 993:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+ 996:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ 999:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 99b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 99e:	eb 26                	jmp    9c6 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 9a0:	83 f8 25             	cmp    $0x25,%eax
+ 9a3:	74 4b                	je     9f0 <printf+0x70>
+  bufwrite(fd, &c, 1);
+ 9a5:	83 ec 04             	sub    $0x4,%esp
+ 9a8:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 9ab:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ 9ae:	6a 01                	push   $0x1
+ 9b0:	50                   	push   %eax
+ 9b1:	ff 75 08             	push   0x8(%ebp)
+ 9b4:	e8 87 f6 ff ff       	call   40 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+ 9b9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 9bc:	0f b6 1f             	movzbl (%edi),%ebx
+ 9bf:	83 c7 01             	add    $0x1,%edi
+ 9c2:	84 db                	test   %bl,%bl
+ 9c4:	74 39                	je     9ff <printf+0x7f>
+    c = fmt[i] & 0xff;
+ 9c6:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 9c9:	85 f6                	test   %esi,%esi
+ 9cb:	74 d3                	je     9a0 <printf+0x20>
+      }
+    } else if(state == '%'){
+ 9cd:	83 fe 25             	cmp    $0x25,%esi
+ 9d0:	75 ea                	jne    9bc <printf+0x3c>
+      if(c == 'd'){
+ 9d2:	83 f8 25             	cmp    $0x25,%eax
+ 9d5:	0f 84 d5 01 00 00    	je     bb0 <printf+0x230>
+ 9db:	83 e8 63             	sub    $0x63,%eax
+ 9de:	83 f8 15             	cmp    $0x15,%eax
+ 9e1:	77 45                	ja     a28 <printf+0xa8>
+ 9e3:	ff 24 85 78 0e 00 00 	jmp    *0xe78(,%eax,4)
+ 9ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+ 9f0:	0f b6 1f             	movzbl (%edi),%ebx
+ 9f3:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+ 9f6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ 9fb:	84 db                	test   %bl,%bl
+ 9fd:	75 c7                	jne    9c6 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+ 9ff:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+ a03:	74 0b                	je     a10 <printf+0x90>
+    fflush(fd);
+}
+ a05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a08:	5b                   	pop    %ebx
+ a09:	5e                   	pop    %esi
+ a0a:	5f                   	pop    %edi
+ a0b:	5d                   	pop    %ebp
+ a0c:	c3                   	ret
+ a0d:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+ a10:	83 ec 0c             	sub    $0xc,%esp
+ a13:	6a 02                	push   $0x2
+ a15:	e8 c6 f7 ff ff       	call   1e0 <fflush>
+ a1a:	83 c4 10             	add    $0x10,%esp
+}
+ a1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a20:	5b                   	pop    %ebx
+ a21:	5e                   	pop    %esi
+ a22:	5f                   	pop    %edi
+ a23:	5d                   	pop    %ebp
+ a24:	c3                   	ret
+ a25:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+ a28:	83 ec 04             	sub    $0x4,%esp
+ a2b:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ a2e:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+ a32:	6a 01                	push   $0x1
+ a34:	52                   	push   %edx
+ a35:	89 55 c0             	mov    %edx,-0x40(%ebp)
+ a38:	ff 75 08             	push   0x8(%ebp)
+ a3b:	e8 00 f6 ff ff       	call   40 <bufwrite>
+ a40:	83 c4 0c             	add    $0xc,%esp
+ a43:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ a46:	6a 01                	push   $0x1
+ a48:	8b 55 c0             	mov    -0x40(%ebp),%edx
+ a4b:	52                   	push   %edx
+      state = 0;
+ a4c:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+ a4e:	ff 75 08             	push   0x8(%ebp)
+ a51:	e8 ea f5 ff ff       	call   40 <bufwrite>
+        putc(fd, c);
+ a56:	83 c4 10             	add    $0x10,%esp
+ a59:	e9 5e ff ff ff       	jmp    9bc <printf+0x3c>
+ a5e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+ a60:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ a63:	83 ec 0c             	sub    $0xc,%esp
+ a66:	b9 10 00 00 00       	mov    $0x10,%ecx
+ a6b:	8b 16                	mov    (%esi),%edx
+ a6d:	6a 00                	push   $0x0
+ a6f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+ a72:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+ a75:	e8 66 fe ff ff       	call   8e0 <printint>
+        ap++;
+ a7a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ a7d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a80:	31 f6                	xor    %esi,%esi
+ a82:	e9 35 ff ff ff       	jmp    9bc <printf+0x3c>
+ a87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a8e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+ a90:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ a93:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a95:	83 c0 04             	add    $0x4,%eax
+ a98:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+ a9b:	b8 6e 0e 00 00       	mov    $0xe6e,%eax
+ aa0:	85 db                	test   %ebx,%ebx
+ aa2:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+ aa5:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+ aa8:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+ aaa:	53                   	push   %ebx
+ aab:	e8 90 f9 ff ff       	call   440 <strlen>
+ ab0:	83 c4 0c             	add    $0xc,%esp
+ ab3:	50                   	push   %eax
+ ab4:	53                   	push   %ebx
+ ab5:	ff 75 08             	push   0x8(%ebp)
+ ab8:	e8 83 f5 ff ff       	call   40 <bufwrite>
+ abd:	83 c4 10             	add    $0x10,%esp
+ ac0:	e9 f7 fe ff ff       	jmp    9bc <printf+0x3c>
+ ac5:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ ac8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+ acb:	83 ec 04             	sub    $0x4,%esp
+ ace:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+ ad1:	8b 06                	mov    (%esi),%eax
+        ap++;
+ ad3:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+ ad6:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+ ad9:	6a 01                	push   $0x1
+ adb:	52                   	push   %edx
+ adc:	ff 75 08             	push   0x8(%ebp)
+ adf:	e8 5c f5 ff ff       	call   40 <bufwrite>
+        ap++;
+ ae4:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ ae7:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ aea:	31 f6                	xor    %esi,%esi
+ aec:	e9 cb fe ff ff       	jmp    9bc <printf+0x3c>
+ af1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+ af8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ afb:	83 ec 0c             	sub    $0xc,%esp
+ afe:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ b03:	8b 16                	mov    (%esi),%edx
+ b05:	6a 01                	push   $0x1
+ b07:	e9 63 ff ff ff       	jmp    a6f <printf+0xef>
+ b0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+ b10:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ b13:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ b16:	89 7d c0             	mov    %edi,-0x40(%ebp)
+ b19:	89 55 bc             	mov    %edx,-0x44(%ebp)
+ b1c:	8b 18                	mov    (%eax),%ebx
+ b1e:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+ b21:	31 c0                	xor    %eax,%eax
+ b23:	89 c7                	mov    %eax,%edi
+ b25:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+ b28:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+ b2d:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+ b2f:	f7 e1                	mul    %ecx
+ b31:	c1 ea 03             	shr    $0x3,%edx
+ b34:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ b37:	89 d1                	mov    %edx,%ecx
+ b39:	01 c0                	add    %eax,%eax
+ b3b:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ b3d:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+ b3f:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ b41:	be 0a 00 00 00       	mov    $0xa,%esi
+ b46:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+ b48:	89 da                	mov    %ebx,%edx
+ b4a:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+ b4c:	89 fe                	mov    %edi,%esi
+ b4e:	83 c7 01             	add    $0x1,%edi
+ b51:	8d 42 30             	lea    0x30(%edx),%eax
+ b54:	89 da                	mov    %ebx,%edx
+ b56:	8d 14 92             	lea    (%edx,%edx,4),%edx
+ b59:	01 d2                	add    %edx,%edx
+ b5b:	29 d0                	sub    %edx,%eax
+ b5d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+ b61:	89 c8                	mov    %ecx,%eax
+ b63:	09 d8                	or     %ebx,%eax
+ b65:	75 c1                	jne    b28 <printf+0x1a8>
+ b67:	8b 55 bc             	mov    -0x44(%ebp),%edx
+ b6a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ b6d:	01 d6                	add    %edx,%esi
+ b6f:	89 f7                	mov    %esi,%edi
+ b71:	89 d6                	mov    %edx,%esi
+ b73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b77:	90                   	nop
+    putc(fd, buf[i]);
+ b78:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+ b7b:	83 ec 04             	sub    $0x4,%esp
+ b7e:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+ b81:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+ b84:	6a 01                	push   $0x1
+ b86:	50                   	push   %eax
+ b87:	53                   	push   %ebx
+ b88:	e8 b3 f4 ff ff       	call   40 <bufwrite>
+  while(--i >= 0)
+ b8d:	89 fa                	mov    %edi,%edx
+ b8f:	83 c4 10             	add    $0x10,%esp
+ b92:	83 ef 01             	sub    $0x1,%edi
+ b95:	39 d6                	cmp    %edx,%esi
+ b97:	75 df                	jne    b78 <printf+0x1f8>
+        ap += 2;
+ b99:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+ b9d:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+ ba0:	31 f6                	xor    %esi,%esi
+ ba2:	e9 15 fe ff ff       	jmp    9bc <printf+0x3c>
+ ba7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bae:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+ bb0:	83 ec 04             	sub    $0x4,%esp
+ bb3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ bb6:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ bb9:	6a 01                	push   $0x1
+ bbb:	e9 8b fe ff ff       	jmp    a4b <printf+0xcb>
+
+00000bc0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ bc0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bc1:	a1 e0 23 00 00       	mov    0x23e0,%eax
+{
+ bc6:	89 e5                	mov    %esp,%ebp
+ bc8:	57                   	push   %edi
+ bc9:	56                   	push   %esi
+ bca:	53                   	push   %ebx
+ bcb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ bce:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bd8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ bda:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bdc:	39 ca                	cmp    %ecx,%edx
+ bde:	73 30                	jae    c10 <free+0x50>
+ be0:	39 c1                	cmp    %eax,%ecx
+ be2:	72 04                	jb     be8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ be4:	39 c2                	cmp    %eax,%edx
+ be6:	72 f0                	jb     bd8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ be8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ beb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ bee:	39 f8                	cmp    %edi,%eax
+ bf0:	74 2e                	je     c20 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ bf2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ bf5:	8b 42 04             	mov    0x4(%edx),%eax
+ bf8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ bfb:	39 f1                	cmp    %esi,%ecx
+ bfd:	74 38                	je     c37 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ bff:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ c01:	5b                   	pop    %ebx
+  freep = p;
+ c02:	89 15 e0 23 00 00    	mov    %edx,0x23e0
+}
+ c08:	5e                   	pop    %esi
+ c09:	5f                   	pop    %edi
+ c0a:	5d                   	pop    %ebp
+ c0b:	c3                   	ret
+ c0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c10:	39 c1                	cmp    %eax,%ecx
+ c12:	72 d0                	jb     be4 <free+0x24>
+ c14:	eb c2                	jmp    bd8 <free+0x18>
+ c16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c1d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ c20:	03 70 04             	add    0x4(%eax),%esi
+ c23:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c26:	8b 02                	mov    (%edx),%eax
+ c28:	8b 00                	mov    (%eax),%eax
+ c2a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ c2d:	8b 42 04             	mov    0x4(%edx),%eax
+ c30:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c33:	39 f1                	cmp    %esi,%ecx
+ c35:	75 c8                	jne    bff <free+0x3f>
+    p->s.size += bp->s.size;
+ c37:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ c3a:	89 15 e0 23 00 00    	mov    %edx,0x23e0
+    p->s.size += bp->s.size;
+ c40:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ c43:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ c46:	89 0a                	mov    %ecx,(%edx)
+}
+ c48:	5b                   	pop    %ebx
+ c49:	5e                   	pop    %esi
+ c4a:	5f                   	pop    %edi
+ c4b:	5d                   	pop    %ebp
+ c4c:	c3                   	ret
+ c4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c50 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ c50:	55                   	push   %ebp
+ c51:	89 e5                	mov    %esp,%ebp
+ c53:	57                   	push   %edi
+ c54:	56                   	push   %esi
+ c55:	53                   	push   %ebx
+ c56:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c59:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ c5c:	8b 15 e0 23 00 00    	mov    0x23e0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c62:	8d 78 07             	lea    0x7(%eax),%edi
+ c65:	c1 ef 03             	shr    $0x3,%edi
+ c68:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ c6b:	85 d2                	test   %edx,%edx
+ c6d:	0f 84 8d 00 00 00    	je     d00 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c73:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c75:	8b 48 04             	mov    0x4(%eax),%ecx
+ c78:	39 f9                	cmp    %edi,%ecx
+ c7a:	73 64                	jae    ce0 <malloc+0x90>
+  if(nu < 4096)
+ c7c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ c81:	39 df                	cmp    %ebx,%edi
+ c83:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ c86:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ c8d:	eb 0a                	jmp    c99 <malloc+0x49>
+ c8f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c90:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c92:	8b 48 04             	mov    0x4(%eax),%ecx
+ c95:	39 f9                	cmp    %edi,%ecx
+ c97:	73 47                	jae    ce0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ c99:	89 c2                	mov    %eax,%edx
+ c9b:	39 05 e0 23 00 00    	cmp    %eax,0x23e0
+ ca1:	75 ed                	jne    c90 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ ca3:	83 ec 0c             	sub    $0xc,%esp
+ ca6:	56                   	push   %esi
+ ca7:	e8 c7 fa ff ff       	call   773 <sbrk>
+  if(p == (char*)-1)
+ cac:	83 c4 10             	add    $0x10,%esp
+ caf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ cb2:	74 1c                	je     cd0 <malloc+0x80>
+  hp->s.size = nu;
+ cb4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ cb7:	83 ec 0c             	sub    $0xc,%esp
+ cba:	83 c0 08             	add    $0x8,%eax
+ cbd:	50                   	push   %eax
+ cbe:	e8 fd fe ff ff       	call   bc0 <free>
+  return freep;
+ cc3:	8b 15 e0 23 00 00    	mov    0x23e0,%edx
+      if((p = morecore(nunits)) == 0)
+ cc9:	83 c4 10             	add    $0x10,%esp
+ ccc:	85 d2                	test   %edx,%edx
+ cce:	75 c0                	jne    c90 <malloc+0x40>
+        return 0;
+  }
+}
+ cd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ cd3:	31 c0                	xor    %eax,%eax
+}
+ cd5:	5b                   	pop    %ebx
+ cd6:	5e                   	pop    %esi
+ cd7:	5f                   	pop    %edi
+ cd8:	5d                   	pop    %ebp
+ cd9:	c3                   	ret
+ cda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ ce0:	39 cf                	cmp    %ecx,%edi
+ ce2:	74 4c                	je     d30 <malloc+0xe0>
+        p->s.size -= nunits;
+ ce4:	29 f9                	sub    %edi,%ecx
+ ce6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ ce9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ cec:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ cef:	89 15 e0 23 00 00    	mov    %edx,0x23e0
+}
+ cf5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ cf8:	83 c0 08             	add    $0x8,%eax
+}
+ cfb:	5b                   	pop    %ebx
+ cfc:	5e                   	pop    %esi
+ cfd:	5f                   	pop    %edi
+ cfe:	5d                   	pop    %ebp
+ cff:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ d00:	c7 05 e0 23 00 00 e4 	movl   $0x23e4,0x23e0
+ d07:	23 00 00 
+    base.s.size = 0;
+ d0a:	b8 e4 23 00 00       	mov    $0x23e4,%eax
+    base.s.ptr = freep = prevp = &base;
+ d0f:	c7 05 e4 23 00 00 e4 	movl   $0x23e4,0x23e4
+ d16:	23 00 00 
+    base.s.size = 0;
+ d19:	c7 05 e8 23 00 00 00 	movl   $0x0,0x23e8
+ d20:	00 00 00 
+    if(p->s.size >= nunits){
+ d23:	e9 54 ff ff ff       	jmp    c7c <malloc+0x2c>
+ d28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d2f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ d30:	8b 08                	mov    (%eax),%ecx
+ d32:	89 0a                	mov    %ecx,(%edx)
+ d34:	eb b9                	jmp    cef <malloc+0x9f>
+ d36:	66 90                	xchg   %ax,%ax
+ d38:	66 90                	xchg   %ax,%ax
+ d3a:	66 90                	xchg   %ax,%ax
+ d3c:	66 90                	xchg   %ax,%ax
+ d3e:	66 90                	xchg   %ax,%ax
+
+00000d40 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+ d40:	55                   	push   %ebp
+ d41:	89 e5                	mov    %esp,%ebp
+ d43:	57                   	push   %edi
+ d44:	56                   	push   %esi
+ d45:	be 01 00 00 00       	mov    $0x1,%esi
+ d4a:	53                   	push   %ebx
+ d4b:	83 ec 28             	sub    $0x28,%esp
+ d4e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ d51:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ d54:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+ d57:	68 00 98 00 00       	push   $0x9800
+ d5c:	e8 ef fe ff ff       	call   c50 <malloc>
+ d61:	83 c4 10             	add    $0x10,%esp
+ d64:	89 c7                	mov    %eax,%edi
+ d66:	85 c0                	test   %eax,%eax
+ d68:	74 62                	je     dcc <waitpoll+0x8c>
+ d6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+ d70:	83 ec 0c             	sub    $0xc,%esp
+ d73:	6a 01                	push   $0x1
+ d75:	e8 03 fa ff ff       	call   77d <sleep>
+    fn();
+ d7a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ d7d:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+ d7f:	58                   	pop    %eax
+ d80:	5a                   	pop    %edx
+ d81:	68 00 02 00 00       	push   $0x200
+ d86:	57                   	push   %edi
+ d87:	e8 eb fa ff ff       	call   877 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+ d8c:	83 c4 10             	add    $0x10,%esp
+ d8f:	85 c0                	test   %eax,%eax
+ d91:	7e 2d                	jle    dc0 <waitpoll+0x80>
+ d93:	6b c0 4c             	imul   $0x4c,%eax,%eax
+ d96:	89 fa                	mov    %edi,%edx
+    alive = 0;
+ d98:	31 c9                	xor    %ecx,%ecx
+ d9a:	01 f8                	add    %edi,%eax
+ d9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+ da0:	3b 1a                	cmp    (%edx),%ebx
+ da2:	75 07                	jne    dab <waitpoll+0x6b>
+        alive = 1;
+ da4:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+ da8:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+ dab:	83 c2 4c             	add    $0x4c,%edx
+ dae:	39 d0                	cmp    %edx,%eax
+ db0:	75 ee                	jne    da0 <waitpoll+0x60>
+  } while(alive);
+ db2:	85 c9                	test   %ecx,%ecx
+ db4:	75 ba                	jne    d70 <waitpoll+0x30>
+ db6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dbd:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+ dc0:	83 ec 0c             	sub    $0xc,%esp
+ dc3:	57                   	push   %edi
+ dc4:	e8 f7 fd ff ff       	call   bc0 <free>
+  wait();
+ dc9:	83 c4 10             	add    $0x10,%esp
+}
+ dcc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ dcf:	5b                   	pop    %ebx
+ dd0:	5e                   	pop    %esi
+ dd1:	5f                   	pop    %edi
+ dd2:	5d                   	pop    %ebp
+  wait();
+ dd3:	e9 10 f9 ff ff       	jmp    6e8 <wait>
+ dd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ddf:	90                   	nop
+
+00000de0 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+ de0:	55                   	push   %ebp
+ de1:	89 e5                	mov    %esp,%ebp
+ de3:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+ de6:	c7 45 f0 e1 0e 00 00 	movl   $0xee1,-0x10(%ebp)
+ ded:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+ df4:	e8 87 f4 ff ff       	call   280 <fork>
+ df9:	85 c0                	test   %eax,%eax
+ dfb:	78 09                	js     e06 <runps+0x26>
+    return -1;
+  if(pid == 0){
+ dfd:	74 0e                	je     e0d <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+ dff:	e8 e4 f8 ff ff       	call   6e8 <wait>
+}
+ e04:	c9                   	leave
+ e05:	c3                   	ret
+ e06:	c9                   	leave
+    return -1;
+ e07:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ e0c:	c3                   	ret
+    exec("ps", argv);
+ e0d:	50                   	push   %eax
+ e0e:	50                   	push   %eax
+ e0f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ e12:	50                   	push   %eax
+ e13:	68 e1 0e 00 00       	push   $0xee1
+ e18:	e8 c3 f4 ff ff       	call   2e0 <exec>
+    printf(2, "exec ps failed\n");
+ e1d:	5a                   	pop    %edx
+ e1e:	59                   	pop    %ecx
+ e1f:	68 e4 0e 00 00       	push   $0xee4
+ e24:	6a 02                	push   $0x2
+ e26:	e8 55 fb ff ff       	call   980 <printf>
+    exit();
+ e2b:	e8 a0 f4 ff ff       	call   2d0 <exit>
@@ -0,0 +1,1962 @@
+
+_testsyscalls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+int main() {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "Sleeping for 10 ticks...\n");
+  13:	68 50 0e 00 00       	push   $0xe50
+  18:	6a 01                	push   $0x1
+  1a:	e8 81 09 00 00       	call   9a0 <printf>
+  sleep(10);
+  1f:	c7 04 24 0a 00 00 00 	movl   $0xa,(%esp)
+  26:	e8 72 07 00 00       	call   79d <sleep>
+
+  int total = getnumsyscalls();
+  2b:	e8 a9 07 00 00       	call   7d9 <getnumsyscalls>
+  30:	89 c6                	mov    %eax,%esi
+  int good = getnumsyscallsgood();
+  32:	e8 ac 07 00 00       	call   7e3 <getnumsyscallsgood>
+
+  printf(1, "Total syscalls made: %d\n", total);
+  37:	83 c4 0c             	add    $0xc,%esp
+  3a:	56                   	push   %esi
+  int good = getnumsyscallsgood();
+  3b:	89 c3                	mov    %eax,%ebx
+  printf(1, "Total syscalls made: %d\n", total);
+  3d:	68 6a 0e 00 00       	push   $0xe6a
+  42:	6a 01                	push   $0x1
+  44:	e8 57 09 00 00       	call   9a0 <printf>
+  printf(1, "Good syscalls made: %d\n", good);
+  49:	83 c4 0c             	add    $0xc,%esp
+  4c:	53                   	push   %ebx
+  4d:	68 83 0e 00 00       	push   $0xe83
+  52:	6a 01                	push   $0x1
+  54:	e8 47 09 00 00       	call   9a0 <printf>
+
+  exit();
+  59:	e8 92 02 00 00       	call   2f0 <exit>
+  5e:	66 90                	xchg   %ax,%ax
+
+00000060 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	57                   	push   %edi
+  64:	56                   	push   %esi
+  65:	53                   	push   %ebx
+  66:	83 ec 4c             	sub    $0x4c,%esp
+  69:	8b 45 0c             	mov    0xc(%ebp),%eax
+  6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  6f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  72:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+  75:	83 fa 0f             	cmp    $0xf,%edx
+  78:	0f 87 32 01 00 00    	ja     1b0 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+  7e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+  84:	8b 80 a0 13 00 00    	mov    0x13a0(%eax),%eax
+  8a:	85 c0                	test   %eax,%eax
+  8c:	0f 84 de 00 00 00    	je     170 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+  92:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+  98:	8b b0 a4 13 00 00    	mov    0x13a4(%eax),%esi
+  9e:	8d 88 a0 13 00 00    	lea    0x13a0(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+  a4:	8d b8 a8 13 00 00    	lea    0x13a8(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+  aa:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+  ad:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+  b0:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+  b3:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+  b9:	0f 8f 01 01 00 00    	jg     1c0 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+  bf:	8d 78 08             	lea    0x8(%eax),%edi
+  c2:	8d bc 3e a0 13 00 00 	lea    0x13a0(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+  c9:	85 db                	test   %ebx,%ebx
+  cb:	7e 3b                	jle    108 <bufwrite+0xa8>
+  cd:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+  d0:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  d7:	90                   	nop
+    *dst++ = *src++;
+  d8:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+  d9:	39 c6                	cmp    %eax,%esi
+  db:	75 fb                	jne    d8 <bufwrite+0x78>
+  ob[fd].n += n;
+  dd:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+  e3:	8b 88 a4 13 00 00    	mov    0x13a4(%eax),%ecx
+  e9:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+  eb:	83 b8 a0 13 00 00 01 	cmpl   $0x1,0x13a0(%eax)
+  ob[fd].n += n;
+  f2:	89 88 a4 13 00 00    	mov    %ecx,0x13a4(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+  f8:	74 26                	je     120 <bufwrite+0xc0>
+}
+  fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  fd:	5b                   	pop    %ebx
+  fe:	5e                   	pop    %esi
+  ff:	5f                   	pop    %edi
+ 100:	5d                   	pop    %ebp
+ 101:	c3                   	ret
+ 102:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+ 108:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 10b:	83 b8 a0 13 00 00 01 	cmpl   $0x1,0x13a0(%eax)
+  ob[fd].n += n;
+ 112:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 115:	75 e3                	jne    fa <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+ 117:	85 db                	test   %ebx,%ebx
+ 119:	74 df                	je     fa <bufwrite+0x9a>
+ 11b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 11f:	90                   	nop
+  src = vsrc;
+ 120:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 123:	01 c3                	add    %eax,%ebx
+ 125:	eb 10                	jmp    137 <bufwrite+0xd7>
+ 127:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12e:	66 90                	xchg   %ax,%ax
+ 130:	83 c0 01             	add    $0x1,%eax
+ 133:	39 d8                	cmp    %ebx,%eax
+ 135:	74 c3                	je     fa <bufwrite+0x9a>
+    if(*p == (char)c)
+ 137:	80 38 0a             	cmpb   $0xa,(%eax)
+ 13a:	75 f4                	jne    130 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 13c:	85 c9                	test   %ecx,%ecx
+ 13e:	7e ba                	jle    fa <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 140:	83 ec 04             	sub    $0x4,%esp
+ 143:	51                   	push   %ecx
+ 144:	ff 75 ac             	push   -0x54(%ebp)
+ 147:	52                   	push   %edx
+ 148:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+ 14b:	e8 cd 05 00 00       	call   71d <write>
+    ob[fd].n = 0;
+ 150:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+ 153:	83 c4 10             	add    $0x10,%esp
+ 156:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+ 15c:	c7 82 a4 13 00 00 00 	movl   $0x0,0x13a4(%edx)
+ 163:	00 00 00 
+ 166:	eb 92                	jmp    fa <bufwrite+0x9a>
+ 168:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16f:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 170:	83 ec 08             	sub    $0x8,%esp
+ 173:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 176:	50                   	push   %eax
+ 177:	52                   	push   %edx
+ 178:	89 55 b0             	mov    %edx,-0x50(%ebp)
+ 17b:	e8 d7 05 00 00       	call   757 <fstat>
+ 180:	83 c4 10             	add    $0x10,%esp
+ 183:	8b 55 b0             	mov    -0x50(%ebp),%edx
+ 186:	89 c1                	mov    %eax,%ecx
+ 188:	b8 02 00 00 00       	mov    $0x2,%eax
+ 18d:	85 c9                	test   %ecx,%ecx
+ 18f:	75 0d                	jne    19e <bufwrite+0x13e>
+ 191:	31 c0                	xor    %eax,%eax
+ 193:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 198:	0f 95 c0             	setne  %al
+ 19b:	83 c0 01             	add    $0x1,%eax
+ 19e:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+ 1a4:	89 81 a0 13 00 00    	mov    %eax,0x13a0(%ecx)
+ 1aa:	e9 e3 fe ff ff       	jmp    92 <bufwrite+0x32>
+ 1af:	90                   	nop
+}
+ 1b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1b3:	5b                   	pop    %ebx
+ 1b4:	5e                   	pop    %esi
+ 1b5:	5f                   	pop    %edi
+ 1b6:	5d                   	pop    %ebp
+    write(fd, p, n);
+ 1b7:	e9 61 05 00 00       	jmp    71d <write>
+ 1bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+ 1c0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+ 1c3:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+ 1c6:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+ 1c9:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+ 1cc:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+ 1cf:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+ 1d2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+ 1d5:	6a 02                	push   $0x2
+ 1d7:	50                   	push   %eax
+ 1d8:	52                   	push   %edx
+ 1d9:	e8 9b 06 00 00       	call   879 <writev>
+    ob[fd].n = 0;
+ 1de:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+ 1e1:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+ 1e4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ 1eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1ee:	5b                   	pop    %ebx
+ 1ef:	5e                   	pop    %esi
+ 1f0:	5f                   	pop    %edi
+ 1f1:	5d                   	pop    %ebp
+ 1f2:	c3                   	ret
+ 1f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000200 <fflush>:
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	53                   	push   %ebx
+ 204:	83 ec 04             	sub    $0x4,%esp
+ 207:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 20a:	83 f8 0f             	cmp    $0xf,%eax
+ 20d:	77 16                	ja     225 <fflush+0x25>
+ 20f:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+ 215:	8b 8a a4 13 00 00    	mov    0x13a4(%edx),%ecx
+ 21b:	8d 9a a0 13 00 00    	lea    0x13a0(%edx),%ebx
+ 221:	85 c9                	test   %ecx,%ecx
+ 223:	7f 0b                	jg     230 <fflush+0x30>
+}
+ 225:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 228:	c9                   	leave
+ 229:	c3                   	ret
+ 22a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 230:	83 ec 04             	sub    $0x4,%esp
+ 233:	81 c2 a8 13 00 00    	add    $0x13a8,%edx
+ 239:	51                   	push   %ecx
+ 23a:	52                   	push   %edx
+ 23b:	50                   	push   %eax
+ 23c:	e8 dc 04 00 00       	call   71d <write>
+    ob[fd].n = 0;
+ 241:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+ 248:	83 c4 10             	add    $0x10,%esp
+}
+ 24b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 24e:	c9                   	leave
+ 24f:	c3                   	ret
+
+00000250 <fflushall>:
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 254:	31 f6                	xor    %esi,%esi
+{
+ 256:	53                   	push   %ebx
+ 257:	bb a8 13 00 00       	mov    $0x13a8,%ebx
+ 25c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 260:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 263:	85 c0                	test   %eax,%eax
+ 265:	7e 15                	jle    27c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 267:	83 ec 04             	sub    $0x4,%esp
+ 26a:	50                   	push   %eax
+ 26b:	53                   	push   %ebx
+ 26c:	56                   	push   %esi
+ 26d:	e8 ab 04 00 00       	call   71d <write>
+    ob[fd].n = 0;
+ 272:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 279:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 27c:	83 c6 01             	add    $0x1,%esi
+ 27f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 285:	83 fe 10             	cmp    $0x10,%esi
+ 288:	75 d6                	jne    260 <fflushall+0x10>
+}
+ 28a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 28d:	5b                   	pop    %ebx
+ 28e:	5e                   	pop    %esi
+ 28f:	5d                   	pop    %ebp
+ 290:	c3                   	ret
+ 291:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 298:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+
+000002a0 <fork>:
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 2a4:	31 f6                	xor    %esi,%esi
+{
+ 2a6:	53                   	push   %ebx
+ 2a7:	bb a8 13 00 00       	mov    $0x13a8,%ebx
+ 2ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 2b0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 2b3:	85 c0                	test   %eax,%eax
+ 2b5:	7e 15                	jle    2cc <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 2b7:	83 ec 04             	sub    $0x4,%esp
+ 2ba:	50                   	push   %eax
+ 2bb:	53                   	push   %ebx
+ 2bc:	56                   	push   %esi
+ 2bd:	e8 5b 04 00 00       	call   71d <write>
+    ob[fd].n = 0;
+ 2c2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 2c9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 2cc:	83 c6 01             	add    $0x1,%esi
+ 2cf:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 2d5:	83 fe 10             	cmp    $0x10,%esi
+ 2d8:	75 d6                	jne    2b0 <fork+0x10>
+}
+ 2da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2dd:	5b                   	pop    %ebx
+ 2de:	5e                   	pop    %esi
+ 2df:	5d                   	pop    %ebp
+  return _fork();
+ 2e0:	e9 15 04 00 00       	jmp    6fa <_fork>
+ 2e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002f0 <exit>:
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+ 2f6:	e8 55 ff ff ff       	call   250 <fflushall>
+  _exit();
+ 2fb:	e8 01 04 00 00       	call   701 <_exit>
+
+00000300 <exec>:
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	57                   	push   %edi
+ 304:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 305:	31 f6                	xor    %esi,%esi
+{
+ 307:	53                   	push   %ebx
+ 308:	bb a8 13 00 00       	mov    $0x13a8,%ebx
+ 30d:	83 ec 1c             	sub    $0x1c,%esp
+ 310:	8b 45 08             	mov    0x8(%ebp),%eax
+ 313:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 316:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 320:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 323:	85 c0                	test   %eax,%eax
+ 325:	7e 15                	jle    33c <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 327:	83 ec 04             	sub    $0x4,%esp
+ 32a:	50                   	push   %eax
+ 32b:	53                   	push   %ebx
+ 32c:	56                   	push   %esi
+ 32d:	e8 eb 03 00 00       	call   71d <write>
+    ob[fd].n = 0;
+ 332:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 339:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 33c:	83 c6 01             	add    $0x1,%esi
+ 33f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 345:	83 fe 10             	cmp    $0x10,%esi
+ 348:	75 d6                	jne    320 <exec+0x20>
+  return _exec(path, argv);
+ 34a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 34d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+ 350:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ 353:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 356:	5b                   	pop    %ebx
+ 357:	5e                   	pop    %esi
+ 358:	5f                   	pop    %edi
+ 359:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 35a:	e9 d3 03 00 00       	jmp    732 <_exec>
+ 35f:	90                   	nop
+
+00000360 <close>:
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	56                   	push   %esi
+ 364:	53                   	push   %ebx
+ 365:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 368:	83 fb 0f             	cmp    $0xf,%ebx
+ 36b:	77 26                	ja     393 <close+0x33>
+ 36d:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 373:	8b 90 a4 13 00 00    	mov    0x13a4(%eax),%edx
+ 379:	8d b0 a0 13 00 00    	lea    0x13a0(%eax),%esi
+ 37f:	85 d2                	test   %edx,%edx
+ 381:	7f 25                	jg     3a8 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+ 383:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 389:	c7 80 a0 13 00 00 00 	movl   $0x0,0x13a0(%eax)
+ 390:	00 00 00 
+  return _close(fd);
+ 393:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 396:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 399:	5b                   	pop    %ebx
+ 39a:	5e                   	pop    %esi
+ 39b:	5d                   	pop    %ebp
+  return _close(fd);
+ 39c:	e9 83 03 00 00       	jmp    724 <_close>
+ 3a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 3a8:	83 ec 04             	sub    $0x4,%esp
+ 3ab:	05 a8 13 00 00       	add    $0x13a8,%eax
+ 3b0:	52                   	push   %edx
+ 3b1:	50                   	push   %eax
+ 3b2:	53                   	push   %ebx
+ 3b3:	e8 65 03 00 00       	call   71d <write>
+    ob[fd].n = 0;
+ 3b8:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+ 3bf:	83 c4 10             	add    $0x10,%esp
+ 3c2:	eb bf                	jmp    383 <close+0x23>
+ 3c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3cf:	90                   	nop
+
+000003d0 <strcpy>:
+{
+ 3d0:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+ 3d1:	31 c0                	xor    %eax,%eax
+{
+ 3d3:	89 e5                	mov    %esp,%ebp
+ 3d5:	53                   	push   %ebx
+ 3d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 3e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 3e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 3e7:	83 c0 01             	add    $0x1,%eax
+ 3ea:	84 d2                	test   %dl,%dl
+ 3ec:	75 f2                	jne    3e0 <strcpy+0x10>
+}
+ 3ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3f1:	89 c8                	mov    %ecx,%eax
+ 3f3:	c9                   	leave
+ 3f4:	c3                   	ret
+ 3f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000400 <strcmp>:
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	53                   	push   %ebx
+ 404:	8b 55 08             	mov    0x8(%ebp),%edx
+ 407:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 40a:	0f b6 02             	movzbl (%edx),%eax
+ 40d:	84 c0                	test   %al,%al
+ 40f:	75 17                	jne    428 <strcmp+0x28>
+ 411:	eb 3a                	jmp    44d <strcmp+0x4d>
+ 413:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 417:	90                   	nop
+ 418:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 41c:	83 c2 01             	add    $0x1,%edx
+ 41f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 422:	84 c0                	test   %al,%al
+ 424:	74 1a                	je     440 <strcmp+0x40>
+    p++, q++;
+ 426:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 428:	0f b6 19             	movzbl (%ecx),%ebx
+ 42b:	38 c3                	cmp    %al,%bl
+ 42d:	74 e9                	je     418 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 42f:	29 d8                	sub    %ebx,%eax
+}
+ 431:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 434:	c9                   	leave
+ 435:	c3                   	ret
+ 436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 440:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 444:	31 c0                	xor    %eax,%eax
+ 446:	29 d8                	sub    %ebx,%eax
+}
+ 448:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 44b:	c9                   	leave
+ 44c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 44d:	0f b6 19             	movzbl (%ecx),%ebx
+ 450:	31 c0                	xor    %eax,%eax
+ 452:	eb db                	jmp    42f <strcmp+0x2f>
+ 454:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 45f:	90                   	nop
+
+00000460 <strlen>:
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+ 466:	80 3a 00             	cmpb   $0x0,(%edx)
+ 469:	74 15                	je     480 <strlen+0x20>
+ 46b:	31 c0                	xor    %eax,%eax
+ 46d:	8d 76 00             	lea    0x0(%esi),%esi
+ 470:	83 c0 01             	add    $0x1,%eax
+ 473:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 477:	89 c1                	mov    %eax,%ecx
+ 479:	75 f5                	jne    470 <strlen+0x10>
+}
+ 47b:	89 c8                	mov    %ecx,%eax
+ 47d:	5d                   	pop    %ebp
+ 47e:	c3                   	ret
+ 47f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 480:	31 c9                	xor    %ecx,%ecx
+}
+ 482:	5d                   	pop    %ebp
+ 483:	89 c8                	mov    %ecx,%eax
+ 485:	c3                   	ret
+ 486:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000490 <memset>:
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 497:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 49a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 49d:	89 d7                	mov    %edx,%edi
+ 49f:	fc                   	cld
+ 4a0:	f3 aa                	rep stos %al,%es:(%edi)
+}
+ 4a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 4a5:	89 d0                	mov    %edx,%eax
+ 4a7:	c9                   	leave
+ 4a8:	c3                   	ret
+ 4a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004b0 <strchr>:
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 4ba:	0f b6 10             	movzbl (%eax),%edx
+ 4bd:	84 d2                	test   %dl,%dl
+ 4bf:	75 12                	jne    4d3 <strchr+0x23>
+ 4c1:	eb 1d                	jmp    4e0 <strchr+0x30>
+ 4c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4c7:	90                   	nop
+ 4c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 4cc:	83 c0 01             	add    $0x1,%eax
+ 4cf:	84 d2                	test   %dl,%dl
+ 4d1:	74 0d                	je     4e0 <strchr+0x30>
+    if(*s == c)
+ 4d3:	38 d1                	cmp    %dl,%cl
+ 4d5:	75 f1                	jne    4c8 <strchr+0x18>
+}
+ 4d7:	5d                   	pop    %ebp
+ 4d8:	c3                   	ret
+ 4d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 4e0:	31 c0                	xor    %eax,%eax
+}
+ 4e2:	5d                   	pop    %ebp
+ 4e3:	c3                   	ret
+ 4e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4ef:	90                   	nop
+
+000004f0 <memchr>:
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	8b 55 10             	mov    0x10(%ebp),%edx
+ 4f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 4f9:	85 d2                	test   %edx,%edx
+ 4fb:	74 1b                	je     518 <memchr+0x28>
+    if(*p == (char)c)
+ 4fd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+ 501:	01 c2                	add    %eax,%edx
+ 503:	eb 0a                	jmp    50f <memchr+0x1f>
+ 505:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+ 508:	83 c0 01             	add    $0x1,%eax
+ 50b:	39 c2                	cmp    %eax,%edx
+ 50d:	74 09                	je     518 <memchr+0x28>
+    if(*p == (char)c)
+ 50f:	38 08                	cmp    %cl,(%eax)
+ 511:	75 f5                	jne    508 <memchr+0x18>
+}
+ 513:	5d                   	pop    %ebp
+ 514:	c3                   	ret
+ 515:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+ 518:	31 c0                	xor    %eax,%eax
+}
+ 51a:	5d                   	pop    %ebp
+ 51b:	c3                   	ret
+ 51c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <gets>:
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+ 524:	31 ff                	xor    %edi,%edi
+{
+ 526:	56                   	push   %esi
+ 527:	be a8 13 00 00       	mov    $0x13a8,%esi
+ 52c:	53                   	push   %ebx
+ 52d:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 530:	8b 46 fc             	mov    -0x4(%esi),%eax
+ 533:	85 c0                	test   %eax,%eax
+ 535:	7e 15                	jle    54c <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 537:	83 ec 04             	sub    $0x4,%esp
+ 53a:	50                   	push   %eax
+ 53b:	56                   	push   %esi
+ 53c:	57                   	push   %edi
+ 53d:	e8 db 01 00 00       	call   71d <write>
+    ob[fd].n = 0;
+ 542:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+ 549:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 54c:	83 c7 01             	add    $0x1,%edi
+ 54f:	81 c6 08 01 00 00    	add    $0x108,%esi
+ 555:	83 ff 10             	cmp    $0x10,%edi
+ 558:	75 d6                	jne    530 <gets+0x10>
+  for(i=0; i+1 < max; ){
+ 55a:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+ 55c:	8d 75 e7             	lea    -0x19(%ebp),%esi
+ 55f:	eb 2e                	jmp    58f <gets+0x6f>
+ 561:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 568:	83 ec 04             	sub    $0x4,%esp
+ 56b:	6a 01                	push   $0x1
+ 56d:	56                   	push   %esi
+ 56e:	6a 00                	push   $0x0
+ 570:	e8 a1 01 00 00       	call   716 <read>
+    if(cc < 1)
+ 575:	83 c4 10             	add    $0x10,%esp
+ 578:	85 c0                	test   %eax,%eax
+ 57a:	7e 1d                	jle    599 <gets+0x79>
+    buf[i++] = c;
+ 57c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 580:	8b 55 08             	mov    0x8(%ebp),%edx
+ 583:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 587:	3c 0a                	cmp    $0xa,%al
+ 589:	74 10                	je     59b <gets+0x7b>
+ 58b:	3c 0d                	cmp    $0xd,%al
+ 58d:	74 0c                	je     59b <gets+0x7b>
+  for(i=0; i+1 < max; ){
+ 58f:	89 df                	mov    %ebx,%edi
+ 591:	83 c3 01             	add    $0x1,%ebx
+ 594:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 597:	7c cf                	jl     568 <gets+0x48>
+ 599:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 59b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 59e:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 5a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5a5:	5b                   	pop    %ebx
+ 5a6:	5e                   	pop    %esi
+ 5a7:	5f                   	pop    %edi
+ 5a8:	5d                   	pop    %ebp
+ 5a9:	c3                   	ret
+ 5aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000005b0 <stat>:
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+ 5b5:	53                   	push   %ebx
+ 5b6:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+ 5b9:	6a 00                	push   $0x0
+ 5bb:	ff 75 08             	push   0x8(%ebp)
+ 5be:	e8 76 01 00 00       	call   739 <open>
+  if(fd < 0)
+ 5c3:	83 c4 10             	add    $0x10,%esp
+ 5c6:	85 c0                	test   %eax,%eax
+ 5c8:	78 76                	js     640 <stat+0x90>
+  r = fstat(fd, st);
+ 5ca:	83 ec 08             	sub    $0x8,%esp
+ 5cd:	ff 75 0c             	push   0xc(%ebp)
+ 5d0:	89 c3                	mov    %eax,%ebx
+ 5d2:	50                   	push   %eax
+ 5d3:	e8 7f 01 00 00       	call   757 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 5d8:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 5db:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 5dd:	83 fb 0f             	cmp    $0xf,%ebx
+ 5e0:	7f 40                	jg     622 <stat+0x72>
+ 5e2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 5e8:	8b 90 a4 13 00 00    	mov    0x13a4(%eax),%edx
+ 5ee:	8d b8 a0 13 00 00    	lea    0x13a0(%eax),%edi
+ 5f4:	85 d2                	test   %edx,%edx
+ 5f6:	7e 1a                	jle    612 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 5f8:	83 ec 04             	sub    $0x4,%esp
+ 5fb:	05 a8 13 00 00       	add    $0x13a8,%eax
+ 600:	52                   	push   %edx
+ 601:	50                   	push   %eax
+ 602:	53                   	push   %ebx
+ 603:	e8 15 01 00 00       	call   71d <write>
+    ob[fd].n = 0;
+ 608:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+ 60f:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+ 612:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 618:	c7 80 a0 13 00 00 00 	movl   $0x0,0x13a0(%eax)
+ 61f:	00 00 00 
+  return _close(fd);
+ 622:	83 ec 0c             	sub    $0xc,%esp
+ 625:	53                   	push   %ebx
+ 626:	e8 f9 00 00 00       	call   724 <_close>
+ 62b:	83 c4 10             	add    $0x10,%esp
+}
+ 62e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 631:	89 f0                	mov    %esi,%eax
+ 633:	5b                   	pop    %ebx
+ 634:	5e                   	pop    %esi
+ 635:	5f                   	pop    %edi
+ 636:	5d                   	pop    %ebp
+ 637:	c3                   	ret
+ 638:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 63f:	90                   	nop
+    return -1;
+ 640:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 645:	eb e7                	jmp    62e <stat+0x7e>
+ 647:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 64e:	66 90                	xchg   %ax,%ax
+
+00000650 <atoi>:
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	53                   	push   %ebx
+ 654:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 657:	0f be 02             	movsbl (%edx),%eax
+ 65a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 65d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 660:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 665:	77 1e                	ja     685 <atoi+0x35>
+ 667:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 670:	83 c2 01             	add    $0x1,%edx
+ 673:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 676:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 67a:	0f be 02             	movsbl (%edx),%eax
+ 67d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 680:	80 fb 09             	cmp    $0x9,%bl
+ 683:	76 eb                	jbe    670 <atoi+0x20>
+}
+ 685:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 688:	89 c8                	mov    %ecx,%eax
+ 68a:	c9                   	leave
+ 68b:	c3                   	ret
+ 68c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000690 <memmove>:
+{
+ 690:	55                   	push   %ebp
+ 691:	89 e5                	mov    %esp,%ebp
+ 693:	57                   	push   %edi
+ 694:	56                   	push   %esi
+ 695:	8b 45 10             	mov    0x10(%ebp),%eax
+ 698:	8b 55 08             	mov    0x8(%ebp),%edx
+ 69b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 69e:	85 c0                	test   %eax,%eax
+ 6a0:	7e 13                	jle    6b5 <memmove+0x25>
+ 6a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 6a4:	89 d7                	mov    %edx,%edi
+ 6a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 6b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 6b1:	39 f8                	cmp    %edi,%eax
+ 6b3:	75 fb                	jne    6b0 <memmove+0x20>
+  return vdst;
+}
+ 6b5:	5e                   	pop    %esi
+ 6b6:	89 d0                	mov    %edx,%eax
+ 6b8:	5f                   	pop    %edi
+ 6b9:	5d                   	pop    %ebp
+ 6ba:	c3                   	ret
+
+000006bb <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+ 6bb:	83 3d 88 13 00 00 00 	cmpl   $0x0,0x1388
+  jle 1f
+ 6c2:	7e 0a                	jle    6ce <syscallentry+0x13>
+  movl %esp, %ecx
+ 6c4:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 6c6:	ba cd 06 00 00       	mov    $0x6cd,%edx
+  sysenter
+ 6cb:	0f 34                	sysenter
+2:
+  ret
+ 6cd:	c3                   	ret
+1:
+  jl 3f
+ 6ce:	7c 27                	jl     6f7 <syscallentry+0x3c>
+  pushal
+ 6d0:	60                   	pusha
+  movl $1, %eax
+ 6d1:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 6d6:	0f a2                	cpuid
+  movl $-1, sysentermode
+ 6d8:	c7 05 88 13 00 00 ff 	movl   $0xffffffff,0x1388
+ 6df:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 6e2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+ 6e8:	74 0a                	je     6f4 <syscallentry+0x39>
+  movl $1, sysentermode
+ 6ea:	c7 05 88 13 00 00 01 	movl   $0x1,0x1388
+ 6f1:	00 00 00 
+4:
+  popal
+ 6f4:	61                   	popa
+  jmp syscallentry
+ 6f5:	eb c4                	jmp    6bb <syscallentry>
+3:
+  int $T_SYSCALL
+ 6f7:	cd 40                	int    $0x40
+  ret
+ 6f9:	c3                   	ret
+
+000006fa <_fork>:
+
+SYSCALLAS(_fork, fork)
+ 6fa:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6ff:	eb ba                	jmp    6bb <syscallentry>
+
+00000701 <_exit>:
+SYSCALLAS(_exit, exit)
+ 701:	b8 02 00 00 00       	mov    $0x2,%eax
+ 706:	eb b3                	jmp    6bb <syscallentry>
+
+00000708 <wait>:
+SYSCALL(wait)
+ 708:	b8 03 00 00 00       	mov    $0x3,%eax
+ 70d:	eb ac                	jmp    6bb <syscallentry>
+
+0000070f <pipe>:
+SYSCALL(pipe)
+ 70f:	b8 04 00 00 00       	mov    $0x4,%eax
+ 714:	eb a5                	jmp    6bb <syscallentry>
+
+00000716 <read>:
+SYSCALL(read)
+ 716:	b8 05 00 00 00       	mov    $0x5,%eax
+ 71b:	eb 9e                	jmp    6bb <syscallentry>
+
+0000071d <write>:
+SYSCALL(write)
+ 71d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 722:	eb 97                	jmp    6bb <syscallentry>
+
+00000724 <_close>:
+SYSCALLAS(_close, close)
+ 724:	b8 15 00 00 00       	mov    $0x15,%eax
+ 729:	eb 90                	jmp    6bb <syscallentry>
+
+0000072b <kill>:
+SYSCALL(kill)
+ 72b:	b8 06 00 00 00       	mov    $0x6,%eax
+ 730:	eb 89                	jmp    6bb <syscallentry>
+
+00000732 <_exec>:
+SYSCALLAS(_exec, exec)
+ 732:	b8 07 00 00 00       	mov    $0x7,%eax
+ 737:	eb 82                	jmp    6bb <syscallentry>
+
+00000739 <open>:
+SYSCALL(open)
+ 739:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 73e:	e9 78 ff ff ff       	jmp    6bb <syscallentry>
+
+00000743 <mknod>:
+SYSCALL(mknod)
+ 743:	b8 11 00 00 00       	mov    $0x11,%eax
+ 748:	e9 6e ff ff ff       	jmp    6bb <syscallentry>
+
+0000074d <unlink>:
+SYSCALL(unlink)
+ 74d:	b8 12 00 00 00       	mov    $0x12,%eax
+ 752:	e9 64 ff ff ff       	jmp    6bb <syscallentry>
+
+00000757 <fstat>:
+SYSCALL(fstat)
+ 757:	b8 08 00 00 00       	mov    $0x8,%eax
+ 75c:	e9 5a ff ff ff       	jmp    6bb <syscallentry>
+
+00000761 <link>:
+SYSCALL(link)
+ 761:	b8 13 00 00 00       	mov    $0x13,%eax
+ 766:	e9 50 ff ff ff       	jmp    6bb <syscallentry>
+
+0000076b <mkdir>:
+SYSCALL(mkdir)
+ 76b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 770:	e9 46 ff ff ff       	jmp    6bb <syscallentry>
+
+00000775 <chdir>:
+SYSCALL(chdir)
+ 775:	b8 09 00 00 00       	mov    $0x9,%eax
+ 77a:	e9 3c ff ff ff       	jmp    6bb <syscallentry>
+
+0000077f <dup>:
+SYSCALL(dup)
+ 77f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 784:	e9 32 ff ff ff       	jmp    6bb <syscallentry>
+
+00000789 <getpid>:
+SYSCALL(getpid)
+ 789:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 78e:	e9 28 ff ff ff       	jmp    6bb <syscallentry>
+
+00000793 <sbrk>:
+SYSCALL(sbrk)
+ 793:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 798:	e9 1e ff ff ff       	jmp    6bb <syscallentry>
+
+0000079d <sleep>:
+SYSCALL(sleep)
+ 79d:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 7a2:	e9 14 ff ff ff       	jmp    6bb <syscallentry>
+
+000007a7 <uptime>:
+SYSCALL(uptime)
+ 7a7:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 7ac:	e9 0a ff ff ff       	jmp    6bb <syscallentry>
+
+000007b1 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+ 7b1:	b8 16 00 00 00       	mov    $0x16,%eax
+ 7b6:	e9 00 ff ff ff       	jmp    6bb <syscallentry>
+
+000007bb <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+ 7bb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 7c0:	e9 f6 fe ff ff       	jmp    6bb <syscallentry>
+
+000007c5 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+ 7c5:	b8 18 00 00 00       	mov    $0x18,%eax
+ 7ca:	e9 ec fe ff ff       	jmp    6bb <syscallentry>
+
+000007cf <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+ 7cf:	b8 19 00 00 00       	mov    $0x19,%eax
+ 7d4:	e9 e2 fe ff ff       	jmp    6bb <syscallentry>
+
+000007d9 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+ 7d9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 7de:	e9 d8 fe ff ff       	jmp    6bb <syscallentry>
+
+000007e3 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+ 7e3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 7e8:	e9 ce fe ff ff       	jmp    6bb <syscallentry>
+
+000007ed <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+ 7ed:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 7f2:	e9 c4 fe ff ff       	jmp    6bb <syscallentry>
+
+000007f7 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+ 7f7:	b8 20 00 00 00       	mov    $0x20,%eax
+ 7fc:	e9 ba fe ff ff       	jmp    6bb <syscallentry>
+
+00000801 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+ 801:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 806:	e9 b0 fe ff ff       	jmp    6bb <syscallentry>
+
+0000080b <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+ 80b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 810:	e9 a6 fe ff ff       	jmp    6bb <syscallentry>
+
+00000815 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+ 815:	b8 21 00 00 00       	mov    $0x21,%eax
+ 81a:	e9 9c fe ff ff       	jmp    6bb <syscallentry>
+
+0000081f <yield>:
+SYSCALL(yield) // yield the CPU to another process
+ 81f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 824:	e9 92 fe ff ff       	jmp    6bb <syscallentry>
+
+00000829 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+ 829:	b8 23 00 00 00       	mov    $0x23,%eax
+ 82e:	e9 88 fe ff ff       	jmp    6bb <syscallentry>
+
+00000833 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+ 833:	b8 24 00 00 00       	mov    $0x24,%eax
+ 838:	e9 7e fe ff ff       	jmp    6bb <syscallentry>
+
+0000083d <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+ 83d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 842:	e9 74 fe ff ff       	jmp    6bb <syscallentry>
+
+00000847 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+ 847:	b8 26 00 00 00       	mov    $0x26,%eax
+ 84c:	e9 6a fe ff ff       	jmp    6bb <syscallentry>
+
+00000851 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+ 851:	b8 27 00 00 00       	mov    $0x27,%eax
+ 856:	e9 60 fe ff ff       	jmp    6bb <syscallentry>
+
+0000085b <mmap>:
+SYSCALL(mmap) // map a file into memory
+ 85b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 860:	e9 56 fe ff ff       	jmp    6bb <syscallentry>
+
+00000865 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+ 865:	b8 29 00 00 00       	mov    $0x29,%eax
+ 86a:	e9 4c fe ff ff       	jmp    6bb <syscallentry>
+
+0000086f <readv>:
+SYSCALL(readv) // read into several buffers
+ 86f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 874:	e9 42 fe ff ff       	jmp    6bb <syscallentry>
+
+00000879 <writev>:
+SYSCALL(writev) // write from several buffers
+ 879:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 87e:	e9 38 fe ff ff       	jmp    6bb <syscallentry>
+
+00000883 <pread>:
+SYSCALL(pread) // read at an offset
+ 883:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 888:	e9 2e fe ff ff       	jmp    6bb <syscallentry>
+
+0000088d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+ 88d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 892:	e9 24 fe ff ff       	jmp    6bb <syscallentry>
+
+00000897 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+ 897:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 89c:	e9 1a fe ff ff       	jmp    6bb <syscallentry>
+
+000008a1 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+ 8a1:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 8a6:	e9 10 fe ff ff       	jmp    6bb <syscallentry>
+
+000008ab <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+ 8ab:	b8 30 00 00 00       	mov    $0x30,%eax
+ 8b0:	e9 06 fe ff ff       	jmp    6bb <syscallentry>
+
+000008b5 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+ 8b5:	b8 31 00 00 00       	mov    $0x31,%eax
+ 8ba:	e9 fc fd ff ff       	jmp    6bb <syscallentry>
+
+000008bf <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+ 8bf:	b8 32 00 00 00       	mov    $0x32,%eax
+ 8c4:	e9 f2 fd ff ff       	jmp    6bb <syscallentry>
+
+000008c9 <profread>:
+SYSCALL(profread) // drain profiler samples
+ 8c9:	b8 33 00 00 00       	mov    $0x33,%eax
+ 8ce:	e9 e8 fd ff ff       	jmp    6bb <syscallentry>
+
+000008d3 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+ 8d3:	b8 34 00 00 00       	mov    $0x34,%eax
+ 8d8:	e9 de fd ff ff       	jmp    6bb <syscallentry>
+
+000008dd <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+ 8dd:	b8 35 00 00 00       	mov    $0x35,%eax
+ 8e2:	e9 d4 fd ff ff       	jmp    6bb <syscallentry>
+
+000008e7 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+ 8e7:	b8 36 00 00 00       	mov    $0x36,%eax
+ 8ec:	e9 ca fd ff ff       	jmp    6bb <syscallentry>
+
+000008f1 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+ 8f1:	b8 37 00 00 00       	mov    $0x37,%eax
+ 8f6:	e9 c0 fd ff ff       	jmp    6bb <syscallentry>
+ 8fb:	66 90                	xchg   %ax,%ax
+ 8fd:	66 90                	xchg   %ax,%ax
+ 8ff:	90                   	nop
+
+00000900 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 900:	55                   	push   %ebp
+ 901:	89 e5                	mov    %esp,%ebp
+ 903:	57                   	push   %edi
+ 904:	56                   	push   %esi
+ 905:	53                   	push   %ebx
+ 906:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 908:	89 d1                	mov    %edx,%ecx
+{
+ 90a:	83 ec 3c             	sub    $0x3c,%esp
+ 90d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 910:	85 d2                	test   %edx,%edx
+ 912:	0f 89 80 00 00 00    	jns    998 <printint+0x98>
+ 918:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 91c:	74 7a                	je     998 <printint+0x98>
+    x = -xx;
+ 91e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 920:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 925:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 928:	31 f6                	xor    %esi,%esi
+ 92a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 930:	89 c8                	mov    %ecx,%eax
+ 932:	31 d2                	xor    %edx,%edx
+ 934:	89 f7                	mov    %esi,%edi
+ 936:	f7 f3                	div    %ebx
+ 938:	8d 76 01             	lea    0x1(%esi),%esi
+ 93b:	0f b6 92 fc 0e 00 00 	movzbl 0xefc(%edx),%edx
+ 942:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 946:	89 ca                	mov    %ecx,%edx
+ 948:	89 c1                	mov    %eax,%ecx
+ 94a:	39 da                	cmp    %ebx,%edx
+ 94c:	73 e2                	jae    930 <printint+0x30>
+  if(neg)
+ 94e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 951:	85 c0                	test   %eax,%eax
+ 953:	74 07                	je     95c <printint+0x5c>
+    buf[i++] = '-';
+ 955:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 95a:	89 f7                	mov    %esi,%edi
+ 95c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 95f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 962:	01 df                	add    %ebx,%edi
+ 964:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 968:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+ 96b:	83 ec 04             	sub    $0x4,%esp
+ 96e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 971:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 974:	6a 01                	push   $0x1
+ 976:	50                   	push   %eax
+ 977:	56                   	push   %esi
+ 978:	e8 e3 f6 ff ff       	call   60 <bufwrite>
+  while(--i >= 0)
+ 97d:	89 f8                	mov    %edi,%eax
+ 97f:	83 c4 10             	add    $0x10,%esp
+ 982:	83 ef 01             	sub    $0x1,%edi
+ 985:	39 d8                	cmp    %ebx,%eax
+ 987:	75 df                	jne    968 <printint+0x68>
+}
+ 989:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 98c:	5b                   	pop    %ebx
+ 98d:	5e                   	pop    %esi
+ 98e:	5f                   	pop    %edi
+ 98f:	5d                   	pop    %ebp
+ 990:	c3                   	ret
+ 991:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 998:	31 c0                	xor    %eax,%eax
+ 99a:	eb 89                	jmp    925 <printint+0x25>
+ 99c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000009a0 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 9a0:	55                   	push   %ebp
+ 9a1:	89 e5                	mov    %esp,%ebp
+ 9a3:	57                   	push   %edi
+ 9a4:	56                   	push   %esi
+ 9a5:	53                   	push   %ebx
+ 9a6:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 9a9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 9ac:	0f b6 18             	movzbl (%eax),%ebx
+ 9af:	84 db                	test   %bl,%bl
+ 9b1:	74 6c                	je     a1f <printf+0x7f>
+ 9b3:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+ 9b6:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ 9b9:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 9bb:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 9be:	eb 26                	jmp    9e6 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 9c0:	83 f8 25             	cmp    $0x25,%eax
+ 9c3:	74 4b                	je     a10 <printf+0x70>
+  bufwrite(fd, &c, 1);
+ 9c5:	83 ec 04             	sub    $0x4,%esp
+ 9c8:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 9cb:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ 9ce:	6a 01                	push   $0x1
+ 9d0:	50                   	push   %eax
+ 9d1:	ff 75 08             	push   0x8(%ebp)
+ 9d4:	e8 87 f6 ff ff       	call   60 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+ 9d9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 9dc:	0f b6 1f             	movzbl (%edi),%ebx
+ 9df:	83 c7 01             	add    $0x1,%edi
+ 9e2:	84 db                	test   %bl,%bl
+ 9e4:	74 39                	je     a1f <printf+0x7f>
+    c = fmt[i] & 0xff;
+ 9e6:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 9e9:	85 f6                	test   %esi,%esi
+ 9eb:	74 d3                	je     9c0 <printf+0x20>
+      }
+    } else if(state == '%'){
+ 9ed:	83 fe 25             	cmp    $0x25,%esi
+ 9f0:	75 ea                	jne    9dc <printf+0x3c>
+      if(c == 'd'){
+ 9f2:	83 f8 25             	cmp    $0x25,%eax
+ 9f5:	0f 84 d5 01 00 00    	je     bd0 <printf+0x230>
+ 9fb:	83 e8 63             	sub    $0x63,%eax
+ 9fe:	83 f8 15             	cmp    $0x15,%eax
+ a01:	77 45                	ja     a48 <printf+0xa8>
+ a03:	ff 24 85 a4 0e 00 00 	jmp    *0xea4(,%eax,4)
+ a0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+ a10:	0f b6 1f             	movzbl (%edi),%ebx
+ a13:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+ a16:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ a1b:	84 db                	test   %bl,%bl
+ a1d:	75 c7                	jne    9e6 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+ a1f:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+ a23:	74 0b                	je     a30 <printf+0x90>
+    fflush(fd);
+}
+ a25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a28:	5b                   	pop    %ebx
+ a29:	5e                   	pop    %esi
+ a2a:	5f                   	pop    %edi
+ a2b:	5d                   	pop    %ebp
+ a2c:	c3                   	ret
+ a2d:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+ a30:	83 ec 0c             	sub    $0xc,%esp
+ a33:	6a 02                	push   $0x2
+ a35:	e8 c6 f7 ff ff       	call   200 <fflush>
+ a3a:	83 c4 10             	add    $0x10,%esp
+}
+ a3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a40:	5b                   	pop    %ebx
+ a41:	5e                   	pop    %esi
+ a42:	5f                   	pop    %edi
+ a43:	5d                   	pop    %ebp
+ a44:	c3                   	ret
+ a45:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+ a48:	83 ec 04             	sub    $0x4,%esp
+ a4b:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ a4e:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+ a52:	6a 01                	push   $0x1
+ a54:	52                   	push   %edx
+ a55:	89 55 c0             	mov    %edx,-0x40(%ebp)
+ a58:	ff 75 08             	push   0x8(%ebp)
+ a5b:	e8 00 f6 ff ff       	call   60 <bufwrite>
+ a60:	83 c4 0c             	add    $0xc,%esp
+ a63:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ a66:	6a 01                	push   $0x1
+ a68:	8b 55 c0             	mov    -0x40(%ebp),%edx
+ a6b:	52                   	push   %edx
+      state = 0;
+ a6c:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+ a6e:	ff 75 08             	push   0x8(%ebp)
+ a71:	e8 ea f5 ff ff       	call   60 <bufwrite>
+        putc(fd, c);
+ a76:	83 c4 10             	add    $0x10,%esp
+ a79:	e9 5e ff ff ff       	jmp    9dc <printf+0x3c>
+ a7e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+ a80:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ a83:	83 ec 0c             	sub    $0xc,%esp
+ a86:	b9 10 00 00 00       	mov    $0x10,%ecx
+ a8b:	8b 16                	mov    (%esi),%edx
+ a8d:	6a 00                	push   $0x0
+ a8f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+ a92:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+ a95:	e8 66 fe ff ff       	call   900 <printint>
+        ap++;
+ a9a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ a9d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ aa0:	31 f6                	xor    %esi,%esi
+ aa2:	e9 35 ff ff ff       	jmp    9dc <printf+0x3c>
+ aa7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aae:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+ ab0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ ab3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ ab5:	83 c0 04             	add    $0x4,%eax
+ ab8:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+ abb:	b8 9b 0e 00 00       	mov    $0xe9b,%eax
+ ac0:	85 db                	test   %ebx,%ebx
+ ac2:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+ ac5:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+ ac8:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+ aca:	53                   	push   %ebx
+ acb:	e8 90 f9 ff ff       	call   460 <strlen>
+ ad0:	83 c4 0c             	add    $0xc,%esp
+ ad3:	50                   	push   %eax
+ ad4:	53                   	push   %ebx
+ ad5:	ff 75 08             	push   0x8(%ebp)
+ ad8:	e8 83 f5 ff ff       	call   60 <bufwrite>
+ add:	83 c4 10             	add    $0x10,%esp
+ ae0:	e9 f7 fe ff ff       	jmp    9dc <printf+0x3c>
+ ae5:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ ae8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+ aeb:	83 ec 04             	sub    $0x4,%esp
+ aee:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+ af1:	8b 06                	mov    (%esi),%eax
+        ap++;
+ af3:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+ af6:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+ af9:	6a 01                	push   $0x1
+ afb:	52                   	push   %edx
+ afc:	ff 75 08             	push   0x8(%ebp)
+ aff:	e8 5c f5 ff ff       	call   60 <bufwrite>
+        ap++;
+ b04:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ b07:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b0a:	31 f6                	xor    %esi,%esi
+ b0c:	e9 cb fe ff ff       	jmp    9dc <printf+0x3c>
+ b11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+ b18:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ b1b:	83 ec 0c             	sub    $0xc,%esp
+ b1e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ b23:	8b 16                	mov    (%esi),%edx
+ b25:	6a 01                	push   $0x1
+ b27:	e9 63 ff ff ff       	jmp    a8f <printf+0xef>
+ b2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+ b30:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ b33:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ b36:	89 7d c0             	mov    %edi,-0x40(%ebp)
+ b39:	89 55 bc             	mov    %edx,-0x44(%ebp)
+ b3c:	8b 18                	mov    (%eax),%ebx
+ b3e:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+ b41:	31 c0                	xor    %eax,%eax
+ b43:	89 c7                	mov    %eax,%edi
+ b45:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+ b48:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+ b4d:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+ b4f:	f7 e1                	mul    %ecx
+ b51:	c1 ea 03             	shr    $0x3,%edx
+ b54:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ b57:	89 d1                	mov    %edx,%ecx
+ b59:	01 c0                	add    %eax,%eax
+ b5b:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ b5d:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+ b5f:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ b61:	be 0a 00 00 00       	mov    $0xa,%esi
+ b66:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+ b68:	89 da                	mov    %ebx,%edx
+ b6a:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+ b6c:	89 fe                	mov    %edi,%esi
+ b6e:	83 c7 01             	add    $0x1,%edi
+ b71:	8d 42 30             	lea    0x30(%edx),%eax
+ b74:	89 da                	mov    %ebx,%edx
+ b76:	8d 14 92             	lea    (%edx,%edx,4),%edx
+ b79:	01 d2                	add    %edx,%edx
+ b7b:	29 d0                	sub    %edx,%eax
+ b7d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+ b81:	89 c8                	mov    %ecx,%eax
+ b83:	09 d8                	or     %ebx,%eax
+ b85:	75 c1                	jne    b48 <printf+0x1a8>
+ b87:	8b 55 bc             	mov    -0x44(%ebp),%edx
+ b8a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ b8d:	01 d6                	add    %edx,%esi
+ b8f:	89 f7                	mov    %esi,%edi
+ b91:	89 d6                	mov    %edx,%esi
+ b93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b97:	90                   	nop
+    putc(fd, buf[i]);
+ b98:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+ b9b:	83 ec 04             	sub    $0x4,%esp
+ b9e:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+ ba1:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+ ba4:	6a 01                	push   $0x1
+ ba6:	50                   	push   %eax
+ ba7:	53                   	push   %ebx
+ ba8:	e8 b3 f4 ff ff       	call   60 <bufwrite>
+  while(--i >= 0)
+ bad:	89 fa                	mov    %edi,%edx
+ baf:	83 c4 10             	add    $0x10,%esp
+ bb2:	83 ef 01             	sub    $0x1,%edi
+ bb5:	39 d6                	cmp    %edx,%esi
+ bb7:	75 df                	jne    b98 <printf+0x1f8>
+        ap += 2;
+ bb9:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+ bbd:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+ bc0:	31 f6                	xor    %esi,%esi
+ bc2:	e9 15 fe ff ff       	jmp    9dc <printf+0x3c>
+ bc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bce:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+ bd0:	83 ec 04             	sub    $0x4,%esp
+ bd3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ bd6:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ bd9:	6a 01                	push   $0x1
+ bdb:	e9 8b fe ff ff       	jmp    a6b <printf+0xcb>
+
+00000be0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ be0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ be1:	a1 20 24 00 00       	mov    0x2420,%eax
+{
+ be6:	89 e5                	mov    %esp,%ebp
+ be8:	57                   	push   %edi
+ be9:	56                   	push   %esi
+ bea:	53                   	push   %ebx
+ beb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ bee:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bf1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bf8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ bfa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bfc:	39 ca                	cmp    %ecx,%edx
+ bfe:	73 30                	jae    c30 <free+0x50>
+ c00:	39 c1                	cmp    %eax,%ecx
+ c02:	72 04                	jb     c08 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c04:	39 c2                	cmp    %eax,%edx
+ c06:	72 f0                	jb     bf8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ c08:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ c0b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ c0e:	39 f8                	cmp    %edi,%eax
+ c10:	74 2e                	je     c40 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c12:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ c15:	8b 42 04             	mov    0x4(%edx),%eax
+ c18:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c1b:	39 f1                	cmp    %esi,%ecx
+ c1d:	74 38                	je     c57 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ c1f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ c21:	5b                   	pop    %ebx
+  freep = p;
+ c22:	89 15 20 24 00 00    	mov    %edx,0x2420
+}
+ c28:	5e                   	pop    %esi
+ c29:	5f                   	pop    %edi
+ c2a:	5d                   	pop    %ebp
+ c2b:	c3                   	ret
+ c2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c30:	39 c1                	cmp    %eax,%ecx
+ c32:	72 d0                	jb     c04 <free+0x24>
+ c34:	eb c2                	jmp    bf8 <free+0x18>
+ c36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c3d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ c40:	03 70 04             	add    0x4(%eax),%esi
+ c43:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c46:	8b 02                	mov    (%edx),%eax
+ c48:	8b 00                	mov    (%eax),%eax
+ c4a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ c4d:	8b 42 04             	mov    0x4(%edx),%eax
+ c50:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c53:	39 f1                	cmp    %esi,%ecx
+ c55:	75 c8                	jne    c1f <free+0x3f>
+    p->s.size += bp->s.size;
+ c57:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ c5a:	89 15 20 24 00 00    	mov    %edx,0x2420
+    p->s.size += bp->s.size;
+ c60:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ c63:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ c66:	89 0a                	mov    %ecx,(%edx)
+}
+ c68:	5b                   	pop    %ebx
+ c69:	5e                   	pop    %esi
+ c6a:	5f                   	pop    %edi
+ c6b:	5d                   	pop    %ebp
+ c6c:	c3                   	ret
+ c6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c70 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ c70:	55                   	push   %ebp
+ c71:	89 e5                	mov    %esp,%ebp
+ c73:	57                   	push   %edi
+ c74:	56                   	push   %esi
+ c75:	53                   	push   %ebx
+ c76:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c79:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ c7c:	8b 15 20 24 00 00    	mov    0x2420,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c82:	8d 78 07             	lea    0x7(%eax),%edi
+ c85:	c1 ef 03             	shr    $0x3,%edi
+ c88:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ c8b:	85 d2                	test   %edx,%edx
+ c8d:	0f 84 8d 00 00 00    	je     d20 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c93:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c95:	8b 48 04             	mov    0x4(%eax),%ecx
+ c98:	39 f9                	cmp    %edi,%ecx
+ c9a:	73 64                	jae    d00 <malloc+0x90>
+  if(nu < 4096)
+ c9c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ ca1:	39 df                	cmp    %ebx,%edi
+ ca3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ ca6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ cad:	eb 0a                	jmp    cb9 <malloc+0x49>
+ caf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cb0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ cb2:	8b 48 04             	mov    0x4(%eax),%ecx
+ cb5:	39 f9                	cmp    %edi,%ecx
+ cb7:	73 47                	jae    d00 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ cb9:	89 c2                	mov    %eax,%edx
+ cbb:	39 05 20 24 00 00    	cmp    %eax,0x2420
+ cc1:	75 ed                	jne    cb0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ cc3:	83 ec 0c             	sub    $0xc,%esp
+ cc6:	56                   	push   %esi
+ cc7:	e8 c7 fa ff ff       	call   793 <sbrk>
+  if(p == (char*)-1)
+ ccc:	83 c4 10             	add    $0x10,%esp
+ ccf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ cd2:	74 1c                	je     cf0 <malloc+0x80>
+  hp->s.size = nu;
+ cd4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ cd7:	83 ec 0c             	sub    $0xc,%esp
+ cda:	83 c0 08             	add    $0x8,%eax
+ cdd:	50                   	push   %eax
+ cde:	e8 fd fe ff ff       	call   be0 <free>
+  return freep;
+ ce3:	8b 15 20 24 00 00    	mov    0x2420,%edx
+      if((p = morecore(nunits)) == 0)
+ ce9:	83 c4 10             	add    $0x10,%esp
+ cec:	85 d2                	test   %edx,%edx
+ cee:	75 c0                	jne    cb0 <malloc+0x40>
+        return 0;
+  }
+}
+ cf0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ cf3:	31 c0                	xor    %eax,%eax
+}
+ cf5:	5b                   	pop    %ebx
+ cf6:	5e                   	pop    %esi
+ cf7:	5f                   	pop    %edi
+ cf8:	5d                   	pop    %ebp
+ cf9:	c3                   	ret
+ cfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ d00:	39 cf                	cmp    %ecx,%edi
+ d02:	74 4c                	je     d50 <malloc+0xe0>
+        p->s.size -= nunits;
+ d04:	29 f9                	sub    %edi,%ecx
+ d06:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ d09:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ d0c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ d0f:	89 15 20 24 00 00    	mov    %edx,0x2420
+}
+ d15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ d18:	83 c0 08             	add    $0x8,%eax
+}
+ d1b:	5b                   	pop    %ebx
+ d1c:	5e                   	pop    %esi
+ d1d:	5f                   	pop    %edi
+ d1e:	5d                   	pop    %ebp
+ d1f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ d20:	c7 05 20 24 00 00 24 	movl   $0x2424,0x2420
+ d27:	24 00 00 
+    base.s.size = 0;
+ d2a:	b8 24 24 00 00       	mov    $0x2424,%eax
+    base.s.ptr = freep = prevp = &base;
+ d2f:	c7 05 24 24 00 00 24 	movl   $0x2424,0x2424
+ d36:	24 00 00 
+    base.s.size = 0;
+ d39:	c7 05 28 24 00 00 00 	movl   $0x0,0x2428
+ d40:	00 00 00 
+    if(p->s.size >= nunits){
+ d43:	e9 54 ff ff ff       	jmp    c9c <malloc+0x2c>
+ d48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d4f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ d50:	8b 08                	mov    (%eax),%ecx
+ d52:	89 0a                	mov    %ecx,(%edx)
+ d54:	eb b9                	jmp    d0f <malloc+0x9f>
+ d56:	66 90                	xchg   %ax,%ax
+ d58:	66 90                	xchg   %ax,%ax
+ d5a:	66 90                	xchg   %ax,%ax
+ d5c:	66 90                	xchg   %ax,%ax
+ d5e:	66 90                	xchg   %ax,%ax
+
+00000d60 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+ d60:	55                   	push   %ebp
+ d61:	89 e5                	mov    %esp,%ebp
+ d63:	57                   	push   %edi
+ d64:	56                   	push   %esi
+ d65:	be 01 00 00 00       	mov    $0x1,%esi
+ d6a:	53                   	push   %ebx
+ d6b:	83 ec 28             	sub    $0x28,%esp
+ d6e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ d71:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ d74:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+ d77:	68 00 98 00 00       	push   $0x9800
+ d7c:	e8 ef fe ff ff       	call   c70 <malloc>
+ d81:	83 c4 10             	add    $0x10,%esp
+ d84:	89 c7                	mov    %eax,%edi
+ d86:	85 c0                	test   %eax,%eax
+ d88:	74 62                	je     dec <waitpoll+0x8c>
+ d8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+ d90:	83 ec 0c             	sub    $0xc,%esp
+ d93:	6a 01                	push   $0x1
+ d95:	e8 03 fa ff ff       	call   79d <sleep>
+    fn();
+ d9a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ d9d:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+ d9f:	58                   	pop    %eax
+ da0:	5a                   	pop    %edx
+ da1:	68 00 02 00 00       	push   $0x200
+ da6:	57                   	push   %edi
+ da7:	e8 eb fa ff ff       	call   897 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+ dac:	83 c4 10             	add    $0x10,%esp
+ daf:	85 c0                	test   %eax,%eax
+ db1:	7e 2d                	jle    de0 <waitpoll+0x80>
+ db3:	6b c0 4c             	imul   $0x4c,%eax,%eax
+ db6:	89 fa                	mov    %edi,%edx
+    alive = 0;
+ db8:	31 c9                	xor    %ecx,%ecx
+ dba:	01 f8                	add    %edi,%eax
+ dbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+ dc0:	3b 1a                	cmp    (%edx),%ebx
+ dc2:	75 07                	jne    dcb <waitpoll+0x6b>
+        alive = 1;
+ dc4:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+ dc8:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+ dcb:	83 c2 4c             	add    $0x4c,%edx
+ dce:	39 d0                	cmp    %edx,%eax
+ dd0:	75 ee                	jne    dc0 <waitpoll+0x60>
+  } while(alive);
+ dd2:	85 c9                	test   %ecx,%ecx
+ dd4:	75 ba                	jne    d90 <waitpoll+0x30>
+ dd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ddd:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+ de0:	83 ec 0c             	sub    $0xc,%esp
+ de3:	57                   	push   %edi
+ de4:	e8 f7 fd ff ff       	call   be0 <free>
+  wait();
+ de9:	83 c4 10             	add    $0x10,%esp
+}
+ dec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ def:	5b                   	pop    %ebx
+ df0:	5e                   	pop    %esi
+ df1:	5f                   	pop    %edi
+ df2:	5d                   	pop    %ebp
+  wait();
+ df3:	e9 10 f9 ff ff       	jmp    708 <wait>
+ df8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dff:	90                   	nop
+
+00000e00 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+ e00:	55                   	push   %ebp
+ e01:	89 e5                	mov    %esp,%ebp
+ e03:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+ e06:	c7 45 f0 0d 0f 00 00 	movl   $0xf0d,-0x10(%ebp)
+ e0d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+ e14:	e8 87 f4 ff ff       	call   2a0 <fork>
+ e19:	85 c0                	test   %eax,%eax
+ e1b:	78 09                	js     e26 <runps+0x26>
+    return -1;
+  if(pid == 0){
+ e1d:	74 0e                	je     e2d <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+ e1f:	e8 e4 f8 ff ff       	call   708 <wait>
+}
+ e24:	c9                   	leave
+ e25:	c3                   	ret
+ e26:	c9                   	leave
+    return -1;
+ e27:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ e2c:	c3                   	ret
+    exec("ps", argv);
+ e2d:	50                   	push   %eax
+ e2e:	50                   	push   %eax
+ e2f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ e32:	50                   	push   %eax
+ e33:	68 0d 0f 00 00       	push   $0xf0d
+ e38:	e8 c3 f4 ff ff       	call   300 <exec>
+    printf(2, "exec ps failed\n");
+ e3d:	5a                   	pop    %edx
+ e3e:	59                   	pop    %ecx
+ e3f:	68 10 0f 00 00       	push   $0xf10
+ e44:	6a 02                	push   $0x2
+ e46:	e8 55 fb ff ff       	call   9a0 <printf>
+    exit();
+ e4b:	e8 a0 f4 ff ff       	call   2f0 <exit>
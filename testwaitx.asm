@@ -0,0 +1,2023 @@
+
+_testwaitx:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+int main() {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 14             	sub    $0x14,%esp
+  uint64 wtime, rtime;
+  int pid = fork();
+  11:	e8 0a 03 00 00       	call   320 <fork>
+
+  if (pid == 0) {
+  16:	85 c0                	test   %eax,%eax
+  18:	74 71                	je     8b <main+0x8b>
+    // Child process does some work
+    printf(1, "Child process starting work...\n");
+    for (volatile int i = 0; i < 1000000000; i++); // CPU work
+    printf(1, "Child process completed\n");
+    exit();
+  } else if (pid > 0) {
+  1a:	7e 5c                	jle    78 <main+0x78>
+    printf(1, "Parent waiting for child %d\n", pid);
+  1c:	52                   	push   %edx
+  1d:	50                   	push   %eax
+  1e:	68 09 0f 00 00       	push   $0xf09
+  23:	6a 01                	push   $0x1
+  25:	e8 f6 09 00 00       	call   a20 <printf>
+    int cpid = waitx(&wtime, &rtime);
+  2a:	59                   	pop    %ecx
+  2b:	58                   	pop    %eax
+  2c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  2f:	50                   	push   %eax
+  30:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  33:	50                   	push   %eax
+  34:	e8 34 08 00 00       	call   86d <waitx>
+    printf(1, "Child %d finished with:\n", cpid);
+  39:	83 c4 0c             	add    $0xc,%esp
+  3c:	50                   	push   %eax
+  3d:	68 26 0f 00 00       	push   $0xf26
+  42:	6a 01                	push   $0x1
+  44:	e8 d7 09 00 00       	call   a20 <printf>
+    printf(1, "- Wait time: %l us\n", wtime);
+  49:	ff 75 ec             	push   -0x14(%ebp)
+  4c:	ff 75 e8             	push   -0x18(%ebp)
+  4f:	68 3f 0f 00 00       	push   $0xf3f
+  54:	6a 01                	push   $0x1
+  56:	e8 c5 09 00 00       	call   a20 <printf>
+    printf(1, "- Run time: %l us\n", rtime);
+  5b:	83 c4 20             	add    $0x20,%esp
+  5e:	ff 75 f4             	push   -0xc(%ebp)
+  61:	ff 75 f0             	push   -0x10(%ebp)
+  64:	68 53 0f 00 00       	push   $0xf53
+  69:	6a 01                	push   $0x1
+  6b:	e8 b0 09 00 00       	call   a20 <printf>
+  70:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(1, "Fork failed\n");
+  }
+  
+  exit();
+  73:	e8 f8 02 00 00       	call   370 <exit>
+    printf(1, "Fork failed\n");
+  78:	50                   	push   %eax
+  79:	50                   	push   %eax
+  7a:	68 66 0f 00 00       	push   $0xf66
+  7f:	6a 01                	push   $0x1
+  81:	e8 9a 09 00 00       	call   a20 <printf>
+  86:	83 c4 10             	add    $0x10,%esp
+  89:	eb e8                	jmp    73 <main+0x73>
+    printf(1, "Child process starting work...\n");
+  8b:	50                   	push   %eax
+  8c:	50                   	push   %eax
+  8d:	68 d0 0e 00 00       	push   $0xed0
+  92:	6a 01                	push   $0x1
+  94:	e8 87 09 00 00       	call   a20 <printf>
+    for (volatile int i = 0; i < 1000000000; i++); // CPU work
+  99:	31 c0                	xor    %eax,%eax
+  9b:	83 c4 10             	add    $0x10,%esp
+  9e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  a1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  a4:	3d ff c9 9a 3b       	cmp    $0x3b9ac9ff,%eax
+  a9:	7f 18                	jg     c3 <main+0xc3>
+  ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  af:	90                   	nop
+  b0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  b3:	83 c0 01             	add    $0x1,%eax
+  b6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  b9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  bc:	3d ff c9 9a 3b       	cmp    $0x3b9ac9ff,%eax
+  c1:	7e ed                	jle    b0 <main+0xb0>
+    printf(1, "Child process completed\n");
+  c3:	50                   	push   %eax
+  c4:	50                   	push   %eax
+  c5:	68 f0 0e 00 00       	push   $0xef0
+  ca:	6a 01                	push   $0x1
+  cc:	e8 4f 09 00 00       	call   a20 <printf>
+    exit();
+  d1:	e8 9a 02 00 00       	call   370 <exit>
+  d6:	66 90                	xchg   %ax,%ax
+  d8:	66 90                	xchg   %ax,%ax
+  da:	66 90                	xchg   %ax,%ax
+  dc:	66 90                	xchg   %ax,%ax
+  de:	66 90                	xchg   %ax,%ax
+
+000000e0 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+  e0:	55                   	push   %ebp
+  e1:	89 e5                	mov    %esp,%ebp
+  e3:	57                   	push   %edi
+  e4:	56                   	push   %esi
+  e5:	53                   	push   %ebx
+  e6:	83 ec 4c             	sub    $0x4c,%esp
+  e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  f2:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+  f5:	83 fa 0f             	cmp    $0xf,%edx
+  f8:	0f 87 32 01 00 00    	ja     230 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+  fe:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 104:	8b 80 60 14 00 00    	mov    0x1460(%eax),%eax
+ 10a:	85 c0                	test   %eax,%eax
+ 10c:	0f 84 de 00 00 00    	je     1f0 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+ 112:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 118:	8b b0 64 14 00 00    	mov    0x1464(%eax),%esi
+ 11e:	8d 88 60 14 00 00    	lea    0x1460(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+ 124:	8d b8 68 14 00 00    	lea    0x1468(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+ 12a:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+ 12d:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+ 130:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+ 133:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+ 139:	0f 8f 01 01 00 00    	jg     240 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+ 13f:	8d 78 08             	lea    0x8(%eax),%edi
+ 142:	8d bc 3e 60 14 00 00 	lea    0x1460(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 149:	85 db                	test   %ebx,%ebx
+ 14b:	7e 3b                	jle    188 <bufwrite+0xa8>
+ 14d:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+ 150:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+    *dst++ = *src++;
+ 158:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 159:	39 c6                	cmp    %eax,%esi
+ 15b:	75 fb                	jne    158 <bufwrite+0x78>
+  ob[fd].n += n;
+ 15d:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+ 163:	8b 88 64 14 00 00    	mov    0x1464(%eax),%ecx
+ 169:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 16b:	83 b8 60 14 00 00 01 	cmpl   $0x1,0x1460(%eax)
+  ob[fd].n += n;
+ 172:	89 88 64 14 00 00    	mov    %ecx,0x1464(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 178:	74 26                	je     1a0 <bufwrite+0xc0>
+}
+ 17a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 17d:	5b                   	pop    %ebx
+ 17e:	5e                   	pop    %esi
+ 17f:	5f                   	pop    %edi
+ 180:	5d                   	pop    %ebp
+ 181:	c3                   	ret
+ 182:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+ 188:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 18b:	83 b8 60 14 00 00 01 	cmpl   $0x1,0x1460(%eax)
+  ob[fd].n += n;
+ 192:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+ 195:	75 e3                	jne    17a <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+ 197:	85 db                	test   %ebx,%ebx
+ 199:	74 df                	je     17a <bufwrite+0x9a>
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+  src = vsrc;
+ 1a0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 1a3:	01 c3                	add    %eax,%ebx
+ 1a5:	eb 10                	jmp    1b7 <bufwrite+0xd7>
+ 1a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ae:	66 90                	xchg   %ax,%ax
+ 1b0:	83 c0 01             	add    $0x1,%eax
+ 1b3:	39 d8                	cmp    %ebx,%eax
+ 1b5:	74 c3                	je     17a <bufwrite+0x9a>
+    if(*p == (char)c)
+ 1b7:	80 38 0a             	cmpb   $0xa,(%eax)
+ 1ba:	75 f4                	jne    1b0 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 1bc:	85 c9                	test   %ecx,%ecx
+ 1be:	7e ba                	jle    17a <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 1c0:	83 ec 04             	sub    $0x4,%esp
+ 1c3:	51                   	push   %ecx
+ 1c4:	ff 75 ac             	push   -0x54(%ebp)
+ 1c7:	52                   	push   %edx
+ 1c8:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+ 1cb:	e8 cd 05 00 00       	call   79d <write>
+    ob[fd].n = 0;
+ 1d0:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+ 1d3:	83 c4 10             	add    $0x10,%esp
+ 1d6:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+ 1dc:	c7 82 64 14 00 00 00 	movl   $0x0,0x1464(%edx)
+ 1e3:	00 00 00 
+ 1e6:	eb 92                	jmp    17a <bufwrite+0x9a>
+ 1e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ef:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 1f0:	83 ec 08             	sub    $0x8,%esp
+ 1f3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 1f6:	50                   	push   %eax
+ 1f7:	52                   	push   %edx
+ 1f8:	89 55 b0             	mov    %edx,-0x50(%ebp)
+ 1fb:	e8 d7 05 00 00       	call   7d7 <fstat>
+ 200:	83 c4 10             	add    $0x10,%esp
+ 203:	8b 55 b0             	mov    -0x50(%ebp),%edx
+ 206:	89 c1                	mov    %eax,%ecx
+ 208:	b8 02 00 00 00       	mov    $0x2,%eax
+ 20d:	85 c9                	test   %ecx,%ecx
+ 20f:	75 0d                	jne    21e <bufwrite+0x13e>
+ 211:	31 c0                	xor    %eax,%eax
+ 213:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 218:	0f 95 c0             	setne  %al
+ 21b:	83 c0 01             	add    $0x1,%eax
+ 21e:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+ 224:	89 81 60 14 00 00    	mov    %eax,0x1460(%ecx)
+ 22a:	e9 e3 fe ff ff       	jmp    112 <bufwrite+0x32>
+ 22f:	90                   	nop
+}
+ 230:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 233:	5b                   	pop    %ebx
+ 234:	5e                   	pop    %esi
+ 235:	5f                   	pop    %edi
+ 236:	5d                   	pop    %ebp
+    write(fd, p, n);
+ 237:	e9 61 05 00 00       	jmp    79d <write>
+ 23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+ 240:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+ 243:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+ 246:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+ 249:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+ 24c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+ 24f:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+ 252:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+ 255:	6a 02                	push   $0x2
+ 257:	50                   	push   %eax
+ 258:	52                   	push   %edx
+ 259:	e8 9b 06 00 00       	call   8f9 <writev>
+    ob[fd].n = 0;
+ 25e:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+ 261:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+ 264:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ 26b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 26e:	5b                   	pop    %ebx
+ 26f:	5e                   	pop    %esi
+ 270:	5f                   	pop    %edi
+ 271:	5d                   	pop    %ebp
+ 272:	c3                   	ret
+ 273:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000280 <fflush>:
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	53                   	push   %ebx
+ 284:	83 ec 04             	sub    $0x4,%esp
+ 287:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 28a:	83 f8 0f             	cmp    $0xf,%eax
+ 28d:	77 16                	ja     2a5 <fflush+0x25>
+ 28f:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+ 295:	8b 8a 64 14 00 00    	mov    0x1464(%edx),%ecx
+ 29b:	8d 9a 60 14 00 00    	lea    0x1460(%edx),%ebx
+ 2a1:	85 c9                	test   %ecx,%ecx
+ 2a3:	7f 0b                	jg     2b0 <fflush+0x30>
+}
+ 2a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2a8:	c9                   	leave
+ 2a9:	c3                   	ret
+ 2aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 2b0:	83 ec 04             	sub    $0x4,%esp
+ 2b3:	81 c2 68 14 00 00    	add    $0x1468,%edx
+ 2b9:	51                   	push   %ecx
+ 2ba:	52                   	push   %edx
+ 2bb:	50                   	push   %eax
+ 2bc:	e8 dc 04 00 00       	call   79d <write>
+    ob[fd].n = 0;
+ 2c1:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+ 2c8:	83 c4 10             	add    $0x10,%esp
+}
+ 2cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2ce:	c9                   	leave
+ 2cf:	c3                   	ret
+
+000002d0 <fflushall>:
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 2d4:	31 f6                	xor    %esi,%esi
+{
+ 2d6:	53                   	push   %ebx
+ 2d7:	bb 68 14 00 00       	mov    $0x1468,%ebx
+ 2dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 2e0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 2e3:	85 c0                	test   %eax,%eax
+ 2e5:	7e 15                	jle    2fc <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 2e7:	83 ec 04             	sub    $0x4,%esp
+ 2ea:	50                   	push   %eax
+ 2eb:	53                   	push   %ebx
+ 2ec:	56                   	push   %esi
+ 2ed:	e8 ab 04 00 00       	call   79d <write>
+    ob[fd].n = 0;
+ 2f2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 2f9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 2fc:	83 c6 01             	add    $0x1,%esi
+ 2ff:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 305:	83 fe 10             	cmp    $0x10,%esi
+ 308:	75 d6                	jne    2e0 <fflushall+0x10>
+}
+ 30a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 30d:	5b                   	pop    %ebx
+ 30e:	5e                   	pop    %esi
+ 30f:	5d                   	pop    %ebp
+ 310:	c3                   	ret
+ 311:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 318:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31f:	90                   	nop
+
+00000320 <fork>:
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 324:	31 f6                	xor    %esi,%esi
+{
+ 326:	53                   	push   %ebx
+ 327:	bb 68 14 00 00       	mov    $0x1468,%ebx
+ 32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 330:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 333:	85 c0                	test   %eax,%eax
+ 335:	7e 15                	jle    34c <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 337:	83 ec 04             	sub    $0x4,%esp
+ 33a:	50                   	push   %eax
+ 33b:	53                   	push   %ebx
+ 33c:	56                   	push   %esi
+ 33d:	e8 5b 04 00 00       	call   79d <write>
+    ob[fd].n = 0;
+ 342:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 349:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 34c:	83 c6 01             	add    $0x1,%esi
+ 34f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 355:	83 fe 10             	cmp    $0x10,%esi
+ 358:	75 d6                	jne    330 <fork+0x10>
+}
+ 35a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 35d:	5b                   	pop    %ebx
+ 35e:	5e                   	pop    %esi
+ 35f:	5d                   	pop    %ebp
+  return _fork();
+ 360:	e9 15 04 00 00       	jmp    77a <_fork>
+ 365:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <exit>:
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+ 376:	e8 55 ff ff ff       	call   2d0 <fflushall>
+  _exit();
+ 37b:	e8 01 04 00 00       	call   781 <_exit>
+
+00000380 <exec>:
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	57                   	push   %edi
+ 384:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 385:	31 f6                	xor    %esi,%esi
+{
+ 387:	53                   	push   %ebx
+ 388:	bb 68 14 00 00       	mov    $0x1468,%ebx
+ 38d:	83 ec 1c             	sub    $0x1c,%esp
+ 390:	8b 45 08             	mov    0x8(%ebp),%eax
+ 393:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 396:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 399:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 3a0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 3a3:	85 c0                	test   %eax,%eax
+ 3a5:	7e 15                	jle    3bc <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 3a7:	83 ec 04             	sub    $0x4,%esp
+ 3aa:	50                   	push   %eax
+ 3ab:	53                   	push   %ebx
+ 3ac:	56                   	push   %esi
+ 3ad:	e8 eb 03 00 00       	call   79d <write>
+    ob[fd].n = 0;
+ 3b2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 3b9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 3bc:	83 c6 01             	add    $0x1,%esi
+ 3bf:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 3c5:	83 fe 10             	cmp    $0x10,%esi
+ 3c8:	75 d6                	jne    3a0 <exec+0x20>
+  return _exec(path, argv);
+ 3ca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 3cd:	89 7d 0c             	mov    %edi,0xc(%ebp)
+ 3d0:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ 3d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3d6:	5b                   	pop    %ebx
+ 3d7:	5e                   	pop    %esi
+ 3d8:	5f                   	pop    %edi
+ 3d9:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 3da:	e9 d3 03 00 00       	jmp    7b2 <_exec>
+ 3df:	90                   	nop
+
+000003e0 <close>:
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	56                   	push   %esi
+ 3e4:	53                   	push   %ebx
+ 3e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 3e8:	83 fb 0f             	cmp    $0xf,%ebx
+ 3eb:	77 26                	ja     413 <close+0x33>
+ 3ed:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 3f3:	8b 90 64 14 00 00    	mov    0x1464(%eax),%edx
+ 3f9:	8d b0 60 14 00 00    	lea    0x1460(%eax),%esi
+ 3ff:	85 d2                	test   %edx,%edx
+ 401:	7f 25                	jg     428 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+ 403:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 409:	c7 80 60 14 00 00 00 	movl   $0x0,0x1460(%eax)
+ 410:	00 00 00 
+  return _close(fd);
+ 413:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 416:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 419:	5b                   	pop    %ebx
+ 41a:	5e                   	pop    %esi
+ 41b:	5d                   	pop    %ebp
+  return _close(fd);
+ 41c:	e9 83 03 00 00       	jmp    7a4 <_close>
+ 421:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 428:	83 ec 04             	sub    $0x4,%esp
+ 42b:	05 68 14 00 00       	add    $0x1468,%eax
+ 430:	52                   	push   %edx
+ 431:	50                   	push   %eax
+ 432:	53                   	push   %ebx
+ 433:	e8 65 03 00 00       	call   79d <write>
+    ob[fd].n = 0;
+ 438:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+ 43f:	83 c4 10             	add    $0x10,%esp
+ 442:	eb bf                	jmp    403 <close+0x23>
+ 444:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 44f:	90                   	nop
+
+00000450 <strcpy>:
+{
+ 450:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+ 451:	31 c0                	xor    %eax,%eax
+{
+ 453:	89 e5                	mov    %esp,%ebp
+ 455:	53                   	push   %ebx
+ 456:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 459:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 45c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 460:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 464:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 467:	83 c0 01             	add    $0x1,%eax
+ 46a:	84 d2                	test   %dl,%dl
+ 46c:	75 f2                	jne    460 <strcpy+0x10>
+}
+ 46e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 471:	89 c8                	mov    %ecx,%eax
+ 473:	c9                   	leave
+ 474:	c3                   	ret
+ 475:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <strcmp>:
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	53                   	push   %ebx
+ 484:	8b 55 08             	mov    0x8(%ebp),%edx
+ 487:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 48a:	0f b6 02             	movzbl (%edx),%eax
+ 48d:	84 c0                	test   %al,%al
+ 48f:	75 17                	jne    4a8 <strcmp+0x28>
+ 491:	eb 3a                	jmp    4cd <strcmp+0x4d>
+ 493:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 497:	90                   	nop
+ 498:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 49c:	83 c2 01             	add    $0x1,%edx
+ 49f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 4a2:	84 c0                	test   %al,%al
+ 4a4:	74 1a                	je     4c0 <strcmp+0x40>
+    p++, q++;
+ 4a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 4a8:	0f b6 19             	movzbl (%ecx),%ebx
+ 4ab:	38 c3                	cmp    %al,%bl
+ 4ad:	74 e9                	je     498 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 4af:	29 d8                	sub    %ebx,%eax
+}
+ 4b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4b4:	c9                   	leave
+ 4b5:	c3                   	ret
+ 4b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 4c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 4c4:	31 c0                	xor    %eax,%eax
+ 4c6:	29 d8                	sub    %ebx,%eax
+}
+ 4c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4cb:	c9                   	leave
+ 4cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 4cd:	0f b6 19             	movzbl (%ecx),%ebx
+ 4d0:	31 c0                	xor    %eax,%eax
+ 4d2:	eb db                	jmp    4af <strcmp+0x2f>
+ 4d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4df:	90                   	nop
+
+000004e0 <strlen>:
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+ 4e6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 4e9:	74 15                	je     500 <strlen+0x20>
+ 4eb:	31 c0                	xor    %eax,%eax
+ 4ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 4f0:	83 c0 01             	add    $0x1,%eax
+ 4f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 4f7:	89 c1                	mov    %eax,%ecx
+ 4f9:	75 f5                	jne    4f0 <strlen+0x10>
+}
+ 4fb:	89 c8                	mov    %ecx,%eax
+ 4fd:	5d                   	pop    %ebp
+ 4fe:	c3                   	ret
+ 4ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 500:	31 c9                	xor    %ecx,%ecx
+}
+ 502:	5d                   	pop    %ebp
+ 503:	89 c8                	mov    %ecx,%eax
+ 505:	c3                   	ret
+ 506:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000510 <memset>:
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	57                   	push   %edi
+ 514:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 517:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 51a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 51d:	89 d7                	mov    %edx,%edi
+ 51f:	fc                   	cld
+ 520:	f3 aa                	rep stos %al,%es:(%edi)
+}
+ 522:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 525:	89 d0                	mov    %edx,%eax
+ 527:	c9                   	leave
+ 528:	c3                   	ret
+ 529:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000530 <strchr>:
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	8b 45 08             	mov    0x8(%ebp),%eax
+ 536:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 53a:	0f b6 10             	movzbl (%eax),%edx
+ 53d:	84 d2                	test   %dl,%dl
+ 53f:	75 12                	jne    553 <strchr+0x23>
+ 541:	eb 1d                	jmp    560 <strchr+0x30>
+ 543:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 547:	90                   	nop
+ 548:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 54c:	83 c0 01             	add    $0x1,%eax
+ 54f:	84 d2                	test   %dl,%dl
+ 551:	74 0d                	je     560 <strchr+0x30>
+    if(*s == c)
+ 553:	38 d1                	cmp    %dl,%cl
+ 555:	75 f1                	jne    548 <strchr+0x18>
+}
+ 557:	5d                   	pop    %ebp
+ 558:	c3                   	ret
+ 559:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 560:	31 c0                	xor    %eax,%eax
+}
+ 562:	5d                   	pop    %ebp
+ 563:	c3                   	ret
+ 564:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 56f:	90                   	nop
+
+00000570 <memchr>:
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	8b 55 10             	mov    0x10(%ebp),%edx
+ 576:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 579:	85 d2                	test   %edx,%edx
+ 57b:	74 1b                	je     598 <memchr+0x28>
+    if(*p == (char)c)
+ 57d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+ 581:	01 c2                	add    %eax,%edx
+ 583:	eb 0a                	jmp    58f <memchr+0x1f>
+ 585:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+ 588:	83 c0 01             	add    $0x1,%eax
+ 58b:	39 c2                	cmp    %eax,%edx
+ 58d:	74 09                	je     598 <memchr+0x28>
+    if(*p == (char)c)
+ 58f:	38 08                	cmp    %cl,(%eax)
+ 591:	75 f5                	jne    588 <memchr+0x18>
+}
+ 593:	5d                   	pop    %ebp
+ 594:	c3                   	ret
+ 595:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+ 598:	31 c0                	xor    %eax,%eax
+}
+ 59a:	5d                   	pop    %ebp
+ 59b:	c3                   	ret
+ 59c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005a0 <gets>:
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+ 5a3:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+ 5a4:	31 ff                	xor    %edi,%edi
+{
+ 5a6:	56                   	push   %esi
+ 5a7:	be 68 14 00 00       	mov    $0x1468,%esi
+ 5ac:	53                   	push   %ebx
+ 5ad:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 5b0:	8b 46 fc             	mov    -0x4(%esi),%eax
+ 5b3:	85 c0                	test   %eax,%eax
+ 5b5:	7e 15                	jle    5cc <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 5b7:	83 ec 04             	sub    $0x4,%esp
+ 5ba:	50                   	push   %eax
+ 5bb:	56                   	push   %esi
+ 5bc:	57                   	push   %edi
+ 5bd:	e8 db 01 00 00       	call   79d <write>
+    ob[fd].n = 0;
+ 5c2:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+ 5c9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 5cc:	83 c7 01             	add    $0x1,%edi
+ 5cf:	81 c6 08 01 00 00    	add    $0x108,%esi
+ 5d5:	83 ff 10             	cmp    $0x10,%edi
+ 5d8:	75 d6                	jne    5b0 <gets+0x10>
+  for(i=0; i+1 < max; ){
+ 5da:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+ 5dc:	8d 75 e7             	lea    -0x19(%ebp),%esi
+ 5df:	eb 2e                	jmp    60f <gets+0x6f>
+ 5e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5e8:	83 ec 04             	sub    $0x4,%esp
+ 5eb:	6a 01                	push   $0x1
+ 5ed:	56                   	push   %esi
+ 5ee:	6a 00                	push   $0x0
+ 5f0:	e8 a1 01 00 00       	call   796 <read>
+    if(cc < 1)
+ 5f5:	83 c4 10             	add    $0x10,%esp
+ 5f8:	85 c0                	test   %eax,%eax
+ 5fa:	7e 1d                	jle    619 <gets+0x79>
+    buf[i++] = c;
+ 5fc:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 600:	8b 55 08             	mov    0x8(%ebp),%edx
+ 603:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 607:	3c 0a                	cmp    $0xa,%al
+ 609:	74 10                	je     61b <gets+0x7b>
+ 60b:	3c 0d                	cmp    $0xd,%al
+ 60d:	74 0c                	je     61b <gets+0x7b>
+  for(i=0; i+1 < max; ){
+ 60f:	89 df                	mov    %ebx,%edi
+ 611:	83 c3 01             	add    $0x1,%ebx
+ 614:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 617:	7c cf                	jl     5e8 <gets+0x48>
+ 619:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 61b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 61e:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 622:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 625:	5b                   	pop    %ebx
+ 626:	5e                   	pop    %esi
+ 627:	5f                   	pop    %edi
+ 628:	5d                   	pop    %ebp
+ 629:	c3                   	ret
+ 62a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000630 <stat>:
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	57                   	push   %edi
+ 634:	56                   	push   %esi
+ 635:	53                   	push   %ebx
+ 636:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+ 639:	6a 00                	push   $0x0
+ 63b:	ff 75 08             	push   0x8(%ebp)
+ 63e:	e8 76 01 00 00       	call   7b9 <open>
+  if(fd < 0)
+ 643:	83 c4 10             	add    $0x10,%esp
+ 646:	85 c0                	test   %eax,%eax
+ 648:	78 76                	js     6c0 <stat+0x90>
+  r = fstat(fd, st);
+ 64a:	83 ec 08             	sub    $0x8,%esp
+ 64d:	ff 75 0c             	push   0xc(%ebp)
+ 650:	89 c3                	mov    %eax,%ebx
+ 652:	50                   	push   %eax
+ 653:	e8 7f 01 00 00       	call   7d7 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 658:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 65b:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 65d:	83 fb 0f             	cmp    $0xf,%ebx
+ 660:	7f 40                	jg     6a2 <stat+0x72>
+ 662:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 668:	8b 90 64 14 00 00    	mov    0x1464(%eax),%edx
+ 66e:	8d b8 60 14 00 00    	lea    0x1460(%eax),%edi
+ 674:	85 d2                	test   %edx,%edx
+ 676:	7e 1a                	jle    692 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 678:	83 ec 04             	sub    $0x4,%esp
+ 67b:	05 68 14 00 00       	add    $0x1468,%eax
+ 680:	52                   	push   %edx
+ 681:	50                   	push   %eax
+ 682:	53                   	push   %ebx
+ 683:	e8 15 01 00 00       	call   79d <write>
+    ob[fd].n = 0;
+ 688:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+ 68f:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+ 692:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 698:	c7 80 60 14 00 00 00 	movl   $0x0,0x1460(%eax)
+ 69f:	00 00 00 
+  return _close(fd);
+ 6a2:	83 ec 0c             	sub    $0xc,%esp
+ 6a5:	53                   	push   %ebx
+ 6a6:	e8 f9 00 00 00       	call   7a4 <_close>
+ 6ab:	83 c4 10             	add    $0x10,%esp
+}
+ 6ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6b1:	89 f0                	mov    %esi,%eax
+ 6b3:	5b                   	pop    %ebx
+ 6b4:	5e                   	pop    %esi
+ 6b5:	5f                   	pop    %edi
+ 6b6:	5d                   	pop    %ebp
+ 6b7:	c3                   	ret
+ 6b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6bf:	90                   	nop
+    return -1;
+ 6c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 6c5:	eb e7                	jmp    6ae <stat+0x7e>
+ 6c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ce:	66 90                	xchg   %ax,%ax
+
+000006d0 <atoi>:
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	53                   	push   %ebx
+ 6d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 6d7:	0f be 02             	movsbl (%edx),%eax
+ 6da:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 6dd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 6e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 6e5:	77 1e                	ja     705 <atoi+0x35>
+ 6e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 6f0:	83 c2 01             	add    $0x1,%edx
+ 6f3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 6f6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 6fa:	0f be 02             	movsbl (%edx),%eax
+ 6fd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 700:	80 fb 09             	cmp    $0x9,%bl
+ 703:	76 eb                	jbe    6f0 <atoi+0x20>
+}
+ 705:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 708:	89 c8                	mov    %ecx,%eax
+ 70a:	c9                   	leave
+ 70b:	c3                   	ret
+ 70c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000710 <memmove>:
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	57                   	push   %edi
+ 714:	56                   	push   %esi
+ 715:	8b 45 10             	mov    0x10(%ebp),%eax
+ 718:	8b 55 08             	mov    0x8(%ebp),%edx
+ 71b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 71e:	85 c0                	test   %eax,%eax
+ 720:	7e 13                	jle    735 <memmove+0x25>
+ 722:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 724:	89 d7                	mov    %edx,%edi
+ 726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 72d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 730:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 731:	39 f8                	cmp    %edi,%eax
+ 733:	75 fb                	jne    730 <memmove+0x20>
+  return vdst;
+}
+ 735:	5e                   	pop    %esi
+ 736:	89 d0                	mov    %edx,%eax
+ 738:	5f                   	pop    %edi
+ 739:	5d                   	pop    %ebp
+ 73a:	c3                   	ret
+
+0000073b <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+ 73b:	83 3d 58 14 00 00 00 	cmpl   $0x0,0x1458
+  jle 1f
+ 742:	7e 0a                	jle    74e <syscallentry+0x13>
+  movl %esp, %ecx
+ 744:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 746:	ba 4d 07 00 00       	mov    $0x74d,%edx
+  sysenter
+ 74b:	0f 34                	sysenter
+2:
+  ret
+ 74d:	c3                   	ret
+1:
+  jl 3f
+ 74e:	7c 27                	jl     777 <syscallentry+0x3c>
+  pushal
+ 750:	60                   	pusha
+  movl $1, %eax
+ 751:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 756:	0f a2                	cpuid
+  movl $-1, sysentermode
+ 758:	c7 05 58 14 00 00 ff 	movl   $0xffffffff,0x1458
+ 75f:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 762:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+ 768:	74 0a                	je     774 <syscallentry+0x39>
+  movl $1, sysentermode
+ 76a:	c7 05 58 14 00 00 01 	movl   $0x1,0x1458
+ 771:	00 00 00 
+4:
+  popal
+ 774:	61                   	popa
+  jmp syscallentry
+ 775:	eb c4                	jmp    73b <syscallentry>
+3:
+  int $T_SYSCALL
+ 777:	cd 40                	int    $0x40
+  ret
+ 779:	c3                   	ret
+
+0000077a <_fork>:
+
+SYSCALLAS(_fork, fork)
+ 77a:	b8 01 00 00 00       	mov    $0x1,%eax
+ 77f:	eb ba                	jmp    73b <syscallentry>
+
+00000781 <_exit>:
+SYSCALLAS(_exit, exit)
+ 781:	b8 02 00 00 00       	mov    $0x2,%eax
+ 786:	eb b3                	jmp    73b <syscallentry>
+
+00000788 <wait>:
+SYSCALL(wait)
+ 788:	b8 03 00 00 00       	mov    $0x3,%eax
+ 78d:	eb ac                	jmp    73b <syscallentry>
+
+0000078f <pipe>:
+SYSCALL(pipe)
+ 78f:	b8 04 00 00 00       	mov    $0x4,%eax
+ 794:	eb a5                	jmp    73b <syscallentry>
+
+00000796 <read>:
+SYSCALL(read)
+ 796:	b8 05 00 00 00       	mov    $0x5,%eax
+ 79b:	eb 9e                	jmp    73b <syscallentry>
+
+0000079d <write>:
+SYSCALL(write)
+ 79d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 7a2:	eb 97                	jmp    73b <syscallentry>
+
+000007a4 <_close>:
+SYSCALLAS(_close, close)
+ 7a4:	b8 15 00 00 00       	mov    $0x15,%eax
+ 7a9:	eb 90                	jmp    73b <syscallentry>
+
+000007ab <kill>:
+SYSCALL(kill)
+ 7ab:	b8 06 00 00 00       	mov    $0x6,%eax
+ 7b0:	eb 89                	jmp    73b <syscallentry>
+
+000007b2 <_exec>:
+SYSCALLAS(_exec, exec)
+ 7b2:	b8 07 00 00 00       	mov    $0x7,%eax
+ 7b7:	eb 82                	jmp    73b <syscallentry>
+
+000007b9 <open>:
+SYSCALL(open)
+ 7b9:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 7be:	e9 78 ff ff ff       	jmp    73b <syscallentry>
+
+000007c3 <mknod>:
+SYSCALL(mknod)
+ 7c3:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7c8:	e9 6e ff ff ff       	jmp    73b <syscallentry>
+
+000007cd <unlink>:
+SYSCALL(unlink)
+ 7cd:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7d2:	e9 64 ff ff ff       	jmp    73b <syscallentry>
+
+000007d7 <fstat>:
+SYSCALL(fstat)
+ 7d7:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7dc:	e9 5a ff ff ff       	jmp    73b <syscallentry>
+
+000007e1 <link>:
+SYSCALL(link)
+ 7e1:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7e6:	e9 50 ff ff ff       	jmp    73b <syscallentry>
+
+000007eb <mkdir>:
+SYSCALL(mkdir)
+ 7eb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7f0:	e9 46 ff ff ff       	jmp    73b <syscallentry>
+
+000007f5 <chdir>:
+SYSCALL(chdir)
+ 7f5:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7fa:	e9 3c ff ff ff       	jmp    73b <syscallentry>
+
+000007ff <dup>:
+SYSCALL(dup)
+ 7ff:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 804:	e9 32 ff ff ff       	jmp    73b <syscallentry>
+
+00000809 <getpid>:
+SYSCALL(getpid)
+ 809:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 80e:	e9 28 ff ff ff       	jmp    73b <syscallentry>
+
+00000813 <sbrk>:
+SYSCALL(sbrk)
+ 813:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 818:	e9 1e ff ff ff       	jmp    73b <syscallentry>
+
+0000081d <sleep>:
+SYSCALL(sleep)
+ 81d:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 822:	e9 14 ff ff ff       	jmp    73b <syscallentry>
+
+00000827 <uptime>:
+SYSCALL(uptime)
+ 827:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 82c:	e9 0a ff ff ff       	jmp    73b <syscallentry>
+
+00000831 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+ 831:	b8 16 00 00 00       	mov    $0x16,%eax
+ 836:	e9 00 ff ff ff       	jmp    73b <syscallentry>
+
+0000083b <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+ 83b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 840:	e9 f6 fe ff ff       	jmp    73b <syscallentry>
+
+00000845 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+ 845:	b8 18 00 00 00       	mov    $0x18,%eax
+ 84a:	e9 ec fe ff ff       	jmp    73b <syscallentry>
+
+0000084f <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+ 84f:	b8 19 00 00 00       	mov    $0x19,%eax
+ 854:	e9 e2 fe ff ff       	jmp    73b <syscallentry>
+
+00000859 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+ 859:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 85e:	e9 d8 fe ff ff       	jmp    73b <syscallentry>
+
+00000863 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+ 863:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 868:	e9 ce fe ff ff       	jmp    73b <syscallentry>
+
+0000086d <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+ 86d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 872:	e9 c4 fe ff ff       	jmp    73b <syscallentry>
+
+00000877 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+ 877:	b8 20 00 00 00       	mov    $0x20,%eax
+ 87c:	e9 ba fe ff ff       	jmp    73b <syscallentry>
+
+00000881 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+ 881:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 886:	e9 b0 fe ff ff       	jmp    73b <syscallentry>
+
+0000088b <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+ 88b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 890:	e9 a6 fe ff ff       	jmp    73b <syscallentry>
+
+00000895 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+ 895:	b8 21 00 00 00       	mov    $0x21,%eax
+ 89a:	e9 9c fe ff ff       	jmp    73b <syscallentry>
+
+0000089f <yield>:
+SYSCALL(yield) // yield the CPU to another process
+ 89f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 8a4:	e9 92 fe ff ff       	jmp    73b <syscallentry>
+
+000008a9 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+ 8a9:	b8 23 00 00 00       	mov    $0x23,%eax
+ 8ae:	e9 88 fe ff ff       	jmp    73b <syscallentry>
+
+000008b3 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+ 8b3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 8b8:	e9 7e fe ff ff       	jmp    73b <syscallentry>
+
+000008bd <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+ 8bd:	b8 25 00 00 00       	mov    $0x25,%eax
+ 8c2:	e9 74 fe ff ff       	jmp    73b <syscallentry>
+
+000008c7 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+ 8c7:	b8 26 00 00 00       	mov    $0x26,%eax
+ 8cc:	e9 6a fe ff ff       	jmp    73b <syscallentry>
+
+000008d1 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+ 8d1:	b8 27 00 00 00       	mov    $0x27,%eax
+ 8d6:	e9 60 fe ff ff       	jmp    73b <syscallentry>
+
+000008db <mmap>:
+SYSCALL(mmap) // map a file into memory
+ 8db:	b8 28 00 00 00       	mov    $0x28,%eax
+ 8e0:	e9 56 fe ff ff       	jmp    73b <syscallentry>
+
+000008e5 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+ 8e5:	b8 29 00 00 00       	mov    $0x29,%eax
+ 8ea:	e9 4c fe ff ff       	jmp    73b <syscallentry>
+
+000008ef <readv>:
+SYSCALL(readv) // read into several buffers
+ 8ef:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 8f4:	e9 42 fe ff ff       	jmp    73b <syscallentry>
+
+000008f9 <writev>:
+SYSCALL(writev) // write from several buffers
+ 8f9:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 8fe:	e9 38 fe ff ff       	jmp    73b <syscallentry>
+
+00000903 <pread>:
+SYSCALL(pread) // read at an offset
+ 903:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 908:	e9 2e fe ff ff       	jmp    73b <syscallentry>
+
+0000090d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+ 90d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 912:	e9 24 fe ff ff       	jmp    73b <syscallentry>
+
+00000917 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+ 917:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 91c:	e9 1a fe ff ff       	jmp    73b <syscallentry>
+
+00000921 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+ 921:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 926:	e9 10 fe ff ff       	jmp    73b <syscallentry>
+
+0000092b <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+ 92b:	b8 30 00 00 00       	mov    $0x30,%eax
+ 930:	e9 06 fe ff ff       	jmp    73b <syscallentry>
+
+00000935 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+ 935:	b8 31 00 00 00       	mov    $0x31,%eax
+ 93a:	e9 fc fd ff ff       	jmp    73b <syscallentry>
+
+0000093f <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+ 93f:	b8 32 00 00 00       	mov    $0x32,%eax
+ 944:	e9 f2 fd ff ff       	jmp    73b <syscallentry>
+
+00000949 <profread>:
+SYSCALL(profread) // drain profiler samples
+ 949:	b8 33 00 00 00       	mov    $0x33,%eax
+ 94e:	e9 e8 fd ff ff       	jmp    73b <syscallentry>
+
+00000953 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+ 953:	b8 34 00 00 00       	mov    $0x34,%eax
+ 958:	e9 de fd ff ff       	jmp    73b <syscallentry>
+
+0000095d <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+ 95d:	b8 35 00 00 00       	mov    $0x35,%eax
+ 962:	e9 d4 fd ff ff       	jmp    73b <syscallentry>
+
+00000967 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+ 967:	b8 36 00 00 00       	mov    $0x36,%eax
+ 96c:	e9 ca fd ff ff       	jmp    73b <syscallentry>
+
+00000971 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+ 971:	b8 37 00 00 00       	mov    $0x37,%eax
+ 976:	e9 c0 fd ff ff       	jmp    73b <syscallentry>
+ 97b:	66 90                	xchg   %ax,%ax
+ 97d:	66 90                	xchg   %ax,%ax
+ 97f:	90                   	nop
+
+00000980 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 980:	55                   	push   %ebp
+ 981:	89 e5                	mov    %esp,%ebp
+ 983:	57                   	push   %edi
+ 984:	56                   	push   %esi
+ 985:	53                   	push   %ebx
+ 986:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 988:	89 d1                	mov    %edx,%ecx
+{
+ 98a:	83 ec 3c             	sub    $0x3c,%esp
+ 98d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 990:	85 d2                	test   %edx,%edx
+ 992:	0f 89 80 00 00 00    	jns    a18 <printint+0x98>
+ 998:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 99c:	74 7a                	je     a18 <printint+0x98>
+    x = -xx;
+ 99e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 9a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 9a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 9a8:	31 f6                	xor    %esi,%esi
+ 9aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 9b0:	89 c8                	mov    %ecx,%eax
+ 9b2:	31 d2                	xor    %edx,%edx
+ 9b4:	89 f7                	mov    %esi,%edi
+ 9b6:	f7 f3                	div    %ebx
+ 9b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 9bb:	0f b6 92 d4 0f 00 00 	movzbl 0xfd4(%edx),%edx
+ 9c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 9c6:	89 ca                	mov    %ecx,%edx
+ 9c8:	89 c1                	mov    %eax,%ecx
+ 9ca:	39 da                	cmp    %ebx,%edx
+ 9cc:	73 e2                	jae    9b0 <printint+0x30>
+  if(neg)
+ 9ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 9d1:	85 c0                	test   %eax,%eax
+ 9d3:	74 07                	je     9dc <printint+0x5c>
+    buf[i++] = '-';
+ 9d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 9da:	89 f7                	mov    %esi,%edi
+ 9dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 9df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 9e2:	01 df                	add    %ebx,%edi
+ 9e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 9e8:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+ 9eb:	83 ec 04             	sub    $0x4,%esp
+ 9ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 9f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 9f4:	6a 01                	push   $0x1
+ 9f6:	50                   	push   %eax
+ 9f7:	56                   	push   %esi
+ 9f8:	e8 e3 f6 ff ff       	call   e0 <bufwrite>
+  while(--i >= 0)
+ 9fd:	89 f8                	mov    %edi,%eax
+ 9ff:	83 c4 10             	add    $0x10,%esp
+ a02:	83 ef 01             	sub    $0x1,%edi
+ a05:	39 d8                	cmp    %ebx,%eax
+ a07:	75 df                	jne    9e8 <printint+0x68>
+}
+ a09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a0c:	5b                   	pop    %ebx
+ a0d:	5e                   	pop    %esi
+ a0e:	5f                   	pop    %edi
+ a0f:	5d                   	pop    %ebp
+ a10:	c3                   	ret
+ a11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ a18:	31 c0                	xor    %eax,%eax
+ a1a:	eb 89                	jmp    9a5 <printint+0x25>
+ a1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a20 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ a20:	55                   	push   %ebp
+ a21:	89 e5                	mov    %esp,%ebp
+ a23:	57                   	push   %edi
+ a24:	56                   	push   %esi
+ a25:	53                   	push   %ebx
+ a26:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ a29:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a2c:	0f b6 18             	movzbl (%eax),%ebx
+ a2f:	84 db                	test   %bl,%bl
+ a31:	74 6c                	je     a9f <printf+0x7f>
+ a33:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+ a36:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ a39:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ a3b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ a3e:	eb 26                	jmp    a66 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ a40:	83 f8 25             	cmp    $0x25,%eax
+ a43:	74 4b                	je     a90 <printf+0x70>
+  bufwrite(fd, &c, 1);
+ a45:	83 ec 04             	sub    $0x4,%esp
+ a48:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ a4b:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ a4e:	6a 01                	push   $0x1
+ a50:	50                   	push   %eax
+ a51:	ff 75 08             	push   0x8(%ebp)
+ a54:	e8 87 f6 ff ff       	call   e0 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+ a59:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ a5c:	0f b6 1f             	movzbl (%edi),%ebx
+ a5f:	83 c7 01             	add    $0x1,%edi
+ a62:	84 db                	test   %bl,%bl
+ a64:	74 39                	je     a9f <printf+0x7f>
+    c = fmt[i] & 0xff;
+ a66:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ a69:	85 f6                	test   %esi,%esi
+ a6b:	74 d3                	je     a40 <printf+0x20>
+      }
+    } else if(state == '%'){
+ a6d:	83 fe 25             	cmp    $0x25,%esi
+ a70:	75 ea                	jne    a5c <printf+0x3c>
+      if(c == 'd'){
+ a72:	83 f8 25             	cmp    $0x25,%eax
+ a75:	0f 84 d5 01 00 00    	je     c50 <printf+0x230>
+ a7b:	83 e8 63             	sub    $0x63,%eax
+ a7e:	83 f8 15             	cmp    $0x15,%eax
+ a81:	77 45                	ja     ac8 <printf+0xa8>
+ a83:	ff 24 85 7c 0f 00 00 	jmp    *0xf7c(,%eax,4)
+ a8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+ a90:	0f b6 1f             	movzbl (%edi),%ebx
+ a93:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+ a96:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ a9b:	84 db                	test   %bl,%bl
+ a9d:	75 c7                	jne    a66 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+ a9f:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+ aa3:	74 0b                	je     ab0 <printf+0x90>
+    fflush(fd);
+}
+ aa5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ aa8:	5b                   	pop    %ebx
+ aa9:	5e                   	pop    %esi
+ aaa:	5f                   	pop    %edi
+ aab:	5d                   	pop    %ebp
+ aac:	c3                   	ret
+ aad:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+ ab0:	83 ec 0c             	sub    $0xc,%esp
+ ab3:	6a 02                	push   $0x2
+ ab5:	e8 c6 f7 ff ff       	call   280 <fflush>
+ aba:	83 c4 10             	add    $0x10,%esp
+}
+ abd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ac0:	5b                   	pop    %ebx
+ ac1:	5e                   	pop    %esi
+ ac2:	5f                   	pop    %edi
+ ac3:	5d                   	pop    %ebp
+ ac4:	c3                   	ret
+ ac5:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+ ac8:	83 ec 04             	sub    $0x4,%esp
+ acb:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ ace:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+ ad2:	6a 01                	push   $0x1
+ ad4:	52                   	push   %edx
+ ad5:	89 55 c0             	mov    %edx,-0x40(%ebp)
+ ad8:	ff 75 08             	push   0x8(%ebp)
+ adb:	e8 00 f6 ff ff       	call   e0 <bufwrite>
+ ae0:	83 c4 0c             	add    $0xc,%esp
+ ae3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ ae6:	6a 01                	push   $0x1
+ ae8:	8b 55 c0             	mov    -0x40(%ebp),%edx
+ aeb:	52                   	push   %edx
+      state = 0;
+ aec:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+ aee:	ff 75 08             	push   0x8(%ebp)
+ af1:	e8 ea f5 ff ff       	call   e0 <bufwrite>
+        putc(fd, c);
+ af6:	83 c4 10             	add    $0x10,%esp
+ af9:	e9 5e ff ff ff       	jmp    a5c <printf+0x3c>
+ afe:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+ b00:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ b03:	83 ec 0c             	sub    $0xc,%esp
+ b06:	b9 10 00 00 00       	mov    $0x10,%ecx
+ b0b:	8b 16                	mov    (%esi),%edx
+ b0d:	6a 00                	push   $0x0
+ b0f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+ b12:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+ b15:	e8 66 fe ff ff       	call   980 <printint>
+        ap++;
+ b1a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ b1d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b20:	31 f6                	xor    %esi,%esi
+ b22:	e9 35 ff ff ff       	jmp    a5c <printf+0x3c>
+ b27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b2e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+ b30:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ b33:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ b35:	83 c0 04             	add    $0x4,%eax
+ b38:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+ b3b:	b8 73 0f 00 00       	mov    $0xf73,%eax
+ b40:	85 db                	test   %ebx,%ebx
+ b42:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+ b45:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+ b48:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+ b4a:	53                   	push   %ebx
+ b4b:	e8 90 f9 ff ff       	call   4e0 <strlen>
+ b50:	83 c4 0c             	add    $0xc,%esp
+ b53:	50                   	push   %eax
+ b54:	53                   	push   %ebx
+ b55:	ff 75 08             	push   0x8(%ebp)
+ b58:	e8 83 f5 ff ff       	call   e0 <bufwrite>
+ b5d:	83 c4 10             	add    $0x10,%esp
+ b60:	e9 f7 fe ff ff       	jmp    a5c <printf+0x3c>
+ b65:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ b68:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+ b6b:	83 ec 04             	sub    $0x4,%esp
+ b6e:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+ b71:	8b 06                	mov    (%esi),%eax
+        ap++;
+ b73:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+ b76:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+ b79:	6a 01                	push   $0x1
+ b7b:	52                   	push   %edx
+ b7c:	ff 75 08             	push   0x8(%ebp)
+ b7f:	e8 5c f5 ff ff       	call   e0 <bufwrite>
+        ap++;
+ b84:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ b87:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b8a:	31 f6                	xor    %esi,%esi
+ b8c:	e9 cb fe ff ff       	jmp    a5c <printf+0x3c>
+ b91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+ b98:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ b9b:	83 ec 0c             	sub    $0xc,%esp
+ b9e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ ba3:	8b 16                	mov    (%esi),%edx
+ ba5:	6a 01                	push   $0x1
+ ba7:	e9 63 ff ff ff       	jmp    b0f <printf+0xef>
+ bac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+ bb0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ bb3:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ bb6:	89 7d c0             	mov    %edi,-0x40(%ebp)
+ bb9:	89 55 bc             	mov    %edx,-0x44(%ebp)
+ bbc:	8b 18                	mov    (%eax),%ebx
+ bbe:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+ bc1:	31 c0                	xor    %eax,%eax
+ bc3:	89 c7                	mov    %eax,%edi
+ bc5:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+ bc8:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+ bcd:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+ bcf:	f7 e1                	mul    %ecx
+ bd1:	c1 ea 03             	shr    $0x3,%edx
+ bd4:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ bd7:	89 d1                	mov    %edx,%ecx
+ bd9:	01 c0                	add    %eax,%eax
+ bdb:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ bdd:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+ bdf:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ be1:	be 0a 00 00 00       	mov    $0xa,%esi
+ be6:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+ be8:	89 da                	mov    %ebx,%edx
+ bea:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+ bec:	89 fe                	mov    %edi,%esi
+ bee:	83 c7 01             	add    $0x1,%edi
+ bf1:	8d 42 30             	lea    0x30(%edx),%eax
+ bf4:	89 da                	mov    %ebx,%edx
+ bf6:	8d 14 92             	lea    (%edx,%edx,4),%edx
+ bf9:	01 d2                	add    %edx,%edx
+ bfb:	29 d0                	sub    %edx,%eax
+ bfd:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+ c01:	89 c8                	mov    %ecx,%eax
+ c03:	09 d8                	or     %ebx,%eax
+ c05:	75 c1                	jne    bc8 <printf+0x1a8>
+ c07:	8b 55 bc             	mov    -0x44(%ebp),%edx
+ c0a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ c0d:	01 d6                	add    %edx,%esi
+ c0f:	89 f7                	mov    %esi,%edi
+ c11:	89 d6                	mov    %edx,%esi
+ c13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c17:	90                   	nop
+    putc(fd, buf[i]);
+ c18:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+ c1b:	83 ec 04             	sub    $0x4,%esp
+ c1e:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+ c21:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+ c24:	6a 01                	push   $0x1
+ c26:	50                   	push   %eax
+ c27:	53                   	push   %ebx
+ c28:	e8 b3 f4 ff ff       	call   e0 <bufwrite>
+  while(--i >= 0)
+ c2d:	89 fa                	mov    %edi,%edx
+ c2f:	83 c4 10             	add    $0x10,%esp
+ c32:	83 ef 01             	sub    $0x1,%edi
+ c35:	39 d6                	cmp    %edx,%esi
+ c37:	75 df                	jne    c18 <printf+0x1f8>
+        ap += 2;
+ c39:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+ c3d:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+ c40:	31 f6                	xor    %esi,%esi
+ c42:	e9 15 fe ff ff       	jmp    a5c <printf+0x3c>
+ c47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c4e:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+ c50:	83 ec 04             	sub    $0x4,%esp
+ c53:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ c56:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ c59:	6a 01                	push   $0x1
+ c5b:	e9 8b fe ff ff       	jmp    aeb <printf+0xcb>
+
+00000c60 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ c60:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c61:	a1 e0 24 00 00       	mov    0x24e0,%eax
+{
+ c66:	89 e5                	mov    %esp,%ebp
+ c68:	57                   	push   %edi
+ c69:	56                   	push   %esi
+ c6a:	53                   	push   %ebx
+ c6b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ c6e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c78:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c7a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c7c:	39 ca                	cmp    %ecx,%edx
+ c7e:	73 30                	jae    cb0 <free+0x50>
+ c80:	39 c1                	cmp    %eax,%ecx
+ c82:	72 04                	jb     c88 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c84:	39 c2                	cmp    %eax,%edx
+ c86:	72 f0                	jb     c78 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ c88:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ c8b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ c8e:	39 f8                	cmp    %edi,%eax
+ c90:	74 2e                	je     cc0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c92:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ c95:	8b 42 04             	mov    0x4(%edx),%eax
+ c98:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c9b:	39 f1                	cmp    %esi,%ecx
+ c9d:	74 38                	je     cd7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ c9f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ ca1:	5b                   	pop    %ebx
+  freep = p;
+ ca2:	89 15 e0 24 00 00    	mov    %edx,0x24e0
+}
+ ca8:	5e                   	pop    %esi
+ ca9:	5f                   	pop    %edi
+ caa:	5d                   	pop    %ebp
+ cab:	c3                   	ret
+ cac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cb0:	39 c1                	cmp    %eax,%ecx
+ cb2:	72 d0                	jb     c84 <free+0x24>
+ cb4:	eb c2                	jmp    c78 <free+0x18>
+ cb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cbd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ cc0:	03 70 04             	add    0x4(%eax),%esi
+ cc3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ cc6:	8b 02                	mov    (%edx),%eax
+ cc8:	8b 00                	mov    (%eax),%eax
+ cca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ ccd:	8b 42 04             	mov    0x4(%edx),%eax
+ cd0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ cd3:	39 f1                	cmp    %esi,%ecx
+ cd5:	75 c8                	jne    c9f <free+0x3f>
+    p->s.size += bp->s.size;
+ cd7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ cda:	89 15 e0 24 00 00    	mov    %edx,0x24e0
+    p->s.size += bp->s.size;
+ ce0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ ce3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ ce6:	89 0a                	mov    %ecx,(%edx)
+}
+ ce8:	5b                   	pop    %ebx
+ ce9:	5e                   	pop    %esi
+ cea:	5f                   	pop    %edi
+ ceb:	5d                   	pop    %ebp
+ cec:	c3                   	ret
+ ced:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000cf0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ cf0:	55                   	push   %ebp
+ cf1:	89 e5                	mov    %esp,%ebp
+ cf3:	57                   	push   %edi
+ cf4:	56                   	push   %esi
+ cf5:	53                   	push   %ebx
+ cf6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ cf9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ cfc:	8b 15 e0 24 00 00    	mov    0x24e0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d02:	8d 78 07             	lea    0x7(%eax),%edi
+ d05:	c1 ef 03             	shr    $0x3,%edi
+ d08:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ d0b:	85 d2                	test   %edx,%edx
+ d0d:	0f 84 8d 00 00 00    	je     da0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d13:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d15:	8b 48 04             	mov    0x4(%eax),%ecx
+ d18:	39 f9                	cmp    %edi,%ecx
+ d1a:	73 64                	jae    d80 <malloc+0x90>
+  if(nu < 4096)
+ d1c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ d21:	39 df                	cmp    %ebx,%edi
+ d23:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ d26:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ d2d:	eb 0a                	jmp    d39 <malloc+0x49>
+ d2f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d30:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d32:	8b 48 04             	mov    0x4(%eax),%ecx
+ d35:	39 f9                	cmp    %edi,%ecx
+ d37:	73 47                	jae    d80 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ d39:	89 c2                	mov    %eax,%edx
+ d3b:	39 05 e0 24 00 00    	cmp    %eax,0x24e0
+ d41:	75 ed                	jne    d30 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ d43:	83 ec 0c             	sub    $0xc,%esp
+ d46:	56                   	push   %esi
+ d47:	e8 c7 fa ff ff       	call   813 <sbrk>
+  if(p == (char*)-1)
+ d4c:	83 c4 10             	add    $0x10,%esp
+ d4f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ d52:	74 1c                	je     d70 <malloc+0x80>
+  hp->s.size = nu;
+ d54:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ d57:	83 ec 0c             	sub    $0xc,%esp
+ d5a:	83 c0 08             	add    $0x8,%eax
+ d5d:	50                   	push   %eax
+ d5e:	e8 fd fe ff ff       	call   c60 <free>
+  return freep;
+ d63:	8b 15 e0 24 00 00    	mov    0x24e0,%edx
+      if((p = morecore(nunits)) == 0)
+ d69:	83 c4 10             	add    $0x10,%esp
+ d6c:	85 d2                	test   %edx,%edx
+ d6e:	75 c0                	jne    d30 <malloc+0x40>
+        return 0;
+  }
+}
+ d70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ d73:	31 c0                	xor    %eax,%eax
+}
+ d75:	5b                   	pop    %ebx
+ d76:	5e                   	pop    %esi
+ d77:	5f                   	pop    %edi
+ d78:	5d                   	pop    %ebp
+ d79:	c3                   	ret
+ d7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ d80:	39 cf                	cmp    %ecx,%edi
+ d82:	74 4c                	je     dd0 <malloc+0xe0>
+        p->s.size -= nunits;
+ d84:	29 f9                	sub    %edi,%ecx
+ d86:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ d89:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ d8c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ d8f:	89 15 e0 24 00 00    	mov    %edx,0x24e0
+}
+ d95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ d98:	83 c0 08             	add    $0x8,%eax
+}
+ d9b:	5b                   	pop    %ebx
+ d9c:	5e                   	pop    %esi
+ d9d:	5f                   	pop    %edi
+ d9e:	5d                   	pop    %ebp
+ d9f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ da0:	c7 05 e0 24 00 00 e4 	movl   $0x24e4,0x24e0
+ da7:	24 00 00 
+    base.s.size = 0;
+ daa:	b8 e4 24 00 00       	mov    $0x24e4,%eax
+    base.s.ptr = freep = prevp = &base;
+ daf:	c7 05 e4 24 00 00 e4 	movl   $0x24e4,0x24e4
+ db6:	24 00 00 
+    base.s.size = 0;
+ db9:	c7 05 e8 24 00 00 00 	movl   $0x0,0x24e8
+ dc0:	00 00 00 
+    if(p->s.size >= nunits){
+ dc3:	e9 54 ff ff ff       	jmp    d1c <malloc+0x2c>
+ dc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dcf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ dd0:	8b 08                	mov    (%eax),%ecx
+ dd2:	89 0a                	mov    %ecx,(%edx)
+ dd4:	eb b9                	jmp    d8f <malloc+0x9f>
+ dd6:	66 90                	xchg   %ax,%ax
+ dd8:	66 90                	xchg   %ax,%ax
+ dda:	66 90                	xchg   %ax,%ax
+ ddc:	66 90                	xchg   %ax,%ax
+ dde:	66 90                	xchg   %ax,%ax
+
+00000de0 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+ de0:	55                   	push   %ebp
+ de1:	89 e5                	mov    %esp,%ebp
+ de3:	57                   	push   %edi
+ de4:	56                   	push   %esi
+ de5:	be 01 00 00 00       	mov    $0x1,%esi
+ dea:	53                   	push   %ebx
+ deb:	83 ec 28             	sub    $0x28,%esp
+ dee:	8b 45 0c             	mov    0xc(%ebp),%eax
+ df1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ df4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+ df7:	68 00 98 00 00       	push   $0x9800
+ dfc:	e8 ef fe ff ff       	call   cf0 <malloc>
+ e01:	83 c4 10             	add    $0x10,%esp
+ e04:	89 c7                	mov    %eax,%edi
+ e06:	85 c0                	test   %eax,%eax
+ e08:	74 62                	je     e6c <waitpoll+0x8c>
+ e0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+ e10:	83 ec 0c             	sub    $0xc,%esp
+ e13:	6a 01                	push   $0x1
+ e15:	e8 03 fa ff ff       	call   81d <sleep>
+    fn();
+ e1a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ e1d:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+ e1f:	58                   	pop    %eax
+ e20:	5a                   	pop    %edx
+ e21:	68 00 02 00 00       	push   $0x200
+ e26:	57                   	push   %edi
+ e27:	e8 eb fa ff ff       	call   917 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+ e2c:	83 c4 10             	add    $0x10,%esp
+ e2f:	85 c0                	test   %eax,%eax
+ e31:	7e 2d                	jle    e60 <waitpoll+0x80>
+ e33:	6b c0 4c             	imul   $0x4c,%eax,%eax
+ e36:	89 fa                	mov    %edi,%edx
+    alive = 0;
+ e38:	31 c9                	xor    %ecx,%ecx
+ e3a:	01 f8                	add    %edi,%eax
+ e3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+ e40:	3b 1a                	cmp    (%edx),%ebx
+ e42:	75 07                	jne    e4b <waitpoll+0x6b>
+        alive = 1;
+ e44:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+ e48:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+ e4b:	83 c2 4c             	add    $0x4c,%edx
+ e4e:	39 d0                	cmp    %edx,%eax
+ e50:	75 ee                	jne    e40 <waitpoll+0x60>
+  } while(alive);
+ e52:	85 c9                	test   %ecx,%ecx
+ e54:	75 ba                	jne    e10 <waitpoll+0x30>
+ e56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e5d:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+ e60:	83 ec 0c             	sub    $0xc,%esp
+ e63:	57                   	push   %edi
+ e64:	e8 f7 fd ff ff       	call   c60 <free>
+  wait();
+ e69:	83 c4 10             	add    $0x10,%esp
+}
+ e6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e6f:	5b                   	pop    %ebx
+ e70:	5e                   	pop    %esi
+ e71:	5f                   	pop    %edi
+ e72:	5d                   	pop    %ebp
+  wait();
+ e73:	e9 10 f9 ff ff       	jmp    788 <wait>
+ e78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e7f:	90                   	nop
+
+00000e80 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+ e80:	55                   	push   %ebp
+ e81:	89 e5                	mov    %esp,%ebp
+ e83:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+ e86:	c7 45 f0 e5 0f 00 00 	movl   $0xfe5,-0x10(%ebp)
+ e8d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+ e94:	e8 87 f4 ff ff       	call   320 <fork>
+ e99:	85 c0                	test   %eax,%eax
+ e9b:	78 09                	js     ea6 <runps+0x26>
+    return -1;
+  if(pid == 0){
+ e9d:	74 0e                	je     ead <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+ e9f:	e8 e4 f8 ff ff       	call   788 <wait>
+}
+ ea4:	c9                   	leave
+ ea5:	c3                   	ret
+ ea6:	c9                   	leave
+    return -1;
+ ea7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ eac:	c3                   	ret
+    exec("ps", argv);
+ ead:	50                   	push   %eax
+ eae:	50                   	push   %eax
+ eaf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ eb2:	50                   	push   %eax
+ eb3:	68 e5 0f 00 00       	push   $0xfe5
+ eb8:	e8 c3 f4 ff ff       	call   380 <exec>
+    printf(2, "exec ps failed\n");
+ ebd:	5a                   	pop    %edx
+ ebe:	59                   	pop    %ecx
+ ebf:	68 e8 0f 00 00       	push   $0xfe8
+ ec4:	6a 02                	push   $0x2
+ ec6:	e8 55 fb ff ff       	call   a20 <printf>
+    exit();
+ ecb:	e8 a0 f4 ff ff       	call   370 <exit>
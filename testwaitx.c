@@ -3,7 +3,7 @@
 #include "user.h"
 
 int main() {
-  int wtime, rtime;
+  uint64 wtime, rtime;
   int pid = fork();
 
   if (pid == 0) {
@@ -16,8 +16,8 @@ int main() {
     printf(1, "Parent waiting for child %d\n", pid);
     int cpid = waitx(&wtime, &rtime);
     printf(1, "Child %d finished with:\n", cpid);
-    printf(1, "- Wait time: %d ticks\n", wtime);
-    printf(1, "- Run time: %d ticks\n", rtime);
+    printf(1, "- Wait time: %l us\n", wtime);
+    printf(1, "- Run time: %l us\n", rtime);
   } else {
     printf(1, "Fork failed\n");
   }
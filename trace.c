@@ -0,0 +1,98 @@
+// Kernel event tracing.
+//
+// Each CPU records events in its own ring, with interrupts
+// off, so trace() takes no lock: only that CPU moves the
+// ring's head. traceread() drains the rings, moving their
+// tails; a spinlock keeps two readers apart. When a ring is
+// full, new events are dropped and counted in lost.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "trace.h"
+
+static struct {
+  struct traceev ev[NTRACE];
+  volatile uint head;     // next slot to fill
+  volatile uint tail;     // next slot to read
+  uint lost;              // events dropped since last read
+} ring[NCPU];
+
+static struct spinlock tracelock;
+int tracing;
+
+void
+traceinit(void)
+{
+  initlock(&tracelock, "trace");
+}
+
+// Record an event on this CPU's ring.
+void
+trace(int type, int pid, int arg)
+{
+  struct traceev *e;
+  int cpu;
+
+  if(!tracing)
+    return;
+  pushcli();
+  cpu = mycpu() - cpus;
+  if(ring[cpu].head - ring[cpu].tail >= NTRACE){
+    ring[cpu].lost++;
+    popcli();
+    return;
+  }
+  e = &ring[cpu].ev[ring[cpu].head % NTRACE];
+  e->tsc = rdtsc();
+  e->type = type;
+  e->cpu = cpu;
+  e->pid = pid;
+  e->arg = arg;
+  __sync_synchronize();
+  ring[cpu].head++;
+  popcli();
+}
+
+// Turn tracing on or off. Returns the TSC rate in kHz,
+// for turning timestamps into time.
+int
+tracectl(int on)
+{
+  tracing = on;
+  return tsckhz;
+}
+
+// Move up to n events into buf, each CPU's in order and
+// followed by a TR_LOST if it dropped any. Returns the number
+// moved.
+int
+traceread(struct traceev *buf, int n)
+{
+  int cpu, i;
+
+  i = 0;
+  acquire(&tracelock);
+  for(cpu = 0; cpu < ncpu; cpu++){
+    while(i < n && ring[cpu].tail != ring[cpu].head){
+      __sync_synchronize();
+      buf[i++] = ring[cpu].ev[ring[cpu].tail % NTRACE];
+      __sync_synchronize();
+      ring[cpu].tail++;
+    }
+    if(i < n && ring[cpu].tail == ring[cpu].head && ring[cpu].lost){
+      buf[i].tsc = rdtsc();
+      buf[i].type = TR_LOST;
+      buf[i].cpu = cpu;
+      buf[i].pid = 0;
+      buf[i].arg = xchg(&ring[cpu].lost, 0);
+      i++;
+    }
+  }
+  release(&tracelock);
+  return i;
+}
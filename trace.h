@@ -0,0 +1,19 @@
+// Kernel trace events, returned by the traceread system call.
+
+#define TR_SWITCHIN   1  // cpu starts running pid
+#define TR_SWITCHOUT  2  // pid gives up the cpu; arg is its new state
+#define TR_WAKEUP     3  // pid made RUNNABLE by arg
+#define TR_FORK       4  // pid created child arg
+#define TR_EXIT       5  // pid exited
+#define TR_SYSCALL    6  // pid entered system call arg
+#define TR_SYSRET     7  // pid returned from system call arg
+#define TR_TIMER      8  // timer interrupt while pid ran
+#define TR_LOST       9  // arg events dropped when the ring was full
+
+struct traceev {
+  uint64 tsc;      // time stamp counter
+  ushort type;     // TR_*
+  ushort cpu;
+  int pid;         // 0 if none
+  int arg;
+};
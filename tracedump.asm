@@ -0,0 +1,2245 @@
+
+_tracedump:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 28             	sub    $0x28,%esp
+      14:	8b 19                	mov    (%ecx),%ebx
+      16:	8b 71 04             	mov    0x4(%ecx),%esi
+  struct traceev *e;
+  uint64 t0;
+  uint khz;
+  int pid, cpu, i;
+
+  drain();
+      19:	e8 72 02 00 00       	call   290 <drain>
+  nev = 0;
+  khz = tracectl(1);
+      1e:	83 ec 0c             	sub    $0xc,%esp
+  nev = 0;
+      21:	c7 05 24 17 00 00 00 	movl   $0x0,0x1724
+      28:	00 00 00 
+  khz = tracectl(1);
+      2b:	6a 01                	push   $0x1
+      2d:	e8 29 0b 00 00       	call   b5b <tracectl>
+  if(argc > 1){
+      32:	83 c4 10             	add    $0x10,%esp
+  khz = tracectl(1);
+      35:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  if(argc > 1){
+      38:	83 fb 01             	cmp    $0x1,%ebx
+      3b:	7e 38                	jle    75 <main+0x75>
+    if((pid = fork()) < 0){
+      3d:	e8 0e 05 00 00       	call   550 <fork>
+      42:	85 c0                	test   %eax,%eax
+      44:	0f 88 13 02 00 00    	js     25d <main+0x25d>
+      printf(2, "tracedump: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      4a:	0f 85 f8 01 00 00    	jne    248 <main+0x248>
+      exec(argv[1], argv + 1);
+      50:	8d 46 04             	lea    0x4(%esi),%eax
+      53:	53                   	push   %ebx
+      54:	53                   	push   %ebx
+      55:	50                   	push   %eax
+      56:	ff 76 04             	push   0x4(%esi)
+      59:	e8 52 05 00 00       	call   5b0 <exec>
+      printf(2, "tracedump: exec %s failed\n", argv[1]);
+      5e:	83 c4 0c             	add    $0xc,%esp
+      61:	ff 76 04             	push   0x4(%esi)
+      64:	68 1a 11 00 00       	push   $0x111a
+      69:	6a 02                	push   $0x2
+      6b:	e8 e0 0b 00 00       	call   c50 <printf>
+      exit();
+      70:	e8 2b 05 00 00       	call   5a0 <exit>
+    }
+    waitpoll(pid, drain);
+  } else
+    sleep(10);
+      75:	83 ec 0c             	sub    $0xc,%esp
+      78:	6a 0a                	push   $0xa
+      7a:	e8 ce 09 00 00       	call   a4d <sleep>
+      7f:	83 c4 10             	add    $0x10,%esp
+  tracectl(0);
+      82:	83 ec 0c             	sub    $0xc,%esp
+      85:	6a 00                	push   $0x0
+      87:	e8 cf 0a 00 00       	call   b5b <tracectl>
+  drain();
+      8c:	e8 ff 01 00 00       	call   290 <drain>
+
+  if(nev == 0)
+      91:	a1 24 17 00 00       	mov    0x1724,%eax
+      96:	83 c4 10             	add    $0x10,%esp
+      99:	85 c0                	test   %eax,%eax
+      9b:	0f 84 a2 01 00 00    	je     243 <main+0x243>
+    exit();
+  t0 = ev[0].tsc;
+      a1:	8b 0d 40 17 00 00    	mov    0x1740,%ecx
+      a7:	8b 1d 44 17 00 00    	mov    0x1744,%ebx
+      ad:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+      b0:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+  for(i = 1; i < nev; i++)
+      b3:	83 f8 01             	cmp    $0x1,%eax
+      b6:	7e 3f                	jle    f7 <main+0xf7>
+      b8:	6b f0 14             	imul   $0x14,%eax,%esi
+      bb:	ba 54 17 00 00       	mov    $0x1754,%edx
+      c0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      c3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+      c6:	89 d1                	mov    %edx,%ecx
+      c8:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      cb:	81 c6 40 17 00 00    	add    $0x1740,%esi
+      d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(ev[i].tsc < t0)
+      d8:	8b 59 04             	mov    0x4(%ecx),%ebx
+      db:	39 01                	cmp    %eax,(%ecx)
+      dd:	89 df                	mov    %ebx,%edi
+      df:	19 d7                	sbb    %edx,%edi
+      e1:	0f 42 01             	cmovb  (%ecx),%eax
+      e4:	0f 42 d3             	cmovb  %ebx,%edx
+  for(i = 1; i < nev; i++)
+      e7:	83 c1 14             	add    $0x14,%ecx
+      ea:	39 f1                	cmp    %esi,%ecx
+      ec:	75 ea                	jne    d8 <main+0xd8>
+      ee:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+      f1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+      f4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      t0 = ev[i].tsc;
+  for(cpu = 0; cpu < NCPU; cpu++){
+      f7:	31 f6                	xor    %esi,%esi
+      f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    for(i = 0; i < nev; i++)
+     100:	31 db                	xor    %ebx,%ebx
+     102:	85 c0                	test   %eax,%eax
+     104:	7f 15                	jg     11b <main+0x11b>
+     106:	eb 22                	jmp    12a <main+0x12a>
+     108:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     10f:	90                   	nop
+     110:	83 c3 01             	add    $0x1,%ebx
+     113:	39 c3                	cmp    %eax,%ebx
+     115:	0f 84 0d 01 00 00    	je     228 <main+0x228>
+      if(ev[i].cpu == cpu)
+     11b:	8d 14 9b             	lea    (%ebx,%ebx,4),%edx
+     11e:	0f b7 14 95 4a 17 00 	movzwl 0x174a(,%edx,4),%edx
+     125:	00 
+     126:	39 f2                	cmp    %esi,%edx
+     128:	75 e6                	jne    110 <main+0x110>
+        break;
+    if(i == nev)
+     12a:	39 d8                	cmp    %ebx,%eax
+     12c:	0f 84 f6 00 00 00    	je     228 <main+0x228>
+      continue;
+    printf(1, "cpu%d:\n", cpu);
+     132:	83 ec 04             	sub    $0x4,%esp
+     135:	56                   	push   %esi
+     136:	68 35 11 00 00       	push   $0x1135
+     13b:	6a 01                	push   $0x1
+     13d:	e8 0e 0b 00 00       	call   c50 <printf>
+    for(; i < nev; i++){
+     142:	83 c4 10             	add    $0x10,%esp
+     145:	39 1d 24 17 00 00    	cmp    %ebx,0x1724
+     14b:	0f 8e d7 00 00 00    	jle    228 <main+0x228>
+     151:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+      e = &ev[i];
+      if(e->cpu != cpu)
+        continue;
+      printf(1, "%d us\tpid %d\t%s", (uint)div64((e->tsc - t0) * 1000, khz),
+             e->pid, e->type < NELEM(names) && names[e->type] ? names[e->type] : "?");
+      if(e->type == TR_WAKEUP || e->type == TR_FORK ||
+     154:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+     157:	8d 3c 85 40 17 00 00 	lea    0x1740(,%eax,4),%edi
+     15e:	89 fe                	mov    %edi,%esi
+      if(e->cpu != cpu)
+     160:	0f b7 46 0a          	movzwl 0xa(%esi),%eax
+     164:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     167:	39 f8                	cmp    %edi,%eax
+     169:	0f 85 a4 00 00 00    	jne    213 <main+0x213>
+             e->pid, e->type < NELEM(names) && names[e->type] ? names[e->type] : "?");
+     16f:	0f b7 46 08          	movzwl 0x8(%esi),%eax
+      printf(1, "%d us\tpid %d\t%s", (uint)div64((e->tsc - t0) * 1000, khz),
+     173:	bf 00 11 00 00       	mov    $0x1100,%edi
+     178:	66 83 f8 09          	cmp    $0x9,%ax
+     17c:	77 11                	ja     18f <main+0x18f>
+             e->pid, e->type < NELEM(names) && names[e->type] ? names[e->type] : "?");
+     17e:	8b 3c 85 e0 16 00 00 	mov    0x16e0(,%eax,4),%edi
+      printf(1, "%d us\tpid %d\t%s", (uint)div64((e->tsc - t0) * 1000, khz),
+     185:	b8 00 11 00 00       	mov    $0x1100,%eax
+     18a:	85 ff                	test   %edi,%edi
+     18c:	0f 44 f8             	cmove  %eax,%edi
+     18f:	8b 06                	mov    (%esi),%eax
+     191:	8b 56 04             	mov    0x4(%esi),%edx
+     194:	2b 45 d0             	sub    -0x30(%ebp),%eax
+     197:	1b 55 d4             	sbb    -0x2c(%ebp),%edx
+     19a:	83 ec 0c             	sub    $0xc,%esp
+     19d:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+     1a3:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     1a6:	b9 e8 03 00 00       	mov    $0x3e8,%ecx
+     1ab:	f7 e1                	mul    %ecx
+     1ad:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+     1b0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+     1b3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     1b6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+     1b9:	01 d0                	add    %edx,%eax
+static inline uint64
+div64(uint64 n, uint d)
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+     1bb:	31 d2                	xor    %edx,%edx
+     1bd:	f7 f1                	div    %ecx
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     1bf:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     1c2:	57                   	push   %edi
+     1c3:	f7 f1                	div    %ecx
+     1c5:	ff 76 0c             	push   0xc(%esi)
+     1c8:	50                   	push   %eax
+     1c9:	68 3d 11 00 00       	push   $0x113d
+     1ce:	6a 01                	push   $0x1
+     1d0:	e8 7b 0a 00 00       	call   c50 <printf>
+      if(e->type == TR_WAKEUP || e->type == TR_FORK ||
+     1d5:	0f b7 46 08          	movzwl 0x8(%esi),%eax
+     1d9:	83 c4 20             	add    $0x20,%esp
+     1dc:	66 83 f8 09          	cmp    $0x9,%ax
+     1e0:	77 1f                	ja     201 <main+0x201>
+         e->type == TR_SYSCALL || e->type == TR_SYSRET ||
+     1e2:	bf 27 fd ff ff       	mov    $0xfffffd27,%edi
+     1e7:	0f a3 c7             	bt     %eax,%edi
+     1ea:	72 15                	jb     201 <main+0x201>
+         e->type == TR_LOST)
+        printf(1, " %d", e->arg);
+     1ec:	83 ec 04             	sub    $0x4,%esp
+     1ef:	ff 76 10             	push   0x10(%esi)
+     1f2:	68 4d 11 00 00       	push   $0x114d
+     1f7:	6a 01                	push   $0x1
+     1f9:	e8 52 0a 00 00       	call   c50 <printf>
+     1fe:	83 c4 10             	add    $0x10,%esp
+      printf(1, "\n");
+     201:	83 ec 08             	sub    $0x8,%esp
+     204:	68 3b 11 00 00       	push   $0x113b
+     209:	6a 01                	push   $0x1
+     20b:	e8 40 0a 00 00       	call   c50 <printf>
+     210:	83 c4 10             	add    $0x10,%esp
+    for(; i < nev; i++){
+     213:	83 c3 01             	add    $0x1,%ebx
+     216:	83 c6 14             	add    $0x14,%esi
+     219:	39 1d 24 17 00 00    	cmp    %ebx,0x1724
+     21f:	0f 8f 3b ff ff ff    	jg     160 <main+0x160>
+     225:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  for(cpu = 0; cpu < NCPU; cpu++){
+     228:	83 c6 01             	add    $0x1,%esi
+     22b:	83 fe 08             	cmp    $0x8,%esi
+     22e:	74 0a                	je     23a <main+0x23a>
+     230:	a1 24 17 00 00       	mov    0x1724,%eax
+     235:	e9 c6 fe ff ff       	jmp    100 <main+0x100>
+    }
+  }
+  if(dropped)
+     23a:	a1 20 17 00 00       	mov    0x1720,%eax
+     23f:	85 c0                	test   %eax,%eax
+     241:	75 2d                	jne    270 <main+0x270>
+    exit();
+     243:	e8 58 03 00 00       	call   5a0 <exit>
+    waitpoll(pid, drain);
+     248:	51                   	push   %ecx
+     249:	51                   	push   %ecx
+     24a:	68 90 02 00 00       	push   $0x290
+     24f:	50                   	push   %eax
+     250:	e8 bb 0d 00 00       	call   1010 <waitpoll>
+     255:	83 c4 10             	add    $0x10,%esp
+     258:	e9 25 fe ff ff       	jmp    82 <main+0x82>
+      printf(2, "tracedump: fork failed\n");
+     25d:	56                   	push   %esi
+     25e:	56                   	push   %esi
+     25f:	68 02 11 00 00       	push   $0x1102
+     264:	6a 02                	push   $0x2
+     266:	e8 e5 09 00 00       	call   c50 <printf>
+      exit();
+     26b:	e8 30 03 00 00       	call   5a0 <exit>
+    printf(1, "tracedump: %d events did not fit\n", dropped);
+     270:	52                   	push   %edx
+     271:	50                   	push   %eax
+     272:	68 94 11 00 00       	push   $0x1194
+     277:	6a 01                	push   $0x1
+     279:	e8 d2 09 00 00       	call   c50 <printf>
+     27e:	83 c4 10             	add    $0x10,%esp
+     281:	eb c0                	jmp    243 <main+0x243>
+     283:	66 90                	xchg   %ax,%ax
+     285:	66 90                	xchg   %ax,%ax
+     287:	66 90                	xchg   %ax,%ax
+     289:	66 90                	xchg   %ax,%ax
+     28b:	66 90                	xchg   %ax,%ax
+     28d:	66 90                	xchg   %ax,%ax
+     28f:	90                   	nop
+
+00000290 <drain>:
+{
+     290:	55                   	push   %ebp
+     291:	89 e5                	mov    %esp,%ebp
+     293:	57                   	push   %edi
+      n = MAXEV - nev;
+     294:	bf 00 10 00 00       	mov    $0x1000,%edi
+{
+     299:	56                   	push   %esi
+     29a:	8d b5 e8 fa ff ff    	lea    -0x518(%ebp),%esi
+     2a0:	53                   	push   %ebx
+     2a1:	81 ec 0c 05 00 00    	sub    $0x50c,%esp
+  while((n = traceread(tmp, NELEM(tmp))) > 0){
+     2a7:	eb 4b                	jmp    2f4 <drain+0x64>
+     2a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(nev + n > MAXEV){
+     2b0:	a1 24 17 00 00       	mov    0x1724,%eax
+     2b5:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+     2b8:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+     2be:	7e 10                	jle    2d0 <drain+0x40>
+      dropped += nev + n - MAXEV;
+     2c0:	81 ea 00 10 00 00    	sub    $0x1000,%edx
+     2c6:	01 15 20 17 00 00    	add    %edx,0x1720
+      n = MAXEV - nev;
+     2cc:	89 fb                	mov    %edi,%ebx
+     2ce:	29 c3                	sub    %eax,%ebx
+    memmove(&ev[nev], tmp, n * sizeof(tmp[0]));
+     2d0:	8d 14 9b             	lea    (%ebx,%ebx,4),%edx
+     2d3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+     2d6:	83 ec 04             	sub    $0x4,%esp
+     2d9:	c1 e2 02             	shl    $0x2,%edx
+     2dc:	8d 04 85 40 17 00 00 	lea    0x1740(,%eax,4),%eax
+     2e3:	52                   	push   %edx
+     2e4:	56                   	push   %esi
+     2e5:	50                   	push   %eax
+     2e6:	e8 55 06 00 00       	call   940 <memmove>
+    nev += n;
+     2eb:	01 1d 24 17 00 00    	add    %ebx,0x1724
+     2f1:	83 c4 10             	add    $0x10,%esp
+  while((n = traceread(tmp, NELEM(tmp))) > 0){
+     2f4:	83 ec 08             	sub    $0x8,%esp
+     2f7:	6a 40                	push   $0x40
+     2f9:	56                   	push   %esi
+     2fa:	e8 66 08 00 00       	call   b65 <traceread>
+     2ff:	83 c4 10             	add    $0x10,%esp
+     302:	89 c3                	mov    %eax,%ebx
+     304:	85 c0                	test   %eax,%eax
+     306:	7f a8                	jg     2b0 <drain+0x20>
+}
+     308:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     30b:	5b                   	pop    %ebx
+     30c:	5e                   	pop    %esi
+     30d:	5f                   	pop    %edi
+     30e:	5d                   	pop    %ebp
+     30f:	c3                   	ret
+
+00000310 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+     310:	55                   	push   %ebp
+     311:	89 e5                	mov    %esp,%ebp
+     313:	57                   	push   %edi
+     314:	56                   	push   %esi
+     315:	53                   	push   %ebx
+     316:	83 ec 4c             	sub    $0x4c,%esp
+     319:	8b 45 0c             	mov    0xc(%ebp),%eax
+     31c:	8b 55 08             	mov    0x8(%ebp),%edx
+     31f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     322:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+     325:	83 fa 0f             	cmp    $0xf,%edx
+     328:	0f 87 32 01 00 00    	ja     460 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+     32e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     334:	8b 80 40 57 01 00    	mov    0x15740(%eax),%eax
+     33a:	85 c0                	test   %eax,%eax
+     33c:	0f 84 de 00 00 00    	je     420 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+     342:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     348:	8b b0 44 57 01 00    	mov    0x15744(%eax),%esi
+     34e:	8d 88 40 57 01 00    	lea    0x15740(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+     354:	8d b8 48 57 01 00    	lea    0x15748(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+     35a:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+     35d:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+     360:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+     363:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+     369:	0f 8f 01 01 00 00    	jg     470 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+     36f:	8d 78 08             	lea    0x8(%eax),%edi
+     372:	8d bc 3e 40 57 01 00 	lea    0x15740(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     379:	85 db                	test   %ebx,%ebx
+     37b:	7e 3b                	jle    3b8 <bufwrite+0xa8>
+     37d:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+     380:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+     383:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     387:	90                   	nop
+    *dst++ = *src++;
+     388:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     389:	39 c6                	cmp    %eax,%esi
+     38b:	75 fb                	jne    388 <bufwrite+0x78>
+  ob[fd].n += n;
+     38d:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+     393:	8b 88 44 57 01 00    	mov    0x15744(%eax),%ecx
+     399:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     39b:	83 b8 40 57 01 00 01 	cmpl   $0x1,0x15740(%eax)
+  ob[fd].n += n;
+     3a2:	89 88 44 57 01 00    	mov    %ecx,0x15744(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     3a8:	74 26                	je     3d0 <bufwrite+0xc0>
+}
+     3aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     3ad:	5b                   	pop    %ebx
+     3ae:	5e                   	pop    %esi
+     3af:	5f                   	pop    %edi
+     3b0:	5d                   	pop    %ebp
+     3b1:	c3                   	ret
+     3b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+     3b8:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     3bb:	83 b8 40 57 01 00 01 	cmpl   $0x1,0x15740(%eax)
+  ob[fd].n += n;
+     3c2:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+     3c5:	75 e3                	jne    3aa <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+     3c7:	85 db                	test   %ebx,%ebx
+     3c9:	74 df                	je     3aa <bufwrite+0x9a>
+     3cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3cf:	90                   	nop
+  src = vsrc;
+     3d0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     3d3:	01 c3                	add    %eax,%ebx
+     3d5:	eb 10                	jmp    3e7 <bufwrite+0xd7>
+     3d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3de:	66 90                	xchg   %ax,%ax
+     3e0:	83 c0 01             	add    $0x1,%eax
+     3e3:	39 d8                	cmp    %ebx,%eax
+     3e5:	74 c3                	je     3aa <bufwrite+0x9a>
+    if(*p == (char)c)
+     3e7:	80 38 0a             	cmpb   $0xa,(%eax)
+     3ea:	75 f4                	jne    3e0 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     3ec:	85 c9                	test   %ecx,%ecx
+     3ee:	7e ba                	jle    3aa <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+     3f0:	83 ec 04             	sub    $0x4,%esp
+     3f3:	51                   	push   %ecx
+     3f4:	ff 75 ac             	push   -0x54(%ebp)
+     3f7:	52                   	push   %edx
+     3f8:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+     3fb:	e8 cd 05 00 00       	call   9cd <write>
+    ob[fd].n = 0;
+     400:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     403:	83 c4 10             	add    $0x10,%esp
+     406:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+     40c:	c7 82 44 57 01 00 00 	movl   $0x0,0x15744(%edx)
+     413:	00 00 00 
+     416:	eb 92                	jmp    3aa <bufwrite+0x9a>
+     418:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     41f:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     420:	83 ec 08             	sub    $0x8,%esp
+     423:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     426:	50                   	push   %eax
+     427:	52                   	push   %edx
+     428:	89 55 b0             	mov    %edx,-0x50(%ebp)
+     42b:	e8 d7 05 00 00       	call   a07 <fstat>
+     430:	83 c4 10             	add    $0x10,%esp
+     433:	8b 55 b0             	mov    -0x50(%ebp),%edx
+     436:	89 c1                	mov    %eax,%ecx
+     438:	b8 02 00 00 00       	mov    $0x2,%eax
+     43d:	85 c9                	test   %ecx,%ecx
+     43f:	75 0d                	jne    44e <bufwrite+0x13e>
+     441:	31 c0                	xor    %eax,%eax
+     443:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     448:	0f 95 c0             	setne  %al
+     44b:	83 c0 01             	add    $0x1,%eax
+     44e:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+     454:	89 81 40 57 01 00    	mov    %eax,0x15740(%ecx)
+     45a:	e9 e3 fe ff ff       	jmp    342 <bufwrite+0x32>
+     45f:	90                   	nop
+}
+     460:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     463:	5b                   	pop    %ebx
+     464:	5e                   	pop    %esi
+     465:	5f                   	pop    %edi
+     466:	5d                   	pop    %ebp
+    write(fd, p, n);
+     467:	e9 61 05 00 00       	jmp    9cd <write>
+     46c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+     470:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+     473:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+     476:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+     479:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+     47c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+     47f:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+     482:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+     485:	6a 02                	push   $0x2
+     487:	50                   	push   %eax
+     488:	52                   	push   %edx
+     489:	e8 9b 06 00 00       	call   b29 <writev>
+    ob[fd].n = 0;
+     48e:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+     491:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+     494:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+     49b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     49e:	5b                   	pop    %ebx
+     49f:	5e                   	pop    %esi
+     4a0:	5f                   	pop    %edi
+     4a1:	5d                   	pop    %ebp
+     4a2:	c3                   	ret
+     4a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000004b0 <fflush>:
+{
+     4b0:	55                   	push   %ebp
+     4b1:	89 e5                	mov    %esp,%ebp
+     4b3:	53                   	push   %ebx
+     4b4:	83 ec 04             	sub    $0x4,%esp
+     4b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     4ba:	83 f8 0f             	cmp    $0xf,%eax
+     4bd:	77 16                	ja     4d5 <fflush+0x25>
+     4bf:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+     4c5:	8b 8a 44 57 01 00    	mov    0x15744(%edx),%ecx
+     4cb:	8d 9a 40 57 01 00    	lea    0x15740(%edx),%ebx
+     4d1:	85 c9                	test   %ecx,%ecx
+     4d3:	7f 0b                	jg     4e0 <fflush+0x30>
+}
+     4d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4d8:	c9                   	leave
+     4d9:	c3                   	ret
+     4da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     4e0:	83 ec 04             	sub    $0x4,%esp
+     4e3:	81 c2 48 57 01 00    	add    $0x15748,%edx
+     4e9:	51                   	push   %ecx
+     4ea:	52                   	push   %edx
+     4eb:	50                   	push   %eax
+     4ec:	e8 dc 04 00 00       	call   9cd <write>
+    ob[fd].n = 0;
+     4f1:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     4f8:	83 c4 10             	add    $0x10,%esp
+}
+     4fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4fe:	c9                   	leave
+     4ff:	c3                   	ret
+
+00000500 <fflushall>:
+{
+     500:	55                   	push   %ebp
+     501:	89 e5                	mov    %esp,%ebp
+     503:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     504:	31 f6                	xor    %esi,%esi
+{
+     506:	53                   	push   %ebx
+     507:	bb 48 57 01 00       	mov    $0x15748,%ebx
+     50c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     510:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     513:	85 c0                	test   %eax,%eax
+     515:	7e 15                	jle    52c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     517:	83 ec 04             	sub    $0x4,%esp
+     51a:	50                   	push   %eax
+     51b:	53                   	push   %ebx
+     51c:	56                   	push   %esi
+     51d:	e8 ab 04 00 00       	call   9cd <write>
+    ob[fd].n = 0;
+     522:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     529:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     52c:	83 c6 01             	add    $0x1,%esi
+     52f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     535:	83 fe 10             	cmp    $0x10,%esi
+     538:	75 d6                	jne    510 <fflushall+0x10>
+}
+     53a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     53d:	5b                   	pop    %ebx
+     53e:	5e                   	pop    %esi
+     53f:	5d                   	pop    %ebp
+     540:	c3                   	ret
+     541:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     548:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     54f:	90                   	nop
+
+00000550 <fork>:
+{
+     550:	55                   	push   %ebp
+     551:	89 e5                	mov    %esp,%ebp
+     553:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     554:	31 f6                	xor    %esi,%esi
+{
+     556:	53                   	push   %ebx
+     557:	bb 48 57 01 00       	mov    $0x15748,%ebx
+     55c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     560:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     563:	85 c0                	test   %eax,%eax
+     565:	7e 15                	jle    57c <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     567:	83 ec 04             	sub    $0x4,%esp
+     56a:	50                   	push   %eax
+     56b:	53                   	push   %ebx
+     56c:	56                   	push   %esi
+     56d:	e8 5b 04 00 00       	call   9cd <write>
+    ob[fd].n = 0;
+     572:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     579:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     57c:	83 c6 01             	add    $0x1,%esi
+     57f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     585:	83 fe 10             	cmp    $0x10,%esi
+     588:	75 d6                	jne    560 <fork+0x10>
+}
+     58a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     58d:	5b                   	pop    %ebx
+     58e:	5e                   	pop    %esi
+     58f:	5d                   	pop    %ebp
+  return _fork();
+     590:	e9 15 04 00 00       	jmp    9aa <_fork>
+     595:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     59c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005a0 <exit>:
+{
+     5a0:	55                   	push   %ebp
+     5a1:	89 e5                	mov    %esp,%ebp
+     5a3:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+     5a6:	e8 55 ff ff ff       	call   500 <fflushall>
+  _exit();
+     5ab:	e8 01 04 00 00       	call   9b1 <_exit>
+
+000005b0 <exec>:
+{
+     5b0:	55                   	push   %ebp
+     5b1:	89 e5                	mov    %esp,%ebp
+     5b3:	57                   	push   %edi
+     5b4:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+     5b5:	31 f6                	xor    %esi,%esi
+{
+     5b7:	53                   	push   %ebx
+     5b8:	bb 48 57 01 00       	mov    $0x15748,%ebx
+     5bd:	83 ec 1c             	sub    $0x1c,%esp
+     5c0:	8b 45 08             	mov    0x8(%ebp),%eax
+     5c3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     5c6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     5c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     5d0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     5d3:	85 c0                	test   %eax,%eax
+     5d5:	7e 15                	jle    5ec <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     5d7:	83 ec 04             	sub    $0x4,%esp
+     5da:	50                   	push   %eax
+     5db:	53                   	push   %ebx
+     5dc:	56                   	push   %esi
+     5dd:	e8 eb 03 00 00       	call   9cd <write>
+    ob[fd].n = 0;
+     5e2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+     5e9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     5ec:	83 c6 01             	add    $0x1,%esi
+     5ef:	81 c3 08 01 00 00    	add    $0x108,%ebx
+     5f5:	83 fe 10             	cmp    $0x10,%esi
+     5f8:	75 d6                	jne    5d0 <exec+0x20>
+  return _exec(path, argv);
+     5fa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     5fd:	89 7d 0c             	mov    %edi,0xc(%ebp)
+     600:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     603:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     606:	5b                   	pop    %ebx
+     607:	5e                   	pop    %esi
+     608:	5f                   	pop    %edi
+     609:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     60a:	e9 d3 03 00 00       	jmp    9e2 <_exec>
+     60f:	90                   	nop
+
+00000610 <close>:
+{
+     610:	55                   	push   %ebp
+     611:	89 e5                	mov    %esp,%ebp
+     613:	56                   	push   %esi
+     614:	53                   	push   %ebx
+     615:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     618:	83 fb 0f             	cmp    $0xf,%ebx
+     61b:	77 26                	ja     643 <close+0x33>
+     61d:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     623:	8b 90 44 57 01 00    	mov    0x15744(%eax),%edx
+     629:	8d b0 40 57 01 00    	lea    0x15740(%eax),%esi
+     62f:	85 d2                	test   %edx,%edx
+     631:	7f 25                	jg     658 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+     633:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     639:	c7 80 40 57 01 00 00 	movl   $0x0,0x15740(%eax)
+     640:	00 00 00 
+  return _close(fd);
+     643:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     646:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     649:	5b                   	pop    %ebx
+     64a:	5e                   	pop    %esi
+     64b:	5d                   	pop    %ebp
+  return _close(fd);
+     64c:	e9 83 03 00 00       	jmp    9d4 <_close>
+     651:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+     658:	83 ec 04             	sub    $0x4,%esp
+     65b:	05 48 57 01 00       	add    $0x15748,%eax
+     660:	52                   	push   %edx
+     661:	50                   	push   %eax
+     662:	53                   	push   %ebx
+     663:	e8 65 03 00 00       	call   9cd <write>
+    ob[fd].n = 0;
+     668:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+     66f:	83 c4 10             	add    $0x10,%esp
+     672:	eb bf                	jmp    633 <close+0x23>
+     674:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     67b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     67f:	90                   	nop
+
+00000680 <strcpy>:
+{
+     680:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+     681:	31 c0                	xor    %eax,%eax
+{
+     683:	89 e5                	mov    %esp,%ebp
+     685:	53                   	push   %ebx
+     686:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     689:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     68c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     690:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     694:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     697:	83 c0 01             	add    $0x1,%eax
+     69a:	84 d2                	test   %dl,%dl
+     69c:	75 f2                	jne    690 <strcpy+0x10>
+}
+     69e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6a1:	89 c8                	mov    %ecx,%eax
+     6a3:	c9                   	leave
+     6a4:	c3                   	ret
+     6a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006b0 <strcmp>:
+{
+     6b0:	55                   	push   %ebp
+     6b1:	89 e5                	mov    %esp,%ebp
+     6b3:	53                   	push   %ebx
+     6b4:	8b 55 08             	mov    0x8(%ebp),%edx
+     6b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     6ba:	0f b6 02             	movzbl (%edx),%eax
+     6bd:	84 c0                	test   %al,%al
+     6bf:	75 17                	jne    6d8 <strcmp+0x28>
+     6c1:	eb 3a                	jmp    6fd <strcmp+0x4d>
+     6c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6c7:	90                   	nop
+     6c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     6cc:	83 c2 01             	add    $0x1,%edx
+     6cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     6d2:	84 c0                	test   %al,%al
+     6d4:	74 1a                	je     6f0 <strcmp+0x40>
+    p++, q++;
+     6d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     6d8:	0f b6 19             	movzbl (%ecx),%ebx
+     6db:	38 c3                	cmp    %al,%bl
+     6dd:	74 e9                	je     6c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     6df:	29 d8                	sub    %ebx,%eax
+}
+     6e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6e4:	c9                   	leave
+     6e5:	c3                   	ret
+     6e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     6f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     6f4:	31 c0                	xor    %eax,%eax
+     6f6:	29 d8                	sub    %ebx,%eax
+}
+     6f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6fb:	c9                   	leave
+     6fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     6fd:	0f b6 19             	movzbl (%ecx),%ebx
+     700:	31 c0                	xor    %eax,%eax
+     702:	eb db                	jmp    6df <strcmp+0x2f>
+     704:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     70b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     70f:	90                   	nop
+
+00000710 <strlen>:
+{
+     710:	55                   	push   %ebp
+     711:	89 e5                	mov    %esp,%ebp
+     713:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+     716:	80 3a 00             	cmpb   $0x0,(%edx)
+     719:	74 15                	je     730 <strlen+0x20>
+     71b:	31 c0                	xor    %eax,%eax
+     71d:	8d 76 00             	lea    0x0(%esi),%esi
+     720:	83 c0 01             	add    $0x1,%eax
+     723:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     727:	89 c1                	mov    %eax,%ecx
+     729:	75 f5                	jne    720 <strlen+0x10>
+}
+     72b:	89 c8                	mov    %ecx,%eax
+     72d:	5d                   	pop    %ebp
+     72e:	c3                   	ret
+     72f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     730:	31 c9                	xor    %ecx,%ecx
+}
+     732:	5d                   	pop    %ebp
+     733:	89 c8                	mov    %ecx,%eax
+     735:	c3                   	ret
+     736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     73d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000740 <memset>:
+{
+     740:	55                   	push   %ebp
+     741:	89 e5                	mov    %esp,%ebp
+     743:	57                   	push   %edi
+     744:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("cld; rep stosb" :
+     747:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     74a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     74d:	89 d7                	mov    %edx,%edi
+     74f:	fc                   	cld
+     750:	f3 aa                	rep stos %al,%es:(%edi)
+}
+     752:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     755:	89 d0                	mov    %edx,%eax
+     757:	c9                   	leave
+     758:	c3                   	ret
+     759:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000760 <strchr>:
+{
+     760:	55                   	push   %ebp
+     761:	89 e5                	mov    %esp,%ebp
+     763:	8b 45 08             	mov    0x8(%ebp),%eax
+     766:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     76a:	0f b6 10             	movzbl (%eax),%edx
+     76d:	84 d2                	test   %dl,%dl
+     76f:	75 12                	jne    783 <strchr+0x23>
+     771:	eb 1d                	jmp    790 <strchr+0x30>
+     773:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     777:	90                   	nop
+     778:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     77c:	83 c0 01             	add    $0x1,%eax
+     77f:	84 d2                	test   %dl,%dl
+     781:	74 0d                	je     790 <strchr+0x30>
+    if(*s == c)
+     783:	38 d1                	cmp    %dl,%cl
+     785:	75 f1                	jne    778 <strchr+0x18>
+}
+     787:	5d                   	pop    %ebp
+     788:	c3                   	ret
+     789:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     790:	31 c0                	xor    %eax,%eax
+}
+     792:	5d                   	pop    %ebp
+     793:	c3                   	ret
+     794:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     79b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     79f:	90                   	nop
+
+000007a0 <memchr>:
+{
+     7a0:	55                   	push   %ebp
+     7a1:	89 e5                	mov    %esp,%ebp
+     7a3:	8b 55 10             	mov    0x10(%ebp),%edx
+     7a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+     7a9:	85 d2                	test   %edx,%edx
+     7ab:	74 1b                	je     7c8 <memchr+0x28>
+    if(*p == (char)c)
+     7ad:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+     7b1:	01 c2                	add    %eax,%edx
+     7b3:	eb 0a                	jmp    7bf <memchr+0x1f>
+     7b5:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+     7b8:	83 c0 01             	add    $0x1,%eax
+     7bb:	39 c2                	cmp    %eax,%edx
+     7bd:	74 09                	je     7c8 <memchr+0x28>
+    if(*p == (char)c)
+     7bf:	38 08                	cmp    %cl,(%eax)
+     7c1:	75 f5                	jne    7b8 <memchr+0x18>
+}
+     7c3:	5d                   	pop    %ebp
+     7c4:	c3                   	ret
+     7c5:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+     7c8:	31 c0                	xor    %eax,%eax
+}
+     7ca:	5d                   	pop    %ebp
+     7cb:	c3                   	ret
+     7cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007d0 <gets>:
+{
+     7d0:	55                   	push   %ebp
+     7d1:	89 e5                	mov    %esp,%ebp
+     7d3:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+     7d4:	31 ff                	xor    %edi,%edi
+{
+     7d6:	56                   	push   %esi
+     7d7:	be 48 57 01 00       	mov    $0x15748,%esi
+     7dc:	53                   	push   %ebx
+     7dd:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     7e0:	8b 46 fc             	mov    -0x4(%esi),%eax
+     7e3:	85 c0                	test   %eax,%eax
+     7e5:	7e 15                	jle    7fc <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+     7e7:	83 ec 04             	sub    $0x4,%esp
+     7ea:	50                   	push   %eax
+     7eb:	56                   	push   %esi
+     7ec:	57                   	push   %edi
+     7ed:	e8 db 01 00 00       	call   9cd <write>
+    ob[fd].n = 0;
+     7f2:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+     7f9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+     7fc:	83 c7 01             	add    $0x1,%edi
+     7ff:	81 c6 08 01 00 00    	add    $0x108,%esi
+     805:	83 ff 10             	cmp    $0x10,%edi
+     808:	75 d6                	jne    7e0 <gets+0x10>
+  for(i=0; i+1 < max; ){
+     80a:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+     80c:	8d 75 e7             	lea    -0x19(%ebp),%esi
+     80f:	eb 2e                	jmp    83f <gets+0x6f>
+     811:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     818:	83 ec 04             	sub    $0x4,%esp
+     81b:	6a 01                	push   $0x1
+     81d:	56                   	push   %esi
+     81e:	6a 00                	push   $0x0
+     820:	e8 a1 01 00 00       	call   9c6 <read>
+    if(cc < 1)
+     825:	83 c4 10             	add    $0x10,%esp
+     828:	85 c0                	test   %eax,%eax
+     82a:	7e 1d                	jle    849 <gets+0x79>
+    buf[i++] = c;
+     82c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     830:	8b 55 08             	mov    0x8(%ebp),%edx
+     833:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     837:	3c 0a                	cmp    $0xa,%al
+     839:	74 10                	je     84b <gets+0x7b>
+     83b:	3c 0d                	cmp    $0xd,%al
+     83d:	74 0c                	je     84b <gets+0x7b>
+  for(i=0; i+1 < max; ){
+     83f:	89 df                	mov    %ebx,%edi
+     841:	83 c3 01             	add    $0x1,%ebx
+     844:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     847:	7c cf                	jl     818 <gets+0x48>
+     849:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     84b:	8b 45 08             	mov    0x8(%ebp),%eax
+     84e:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     852:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     855:	5b                   	pop    %ebx
+     856:	5e                   	pop    %esi
+     857:	5f                   	pop    %edi
+     858:	5d                   	pop    %ebp
+     859:	c3                   	ret
+     85a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000860 <stat>:
+{
+     860:	55                   	push   %ebp
+     861:	89 e5                	mov    %esp,%ebp
+     863:	57                   	push   %edi
+     864:	56                   	push   %esi
+     865:	53                   	push   %ebx
+     866:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+     869:	6a 00                	push   $0x0
+     86b:	ff 75 08             	push   0x8(%ebp)
+     86e:	e8 76 01 00 00       	call   9e9 <open>
+  if(fd < 0)
+     873:	83 c4 10             	add    $0x10,%esp
+     876:	85 c0                	test   %eax,%eax
+     878:	78 76                	js     8f0 <stat+0x90>
+  r = fstat(fd, st);
+     87a:	83 ec 08             	sub    $0x8,%esp
+     87d:	ff 75 0c             	push   0xc(%ebp)
+     880:	89 c3                	mov    %eax,%ebx
+     882:	50                   	push   %eax
+     883:	e8 7f 01 00 00       	call   a07 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     888:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     88b:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+     88d:	83 fb 0f             	cmp    $0xf,%ebx
+     890:	7f 40                	jg     8d2 <stat+0x72>
+     892:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     898:	8b 90 44 57 01 00    	mov    0x15744(%eax),%edx
+     89e:	8d b8 40 57 01 00    	lea    0x15740(%eax),%edi
+     8a4:	85 d2                	test   %edx,%edx
+     8a6:	7e 1a                	jle    8c2 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+     8a8:	83 ec 04             	sub    $0x4,%esp
+     8ab:	05 48 57 01 00       	add    $0x15748,%eax
+     8b0:	52                   	push   %edx
+     8b1:	50                   	push   %eax
+     8b2:	53                   	push   %ebx
+     8b3:	e8 15 01 00 00       	call   9cd <write>
+    ob[fd].n = 0;
+     8b8:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+     8bf:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+     8c2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+     8c8:	c7 80 40 57 01 00 00 	movl   $0x0,0x15740(%eax)
+     8cf:	00 00 00 
+  return _close(fd);
+     8d2:	83 ec 0c             	sub    $0xc,%esp
+     8d5:	53                   	push   %ebx
+     8d6:	e8 f9 00 00 00       	call   9d4 <_close>
+     8db:	83 c4 10             	add    $0x10,%esp
+}
+     8de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8e1:	89 f0                	mov    %esi,%eax
+     8e3:	5b                   	pop    %ebx
+     8e4:	5e                   	pop    %esi
+     8e5:	5f                   	pop    %edi
+     8e6:	5d                   	pop    %ebp
+     8e7:	c3                   	ret
+     8e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ef:	90                   	nop
+    return -1;
+     8f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     8f5:	eb e7                	jmp    8de <stat+0x7e>
+     8f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8fe:	66 90                	xchg   %ax,%ax
+
+00000900 <atoi>:
+{
+     900:	55                   	push   %ebp
+     901:	89 e5                	mov    %esp,%ebp
+     903:	53                   	push   %ebx
+     904:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     907:	0f be 02             	movsbl (%edx),%eax
+     90a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     90d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     910:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     915:	77 1e                	ja     935 <atoi+0x35>
+     917:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     91e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     920:	83 c2 01             	add    $0x1,%edx
+     923:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     926:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     92a:	0f be 02             	movsbl (%edx),%eax
+     92d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     930:	80 fb 09             	cmp    $0x9,%bl
+     933:	76 eb                	jbe    920 <atoi+0x20>
+}
+     935:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     938:	89 c8                	mov    %ecx,%eax
+     93a:	c9                   	leave
+     93b:	c3                   	ret
+     93c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000940 <memmove>:
+{
+     940:	55                   	push   %ebp
+     941:	89 e5                	mov    %esp,%ebp
+     943:	57                   	push   %edi
+     944:	56                   	push   %esi
+     945:	8b 45 10             	mov    0x10(%ebp),%eax
+     948:	8b 55 08             	mov    0x8(%ebp),%edx
+     94b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     94e:	85 c0                	test   %eax,%eax
+     950:	7e 13                	jle    965 <memmove+0x25>
+     952:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     954:	89 d7                	mov    %edx,%edi
+     956:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     95d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     960:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     961:	39 f8                	cmp    %edi,%eax
+     963:	75 fb                	jne    960 <memmove+0x20>
+  return vdst;
+}
+     965:	5e                   	pop    %esi
+     966:	89 d0                	mov    %edx,%eax
+     968:	5f                   	pop    %edi
+     969:	5d                   	pop    %ebp
+     96a:	c3                   	ret
+
+0000096b <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+     96b:	83 3d 08 17 00 00 00 	cmpl   $0x0,0x1708
+  jle 1f
+     972:	7e 0a                	jle    97e <syscallentry+0x13>
+  movl %esp, %ecx
+     974:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+     976:	ba 7d 09 00 00       	mov    $0x97d,%edx
+  sysenter
+     97b:	0f 34                	sysenter
+2:
+  ret
+     97d:	c3                   	ret
+1:
+  jl 3f
+     97e:	7c 27                	jl     9a7 <syscallentry+0x3c>
+  pushal
+     980:	60                   	pusha
+  movl $1, %eax
+     981:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     986:	0f a2                	cpuid
+  movl $-1, sysentermode
+     988:	c7 05 08 17 00 00 ff 	movl   $0xffffffff,0x1708
+     98f:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     992:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+     998:	74 0a                	je     9a4 <syscallentry+0x39>
+  movl $1, sysentermode
+     99a:	c7 05 08 17 00 00 01 	movl   $0x1,0x1708
+     9a1:	00 00 00 
+4:
+  popal
+     9a4:	61                   	popa
+  jmp syscallentry
+     9a5:	eb c4                	jmp    96b <syscallentry>
+3:
+  int $T_SYSCALL
+     9a7:	cd 40                	int    $0x40
+  ret
+     9a9:	c3                   	ret
+
+000009aa <_fork>:
+
+SYSCALLAS(_fork, fork)
+     9aa:	b8 01 00 00 00       	mov    $0x1,%eax
+     9af:	eb ba                	jmp    96b <syscallentry>
+
+000009b1 <_exit>:
+SYSCALLAS(_exit, exit)
+     9b1:	b8 02 00 00 00       	mov    $0x2,%eax
+     9b6:	eb b3                	jmp    96b <syscallentry>
+
+000009b8 <wait>:
+SYSCALL(wait)
+     9b8:	b8 03 00 00 00       	mov    $0x3,%eax
+     9bd:	eb ac                	jmp    96b <syscallentry>
+
+000009bf <pipe>:
+SYSCALL(pipe)
+     9bf:	b8 04 00 00 00       	mov    $0x4,%eax
+     9c4:	eb a5                	jmp    96b <syscallentry>
+
+000009c6 <read>:
+SYSCALL(read)
+     9c6:	b8 05 00 00 00       	mov    $0x5,%eax
+     9cb:	eb 9e                	jmp    96b <syscallentry>
+
+000009cd <write>:
+SYSCALL(write)
+     9cd:	b8 10 00 00 00       	mov    $0x10,%eax
+     9d2:	eb 97                	jmp    96b <syscallentry>
+
+000009d4 <_close>:
+SYSCALLAS(_close, close)
+     9d4:	b8 15 00 00 00       	mov    $0x15,%eax
+     9d9:	eb 90                	jmp    96b <syscallentry>
+
+000009db <kill>:
+SYSCALL(kill)
+     9db:	b8 06 00 00 00       	mov    $0x6,%eax
+     9e0:	eb 89                	jmp    96b <syscallentry>
+
+000009e2 <_exec>:
+SYSCALLAS(_exec, exec)
+     9e2:	b8 07 00 00 00       	mov    $0x7,%eax
+     9e7:	eb 82                	jmp    96b <syscallentry>
+
+000009e9 <open>:
+SYSCALL(open)
+     9e9:	b8 0f 00 00 00       	mov    $0xf,%eax
+     9ee:	e9 78 ff ff ff       	jmp    96b <syscallentry>
+
+000009f3 <mknod>:
+SYSCALL(mknod)
+     9f3:	b8 11 00 00 00       	mov    $0x11,%eax
+     9f8:	e9 6e ff ff ff       	jmp    96b <syscallentry>
+
+000009fd <unlink>:
+SYSCALL(unlink)
+     9fd:	b8 12 00 00 00       	mov    $0x12,%eax
+     a02:	e9 64 ff ff ff       	jmp    96b <syscallentry>
+
+00000a07 <fstat>:
+SYSCALL(fstat)
+     a07:	b8 08 00 00 00       	mov    $0x8,%eax
+     a0c:	e9 5a ff ff ff       	jmp    96b <syscallentry>
+
+00000a11 <link>:
+SYSCALL(link)
+     a11:	b8 13 00 00 00       	mov    $0x13,%eax
+     a16:	e9 50 ff ff ff       	jmp    96b <syscallentry>
+
+00000a1b <mkdir>:
+SYSCALL(mkdir)
+     a1b:	b8 14 00 00 00       	mov    $0x14,%eax
+     a20:	e9 46 ff ff ff       	jmp    96b <syscallentry>
+
+00000a25 <chdir>:
+SYSCALL(chdir)
+     a25:	b8 09 00 00 00       	mov    $0x9,%eax
+     a2a:	e9 3c ff ff ff       	jmp    96b <syscallentry>
+
+00000a2f <dup>:
+SYSCALL(dup)
+     a2f:	b8 0a 00 00 00       	mov    $0xa,%eax
+     a34:	e9 32 ff ff ff       	jmp    96b <syscallentry>
+
+00000a39 <getpid>:
+SYSCALL(getpid)
+     a39:	b8 0b 00 00 00       	mov    $0xb,%eax
+     a3e:	e9 28 ff ff ff       	jmp    96b <syscallentry>
+
+00000a43 <sbrk>:
+SYSCALL(sbrk)
+     a43:	b8 0c 00 00 00       	mov    $0xc,%eax
+     a48:	e9 1e ff ff ff       	jmp    96b <syscallentry>
+
+00000a4d <sleep>:
+SYSCALL(sleep)
+     a4d:	b8 0d 00 00 00       	mov    $0xd,%eax
+     a52:	e9 14 ff ff ff       	jmp    96b <syscallentry>
+
+00000a57 <uptime>:
+SYSCALL(uptime)
+     a57:	b8 0e 00 00 00       	mov    $0xe,%eax
+     a5c:	e9 0a ff ff ff       	jmp    96b <syscallentry>
+
+00000a61 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+     a61:	b8 16 00 00 00       	mov    $0x16,%eax
+     a66:	e9 00 ff ff ff       	jmp    96b <syscallentry>
+
+00000a6b <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+     a6b:	b8 17 00 00 00       	mov    $0x17,%eax
+     a70:	e9 f6 fe ff ff       	jmp    96b <syscallentry>
+
+00000a75 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+     a75:	b8 18 00 00 00       	mov    $0x18,%eax
+     a7a:	e9 ec fe ff ff       	jmp    96b <syscallentry>
+
+00000a7f <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+     a7f:	b8 19 00 00 00       	mov    $0x19,%eax
+     a84:	e9 e2 fe ff ff       	jmp    96b <syscallentry>
+
+00000a89 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+     a89:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     a8e:	e9 d8 fe ff ff       	jmp    96b <syscallentry>
+
+00000a93 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+     a93:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     a98:	e9 ce fe ff ff       	jmp    96b <syscallentry>
+
+00000a9d <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+     a9d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     aa2:	e9 c4 fe ff ff       	jmp    96b <syscallentry>
+
+00000aa7 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+     aa7:	b8 20 00 00 00       	mov    $0x20,%eax
+     aac:	e9 ba fe ff ff       	jmp    96b <syscallentry>
+
+00000ab1 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+     ab1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     ab6:	e9 b0 fe ff ff       	jmp    96b <syscallentry>
+
+00000abb <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+     abb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     ac0:	e9 a6 fe ff ff       	jmp    96b <syscallentry>
+
+00000ac5 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+     ac5:	b8 21 00 00 00       	mov    $0x21,%eax
+     aca:	e9 9c fe ff ff       	jmp    96b <syscallentry>
+
+00000acf <yield>:
+SYSCALL(yield) // yield the CPU to another process
+     acf:	b8 22 00 00 00       	mov    $0x22,%eax
+     ad4:	e9 92 fe ff ff       	jmp    96b <syscallentry>
+
+00000ad9 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+     ad9:	b8 23 00 00 00       	mov    $0x23,%eax
+     ade:	e9 88 fe ff ff       	jmp    96b <syscallentry>
+
+00000ae3 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+     ae3:	b8 24 00 00 00       	mov    $0x24,%eax
+     ae8:	e9 7e fe ff ff       	jmp    96b <syscallentry>
+
+00000aed <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+     aed:	b8 25 00 00 00       	mov    $0x25,%eax
+     af2:	e9 74 fe ff ff       	jmp    96b <syscallentry>
+
+00000af7 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+     af7:	b8 26 00 00 00       	mov    $0x26,%eax
+     afc:	e9 6a fe ff ff       	jmp    96b <syscallentry>
+
+00000b01 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+     b01:	b8 27 00 00 00       	mov    $0x27,%eax
+     b06:	e9 60 fe ff ff       	jmp    96b <syscallentry>
+
+00000b0b <mmap>:
+SYSCALL(mmap) // map a file into memory
+     b0b:	b8 28 00 00 00       	mov    $0x28,%eax
+     b10:	e9 56 fe ff ff       	jmp    96b <syscallentry>
+
+00000b15 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+     b15:	b8 29 00 00 00       	mov    $0x29,%eax
+     b1a:	e9 4c fe ff ff       	jmp    96b <syscallentry>
+
+00000b1f <readv>:
+SYSCALL(readv) // read into several buffers
+     b1f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     b24:	e9 42 fe ff ff       	jmp    96b <syscallentry>
+
+00000b29 <writev>:
+SYSCALL(writev) // write from several buffers
+     b29:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     b2e:	e9 38 fe ff ff       	jmp    96b <syscallentry>
+
+00000b33 <pread>:
+SYSCALL(pread) // read at an offset
+     b33:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     b38:	e9 2e fe ff ff       	jmp    96b <syscallentry>
+
+00000b3d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+     b3d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     b42:	e9 24 fe ff ff       	jmp    96b <syscallentry>
+
+00000b47 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+     b47:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     b4c:	e9 1a fe ff ff       	jmp    96b <syscallentry>
+
+00000b51 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+     b51:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     b56:	e9 10 fe ff ff       	jmp    96b <syscallentry>
+
+00000b5b <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+     b5b:	b8 30 00 00 00       	mov    $0x30,%eax
+     b60:	e9 06 fe ff ff       	jmp    96b <syscallentry>
+
+00000b65 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+     b65:	b8 31 00 00 00       	mov    $0x31,%eax
+     b6a:	e9 fc fd ff ff       	jmp    96b <syscallentry>
+
+00000b6f <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+     b6f:	b8 32 00 00 00       	mov    $0x32,%eax
+     b74:	e9 f2 fd ff ff       	jmp    96b <syscallentry>
+
+00000b79 <profread>:
+SYSCALL(profread) // drain profiler samples
+     b79:	b8 33 00 00 00       	mov    $0x33,%eax
+     b7e:	e9 e8 fd ff ff       	jmp    96b <syscallentry>
+
+00000b83 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+     b83:	b8 34 00 00 00       	mov    $0x34,%eax
+     b88:	e9 de fd ff ff       	jmp    96b <syscallentry>
+
+00000b8d <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+     b8d:	b8 35 00 00 00       	mov    $0x35,%eax
+     b92:	e9 d4 fd ff ff       	jmp    96b <syscallentry>
+
+00000b97 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+     b97:	b8 36 00 00 00       	mov    $0x36,%eax
+     b9c:	e9 ca fd ff ff       	jmp    96b <syscallentry>
+
+00000ba1 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+     ba1:	b8 37 00 00 00       	mov    $0x37,%eax
+     ba6:	e9 c0 fd ff ff       	jmp    96b <syscallentry>
+     bab:	66 90                	xchg   %ax,%ax
+     bad:	66 90                	xchg   %ax,%ax
+     baf:	90                   	nop
+
+00000bb0 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     bb0:	55                   	push   %ebp
+     bb1:	89 e5                	mov    %esp,%ebp
+     bb3:	57                   	push   %edi
+     bb4:	56                   	push   %esi
+     bb5:	53                   	push   %ebx
+     bb6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     bb8:	89 d1                	mov    %edx,%ecx
+{
+     bba:	83 ec 3c             	sub    $0x3c,%esp
+     bbd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     bc0:	85 d2                	test   %edx,%edx
+     bc2:	0f 89 80 00 00 00    	jns    c48 <printint+0x98>
+     bc8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     bcc:	74 7a                	je     c48 <printint+0x98>
+    x = -xx;
+     bce:	f7 d9                	neg    %ecx
+    neg = 1;
+     bd0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     bd5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     bd8:	31 f6                	xor    %esi,%esi
+     bda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     be0:	89 c8                	mov    %ecx,%eax
+     be2:	31 d2                	xor    %edx,%edx
+     be4:	89 f7                	mov    %esi,%edi
+     be6:	f7 f3                	div    %ebx
+     be8:	8d 76 01             	lea    0x1(%esi),%esi
+     beb:	0f b6 92 18 12 00 00 	movzbl 0x1218(%edx),%edx
+     bf2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     bf6:	89 ca                	mov    %ecx,%edx
+     bf8:	89 c1                	mov    %eax,%ecx
+     bfa:	39 da                	cmp    %ebx,%edx
+     bfc:	73 e2                	jae    be0 <printint+0x30>
+  if(neg)
+     bfe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     c01:	85 c0                	test   %eax,%eax
+     c03:	74 07                	je     c0c <printint+0x5c>
+    buf[i++] = '-';
+     c05:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     c0a:	89 f7                	mov    %esi,%edi
+     c0c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     c0f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     c12:	01 df                	add    %ebx,%edi
+     c14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     c18:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+     c1b:	83 ec 04             	sub    $0x4,%esp
+     c1e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     c21:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     c24:	6a 01                	push   $0x1
+     c26:	50                   	push   %eax
+     c27:	56                   	push   %esi
+     c28:	e8 e3 f6 ff ff       	call   310 <bufwrite>
+  while(--i >= 0)
+     c2d:	89 f8                	mov    %edi,%eax
+     c2f:	83 c4 10             	add    $0x10,%esp
+     c32:	83 ef 01             	sub    $0x1,%edi
+     c35:	39 d8                	cmp    %ebx,%eax
+     c37:	75 df                	jne    c18 <printint+0x68>
+}
+     c39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c3c:	5b                   	pop    %ebx
+     c3d:	5e                   	pop    %esi
+     c3e:	5f                   	pop    %edi
+     c3f:	5d                   	pop    %ebp
+     c40:	c3                   	ret
+     c41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     c48:	31 c0                	xor    %eax,%eax
+     c4a:	eb 89                	jmp    bd5 <printint+0x25>
+     c4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c50 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     c50:	55                   	push   %ebp
+     c51:	89 e5                	mov    %esp,%ebp
+     c53:	57                   	push   %edi
+     c54:	56                   	push   %esi
+     c55:	53                   	push   %ebx
+     c56:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     c59:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c5c:	0f b6 18             	movzbl (%eax),%ebx
+     c5f:	84 db                	test   %bl,%bl
+     c61:	74 6c                	je     ccf <printf+0x7f>
+     c63:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+     c66:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+     c69:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     c6b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     c6e:	eb 26                	jmp    c96 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     c70:	83 f8 25             	cmp    $0x25,%eax
+     c73:	74 4b                	je     cc0 <printf+0x70>
+  bufwrite(fd, &c, 1);
+     c75:	83 ec 04             	sub    $0x4,%esp
+     c78:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     c7b:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     c7e:	6a 01                	push   $0x1
+     c80:	50                   	push   %eax
+     c81:	ff 75 08             	push   0x8(%ebp)
+     c84:	e8 87 f6 ff ff       	call   310 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+     c89:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     c8c:	0f b6 1f             	movzbl (%edi),%ebx
+     c8f:	83 c7 01             	add    $0x1,%edi
+     c92:	84 db                	test   %bl,%bl
+     c94:	74 39                	je     ccf <printf+0x7f>
+    c = fmt[i] & 0xff;
+     c96:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     c99:	85 f6                	test   %esi,%esi
+     c9b:	74 d3                	je     c70 <printf+0x20>
+      }
+    } else if(state == '%'){
+     c9d:	83 fe 25             	cmp    $0x25,%esi
+     ca0:	75 ea                	jne    c8c <printf+0x3c>
+      if(c == 'd'){
+     ca2:	83 f8 25             	cmp    $0x25,%eax
+     ca5:	0f 84 d5 01 00 00    	je     e80 <printf+0x230>
+     cab:	83 e8 63             	sub    $0x63,%eax
+     cae:	83 f8 15             	cmp    $0x15,%eax
+     cb1:	77 45                	ja     cf8 <printf+0xa8>
+     cb3:	ff 24 85 c0 11 00 00 	jmp    *0x11c0(,%eax,4)
+     cba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     cc0:	0f b6 1f             	movzbl (%edi),%ebx
+     cc3:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+     cc6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     ccb:	84 db                	test   %bl,%bl
+     ccd:	75 c7                	jne    c96 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+     ccf:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+     cd3:	74 0b                	je     ce0 <printf+0x90>
+    fflush(fd);
+}
+     cd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cd8:	5b                   	pop    %ebx
+     cd9:	5e                   	pop    %esi
+     cda:	5f                   	pop    %edi
+     cdb:	5d                   	pop    %ebp
+     cdc:	c3                   	ret
+     cdd:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+     ce0:	83 ec 0c             	sub    $0xc,%esp
+     ce3:	6a 02                	push   $0x2
+     ce5:	e8 c6 f7 ff ff       	call   4b0 <fflush>
+     cea:	83 c4 10             	add    $0x10,%esp
+}
+     ced:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cf0:	5b                   	pop    %ebx
+     cf1:	5e                   	pop    %esi
+     cf2:	5f                   	pop    %edi
+     cf3:	5d                   	pop    %ebp
+     cf4:	c3                   	ret
+     cf5:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+     cf8:	83 ec 04             	sub    $0x4,%esp
+     cfb:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     cfe:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+     d02:	6a 01                	push   $0x1
+     d04:	52                   	push   %edx
+     d05:	89 55 c0             	mov    %edx,-0x40(%ebp)
+     d08:	ff 75 08             	push   0x8(%ebp)
+     d0b:	e8 00 f6 ff ff       	call   310 <bufwrite>
+     d10:	83 c4 0c             	add    $0xc,%esp
+     d13:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     d16:	6a 01                	push   $0x1
+     d18:	8b 55 c0             	mov    -0x40(%ebp),%edx
+     d1b:	52                   	push   %edx
+      state = 0;
+     d1c:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+     d1e:	ff 75 08             	push   0x8(%ebp)
+     d21:	e8 ea f5 ff ff       	call   310 <bufwrite>
+        putc(fd, c);
+     d26:	83 c4 10             	add    $0x10,%esp
+     d29:	e9 5e ff ff ff       	jmp    c8c <printf+0x3c>
+     d2e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+     d30:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     d33:	83 ec 0c             	sub    $0xc,%esp
+     d36:	b9 10 00 00 00       	mov    $0x10,%ecx
+     d3b:	8b 16                	mov    (%esi),%edx
+     d3d:	6a 00                	push   $0x0
+     d3f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+     d42:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+     d45:	e8 66 fe ff ff       	call   bb0 <printint>
+        ap++;
+     d4a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     d4d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d50:	31 f6                	xor    %esi,%esi
+     d52:	e9 35 ff ff ff       	jmp    c8c <printf+0x3c>
+     d57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d5e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     d60:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     d63:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     d65:	83 c0 04             	add    $0x4,%eax
+     d68:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+     d6b:	b8 b6 11 00 00       	mov    $0x11b6,%eax
+     d70:	85 db                	test   %ebx,%ebx
+     d72:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+     d75:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+     d78:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+     d7a:	53                   	push   %ebx
+     d7b:	e8 90 f9 ff ff       	call   710 <strlen>
+     d80:	83 c4 0c             	add    $0xc,%esp
+     d83:	50                   	push   %eax
+     d84:	53                   	push   %ebx
+     d85:	ff 75 08             	push   0x8(%ebp)
+     d88:	e8 83 f5 ff ff       	call   310 <bufwrite>
+     d8d:	83 c4 10             	add    $0x10,%esp
+     d90:	e9 f7 fe ff ff       	jmp    c8c <printf+0x3c>
+     d95:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+     d98:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+     d9b:	83 ec 04             	sub    $0x4,%esp
+     d9e:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+     da1:	8b 06                	mov    (%esi),%eax
+        ap++;
+     da3:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+     da6:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+     da9:	6a 01                	push   $0x1
+     dab:	52                   	push   %edx
+     dac:	ff 75 08             	push   0x8(%ebp)
+     daf:	e8 5c f5 ff ff       	call   310 <bufwrite>
+        ap++;
+     db4:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     db7:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     dba:	31 f6                	xor    %esi,%esi
+     dbc:	e9 cb fe ff ff       	jmp    c8c <printf+0x3c>
+     dc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+     dc8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     dcb:	83 ec 0c             	sub    $0xc,%esp
+     dce:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     dd3:	8b 16                	mov    (%esi),%edx
+     dd5:	6a 01                	push   $0x1
+     dd7:	e9 63 ff ff ff       	jmp    d3f <printf+0xef>
+     ddc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+     de0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     de3:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     de6:	89 7d c0             	mov    %edi,-0x40(%ebp)
+     de9:	89 55 bc             	mov    %edx,-0x44(%ebp)
+     dec:	8b 18                	mov    (%eax),%ebx
+     dee:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+     df1:	31 c0                	xor    %eax,%eax
+     df3:	89 c7                	mov    %eax,%edi
+     df5:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+     df8:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+     dfd:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+     dff:	f7 e1                	mul    %ecx
+     e01:	c1 ea 03             	shr    $0x3,%edx
+     e04:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     e07:	89 d1                	mov    %edx,%ecx
+     e09:	01 c0                	add    %eax,%eax
+     e0b:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     e0d:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+     e0f:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+     e11:	be 0a 00 00 00       	mov    $0xa,%esi
+     e16:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+     e18:	89 da                	mov    %ebx,%edx
+     e1a:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+     e1c:	89 fe                	mov    %edi,%esi
+     e1e:	83 c7 01             	add    $0x1,%edi
+     e21:	8d 42 30             	lea    0x30(%edx),%eax
+     e24:	89 da                	mov    %ebx,%edx
+     e26:	8d 14 92             	lea    (%edx,%edx,4),%edx
+     e29:	01 d2                	add    %edx,%edx
+     e2b:	29 d0                	sub    %edx,%eax
+     e2d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+     e31:	89 c8                	mov    %ecx,%eax
+     e33:	09 d8                	or     %ebx,%eax
+     e35:	75 c1                	jne    df8 <printf+0x1a8>
+     e37:	8b 55 bc             	mov    -0x44(%ebp),%edx
+     e3a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     e3d:	01 d6                	add    %edx,%esi
+     e3f:	89 f7                	mov    %esi,%edi
+     e41:	89 d6                	mov    %edx,%esi
+     e43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e47:	90                   	nop
+    putc(fd, buf[i]);
+     e48:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+     e4b:	83 ec 04             	sub    $0x4,%esp
+     e4e:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+     e51:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+     e54:	6a 01                	push   $0x1
+     e56:	50                   	push   %eax
+     e57:	53                   	push   %ebx
+     e58:	e8 b3 f4 ff ff       	call   310 <bufwrite>
+  while(--i >= 0)
+     e5d:	89 fa                	mov    %edi,%edx
+     e5f:	83 c4 10             	add    $0x10,%esp
+     e62:	83 ef 01             	sub    $0x1,%edi
+     e65:	39 d6                	cmp    %edx,%esi
+     e67:	75 df                	jne    e48 <printf+0x1f8>
+        ap += 2;
+     e69:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+     e6d:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+     e70:	31 f6                	xor    %esi,%esi
+     e72:	e9 15 fe ff ff       	jmp    c8c <printf+0x3c>
+     e77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e7e:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+     e80:	83 ec 04             	sub    $0x4,%esp
+     e83:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+     e86:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+     e89:	6a 01                	push   $0x1
+     e8b:	e9 8b fe ff ff       	jmp    d1b <printf+0xcb>
+
+00000e90 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     e90:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e91:	a1 c0 67 01 00       	mov    0x167c0,%eax
+{
+     e96:	89 e5                	mov    %esp,%ebp
+     e98:	57                   	push   %edi
+     e99:	56                   	push   %esi
+     e9a:	53                   	push   %ebx
+     e9b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     e9e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     ea1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ea8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     eaa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     eac:	39 ca                	cmp    %ecx,%edx
+     eae:	73 30                	jae    ee0 <free+0x50>
+     eb0:	39 c1                	cmp    %eax,%ecx
+     eb2:	72 04                	jb     eb8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     eb4:	39 c2                	cmp    %eax,%edx
+     eb6:	72 f0                	jb     ea8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     eb8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     ebb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     ebe:	39 f8                	cmp    %edi,%eax
+     ec0:	74 2e                	je     ef0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     ec2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     ec5:	8b 42 04             	mov    0x4(%edx),%eax
+     ec8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     ecb:	39 f1                	cmp    %esi,%ecx
+     ecd:	74 38                	je     f07 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     ecf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     ed1:	5b                   	pop    %ebx
+  freep = p;
+     ed2:	89 15 c0 67 01 00    	mov    %edx,0x167c0
+}
+     ed8:	5e                   	pop    %esi
+     ed9:	5f                   	pop    %edi
+     eda:	5d                   	pop    %ebp
+     edb:	c3                   	ret
+     edc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     ee0:	39 c1                	cmp    %eax,%ecx
+     ee2:	72 d0                	jb     eb4 <free+0x24>
+     ee4:	eb c2                	jmp    ea8 <free+0x18>
+     ee6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eed:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+     ef0:	03 70 04             	add    0x4(%eax),%esi
+     ef3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     ef6:	8b 02                	mov    (%edx),%eax
+     ef8:	8b 00                	mov    (%eax),%eax
+     efa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     efd:	8b 42 04             	mov    0x4(%edx),%eax
+     f00:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     f03:	39 f1                	cmp    %esi,%ecx
+     f05:	75 c8                	jne    ecf <free+0x3f>
+    p->s.size += bp->s.size;
+     f07:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     f0a:	89 15 c0 67 01 00    	mov    %edx,0x167c0
+    p->s.size += bp->s.size;
+     f10:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     f13:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     f16:	89 0a                	mov    %ecx,(%edx)
+}
+     f18:	5b                   	pop    %ebx
+     f19:	5e                   	pop    %esi
+     f1a:	5f                   	pop    %edi
+     f1b:	5d                   	pop    %ebp
+     f1c:	c3                   	ret
+     f1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f20 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     f20:	55                   	push   %ebp
+     f21:	89 e5                	mov    %esp,%ebp
+     f23:	57                   	push   %edi
+     f24:	56                   	push   %esi
+     f25:	53                   	push   %ebx
+     f26:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f29:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+     f2c:	8b 15 c0 67 01 00    	mov    0x167c0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f32:	8d 78 07             	lea    0x7(%eax),%edi
+     f35:	c1 ef 03             	shr    $0x3,%edi
+     f38:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+     f3b:	85 d2                	test   %edx,%edx
+     f3d:	0f 84 8d 00 00 00    	je     fd0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f43:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     f45:	8b 48 04             	mov    0x4(%eax),%ecx
+     f48:	39 f9                	cmp    %edi,%ecx
+     f4a:	73 64                	jae    fb0 <malloc+0x90>
+  if(nu < 4096)
+     f4c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     f51:	39 df                	cmp    %ebx,%edi
+     f53:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     f56:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     f5d:	eb 0a                	jmp    f69 <malloc+0x49>
+     f5f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f60:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     f62:	8b 48 04             	mov    0x4(%eax),%ecx
+     f65:	39 f9                	cmp    %edi,%ecx
+     f67:	73 47                	jae    fb0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     f69:	89 c2                	mov    %eax,%edx
+     f6b:	39 05 c0 67 01 00    	cmp    %eax,0x167c0
+     f71:	75 ed                	jne    f60 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+     f73:	83 ec 0c             	sub    $0xc,%esp
+     f76:	56                   	push   %esi
+     f77:	e8 c7 fa ff ff       	call   a43 <sbrk>
+  if(p == (char*)-1)
+     f7c:	83 c4 10             	add    $0x10,%esp
+     f7f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f82:	74 1c                	je     fa0 <malloc+0x80>
+  hp->s.size = nu;
+     f84:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+     f87:	83 ec 0c             	sub    $0xc,%esp
+     f8a:	83 c0 08             	add    $0x8,%eax
+     f8d:	50                   	push   %eax
+     f8e:	e8 fd fe ff ff       	call   e90 <free>
+  return freep;
+     f93:	8b 15 c0 67 01 00    	mov    0x167c0,%edx
+      if((p = morecore(nunits)) == 0)
+     f99:	83 c4 10             	add    $0x10,%esp
+     f9c:	85 d2                	test   %edx,%edx
+     f9e:	75 c0                	jne    f60 <malloc+0x40>
+        return 0;
+  }
+}
+     fa0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     fa3:	31 c0                	xor    %eax,%eax
+}
+     fa5:	5b                   	pop    %ebx
+     fa6:	5e                   	pop    %esi
+     fa7:	5f                   	pop    %edi
+     fa8:	5d                   	pop    %ebp
+     fa9:	c3                   	ret
+     faa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     fb0:	39 cf                	cmp    %ecx,%edi
+     fb2:	74 4c                	je     1000 <malloc+0xe0>
+        p->s.size -= nunits;
+     fb4:	29 f9                	sub    %edi,%ecx
+     fb6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+     fb9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+     fbc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+     fbf:	89 15 c0 67 01 00    	mov    %edx,0x167c0
+}
+     fc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+     fc8:	83 c0 08             	add    $0x8,%eax
+}
+     fcb:	5b                   	pop    %ebx
+     fcc:	5e                   	pop    %esi
+     fcd:	5f                   	pop    %edi
+     fce:	5d                   	pop    %ebp
+     fcf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+     fd0:	c7 05 c0 67 01 00 c4 	movl   $0x167c4,0x167c0
+     fd7:	67 01 00 
+    base.s.size = 0;
+     fda:	b8 c4 67 01 00       	mov    $0x167c4,%eax
+    base.s.ptr = freep = prevp = &base;
+     fdf:	c7 05 c4 67 01 00 c4 	movl   $0x167c4,0x167c4
+     fe6:	67 01 00 
+    base.s.size = 0;
+     fe9:	c7 05 c8 67 01 00 00 	movl   $0x0,0x167c8
+     ff0:	00 00 00 
+    if(p->s.size >= nunits){
+     ff3:	e9 54 ff ff ff       	jmp    f4c <malloc+0x2c>
+     ff8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fff:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1000:	8b 08                	mov    (%eax),%ecx
+    1002:	89 0a                	mov    %ecx,(%edx)
+    1004:	eb b9                	jmp    fbf <malloc+0x9f>
+    1006:	66 90                	xchg   %ax,%ax
+    1008:	66 90                	xchg   %ax,%ax
+    100a:	66 90                	xchg   %ax,%ax
+    100c:	66 90                	xchg   %ax,%ax
+    100e:	66 90                	xchg   %ax,%ax
+
+00001010 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+    1010:	55                   	push   %ebp
+    1011:	89 e5                	mov    %esp,%ebp
+    1013:	57                   	push   %edi
+    1014:	56                   	push   %esi
+    1015:	be 01 00 00 00       	mov    $0x1,%esi
+    101a:	53                   	push   %ebx
+    101b:	83 ec 28             	sub    $0x28,%esp
+    101e:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1021:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1024:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+    1027:	68 00 98 00 00       	push   $0x9800
+    102c:	e8 ef fe ff ff       	call   f20 <malloc>
+    1031:	83 c4 10             	add    $0x10,%esp
+    1034:	89 c7                	mov    %eax,%edi
+    1036:	85 c0                	test   %eax,%eax
+    1038:	74 62                	je     109c <waitpoll+0x8c>
+    103a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+    1040:	83 ec 0c             	sub    $0xc,%esp
+    1043:	6a 01                	push   $0x1
+    1045:	e8 03 fa ff ff       	call   a4d <sleep>
+    fn();
+    104a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    104d:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+    104f:	58                   	pop    %eax
+    1050:	5a                   	pop    %edx
+    1051:	68 00 02 00 00       	push   $0x200
+    1056:	57                   	push   %edi
+    1057:	e8 eb fa ff ff       	call   b47 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+    105c:	83 c4 10             	add    $0x10,%esp
+    105f:	85 c0                	test   %eax,%eax
+    1061:	7e 2d                	jle    1090 <waitpoll+0x80>
+    1063:	6b c0 4c             	imul   $0x4c,%eax,%eax
+    1066:	89 fa                	mov    %edi,%edx
+    alive = 0;
+    1068:	31 c9                	xor    %ecx,%ecx
+    106a:	01 f8                	add    %edi,%eax
+    106c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+    1070:	3b 1a                	cmp    (%edx),%ebx
+    1072:	75 07                	jne    107b <waitpoll+0x6b>
+        alive = 1;
+    1074:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+    1078:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+    107b:	83 c2 4c             	add    $0x4c,%edx
+    107e:	39 d0                	cmp    %edx,%eax
+    1080:	75 ee                	jne    1070 <waitpoll+0x60>
+  } while(alive);
+    1082:	85 c9                	test   %ecx,%ecx
+    1084:	75 ba                	jne    1040 <waitpoll+0x30>
+    1086:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    108d:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+    1090:	83 ec 0c             	sub    $0xc,%esp
+    1093:	57                   	push   %edi
+    1094:	e8 f7 fd ff ff       	call   e90 <free>
+  wait();
+    1099:	83 c4 10             	add    $0x10,%esp
+}
+    109c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    109f:	5b                   	pop    %ebx
+    10a0:	5e                   	pop    %esi
+    10a1:	5f                   	pop    %edi
+    10a2:	5d                   	pop    %ebp
+  wait();
+    10a3:	e9 10 f9 ff ff       	jmp    9b8 <wait>
+    10a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10af:	90                   	nop
+
+000010b0 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+    10b0:	55                   	push   %ebp
+    10b1:	89 e5                	mov    %esp,%ebp
+    10b3:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+    10b6:	c7 45 f0 29 12 00 00 	movl   $0x1229,-0x10(%ebp)
+    10bd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+    10c4:	e8 87 f4 ff ff       	call   550 <fork>
+    10c9:	85 c0                	test   %eax,%eax
+    10cb:	78 09                	js     10d6 <runps+0x26>
+    return -1;
+  if(pid == 0){
+    10cd:	74 0e                	je     10dd <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+    10cf:	e8 e4 f8 ff ff       	call   9b8 <wait>
+}
+    10d4:	c9                   	leave
+    10d5:	c3                   	ret
+    10d6:	c9                   	leave
+    return -1;
+    10d7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    10dc:	c3                   	ret
+    exec("ps", argv);
+    10dd:	50                   	push   %eax
+    10de:	50                   	push   %eax
+    10df:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    10e2:	50                   	push   %eax
+    10e3:	68 29 12 00 00       	push   $0x1229
+    10e8:	e8 c3 f4 ff ff       	call   5b0 <exec>
+    printf(2, "exec ps failed\n");
+    10ed:	5a                   	pop    %edx
+    10ee:	59                   	pop    %ecx
+    10ef:	68 2c 12 00 00       	push   $0x122c
+    10f4:	6a 02                	push   $0x2
+    10f6:	e8 55 fb ff ff       	call   c50 <printf>
+    exit();
+    10fb:	e8 a0 f4 ff ff       	call   5a0 <exit>
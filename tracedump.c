@@ -0,0 +1,105 @@
+// Trace the kernel while a command runs, then print what each
+// CPU did, in time order: switches, wakeups, forks, exits,
+// system calls and timer interrupts.
+//
+// usage: tracedump [command [args...]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "x86.h"
+#include "trace.h"
+
+#define MAXEV 4096
+#define NELEM(x) (sizeof(x)/sizeof((x)[0]))
+
+struct traceev ev[MAXEV];
+int nev, dropped;
+
+char *names[] = {
+  [TR_SWITCHIN]  "switch in",
+  [TR_SWITCHOUT] "switch out",
+  [TR_WAKEUP]    "wakeup by",
+  [TR_FORK]      "fork",
+  [TR_EXIT]      "exit",
+  [TR_SYSCALL]   "syscall",
+  [TR_SYSRET]    "sysret",
+  [TR_TIMER]     "timer",
+  [TR_LOST]      "lost",
+};
+
+// Move what the kernel has into ev[], counting what does not fit.
+void
+drain(void)
+{
+  struct traceev tmp[64];
+  int n;
+
+  while((n = traceread(tmp, NELEM(tmp))) > 0){
+    if(nev + n > MAXEV){
+      dropped += nev + n - MAXEV;
+      n = MAXEV - nev;
+    }
+    memmove(&ev[nev], tmp, n * sizeof(tmp[0]));
+    nev += n;
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct traceev *e;
+  uint64 t0;
+  uint khz;
+  int pid, cpu, i;
+
+  drain();
+  nev = 0;
+  khz = tracectl(1);
+  if(argc > 1){
+    if((pid = fork()) < 0){
+      printf(2, "tracedump: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      exec(argv[1], argv + 1);
+      printf(2, "tracedump: exec %s failed\n", argv[1]);
+      exit();
+    }
+    waitpoll(pid, drain);
+  } else
+    sleep(10);
+  tracectl(0);
+  drain();
+
+  if(nev == 0)
+    exit();
+  t0 = ev[0].tsc;
+  for(i = 1; i < nev; i++)
+    if(ev[i].tsc < t0)
+      t0 = ev[i].tsc;
+  for(cpu = 0; cpu < NCPU; cpu++){
+    for(i = 0; i < nev; i++)
+      if(ev[i].cpu == cpu)
+        break;
+    if(i == nev)
+      continue;
+    printf(1, "cpu%d:\n", cpu);
+    for(; i < nev; i++){
+      e = &ev[i];
+      if(e->cpu != cpu)
+        continue;
+      printf(1, "%d us\tpid %d\t%s", (uint)div64((e->tsc - t0) * 1000, khz),
+             e->pid, e->type < NELEM(names) && names[e->type] ? names[e->type] : "?");
+      if(e->type == TR_WAKEUP || e->type == TR_FORK ||
+         e->type == TR_SYSCALL || e->type == TR_SYSRET ||
+         e->type == TR_LOST)
+        printf(1, " %d", e->arg);
+      printf(1, "\n");
+    }
+  }
+  if(dropped)
+    printf(1, "tracedump: %d events did not fit\n", dropped);
+  exit();
+}
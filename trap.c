@@ -7,6 +7,7 @@
 #include "x86.h"
 #include "traps.h"
 #include "spinlock.h"
+#include "trace.h"
 
 #define QUANTUM 5  // Default time slice of 5 ticks if not defined elsewhere
 
@@ -14,6 +15,7 @@
 // Interrupt descriptor table (shared by all CPUs).
 struct gatedesc idt[256];
 extern uint vectors[];  // in vectors.S: array of 256 entry pointers
+extern char sysenter_entry[];  // in trapasm.S
 struct spinlock tickslock;
 uint ticks;
 
@@ -35,6 +37,23 @@ idtinit(void)
   lidt(idt, sizeof(idt));
 }
 
+// Point this CPU's sysenter at sysenter_entry, if it has one.
+// The %esp it loads is the address of the CPU's ts.esp0, which
+// switchuvm() keeps at the top of the running process's kernel
+// stack; sysenter_entry loads its real stack from there.
+void
+sysenterinit(void)
+{
+  uint eax, ebx, ecx, edx;
+
+  cpuinfo(1, &eax, &ebx, &ecx, &edx);
+  if((edx & CPUID_SEP) == 0)
+    return;
+  wrmsr(MSR_SYSENTER_CS, SEG_KCODE<<3);
+  wrmsr(MSR_SYSENTER_ESP, (uint)&mycpu()->ts.esp0);
+  wrmsr(MSR_SYSENTER_EIP, (uint)sysenter_entry);
+}
+
 //PAGEBREAK: 41
 void
 trap(struct trapframe *tf)
@@ -51,6 +70,12 @@ trap(struct trapframe *tf)
 
   switch(tf->trapno){
   case T_IRQ0 + IRQ_TIMER:
+    if(proftick(tf)){
+      // A profiler sample between clock ticks.
+      lapiceoi();
+      return;
+    }
+    trace(TR_TIMER, myproc() ? myproc()->pid : 0, 0);
     if(cpuid() == 0){
       acquire(&tickslock);
       ticks++;
@@ -81,6 +106,13 @@ trap(struct trapframe *tf)
     lapiceoi();
     break;
 
+  case T_PGFLT:
+    // Fault in a page of an mmap()ed file.
+    if(myproc() && (tf->cs&3) == DPL_USER &&
+       mmapfault(myproc(), rcr2(), tf->err & 2) == 0)
+      break;
+    // fall through
+
   //PAGEBREAK: 13
   default:
     if(myproc() == 0 || (tf->cs&3) == 0){
@@ -107,7 +139,6 @@ trap(struct trapframe *tf)
   // If interrupts were on while locks held, would need to check nlock.
   if(myproc() && myproc()->state == RUNNING &&
      tf->trapno == T_IRQ0+IRQ_TIMER) {
-    myproc()->runtime++;
     myproc()->last_burst_ticks++;
     
     // Increment the ticks counter for this time slice
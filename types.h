@@ -3,3 +3,4 @@ typedef unsigned short ushort;
 typedef unsigned char  uchar;
 typedef unsigned long long uint64;  // Add this line
 typedef uint pde_t;
+typedef uint pte_t;
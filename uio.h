@@ -0,0 +1,7 @@
+// One buffer of a readv() or writev().
+struct iovec {
+  void *base;
+  int len;
+};
+
+#define NIOV 16  // max buffers per readv() or writev()
@@ -3,6 +3,107 @@
 #include "fcntl.h"
 #include "user.h"
 #include "x86.h"
+#include "uio.h"
+
+// Output buffers for printf() and bufwrite(), one per fd.
+// Console output is sent at each newline, other output when
+// the buffer fills; fflush() sends it at once. Everything is
+// flushed before fork(), exec(), exit() and reads by gets(),
+// and an fd's buffer before close().
+
+#define NOBUF  16   // fds with buffers
+#define OBUFSZ 256
+
+enum { UNKNOWN, LINEBUF, FULLBUF };
+
+static struct {
+  int mode;
+  int n;
+  char buf[OBUFSZ];
+} ob[NOBUF];
+
+int _fork(void);
+int _exit(void) __attribute__((noreturn));
+int _close(int);
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+    iov[0].len = ob[fd].n;
+    iov[1].base = (void*)p;
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+  ob[fd].n += n;
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+    fflush(fd);
+}
+
+void
+fflush(int fd)
+{
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+    write(fd, ob[fd].buf, ob[fd].n);
+    ob[fd].n = 0;
+  }
+}
+
+void
+fflushall(void)
+{
+  int fd;
+
+  for(fd = 0; fd < NOBUF; fd++)
+    fflush(fd);
+}
+
+int
+fork(void)
+{
+  fflushall();
+  return _fork();
+}
+
+int
+exit(void)
+{
+  fflushall();
+  _exit();
+}
+
+int
+exec(char *path, char **argv)
+{
+  fflushall();
+  return _exec(path, argv);
+}
+
+int
+close(int fd)
+{
+  fflush(fd);
+  if(fd >= 0 && fd < NOBUF)
+    ob[fd].mode = UNKNOWN;
+  return _close(fd);
+}
 
 char*
 strcpy(char *s, const char *t)
@@ -49,12 +150,24 @@ strchr(const char *s, char c)
   return 0;
 }
 
+void*
+memchr(const void *s, int c, uint n)
+{
+  const char *p;
+
+  for(p = s; n > 0; p++, n--)
+    if(*p == (char)c)
+      return (void*)p;
+  return 0;
+}
+
 char*
 gets(char *buf, int max)
 {
   int i, cc;
   char c;
 
+  fflushall();  // show any prompt
   for(i=0; i+1 < max; ){
     cc = read(0, &c, 1);
     if(cc < 1)
@@ -0,0 +1,50 @@
+// Helpers for user programs that watch other processes.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "procinfo.h"
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+    fn();
+    n = getprocinfo(pi, NPROC);
+    alive = 0;
+    for(i = 0; i < n; i++)
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+        alive = 1;
+  } while(alive);
+  free(pi);
+  wait();
+}
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+  char *argv[] = { "ps", 0 };
+  int pid;
+
+  if((pid = fork()) < 0)
+    return -1;
+  if(pid == 0){
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+}
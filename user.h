@@ -1,5 +1,13 @@
 struct stat;
 struct rtcdate;
+struct logstat;
+struct icachestat;
+struct iovec;
+struct procinfo;
+struct schedlat;
+struct traceev;
+struct profsample;
+struct lockstat;
 struct sysinfo; // Add if you have sysinfo struct
 
 // system calls
@@ -26,19 +34,43 @@ int sleep(int);
 int uptime(void);
 int get_uncle_count(int);
 int getprocessinfo(int);
-int waitx(int*, int*); // Add if not present
+int waitx(uint64*, uint64*); // wait and run time, in microseconds
 int setschedpolicy(int);
 int set_priority(int); // Add this line if not present
-int ps(void);  // Add ps system call declaration
 int test_rr(int);  // Test RR with n processes
 int set_burst_estimate(int); // Add this with the other system call declarations
 int yield(void); // Add this with other system call declarations
+int setidemode(int);
+int logstat(struct logstat*);
+int fsync(int);
+int copy_file_range(int, int, int);
+int icachestat(struct icachestat*);
+void* mmap(int, int, int, int, int);
+int munmap(void*, int);
+int readv(int, struct iovec*, int);
+int writev(int, struct iovec*, int);
+int pread(int, void*, int, int);
+int pwrite(int, void*, int, int);
+int getprocinfo(struct procinfo*, int);
+int schedlat(struct schedlat*, int);
+int tracectl(int);
+int traceread(struct traceev*, int);
+int profctl(int);
+int profread(struct profsample*, int);
+int lockstat(struct lockstat*, int, int);
+int lockbench(int);
+int fsfree(void);
+int mkhdir(const char*);
 
 // ulib.c
 int stat(const char*, struct stat*);
+void bufwrite(int, const void*, int);
+void fflush(int);
+void fflushall(void);
 char* strcpy(char*, const char*);
 void *memmove(void*, const void*, int);
 char* strchr(const char*, char c);
+void* memchr(const void*, int, uint);
 int strcmp(const char*, const char*);
 void printf(int, const char*, ...);
 char* gets(char*, int max);
@@ -53,6 +85,8 @@ int get_uncle_count(int pid); // New function to get the uncle count
 int get_process_lifetime(int pid);
 int getnumsyscalls(void);
 int getnumsyscallsgood(void);
+int runps(void);
+void waitpoll(int, void (*)(void));
 
 
 
@@ -0,0 +1,7664 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+      11:	68 06 58 00 00       	push   $0x5806
+      16:	6a 01                	push   $0x1
+      18:	e8 93 42 00 00       	call   42b0 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+      1d:	59                   	pop    %ecx
+      1e:	58                   	pop    %eax
+      1f:	6a 00                	push   $0x0
+      21:	68 1a 58 00 00       	push   $0x581a
+      26:	e8 1e 40 00 00       	call   4049 <open>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	85 c0                	test   %eax,%eax
+      30:	78 13                	js     45 <main+0x45>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+      32:	52                   	push   %edx
+      33:	52                   	push   %edx
+      34:	68 f8 5f 00 00       	push   $0x5ff8
+      39:	6a 01                	push   $0x1
+      3b:	e8 70 42 00 00       	call   42b0 <printf>
+    exit();
+      40:	e8 bb 3b 00 00       	call   3c00 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+      45:	50                   	push   %eax
+      46:	50                   	push   %eax
+      47:	68 00 02 00 00       	push   $0x200
+      4c:	68 1a 58 00 00       	push   $0x581a
+      51:	e8 f3 3f 00 00       	call   4049 <open>
+      56:	89 04 24             	mov    %eax,(%esp)
+      59:	e8 12 3c 00 00       	call   3c70 <close>
+
+  argptest();
+      5e:	e8 7d 38 00 00       	call   38e0 <argptest>
+  createdelete();
+      63:	e8 b8 11 00 00       	call   1220 <createdelete>
+  linkunlink();
+      68:	e8 53 1a 00 00       	call   1ac0 <linkunlink>
+  concreate();
+      6d:	e8 4e 17 00 00       	call   17c0 <concreate>
+  fourfiles();
+      72:	e8 a9 0f 00 00       	call   1020 <fourfiles>
+  sharedfd();
+      77:	e8 e4 0d 00 00       	call   e60 <sharedfd>
+
+  bigargtest();
+      7c:	e8 0f 32 00 00       	call   3290 <bigargtest>
+  bigwrite();
+      81:	e8 5a 23 00 00       	call   23e0 <bigwrite>
+  bigargtest();
+      86:	e8 05 32 00 00       	call   3290 <bigargtest>
+  bsstest();
+      8b:	e8 90 31 00 00       	call   3220 <bsstest>
+  sbrktest();
+      90:	e8 8b 2c 00 00       	call   2d20 <sbrktest>
+  validatetest();
+      95:	e8 d6 30 00 00       	call   3170 <validatetest>
+
+  opentest();
+      9a:	e8 61 03 00 00       	call   400 <opentest>
+  writetest();
+      9f:	e8 ec 03 00 00       	call   490 <writetest>
+  writetest1();
+      a4:	e8 c7 05 00 00       	call   670 <writetest1>
+  createtest();
+      a9:	e8 82 07 00 00       	call   830 <createtest>
+
+  openiputtest();
+      ae:	e8 4d 02 00 00       	call   300 <openiputtest>
+  exitiputtest();
+      b3:	e8 48 01 00 00       	call   200 <exitiputtest>
+  iputtest();
+      b8:	e8 63 00 00 00       	call   120 <iputtest>
+
+  mem();
+      bd:	e8 ce 0c 00 00       	call   d90 <mem>
+  pipe1();
+      c2:	e8 49 09 00 00       	call   a10 <pipe1>
+  preempt();
+      c7:	e8 e4 0a 00 00       	call   bb0 <preempt>
+  exitwait();
+      cc:	e8 3f 0c 00 00       	call   d10 <exitwait>
+
+  rmdot();
+      d1:	e8 fa 26 00 00       	call   27d0 <rmdot>
+  fourteen();
+      d6:	e8 b5 25 00 00       	call   2690 <fourteen>
+  bigfile();
+      db:	e8 e0 23 00 00       	call   24c0 <bigfile>
+  subdir();
+      e0:	e8 1b 1c 00 00       	call   1d00 <subdir>
+  linktest();
+      e5:	e8 c6 14 00 00       	call   15b0 <linktest>
+  unlinkread();
+      ea:	e8 31 13 00 00       	call   1420 <unlinkread>
+  dirfile();
+      ef:	e8 5c 28 00 00       	call   2950 <dirfile>
+  iref();
+      f4:	e8 57 2a 00 00       	call   2b50 <iref>
+  forktest();
+      f9:	e8 72 2b 00 00       	call   2c70 <forktest>
+  bigdir(); // slow
+      fe:	e8 cd 1a 00 00       	call   1bd0 <bigdir>
+  mmaptest();
+     103:	e8 58 34 00 00       	call   3560 <mmaptest>
+
+  uio();
+     108:	e8 63 37 00 00       	call   3870 <uio>
+
+  exectest();
+     10d:	e8 ae 08 00 00       	call   9c0 <exectest>
+
+  exit();
+     112:	e8 e9 3a 00 00       	call   3c00 <exit>
+     117:	66 90                	xchg   %ax,%ax
+     119:	66 90                	xchg   %ax,%ax
+     11b:	66 90                	xchg   %ax,%ax
+     11d:	66 90                	xchg   %ax,%ax
+     11f:	90                   	nop
+
+00000120 <iputtest>:
+{
+     120:	55                   	push   %ebp
+     121:	89 e5                	mov    %esp,%ebp
+     123:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+     126:	68 f4 47 00 00       	push   $0x47f4
+     12b:	ff 35 84 6b 00 00    	push   0x6b84
+     131:	e8 7a 41 00 00       	call   42b0 <printf>
+  if(mkdir("iputdir") < 0){
+     136:	c7 04 24 87 47 00 00 	movl   $0x4787,(%esp)
+     13d:	e8 39 3f 00 00       	call   407b <mkdir>
+     142:	83 c4 10             	add    $0x10,%esp
+     145:	85 c0                	test   %eax,%eax
+     147:	78 58                	js     1a1 <iputtest+0x81>
+  if(chdir("iputdir") < 0){
+     149:	83 ec 0c             	sub    $0xc,%esp
+     14c:	68 87 47 00 00       	push   $0x4787
+     151:	e8 2f 3f 00 00       	call   4085 <chdir>
+     156:	83 c4 10             	add    $0x10,%esp
+     159:	85 c0                	test   %eax,%eax
+     15b:	0f 88 85 00 00 00    	js     1e6 <iputtest+0xc6>
+  if(unlink("../iputdir") < 0){
+     161:	83 ec 0c             	sub    $0xc,%esp
+     164:	68 84 47 00 00       	push   $0x4784
+     169:	e8 ef 3e 00 00       	call   405d <unlink>
+     16e:	83 c4 10             	add    $0x10,%esp
+     171:	85 c0                	test   %eax,%eax
+     173:	78 5a                	js     1cf <iputtest+0xaf>
+  if(chdir("/") < 0){
+     175:	83 ec 0c             	sub    $0xc,%esp
+     178:	68 a9 47 00 00       	push   $0x47a9
+     17d:	e8 03 3f 00 00       	call   4085 <chdir>
+     182:	83 c4 10             	add    $0x10,%esp
+     185:	85 c0                	test   %eax,%eax
+     187:	78 2f                	js     1b8 <iputtest+0x98>
+  printf(stdout, "iput test ok\n");
+     189:	83 ec 08             	sub    $0x8,%esp
+     18c:	68 2c 48 00 00       	push   $0x482c
+     191:	ff 35 84 6b 00 00    	push   0x6b84
+     197:	e8 14 41 00 00       	call   42b0 <printf>
+}
+     19c:	83 c4 10             	add    $0x10,%esp
+     19f:	c9                   	leave
+     1a0:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     1a1:	50                   	push   %eax
+     1a2:	50                   	push   %eax
+     1a3:	68 60 47 00 00       	push   $0x4760
+     1a8:	ff 35 84 6b 00 00    	push   0x6b84
+     1ae:	e8 fd 40 00 00       	call   42b0 <printf>
+    exit();
+     1b3:	e8 48 3a 00 00       	call   3c00 <exit>
+    printf(stdout, "chdir / failed\n");
+     1b8:	50                   	push   %eax
+     1b9:	50                   	push   %eax
+     1ba:	68 ab 47 00 00       	push   $0x47ab
+     1bf:	ff 35 84 6b 00 00    	push   0x6b84
+     1c5:	e8 e6 40 00 00       	call   42b0 <printf>
+    exit();
+     1ca:	e8 31 3a 00 00       	call   3c00 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+     1cf:	52                   	push   %edx
+     1d0:	52                   	push   %edx
+     1d1:	68 8f 47 00 00       	push   $0x478f
+     1d6:	ff 35 84 6b 00 00    	push   0x6b84
+     1dc:	e8 cf 40 00 00       	call   42b0 <printf>
+    exit();
+     1e1:	e8 1a 3a 00 00       	call   3c00 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+     1e6:	51                   	push   %ecx
+     1e7:	51                   	push   %ecx
+     1e8:	68 6e 47 00 00       	push   $0x476e
+     1ed:	ff 35 84 6b 00 00    	push   0x6b84
+     1f3:	e8 b8 40 00 00       	call   42b0 <printf>
+    exit();
+     1f8:	e8 03 3a 00 00       	call   3c00 <exit>
+     1fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000200 <exitiputtest>:
+{
+     200:	55                   	push   %ebp
+     201:	89 e5                	mov    %esp,%ebp
+     203:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+     206:	68 bb 47 00 00       	push   $0x47bb
+     20b:	ff 35 84 6b 00 00    	push   0x6b84
+     211:	e8 9a 40 00 00       	call   42b0 <printf>
+  pid = fork();
+     216:	e8 95 39 00 00       	call   3bb0 <fork>
+  if(pid < 0){
+     21b:	83 c4 10             	add    $0x10,%esp
+     21e:	85 c0                	test   %eax,%eax
+     220:	0f 88 8a 00 00 00    	js     2b0 <exitiputtest+0xb0>
+  if(pid == 0){
+     226:	75 50                	jne    278 <exitiputtest+0x78>
+    if(mkdir("iputdir") < 0){
+     228:	83 ec 0c             	sub    $0xc,%esp
+     22b:	68 87 47 00 00       	push   $0x4787
+     230:	e8 46 3e 00 00       	call   407b <mkdir>
+     235:	83 c4 10             	add    $0x10,%esp
+     238:	85 c0                	test   %eax,%eax
+     23a:	0f 88 87 00 00 00    	js     2c7 <exitiputtest+0xc7>
+    if(chdir("iputdir") < 0){
+     240:	83 ec 0c             	sub    $0xc,%esp
+     243:	68 87 47 00 00       	push   $0x4787
+     248:	e8 38 3e 00 00       	call   4085 <chdir>
+     24d:	83 c4 10             	add    $0x10,%esp
+     250:	85 c0                	test   %eax,%eax
+     252:	0f 88 86 00 00 00    	js     2de <exitiputtest+0xde>
+    if(unlink("../iputdir") < 0){
+     258:	83 ec 0c             	sub    $0xc,%esp
+     25b:	68 84 47 00 00       	push   $0x4784
+     260:	e8 f8 3d 00 00       	call   405d <unlink>
+     265:	83 c4 10             	add    $0x10,%esp
+     268:	85 c0                	test   %eax,%eax
+     26a:	78 2c                	js     298 <exitiputtest+0x98>
+    exit();
+     26c:	e8 8f 39 00 00       	call   3c00 <exit>
+     271:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+     278:	e8 9b 3d 00 00       	call   4018 <wait>
+  printf(stdout, "exitiput test ok\n");
+     27d:	83 ec 08             	sub    $0x8,%esp
+     280:	68 de 47 00 00       	push   $0x47de
+     285:	ff 35 84 6b 00 00    	push   0x6b84
+     28b:	e8 20 40 00 00       	call   42b0 <printf>
+}
+     290:	83 c4 10             	add    $0x10,%esp
+     293:	c9                   	leave
+     294:	c3                   	ret
+     295:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "unlink ../iputdir failed\n");
+     298:	83 ec 08             	sub    $0x8,%esp
+     29b:	68 8f 47 00 00       	push   $0x478f
+     2a0:	ff 35 84 6b 00 00    	push   0x6b84
+     2a6:	e8 05 40 00 00       	call   42b0 <printf>
+      exit();
+     2ab:	e8 50 39 00 00       	call   3c00 <exit>
+    printf(stdout, "fork failed\n");
+     2b0:	51                   	push   %ecx
+     2b1:	51                   	push   %ecx
+     2b2:	68 6a 57 00 00       	push   $0x576a
+     2b7:	ff 35 84 6b 00 00    	push   0x6b84
+     2bd:	e8 ee 3f 00 00       	call   42b0 <printf>
+    exit();
+     2c2:	e8 39 39 00 00       	call   3c00 <exit>
+      printf(stdout, "mkdir failed\n");
+     2c7:	52                   	push   %edx
+     2c8:	52                   	push   %edx
+     2c9:	68 60 47 00 00       	push   $0x4760
+     2ce:	ff 35 84 6b 00 00    	push   0x6b84
+     2d4:	e8 d7 3f 00 00       	call   42b0 <printf>
+      exit();
+     2d9:	e8 22 39 00 00       	call   3c00 <exit>
+      printf(stdout, "child chdir failed\n");
+     2de:	50                   	push   %eax
+     2df:	50                   	push   %eax
+     2e0:	68 ca 47 00 00       	push   $0x47ca
+     2e5:	ff 35 84 6b 00 00    	push   0x6b84
+     2eb:	e8 c0 3f 00 00       	call   42b0 <printf>
+      exit();
+     2f0:	e8 0b 39 00 00       	call   3c00 <exit>
+     2f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <openiputtest>:
+{
+     300:	55                   	push   %ebp
+     301:	89 e5                	mov    %esp,%ebp
+     303:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+     306:	68 f0 47 00 00       	push   $0x47f0
+     30b:	ff 35 84 6b 00 00    	push   0x6b84
+     311:	e8 9a 3f 00 00       	call   42b0 <printf>
+  if(mkdir("oidir") < 0){
+     316:	c7 04 24 ff 47 00 00 	movl   $0x47ff,(%esp)
+     31d:	e8 59 3d 00 00       	call   407b <mkdir>
+     322:	83 c4 10             	add    $0x10,%esp
+     325:	85 c0                	test   %eax,%eax
+     327:	0f 88 9f 00 00 00    	js     3cc <openiputtest+0xcc>
+  pid = fork();
+     32d:	e8 7e 38 00 00       	call   3bb0 <fork>
+  if(pid < 0){
+     332:	85 c0                	test   %eax,%eax
+     334:	78 7f                	js     3b5 <openiputtest+0xb5>
+  if(pid == 0){
+     336:	75 38                	jne    370 <openiputtest+0x70>
+    int fd = open("oidir", O_RDWR);
+     338:	83 ec 08             	sub    $0x8,%esp
+     33b:	6a 02                	push   $0x2
+     33d:	68 ff 47 00 00       	push   $0x47ff
+     342:	e8 02 3d 00 00       	call   4049 <open>
+    if(fd >= 0){
+     347:	83 c4 10             	add    $0x10,%esp
+     34a:	85 c0                	test   %eax,%eax
+     34c:	78 62                	js     3b0 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     34e:	83 ec 08             	sub    $0x8,%esp
+     351:	68 3c 58 00 00       	push   $0x583c
+     356:	ff 35 84 6b 00 00    	push   0x6b84
+     35c:	e8 4f 3f 00 00       	call   42b0 <printf>
+      exit();
+     361:	e8 9a 38 00 00       	call   3c00 <exit>
+     366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     36d:	8d 76 00             	lea    0x0(%esi),%esi
+  sleep(1);
+     370:	83 ec 0c             	sub    $0xc,%esp
+     373:	6a 01                	push   $0x1
+     375:	e8 33 3d 00 00       	call   40ad <sleep>
+  if(unlink("oidir") != 0){
+     37a:	c7 04 24 ff 47 00 00 	movl   $0x47ff,(%esp)
+     381:	e8 d7 3c 00 00       	call   405d <unlink>
+     386:	83 c4 10             	add    $0x10,%esp
+     389:	85 c0                	test   %eax,%eax
+     38b:	75 56                	jne    3e3 <openiputtest+0xe3>
+  wait();
+     38d:	e8 86 3c 00 00       	call   4018 <wait>
+  printf(stdout, "openiput test ok\n");
+     392:	83 ec 08             	sub    $0x8,%esp
+     395:	68 28 48 00 00       	push   $0x4828
+     39a:	ff 35 84 6b 00 00    	push   0x6b84
+     3a0:	e8 0b 3f 00 00       	call   42b0 <printf>
+}
+     3a5:	83 c4 10             	add    $0x10,%esp
+     3a8:	c9                   	leave
+     3a9:	c3                   	ret
+     3aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit();
+     3b0:	e8 4b 38 00 00       	call   3c00 <exit>
+    printf(stdout, "fork failed\n");
+     3b5:	52                   	push   %edx
+     3b6:	52                   	push   %edx
+     3b7:	68 6a 57 00 00       	push   $0x576a
+     3bc:	ff 35 84 6b 00 00    	push   0x6b84
+     3c2:	e8 e9 3e 00 00       	call   42b0 <printf>
+    exit();
+     3c7:	e8 34 38 00 00       	call   3c00 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     3cc:	51                   	push   %ecx
+     3cd:	51                   	push   %ecx
+     3ce:	68 05 48 00 00       	push   $0x4805
+     3d3:	ff 35 84 6b 00 00    	push   0x6b84
+     3d9:	e8 d2 3e 00 00       	call   42b0 <printf>
+    exit();
+     3de:	e8 1d 38 00 00       	call   3c00 <exit>
+    printf(stdout, "unlink failed\n");
+     3e3:	50                   	push   %eax
+     3e4:	50                   	push   %eax
+     3e5:	68 19 48 00 00       	push   $0x4819
+     3ea:	ff 35 84 6b 00 00    	push   0x6b84
+     3f0:	e8 bb 3e 00 00       	call   42b0 <printf>
+    exit();
+     3f5:	e8 06 38 00 00       	call   3c00 <exit>
+     3fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000400 <opentest>:
+{
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+     403:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+     406:	68 3a 48 00 00       	push   $0x483a
+     40b:	ff 35 84 6b 00 00    	push   0x6b84
+     411:	e8 9a 3e 00 00       	call   42b0 <printf>
+  fd = open("echo", 0);
+     416:	58                   	pop    %eax
+     417:	5a                   	pop    %edx
+     418:	6a 00                	push   $0x0
+     41a:	68 45 48 00 00       	push   $0x4845
+     41f:	e8 25 3c 00 00       	call   4049 <open>
+  if(fd < 0){
+     424:	83 c4 10             	add    $0x10,%esp
+     427:	85 c0                	test   %eax,%eax
+     429:	78 36                	js     461 <opentest+0x61>
+  close(fd);
+     42b:	83 ec 0c             	sub    $0xc,%esp
+     42e:	50                   	push   %eax
+     42f:	e8 3c 38 00 00       	call   3c70 <close>
+  fd = open("doesnotexist", 0);
+     434:	5a                   	pop    %edx
+     435:	59                   	pop    %ecx
+     436:	6a 00                	push   $0x0
+     438:	68 5d 48 00 00       	push   $0x485d
+     43d:	e8 07 3c 00 00       	call   4049 <open>
+  if(fd >= 0){
+     442:	83 c4 10             	add    $0x10,%esp
+     445:	85 c0                	test   %eax,%eax
+     447:	79 2f                	jns    478 <opentest+0x78>
+  printf(stdout, "open test ok\n");
+     449:	83 ec 08             	sub    $0x8,%esp
+     44c:	68 88 48 00 00       	push   $0x4888
+     451:	ff 35 84 6b 00 00    	push   0x6b84
+     457:	e8 54 3e 00 00       	call   42b0 <printf>
+}
+     45c:	83 c4 10             	add    $0x10,%esp
+     45f:	c9                   	leave
+     460:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     461:	50                   	push   %eax
+     462:	50                   	push   %eax
+     463:	68 4a 48 00 00       	push   $0x484a
+     468:	ff 35 84 6b 00 00    	push   0x6b84
+     46e:	e8 3d 3e 00 00       	call   42b0 <printf>
+    exit();
+     473:	e8 88 37 00 00       	call   3c00 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     478:	50                   	push   %eax
+     479:	50                   	push   %eax
+     47a:	68 6a 48 00 00       	push   $0x486a
+     47f:	ff 35 84 6b 00 00    	push   0x6b84
+     485:	e8 26 3e 00 00       	call   42b0 <printf>
+    exit();
+     48a:	e8 71 37 00 00       	call   3c00 <exit>
+     48f:	90                   	nop
+
+00000490 <writetest>:
+{
+     490:	55                   	push   %ebp
+     491:	89 e5                	mov    %esp,%ebp
+     493:	56                   	push   %esi
+     494:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     495:	83 ec 08             	sub    $0x8,%esp
+     498:	68 96 48 00 00       	push   $0x4896
+     49d:	ff 35 84 6b 00 00    	push   0x6b84
+     4a3:	e8 08 3e 00 00       	call   42b0 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     4a8:	58                   	pop    %eax
+     4a9:	5a                   	pop    %edx
+     4aa:	68 02 02 00 00       	push   $0x202
+     4af:	68 a7 48 00 00       	push   $0x48a7
+     4b4:	e8 90 3b 00 00       	call   4049 <open>
+  if(fd >= 0){
+     4b9:	83 c4 10             	add    $0x10,%esp
+     4bc:	85 c0                	test   %eax,%eax
+     4be:	0f 88 88 01 00 00    	js     64c <writetest+0x1bc>
+    printf(stdout, "creat small succeeded; ok\n");
+     4c4:	83 ec 08             	sub    $0x8,%esp
+     4c7:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     4c9:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "creat small succeeded; ok\n");
+     4cb:	68 ad 48 00 00       	push   $0x48ad
+     4d0:	ff 35 84 6b 00 00    	push   0x6b84
+     4d6:	e8 d5 3d 00 00       	call   42b0 <printf>
+     4db:	83 c4 10             	add    $0x10,%esp
+     4de:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     4e0:	83 ec 04             	sub    $0x4,%esp
+     4e3:	6a 0a                	push   $0xa
+     4e5:	68 e4 48 00 00       	push   $0x48e4
+     4ea:	56                   	push   %esi
+     4eb:	e8 3d 3b 00 00       	call   402d <write>
+     4f0:	83 c4 10             	add    $0x10,%esp
+     4f3:	83 f8 0a             	cmp    $0xa,%eax
+     4f6:	0f 85 d9 00 00 00    	jne    5d5 <writetest+0x145>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     4fc:	83 ec 04             	sub    $0x4,%esp
+     4ff:	6a 0a                	push   $0xa
+     501:	68 ef 48 00 00       	push   $0x48ef
+     506:	56                   	push   %esi
+     507:	e8 21 3b 00 00       	call   402d <write>
+     50c:	83 c4 10             	add    $0x10,%esp
+     50f:	83 f8 0a             	cmp    $0xa,%eax
+     512:	0f 85 d6 00 00 00    	jne    5ee <writetest+0x15e>
+  for(i = 0; i < 100; i++){
+     518:	83 c3 01             	add    $0x1,%ebx
+     51b:	83 fb 64             	cmp    $0x64,%ebx
+     51e:	75 c0                	jne    4e0 <writetest+0x50>
+  printf(stdout, "writes ok\n");
+     520:	83 ec 08             	sub    $0x8,%esp
+     523:	68 fa 48 00 00       	push   $0x48fa
+     528:	ff 35 84 6b 00 00    	push   0x6b84
+     52e:	e8 7d 3d 00 00       	call   42b0 <printf>
+  close(fd);
+     533:	89 34 24             	mov    %esi,(%esp)
+     536:	e8 35 37 00 00       	call   3c70 <close>
+  fd = open("small", O_RDONLY);
+     53b:	5b                   	pop    %ebx
+     53c:	5e                   	pop    %esi
+     53d:	6a 00                	push   $0x0
+     53f:	68 a7 48 00 00       	push   $0x48a7
+     544:	e8 00 3b 00 00       	call   4049 <open>
+  if(fd >= 0){
+     549:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     54c:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     54e:	85 c0                	test   %eax,%eax
+     550:	0f 88 b1 00 00 00    	js     607 <writetest+0x177>
+    printf(stdout, "open small succeeded ok\n");
+     556:	83 ec 08             	sub    $0x8,%esp
+     559:	68 05 49 00 00       	push   $0x4905
+     55e:	ff 35 84 6b 00 00    	push   0x6b84
+     564:	e8 47 3d 00 00       	call   42b0 <printf>
+  i = read(fd, buf, 2000);
+     569:	83 c4 0c             	add    $0xc,%esp
+     56c:	68 d0 07 00 00       	push   $0x7d0
+     571:	68 c0 92 00 00       	push   $0x92c0
+     576:	53                   	push   %ebx
+     577:	e8 aa 3a 00 00       	call   4026 <read>
+  if(i == 2000){
+     57c:	83 c4 10             	add    $0x10,%esp
+     57f:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     584:	0f 85 94 00 00 00    	jne    61e <writetest+0x18e>
+    printf(stdout, "read succeeded ok\n");
+     58a:	83 ec 08             	sub    $0x8,%esp
+     58d:	68 39 49 00 00       	push   $0x4939
+     592:	ff 35 84 6b 00 00    	push   0x6b84
+     598:	e8 13 3d 00 00       	call   42b0 <printf>
+  close(fd);
+     59d:	89 1c 24             	mov    %ebx,(%esp)
+     5a0:	e8 cb 36 00 00       	call   3c70 <close>
+  if(unlink("small") < 0){
+     5a5:	c7 04 24 a7 48 00 00 	movl   $0x48a7,(%esp)
+     5ac:	e8 ac 3a 00 00       	call   405d <unlink>
+     5b1:	83 c4 10             	add    $0x10,%esp
+     5b4:	85 c0                	test   %eax,%eax
+     5b6:	78 7d                	js     635 <writetest+0x1a5>
+  printf(stdout, "small file test ok\n");
+     5b8:	83 ec 08             	sub    $0x8,%esp
+     5bb:	68 61 49 00 00       	push   $0x4961
+     5c0:	ff 35 84 6b 00 00    	push   0x6b84
+     5c6:	e8 e5 3c 00 00       	call   42b0 <printf>
+}
+     5cb:	83 c4 10             	add    $0x10,%esp
+     5ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5d1:	5b                   	pop    %ebx
+     5d2:	5e                   	pop    %esi
+     5d3:	5d                   	pop    %ebp
+     5d4:	c3                   	ret
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     5d5:	83 ec 04             	sub    $0x4,%esp
+     5d8:	53                   	push   %ebx
+     5d9:	68 60 58 00 00       	push   $0x5860
+     5de:	ff 35 84 6b 00 00    	push   0x6b84
+     5e4:	e8 c7 3c 00 00       	call   42b0 <printf>
+      exit();
+     5e9:	e8 12 36 00 00       	call   3c00 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     5ee:	83 ec 04             	sub    $0x4,%esp
+     5f1:	53                   	push   %ebx
+     5f2:	68 84 58 00 00       	push   $0x5884
+     5f7:	ff 35 84 6b 00 00    	push   0x6b84
+     5fd:	e8 ae 3c 00 00       	call   42b0 <printf>
+      exit();
+     602:	e8 f9 35 00 00       	call   3c00 <exit>
+    printf(stdout, "error: open small failed!\n");
+     607:	51                   	push   %ecx
+     608:	51                   	push   %ecx
+     609:	68 1e 49 00 00       	push   $0x491e
+     60e:	ff 35 84 6b 00 00    	push   0x6b84
+     614:	e8 97 3c 00 00       	call   42b0 <printf>
+    exit();
+     619:	e8 e2 35 00 00       	call   3c00 <exit>
+    printf(stdout, "read failed\n");
+     61e:	52                   	push   %edx
+     61f:	52                   	push   %edx
+     620:	68 92 57 00 00       	push   $0x5792
+     625:	ff 35 84 6b 00 00    	push   0x6b84
+     62b:	e8 80 3c 00 00       	call   42b0 <printf>
+    exit();
+     630:	e8 cb 35 00 00       	call   3c00 <exit>
+    printf(stdout, "unlink small failed\n");
+     635:	50                   	push   %eax
+     636:	50                   	push   %eax
+     637:	68 4c 49 00 00       	push   $0x494c
+     63c:	ff 35 84 6b 00 00    	push   0x6b84
+     642:	e8 69 3c 00 00       	call   42b0 <printf>
+    exit();
+     647:	e8 b4 35 00 00       	call   3c00 <exit>
+    printf(stdout, "error: creat small failed!\n");
+     64c:	50                   	push   %eax
+     64d:	50                   	push   %eax
+     64e:	68 c8 48 00 00       	push   $0x48c8
+     653:	ff 35 84 6b 00 00    	push   0x6b84
+     659:	e8 52 3c 00 00       	call   42b0 <printf>
+    exit();
+     65e:	e8 9d 35 00 00       	call   3c00 <exit>
+     663:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     66a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000670 <writetest1>:
+{
+     670:	55                   	push   %ebp
+     671:	89 e5                	mov    %esp,%ebp
+     673:	56                   	push   %esi
+     674:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+     675:	83 ec 08             	sub    $0x8,%esp
+     678:	68 75 49 00 00       	push   $0x4975
+     67d:	ff 35 84 6b 00 00    	push   0x6b84
+     683:	e8 28 3c 00 00       	call   42b0 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     688:	58                   	pop    %eax
+     689:	5a                   	pop    %edx
+     68a:	68 02 02 00 00       	push   $0x202
+     68f:	68 ef 49 00 00       	push   $0x49ef
+     694:	e8 b0 39 00 00       	call   4049 <open>
+  if(fd < 0){
+     699:	83 c4 10             	add    $0x10,%esp
+     69c:	85 c0                	test   %eax,%eax
+     69e:	0f 88 5d 01 00 00    	js     801 <writetest1+0x191>
+     6a4:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < BIGBLOCKS; i++){
+     6a6:	31 db                	xor    %ebx,%ebx
+     6a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6af:	90                   	nop
+    if(write(fd, buf, 512) != 512){
+     6b0:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     6b3:	89 1d c0 92 00 00    	mov    %ebx,0x92c0
+    if(write(fd, buf, 512) != 512){
+     6b9:	68 00 02 00 00       	push   $0x200
+     6be:	68 c0 92 00 00       	push   $0x92c0
+     6c3:	56                   	push   %esi
+     6c4:	e8 64 39 00 00       	call   402d <write>
+     6c9:	83 c4 10             	add    $0x10,%esp
+     6cc:	3d 00 02 00 00       	cmp    $0x200,%eax
+     6d1:	0f 85 b3 00 00 00    	jne    78a <writetest1+0x11a>
+  for(i = 0; i < BIGBLOCKS; i++){
+     6d7:	83 c3 01             	add    $0x1,%ebx
+     6da:	81 fb 8a 01 00 00    	cmp    $0x18a,%ebx
+     6e0:	75 ce                	jne    6b0 <writetest1+0x40>
+  close(fd);
+     6e2:	83 ec 0c             	sub    $0xc,%esp
+     6e5:	56                   	push   %esi
+     6e6:	e8 85 35 00 00       	call   3c70 <close>
+  fd = open("big", O_RDONLY);
+     6eb:	5b                   	pop    %ebx
+     6ec:	5e                   	pop    %esi
+     6ed:	6a 00                	push   $0x0
+     6ef:	68 ef 49 00 00       	push   $0x49ef
+     6f4:	e8 50 39 00 00       	call   4049 <open>
+  if(fd < 0){
+     6f9:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+     6fc:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     6fe:	85 c0                	test   %eax,%eax
+     700:	0f 88 e4 00 00 00    	js     7ea <writetest1+0x17a>
+  n = 0;
+     706:	31 f6                	xor    %esi,%esi
+     708:	eb 1d                	jmp    727 <writetest1+0xb7>
+     70a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != 512){
+     710:	3d 00 02 00 00       	cmp    $0x200,%eax
+     715:	0f 85 9f 00 00 00    	jne    7ba <writetest1+0x14a>
+    if(((int*)buf)[0] != n){
+     71b:	a1 c0 92 00 00       	mov    0x92c0,%eax
+     720:	39 f0                	cmp    %esi,%eax
+     722:	75 7f                	jne    7a3 <writetest1+0x133>
+    n++;
+     724:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, 512);
+     727:	83 ec 04             	sub    $0x4,%esp
+     72a:	68 00 02 00 00       	push   $0x200
+     72f:	68 c0 92 00 00       	push   $0x92c0
+     734:	53                   	push   %ebx
+     735:	e8 ec 38 00 00       	call   4026 <read>
+    if(i == 0){
+     73a:	83 c4 10             	add    $0x10,%esp
+     73d:	85 c0                	test   %eax,%eax
+     73f:	75 cf                	jne    710 <writetest1+0xa0>
+      if(n != BIGBLOCKS){
+     741:	81 fe 8a 01 00 00    	cmp    $0x18a,%esi
+     747:	0f 85 86 00 00 00    	jne    7d3 <writetest1+0x163>
+  close(fd);
+     74d:	83 ec 0c             	sub    $0xc,%esp
+     750:	53                   	push   %ebx
+     751:	e8 1a 35 00 00       	call   3c70 <close>
+  if(unlink("big") < 0){
+     756:	c7 04 24 ef 49 00 00 	movl   $0x49ef,(%esp)
+     75d:	e8 fb 38 00 00       	call   405d <unlink>
+     762:	83 c4 10             	add    $0x10,%esp
+     765:	85 c0                	test   %eax,%eax
+     767:	0f 88 ab 00 00 00    	js     818 <writetest1+0x1a8>
+  printf(stdout, "big files ok\n");
+     76d:	83 ec 08             	sub    $0x8,%esp
+     770:	68 16 4a 00 00       	push   $0x4a16
+     775:	ff 35 84 6b 00 00    	push   0x6b84
+     77b:	e8 30 3b 00 00       	call   42b0 <printf>
+}
+     780:	83 c4 10             	add    $0x10,%esp
+     783:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     786:	5b                   	pop    %ebx
+     787:	5e                   	pop    %esi
+     788:	5d                   	pop    %ebp
+     789:	c3                   	ret
+      printf(stdout, "error: write big file failed\n", i);
+     78a:	83 ec 04             	sub    $0x4,%esp
+     78d:	53                   	push   %ebx
+     78e:	68 9f 49 00 00       	push   $0x499f
+     793:	ff 35 84 6b 00 00    	push   0x6b84
+     799:	e8 12 3b 00 00       	call   42b0 <printf>
+      exit();
+     79e:	e8 5d 34 00 00       	call   3c00 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     7a3:	50                   	push   %eax
+     7a4:	56                   	push   %esi
+     7a5:	68 a8 58 00 00       	push   $0x58a8
+     7aa:	ff 35 84 6b 00 00    	push   0x6b84
+     7b0:	e8 fb 3a 00 00       	call   42b0 <printf>
+      exit();
+     7b5:	e8 46 34 00 00       	call   3c00 <exit>
+      printf(stdout, "read failed %d\n", i);
+     7ba:	83 ec 04             	sub    $0x4,%esp
+     7bd:	50                   	push   %eax
+     7be:	68 f3 49 00 00       	push   $0x49f3
+     7c3:	ff 35 84 6b 00 00    	push   0x6b84
+     7c9:	e8 e2 3a 00 00       	call   42b0 <printf>
+      exit();
+     7ce:	e8 2d 34 00 00       	call   3c00 <exit>
+        printf(stdout, "read only %d blocks from big", n);
+     7d3:	52                   	push   %edx
+     7d4:	56                   	push   %esi
+     7d5:	68 d6 49 00 00       	push   $0x49d6
+     7da:	ff 35 84 6b 00 00    	push   0x6b84
+     7e0:	e8 cb 3a 00 00       	call   42b0 <printf>
+        exit();
+     7e5:	e8 16 34 00 00       	call   3c00 <exit>
+    printf(stdout, "error: open big failed!\n");
+     7ea:	51                   	push   %ecx
+     7eb:	51                   	push   %ecx
+     7ec:	68 bd 49 00 00       	push   $0x49bd
+     7f1:	ff 35 84 6b 00 00    	push   0x6b84
+     7f7:	e8 b4 3a 00 00       	call   42b0 <printf>
+    exit();
+     7fc:	e8 ff 33 00 00       	call   3c00 <exit>
+    printf(stdout, "error: creat big failed!\n");
+     801:	50                   	push   %eax
+     802:	50                   	push   %eax
+     803:	68 85 49 00 00       	push   $0x4985
+     808:	ff 35 84 6b 00 00    	push   0x6b84
+     80e:	e8 9d 3a 00 00       	call   42b0 <printf>
+    exit();
+     813:	e8 e8 33 00 00       	call   3c00 <exit>
+    printf(stdout, "unlink big failed\n");
+     818:	50                   	push   %eax
+     819:	50                   	push   %eax
+     81a:	68 03 4a 00 00       	push   $0x4a03
+     81f:	ff 35 84 6b 00 00    	push   0x6b84
+     825:	e8 86 3a 00 00       	call   42b0 <printf>
+    exit();
+     82a:	e8 d1 33 00 00       	call   3c00 <exit>
+     82f:	90                   	nop
+
+00000830 <createtest>:
+{
+     830:	55                   	push   %ebp
+     831:	89 e5                	mov    %esp,%ebp
+     833:	53                   	push   %ebx
+  name[2] = '\0';
+     834:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+     839:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+     83c:	68 c8 58 00 00       	push   $0x58c8
+     841:	ff 35 84 6b 00 00    	push   0x6b84
+     847:	e8 64 3a 00 00       	call   42b0 <printf>
+  name[0] = 'a';
+     84c:	c6 05 b0 92 00 00 61 	movb   $0x61,0x92b0
+  name[2] = '\0';
+     853:	83 c4 10             	add    $0x10,%esp
+     856:	c6 05 b2 92 00 00 00 	movb   $0x0,0x92b2
+  for(i = 0; i < 52; i++){
+     85d:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+     860:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+     863:	88 1d b1 92 00 00    	mov    %bl,0x92b1
+  for(i = 0; i < 52; i++){
+     869:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     86c:	68 02 02 00 00       	push   $0x202
+     871:	68 b0 92 00 00       	push   $0x92b0
+     876:	e8 ce 37 00 00       	call   4049 <open>
+    close(fd);
+     87b:	89 04 24             	mov    %eax,(%esp)
+     87e:	e8 ed 33 00 00       	call   3c70 <close>
+  for(i = 0; i < 52; i++){
+     883:	83 c4 10             	add    $0x10,%esp
+     886:	80 fb 64             	cmp    $0x64,%bl
+     889:	75 d5                	jne    860 <createtest+0x30>
+  name[0] = 'a';
+     88b:	c6 05 b0 92 00 00 61 	movb   $0x61,0x92b0
+  name[2] = '\0';
+     892:	bb 30 00 00 00       	mov    $0x30,%ebx
+     897:	c6 05 b2 92 00 00 00 	movb   $0x0,0x92b2
+  for(i = 0; i < 52; i++){
+     89e:	66 90                	xchg   %ax,%ax
+    unlink(name);
+     8a0:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+     8a3:	88 1d b1 92 00 00    	mov    %bl,0x92b1
+  for(i = 0; i < 52; i++){
+     8a9:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+     8ac:	68 b0 92 00 00       	push   $0x92b0
+     8b1:	e8 a7 37 00 00       	call   405d <unlink>
+  for(i = 0; i < 52; i++){
+     8b6:	83 c4 10             	add    $0x10,%esp
+     8b9:	80 fb 64             	cmp    $0x64,%bl
+     8bc:	75 e2                	jne    8a0 <createtest+0x70>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     8be:	83 ec 08             	sub    $0x8,%esp
+     8c1:	68 f0 58 00 00       	push   $0x58f0
+     8c6:	ff 35 84 6b 00 00    	push   0x6b84
+     8cc:	e8 df 39 00 00       	call   42b0 <printf>
+}
+     8d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8d4:	83 c4 10             	add    $0x10,%esp
+     8d7:	c9                   	leave
+     8d8:	c3                   	ret
+     8d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000008e0 <dirtest>:
+{
+     8e0:	55                   	push   %ebp
+     8e1:	89 e5                	mov    %esp,%ebp
+     8e3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     8e6:	68 24 4a 00 00       	push   $0x4a24
+     8eb:	ff 35 84 6b 00 00    	push   0x6b84
+     8f1:	e8 ba 39 00 00       	call   42b0 <printf>
+  if(mkdir("dir0") < 0){
+     8f6:	c7 04 24 30 4a 00 00 	movl   $0x4a30,(%esp)
+     8fd:	e8 79 37 00 00       	call   407b <mkdir>
+     902:	83 c4 10             	add    $0x10,%esp
+     905:	85 c0                	test   %eax,%eax
+     907:	78 58                	js     961 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+     909:	83 ec 0c             	sub    $0xc,%esp
+     90c:	68 30 4a 00 00       	push   $0x4a30
+     911:	e8 6f 37 00 00       	call   4085 <chdir>
+     916:	83 c4 10             	add    $0x10,%esp
+     919:	85 c0                	test   %eax,%eax
+     91b:	0f 88 85 00 00 00    	js     9a6 <dirtest+0xc6>
+  if(chdir("..") < 0){
+     921:	83 ec 0c             	sub    $0xc,%esp
+     924:	68 d5 4f 00 00       	push   $0x4fd5
+     929:	e8 57 37 00 00       	call   4085 <chdir>
+     92e:	83 c4 10             	add    $0x10,%esp
+     931:	85 c0                	test   %eax,%eax
+     933:	78 5a                	js     98f <dirtest+0xaf>
+  if(unlink("dir0") < 0){
+     935:	83 ec 0c             	sub    $0xc,%esp
+     938:	68 30 4a 00 00       	push   $0x4a30
+     93d:	e8 1b 37 00 00       	call   405d <unlink>
+     942:	83 c4 10             	add    $0x10,%esp
+     945:	85 c0                	test   %eax,%eax
+     947:	78 2f                	js     978 <dirtest+0x98>
+  printf(stdout, "mkdir test ok\n");
+     949:	83 ec 08             	sub    $0x8,%esp
+     94c:	68 6d 4a 00 00       	push   $0x4a6d
+     951:	ff 35 84 6b 00 00    	push   0x6b84
+     957:	e8 54 39 00 00       	call   42b0 <printf>
+}
+     95c:	83 c4 10             	add    $0x10,%esp
+     95f:	c9                   	leave
+     960:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     961:	50                   	push   %eax
+     962:	50                   	push   %eax
+     963:	68 60 47 00 00       	push   $0x4760
+     968:	ff 35 84 6b 00 00    	push   0x6b84
+     96e:	e8 3d 39 00 00       	call   42b0 <printf>
+    exit();
+     973:	e8 88 32 00 00       	call   3c00 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     978:	50                   	push   %eax
+     979:	50                   	push   %eax
+     97a:	68 59 4a 00 00       	push   $0x4a59
+     97f:	ff 35 84 6b 00 00    	push   0x6b84
+     985:	e8 26 39 00 00       	call   42b0 <printf>
+    exit();
+     98a:	e8 71 32 00 00       	call   3c00 <exit>
+    printf(stdout, "chdir .. failed\n");
+     98f:	52                   	push   %edx
+     990:	52                   	push   %edx
+     991:	68 48 4a 00 00       	push   $0x4a48
+     996:	ff 35 84 6b 00 00    	push   0x6b84
+     99c:	e8 0f 39 00 00       	call   42b0 <printf>
+    exit();
+     9a1:	e8 5a 32 00 00       	call   3c00 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     9a6:	51                   	push   %ecx
+     9a7:	51                   	push   %ecx
+     9a8:	68 35 4a 00 00       	push   $0x4a35
+     9ad:	ff 35 84 6b 00 00    	push   0x6b84
+     9b3:	e8 f8 38 00 00       	call   42b0 <printf>
+    exit();
+     9b8:	e8 43 32 00 00       	call   3c00 <exit>
+     9bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009c0 <exectest>:
+{
+     9c0:	55                   	push   %ebp
+     9c1:	89 e5                	mov    %esp,%ebp
+     9c3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     9c6:	68 7c 4a 00 00       	push   $0x4a7c
+     9cb:	ff 35 84 6b 00 00    	push   0x6b84
+     9d1:	e8 da 38 00 00       	call   42b0 <printf>
+  if(exec("echo", echoargv) < 0){
+     9d6:	5a                   	pop    %edx
+     9d7:	59                   	pop    %ecx
+     9d8:	68 88 6b 00 00       	push   $0x6b88
+     9dd:	68 45 48 00 00       	push   $0x4845
+     9e2:	e8 29 32 00 00       	call   3c10 <exec>
+     9e7:	83 c4 10             	add    $0x10,%esp
+     9ea:	85 c0                	test   %eax,%eax
+     9ec:	78 02                	js     9f0 <exectest+0x30>
+}
+     9ee:	c9                   	leave
+     9ef:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     9f0:	50                   	push   %eax
+     9f1:	50                   	push   %eax
+     9f2:	68 87 4a 00 00       	push   $0x4a87
+     9f7:	ff 35 84 6b 00 00    	push   0x6b84
+     9fd:	e8 ae 38 00 00       	call   42b0 <printf>
+    exit();
+     a02:	e8 f9 31 00 00       	call   3c00 <exit>
+     a07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a0e:	66 90                	xchg   %ax,%ax
+
+00000a10 <pipe1>:
+{
+     a10:	55                   	push   %ebp
+     a11:	89 e5                	mov    %esp,%ebp
+     a13:	57                   	push   %edi
+     a14:	56                   	push   %esi
+  if(pipe(fds) != 0){
+     a15:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     a18:	53                   	push   %ebx
+     a19:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+     a1c:	50                   	push   %eax
+     a1d:	e8 fd 35 00 00       	call   401f <pipe>
+     a22:	83 c4 10             	add    $0x10,%esp
+     a25:	85 c0                	test   %eax,%eax
+     a27:	0f 85 41 01 00 00    	jne    b6e <pipe1+0x15e>
+     a2d:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     a2f:	e8 7c 31 00 00       	call   3bb0 <fork>
+  if(pid == 0){
+     a34:	85 c0                	test   %eax,%eax
+     a36:	0f 84 92 00 00 00    	je     ace <pipe1+0xbe>
+  } else if(pid > 0){
+     a3c:	0f 8e 3f 01 00 00    	jle    b81 <pipe1+0x171>
+    close(fds[1]);
+     a42:	83 ec 0c             	sub    $0xc,%esp
+     a45:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+     a48:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+     a4a:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+     a4f:	e8 1c 32 00 00       	call   3c70 <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     a54:	83 c4 10             	add    $0x10,%esp
+     a57:	83 ec 04             	sub    $0x4,%esp
+     a5a:	57                   	push   %edi
+     a5b:	68 c0 92 00 00       	push   $0x92c0
+     a60:	ff 75 e0             	push   -0x20(%ebp)
+     a63:	e8 be 35 00 00       	call   4026 <read>
+     a68:	83 c4 10             	add    $0x10,%esp
+     a6b:	89 c1                	mov    %eax,%ecx
+     a6d:	85 c0                	test   %eax,%eax
+     a6f:	0f 8e b8 00 00 00    	jle    b2d <pipe1+0x11d>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     a75:	89 f0                	mov    %esi,%eax
+     a77:	32 05 c0 92 00 00    	xor    0x92c0,%al
+     a7d:	0f b6 c0             	movzbl %al,%eax
+     a80:	85 c0                	test   %eax,%eax
+     a82:	75 30                	jne    ab4 <pipe1+0xa4>
+     a84:	83 c6 01             	add    $0x1,%esi
+     a87:	eb 0f                	jmp    a98 <pipe1+0x88>
+     a89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a90:	38 90 c0 92 00 00    	cmp    %dl,0x92c0(%eax)
+     a96:	75 1c                	jne    ab4 <pipe1+0xa4>
+     a98:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+     a9b:	83 c0 01             	add    $0x1,%eax
+     a9e:	39 c1                	cmp    %eax,%ecx
+     aa0:	75 ee                	jne    a90 <pipe1+0x80>
+      cc = cc * 2;
+     aa2:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+     aa4:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+     aa9:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+     aab:	89 d6                	mov    %edx,%esi
+     aad:	39 c7                	cmp    %eax,%edi
+     aaf:	0f 4f f8             	cmovg  %eax,%edi
+     ab2:	eb a3                	jmp    a57 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+     ab4:	83 ec 08             	sub    $0x8,%esp
+     ab7:	68 b6 4a 00 00       	push   $0x4ab6
+     abc:	6a 01                	push   $0x1
+     abe:	e8 ed 37 00 00       	call   42b0 <printf>
+     ac3:	83 c4 10             	add    $0x10,%esp
+}
+     ac6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ac9:	5b                   	pop    %ebx
+     aca:	5e                   	pop    %esi
+     acb:	5f                   	pop    %edi
+     acc:	5d                   	pop    %ebp
+     acd:	c3                   	ret
+    close(fds[0]);
+     ace:	83 ec 0c             	sub    $0xc,%esp
+     ad1:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+     ad4:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+     ad6:	e8 95 31 00 00       	call   3c70 <close>
+     adb:	83 c4 10             	add    $0x10,%esp
+     ade:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+     ae0:	31 c0                	xor    %eax,%eax
+     ae2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+     ae8:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+     aeb:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     aee:	88 90 bf 92 00 00    	mov    %dl,0x92bf(%eax)
+      for(i = 0; i < 1033; i++)
+     af4:	3d 09 04 00 00       	cmp    $0x409,%eax
+     af9:	75 ed                	jne    ae8 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+     afb:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+     afe:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     b04:	68 09 04 00 00       	push   $0x409
+     b09:	68 c0 92 00 00       	push   $0x92c0
+     b0e:	ff 75 e4             	push   -0x1c(%ebp)
+     b11:	e8 17 35 00 00       	call   402d <write>
+     b16:	83 c4 10             	add    $0x10,%esp
+     b19:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b1e:	75 74                	jne    b94 <pipe1+0x184>
+    for(n = 0; n < 5; n++){
+     b20:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b26:	75 b8                	jne    ae0 <pipe1+0xd0>
+    exit();
+     b28:	e8 d3 30 00 00       	call   3c00 <exit>
+    if(total != 5 * 1033){
+     b2d:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b33:	75 26                	jne    b5b <pipe1+0x14b>
+    close(fds[0]);
+     b35:	83 ec 0c             	sub    $0xc,%esp
+     b38:	ff 75 e0             	push   -0x20(%ebp)
+     b3b:	e8 30 31 00 00       	call   3c70 <close>
+    wait();
+     b40:	e8 d3 34 00 00       	call   4018 <wait>
+  printf(1, "pipe1 ok\n");
+     b45:	5a                   	pop    %edx
+     b46:	59                   	pop    %ecx
+     b47:	68 db 4a 00 00       	push   $0x4adb
+     b4c:	6a 01                	push   $0x1
+     b4e:	e8 5d 37 00 00       	call   42b0 <printf>
+     b53:	83 c4 10             	add    $0x10,%esp
+     b56:	e9 6b ff ff ff       	jmp    ac6 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     b5b:	56                   	push   %esi
+     b5c:	53                   	push   %ebx
+     b5d:	68 c4 4a 00 00       	push   $0x4ac4
+     b62:	6a 01                	push   $0x1
+     b64:	e8 47 37 00 00       	call   42b0 <printf>
+      exit();
+     b69:	e8 92 30 00 00       	call   3c00 <exit>
+    printf(1, "pipe() failed\n");
+     b6e:	50                   	push   %eax
+     b6f:	50                   	push   %eax
+     b70:	68 99 4a 00 00       	push   $0x4a99
+     b75:	6a 01                	push   $0x1
+     b77:	e8 34 37 00 00       	call   42b0 <printf>
+    exit();
+     b7c:	e8 7f 30 00 00       	call   3c00 <exit>
+    printf(1, "fork() failed\n");
+     b81:	50                   	push   %eax
+     b82:	50                   	push   %eax
+     b83:	68 e5 4a 00 00       	push   $0x4ae5
+     b88:	6a 01                	push   $0x1
+     b8a:	e8 21 37 00 00       	call   42b0 <printf>
+    exit();
+     b8f:	e8 6c 30 00 00       	call   3c00 <exit>
+        printf(1, "pipe1 oops 1\n");
+     b94:	57                   	push   %edi
+     b95:	57                   	push   %edi
+     b96:	68 a8 4a 00 00       	push   $0x4aa8
+     b9b:	6a 01                	push   $0x1
+     b9d:	e8 0e 37 00 00       	call   42b0 <printf>
+        exit();
+     ba2:	e8 59 30 00 00       	call   3c00 <exit>
+     ba7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bae:	66 90                	xchg   %ax,%ax
+
+00000bb0 <preempt>:
+{
+     bb0:	55                   	push   %ebp
+     bb1:	89 e5                	mov    %esp,%ebp
+     bb3:	57                   	push   %edi
+     bb4:	56                   	push   %esi
+     bb5:	53                   	push   %ebx
+     bb6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+     bb9:	68 f4 4a 00 00       	push   $0x4af4
+     bbe:	6a 01                	push   $0x1
+     bc0:	e8 eb 36 00 00       	call   42b0 <printf>
+  pid1 = fork();
+     bc5:	e8 e6 2f 00 00       	call   3bb0 <fork>
+  if(pid1 == 0)
+     bca:	83 c4 10             	add    $0x10,%esp
+     bcd:	85 c0                	test   %eax,%eax
+     bcf:	75 07                	jne    bd8 <preempt+0x28>
+    for(;;)
+     bd1:	eb fe                	jmp    bd1 <preempt+0x21>
+     bd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bd7:	90                   	nop
+     bd8:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+     bda:	e8 d1 2f 00 00       	call   3bb0 <fork>
+     bdf:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+     be1:	85 c0                	test   %eax,%eax
+     be3:	75 0b                	jne    bf0 <preempt+0x40>
+    for(;;)
+     be5:	eb fe                	jmp    be5 <preempt+0x35>
+     be7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bee:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+     bf0:	83 ec 0c             	sub    $0xc,%esp
+     bf3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     bf6:	50                   	push   %eax
+     bf7:	e8 23 34 00 00       	call   401f <pipe>
+  pid3 = fork();
+     bfc:	e8 af 2f 00 00       	call   3bb0 <fork>
+  if(pid3 == 0){
+     c01:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+     c04:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+     c06:	85 c0                	test   %eax,%eax
+     c08:	75 3e                	jne    c48 <preempt+0x98>
+    close(pfds[0]);
+     c0a:	83 ec 0c             	sub    $0xc,%esp
+     c0d:	ff 75 e0             	push   -0x20(%ebp)
+     c10:	e8 5b 30 00 00       	call   3c70 <close>
+    if(write(pfds[1], "x", 1) != 1)
+     c15:	83 c4 0c             	add    $0xc,%esp
+     c18:	6a 01                	push   $0x1
+     c1a:	68 b9 50 00 00       	push   $0x50b9
+     c1f:	ff 75 e4             	push   -0x1c(%ebp)
+     c22:	e8 06 34 00 00       	call   402d <write>
+     c27:	83 c4 10             	add    $0x10,%esp
+     c2a:	83 f8 01             	cmp    $0x1,%eax
+     c2d:	0f 85 b8 00 00 00    	jne    ceb <preempt+0x13b>
+    close(pfds[1]);
+     c33:	83 ec 0c             	sub    $0xc,%esp
+     c36:	ff 75 e4             	push   -0x1c(%ebp)
+     c39:	e8 32 30 00 00       	call   3c70 <close>
+     c3e:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     c41:	eb fe                	jmp    c41 <preempt+0x91>
+     c43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c47:	90                   	nop
+  close(pfds[1]);
+     c48:	83 ec 0c             	sub    $0xc,%esp
+     c4b:	ff 75 e4             	push   -0x1c(%ebp)
+     c4e:	e8 1d 30 00 00       	call   3c70 <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     c53:	83 c4 0c             	add    $0xc,%esp
+     c56:	68 00 20 00 00       	push   $0x2000
+     c5b:	68 c0 92 00 00       	push   $0x92c0
+     c60:	ff 75 e0             	push   -0x20(%ebp)
+     c63:	e8 be 33 00 00       	call   4026 <read>
+     c68:	83 c4 10             	add    $0x10,%esp
+     c6b:	83 f8 01             	cmp    $0x1,%eax
+     c6e:	75 67                	jne    cd7 <preempt+0x127>
+  close(pfds[0]);
+     c70:	83 ec 0c             	sub    $0xc,%esp
+     c73:	ff 75 e0             	push   -0x20(%ebp)
+     c76:	e8 f5 2f 00 00       	call   3c70 <close>
+  printf(1, "kill... ");
+     c7b:	58                   	pop    %eax
+     c7c:	5a                   	pop    %edx
+     c7d:	68 25 4b 00 00       	push   $0x4b25
+     c82:	6a 01                	push   $0x1
+     c84:	e8 27 36 00 00       	call   42b0 <printf>
+  kill(pid1);
+     c89:	89 1c 24             	mov    %ebx,(%esp)
+     c8c:	e8 aa 33 00 00       	call   403b <kill>
+  kill(pid2);
+     c91:	89 34 24             	mov    %esi,(%esp)
+     c94:	e8 a2 33 00 00       	call   403b <kill>
+  kill(pid3);
+     c99:	89 3c 24             	mov    %edi,(%esp)
+     c9c:	e8 9a 33 00 00       	call   403b <kill>
+  printf(1, "wait... ");
+     ca1:	59                   	pop    %ecx
+     ca2:	5b                   	pop    %ebx
+     ca3:	68 2e 4b 00 00       	push   $0x4b2e
+     ca8:	6a 01                	push   $0x1
+     caa:	e8 01 36 00 00       	call   42b0 <printf>
+  wait();
+     caf:	e8 64 33 00 00       	call   4018 <wait>
+  wait();
+     cb4:	e8 5f 33 00 00       	call   4018 <wait>
+  wait();
+     cb9:	e8 5a 33 00 00       	call   4018 <wait>
+  printf(1, "preempt ok\n");
+     cbe:	5e                   	pop    %esi
+     cbf:	5f                   	pop    %edi
+     cc0:	68 37 4b 00 00       	push   $0x4b37
+     cc5:	6a 01                	push   $0x1
+     cc7:	e8 e4 35 00 00       	call   42b0 <printf>
+     ccc:	83 c4 10             	add    $0x10,%esp
+}
+     ccf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cd2:	5b                   	pop    %ebx
+     cd3:	5e                   	pop    %esi
+     cd4:	5f                   	pop    %edi
+     cd5:	5d                   	pop    %ebp
+     cd6:	c3                   	ret
+    printf(1, "preempt read error");
+     cd7:	83 ec 08             	sub    $0x8,%esp
+     cda:	68 12 4b 00 00       	push   $0x4b12
+     cdf:	6a 01                	push   $0x1
+     ce1:	e8 ca 35 00 00       	call   42b0 <printf>
+     ce6:	83 c4 10             	add    $0x10,%esp
+     ce9:	eb e4                	jmp    ccf <preempt+0x11f>
+      printf(1, "preempt write error");
+     ceb:	83 ec 08             	sub    $0x8,%esp
+     cee:	68 fe 4a 00 00       	push   $0x4afe
+     cf3:	6a 01                	push   $0x1
+     cf5:	e8 b6 35 00 00       	call   42b0 <printf>
+     cfa:	83 c4 10             	add    $0x10,%esp
+     cfd:	e9 31 ff ff ff       	jmp    c33 <preempt+0x83>
+     d02:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d10 <exitwait>:
+{
+     d10:	55                   	push   %ebp
+     d11:	89 e5                	mov    %esp,%ebp
+     d13:	56                   	push   %esi
+     d14:	be 64 00 00 00       	mov    $0x64,%esi
+     d19:	53                   	push   %ebx
+     d1a:	eb 14                	jmp    d30 <exitwait+0x20>
+     d1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+     d20:	74 68                	je     d8a <exitwait+0x7a>
+      if(wait() != pid){
+     d22:	e8 f1 32 00 00       	call   4018 <wait>
+     d27:	39 d8                	cmp    %ebx,%eax
+     d29:	75 2d                	jne    d58 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+     d2b:	83 ee 01             	sub    $0x1,%esi
+     d2e:	74 41                	je     d71 <exitwait+0x61>
+    pid = fork();
+     d30:	e8 7b 2e 00 00       	call   3bb0 <fork>
+     d35:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     d37:	85 c0                	test   %eax,%eax
+     d39:	79 e5                	jns    d20 <exitwait+0x10>
+      printf(1, "fork failed\n");
+     d3b:	83 ec 08             	sub    $0x8,%esp
+     d3e:	68 6a 57 00 00       	push   $0x576a
+     d43:	6a 01                	push   $0x1
+     d45:	e8 66 35 00 00       	call   42b0 <printf>
+      return;
+     d4a:	83 c4 10             	add    $0x10,%esp
+}
+     d4d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d50:	5b                   	pop    %ebx
+     d51:	5e                   	pop    %esi
+     d52:	5d                   	pop    %ebp
+     d53:	c3                   	ret
+     d54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+     d58:	83 ec 08             	sub    $0x8,%esp
+     d5b:	68 43 4b 00 00       	push   $0x4b43
+     d60:	6a 01                	push   $0x1
+     d62:	e8 49 35 00 00       	call   42b0 <printf>
+        return;
+     d67:	83 c4 10             	add    $0x10,%esp
+}
+     d6a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d6d:	5b                   	pop    %ebx
+     d6e:	5e                   	pop    %esi
+     d6f:	5d                   	pop    %ebp
+     d70:	c3                   	ret
+  printf(1, "exitwait ok\n");
+     d71:	83 ec 08             	sub    $0x8,%esp
+     d74:	68 53 4b 00 00       	push   $0x4b53
+     d79:	6a 01                	push   $0x1
+     d7b:	e8 30 35 00 00       	call   42b0 <printf>
+     d80:	83 c4 10             	add    $0x10,%esp
+}
+     d83:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d86:	5b                   	pop    %ebx
+     d87:	5e                   	pop    %esi
+     d88:	5d                   	pop    %ebp
+     d89:	c3                   	ret
+      exit();
+     d8a:	e8 71 2e 00 00       	call   3c00 <exit>
+     d8f:	90                   	nop
+
+00000d90 <mem>:
+{
+     d90:	55                   	push   %ebp
+     d91:	89 e5                	mov    %esp,%ebp
+     d93:	56                   	push   %esi
+     d94:	31 f6                	xor    %esi,%esi
+     d96:	53                   	push   %ebx
+  printf(1, "mem test\n");
+     d97:	83 ec 08             	sub    $0x8,%esp
+     d9a:	68 60 4b 00 00       	push   $0x4b60
+     d9f:	6a 01                	push   $0x1
+     da1:	e8 0a 35 00 00       	call   42b0 <printf>
+  ppid = getpid();
+     da6:	e8 ee 32 00 00       	call   4099 <getpid>
+     dab:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+     dad:	e8 fe 2d 00 00       	call   3bb0 <fork>
+     db2:	83 c4 10             	add    $0x10,%esp
+     db5:	85 c0                	test   %eax,%eax
+     db7:	74 0b                	je     dc4 <mem+0x34>
+     db9:	e9 8a 00 00 00       	jmp    e48 <mem+0xb8>
+     dbe:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+     dc0:	89 30                	mov    %esi,(%eax)
+     dc2:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+     dc4:	83 ec 0c             	sub    $0xc,%esp
+     dc7:	68 11 27 00 00       	push   $0x2711
+     dcc:	e8 af 37 00 00       	call   4580 <malloc>
+     dd1:	83 c4 10             	add    $0x10,%esp
+     dd4:	85 c0                	test   %eax,%eax
+     dd6:	75 e8                	jne    dc0 <mem+0x30>
+    while(m1){
+     dd8:	85 f6                	test   %esi,%esi
+     dda:	74 18                	je     df4 <mem+0x64>
+     ddc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+     de0:	89 f0                	mov    %esi,%eax
+      free(m1);
+     de2:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+     de5:	8b 36                	mov    (%esi),%esi
+      free(m1);
+     de7:	50                   	push   %eax
+     de8:	e8 03 37 00 00       	call   44f0 <free>
+    while(m1){
+     ded:	83 c4 10             	add    $0x10,%esp
+     df0:	85 f6                	test   %esi,%esi
+     df2:	75 ec                	jne    de0 <mem+0x50>
+    m1 = malloc(1024*20);
+     df4:	83 ec 0c             	sub    $0xc,%esp
+     df7:	68 00 50 00 00       	push   $0x5000
+     dfc:	e8 7f 37 00 00       	call   4580 <malloc>
+    if(m1 == 0){
+     e01:	83 c4 10             	add    $0x10,%esp
+     e04:	85 c0                	test   %eax,%eax
+     e06:	74 20                	je     e28 <mem+0x98>
+    free(m1);
+     e08:	83 ec 0c             	sub    $0xc,%esp
+     e0b:	50                   	push   %eax
+     e0c:	e8 df 36 00 00       	call   44f0 <free>
+    printf(1, "mem ok\n");
+     e11:	58                   	pop    %eax
+     e12:	5a                   	pop    %edx
+     e13:	68 84 4b 00 00       	push   $0x4b84
+     e18:	6a 01                	push   $0x1
+     e1a:	e8 91 34 00 00       	call   42b0 <printf>
+    exit();
+     e1f:	e8 dc 2d 00 00       	call   3c00 <exit>
+     e24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "couldn't allocate mem?!!\n");
+     e28:	83 ec 08             	sub    $0x8,%esp
+     e2b:	68 6a 4b 00 00       	push   $0x4b6a
+     e30:	6a 01                	push   $0x1
+     e32:	e8 79 34 00 00       	call   42b0 <printf>
+      kill(ppid);
+     e37:	89 1c 24             	mov    %ebx,(%esp)
+     e3a:	e8 fc 31 00 00       	call   403b <kill>
+      exit();
+     e3f:	e8 bc 2d 00 00       	call   3c00 <exit>
+     e44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+     e48:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e4b:	5b                   	pop    %ebx
+     e4c:	5e                   	pop    %esi
+     e4d:	5d                   	pop    %ebp
+    wait();
+     e4e:	e9 c5 31 00 00       	jmp    4018 <wait>
+     e53:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000e60 <sharedfd>:
+{
+     e60:	55                   	push   %ebp
+     e61:	89 e5                	mov    %esp,%ebp
+     e63:	57                   	push   %edi
+     e64:	56                   	push   %esi
+     e65:	53                   	push   %ebx
+     e66:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+     e69:	68 8c 4b 00 00       	push   $0x4b8c
+     e6e:	6a 01                	push   $0x1
+     e70:	e8 3b 34 00 00       	call   42b0 <printf>
+  unlink("sharedfd");
+     e75:	c7 04 24 9b 4b 00 00 	movl   $0x4b9b,(%esp)
+     e7c:	e8 dc 31 00 00       	call   405d <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+     e81:	5b                   	pop    %ebx
+     e82:	5e                   	pop    %esi
+     e83:	68 02 02 00 00       	push   $0x202
+     e88:	68 9b 4b 00 00       	push   $0x4b9b
+     e8d:	e8 b7 31 00 00       	call   4049 <open>
+  if(fd < 0){
+     e92:	83 c4 10             	add    $0x10,%esp
+     e95:	85 c0                	test   %eax,%eax
+     e97:	0f 88 2a 01 00 00    	js     fc7 <sharedfd+0x167>
+     e9d:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     e9f:	8d 75 de             	lea    -0x22(%ebp),%esi
+     ea2:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+     ea7:	e8 04 2d 00 00       	call   3bb0 <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     eac:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+     eaf:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     eb2:	19 c0                	sbb    %eax,%eax
+     eb4:	83 ec 04             	sub    $0x4,%esp
+     eb7:	83 e0 f3             	and    $0xfffffff3,%eax
+     eba:	6a 0a                	push   $0xa
+     ebc:	83 c0 70             	add    $0x70,%eax
+     ebf:	50                   	push   %eax
+     ec0:	56                   	push   %esi
+     ec1:	e8 da 2e 00 00       	call   3da0 <memset>
+     ec6:	83 c4 10             	add    $0x10,%esp
+     ec9:	eb 0a                	jmp    ed5 <sharedfd+0x75>
+     ecb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ecf:	90                   	nop
+  for(i = 0; i < 1000; i++){
+     ed0:	83 eb 01             	sub    $0x1,%ebx
+     ed3:	74 26                	je     efb <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+     ed5:	83 ec 04             	sub    $0x4,%esp
+     ed8:	6a 0a                	push   $0xa
+     eda:	56                   	push   %esi
+     edb:	57                   	push   %edi
+     edc:	e8 4c 31 00 00       	call   402d <write>
+     ee1:	83 c4 10             	add    $0x10,%esp
+     ee4:	83 f8 0a             	cmp    $0xa,%eax
+     ee7:	74 e7                	je     ed0 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+     ee9:	83 ec 08             	sub    $0x8,%esp
+     eec:	68 44 59 00 00       	push   $0x5944
+     ef1:	6a 01                	push   $0x1
+     ef3:	e8 b8 33 00 00       	call   42b0 <printf>
+      break;
+     ef8:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+     efb:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     efe:	85 c9                	test   %ecx,%ecx
+     f00:	0f 84 f5 00 00 00    	je     ffb <sharedfd+0x19b>
+    wait();
+     f06:	e8 0d 31 00 00       	call   4018 <wait>
+  close(fd);
+     f0b:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+     f0e:	31 db                	xor    %ebx,%ebx
+  close(fd);
+     f10:	57                   	push   %edi
+     f11:	8d 7d e8             	lea    -0x18(%ebp),%edi
+     f14:	e8 57 2d 00 00       	call   3c70 <close>
+  fd = open("sharedfd", 0);
+     f19:	58                   	pop    %eax
+     f1a:	5a                   	pop    %edx
+     f1b:	6a 00                	push   $0x0
+     f1d:	68 9b 4b 00 00       	push   $0x4b9b
+     f22:	e8 22 31 00 00       	call   4049 <open>
+  if(fd < 0){
+     f27:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+     f2a:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+     f2c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+     f2f:	85 c0                	test   %eax,%eax
+     f31:	0f 88 aa 00 00 00    	js     fe1 <sharedfd+0x181>
+     f37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f3e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+     f40:	83 ec 04             	sub    $0x4,%esp
+     f43:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     f46:	6a 0a                	push   $0xa
+     f48:	56                   	push   %esi
+     f49:	ff 75 d0             	push   -0x30(%ebp)
+     f4c:	e8 d5 30 00 00       	call   4026 <read>
+     f51:	83 c4 10             	add    $0x10,%esp
+     f54:	85 c0                	test   %eax,%eax
+     f56:	7e 28                	jle    f80 <sharedfd+0x120>
+     f58:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     f5b:	89 f0                	mov    %esi,%eax
+     f5d:	eb 13                	jmp    f72 <sharedfd+0x112>
+     f5f:	90                   	nop
+        np++;
+     f60:	80 f9 70             	cmp    $0x70,%cl
+     f63:	0f 94 c1             	sete   %cl
+     f66:	0f b6 c9             	movzbl %cl,%ecx
+     f69:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+     f6b:	83 c0 01             	add    $0x1,%eax
+     f6e:	39 f8                	cmp    %edi,%eax
+     f70:	74 ce                	je     f40 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+     f72:	0f b6 08             	movzbl (%eax),%ecx
+     f75:	80 f9 63             	cmp    $0x63,%cl
+     f78:	75 e6                	jne    f60 <sharedfd+0x100>
+        nc++;
+     f7a:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+     f7d:	eb ec                	jmp    f6b <sharedfd+0x10b>
+     f7f:	90                   	nop
+  close(fd);
+     f80:	83 ec 0c             	sub    $0xc,%esp
+     f83:	ff 75 d0             	push   -0x30(%ebp)
+     f86:	e8 e5 2c 00 00       	call   3c70 <close>
+  unlink("sharedfd");
+     f8b:	c7 04 24 9b 4b 00 00 	movl   $0x4b9b,(%esp)
+     f92:	e8 c6 30 00 00       	call   405d <unlink>
+  if(nc == 10000 && np == 10000){
+     f97:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     f9a:	83 c4 10             	add    $0x10,%esp
+     f9d:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+     fa3:	75 5b                	jne    1000 <sharedfd+0x1a0>
+     fa5:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+     fab:	75 53                	jne    1000 <sharedfd+0x1a0>
+    printf(1, "sharedfd ok\n");
+     fad:	83 ec 08             	sub    $0x8,%esp
+     fb0:	68 a4 4b 00 00       	push   $0x4ba4
+     fb5:	6a 01                	push   $0x1
+     fb7:	e8 f4 32 00 00       	call   42b0 <printf>
+     fbc:	83 c4 10             	add    $0x10,%esp
+}
+     fbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     fc2:	5b                   	pop    %ebx
+     fc3:	5e                   	pop    %esi
+     fc4:	5f                   	pop    %edi
+     fc5:	5d                   	pop    %ebp
+     fc6:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+     fc7:	83 ec 08             	sub    $0x8,%esp
+     fca:	68 18 59 00 00       	push   $0x5918
+     fcf:	6a 01                	push   $0x1
+     fd1:	e8 da 32 00 00       	call   42b0 <printf>
+    return;
+     fd6:	83 c4 10             	add    $0x10,%esp
+}
+     fd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     fdc:	5b                   	pop    %ebx
+     fdd:	5e                   	pop    %esi
+     fde:	5f                   	pop    %edi
+     fdf:	5d                   	pop    %ebp
+     fe0:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+     fe1:	83 ec 08             	sub    $0x8,%esp
+     fe4:	68 64 59 00 00       	push   $0x5964
+     fe9:	6a 01                	push   $0x1
+     feb:	e8 c0 32 00 00       	call   42b0 <printf>
+    return;
+     ff0:	83 c4 10             	add    $0x10,%esp
+}
+     ff3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ff6:	5b                   	pop    %ebx
+     ff7:	5e                   	pop    %esi
+     ff8:	5f                   	pop    %edi
+     ff9:	5d                   	pop    %ebp
+     ffa:	c3                   	ret
+    exit();
+     ffb:	e8 00 2c 00 00       	call   3c00 <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    1000:	53                   	push   %ebx
+    1001:	52                   	push   %edx
+    1002:	68 b1 4b 00 00       	push   $0x4bb1
+    1007:	6a 01                	push   $0x1
+    1009:	e8 a2 32 00 00       	call   42b0 <printf>
+    exit();
+    100e:	e8 ed 2b 00 00       	call   3c00 <exit>
+    1013:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    101a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001020 <fourfiles>:
+{
+    1020:	55                   	push   %ebp
+    1021:	89 e5                	mov    %esp,%ebp
+    1023:	57                   	push   %edi
+    1024:	56                   	push   %esi
+    1025:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+    1026:	31 db                	xor    %ebx,%ebx
+{
+    1028:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    102b:	c7 45 d8 c6 4b 00 00 	movl   $0x4bc6,-0x28(%ebp)
+    1032:	c7 45 dc 0f 4d 00 00 	movl   $0x4d0f,-0x24(%ebp)
+    1039:	c7 45 e0 13 4d 00 00 	movl   $0x4d13,-0x20(%ebp)
+    1040:	c7 45 e4 c9 4b 00 00 	movl   $0x4bc9,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+    1047:	68 cc 4b 00 00       	push   $0x4bcc
+    104c:	6a 01                	push   $0x1
+    104e:	e8 5d 32 00 00       	call   42b0 <printf>
+    1053:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+    1056:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+    105a:	83 ec 0c             	sub    $0xc,%esp
+    105d:	56                   	push   %esi
+    105e:	e8 fa 2f 00 00       	call   405d <unlink>
+    pid = fork();
+    1063:	e8 48 2b 00 00       	call   3bb0 <fork>
+    if(pid < 0){
+    1068:	83 c4 10             	add    $0x10,%esp
+    106b:	85 c0                	test   %eax,%eax
+    106d:	0f 88 65 01 00 00    	js     11d8 <fourfiles+0x1b8>
+    if(pid == 0){
+    1073:	0f 84 eb 00 00 00    	je     1164 <fourfiles+0x144>
+  for(pi = 0; pi < 4; pi++){
+    1079:	83 c3 01             	add    $0x1,%ebx
+    107c:	83 fb 04             	cmp    $0x4,%ebx
+    107f:	75 d5                	jne    1056 <fourfiles+0x36>
+    wait();
+    1081:	e8 92 2f 00 00       	call   4018 <wait>
+  for(i = 0; i < 2; i++){
+    1086:	31 f6                	xor    %esi,%esi
+    wait();
+    1088:	e8 8b 2f 00 00       	call   4018 <wait>
+    108d:	e8 86 2f 00 00       	call   4018 <wait>
+    1092:	e8 81 2f 00 00       	call   4018 <wait>
+    fname = names[i];
+    1097:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+    109b:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+    109e:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+    10a0:	6a 00                	push   $0x0
+    10a2:	53                   	push   %ebx
+    10a3:	e8 a1 2f 00 00       	call   4049 <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    10a8:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    10ab:	83 c4 10             	add    $0x10,%esp
+    10ae:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    10b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10b8:	83 ec 04             	sub    $0x4,%esp
+    10bb:	68 00 20 00 00       	push   $0x2000
+    10c0:	68 c0 92 00 00       	push   $0x92c0
+    10c5:	ff 75 d4             	push   -0x2c(%ebp)
+    10c8:	e8 59 2f 00 00       	call   4026 <read>
+    10cd:	83 c4 10             	add    $0x10,%esp
+    10d0:	89 c3                	mov    %eax,%ebx
+    10d2:	85 c0                	test   %eax,%eax
+    10d4:	7e 28                	jle    10fe <fourfiles+0xde>
+      for(j = 0; j < n; j++){
+    10d6:	31 c0                	xor    %eax,%eax
+    10d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10df:	90                   	nop
+        if(buf[j] != '0'+i){
+    10e0:	83 fe 01             	cmp    $0x1,%esi
+    10e3:	0f be 88 c0 92 00 00 	movsbl 0x92c0(%eax),%ecx
+    10ea:	19 d2                	sbb    %edx,%edx
+    10ec:	83 c2 31             	add    $0x31,%edx
+    10ef:	39 d1                	cmp    %edx,%ecx
+    10f1:	75 5d                	jne    1150 <fourfiles+0x130>
+      for(j = 0; j < n; j++){
+    10f3:	83 c0 01             	add    $0x1,%eax
+    10f6:	39 c3                	cmp    %eax,%ebx
+    10f8:	75 e6                	jne    10e0 <fourfiles+0xc0>
+      total += n;
+    10fa:	01 df                	add    %ebx,%edi
+    10fc:	eb ba                	jmp    10b8 <fourfiles+0x98>
+    close(fd);
+    10fe:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    1101:	83 ec 0c             	sub    $0xc,%esp
+    1104:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1107:	51                   	push   %ecx
+    1108:	e8 63 2b 00 00       	call   3c70 <close>
+    if(total != 12*500){
+    110d:	83 c4 10             	add    $0x10,%esp
+    1110:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+    1116:	0f 85 d0 00 00 00    	jne    11ec <fourfiles+0x1cc>
+    unlink(fname);
+    111c:	83 ec 0c             	sub    $0xc,%esp
+    111f:	53                   	push   %ebx
+    1120:	e8 38 2f 00 00       	call   405d <unlink>
+  for(i = 0; i < 2; i++){
+    1125:	83 c4 10             	add    $0x10,%esp
+    1128:	85 f6                	test   %esi,%esi
+    112a:	75 0a                	jne    1136 <fourfiles+0x116>
+    112c:	be 01 00 00 00       	mov    $0x1,%esi
+    1131:	e9 61 ff ff ff       	jmp    1097 <fourfiles+0x77>
+  printf(1, "fourfiles ok\n");
+    1136:	83 ec 08             	sub    $0x8,%esp
+    1139:	68 0a 4c 00 00       	push   $0x4c0a
+    113e:	6a 01                	push   $0x1
+    1140:	e8 6b 31 00 00       	call   42b0 <printf>
+}
+    1145:	83 c4 10             	add    $0x10,%esp
+    1148:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    114b:	5b                   	pop    %ebx
+    114c:	5e                   	pop    %esi
+    114d:	5f                   	pop    %edi
+    114e:	5d                   	pop    %ebp
+    114f:	c3                   	ret
+          printf(1, "wrong char\n");
+    1150:	83 ec 08             	sub    $0x8,%esp
+    1153:	68 ed 4b 00 00       	push   $0x4bed
+    1158:	6a 01                	push   $0x1
+    115a:	e8 51 31 00 00       	call   42b0 <printf>
+          exit();
+    115f:	e8 9c 2a 00 00       	call   3c00 <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+    1164:	83 ec 08             	sub    $0x8,%esp
+    1167:	68 02 02 00 00       	push   $0x202
+    116c:	56                   	push   %esi
+    116d:	e8 d7 2e 00 00       	call   4049 <open>
+      if(fd < 0){
+    1172:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+    1175:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    1177:	85 c0                	test   %eax,%eax
+    1179:	78 45                	js     11c0 <fourfiles+0x1a0>
+      memset(buf, '0'+pi, 512);
+    117b:	83 ec 04             	sub    $0x4,%esp
+    117e:	83 c3 30             	add    $0x30,%ebx
+    1181:	68 00 02 00 00       	push   $0x200
+    1186:	53                   	push   %ebx
+    1187:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    118c:	68 c0 92 00 00       	push   $0x92c0
+    1191:	e8 0a 2c 00 00       	call   3da0 <memset>
+    1196:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+    1199:	83 ec 04             	sub    $0x4,%esp
+    119c:	68 f4 01 00 00       	push   $0x1f4
+    11a1:	68 c0 92 00 00       	push   $0x92c0
+    11a6:	56                   	push   %esi
+    11a7:	e8 81 2e 00 00       	call   402d <write>
+    11ac:	83 c4 10             	add    $0x10,%esp
+    11af:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    11b4:	75 49                	jne    11ff <fourfiles+0x1df>
+      for(i = 0; i < 12; i++){
+    11b6:	83 eb 01             	sub    $0x1,%ebx
+    11b9:	75 de                	jne    1199 <fourfiles+0x179>
+      exit();
+    11bb:	e8 40 2a 00 00       	call   3c00 <exit>
+        printf(1, "create failed\n");
+    11c0:	51                   	push   %ecx
+    11c1:	51                   	push   %ecx
+    11c2:	68 2c 57 00 00       	push   $0x572c
+    11c7:	6a 01                	push   $0x1
+    11c9:	e8 e2 30 00 00       	call   42b0 <printf>
+        exit();
+    11ce:	e8 2d 2a 00 00       	call   3c00 <exit>
+    11d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11d7:	90                   	nop
+      printf(1, "fork failed\n");
+    11d8:	83 ec 08             	sub    $0x8,%esp
+    11db:	68 6a 57 00 00       	push   $0x576a
+    11e0:	6a 01                	push   $0x1
+    11e2:	e8 c9 30 00 00       	call   42b0 <printf>
+      exit();
+    11e7:	e8 14 2a 00 00       	call   3c00 <exit>
+      printf(1, "wrong length %d\n", total);
+    11ec:	50                   	push   %eax
+    11ed:	57                   	push   %edi
+    11ee:	68 f9 4b 00 00       	push   $0x4bf9
+    11f3:	6a 01                	push   $0x1
+    11f5:	e8 b6 30 00 00       	call   42b0 <printf>
+      exit();
+    11fa:	e8 01 2a 00 00       	call   3c00 <exit>
+          printf(1, "write failed %d\n", n);
+    11ff:	52                   	push   %edx
+    1200:	50                   	push   %eax
+    1201:	68 dc 4b 00 00       	push   $0x4bdc
+    1206:	6a 01                	push   $0x1
+    1208:	e8 a3 30 00 00       	call   42b0 <printf>
+          exit();
+    120d:	e8 ee 29 00 00       	call   3c00 <exit>
+    1212:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001220 <createdelete>:
+{
+    1220:	55                   	push   %ebp
+    1221:	89 e5                	mov    %esp,%ebp
+    1223:	57                   	push   %edi
+    1224:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+    1225:	31 f6                	xor    %esi,%esi
+{
+    1227:	53                   	push   %ebx
+    1228:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+    122b:	68 18 4c 00 00       	push   $0x4c18
+    1230:	6a 01                	push   $0x1
+    1232:	e8 79 30 00 00       	call   42b0 <printf>
+    1237:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    123a:	e8 71 29 00 00       	call   3bb0 <fork>
+    123f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    1241:	85 c0                	test   %eax,%eax
+    1243:	0f 88 ac 01 00 00    	js     13f5 <createdelete+0x1d5>
+    if(pid == 0){
+    1249:	0f 84 01 01 00 00    	je     1350 <createdelete+0x130>
+  for(pi = 0; pi < 4; pi++){
+    124f:	83 c6 01             	add    $0x1,%esi
+    1252:	83 fe 04             	cmp    $0x4,%esi
+    1255:	75 e3                	jne    123a <createdelete+0x1a>
+    wait();
+    1257:	e8 bc 2d 00 00       	call   4018 <wait>
+  for(i = 0; i < N; i++){
+    125c:	31 ff                	xor    %edi,%edi
+    125e:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait();
+    1261:	e8 b2 2d 00 00       	call   4018 <wait>
+    1266:	e8 ad 2d 00 00       	call   4018 <wait>
+    126b:	e8 a8 2d 00 00       	call   4018 <wait>
+  name[0] = name[1] = name[2] = 0;
+    1270:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  for(i = 0; i < N; i++){
+    1274:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+    1278:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+    127a:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+    127d:	bb 70 00 00 00       	mov    $0x70,%ebx
+    1282:	0f 94 c2             	sete   %dl
+    1285:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+    1288:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    128b:	0f 9f c0             	setg   %al
+    128e:	09 c2                	or     %eax,%edx
+    1290:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+    1293:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+    1297:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+    129a:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    129d:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    12a0:	6a 00                	push   $0x0
+    12a2:	56                   	push   %esi
+    12a3:	e8 a1 2d 00 00       	call   4049 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    12a8:	83 c4 10             	add    $0x10,%esp
+    12ab:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+    12af:	74 7f                	je     1330 <createdelete+0x110>
+    12b1:	85 c0                	test   %eax,%eax
+    12b3:	0f 88 27 01 00 00    	js     13e0 <createdelete+0x1c0>
+        close(fd);
+    12b9:	83 ec 0c             	sub    $0xc,%esp
+    12bc:	50                   	push   %eax
+    12bd:	e8 ae 29 00 00       	call   3c70 <close>
+    12c2:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    12c5:	83 c3 01             	add    $0x1,%ebx
+    12c8:	80 fb 74             	cmp    $0x74,%bl
+    12cb:	75 c6                	jne    1293 <createdelete+0x73>
+  for(i = 0; i < N; i++){
+    12cd:	83 c7 01             	add    $0x1,%edi
+    12d0:	83 ff 14             	cmp    $0x14,%edi
+    12d3:	75 a3                	jne    1278 <createdelete+0x58>
+    12d5:	bf 70 00 00 00       	mov    $0x70,%edi
+    12da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+    12e0:	8d 47 c0             	lea    -0x40(%edi),%eax
+    12e3:	bb 04 00 00 00       	mov    $0x4,%ebx
+    12e8:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+    12eb:	89 f8                	mov    %edi,%eax
+      unlink(name);
+    12ed:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+    12f0:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    12f3:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    12f7:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    12fa:	56                   	push   %esi
+    12fb:	e8 5d 2d 00 00       	call   405d <unlink>
+    for(pi = 0; pi < 4; pi++){
+    1300:	83 c4 10             	add    $0x10,%esp
+    1303:	83 eb 01             	sub    $0x1,%ebx
+    1306:	75 e3                	jne    12eb <createdelete+0xcb>
+  for(i = 0; i < N; i++){
+    1308:	83 c7 01             	add    $0x1,%edi
+    130b:	89 f8                	mov    %edi,%eax
+    130d:	3c 84                	cmp    $0x84,%al
+    130f:	75 cf                	jne    12e0 <createdelete+0xc0>
+  printf(1, "createdelete ok\n");
+    1311:	83 ec 08             	sub    $0x8,%esp
+    1314:	68 2b 4c 00 00       	push   $0x4c2b
+    1319:	6a 01                	push   $0x1
+    131b:	e8 90 2f 00 00       	call   42b0 <printf>
+}
+    1320:	83 c4 10             	add    $0x10,%esp
+    1323:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1326:	5b                   	pop    %ebx
+    1327:	5e                   	pop    %esi
+    1328:	5f                   	pop    %edi
+    1329:	5d                   	pop    %ebp
+    132a:	c3                   	ret
+    132b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    132f:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    1330:	85 c0                	test   %eax,%eax
+    1332:	78 91                	js     12c5 <createdelete+0xa5>
+        printf(1, "oops createdelete %s did exist\n", name);
+    1334:	50                   	push   %eax
+    1335:	56                   	push   %esi
+    1336:	68 b4 59 00 00       	push   $0x59b4
+    133b:	6a 01                	push   $0x1
+    133d:	e8 6e 2f 00 00       	call   42b0 <printf>
+        exit();
+    1342:	e8 b9 28 00 00       	call   3c00 <exit>
+    1347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    134e:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+    1350:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+    1353:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    1357:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+    135a:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+    135d:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+    1360:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+    1363:	8d 43 30             	lea    0x30(%ebx),%eax
+    1366:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    1369:	68 02 02 00 00       	push   $0x202
+    136e:	56                   	push   %esi
+    136f:	e8 d5 2c 00 00       	call   4049 <open>
+        if(fd < 0){
+    1374:	83 c4 10             	add    $0x10,%esp
+    1377:	85 c0                	test   %eax,%eax
+    1379:	0f 88 8a 00 00 00    	js     1409 <createdelete+0x1e9>
+        close(fd);
+    137f:	83 ec 0c             	sub    $0xc,%esp
+    1382:	50                   	push   %eax
+    1383:	e8 e8 28 00 00       	call   3c70 <close>
+        if(i > 0 && (i % 2 ) == 0){
+    1388:	83 c4 10             	add    $0x10,%esp
+    138b:	85 db                	test   %ebx,%ebx
+    138d:	74 19                	je     13a8 <createdelete+0x188>
+    138f:	f6 c3 01             	test   $0x1,%bl
+    1392:	74 1b                	je     13af <createdelete+0x18f>
+      for(i = 0; i < N; i++){
+    1394:	83 c3 01             	add    $0x1,%ebx
+    1397:	83 fb 14             	cmp    $0x14,%ebx
+    139a:	75 c4                	jne    1360 <createdelete+0x140>
+      exit();
+    139c:	e8 5f 28 00 00       	call   3c00 <exit>
+    13a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(i = 0; i < N; i++){
+    13a8:	bb 01 00 00 00       	mov    $0x1,%ebx
+    13ad:	eb b1                	jmp    1360 <createdelete+0x140>
+          name[1] = '0' + (i / 2);
+    13af:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+    13b1:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+    13b4:	d1 f8                	sar    %eax
+    13b6:	83 c0 30             	add    $0x30,%eax
+    13b9:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    13bc:	56                   	push   %esi
+    13bd:	e8 9b 2c 00 00       	call   405d <unlink>
+    13c2:	83 c4 10             	add    $0x10,%esp
+    13c5:	85 c0                	test   %eax,%eax
+    13c7:	79 cb                	jns    1394 <createdelete+0x174>
+            printf(1, "unlink failed\n");
+    13c9:	52                   	push   %edx
+    13ca:	52                   	push   %edx
+    13cb:	68 19 48 00 00       	push   $0x4819
+    13d0:	6a 01                	push   $0x1
+    13d2:	e8 d9 2e 00 00       	call   42b0 <printf>
+            exit();
+    13d7:	e8 24 28 00 00       	call   3c00 <exit>
+    13dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    13e0:	83 ec 04             	sub    $0x4,%esp
+    13e3:	56                   	push   %esi
+    13e4:	68 90 59 00 00       	push   $0x5990
+    13e9:	6a 01                	push   $0x1
+    13eb:	e8 c0 2e 00 00       	call   42b0 <printf>
+        exit();
+    13f0:	e8 0b 28 00 00       	call   3c00 <exit>
+      printf(1, "fork failed\n");
+    13f5:	83 ec 08             	sub    $0x8,%esp
+    13f8:	68 6a 57 00 00       	push   $0x576a
+    13fd:	6a 01                	push   $0x1
+    13ff:	e8 ac 2e 00 00       	call   42b0 <printf>
+      exit();
+    1404:	e8 f7 27 00 00       	call   3c00 <exit>
+          printf(1, "create failed\n");
+    1409:	83 ec 08             	sub    $0x8,%esp
+    140c:	68 2c 57 00 00       	push   $0x572c
+    1411:	6a 01                	push   $0x1
+    1413:	e8 98 2e 00 00       	call   42b0 <printf>
+          exit();
+    1418:	e8 e3 27 00 00       	call   3c00 <exit>
+    141d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001420 <unlinkread>:
+{
+    1420:	55                   	push   %ebp
+    1421:	89 e5                	mov    %esp,%ebp
+    1423:	56                   	push   %esi
+    1424:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    1425:	83 ec 08             	sub    $0x8,%esp
+    1428:	68 3c 4c 00 00       	push   $0x4c3c
+    142d:	6a 01                	push   $0x1
+    142f:	e8 7c 2e 00 00       	call   42b0 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    1434:	5b                   	pop    %ebx
+    1435:	5e                   	pop    %esi
+    1436:	68 02 02 00 00       	push   $0x202
+    143b:	68 4d 4c 00 00       	push   $0x4c4d
+    1440:	e8 04 2c 00 00       	call   4049 <open>
+  if(fd < 0){
+    1445:	83 c4 10             	add    $0x10,%esp
+    1448:	85 c0                	test   %eax,%eax
+    144a:	0f 88 e6 00 00 00    	js     1536 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    1450:	83 ec 04             	sub    $0x4,%esp
+    1453:	89 c3                	mov    %eax,%ebx
+    1455:	6a 05                	push   $0x5
+    1457:	68 72 4c 00 00       	push   $0x4c72
+    145c:	50                   	push   %eax
+    145d:	e8 cb 2b 00 00       	call   402d <write>
+  close(fd);
+    1462:	89 1c 24             	mov    %ebx,(%esp)
+    1465:	e8 06 28 00 00       	call   3c70 <close>
+  fd = open("unlinkread", O_RDWR);
+    146a:	58                   	pop    %eax
+    146b:	5a                   	pop    %edx
+    146c:	6a 02                	push   $0x2
+    146e:	68 4d 4c 00 00       	push   $0x4c4d
+    1473:	e8 d1 2b 00 00       	call   4049 <open>
+  if(fd < 0){
+    1478:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    147b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    147d:	85 c0                	test   %eax,%eax
+    147f:	0f 88 10 01 00 00    	js     1595 <unlinkread+0x175>
+  if(unlink("unlinkread") != 0){
+    1485:	83 ec 0c             	sub    $0xc,%esp
+    1488:	68 4d 4c 00 00       	push   $0x4c4d
+    148d:	e8 cb 2b 00 00       	call   405d <unlink>
+    1492:	83 c4 10             	add    $0x10,%esp
+    1495:	85 c0                	test   %eax,%eax
+    1497:	0f 85 e5 00 00 00    	jne    1582 <unlinkread+0x162>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    149d:	83 ec 08             	sub    $0x8,%esp
+    14a0:	68 02 02 00 00       	push   $0x202
+    14a5:	68 4d 4c 00 00       	push   $0x4c4d
+    14aa:	e8 9a 2b 00 00       	call   4049 <open>
+  write(fd1, "yyy", 3);
+    14af:	83 c4 0c             	add    $0xc,%esp
+    14b2:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    14b4:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    14b6:	68 aa 4c 00 00       	push   $0x4caa
+    14bb:	50                   	push   %eax
+    14bc:	e8 6c 2b 00 00       	call   402d <write>
+  close(fd1);
+    14c1:	89 34 24             	mov    %esi,(%esp)
+    14c4:	e8 a7 27 00 00       	call   3c70 <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    14c9:	83 c4 0c             	add    $0xc,%esp
+    14cc:	68 00 20 00 00       	push   $0x2000
+    14d1:	68 c0 92 00 00       	push   $0x92c0
+    14d6:	53                   	push   %ebx
+    14d7:	e8 4a 2b 00 00       	call   4026 <read>
+    14dc:	83 c4 10             	add    $0x10,%esp
+    14df:	83 f8 05             	cmp    $0x5,%eax
+    14e2:	0f 85 87 00 00 00    	jne    156f <unlinkread+0x14f>
+  if(buf[0] != 'h'){
+    14e8:	80 3d c0 92 00 00 68 	cmpb   $0x68,0x92c0
+    14ef:	75 6b                	jne    155c <unlinkread+0x13c>
+  if(write(fd, buf, 10) != 10){
+    14f1:	83 ec 04             	sub    $0x4,%esp
+    14f4:	6a 0a                	push   $0xa
+    14f6:	68 c0 92 00 00       	push   $0x92c0
+    14fb:	53                   	push   %ebx
+    14fc:	e8 2c 2b 00 00       	call   402d <write>
+    1501:	83 c4 10             	add    $0x10,%esp
+    1504:	83 f8 0a             	cmp    $0xa,%eax
+    1507:	75 40                	jne    1549 <unlinkread+0x129>
+  close(fd);
+    1509:	83 ec 0c             	sub    $0xc,%esp
+    150c:	53                   	push   %ebx
+    150d:	e8 5e 27 00 00       	call   3c70 <close>
+  unlink("unlinkread");
+    1512:	c7 04 24 4d 4c 00 00 	movl   $0x4c4d,(%esp)
+    1519:	e8 3f 2b 00 00       	call   405d <unlink>
+  printf(1, "unlinkread ok\n");
+    151e:	58                   	pop    %eax
+    151f:	5a                   	pop    %edx
+    1520:	68 f5 4c 00 00       	push   $0x4cf5
+    1525:	6a 01                	push   $0x1
+    1527:	e8 84 2d 00 00       	call   42b0 <printf>
+}
+    152c:	83 c4 10             	add    $0x10,%esp
+    152f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1532:	5b                   	pop    %ebx
+    1533:	5e                   	pop    %esi
+    1534:	5d                   	pop    %ebp
+    1535:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    1536:	51                   	push   %ecx
+    1537:	51                   	push   %ecx
+    1538:	68 58 4c 00 00       	push   $0x4c58
+    153d:	6a 01                	push   $0x1
+    153f:	e8 6c 2d 00 00       	call   42b0 <printf>
+    exit();
+    1544:	e8 b7 26 00 00       	call   3c00 <exit>
+    printf(1, "unlinkread write failed\n");
+    1549:	51                   	push   %ecx
+    154a:	51                   	push   %ecx
+    154b:	68 dc 4c 00 00       	push   $0x4cdc
+    1550:	6a 01                	push   $0x1
+    1552:	e8 59 2d 00 00       	call   42b0 <printf>
+    exit();
+    1557:	e8 a4 26 00 00       	call   3c00 <exit>
+    printf(1, "unlinkread wrong data\n");
+    155c:	53                   	push   %ebx
+    155d:	53                   	push   %ebx
+    155e:	68 c5 4c 00 00       	push   $0x4cc5
+    1563:	6a 01                	push   $0x1
+    1565:	e8 46 2d 00 00       	call   42b0 <printf>
+    exit();
+    156a:	e8 91 26 00 00       	call   3c00 <exit>
+    printf(1, "unlinkread read failed");
+    156f:	56                   	push   %esi
+    1570:	56                   	push   %esi
+    1571:	68 ae 4c 00 00       	push   $0x4cae
+    1576:	6a 01                	push   $0x1
+    1578:	e8 33 2d 00 00       	call   42b0 <printf>
+    exit();
+    157d:	e8 7e 26 00 00       	call   3c00 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    1582:	50                   	push   %eax
+    1583:	50                   	push   %eax
+    1584:	68 90 4c 00 00       	push   $0x4c90
+    1589:	6a 01                	push   $0x1
+    158b:	e8 20 2d 00 00       	call   42b0 <printf>
+    exit();
+    1590:	e8 6b 26 00 00       	call   3c00 <exit>
+    printf(1, "open unlinkread failed\n");
+    1595:	50                   	push   %eax
+    1596:	50                   	push   %eax
+    1597:	68 78 4c 00 00       	push   $0x4c78
+    159c:	6a 01                	push   $0x1
+    159e:	e8 0d 2d 00 00       	call   42b0 <printf>
+    exit();
+    15a3:	e8 58 26 00 00       	call   3c00 <exit>
+    15a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15af:	90                   	nop
+
+000015b0 <linktest>:
+{
+    15b0:	55                   	push   %ebp
+    15b1:	89 e5                	mov    %esp,%ebp
+    15b3:	53                   	push   %ebx
+    15b4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    15b7:	68 04 4d 00 00       	push   $0x4d04
+    15bc:	6a 01                	push   $0x1
+    15be:	e8 ed 2c 00 00       	call   42b0 <printf>
+  unlink("lf1");
+    15c3:	c7 04 24 0e 4d 00 00 	movl   $0x4d0e,(%esp)
+    15ca:	e8 8e 2a 00 00       	call   405d <unlink>
+  unlink("lf2");
+    15cf:	c7 04 24 12 4d 00 00 	movl   $0x4d12,(%esp)
+    15d6:	e8 82 2a 00 00       	call   405d <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    15db:	58                   	pop    %eax
+    15dc:	5a                   	pop    %edx
+    15dd:	68 02 02 00 00       	push   $0x202
+    15e2:	68 0e 4d 00 00       	push   $0x4d0e
+    15e7:	e8 5d 2a 00 00       	call   4049 <open>
+  if(fd < 0){
+    15ec:	83 c4 10             	add    $0x10,%esp
+    15ef:	85 c0                	test   %eax,%eax
+    15f1:	0f 88 1e 01 00 00    	js     1715 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    15f7:	83 ec 04             	sub    $0x4,%esp
+    15fa:	89 c3                	mov    %eax,%ebx
+    15fc:	6a 05                	push   $0x5
+    15fe:	68 72 4c 00 00       	push   $0x4c72
+    1603:	50                   	push   %eax
+    1604:	e8 24 2a 00 00       	call   402d <write>
+    1609:	83 c4 10             	add    $0x10,%esp
+    160c:	83 f8 05             	cmp    $0x5,%eax
+    160f:	0f 85 98 01 00 00    	jne    17ad <linktest+0x1fd>
+  close(fd);
+    1615:	83 ec 0c             	sub    $0xc,%esp
+    1618:	53                   	push   %ebx
+    1619:	e8 52 26 00 00       	call   3c70 <close>
+  if(link("lf1", "lf2") < 0){
+    161e:	5b                   	pop    %ebx
+    161f:	58                   	pop    %eax
+    1620:	68 12 4d 00 00       	push   $0x4d12
+    1625:	68 0e 4d 00 00       	push   $0x4d0e
+    162a:	e8 42 2a 00 00       	call   4071 <link>
+    162f:	83 c4 10             	add    $0x10,%esp
+    1632:	85 c0                	test   %eax,%eax
+    1634:	0f 88 60 01 00 00    	js     179a <linktest+0x1ea>
+  unlink("lf1");
+    163a:	83 ec 0c             	sub    $0xc,%esp
+    163d:	68 0e 4d 00 00       	push   $0x4d0e
+    1642:	e8 16 2a 00 00       	call   405d <unlink>
+  if(open("lf1", 0) >= 0){
+    1647:	58                   	pop    %eax
+    1648:	5a                   	pop    %edx
+    1649:	6a 00                	push   $0x0
+    164b:	68 0e 4d 00 00       	push   $0x4d0e
+    1650:	e8 f4 29 00 00       	call   4049 <open>
+    1655:	83 c4 10             	add    $0x10,%esp
+    1658:	85 c0                	test   %eax,%eax
+    165a:	0f 89 27 01 00 00    	jns    1787 <linktest+0x1d7>
+  fd = open("lf2", 0);
+    1660:	83 ec 08             	sub    $0x8,%esp
+    1663:	6a 00                	push   $0x0
+    1665:	68 12 4d 00 00       	push   $0x4d12
+    166a:	e8 da 29 00 00       	call   4049 <open>
+  if(fd < 0){
+    166f:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    1672:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1674:	85 c0                	test   %eax,%eax
+    1676:	0f 88 f8 00 00 00    	js     1774 <linktest+0x1c4>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    167c:	83 ec 04             	sub    $0x4,%esp
+    167f:	68 00 20 00 00       	push   $0x2000
+    1684:	68 c0 92 00 00       	push   $0x92c0
+    1689:	50                   	push   %eax
+    168a:	e8 97 29 00 00       	call   4026 <read>
+    168f:	83 c4 10             	add    $0x10,%esp
+    1692:	83 f8 05             	cmp    $0x5,%eax
+    1695:	0f 85 c6 00 00 00    	jne    1761 <linktest+0x1b1>
+  close(fd);
+    169b:	83 ec 0c             	sub    $0xc,%esp
+    169e:	53                   	push   %ebx
+    169f:	e8 cc 25 00 00       	call   3c70 <close>
+  if(link("lf2", "lf2") >= 0){
+    16a4:	58                   	pop    %eax
+    16a5:	5a                   	pop    %edx
+    16a6:	68 12 4d 00 00       	push   $0x4d12
+    16ab:	68 12 4d 00 00       	push   $0x4d12
+    16b0:	e8 bc 29 00 00       	call   4071 <link>
+    16b5:	83 c4 10             	add    $0x10,%esp
+    16b8:	85 c0                	test   %eax,%eax
+    16ba:	0f 89 8e 00 00 00    	jns    174e <linktest+0x19e>
+  unlink("lf2");
+    16c0:	83 ec 0c             	sub    $0xc,%esp
+    16c3:	68 12 4d 00 00       	push   $0x4d12
+    16c8:	e8 90 29 00 00       	call   405d <unlink>
+  if(link("lf2", "lf1") >= 0){
+    16cd:	59                   	pop    %ecx
+    16ce:	5b                   	pop    %ebx
+    16cf:	68 0e 4d 00 00       	push   $0x4d0e
+    16d4:	68 12 4d 00 00       	push   $0x4d12
+    16d9:	e8 93 29 00 00       	call   4071 <link>
+    16de:	83 c4 10             	add    $0x10,%esp
+    16e1:	85 c0                	test   %eax,%eax
+    16e3:	79 56                	jns    173b <linktest+0x18b>
+  if(link(".", "lf1") >= 0){
+    16e5:	83 ec 08             	sub    $0x8,%esp
+    16e8:	68 0e 4d 00 00       	push   $0x4d0e
+    16ed:	68 d6 4f 00 00       	push   $0x4fd6
+    16f2:	e8 7a 29 00 00       	call   4071 <link>
+    16f7:	83 c4 10             	add    $0x10,%esp
+    16fa:	85 c0                	test   %eax,%eax
+    16fc:	79 2a                	jns    1728 <linktest+0x178>
+  printf(1, "linktest ok\n");
+    16fe:	83 ec 08             	sub    $0x8,%esp
+    1701:	68 ac 4d 00 00       	push   $0x4dac
+    1706:	6a 01                	push   $0x1
+    1708:	e8 a3 2b 00 00       	call   42b0 <printf>
+}
+    170d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1710:	83 c4 10             	add    $0x10,%esp
+    1713:	c9                   	leave
+    1714:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    1715:	50                   	push   %eax
+    1716:	50                   	push   %eax
+    1717:	68 16 4d 00 00       	push   $0x4d16
+    171c:	6a 01                	push   $0x1
+    171e:	e8 8d 2b 00 00       	call   42b0 <printf>
+    exit();
+    1723:	e8 d8 24 00 00       	call   3c00 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    1728:	50                   	push   %eax
+    1729:	50                   	push   %eax
+    172a:	68 90 4d 00 00       	push   $0x4d90
+    172f:	6a 01                	push   $0x1
+    1731:	e8 7a 2b 00 00       	call   42b0 <printf>
+    exit();
+    1736:	e8 c5 24 00 00       	call   3c00 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    173b:	52                   	push   %edx
+    173c:	52                   	push   %edx
+    173d:	68 fc 59 00 00       	push   $0x59fc
+    1742:	6a 01                	push   $0x1
+    1744:	e8 67 2b 00 00       	call   42b0 <printf>
+    exit();
+    1749:	e8 b2 24 00 00       	call   3c00 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    174e:	50                   	push   %eax
+    174f:	50                   	push   %eax
+    1750:	68 72 4d 00 00       	push   $0x4d72
+    1755:	6a 01                	push   $0x1
+    1757:	e8 54 2b 00 00       	call   42b0 <printf>
+    exit();
+    175c:	e8 9f 24 00 00       	call   3c00 <exit>
+    printf(1, "read lf2 failed\n");
+    1761:	51                   	push   %ecx
+    1762:	51                   	push   %ecx
+    1763:	68 61 4d 00 00       	push   $0x4d61
+    1768:	6a 01                	push   $0x1
+    176a:	e8 41 2b 00 00       	call   42b0 <printf>
+    exit();
+    176f:	e8 8c 24 00 00       	call   3c00 <exit>
+    printf(1, "open lf2 failed\n");
+    1774:	53                   	push   %ebx
+    1775:	53                   	push   %ebx
+    1776:	68 50 4d 00 00       	push   $0x4d50
+    177b:	6a 01                	push   $0x1
+    177d:	e8 2e 2b 00 00       	call   42b0 <printf>
+    exit();
+    1782:	e8 79 24 00 00       	call   3c00 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    1787:	50                   	push   %eax
+    1788:	50                   	push   %eax
+    1789:	68 d4 59 00 00       	push   $0x59d4
+    178e:	6a 01                	push   $0x1
+    1790:	e8 1b 2b 00 00       	call   42b0 <printf>
+    exit();
+    1795:	e8 66 24 00 00       	call   3c00 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    179a:	51                   	push   %ecx
+    179b:	51                   	push   %ecx
+    179c:	68 3b 4d 00 00       	push   $0x4d3b
+    17a1:	6a 01                	push   $0x1
+    17a3:	e8 08 2b 00 00       	call   42b0 <printf>
+    exit();
+    17a8:	e8 53 24 00 00       	call   3c00 <exit>
+    printf(1, "write lf1 failed\n");
+    17ad:	50                   	push   %eax
+    17ae:	50                   	push   %eax
+    17af:	68 29 4d 00 00       	push   $0x4d29
+    17b4:	6a 01                	push   $0x1
+    17b6:	e8 f5 2a 00 00       	call   42b0 <printf>
+    exit();
+    17bb:	e8 40 24 00 00       	call   3c00 <exit>
+
+000017c0 <concreate>:
+{
+    17c0:	55                   	push   %ebp
+    17c1:	89 e5                	mov    %esp,%ebp
+    17c3:	57                   	push   %edi
+    17c4:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    17c5:	31 f6                	xor    %esi,%esi
+{
+    17c7:	53                   	push   %ebx
+    17c8:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    17cb:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    17ce:	68 b9 4d 00 00       	push   $0x4db9
+    17d3:	6a 01                	push   $0x1
+    17d5:	e8 d6 2a 00 00       	call   42b0 <printf>
+  file[0] = 'C';
+    17da:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    17de:	83 c4 10             	add    $0x10,%esp
+    17e1:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    17e5:	eb 4c                	jmp    1833 <concreate+0x73>
+    17e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17ee:	66 90                	xchg   %ax,%ax
+    17f0:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    17f6:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    17fb:	0f 83 8f 00 00 00    	jae    1890 <concreate+0xd0>
+      fd = open(file, O_CREATE | O_RDWR);
+    1801:	83 ec 08             	sub    $0x8,%esp
+    1804:	68 02 02 00 00       	push   $0x202
+    1809:	53                   	push   %ebx
+    180a:	e8 3a 28 00 00       	call   4049 <open>
+      if(fd < 0){
+    180f:	83 c4 10             	add    $0x10,%esp
+    1812:	85 c0                	test   %eax,%eax
+    1814:	78 63                	js     1879 <concreate+0xb9>
+      close(fd);
+    1816:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    1819:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    181c:	50                   	push   %eax
+    181d:	e8 4e 24 00 00       	call   3c70 <close>
+    1822:	83 c4 10             	add    $0x10,%esp
+      wait();
+    1825:	e8 ee 27 00 00       	call   4018 <wait>
+  for(i = 0; i < 40; i++){
+    182a:	83 fe 28             	cmp    $0x28,%esi
+    182d:	0f 84 7f 00 00 00    	je     18b2 <concreate+0xf2>
+    unlink(file);
+    1833:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    1836:	8d 46 30             	lea    0x30(%esi),%eax
+    1839:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    183c:	53                   	push   %ebx
+    183d:	e8 1b 28 00 00       	call   405d <unlink>
+    pid = fork();
+    1842:	e8 69 23 00 00       	call   3bb0 <fork>
+    if(pid && (i % 3) == 1){
+    1847:	83 c4 10             	add    $0x10,%esp
+    184a:	85 c0                	test   %eax,%eax
+    184c:	75 a2                	jne    17f0 <concreate+0x30>
+      link("C0", file);
+    184e:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    1854:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    185a:	0f 83 d0 00 00 00    	jae    1930 <concreate+0x170>
+      fd = open(file, O_CREATE | O_RDWR);
+    1860:	83 ec 08             	sub    $0x8,%esp
+    1863:	68 02 02 00 00       	push   $0x202
+    1868:	53                   	push   %ebx
+    1869:	e8 db 27 00 00       	call   4049 <open>
+      if(fd < 0){
+    186e:	83 c4 10             	add    $0x10,%esp
+    1871:	85 c0                	test   %eax,%eax
+    1873:	0f 89 ea 01 00 00    	jns    1a63 <concreate+0x2a3>
+        printf(1, "concreate create %s failed\n", file);
+    1879:	83 ec 04             	sub    $0x4,%esp
+    187c:	53                   	push   %ebx
+    187d:	68 cc 4d 00 00       	push   $0x4dcc
+    1882:	6a 01                	push   $0x1
+    1884:	e8 27 2a 00 00       	call   42b0 <printf>
+        exit();
+    1889:	e8 72 23 00 00       	call   3c00 <exit>
+    188e:	66 90                	xchg   %ax,%ax
+      link("C0", file);
+    1890:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+    1893:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+    1896:	53                   	push   %ebx
+    1897:	68 c9 4d 00 00       	push   $0x4dc9
+    189c:	e8 d0 27 00 00       	call   4071 <link>
+    18a1:	83 c4 10             	add    $0x10,%esp
+      wait();
+    18a4:	e8 6f 27 00 00       	call   4018 <wait>
+  for(i = 0; i < 40; i++){
+    18a9:	83 fe 28             	cmp    $0x28,%esi
+    18ac:	0f 85 81 ff ff ff    	jne    1833 <concreate+0x73>
+  memset(fa, 0, sizeof(fa));
+    18b2:	83 ec 04             	sub    $0x4,%esp
+    18b5:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    18b8:	6a 28                	push   $0x28
+    18ba:	6a 00                	push   $0x0
+    18bc:	50                   	push   %eax
+    18bd:	e8 de 24 00 00       	call   3da0 <memset>
+  fd = open(".", 0);
+    18c2:	5e                   	pop    %esi
+    18c3:	5f                   	pop    %edi
+    18c4:	6a 00                	push   $0x0
+    18c6:	68 d6 4f 00 00       	push   $0x4fd6
+    18cb:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    18ce:	e8 76 27 00 00       	call   4049 <open>
+  n = 0;
+    18d3:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    18da:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    18dd:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    18df:	90                   	nop
+    18e0:	83 ec 04             	sub    $0x4,%esp
+    18e3:	6a 10                	push   $0x10
+    18e5:	57                   	push   %edi
+    18e6:	56                   	push   %esi
+    18e7:	e8 3a 27 00 00       	call   4026 <read>
+    18ec:	83 c4 10             	add    $0x10,%esp
+    18ef:	85 c0                	test   %eax,%eax
+    18f1:	7e 5d                	jle    1950 <concreate+0x190>
+    if(de.inum == 0)
+    18f3:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    18f8:	74 e6                	je     18e0 <concreate+0x120>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    18fa:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    18fe:	75 e0                	jne    18e0 <concreate+0x120>
+    1900:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    1904:	75 da                	jne    18e0 <concreate+0x120>
+      i = de.name[1] - '0';
+    1906:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    190a:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    190d:	83 f8 27             	cmp    $0x27,%eax
+    1910:	0f 87 5e 01 00 00    	ja     1a74 <concreate+0x2b4>
+      if(fa[i]){
+    1916:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    191b:	0f 85 7e 01 00 00    	jne    1a9f <concreate+0x2df>
+      n++;
+    1921:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    1925:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    192a:	eb b4                	jmp    18e0 <concreate+0x120>
+    192c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    1930:	83 ec 08             	sub    $0x8,%esp
+    1933:	53                   	push   %ebx
+    1934:	68 c9 4d 00 00       	push   $0x4dc9
+    1939:	e8 33 27 00 00       	call   4071 <link>
+    193e:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1941:	e8 ba 22 00 00       	call   3c00 <exit>
+    1946:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    194d:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+    1950:	83 ec 0c             	sub    $0xc,%esp
+    1953:	56                   	push   %esi
+    1954:	e8 17 23 00 00       	call   3c70 <close>
+  if(n != 40){
+    1959:	83 c4 10             	add    $0x10,%esp
+    195c:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    1960:	0f 85 26 01 00 00    	jne    1a8c <concreate+0x2cc>
+  for(i = 0; i < 40; i++){
+    1966:	31 f6                	xor    %esi,%esi
+    1968:	eb 48                	jmp    19b2 <concreate+0x1f2>
+    196a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    1970:	85 ff                	test   %edi,%edi
+    1972:	74 05                	je     1979 <concreate+0x1b9>
+    1974:	83 f8 01             	cmp    $0x1,%eax
+    1977:	74 68                	je     19e1 <concreate+0x221>
+      unlink(file);
+    1979:	83 ec 0c             	sub    $0xc,%esp
+    197c:	53                   	push   %ebx
+    197d:	e8 db 26 00 00       	call   405d <unlink>
+      unlink(file);
+    1982:	89 1c 24             	mov    %ebx,(%esp)
+    1985:	e8 d3 26 00 00       	call   405d <unlink>
+      unlink(file);
+    198a:	89 1c 24             	mov    %ebx,(%esp)
+    198d:	e8 cb 26 00 00       	call   405d <unlink>
+      unlink(file);
+    1992:	89 1c 24             	mov    %ebx,(%esp)
+    1995:	e8 c3 26 00 00       	call   405d <unlink>
+    199a:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    199d:	85 ff                	test   %edi,%edi
+    199f:	74 a0                	je     1941 <concreate+0x181>
+      wait();
+    19a1:	e8 72 26 00 00       	call   4018 <wait>
+  for(i = 0; i < 40; i++){
+    19a6:	83 c6 01             	add    $0x1,%esi
+    19a9:	83 fe 28             	cmp    $0x28,%esi
+    19ac:	0f 84 86 00 00 00    	je     1a38 <concreate+0x278>
+    file[1] = '0' + i;
+    19b2:	8d 46 30             	lea    0x30(%esi),%eax
+    19b5:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    19b8:	e8 f3 21 00 00       	call   3bb0 <fork>
+    19bd:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    19bf:	85 c0                	test   %eax,%eax
+    19c1:	0f 88 88 00 00 00    	js     1a4f <concreate+0x28f>
+    if(((i % 3) == 0 && pid == 0) ||
+    19c7:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    19cc:	f7 e6                	mul    %esi
+    19ce:	89 d0                	mov    %edx,%eax
+    19d0:	83 e2 fe             	and    $0xfffffffe,%edx
+    19d3:	d1 e8                	shr    %eax
+    19d5:	01 c2                	add    %eax,%edx
+    19d7:	89 f0                	mov    %esi,%eax
+    19d9:	29 d0                	sub    %edx,%eax
+    19db:	89 c1                	mov    %eax,%ecx
+    19dd:	09 f9                	or     %edi,%ecx
+    19df:	75 8f                	jne    1970 <concreate+0x1b0>
+      close(open(file, 0));
+    19e1:	83 ec 08             	sub    $0x8,%esp
+    19e4:	6a 00                	push   $0x0
+    19e6:	53                   	push   %ebx
+    19e7:	e8 5d 26 00 00       	call   4049 <open>
+    19ec:	89 04 24             	mov    %eax,(%esp)
+    19ef:	e8 7c 22 00 00       	call   3c70 <close>
+      close(open(file, 0));
+    19f4:	58                   	pop    %eax
+    19f5:	5a                   	pop    %edx
+    19f6:	6a 00                	push   $0x0
+    19f8:	53                   	push   %ebx
+    19f9:	e8 4b 26 00 00       	call   4049 <open>
+    19fe:	89 04 24             	mov    %eax,(%esp)
+    1a01:	e8 6a 22 00 00       	call   3c70 <close>
+      close(open(file, 0));
+    1a06:	59                   	pop    %ecx
+    1a07:	58                   	pop    %eax
+    1a08:	6a 00                	push   $0x0
+    1a0a:	53                   	push   %ebx
+    1a0b:	e8 39 26 00 00       	call   4049 <open>
+    1a10:	89 04 24             	mov    %eax,(%esp)
+    1a13:	e8 58 22 00 00       	call   3c70 <close>
+      close(open(file, 0));
+    1a18:	58                   	pop    %eax
+    1a19:	5a                   	pop    %edx
+    1a1a:	6a 00                	push   $0x0
+    1a1c:	53                   	push   %ebx
+    1a1d:	e8 27 26 00 00       	call   4049 <open>
+    1a22:	89 04 24             	mov    %eax,(%esp)
+    1a25:	e8 46 22 00 00       	call   3c70 <close>
+    1a2a:	83 c4 10             	add    $0x10,%esp
+    1a2d:	e9 6b ff ff ff       	jmp    199d <concreate+0x1dd>
+    1a32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    1a38:	83 ec 08             	sub    $0x8,%esp
+    1a3b:	68 1e 4e 00 00       	push   $0x4e1e
+    1a40:	6a 01                	push   $0x1
+    1a42:	e8 69 28 00 00       	call   42b0 <printf>
+}
+    1a47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a4a:	5b                   	pop    %ebx
+    1a4b:	5e                   	pop    %esi
+    1a4c:	5f                   	pop    %edi
+    1a4d:	5d                   	pop    %ebp
+    1a4e:	c3                   	ret
+      printf(1, "fork failed\n");
+    1a4f:	83 ec 08             	sub    $0x8,%esp
+    1a52:	68 6a 57 00 00       	push   $0x576a
+    1a57:	6a 01                	push   $0x1
+    1a59:	e8 52 28 00 00       	call   42b0 <printf>
+      exit();
+    1a5e:	e8 9d 21 00 00       	call   3c00 <exit>
+      close(fd);
+    1a63:	83 ec 0c             	sub    $0xc,%esp
+    1a66:	50                   	push   %eax
+    1a67:	e8 04 22 00 00       	call   3c70 <close>
+    1a6c:	83 c4 10             	add    $0x10,%esp
+    1a6f:	e9 cd fe ff ff       	jmp    1941 <concreate+0x181>
+        printf(1, "concreate weird file %s\n", de.name);
+    1a74:	83 ec 04             	sub    $0x4,%esp
+    1a77:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1a7a:	50                   	push   %eax
+    1a7b:	68 e8 4d 00 00       	push   $0x4de8
+    1a80:	6a 01                	push   $0x1
+    1a82:	e8 29 28 00 00       	call   42b0 <printf>
+        exit();
+    1a87:	e8 74 21 00 00       	call   3c00 <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    1a8c:	51                   	push   %ecx
+    1a8d:	51                   	push   %ecx
+    1a8e:	68 20 5a 00 00       	push   $0x5a20
+    1a93:	6a 01                	push   $0x1
+    1a95:	e8 16 28 00 00       	call   42b0 <printf>
+    exit();
+    1a9a:	e8 61 21 00 00       	call   3c00 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    1a9f:	83 ec 04             	sub    $0x4,%esp
+    1aa2:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1aa5:	50                   	push   %eax
+    1aa6:	68 01 4e 00 00       	push   $0x4e01
+    1aab:	6a 01                	push   $0x1
+    1aad:	e8 fe 27 00 00       	call   42b0 <printf>
+        exit();
+    1ab2:	e8 49 21 00 00       	call   3c00 <exit>
+    1ab7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1abe:	66 90                	xchg   %ax,%ax
+
+00001ac0 <linkunlink>:
+{
+    1ac0:	55                   	push   %ebp
+    1ac1:	89 e5                	mov    %esp,%ebp
+    1ac3:	57                   	push   %edi
+    1ac4:	56                   	push   %esi
+    1ac5:	53                   	push   %ebx
+    1ac6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    1ac9:	68 2c 4e 00 00       	push   $0x4e2c
+    1ace:	6a 01                	push   $0x1
+    1ad0:	e8 db 27 00 00       	call   42b0 <printf>
+  unlink("x");
+    1ad5:	c7 04 24 b9 50 00 00 	movl   $0x50b9,(%esp)
+    1adc:	e8 7c 25 00 00       	call   405d <unlink>
+  pid = fork();
+    1ae1:	e8 ca 20 00 00       	call   3bb0 <fork>
+  if(pid < 0){
+    1ae6:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    1ae9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    1aec:	85 c0                	test   %eax,%eax
+    1aee:	0f 88 b6 00 00 00    	js     1baa <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    1af4:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    1af8:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    1afd:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    1b02:	19 ff                	sbb    %edi,%edi
+    1b04:	83 e7 60             	and    $0x60,%edi
+    1b07:	83 c7 01             	add    $0x1,%edi
+    1b0a:	eb 1e                	jmp    1b2a <linkunlink+0x6a>
+    1b0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    1b10:	83 f8 01             	cmp    $0x1,%eax
+    1b13:	74 7b                	je     1b90 <linkunlink+0xd0>
+      unlink("x");
+    1b15:	83 ec 0c             	sub    $0xc,%esp
+    1b18:	68 b9 50 00 00       	push   $0x50b9
+    1b1d:	e8 3b 25 00 00       	call   405d <unlink>
+    1b22:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1b25:	83 eb 01             	sub    $0x1,%ebx
+    1b28:	74 41                	je     1b6b <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    1b2a:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    1b30:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    1b36:	89 f8                	mov    %edi,%eax
+    1b38:	f7 e6                	mul    %esi
+    1b3a:	89 d0                	mov    %edx,%eax
+    1b3c:	83 e2 fe             	and    $0xfffffffe,%edx
+    1b3f:	d1 e8                	shr    %eax
+    1b41:	01 c2                	add    %eax,%edx
+    1b43:	89 f8                	mov    %edi,%eax
+    1b45:	29 d0                	sub    %edx,%eax
+    1b47:	75 c7                	jne    1b10 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    1b49:	83 ec 08             	sub    $0x8,%esp
+    1b4c:	68 02 02 00 00       	push   $0x202
+    1b51:	68 b9 50 00 00       	push   $0x50b9
+    1b56:	e8 ee 24 00 00       	call   4049 <open>
+    1b5b:	89 04 24             	mov    %eax,(%esp)
+    1b5e:	e8 0d 21 00 00       	call   3c70 <close>
+    1b63:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1b66:	83 eb 01             	sub    $0x1,%ebx
+    1b69:	75 bf                	jne    1b2a <linkunlink+0x6a>
+  if(pid)
+    1b6b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1b6e:	85 c0                	test   %eax,%eax
+    1b70:	74 4b                	je     1bbd <linkunlink+0xfd>
+    wait();
+    1b72:	e8 a1 24 00 00       	call   4018 <wait>
+  printf(1, "linkunlink ok\n");
+    1b77:	83 ec 08             	sub    $0x8,%esp
+    1b7a:	68 41 4e 00 00       	push   $0x4e41
+    1b7f:	6a 01                	push   $0x1
+    1b81:	e8 2a 27 00 00       	call   42b0 <printf>
+}
+    1b86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b89:	5b                   	pop    %ebx
+    1b8a:	5e                   	pop    %esi
+    1b8b:	5f                   	pop    %edi
+    1b8c:	5d                   	pop    %ebp
+    1b8d:	c3                   	ret
+    1b8e:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    1b90:	83 ec 08             	sub    $0x8,%esp
+    1b93:	68 b9 50 00 00       	push   $0x50b9
+    1b98:	68 3d 4e 00 00       	push   $0x4e3d
+    1b9d:	e8 cf 24 00 00       	call   4071 <link>
+    1ba2:	83 c4 10             	add    $0x10,%esp
+    1ba5:	e9 7b ff ff ff       	jmp    1b25 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    1baa:	52                   	push   %edx
+    1bab:	52                   	push   %edx
+    1bac:	68 6a 57 00 00       	push   $0x576a
+    1bb1:	6a 01                	push   $0x1
+    1bb3:	e8 f8 26 00 00       	call   42b0 <printf>
+    exit();
+    1bb8:	e8 43 20 00 00       	call   3c00 <exit>
+    exit();
+    1bbd:	e8 3e 20 00 00       	call   3c00 <exit>
+    1bc2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001bd0 <bigdir>:
+{
+    1bd0:	55                   	push   %ebp
+    1bd1:	89 e5                	mov    %esp,%ebp
+    1bd3:	57                   	push   %edi
+    1bd4:	56                   	push   %esi
+    1bd5:	53                   	push   %ebx
+    1bd6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    1bd9:	68 50 4e 00 00       	push   $0x4e50
+    1bde:	6a 01                	push   $0x1
+    1be0:	e8 cb 26 00 00       	call   42b0 <printf>
+  unlink("bd");
+    1be5:	c7 04 24 5d 4e 00 00 	movl   $0x4e5d,(%esp)
+    1bec:	e8 6c 24 00 00       	call   405d <unlink>
+  fd = open("bd", O_CREATE);
+    1bf1:	5a                   	pop    %edx
+    1bf2:	59                   	pop    %ecx
+    1bf3:	68 00 02 00 00       	push   $0x200
+    1bf8:	68 5d 4e 00 00       	push   $0x4e5d
+    1bfd:	e8 47 24 00 00       	call   4049 <open>
+  if(fd < 0){
+    1c02:	83 c4 10             	add    $0x10,%esp
+    1c05:	85 c0                	test   %eax,%eax
+    1c07:	0f 88 de 00 00 00    	js     1ceb <bigdir+0x11b>
+  close(fd);
+    1c0d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    1c10:	31 f6                	xor    %esi,%esi
+    1c12:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    1c15:	50                   	push   %eax
+    1c16:	e8 55 20 00 00       	call   3c70 <close>
+    1c1b:	83 c4 10             	add    $0x10,%esp
+    1c1e:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    1c20:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    1c22:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    1c25:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1c29:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1c2c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1c30:	83 c0 30             	add    $0x30,%eax
+    1c33:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1c36:	89 f0                	mov    %esi,%eax
+    1c38:	83 e0 3f             	and    $0x3f,%eax
+    1c3b:	83 c0 30             	add    $0x30,%eax
+    1c3e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    1c41:	57                   	push   %edi
+    1c42:	68 5d 4e 00 00       	push   $0x4e5d
+    1c47:	e8 25 24 00 00       	call   4071 <link>
+    1c4c:	83 c4 10             	add    $0x10,%esp
+    1c4f:	89 c3                	mov    %eax,%ebx
+    1c51:	85 c0                	test   %eax,%eax
+    1c53:	75 6e                	jne    1cc3 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    1c55:	83 c6 01             	add    $0x1,%esi
+    1c58:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    1c5e:	75 c0                	jne    1c20 <bigdir+0x50>
+  unlink("bd");
+    1c60:	83 ec 0c             	sub    $0xc,%esp
+    1c63:	68 5d 4e 00 00       	push   $0x4e5d
+    1c68:	e8 f0 23 00 00       	call   405d <unlink>
+    1c6d:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    1c70:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    1c72:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    1c75:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1c79:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1c7c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1c80:	83 c0 30             	add    $0x30,%eax
+    1c83:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1c86:	89 d8                	mov    %ebx,%eax
+    1c88:	83 e0 3f             	and    $0x3f,%eax
+    1c8b:	83 c0 30             	add    $0x30,%eax
+    1c8e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    1c91:	57                   	push   %edi
+    1c92:	e8 c6 23 00 00       	call   405d <unlink>
+    1c97:	83 c4 10             	add    $0x10,%esp
+    1c9a:	85 c0                	test   %eax,%eax
+    1c9c:	75 39                	jne    1cd7 <bigdir+0x107>
+  for(i = 0; i < 500; i++){
+    1c9e:	83 c3 01             	add    $0x1,%ebx
+    1ca1:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    1ca7:	75 c7                	jne    1c70 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    1ca9:	83 ec 08             	sub    $0x8,%esp
+    1cac:	68 9f 4e 00 00       	push   $0x4e9f
+    1cb1:	6a 01                	push   $0x1
+    1cb3:	e8 f8 25 00 00       	call   42b0 <printf>
+    1cb8:	83 c4 10             	add    $0x10,%esp
+}
+    1cbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1cbe:	5b                   	pop    %ebx
+    1cbf:	5e                   	pop    %esi
+    1cc0:	5f                   	pop    %edi
+    1cc1:	5d                   	pop    %ebp
+    1cc2:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    1cc3:	83 ec 08             	sub    $0x8,%esp
+    1cc6:	68 76 4e 00 00       	push   $0x4e76
+    1ccb:	6a 01                	push   $0x1
+    1ccd:	e8 de 25 00 00       	call   42b0 <printf>
+      exit();
+    1cd2:	e8 29 1f 00 00       	call   3c00 <exit>
+      printf(1, "bigdir unlink failed");
+    1cd7:	83 ec 08             	sub    $0x8,%esp
+    1cda:	68 8a 4e 00 00       	push   $0x4e8a
+    1cdf:	6a 01                	push   $0x1
+    1ce1:	e8 ca 25 00 00       	call   42b0 <printf>
+      exit();
+    1ce6:	e8 15 1f 00 00       	call   3c00 <exit>
+    printf(1, "bigdir create failed\n");
+    1ceb:	50                   	push   %eax
+    1cec:	50                   	push   %eax
+    1ced:	68 60 4e 00 00       	push   $0x4e60
+    1cf2:	6a 01                	push   $0x1
+    1cf4:	e8 b7 25 00 00       	call   42b0 <printf>
+    exit();
+    1cf9:	e8 02 1f 00 00       	call   3c00 <exit>
+    1cfe:	66 90                	xchg   %ax,%ax
+
+00001d00 <subdir>:
+{
+    1d00:	55                   	push   %ebp
+    1d01:	89 e5                	mov    %esp,%ebp
+    1d03:	53                   	push   %ebx
+    1d04:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    1d07:	68 aa 4e 00 00       	push   $0x4eaa
+    1d0c:	6a 01                	push   $0x1
+    1d0e:	e8 9d 25 00 00       	call   42b0 <printf>
+  unlink("ff");
+    1d13:	c7 04 24 33 4f 00 00 	movl   $0x4f33,(%esp)
+    1d1a:	e8 3e 23 00 00       	call   405d <unlink>
+  if(mkdir("dd") != 0){
+    1d1f:	c7 04 24 d0 4f 00 00 	movl   $0x4fd0,(%esp)
+    1d26:	e8 50 23 00 00       	call   407b <mkdir>
+    1d2b:	83 c4 10             	add    $0x10,%esp
+    1d2e:	85 c0                	test   %eax,%eax
+    1d30:	0f 85 b3 05 00 00    	jne    22e9 <subdir+0x5e9>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1d36:	83 ec 08             	sub    $0x8,%esp
+    1d39:	68 02 02 00 00       	push   $0x202
+    1d3e:	68 09 4f 00 00       	push   $0x4f09
+    1d43:	e8 01 23 00 00       	call   4049 <open>
+  if(fd < 0){
+    1d48:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1d4b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1d4d:	85 c0                	test   %eax,%eax
+    1d4f:	0f 88 81 05 00 00    	js     22d6 <subdir+0x5d6>
+  write(fd, "ff", 2);
+    1d55:	83 ec 04             	sub    $0x4,%esp
+    1d58:	6a 02                	push   $0x2
+    1d5a:	68 33 4f 00 00       	push   $0x4f33
+    1d5f:	50                   	push   %eax
+    1d60:	e8 c8 22 00 00       	call   402d <write>
+  close(fd);
+    1d65:	89 1c 24             	mov    %ebx,(%esp)
+    1d68:	e8 03 1f 00 00       	call   3c70 <close>
+  if(unlink("dd") >= 0){
+    1d6d:	c7 04 24 d0 4f 00 00 	movl   $0x4fd0,(%esp)
+    1d74:	e8 e4 22 00 00       	call   405d <unlink>
+    1d79:	83 c4 10             	add    $0x10,%esp
+    1d7c:	85 c0                	test   %eax,%eax
+    1d7e:	0f 89 3f 05 00 00    	jns    22c3 <subdir+0x5c3>
+  if(mkdir("/dd/dd") != 0){
+    1d84:	83 ec 0c             	sub    $0xc,%esp
+    1d87:	68 e4 4e 00 00       	push   $0x4ee4
+    1d8c:	e8 ea 22 00 00       	call   407b <mkdir>
+    1d91:	83 c4 10             	add    $0x10,%esp
+    1d94:	85 c0                	test   %eax,%eax
+    1d96:	0f 85 14 05 00 00    	jne    22b0 <subdir+0x5b0>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    1d9c:	83 ec 08             	sub    $0x8,%esp
+    1d9f:	68 02 02 00 00       	push   $0x202
+    1da4:	68 06 4f 00 00       	push   $0x4f06
+    1da9:	e8 9b 22 00 00       	call   4049 <open>
+  if(fd < 0){
+    1dae:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    1db1:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1db3:	85 c0                	test   %eax,%eax
+    1db5:	0f 88 24 04 00 00    	js     21df <subdir+0x4df>
+  write(fd, "FF", 2);
+    1dbb:	83 ec 04             	sub    $0x4,%esp
+    1dbe:	6a 02                	push   $0x2
+    1dc0:	68 27 4f 00 00       	push   $0x4f27
+    1dc5:	50                   	push   %eax
+    1dc6:	e8 62 22 00 00       	call   402d <write>
+  close(fd);
+    1dcb:	89 1c 24             	mov    %ebx,(%esp)
+    1dce:	e8 9d 1e 00 00       	call   3c70 <close>
+  fd = open("dd/dd/../ff", 0);
+    1dd3:	58                   	pop    %eax
+    1dd4:	5a                   	pop    %edx
+    1dd5:	6a 00                	push   $0x0
+    1dd7:	68 2a 4f 00 00       	push   $0x4f2a
+    1ddc:	e8 68 22 00 00       	call   4049 <open>
+  if(fd < 0){
+    1de1:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    1de4:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1de6:	85 c0                	test   %eax,%eax
+    1de8:	0f 88 de 03 00 00    	js     21cc <subdir+0x4cc>
+  cc = read(fd, buf, sizeof(buf));
+    1dee:	83 ec 04             	sub    $0x4,%esp
+    1df1:	68 00 20 00 00       	push   $0x2000
+    1df6:	68 c0 92 00 00       	push   $0x92c0
+    1dfb:	50                   	push   %eax
+    1dfc:	e8 25 22 00 00       	call   4026 <read>
+  if(cc != 2 || buf[0] != 'f'){
+    1e01:	83 c4 10             	add    $0x10,%esp
+    1e04:	83 f8 02             	cmp    $0x2,%eax
+    1e07:	0f 85 3a 03 00 00    	jne    2147 <subdir+0x447>
+    1e0d:	80 3d c0 92 00 00 66 	cmpb   $0x66,0x92c0
+    1e14:	0f 85 2d 03 00 00    	jne    2147 <subdir+0x447>
+  close(fd);
+    1e1a:	83 ec 0c             	sub    $0xc,%esp
+    1e1d:	53                   	push   %ebx
+    1e1e:	e8 4d 1e 00 00       	call   3c70 <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    1e23:	59                   	pop    %ecx
+    1e24:	5b                   	pop    %ebx
+    1e25:	68 6a 4f 00 00       	push   $0x4f6a
+    1e2a:	68 06 4f 00 00       	push   $0x4f06
+    1e2f:	e8 3d 22 00 00       	call   4071 <link>
+    1e34:	83 c4 10             	add    $0x10,%esp
+    1e37:	85 c0                	test   %eax,%eax
+    1e39:	0f 85 c6 03 00 00    	jne    2205 <subdir+0x505>
+  if(unlink("dd/dd/ff") != 0){
+    1e3f:	83 ec 0c             	sub    $0xc,%esp
+    1e42:	68 06 4f 00 00       	push   $0x4f06
+    1e47:	e8 11 22 00 00       	call   405d <unlink>
+    1e4c:	83 c4 10             	add    $0x10,%esp
+    1e4f:	85 c0                	test   %eax,%eax
+    1e51:	0f 85 16 03 00 00    	jne    216d <subdir+0x46d>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    1e57:	83 ec 08             	sub    $0x8,%esp
+    1e5a:	6a 00                	push   $0x0
+    1e5c:	68 06 4f 00 00       	push   $0x4f06
+    1e61:	e8 e3 21 00 00       	call   4049 <open>
+    1e66:	83 c4 10             	add    $0x10,%esp
+    1e69:	85 c0                	test   %eax,%eax
+    1e6b:	0f 89 2c 04 00 00    	jns    229d <subdir+0x59d>
+  if(chdir("dd") != 0){
+    1e71:	83 ec 0c             	sub    $0xc,%esp
+    1e74:	68 d0 4f 00 00       	push   $0x4fd0
+    1e79:	e8 07 22 00 00       	call   4085 <chdir>
+    1e7e:	83 c4 10             	add    $0x10,%esp
+    1e81:	85 c0                	test   %eax,%eax
+    1e83:	0f 85 01 04 00 00    	jne    228a <subdir+0x58a>
+  if(chdir("dd/../../dd") != 0){
+    1e89:	83 ec 0c             	sub    $0xc,%esp
+    1e8c:	68 9e 4f 00 00       	push   $0x4f9e
+    1e91:	e8 ef 21 00 00       	call   4085 <chdir>
+    1e96:	83 c4 10             	add    $0x10,%esp
+    1e99:	85 c0                	test   %eax,%eax
+    1e9b:	0f 85 b9 02 00 00    	jne    215a <subdir+0x45a>
+  if(chdir("dd/../../../dd") != 0){
+    1ea1:	83 ec 0c             	sub    $0xc,%esp
+    1ea4:	68 c4 4f 00 00       	push   $0x4fc4
+    1ea9:	e8 d7 21 00 00       	call   4085 <chdir>
+    1eae:	83 c4 10             	add    $0x10,%esp
+    1eb1:	85 c0                	test   %eax,%eax
+    1eb3:	0f 85 a1 02 00 00    	jne    215a <subdir+0x45a>
+  if(chdir("./..") != 0){
+    1eb9:	83 ec 0c             	sub    $0xc,%esp
+    1ebc:	68 d3 4f 00 00       	push   $0x4fd3
+    1ec1:	e8 bf 21 00 00       	call   4085 <chdir>
+    1ec6:	83 c4 10             	add    $0x10,%esp
+    1ec9:	85 c0                	test   %eax,%eax
+    1ecb:	0f 85 21 03 00 00    	jne    21f2 <subdir+0x4f2>
+  fd = open("dd/dd/ffff", 0);
+    1ed1:	83 ec 08             	sub    $0x8,%esp
+    1ed4:	6a 00                	push   $0x0
+    1ed6:	68 6a 4f 00 00       	push   $0x4f6a
+    1edb:	e8 69 21 00 00       	call   4049 <open>
+  if(fd < 0){
+    1ee0:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    1ee3:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1ee5:	85 c0                	test   %eax,%eax
+    1ee7:	0f 88 e0 04 00 00    	js     23cd <subdir+0x6cd>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    1eed:	83 ec 04             	sub    $0x4,%esp
+    1ef0:	68 00 20 00 00       	push   $0x2000
+    1ef5:	68 c0 92 00 00       	push   $0x92c0
+    1efa:	50                   	push   %eax
+    1efb:	e8 26 21 00 00       	call   4026 <read>
+    1f00:	83 c4 10             	add    $0x10,%esp
+    1f03:	83 f8 02             	cmp    $0x2,%eax
+    1f06:	0f 85 ae 04 00 00    	jne    23ba <subdir+0x6ba>
+  close(fd);
+    1f0c:	83 ec 0c             	sub    $0xc,%esp
+    1f0f:	53                   	push   %ebx
+    1f10:	e8 5b 1d 00 00       	call   3c70 <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    1f15:	58                   	pop    %eax
+    1f16:	5a                   	pop    %edx
+    1f17:	6a 00                	push   $0x0
+    1f19:	68 06 4f 00 00       	push   $0x4f06
+    1f1e:	e8 26 21 00 00       	call   4049 <open>
+    1f23:	83 c4 10             	add    $0x10,%esp
+    1f26:	85 c0                	test   %eax,%eax
+    1f28:	0f 89 65 02 00 00    	jns    2193 <subdir+0x493>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    1f2e:	83 ec 08             	sub    $0x8,%esp
+    1f31:	68 02 02 00 00       	push   $0x202
+    1f36:	68 1e 50 00 00       	push   $0x501e
+    1f3b:	e8 09 21 00 00       	call   4049 <open>
+    1f40:	83 c4 10             	add    $0x10,%esp
+    1f43:	85 c0                	test   %eax,%eax
+    1f45:	0f 89 35 02 00 00    	jns    2180 <subdir+0x480>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    1f4b:	83 ec 08             	sub    $0x8,%esp
+    1f4e:	68 02 02 00 00       	push   $0x202
+    1f53:	68 43 50 00 00       	push   $0x5043
+    1f58:	e8 ec 20 00 00       	call   4049 <open>
+    1f5d:	83 c4 10             	add    $0x10,%esp
+    1f60:	85 c0                	test   %eax,%eax
+    1f62:	0f 89 0f 03 00 00    	jns    2277 <subdir+0x577>
+  if(open("dd", O_CREATE) >= 0){
+    1f68:	83 ec 08             	sub    $0x8,%esp
+    1f6b:	68 00 02 00 00       	push   $0x200
+    1f70:	68 d0 4f 00 00       	push   $0x4fd0
+    1f75:	e8 cf 20 00 00       	call   4049 <open>
+    1f7a:	83 c4 10             	add    $0x10,%esp
+    1f7d:	85 c0                	test   %eax,%eax
+    1f7f:	0f 89 df 02 00 00    	jns    2264 <subdir+0x564>
+  if(open("dd", O_RDWR) >= 0){
+    1f85:	83 ec 08             	sub    $0x8,%esp
+    1f88:	6a 02                	push   $0x2
+    1f8a:	68 d0 4f 00 00       	push   $0x4fd0
+    1f8f:	e8 b5 20 00 00       	call   4049 <open>
+    1f94:	83 c4 10             	add    $0x10,%esp
+    1f97:	85 c0                	test   %eax,%eax
+    1f99:	0f 89 b2 02 00 00    	jns    2251 <subdir+0x551>
+  if(open("dd", O_WRONLY) >= 0){
+    1f9f:	83 ec 08             	sub    $0x8,%esp
+    1fa2:	6a 01                	push   $0x1
+    1fa4:	68 d0 4f 00 00       	push   $0x4fd0
+    1fa9:	e8 9b 20 00 00       	call   4049 <open>
+    1fae:	83 c4 10             	add    $0x10,%esp
+    1fb1:	85 c0                	test   %eax,%eax
+    1fb3:	0f 89 85 02 00 00    	jns    223e <subdir+0x53e>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    1fb9:	83 ec 08             	sub    $0x8,%esp
+    1fbc:	68 b2 50 00 00       	push   $0x50b2
+    1fc1:	68 1e 50 00 00       	push   $0x501e
+    1fc6:	e8 a6 20 00 00       	call   4071 <link>
+    1fcb:	83 c4 10             	add    $0x10,%esp
+    1fce:	85 c0                	test   %eax,%eax
+    1fd0:	0f 84 55 02 00 00    	je     222b <subdir+0x52b>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    1fd6:	83 ec 08             	sub    $0x8,%esp
+    1fd9:	68 b2 50 00 00       	push   $0x50b2
+    1fde:	68 43 50 00 00       	push   $0x5043
+    1fe3:	e8 89 20 00 00       	call   4071 <link>
+    1fe8:	83 c4 10             	add    $0x10,%esp
+    1feb:	85 c0                	test   %eax,%eax
+    1fed:	0f 84 25 02 00 00    	je     2218 <subdir+0x518>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    1ff3:	83 ec 08             	sub    $0x8,%esp
+    1ff6:	68 6a 4f 00 00       	push   $0x4f6a
+    1ffb:	68 09 4f 00 00       	push   $0x4f09
+    2000:	e8 6c 20 00 00       	call   4071 <link>
+    2005:	83 c4 10             	add    $0x10,%esp
+    2008:	85 c0                	test   %eax,%eax
+    200a:	0f 84 a9 01 00 00    	je     21b9 <subdir+0x4b9>
+  if(mkdir("dd/ff/ff") == 0){
+    2010:	83 ec 0c             	sub    $0xc,%esp
+    2013:	68 1e 50 00 00       	push   $0x501e
+    2018:	e8 5e 20 00 00       	call   407b <mkdir>
+    201d:	83 c4 10             	add    $0x10,%esp
+    2020:	85 c0                	test   %eax,%eax
+    2022:	0f 84 7e 01 00 00    	je     21a6 <subdir+0x4a6>
+  if(mkdir("dd/xx/ff") == 0){
+    2028:	83 ec 0c             	sub    $0xc,%esp
+    202b:	68 43 50 00 00       	push   $0x5043
+    2030:	e8 46 20 00 00       	call   407b <mkdir>
+    2035:	83 c4 10             	add    $0x10,%esp
+    2038:	85 c0                	test   %eax,%eax
+    203a:	0f 84 67 03 00 00    	je     23a7 <subdir+0x6a7>
+  if(mkdir("dd/dd/ffff") == 0){
+    2040:	83 ec 0c             	sub    $0xc,%esp
+    2043:	68 6a 4f 00 00       	push   $0x4f6a
+    2048:	e8 2e 20 00 00       	call   407b <mkdir>
+    204d:	83 c4 10             	add    $0x10,%esp
+    2050:	85 c0                	test   %eax,%eax
+    2052:	0f 84 3c 03 00 00    	je     2394 <subdir+0x694>
+  if(unlink("dd/xx/ff") == 0){
+    2058:	83 ec 0c             	sub    $0xc,%esp
+    205b:	68 43 50 00 00       	push   $0x5043
+    2060:	e8 f8 1f 00 00       	call   405d <unlink>
+    2065:	83 c4 10             	add    $0x10,%esp
+    2068:	85 c0                	test   %eax,%eax
+    206a:	0f 84 11 03 00 00    	je     2381 <subdir+0x681>
+  if(unlink("dd/ff/ff") == 0){
+    2070:	83 ec 0c             	sub    $0xc,%esp
+    2073:	68 1e 50 00 00       	push   $0x501e
+    2078:	e8 e0 1f 00 00       	call   405d <unlink>
+    207d:	83 c4 10             	add    $0x10,%esp
+    2080:	85 c0                	test   %eax,%eax
+    2082:	0f 84 e6 02 00 00    	je     236e <subdir+0x66e>
+  if(chdir("dd/ff") == 0){
+    2088:	83 ec 0c             	sub    $0xc,%esp
+    208b:	68 09 4f 00 00       	push   $0x4f09
+    2090:	e8 f0 1f 00 00       	call   4085 <chdir>
+    2095:	83 c4 10             	add    $0x10,%esp
+    2098:	85 c0                	test   %eax,%eax
+    209a:	0f 84 bb 02 00 00    	je     235b <subdir+0x65b>
+  if(chdir("dd/xx") == 0){
+    20a0:	83 ec 0c             	sub    $0xc,%esp
+    20a3:	68 b5 50 00 00       	push   $0x50b5
+    20a8:	e8 d8 1f 00 00       	call   4085 <chdir>
+    20ad:	83 c4 10             	add    $0x10,%esp
+    20b0:	85 c0                	test   %eax,%eax
+    20b2:	0f 84 90 02 00 00    	je     2348 <subdir+0x648>
+  if(unlink("dd/dd/ffff") != 0){
+    20b8:	83 ec 0c             	sub    $0xc,%esp
+    20bb:	68 6a 4f 00 00       	push   $0x4f6a
+    20c0:	e8 98 1f 00 00       	call   405d <unlink>
+    20c5:	83 c4 10             	add    $0x10,%esp
+    20c8:	85 c0                	test   %eax,%eax
+    20ca:	0f 85 9d 00 00 00    	jne    216d <subdir+0x46d>
+  if(unlink("dd/ff") != 0){
+    20d0:	83 ec 0c             	sub    $0xc,%esp
+    20d3:	68 09 4f 00 00       	push   $0x4f09
+    20d8:	e8 80 1f 00 00       	call   405d <unlink>
+    20dd:	83 c4 10             	add    $0x10,%esp
+    20e0:	85 c0                	test   %eax,%eax
+    20e2:	0f 85 4d 02 00 00    	jne    2335 <subdir+0x635>
+  if(unlink("dd") == 0){
+    20e8:	83 ec 0c             	sub    $0xc,%esp
+    20eb:	68 d0 4f 00 00       	push   $0x4fd0
+    20f0:	e8 68 1f 00 00       	call   405d <unlink>
+    20f5:	83 c4 10             	add    $0x10,%esp
+    20f8:	85 c0                	test   %eax,%eax
+    20fa:	0f 84 22 02 00 00    	je     2322 <subdir+0x622>
+  if(unlink("dd/dd") < 0){
+    2100:	83 ec 0c             	sub    $0xc,%esp
+    2103:	68 e5 4e 00 00       	push   $0x4ee5
+    2108:	e8 50 1f 00 00       	call   405d <unlink>
+    210d:	83 c4 10             	add    $0x10,%esp
+    2110:	85 c0                	test   %eax,%eax
+    2112:	0f 88 f7 01 00 00    	js     230f <subdir+0x60f>
+  if(unlink("dd") < 0){
+    2118:	83 ec 0c             	sub    $0xc,%esp
+    211b:	68 d0 4f 00 00       	push   $0x4fd0
+    2120:	e8 38 1f 00 00       	call   405d <unlink>
+    2125:	83 c4 10             	add    $0x10,%esp
+    2128:	85 c0                	test   %eax,%eax
+    212a:	0f 88 cc 01 00 00    	js     22fc <subdir+0x5fc>
+  printf(1, "subdir ok\n");
+    2130:	83 ec 08             	sub    $0x8,%esp
+    2133:	68 b2 51 00 00       	push   $0x51b2
+    2138:	6a 01                	push   $0x1
+    213a:	e8 71 21 00 00       	call   42b0 <printf>
+}
+    213f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2142:	83 c4 10             	add    $0x10,%esp
+    2145:	c9                   	leave
+    2146:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    2147:	50                   	push   %eax
+    2148:	50                   	push   %eax
+    2149:	68 4f 4f 00 00       	push   $0x4f4f
+    214e:	6a 01                	push   $0x1
+    2150:	e8 5b 21 00 00       	call   42b0 <printf>
+    exit();
+    2155:	e8 a6 1a 00 00       	call   3c00 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    215a:	50                   	push   %eax
+    215b:	50                   	push   %eax
+    215c:	68 aa 4f 00 00       	push   $0x4faa
+    2161:	6a 01                	push   $0x1
+    2163:	e8 48 21 00 00       	call   42b0 <printf>
+    exit();
+    2168:	e8 93 1a 00 00       	call   3c00 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    216d:	50                   	push   %eax
+    216e:	50                   	push   %eax
+    216f:	68 75 4f 00 00       	push   $0x4f75
+    2174:	6a 01                	push   $0x1
+    2176:	e8 35 21 00 00       	call   42b0 <printf>
+    exit();
+    217b:	e8 80 1a 00 00       	call   3c00 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    2180:	51                   	push   %ecx
+    2181:	51                   	push   %ecx
+    2182:	68 27 50 00 00       	push   $0x5027
+    2187:	6a 01                	push   $0x1
+    2189:	e8 22 21 00 00       	call   42b0 <printf>
+    exit();
+    218e:	e8 6d 1a 00 00       	call   3c00 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    2193:	53                   	push   %ebx
+    2194:	53                   	push   %ebx
+    2195:	68 c4 5a 00 00       	push   $0x5ac4
+    219a:	6a 01                	push   $0x1
+    219c:	e8 0f 21 00 00       	call   42b0 <printf>
+    exit();
+    21a1:	e8 5a 1a 00 00       	call   3c00 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    21a6:	51                   	push   %ecx
+    21a7:	51                   	push   %ecx
+    21a8:	68 bb 50 00 00       	push   $0x50bb
+    21ad:	6a 01                	push   $0x1
+    21af:	e8 fc 20 00 00       	call   42b0 <printf>
+    exit();
+    21b4:	e8 47 1a 00 00       	call   3c00 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    21b9:	53                   	push   %ebx
+    21ba:	53                   	push   %ebx
+    21bb:	68 34 5b 00 00       	push   $0x5b34
+    21c0:	6a 01                	push   $0x1
+    21c2:	e8 e9 20 00 00       	call   42b0 <printf>
+    exit();
+    21c7:	e8 34 1a 00 00       	call   3c00 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    21cc:	50                   	push   %eax
+    21cd:	50                   	push   %eax
+    21ce:	68 36 4f 00 00       	push   $0x4f36
+    21d3:	6a 01                	push   $0x1
+    21d5:	e8 d6 20 00 00       	call   42b0 <printf>
+    exit();
+    21da:	e8 21 1a 00 00       	call   3c00 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    21df:	51                   	push   %ecx
+    21e0:	51                   	push   %ecx
+    21e1:	68 0f 4f 00 00       	push   $0x4f0f
+    21e6:	6a 01                	push   $0x1
+    21e8:	e8 c3 20 00 00       	call   42b0 <printf>
+    exit();
+    21ed:	e8 0e 1a 00 00       	call   3c00 <exit>
+    printf(1, "chdir ./.. failed\n");
+    21f2:	50                   	push   %eax
+    21f3:	50                   	push   %eax
+    21f4:	68 d8 4f 00 00       	push   $0x4fd8
+    21f9:	6a 01                	push   $0x1
+    21fb:	e8 b0 20 00 00       	call   42b0 <printf>
+    exit();
+    2200:	e8 fb 19 00 00       	call   3c00 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    2205:	52                   	push   %edx
+    2206:	52                   	push   %edx
+    2207:	68 7c 5a 00 00       	push   $0x5a7c
+    220c:	6a 01                	push   $0x1
+    220e:	e8 9d 20 00 00       	call   42b0 <printf>
+    exit();
+    2213:	e8 e8 19 00 00       	call   3c00 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    2218:	50                   	push   %eax
+    2219:	50                   	push   %eax
+    221a:	68 10 5b 00 00       	push   $0x5b10
+    221f:	6a 01                	push   $0x1
+    2221:	e8 8a 20 00 00       	call   42b0 <printf>
+    exit();
+    2226:	e8 d5 19 00 00       	call   3c00 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    222b:	50                   	push   %eax
+    222c:	50                   	push   %eax
+    222d:	68 ec 5a 00 00       	push   $0x5aec
+    2232:	6a 01                	push   $0x1
+    2234:	e8 77 20 00 00       	call   42b0 <printf>
+    exit();
+    2239:	e8 c2 19 00 00       	call   3c00 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    223e:	50                   	push   %eax
+    223f:	50                   	push   %eax
+    2240:	68 97 50 00 00       	push   $0x5097
+    2245:	6a 01                	push   $0x1
+    2247:	e8 64 20 00 00       	call   42b0 <printf>
+    exit();
+    224c:	e8 af 19 00 00       	call   3c00 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    2251:	50                   	push   %eax
+    2252:	50                   	push   %eax
+    2253:	68 7e 50 00 00       	push   $0x507e
+    2258:	6a 01                	push   $0x1
+    225a:	e8 51 20 00 00       	call   42b0 <printf>
+    exit();
+    225f:	e8 9c 19 00 00       	call   3c00 <exit>
+    printf(1, "create dd succeeded!\n");
+    2264:	50                   	push   %eax
+    2265:	50                   	push   %eax
+    2266:	68 68 50 00 00       	push   $0x5068
+    226b:	6a 01                	push   $0x1
+    226d:	e8 3e 20 00 00       	call   42b0 <printf>
+    exit();
+    2272:	e8 89 19 00 00       	call   3c00 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    2277:	52                   	push   %edx
+    2278:	52                   	push   %edx
+    2279:	68 4c 50 00 00       	push   $0x504c
+    227e:	6a 01                	push   $0x1
+    2280:	e8 2b 20 00 00       	call   42b0 <printf>
+    exit();
+    2285:	e8 76 19 00 00       	call   3c00 <exit>
+    printf(1, "chdir dd failed\n");
+    228a:	50                   	push   %eax
+    228b:	50                   	push   %eax
+    228c:	68 8d 4f 00 00       	push   $0x4f8d
+    2291:	6a 01                	push   $0x1
+    2293:	e8 18 20 00 00       	call   42b0 <printf>
+    exit();
+    2298:	e8 63 19 00 00       	call   3c00 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    229d:	50                   	push   %eax
+    229e:	50                   	push   %eax
+    229f:	68 a0 5a 00 00       	push   $0x5aa0
+    22a4:	6a 01                	push   $0x1
+    22a6:	e8 05 20 00 00       	call   42b0 <printf>
+    exit();
+    22ab:	e8 50 19 00 00       	call   3c00 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    22b0:	53                   	push   %ebx
+    22b1:	53                   	push   %ebx
+    22b2:	68 eb 4e 00 00       	push   $0x4eeb
+    22b7:	6a 01                	push   $0x1
+    22b9:	e8 f2 1f 00 00       	call   42b0 <printf>
+    exit();
+    22be:	e8 3d 19 00 00       	call   3c00 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    22c3:	50                   	push   %eax
+    22c4:	50                   	push   %eax
+    22c5:	68 54 5a 00 00       	push   $0x5a54
+    22ca:	6a 01                	push   $0x1
+    22cc:	e8 df 1f 00 00       	call   42b0 <printf>
+    exit();
+    22d1:	e8 2a 19 00 00       	call   3c00 <exit>
+    printf(1, "create dd/ff failed\n");
+    22d6:	50                   	push   %eax
+    22d7:	50                   	push   %eax
+    22d8:	68 cf 4e 00 00       	push   $0x4ecf
+    22dd:	6a 01                	push   $0x1
+    22df:	e8 cc 1f 00 00       	call   42b0 <printf>
+    exit();
+    22e4:	e8 17 19 00 00       	call   3c00 <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    22e9:	50                   	push   %eax
+    22ea:	50                   	push   %eax
+    22eb:	68 b7 4e 00 00       	push   $0x4eb7
+    22f0:	6a 01                	push   $0x1
+    22f2:	e8 b9 1f 00 00       	call   42b0 <printf>
+    exit();
+    22f7:	e8 04 19 00 00       	call   3c00 <exit>
+    printf(1, "unlink dd failed\n");
+    22fc:	50                   	push   %eax
+    22fd:	50                   	push   %eax
+    22fe:	68 a0 51 00 00       	push   $0x51a0
+    2303:	6a 01                	push   $0x1
+    2305:	e8 a6 1f 00 00       	call   42b0 <printf>
+    exit();
+    230a:	e8 f1 18 00 00       	call   3c00 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    230f:	52                   	push   %edx
+    2310:	52                   	push   %edx
+    2311:	68 8b 51 00 00       	push   $0x518b
+    2316:	6a 01                	push   $0x1
+    2318:	e8 93 1f 00 00       	call   42b0 <printf>
+    exit();
+    231d:	e8 de 18 00 00       	call   3c00 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    2322:	51                   	push   %ecx
+    2323:	51                   	push   %ecx
+    2324:	68 58 5b 00 00       	push   $0x5b58
+    2329:	6a 01                	push   $0x1
+    232b:	e8 80 1f 00 00       	call   42b0 <printf>
+    exit();
+    2330:	e8 cb 18 00 00       	call   3c00 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    2335:	53                   	push   %ebx
+    2336:	53                   	push   %ebx
+    2337:	68 76 51 00 00       	push   $0x5176
+    233c:	6a 01                	push   $0x1
+    233e:	e8 6d 1f 00 00       	call   42b0 <printf>
+    exit();
+    2343:	e8 b8 18 00 00       	call   3c00 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    2348:	50                   	push   %eax
+    2349:	50                   	push   %eax
+    234a:	68 5e 51 00 00       	push   $0x515e
+    234f:	6a 01                	push   $0x1
+    2351:	e8 5a 1f 00 00       	call   42b0 <printf>
+    exit();
+    2356:	e8 a5 18 00 00       	call   3c00 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    235b:	50                   	push   %eax
+    235c:	50                   	push   %eax
+    235d:	68 46 51 00 00       	push   $0x5146
+    2362:	6a 01                	push   $0x1
+    2364:	e8 47 1f 00 00       	call   42b0 <printf>
+    exit();
+    2369:	e8 92 18 00 00       	call   3c00 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    236e:	50                   	push   %eax
+    236f:	50                   	push   %eax
+    2370:	68 2a 51 00 00       	push   $0x512a
+    2375:	6a 01                	push   $0x1
+    2377:	e8 34 1f 00 00       	call   42b0 <printf>
+    exit();
+    237c:	e8 7f 18 00 00       	call   3c00 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    2381:	50                   	push   %eax
+    2382:	50                   	push   %eax
+    2383:	68 0e 51 00 00       	push   $0x510e
+    2388:	6a 01                	push   $0x1
+    238a:	e8 21 1f 00 00       	call   42b0 <printf>
+    exit();
+    238f:	e8 6c 18 00 00       	call   3c00 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    2394:	50                   	push   %eax
+    2395:	50                   	push   %eax
+    2396:	68 f1 50 00 00       	push   $0x50f1
+    239b:	6a 01                	push   $0x1
+    239d:	e8 0e 1f 00 00       	call   42b0 <printf>
+    exit();
+    23a2:	e8 59 18 00 00       	call   3c00 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    23a7:	52                   	push   %edx
+    23a8:	52                   	push   %edx
+    23a9:	68 d6 50 00 00       	push   $0x50d6
+    23ae:	6a 01                	push   $0x1
+    23b0:	e8 fb 1e 00 00       	call   42b0 <printf>
+    exit();
+    23b5:	e8 46 18 00 00       	call   3c00 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    23ba:	51                   	push   %ecx
+    23bb:	51                   	push   %ecx
+    23bc:	68 03 50 00 00       	push   $0x5003
+    23c1:	6a 01                	push   $0x1
+    23c3:	e8 e8 1e 00 00       	call   42b0 <printf>
+    exit();
+    23c8:	e8 33 18 00 00       	call   3c00 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    23cd:	53                   	push   %ebx
+    23ce:	53                   	push   %ebx
+    23cf:	68 eb 4f 00 00       	push   $0x4feb
+    23d4:	6a 01                	push   $0x1
+    23d6:	e8 d5 1e 00 00       	call   42b0 <printf>
+    exit();
+    23db:	e8 20 18 00 00       	call   3c00 <exit>
+
+000023e0 <bigwrite>:
+{
+    23e0:	55                   	push   %ebp
+    23e1:	89 e5                	mov    %esp,%ebp
+    23e3:	56                   	push   %esi
+    23e4:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    23e5:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    23ea:	83 ec 08             	sub    $0x8,%esp
+    23ed:	68 bd 51 00 00       	push   $0x51bd
+    23f2:	6a 01                	push   $0x1
+    23f4:	e8 b7 1e 00 00       	call   42b0 <printf>
+  unlink("bigwrite");
+    23f9:	c7 04 24 cc 51 00 00 	movl   $0x51cc,(%esp)
+    2400:	e8 58 1c 00 00       	call   405d <unlink>
+    2405:	83 c4 10             	add    $0x10,%esp
+    2408:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    240f:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2410:	83 ec 08             	sub    $0x8,%esp
+    2413:	68 02 02 00 00       	push   $0x202
+    2418:	68 cc 51 00 00       	push   $0x51cc
+    241d:	e8 27 1c 00 00       	call   4049 <open>
+    if(fd < 0){
+    2422:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2425:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    2427:	85 c0                	test   %eax,%eax
+    2429:	78 7e                	js     24a9 <bigwrite+0xc9>
+      int cc = write(fd, buf, sz);
+    242b:	83 ec 04             	sub    $0x4,%esp
+    242e:	53                   	push   %ebx
+    242f:	68 c0 92 00 00       	push   $0x92c0
+    2434:	50                   	push   %eax
+    2435:	e8 f3 1b 00 00       	call   402d <write>
+      if(cc != sz){
+    243a:	83 c4 10             	add    $0x10,%esp
+    243d:	39 d8                	cmp    %ebx,%eax
+    243f:	75 55                	jne    2496 <bigwrite+0xb6>
+      int cc = write(fd, buf, sz);
+    2441:	83 ec 04             	sub    $0x4,%esp
+    2444:	53                   	push   %ebx
+    2445:	68 c0 92 00 00       	push   $0x92c0
+    244a:	56                   	push   %esi
+    244b:	e8 dd 1b 00 00       	call   402d <write>
+      if(cc != sz){
+    2450:	83 c4 10             	add    $0x10,%esp
+    2453:	39 c3                	cmp    %eax,%ebx
+    2455:	75 3f                	jne    2496 <bigwrite+0xb6>
+    close(fd);
+    2457:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    245a:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    2460:	56                   	push   %esi
+    2461:	e8 0a 18 00 00       	call   3c70 <close>
+    unlink("bigwrite");
+    2466:	c7 04 24 cc 51 00 00 	movl   $0x51cc,(%esp)
+    246d:	e8 eb 1b 00 00       	call   405d <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    2472:	83 c4 10             	add    $0x10,%esp
+    2475:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    247b:	75 93                	jne    2410 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    247d:	83 ec 08             	sub    $0x8,%esp
+    2480:	68 ff 51 00 00       	push   $0x51ff
+    2485:	6a 01                	push   $0x1
+    2487:	e8 24 1e 00 00       	call   42b0 <printf>
+}
+    248c:	83 c4 10             	add    $0x10,%esp
+    248f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2492:	5b                   	pop    %ebx
+    2493:	5e                   	pop    %esi
+    2494:	5d                   	pop    %ebp
+    2495:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    2496:	50                   	push   %eax
+    2497:	53                   	push   %ebx
+    2498:	68 ed 51 00 00       	push   $0x51ed
+    249d:	6a 01                	push   $0x1
+    249f:	e8 0c 1e 00 00       	call   42b0 <printf>
+        exit();
+    24a4:	e8 57 17 00 00       	call   3c00 <exit>
+      printf(1, "cannot create bigwrite\n");
+    24a9:	83 ec 08             	sub    $0x8,%esp
+    24ac:	68 d5 51 00 00       	push   $0x51d5
+    24b1:	6a 01                	push   $0x1
+    24b3:	e8 f8 1d 00 00       	call   42b0 <printf>
+      exit();
+    24b8:	e8 43 17 00 00       	call   3c00 <exit>
+    24bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000024c0 <bigfile>:
+{
+    24c0:	55                   	push   %ebp
+    24c1:	89 e5                	mov    %esp,%ebp
+    24c3:	57                   	push   %edi
+    24c4:	56                   	push   %esi
+    24c5:	53                   	push   %ebx
+    24c6:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    24c9:	68 0c 52 00 00       	push   $0x520c
+    24ce:	6a 01                	push   $0x1
+    24d0:	e8 db 1d 00 00       	call   42b0 <printf>
+  unlink("bigfile");
+    24d5:	c7 04 24 28 52 00 00 	movl   $0x5228,(%esp)
+    24dc:	e8 7c 1b 00 00       	call   405d <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    24e1:	58                   	pop    %eax
+    24e2:	5a                   	pop    %edx
+    24e3:	68 02 02 00 00       	push   $0x202
+    24e8:	68 28 52 00 00       	push   $0x5228
+    24ed:	e8 57 1b 00 00       	call   4049 <open>
+  if(fd < 0){
+    24f2:	83 c4 10             	add    $0x10,%esp
+    24f5:	85 c0                	test   %eax,%eax
+    24f7:	0f 88 5e 01 00 00    	js     265b <bigfile+0x19b>
+    24fd:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    24ff:	31 db                	xor    %ebx,%ebx
+    2501:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    2508:	83 ec 04             	sub    $0x4,%esp
+    250b:	68 58 02 00 00       	push   $0x258
+    2510:	53                   	push   %ebx
+    2511:	68 c0 92 00 00       	push   $0x92c0
+    2516:	e8 85 18 00 00       	call   3da0 <memset>
+    if(write(fd, buf, 600) != 600){
+    251b:	83 c4 0c             	add    $0xc,%esp
+    251e:	68 58 02 00 00       	push   $0x258
+    2523:	68 c0 92 00 00       	push   $0x92c0
+    2528:	56                   	push   %esi
+    2529:	e8 ff 1a 00 00       	call   402d <write>
+    252e:	83 c4 10             	add    $0x10,%esp
+    2531:	3d 58 02 00 00       	cmp    $0x258,%eax
+    2536:	0f 85 f8 00 00 00    	jne    2634 <bigfile+0x174>
+  for(i = 0; i < 20; i++){
+    253c:	83 c3 01             	add    $0x1,%ebx
+    253f:	83 fb 14             	cmp    $0x14,%ebx
+    2542:	75 c4                	jne    2508 <bigfile+0x48>
+  close(fd);
+    2544:	83 ec 0c             	sub    $0xc,%esp
+    2547:	56                   	push   %esi
+    2548:	e8 23 17 00 00       	call   3c70 <close>
+  fd = open("bigfile", 0);
+    254d:	5e                   	pop    %esi
+    254e:	5f                   	pop    %edi
+    254f:	6a 00                	push   $0x0
+    2551:	68 28 52 00 00       	push   $0x5228
+    2556:	e8 ee 1a 00 00       	call   4049 <open>
+  if(fd < 0){
+    255b:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    255e:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    2560:	85 c0                	test   %eax,%eax
+    2562:	0f 88 e0 00 00 00    	js     2648 <bigfile+0x188>
+  total = 0;
+    2568:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    256a:	31 ff                	xor    %edi,%edi
+    256c:	eb 30                	jmp    259e <bigfile+0xde>
+    256e:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+    2570:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    2575:	0f 85 91 00 00 00    	jne    260c <bigfile+0x14c>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    257b:	89 fa                	mov    %edi,%edx
+    257d:	0f be 05 c0 92 00 00 	movsbl 0x92c0,%eax
+    2584:	d1 fa                	sar    %edx
+    2586:	39 d0                	cmp    %edx,%eax
+    2588:	75 6e                	jne    25f8 <bigfile+0x138>
+    258a:	0f be 15 eb 93 00 00 	movsbl 0x93eb,%edx
+    2591:	39 d0                	cmp    %edx,%eax
+    2593:	75 63                	jne    25f8 <bigfile+0x138>
+    total += cc;
+    2595:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    259b:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    259e:	83 ec 04             	sub    $0x4,%esp
+    25a1:	68 2c 01 00 00       	push   $0x12c
+    25a6:	68 c0 92 00 00       	push   $0x92c0
+    25ab:	56                   	push   %esi
+    25ac:	e8 75 1a 00 00       	call   4026 <read>
+    if(cc < 0){
+    25b1:	83 c4 10             	add    $0x10,%esp
+    25b4:	85 c0                	test   %eax,%eax
+    25b6:	78 68                	js     2620 <bigfile+0x160>
+    if(cc == 0)
+    25b8:	75 b6                	jne    2570 <bigfile+0xb0>
+  close(fd);
+    25ba:	83 ec 0c             	sub    $0xc,%esp
+    25bd:	56                   	push   %esi
+    25be:	e8 ad 16 00 00       	call   3c70 <close>
+  if(total != 20*600){
+    25c3:	83 c4 10             	add    $0x10,%esp
+    25c6:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    25cc:	0f 85 9c 00 00 00    	jne    266e <bigfile+0x1ae>
+  unlink("bigfile");
+    25d2:	83 ec 0c             	sub    $0xc,%esp
+    25d5:	68 28 52 00 00       	push   $0x5228
+    25da:	e8 7e 1a 00 00       	call   405d <unlink>
+  printf(1, "bigfile test ok\n");
+    25df:	58                   	pop    %eax
+    25e0:	5a                   	pop    %edx
+    25e1:	68 b7 52 00 00       	push   $0x52b7
+    25e6:	6a 01                	push   $0x1
+    25e8:	e8 c3 1c 00 00       	call   42b0 <printf>
+}
+    25ed:	83 c4 10             	add    $0x10,%esp
+    25f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    25f3:	5b                   	pop    %ebx
+    25f4:	5e                   	pop    %esi
+    25f5:	5f                   	pop    %edi
+    25f6:	5d                   	pop    %ebp
+    25f7:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    25f8:	83 ec 08             	sub    $0x8,%esp
+    25fb:	68 84 52 00 00       	push   $0x5284
+    2600:	6a 01                	push   $0x1
+    2602:	e8 a9 1c 00 00       	call   42b0 <printf>
+      exit();
+    2607:	e8 f4 15 00 00       	call   3c00 <exit>
+      printf(1, "short read bigfile\n");
+    260c:	83 ec 08             	sub    $0x8,%esp
+    260f:	68 70 52 00 00       	push   $0x5270
+    2614:	6a 01                	push   $0x1
+    2616:	e8 95 1c 00 00       	call   42b0 <printf>
+      exit();
+    261b:	e8 e0 15 00 00       	call   3c00 <exit>
+      printf(1, "read bigfile failed\n");
+    2620:	83 ec 08             	sub    $0x8,%esp
+    2623:	68 5b 52 00 00       	push   $0x525b
+    2628:	6a 01                	push   $0x1
+    262a:	e8 81 1c 00 00       	call   42b0 <printf>
+      exit();
+    262f:	e8 cc 15 00 00       	call   3c00 <exit>
+      printf(1, "write bigfile failed\n");
+    2634:	83 ec 08             	sub    $0x8,%esp
+    2637:	68 30 52 00 00       	push   $0x5230
+    263c:	6a 01                	push   $0x1
+    263e:	e8 6d 1c 00 00       	call   42b0 <printf>
+      exit();
+    2643:	e8 b8 15 00 00       	call   3c00 <exit>
+    printf(1, "cannot open bigfile\n");
+    2648:	53                   	push   %ebx
+    2649:	53                   	push   %ebx
+    264a:	68 46 52 00 00       	push   $0x5246
+    264f:	6a 01                	push   $0x1
+    2651:	e8 5a 1c 00 00       	call   42b0 <printf>
+    exit();
+    2656:	e8 a5 15 00 00       	call   3c00 <exit>
+    printf(1, "cannot create bigfile");
+    265b:	50                   	push   %eax
+    265c:	50                   	push   %eax
+    265d:	68 1a 52 00 00       	push   $0x521a
+    2662:	6a 01                	push   $0x1
+    2664:	e8 47 1c 00 00       	call   42b0 <printf>
+    exit();
+    2669:	e8 92 15 00 00       	call   3c00 <exit>
+    printf(1, "read bigfile wrong total\n");
+    266e:	51                   	push   %ecx
+    266f:	51                   	push   %ecx
+    2670:	68 9d 52 00 00       	push   $0x529d
+    2675:	6a 01                	push   $0x1
+    2677:	e8 34 1c 00 00       	call   42b0 <printf>
+    exit();
+    267c:	e8 7f 15 00 00       	call   3c00 <exit>
+    2681:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2688:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    268f:	90                   	nop
+
+00002690 <fourteen>:
+{
+    2690:	55                   	push   %ebp
+    2691:	89 e5                	mov    %esp,%ebp
+    2693:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    2696:	68 c8 52 00 00       	push   $0x52c8
+    269b:	6a 01                	push   $0x1
+    269d:	e8 0e 1c 00 00       	call   42b0 <printf>
+  if(mkdir("12345678901234") != 0){
+    26a2:	c7 04 24 03 53 00 00 	movl   $0x5303,(%esp)
+    26a9:	e8 cd 19 00 00       	call   407b <mkdir>
+    26ae:	83 c4 10             	add    $0x10,%esp
+    26b1:	85 c0                	test   %eax,%eax
+    26b3:	0f 85 97 00 00 00    	jne    2750 <fourteen+0xc0>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    26b9:	83 ec 0c             	sub    $0xc,%esp
+    26bc:	68 78 5b 00 00       	push   $0x5b78
+    26c1:	e8 b5 19 00 00       	call   407b <mkdir>
+    26c6:	83 c4 10             	add    $0x10,%esp
+    26c9:	85 c0                	test   %eax,%eax
+    26cb:	0f 85 de 00 00 00    	jne    27af <fourteen+0x11f>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    26d1:	83 ec 08             	sub    $0x8,%esp
+    26d4:	68 00 02 00 00       	push   $0x200
+    26d9:	68 c8 5b 00 00       	push   $0x5bc8
+    26de:	e8 66 19 00 00       	call   4049 <open>
+  if(fd < 0){
+    26e3:	83 c4 10             	add    $0x10,%esp
+    26e6:	85 c0                	test   %eax,%eax
+    26e8:	0f 88 ae 00 00 00    	js     279c <fourteen+0x10c>
+  close(fd);
+    26ee:	83 ec 0c             	sub    $0xc,%esp
+    26f1:	50                   	push   %eax
+    26f2:	e8 79 15 00 00       	call   3c70 <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    26f7:	58                   	pop    %eax
+    26f8:	5a                   	pop    %edx
+    26f9:	6a 00                	push   $0x0
+    26fb:	68 38 5c 00 00       	push   $0x5c38
+    2700:	e8 44 19 00 00       	call   4049 <open>
+  if(fd < 0){
+    2705:	83 c4 10             	add    $0x10,%esp
+    2708:	85 c0                	test   %eax,%eax
+    270a:	78 7d                	js     2789 <fourteen+0xf9>
+  close(fd);
+    270c:	83 ec 0c             	sub    $0xc,%esp
+    270f:	50                   	push   %eax
+    2710:	e8 5b 15 00 00       	call   3c70 <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    2715:	c7 04 24 f4 52 00 00 	movl   $0x52f4,(%esp)
+    271c:	e8 5a 19 00 00       	call   407b <mkdir>
+    2721:	83 c4 10             	add    $0x10,%esp
+    2724:	85 c0                	test   %eax,%eax
+    2726:	74 4e                	je     2776 <fourteen+0xe6>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    2728:	83 ec 0c             	sub    $0xc,%esp
+    272b:	68 d4 5c 00 00       	push   $0x5cd4
+    2730:	e8 46 19 00 00       	call   407b <mkdir>
+    2735:	83 c4 10             	add    $0x10,%esp
+    2738:	85 c0                	test   %eax,%eax
+    273a:	74 27                	je     2763 <fourteen+0xd3>
+  printf(1, "fourteen ok\n");
+    273c:	83 ec 08             	sub    $0x8,%esp
+    273f:	68 12 53 00 00       	push   $0x5312
+    2744:	6a 01                	push   $0x1
+    2746:	e8 65 1b 00 00       	call   42b0 <printf>
+}
+    274b:	83 c4 10             	add    $0x10,%esp
+    274e:	c9                   	leave
+    274f:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    2750:	50                   	push   %eax
+    2751:	50                   	push   %eax
+    2752:	68 d7 52 00 00       	push   $0x52d7
+    2757:	6a 01                	push   $0x1
+    2759:	e8 52 1b 00 00       	call   42b0 <printf>
+    exit();
+    275e:	e8 9d 14 00 00       	call   3c00 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    2763:	50                   	push   %eax
+    2764:	50                   	push   %eax
+    2765:	68 f4 5c 00 00       	push   $0x5cf4
+    276a:	6a 01                	push   $0x1
+    276c:	e8 3f 1b 00 00       	call   42b0 <printf>
+    exit();
+    2771:	e8 8a 14 00 00       	call   3c00 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    2776:	52                   	push   %edx
+    2777:	52                   	push   %edx
+    2778:	68 a4 5c 00 00       	push   $0x5ca4
+    277d:	6a 01                	push   $0x1
+    277f:	e8 2c 1b 00 00       	call   42b0 <printf>
+    exit();
+    2784:	e8 77 14 00 00       	call   3c00 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    2789:	51                   	push   %ecx
+    278a:	51                   	push   %ecx
+    278b:	68 68 5c 00 00       	push   $0x5c68
+    2790:	6a 01                	push   $0x1
+    2792:	e8 19 1b 00 00       	call   42b0 <printf>
+    exit();
+    2797:	e8 64 14 00 00       	call   3c00 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    279c:	51                   	push   %ecx
+    279d:	51                   	push   %ecx
+    279e:	68 f8 5b 00 00       	push   $0x5bf8
+    27a3:	6a 01                	push   $0x1
+    27a5:	e8 06 1b 00 00       	call   42b0 <printf>
+    exit();
+    27aa:	e8 51 14 00 00       	call   3c00 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    27af:	50                   	push   %eax
+    27b0:	50                   	push   %eax
+    27b1:	68 98 5b 00 00       	push   $0x5b98
+    27b6:	6a 01                	push   $0x1
+    27b8:	e8 f3 1a 00 00       	call   42b0 <printf>
+    exit();
+    27bd:	e8 3e 14 00 00       	call   3c00 <exit>
+    27c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    27c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000027d0 <rmdot>:
+{
+    27d0:	55                   	push   %ebp
+    27d1:	89 e5                	mov    %esp,%ebp
+    27d3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    27d6:	68 1f 53 00 00       	push   $0x531f
+    27db:	6a 01                	push   $0x1
+    27dd:	e8 ce 1a 00 00       	call   42b0 <printf>
+  if(mkdir("dots") != 0){
+    27e2:	c7 04 24 2b 53 00 00 	movl   $0x532b,(%esp)
+    27e9:	e8 8d 18 00 00       	call   407b <mkdir>
+    27ee:	83 c4 10             	add    $0x10,%esp
+    27f1:	85 c0                	test   %eax,%eax
+    27f3:	0f 85 b0 00 00 00    	jne    28a9 <rmdot+0xd9>
+  if(chdir("dots") != 0){
+    27f9:	83 ec 0c             	sub    $0xc,%esp
+    27fc:	68 2b 53 00 00       	push   $0x532b
+    2801:	e8 7f 18 00 00       	call   4085 <chdir>
+    2806:	83 c4 10             	add    $0x10,%esp
+    2809:	85 c0                	test   %eax,%eax
+    280b:	0f 85 1d 01 00 00    	jne    292e <rmdot+0x15e>
+  if(unlink(".") == 0){
+    2811:	83 ec 0c             	sub    $0xc,%esp
+    2814:	68 d6 4f 00 00       	push   $0x4fd6
+    2819:	e8 3f 18 00 00       	call   405d <unlink>
+    281e:	83 c4 10             	add    $0x10,%esp
+    2821:	85 c0                	test   %eax,%eax
+    2823:	0f 84 f2 00 00 00    	je     291b <rmdot+0x14b>
+  if(unlink("..") == 0){
+    2829:	83 ec 0c             	sub    $0xc,%esp
+    282c:	68 d5 4f 00 00       	push   $0x4fd5
+    2831:	e8 27 18 00 00       	call   405d <unlink>
+    2836:	83 c4 10             	add    $0x10,%esp
+    2839:	85 c0                	test   %eax,%eax
+    283b:	0f 84 c7 00 00 00    	je     2908 <rmdot+0x138>
+  if(chdir("/") != 0){
+    2841:	83 ec 0c             	sub    $0xc,%esp
+    2844:	68 a9 47 00 00       	push   $0x47a9
+    2849:	e8 37 18 00 00       	call   4085 <chdir>
+    284e:	83 c4 10             	add    $0x10,%esp
+    2851:	85 c0                	test   %eax,%eax
+    2853:	0f 85 9c 00 00 00    	jne    28f5 <rmdot+0x125>
+  if(unlink("dots/.") == 0){
+    2859:	83 ec 0c             	sub    $0xc,%esp
+    285c:	68 73 53 00 00       	push   $0x5373
+    2861:	e8 f7 17 00 00       	call   405d <unlink>
+    2866:	83 c4 10             	add    $0x10,%esp
+    2869:	85 c0                	test   %eax,%eax
+    286b:	74 75                	je     28e2 <rmdot+0x112>
+  if(unlink("dots/..") == 0){
+    286d:	83 ec 0c             	sub    $0xc,%esp
+    2870:	68 91 53 00 00       	push   $0x5391
+    2875:	e8 e3 17 00 00       	call   405d <unlink>
+    287a:	83 c4 10             	add    $0x10,%esp
+    287d:	85 c0                	test   %eax,%eax
+    287f:	74 4e                	je     28cf <rmdot+0xff>
+  if(unlink("dots") != 0){
+    2881:	83 ec 0c             	sub    $0xc,%esp
+    2884:	68 2b 53 00 00       	push   $0x532b
+    2889:	e8 cf 17 00 00       	call   405d <unlink>
+    288e:	83 c4 10             	add    $0x10,%esp
+    2891:	85 c0                	test   %eax,%eax
+    2893:	75 27                	jne    28bc <rmdot+0xec>
+  printf(1, "rmdot ok\n");
+    2895:	83 ec 08             	sub    $0x8,%esp
+    2898:	68 c6 53 00 00       	push   $0x53c6
+    289d:	6a 01                	push   $0x1
+    289f:	e8 0c 1a 00 00       	call   42b0 <printf>
+}
+    28a4:	83 c4 10             	add    $0x10,%esp
+    28a7:	c9                   	leave
+    28a8:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    28a9:	50                   	push   %eax
+    28aa:	50                   	push   %eax
+    28ab:	68 30 53 00 00       	push   $0x5330
+    28b0:	6a 01                	push   $0x1
+    28b2:	e8 f9 19 00 00       	call   42b0 <printf>
+    exit();
+    28b7:	e8 44 13 00 00       	call   3c00 <exit>
+    printf(1, "unlink dots failed!\n");
+    28bc:	50                   	push   %eax
+    28bd:	50                   	push   %eax
+    28be:	68 b1 53 00 00       	push   $0x53b1
+    28c3:	6a 01                	push   $0x1
+    28c5:	e8 e6 19 00 00       	call   42b0 <printf>
+    exit();
+    28ca:	e8 31 13 00 00       	call   3c00 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    28cf:	52                   	push   %edx
+    28d0:	52                   	push   %edx
+    28d1:	68 99 53 00 00       	push   $0x5399
+    28d6:	6a 01                	push   $0x1
+    28d8:	e8 d3 19 00 00       	call   42b0 <printf>
+    exit();
+    28dd:	e8 1e 13 00 00       	call   3c00 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    28e2:	51                   	push   %ecx
+    28e3:	51                   	push   %ecx
+    28e4:	68 7a 53 00 00       	push   $0x537a
+    28e9:	6a 01                	push   $0x1
+    28eb:	e8 c0 19 00 00       	call   42b0 <printf>
+    exit();
+    28f0:	e8 0b 13 00 00       	call   3c00 <exit>
+    printf(1, "chdir / failed\n");
+    28f5:	50                   	push   %eax
+    28f6:	50                   	push   %eax
+    28f7:	68 ab 47 00 00       	push   $0x47ab
+    28fc:	6a 01                	push   $0x1
+    28fe:	e8 ad 19 00 00       	call   42b0 <printf>
+    exit();
+    2903:	e8 f8 12 00 00       	call   3c00 <exit>
+    printf(1, "rm .. worked!\n");
+    2908:	50                   	push   %eax
+    2909:	50                   	push   %eax
+    290a:	68 64 53 00 00       	push   $0x5364
+    290f:	6a 01                	push   $0x1
+    2911:	e8 9a 19 00 00       	call   42b0 <printf>
+    exit();
+    2916:	e8 e5 12 00 00       	call   3c00 <exit>
+    printf(1, "rm . worked!\n");
+    291b:	50                   	push   %eax
+    291c:	50                   	push   %eax
+    291d:	68 56 53 00 00       	push   $0x5356
+    2922:	6a 01                	push   $0x1
+    2924:	e8 87 19 00 00       	call   42b0 <printf>
+    exit();
+    2929:	e8 d2 12 00 00       	call   3c00 <exit>
+    printf(1, "chdir dots failed\n");
+    292e:	50                   	push   %eax
+    292f:	50                   	push   %eax
+    2930:	68 43 53 00 00       	push   $0x5343
+    2935:	6a 01                	push   $0x1
+    2937:	e8 74 19 00 00       	call   42b0 <printf>
+    exit();
+    293c:	e8 bf 12 00 00       	call   3c00 <exit>
+    2941:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2948:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    294f:	90                   	nop
+
+00002950 <dirfile>:
+{
+    2950:	55                   	push   %ebp
+    2951:	89 e5                	mov    %esp,%ebp
+    2953:	53                   	push   %ebx
+    2954:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    2957:	68 d0 53 00 00       	push   $0x53d0
+    295c:	6a 01                	push   $0x1
+    295e:	e8 4d 19 00 00       	call   42b0 <printf>
+  fd = open("dirfile", O_CREATE);
+    2963:	5b                   	pop    %ebx
+    2964:	58                   	pop    %eax
+    2965:	68 00 02 00 00       	push   $0x200
+    296a:	68 dd 53 00 00       	push   $0x53dd
+    296f:	e8 d5 16 00 00       	call   4049 <open>
+  if(fd < 0){
+    2974:	83 c4 10             	add    $0x10,%esp
+    2977:	85 c0                	test   %eax,%eax
+    2979:	0f 88 43 01 00 00    	js     2ac2 <dirfile+0x172>
+  close(fd);
+    297f:	83 ec 0c             	sub    $0xc,%esp
+    2982:	50                   	push   %eax
+    2983:	e8 e8 12 00 00       	call   3c70 <close>
+  if(chdir("dirfile") == 0){
+    2988:	c7 04 24 dd 53 00 00 	movl   $0x53dd,(%esp)
+    298f:	e8 f1 16 00 00       	call   4085 <chdir>
+    2994:	83 c4 10             	add    $0x10,%esp
+    2997:	85 c0                	test   %eax,%eax
+    2999:	0f 84 10 01 00 00    	je     2aaf <dirfile+0x15f>
+  fd = open("dirfile/xx", 0);
+    299f:	83 ec 08             	sub    $0x8,%esp
+    29a2:	6a 00                	push   $0x0
+    29a4:	68 16 54 00 00       	push   $0x5416
+    29a9:	e8 9b 16 00 00       	call   4049 <open>
+  if(fd >= 0){
+    29ae:	83 c4 10             	add    $0x10,%esp
+    29b1:	85 c0                	test   %eax,%eax
+    29b3:	0f 89 e3 00 00 00    	jns    2a9c <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    29b9:	83 ec 08             	sub    $0x8,%esp
+    29bc:	68 00 02 00 00       	push   $0x200
+    29c1:	68 16 54 00 00       	push   $0x5416
+    29c6:	e8 7e 16 00 00       	call   4049 <open>
+  if(fd >= 0){
+    29cb:	83 c4 10             	add    $0x10,%esp
+    29ce:	85 c0                	test   %eax,%eax
+    29d0:	0f 89 c6 00 00 00    	jns    2a9c <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    29d6:	83 ec 0c             	sub    $0xc,%esp
+    29d9:	68 16 54 00 00       	push   $0x5416
+    29de:	e8 98 16 00 00       	call   407b <mkdir>
+    29e3:	83 c4 10             	add    $0x10,%esp
+    29e6:	85 c0                	test   %eax,%eax
+    29e8:	0f 84 46 01 00 00    	je     2b34 <dirfile+0x1e4>
+  if(unlink("dirfile/xx") == 0){
+    29ee:	83 ec 0c             	sub    $0xc,%esp
+    29f1:	68 16 54 00 00       	push   $0x5416
+    29f6:	e8 62 16 00 00       	call   405d <unlink>
+    29fb:	83 c4 10             	add    $0x10,%esp
+    29fe:	85 c0                	test   %eax,%eax
+    2a00:	0f 84 1b 01 00 00    	je     2b21 <dirfile+0x1d1>
+  if(link("README", "dirfile/xx") == 0){
+    2a06:	83 ec 08             	sub    $0x8,%esp
+    2a09:	68 16 54 00 00       	push   $0x5416
+    2a0e:	68 7a 54 00 00       	push   $0x547a
+    2a13:	e8 59 16 00 00       	call   4071 <link>
+    2a18:	83 c4 10             	add    $0x10,%esp
+    2a1b:	85 c0                	test   %eax,%eax
+    2a1d:	0f 84 eb 00 00 00    	je     2b0e <dirfile+0x1be>
+  if(unlink("dirfile") != 0){
+    2a23:	83 ec 0c             	sub    $0xc,%esp
+    2a26:	68 dd 53 00 00       	push   $0x53dd
+    2a2b:	e8 2d 16 00 00       	call   405d <unlink>
+    2a30:	83 c4 10             	add    $0x10,%esp
+    2a33:	85 c0                	test   %eax,%eax
+    2a35:	0f 85 c0 00 00 00    	jne    2afb <dirfile+0x1ab>
+  fd = open(".", O_RDWR);
+    2a3b:	83 ec 08             	sub    $0x8,%esp
+    2a3e:	6a 02                	push   $0x2
+    2a40:	68 d6 4f 00 00       	push   $0x4fd6
+    2a45:	e8 ff 15 00 00       	call   4049 <open>
+  if(fd >= 0){
+    2a4a:	83 c4 10             	add    $0x10,%esp
+    2a4d:	85 c0                	test   %eax,%eax
+    2a4f:	0f 89 93 00 00 00    	jns    2ae8 <dirfile+0x198>
+  fd = open(".", 0);
+    2a55:	83 ec 08             	sub    $0x8,%esp
+    2a58:	6a 00                	push   $0x0
+    2a5a:	68 d6 4f 00 00       	push   $0x4fd6
+    2a5f:	e8 e5 15 00 00       	call   4049 <open>
+  if(write(fd, "x", 1) > 0){
+    2a64:	83 c4 0c             	add    $0xc,%esp
+    2a67:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    2a69:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    2a6b:	68 b9 50 00 00       	push   $0x50b9
+    2a70:	50                   	push   %eax
+    2a71:	e8 b7 15 00 00       	call   402d <write>
+    2a76:	83 c4 10             	add    $0x10,%esp
+    2a79:	85 c0                	test   %eax,%eax
+    2a7b:	7f 58                	jg     2ad5 <dirfile+0x185>
+  close(fd);
+    2a7d:	83 ec 0c             	sub    $0xc,%esp
+    2a80:	53                   	push   %ebx
+    2a81:	e8 ea 11 00 00       	call   3c70 <close>
+  printf(1, "dir vs file OK\n");
+    2a86:	58                   	pop    %eax
+    2a87:	5a                   	pop    %edx
+    2a88:	68 ad 54 00 00       	push   $0x54ad
+    2a8d:	6a 01                	push   $0x1
+    2a8f:	e8 1c 18 00 00       	call   42b0 <printf>
+}
+    2a94:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2a97:	83 c4 10             	add    $0x10,%esp
+    2a9a:	c9                   	leave
+    2a9b:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    2a9c:	50                   	push   %eax
+    2a9d:	50                   	push   %eax
+    2a9e:	68 21 54 00 00       	push   $0x5421
+    2aa3:	6a 01                	push   $0x1
+    2aa5:	e8 06 18 00 00       	call   42b0 <printf>
+    exit();
+    2aaa:	e8 51 11 00 00       	call   3c00 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    2aaf:	52                   	push   %edx
+    2ab0:	52                   	push   %edx
+    2ab1:	68 fc 53 00 00       	push   $0x53fc
+    2ab6:	6a 01                	push   $0x1
+    2ab8:	e8 f3 17 00 00       	call   42b0 <printf>
+    exit();
+    2abd:	e8 3e 11 00 00       	call   3c00 <exit>
+    printf(1, "create dirfile failed\n");
+    2ac2:	51                   	push   %ecx
+    2ac3:	51                   	push   %ecx
+    2ac4:	68 e5 53 00 00       	push   $0x53e5
+    2ac9:	6a 01                	push   $0x1
+    2acb:	e8 e0 17 00 00       	call   42b0 <printf>
+    exit();
+    2ad0:	e8 2b 11 00 00       	call   3c00 <exit>
+    printf(1, "write . succeeded!\n");
+    2ad5:	51                   	push   %ecx
+    2ad6:	51                   	push   %ecx
+    2ad7:	68 99 54 00 00       	push   $0x5499
+    2adc:	6a 01                	push   $0x1
+    2ade:	e8 cd 17 00 00       	call   42b0 <printf>
+    exit();
+    2ae3:	e8 18 11 00 00       	call   3c00 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    2ae8:	53                   	push   %ebx
+    2ae9:	53                   	push   %ebx
+    2aea:	68 48 5d 00 00       	push   $0x5d48
+    2aef:	6a 01                	push   $0x1
+    2af1:	e8 ba 17 00 00       	call   42b0 <printf>
+    exit();
+    2af6:	e8 05 11 00 00       	call   3c00 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    2afb:	50                   	push   %eax
+    2afc:	50                   	push   %eax
+    2afd:	68 81 54 00 00       	push   $0x5481
+    2b02:	6a 01                	push   $0x1
+    2b04:	e8 a7 17 00 00       	call   42b0 <printf>
+    exit();
+    2b09:	e8 f2 10 00 00       	call   3c00 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    2b0e:	50                   	push   %eax
+    2b0f:	50                   	push   %eax
+    2b10:	68 28 5d 00 00       	push   $0x5d28
+    2b15:	6a 01                	push   $0x1
+    2b17:	e8 94 17 00 00       	call   42b0 <printf>
+    exit();
+    2b1c:	e8 df 10 00 00       	call   3c00 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    2b21:	50                   	push   %eax
+    2b22:	50                   	push   %eax
+    2b23:	68 5c 54 00 00       	push   $0x545c
+    2b28:	6a 01                	push   $0x1
+    2b2a:	e8 81 17 00 00       	call   42b0 <printf>
+    exit();
+    2b2f:	e8 cc 10 00 00       	call   3c00 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    2b34:	50                   	push   %eax
+    2b35:	50                   	push   %eax
+    2b36:	68 3f 54 00 00       	push   $0x543f
+    2b3b:	6a 01                	push   $0x1
+    2b3d:	e8 6e 17 00 00       	call   42b0 <printf>
+    exit();
+    2b42:	e8 b9 10 00 00       	call   3c00 <exit>
+    2b47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2b4e:	66 90                	xchg   %ax,%ax
+
+00002b50 <iref>:
+{
+    2b50:	55                   	push   %ebp
+    2b51:	89 e5                	mov    %esp,%ebp
+    2b53:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    2b54:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    2b59:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    2b5c:	68 bd 54 00 00       	push   $0x54bd
+    2b61:	6a 01                	push   $0x1
+    2b63:	e8 48 17 00 00       	call   42b0 <printf>
+    2b68:	83 c4 10             	add    $0x10,%esp
+    2b6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2b6f:	90                   	nop
+    if(mkdir("irefd") != 0){
+    2b70:	83 ec 0c             	sub    $0xc,%esp
+    2b73:	68 ce 54 00 00       	push   $0x54ce
+    2b78:	e8 fe 14 00 00       	call   407b <mkdir>
+    2b7d:	83 c4 10             	add    $0x10,%esp
+    2b80:	85 c0                	test   %eax,%eax
+    2b82:	0f 85 bb 00 00 00    	jne    2c43 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    2b88:	83 ec 0c             	sub    $0xc,%esp
+    2b8b:	68 ce 54 00 00       	push   $0x54ce
+    2b90:	e8 f0 14 00 00       	call   4085 <chdir>
+    2b95:	83 c4 10             	add    $0x10,%esp
+    2b98:	85 c0                	test   %eax,%eax
+    2b9a:	0f 85 b7 00 00 00    	jne    2c57 <iref+0x107>
+    mkdir("");
+    2ba0:	83 ec 0c             	sub    $0xc,%esp
+    2ba3:	68 83 4b 00 00       	push   $0x4b83
+    2ba8:	e8 ce 14 00 00       	call   407b <mkdir>
+    link("README", "");
+    2bad:	59                   	pop    %ecx
+    2bae:	58                   	pop    %eax
+    2baf:	68 83 4b 00 00       	push   $0x4b83
+    2bb4:	68 7a 54 00 00       	push   $0x547a
+    2bb9:	e8 b3 14 00 00       	call   4071 <link>
+    fd = open("", O_CREATE);
+    2bbe:	58                   	pop    %eax
+    2bbf:	5a                   	pop    %edx
+    2bc0:	68 00 02 00 00       	push   $0x200
+    2bc5:	68 83 4b 00 00       	push   $0x4b83
+    2bca:	e8 7a 14 00 00       	call   4049 <open>
+    if(fd >= 0)
+    2bcf:	83 c4 10             	add    $0x10,%esp
+    2bd2:	85 c0                	test   %eax,%eax
+    2bd4:	78 0c                	js     2be2 <iref+0x92>
+      close(fd);
+    2bd6:	83 ec 0c             	sub    $0xc,%esp
+    2bd9:	50                   	push   %eax
+    2bda:	e8 91 10 00 00       	call   3c70 <close>
+    2bdf:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    2be2:	83 ec 08             	sub    $0x8,%esp
+    2be5:	68 00 02 00 00       	push   $0x200
+    2bea:	68 b8 50 00 00       	push   $0x50b8
+    2bef:	e8 55 14 00 00       	call   4049 <open>
+    if(fd >= 0)
+    2bf4:	83 c4 10             	add    $0x10,%esp
+    2bf7:	85 c0                	test   %eax,%eax
+    2bf9:	78 0c                	js     2c07 <iref+0xb7>
+      close(fd);
+    2bfb:	83 ec 0c             	sub    $0xc,%esp
+    2bfe:	50                   	push   %eax
+    2bff:	e8 6c 10 00 00       	call   3c70 <close>
+    2c04:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    2c07:	83 ec 0c             	sub    $0xc,%esp
+    2c0a:	68 b8 50 00 00       	push   $0x50b8
+    2c0f:	e8 49 14 00 00       	call   405d <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    2c14:	83 c4 10             	add    $0x10,%esp
+    2c17:	83 eb 01             	sub    $0x1,%ebx
+    2c1a:	0f 85 50 ff ff ff    	jne    2b70 <iref+0x20>
+  chdir("/");
+    2c20:	83 ec 0c             	sub    $0xc,%esp
+    2c23:	68 a9 47 00 00       	push   $0x47a9
+    2c28:	e8 58 14 00 00       	call   4085 <chdir>
+  printf(1, "empty file name OK\n");
+    2c2d:	58                   	pop    %eax
+    2c2e:	5a                   	pop    %edx
+    2c2f:	68 fc 54 00 00       	push   $0x54fc
+    2c34:	6a 01                	push   $0x1
+    2c36:	e8 75 16 00 00       	call   42b0 <printf>
+}
+    2c3b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2c3e:	83 c4 10             	add    $0x10,%esp
+    2c41:	c9                   	leave
+    2c42:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    2c43:	83 ec 08             	sub    $0x8,%esp
+    2c46:	68 d4 54 00 00       	push   $0x54d4
+    2c4b:	6a 01                	push   $0x1
+    2c4d:	e8 5e 16 00 00       	call   42b0 <printf>
+      exit();
+    2c52:	e8 a9 0f 00 00       	call   3c00 <exit>
+      printf(1, "chdir irefd failed\n");
+    2c57:	83 ec 08             	sub    $0x8,%esp
+    2c5a:	68 e8 54 00 00       	push   $0x54e8
+    2c5f:	6a 01                	push   $0x1
+    2c61:	e8 4a 16 00 00       	call   42b0 <printf>
+      exit();
+    2c66:	e8 95 0f 00 00       	call   3c00 <exit>
+    2c6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2c6f:	90                   	nop
+
+00002c70 <forktest>:
+{
+    2c70:	55                   	push   %ebp
+    2c71:	89 e5                	mov    %esp,%ebp
+    2c73:	53                   	push   %ebx
+  for(n=0; n<1000; n++){
+    2c74:	31 db                	xor    %ebx,%ebx
+{
+    2c76:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    2c79:	68 10 55 00 00       	push   $0x5510
+    2c7e:	6a 01                	push   $0x1
+    2c80:	e8 2b 16 00 00       	call   42b0 <printf>
+    2c85:	83 c4 10             	add    $0x10,%esp
+    2c88:	eb 13                	jmp    2c9d <forktest+0x2d>
+    2c8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    2c90:	74 4d                	je     2cdf <forktest+0x6f>
+  for(n=0; n<1000; n++){
+    2c92:	83 c3 01             	add    $0x1,%ebx
+    2c95:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    2c9b:	74 6e                	je     2d0b <forktest+0x9b>
+    pid = fork();
+    2c9d:	e8 0e 0f 00 00       	call   3bb0 <fork>
+    if(pid < 0)
+    2ca2:	85 c0                	test   %eax,%eax
+    2ca4:	79 ea                	jns    2c90 <forktest+0x20>
+  for(; n > 0; n--){
+    2ca6:	85 db                	test   %ebx,%ebx
+    2ca8:	74 14                	je     2cbe <forktest+0x4e>
+    2caa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(wait() < 0){
+    2cb0:	e8 63 13 00 00       	call   4018 <wait>
+    2cb5:	85 c0                	test   %eax,%eax
+    2cb7:	78 2b                	js     2ce4 <forktest+0x74>
+  for(; n > 0; n--){
+    2cb9:	83 eb 01             	sub    $0x1,%ebx
+    2cbc:	75 f2                	jne    2cb0 <forktest+0x40>
+  if(wait() != -1){
+    2cbe:	e8 55 13 00 00       	call   4018 <wait>
+    2cc3:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2cc6:	75 30                	jne    2cf8 <forktest+0x88>
+  printf(1, "fork test OK\n");
+    2cc8:	83 ec 08             	sub    $0x8,%esp
+    2ccb:	68 42 55 00 00       	push   $0x5542
+    2cd0:	6a 01                	push   $0x1
+    2cd2:	e8 d9 15 00 00       	call   42b0 <printf>
+}
+    2cd7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2cda:	83 c4 10             	add    $0x10,%esp
+    2cdd:	c9                   	leave
+    2cde:	c3                   	ret
+      exit();
+    2cdf:	e8 1c 0f 00 00       	call   3c00 <exit>
+      printf(1, "wait stopped early\n");
+    2ce4:	83 ec 08             	sub    $0x8,%esp
+    2ce7:	68 1b 55 00 00       	push   $0x551b
+    2cec:	6a 01                	push   $0x1
+    2cee:	e8 bd 15 00 00       	call   42b0 <printf>
+      exit();
+    2cf3:	e8 08 0f 00 00       	call   3c00 <exit>
+    printf(1, "wait got too many\n");
+    2cf8:	50                   	push   %eax
+    2cf9:	50                   	push   %eax
+    2cfa:	68 2f 55 00 00       	push   $0x552f
+    2cff:	6a 01                	push   $0x1
+    2d01:	e8 aa 15 00 00       	call   42b0 <printf>
+    exit();
+    2d06:	e8 f5 0e 00 00       	call   3c00 <exit>
+    printf(1, "fork claimed to work 1000 times!\n");
+    2d0b:	52                   	push   %edx
+    2d0c:	52                   	push   %edx
+    2d0d:	68 68 5d 00 00       	push   $0x5d68
+    2d12:	6a 01                	push   $0x1
+    2d14:	e8 97 15 00 00       	call   42b0 <printf>
+    exit();
+    2d19:	e8 e2 0e 00 00       	call   3c00 <exit>
+    2d1e:	66 90                	xchg   %ax,%ax
+
+00002d20 <sbrktest>:
+{
+    2d20:	55                   	push   %ebp
+    2d21:	89 e5                	mov    %esp,%ebp
+    2d23:	57                   	push   %edi
+    2d24:	56                   	push   %esi
+  for(i = 0; i < 5000; i++){
+    2d25:	31 f6                	xor    %esi,%esi
+{
+    2d27:	53                   	push   %ebx
+    2d28:	83 ec 64             	sub    $0x64,%esp
+  printf(stdout, "sbrk test\n");
+    2d2b:	68 50 55 00 00       	push   $0x5550
+    2d30:	ff 35 84 6b 00 00    	push   0x6b84
+    2d36:	e8 75 15 00 00       	call   42b0 <printf>
+  oldbrk = sbrk(0);
+    2d3b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2d42:	e8 5c 13 00 00       	call   40a3 <sbrk>
+    2d47:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    2d4a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2d51:	e8 4d 13 00 00       	call   40a3 <sbrk>
+    2d56:	83 c4 10             	add    $0x10,%esp
+    2d59:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){
+    2d5b:	eb 05                	jmp    2d62 <sbrktest+0x42>
+    2d5d:	8d 76 00             	lea    0x0(%esi),%esi
+    a = b + 1;
+    2d60:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    2d62:	83 ec 0c             	sub    $0xc,%esp
+    2d65:	6a 01                	push   $0x1
+    2d67:	e8 37 13 00 00       	call   40a3 <sbrk>
+    if(b != a){
+    2d6c:	83 c4 10             	add    $0x10,%esp
+    2d6f:	39 d8                	cmp    %ebx,%eax
+    2d71:	0f 85 9c 02 00 00    	jne    3013 <sbrktest+0x2f3>
+  for(i = 0; i < 5000; i++){
+    2d77:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+    2d7a:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    2d7d:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    2d80:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    2d86:	75 d8                	jne    2d60 <sbrktest+0x40>
+  pid = fork();
+    2d88:	e8 23 0e 00 00       	call   3bb0 <fork>
+    2d8d:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    2d8f:	85 c0                	test   %eax,%eax
+    2d91:	0f 88 02 03 00 00    	js     3099 <sbrktest+0x379>
+  c = sbrk(1);
+    2d97:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+    2d9a:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    2d9d:	6a 01                	push   $0x1
+    2d9f:	e8 ff 12 00 00       	call   40a3 <sbrk>
+  c = sbrk(1);
+    2da4:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2dab:	e8 f3 12 00 00       	call   40a3 <sbrk>
+  if(c != a + 1){
+    2db0:	83 c4 10             	add    $0x10,%esp
+    2db3:	39 c3                	cmp    %eax,%ebx
+    2db5:	0f 85 3b 03 00 00    	jne    30f6 <sbrktest+0x3d6>
+  if(pid == 0)
+    2dbb:	85 f6                	test   %esi,%esi
+    2dbd:	0f 84 2e 03 00 00    	je     30f1 <sbrktest+0x3d1>
+  wait();
+    2dc3:	e8 50 12 00 00       	call   4018 <wait>
+  a = sbrk(0);
+    2dc8:	83 ec 0c             	sub    $0xc,%esp
+    2dcb:	6a 00                	push   $0x0
+    2dcd:	e8 d1 12 00 00       	call   40a3 <sbrk>
+    2dd2:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    2dd4:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    2dd9:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    2ddb:	89 04 24             	mov    %eax,(%esp)
+    2dde:	e8 c0 12 00 00       	call   40a3 <sbrk>
+  if (p != a) {
+    2de3:	83 c4 10             	add    $0x10,%esp
+    2de6:	39 c3                	cmp    %eax,%ebx
+    2de8:	0f 85 94 02 00 00    	jne    3082 <sbrktest+0x362>
+  a = sbrk(0);
+    2dee:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    2df1:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    2df8:	6a 00                	push   $0x0
+    2dfa:	e8 a4 12 00 00       	call   40a3 <sbrk>
+  c = sbrk(-4096);
+    2dff:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    2e06:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    2e08:	e8 96 12 00 00       	call   40a3 <sbrk>
+  if(c == (char*)0xffffffff){
+    2e0d:	83 c4 10             	add    $0x10,%esp
+    2e10:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2e13:	0f 84 22 03 00 00    	je     313b <sbrktest+0x41b>
+  c = sbrk(0);
+    2e19:	83 ec 0c             	sub    $0xc,%esp
+    2e1c:	6a 00                	push   $0x0
+    2e1e:	e8 80 12 00 00       	call   40a3 <sbrk>
+  if(c != a - 4096){
+    2e23:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    2e29:	83 c4 10             	add    $0x10,%esp
+    2e2c:	39 d0                	cmp    %edx,%eax
+    2e2e:	0f 85 f0 02 00 00    	jne    3124 <sbrktest+0x404>
+  a = sbrk(0);
+    2e34:	83 ec 0c             	sub    $0xc,%esp
+    2e37:	6a 00                	push   $0x0
+    2e39:	e8 65 12 00 00       	call   40a3 <sbrk>
+  c = sbrk(4096);
+    2e3e:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    2e45:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    2e47:	e8 57 12 00 00       	call   40a3 <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    2e4c:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    2e4f:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    2e51:	39 c3                	cmp    %eax,%ebx
+    2e53:	0f 85 b4 02 00 00    	jne    310d <sbrktest+0x3ed>
+    2e59:	83 ec 0c             	sub    $0xc,%esp
+    2e5c:	6a 00                	push   $0x0
+    2e5e:	e8 40 12 00 00       	call   40a3 <sbrk>
+    2e63:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    2e69:	83 c4 10             	add    $0x10,%esp
+    2e6c:	39 c2                	cmp    %eax,%edx
+    2e6e:	0f 85 99 02 00 00    	jne    310d <sbrktest+0x3ed>
+  if(*lastaddr == 99){
+    2e74:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    2e7b:	0f 84 2f 02 00 00    	je     30b0 <sbrktest+0x390>
+  a = sbrk(0);
+    2e81:	83 ec 0c             	sub    $0xc,%esp
+    2e84:	6a 00                	push   $0x0
+    2e86:	e8 18 12 00 00       	call   40a3 <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    2e8b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    2e92:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    2e94:	e8 0a 12 00 00       	call   40a3 <sbrk>
+    2e99:	89 c2                	mov    %eax,%edx
+    2e9b:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    2e9e:	29 d0                	sub    %edx,%eax
+    2ea0:	89 04 24             	mov    %eax,(%esp)
+    2ea3:	e8 fb 11 00 00       	call   40a3 <sbrk>
+  if(c != a){
+    2ea8:	83 c4 10             	add    $0x10,%esp
+    2eab:	39 c3                	cmp    %eax,%ebx
+    2ead:	0f 85 b8 01 00 00    	jne    306b <sbrktest+0x34b>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    2eb3:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    2eb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2ebf:	90                   	nop
+    ppid = getpid();
+    2ec0:	e8 d4 11 00 00       	call   4099 <getpid>
+    2ec5:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    2ec7:	e8 e4 0c 00 00       	call   3bb0 <fork>
+    if(pid < 0){
+    2ecc:	85 c0                	test   %eax,%eax
+    2ece:	0f 88 5d 01 00 00    	js     3031 <sbrktest+0x311>
+    if(pid == 0){
+    2ed4:	0f 84 6f 01 00 00    	je     3049 <sbrktest+0x329>
+    wait();
+    2eda:	e8 39 11 00 00       	call   4018 <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    2edf:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    2ee5:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    2eeb:	75 d3                	jne    2ec0 <sbrktest+0x1a0>
+  if(pipe(fds) != 0){
+    2eed:	83 ec 0c             	sub    $0xc,%esp
+    2ef0:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    2ef3:	50                   	push   %eax
+    2ef4:	e8 26 11 00 00       	call   401f <pipe>
+    2ef9:	83 c4 10             	add    $0x10,%esp
+    2efc:	85 c0                	test   %eax,%eax
+    2efe:	0f 85 da 01 00 00    	jne    30de <sbrktest+0x3be>
+    2f04:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+    2f07:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    2f0a:	89 df                	mov    %ebx,%edi
+    2f0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pids[i] = fork()) == 0){
+    2f10:	e8 9b 0c 00 00       	call   3bb0 <fork>
+    2f15:	89 07                	mov    %eax,(%edi)
+    2f17:	85 c0                	test   %eax,%eax
+    2f19:	0f 84 91 00 00 00    	je     2fb0 <sbrktest+0x290>
+    if(pids[i] != -1)
+    2f1f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2f22:	74 14                	je     2f38 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+    2f24:	83 ec 04             	sub    $0x4,%esp
+    2f27:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    2f2a:	6a 01                	push   $0x1
+    2f2c:	50                   	push   %eax
+    2f2d:	ff 75 b8             	push   -0x48(%ebp)
+    2f30:	e8 f1 10 00 00       	call   4026 <read>
+    2f35:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    2f38:	83 c7 04             	add    $0x4,%edi
+    2f3b:	39 f7                	cmp    %esi,%edi
+    2f3d:	75 d1                	jne    2f10 <sbrktest+0x1f0>
+  c = sbrk(4096);
+    2f3f:	83 ec 0c             	sub    $0xc,%esp
+    2f42:	68 00 10 00 00       	push   $0x1000
+    2f47:	e8 57 11 00 00       	call   40a3 <sbrk>
+    2f4c:	83 c4 10             	add    $0x10,%esp
+    2f4f:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    2f51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    2f58:	8b 03                	mov    (%ebx),%eax
+    2f5a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2f5d:	74 11                	je     2f70 <sbrktest+0x250>
+    kill(pids[i]);
+    2f5f:	83 ec 0c             	sub    $0xc,%esp
+    2f62:	50                   	push   %eax
+    2f63:	e8 d3 10 00 00       	call   403b <kill>
+    wait();
+    2f68:	e8 ab 10 00 00       	call   4018 <wait>
+    2f6d:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    2f70:	83 c3 04             	add    $0x4,%ebx
+    2f73:	39 f3                	cmp    %esi,%ebx
+    2f75:	75 e1                	jne    2f58 <sbrktest+0x238>
+  if(c == (char*)0xffffffff){
+    2f77:	83 ff ff             	cmp    $0xffffffff,%edi
+    2f7a:	0f 84 47 01 00 00    	je     30c7 <sbrktest+0x3a7>
+  if(sbrk(0) > oldbrk)
+    2f80:	83 ec 0c             	sub    $0xc,%esp
+    2f83:	6a 00                	push   $0x0
+    2f85:	e8 19 11 00 00       	call   40a3 <sbrk>
+    2f8a:	83 c4 10             	add    $0x10,%esp
+    2f8d:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    2f90:	72 60                	jb     2ff2 <sbrktest+0x2d2>
+  printf(stdout, "sbrk test OK\n");
+    2f92:	83 ec 08             	sub    $0x8,%esp
+    2f95:	68 f8 55 00 00       	push   $0x55f8
+    2f9a:	ff 35 84 6b 00 00    	push   0x6b84
+    2fa0:	e8 0b 13 00 00       	call   42b0 <printf>
+}
+    2fa5:	83 c4 10             	add    $0x10,%esp
+    2fa8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2fab:	5b                   	pop    %ebx
+    2fac:	5e                   	pop    %esi
+    2fad:	5f                   	pop    %edi
+    2fae:	5d                   	pop    %ebp
+    2faf:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    2fb0:	83 ec 0c             	sub    $0xc,%esp
+    2fb3:	6a 00                	push   $0x0
+    2fb5:	e8 e9 10 00 00       	call   40a3 <sbrk>
+    2fba:	89 c2                	mov    %eax,%edx
+    2fbc:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    2fc1:	29 d0                	sub    %edx,%eax
+    2fc3:	89 04 24             	mov    %eax,(%esp)
+    2fc6:	e8 d8 10 00 00       	call   40a3 <sbrk>
+      write(fds[1], "x", 1);
+    2fcb:	83 c4 0c             	add    $0xc,%esp
+    2fce:	6a 01                	push   $0x1
+    2fd0:	68 b9 50 00 00       	push   $0x50b9
+    2fd5:	ff 75 bc             	push   -0x44(%ebp)
+    2fd8:	e8 50 10 00 00       	call   402d <write>
+    2fdd:	83 c4 10             	add    $0x10,%esp
+      for(;;) sleep(1000);
+    2fe0:	83 ec 0c             	sub    $0xc,%esp
+    2fe3:	68 e8 03 00 00       	push   $0x3e8
+    2fe8:	e8 c0 10 00 00       	call   40ad <sleep>
+    2fed:	83 c4 10             	add    $0x10,%esp
+    2ff0:	eb ee                	jmp    2fe0 <sbrktest+0x2c0>
+    sbrk(-(sbrk(0) - oldbrk));
+    2ff2:	83 ec 0c             	sub    $0xc,%esp
+    2ff5:	6a 00                	push   $0x0
+    2ff7:	e8 a7 10 00 00       	call   40a3 <sbrk>
+    2ffc:	89 c2                	mov    %eax,%edx
+    2ffe:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    3001:	29 d0                	sub    %edx,%eax
+    3003:	89 04 24             	mov    %eax,(%esp)
+    3006:	e8 98 10 00 00       	call   40a3 <sbrk>
+    300b:	83 c4 10             	add    $0x10,%esp
+    300e:	e9 7f ff ff ff       	jmp    2f92 <sbrktest+0x272>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    3013:	83 ec 0c             	sub    $0xc,%esp
+    3016:	50                   	push   %eax
+    3017:	53                   	push   %ebx
+    3018:	56                   	push   %esi
+    3019:	68 5b 55 00 00       	push   $0x555b
+    301e:	ff 35 84 6b 00 00    	push   0x6b84
+    3024:	e8 87 12 00 00       	call   42b0 <printf>
+      exit();
+    3029:	83 c4 20             	add    $0x20,%esp
+    302c:	e8 cf 0b 00 00       	call   3c00 <exit>
+      printf(stdout, "fork failed\n");
+    3031:	83 ec 08             	sub    $0x8,%esp
+    3034:	68 6a 57 00 00       	push   $0x576a
+    3039:	ff 35 84 6b 00 00    	push   0x6b84
+    303f:	e8 6c 12 00 00       	call   42b0 <printf>
+      exit();
+    3044:	e8 b7 0b 00 00       	call   3c00 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    3049:	0f be 03             	movsbl (%ebx),%eax
+    304c:	50                   	push   %eax
+    304d:	53                   	push   %ebx
+    304e:	68 c4 55 00 00       	push   $0x55c4
+    3053:	ff 35 84 6b 00 00    	push   0x6b84
+    3059:	e8 52 12 00 00       	call   42b0 <printf>
+      kill(ppid);
+    305e:	89 34 24             	mov    %esi,(%esp)
+    3061:	e8 d5 0f 00 00       	call   403b <kill>
+      exit();
+    3066:	e8 95 0b 00 00       	call   3c00 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    306b:	50                   	push   %eax
+    306c:	53                   	push   %ebx
+    306d:	68 5c 5e 00 00       	push   $0x5e5c
+    3072:	ff 35 84 6b 00 00    	push   0x6b84
+    3078:	e8 33 12 00 00       	call   42b0 <printf>
+    exit();
+    307d:	e8 7e 0b 00 00       	call   3c00 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    3082:	56                   	push   %esi
+    3083:	56                   	push   %esi
+    3084:	68 8c 5d 00 00       	push   $0x5d8c
+    3089:	ff 35 84 6b 00 00    	push   0x6b84
+    308f:	e8 1c 12 00 00       	call   42b0 <printf>
+    exit();
+    3094:	e8 67 0b 00 00       	call   3c00 <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    3099:	50                   	push   %eax
+    309a:	50                   	push   %eax
+    309b:	68 76 55 00 00       	push   $0x5576
+    30a0:	ff 35 84 6b 00 00    	push   0x6b84
+    30a6:	e8 05 12 00 00       	call   42b0 <printf>
+    exit();
+    30ab:	e8 50 0b 00 00       	call   3c00 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    30b0:	51                   	push   %ecx
+    30b1:	51                   	push   %ecx
+    30b2:	68 2c 5e 00 00       	push   $0x5e2c
+    30b7:	ff 35 84 6b 00 00    	push   0x6b84
+    30bd:	e8 ee 11 00 00       	call   42b0 <printf>
+    exit();
+    30c2:	e8 39 0b 00 00       	call   3c00 <exit>
+    printf(stdout, "failed sbrk leaked memory\n");
+    30c7:	50                   	push   %eax
+    30c8:	50                   	push   %eax
+    30c9:	68 dd 55 00 00       	push   $0x55dd
+    30ce:	ff 35 84 6b 00 00    	push   0x6b84
+    30d4:	e8 d7 11 00 00       	call   42b0 <printf>
+    exit();
+    30d9:	e8 22 0b 00 00       	call   3c00 <exit>
+    printf(1, "pipe() failed\n");
+    30de:	52                   	push   %edx
+    30df:	52                   	push   %edx
+    30e0:	68 99 4a 00 00       	push   $0x4a99
+    30e5:	6a 01                	push   $0x1
+    30e7:	e8 c4 11 00 00       	call   42b0 <printf>
+    exit();
+    30ec:	e8 0f 0b 00 00       	call   3c00 <exit>
+    exit();
+    30f1:	e8 0a 0b 00 00       	call   3c00 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    30f6:	57                   	push   %edi
+    30f7:	57                   	push   %edi
+    30f8:	68 8d 55 00 00       	push   $0x558d
+    30fd:	ff 35 84 6b 00 00    	push   0x6b84
+    3103:	e8 a8 11 00 00       	call   42b0 <printf>
+    exit();
+    3108:	e8 f3 0a 00 00       	call   3c00 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    310d:	56                   	push   %esi
+    310e:	53                   	push   %ebx
+    310f:	68 04 5e 00 00       	push   $0x5e04
+    3114:	ff 35 84 6b 00 00    	push   0x6b84
+    311a:	e8 91 11 00 00       	call   42b0 <printf>
+    exit();
+    311f:	e8 dc 0a 00 00       	call   3c00 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    3124:	50                   	push   %eax
+    3125:	53                   	push   %ebx
+    3126:	68 cc 5d 00 00       	push   $0x5dcc
+    312b:	ff 35 84 6b 00 00    	push   0x6b84
+    3131:	e8 7a 11 00 00       	call   42b0 <printf>
+    exit();
+    3136:	e8 c5 0a 00 00       	call   3c00 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    313b:	53                   	push   %ebx
+    313c:	53                   	push   %ebx
+    313d:	68 a9 55 00 00       	push   $0x55a9
+    3142:	ff 35 84 6b 00 00    	push   0x6b84
+    3148:	e8 63 11 00 00       	call   42b0 <printf>
+    exit();
+    314d:	e8 ae 0a 00 00       	call   3c00 <exit>
+    3152:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003160 <validateint>:
+}
+    3160:	c3                   	ret
+    3161:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3168:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    316f:	90                   	nop
+
+00003170 <validatetest>:
+{
+    3170:	55                   	push   %ebp
+    3171:	89 e5                	mov    %esp,%ebp
+    3173:	56                   	push   %esi
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3174:	31 f6                	xor    %esi,%esi
+{
+    3176:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    3177:	83 ec 08             	sub    $0x8,%esp
+    317a:	68 06 56 00 00       	push   $0x5606
+    317f:	ff 35 84 6b 00 00    	push   0x6b84
+    3185:	e8 26 11 00 00       	call   42b0 <printf>
+    318a:	83 c4 10             	add    $0x10,%esp
+    318d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) == 0){
+    3190:	e8 1b 0a 00 00       	call   3bb0 <fork>
+    3195:	89 c3                	mov    %eax,%ebx
+    3197:	85 c0                	test   %eax,%eax
+    3199:	74 63                	je     31fe <validatetest+0x8e>
+    sleep(0);
+    319b:	83 ec 0c             	sub    $0xc,%esp
+    319e:	6a 00                	push   $0x0
+    31a0:	e8 08 0f 00 00       	call   40ad <sleep>
+    sleep(0);
+    31a5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    31ac:	e8 fc 0e 00 00       	call   40ad <sleep>
+    kill(pid);
+    31b1:	89 1c 24             	mov    %ebx,(%esp)
+    31b4:	e8 82 0e 00 00       	call   403b <kill>
+    wait();
+    31b9:	e8 5a 0e 00 00       	call   4018 <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    31be:	58                   	pop    %eax
+    31bf:	5a                   	pop    %edx
+    31c0:	56                   	push   %esi
+    31c1:	68 15 56 00 00       	push   $0x5615
+    31c6:	e8 a6 0e 00 00       	call   4071 <link>
+    31cb:	83 c4 10             	add    $0x10,%esp
+    31ce:	83 f8 ff             	cmp    $0xffffffff,%eax
+    31d1:	75 30                	jne    3203 <validatetest+0x93>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    31d3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    31d9:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    31df:	75 af                	jne    3190 <validatetest+0x20>
+  printf(stdout, "validate ok\n");
+    31e1:	83 ec 08             	sub    $0x8,%esp
+    31e4:	68 39 56 00 00       	push   $0x5639
+    31e9:	ff 35 84 6b 00 00    	push   0x6b84
+    31ef:	e8 bc 10 00 00       	call   42b0 <printf>
+}
+    31f4:	83 c4 10             	add    $0x10,%esp
+    31f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    31fa:	5b                   	pop    %ebx
+    31fb:	5e                   	pop    %esi
+    31fc:	5d                   	pop    %ebp
+    31fd:	c3                   	ret
+      exit();
+    31fe:	e8 fd 09 00 00       	call   3c00 <exit>
+      printf(stdout, "link should not succeed\n");
+    3203:	83 ec 08             	sub    $0x8,%esp
+    3206:	68 20 56 00 00       	push   $0x5620
+    320b:	ff 35 84 6b 00 00    	push   0x6b84
+    3211:	e8 9a 10 00 00       	call   42b0 <printf>
+      exit();
+    3216:	e8 e5 09 00 00       	call   3c00 <exit>
+    321b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    321f:	90                   	nop
+
+00003220 <bsstest>:
+{
+    3220:	55                   	push   %ebp
+    3221:	89 e5                	mov    %esp,%ebp
+    3223:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "bss test\n");
+    3226:	68 46 56 00 00       	push   $0x5646
+    322b:	ff 35 84 6b 00 00    	push   0x6b84
+    3231:	e8 7a 10 00 00       	call   42b0 <printf>
+    3236:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    3239:	31 c0                	xor    %eax,%eax
+    323b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    323f:	90                   	nop
+    if(uninit[i] != '\0'){
+    3240:	80 b8 a0 6b 00 00 00 	cmpb   $0x0,0x6ba0(%eax)
+    3247:	75 22                	jne    326b <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    3249:	83 c0 01             	add    $0x1,%eax
+    324c:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    3251:	75 ed                	jne    3240 <bsstest+0x20>
+  printf(stdout, "bss test ok\n");
+    3253:	83 ec 08             	sub    $0x8,%esp
+    3256:	68 61 56 00 00       	push   $0x5661
+    325b:	ff 35 84 6b 00 00    	push   0x6b84
+    3261:	e8 4a 10 00 00       	call   42b0 <printf>
+}
+    3266:	83 c4 10             	add    $0x10,%esp
+    3269:	c9                   	leave
+    326a:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    326b:	83 ec 08             	sub    $0x8,%esp
+    326e:	68 50 56 00 00       	push   $0x5650
+    3273:	ff 35 84 6b 00 00    	push   0x6b84
+    3279:	e8 32 10 00 00       	call   42b0 <printf>
+      exit();
+    327e:	e8 7d 09 00 00       	call   3c00 <exit>
+    3283:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    328a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003290 <bigargtest>:
+{
+    3290:	55                   	push   %ebp
+    3291:	89 e5                	mov    %esp,%ebp
+    3293:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    3296:	68 6e 56 00 00       	push   $0x566e
+    329b:	e8 bd 0d 00 00       	call   405d <unlink>
+  pid = fork();
+    32a0:	e8 0b 09 00 00       	call   3bb0 <fork>
+  if(pid == 0){
+    32a5:	83 c4 10             	add    $0x10,%esp
+    32a8:	85 c0                	test   %eax,%eax
+    32aa:	74 44                	je     32f0 <bigargtest+0x60>
+  } else if(pid < 0){
+    32ac:	0f 88 c3 00 00 00    	js     3375 <bigargtest+0xe5>
+  wait();
+    32b2:	e8 61 0d 00 00       	call   4018 <wait>
+  fd = open("bigarg-ok", 0);
+    32b7:	83 ec 08             	sub    $0x8,%esp
+    32ba:	6a 00                	push   $0x0
+    32bc:	68 6e 56 00 00       	push   $0x566e
+    32c1:	e8 83 0d 00 00       	call   4049 <open>
+  if(fd < 0){
+    32c6:	83 c4 10             	add    $0x10,%esp
+    32c9:	85 c0                	test   %eax,%eax
+    32cb:	0f 88 8d 00 00 00    	js     335e <bigargtest+0xce>
+  close(fd);
+    32d1:	83 ec 0c             	sub    $0xc,%esp
+    32d4:	50                   	push   %eax
+    32d5:	e8 96 09 00 00       	call   3c70 <close>
+  unlink("bigarg-ok");
+    32da:	c7 04 24 6e 56 00 00 	movl   $0x566e,(%esp)
+    32e1:	e8 77 0d 00 00       	call   405d <unlink>
+}
+    32e6:	83 c4 10             	add    $0x10,%esp
+    32e9:	c9                   	leave
+    32ea:	c3                   	ret
+    32eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    32ef:	90                   	nop
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    32f0:	c7 04 85 c0 b2 00 00 	movl   $0x5e80,0xb2c0(,%eax,4)
+    32f7:	80 5e 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    32fb:	83 c0 01             	add    $0x1,%eax
+    32fe:	83 f8 1f             	cmp    $0x1f,%eax
+    3301:	75 ed                	jne    32f0 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    3303:	31 c9                	xor    %ecx,%ecx
+    3305:	89 0d 3c b3 00 00    	mov    %ecx,0xb33c
+    printf(stdout, "bigarg test\n");
+    330b:	50                   	push   %eax
+    330c:	50                   	push   %eax
+    330d:	68 78 56 00 00       	push   $0x5678
+    3312:	ff 35 84 6b 00 00    	push   0x6b84
+    3318:	e8 93 0f 00 00       	call   42b0 <printf>
+    exec("echo", args);
+    331d:	58                   	pop    %eax
+    331e:	5a                   	pop    %edx
+    331f:	68 c0 b2 00 00       	push   $0xb2c0
+    3324:	68 45 48 00 00       	push   $0x4845
+    3329:	e8 e2 08 00 00       	call   3c10 <exec>
+    printf(stdout, "bigarg test ok\n");
+    332e:	59                   	pop    %ecx
+    332f:	58                   	pop    %eax
+    3330:	68 85 56 00 00       	push   $0x5685
+    3335:	ff 35 84 6b 00 00    	push   0x6b84
+    333b:	e8 70 0f 00 00       	call   42b0 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    3340:	58                   	pop    %eax
+    3341:	5a                   	pop    %edx
+    3342:	68 00 02 00 00       	push   $0x200
+    3347:	68 6e 56 00 00       	push   $0x566e
+    334c:	e8 f8 0c 00 00       	call   4049 <open>
+    close(fd);
+    3351:	89 04 24             	mov    %eax,(%esp)
+    3354:	e8 17 09 00 00       	call   3c70 <close>
+    exit();
+    3359:	e8 a2 08 00 00       	call   3c00 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    335e:	50                   	push   %eax
+    335f:	50                   	push   %eax
+    3360:	68 ae 56 00 00       	push   $0x56ae
+    3365:	ff 35 84 6b 00 00    	push   0x6b84
+    336b:	e8 40 0f 00 00       	call   42b0 <printf>
+    exit();
+    3370:	e8 8b 08 00 00       	call   3c00 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    3375:	52                   	push   %edx
+    3376:	52                   	push   %edx
+    3377:	68 95 56 00 00       	push   $0x5695
+    337c:	ff 35 84 6b 00 00    	push   0x6b84
+    3382:	e8 29 0f 00 00       	call   42b0 <printf>
+    exit();
+    3387:	e8 74 08 00 00       	call   3c00 <exit>
+    338c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003390 <fsfull>:
+{
+    3390:	55                   	push   %ebp
+    3391:	89 e5                	mov    %esp,%ebp
+    3393:	57                   	push   %edi
+    3394:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    3395:	31 f6                	xor    %esi,%esi
+{
+    3397:	53                   	push   %ebx
+    3398:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    339b:	68 c3 56 00 00       	push   $0x56c3
+    33a0:	6a 01                	push   $0x1
+    33a2:	e8 09 0f 00 00       	call   42b0 <printf>
+    33a7:	83 c4 10             	add    $0x10,%esp
+    33aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    33b0:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    33b5:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    33ba:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    33bd:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    33c1:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    33c3:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    33c7:	c1 ea 06             	shr    $0x6,%edx
+    33ca:	8d 42 30             	lea    0x30(%edx),%eax
+    33cd:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    33d0:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    33d6:	89 f2                	mov    %esi,%edx
+    33d8:	29 c2                	sub    %eax,%edx
+    33da:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    33df:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    33e1:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    33e6:	c1 ea 05             	shr    $0x5,%edx
+    33e9:	83 c2 30             	add    $0x30,%edx
+    33ec:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    33ef:	f7 e6                	mul    %esi
+    33f1:	c1 ea 05             	shr    $0x5,%edx
+    33f4:	6b c2 64             	imul   $0x64,%edx,%eax
+    33f7:	89 f2                	mov    %esi,%edx
+    33f9:	29 c2                	sub    %eax,%edx
+    33fb:	89 d0                	mov    %edx,%eax
+    33fd:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    33ff:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3401:	c1 ea 03             	shr    $0x3,%edx
+    3404:	83 c2 30             	add    $0x30,%edx
+    3407:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    340a:	f7 e1                	mul    %ecx
+    340c:	89 f0                	mov    %esi,%eax
+    340e:	c1 ea 03             	shr    $0x3,%edx
+    3411:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    3414:	01 d2                	add    %edx,%edx
+    3416:	29 d0                	sub    %edx,%eax
+    3418:	83 c0 30             	add    $0x30,%eax
+    341b:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    341e:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3421:	50                   	push   %eax
+    3422:	68 d0 56 00 00       	push   $0x56d0
+    3427:	6a 01                	push   $0x1
+    3429:	e8 82 0e 00 00       	call   42b0 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    342e:	58                   	pop    %eax
+    342f:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3432:	5a                   	pop    %edx
+    3433:	68 02 02 00 00       	push   $0x202
+    3438:	50                   	push   %eax
+    3439:	e8 0b 0c 00 00       	call   4049 <open>
+    if(fd < 0){
+    343e:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    3441:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    3443:	85 c0                	test   %eax,%eax
+    3445:	78 4f                	js     3496 <fsfull+0x106>
+    int total = 0;
+    3447:	31 db                	xor    %ebx,%ebx
+    3449:	eb 07                	jmp    3452 <fsfull+0xc2>
+    344b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    344f:	90                   	nop
+      total += cc;
+    3450:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    3452:	83 ec 04             	sub    $0x4,%esp
+    3455:	68 00 02 00 00       	push   $0x200
+    345a:	68 c0 92 00 00       	push   $0x92c0
+    345f:	57                   	push   %edi
+    3460:	e8 c8 0b 00 00       	call   402d <write>
+      if(cc < 512)
+    3465:	83 c4 10             	add    $0x10,%esp
+    3468:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    346d:	7f e1                	jg     3450 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    346f:	83 ec 04             	sub    $0x4,%esp
+    3472:	53                   	push   %ebx
+    3473:	68 ec 56 00 00       	push   $0x56ec
+    3478:	6a 01                	push   $0x1
+    347a:	e8 31 0e 00 00       	call   42b0 <printf>
+    close(fd);
+    347f:	89 3c 24             	mov    %edi,(%esp)
+    3482:	e8 e9 07 00 00       	call   3c70 <close>
+    if(total == 0)
+    3487:	83 c4 10             	add    $0x10,%esp
+    348a:	85 db                	test   %ebx,%ebx
+    348c:	74 1e                	je     34ac <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    348e:	83 c6 01             	add    $0x1,%esi
+    3491:	e9 1a ff ff ff       	jmp    33b0 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    3496:	83 ec 04             	sub    $0x4,%esp
+    3499:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    349c:	50                   	push   %eax
+    349d:	68 dc 56 00 00       	push   $0x56dc
+    34a2:	6a 01                	push   $0x1
+    34a4:	e8 07 0e 00 00       	call   42b0 <printf>
+      break;
+    34a9:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    34ac:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    34b1:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    34b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    34bd:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    34c0:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    34c2:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    34c5:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    34c9:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    34cb:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    34cf:	c1 ea 06             	shr    $0x6,%edx
+    34d2:	8d 42 30             	lea    0x30(%edx),%eax
+    34d5:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    34d8:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    34de:	89 f2                	mov    %esi,%edx
+    34e0:	29 c2                	sub    %eax,%edx
+    34e2:	89 d0                	mov    %edx,%eax
+    34e4:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    34e6:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    34e8:	c1 ea 05             	shr    $0x5,%edx
+    34eb:	83 c2 30             	add    $0x30,%edx
+    34ee:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    34f1:	f7 e3                	mul    %ebx
+    34f3:	c1 ea 05             	shr    $0x5,%edx
+    34f6:	6b ca 64             	imul   $0x64,%edx,%ecx
+    34f9:	89 f2                	mov    %esi,%edx
+    34fb:	29 ca                	sub    %ecx,%edx
+    34fd:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    3502:	89 d0                	mov    %edx,%eax
+    3504:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    3506:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3508:	c1 ea 03             	shr    $0x3,%edx
+    350b:	83 c2 30             	add    $0x30,%edx
+    350e:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    3511:	f7 e1                	mul    %ecx
+    3513:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    3515:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    3518:	c1 ea 03             	shr    $0x3,%edx
+    351b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    351e:	01 d2                	add    %edx,%edx
+    3520:	29 d0                	sub    %edx,%eax
+    3522:	83 c0 30             	add    $0x30,%eax
+    3525:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    3528:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    352b:	50                   	push   %eax
+    352c:	e8 2c 0b 00 00       	call   405d <unlink>
+  while(nfiles >= 0){
+    3531:	83 c4 10             	add    $0x10,%esp
+    3534:	83 fe ff             	cmp    $0xffffffff,%esi
+    3537:	75 87                	jne    34c0 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    3539:	83 ec 08             	sub    $0x8,%esp
+    353c:	68 fc 56 00 00       	push   $0x56fc
+    3541:	6a 01                	push   $0x1
+    3543:	e8 68 0d 00 00       	call   42b0 <printf>
+}
+    3548:	83 c4 10             	add    $0x10,%esp
+    354b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    354e:	5b                   	pop    %ebx
+    354f:	5e                   	pop    %esi
+    3550:	5f                   	pop    %edi
+    3551:	5d                   	pop    %ebp
+    3552:	c3                   	ret
+    3553:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    355a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003560 <mmaptest>:
+{
+    3560:	55                   	push   %ebp
+    3561:	89 e5                	mov    %esp,%ebp
+    3563:	57                   	push   %edi
+    3564:	56                   	push   %esi
+    3565:	53                   	push   %ebx
+    3566:	83 ec 24             	sub    $0x24,%esp
+  printf(stdout, "mmap test\n");
+    3569:	68 12 57 00 00       	push   $0x5712
+    356e:	ff 35 84 6b 00 00    	push   0x6b84
+    3574:	e8 37 0d 00 00       	call   42b0 <printf>
+  unlink("mmapfile");
+    3579:	c7 04 24 1d 57 00 00 	movl   $0x571d,(%esp)
+    3580:	e8 d8 0a 00 00       	call   405d <unlink>
+  fd = open("mmapfile", O_CREATE|O_RDWR);
+    3585:	5a                   	pop    %edx
+    3586:	59                   	pop    %ecx
+    3587:	68 02 02 00 00       	push   $0x202
+    358c:	68 1d 57 00 00       	push   $0x571d
+    3591:	e8 b3 0a 00 00       	call   4049 <open>
+  if(fd < 0){
+    3596:	83 c4 10             	add    $0x10,%esp
+    3599:	85 c0                	test   %eax,%eax
+    359b:	0f 88 ab 02 00 00    	js     384c <mmaptest+0x2ec>
+  memset(buf, 'a', 4096);
+    35a1:	83 ec 04             	sub    $0x4,%esp
+    35a4:	89 c3                	mov    %eax,%ebx
+    35a6:	68 00 10 00 00       	push   $0x1000
+    35ab:	6a 61                	push   $0x61
+    35ad:	68 c0 92 00 00       	push   $0x92c0
+    35b2:	e8 e9 07 00 00       	call   3da0 <memset>
+  if(write(fd, buf, 4096) != 4096){
+    35b7:	83 c4 0c             	add    $0xc,%esp
+    35ba:	68 00 10 00 00       	push   $0x1000
+    35bf:	68 c0 92 00 00       	push   $0x92c0
+    35c4:	53                   	push   %ebx
+    35c5:	e8 63 0a 00 00       	call   402d <write>
+    35ca:	83 c4 10             	add    $0x10,%esp
+    35cd:	3d 00 10 00 00       	cmp    $0x1000,%eax
+    35d2:	0f 85 5d 02 00 00    	jne    3835 <mmaptest+0x2d5>
+  p = mmap(fd, 0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED);
+    35d8:	83 ec 0c             	sub    $0xc,%esp
+    35db:	6a 01                	push   $0x1
+    35dd:	6a 03                	push   $0x3
+    35df:	68 00 10 00 00       	push   $0x1000
+    35e4:	6a 00                	push   $0x0
+    35e6:	53                   	push   %ebx
+    35e7:	e8 7f 0b 00 00       	call   416b <mmap>
+  q = mmap(fd, 0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED);
+    35ec:	83 c4 14             	add    $0x14,%esp
+    35ef:	6a 01                	push   $0x1
+  p = mmap(fd, 0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED);
+    35f1:	89 c6                	mov    %eax,%esi
+  q = mmap(fd, 0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED);
+    35f3:	6a 03                	push   $0x3
+    35f5:	68 00 10 00 00       	push   $0x1000
+    35fa:	6a 00                	push   $0x0
+    35fc:	53                   	push   %ebx
+    35fd:	e8 69 0b 00 00       	call   416b <mmap>
+  if(p == (char*)-1 || q == (char*)-1){
+    3602:	83 c4 20             	add    $0x20,%esp
+  q = mmap(fd, 0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED);
+    3605:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(p == (char*)-1 || q == (char*)-1){
+    3608:	83 fe ff             	cmp    $0xffffffff,%esi
+    360b:	0f 84 0d 02 00 00    	je     381e <mmaptest+0x2be>
+    3611:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3614:	0f 84 04 02 00 00    	je     381e <mmaptest+0x2be>
+  if(q[0] != 'p'){
+    361a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  p[0] = 'p';
+    361d:	c6 06 70             	movb   $0x70,(%esi)
+  if(q[0] != 'p'){
+    3620:	80 38 70             	cmpb   $0x70,(%eax)
+    3623:	0f 85 de 01 00 00    	jne    3807 <mmaptest+0x2a7>
+  if(pwrite(fd, "w", 1, 100) != 1 || p[100] != 'w'){
+    3629:	6a 64                	push   $0x64
+    362b:	6a 01                	push   $0x1
+    362d:	68 62 57 00 00       	push   $0x5762
+    3632:	53                   	push   %ebx
+    3633:	e8 65 0b 00 00       	call   419d <pwrite>
+    3638:	83 c4 10             	add    $0x10,%esp
+    363b:	89 c7                	mov    %eax,%edi
+    363d:	83 f8 01             	cmp    $0x1,%eax
+    3640:	0f 85 aa 01 00 00    	jne    37f0 <mmaptest+0x290>
+    3646:	80 7e 64 77          	cmpb   $0x77,0x64(%esi)
+    364a:	0f 85 a0 01 00 00    	jne    37f0 <mmaptest+0x290>
+  pid = fork();
+    3650:	e8 5b 05 00 00       	call   3bb0 <fork>
+  if(pid < 0){
+    3655:	85 c0                	test   %eax,%eax
+    3657:	0f 88 7c 01 00 00    	js     37d9 <mmaptest+0x279>
+  if(pid == 0){
+    365d:	0f 84 67 01 00 00    	je     37ca <mmaptest+0x26a>
+  wait();
+    3663:	e8 b0 09 00 00       	call   4018 <wait>
+  if(p[200] != 'c'){
+    3668:	80 be c8 00 00 00 63 	cmpb   $0x63,0xc8(%esi)
+    366f:	0f 85 3e 01 00 00    	jne    37b3 <mmaptest+0x253>
+  if(munmap(p, 4096) < 0 || munmap(q, 4096) < 0){
+    3675:	83 ec 08             	sub    $0x8,%esp
+    3678:	68 00 10 00 00       	push   $0x1000
+    367d:	56                   	push   %esi
+    367e:	e8 f2 0a 00 00       	call   4175 <munmap>
+    3683:	83 c4 10             	add    $0x10,%esp
+    3686:	85 c0                	test   %eax,%eax
+    3688:	0f 88 0e 01 00 00    	js     379c <mmaptest+0x23c>
+    368e:	83 ec 08             	sub    $0x8,%esp
+    3691:	68 00 10 00 00       	push   $0x1000
+    3696:	ff 75 e4             	push   -0x1c(%ebp)
+    3699:	e8 d7 0a 00 00       	call   4175 <munmap>
+    369e:	83 c4 10             	add    $0x10,%esp
+    36a1:	85 c0                	test   %eax,%eax
+    36a3:	0f 88 f3 00 00 00    	js     379c <mmaptest+0x23c>
+  if(pread(fd, buf, 4096, 0) != 4096){
+    36a9:	6a 00                	push   $0x0
+    36ab:	68 00 10 00 00       	push   $0x1000
+    36b0:	68 c0 92 00 00       	push   $0x92c0
+    36b5:	53                   	push   %ebx
+    36b6:	e8 d8 0a 00 00       	call   4193 <pread>
+    36bb:	83 c4 10             	add    $0x10,%esp
+    36be:	3d 00 10 00 00       	cmp    $0x1000,%eax
+    36c3:	0f 85 bc 00 00 00    	jne    3785 <mmaptest+0x225>
+    if(buf[i] != (i == 0 ? 'p' : i == 100 ? 'w' : i == 200 ? 'c' : 'a')){
+    36c9:	80 3d c0 92 00 00 70 	cmpb   $0x70,0x92c0
+    36d0:	74 26                	je     36f8 <mmaptest+0x198>
+    36d2:	e9 93 00 00 00       	jmp    376a <mmaptest+0x20a>
+    36d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    36de:	66 90                	xchg   %ax,%ax
+    36e0:	81 ff c8 00 00 00    	cmp    $0xc8,%edi
+    36e6:	74 38                	je     3720 <mmaptest+0x1c0>
+    36e8:	83 f8 61             	cmp    $0x61,%eax
+    36eb:	75 7f                	jne    376c <mmaptest+0x20c>
+  for(i = 0; i < 4096; i++){
+    36ed:	83 c7 01             	add    $0x1,%edi
+    36f0:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+    36f6:	74 40                	je     3738 <mmaptest+0x1d8>
+    if(buf[i] != (i == 0 ? 'p' : i == 100 ? 'w' : i == 200 ? 'c' : 'a')){
+    36f8:	0f be 87 c0 92 00 00 	movsbl 0x92c0(%edi),%eax
+    36ff:	83 ff 64             	cmp    $0x64,%edi
+    3702:	75 dc                	jne    36e0 <mmaptest+0x180>
+    3704:	83 f8 77             	cmp    $0x77,%eax
+    3707:	75 63                	jne    376c <mmaptest+0x20c>
+    3709:	0f be 05 25 93 00 00 	movsbl 0x9325,%eax
+  for(i = 0; i < 4096; i++){
+    3710:	bf 65 00 00 00       	mov    $0x65,%edi
+    3715:	eb d1                	jmp    36e8 <mmaptest+0x188>
+    3717:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    371e:	66 90                	xchg   %ax,%ax
+    if(buf[i] != (i == 0 ? 'p' : i == 100 ? 'w' : i == 200 ? 'c' : 'a')){
+    3720:	83 f8 63             	cmp    $0x63,%eax
+    3723:	75 47                	jne    376c <mmaptest+0x20c>
+    3725:	0f be 05 89 93 00 00 	movsbl 0x9389,%eax
+  for(i = 0; i < 4096; i++){
+    372c:	bf c9 00 00 00       	mov    $0xc9,%edi
+    3731:	eb b5                	jmp    36e8 <mmaptest+0x188>
+    3733:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3737:	90                   	nop
+  close(fd);
+    3738:	83 ec 0c             	sub    $0xc,%esp
+    373b:	53                   	push   %ebx
+    373c:	e8 2f 05 00 00       	call   3c70 <close>
+  unlink("mmapfile");
+    3741:	c7 04 24 1d 57 00 00 	movl   $0x571d,(%esp)
+    3748:	e8 10 09 00 00       	call   405d <unlink>
+  printf(stdout, "mmap test ok\n");
+    374d:	58                   	pop    %eax
+    374e:	5a                   	pop    %edx
+    374f:	68 bc 57 00 00       	push   $0x57bc
+    3754:	ff 35 84 6b 00 00    	push   0x6b84
+    375a:	e8 51 0b 00 00       	call   42b0 <printf>
+}
+    375f:	83 c4 10             	add    $0x10,%esp
+    3762:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3765:	5b                   	pop    %ebx
+    3766:	5e                   	pop    %esi
+    3767:	5f                   	pop    %edi
+    3768:	5d                   	pop    %ebp
+    3769:	c3                   	ret
+  for(i = 0; i < 4096; i++){
+    376a:	31 ff                	xor    %edi,%edi
+      printf(stdout, "mmap: wrong byte %d in file\n", i);
+    376c:	83 ec 04             	sub    $0x4,%esp
+    376f:	57                   	push   %edi
+    3770:	68 9f 57 00 00       	push   $0x579f
+    3775:	ff 35 84 6b 00 00    	push   0x6b84
+    377b:	e8 30 0b 00 00       	call   42b0 <printf>
+      exit();
+    3780:	e8 7b 04 00 00       	call   3c00 <exit>
+    printf(stdout, "mmap: read failed\n");
+    3785:	51                   	push   %ecx
+    3786:	51                   	push   %ecx
+    3787:	68 8c 57 00 00       	push   $0x578c
+    378c:	ff 35 84 6b 00 00    	push   0x6b84
+    3792:	e8 19 0b 00 00       	call   42b0 <printf>
+    exit();
+    3797:	e8 64 04 00 00       	call   3c00 <exit>
+    printf(stdout, "mmap: munmap failed\n");
+    379c:	53                   	push   %ebx
+    379d:	53                   	push   %ebx
+    379e:	68 77 57 00 00       	push   $0x5777
+    37a3:	ff 35 84 6b 00 00    	push   0x6b84
+    37a9:	e8 02 0b 00 00       	call   42b0 <printf>
+    exit();
+    37ae:	e8 4d 04 00 00       	call   3c00 <exit>
+    printf(stdout, "mmap: child's store not seen by parent\n");
+    37b3:	56                   	push   %esi
+    37b4:	56                   	push   %esi
+    37b5:	68 ac 5f 00 00       	push   $0x5fac
+    37ba:	ff 35 84 6b 00 00    	push   0x6b84
+    37c0:	e8 eb 0a 00 00       	call   42b0 <printf>
+    exit();
+    37c5:	e8 36 04 00 00       	call   3c00 <exit>
+    q[200] = 'c';
+    37ca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    37cd:	c6 80 c8 00 00 00 63 	movb   $0x63,0xc8(%eax)
+    exit();
+    37d4:	e8 27 04 00 00       	call   3c00 <exit>
+    printf(stdout, "mmap: fork failed\n");
+    37d9:	57                   	push   %edi
+    37da:	57                   	push   %edi
+    37db:	68 64 57 00 00       	push   $0x5764
+    37e0:	ff 35 84 6b 00 00    	push   0x6b84
+    37e6:	e8 c5 0a 00 00       	call   42b0 <printf>
+    exit();
+    37eb:	e8 10 04 00 00       	call   3c00 <exit>
+    printf(stdout, "mmap: write() not seen by mapping\n");
+    37f0:	50                   	push   %eax
+    37f1:	50                   	push   %eax
+    37f2:	68 88 5f 00 00       	push   $0x5f88
+    37f7:	ff 35 84 6b 00 00    	push   0x6b84
+    37fd:	e8 ae 0a 00 00       	call   42b0 <printf>
+    exit();
+    3802:	e8 f9 03 00 00       	call   3c00 <exit>
+    printf(stdout, "mmap: store not seen by other mapping\n");
+    3807:	50                   	push   %eax
+    3808:	50                   	push   %eax
+    3809:	68 60 5f 00 00       	push   $0x5f60
+    380e:	ff 35 84 6b 00 00    	push   0x6b84
+    3814:	e8 97 0a 00 00       	call   42b0 <printf>
+    exit();
+    3819:	e8 e2 03 00 00       	call   3c00 <exit>
+    printf(stdout, "mmap: mmap failed\n");
+    381e:	50                   	push   %eax
+    381f:	50                   	push   %eax
+    3820:	68 4f 57 00 00       	push   $0x574f
+    3825:	ff 35 84 6b 00 00    	push   0x6b84
+    382b:	e8 80 0a 00 00       	call   42b0 <printf>
+    exit();
+    3830:	e8 cb 03 00 00       	call   3c00 <exit>
+    printf(stdout, "mmap: write failed\n");
+    3835:	50                   	push   %eax
+    3836:	50                   	push   %eax
+    3837:	68 3b 57 00 00       	push   $0x573b
+    383c:	ff 35 84 6b 00 00    	push   0x6b84
+    3842:	e8 69 0a 00 00       	call   42b0 <printf>
+    exit();
+    3847:	e8 b4 03 00 00       	call   3c00 <exit>
+    printf(stdout, "mmap: create failed\n");
+    384c:	50                   	push   %eax
+    384d:	50                   	push   %eax
+    384e:	68 26 57 00 00       	push   $0x5726
+    3853:	ff 35 84 6b 00 00    	push   0x6b84
+    3859:	e8 52 0a 00 00       	call   42b0 <printf>
+    exit();
+    385e:	e8 9d 03 00 00       	call   3c00 <exit>
+    3863:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    386a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003870 <uio>:
+{
+    3870:	55                   	push   %ebp
+    3871:	89 e5                	mov    %esp,%ebp
+    3873:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "uio test\n");
+    3876:	68 ca 57 00 00       	push   $0x57ca
+    387b:	6a 01                	push   $0x1
+    387d:	e8 2e 0a 00 00       	call   42b0 <printf>
+  pid = fork();
+    3882:	e8 29 03 00 00       	call   3bb0 <fork>
+  if(pid == 0){
+    3887:	83 c4 10             	add    $0x10,%esp
+    388a:	85 c0                	test   %eax,%eax
+    388c:	74 1b                	je     38a9 <uio+0x39>
+  } else if(pid < 0){
+    388e:	78 3d                	js     38cd <uio+0x5d>
+  wait();
+    3890:	e8 83 07 00 00       	call   4018 <wait>
+  printf(1, "uio test done\n");
+    3895:	83 ec 08             	sub    $0x8,%esp
+    3898:	68 d4 57 00 00       	push   $0x57d4
+    389d:	6a 01                	push   $0x1
+    389f:	e8 0c 0a 00 00       	call   42b0 <printf>
+}
+    38a4:	83 c4 10             	add    $0x10,%esp
+    38a7:	c9                   	leave
+    38a8:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    38a9:	b8 09 00 00 00       	mov    $0x9,%eax
+    38ae:	ba 70 00 00 00       	mov    $0x70,%edx
+    38b3:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    38b4:	ba 71 00 00 00       	mov    $0x71,%edx
+    38b9:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    38ba:	52                   	push   %edx
+    38bb:	52                   	push   %edx
+    38bc:	68 d4 5f 00 00       	push   $0x5fd4
+    38c1:	6a 01                	push   $0x1
+    38c3:	e8 e8 09 00 00       	call   42b0 <printf>
+    exit();
+    38c8:	e8 33 03 00 00       	call   3c00 <exit>
+    printf (1, "fork failed\n");
+    38cd:	50                   	push   %eax
+    38ce:	50                   	push   %eax
+    38cf:	68 6a 57 00 00       	push   $0x576a
+    38d4:	6a 01                	push   $0x1
+    38d6:	e8 d5 09 00 00       	call   42b0 <printf>
+    exit();
+    38db:	e8 20 03 00 00       	call   3c00 <exit>
+
+000038e0 <argptest>:
+{
+    38e0:	55                   	push   %ebp
+    38e1:	89 e5                	mov    %esp,%ebp
+    38e3:	53                   	push   %ebx
+    38e4:	83 ec 0c             	sub    $0xc,%esp
+  fd = open("init", O_RDONLY);
+    38e7:	6a 00                	push   $0x0
+    38e9:	68 e3 57 00 00       	push   $0x57e3
+    38ee:	e8 56 07 00 00       	call   4049 <open>
+  if (fd < 0) {
+    38f3:	83 c4 10             	add    $0x10,%esp
+    38f6:	85 c0                	test   %eax,%eax
+    38f8:	78 39                	js     3933 <argptest+0x53>
+  read(fd, sbrk(0) - 1, -1);
+    38fa:	83 ec 0c             	sub    $0xc,%esp
+    38fd:	89 c3                	mov    %eax,%ebx
+    38ff:	6a 00                	push   $0x0
+    3901:	e8 9d 07 00 00       	call   40a3 <sbrk>
+    3906:	83 c4 0c             	add    $0xc,%esp
+    3909:	83 e8 01             	sub    $0x1,%eax
+    390c:	6a ff                	push   $0xffffffff
+    390e:	50                   	push   %eax
+    390f:	53                   	push   %ebx
+    3910:	e8 11 07 00 00       	call   4026 <read>
+  close(fd);
+    3915:	89 1c 24             	mov    %ebx,(%esp)
+    3918:	e8 53 03 00 00       	call   3c70 <close>
+  printf(1, "arg test passed\n");
+    391d:	58                   	pop    %eax
+    391e:	5a                   	pop    %edx
+    391f:	68 f5 57 00 00       	push   $0x57f5
+    3924:	6a 01                	push   $0x1
+    3926:	e8 85 09 00 00       	call   42b0 <printf>
+}
+    392b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    392e:	83 c4 10             	add    $0x10,%esp
+    3931:	c9                   	leave
+    3932:	c3                   	ret
+    printf(2, "open failed\n");
+    3933:	51                   	push   %ecx
+    3934:	51                   	push   %ecx
+    3935:	68 e8 57 00 00       	push   $0x57e8
+    393a:	6a 02                	push   $0x2
+    393c:	e8 6f 09 00 00       	call   42b0 <printf>
+    exit();
+    3941:	e8 ba 02 00 00       	call   3c00 <exit>
+    3946:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    394d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003950 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    3950:	69 05 80 6b 00 00 0d 	imul   $0x19660d,0x6b80,%eax
+    3957:	66 19 00 
+    395a:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    395f:	a3 80 6b 00 00       	mov    %eax,0x6b80
+}
+    3964:	c3                   	ret
+    3965:	66 90                	xchg   %ax,%ax
+    3967:	66 90                	xchg   %ax,%ax
+    3969:	66 90                	xchg   %ax,%ax
+    396b:	66 90                	xchg   %ax,%ax
+    396d:	66 90                	xchg   %ax,%ax
+    396f:	90                   	nop
+
+00003970 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+    3970:	55                   	push   %ebp
+    3971:	89 e5                	mov    %esp,%ebp
+    3973:	57                   	push   %edi
+    3974:	56                   	push   %esi
+    3975:	53                   	push   %ebx
+    3976:	83 ec 4c             	sub    $0x4c,%esp
+    3979:	8b 45 0c             	mov    0xc(%ebp),%eax
+    397c:	8b 55 08             	mov    0x8(%ebp),%edx
+    397f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+    3982:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+    3985:	83 fa 0f             	cmp    $0xf,%edx
+    3988:	0f 87 32 01 00 00    	ja     3ac0 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+    398e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+    3994:	8b 80 40 b3 00 00    	mov    0xb340(%eax),%eax
+    399a:	85 c0                	test   %eax,%eax
+    399c:	0f 84 de 00 00 00    	je     3a80 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+    39a2:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+    39a8:	8b b0 44 b3 00 00    	mov    0xb344(%eax),%esi
+    39ae:	8d 88 40 b3 00 00    	lea    0xb340(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+    39b4:	8d b8 48 b3 00 00    	lea    0xb348(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+    39ba:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+    39bd:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+    39c0:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+    39c3:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+    39c9:	0f 8f 01 01 00 00    	jg     3ad0 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+    39cf:	8d 78 08             	lea    0x8(%eax),%edi
+    39d2:	8d bc 3e 40 b3 00 00 	lea    0xb340(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    39d9:	85 db                	test   %ebx,%ebx
+    39db:	7e 3b                	jle    3a18 <bufwrite+0xa8>
+    39dd:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+    39e0:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+    39e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    39e7:	90                   	nop
+    *dst++ = *src++;
+    39e8:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    39e9:	39 c6                	cmp    %eax,%esi
+    39eb:	75 fb                	jne    39e8 <bufwrite+0x78>
+  ob[fd].n += n;
+    39ed:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+    39f3:	8b 88 44 b3 00 00    	mov    0xb344(%eax),%ecx
+    39f9:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+    39fb:	83 b8 40 b3 00 00 01 	cmpl   $0x1,0xb340(%eax)
+  ob[fd].n += n;
+    3a02:	89 88 44 b3 00 00    	mov    %ecx,0xb344(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+    3a08:	74 26                	je     3a30 <bufwrite+0xc0>
+}
+    3a0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3a0d:	5b                   	pop    %ebx
+    3a0e:	5e                   	pop    %esi
+    3a0f:	5f                   	pop    %edi
+    3a10:	5d                   	pop    %ebp
+    3a11:	c3                   	ret
+    3a12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+    3a18:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+    3a1b:	83 b8 40 b3 00 00 01 	cmpl   $0x1,0xb340(%eax)
+  ob[fd].n += n;
+    3a22:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+    3a25:	75 e3                	jne    3a0a <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+    3a27:	85 db                	test   %ebx,%ebx
+    3a29:	74 df                	je     3a0a <bufwrite+0x9a>
+    3a2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3a2f:	90                   	nop
+  src = vsrc;
+    3a30:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+    3a33:	01 c3                	add    %eax,%ebx
+    3a35:	eb 10                	jmp    3a47 <bufwrite+0xd7>
+    3a37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3a3e:	66 90                	xchg   %ax,%ax
+    3a40:	83 c0 01             	add    $0x1,%eax
+    3a43:	39 d8                	cmp    %ebx,%eax
+    3a45:	74 c3                	je     3a0a <bufwrite+0x9a>
+    if(*p == (char)c)
+    3a47:	80 38 0a             	cmpb   $0xa,(%eax)
+    3a4a:	75 f4                	jne    3a40 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+    3a4c:	85 c9                	test   %ecx,%ecx
+    3a4e:	7e ba                	jle    3a0a <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+    3a50:	83 ec 04             	sub    $0x4,%esp
+    3a53:	51                   	push   %ecx
+    3a54:	ff 75 ac             	push   -0x54(%ebp)
+    3a57:	52                   	push   %edx
+    3a58:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+    3a5b:	e8 cd 05 00 00       	call   402d <write>
+    ob[fd].n = 0;
+    3a60:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+    3a63:	83 c4 10             	add    $0x10,%esp
+    3a66:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+    3a6c:	c7 82 44 b3 00 00 00 	movl   $0x0,0xb344(%edx)
+    3a73:	00 00 00 
+    3a76:	eb 92                	jmp    3a0a <bufwrite+0x9a>
+    3a78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3a7f:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+    3a80:	83 ec 08             	sub    $0x8,%esp
+    3a83:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    3a86:	50                   	push   %eax
+    3a87:	52                   	push   %edx
+    3a88:	89 55 b0             	mov    %edx,-0x50(%ebp)
+    3a8b:	e8 d7 05 00 00       	call   4067 <fstat>
+    3a90:	83 c4 10             	add    $0x10,%esp
+    3a93:	8b 55 b0             	mov    -0x50(%ebp),%edx
+    3a96:	89 c1                	mov    %eax,%ecx
+    3a98:	b8 02 00 00 00       	mov    $0x2,%eax
+    3a9d:	85 c9                	test   %ecx,%ecx
+    3a9f:	75 0d                	jne    3aae <bufwrite+0x13e>
+    3aa1:	31 c0                	xor    %eax,%eax
+    3aa3:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+    3aa8:	0f 95 c0             	setne  %al
+    3aab:	83 c0 01             	add    $0x1,%eax
+    3aae:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+    3ab4:	89 81 40 b3 00 00    	mov    %eax,0xb340(%ecx)
+    3aba:	e9 e3 fe ff ff       	jmp    39a2 <bufwrite+0x32>
+    3abf:	90                   	nop
+}
+    3ac0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3ac3:	5b                   	pop    %ebx
+    3ac4:	5e                   	pop    %esi
+    3ac5:	5f                   	pop    %edi
+    3ac6:	5d                   	pop    %ebp
+    write(fd, p, n);
+    3ac7:	e9 61 05 00 00       	jmp    402d <write>
+    3acc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+    3ad0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+    3ad3:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+    3ad6:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+    3ad9:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+    3adc:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+    3adf:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+    3ae2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+    3ae5:	6a 02                	push   $0x2
+    3ae7:	50                   	push   %eax
+    3ae8:	52                   	push   %edx
+    3ae9:	e8 9b 06 00 00       	call   4189 <writev>
+    ob[fd].n = 0;
+    3aee:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+    3af1:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+    3af4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+    3afb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3afe:	5b                   	pop    %ebx
+    3aff:	5e                   	pop    %esi
+    3b00:	5f                   	pop    %edi
+    3b01:	5d                   	pop    %ebp
+    3b02:	c3                   	ret
+    3b03:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3b0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003b10 <fflush>:
+{
+    3b10:	55                   	push   %ebp
+    3b11:	89 e5                	mov    %esp,%ebp
+    3b13:	53                   	push   %ebx
+    3b14:	83 ec 04             	sub    $0x4,%esp
+    3b17:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+    3b1a:	83 f8 0f             	cmp    $0xf,%eax
+    3b1d:	77 16                	ja     3b35 <fflush+0x25>
+    3b1f:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+    3b25:	8b 8a 44 b3 00 00    	mov    0xb344(%edx),%ecx
+    3b2b:	8d 9a 40 b3 00 00    	lea    0xb340(%edx),%ebx
+    3b31:	85 c9                	test   %ecx,%ecx
+    3b33:	7f 0b                	jg     3b40 <fflush+0x30>
+}
+    3b35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3b38:	c9                   	leave
+    3b39:	c3                   	ret
+    3b3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+    3b40:	83 ec 04             	sub    $0x4,%esp
+    3b43:	81 c2 48 b3 00 00    	add    $0xb348,%edx
+    3b49:	51                   	push   %ecx
+    3b4a:	52                   	push   %edx
+    3b4b:	50                   	push   %eax
+    3b4c:	e8 dc 04 00 00       	call   402d <write>
+    ob[fd].n = 0;
+    3b51:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    3b58:	83 c4 10             	add    $0x10,%esp
+}
+    3b5b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3b5e:	c9                   	leave
+    3b5f:	c3                   	ret
+
+00003b60 <fflushall>:
+{
+    3b60:	55                   	push   %ebp
+    3b61:	89 e5                	mov    %esp,%ebp
+    3b63:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+    3b64:	31 f6                	xor    %esi,%esi
+{
+    3b66:	53                   	push   %ebx
+    3b67:	bb 48 b3 00 00       	mov    $0xb348,%ebx
+    3b6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+    3b70:	8b 43 fc             	mov    -0x4(%ebx),%eax
+    3b73:	85 c0                	test   %eax,%eax
+    3b75:	7e 15                	jle    3b8c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+    3b77:	83 ec 04             	sub    $0x4,%esp
+    3b7a:	50                   	push   %eax
+    3b7b:	53                   	push   %ebx
+    3b7c:	56                   	push   %esi
+    3b7d:	e8 ab 04 00 00       	call   402d <write>
+    ob[fd].n = 0;
+    3b82:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+    3b89:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+    3b8c:	83 c6 01             	add    $0x1,%esi
+    3b8f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+    3b95:	83 fe 10             	cmp    $0x10,%esi
+    3b98:	75 d6                	jne    3b70 <fflushall+0x10>
+}
+    3b9a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3b9d:	5b                   	pop    %ebx
+    3b9e:	5e                   	pop    %esi
+    3b9f:	5d                   	pop    %ebp
+    3ba0:	c3                   	ret
+    3ba1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3ba8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3baf:	90                   	nop
+
+00003bb0 <fork>:
+{
+    3bb0:	55                   	push   %ebp
+    3bb1:	89 e5                	mov    %esp,%ebp
+    3bb3:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+    3bb4:	31 f6                	xor    %esi,%esi
+{
+    3bb6:	53                   	push   %ebx
+    3bb7:	bb 48 b3 00 00       	mov    $0xb348,%ebx
+    3bbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+    3bc0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+    3bc3:	85 c0                	test   %eax,%eax
+    3bc5:	7e 15                	jle    3bdc <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+    3bc7:	83 ec 04             	sub    $0x4,%esp
+    3bca:	50                   	push   %eax
+    3bcb:	53                   	push   %ebx
+    3bcc:	56                   	push   %esi
+    3bcd:	e8 5b 04 00 00       	call   402d <write>
+    ob[fd].n = 0;
+    3bd2:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+    3bd9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+    3bdc:	83 c6 01             	add    $0x1,%esi
+    3bdf:	81 c3 08 01 00 00    	add    $0x108,%ebx
+    3be5:	83 fe 10             	cmp    $0x10,%esi
+    3be8:	75 d6                	jne    3bc0 <fork+0x10>
+}
+    3bea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3bed:	5b                   	pop    %ebx
+    3bee:	5e                   	pop    %esi
+    3bef:	5d                   	pop    %ebp
+  return _fork();
+    3bf0:	e9 15 04 00 00       	jmp    400a <_fork>
+    3bf5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3bfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003c00 <exit>:
+{
+    3c00:	55                   	push   %ebp
+    3c01:	89 e5                	mov    %esp,%ebp
+    3c03:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+    3c06:	e8 55 ff ff ff       	call   3b60 <fflushall>
+  _exit();
+    3c0b:	e8 01 04 00 00       	call   4011 <_exit>
+
+00003c10 <exec>:
+{
+    3c10:	55                   	push   %ebp
+    3c11:	89 e5                	mov    %esp,%ebp
+    3c13:	57                   	push   %edi
+    3c14:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+    3c15:	31 f6                	xor    %esi,%esi
+{
+    3c17:	53                   	push   %ebx
+    3c18:	bb 48 b3 00 00       	mov    $0xb348,%ebx
+    3c1d:	83 ec 1c             	sub    $0x1c,%esp
+    3c20:	8b 45 08             	mov    0x8(%ebp),%eax
+    3c23:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    3c26:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    3c29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+    3c30:	8b 43 fc             	mov    -0x4(%ebx),%eax
+    3c33:	85 c0                	test   %eax,%eax
+    3c35:	7e 15                	jle    3c4c <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+    3c37:	83 ec 04             	sub    $0x4,%esp
+    3c3a:	50                   	push   %eax
+    3c3b:	53                   	push   %ebx
+    3c3c:	56                   	push   %esi
+    3c3d:	e8 eb 03 00 00       	call   402d <write>
+    ob[fd].n = 0;
+    3c42:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+    3c49:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+    3c4c:	83 c6 01             	add    $0x1,%esi
+    3c4f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+    3c55:	83 fe 10             	cmp    $0x10,%esi
+    3c58:	75 d6                	jne    3c30 <exec+0x20>
+  return _exec(path, argv);
+    3c5a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    3c5d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+    3c60:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+    3c63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3c66:	5b                   	pop    %ebx
+    3c67:	5e                   	pop    %esi
+    3c68:	5f                   	pop    %edi
+    3c69:	5d                   	pop    %ebp
+  return _exec(path, argv);
+    3c6a:	e9 d3 03 00 00       	jmp    4042 <_exec>
+    3c6f:	90                   	nop
+
+00003c70 <close>:
+{
+    3c70:	55                   	push   %ebp
+    3c71:	89 e5                	mov    %esp,%ebp
+    3c73:	56                   	push   %esi
+    3c74:	53                   	push   %ebx
+    3c75:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+    3c78:	83 fb 0f             	cmp    $0xf,%ebx
+    3c7b:	77 26                	ja     3ca3 <close+0x33>
+    3c7d:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+    3c83:	8b 90 44 b3 00 00    	mov    0xb344(%eax),%edx
+    3c89:	8d b0 40 b3 00 00    	lea    0xb340(%eax),%esi
+    3c8f:	85 d2                	test   %edx,%edx
+    3c91:	7f 25                	jg     3cb8 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+    3c93:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+    3c99:	c7 80 40 b3 00 00 00 	movl   $0x0,0xb340(%eax)
+    3ca0:	00 00 00 
+  return _close(fd);
+    3ca3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    3ca6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3ca9:	5b                   	pop    %ebx
+    3caa:	5e                   	pop    %esi
+    3cab:	5d                   	pop    %ebp
+  return _close(fd);
+    3cac:	e9 83 03 00 00       	jmp    4034 <_close>
+    3cb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+    3cb8:	83 ec 04             	sub    $0x4,%esp
+    3cbb:	05 48 b3 00 00       	add    $0xb348,%eax
+    3cc0:	52                   	push   %edx
+    3cc1:	50                   	push   %eax
+    3cc2:	53                   	push   %ebx
+    3cc3:	e8 65 03 00 00       	call   402d <write>
+    ob[fd].n = 0;
+    3cc8:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+    3ccf:	83 c4 10             	add    $0x10,%esp
+    3cd2:	eb bf                	jmp    3c93 <close+0x23>
+    3cd4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3cdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3cdf:	90                   	nop
+
+00003ce0 <strcpy>:
+{
+    3ce0:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+    3ce1:	31 c0                	xor    %eax,%eax
+{
+    3ce3:	89 e5                	mov    %esp,%ebp
+    3ce5:	53                   	push   %ebx
+    3ce6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    3ce9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    3cec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    3cf0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    3cf4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    3cf7:	83 c0 01             	add    $0x1,%eax
+    3cfa:	84 d2                	test   %dl,%dl
+    3cfc:	75 f2                	jne    3cf0 <strcpy+0x10>
+}
+    3cfe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3d01:	89 c8                	mov    %ecx,%eax
+    3d03:	c9                   	leave
+    3d04:	c3                   	ret
+    3d05:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3d0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003d10 <strcmp>:
+{
+    3d10:	55                   	push   %ebp
+    3d11:	89 e5                	mov    %esp,%ebp
+    3d13:	53                   	push   %ebx
+    3d14:	8b 55 08             	mov    0x8(%ebp),%edx
+    3d17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    3d1a:	0f b6 02             	movzbl (%edx),%eax
+    3d1d:	84 c0                	test   %al,%al
+    3d1f:	75 17                	jne    3d38 <strcmp+0x28>
+    3d21:	eb 3a                	jmp    3d5d <strcmp+0x4d>
+    3d23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3d27:	90                   	nop
+    3d28:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    3d2c:	83 c2 01             	add    $0x1,%edx
+    3d2f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    3d32:	84 c0                	test   %al,%al
+    3d34:	74 1a                	je     3d50 <strcmp+0x40>
+    p++, q++;
+    3d36:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    3d38:	0f b6 19             	movzbl (%ecx),%ebx
+    3d3b:	38 c3                	cmp    %al,%bl
+    3d3d:	74 e9                	je     3d28 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    3d3f:	29 d8                	sub    %ebx,%eax
+}
+    3d41:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3d44:	c9                   	leave
+    3d45:	c3                   	ret
+    3d46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3d4d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    3d50:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    3d54:	31 c0                	xor    %eax,%eax
+    3d56:	29 d8                	sub    %ebx,%eax
+}
+    3d58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3d5b:	c9                   	leave
+    3d5c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    3d5d:	0f b6 19             	movzbl (%ecx),%ebx
+    3d60:	31 c0                	xor    %eax,%eax
+    3d62:	eb db                	jmp    3d3f <strcmp+0x2f>
+    3d64:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3d6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3d6f:	90                   	nop
+
+00003d70 <strlen>:
+{
+    3d70:	55                   	push   %ebp
+    3d71:	89 e5                	mov    %esp,%ebp
+    3d73:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+    3d76:	80 3a 00             	cmpb   $0x0,(%edx)
+    3d79:	74 15                	je     3d90 <strlen+0x20>
+    3d7b:	31 c0                	xor    %eax,%eax
+    3d7d:	8d 76 00             	lea    0x0(%esi),%esi
+    3d80:	83 c0 01             	add    $0x1,%eax
+    3d83:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    3d87:	89 c1                	mov    %eax,%ecx
+    3d89:	75 f5                	jne    3d80 <strlen+0x10>
+}
+    3d8b:	89 c8                	mov    %ecx,%eax
+    3d8d:	5d                   	pop    %ebp
+    3d8e:	c3                   	ret
+    3d8f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    3d90:	31 c9                	xor    %ecx,%ecx
+}
+    3d92:	5d                   	pop    %ebp
+    3d93:	89 c8                	mov    %ecx,%eax
+    3d95:	c3                   	ret
+    3d96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3d9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003da0 <memset>:
+{
+    3da0:	55                   	push   %ebp
+    3da1:	89 e5                	mov    %esp,%ebp
+    3da3:	57                   	push   %edi
+    3da4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    3da7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    3daa:	8b 45 0c             	mov    0xc(%ebp),%eax
+    3dad:	89 d7                	mov    %edx,%edi
+    3daf:	fc                   	cld
+    3db0:	f3 aa                	rep stos %al,%es:(%edi)
+}
+    3db2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    3db5:	89 d0                	mov    %edx,%eax
+    3db7:	c9                   	leave
+    3db8:	c3                   	ret
+    3db9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003dc0 <strchr>:
+{
+    3dc0:	55                   	push   %ebp
+    3dc1:	89 e5                	mov    %esp,%ebp
+    3dc3:	8b 45 08             	mov    0x8(%ebp),%eax
+    3dc6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    3dca:	0f b6 10             	movzbl (%eax),%edx
+    3dcd:	84 d2                	test   %dl,%dl
+    3dcf:	75 12                	jne    3de3 <strchr+0x23>
+    3dd1:	eb 1d                	jmp    3df0 <strchr+0x30>
+    3dd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3dd7:	90                   	nop
+    3dd8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    3ddc:	83 c0 01             	add    $0x1,%eax
+    3ddf:	84 d2                	test   %dl,%dl
+    3de1:	74 0d                	je     3df0 <strchr+0x30>
+    if(*s == c)
+    3de3:	38 d1                	cmp    %dl,%cl
+    3de5:	75 f1                	jne    3dd8 <strchr+0x18>
+}
+    3de7:	5d                   	pop    %ebp
+    3de8:	c3                   	ret
+    3de9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    3df0:	31 c0                	xor    %eax,%eax
+}
+    3df2:	5d                   	pop    %ebp
+    3df3:	c3                   	ret
+    3df4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3dfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3dff:	90                   	nop
+
+00003e00 <memchr>:
+{
+    3e00:	55                   	push   %ebp
+    3e01:	89 e5                	mov    %esp,%ebp
+    3e03:	8b 55 10             	mov    0x10(%ebp),%edx
+    3e06:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+    3e09:	85 d2                	test   %edx,%edx
+    3e0b:	74 1b                	je     3e28 <memchr+0x28>
+    if(*p == (char)c)
+    3e0d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+    3e11:	01 c2                	add    %eax,%edx
+    3e13:	eb 0a                	jmp    3e1f <memchr+0x1f>
+    3e15:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+    3e18:	83 c0 01             	add    $0x1,%eax
+    3e1b:	39 c2                	cmp    %eax,%edx
+    3e1d:	74 09                	je     3e28 <memchr+0x28>
+    if(*p == (char)c)
+    3e1f:	38 08                	cmp    %cl,(%eax)
+    3e21:	75 f5                	jne    3e18 <memchr+0x18>
+}
+    3e23:	5d                   	pop    %ebp
+    3e24:	c3                   	ret
+    3e25:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+    3e28:	31 c0                	xor    %eax,%eax
+}
+    3e2a:	5d                   	pop    %ebp
+    3e2b:	c3                   	ret
+    3e2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003e30 <gets>:
+{
+    3e30:	55                   	push   %ebp
+    3e31:	89 e5                	mov    %esp,%ebp
+    3e33:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+    3e34:	31 ff                	xor    %edi,%edi
+{
+    3e36:	56                   	push   %esi
+    3e37:	be 48 b3 00 00       	mov    $0xb348,%esi
+    3e3c:	53                   	push   %ebx
+    3e3d:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+    3e40:	8b 46 fc             	mov    -0x4(%esi),%eax
+    3e43:	85 c0                	test   %eax,%eax
+    3e45:	7e 15                	jle    3e5c <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+    3e47:	83 ec 04             	sub    $0x4,%esp
+    3e4a:	50                   	push   %eax
+    3e4b:	56                   	push   %esi
+    3e4c:	57                   	push   %edi
+    3e4d:	e8 db 01 00 00       	call   402d <write>
+    ob[fd].n = 0;
+    3e52:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+    3e59:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+    3e5c:	83 c7 01             	add    $0x1,%edi
+    3e5f:	81 c6 08 01 00 00    	add    $0x108,%esi
+    3e65:	83 ff 10             	cmp    $0x10,%edi
+    3e68:	75 d6                	jne    3e40 <gets+0x10>
+  for(i=0; i+1 < max; ){
+    3e6a:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+    3e6c:	8d 75 e7             	lea    -0x19(%ebp),%esi
+    3e6f:	eb 2e                	jmp    3e9f <gets+0x6f>
+    3e71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3e78:	83 ec 04             	sub    $0x4,%esp
+    3e7b:	6a 01                	push   $0x1
+    3e7d:	56                   	push   %esi
+    3e7e:	6a 00                	push   $0x0
+    3e80:	e8 a1 01 00 00       	call   4026 <read>
+    if(cc < 1)
+    3e85:	83 c4 10             	add    $0x10,%esp
+    3e88:	85 c0                	test   %eax,%eax
+    3e8a:	7e 1d                	jle    3ea9 <gets+0x79>
+    buf[i++] = c;
+    3e8c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    3e90:	8b 55 08             	mov    0x8(%ebp),%edx
+    3e93:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    3e97:	3c 0a                	cmp    $0xa,%al
+    3e99:	74 10                	je     3eab <gets+0x7b>
+    3e9b:	3c 0d                	cmp    $0xd,%al
+    3e9d:	74 0c                	je     3eab <gets+0x7b>
+  for(i=0; i+1 < max; ){
+    3e9f:	89 df                	mov    %ebx,%edi
+    3ea1:	83 c3 01             	add    $0x1,%ebx
+    3ea4:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    3ea7:	7c cf                	jl     3e78 <gets+0x48>
+    3ea9:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+    3eab:	8b 45 08             	mov    0x8(%ebp),%eax
+    3eae:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+    3eb2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3eb5:	5b                   	pop    %ebx
+    3eb6:	5e                   	pop    %esi
+    3eb7:	5f                   	pop    %edi
+    3eb8:	5d                   	pop    %ebp
+    3eb9:	c3                   	ret
+    3eba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003ec0 <stat>:
+{
+    3ec0:	55                   	push   %ebp
+    3ec1:	89 e5                	mov    %esp,%ebp
+    3ec3:	57                   	push   %edi
+    3ec4:	56                   	push   %esi
+    3ec5:	53                   	push   %ebx
+    3ec6:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+    3ec9:	6a 00                	push   $0x0
+    3ecb:	ff 75 08             	push   0x8(%ebp)
+    3ece:	e8 76 01 00 00       	call   4049 <open>
+  if(fd < 0)
+    3ed3:	83 c4 10             	add    $0x10,%esp
+    3ed6:	85 c0                	test   %eax,%eax
+    3ed8:	78 76                	js     3f50 <stat+0x90>
+  r = fstat(fd, st);
+    3eda:	83 ec 08             	sub    $0x8,%esp
+    3edd:	ff 75 0c             	push   0xc(%ebp)
+    3ee0:	89 c3                	mov    %eax,%ebx
+    3ee2:	50                   	push   %eax
+    3ee3:	e8 7f 01 00 00       	call   4067 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+    3ee8:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+    3eeb:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+    3eed:	83 fb 0f             	cmp    $0xf,%ebx
+    3ef0:	7f 40                	jg     3f32 <stat+0x72>
+    3ef2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+    3ef8:	8b 90 44 b3 00 00    	mov    0xb344(%eax),%edx
+    3efe:	8d b8 40 b3 00 00    	lea    0xb340(%eax),%edi
+    3f04:	85 d2                	test   %edx,%edx
+    3f06:	7e 1a                	jle    3f22 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+    3f08:	83 ec 04             	sub    $0x4,%esp
+    3f0b:	05 48 b3 00 00       	add    $0xb348,%eax
+    3f10:	52                   	push   %edx
+    3f11:	50                   	push   %eax
+    3f12:	53                   	push   %ebx
+    3f13:	e8 15 01 00 00       	call   402d <write>
+    ob[fd].n = 0;
+    3f18:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+    3f1f:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+    3f22:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+    3f28:	c7 80 40 b3 00 00 00 	movl   $0x0,0xb340(%eax)
+    3f2f:	00 00 00 
+  return _close(fd);
+    3f32:	83 ec 0c             	sub    $0xc,%esp
+    3f35:	53                   	push   %ebx
+    3f36:	e8 f9 00 00 00       	call   4034 <_close>
+    3f3b:	83 c4 10             	add    $0x10,%esp
+}
+    3f3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3f41:	89 f0                	mov    %esi,%eax
+    3f43:	5b                   	pop    %ebx
+    3f44:	5e                   	pop    %esi
+    3f45:	5f                   	pop    %edi
+    3f46:	5d                   	pop    %ebp
+    3f47:	c3                   	ret
+    3f48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3f4f:	90                   	nop
+    return -1;
+    3f50:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    3f55:	eb e7                	jmp    3f3e <stat+0x7e>
+    3f57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3f5e:	66 90                	xchg   %ax,%ax
+
+00003f60 <atoi>:
+{
+    3f60:	55                   	push   %ebp
+    3f61:	89 e5                	mov    %esp,%ebp
+    3f63:	53                   	push   %ebx
+    3f64:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+    3f67:	0f be 02             	movsbl (%edx),%eax
+    3f6a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    3f6d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    3f70:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    3f75:	77 1e                	ja     3f95 <atoi+0x35>
+    3f77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3f7e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    3f80:	83 c2 01             	add    $0x1,%edx
+    3f83:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    3f86:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    3f8a:	0f be 02             	movsbl (%edx),%eax
+    3f8d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    3f90:	80 fb 09             	cmp    $0x9,%bl
+    3f93:	76 eb                	jbe    3f80 <atoi+0x20>
+}
+    3f95:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3f98:	89 c8                	mov    %ecx,%eax
+    3f9a:	c9                   	leave
+    3f9b:	c3                   	ret
+    3f9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003fa0 <memmove>:
+{
+    3fa0:	55                   	push   %ebp
+    3fa1:	89 e5                	mov    %esp,%ebp
+    3fa3:	57                   	push   %edi
+    3fa4:	56                   	push   %esi
+    3fa5:	8b 45 10             	mov    0x10(%ebp),%eax
+    3fa8:	8b 55 08             	mov    0x8(%ebp),%edx
+    3fab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+    3fae:	85 c0                	test   %eax,%eax
+    3fb0:	7e 13                	jle    3fc5 <memmove+0x25>
+    3fb2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    3fb4:	89 d7                	mov    %edx,%edi
+    3fb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3fbd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    3fc0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    3fc1:	39 f8                	cmp    %edi,%eax
+    3fc3:	75 fb                	jne    3fc0 <memmove+0x20>
+  return vdst;
+}
+    3fc5:	5e                   	pop    %esi
+    3fc6:	89 d0                	mov    %edx,%eax
+    3fc8:	5f                   	pop    %edi
+    3fc9:	5d                   	pop    %ebp
+    3fca:	c3                   	ret
+
+00003fcb <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+    3fcb:	83 3d 9c 6b 00 00 00 	cmpl   $0x0,0x6b9c
+  jle 1f
+    3fd2:	7e 0a                	jle    3fde <syscallentry+0x13>
+  movl %esp, %ecx
+    3fd4:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+    3fd6:	ba dd 3f 00 00       	mov    $0x3fdd,%edx
+  sysenter
+    3fdb:	0f 34                	sysenter
+2:
+  ret
+    3fdd:	c3                   	ret
+1:
+  jl 3f
+    3fde:	7c 27                	jl     4007 <syscallentry+0x3c>
+  pushal
+    3fe0:	60                   	pusha
+  movl $1, %eax
+    3fe1:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+    3fe6:	0f a2                	cpuid
+  movl $-1, sysentermode
+    3fe8:	c7 05 9c 6b 00 00 ff 	movl   $0xffffffff,0x6b9c
+    3fef:	ff ff ff 
+  testl $CPUID_SEP, %edx
+    3ff2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+    3ff8:	74 0a                	je     4004 <syscallentry+0x39>
+  movl $1, sysentermode
+    3ffa:	c7 05 9c 6b 00 00 01 	movl   $0x1,0x6b9c
+    4001:	00 00 00 
+4:
+  popal
+    4004:	61                   	popa
+  jmp syscallentry
+    4005:	eb c4                	jmp    3fcb <syscallentry>
+3:
+  int $T_SYSCALL
+    4007:	cd 40                	int    $0x40
+  ret
+    4009:	c3                   	ret
+
+0000400a <_fork>:
+
+SYSCALLAS(_fork, fork)
+    400a:	b8 01 00 00 00       	mov    $0x1,%eax
+    400f:	eb ba                	jmp    3fcb <syscallentry>
+
+00004011 <_exit>:
+SYSCALLAS(_exit, exit)
+    4011:	b8 02 00 00 00       	mov    $0x2,%eax
+    4016:	eb b3                	jmp    3fcb <syscallentry>
+
+00004018 <wait>:
+SYSCALL(wait)
+    4018:	b8 03 00 00 00       	mov    $0x3,%eax
+    401d:	eb ac                	jmp    3fcb <syscallentry>
+
+0000401f <pipe>:
+SYSCALL(pipe)
+    401f:	b8 04 00 00 00       	mov    $0x4,%eax
+    4024:	eb a5                	jmp    3fcb <syscallentry>
+
+00004026 <read>:
+SYSCALL(read)
+    4026:	b8 05 00 00 00       	mov    $0x5,%eax
+    402b:	eb 9e                	jmp    3fcb <syscallentry>
+
+0000402d <write>:
+SYSCALL(write)
+    402d:	b8 10 00 00 00       	mov    $0x10,%eax
+    4032:	eb 97                	jmp    3fcb <syscallentry>
+
+00004034 <_close>:
+SYSCALLAS(_close, close)
+    4034:	b8 15 00 00 00       	mov    $0x15,%eax
+    4039:	eb 90                	jmp    3fcb <syscallentry>
+
+0000403b <kill>:
+SYSCALL(kill)
+    403b:	b8 06 00 00 00       	mov    $0x6,%eax
+    4040:	eb 89                	jmp    3fcb <syscallentry>
+
+00004042 <_exec>:
+SYSCALLAS(_exec, exec)
+    4042:	b8 07 00 00 00       	mov    $0x7,%eax
+    4047:	eb 82                	jmp    3fcb <syscallentry>
+
+00004049 <open>:
+SYSCALL(open)
+    4049:	b8 0f 00 00 00       	mov    $0xf,%eax
+    404e:	e9 78 ff ff ff       	jmp    3fcb <syscallentry>
+
+00004053 <mknod>:
+SYSCALL(mknod)
+    4053:	b8 11 00 00 00       	mov    $0x11,%eax
+    4058:	e9 6e ff ff ff       	jmp    3fcb <syscallentry>
+
+0000405d <unlink>:
+SYSCALL(unlink)
+    405d:	b8 12 00 00 00       	mov    $0x12,%eax
+    4062:	e9 64 ff ff ff       	jmp    3fcb <syscallentry>
+
+00004067 <fstat>:
+SYSCALL(fstat)
+    4067:	b8 08 00 00 00       	mov    $0x8,%eax
+    406c:	e9 5a ff ff ff       	jmp    3fcb <syscallentry>
+
+00004071 <link>:
+SYSCALL(link)
+    4071:	b8 13 00 00 00       	mov    $0x13,%eax
+    4076:	e9 50 ff ff ff       	jmp    3fcb <syscallentry>
+
+0000407b <mkdir>:
+SYSCALL(mkdir)
+    407b:	b8 14 00 00 00       	mov    $0x14,%eax
+    4080:	e9 46 ff ff ff       	jmp    3fcb <syscallentry>
+
+00004085 <chdir>:
+SYSCALL(chdir)
+    4085:	b8 09 00 00 00       	mov    $0x9,%eax
+    408a:	e9 3c ff ff ff       	jmp    3fcb <syscallentry>
+
+0000408f <dup>:
+SYSCALL(dup)
+    408f:	b8 0a 00 00 00       	mov    $0xa,%eax
+    4094:	e9 32 ff ff ff       	jmp    3fcb <syscallentry>
+
+00004099 <getpid>:
+SYSCALL(getpid)
+    4099:	b8 0b 00 00 00       	mov    $0xb,%eax
+    409e:	e9 28 ff ff ff       	jmp    3fcb <syscallentry>
+
+000040a3 <sbrk>:
+SYSCALL(sbrk)
+    40a3:	b8 0c 00 00 00       	mov    $0xc,%eax
+    40a8:	e9 1e ff ff ff       	jmp    3fcb <syscallentry>
+
+000040ad <sleep>:
+SYSCALL(sleep)
+    40ad:	b8 0d 00 00 00       	mov    $0xd,%eax
+    40b2:	e9 14 ff ff ff       	jmp    3fcb <syscallentry>
+
+000040b7 <uptime>:
+SYSCALL(uptime)
+    40b7:	b8 0e 00 00 00       	mov    $0xe,%eax
+    40bc:	e9 0a ff ff ff       	jmp    3fcb <syscallentry>
+
+000040c1 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+    40c1:	b8 16 00 00 00       	mov    $0x16,%eax
+    40c6:	e9 00 ff ff ff       	jmp    3fcb <syscallentry>
+
+000040cb <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+    40cb:	b8 17 00 00 00       	mov    $0x17,%eax
+    40d0:	e9 f6 fe ff ff       	jmp    3fcb <syscallentry>
+
+000040d5 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+    40d5:	b8 18 00 00 00       	mov    $0x18,%eax
+    40da:	e9 ec fe ff ff       	jmp    3fcb <syscallentry>
+
+000040df <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+    40df:	b8 19 00 00 00       	mov    $0x19,%eax
+    40e4:	e9 e2 fe ff ff       	jmp    3fcb <syscallentry>
+
+000040e9 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+    40e9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    40ee:	e9 d8 fe ff ff       	jmp    3fcb <syscallentry>
+
+000040f3 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+    40f3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    40f8:	e9 ce fe ff ff       	jmp    3fcb <syscallentry>
+
+000040fd <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+    40fd:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    4102:	e9 c4 fe ff ff       	jmp    3fcb <syscallentry>
+
+00004107 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+    4107:	b8 20 00 00 00       	mov    $0x20,%eax
+    410c:	e9 ba fe ff ff       	jmp    3fcb <syscallentry>
+
+00004111 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+    4111:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    4116:	e9 b0 fe ff ff       	jmp    3fcb <syscallentry>
+
+0000411b <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+    411b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    4120:	e9 a6 fe ff ff       	jmp    3fcb <syscallentry>
+
+00004125 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+    4125:	b8 21 00 00 00       	mov    $0x21,%eax
+    412a:	e9 9c fe ff ff       	jmp    3fcb <syscallentry>
+
+0000412f <yield>:
+SYSCALL(yield) // yield the CPU to another process
+    412f:	b8 22 00 00 00       	mov    $0x22,%eax
+    4134:	e9 92 fe ff ff       	jmp    3fcb <syscallentry>
+
+00004139 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+    4139:	b8 23 00 00 00       	mov    $0x23,%eax
+    413e:	e9 88 fe ff ff       	jmp    3fcb <syscallentry>
+
+00004143 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+    4143:	b8 24 00 00 00       	mov    $0x24,%eax
+    4148:	e9 7e fe ff ff       	jmp    3fcb <syscallentry>
+
+0000414d <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+    414d:	b8 25 00 00 00       	mov    $0x25,%eax
+    4152:	e9 74 fe ff ff       	jmp    3fcb <syscallentry>
+
+00004157 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+    4157:	b8 26 00 00 00       	mov    $0x26,%eax
+    415c:	e9 6a fe ff ff       	jmp    3fcb <syscallentry>
+
+00004161 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+    4161:	b8 27 00 00 00       	mov    $0x27,%eax
+    4166:	e9 60 fe ff ff       	jmp    3fcb <syscallentry>
+
+0000416b <mmap>:
+SYSCALL(mmap) // map a file into memory
+    416b:	b8 28 00 00 00       	mov    $0x28,%eax
+    4170:	e9 56 fe ff ff       	jmp    3fcb <syscallentry>
+
+00004175 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+    4175:	b8 29 00 00 00       	mov    $0x29,%eax
+    417a:	e9 4c fe ff ff       	jmp    3fcb <syscallentry>
+
+0000417f <readv>:
+SYSCALL(readv) // read into several buffers
+    417f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    4184:	e9 42 fe ff ff       	jmp    3fcb <syscallentry>
+
+00004189 <writev>:
+SYSCALL(writev) // write from several buffers
+    4189:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    418e:	e9 38 fe ff ff       	jmp    3fcb <syscallentry>
+
+00004193 <pread>:
+SYSCALL(pread) // read at an offset
+    4193:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    4198:	e9 2e fe ff ff       	jmp    3fcb <syscallentry>
+
+0000419d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+    419d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    41a2:	e9 24 fe ff ff       	jmp    3fcb <syscallentry>
+
+000041a7 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+    41a7:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    41ac:	e9 1a fe ff ff       	jmp    3fcb <syscallentry>
+
+000041b1 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+    41b1:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    41b6:	e9 10 fe ff ff       	jmp    3fcb <syscallentry>
+
+000041bb <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+    41bb:	b8 30 00 00 00       	mov    $0x30,%eax
+    41c0:	e9 06 fe ff ff       	jmp    3fcb <syscallentry>
+
+000041c5 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+    41c5:	b8 31 00 00 00       	mov    $0x31,%eax
+    41ca:	e9 fc fd ff ff       	jmp    3fcb <syscallentry>
+
+000041cf <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+    41cf:	b8 32 00 00 00       	mov    $0x32,%eax
+    41d4:	e9 f2 fd ff ff       	jmp    3fcb <syscallentry>
+
+000041d9 <profread>:
+SYSCALL(profread) // drain profiler samples
+    41d9:	b8 33 00 00 00       	mov    $0x33,%eax
+    41de:	e9 e8 fd ff ff       	jmp    3fcb <syscallentry>
+
+000041e3 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+    41e3:	b8 34 00 00 00       	mov    $0x34,%eax
+    41e8:	e9 de fd ff ff       	jmp    3fcb <syscallentry>
+
+000041ed <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+    41ed:	b8 35 00 00 00       	mov    $0x35,%eax
+    41f2:	e9 d4 fd ff ff       	jmp    3fcb <syscallentry>
+
+000041f7 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+    41f7:	b8 36 00 00 00       	mov    $0x36,%eax
+    41fc:	e9 ca fd ff ff       	jmp    3fcb <syscallentry>
+
+00004201 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+    4201:	b8 37 00 00 00       	mov    $0x37,%eax
+    4206:	e9 c0 fd ff ff       	jmp    3fcb <syscallentry>
+    420b:	66 90                	xchg   %ax,%ax
+    420d:	66 90                	xchg   %ax,%ax
+    420f:	90                   	nop
+
+00004210 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    4210:	55                   	push   %ebp
+    4211:	89 e5                	mov    %esp,%ebp
+    4213:	57                   	push   %edi
+    4214:	56                   	push   %esi
+    4215:	53                   	push   %ebx
+    4216:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    4218:	89 d1                	mov    %edx,%ecx
+{
+    421a:	83 ec 3c             	sub    $0x3c,%esp
+    421d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    4220:	85 d2                	test   %edx,%edx
+    4222:	0f 89 80 00 00 00    	jns    42a8 <printint+0x98>
+    4228:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    422c:	74 7a                	je     42a8 <printint+0x98>
+    x = -xx;
+    422e:	f7 d9                	neg    %ecx
+    neg = 1;
+    4230:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    4235:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    4238:	31 f6                	xor    %esi,%esi
+    423a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    4240:	89 c8                	mov    %ecx,%eax
+    4242:	31 d2                	xor    %edx,%edx
+    4244:	89 f7                	mov    %esi,%edi
+    4246:	f7 f3                	div    %ebx
+    4248:	8d 76 01             	lea    0x1(%esi),%esi
+    424b:	0f b6 92 84 60 00 00 	movzbl 0x6084(%edx),%edx
+    4252:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    4256:	89 ca                	mov    %ecx,%edx
+    4258:	89 c1                	mov    %eax,%ecx
+    425a:	39 da                	cmp    %ebx,%edx
+    425c:	73 e2                	jae    4240 <printint+0x30>
+  if(neg)
+    425e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    4261:	85 c0                	test   %eax,%eax
+    4263:	74 07                	je     426c <printint+0x5c>
+    buf[i++] = '-';
+    4265:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    426a:	89 f7                	mov    %esi,%edi
+    426c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    426f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    4272:	01 df                	add    %ebx,%edi
+    4274:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    4278:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+    427b:	83 ec 04             	sub    $0x4,%esp
+    427e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    4281:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    4284:	6a 01                	push   $0x1
+    4286:	50                   	push   %eax
+    4287:	56                   	push   %esi
+    4288:	e8 e3 f6 ff ff       	call   3970 <bufwrite>
+  while(--i >= 0)
+    428d:	89 f8                	mov    %edi,%eax
+    428f:	83 c4 10             	add    $0x10,%esp
+    4292:	83 ef 01             	sub    $0x1,%edi
+    4295:	39 d8                	cmp    %ebx,%eax
+    4297:	75 df                	jne    4278 <printint+0x68>
+}
+    4299:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    429c:	5b                   	pop    %ebx
+    429d:	5e                   	pop    %esi
+    429e:	5f                   	pop    %edi
+    429f:	5d                   	pop    %ebp
+    42a0:	c3                   	ret
+    42a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    42a8:	31 c0                	xor    %eax,%eax
+    42aa:	eb 89                	jmp    4235 <printint+0x25>
+    42ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000042b0 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    42b0:	55                   	push   %ebp
+    42b1:	89 e5                	mov    %esp,%ebp
+    42b3:	57                   	push   %edi
+    42b4:	56                   	push   %esi
+    42b5:	53                   	push   %ebx
+    42b6:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    42b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+    42bc:	0f b6 18             	movzbl (%eax),%ebx
+    42bf:	84 db                	test   %bl,%bl
+    42c1:	74 6c                	je     432f <printf+0x7f>
+    42c3:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+    42c6:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+    42c9:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+    42cb:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    42ce:	eb 26                	jmp    42f6 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    42d0:	83 f8 25             	cmp    $0x25,%eax
+    42d3:	74 4b                	je     4320 <printf+0x70>
+  bufwrite(fd, &c, 1);
+    42d5:	83 ec 04             	sub    $0x4,%esp
+    42d8:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    42db:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+    42de:	6a 01                	push   $0x1
+    42e0:	50                   	push   %eax
+    42e1:	ff 75 08             	push   0x8(%ebp)
+    42e4:	e8 87 f6 ff ff       	call   3970 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+    42e9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    42ec:	0f b6 1f             	movzbl (%edi),%ebx
+    42ef:	83 c7 01             	add    $0x1,%edi
+    42f2:	84 db                	test   %bl,%bl
+    42f4:	74 39                	je     432f <printf+0x7f>
+    c = fmt[i] & 0xff;
+    42f6:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    42f9:	85 f6                	test   %esi,%esi
+    42fb:	74 d3                	je     42d0 <printf+0x20>
+      }
+    } else if(state == '%'){
+    42fd:	83 fe 25             	cmp    $0x25,%esi
+    4300:	75 ea                	jne    42ec <printf+0x3c>
+      if(c == 'd'){
+    4302:	83 f8 25             	cmp    $0x25,%eax
+    4305:	0f 84 d5 01 00 00    	je     44e0 <printf+0x230>
+    430b:	83 e8 63             	sub    $0x63,%eax
+    430e:	83 f8 15             	cmp    $0x15,%eax
+    4311:	77 45                	ja     4358 <printf+0xa8>
+    4313:	ff 24 85 2c 60 00 00 	jmp    *0x602c(,%eax,4)
+    431a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+    4320:	0f b6 1f             	movzbl (%edi),%ebx
+    4323:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+    4326:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    432b:	84 db                	test   %bl,%bl
+    432d:	75 c7                	jne    42f6 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+    432f:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+    4333:	74 0b                	je     4340 <printf+0x90>
+    fflush(fd);
+}
+    4335:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4338:	5b                   	pop    %ebx
+    4339:	5e                   	pop    %esi
+    433a:	5f                   	pop    %edi
+    433b:	5d                   	pop    %ebp
+    433c:	c3                   	ret
+    433d:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+    4340:	83 ec 0c             	sub    $0xc,%esp
+    4343:	6a 02                	push   $0x2
+    4345:	e8 c6 f7 ff ff       	call   3b10 <fflush>
+    434a:	83 c4 10             	add    $0x10,%esp
+}
+    434d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4350:	5b                   	pop    %ebx
+    4351:	5e                   	pop    %esi
+    4352:	5f                   	pop    %edi
+    4353:	5d                   	pop    %ebp
+    4354:	c3                   	ret
+    4355:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+    4358:	83 ec 04             	sub    $0x4,%esp
+    435b:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+    435e:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+    4362:	6a 01                	push   $0x1
+    4364:	52                   	push   %edx
+    4365:	89 55 c0             	mov    %edx,-0x40(%ebp)
+    4368:	ff 75 08             	push   0x8(%ebp)
+    436b:	e8 00 f6 ff ff       	call   3970 <bufwrite>
+    4370:	83 c4 0c             	add    $0xc,%esp
+    4373:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+    4376:	6a 01                	push   $0x1
+    4378:	8b 55 c0             	mov    -0x40(%ebp),%edx
+    437b:	52                   	push   %edx
+      state = 0;
+    437c:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+    437e:	ff 75 08             	push   0x8(%ebp)
+    4381:	e8 ea f5 ff ff       	call   3970 <bufwrite>
+        putc(fd, c);
+    4386:	83 c4 10             	add    $0x10,%esp
+    4389:	e9 5e ff ff ff       	jmp    42ec <printf+0x3c>
+    438e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+    4390:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+    4393:	83 ec 0c             	sub    $0xc,%esp
+    4396:	b9 10 00 00 00       	mov    $0x10,%ecx
+    439b:	8b 16                	mov    (%esi),%edx
+    439d:	6a 00                	push   $0x0
+    439f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+    43a2:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+    43a5:	e8 66 fe ff ff       	call   4210 <printint>
+        ap++;
+    43aa:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+    43ad:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    43b0:	31 f6                	xor    %esi,%esi
+    43b2:	e9 35 ff ff ff       	jmp    42ec <printf+0x3c>
+    43b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    43be:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+    43c0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    43c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    43c5:	83 c0 04             	add    $0x4,%eax
+    43c8:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+    43cb:	b8 22 60 00 00       	mov    $0x6022,%eax
+    43d0:	85 db                	test   %ebx,%ebx
+    43d2:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+    43d5:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+    43d8:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+    43da:	53                   	push   %ebx
+    43db:	e8 90 f9 ff ff       	call   3d70 <strlen>
+    43e0:	83 c4 0c             	add    $0xc,%esp
+    43e3:	50                   	push   %eax
+    43e4:	53                   	push   %ebx
+    43e5:	ff 75 08             	push   0x8(%ebp)
+    43e8:	e8 83 f5 ff ff       	call   3970 <bufwrite>
+    43ed:	83 c4 10             	add    $0x10,%esp
+    43f0:	e9 f7 fe ff ff       	jmp    42ec <printf+0x3c>
+    43f5:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+    43f8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+    43fb:	83 ec 04             	sub    $0x4,%esp
+    43fe:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+    4401:	8b 06                	mov    (%esi),%eax
+        ap++;
+    4403:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+    4406:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+    4409:	6a 01                	push   $0x1
+    440b:	52                   	push   %edx
+    440c:	ff 75 08             	push   0x8(%ebp)
+    440f:	e8 5c f5 ff ff       	call   3970 <bufwrite>
+        ap++;
+    4414:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+    4417:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    441a:	31 f6                	xor    %esi,%esi
+    441c:	e9 cb fe ff ff       	jmp    42ec <printf+0x3c>
+    4421:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+    4428:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+    442b:	83 ec 0c             	sub    $0xc,%esp
+    442e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    4433:	8b 16                	mov    (%esi),%edx
+    4435:	6a 01                	push   $0x1
+    4437:	e9 63 ff ff ff       	jmp    439f <printf+0xef>
+    443c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+    4440:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    4443:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+    4446:	89 7d c0             	mov    %edi,-0x40(%ebp)
+    4449:	89 55 bc             	mov    %edx,-0x44(%ebp)
+    444c:	8b 18                	mov    (%eax),%ebx
+    444e:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+    4451:	31 c0                	xor    %eax,%eax
+    4453:	89 c7                	mov    %eax,%edi
+    4455:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+    4458:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+    445d:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+    445f:	f7 e1                	mul    %ecx
+    4461:	c1 ea 03             	shr    $0x3,%edx
+    4464:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    4467:	89 d1                	mov    %edx,%ecx
+    4469:	01 c0                	add    %eax,%eax
+    446b:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+    446d:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+    446f:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+    4471:	be 0a 00 00 00       	mov    $0xa,%esi
+    4476:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+    4478:	89 da                	mov    %ebx,%edx
+    447a:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+    447c:	89 fe                	mov    %edi,%esi
+    447e:	83 c7 01             	add    $0x1,%edi
+    4481:	8d 42 30             	lea    0x30(%edx),%eax
+    4484:	89 da                	mov    %ebx,%edx
+    4486:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    4489:	01 d2                	add    %edx,%edx
+    448b:	29 d0                	sub    %edx,%eax
+    448d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+    4491:	89 c8                	mov    %ecx,%eax
+    4493:	09 d8                	or     %ebx,%eax
+    4495:	75 c1                	jne    4458 <printf+0x1a8>
+    4497:	8b 55 bc             	mov    -0x44(%ebp),%edx
+    449a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    449d:	01 d6                	add    %edx,%esi
+    449f:	89 f7                	mov    %esi,%edi
+    44a1:	89 d6                	mov    %edx,%esi
+    44a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    44a7:	90                   	nop
+    putc(fd, buf[i]);
+    44a8:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+    44ab:	83 ec 04             	sub    $0x4,%esp
+    44ae:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+    44b1:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+    44b4:	6a 01                	push   $0x1
+    44b6:	50                   	push   %eax
+    44b7:	53                   	push   %ebx
+    44b8:	e8 b3 f4 ff ff       	call   3970 <bufwrite>
+  while(--i >= 0)
+    44bd:	89 fa                	mov    %edi,%edx
+    44bf:	83 c4 10             	add    $0x10,%esp
+    44c2:	83 ef 01             	sub    $0x1,%edi
+    44c5:	39 d6                	cmp    %edx,%esi
+    44c7:	75 df                	jne    44a8 <printf+0x1f8>
+        ap += 2;
+    44c9:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+    44cd:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+    44d0:	31 f6                	xor    %esi,%esi
+    44d2:	e9 15 fe ff ff       	jmp    42ec <printf+0x3c>
+    44d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    44de:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+    44e0:	83 ec 04             	sub    $0x4,%esp
+    44e3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+    44e6:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+    44e9:	6a 01                	push   $0x1
+    44eb:	e9 8b fe ff ff       	jmp    437b <printf+0xcb>
+
+000044f0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    44f0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    44f1:	a1 c0 c3 00 00       	mov    0xc3c0,%eax
+{
+    44f6:	89 e5                	mov    %esp,%ebp
+    44f8:	57                   	push   %edi
+    44f9:	56                   	push   %esi
+    44fa:	53                   	push   %ebx
+    44fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    44fe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4501:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4508:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    450a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    450c:	39 ca                	cmp    %ecx,%edx
+    450e:	73 30                	jae    4540 <free+0x50>
+    4510:	39 c1                	cmp    %eax,%ecx
+    4512:	72 04                	jb     4518 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4514:	39 c2                	cmp    %eax,%edx
+    4516:	72 f0                	jb     4508 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    4518:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    451b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    451e:	39 f8                	cmp    %edi,%eax
+    4520:	74 2e                	je     4550 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    4522:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    4525:	8b 42 04             	mov    0x4(%edx),%eax
+    4528:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    452b:	39 f1                	cmp    %esi,%ecx
+    452d:	74 38                	je     4567 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    452f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    4531:	5b                   	pop    %ebx
+  freep = p;
+    4532:	89 15 c0 c3 00 00    	mov    %edx,0xc3c0
+}
+    4538:	5e                   	pop    %esi
+    4539:	5f                   	pop    %edi
+    453a:	5d                   	pop    %ebp
+    453b:	c3                   	ret
+    453c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4540:	39 c1                	cmp    %eax,%ecx
+    4542:	72 d0                	jb     4514 <free+0x24>
+    4544:	eb c2                	jmp    4508 <free+0x18>
+    4546:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    454d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    4550:	03 70 04             	add    0x4(%eax),%esi
+    4553:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    4556:	8b 02                	mov    (%edx),%eax
+    4558:	8b 00                	mov    (%eax),%eax
+    455a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    455d:	8b 42 04             	mov    0x4(%edx),%eax
+    4560:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    4563:	39 f1                	cmp    %esi,%ecx
+    4565:	75 c8                	jne    452f <free+0x3f>
+    p->s.size += bp->s.size;
+    4567:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    456a:	89 15 c0 c3 00 00    	mov    %edx,0xc3c0
+    p->s.size += bp->s.size;
+    4570:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    4573:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    4576:	89 0a                	mov    %ecx,(%edx)
+}
+    4578:	5b                   	pop    %ebx
+    4579:	5e                   	pop    %esi
+    457a:	5f                   	pop    %edi
+    457b:	5d                   	pop    %ebp
+    457c:	c3                   	ret
+    457d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004580 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    4580:	55                   	push   %ebp
+    4581:	89 e5                	mov    %esp,%ebp
+    4583:	57                   	push   %edi
+    4584:	56                   	push   %esi
+    4585:	53                   	push   %ebx
+    4586:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4589:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    458c:	8b 15 c0 c3 00 00    	mov    0xc3c0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4592:	8d 78 07             	lea    0x7(%eax),%edi
+    4595:	c1 ef 03             	shr    $0x3,%edi
+    4598:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    459b:	85 d2                	test   %edx,%edx
+    459d:	0f 84 8d 00 00 00    	je     4630 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    45a3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    45a5:	8b 48 04             	mov    0x4(%eax),%ecx
+    45a8:	39 f9                	cmp    %edi,%ecx
+    45aa:	73 64                	jae    4610 <malloc+0x90>
+  if(nu < 4096)
+    45ac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    45b1:	39 df                	cmp    %ebx,%edi
+    45b3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    45b6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    45bd:	eb 0a                	jmp    45c9 <malloc+0x49>
+    45bf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    45c0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    45c2:	8b 48 04             	mov    0x4(%eax),%ecx
+    45c5:	39 f9                	cmp    %edi,%ecx
+    45c7:	73 47                	jae    4610 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    45c9:	89 c2                	mov    %eax,%edx
+    45cb:	39 05 c0 c3 00 00    	cmp    %eax,0xc3c0
+    45d1:	75 ed                	jne    45c0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    45d3:	83 ec 0c             	sub    $0xc,%esp
+    45d6:	56                   	push   %esi
+    45d7:	e8 c7 fa ff ff       	call   40a3 <sbrk>
+  if(p == (char*)-1)
+    45dc:	83 c4 10             	add    $0x10,%esp
+    45df:	83 f8 ff             	cmp    $0xffffffff,%eax
+    45e2:	74 1c                	je     4600 <malloc+0x80>
+  hp->s.size = nu;
+    45e4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    45e7:	83 ec 0c             	sub    $0xc,%esp
+    45ea:	83 c0 08             	add    $0x8,%eax
+    45ed:	50                   	push   %eax
+    45ee:	e8 fd fe ff ff       	call   44f0 <free>
+  return freep;
+    45f3:	8b 15 c0 c3 00 00    	mov    0xc3c0,%edx
+      if((p = morecore(nunits)) == 0)
+    45f9:	83 c4 10             	add    $0x10,%esp
+    45fc:	85 d2                	test   %edx,%edx
+    45fe:	75 c0                	jne    45c0 <malloc+0x40>
+        return 0;
+  }
+}
+    4600:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    4603:	31 c0                	xor    %eax,%eax
+}
+    4605:	5b                   	pop    %ebx
+    4606:	5e                   	pop    %esi
+    4607:	5f                   	pop    %edi
+    4608:	5d                   	pop    %ebp
+    4609:	c3                   	ret
+    460a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    4610:	39 cf                	cmp    %ecx,%edi
+    4612:	74 4c                	je     4660 <malloc+0xe0>
+        p->s.size -= nunits;
+    4614:	29 f9                	sub    %edi,%ecx
+    4616:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    4619:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    461c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    461f:	89 15 c0 c3 00 00    	mov    %edx,0xc3c0
+}
+    4625:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    4628:	83 c0 08             	add    $0x8,%eax
+}
+    462b:	5b                   	pop    %ebx
+    462c:	5e                   	pop    %esi
+    462d:	5f                   	pop    %edi
+    462e:	5d                   	pop    %ebp
+    462f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    4630:	c7 05 c0 c3 00 00 c4 	movl   $0xc3c4,0xc3c0
+    4637:	c3 00 00 
+    base.s.size = 0;
+    463a:	b8 c4 c3 00 00       	mov    $0xc3c4,%eax
+    base.s.ptr = freep = prevp = &base;
+    463f:	c7 05 c4 c3 00 00 c4 	movl   $0xc3c4,0xc3c4
+    4646:	c3 00 00 
+    base.s.size = 0;
+    4649:	c7 05 c8 c3 00 00 00 	movl   $0x0,0xc3c8
+    4650:	00 00 00 
+    if(p->s.size >= nunits){
+    4653:	e9 54 ff ff ff       	jmp    45ac <malloc+0x2c>
+    4658:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    465f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    4660:	8b 08                	mov    (%eax),%ecx
+    4662:	89 0a                	mov    %ecx,(%edx)
+    4664:	eb b9                	jmp    461f <malloc+0x9f>
+    4666:	66 90                	xchg   %ax,%ax
+    4668:	66 90                	xchg   %ax,%ax
+    466a:	66 90                	xchg   %ax,%ax
+    466c:	66 90                	xchg   %ax,%ax
+    466e:	66 90                	xchg   %ax,%ax
+
+00004670 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+    4670:	55                   	push   %ebp
+    4671:	89 e5                	mov    %esp,%ebp
+    4673:	57                   	push   %edi
+    4674:	56                   	push   %esi
+    4675:	be 01 00 00 00       	mov    $0x1,%esi
+    467a:	53                   	push   %ebx
+    467b:	83 ec 28             	sub    $0x28,%esp
+    467e:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4681:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    4684:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+    4687:	68 00 98 00 00       	push   $0x9800
+    468c:	e8 ef fe ff ff       	call   4580 <malloc>
+    4691:	83 c4 10             	add    $0x10,%esp
+    4694:	89 c7                	mov    %eax,%edi
+    4696:	85 c0                	test   %eax,%eax
+    4698:	74 62                	je     46fc <waitpoll+0x8c>
+    469a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+    46a0:	83 ec 0c             	sub    $0xc,%esp
+    46a3:	6a 01                	push   $0x1
+    46a5:	e8 03 fa ff ff       	call   40ad <sleep>
+    fn();
+    46aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    46ad:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+    46af:	58                   	pop    %eax
+    46b0:	5a                   	pop    %edx
+    46b1:	68 00 02 00 00       	push   $0x200
+    46b6:	57                   	push   %edi
+    46b7:	e8 eb fa ff ff       	call   41a7 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+    46bc:	83 c4 10             	add    $0x10,%esp
+    46bf:	85 c0                	test   %eax,%eax
+    46c1:	7e 2d                	jle    46f0 <waitpoll+0x80>
+    46c3:	6b c0 4c             	imul   $0x4c,%eax,%eax
+    46c6:	89 fa                	mov    %edi,%edx
+    alive = 0;
+    46c8:	31 c9                	xor    %ecx,%ecx
+    46ca:	01 f8                	add    %edi,%eax
+    46cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+    46d0:	3b 1a                	cmp    (%edx),%ebx
+    46d2:	75 07                	jne    46db <waitpoll+0x6b>
+        alive = 1;
+    46d4:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+    46d8:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+    46db:	83 c2 4c             	add    $0x4c,%edx
+    46de:	39 d0                	cmp    %edx,%eax
+    46e0:	75 ee                	jne    46d0 <waitpoll+0x60>
+  } while(alive);
+    46e2:	85 c9                	test   %ecx,%ecx
+    46e4:	75 ba                	jne    46a0 <waitpoll+0x30>
+    46e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    46ed:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+    46f0:	83 ec 0c             	sub    $0xc,%esp
+    46f3:	57                   	push   %edi
+    46f4:	e8 f7 fd ff ff       	call   44f0 <free>
+  wait();
+    46f9:	83 c4 10             	add    $0x10,%esp
+}
+    46fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    46ff:	5b                   	pop    %ebx
+    4700:	5e                   	pop    %esi
+    4701:	5f                   	pop    %edi
+    4702:	5d                   	pop    %ebp
+  wait();
+    4703:	e9 10 f9 ff ff       	jmp    4018 <wait>
+    4708:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    470f:	90                   	nop
+
+00004710 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+    4710:	55                   	push   %ebp
+    4711:	89 e5                	mov    %esp,%ebp
+    4713:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+    4716:	c7 45 f0 95 60 00 00 	movl   $0x6095,-0x10(%ebp)
+    471d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+    4724:	e8 87 f4 ff ff       	call   3bb0 <fork>
+    4729:	85 c0                	test   %eax,%eax
+    472b:	78 09                	js     4736 <runps+0x26>
+    return -1;
+  if(pid == 0){
+    472d:	74 0e                	je     473d <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+    472f:	e8 e4 f8 ff ff       	call   4018 <wait>
+}
+    4734:	c9                   	leave
+    4735:	c3                   	ret
+    4736:	c9                   	leave
+    return -1;
+    4737:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    473c:	c3                   	ret
+    exec("ps", argv);
+    473d:	50                   	push   %eax
+    473e:	50                   	push   %eax
+    473f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    4742:	50                   	push   %eax
+    4743:	68 95 60 00 00       	push   $0x6095
+    4748:	e8 c3 f4 ff ff       	call   3c10 <exec>
+    printf(2, "exec ps failed\n");
+    474d:	5a                   	pop    %edx
+    474e:	59                   	pop    %ecx
+    474f:	68 98 60 00 00       	push   $0x6098
+    4754:	6a 02                	push   $0x2
+    4756:	e8 55 fb ff ff       	call   42b0 <printf>
+    exit();
+    475b:	e8 a0 f4 ff ff       	call   3c00 <exit>
@@ -8,6 +8,10 @@
 #include "traps.h"
 #include "memlayout.h"
 
+// Blocks in writetest1's big file: enough to reach
+// past the single indirect block into the double.
+#define BIGBLOCKS (NDIRECT + NINDIRECT + 2*NINDIRECT)
+
 char buf[8192];
 char name[3];
 char *echoargv[] = { "echo", "ALL", "TESTS", "PASSED", 0 };
@@ -197,7 +201,7 @@ writetest1(void)
     exit();
   }
 
-  for(i = 0; i < MAXFILE; i++){
+  for(i = 0; i < BIGBLOCKS; i++){
     ((int*)buf)[0] = i;
     if(write(fd, buf, 512) != 512){
       printf(stdout, "error: write big file failed\n", i);
@@ -217,7 +221,7 @@ writetest1(void)
   for(;;){
     i = read(fd, buf, 512);
     if(i == 0){
-      if(n == MAXFILE - 1){
+      if(n != BIGBLOCKS){
         printf(stdout, "read only %d blocks from big", n);
         exit();
       }
@@ -1695,6 +1699,79 @@ fsfull()
   printf(1, "fsfull test finished\n");
 }
 
+// Two MAP_SHARED mappings of a file, and a fork()ed child's,
+// see each other's stores. A write() to the file after the page
+// is mapped shows up in the mapping, and is not overwritten when
+// the mapping writes its stores back at munmap().
+void
+mmaptest(void)
+{
+  char *p, *q;
+  int fd, i, pid;
+
+  printf(stdout, "mmap test\n");
+  unlink("mmapfile");
+  fd = open("mmapfile", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(stdout, "mmap: create failed\n");
+    exit();
+  }
+  memset(buf, 'a', 4096);
+  if(write(fd, buf, 4096) != 4096){
+    printf(stdout, "mmap: write failed\n");
+    exit();
+  }
+  p = mmap(fd, 0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED);
+  q = mmap(fd, 0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED);
+  if(p == (char*)-1 || q == (char*)-1){
+    printf(stdout, "mmap: mmap failed\n");
+    exit();
+  }
+
+  p[0] = 'p';
+  if(q[0] != 'p'){
+    printf(stdout, "mmap: store not seen by other mapping\n");
+    exit();
+  }
+  if(pwrite(fd, "w", 1, 100) != 1 || p[100] != 'w'){
+    printf(stdout, "mmap: write() not seen by mapping\n");
+    exit();
+  }
+
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "mmap: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    q[200] = 'c';
+    exit();
+  }
+  wait();
+  if(p[200] != 'c'){
+    printf(stdout, "mmap: child's store not seen by parent\n");
+    exit();
+  }
+
+  if(munmap(p, 4096) < 0 || munmap(q, 4096) < 0){
+    printf(stdout, "mmap: munmap failed\n");
+    exit();
+  }
+  if(pread(fd, buf, 4096, 0) != 4096){
+    printf(stdout, "mmap: read failed\n");
+    exit();
+  }
+  for(i = 0; i < 4096; i++){
+    if(buf[i] != (i == 0 ? 'p' : i == 100 ? 'w' : i == 200 ? 'c' : 'a')){
+      printf(stdout, "mmap: wrong byte %d in file\n", i);
+      exit();
+    }
+  }
+  close(fd);
+  unlink("mmapfile");
+  printf(stdout, "mmap test ok\n");
+}
+
 void
 uio()
 {
@@ -1794,6 +1871,7 @@ main(int argc, char *argv[])
   iref();
   forktest();
   bigdir(); // slow
+  mmaptest();
 
   uio();
 
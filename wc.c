@@ -1,44 +1,66 @@
 #include "types.h"
 #include "stat.h"
 #include "user.h"
+#include "fcntl.h"
 
 char buf[512];
+int l, w, c, inword;
 
+// Count the n bytes at p.
 void
-wc(int fd, char *name)
+count(char *p, int n)
 {
-  int i, n;
-  int l, w, c, inword;
+  int i;
+
+  for(i=0; i<n; i++){
+    c++;
+    if(p[i] == '\n')
+      l++;
+    if(strchr(" \r\t\n\v", p[i]))
+      inword = 0;
+    else if(!inword){
+      w++;
+      inword = 1;
+    }
+  }
+}
+
+void
+wc(int fd, char *name, int usemmap)
+{
+  int n;
+  struct stat st;
+  char *p;
 
   l = w = c = 0;
   inword = 0;
-  while((n = read(fd, buf, sizeof(buf))) > 0){
-    for(i=0; i<n; i++){
-      c++;
-      if(buf[i] == '\n')
-        l++;
-      if(strchr(" \r\t\n\v", buf[i]))
-        inword = 0;
-      else if(!inword){
-        w++;
-        inword = 1;
-      }
+  if(usemmap && fstat(fd, &st) == 0 && st.size > 0 &&
+     (p = mmap(fd, 0, st.size, PROT_READ, MAP_PRIVATE)) != (char*)-1){
+    count(p, st.size);
+    munmap(p, st.size);
+  } else {
+    while((n = read(fd, buf, sizeof(buf))) > 0)
+      count(buf, n);
+    if(n < 0){
+      printf(1, "wc: read error\n");
+      exit();
     }
   }
-  if(n < 0){
-    printf(1, "wc: read error\n");
-    exit();
-  }
   printf(1, "%d %d %d %s\n", l, w, c, name);
 }
 
 int
 main(int argc, char *argv[])
 {
-  int fd, i;
+  int fd, i, usemmap;
 
+  usemmap = argc > 1 && strcmp(argv[1], "-m") == 0;
+  if(usemmap){
+    argc--;
+    argv++;
+  }
   if(argc <= 1){
-    wc(0, "");
+    wc(0, "", 0);
     exit();
   }
 
@@ -47,7 +69,7 @@ main(int argc, char *argv[])
       printf(1, "wc: cannot open %s\n", argv[i]);
       exit();
     }
-    wc(fd, argv[i]);
+    wc(fd, argv[i], usemmap);
     close(fd);
   }
   exit();
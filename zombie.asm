@@ -0,0 +1,1941 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 5a 02 00 00       	call   270 <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 49 07 00 00       	call   76d <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+  exit();
+  27:	e8 94 02 00 00       	call   2c0 <exit>
+  2c:	66 90                	xchg   %ax,%ax
+  2e:	66 90                	xchg   %ax,%ax
+
+00000030 <bufwrite>:
+int _exec(char*, char**);
+
+// Write the n bytes at p to fd through its buffer.
+void
+bufwrite(int fd, const void *p, int n)
+{
+  30:	55                   	push   %ebp
+  31:	89 e5                	mov    %esp,%ebp
+  33:	57                   	push   %edi
+  34:	56                   	push   %esi
+  35:	53                   	push   %ebx
+  36:	83 ec 4c             	sub    $0x4c,%esp
+  39:	8b 45 0c             	mov    0xc(%ebp),%eax
+  3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  3f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  42:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct iovec iov[2];
+  struct stat st;
+
+  if(fd < 0 || fd >= NOBUF){
+  45:	83 fa 0f             	cmp    $0xf,%edx
+  48:	0f 87 32 01 00 00    	ja     180 <bufwrite+0x150>
+    write(fd, p, n);
+    return;
+  }
+  if(ob[fd].mode == UNKNOWN)
+  4e:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+  54:	8b 80 20 13 00 00    	mov    0x1320(%eax),%eax
+  5a:	85 c0                	test   %eax,%eax
+  5c:	0f 84 de 00 00 00    	je     140 <bufwrite+0x110>
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+
+  if(ob[fd].n + n > OBUFSZ){
+  62:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+  68:	8b b0 24 13 00 00    	mov    0x1324(%eax),%esi
+  6e:	8d 88 20 13 00 00    	lea    0x1320(%eax),%ecx
+    // Send the buffer and p together.
+    iov[0].base = ob[fd].buf;
+  74:	8d b8 28 13 00 00    	lea    0x1328(%eax),%edi
+  if(ob[fd].n + n > OBUFSZ){
+  7a:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+  7d:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    iov[0].base = ob[fd].buf;
+  80:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  if(ob[fd].n + n > OBUFSZ){
+  83:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+  89:	0f 8f 01 01 00 00    	jg     190 <bufwrite+0x160>
+    iov[1].len = n;
+    writev(fd, iov, 2);
+    ob[fd].n = 0;
+    return;
+  }
+  memmove(ob[fd].buf + ob[fd].n, p, n);
+  8f:	8d 78 08             	lea    0x8(%eax),%edi
+  92:	8d bc 3e 20 13 00 00 	lea    0x1320(%esi,%edi,1),%edi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+  99:	85 db                	test   %ebx,%ebx
+  9b:	7e 3b                	jle    d8 <bufwrite+0xa8>
+  9d:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+  a0:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  a7:	90                   	nop
+    *dst++ = *src++;
+  a8:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+  a9:	39 c6                	cmp    %eax,%esi
+  ab:	75 fb                	jne    a8 <bufwrite+0x78>
+  ob[fd].n += n;
+  ad:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+  b3:	8b 88 24 13 00 00    	mov    0x1324(%eax),%ecx
+  b9:	01 d9                	add    %ebx,%ecx
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+  bb:	83 b8 20 13 00 00 01 	cmpl   $0x1,0x1320(%eax)
+  ob[fd].n += n;
+  c2:	89 88 24 13 00 00    	mov    %ecx,0x1324(%eax)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+  c8:	74 26                	je     f0 <bufwrite+0xc0>
+}
+  ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  cd:	5b                   	pop    %ebx
+  ce:	5e                   	pop    %esi
+  cf:	5f                   	pop    %edi
+  d0:	5d                   	pop    %ebp
+  d1:	c3                   	ret
+  d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ob[fd].n += n;
+  d8:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+  db:	83 b8 20 13 00 00 01 	cmpl   $0x1,0x1320(%eax)
+  ob[fd].n += n;
+  e2:	89 4f 04             	mov    %ecx,0x4(%edi)
+  if(ob[fd].mode == LINEBUF && memchr(p, '\n', n))
+  e5:	75 e3                	jne    ca <bufwrite+0x9a>
+  for(p = s; n > 0; p++, n--)
+  e7:	85 db                	test   %ebx,%ebx
+  e9:	74 df                	je     ca <bufwrite+0x9a>
+  eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ef:	90                   	nop
+  src = vsrc;
+  f0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+  f3:	01 c3                	add    %eax,%ebx
+  f5:	eb 10                	jmp    107 <bufwrite+0xd7>
+  f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fe:	66 90                	xchg   %ax,%ax
+ 100:	83 c0 01             	add    $0x1,%eax
+ 103:	39 d8                	cmp    %ebx,%eax
+ 105:	74 c3                	je     ca <bufwrite+0x9a>
+    if(*p == (char)c)
+ 107:	80 38 0a             	cmpb   $0xa,(%eax)
+ 10a:	75 f4                	jne    100 <bufwrite+0xd0>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 10c:	85 c9                	test   %ecx,%ecx
+ 10e:	7e ba                	jle    ca <bufwrite+0x9a>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 110:	83 ec 04             	sub    $0x4,%esp
+ 113:	51                   	push   %ecx
+ 114:	ff 75 ac             	push   -0x54(%ebp)
+ 117:	52                   	push   %edx
+ 118:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+ 11b:	e8 cd 05 00 00       	call   6ed <write>
+    ob[fd].n = 0;
+ 120:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+ 123:	83 c4 10             	add    $0x10,%esp
+ 126:	69 d2 08 01 00 00    	imul   $0x108,%edx,%edx
+ 12c:	c7 82 24 13 00 00 00 	movl   $0x0,0x1324(%edx)
+ 133:	00 00 00 
+ 136:	eb 92                	jmp    ca <bufwrite+0x9a>
+ 138:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13f:	90                   	nop
+    ob[fd].mode = fstat(fd, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 140:	83 ec 08             	sub    $0x8,%esp
+ 143:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 146:	50                   	push   %eax
+ 147:	52                   	push   %edx
+ 148:	89 55 b0             	mov    %edx,-0x50(%ebp)
+ 14b:	e8 d7 05 00 00       	call   727 <fstat>
+ 150:	83 c4 10             	add    $0x10,%esp
+ 153:	8b 55 b0             	mov    -0x50(%ebp),%edx
+ 156:	89 c1                	mov    %eax,%ecx
+ 158:	b8 02 00 00 00       	mov    $0x2,%eax
+ 15d:	85 c9                	test   %ecx,%ecx
+ 15f:	75 0d                	jne    16e <bufwrite+0x13e>
+ 161:	31 c0                	xor    %eax,%eax
+ 163:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 168:	0f 95 c0             	setne  %al
+ 16b:	83 c0 01             	add    $0x1,%eax
+ 16e:	69 ca 08 01 00 00    	imul   $0x108,%edx,%ecx
+ 174:	89 81 20 13 00 00    	mov    %eax,0x1320(%ecx)
+ 17a:	e9 e3 fe ff ff       	jmp    62 <bufwrite+0x32>
+ 17f:	90                   	nop
+}
+ 180:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 183:	5b                   	pop    %ebx
+ 184:	5e                   	pop    %esi
+ 185:	5f                   	pop    %edi
+ 186:	5d                   	pop    %ebp
+    write(fd, p, n);
+ 187:	e9 61 05 00 00       	jmp    6ed <write>
+ 18c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iov[1].base = (void*)p;
+ 190:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    writev(fd, iov, 2);
+ 193:	83 ec 04             	sub    $0x4,%esp
+    iov[0].base = ob[fd].buf;
+ 196:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    iov[0].len = ob[fd].n;
+ 199:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    iov[1].base = (void*)p;
+ 19c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    writev(fd, iov, 2);
+ 19f:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    iov[1].len = n;
+ 1a2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    writev(fd, iov, 2);
+ 1a5:	6a 02                	push   $0x2
+ 1a7:	50                   	push   %eax
+ 1a8:	52                   	push   %edx
+ 1a9:	e8 9b 06 00 00       	call   849 <writev>
+    ob[fd].n = 0;
+ 1ae:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    return;
+ 1b1:	83 c4 10             	add    $0x10,%esp
+    ob[fd].n = 0;
+ 1b4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ 1bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1be:	5b                   	pop    %ebx
+ 1bf:	5e                   	pop    %esi
+ 1c0:	5f                   	pop    %edi
+ 1c1:	5d                   	pop    %ebp
+ 1c2:	c3                   	ret
+ 1c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000001d0 <fflush>:
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	53                   	push   %ebx
+ 1d4:	83 ec 04             	sub    $0x4,%esp
+ 1d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 1da:	83 f8 0f             	cmp    $0xf,%eax
+ 1dd:	77 16                	ja     1f5 <fflush+0x25>
+ 1df:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+ 1e5:	8b 8a 24 13 00 00    	mov    0x1324(%edx),%ecx
+ 1eb:	8d 9a 20 13 00 00    	lea    0x1320(%edx),%ebx
+ 1f1:	85 c9                	test   %ecx,%ecx
+ 1f3:	7f 0b                	jg     200 <fflush+0x30>
+}
+ 1f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1f8:	c9                   	leave
+ 1f9:	c3                   	ret
+ 1fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 200:	83 ec 04             	sub    $0x4,%esp
+ 203:	81 c2 28 13 00 00    	add    $0x1328,%edx
+ 209:	51                   	push   %ecx
+ 20a:	52                   	push   %edx
+ 20b:	50                   	push   %eax
+ 20c:	e8 dc 04 00 00       	call   6ed <write>
+    ob[fd].n = 0;
+ 211:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+ 218:	83 c4 10             	add    $0x10,%esp
+}
+ 21b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 21e:	c9                   	leave
+ 21f:	c3                   	ret
+
+00000220 <fflushall>:
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 224:	31 f6                	xor    %esi,%esi
+{
+ 226:	53                   	push   %ebx
+ 227:	bb 28 13 00 00       	mov    $0x1328,%ebx
+ 22c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 230:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 233:	85 c0                	test   %eax,%eax
+ 235:	7e 15                	jle    24c <fflushall+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 237:	83 ec 04             	sub    $0x4,%esp
+ 23a:	50                   	push   %eax
+ 23b:	53                   	push   %ebx
+ 23c:	56                   	push   %esi
+ 23d:	e8 ab 04 00 00       	call   6ed <write>
+    ob[fd].n = 0;
+ 242:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 249:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 24c:	83 c6 01             	add    $0x1,%esi
+ 24f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 255:	83 fe 10             	cmp    $0x10,%esi
+ 258:	75 d6                	jne    230 <fflushall+0x10>
+}
+ 25a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 25d:	5b                   	pop    %ebx
+ 25e:	5e                   	pop    %esi
+ 25f:	5d                   	pop    %ebp
+ 260:	c3                   	ret
+ 261:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 268:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+
+00000270 <fork>:
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 274:	31 f6                	xor    %esi,%esi
+{
+ 276:	53                   	push   %ebx
+ 277:	bb 28 13 00 00       	mov    $0x1328,%ebx
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 280:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 283:	85 c0                	test   %eax,%eax
+ 285:	7e 15                	jle    29c <fork+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 287:	83 ec 04             	sub    $0x4,%esp
+ 28a:	50                   	push   %eax
+ 28b:	53                   	push   %ebx
+ 28c:	56                   	push   %esi
+ 28d:	e8 5b 04 00 00       	call   6ed <write>
+    ob[fd].n = 0;
+ 292:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 299:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 29c:	83 c6 01             	add    $0x1,%esi
+ 29f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 2a5:	83 fe 10             	cmp    $0x10,%esi
+ 2a8:	75 d6                	jne    280 <fork+0x10>
+}
+ 2aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2ad:	5b                   	pop    %ebx
+ 2ae:	5e                   	pop    %esi
+ 2af:	5d                   	pop    %ebp
+  return _fork();
+ 2b0:	e9 15 04 00 00       	jmp    6ca <_fork>
+ 2b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002c0 <exit>:
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	83 ec 08             	sub    $0x8,%esp
+  fflushall();
+ 2c6:	e8 55 ff ff ff       	call   220 <fflushall>
+  _exit();
+ 2cb:	e8 01 04 00 00       	call   6d1 <_exit>
+
+000002d0 <exec>:
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	57                   	push   %edi
+ 2d4:	56                   	push   %esi
+  for(fd = 0; fd < NOBUF; fd++)
+ 2d5:	31 f6                	xor    %esi,%esi
+{
+ 2d7:	53                   	push   %ebx
+ 2d8:	bb 28 13 00 00       	mov    $0x1328,%ebx
+ 2dd:	83 ec 1c             	sub    $0x1c,%esp
+ 2e0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 2e6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 2e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 2f0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 2f3:	85 c0                	test   %eax,%eax
+ 2f5:	7e 15                	jle    30c <exec+0x3c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 2f7:	83 ec 04             	sub    $0x4,%esp
+ 2fa:	50                   	push   %eax
+ 2fb:	53                   	push   %ebx
+ 2fc:	56                   	push   %esi
+ 2fd:	e8 eb 03 00 00       	call   6ed <write>
+    ob[fd].n = 0;
+ 302:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+ 309:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 30c:	83 c6 01             	add    $0x1,%esi
+ 30f:	81 c3 08 01 00 00    	add    $0x108,%ebx
+ 315:	83 fe 10             	cmp    $0x10,%esi
+ 318:	75 d6                	jne    2f0 <exec+0x20>
+  return _exec(path, argv);
+ 31a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 31d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+ 320:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ 323:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 326:	5b                   	pop    %ebx
+ 327:	5e                   	pop    %esi
+ 328:	5f                   	pop    %edi
+ 329:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 32a:	e9 d3 03 00 00       	jmp    702 <_exec>
+ 32f:	90                   	nop
+
+00000330 <close>:
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	56                   	push   %esi
+ 334:	53                   	push   %ebx
+ 335:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 338:	83 fb 0f             	cmp    $0xf,%ebx
+ 33b:	77 26                	ja     363 <close+0x33>
+ 33d:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 343:	8b 90 24 13 00 00    	mov    0x1324(%eax),%edx
+ 349:	8d b0 20 13 00 00    	lea    0x1320(%eax),%esi
+ 34f:	85 d2                	test   %edx,%edx
+ 351:	7f 25                	jg     378 <close+0x48>
+    ob[fd].mode = UNKNOWN;
+ 353:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 359:	c7 80 20 13 00 00 00 	movl   $0x0,0x1320(%eax)
+ 360:	00 00 00 
+  return _close(fd);
+ 363:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 366:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 369:	5b                   	pop    %ebx
+ 36a:	5e                   	pop    %esi
+ 36b:	5d                   	pop    %ebp
+  return _close(fd);
+ 36c:	e9 83 03 00 00       	jmp    6f4 <_close>
+ 371:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(fd, ob[fd].buf, ob[fd].n);
+ 378:	83 ec 04             	sub    $0x4,%esp
+ 37b:	05 28 13 00 00       	add    $0x1328,%eax
+ 380:	52                   	push   %edx
+ 381:	50                   	push   %eax
+ 382:	53                   	push   %ebx
+ 383:	e8 65 03 00 00       	call   6ed <write>
+    ob[fd].n = 0;
+ 388:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+ 38f:	83 c4 10             	add    $0x10,%esp
+ 392:	eb bf                	jmp    353 <close+0x23>
+ 394:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 39f:	90                   	nop
+
+000003a0 <strcpy>:
+{
+ 3a0:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+ 3a1:	31 c0                	xor    %eax,%eax
+{
+ 3a3:	89 e5                	mov    %esp,%ebp
+ 3a5:	53                   	push   %ebx
+ 3a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 3b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 3b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 3b7:	83 c0 01             	add    $0x1,%eax
+ 3ba:	84 d2                	test   %dl,%dl
+ 3bc:	75 f2                	jne    3b0 <strcpy+0x10>
+}
+ 3be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3c1:	89 c8                	mov    %ecx,%eax
+ 3c3:	c9                   	leave
+ 3c4:	c3                   	ret
+ 3c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <strcmp>:
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	53                   	push   %ebx
+ 3d4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 3da:	0f b6 02             	movzbl (%edx),%eax
+ 3dd:	84 c0                	test   %al,%al
+ 3df:	75 17                	jne    3f8 <strcmp+0x28>
+ 3e1:	eb 3a                	jmp    41d <strcmp+0x4d>
+ 3e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3e7:	90                   	nop
+ 3e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 3ec:	83 c2 01             	add    $0x1,%edx
+ 3ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 3f2:	84 c0                	test   %al,%al
+ 3f4:	74 1a                	je     410 <strcmp+0x40>
+    p++, q++;
+ 3f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 3f8:	0f b6 19             	movzbl (%ecx),%ebx
+ 3fb:	38 c3                	cmp    %al,%bl
+ 3fd:	74 e9                	je     3e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 3ff:	29 d8                	sub    %ebx,%eax
+}
+ 401:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 404:	c9                   	leave
+ 405:	c3                   	ret
+ 406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 410:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 414:	31 c0                	xor    %eax,%eax
+ 416:	29 d8                	sub    %ebx,%eax
+}
+ 418:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 41b:	c9                   	leave
+ 41c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 41d:	0f b6 19             	movzbl (%ecx),%ebx
+ 420:	31 c0                	xor    %eax,%eax
+ 422:	eb db                	jmp    3ff <strcmp+0x2f>
+ 424:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 42f:	90                   	nop
+
+00000430 <strlen>:
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+ 436:	80 3a 00             	cmpb   $0x0,(%edx)
+ 439:	74 15                	je     450 <strlen+0x20>
+ 43b:	31 c0                	xor    %eax,%eax
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+ 440:	83 c0 01             	add    $0x1,%eax
+ 443:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 447:	89 c1                	mov    %eax,%ecx
+ 449:	75 f5                	jne    440 <strlen+0x10>
+}
+ 44b:	89 c8                	mov    %ecx,%eax
+ 44d:	5d                   	pop    %ebp
+ 44e:	c3                   	ret
+ 44f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 450:	31 c9                	xor    %ecx,%ecx
+}
+ 452:	5d                   	pop    %ebp
+ 453:	89 c8                	mov    %ecx,%eax
+ 455:	c3                   	ret
+ 456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000460 <memset>:
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 467:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 46a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 46d:	89 d7                	mov    %edx,%edi
+ 46f:	fc                   	cld
+ 470:	f3 aa                	rep stos %al,%es:(%edi)
+}
+ 472:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 475:	89 d0                	mov    %edx,%eax
+ 477:	c9                   	leave
+ 478:	c3                   	ret
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <strchr>:
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	8b 45 08             	mov    0x8(%ebp),%eax
+ 486:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 48a:	0f b6 10             	movzbl (%eax),%edx
+ 48d:	84 d2                	test   %dl,%dl
+ 48f:	75 12                	jne    4a3 <strchr+0x23>
+ 491:	eb 1d                	jmp    4b0 <strchr+0x30>
+ 493:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 497:	90                   	nop
+ 498:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 49c:	83 c0 01             	add    $0x1,%eax
+ 49f:	84 d2                	test   %dl,%dl
+ 4a1:	74 0d                	je     4b0 <strchr+0x30>
+    if(*s == c)
+ 4a3:	38 d1                	cmp    %dl,%cl
+ 4a5:	75 f1                	jne    498 <strchr+0x18>
+}
+ 4a7:	5d                   	pop    %ebp
+ 4a8:	c3                   	ret
+ 4a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 4b0:	31 c0                	xor    %eax,%eax
+}
+ 4b2:	5d                   	pop    %ebp
+ 4b3:	c3                   	ret
+ 4b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4bf:	90                   	nop
+
+000004c0 <memchr>:
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	8b 55 10             	mov    0x10(%ebp),%edx
+ 4c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(p = s; n > 0; p++, n--)
+ 4c9:	85 d2                	test   %edx,%edx
+ 4cb:	74 1b                	je     4e8 <memchr+0x28>
+    if(*p == (char)c)
+ 4cd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+ 4d1:	01 c2                	add    %eax,%edx
+ 4d3:	eb 0a                	jmp    4df <memchr+0x1f>
+ 4d5:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = s; n > 0; p++, n--)
+ 4d8:	83 c0 01             	add    $0x1,%eax
+ 4db:	39 c2                	cmp    %eax,%edx
+ 4dd:	74 09                	je     4e8 <memchr+0x28>
+    if(*p == (char)c)
+ 4df:	38 08                	cmp    %cl,(%eax)
+ 4e1:	75 f5                	jne    4d8 <memchr+0x18>
+}
+ 4e3:	5d                   	pop    %ebp
+ 4e4:	c3                   	ret
+ 4e5:	8d 76 00             	lea    0x0(%esi),%esi
+  return 0;
+ 4e8:	31 c0                	xor    %eax,%eax
+}
+ 4ea:	5d                   	pop    %ebp
+ 4eb:	c3                   	ret
+ 4ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004f0 <gets>:
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	57                   	push   %edi
+  for(fd = 0; fd < NOBUF; fd++)
+ 4f4:	31 ff                	xor    %edi,%edi
+{
+ 4f6:	56                   	push   %esi
+ 4f7:	be 28 13 00 00       	mov    $0x1328,%esi
+ 4fc:	53                   	push   %ebx
+ 4fd:	83 ec 1c             	sub    $0x1c,%esp
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 500:	8b 46 fc             	mov    -0x4(%esi),%eax
+ 503:	85 c0                	test   %eax,%eax
+ 505:	7e 15                	jle    51c <gets+0x2c>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 507:	83 ec 04             	sub    $0x4,%esp
+ 50a:	50                   	push   %eax
+ 50b:	56                   	push   %esi
+ 50c:	57                   	push   %edi
+ 50d:	e8 db 01 00 00       	call   6ed <write>
+    ob[fd].n = 0;
+ 512:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+ 519:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOBUF; fd++)
+ 51c:	83 c7 01             	add    $0x1,%edi
+ 51f:	81 c6 08 01 00 00    	add    $0x108,%esi
+ 525:	83 ff 10             	cmp    $0x10,%edi
+ 528:	75 d6                	jne    500 <gets+0x10>
+  for(i=0; i+1 < max; ){
+ 52a:	31 db                	xor    %ebx,%ebx
+    cc = read(0, &c, 1);
+ 52c:	8d 75 e7             	lea    -0x19(%ebp),%esi
+ 52f:	eb 2e                	jmp    55f <gets+0x6f>
+ 531:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 538:	83 ec 04             	sub    $0x4,%esp
+ 53b:	6a 01                	push   $0x1
+ 53d:	56                   	push   %esi
+ 53e:	6a 00                	push   $0x0
+ 540:	e8 a1 01 00 00       	call   6e6 <read>
+    if(cc < 1)
+ 545:	83 c4 10             	add    $0x10,%esp
+ 548:	85 c0                	test   %eax,%eax
+ 54a:	7e 1d                	jle    569 <gets+0x79>
+    buf[i++] = c;
+ 54c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 550:	8b 55 08             	mov    0x8(%ebp),%edx
+ 553:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 557:	3c 0a                	cmp    $0xa,%al
+ 559:	74 10                	je     56b <gets+0x7b>
+ 55b:	3c 0d                	cmp    $0xd,%al
+ 55d:	74 0c                	je     56b <gets+0x7b>
+  for(i=0; i+1 < max; ){
+ 55f:	89 df                	mov    %ebx,%edi
+ 561:	83 c3 01             	add    $0x1,%ebx
+ 564:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 567:	7c cf                	jl     538 <gets+0x48>
+ 569:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 56b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 56e:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 572:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 575:	5b                   	pop    %ebx
+ 576:	5e                   	pop    %esi
+ 577:	5f                   	pop    %edi
+ 578:	5d                   	pop    %ebp
+ 579:	c3                   	ret
+ 57a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000580 <stat>:
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	57                   	push   %edi
+ 584:	56                   	push   %esi
+ 585:	53                   	push   %ebx
+ 586:	83 ec 14             	sub    $0x14,%esp
+  fd = open(n, O_RDONLY);
+ 589:	6a 00                	push   $0x0
+ 58b:	ff 75 08             	push   0x8(%ebp)
+ 58e:	e8 76 01 00 00       	call   709 <open>
+  if(fd < 0)
+ 593:	83 c4 10             	add    $0x10,%esp
+ 596:	85 c0                	test   %eax,%eax
+ 598:	78 76                	js     610 <stat+0x90>
+  r = fstat(fd, st);
+ 59a:	83 ec 08             	sub    $0x8,%esp
+ 59d:	ff 75 0c             	push   0xc(%ebp)
+ 5a0:	89 c3                	mov    %eax,%ebx
+ 5a2:	50                   	push   %eax
+ 5a3:	e8 7f 01 00 00       	call   727 <fstat>
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 5a8:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 5ab:	89 c6                	mov    %eax,%esi
+  if(fd >= 0 && fd < NOBUF && ob[fd].n > 0){
+ 5ad:	83 fb 0f             	cmp    $0xf,%ebx
+ 5b0:	7f 40                	jg     5f2 <stat+0x72>
+ 5b2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 5b8:	8b 90 24 13 00 00    	mov    0x1324(%eax),%edx
+ 5be:	8d b8 20 13 00 00    	lea    0x1320(%eax),%edi
+ 5c4:	85 d2                	test   %edx,%edx
+ 5c6:	7e 1a                	jle    5e2 <stat+0x62>
+    write(fd, ob[fd].buf, ob[fd].n);
+ 5c8:	83 ec 04             	sub    $0x4,%esp
+ 5cb:	05 28 13 00 00       	add    $0x1328,%eax
+ 5d0:	52                   	push   %edx
+ 5d1:	50                   	push   %eax
+ 5d2:	53                   	push   %ebx
+ 5d3:	e8 15 01 00 00       	call   6ed <write>
+    ob[fd].n = 0;
+ 5d8:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+ 5df:	83 c4 10             	add    $0x10,%esp
+    ob[fd].mode = UNKNOWN;
+ 5e2:	69 c3 08 01 00 00    	imul   $0x108,%ebx,%eax
+ 5e8:	c7 80 20 13 00 00 00 	movl   $0x0,0x1320(%eax)
+ 5ef:	00 00 00 
+  return _close(fd);
+ 5f2:	83 ec 0c             	sub    $0xc,%esp
+ 5f5:	53                   	push   %ebx
+ 5f6:	e8 f9 00 00 00       	call   6f4 <_close>
+ 5fb:	83 c4 10             	add    $0x10,%esp
+}
+ 5fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 601:	89 f0                	mov    %esi,%eax
+ 603:	5b                   	pop    %ebx
+ 604:	5e                   	pop    %esi
+ 605:	5f                   	pop    %edi
+ 606:	5d                   	pop    %ebp
+ 607:	c3                   	ret
+ 608:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60f:	90                   	nop
+    return -1;
+ 610:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 615:	eb e7                	jmp    5fe <stat+0x7e>
+ 617:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61e:	66 90                	xchg   %ax,%ax
+
+00000620 <atoi>:
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	53                   	push   %ebx
+ 624:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 627:	0f be 02             	movsbl (%edx),%eax
+ 62a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 62d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 630:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 635:	77 1e                	ja     655 <atoi+0x35>
+ 637:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 63e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 640:	83 c2 01             	add    $0x1,%edx
+ 643:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 646:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 64a:	0f be 02             	movsbl (%edx),%eax
+ 64d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 650:	80 fb 09             	cmp    $0x9,%bl
+ 653:	76 eb                	jbe    640 <atoi+0x20>
+}
+ 655:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 658:	89 c8                	mov    %ecx,%eax
+ 65a:	c9                   	leave
+ 65b:	c3                   	ret
+ 65c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000660 <memmove>:
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	57                   	push   %edi
+ 664:	56                   	push   %esi
+ 665:	8b 45 10             	mov    0x10(%ebp),%eax
+ 668:	8b 55 08             	mov    0x8(%ebp),%edx
+ 66b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 66e:	85 c0                	test   %eax,%eax
+ 670:	7e 13                	jle    685 <memmove+0x25>
+ 672:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 674:	89 d7                	mov    %edx,%edi
+ 676:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 680:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 681:	39 f8                	cmp    %edi,%eax
+ 683:	75 fb                	jne    680 <memmove+0x20>
+  return vdst;
+}
+ 685:	5e                   	pop    %esi
+ 686:	89 d0                	mov    %edx,%eax
+ 688:	5f                   	pop    %edi
+ 689:	5d                   	pop    %ebp
+ 68a:	c3                   	ret
+
+0000068b <syscallentry>:
+sysentermode:
+  .long 0  // 0 not yet known, 1 sysenter, -1 int
+
+.text
+syscallentry:
+  cmpl $0, sysentermode
+ 68b:	83 3d 04 13 00 00 00 	cmpl   $0x0,0x1304
+  jle 1f
+ 692:	7e 0a                	jle    69e <syscallentry+0x13>
+  movl %esp, %ecx
+ 694:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 696:	ba 9d 06 00 00       	mov    $0x69d,%edx
+  sysenter
+ 69b:	0f 34                	sysenter
+2:
+  ret
+ 69d:	c3                   	ret
+1:
+  jl 3f
+ 69e:	7c 27                	jl     6c7 <syscallentry+0x3c>
+  pushal
+ 6a0:	60                   	pusha
+  movl $1, %eax
+ 6a1:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 6a6:	0f a2                	cpuid
+  movl $-1, sysentermode
+ 6a8:	c7 05 04 13 00 00 ff 	movl   $0xffffffff,0x1304
+ 6af:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 6b2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+ 6b8:	74 0a                	je     6c4 <syscallentry+0x39>
+  movl $1, sysentermode
+ 6ba:	c7 05 04 13 00 00 01 	movl   $0x1,0x1304
+ 6c1:	00 00 00 
+4:
+  popal
+ 6c4:	61                   	popa
+  jmp syscallentry
+ 6c5:	eb c4                	jmp    68b <syscallentry>
+3:
+  int $T_SYSCALL
+ 6c7:	cd 40                	int    $0x40
+  ret
+ 6c9:	c3                   	ret
+
+000006ca <_fork>:
+
+SYSCALLAS(_fork, fork)
+ 6ca:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6cf:	eb ba                	jmp    68b <syscallentry>
+
+000006d1 <_exit>:
+SYSCALLAS(_exit, exit)
+ 6d1:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6d6:	eb b3                	jmp    68b <syscallentry>
+
+000006d8 <wait>:
+SYSCALL(wait)
+ 6d8:	b8 03 00 00 00       	mov    $0x3,%eax
+ 6dd:	eb ac                	jmp    68b <syscallentry>
+
+000006df <pipe>:
+SYSCALL(pipe)
+ 6df:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6e4:	eb a5                	jmp    68b <syscallentry>
+
+000006e6 <read>:
+SYSCALL(read)
+ 6e6:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6eb:	eb 9e                	jmp    68b <syscallentry>
+
+000006ed <write>:
+SYSCALL(write)
+ 6ed:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6f2:	eb 97                	jmp    68b <syscallentry>
+
+000006f4 <_close>:
+SYSCALLAS(_close, close)
+ 6f4:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6f9:	eb 90                	jmp    68b <syscallentry>
+
+000006fb <kill>:
+SYSCALL(kill)
+ 6fb:	b8 06 00 00 00       	mov    $0x6,%eax
+ 700:	eb 89                	jmp    68b <syscallentry>
+
+00000702 <_exec>:
+SYSCALLAS(_exec, exec)
+ 702:	b8 07 00 00 00       	mov    $0x7,%eax
+ 707:	eb 82                	jmp    68b <syscallentry>
+
+00000709 <open>:
+SYSCALL(open)
+ 709:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 70e:	e9 78 ff ff ff       	jmp    68b <syscallentry>
+
+00000713 <mknod>:
+SYSCALL(mknod)
+ 713:	b8 11 00 00 00       	mov    $0x11,%eax
+ 718:	e9 6e ff ff ff       	jmp    68b <syscallentry>
+
+0000071d <unlink>:
+SYSCALL(unlink)
+ 71d:	b8 12 00 00 00       	mov    $0x12,%eax
+ 722:	e9 64 ff ff ff       	jmp    68b <syscallentry>
+
+00000727 <fstat>:
+SYSCALL(fstat)
+ 727:	b8 08 00 00 00       	mov    $0x8,%eax
+ 72c:	e9 5a ff ff ff       	jmp    68b <syscallentry>
+
+00000731 <link>:
+SYSCALL(link)
+ 731:	b8 13 00 00 00       	mov    $0x13,%eax
+ 736:	e9 50 ff ff ff       	jmp    68b <syscallentry>
+
+0000073b <mkdir>:
+SYSCALL(mkdir)
+ 73b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 740:	e9 46 ff ff ff       	jmp    68b <syscallentry>
+
+00000745 <chdir>:
+SYSCALL(chdir)
+ 745:	b8 09 00 00 00       	mov    $0x9,%eax
+ 74a:	e9 3c ff ff ff       	jmp    68b <syscallentry>
+
+0000074f <dup>:
+SYSCALL(dup)
+ 74f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 754:	e9 32 ff ff ff       	jmp    68b <syscallentry>
+
+00000759 <getpid>:
+SYSCALL(getpid)
+ 759:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 75e:	e9 28 ff ff ff       	jmp    68b <syscallentry>
+
+00000763 <sbrk>:
+SYSCALL(sbrk)
+ 763:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 768:	e9 1e ff ff ff       	jmp    68b <syscallentry>
+
+0000076d <sleep>:
+SYSCALL(sleep)
+ 76d:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 772:	e9 14 ff ff ff       	jmp    68b <syscallentry>
+
+00000777 <uptime>:
+SYSCALL(uptime)
+ 777:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 77c:	e9 0a ff ff ff       	jmp    68b <syscallentry>
+
+00000781 <find_digit_root>:
+SYSCALL(find_digit_root) // returns the digit root of a number for using in random_seed
+ 781:	b8 16 00 00 00       	mov    $0x16,%eax
+ 786:	e9 00 ff ff ff       	jmp    68b <syscallentry>
+
+0000078b <copy_file>:
+SYSCALL(copy_file); // function declaration for the copy file system call as a load for child process
+ 78b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 790:	e9 f6 fe ff ff       	jmp    68b <syscallentry>
+
+00000795 <get_uncle_count>:
+SYSCALL(get_uncle_count) // returns the number of uncles for a given process
+ 795:	b8 18 00 00 00       	mov    $0x18,%eax
+ 79a:	e9 ec fe ff ff       	jmp    68b <syscallentry>
+
+0000079f <get_process_lifetime>:
+SYSCALL(get_process_lifetime) // returns the lifetime of a process
+ 79f:	b8 19 00 00 00       	mov    $0x19,%eax
+ 7a4:	e9 e2 fe ff ff       	jmp    68b <syscallentry>
+
+000007a9 <getnumsyscalls>:
+SYSCALL(getnumsyscalls) // returns the number of system calls made by a process
+ 7a9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 7ae:	e9 d8 fe ff ff       	jmp    68b <syscallentry>
+
+000007b3 <getnumsyscallsgood>:
+SYSCALL(getnumsyscallsgood) // returns the number of successful system calls made by a process
+ 7b3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 7b8:	e9 ce fe ff ff       	jmp    68b <syscallentry>
+
+000007bd <waitx>:
+SYSCALL(waitx) // Add waitx syscall stub returns the exit status of a process and wait and execution time
+ 7bd:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 7c2:	e9 c4 fe ff ff       	jmp    68b <syscallentry>
+
+000007c7 <setschedpolicy>:
+SYSCALL(setschedpolicy) // Add new syscall entry for setschedpolicy
+ 7c7:	b8 20 00 00 00       	mov    $0x20,%eax
+ 7cc:	e9 ba fe ff ff       	jmp    68b <syscallentry>
+
+000007d1 <set_priority>:
+SYSCALL(set_priority) // sets the priority of a process in the scheduler
+ 7d1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 7d6:	e9 b0 fe ff ff       	jmp    68b <syscallentry>
+
+000007db <test_rr>:
+SYSCALL(test_rr) // test round robin scheduler
+ 7db:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 7e0:	e9 a6 fe ff ff       	jmp    68b <syscallentry>
+
+000007e5 <set_burst_estimate>:
+SYSCALL(set_burst_estimate) // sets the burst estimate of a process in the scheduler
+ 7e5:	b8 21 00 00 00       	mov    $0x21,%eax
+ 7ea:	e9 9c fe ff ff       	jmp    68b <syscallentry>
+
+000007ef <yield>:
+SYSCALL(yield) // yield the CPU to another process
+ 7ef:	b8 22 00 00 00       	mov    $0x22,%eax
+ 7f4:	e9 92 fe ff ff       	jmp    68b <syscallentry>
+
+000007f9 <setidemode>:
+SYSCALL(setidemode) // switch the disk driver between PIO and DMA
+ 7f9:	b8 23 00 00 00       	mov    $0x23,%eax
+ 7fe:	e9 88 fe ff ff       	jmp    68b <syscallentry>
+
+00000803 <logstat>:
+SYSCALL(logstat) // copy out the log traffic counters
+ 803:	b8 24 00 00 00       	mov    $0x24,%eax
+ 808:	e9 7e fe ff ff       	jmp    68b <syscallentry>
+
+0000080d <fsync>:
+SYSCALL(fsync) // flush a file's buffered writes and commit
+ 80d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 812:	e9 74 fe ff ff       	jmp    68b <syscallentry>
+
+00000817 <copy_file_range>:
+SYSCALL(copy_file_range) // copy between open files in the kernel
+ 817:	b8 26 00 00 00       	mov    $0x26,%eax
+ 81c:	e9 6a fe ff ff       	jmp    68b <syscallentry>
+
+00000821 <icachestat>:
+SYSCALL(icachestat) // copy out the inode cache counters
+ 821:	b8 27 00 00 00       	mov    $0x27,%eax
+ 826:	e9 60 fe ff ff       	jmp    68b <syscallentry>
+
+0000082b <mmap>:
+SYSCALL(mmap) // map a file into memory
+ 82b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 830:	e9 56 fe ff ff       	jmp    68b <syscallentry>
+
+00000835 <munmap>:
+SYSCALL(munmap) // unmap part of an mmap()ed region
+ 835:	b8 29 00 00 00       	mov    $0x29,%eax
+ 83a:	e9 4c fe ff ff       	jmp    68b <syscallentry>
+
+0000083f <readv>:
+SYSCALL(readv) // read into several buffers
+ 83f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 844:	e9 42 fe ff ff       	jmp    68b <syscallentry>
+
+00000849 <writev>:
+SYSCALL(writev) // write from several buffers
+ 849:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 84e:	e9 38 fe ff ff       	jmp    68b <syscallentry>
+
+00000853 <pread>:
+SYSCALL(pread) // read at an offset
+ 853:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 858:	e9 2e fe ff ff       	jmp    68b <syscallentry>
+
+0000085d <pwrite>:
+SYSCALL(pwrite) // write at an offset
+ 85d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 862:	e9 24 fe ff ff       	jmp    68b <syscallentry>
+
+00000867 <getprocinfo>:
+SYSCALL(getprocinfo) // copy out a snapshot of the process table
+ 867:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 86c:	e9 1a fe ff ff       	jmp    68b <syscallentry>
+
+00000871 <schedlat>:
+SYSCALL(schedlat) // copy out per-cpu run queue latency histograms
+ 871:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 876:	e9 10 fe ff ff       	jmp    68b <syscallentry>
+
+0000087b <tracectl>:
+SYSCALL(tracectl) // turn kernel event tracing on or off
+ 87b:	b8 30 00 00 00       	mov    $0x30,%eax
+ 880:	e9 06 fe ff ff       	jmp    68b <syscallentry>
+
+00000885 <traceread>:
+SYSCALL(traceread) // drain kernel trace events
+ 885:	b8 31 00 00 00       	mov    $0x31,%eax
+ 88a:	e9 fc fd ff ff       	jmp    68b <syscallentry>
+
+0000088f <profctl>:
+SYSCALL(profctl) // start or stop the sampling profiler
+ 88f:	b8 32 00 00 00       	mov    $0x32,%eax
+ 894:	e9 f2 fd ff ff       	jmp    68b <syscallentry>
+
+00000899 <profread>:
+SYSCALL(profread) // drain profiler samples
+ 899:	b8 33 00 00 00       	mov    $0x33,%eax
+ 89e:	e9 e8 fd ff ff       	jmp    68b <syscallentry>
+
+000008a3 <lockstat>:
+SYSCALL(lockstat) // copy out, and maybe reset, spinlock counters
+ 8a3:	b8 34 00 00 00       	mov    $0x34,%eax
+ 8a8:	e9 de fd ff ff       	jmp    68b <syscallentry>
+
+000008ad <lockbench>:
+SYSCALL(lockbench) // contend for a kernel spinlock, for lockbench
+ 8ad:	b8 35 00 00 00       	mov    $0x35,%eax
+ 8b2:	e9 d4 fd ff ff       	jmp    68b <syscallentry>
+
+000008b7 <fsfree>:
+SYSCALL(fsfree) // count the free disk blocks
+ 8b7:	b8 36 00 00 00       	mov    $0x36,%eax
+ 8bc:	e9 ca fd ff ff       	jmp    68b <syscallentry>
+
+000008c1 <mkhdir>:
+SYSCALL(mkhdir) // make a hashed directory
+ 8c1:	b8 37 00 00 00       	mov    $0x37,%eax
+ 8c6:	e9 c0 fd ff ff       	jmp    68b <syscallentry>
+ 8cb:	66 90                	xchg   %ax,%ax
+ 8cd:	66 90                	xchg   %ax,%ax
+ 8cf:	90                   	nop
+
+000008d0 <printint>:
+  bufwrite(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 8d0:	55                   	push   %ebp
+ 8d1:	89 e5                	mov    %esp,%ebp
+ 8d3:	57                   	push   %edi
+ 8d4:	56                   	push   %esi
+ 8d5:	53                   	push   %ebx
+ 8d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 8d8:	89 d1                	mov    %edx,%ecx
+{
+ 8da:	83 ec 3c             	sub    $0x3c,%esp
+ 8dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 8e0:	85 d2                	test   %edx,%edx
+ 8e2:	0f 89 80 00 00 00    	jns    968 <printint+0x98>
+ 8e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 8ec:	74 7a                	je     968 <printint+0x98>
+    x = -xx;
+ 8ee:	f7 d9                	neg    %ecx
+    neg = 1;
+ 8f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 8f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 8f8:	31 f6                	xor    %esi,%esi
+ 8fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 900:	89 c8                	mov    %ecx,%eax
+ 902:	31 d2                	xor    %edx,%edx
+ 904:	89 f7                	mov    %esi,%edi
+ 906:	f7 f3                	div    %ebx
+ 908:	8d 76 01             	lea    0x1(%esi),%esi
+ 90b:	0f b6 92 80 0e 00 00 	movzbl 0xe80(%edx),%edx
+ 912:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 916:	89 ca                	mov    %ecx,%edx
+ 918:	89 c1                	mov    %eax,%ecx
+ 91a:	39 da                	cmp    %ebx,%edx
+ 91c:	73 e2                	jae    900 <printint+0x30>
+  if(neg)
+ 91e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 921:	85 c0                	test   %eax,%eax
+ 923:	74 07                	je     92c <printint+0x5c>
+    buf[i++] = '-';
+ 925:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 92a:	89 f7                	mov    %esi,%edi
+ 92c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 92f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 932:	01 df                	add    %ebx,%edi
+ 934:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 938:	0f b6 07             	movzbl (%edi),%eax
+  bufwrite(fd, &c, 1);
+ 93b:	83 ec 04             	sub    $0x4,%esp
+ 93e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 941:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 944:	6a 01                	push   $0x1
+ 946:	50                   	push   %eax
+ 947:	56                   	push   %esi
+ 948:	e8 e3 f6 ff ff       	call   30 <bufwrite>
+  while(--i >= 0)
+ 94d:	89 f8                	mov    %edi,%eax
+ 94f:	83 c4 10             	add    $0x10,%esp
+ 952:	83 ef 01             	sub    $0x1,%edi
+ 955:	39 d8                	cmp    %ebx,%eax
+ 957:	75 df                	jne    938 <printint+0x68>
+}
+ 959:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 95c:	5b                   	pop    %ebx
+ 95d:	5e                   	pop    %esi
+ 95e:	5f                   	pop    %edi
+ 95f:	5d                   	pop    %ebp
+ 960:	c3                   	ret
+ 961:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 968:	31 c0                	xor    %eax,%eax
+ 96a:	eb 89                	jmp    8f5 <printint+0x25>
+ 96c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000970 <printf>:
+// Print to the given fd, through its output buffer (see
+// ulib.c); fd 2 is flushed at the end of each call.
+// Only understands %d, %l (uint64), %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 970:	55                   	push   %ebp
+ 971:	89 e5                	mov    %esp,%ebp
+ 973:	57                   	push   %edi
+ 974:	56                   	push   %esi
+ 975:	53                   	push   %ebx
+ 976:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 979:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 97c:	0f b6 18             	movzbl (%eax),%ebx
+ 97f:	84 db                	test   %bl,%bl
+ 981:	74 6c                	je     9ef <printf+0x7f>
+ 983:	8d 78 01             	lea    0x1(%eax),%edi
+  ap = (uint*)(void*)&fmt + 1;
+ 986:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ 989:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 98b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 98e:	eb 26                	jmp    9b6 <printf+0x46>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 990:	83 f8 25             	cmp    $0x25,%eax
+ 993:	74 4b                	je     9e0 <printf+0x70>
+  bufwrite(fd, &c, 1);
+ 995:	83 ec 04             	sub    $0x4,%esp
+ 998:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 99b:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ 99e:	6a 01                	push   $0x1
+ 9a0:	50                   	push   %eax
+ 9a1:	ff 75 08             	push   0x8(%ebp)
+ 9a4:	e8 87 f6 ff ff       	call   30 <bufwrite>
+        state = '%';
+      } else {
+        putc(fd, c);
+ 9a9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 9ac:	0f b6 1f             	movzbl (%edi),%ebx
+ 9af:	83 c7 01             	add    $0x1,%edi
+ 9b2:	84 db                	test   %bl,%bl
+ 9b4:	74 39                	je     9ef <printf+0x7f>
+    c = fmt[i] & 0xff;
+ 9b6:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 9b9:	85 f6                	test   %esi,%esi
+ 9bb:	74 d3                	je     990 <printf+0x20>
+      }
+    } else if(state == '%'){
+ 9bd:	83 fe 25             	cmp    $0x25,%esi
+ 9c0:	75 ea                	jne    9ac <printf+0x3c>
+      if(c == 'd'){
+ 9c2:	83 f8 25             	cmp    $0x25,%eax
+ 9c5:	0f 84 d5 01 00 00    	je     ba0 <printf+0x230>
+ 9cb:	83 e8 63             	sub    $0x63,%eax
+ 9ce:	83 f8 15             	cmp    $0x15,%eax
+ 9d1:	77 45                	ja     a18 <printf+0xa8>
+ 9d3:	ff 24 85 28 0e 00 00 	jmp    *0xe28(,%eax,4)
+ 9da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+ 9e0:	0f b6 1f             	movzbl (%edi),%ebx
+ 9e3:	83 c7 01             	add    $0x1,%edi
+        state = '%';
+ 9e6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ 9eb:	84 db                	test   %bl,%bl
+ 9ed:	75 c7                	jne    9b6 <printf+0x46>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+  if(fd == 2)
+ 9ef:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+ 9f3:	74 0b                	je     a00 <printf+0x90>
+    fflush(fd);
+}
+ 9f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9f8:	5b                   	pop    %ebx
+ 9f9:	5e                   	pop    %esi
+ 9fa:	5f                   	pop    %edi
+ 9fb:	5d                   	pop    %ebp
+ 9fc:	c3                   	ret
+ 9fd:	8d 76 00             	lea    0x0(%esi),%esi
+    fflush(fd);
+ a00:	83 ec 0c             	sub    $0xc,%esp
+ a03:	6a 02                	push   $0x2
+ a05:	e8 c6 f7 ff ff       	call   1d0 <fflush>
+ a0a:	83 c4 10             	add    $0x10,%esp
+}
+ a0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a10:	5b                   	pop    %ebx
+ a11:	5e                   	pop    %esi
+ a12:	5f                   	pop    %edi
+ a13:	5d                   	pop    %ebp
+ a14:	c3                   	ret
+ a15:	8d 76 00             	lea    0x0(%esi),%esi
+  bufwrite(fd, &c, 1);
+ a18:	83 ec 04             	sub    $0x4,%esp
+ a1b:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ a1e:	c6 45 d4 25          	movb   $0x25,-0x2c(%ebp)
+ a22:	6a 01                	push   $0x1
+ a24:	52                   	push   %edx
+ a25:	89 55 c0             	mov    %edx,-0x40(%ebp)
+ a28:	ff 75 08             	push   0x8(%ebp)
+ a2b:	e8 00 f6 ff ff       	call   30 <bufwrite>
+ a30:	83 c4 0c             	add    $0xc,%esp
+ a33:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ a36:	6a 01                	push   $0x1
+ a38:	8b 55 c0             	mov    -0x40(%ebp),%edx
+ a3b:	52                   	push   %edx
+      state = 0;
+ a3c:	31 f6                	xor    %esi,%esi
+  bufwrite(fd, &c, 1);
+ a3e:	ff 75 08             	push   0x8(%ebp)
+ a41:	e8 ea f5 ff ff       	call   30 <bufwrite>
+        putc(fd, c);
+ a46:	83 c4 10             	add    $0x10,%esp
+ a49:	e9 5e ff ff ff       	jmp    9ac <printf+0x3c>
+ a4e:	66 90                	xchg   %ax,%ax
+        printint(fd, *ap, 16, 0);
+ a50:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ a53:	83 ec 0c             	sub    $0xc,%esp
+ a56:	b9 10 00 00 00       	mov    $0x10,%ecx
+ a5b:	8b 16                	mov    (%esi),%edx
+ a5d:	6a 00                	push   $0x0
+ a5f:	8b 45 08             	mov    0x8(%ebp),%eax
+        ap++;
+ a62:	83 c6 04             	add    $0x4,%esi
+        printint(fd, *ap, 16, 0);
+ a65:	e8 66 fe ff ff       	call   8d0 <printint>
+        ap++;
+ a6a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ a6d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a70:	31 f6                	xor    %esi,%esi
+ a72:	e9 35 ff ff ff       	jmp    9ac <printf+0x3c>
+ a77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a7e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+ a80:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ a83:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a85:	83 c0 04             	add    $0x4,%eax
+ a88:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        s = (char*)*ap;
+ a8b:	b8 20 0e 00 00       	mov    $0xe20,%eax
+ a90:	85 db                	test   %ebx,%ebx
+ a92:	0f 44 d8             	cmove  %eax,%ebx
+        bufwrite(fd, s, strlen(s));
+ a95:	83 ec 0c             	sub    $0xc,%esp
+      state = 0;
+ a98:	31 f6                	xor    %esi,%esi
+        bufwrite(fd, s, strlen(s));
+ a9a:	53                   	push   %ebx
+ a9b:	e8 90 f9 ff ff       	call   430 <strlen>
+ aa0:	83 c4 0c             	add    $0xc,%esp
+ aa3:	50                   	push   %eax
+ aa4:	53                   	push   %ebx
+ aa5:	ff 75 08             	push   0x8(%ebp)
+ aa8:	e8 83 f5 ff ff       	call   30 <bufwrite>
+ aad:	83 c4 10             	add    $0x10,%esp
+ ab0:	e9 f7 fe ff ff       	jmp    9ac <printf+0x3c>
+ ab5:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ ab8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  bufwrite(fd, &c, 1);
+ abb:	83 ec 04             	sub    $0x4,%esp
+ abe:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+        putc(fd, *ap);
+ ac1:	8b 06                	mov    (%esi),%eax
+        ap++;
+ ac3:	83 c6 04             	add    $0x4,%esi
+        putc(fd, *ap);
+ ac6:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  bufwrite(fd, &c, 1);
+ ac9:	6a 01                	push   $0x1
+ acb:	52                   	push   %edx
+ acc:	ff 75 08             	push   0x8(%ebp)
+ acf:	e8 5c f5 ff ff       	call   30 <bufwrite>
+        ap++;
+ ad4:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ ad7:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ ada:	31 f6                	xor    %esi,%esi
+ adc:	e9 cb fe ff ff       	jmp    9ac <printf+0x3c>
+ ae1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(fd, *ap, 10, 1);
+ ae8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ aeb:	83 ec 0c             	sub    $0xc,%esp
+ aee:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ af3:	8b 16                	mov    (%esi),%edx
+ af5:	6a 01                	push   $0x1
+ af7:	e9 63 ff ff ff       	jmp    a5f <printf+0xef>
+ afc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printlong(fd, *(uint64*)ap);
+ b00:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ b03:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+{
+  uint hi, lo, r;
+
+  hi = (uint)(n >> 32) / d;
+  r = (uint)(n >> 32) % d;
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ b06:	89 7d c0             	mov    %edi,-0x40(%ebp)
+ b09:	89 55 bc             	mov    %edx,-0x44(%ebp)
+ b0c:	8b 18                	mov    (%eax),%ebx
+ b0e:	8b 48 04             	mov    0x4(%eax),%ecx
+  i = 0;
+ b11:	31 c0                	xor    %eax,%eax
+ b13:	89 c7                	mov    %eax,%edi
+ b15:	8d 76 00             	lea    0x0(%esi),%esi
+  r = (uint)(n >> 32) % d;
+ b18:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  hi = (uint)(n >> 32) / d;
+ b1d:	89 ce                	mov    %ecx,%esi
+  r = (uint)(n >> 32) % d;
+ b1f:	f7 e1                	mul    %ecx
+ b21:	c1 ea 03             	shr    $0x3,%edx
+ b24:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ b27:	89 d1                	mov    %edx,%ecx
+ b29:	01 c0                	add    %eax,%eax
+ b2b:	29 c6                	sub    %eax,%esi
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ b2d:	89 d8                	mov    %ebx,%eax
+  r = (uint)(n >> 32) % d;
+ b2f:	89 f2                	mov    %esi,%edx
+  asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+ b31:	be 0a 00 00 00       	mov    $0xa,%esi
+ b36:	f7 f6                	div    %esi
+  return ((uint64)hi << 32) | lo;
+ b38:	89 da                	mov    %ebx,%edx
+ b3a:	89 c3                	mov    %eax,%ebx
+    buf[i++] = '0' + (x - q*10);
+ b3c:	89 fe                	mov    %edi,%esi
+ b3e:	83 c7 01             	add    $0x1,%edi
+ b41:	8d 42 30             	lea    0x30(%edx),%eax
+ b44:	89 da                	mov    %ebx,%edx
+ b46:	8d 14 92             	lea    (%edx,%edx,4),%edx
+ b49:	01 d2                	add    %edx,%edx
+ b4b:	29 d0                	sub    %edx,%eax
+ b4d:	88 44 3d d3          	mov    %al,-0x2d(%ebp,%edi,1)
+  }while((x = q) != 0);
+ b51:	89 c8                	mov    %ecx,%eax
+ b53:	09 d8                	or     %ebx,%eax
+ b55:	75 c1                	jne    b18 <printf+0x1a8>
+ b57:	8b 55 bc             	mov    -0x44(%ebp),%edx
+ b5a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ b5d:	01 d6                	add    %edx,%esi
+ b5f:	89 f7                	mov    %esi,%edi
+ b61:	89 d6                	mov    %edx,%esi
+ b63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b67:	90                   	nop
+    putc(fd, buf[i]);
+ b68:	0f b6 17             	movzbl (%edi),%edx
+  bufwrite(fd, &c, 1);
+ b6b:	83 ec 04             	sub    $0x4,%esp
+ b6e:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+ b71:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+ b74:	6a 01                	push   $0x1
+ b76:	50                   	push   %eax
+ b77:	53                   	push   %ebx
+ b78:	e8 b3 f4 ff ff       	call   30 <bufwrite>
+  while(--i >= 0)
+ b7d:	89 fa                	mov    %edi,%edx
+ b7f:	83 c4 10             	add    $0x10,%esp
+ b82:	83 ef 01             	sub    $0x1,%edi
+ b85:	39 d6                	cmp    %edx,%esi
+ b87:	75 df                	jne    b68 <printf+0x1f8>
+        ap += 2;
+ b89:	83 45 c4 08          	addl   $0x8,-0x3c(%ebp)
+ b8d:	8b 7d c0             	mov    -0x40(%ebp),%edi
+      state = 0;
+ b90:	31 f6                	xor    %esi,%esi
+ b92:	e9 15 fe ff ff       	jmp    9ac <printf+0x3c>
+ b97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b9e:	66 90                	xchg   %ax,%ax
+  bufwrite(fd, &c, 1);
+ ba0:	83 ec 04             	sub    $0x4,%esp
+ ba3:	88 5d d4             	mov    %bl,-0x2c(%ebp)
+ ba6:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+ ba9:	6a 01                	push   $0x1
+ bab:	e9 8b fe ff ff       	jmp    a3b <printf+0xcb>
+
+00000bb0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ bb0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bb1:	a1 a0 23 00 00       	mov    0x23a0,%eax
+{
+ bb6:	89 e5                	mov    %esp,%ebp
+ bb8:	57                   	push   %edi
+ bb9:	56                   	push   %esi
+ bba:	53                   	push   %ebx
+ bbb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ bbe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bc8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ bca:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bcc:	39 ca                	cmp    %ecx,%edx
+ bce:	73 30                	jae    c00 <free+0x50>
+ bd0:	39 c1                	cmp    %eax,%ecx
+ bd2:	72 04                	jb     bd8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ bd4:	39 c2                	cmp    %eax,%edx
+ bd6:	72 f0                	jb     bc8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ bd8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ bdb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ bde:	39 f8                	cmp    %edi,%eax
+ be0:	74 2e                	je     c10 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ be2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ be5:	8b 42 04             	mov    0x4(%edx),%eax
+ be8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ beb:	39 f1                	cmp    %esi,%ecx
+ bed:	74 38                	je     c27 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ bef:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ bf1:	5b                   	pop    %ebx
+  freep = p;
+ bf2:	89 15 a0 23 00 00    	mov    %edx,0x23a0
+}
+ bf8:	5e                   	pop    %esi
+ bf9:	5f                   	pop    %edi
+ bfa:	5d                   	pop    %ebp
+ bfb:	c3                   	ret
+ bfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c00:	39 c1                	cmp    %eax,%ecx
+ c02:	72 d0                	jb     bd4 <free+0x24>
+ c04:	eb c2                	jmp    bc8 <free+0x18>
+ c06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c0d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ c10:	03 70 04             	add    0x4(%eax),%esi
+ c13:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c16:	8b 02                	mov    (%edx),%eax
+ c18:	8b 00                	mov    (%eax),%eax
+ c1a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ c1d:	8b 42 04             	mov    0x4(%edx),%eax
+ c20:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c23:	39 f1                	cmp    %esi,%ecx
+ c25:	75 c8                	jne    bef <free+0x3f>
+    p->s.size += bp->s.size;
+ c27:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ c2a:	89 15 a0 23 00 00    	mov    %edx,0x23a0
+    p->s.size += bp->s.size;
+ c30:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ c33:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ c36:	89 0a                	mov    %ecx,(%edx)
+}
+ c38:	5b                   	pop    %ebx
+ c39:	5e                   	pop    %esi
+ c3a:	5f                   	pop    %edi
+ c3b:	5d                   	pop    %ebp
+ c3c:	c3                   	ret
+ c3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c40 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ c40:	55                   	push   %ebp
+ c41:	89 e5                	mov    %esp,%ebp
+ c43:	57                   	push   %edi
+ c44:	56                   	push   %esi
+ c45:	53                   	push   %ebx
+ c46:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c49:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ c4c:	8b 15 a0 23 00 00    	mov    0x23a0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c52:	8d 78 07             	lea    0x7(%eax),%edi
+ c55:	c1 ef 03             	shr    $0x3,%edi
+ c58:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ c5b:	85 d2                	test   %edx,%edx
+ c5d:	0f 84 8d 00 00 00    	je     cf0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c63:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c65:	8b 48 04             	mov    0x4(%eax),%ecx
+ c68:	39 f9                	cmp    %edi,%ecx
+ c6a:	73 64                	jae    cd0 <malloc+0x90>
+  if(nu < 4096)
+ c6c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ c71:	39 df                	cmp    %ebx,%edi
+ c73:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ c76:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ c7d:	eb 0a                	jmp    c89 <malloc+0x49>
+ c7f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c80:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c82:	8b 48 04             	mov    0x4(%eax),%ecx
+ c85:	39 f9                	cmp    %edi,%ecx
+ c87:	73 47                	jae    cd0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ c89:	89 c2                	mov    %eax,%edx
+ c8b:	39 05 a0 23 00 00    	cmp    %eax,0x23a0
+ c91:	75 ed                	jne    c80 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ c93:	83 ec 0c             	sub    $0xc,%esp
+ c96:	56                   	push   %esi
+ c97:	e8 c7 fa ff ff       	call   763 <sbrk>
+  if(p == (char*)-1)
+ c9c:	83 c4 10             	add    $0x10,%esp
+ c9f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ca2:	74 1c                	je     cc0 <malloc+0x80>
+  hp->s.size = nu;
+ ca4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ ca7:	83 ec 0c             	sub    $0xc,%esp
+ caa:	83 c0 08             	add    $0x8,%eax
+ cad:	50                   	push   %eax
+ cae:	e8 fd fe ff ff       	call   bb0 <free>
+  return freep;
+ cb3:	8b 15 a0 23 00 00    	mov    0x23a0,%edx
+      if((p = morecore(nunits)) == 0)
+ cb9:	83 c4 10             	add    $0x10,%esp
+ cbc:	85 d2                	test   %edx,%edx
+ cbe:	75 c0                	jne    c80 <malloc+0x40>
+        return 0;
+  }
+}
+ cc0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ cc3:	31 c0                	xor    %eax,%eax
+}
+ cc5:	5b                   	pop    %ebx
+ cc6:	5e                   	pop    %esi
+ cc7:	5f                   	pop    %edi
+ cc8:	5d                   	pop    %ebp
+ cc9:	c3                   	ret
+ cca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ cd0:	39 cf                	cmp    %ecx,%edi
+ cd2:	74 4c                	je     d20 <malloc+0xe0>
+        p->s.size -= nunits;
+ cd4:	29 f9                	sub    %edi,%ecx
+ cd6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ cd9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ cdc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ cdf:	89 15 a0 23 00 00    	mov    %edx,0x23a0
+}
+ ce5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ ce8:	83 c0 08             	add    $0x8,%eax
+}
+ ceb:	5b                   	pop    %ebx
+ cec:	5e                   	pop    %esi
+ ced:	5f                   	pop    %edi
+ cee:	5d                   	pop    %ebp
+ cef:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ cf0:	c7 05 a0 23 00 00 a4 	movl   $0x23a4,0x23a0
+ cf7:	23 00 00 
+    base.s.size = 0;
+ cfa:	b8 a4 23 00 00       	mov    $0x23a4,%eax
+    base.s.ptr = freep = prevp = &base;
+ cff:	c7 05 a4 23 00 00 a4 	movl   $0x23a4,0x23a4
+ d06:	23 00 00 
+    base.s.size = 0;
+ d09:	c7 05 a8 23 00 00 00 	movl   $0x0,0x23a8
+ d10:	00 00 00 
+    if(p->s.size >= nunits){
+ d13:	e9 54 ff ff ff       	jmp    c6c <malloc+0x2c>
+ d18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d1f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ d20:	8b 08                	mov    (%eax),%ecx
+ d22:	89 0a                	mov    %ecx,(%edx)
+ d24:	eb b9                	jmp    cdf <malloc+0x9f>
+ d26:	66 90                	xchg   %ax,%ax
+ d28:	66 90                	xchg   %ax,%ax
+ d2a:	66 90                	xchg   %ax,%ax
+ d2c:	66 90                	xchg   %ax,%ax
+ d2e:	66 90                	xchg   %ax,%ax
+
+00000d30 <waitpoll>:
+
+// Call fn about once a tick until process pid, a child,
+// has exited, then wait() for it.
+void
+waitpoll(int pid, void (*fn)(void))
+{
+ d30:	55                   	push   %ebp
+ d31:	89 e5                	mov    %esp,%ebp
+ d33:	57                   	push   %edi
+ d34:	56                   	push   %esi
+ d35:	be 01 00 00 00       	mov    $0x1,%esi
+ d3a:	53                   	push   %ebx
+ d3b:	83 ec 28             	sub    $0x28,%esp
+ d3e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ d41:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ d44:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct procinfo *pi;
+  int i, n, alive;
+
+  if((pi = malloc(NPROC * sizeof(*pi))) == 0){
+ d47:	68 00 98 00 00       	push   $0x9800
+ d4c:	e8 ef fe ff ff       	call   c40 <malloc>
+ d51:	83 c4 10             	add    $0x10,%esp
+ d54:	89 c7                	mov    %eax,%edi
+ d56:	85 c0                	test   %eax,%eax
+ d58:	74 62                	je     dbc <waitpoll+0x8c>
+ d5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    return;
+  }
+  do {
+    sleep(1);
+ d60:	83 ec 0c             	sub    $0xc,%esp
+ d63:	6a 01                	push   $0x1
+ d65:	e8 03 fa ff ff       	call   76d <sleep>
+    fn();
+ d6a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ d6d:	ff d0                	call   *%eax
+    n = getprocinfo(pi, NPROC);
+ d6f:	58                   	pop    %eax
+ d70:	5a                   	pop    %edx
+ d71:	68 00 02 00 00       	push   $0x200
+ d76:	57                   	push   %edi
+ d77:	e8 eb fa ff ff       	call   867 <getprocinfo>
+    alive = 0;
+    for(i = 0; i < n; i++)
+ d7c:	83 c4 10             	add    $0x10,%esp
+ d7f:	85 c0                	test   %eax,%eax
+ d81:	7e 2d                	jle    db0 <waitpoll+0x80>
+ d83:	6b c0 4c             	imul   $0x4c,%eax,%eax
+ d86:	89 fa                	mov    %edi,%edx
+    alive = 0;
+ d88:	31 c9                	xor    %ecx,%ecx
+ d8a:	01 f8                	add    %edi,%eax
+ d8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(pi[i].pid == pid && pi[i].state != PS_ZOMBIE)
+ d90:	3b 1a                	cmp    (%edx),%ebx
+ d92:	75 07                	jne    d9b <waitpoll+0x6b>
+        alive = 1;
+ d94:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+ d98:	0f 45 ce             	cmovne %esi,%ecx
+    for(i = 0; i < n; i++)
+ d9b:	83 c2 4c             	add    $0x4c,%edx
+ d9e:	39 d0                	cmp    %edx,%eax
+ da0:	75 ee                	jne    d90 <waitpoll+0x60>
+  } while(alive);
+ da2:	85 c9                	test   %ecx,%ecx
+ da4:	75 ba                	jne    d60 <waitpoll+0x30>
+ da6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dad:	8d 76 00             	lea    0x0(%esi),%esi
+  free(pi);
+ db0:	83 ec 0c             	sub    $0xc,%esp
+ db3:	57                   	push   %edi
+ db4:	e8 f7 fd ff ff       	call   bb0 <free>
+  wait();
+ db9:	83 c4 10             	add    $0x10,%esp
+}
+ dbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ dbf:	5b                   	pop    %ebx
+ dc0:	5e                   	pop    %esi
+ dc1:	5f                   	pop    %edi
+ dc2:	5d                   	pop    %ebp
+  wait();
+ dc3:	e9 10 f9 ff ff       	jmp    6d8 <wait>
+ dc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dcf:	90                   	nop
+
+00000dd0 <runps>:
+
+// Run the ps program and wait for it.  wait() takes any
+// child, so the caller must have no others left to reap.
+int
+runps(void)
+{
+ dd0:	55                   	push   %ebp
+ dd1:	89 e5                	mov    %esp,%ebp
+ dd3:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { "ps", 0 };
+ dd6:	c7 45 f0 91 0e 00 00 	movl   $0xe91,-0x10(%ebp)
+ ddd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  int pid;
+
+  if((pid = fork()) < 0)
+ de4:	e8 87 f4 ff ff       	call   270 <fork>
+ de9:	85 c0                	test   %eax,%eax
+ deb:	78 09                	js     df6 <runps+0x26>
+    return -1;
+  if(pid == 0){
+ ded:	74 0e                	je     dfd <runps+0x2d>
+    exec("ps", argv);
+    printf(2, "exec ps failed\n");
+    exit();
+  }
+  return wait();
+ def:	e8 e4 f8 ff ff       	call   6d8 <wait>
+}
+ df4:	c9                   	leave
+ df5:	c3                   	ret
+ df6:	c9                   	leave
+    return -1;
+ df7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ dfc:	c3                   	ret
+    exec("ps", argv);
+ dfd:	50                   	push   %eax
+ dfe:	50                   	push   %eax
+ dff:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ e02:	50                   	push   %eax
+ e03:	68 91 0e 00 00       	push   $0xe91
+ e08:	e8 c3 f4 ff ff       	call   2d0 <exec>
+    printf(2, "exec ps failed\n");
+ e0d:	5a                   	pop    %edx
+ e0e:	59                   	pop    %ecx
+ e0f:	68 94 0e 00 00       	push   $0xe94
+ e14:	6a 02                	push   $0x2
+ e16:	e8 55 fb ff ff       	call   970 <printf>
+    exit();
+ e1b:	e8 a0 f4 ff ff       	call   2c0 <exit>